@@ -25,6 +25,8 @@
  **************************************************************************************/
 
 #define SECTSIZE 512
+// 每条磁盘读命令读取的扇区数(1~255)
+#define BATCH 64
 // 定义一个指向内存中 ELF 文件头存放位置的结构体指针
 // (类似于数组名，不可以通过指针修改指向变量的值)
 // 0x10000 已经是是高地址的最低处，也可以是其它高地址处
@@ -74,75 +76,50 @@ void bootmain(void)
 	((void (*)(void))((uint32_t)(ELFHDR->e_entry)))();
 }
 
+static void
+waitdisk(void)
+{
+	// 循环等待磁盘就绪(BSY 清零，DRDY 置位)
+	while ((inb(0x1F7) & 0xC0) != 0x40)
+		;
+}
+
 // 从内核的 offset 处读取 count 个字节到物理地址 pa 处
 // 可能读取会超过count个（扇区对齐）
+// 每条 READ SECTORS 命令固定读取 BATCH 个扇区，而不是每个扇区一条命令(PIO 仍需每个扇区等待一次 DRQ)
+// 每条命令的扇区都要全部读出，因此最多会多读 BATCH-1 个扇区
 void readseg(uint32_t pa, uint32_t count, uint32_t offset)
 {
-	uint32_t end_pa;
+	uint32_t end_pa, n;
 
 	// 结束物理地址
 	end_pa = pa + count;
-	// 偏移地址
-	uint32_t orgoff = offset;
 
 	// 向下舍入到扇区边界
 	pa &= ~(SECTSIZE - 1);
 
-	// offset 从字节转换为硬盘的第i扇区，内核从扇区3开始，
+	// offset 从字节转换为硬盘的第i扇区，内核从扇区1开始
 	offset = (offset / SECTSIZE) + 1;
 
-	// 如果速度太慢，可以一次读取许多扇区.
 	// 会在内存中写入比要求的更多的内容，但是没关系 —— 以递增的顺序加载.
-	while (pa < end_pa)
+	for (n = 0; n || pa < end_pa; n--, pa += SECTSIZE)
 	{
-		// 循环等待磁盘就绪
-		while ((inb(0x1F7) & 0xC0) != 0x40)
-			;
-
-		outb(0x1F2, 1);
-		outb(0x1F3, offset);
-		outb(0x1F4, offset >> 8);
-		outb(0x1F5, offset >> 16);
-		outb(0x1F6, (offset >> 24) | 0xE0);
-		outb(0x1F7, 0x20);
-
-		// 循环等待磁盘就绪
-		while ((inb(0x1F7) & 0xC0) != 0x40)
-			;
-
-		// 读取一个扇区，数据存放在内存中的 pa
+		// 上一条命令的扇区已读完，发出一条新命令
+		if (n == 0)
+		{
+			waitdisk();
+			outb(0x1F2, BATCH);
+			outb(0x1F3, offset);
+			outb(0x1F4, offset >> 8);
+			outb(0x1F5, offset >> 16);
+			outb(0x1F6, (offset >> 24) | 0xE0);
+			outb(0x1F7, 0x20);
+			offset += BATCH;
+			n = BATCH;
+		}
+
+		// 循环等待磁盘就绪，读取一个扇区，数据存放在内存中的 pa
+		waitdisk();
 		insl(0x1F0, (uint8_t *)pa, SECTSIZE / 4);
-
-		pa += SECTSIZE;
-		offset++;
 	}
 }
-/*
-void
-waitdisk(void)
-{
-	// wait for disk ready
-	while ((inb(0x1F7) & 0xC0) != 0x40)
-		;
-}
-
-void
-readsect(void *dst, uint32_t offset)
-{
-	// wait for disk to be ready
-	waitdisk();
-
-	outb(0x1F2, 1);		// count = 1
-	outb(0x1F3, offset);
-	outb(0x1F4, offset >> 8);
-	outb(0x1F5, offset >> 16);
-	outb(0x1F6, (offset >> 24) | 0xE0);
-	outb(0x1F7, 0x20);	// cmd 0x20 - read sectors
-
-	// wait for disk to be ready
-	waitdisk();
-
-	// read a sector
-	insl(0x1F0, dst, SECTSIZE/4);
-}
-*/
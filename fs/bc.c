@@ -0,0 +1,84 @@
+/**
+ * 文件系统服务器的块缓存
+ * 整个磁盘映射在 [DISKMAP, DISKMAP+DISKSIZE)，首次访问某块时产生页错误，
+ * 由 bc_pgfault() 分配物理页并通过 sys_disk_io() 从磁盘读入(读入期间服务器阻塞，内核可以调度其他环境)
+ * 页表项的 Dirty 位记录块是否被修改，flush_block() 只写回被修改过的块
+ *
+ * 缓存页同时会以只读、PTE_SHARE 的方式映射给客户端(FSREQ_MAP)，客户端通过映射看到的就是服务器缓存中的最新数据；
+ * 服务器不回收缓存页，只在释放块时把仍被客户端映射的缓存页解除映射(free_block)，块重新分配后使用新的物理页
+ */
+#include "fs/fs.h"
+
+// 返回块 blockno 在块缓存中的虚拟地址
+void *
+diskaddr(uint32_t blockno)
+{
+	if (blockno == 0 || (super && blockno >= super->s_nblocks))
+		panic("bad block number %08x in diskaddr", blockno);
+	return (char *)(DISKMAP + (uint64_t)blockno * BLKSIZE);
+}
+
+// 虚拟地址 va 所在的页是否被写过
+bool va_is_dirty(void *va)
+{
+	return (uvpt[VPN(va)] & PTE_D) != 0;
+}
+
+/**
+ * 块缓存的页错误处理函数：为出错地址所在的块分配物理页并从磁盘读入
+ */
+static void
+bc_pgfault(struct UTrapframe *utf)
+{
+	void *addr = (void *)utf->utf_fault_va;
+	uint32_t blockno = ((uint64_t)addr - DISKMAP) / BLKSIZE;
+	int r;
+
+	// 检查出错地址是否在块缓存区域内
+	if ((uint64_t)addr < DISKMAP || (uint64_t)addr >= DISKMAP + DISKSIZE)
+		panic("page fault in FS: rip %08lx, va %08lx, err %04x",
+			  utf->utf_rip, (uint64_t)addr, utf->utf_err);
+
+	// 检查块号是否合法
+	if (super && blockno >= super->s_nblocks)
+		panic("reading non-existent block %08x\n", blockno);
+
+	addr = ROUNDDOWN(addr, BLKSIZE);
+	if ((r = sys_page_alloc(0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+		panic("in bc_pgfault, sys_page_alloc: %e", r);
+	if ((r = sys_disk_io(FSDEV, (uint64_t)blockno * BLKSECTS, addr, BLKSECTS, 0)) < 0)
+		panic("in bc_pgfault, sys_disk_io: %e", r);
+
+	// 读入磁盘数据时写了该页，重新映射以清除 Dirty 位
+	if ((r = sys_page_map(0, addr, 0, addr, uvpt[VPN(addr)] & PTE_SYSCALL)) < 0)
+		panic("in bc_pgfault, sys_page_map: %e", r);
+
+	// 检查读入的块是否已分配(读入位图块之前无法检查)
+	if (bitmap && block_is_free(blockno))
+		panic("reading free block %08x\n", blockno);
+}
+
+/**
+ * 如果 addr 所在的块在缓存中且被修改过，将其写回磁盘，然后清除 Dirty 位
+ */
+void flush_block(void *addr)
+{
+	uint32_t blockno = ((uint64_t)addr - DISKMAP) / BLKSIZE;
+	int r;
+
+	if ((uint64_t)addr < DISKMAP || (uint64_t)addr >= DISKMAP + DISKSIZE)
+		panic("flush_block of bad va %08lx", (uint64_t)addr);
+
+	addr = ROUNDDOWN(addr, BLKSIZE);
+	if (!va_is_mapped(addr) || !va_is_dirty(addr))
+		return;
+	if ((r = sys_disk_io(FSDEV, (uint64_t)blockno * BLKSECTS, addr, BLKSECTS, 1)) < 0)
+		panic("in flush_block, sys_disk_io: %e", r);
+	if ((r = sys_page_map(0, addr, 0, addr, uvpt[VPN(addr)] & PTE_SYSCALL)) < 0)
+		panic("in flush_block, sys_page_map: %e", r);
+}
+
+void bc_init(void)
+{
+	set_pgfault_handler(bc_pgfault);
+}
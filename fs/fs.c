@@ -0,0 +1,477 @@
+/**
+ * 文件系统的磁盘布局：
+ * 块 0 保留给引导扇区和分区表，块 1 是超级块，从块 2 开始是空闲块位图，其后是目录和文件数据块
+ * 文件通过 struct File 描述：NDIRECT 个直接块指针和一个间接块(最多 NINDIRECT 个块号)
+ * 目录是内容为 struct File 数组的文件
+ */
+#include "inc/string.h"
+
+#include "fs/fs.h"
+
+struct Super *super;
+uint32_t *bitmap;
+
+/* ---------------------------- 超级块 ---------------------------- */
+
+// 检查超级块
+static void
+check_super(void)
+{
+	if (super->s_magic != FS_MAGIC)
+		panic("bad file system magic number");
+
+	if (super->s_nblocks > DISKSIZE / BLKSIZE)
+		panic("file system is too large");
+
+	cprintf("superblock is good\n");
+}
+
+/* ---------------------------- 空闲块位图 ---------------------------- */
+
+// 块 blockno 是否空闲
+bool block_is_free(uint32_t blockno)
+{
+	if (super == 0 || blockno >= super->s_nblocks)
+		return 0;
+	if (bitmap[blockno / 32] & (1 << (blockno % 32)))
+		return 1;
+	return 0;
+}
+
+/**
+ * 在位图中将块标记为空闲
+ * 客户端可能仍映射着该块的缓存页(FSREQ_MAP)，因此先把缓存页从服务器中解除映射：
+ * 客户端保留原来的物理页(仍是其打开的文件的数据)，块被重新分配后由 bc_pgfault 分配新的物理页，
+ * 其他文件的数据不会出现在客户端的映射中
+ */
+static void
+free_block(uint32_t blockno)
+{
+	void *addr;
+	int r;
+
+	// 块 0 永远不会被释放
+	if (blockno == 0)
+		panic("attempt to free zero block");
+	addr = diskaddr(blockno);
+	if (pageref(addr) > 1 && (r = sys_page_unmap(0, addr)) < 0)
+		panic("free_block: sys_page_unmap: %e", r);
+	bitmap[blockno / 32] |= 1 << (blockno % 32);
+}
+
+/**
+ * 在位图中查找一个空闲块并标记为已使用，返回块号
+ * 修改位图后立即将其写回磁盘，以保持位图的一致性
+ * 没有空闲块时返回 -E_NO_DISK
+ */
+int alloc_block(void)
+{
+	uint32_t blockno;
+
+	for (blockno = 2; blockno < super->s_nblocks; blockno++)
+		if (block_is_free(blockno))
+		{
+			bitmap[blockno / 32] &= ~(1 << (blockno % 32));
+			flush_block(&bitmap[blockno / 32]);
+			return blockno;
+		}
+	return -E_NO_DISK;
+}
+
+// 检查保留块和位图块都已标记为使用
+static void
+check_bitmap(void)
+{
+	uint32_t i;
+
+	// 确保所有位图块都标记为使用
+	for (i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+		assert(!block_is_free(2 + i));
+
+	// 确保保留块和超级块都标记为使用
+	assert(!block_is_free(0));
+	assert(!block_is_free(1));
+
+	cprintf("bitmap is good\n");
+}
+
+/* ---------------------------- 文件系统结构 ---------------------------- */
+
+// 初始化文件系统
+void fs_init(void)
+{
+	static_assert(sizeof(struct File) == 256);
+
+	bc_init();
+
+	// 设置超级块和位图指针，首次访问时块缓存从磁盘读入
+	super = diskaddr(1);
+	check_super();
+
+	bitmap = diskaddr(2);
+	check_bitmap();
+}
+
+/**
+ * 查找文件 f 中第 filebno 个块的块号所在的槽，存入 *ppdiskbno
+ * 槽可能是 f->f_direct[] 中的一项，也可能是间接块中的一项
+ * 需要间接块而间接块不存在时，若 alloc 为真则分配一个(清零)
+ * 错误:
+ *   -E_NOT_FOUND: 需要间接块但 alloc 为 0
+ *   -E_NO_DISK: 无法分配间接块
+ *   -E_INVAL: filebno 超出范围
+ */
+static int
+file_block_walk(struct File *f, uint32_t filebno, uint32_t **ppdiskbno, bool alloc)
+{
+	int r;
+
+	if (filebno >= NDIRECT + NINDIRECT)
+		return -E_INVAL;
+	if (filebno < NDIRECT)
+	{
+		*ppdiskbno = &f->f_direct[filebno];
+		return 0;
+	}
+	if (!f->f_indirect)
+	{
+		if (!alloc)
+			return -E_NOT_FOUND;
+		if ((r = alloc_block()) < 0)
+			return r;
+		f->f_indirect = r;
+		memset(diskaddr(r), 0, BLKSIZE);
+		flush_block(diskaddr(r));
+	}
+	*ppdiskbno = (uint32_t *)diskaddr(f->f_indirect) + (filebno - NDIRECT);
+	return 0;
+}
+
+/**
+ * 将 *blk 设置为文件 f 第 filebno 个块在块缓存中的地址，块不存在时分配
+ * 错误:
+ *   -E_NO_DISK: 无法分配块
+ *   -E_INVAL: filebno 超出范围
+ */
+int file_get_block(struct File *f, uint32_t filebno, char **blk)
+{
+	uint32_t *pdiskbno;
+	int r;
+
+	if ((r = file_block_walk(f, filebno, &pdiskbno, 1)) < 0)
+		return r;
+	if (!*pdiskbno)
+	{
+		if ((r = alloc_block()) < 0)
+			return r;
+		*pdiskbno = r;
+		memset(diskaddr(r), 0, BLKSIZE);
+		flush_block(diskaddr(r));
+	}
+	*blk = diskaddr(*pdiskbno);
+	return 0;
+}
+
+/**
+ * 在目录 dir 中查找名为 name 的文件，找到时 *file 指向该文件的 struct File
+ * 错误: -E_NOT_FOUND
+ */
+static int
+dir_lookup(struct File *dir, const char *name, struct File **file)
+{
+	uint32_t i, j, nblock;
+	char *blk;
+	struct File *f;
+	int r;
+
+	assert((dir->f_size % BLKSIZE) == 0);
+	nblock = dir->f_size / BLKSIZE;
+	for (i = 0; i < nblock; i++)
+	{
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+			return r;
+		f = (struct File *)blk;
+		for (j = 0; j < BLKFILES; j++)
+			if (strcmp(f[j].f_name, name) == 0)
+			{
+				*file = &f[j];
+				return 0;
+			}
+	}
+	return -E_NOT_FOUND;
+}
+
+// 在目录 dir 中找到一个空闲的 struct File(必要时扩展目录)，存入 *file
+static int
+dir_alloc_file(struct File *dir, struct File **file)
+{
+	uint32_t nblock, i, j;
+	char *blk;
+	struct File *f;
+	int r;
+
+	assert((dir->f_size % BLKSIZE) == 0);
+	nblock = dir->f_size / BLKSIZE;
+	for (i = 0; i < nblock; i++)
+	{
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+			return r;
+		f = (struct File *)blk;
+		for (j = 0; j < BLKFILES; j++)
+			if (f[j].f_name[0] == '\0')
+			{
+				*file = &f[j];
+				return 0;
+			}
+	}
+	dir->f_size += BLKSIZE;
+	if ((r = file_get_block(dir, i, &blk)) < 0)
+		return r;
+	f = (struct File *)blk;
+	*file = &f[0];
+	return 0;
+}
+
+// 跳过开头的 '/'
+static const char *
+skip_slash(const char *p)
+{
+	while (*p == '/')
+		p++;
+	return p;
+}
+
+/**
+ * 从根目录开始解析路径 path
+ * 成功时 *pf 为文件，*pdir 为其所在目录
+ * 只有最后一个路径分量不存在时，*pdir 为其所在目录、*pf 为 0，lastelem 中存放该分量，返回 -E_NOT_FOUND
+ */
+static int
+walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem)
+{
+	const char *p;
+	char name[MAXNAMELEN];
+	struct File *dir, *f;
+	int r;
+
+	path = skip_slash(path);
+	f = &super->s_root;
+	dir = 0;
+	name[0] = 0;
+
+	if (pdir)
+		*pdir = 0;
+	*pf = 0;
+	while (*path != '\0')
+	{
+		dir = f;
+		p = path;
+		while (*path != '/' && *path != '\0')
+			path++;
+		if (path - p >= MAXNAMELEN)
+			return -E_BAD_PATH;
+		memmove(name, p, path - p);
+		name[path - p] = '\0';
+		path = skip_slash(path);
+
+		if (dir->f_type != FTYPE_DIR)
+			return -E_NOT_FOUND;
+
+		if ((r = dir_lookup(dir, name, &f)) < 0)
+		{
+			if (r == -E_NOT_FOUND && *path == '\0')
+			{
+				if (pdir)
+					*pdir = dir;
+				if (lastelem)
+					strcpy(lastelem, name);
+				*pf = 0;
+			}
+			return r;
+		}
+	}
+
+	if (pdir)
+		*pdir = dir;
+	*pf = f;
+	return 0;
+}
+
+/* ---------------------------- 文件操作 ---------------------------- */
+
+// 创建文件 path，成功时 *pf 为新文件；文件已存在时返回 -E_FILE_EXISTS
+int file_create(const char *path, struct File **pf)
+{
+	char name[MAXNAMELEN];
+	int r;
+	struct File *dir, *f;
+
+	if ((r = walk_path(path, &dir, &f, name)) == 0)
+		return -E_FILE_EXISTS;
+	if (r != -E_NOT_FOUND || dir == 0)
+		return r;
+	if ((r = dir_alloc_file(dir, &f)) < 0)
+		return r;
+
+	strcpy(f->f_name, name);
+	*pf = f;
+	file_flush(dir);
+	return 0;
+}
+
+// 打开文件 path，成功时 *pf 为该文件
+int file_open(const char *path, struct File **pf)
+{
+	return walk_path(path, 0, pf, 0);
+}
+
+/**
+ * 从文件 f 的 offset 处读取 count 字节到 buf
+ * 返回读取的字节数，到达文件末尾时少于 count
+ */
+ssize_t
+file_read(struct File *f, void *buf, size_t count, off_t offset)
+{
+	int r, bn;
+	off_t pos;
+	char *blk;
+
+	if (offset >= f->f_size)
+		return 0;
+
+	count = MIN(count, f->f_size - offset);
+
+	for (pos = offset; pos < offset + count;)
+	{
+		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+			return r;
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+		memmove(buf, blk + pos % BLKSIZE, bn);
+		pos += bn;
+		buf += bn;
+	}
+
+	return count;
+}
+
+/**
+ * 将 buf 中的 count 字节写入文件 f 的 offset 处，必要时扩展文件
+ * 返回写入的字节数
+ */
+int file_write(struct File *f, const void *buf, size_t count, off_t offset)
+{
+	int r, bn;
+	off_t pos;
+	char *blk;
+
+	// 必要时扩展文件
+	if (offset + count > f->f_size)
+		if ((r = file_set_size(f, offset + count)) < 0)
+			return r;
+
+	for (pos = offset; pos < offset + count;)
+	{
+		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+			return r;
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+		memmove(blk + pos % BLKSIZE, buf, bn);
+		pos += bn;
+		buf += bn;
+	}
+
+	return count;
+}
+
+// 释放文件 f 的第 filebno 个块(如果存在)
+static int
+file_free_block(struct File *f, uint32_t filebno)
+{
+	int r;
+	uint32_t *ptr;
+
+	if ((r = file_block_walk(f, filebno, &ptr, 0)) < 0)
+		return r;
+	if (*ptr)
+	{
+		free_block(*ptr);
+		*ptr = 0;
+	}
+	return 0;
+}
+
+/**
+ * 释放文件 f 在新大小 newsize 之外的块
+ * 新大小不需要间接块时，同时释放间接块
+ */
+static void
+file_truncate_blocks(struct File *f, off_t newsize)
+{
+	int r;
+	uint32_t bno, old_nblocks, new_nblocks;
+
+	old_nblocks = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+	new_nblocks = (newsize + BLKSIZE - 1) / BLKSIZE;
+	for (bno = new_nblocks; bno < old_nblocks; bno++)
+		if ((r = file_free_block(f, bno)) < 0)
+			cprintf("warning: file_free_block: %e", r);
+
+	if (new_nblocks <= NDIRECT && f->f_indirect)
+	{
+		free_block(f->f_indirect);
+		f->f_indirect = 0;
+	}
+}
+
+// 设置文件 f 的大小，缩小时释放多余的块
+int file_set_size(struct File *f, off_t newsize)
+{
+	if (f->f_size > newsize)
+		file_truncate_blocks(f, newsize);
+	f->f_size = newsize;
+	flush_block(f);
+	return 0;
+}
+
+// 将文件 f 的内容和元数据写回磁盘
+void file_flush(struct File *f)
+{
+	uint32_t i;
+	uint32_t *pdiskbno;
+
+	for (i = 0; i < (f->f_size + BLKSIZE - 1) / BLKSIZE; i++)
+	{
+		if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+			pdiskbno == NULL || *pdiskbno == 0)
+			continue;
+		flush_block(diskaddr(*pdiskbno));
+	}
+	flush_block(f);
+	if (f->f_indirect)
+		flush_block(diskaddr(f->f_indirect));
+}
+
+// 删除文件 path
+int file_remove(const char *path)
+{
+	int r;
+	struct File *f;
+
+	if ((r = walk_path(path, 0, &f, 0)) < 0)
+		return r;
+
+	file_truncate_blocks(f, 0);
+	f->f_name[0] = '\0';
+	f->f_size = 0;
+	flush_block(f);
+
+	return 0;
+}
+
+// 将整个块缓存写回磁盘
+void fs_sync(void)
+{
+	uint32_t i;
+
+	for (i = 1; i < super->s_nblocks; i++)
+		flush_block(diskaddr(i));
+}
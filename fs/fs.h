@@ -0,0 +1,46 @@
+#ifndef ALVOS_FS_FS_H
+#define ALVOS_FS_FS_H
+
+#include "inc/fs.h"
+#include "inc/lib.h"
+
+// 文件系统所在的磁盘(IDE 主通道的 slave，即 hdb)
+#define FSDEV 1
+
+#define SECTSIZE 512					// 磁盘扇区大小
+#define BLKSECTS (BLKSIZE / SECTSIZE) // 每个文件系统块包含的扇区数
+
+/**
+ * 块缓存：磁盘映射到文件系统服务器地址空间的 [DISKMAP, DISKMAP+DISKSIZE)
+ * 第 n 块位于 DISKMAP + n*BLKSIZE，首次访问时由 bc.c 的页错误处理函数从磁盘读入
+ */
+#define DISKMAP 0x10000000
+
+// 支持的最大磁盘大小
+#define DISKSIZE 0xC0000000
+
+extern struct Super *super; // 超级块
+extern uint32_t *bitmap;	// 空闲块位图，位为 1 表示块空闲
+
+/* bc.c */
+void *diskaddr(uint32_t blockno);
+bool va_is_dirty(void *va);
+void flush_block(void *addr);
+void bc_init(void);
+
+/* fs.c */
+void fs_init(void);
+int file_get_block(struct File *f, uint32_t file_blockno, char **pblk);
+int file_create(const char *path, struct File **f);
+int file_open(const char *path, struct File **f);
+ssize_t file_read(struct File *f, void *buf, size_t count, off_t offset);
+int file_write(struct File *f, const void *buf, size_t count, off_t offset);
+int file_set_size(struct File *f, off_t newsize);
+void file_flush(struct File *f);
+int file_remove(const char *path);
+void fs_sync(void);
+
+bool block_is_free(uint32_t blockno);
+int alloc_block(void);
+
+#endif
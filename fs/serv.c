@@ -0,0 +1,381 @@
+/**
+ * 文件系统服务器的主循环 -- 通过 IPC 接收客户端的请求并处理
+ *
+ * 每个打开的文件对应一个 OpenFile，其 Fd 页以 PTE_SHARE 映射给客户端，客户端与服务器共享偏移和文件大小
+ * 读文件时客户端可以请求 FSREQ_MAP：服务器把文件块所在的块缓存页只读、PTE_SHARE 地映射给客户端，
+ * 数据不经过 IPC 复制；服务器对该块的写入直接反映在客户端的映射中
+ */
+#include "inc/x86.h"
+#include "inc/string.h"
+
+#include "fs/fs.h"
+
+#define debug 0
+
+/**
+ * 打开的文件
+ * o_fd 是映射在 FILEVA + i*PGSIZE 的 Fd 页，客户端关闭文件后该页只剩服务器的引用(pageref == 1)，
+ * 此时 OpenFile 可以重新分配
+ */
+struct OpenFile
+{
+	uint32_t o_fileid;	 // 文件 ID
+	struct File *o_file; // 文件在块缓存中的 struct File
+	int o_mode;			 // 打开模式
+	struct Fd *o_fd;	 // Fd 页
+};
+
+// 同时打开的文件数上限
+#define MAXOPEN 1024
+#define FILEVA 0xD0000000
+
+// 初始化为所有 OpenFile 都未使用
+struct OpenFile opentab[MAXOPEN];
+
+// 接收请求参数页的虚拟地址
+union Fsipc *fsreq = (union Fsipc *)0x0ffff000;
+
+static void
+serve_init(void)
+{
+	int i;
+	uintptr_t va = FILEVA;
+
+	for (i = 0; i < MAXOPEN; i++)
+	{
+		opentab[i].o_fileid = i;
+		opentab[i].o_fd = (struct Fd *)va;
+		va += PGSIZE;
+	}
+}
+
+// 分配一个 OpenFile
+static int
+openfile_alloc(struct OpenFile **o)
+{
+	int i, r;
+
+	for (i = 0; i < MAXOPEN; i++)
+	{
+		switch (pageref(opentab[i].o_fd))
+		{
+		case 0:
+			if ((r = sys_page_alloc(0, opentab[i].o_fd, PTE_P | PTE_U | PTE_W)) < 0)
+				return r;
+			/* fall through */
+		case 1:
+			opentab[i].o_fileid += MAXOPEN;
+			*o = &opentab[i];
+			memset(opentab[i].o_fd, 0, PGSIZE);
+			return (*o)->o_fileid;
+		}
+	}
+	return -E_MAX_OPEN;
+}
+
+// 查找环境 envid 打开的文件 fileid
+static int
+openfile_lookup(envid_t envid, uint32_t fileid, struct OpenFile **po)
+{
+	struct OpenFile *o;
+
+	o = &opentab[fileid % MAXOPEN];
+	if (pageref(o->o_fd) <= 1 || o->o_fileid != fileid)
+		return -E_INVAL;
+	*po = o;
+	return 0;
+}
+
+/**
+ * 以 req->req_omode 打开 req->req_path，Fd 页通过 *pg_store 和 *perm_store 返回给客户端
+ */
+static int
+serve_open(envid_t envid, struct Fsreq_open *req,
+		   void **pg_store, int *perm_store)
+{
+	char path[MAXPATHLEN];
+	struct File *f;
+	int fileid;
+	int r;
+	struct OpenFile *o;
+
+	if (debug)
+		cprintf("serve_open %08x %s 0x%x\n", envid, req->req_path, req->req_omode);
+
+	// 复制路径，确保以 NULL 结尾
+	memmove(path, req->req_path, MAXPATHLEN);
+	path[MAXPATHLEN - 1] = 0;
+
+	if ((r = openfile_alloc(&o)) < 0)
+		return r;
+	fileid = r;
+
+	if (req->req_omode & O_CREAT)
+	{
+		if ((r = file_create(path, &f)) < 0)
+		{
+			if (!(req->req_omode & O_EXCL) && r == -E_FILE_EXISTS)
+				goto try_open;
+			return r;
+		}
+	}
+	else
+	{
+	try_open:
+		if ((r = file_open(path, &f)) < 0)
+			return r;
+	}
+
+	if (req->req_omode & O_TRUNC)
+	{
+		if ((r = file_set_size(f, 0)) < 0)
+			return r;
+	}
+
+	o->o_file = f;
+	o->o_mode = req->req_omode;
+
+	// 填写 Fd 页
+	o->o_fd->fd_file.id = o->o_fileid;
+	o->o_fd->fd_file.size = f->f_size;
+	o->o_fd->fd_omode = req->req_omode & O_ACCMODE;
+	o->o_fd->fd_dev_id = devfile.dev_id;
+
+	if (debug)
+		cprintf("sending success, page %08lx\n", (uintptr_t)o->o_fd);
+
+	// 与客户端共享 Fd 页
+	*pg_store = o->o_fd;
+	*perm_store = PTE_P | PTE_U | PTE_W | PTE_SHARE;
+
+	return 0;
+}
+
+// 设置文件大小
+static int
+serve_set_size(envid_t envid, union Fsipc *ipc)
+{
+	struct Fsreq_set_size *req = &ipc->set_size;
+	struct OpenFile *o;
+	int r;
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	if ((r = file_set_size(o->o_file, req->req_size)) < 0)
+		return r;
+	o->o_fd->fd_file.size = o->o_file->f_size;
+	return 0;
+}
+
+// 从当前偏移读取最多 req_n 字节到请求页，返回读取的字节数
+static int
+serve_read(envid_t envid, union Fsipc *ipc)
+{
+	struct Fsreq_read *req = &ipc->read;
+	struct Fsret_read *ret = &ipc->readRet;
+	struct OpenFile *o;
+	int r;
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	if ((r = file_read(o->o_file, ret->ret_buf, MIN(req->req_n, sizeof(ret->ret_buf)),
+					   o->o_fd->fd_offset)) < 0)
+		return r;
+	o->o_fd->fd_offset += r;
+	return r;
+}
+
+// 将请求页中的 req_n 字节写到当前偏移，返回写入的字节数
+static int
+serve_write(envid_t envid, union Fsipc *ipc)
+{
+	struct Fsreq_write *req = &ipc->write;
+	struct OpenFile *o;
+	int r;
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	if ((r = file_write(o->o_file, req->req_buf, MIN(req->req_n, sizeof(req->req_buf)),
+						o->o_fd->fd_offset)) < 0)
+		return r;
+	o->o_fd->fd_offset += r;
+	o->o_fd->fd_file.size = o->o_file->f_size;
+	return r;
+}
+
+// 返回文件的名称、大小和类型
+static int
+serve_stat(envid_t envid, union Fsipc *ipc)
+{
+	struct Fsreq_stat *req = &ipc->stat;
+	struct Fsret_stat *ret = &ipc->statRet;
+	struct OpenFile *o;
+	int r;
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+
+	strcpy(ret->ret_name, o->o_file->f_name);
+	ret->ret_size = o->o_file->f_size;
+	ret->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+	return 0;
+}
+
+// 将文件写回磁盘
+static int
+serve_flush(envid_t envid, union Fsipc *ipc)
+{
+	struct OpenFile *o;
+	int r;
+
+	if ((r = openfile_lookup(envid, ipc->flush.req_fileid, &o)) < 0)
+		return r;
+	file_flush(o->o_file);
+	return 0;
+}
+
+// 删除文件
+static int
+serve_remove(envid_t envid, union Fsipc *ipc)
+{
+	char path[MAXPATHLEN];
+
+	memmove(path, ipc->remove.req_path, MAXPATHLEN);
+	path[MAXPATHLEN - 1] = 0;
+	return file_remove(path);
+}
+
+// 将整个文件系统写回磁盘
+static int
+serve_sync(envid_t envid, union Fsipc *req)
+{
+	fs_sync();
+	return 0;
+}
+
+/**
+ * 把文件 req_offset 处的块缓存页只读地共享给客户端
+ * 客户端把它映射到自己的文件窗口中直接读取，不需要经过 IPC 复制数据
+ */
+static int
+serve_map(envid_t envid, struct Fsreq_map *req, void **pg_store, int *perm_store)
+{
+	struct OpenFile *o;
+	char *blk;
+	int r;
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	if (req->req_offset < 0 || req->req_offset % BLKSIZE ||
+		req->req_offset >= o->o_file->f_size)
+		return -E_INVAL;
+	if ((r = file_get_block(o->o_file, req->req_offset / BLKSIZE, &blk)) < 0)
+		return r;
+	// 确保块已读入缓存(缺页时由 bc_pgfault 读入)，才能通过 IPC 映射
+	(void)*(volatile char *)blk;
+
+	*pg_store = blk;
+	*perm_store = PTE_P | PTE_U | PTE_SHARE;
+	return 0;
+}
+
+/**
+ * 把文件设为请求者刚创建的子环境 req_envid 的程序映像(sys_image_attach)
+ * 先把文件写回磁盘，再把各块在磁盘上的位置交给内核，内核按需从磁盘读入程序页
+ */
+static int
+serve_exec(envid_t envid, union Fsipc *ipc)
+{
+	static uint64_t secnos[NDIRECT + NINDIRECT];
+	struct Fsreq_exec *req = &ipc->exec;
+	const volatile struct Env *child = &procs[ENVX(req->req_envid)];
+	struct OpenFile *o;
+	char *blk;
+	uint32_t i, nblocks;
+	int r;
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	// 只能为自己尚未运行的子环境设置程序
+	if (child->proc_id != req->req_envid || child->env_parent_id != envid ||
+		child->env_status != ENV_NOT_RUNNABLE)
+		return -E_BAD_ENV;
+	if (o->o_file->f_size <= 0)
+		return -E_NOT_EXEC;
+
+	nblocks = ROUNDUP(o->o_file->f_size, BLKSIZE) / BLKSIZE;
+	for (i = 0; i < nblocks; i++)
+	{
+		if ((r = file_get_block(o->o_file, i, &blk)) < 0)
+			return r;
+		secnos[i] = (uint64_t)(blk - (char *)DISKMAP) / BLKSIZE * BLKSECTS;
+	}
+	file_flush(o->o_file);
+	return sys_image_attach(req->req_envid, FSDEV, secnos, o->o_file->f_size);
+}
+
+typedef int (*fshandler)(envid_t envid, union Fsipc *req);
+
+fshandler handlers[] = {
+	// Open 和 Map 需要返回页，单独处理
+	[FSREQ_READ] = serve_read,
+	[FSREQ_STAT] = serve_stat,
+	[FSREQ_FLUSH] = serve_flush,
+	[FSREQ_WRITE] = serve_write,
+	[FSREQ_SET_SIZE] = serve_set_size,
+	[FSREQ_SYNC] = serve_sync,
+	[FSREQ_REMOVE] = serve_remove,
+	[FSREQ_EXEC] = serve_exec,
+};
+#define NHANDLERS (sizeof(handlers) / sizeof(handlers[0]))
+
+static void
+serve(void)
+{
+	uint32_t req;
+	envid_t whom;
+	int perm, r;
+	void *pg;
+
+	while (1)
+	{
+		perm = 0;
+		req = ipc_recv(&whom, fsreq, &perm);
+		if (debug)
+			cprintf("fs req %d from %08x [page %08lx: %s]\n",
+					req, whom, uvpt[VPN(fsreq)], fsreq);
+
+		// 所有请求都必须带有参数页
+		if (!(perm & PTE_P))
+		{
+			cprintf("Invalid request from %08x: no argument page\n", whom);
+			continue;
+		}
+
+		pg = NULL;
+		if (req == FSREQ_OPEN)
+			r = serve_open(whom, (struct Fsreq_open *)fsreq, &pg, &perm);
+		else if (req == FSREQ_MAP)
+			r = serve_map(whom, &fsreq->map, &pg, &perm);
+		else if (req < NHANDLERS && handlers[req])
+			r = handlers[req](whom, fsreq);
+		else
+		{
+			cprintf("Invalid request code %d from %08x\n", req, whom);
+			r = -E_INVAL;
+		}
+		ipc_send(whom, r, pg, perm);
+		sys_page_unmap(0, fsreq);
+	}
+}
+
+void umain(int argc, char **argv)
+{
+	static_assert(sizeof(struct File) == 256);
+	binaryname = "fs";
+	cprintf("FS is running\n");
+
+	serve_init();
+	fs_init();
+	serve();
+}
@@ -11,6 +11,7 @@
 #include "inc/types.h"
 #include "inc/trap.h"
 #include "inc/memlayout.h"
+#include "inc/pmu.h"
 /**
  * 一个环境ID: envid_t 有三个部分:
  * 
@@ -58,10 +59,65 @@ enum
 	ENV_NOT_RUNNABLE
 };
 
+// 每个环境最多可以描述的虚拟内存区域(VMA)数目
+#define NVMA 8
+
+// struct Vma 中 vma_type 属性的值
+enum
+{
+	// 空闲的 VMA 槽位
+	VMA_UNUSED = 0,
+
+	// 匿名内存(栈、堆): 首次访问时分配一个清零的物理页
+	VMA_ANON,
+
+	// 程序段: 首次访问时从环境的程序映像(env_image)取文件部分，其余(.bss)清零
+	VMA_BINARY
+};
+
+/**
+ * 虚拟内存区域(Virtual Memory Area)描述环境地址空间中的一段区域，但并不立即为其分配物理页
+ * 环境首次访问区域中的某一页时触发页错误，由内核按 VMA 的描述分配、填充并映射该页(按需调页)
+ * 因此创建环境的开销与区域大小无关
+ */
+struct Vma
+{
+	// 区域类型 VMA_ANON / VMA_BINARY
+	int vma_type;
+	// 映射区域中页的权限(PTE_U | PTE_P, 可选 PTE_W)
+	int vma_perm;
+	// 区域覆盖的虚拟地址 [vma_start, vma_end)，页对齐
+	uintptr_t vma_start;
+	uintptr_t vma_end;
+	// VMA_BINARY: 虚拟地址 [vma_va, vma_va + vma_filesz) 的内容来自程序映像中从 vma_off 开始的部分
+	uintptr_t vma_va;
+	size_t vma_off;
+	size_t vma_filesz;
+};
+
 // 特殊环境类型
 enum EnvType
 {
-	PROC_TYPE_USER = 0
+	PROC_TYPE_USER = 0,
+	PROC_TYPE_FS, // 文件系统服务器
+	PROC_TYPE_PRIV, // 由内核创建的特权环境，可以使用内核跟踪(sys_trace_ctl/sys_trace_read)
+};
+
+/**
+ * 环境的资源使用统计，由内核在 trap()、env_run() 和系统调用中更新，通过 sys_getrusage() 读取
+ * 时间以 TSC 周期为单位；内核态时间从陷入内核到返回用户态(或让出 CPU)，不包括等待大内核锁之前的部分
+ */
+struct Rusage
+{
+	uint64_t ru_utime;	  // 用户态时间
+	uint64_t ru_stime;	  // 内核态时间
+	uint64_t ru_syscalls; // 系统调用次数
+	uint64_t ru_pgfaults; // 页错误次数
+	uint64_t ru_cow;	  // 写时复制的页错误次数(写零页，或交给用户态处理的写保护错误)
+	uint64_t ru_ipc_sent; // 发送成功的 IPC 消息数
+	uint64_t ru_ipc_recv; // 收到的 IPC 消息数
+	uint64_t ru_nvcsw;	  // 主动让出 CPU(sys_yield、等待 IPC 或磁盘)的次数
+	uint64_t ru_nivcsw;	  // 被时钟中断抢占并切换到其他环境的次数
 };
 
 /**
@@ -80,6 +136,9 @@ struct Env
 
 	// 索引下一个空闲的 Env 结构，指向空闲环境链表 env_free_list 中的下一个 Env 结构
 	struct Env *env_link;
+	// 已分配(非 ENV_FREE)环境的循环双向链表 env_live，调度器只遍历这个链表
+	struct Env *env_live_next;
+	struct Env *env_live_prev;
 
 	/**
 	 * +1+---------------21-----------------+--------10--------+
@@ -110,6 +169,8 @@ struct Env
 
 	// 环境运行的次数
 	uint32_t env_runs;
+	// 资源使用统计
+	struct Rusage env_ru;
 
 	// 正在运行环境的 CPU
 	int env_cpunum;
@@ -140,8 +201,21 @@ struct Env
 	// 如果环境要接受消息，并且传送页，那么发送方发送页以后将传送的页权限传给这个成员.
 	int env_ipc_perm;
 
-	// 环境对应的 ELF 文件
-	uint8_t *elf;
+	// 环境运行的程序映像(由 kern/image.c 管理)，VMA_BINARY 的内容和调试信息都来自它
+	struct Image *env_image;
+
+	// 环境地址空间中按需调页的虚拟内存区域(由 kern/vma.c 管理)
+	struct Vma env_vmas[NVMA];
+
+	// FPU/SSE/AVX 状态的 XSAVE 区域(内核虚拟地址)，首次使用 FPU 时分配，未使用过为 NULL
+	void *env_fpu;
+	// 环境的 FPU 状态最后一次装载到的 CPU，-1 表示只在 env_fpu 中有效
+	int env_fpu_cpu;
+
+	// 性能计数器(由 kern/pmu.c 管理): 事件选择寄存器的值(0 表示未使用)，
+	// 以及环境在之前各次运行中累计的计数，当前这次运行的计数在硬件计数器中
+	uint64_t env_pmu_evtsel[PMU_NCOUNTERS];
+	uint64_t env_pmu_count[PMU_NCOUNTERS];
 
 	// 环境运行路径
 	// char workpath[MAXPATH];
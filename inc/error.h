@@ -22,6 +22,7 @@ enum
 	E_FILE_EXISTS = 14, // File already exists
 	E_NOT_EXEC = 15,	// File not a valid executable
 	E_NOT_SUPP = 16,	// Operation not supported
+	E_IO = 17,			// 磁盘读写出错
 
 	MAXERROR
 };
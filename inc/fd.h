@@ -29,6 +29,8 @@ struct Dev
 struct FdFile
 {
 	int id;
+	// 文件大小，由文件系统服务器在打开、写入和截断时更新(Fd 页由客户端与服务器共享)
+	off_t size;
 };
 
 // 文件ID，其对应一个文件，保存文件的操作模式，比如只读、可写等
@@ -54,6 +56,9 @@ struct Stat
 	struct Dev *st_dev;
 };
 
+// 每个文件描述符的数据窗口大小(fd2data)，普通文件的块缓存页按文件偏移映射在其中
+#define FILEWINDOW ROUNDUP(MAXFILESIZE, PTSIZE)
+
 /* 针对这些数据结构，定义了一些宏以及函数来对这些结构进行操作 */
 
 char *fd2data(struct Fd *fd);
@@ -45,7 +45,7 @@ struct File
 
 	// 填充到256个字节
 	uint8_t f_pad[256 - MAXNAMELEN - 8 - 4 * NDIRECT - 4];
-} __attribute__((packed));
+};
 
 // 一个 inode 块恰好包含 BLKFILES 的文件结构
 #define BLKFILES (BLKSIZE / sizeof(struct File))
@@ -80,7 +80,11 @@ enum
 	FSREQ_STAT,
 	FSREQ_FLUSH,
 	FSREQ_REMOVE,
-	FSREQ_SYNC
+	FSREQ_SYNC,
+	// Map returns the file's block cache page (read-only, PTE_SHARE)
+	FSREQ_MAP,
+	// Exec makes the file the program image of a child being spawned
+	FSREQ_EXEC
 };
 
 union Fsipc
@@ -106,8 +110,8 @@ union Fsipc
 	} readRet;
 	struct Fsreq_write
 	{
-		int req_fileid;
 		size_t req_n;
+		int req_fileid;
 		char req_buf[PGSIZE - (sizeof(int) + sizeof(size_t))];
 	} write;
 	struct Fsreq_stat
@@ -128,6 +132,16 @@ union Fsipc
 	{
 		char req_path[MAXPATHLEN];
 	} remove;
+	struct Fsreq_map
+	{
+		int req_fileid;
+		off_t req_offset; // BLKSIZE 对齐
+	} map;
+	struct Fsreq_exec
+	{
+		int req_fileid;
+		int32_t req_envid; // spawn 创建的子环境(envid_t)
+	} exec;
 
 	// Ensure Fsipc is one page
 	char _pad[PGSIZE];
@@ -14,6 +14,10 @@
 #include "inc/memlayout.h"
 #include "inc/syscall.h"
 #include "inc/trap.h"
+#include "inc/fs.h"
+#include "inc/fd.h"
+#include "inc/trace.h"
+#include "inc/elf.h"
 
 #define USED(x) (void)(x)
 
@@ -55,6 +59,16 @@ int sys_page_map(envid_t src_env, void *src_pg,
 int sys_page_unmap(envid_t env, void *pg);
 int sys_ipc_try_send(envid_t to_env, uint64_t value, void *pg, int perm);
 int sys_ipc_recv(void *rcv_pg);
+int sys_disk_io(int dev, uint64_t secno, void *pg, size_t nsecs, int write);
+int sys_vma_alloc(envid_t env, void *va, size_t len, int perm);
+int sys_vma_clear(envid_t env);
+int sys_trace_ctl(int enable);
+int sys_trace_read(int cpu, uint64_t *seq, struct TraceEvent *buf, int n);
+int sys_getrusage(envid_t env, struct Rusage *ru);
+int sys_pmu_config(int idx, uint64_t event);
+envid_t sys_env_find(enum EnvType type);
+int sys_image_attach(envid_t env, int dev, const uint64_t *secnos, size_t size);
+int sys_vma_binary(envid_t env, const struct Proghdr *ph);
 
 // 必须内联.
 static __inline envid_t __attribute__((always_inline))
@@ -68,6 +82,10 @@ sys_exofork(void)
 	return ret;
 }
 
+// pmu.c
+int pmu_open(int idx, uint64_t event);
+uint64_t pmu_read(int idx);
+
 // ipc.c
 void ipc_send(envid_t to_env, uint32_t value, void *pg, int perm);
 int32_t ipc_recv(envid_t *from_env_store, void *pg, int *perm_store);
@@ -78,4 +96,40 @@ envid_t ipc_find_env(enum EnvType type);
 #define PTE_SHARE 0x400
 envid_t fork(void);
 
+// fd.c
+int close(int fd);
+ssize_t read(int fd, void *buf, size_t nbytes);
+ssize_t write(int fd, const void *buf, size_t nbytes);
+int seek(int fd, off_t offset);
+void close_all(void);
+ssize_t readn(int fd, void *buf, size_t nbytes);
+int dup(int oldfd, int newfd);
+int fstat(int fd, struct Stat *statbuf);
+int stat(const char *path, struct Stat *statbuf);
+int ftruncate(int fd, off_t size);
+
+// file.c
+int open(const char *path, int mode);
+int remove(const char *path);
+int sync(void);
+int fexec(int fdnum, envid_t child);
+
+// spawn.c
+envid_t spawn(const char *program, const char **argv);
+envid_t spawnl(const char *program, const char *arg0, ...);
+
+// pageref.c
+bool va_is_mapped(void *va);
+int pageref(void *addr);
+
+// 文件打开模式
+#define O_RDONLY 0x0000	 // 只读
+#define O_WRONLY 0x0001	 // 只写
+#define O_RDWR 0x0002	 // 读写
+#define O_ACCMODE 0x0003 // 访问模式的掩码
+
+#define O_CREAT 0x0100 // 文件不存在时创建
+#define O_TRUNC 0x0200 // 截断为 0 长度
+#define O_EXCL 0x0400  // 与 O_CREAT 一起使用时，文件已存在则出错
+
 #endif
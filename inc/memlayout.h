@@ -172,6 +172,9 @@
 // 非引导 CPUs(APs) 的引导代码的物理地址，可以是 640KB(0xA0000) 以下的未使用、页对齐的物理地址
 #define MPENTRY_PADDR 0x7000
 
+// 引导扇区开始执行时(boot.S start)记录的 TSC 时间戳(64位)所在的物理地址
+#define BOOT_TSC_PADDR 0x6ff0
+
 #ifndef __ASSEMBLER__
 
 typedef uint64_t pml4e_t;
@@ -104,6 +104,9 @@
 #define CR0_CD 0x40000000 // 禁用 Cache
 #define CR0_PG 0x80000000 // 分页位
 
+#define CR4_OSXSAVE 0x00040000   // XSAVE and Processor Extended States Enable
+#define CR4_OSXMMEXCPT 0x00000400 // Unmasked SIMD FP Exceptions Support
+#define CR4_OSFXSR 0x00000200     // FXSAVE/FXRSTOR and SSE Support
 #define CR4_PCE 0x00000100 // Performance counter enable
 #define CR4_MCE 0x00000040 // Machine Check Enable
 #define CR4_PSE 0x00000010 // Page Size Extensions
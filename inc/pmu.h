@@ -0,0 +1,19 @@
+#ifndef ALVOS_INC_PMU_H
+#define ALVOS_INC_PMU_H
+
+#include "inc/types.h"
+
+// 每个环境可以使用的通用性能计数器数(不超过 CPU 实际支持的数量)
+#define PMU_NCOUNTERS 4
+
+/**
+ * 常用事件的编码: (umask << 8) | event select
+ * 前三个是 Intel 架构性能事件(CPUID 0xA)，在所有支持架构性能监控的处理器上含义相同
+ * PMU_EV_DTLB_MISSES 是 DTLB_LOAD_MISSES.MISS_CAUSES_A_WALK，与处理器型号有关(Nehalem 至 Skylake)
+ */
+#define PMU_EV_CYCLES 0x003C	   // UnHalted Core Cycles
+#define PMU_EV_INSTRUCTIONS 0x00C0 // Instructions Retired
+#define PMU_EV_LLC_MISSES 0x412E   // LLC Misses
+#define PMU_EV_DTLB_MISSES 0x0108  // 引起页表遍历的 DTLB 读缺失
+
+#endif
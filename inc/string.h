@@ -19,6 +19,7 @@ void *memcpy(void *dst, const void *src, size_t len);
 void *memmove(void *dst, const void *src, size_t len);
 int memcmp(const void *s1, const void *s2, size_t len);
 void *memfind(const void *s, int c, size_t len);
+void mem_init(void);
 
 long strtol(const char *s, char **endptr, int base);
 char *strstr(const char *in, const char *str);
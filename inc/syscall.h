@@ -17,6 +17,16 @@ enum {
 	SYS_yield,
 	SYS_ipc_try_send,
 	SYS_ipc_recv,
+	SYS_disk_io,
+	SYS_vma_alloc,
+	SYS_vma_clear,
+	SYS_trace_ctl,
+	SYS_trace_read,
+	SYS_getrusage,
+	SYS_pmu_config,
+	SYS_env_find,
+	SYS_image_attach,
+	SYS_vma_binary,
 	NSYSCALLS
 };
 
@@ -0,0 +1,53 @@
+#ifndef ALVOS_INC_TRACE_H
+#define ALVOS_INC_TRACE_H
+
+#include "inc/types.h"
+
+// 内核跟踪事件的类型(struct TraceEvent 的 te_id)
+enum
+{
+	TRACE_TRAP = 1,	   // 进入 trap(): args = {trapno, rip}
+	TRACE_TRAP_EXIT,   // trap() 处理结束: args = {trapno, 下一步运行的环境 id(0 表示重新调度)}
+	TRACE_SYSCALL,	   // 系统调用: args = {syscallno, a1}
+	TRACE_ENV_RUN,	   // env_run(): args = {envid, env_runs}
+	TRACE_SCHED,	   // sched_yield(): args = {上次运行的环境 id, 0}
+	TRACE_PGFAULT,	   // 页错误: args = {fault_va, err}
+	TRACE_IPC_SEND,	   // sys_ipc_try_send() 成功: args = {目标 envid, value}
+	TRACE_IPC_RECV,	   // sys_ipc_recv() 开始等待: args = {dstva, 0}
+	NTRACEEVENTS
+};
+
+/**
+ * 一个跟踪事件，32字节
+ * 每个 CPU 只向自己的环形缓冲区写入事件，不需要加锁
+ */
+struct TraceEvent
+{
+	uint64_t te_tsc;	 // 时间戳(TSC)
+	uint16_t te_cpu;	 // 产生事件的 CPU
+	uint16_t te_id;		 // 事件类型 TRACE_*
+	int32_t te_envid;	 // 产生事件时 CPU 上的当前环境，没有则为0
+	uint64_t te_args[2]; // 事件参数，含义见上面的事件类型
+};
+
+// 返回事件类型 id 的名字，内核和用户程序共用同一张表
+static inline const char *
+trace_name(int id)
+{
+	static const char *const names[NTRACEEVENTS] = {
+		[TRACE_TRAP] = "trap",
+		[TRACE_TRAP_EXIT] = "trap-exit",
+		[TRACE_SYSCALL] = "syscall",
+		[TRACE_ENV_RUN] = "env-run",
+		[TRACE_SCHED] = "sched",
+		[TRACE_PGFAULT] = "pgfault",
+		[TRACE_IPC_SEND] = "ipc-send",
+		[TRACE_IPC_RECV] = "ipc-recv",
+	};
+
+	if (id <= 0 || id >= NTRACEEVENTS || !names[id])
+		return "?";
+	return names[id];
+}
+
+#endif
@@ -0,0 +1,171 @@
+/**
+ * 按地址排序的范围索引，供调试信息查找使用(函数地址索引、FDE 查找表)
+ * 每个 ELF 映像第一次查询时由使用者顺序扫描调试段，逐个加入 [lo, hi) 范围，排序后
+ * 每次查询只需二分查找，再解析命中的那一个条目
+ * 索引以 ELF 映像的地址为键，放在使用者提供的固定大小的表中，表满时淘汰最久未使用的索引；
+ * 映像被释放时须调用 addr_index_forget()，否则之后装入到同一地址的映像会查到旧的索引
+ */
+#include "inc/string.h"
+#include "inc/error.h"
+
+#include "kern/addrindex.h"
+#include "kern/kmem.h"
+
+// 数组第一次分配时的项数
+#define ADDRINDEX_MINCAP 64
+
+static uint64_t addr_index_clock;
+
+/**
+ * 保证 *arr 能再容纳一项(每项 size 字节，已有 n 项)，空间不足时倍增
+ * 成功返回0，内存不足返回 -E_NO_MEM
+ */
+static int
+addr_index_grow(void **arr, int *cap, int n, size_t size)
+{
+	void *p;
+	int newcap;
+
+	if (n < *cap)
+		return 0;
+	newcap = *cap ? *cap * 2 : ADDRINDEX_MINCAP;
+	if (!(p = kmalloc(newcap * size)))
+		return -E_NO_MEM;
+	if (*arr)
+	{
+		memcpy(p, *arr, n * size);
+		kfree(*arr);
+	}
+	*arr = p;
+	*cap = newcap;
+	return 0;
+}
+
+// 释放 ai 的数组，ai 变为空闲
+static void
+addr_index_release(struct AddrIndex *ai)
+{
+	kfree(ai->ai_ranges);
+	kfree(ai->ai_aux);
+	memset(ai, 0, sizeof(struct AddrIndex));
+}
+
+/**
+ * 返回表 tab(n 项)中 ELF 映像 elf 的索引
+ * 不存在时占用一个空闲项(表满时淘汰最久未使用的索引)，*fresh 置1，由调用者调用
+ * addr_index_add() 等建立；已存在时 *fresh 置0
+ */
+struct AddrIndex *
+addr_index_get(struct AddrIndex *tab, int n, const void *elf, size_t auxsize, int *fresh)
+{
+	struct AddrIndex *ai, *slot = NULL;
+	int i;
+
+	for (i = 0; i < n; i++)
+	{
+		ai = &tab[i];
+		if (ai->ai_elf == elf)
+		{
+			ai->ai_lastuse = ++addr_index_clock;
+			*fresh = 0;
+			return ai;
+		}
+		if (!slot || (slot->ai_elf && (!ai->ai_elf || ai->ai_lastuse < slot->ai_lastuse)))
+			slot = ai;
+	}
+	if (slot->ai_elf)
+		addr_index_release(slot);
+	slot->ai_elf = elf;
+	slot->ai_auxsize = auxsize;
+	slot->ai_lastuse = ++addr_index_clock;
+	*fresh = 1;
+	return slot;
+}
+
+/**
+ * 向 ai 加入范围 [lo, hi)
+ * 成功返回0，内存不足返回 -E_NO_MEM
+ */
+int addr_index_add(struct AddrIndex *ai, uint64_t lo, uint64_t hi, uint64_t off, uint32_t aux)
+{
+	struct AddrRange *ar;
+
+	if (addr_index_grow((void **)&ai->ai_ranges, &ai->ai_rangecap, ai->ai_nranges,
+						sizeof(struct AddrRange)) < 0)
+		return -E_NO_MEM;
+	ar = &ai->ai_ranges[ai->ai_nranges++];
+	ar->ar_lo = lo;
+	ar->ar_hi = hi;
+	ar->ar_off = off;
+	ar->ar_aux = aux;
+	return 0;
+}
+
+/**
+ * 把附属项 *aux(ai_auxsize 字节)复制到 ai 中
+ * 返回其下标，内存不足返回 -E_NO_MEM
+ */
+int addr_index_add_aux(struct AddrIndex *ai, const void *aux)
+{
+	if (addr_index_grow(&ai->ai_aux, &ai->ai_auxcap, ai->ai_naux, ai->ai_auxsize) < 0)
+		return -E_NO_MEM;
+	memcpy((uint8_t *)ai->ai_aux + ai->ai_naux * ai->ai_auxsize, aux, ai->ai_auxsize);
+	return ai->ai_naux++;
+}
+
+// 无法建立 ai: 释放已加入的项，之后对该映像的 addr_index_get() 返回 ai_nranges < 0 的索引
+void addr_index_fail(struct AddrIndex *ai)
+{
+	const void *elf = ai->ai_elf;
+	uint64_t lastuse = ai->ai_lastuse;
+
+	addr_index_release(ai);
+	ai->ai_elf = elf;
+	ai->ai_lastuse = lastuse;
+	ai->ai_nranges = -1;
+}
+
+// 按 ar_lo 排序 ai 的范围，调试段中的条目基本按地址有序，插入排序接近线性
+void addr_index_sort(struct AddrIndex *ai)
+{
+	struct AddrRange tmp;
+	int i, j;
+
+	for (i = 1; i < ai->ai_nranges; i++)
+	{
+		tmp = ai->ai_ranges[i];
+		for (j = i; j > 0 && ai->ai_ranges[j - 1].ar_lo > tmp.ar_lo; j--)
+			ai->ai_ranges[j] = ai->ai_ranges[j - 1];
+		ai->ai_ranges[j] = tmp;
+	}
+}
+
+// 二分查找 ai 中包含 addr 的范围，没有时返回 NULL
+struct AddrRange *
+addr_index_lookup(struct AddrIndex *ai, uint64_t addr)
+{
+	int lo = 0, hi = ai->ai_nranges, mid;
+
+	// 找到最后一个 ar_lo <= addr 的范围
+	while (lo < hi)
+	{
+		mid = (lo + hi) / 2;
+		if (ai->ai_ranges[mid].ar_lo <= addr)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo == 0 || addr >= ai->ai_ranges[lo - 1].ar_hi)
+		return NULL;
+	return &ai->ai_ranges[lo - 1];
+}
+
+// 释放表 tab(n 项)中 ELF 映像 elf 的索引
+void addr_index_forget(struct AddrIndex *tab, int n, const void *elf)
+{
+	int i;
+
+	for (i = 0; i < n; i++)
+		if (tab[i].ai_elf == elf)
+			addr_index_release(&tab[i]);
+}
@@ -0,0 +1,44 @@
+#ifndef ALVOS_KERN_ADDRINDEX_H
+#define ALVOS_KERN_ADDRINDEX_H
+#ifndef ALVOS_KERNEL
+# error "This is a AlvOS kernel header; user programs should not #include it"
+#endif
+
+#include "inc/types.h"
+
+// 一个地址范围 [ar_lo, ar_hi) 及其对应的调试条目
+struct AddrRange
+{
+	uint64_t ar_lo;
+	uint64_t ar_hi;
+	uint64_t ar_off; // 条目(函数 DIE、FDE)在调试段中的偏移
+	uint32_t ar_aux; // 条目所属的附属项(CU、CIE)在 ai_aux 中的下标
+};
+
+/**
+ * 一个 ELF 映像的地址索引: 按 ar_lo 排序的地址范围数组，以及各范围共用的附属项数组
+ * 两个数组都由 kmalloc() 分配，按需倍增
+ */
+struct AddrIndex
+{
+	const void *ai_elf;	 // 索引的 ELF 映像，NULL 表示空闲
+	int ai_nranges;		 // 范围数，< 0 表示无法建立，该映像只能线性查找
+	int ai_rangecap;
+	struct AddrRange *ai_ranges;
+	size_t ai_auxsize;	 // 附属项的大小
+	int ai_naux;
+	int ai_auxcap;
+	void *ai_aux;
+	uint64_t ai_lastuse; // 最近一次使用的时间，表满时淘汰最久未使用的索引
+};
+
+struct AddrIndex *addr_index_get(struct AddrIndex *tab, int n, const void *elf,
+								 size_t auxsize, int *fresh);
+int addr_index_add(struct AddrIndex *ai, uint64_t lo, uint64_t hi, uint64_t off, uint32_t aux);
+int addr_index_add_aux(struct AddrIndex *ai, const void *aux);
+void addr_index_fail(struct AddrIndex *ai);
+void addr_index_sort(struct AddrIndex *ai);
+struct AddrRange *addr_index_lookup(struct AddrIndex *ai, uint64_t addr);
+void addr_index_forget(struct AddrIndex *tab, int n, const void *elf);
+
+#endif
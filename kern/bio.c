@@ -0,0 +1,333 @@
+/**
+ * 内核磁盘块缓存(buffer cache)
+ * 以 (设备, 块起始 LBA) 为键缓存 NBUF 个 BIO_BLKSIZE 大小的磁盘块，按 LRU 顺序回收
+ *
+ * - bread() 返回持有 b_lock 的缓存块，命中时不访问磁盘；未命中时回收最久未使用的空闲块并从磁盘读入
+ * - 文件系统服务器的 sys_disk_io() 经由 bio_env_io() 访问磁盘：读命中时直接复制，不阻塞；
+ *   未命中时把请求挂在读入中的缓存块上，块读入后复制给环境并唤醒它；写请求直写(write-through)到磁盘，
+ *   同时更新缓存中的块，因此缓存中没有脏块，回收时无需写回
+ * - 检测到对同一设备的顺序读(本次读的块紧跟在上一次之后)时，异步预读后面 BIO_READAHEAD 个块，
+ *   预读请求与本次请求一起交给 IDE 驱动按 LBA 排序，调用者处理本块数据时磁盘继续传输后续块
+ *
+ * bio_lock 保护 LRU 链表、键和引用计数，每个块的 b_lock 保护块的数据
+ * 读请求进行中的块带有 B_IO 标志(此时没有 CPU 持有 b_lock)，bread() 拿到该块后等待其磁盘请求完成
+ */
+#include "inc/error.h"
+#include "inc/assert.h"
+#include "inc/string.h"
+
+#include "kern/bio.h"
+#include "kern/pmap.h"
+
+// 同时等待缓存块读入的环境请求数，用完时环境请求绕过缓存直接访问磁盘
+#define NBIOWAIT 16
+
+static struct spinlock bio_lock;
+static struct Buf bio_bufs[NBUF];
+// LRU 链表头：bio_head.b_next 最近使用，bio_head.b_prev 最久未使用
+static struct Buf bio_head;
+static uint8_t bio_data[NBUF][BIO_BLKSIZE] __attribute__((aligned(BIO_BLKSIZE)));
+// 每个设备上一次读的块，用于检测顺序读
+static uint64_t bio_last[IDE_NDEV];
+static struct BioWaiter bio_waiters[NBIOWAIT];
+static struct BioWaiter *bio_waiter_free;
+
+void bio_init(void)
+{
+	struct Buf *b;
+	int i;
+
+	spin_initlock(&bio_lock);
+	bio_head.b_prev = bio_head.b_next = &bio_head;
+	for (i = 0; i < NBUF; i++)
+	{
+		b = &bio_bufs[i];
+		b->b_dev = -1;
+		b->b_data = bio_data[i];
+		__spin_initlock(&b->b_lock, "buf");
+		b->b_next = bio_head.b_next;
+		b->b_prev = &bio_head;
+		bio_head.b_next->b_prev = b;
+		bio_head.b_next = b;
+	}
+	for (i = 0; i < IDE_NDEV; i++)
+		bio_last[i] = ~0UL;
+	for (i = 0; i < NBIOWAIT; i++)
+	{
+		bio_waiters[i].bw_next = bio_waiter_free;
+		bio_waiter_free = &bio_waiters[i];
+	}
+}
+
+// 将 b 移到 LRU 链表头部(最近使用)
+static void
+bio_touch(struct Buf *b)
+{
+	b->b_prev->b_next = b->b_next;
+	b->b_next->b_prev = b->b_prev;
+	b->b_next = bio_head.b_next;
+	b->b_prev = &bio_head;
+	bio_head.b_next->b_prev = b;
+	bio_head.b_next = b;
+}
+
+static struct Buf *
+bio_lookup(int dev, uint64_t lba)
+{
+	struct Buf *b;
+
+	for (b = bio_head.b_next; b != &bio_head; b = b->b_next)
+		if (b->b_dev == dev && b->b_lba == lba)
+			return b;
+	return NULL;
+}
+
+/**
+ * 返回 (dev, lba) 对应的缓存块，不在缓存中时从 LRU 链表尾部回收一个没有被持有、也没有磁盘请求的块
+ * 回收的块不含有效数据(b_flags 为 0)；没有可回收的块时返回 NULL
+ */
+static struct Buf *
+bio_get(int dev, uint64_t lba)
+{
+	struct Buf *b;
+
+	if ((b = bio_lookup(dev, lba)))
+		return b;
+	for (b = bio_head.b_prev; b != &bio_head; b = b->b_prev)
+		if (b->b_refcnt == 0 && !(b->b_flags & B_IO))
+		{
+			b->b_dev = dev;
+			b->b_lba = lba;
+			b->b_nsect = MIN((uint64_t)BIO_BLKSECTS, ide_nsect(dev) - lba);
+			b->b_flags = 0;
+			return b;
+		}
+	return NULL;
+}
+
+/**
+ * 读请求完成(在 IDE 中断或轮询中调用)
+ * 把数据复制给等待该块的环境请求并唤醒它们；读请求进行中该块被写入时(B_STALE)不缓存读入的数据
+ */
+static void
+bio_done(struct IdeReq *r)
+{
+	struct Buf *b = r->ir_arg;
+	struct BioWaiter *w;
+
+	if (!r->ir_error && !(b->b_flags & B_STALE))
+		b->b_flags |= B_VALID;
+	b->b_flags &= ~(B_IO | B_STALE);
+	while ((w = b->b_waiters))
+	{
+		b->b_waiters = w->bw_next;
+		if (!r->ir_error)
+			memcpy(page2kva(w->bw_pp), b->b_data + w->bw_off * SECTSIZE, w->bw_nsect * SECTSIZE);
+		ide_env_wake(w->bw_envid, r->ir_error);
+		page_decref(w->bw_pp);
+		w->bw_next = bio_waiter_free;
+		bio_waiter_free = w;
+	}
+}
+
+// 发出读入块 b 的磁盘请求，不等待完成
+static void
+bio_start(struct Buf *b)
+{
+	memset(&b->b_req, 0, sizeof(b->b_req));
+	b->b_req.ir_dev = b->b_dev;
+	b->b_req.ir_lba = b->b_lba;
+	b->b_req.ir_nsect = b->b_nsect;
+	b->b_req.ir_buf = b->b_data;
+	b->b_req.ir_done_fn = bio_done;
+	b->b_req.ir_arg = b;
+	b->b_flags |= B_IO;
+	ide_submit(&b->b_req);
+}
+
+// 预读 lba 之后的 BIO_READAHEAD 个块中尚未缓存的块
+static void
+bio_readahead(int dev, uint64_t lba)
+{
+	struct Buf *b;
+	uint64_t next;
+	int i;
+
+	for (i = 1; i <= BIO_READAHEAD; i++)
+	{
+		next = lba + i * BIO_BLKSECTS;
+		if (next >= ide_nsect(dev))
+			break;
+		if (bio_lookup(dev, next))
+			continue;
+		if (!(b = bio_get(dev, next)))
+			break;
+		// 预读的块放到链表头部，避免在使用之前被后续的预读回收
+		bio_touch(b);
+		bio_start(b);
+	}
+}
+
+static void
+bio_put(struct Buf *b)
+{
+	spin_lock(&bio_lock);
+	b->b_refcnt--;
+	spin_unlock(&bio_lock);
+}
+
+/**
+ * 读取设备 dev 上从扇区 lba(BIO_BLKSECTS 对齐)开始的块，成功时 *bp 为持有 b_lock 的缓存块
+ * 使用完毕后必须调用 brelse()
+ * 错误时返回 < 0:
+ *   -E_INVAL: lba 超出磁盘
+ *   -E_NO_MEM: 所有缓存块都在使用中
+ *   -E_IO: 读磁盘出错
+ */
+int bread(int dev, uint64_t lba, struct Buf **bp)
+{
+	struct Buf *b;
+
+	assert(lba % BIO_BLKSECTS == 0);
+	if (lba >= ide_nsect(dev))
+		return -E_INVAL;
+
+	spin_lock(&bio_lock);
+	if (!(b = bio_get(dev, lba)))
+	{
+		spin_unlock(&bio_lock);
+		return -E_NO_MEM;
+	}
+	b->b_refcnt++;
+	bio_touch(b);
+	if (!(b->b_flags & (B_VALID | B_IO)))
+		bio_start(b);
+	if (lba == bio_last[dev] + BIO_BLKSECTS)
+		bio_readahead(dev, lba);
+	bio_last[dev] = lba;
+	spin_unlock(&bio_lock);
+
+	spin_lock(&b->b_lock);
+	while (!(b->b_flags & B_VALID))
+	{
+		// 读入的数据因写入而作废(B_STALE)时重新读入
+		if (!(b->b_flags & B_IO))
+		{
+			spin_lock(&bio_lock);
+			bio_start(b);
+			spin_unlock(&bio_lock);
+		}
+		ide_wait_req(&b->b_req);
+		if (b->b_req.ir_error)
+		{
+			spin_unlock(&b->b_lock);
+			bio_put(b);
+			return -E_IO;
+		}
+	}
+	*bp = b;
+	return 0;
+}
+
+// 释放 bread() 得到的块
+void brelse(struct Buf *b)
+{
+	spin_unlock(&b->b_lock);
+	bio_put(b);
+}
+
+/**
+ * 经由缓存从扇区 secno 开始读取 nsecs 个扇区到 dst
+ * 成功返回 0，错误时返回 bread() 的错误码
+ */
+int bio_read(int dev, uint64_t secno, void *dst, size_t nsecs)
+{
+	struct Buf *b;
+	uint64_t lba, off, n;
+	int r;
+
+	while (nsecs > 0)
+	{
+		lba = ROUNDDOWN(secno, BIO_BLKSECTS);
+		off = secno - lba;
+		n = MIN(nsecs, BIO_BLKSECTS - off);
+		if ((r = bread(dev, lba, &b)) < 0)
+			return r;
+		if (off + n > b->b_nsect)
+		{
+			brelse(b);
+			return -E_INVAL;
+		}
+		memcpy(dst, b->b_data + off * SECTSIZE, n * SECTSIZE);
+		brelse(b);
+		secno += n;
+		dst += n * SECTSIZE;
+		nsecs -= n;
+	}
+	return 0;
+}
+
+/**
+ * 经由缓存为环境 waiter 读写物理页 pp(从扇区 secno 开始的 nsecs 个扇区，不超过一页)
+ * 读:
+ *   - 所在块已缓存时直接复制，返回1
+ *   - 否则把请求挂在读入中的缓存块上，块读入后复制并唤醒 waiter，返回0
+ *   - 跨块、没有可回收的缓存块或等待请求用完时直接访问磁盘(ide_env_io)，返回0
+ * 写: 更新缓存中的块后直写到磁盘，返回0
+ * 返回0时调用者负责将 waiter 置为 ENV_NOT_RUNNABLE 并让出 CPU；错误时返回 ide_env_io() 的错误码
+ */
+int bio_env_io(int dev, uint64_t secno, struct PageInfo *pp, size_t nsecs, int write, envid_t waiter)
+{
+	struct BioWaiter *w;
+	struct Buf *b;
+	uint64_t lba = ROUNDDOWN(secno, BIO_BLKSECTS), off = secno - lba;
+
+	if (nsecs == 0 || nsecs > PGSIZE / SECTSIZE || secno + nsecs > ide_nsect(dev))
+		return -E_INVAL;
+	if (off + nsecs > BIO_BLKSECTS)
+		return ide_env_io(dev, secno, pp, nsecs, write, waiter);
+
+	spin_lock(&bio_lock);
+	if (write)
+	{
+		if ((b = bio_lookup(dev, lba)))
+		{
+			if (b->b_flags & B_VALID)
+				memcpy(b->b_data + off * SECTSIZE, page2kva(pp), nsecs * SECTSIZE);
+			else if (b->b_flags & B_IO)
+				b->b_flags |= B_STALE;
+		}
+		spin_unlock(&bio_lock);
+		return ide_env_io(dev, secno, pp, nsecs, write, waiter);
+	}
+
+	if (lba == bio_last[dev] + BIO_BLKSECTS)
+		bio_readahead(dev, lba);
+	bio_last[dev] = lba;
+	if ((b = bio_lookup(dev, lba)) && (b->b_flags & B_VALID))
+	{
+		bio_touch(b);
+		memcpy(page2kva(pp), b->b_data + off * SECTSIZE, nsecs * SECTSIZE);
+		spin_unlock(&bio_lock);
+		return 1;
+	}
+	if (!(w = bio_waiter_free) || !(b = bio_get(dev, lba)))
+	{
+		spin_unlock(&bio_lock);
+		return ide_env_io(dev, secno, pp, nsecs, write, waiter);
+	}
+	bio_waiter_free = w->bw_next;
+	w->bw_envid = waiter;
+	w->bw_pp = pp;
+	w->bw_off = off;
+	w->bw_nsect = nsecs;
+	w->bw_next = b->b_waiters;
+	b->b_waiters = w;
+	// 物理页在传输期间被额外引用，环境在此期间退出也不会被重新分配
+	pp->pp_ref++;
+	bio_touch(b);
+	if (!(b->b_flags & B_IO))
+		bio_start(b);
+	spin_unlock(&bio_lock);
+	return 0;
+}
@@ -0,0 +1,60 @@
+#ifndef ALVOS_KERN_BIO_H
+#define ALVOS_KERN_BIO_H
+#ifndef ALVOS_KERNEL
+# error "This is a AlvOS kernel header; user programs should not #include it"
+#endif
+
+#include "inc/types.h"
+#include "inc/mmu.h"
+#include "kern/spinlock.h"
+#include "kern/ide.h"
+
+#define BIO_BLKSIZE PGSIZE						// 缓存块大小
+#define BIO_BLKSECTS (BIO_BLKSIZE / SECTSIZE)	// 每个缓存块包含的扇区数
+#define NBUF 64									// 缓存块数量
+#define BIO_READAHEAD 4							// 顺序读时预读的块数
+
+// b_flags
+#define B_VALID 0x1 // 数据已从磁盘读入
+#define B_IO 0x2	// 磁盘请求(预读)进行中
+#define B_STALE 0x4 // 读请求进行中时该块被写入，读入的数据不再缓存
+
+struct PageInfo;
+
+// 等待缓存块读入的环境请求，读入后把 [bw_off, bw_off+bw_nsect) 扇区复制到 bw_pp
+struct BioWaiter
+{
+	envid_t bw_envid;
+	struct PageInfo *bw_pp;
+	uint32_t bw_off;		// 相对于块起始的扇区
+	uint32_t bw_nsect;
+	struct BioWaiter *bw_next;
+};
+
+/**
+ * 磁盘块缓存，以 (设备, 块起始 LBA) 为键
+ * 所有缓存块挂在一个 LRU 双向链表上，bio_head.b_next 是最近使用的块
+ * b_lock 保护块的数据：bread() 返回时持有该锁，brelse() 释放
+ */
+struct Buf
+{
+	int b_dev;
+	uint64_t b_lba;			// 块的起始扇区(BIO_BLKSECTS 对齐)
+	uint32_t b_nsect;		// 块中有效的扇区数(磁盘末尾的块可能不足一块)
+	int b_flags;
+	int b_refcnt;			// 持有该块的调用者数
+	struct spinlock b_lock; // 持有者独占访问 b_data
+	struct Buf *b_prev;		// LRU 链表
+	struct Buf *b_next;
+	struct IdeReq b_req;	// 该块的磁盘请求
+	struct BioWaiter *b_waiters; // 等待 b_req 完成的环境请求
+	uint8_t *b_data;
+};
+
+void bio_init(void);
+int bread(int dev, uint64_t lba, struct Buf **bp);
+void brelse(struct Buf *b);
+int bio_read(int dev, uint64_t secno, void *dst, size_t nsecs);
+int bio_env_io(int dev, uint64_t secno, struct PageInfo *pp, size_t nsecs, int write, envid_t waiter);
+
+#endif
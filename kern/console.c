@@ -30,8 +30,12 @@ delay(void)
 #define COM_DLM		1	// Out: Divisor Latch High (DLAB=1)
 #define COM_IER		1	// Out: Interrupt Enable Register
 #define   COM_IER_RDI	0x01	//   Enable receiver data interrupt
+#define   COM_IER_TXI	0x02	//   Enable transmitter holding register empty interrupt
 #define COM_IIR		2	// In:	Interrupt ID Register
 #define COM_FCR		2	// Out: FIFO Control Register
+#define   COM_FCR_ENABLE	0x01	//   Enable FIFOs
+#define   COM_FCR_CLRRX	0x02	//   Clear receive FIFO
+#define   COM_FCR_CLRTX	0x04	//   Clear transmit FIFO
 #define COM_LCR		3	// Out: Line Control Register
 #define	  COM_LCR_DLAB	0x80	//   Divisor latch access bit
 #define	  COM_LCR_WLEN8	0x03	//   Wordlength: 8 bits
@@ -44,8 +48,28 @@ delay(void)
 #define   COM_LSR_TXRDY	0x20	//   Transmit buffer avail
 #define   COM_LSR_TSRE	0x40	//   Transmitter off
 
+// 16550A 发送 FIFO 的深度
+#define COM_TXFIFO	16
+
 static bool serial_exists;
 
+/**
+ * 串口发送缓冲区
+ * serial_putc() 只把字符放入缓冲区，发送 FIFO 空时一次写入 COM_TXFIFO 个字符，
+ * 之后由发送器空中断(IRQ 4)继续从缓冲区取出字符，输出不再为每个字符轮询 LSR
+ * rpos/wpos 只增不减，对 SERIAL_TXBUFSIZE 取模得到下标
+ */
+#define SERIAL_TXBUFSIZE 4096
+
+static struct {
+	uint8_t buf[SERIAL_TXBUFSIZE];
+	uint32_t rpos;
+	uint32_t wpos;
+} serial_tx;
+
+// 当前是否打开了发送器空中断
+static bool serial_txi;
+
 static int
 serial_proc_data(void)
 {
@@ -54,15 +78,33 @@ serial_proc_data(void)
 	return inb(COM1+COM_RX);
 }
 
-void
-serial_intr(void)
+// 发送 FIFO 为空时，从发送缓冲区向其中写入最多 COM_TXFIFO 个字符
+static void
+serial_tx_drain(void)
 {
-	if (serial_exists)
-		cons_intr(serial_proc_data);
+	int i;
+
+	if (!(inb(COM1 + COM_LSR) & COM_LSR_TXRDY))
+		return;
+	for (i = 0; i < COM_TXFIFO && serial_tx.rpos != serial_tx.wpos; i++)
+		outb(COM1 + COM_TX, serial_tx.buf[serial_tx.rpos++ % SERIAL_TXBUFSIZE]);
 }
 
+// 发送缓冲区非空时打开发送器空中断，空时关闭
 static void
-serial_putc(int c)
+serial_tx_update(void)
+{
+	bool pending = serial_tx.rpos != serial_tx.wpos;
+
+	if (pending != serial_txi) {
+		serial_txi = pending;
+		outb(COM1 + COM_IER, COM_IER_RDI | (pending ? COM_IER_TXI : 0));
+	}
+}
+
+// 轮询等待发送 FIFO 为空(有上限，与原来逐字符输出时相同)，然后写入下一批字符
+static void
+serial_tx_poll(void)
 {
 	int i;
 
@@ -70,15 +112,37 @@ serial_putc(int c)
 	     !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
 	     i++)
 		delay();
+	serial_tx_drain();
+}
 
-	outb(COM1 + COM_TX, c);
+// IRQ 4: 接收字符，并继续发送缓冲区中的字符
+void
+serial_intr(void)
+{
+	if (!serial_exists)
+		return;
+	(void) inb(COM1+COM_IIR);
+	cons_intr(serial_proc_data);
+	serial_tx_drain();
+	serial_tx_update();
+}
+
+// 把字符放入发送缓冲区，缓冲区满时才轮询发送
+static void
+serial_putc(int c)
+{
+	if (!serial_exists)
+		return;
+	while (serial_tx.wpos - serial_tx.rpos == SERIAL_TXBUFSIZE)
+		serial_tx_poll();
+	serial_tx.buf[serial_tx.wpos++ % SERIAL_TXBUFSIZE] = c;
 }
 
 static void
 serial_init(void)
 {
-	// Turn off the FIFO
-	outb(COM1+COM_FCR, 0);
+	// Enable and clear the FIFOs (1-byte receive trigger level)
+	outb(COM1+COM_FCR, COM_FCR_ENABLE | COM_FCR_CLRRX | COM_FCR_CLRTX);
 
 	// Set speed; requires DLAB latch
 	outb(COM1+COM_LCR, COM_LCR_DLAB);
@@ -90,7 +154,8 @@ serial_init(void)
 
 	// No modem controls
 	outb(COM1+COM_MCR, 0);
-	// Enable rcv interrupts
+	// Enable rcv interrupts; the transmit interrupt is enabled only while
+	// there is buffered output (serial_tx_update)
 	outb(COM1+COM_IER, COM_IER_RDI);
 
 	// Clear any preexisting overrun indications and interrupts
@@ -107,6 +172,8 @@ serial_init(void)
 
 
 /***** Parallel port output code *****/
+// 并口每个字符都要轮询忙状态并产生选通脉冲，只有定义了 CONS_LPT(kern/console.h)才输出到并口
+#ifdef CONS_LPT
 // 输出字符前的硬件准备工作
 static void
 lpt_putc(int c)
@@ -119,6 +186,12 @@ lpt_putc(int c)
 	outb(0x378+2, 0x08|0x04|0x01);
 	outb(0x378+2, 0x08);
 }
+#else
+static void
+lpt_putc(int c)
+{
+}
+#endif
 
 
 
@@ -448,7 +521,7 @@ cons_getc(void)
 	return 0;
 }
 
-// 输出一个字符导致控制台
+// 输出一个字符到控制台
 static void
 cons_putc(int c)
 {
@@ -457,6 +530,44 @@ cons_putc(int c)
 	cga_putc(c);
 }
 
+// 启动串口发送，发送 FIFO 为空时立即写入一批，其余由发送器空中断完成
+static void
+cons_kick(void)
+{
+	if (!serial_exists)
+		return;
+	serial_tx_drain();
+	serial_tx_update();
+}
+
+/**
+ * 输出 n 个字符到控制台，cprintf() 按行或按调用批量输出
+ * 字符先全部放入串口发送缓冲区，最后才启动一次发送
+ */
+void
+cons_write(const char *s, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++)
+		cons_putc((unsigned char) s[i]);
+	cons_kick();
+}
+
+/**
+ * 以轮询方式发送完串口缓冲区中的所有字符
+ * 用于关中断后不再返回的场合(panic)，此时发送器空中断不会再到来
+ */
+void
+cons_flush(void)
+{
+	if (!serial_exists)
+		return;
+	while (serial_tx.rpos != serial_tx.wpos)
+		serial_tx_poll();
+	serial_tx_update();
+}
+
 // initialize the console devices
 void
 cons_init(void)
@@ -476,6 +587,7 @@ void
 cputchar(int c)
 {
 	cons_putc(c);
+	cons_kick();
 }
 
 int
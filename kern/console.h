@@ -15,8 +15,13 @@
 #define CRT_COLS	80
 #define CRT_SIZE	(CRT_ROWS * CRT_COLS)
 
+// 同时把控制台输出写到并口(LPT1)
+// #define CONS_LPT
+
 void cons_init(void);
 int cons_getc(void);
+void cons_write(const char *s, size_t n);
+void cons_flush(void);
 
 void kbd_intr(void); // irq 1
 void serial_intr(void); // irq 4
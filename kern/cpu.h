@@ -35,10 +35,20 @@ struct CpuInfo {
 	// 调用 env_run() 的时候更新，实际上是更新当前 CPU 执行的环境
 	struct Env *cpu_env;
 
+	// 当前 CPU 的 FPU/SSE/AVX 寄存器中装载的是哪个环境的状态(由 kern/fpu.c 管理)
+	struct Env *cpu_fpu_owner;
+
 	// x86 TSS任务状态段用于寻位 Per-CPU 的内核栈
 	// CPUi 的TSS存于cpus[i].cpu_ts中，相关联的TSS描述符定义在GDT入口gdt[(GD_TSS0 >> 3) + i]
 	// 覆盖 kern/trap.c 定义的全局ts变量
 	struct Taskstate cpu_ts;
+
+	// CPU 时间统计(TSC 周期)，由 trap()、env_run() 和 sched_halt() 在持有大内核锁或关中断时更新
+	uint64_t cpu_start_tsc; // trap_init_percpu() 时的 TSC
+	uint64_t cpu_user_tsc;	// 运行用户环境的时间
+	uint64_t cpu_idle_tsc;	// 在 sched_halt() 中停机等待中断的时间
+	uint64_t cpu_mark_tsc;	// 最近一次陷入内核、进入用户态或停机时的 TSC
+	bool cpu_preempted;		// 本次调度由时钟中断引起，env_run() 切换到其他环境时计为原环境的非自愿切换
 };
 
 // 在 mpconfig.c 被初始化
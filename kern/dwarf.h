@@ -120,6 +120,7 @@ struct _Dwarf_Debug
     uint64_t  (*read)(uint8_t *, uint64_t *, int);
     uint64_t  (*decode)(uint8_t **, int);
     int       dbg_pointer_size; /* Object address size. */
+    void      *dbg_elf;         /* ELF image being described. */
 
 	//Follwing two can either be eh_frame or debug_frame, 
 	//depending upon what is supported.
@@ -288,5 +289,7 @@ typedef _Dwarf_LineInfo  *Dwarf_LineInfo;
 typedef _Dwarf_Line     *Dwarf_Line;
 
 int dwarf_srclines(Dwarf_Die *die, Dwarf_Line linebuf, Dwarf_Addr pc, Dwarf_Error *error);
+void _dwarf_fde_index_forget(const void *elf);
+void _dwarf_lineno_forget(const void *elf);
 
 #endif
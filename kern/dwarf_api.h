@@ -7,6 +7,7 @@
 
 extern uintptr_t read_section_headers(uintptr_t, uintptr_t);
 extern void find_debug_sections(uintptr_t);
+extern void restore_kernel_debug_sections(void);
 extern int dwarf_get_pc_info(uintptr_t addr, struct Ripdebuginfo *info);
 
 #endif
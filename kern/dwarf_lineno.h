@@ -6,12 +6,21 @@
 extern Dwarf_Attribute *_dwarf_attr_find(Dwarf_Die *, uint16_t);
 
 
+// 行号表中的一行
+struct LineRow {
+    uint64_t lr_addr;
+    uint32_t lr_line;
+    uint16_t lr_file;
+    uint16_t lr_endseq;     // 序列结束行(地址为序列之后的第一个地址)
+};
+
 //Functions declared in this module
 static int _dwarf_lineno_add_file(Dwarf_LineInfo, uint8_t **, const char *, Dwarf_Error *, Dwarf_Debug);
 
 static int
 _dwarf_lineno_run_program(Dwarf_CU *cu, Dwarf_LineInfo li, uint8_t *p,
-    uint8_t *pe, Dwarf_Addr pc, Dwarf_Error *error);
+    uint8_t *pe, Dwarf_Addr pc, struct LineRow *rows, int *nrowsp,
+    Dwarf_Error *error);
 
 static int
 _dwarf_lineno_add_file(Dwarf_LineInfo li, uint8_t **p, const char *compdir,
@@ -7,8 +7,8 @@
 #include "dwarf.h"
 
 #include "pmap.h"
+#include "bio.h"
 
-#define SECTSIZE 512
 #define OFFSET_CORRECT(x) (x - ROUNDDOWN(x, SECTSIZE))
 
 enum
@@ -29,7 +29,10 @@ Dwarf_Section section_info[NDEBUG_SECT] = {
 	{.ds_name = ".debug_str", .ds_data = NULL, .ds_addr = 0, .ds_size = 0},
 };
 
-void readsect(void *, uint64_t);
+// 内核自身的调试段，find_debug_sections() 切换到用户程序后用于恢复
+static Dwarf_Section kern_section_info[NDEBUG_SECT];
+
+void readsects(void *, uint64_t, uint64_t);
 void readseg(uint64_t, uint64_t, uint64_t, uint64_t *);
 
 uintptr_t
@@ -53,51 +56,35 @@ _dwarf_find_section(const char *name)
 	return ret;
 }
 
+/**
+ * 把调试段切换到嵌入内核的用户程序映像 elf
+ * 映像整个位于内核内存中，各调试段直接指向映像中的内容(elf + sh_offset)，不依赖用户地址空间；
+ * .eh_frame 的 ds_addr 仍是其在用户程序中的虚拟地址，供 pc 相对编码的地址计算使用
+ */
 void find_debug_sections(uintptr_t elf)
 {
 	Elf *ehdr = (Elf *)elf;
-	uintptr_t debug_address = USTABDATA;
 	Secthdr *sh = (Secthdr *)(((uint8_t *)ehdr + ehdr->e_shoff));
 	Secthdr *shstr_tab = sh + ehdr->e_shstrndx;
 	Secthdr *esh = sh + ehdr->e_shnum;
+	Dwarf_Section *ds;
+	int i;
+
+	for (i = 0; i < NDEBUG_SECT; i++)
+	{
+		section_info[i].ds_data = NULL;
+		section_info[i].ds_addr = 0;
+		section_info[i].ds_size = 0;
+	}
 	for (; sh < esh; sh++)
 	{
 		char *name = (char *)((uint8_t *)elf + shstr_tab->sh_offset) + sh->sh_name;
-		if (!strcmp(name, ".debug_info"))
-		{
-			section_info[DEBUG_INFO].ds_data = (uint8_t *)debug_address;
-			section_info[DEBUG_INFO].ds_addr = debug_address;
-			section_info[DEBUG_INFO].ds_size = sh->sh_size;
-			debug_address += sh->sh_size;
-		}
-		else if (!strcmp(name, ".debug_abbrev"))
-		{
-			section_info[DEBUG_ABBREV].ds_data = (uint8_t *)debug_address;
-			section_info[DEBUG_ABBREV].ds_addr = debug_address;
-			section_info[DEBUG_ABBREV].ds_size = sh->sh_size;
-			debug_address += sh->sh_size;
-		}
-		else if (!strcmp(name, ".debug_line"))
-		{
-			section_info[DEBUG_LINE].ds_data = (uint8_t *)debug_address;
-			section_info[DEBUG_LINE].ds_addr = debug_address;
-			section_info[DEBUG_LINE].ds_size = sh->sh_size;
-			debug_address += sh->sh_size;
-		}
-		else if (!strcmp(name, ".eh_frame"))
-		{
-			section_info[DEBUG_FRAME].ds_data = (uint8_t *)sh->sh_addr;
-			section_info[DEBUG_FRAME].ds_addr = sh->sh_addr;
-			section_info[DEBUG_FRAME].ds_size = sh->sh_size;
-			debug_address += sh->sh_size;
-		}
-		else if (!strcmp(name, ".debug_str"))
-		{
-			section_info[DEBUG_STR].ds_data = (uint8_t *)debug_address;
-			section_info[DEBUG_STR].ds_addr = debug_address;
-			section_info[DEBUG_STR].ds_size = sh->sh_size;
-			debug_address += sh->sh_size;
-		}
+
+		if (!(ds = _dwarf_find_section(name)))
+			continue;
+		ds->ds_data = (uint8_t *)elf + sh->sh_offset;
+		ds->ds_addr = ds == &section_info[DEBUG_FRAME] ? sh->sh_addr : (uintptr_t)ds->ds_data;
+		ds->ds_size = sh->sh_size;
 	}
 }
 
@@ -193,13 +180,21 @@ read_section_headers(uintptr_t elfhdr, uintptr_t to_va)
 		}
 	}
 
+	if (elfhdr == KELFHDR)
+		memmove(kern_section_info, section_info, sizeof(section_info));
 	return ((uintptr_t)kvbase + kvoffset);
 }
 
+// 把调试段切换回内核自身的调试段(由 find_debug_sections() 切换到了用户程序)
+void restore_kernel_debug_sections(void)
+{
+	memmove(section_info, kern_section_info, sizeof(section_info));
+}
+
 // 从内核读取"count"字节到物理地址"pa"的"offset"，可能复制的比要求的多
 void readseg(uint64_t pa, uint64_t count, uint64_t offset, uint64_t *kvoffset)
 {
-	uint64_t end_pa;
+	uint64_t end_pa, nsect;
 	uint64_t orgoff = offset;
 
 	end_pa = pa + count;
@@ -211,47 +206,24 @@ void readseg(uint64_t pa, uint64_t count, uint64_t offset, uint64_t *kvoffset)
 	// translate from bytes to sectors, and kernel starts at sector 1
 	offset = (offset / SECTSIZE) + 1;
 
-	// If this is too slow, we could read lots of sectors at a time.
-	// We'd write more to memory than asked, but it doesn't matter --
-	// we load in increasing order.
-	while (pa < end_pa)
-	{
-		readsect((uint8_t *)pa, offset);
-		pa += SECTSIZE;
-		*kvoffset += SECTSIZE;
-		offset++;
-	}
-
+	// 覆盖 [pa, end_pa) 的扇区数，offset 不是扇区对齐时数据跨越额外的一个扇区
+	nsect = ROUNDUP(end_pa - pa, SECTSIZE) / SECTSIZE;
 	if (((orgoff % SECTSIZE) + count) > SECTSIZE)
-	{
-		readsect((uint8_t *)pa, offset);
-		*kvoffset += SECTSIZE;
-	}
-	assert(*kvoffset % SECTSIZE == 0);
-}
+		nsect++;
 
-void waitdisk(void)
-{
-	// wait for disk reaady
-	while ((inb(0x1F7) & 0xC0) != 0x40)
-		/* do nothing */;
+	// 整段一次性用多扇区命令读取，而不是每个扇区一条命令
+	readsects((uint8_t *)pa, offset, nsect);
+	*kvoffset += nsect * SECTSIZE;
+	assert(*kvoffset % SECTSIZE == 0);
 }
 
-void readsect(void *dst, uint64_t offset)
+/**
+ * 从第 offset 个扇区开始连续读取 nsect 个扇区到 dst
+ * 经由内核块缓存读取：已缓存的扇区(如节头表和节名表所在的块)不再访问磁盘，
+ * 顺序读取调试段时缓存会预读后续的块
+ */
+void readsects(void *dst, uint64_t offset, uint64_t nsect)
 {
-	// wait for disk to be ready
-	waitdisk();
-
-	outb(0x1F2, 1); // count = 1
-	outb(0x1F3, offset);
-	outb(0x1F4, offset >> 8);
-	outb(0x1F5, offset >> 16);
-	outb(0x1F6, (offset >> 24) | 0xE0);
-	outb(0x1F7, 0x20); // cmd 0x20 - read sectors
-
-	// wait for disk to be ready
-	waitdisk();
-
-	// read a sector
-	insl(0x1F0, dst, SECTSIZE / 4);
+	if (bio_read(0, offset, dst, nsect) < 0)
+		panic("readsects: cannot read %lu sectors at sector %lu", nsect, offset);
 }
@@ -9,11 +9,16 @@
 #include "kern/pmap.h"
 #include "kern/trap.h"
 #include "kern/monitor.h"
+#include "kern/fpu.h"
+#include "kern/pmu.h"
 #include "kern/macro.h"
 #include "kern/dwarf_api.h"
 #include "kern/sched.h"
 #include "kern/cpu.h"
 #include "kern/spinlock.h"
+#include "kern/vma.h"
+#include "kern/image.h"
+#include "kern/trace.h"
 
 // 所有 Env 在内存（物理内存）中的存放是连续的，存放于 procs 处，可以通过数组的形式访问各个 Env
 // procs 指向 Env 数组的指针，其操作方式跟内存管理的 pages 类似
@@ -24,6 +29,11 @@ struct Env *procs = NULL;
 static struct Env *env_free_list;
 // (由 Env->env_link 链接所有空闲环境节点)
 
+// env_live 是所有已分配环境的循环双向链表(按分配顺序)，env_nlive 是其中的环境数
+// 调度和遍历环境的开销只与存在的环境数有关，而不是 NENV
+struct Env *env_live;
+int env_nlive;
+
 #define ENVGENSHIFT 12 // >= LOGNENV，支持最多"同时"执行 NENV 个用户环境
 
 /**
@@ -158,8 +168,8 @@ env_setup_vm(struct Env *e)
 	int i;
 	struct PageInfo *pp = NULL;
 
-	// 分配环境4级页表
-	if (!(pp = page_alloc(0)))
+	// 分配环境4级页表(清零，UTOP 以下的表项均不存在)
+	if (!(pp = page_alloc(ALLOC_ZERO)))
 		return -E_NO_MEM;
 
 	/**
@@ -228,6 +238,7 @@ int env_alloc(struct Env **newenv_store, envid_t parent_id)
 	e->env_type = PROC_TYPE_USER;
 	e->env_status = ENV_RUNNABLE;
 	e->env_runs = 0;
+	memset(&e->env_ru, 0, sizeof(e->env_ru));
 
 	// 清除所有已保存的寄存器状态，防止当前环境的寄存器值泄漏到新环境中(所有环境所使用寄存器相同)
 	memset(&e->env_tf, 0, sizeof(e->env_tf));
@@ -254,8 +265,27 @@ int env_alloc(struct Env **newenv_store, envid_t parent_id)
 	// 清除IPC接收标志.
 	e->env_ipc_recving = 0;
 
-	// 存储分配的环境
+	// 新环境没有任何虚拟内存区域
+	vma_clear(e);
+
+	// 新环境尚未使用过 FPU(env_free() 已释放其 XSAVE 区域)，其他 CPU 上残留的所有权随之失效
+	e->env_fpu_cpu = -1;
+	// 新环境没有使用性能计数器
+	memset(e->env_pmu_evtsel, 0, sizeof(e->env_pmu_evtsel));
+	memset(e->env_pmu_count, 0, sizeof(e->env_pmu_count));
+
+	// 存储分配的环境，并加入 env_live 的末尾
 	env_free_list = e->env_link;
+	if (env_live)
+	{
+		e->env_live_next = env_live;
+		e->env_live_prev = env_live->env_live_prev;
+		env_live->env_live_prev->env_live_next = e;
+		env_live->env_live_prev = e;
+	}
+	else
+		env_live = e->env_live_next = e->env_live_prev = e;
+	env_nlive++;
 	*newenv_store = e;
 
 	cprintf("[%08x] new proc %08x\n", curenv ? curenv->proc_id : 0, e->proc_id);
@@ -263,35 +293,20 @@ int env_alloc(struct Env **newenv_store, envid_t parent_id)
 }
 
 /**
- * 为用户环境 e 分配和映射物理内存，用于存储环境运行所需资源(调用page_insert())
+ * 为用户环境 e 分配一段匿名的虚拟内存区域 [va, va+len)，用于存储环境运行所需资源(栈)
  * 参数：
- * e:Env指针, va:虚拟地址, len:分配和映射的空间大小
- * 作用：在 e 指向的用户虚拟地址空间中分配[va, va+len)一段区域，为后续写入数据作准备
- * - 不需要对分配的空间初始化
+ * e:Env指针, va:虚拟地址, len:分配的空间大小
+ * 作用：在 e 的用户虚拟地址空间中登记[va, va+len)一段可写的匿名区域(VMA_ANON)
+ * - 不立即分配物理页，环境首次访问某一页时由 page_fault_handler() 分配清零的物理页(按需调页)
  * - 分配的页用户和内核具有写权限
- * - 需要对起始地址 va 和长度 len 进行页对齐
- * - 只在 load_icode() 调用
- * 
- * 实现：
- * 类似pmap.c中的boot_map_region()，却不一样
- * boot_map_region() 操作的是内核的虚拟地址空间，boot_pml4e提供的是静态映射(内核共享)，且不涉及物理页的分配
- * 而region_alloc() 则是要为实际的物理页帧分配(page_insert())映射到当前用户的虚拟地址空间(page_alloc())中(页表页项)
+ * - 起始地址 va 和长度 len 按页对齐扩展
+ * - 因此环境创建的开销与区域大小无关
  */
 static void
 region_alloc(struct Env *e, void *va, size_t len)
 {
-	// 开始区间和结束区间页对齐
-	size_t start = ROUNDDOWN((uint64_t)va, PGSIZE);
-	size_t end = ROUNDUP((uint64_t)(va + len), PGSIZE);
-	for (; start < end; start += PGSIZE)
-	{
-		// 分配一个物理页帧
-		struct PageInfo *pp = page_alloc(0);
-		if (!pp)
-			panic("No memory available for allocation to environment.");
-		if (page_insert(e->env_pml4e, pp, (void *)start, PTE_U | PTE_P | PTE_W) < 0)
-			panic("Cannot allocate any memory.");
-	}
+	if (vma_add(e, VMA_ANON, (uintptr_t)va, len, PTE_U | PTE_P | PTE_W, 0, 0) < 0)
+		panic("region_alloc: too many memory regions for environment.");
 }
 
 /**
@@ -300,8 +315,8 @@ region_alloc(struct Env *e, void *va, size_t len)
  * - 像bootloader，从ELF文件加载用户环境的初始代码区、栈和处理器标识位
  * - 这个函数仅在内核初始化期间、第一个用户态环境运行前被调用
  * - 将 ELF 镜像中所有可加载的段载入到用户地址空间中，并设置 e->env_tf.tf_rip 为 ELF 的 entry point，以便环境执行程序指令
- * - 清零 .bss 段
- * - 映射环境的初始栈
+ * - 登记 .bss 段(首次访问时清零)
+ * - 登记环境的初始栈
  * 
  * 由于还没有实现文件系统，所以用户环境实际的存放的位置实际上是在内存中的，文件载入内存，实际上是内存之间的数据的复制而已
  * 所以这个函数的作用就是将嵌入在内核中的用户环境复制到user.ld指定的用户虚拟地址空间(0x800020)
@@ -318,14 +333,10 @@ void load_icode(struct Env *e, uint8_t *binary)
 	 * 所以具体来讲，就是每个程序段ph，总共占用p_memsz的内存，
 	 * 前面p_filesz的空间从binary的对应内存复制过来，后面剩下的空间全部清0
 	 * 
-	 * 2.ph->p_va 指向该程序段应该被存储到用户环境Env的虚拟空间地址. 
-	 * 可是，在进入 load_icode() 时，是内核态进入的，所以虚拟地址空间还是内核的空间
-	 * 要如何对用户的虚拟空间进行操作呢？
-	 *  lcr3 (e->env_cr3);
-	 * 这个语句在进入每个程序头进行具体设置时，将页表切换到用户虚拟地址空间
-	 * 方便的通过 memset() 和 memmove() 函数对 va 进行相应的操作了
-	 * 其中 e->env_cr3 的值是在前面的 env_setup_vm() 设置好的
-	 * ELF 载入完毕以后，就不需要对用户空间进行操作了，所以在最后切回到内核虚拟地址空间来
+	 * 2.ph->p_va 指向该程序段应该被存储到用户环境Env的虚拟空间地址.
+	 * load_icode() 并不复制程序段，而是为每个程序段登记一个 VMA(kern/vma.c)
+	 * 环境首次访问某一页时，page_fault_handler() 才映射程序映像(kern/image.c)中的只读页，或分配物理页并从映像复制数据或清零
+	 * 所以不需要 lcr3(e->env_cr3) 切换到用户虚拟地址空间，创建环境的开销也与程序段大小无关
 	 * 
 	 * 3.要配置程序的入口地址，对应的操作: e->env_tf.tf_rip = ELFHDR->e_entry;
 	 */
@@ -336,42 +347,31 @@ void load_icode(struct Env *e, uint8_t *binary)
 	// 判断是否为有效的 ELF文件
 	if (env_elf->e_magic != ELF_MAGIC)
 		panic("load_icode: The binary is not a valid ELF!\n");
+	// 程序段的内容来自程序映像缓存，由同一嵌入程序创建的环境共享只读页，也用于解析调试信息
+	if (!(e->env_image = image_mem(binary)))
+		panic("load_icode: no free program image slot.\n");
 
 	// 加载程序段：
 	// ph 指向ELF头部的程序头的起始地址(env_elf+env_elf->e_phoff)
 	ph = (struct Proghdr *)((uint8_t *)env_elf + env_elf->e_phoff);
 	// eph(end of ph): ELF头部所有程序之后的结尾处
 	eph = ph + env_elf->e_phnum;
-	// 在内核对用户的虚拟空间进行操作
-	// A:用户虚拟地址空间的4级页表e->env_cr3
-	lcr3(e->env_cr3);
-
 	for (; ph < eph; ph++)
 	{
 		// 只加载 LOAD 类型的程序段到内存
-		if (ph->p_type == ELF_PROG_LOAD)
-		{
-			// AlvOS 分配用户空间不是连续的，而是根据ph->p_va作为每次的开始地址，以p_memsz为长度进行页分配
-			// 首先对当前用户环境在虚拟地址处分配空闲的物理页
-			region_alloc(e, (void *)ph->p_va, ph->p_memsz);
-			// 将当前ELF程序段 ph 的数据复制到p_va虚拟地址空间，大小p_filesz
-			memmove((void *)ph->p_va, (void *)(binary + ph->p_offset), ph->p_filesz);
-			// ELF文件中BSS段中那些没有被初始化的静态变量，全部初始化为0，即p_memsz-p_filesz的部分(.bss)
-			// 又因为函数 region_alloc 分配的物理页已经标志ALLOC_ZERO，无需再memset清零
-			memset((void *)(ph->p_va + ph->p_filesz), 0, ph->p_memsz - ph->p_filesz);
-		}
+		// AlvOS 分配用户空间不是连续的，而是根据ph->p_va作为每次的开始地址，以p_memsz为长度登记一个 VMA_BINARY 区域
+		// 前 p_filesz 字节来自程序映像中 p_offset 处，其余(.bss)清零，均在环境首次访问对应页时才填充
+		if (ph->p_type == ELF_PROG_LOAD && vma_add_segment(e, ph) < 0)
+			panic("load_icode: bad or too many program segments.\n");
 	}
-	// 恢复cr3寄存器为内核的4级页表
-	lcr3(boot_cr3);
 
 	// 这样才能根据设置好的cs与新的偏移量eip找到用户程序需要执行的代码
 	e->env_tf.tf_rip = env_elf->e_entry;
-	// 再在虚拟地址(USTACKTOP-PGSIZE)为环境映射一个 PGSIZE 大小的初始栈
+	// 再在虚拟地址(USTACKTOP-2*PGSIZE)为环境登记两个 PGSIZE 大小的初始栈
 	region_alloc(e, (void *)(USTACKTOP - 2 * PGSIZE), 2 * PGSIZE);
 
 	// 在许多系统上，内核初始化分配一个栈页，然后如果程序发生的故障是去访问这个栈页下面的页，那么内核会自动分配这些页，并让程序继续运行
 	// 通过这种方式，内核只分配程序所需要的内存栈，但是程序可以运行在一个任意大小的栈的假像中
-	e->elf = binary;
 }
 
 /**
@@ -405,14 +405,18 @@ void create_proc(uint8_t *binary, enum EnvType type)
  */
 void env_free(struct Env *e)
 {
-	pte_t *pt;
-	uint64_t pdeno, pteno;
+	uint64_t pdeno;
 	physaddr_t pa;
 
 	// 如果释放当前环境，在释放页面目录之前切换到 boot_pml4e，以防重用该页面.
 	if (e == curenv)
 		lcr3(boot_cr3);
 
+	// 释放 FPU 状态，停止正在使用的性能计数器
+	fpu_free(e);
+	if (e == curenv)
+		pmu_leave(e);
+
 	// 刷新地址空间用户部分的所有映射页面
 	pdpe_t *env_pdpe = KADDR(PTE_ADDR(e->env_pml4e[0]));
 	int pdeno_limit;
@@ -431,18 +435,11 @@ void env_free(struct Env *e)
 			// 只查看映射的页表
 			if (!(env_pgdir[pdeno] & PTE_P))
 				continue;
-			// 找到页表的 pa 和 va
+			// 找到页表的 pa
 			pa = PTE_ADDR(env_pgdir[pdeno]);
-			pt = (pte_t *)KADDR(pa);
 
-			// 取消映射此页表中的所有 PTE
-			for (pteno = 0; pteno < PTX(~0); pteno++)
-			{
-				if (pt[pteno] & PTE_P)
-				{
-					page_remove(e->env_pml4e, PGADDR((uint64_t)0, pdpe_index, pdeno, pteno, 0));
-				}
-			}
+			// 取消映射此页表中的所有 PTE(整个页表页只遍历一次4级页表)
+			page_remove_range(e->env_pml4e, (uintptr_t)PGADDR((uint64_t)0, pdpe_index, pdeno, (uint64_t)0, 0), PTSIZE);
 
 			// 释放页表本身
 			env_pgdir[pdeno] = 0;
@@ -461,13 +458,57 @@ void env_free(struct Env *e)
 	e->env_pml4e = 0;
 	e->env_cr3 = 0;
 	page_decref(pa2page(pa));
+	// 清空 VMA，释放对程序映像的引用
+	vma_clear(e);
 
-	// 返回环境到 env_free_list
+	// 从 env_live 中移除，返回环境到 env_free_list
+	if (e->env_live_next == e)
+		env_live = NULL;
+	else
+	{
+		e->env_live_prev->env_live_next = e->env_live_next;
+		e->env_live_next->env_live_prev = e->env_live_prev;
+		if (env_live == e)
+			env_live = e->env_live_next;
+	}
+	e->env_live_next = e->env_live_prev = NULL;
+	env_nlive--;
 	e->env_status = ENV_FREE;
 	e->env_link = env_free_list;
 	env_free_list = e;
 }
 
+/**
+ * 统计环境 e 的用户地址空间占用的页表页数(PML4、页目录指针表、页目录和页表)，
+ * 与 env_free() 的遍历范围相同；*nmapped 为其中映射的用户页数
+ */
+size_t env_pgtable_pages(struct Env *e, size_t *nmapped)
+{
+	pdpe_t *env_pdpe = KADDR(PTE_ADDR(e->env_pml4e[0]));
+	size_t npt = 2, n = 0;
+	uint64_t pdpe_index, pdeno, pteno;
+
+	for (pdpe_index = 0; pdpe_index <= 3; pdpe_index++)
+	{
+		if (!(env_pdpe[pdpe_index] & PTE_P))
+			continue;
+		pde_t *env_pgdir = KADDR(PTE_ADDR(env_pdpe[pdpe_index]));
+		npt++;
+		for (pdeno = 0; pdeno < (pdpe_index == 3 ? PDX(UTOP) : NPDENTRIES); pdeno++)
+		{
+			if (!(env_pgdir[pdeno] & PTE_P))
+				continue;
+			pte_t *pt = KADDR(PTE_ADDR(env_pgdir[pdeno]));
+			npt++;
+			for (pteno = 0; pteno < NPTENTRIES; pteno++)
+				if (pt[pteno] & PTE_P)
+					n++;
+		}
+	}
+	*nmapped = n;
+	return npt;
+}
+
 //
 // 释放环境 e。
 // 如果 e 是当前的 env，则运行一个新环境(并且不返回给调用者)。
@@ -555,22 +596,43 @@ void env_run(struct Env *e)
 	 * 注意，这个函数从e->env_tf加载新环境的状态，确保您已经将e->env_tf的相关部分设置为合理的值
 	 */
 
+	// 本次进入内核以来的时间计入原环境的内核态时间
+	if (curenv)
+		curenv->env_ru.ru_stime += read_tsc() - thiscpu->cpu_mark_tsc;
+	// 上下文切换时，保存原环境在本次运行中修改过的 FPU 状态和性能计数器
+	if (curenv && curenv != e)
+	{
+		fpu_leave(curenv);
+		pmu_leave(curenv);
+		// 时钟中断后重新选中同一环境不算上下文切换
+		if (thiscpu->cpu_preempted)
+			curenv->env_ru.ru_nivcsw++;
+	}
+	thiscpu->cpu_preempted = 0;
 	// 1.如果当前运行的环境(curenv)是正在运行(ENV_RUNNING)，上下文切换，更新状态为等待运行(ENV_RUNNABLE)
 	if (curenv && curenv->env_status == ENV_RUNNING)
 	{
 		curenv->env_status = ENV_RUNNABLE;
 	}
+	// 切换到 e 时启用它使用的性能计数器(只在用户态计数)
+	if (curenv != e)
+		pmu_enter(e);
 	// 2~4.设置curenv为新环境，并更新状态和运行次数
 	curenv = e;
 	curenv->env_status = ENV_RUNNING;
 	curenv->env_runs++;
+	TRACE(TRACE_ENV_RUN, e->proc_id, e->env_runs);
 	// env_run() 修改了参数e的成员状态之后就会调用lcr3切换到进程的4级页表，这时候MMU所寻址的地址空间立即发生了变化
 	// 在地址切换前后，为什么参数e仍能够被引用？
 	// 内核地址空间被映射到4级页表，所有环境4级页表的内核部分是相同的，通过内核地址空间访问e.(以DPL=0内核态的形式)
 	// 5.使用lcr3()切换到e对应的4级页表(地址空间)
 	lcr3(curenv->env_cr3);
+	// 寄存器中仍是 e 的 FPU 状态时直接使用，否则在首次使用 FPU 时触发 #NM 惰性恢复
+	fpu_enter(e);
 	// 用户态 -> 内核态，加大内核锁
 	unlock_kernel();
+	// 从这里到下一次陷入内核的时间计为用户态时间(见 trap())
+	thiscpu->cpu_mark_tsc = read_tsc();
 	// 调用env_pop_tf切换(恢复)回用户态
 	env_pop_tf(&e->env_tf);
 }
@@ -6,6 +6,9 @@
 
 // kern/env.c 中定义的 procs[NENV]
 extern struct Env *procs;
+// 所有已分配环境的循环双向链表及环境数
+extern struct Env *env_live;
+extern int env_nlive;
 // 当前运行环境
 #define curenv (thiscpu->cpu_env)
 extern struct Segdesc gdt[];
@@ -14,6 +17,7 @@ void env_init(void);
 void env_init_percpu(void);
 int env_alloc(struct Env **e, envid_t parent_id);
 void env_free(struct Env *e);
+size_t env_pgtable_pages(struct Env *e, size_t *nmapped);
 void create_proc(uint8_t *binary, enum EnvType type);
 // if e == curenv, 不返回
 void env_destroy(struct Env *e);
@@ -26,12 +30,12 @@ void env_pop_tf(struct Trapframe *tf) __attribute__((noreturn));
 // 没有这个宏，由于 C 预处理器的参数预扫描规则，无法将的宏传递给 create_proc.
 #define PROC_PASTE3(x, y, z) x##y##z
 
-#define CREATE_PROC(x)                                   \
+#define CREATE_PROC(x, type)                                   \
 	do                                                        \
 	{                                                         \
 		extern uint8_t PROC_PASTE3(_binary_obj_, x, _start)[]; \
 		create_proc(PROC_PASTE3(_binary_obj_, x, _start),       \
-				   PROC_TYPE_USER);                                     \
+				   type);                                     \
 	} while (0)
 
 #endif
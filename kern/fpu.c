@@ -0,0 +1,219 @@
+/**
+ * 惰性(lazy)切换环境的 x87/SSE/AVX 寄存器状态
+ * 环境的 FPU 状态保存在首次使用 FPU 时分配的一个物理页中(XSAVE 区域，64 字节对齐)
+ * 每个 CPU 记录当前寄存器中装载的是哪个环境的状态(cpu_fpu_owner)：
+ * - env_run() 切换到该环境时清除 CR0.TS，否则置位 CR0.TS，环境首次执行 FPU 指令时触发 #NM(T_DEVICE)
+ * - #NM 时由 fpu_trap() 用 XRSTOR 装载该环境的状态，并把该 CPU 的所有权交给它
+ * - 环境离开 CPU 时，只有它拥有寄存器且使用过 FPU(CR0.TS 为 0)才用 XSAVEOPT 保存
+ * 从不使用 FPU 的环境不分配 XSAVE 区域，也不会触发 #NM 或保存/恢复
+ * 内核自身不使用 FPU/SSE 寄存器(-mno-sse)，因此在内核中无需保存环境的 FPU 状态
+ *
+ * 环境离开时就保存状态(而不是等到其他环境抢占所有权时再保存)，是因为环境可能迁移到其他 CPU 上运行，
+ * 此时只能从内存中恢复；env_fpu_cpu 记录环境的状态最后一次装载到哪个 CPU，以判断该 CPU 寄存器中的副本是否仍然有效
+ */
+#include "inc/x86.h"
+#include "inc/mmu.h"
+#include "inc/string.h"
+#include "inc/assert.h"
+#include "inc/error.h"
+
+#include "kern/fpu.h"
+#include "kern/env.h"
+#include "kern/cpu.h"
+#include "kern/pmap.h"
+
+// XCR0 中内核为环境启用的状态分量
+#define XCR0_X87 0x1
+#define XCR0_SSE 0x2
+#define XCR0_AVX 0x4
+
+// 保存/恢复所用的指令
+enum
+{
+	FPU_FXSAVE = 0, // 不支持 XSAVE，只保存 x87/SSE
+	FPU_XSAVE,
+	FPU_XSAVEOPT,
+};
+
+static int fpu_mode;
+static uint64_t fpu_xcr0;
+
+static inline void
+xsetbv(uint32_t index, uint64_t val)
+{
+	asm volatile("xsetbv" ::"c"(index), "a"((uint32_t)val), "d"((uint32_t)(val >> 32)));
+}
+
+static inline void
+clts(void)
+{
+	asm volatile("clts");
+}
+
+static inline void
+stts(void)
+{
+	lcr0(rcr0() | CR0_TS);
+}
+
+/**
+ * 每个 CPU 调用一次：允许执行 x87/SSE 指令(CR0.EM=0, CR4.OSFXSR)，支持 XSAVE 时设置 XCR0，最后置位 CR0.TS
+ */
+void fpu_init_percpu(void)
+{
+	uint32_t ecx, edx, eax;
+
+	cpuid(1, NULL, NULL, &ecx, &edx);
+	if (!(edx & (1 << 24)))
+		panic("fpu_init_percpu: CPU does not support FXSAVE");
+
+	lcr0((rcr0() & ~CR0_EM) | CR0_MP | CR0_NE);
+	lcr4(rcr4() | CR4_OSFXSR | CR4_OSXMMEXCPT);
+
+	fpu_mode = FPU_FXSAVE;
+	if (ecx & (1 << 26))
+	{
+		lcr4(rcr4() | CR4_OSXSAVE);
+		cpuid_count(0xd, 0, &eax, NULL, NULL, NULL);
+		fpu_xcr0 = (XCR0_X87 | XCR0_SSE) | (eax & XCR0_AVX);
+		xsetbv(0, fpu_xcr0);
+		cpuid_count(0xd, 1, &eax, NULL, NULL, NULL);
+		fpu_mode = (eax & 1) ? FPU_XSAVEOPT : FPU_XSAVE;
+	}
+	asm volatile("fninit");
+	stts();
+}
+
+static void
+fpu_save(void *area)
+{
+	uint32_t lo = (uint32_t)fpu_xcr0, hi = (uint32_t)(fpu_xcr0 >> 32);
+
+	if (fpu_mode == FPU_XSAVEOPT)
+		asm volatile("xsaveopt64 (%0)" ::"r"(area), "a"(lo), "d"(hi)
+					 : "memory");
+	else if (fpu_mode == FPU_XSAVE)
+		asm volatile("xsave64 (%0)" ::"r"(area), "a"(lo), "d"(hi)
+					 : "memory");
+	else
+		asm volatile("fxsave64 (%0)" ::"r"(area)
+					 : "memory");
+}
+
+static void
+fpu_restore(void *area)
+{
+	uint32_t lo = (uint32_t)fpu_xcr0, hi = (uint32_t)(fpu_xcr0 >> 32);
+
+	if (fpu_mode == FPU_FXSAVE)
+		asm volatile("fxrstor64 (%0)" ::"r"(area)
+					 : "memory");
+	else
+		asm volatile("xrstor64 (%0)" ::"r"(area), "a"(lo), "d"(hi)
+					 : "memory");
+}
+
+/**
+ * env_run() 在返回用户态之前调用：若该 CPU 寄存器中仍是 e 的状态，则清除 CR0.TS 直接使用，否则置位 CR0.TS
+ */
+void fpu_enter(struct Env *e)
+{
+	if (thiscpu->cpu_fpu_owner == e && e->env_fpu_cpu == cpunum())
+		clts();
+	else
+		stts();
+}
+
+/**
+ * 环境 e 离开当前 CPU(切换到其他环境或 CPU 空闲)时调用
+ * 只有 e 拥有寄存器并且在本次运行中使用过 FPU(CR0.TS 为 0)时才保存，所有权保持不变，
+ * 若 e 再次在该 CPU 上运行且期间无其他环境使用 FPU，则无需恢复
+ */
+void fpu_leave(struct Env *e)
+{
+	if (thiscpu->cpu_fpu_owner != e || (rcr0() & CR0_TS))
+		return;
+	fpu_save(e->env_fpu);
+	stts();
+}
+
+/**
+ * #NM(T_DEVICE) 处理：用户环境在 CR0.TS 置位时执行了 FPU/SSE/AVX 指令
+ * 首次使用时分配 XSAVE 区域(初始状态)，然后装载 curenv 的状态并获得该 CPU 的所有权
+ * 其他环境的状态已在其离开 CPU 时保存，此处无需再保存
+ */
+void fpu_trap(struct Trapframe *tf)
+{
+	struct Env *e = curenv;
+	struct PageInfo *pp;
+	uint8_t *area;
+
+	if ((tf->tf_cs & 3) == 0)
+		panic("fpu_trap: FPU used in kernel mode");
+
+	if (!e->env_fpu)
+	{
+		if (!(pp = page_alloc(ALLOC_ZERO)))
+		{
+			cprintf("[%08x] fpu_trap: no memory for FPU state\n", e->proc_id);
+			env_destroy(e);
+			return;
+		}
+		pp->pp_ref++;
+		area = page2kva(pp);
+		// FXSAVE 格式的默认值: FCW = 0x37f, MXCSR = 0x1f80(屏蔽所有异常)
+		*(uint16_t *)(area + 0) = 0x37f;
+		*(uint32_t *)(area + 24) = 0x1f80;
+		// XSAVE 头部 XSTATE_BV 只标记 x87/SSE，其余分量(AVX)按初始状态装载
+		if (fpu_mode != FPU_FXSAVE)
+			*(uint64_t *)(area + 512) = XCR0_X87 | XCR0_SSE;
+		e->env_fpu = area;
+		e->env_fpu_cpu = -1;
+	}
+
+	clts();
+	if (thiscpu->cpu_fpu_owner != e || e->env_fpu_cpu != cpunum())
+		fpu_restore(e->env_fpu);
+	thiscpu->cpu_fpu_owner = e;
+	e->env_fpu_cpu = cpunum();
+}
+
+/**
+ * sys_exofork() 调用：子环境 child 继承父环境 parent(curenv) 的 FPU 状态
+ * 父环境的最新状态可能还在寄存器中，先保存到其 XSAVE 区域，再复制一份给子环境
+ * 父环境从未使用 FPU 时子环境也不分配；内存不足时返回 -E_NO_MEM
+ */
+int fpu_fork(struct Env *child, struct Env *parent)
+{
+	struct PageInfo *pp;
+
+	if (!parent->env_fpu)
+		return 0;
+	fpu_leave(parent);
+	if (!(pp = page_alloc(0)))
+		return -E_NO_MEM;
+	pp->pp_ref++;
+	memcpy(page2kva(pp), parent->env_fpu, PGSIZE);
+	child->env_fpu = page2kva(pp);
+	child->env_fpu_cpu = -1;
+	return 0;
+}
+
+/**
+ * env_free() 调用：释放 e 的 XSAVE 区域，并放弃当前 CPU 上的所有权
+ * 其他 CPU 上残留的所有权由 env_alloc() 把 env_fpu_cpu 置为 -1 来失效
+ */
+void fpu_free(struct Env *e)
+{
+	if (thiscpu->cpu_fpu_owner == e)
+	{
+		thiscpu->cpu_fpu_owner = NULL;
+		stts();
+	}
+	if (e->env_fpu)
+	{
+		page_decref(pa2page(PADDR(e->env_fpu)));
+		e->env_fpu = NULL;
+	}
+	e->env_fpu_cpu = -1;
+}
@@ -0,0 +1,17 @@
+#ifndef ALVOS_KERN_FPU_H
+#define ALVOS_KERN_FPU_H
+#ifndef ALVOS_KERNEL
+# error "This is a AlvOS kernel header; user programs should not #include it"
+#endif
+
+#include "inc/env.h"
+#include "inc/trap.h"
+
+void fpu_init_percpu(void);
+void fpu_enter(struct Env *e);
+void fpu_leave(struct Env *e);
+void fpu_trap(struct Trapframe *tf);
+int fpu_fork(struct Env *child, struct Env *parent);
+void fpu_free(struct Env *e);
+
+#endif
@@ -0,0 +1,485 @@
+/**
+ * 中断驱动的 IDE(ATA PIO) 磁盘驱动，只管理主 IDE 通道(0x1F0~0x1F7, IRQ14)上的两个设备
+ *
+ * 所有请求挂在一个按 (设备, LBA) 排序的等待队列上，驱动按电梯(C-LOOK)顺序服务：
+ * 从上一个请求结束的位置开始，选择 LBA 不小于当前位置的第一个请求，到达队尾后回到队首
+ * 每个请求只发出一条多扇区命令(设备支持时使用 READ/WRITE MULTIPLE，每次 DRQ 传输多个扇区)，
+ * 随后由 IDE 中断推进数据传输，CPU 不再忙等状态寄存器：
+ * - 读：每次中断时设备已准备好一个数据块，ide_intr() 读出该块
+ * - 写：发出命令后写入第一个数据块，之后每次中断写入下一个数据块，最后一次中断表示写入完成
+ * 请求完成后立即发出队列中的下一个请求，并调用请求的完成函数(如唤醒等待的环境)
+ *
+ * 内核自身(如启动时读取 DWARF 调试段)无法阻塞，使用 ide_rw() 同步等待：
+ * 它在请求完成前轮询同一个服务例程，因此同步请求与环境的异步请求共用一个队列
+ * 驱动的所有状态都由大内核锁保护
+ */
+#include "inc/x86.h"
+#include "inc/error.h"
+#include "inc/assert.h"
+#include "inc/stdio.h"
+#include "inc/string.h"
+
+#include "kern/ide.h"
+#include "kern/env.h"
+#include "kern/pmap.h"
+#include "kern/picirq.h"
+
+// 主 IDE 通道的寄存器
+#define IDE_DATA 0x1F0
+#define IDE_ERROR 0x1F1
+#define IDE_NSECT 0x1F2
+#define IDE_LBA0 0x1F3
+#define IDE_LBA1 0x1F4
+#define IDE_LBA2 0x1F5
+#define IDE_DRIVE 0x1F6
+#define IDE_CMD 0x1F7 // 读：状态寄存器(读取即应答设备的中断)
+#define IDE_CTRL 0x3F6 // 写：设备控制寄存器；读：备用状态寄存器(不应答中断)
+
+// 状态寄存器
+#define IDE_BSY 0x80
+#define IDE_DRDY 0x40
+#define IDE_DF 0x20
+#define IDE_DRQ 0x08
+#define IDE_ERR 0x01
+
+// 设备控制寄存器
+#define IDE_CTRL_NIEN 0x02 // 禁止设备产生中断
+
+// 命令
+#define ATA_READ 0x20
+#define ATA_WRITE 0x30
+#define ATA_READ_MULTI 0xC4
+#define ATA_WRITE_MULTI 0xC5
+#define ATA_READ_EXT 0x24
+#define ATA_WRITE_EXT 0x34
+#define ATA_READ_MULTI_EXT 0x29
+#define ATA_WRITE_MULTI_EXT 0x39
+#define ATA_SET_MULTI 0xC6
+#define ATA_IDENTIFY 0xEC
+
+// READ/WRITE MULTIPLE 每个数据块的扇区数上限
+#define IDE_MULTI_MAX 16
+// 初始化时轮询等待设备的次数上限(不存在的设备可能一直不就绪)
+#define IDE_PROBE_SPIN 1000000
+
+// 同时存在的异步请求数(每个环境同一时刻最多有一个)
+#define NIDEREQ 64
+
+struct IdeDisk
+{
+	int id_present;	  // 设备存在且是 ATA 磁盘
+	int id_lba48;	  // 支持 48 位 LBA
+	int id_multi;	  // READ/WRITE MULTIPLE 每个数据块的扇区数，0 表示不使用
+	uint64_t id_nsect; // 容量(扇区数)
+};
+
+static struct IdeDisk ide_disks[IDE_NDEV];
+
+// 按 (设备, LBA) 升序排列的等待队列，以及正在传输的请求
+static struct IdeReq *ide_queue;
+static struct IdeReq *ide_active;
+// 磁头位置：上一个请求结束处的 (设备, LBA)，电梯算法从这里继续
+static uint64_t ide_head;
+
+// 环境发起的异步请求从这里分配
+static struct IdeReq ide_reqs[NIDEREQ];
+static struct IdeReq *ide_req_free_list;
+
+static inline uint64_t
+ide_key(int dev, uint64_t lba)
+{
+	return ((uint64_t)dev << 48) | lba;
+}
+
+// 读 4 次备用状态寄存器，等待约 400ns 让设备更新状态
+static void
+ide_delay(void)
+{
+	inb(IDE_CTRL);
+	inb(IDE_CTRL);
+	inb(IDE_CTRL);
+	inb(IDE_CTRL);
+}
+
+// 轮询等待 BSY 清零，返回最终的状态，超时返回 -1；只在初始化和发出命令前使用
+static int
+ide_wait(int spin)
+{
+	int st;
+
+	while (((st = inb(IDE_CMD)) & IDE_BSY) && --spin > 0)
+		/* do nothing */;
+	return spin > 0 ? st : -1;
+}
+
+/**
+ * 用 IDENTIFY DEVICE 探测设备，记录是否支持 LBA48、READ/WRITE MULTIPLE 的块大小和容量
+ * 初始化期间设备中断被禁止，因此这里轮询即可
+ */
+static void
+ide_probe(int dev)
+{
+	struct IdeDisk *d = &ide_disks[dev];
+	uint16_t id[256];
+	int st, multi;
+
+	outb(IDE_DRIVE, 0xA0 | (dev << 4));
+	ide_delay();
+	outb(IDE_NSECT, 0);
+	outb(IDE_LBA0, 0);
+	outb(IDE_LBA1, 0);
+	outb(IDE_LBA2, 0);
+	outb(IDE_CMD, ATA_IDENTIFY);
+	ide_delay();
+
+	// 状态为 0 表示设备不存在，0xFF 表示通道上没有控制器(总线悬空)
+	st = inb(IDE_CMD);
+	if (st == 0 || st == 0xFF)
+		return;
+	if ((st = ide_wait(IDE_PROBE_SPIN)) < 0)
+		return;
+	// ATAPI/SATA 设备会在 LBA1/LBA2 中给出签名，不是 ATA 磁盘
+	if (inb(IDE_LBA1) || inb(IDE_LBA2))
+		return;
+	while (!((st = inb(IDE_CMD)) & (IDE_DRQ | IDE_ERR)))
+		/* do nothing */;
+	if (st & IDE_ERR)
+		return;
+	insl(IDE_DATA, id, sizeof(id) / 4);
+
+	d->id_present = 1;
+	d->id_lba48 = (id[83] >> 10) & 1;
+	if (d->id_lba48)
+		d->id_nsect = (uint64_t)id[100] | ((uint64_t)id[101] << 16) |
+					  ((uint64_t)id[102] << 32) | ((uint64_t)id[103] << 48);
+	else
+		d->id_nsect = (uint64_t)id[60] | ((uint64_t)id[61] << 16);
+
+	// word 47 低字节：READ/WRITE MULTIPLE 每块最多的扇区数
+	multi = MIN(id[47] & 0xFF, IDE_MULTI_MAX);
+	if (multi > 1)
+	{
+		outb(IDE_NSECT, multi);
+		outb(IDE_CMD, ATA_SET_MULTI);
+		ide_delay();
+		st = ide_wait(IDE_PROBE_SPIN);
+		if (st >= 0 && !(st & (IDE_ERR | IDE_DF)))
+			d->id_multi = multi;
+	}
+}
+
+/**
+ * 探测主 IDE 通道上的设备，然后打开设备中断并在 8259A 上允许 IRQ14(经由从片，IRQ2 须同时允许)
+ */
+void ide_init(void)
+{
+	int dev, i;
+
+	for (i = 0; i < NIDEREQ; i++)
+	{
+		ide_reqs[i].ir_next = ide_req_free_list;
+		ide_req_free_list = &ide_reqs[i];
+	}
+
+	outb(IDE_CTRL, IDE_CTRL_NIEN);
+	for (dev = 0; dev < IDE_NDEV; dev++)
+	{
+		ide_probe(dev);
+		if (ide_disks[dev].id_present)
+			cprintf("IDE: hd%c %lu sectors, %s, %d sectors per interrupt\n",
+					'a' + dev, ide_disks[dev].id_nsect,
+					ide_disks[dev].id_lba48 ? "LBA48" : "LBA28",
+					ide_disks[dev].id_multi ? ide_disks[dev].id_multi : 1);
+	}
+	// 清除设备上可能挂起的中断后再允许中断
+	inb(IDE_CMD);
+	outb(IDE_CTRL, 0);
+	irq_setmask_8259A(irq_mask_8259A & ~(1 << IRQ_IDE) & ~(1 << IRQ_SLAVE));
+}
+
+// 返回设备 dev 的容量(扇区数)，设备不存在时返回 0
+uint64_t
+ide_nsect(int dev)
+{
+	if (dev < 0 || dev >= IDE_NDEV || !ide_disks[dev].id_present)
+		return 0;
+	return ide_disks[dev].id_nsect;
+}
+
+// 是否还有未完成的请求(此时即使没有可运行环境也不能进入内核监视器)
+int ide_busy(void)
+{
+	return ide_active != NULL || ide_queue != NULL;
+}
+
+// 当前请求下一次 DRQ 传输的扇区数
+static inline uint32_t
+ide_block(struct IdeReq *r)
+{
+	int multi = ide_disks[r->ir_dev].id_multi;
+
+	return multi ? MIN((uint32_t)multi, r->ir_nsect) : 1;
+}
+
+// 发出请求 r 的命令；写请求还要在设备请求数据(DRQ)后写入第一个数据块
+static void
+ide_start(struct IdeReq *r)
+{
+	struct IdeDisk *d = &ide_disks[r->ir_dev];
+	uint64_t lba = r->ir_lba;
+	uint32_t n = r->ir_nsect;
+	uint8_t cmd;
+
+	ide_active = r;
+	ide_wait(IDE_PROBE_SPIN);
+	if (d->id_lba48)
+	{
+		outb(IDE_DRIVE, 0xE0 | (r->ir_dev << 4));
+		// 先写高字节，再写低字节
+		outb(IDE_NSECT, n >> 8);
+		outb(IDE_LBA0, lba >> 24);
+		outb(IDE_LBA1, lba >> 32);
+		outb(IDE_LBA2, lba >> 40);
+		if (r->ir_write)
+			cmd = d->id_multi ? ATA_WRITE_MULTI_EXT : ATA_WRITE_EXT;
+		else
+			cmd = d->id_multi ? ATA_READ_MULTI_EXT : ATA_READ_EXT;
+	}
+	else
+	{
+		outb(IDE_DRIVE, 0xE0 | (r->ir_dev << 4) | ((lba >> 24) & 0x0F));
+		if (r->ir_write)
+			cmd = d->id_multi ? ATA_WRITE_MULTI : ATA_WRITE;
+		else
+			cmd = d->id_multi ? ATA_READ_MULTI : ATA_READ;
+	}
+	// n == IDE_MAXSECTS 时写入的低字节为 0，LBA28 中即表示 256 个扇区
+	outb(IDE_NSECT, n);
+	outb(IDE_LBA0, lba);
+	outb(IDE_LBA1, lba >> 8);
+	outb(IDE_LBA2, lba >> 16);
+	outb(IDE_CMD, cmd);
+
+	if (r->ir_write)
+	{
+		int st;
+
+		ide_delay();
+		while (((st = inb(IDE_CTRL)) & IDE_BSY) || !(st & (IDE_DRQ | IDE_ERR | IDE_DF)))
+			/* do nothing */;
+		if (st & (IDE_ERR | IDE_DF))
+			return; // 由随后的中断(或轮询)报告错误
+		n = ide_block(r);
+		outsl(IDE_DATA, r->ir_buf, n * SECTSIZE / 4);
+		r->ir_buf += n * SECTSIZE;
+		r->ir_lba += n;
+		r->ir_nsect -= n;
+	}
+}
+
+// 按 C-LOOK 顺序从等待队列中取出下一个请求并发出
+static void
+ide_start_next(void)
+{
+	struct IdeReq **pr, **pick = &ide_queue;
+
+	if (ide_active || !ide_queue)
+		return;
+	for (pr = &ide_queue; *pr; pr = &(*pr)->ir_next)
+		if (ide_key((*pr)->ir_dev, (*pr)->ir_lba) >= ide_head)
+		{
+			pick = pr;
+			break;
+		}
+	struct IdeReq *r = *pick;
+	*pick = r->ir_next;
+	r->ir_next = NULL;
+	ide_start(r);
+}
+
+/**
+ * 将请求 r 插入按 (设备, LBA) 排序的等待队列，磁盘空闲时立即发出
+ * 调用者需要设置 ir_dev/ir_write/ir_lba/ir_nsect/ir_buf 和 ir_done_fn(可为 NULL)
+ */
+void ide_submit(struct IdeReq *r)
+{
+	struct IdeReq **pr;
+	uint64_t key = ide_key(r->ir_dev, r->ir_lba);
+
+	assert(r->ir_nsect > 0 && r->ir_nsect <= IDE_MAXSECTS);
+	assert(ide_disks[r->ir_dev].id_present);
+	r->ir_count = r->ir_nsect;
+	r->ir_done = 0;
+	r->ir_error = 0;
+	for (pr = &ide_queue; *pr && ide_key((*pr)->ir_dev, (*pr)->ir_lba) <= key; pr = &(*pr)->ir_next)
+		/* do nothing */;
+	r->ir_next = *pr;
+	*pr = r;
+	ide_start_next();
+}
+
+// 结束当前请求，发出下一个请求，然后通知请求的发起者
+static void
+ide_complete(struct IdeReq *r, int error)
+{
+	ide_active = NULL;
+	ide_head = ide_key(r->ir_dev, r->ir_lba);
+	r->ir_error = error;
+	r->ir_done = 1;
+	ide_start_next();
+	if (r->ir_done_fn)
+		r->ir_done_fn(r);
+}
+
+/**
+ * IDE 服务例程：根据设备状态推进当前请求
+ * 读取状态寄存器同时应答了设备的中断；设备仍忙或(读请求)数据尚未就绪时直接返回
+ */
+static void
+ide_service(void)
+{
+	struct IdeReq *r = ide_active;
+	uint32_t n;
+	int st;
+
+	st = inb(IDE_CMD);
+	if (!r || (st & IDE_BSY))
+		return;
+	if (st & (IDE_ERR | IDE_DF))
+	{
+		cprintf("IDE: hd%c %s error at sector %lu (status 0x%x, error 0x%x)\n",
+				'a' + r->ir_dev, r->ir_write ? "write" : "read", r->ir_lba, st, inb(IDE_ERROR));
+		ide_complete(r, -E_IO);
+		return;
+	}
+	if (r->ir_write && r->ir_nsect == 0)
+	{
+		// 最后一个数据块已写入磁盘
+		ide_complete(r, 0);
+		return;
+	}
+	if (!(st & IDE_DRQ))
+		return;
+
+	n = ide_block(r);
+	if (r->ir_write)
+		outsl(IDE_DATA, r->ir_buf, n * SECTSIZE / 4);
+	else
+		insl(IDE_DATA, r->ir_buf, n * SECTSIZE / 4);
+	r->ir_buf += n * SECTSIZE;
+	r->ir_lba += n;
+	r->ir_nsect -= n;
+	// 读出最后一个数据块后设备不会再产生中断
+	if (!r->ir_write && r->ir_nsect == 0)
+		ide_complete(r, 0);
+}
+
+/**
+ * IRQ14 的中断处理函数，由 trap_dispatch() 调用
+ * 从片 8259A 不使用自动 EOI，需要显式发送 EOI
+ */
+void ide_intr(void)
+{
+	ide_service();
+	irq_eoi_8259A(IRQ_IDE);
+}
+
+// 轮询服务例程直到请求 r 完成，供无法阻塞的内核代码等待已提交的请求
+void ide_wait_req(struct IdeReq *r)
+{
+	while (!r->ir_done)
+		ide_service();
+}
+
+/**
+ * 同步读写：从扇区 secno 开始传输 nsecs 个扇区，成功返回 0，出错返回 -E_IO
+ * 供无法阻塞的内核代码使用，按 IDE_MAXSECTS 拆分为多个请求，在请求完成前轮询服务例程
+ * (轮询期间可能顺带推进排在前面的其他请求)
+ */
+int ide_rw(int dev, uint64_t secno, void *buf, size_t nsecs, int write)
+{
+	struct IdeReq r;
+	uint32_t n;
+
+	if (secno + nsecs > ide_nsect(dev))
+		return -E_INVAL;
+	while (nsecs > 0)
+	{
+		n = MIN(nsecs, IDE_MAXSECTS);
+		memset(&r, 0, sizeof(r));
+		r.ir_dev = dev;
+		r.ir_write = write;
+		r.ir_lba = secno;
+		r.ir_nsect = n;
+		r.ir_buf = buf;
+		ide_submit(&r);
+		ide_wait_req(&r);
+		if (r.ir_error)
+			return r.ir_error;
+		secno += n;
+		buf += n * SECTSIZE;
+		nsecs -= n;
+	}
+	return 0;
+}
+
+int ide_read(int dev, uint64_t secno, void *dst, size_t nsecs)
+{
+	return ide_rw(dev, secno, dst, nsecs, 0);
+}
+
+int ide_write(int dev, uint64_t secno, const void *src, size_t nsecs)
+{
+	return ide_rw(dev, secno, (void *)src, nsecs, 1);
+}
+
+// 唤醒仍在等待磁盘请求的环境 envid，并以 error 作为其系统调用的返回值
+void ide_env_wake(envid_t envid, int error)
+{
+	struct Env *e;
+
+	if (envid2env(envid, &e, 0) == 0 && e->env_status == ENV_NOT_RUNNABLE)
+	{
+		e->env_tf.tf_regs.reg_rax = error;
+		e->env_status = ENV_RUNNABLE;
+	}
+}
+
+// 环境的请求完成：唤醒等待的环境，然后释放固定的物理页
+static void
+ide_env_done(struct IdeReq *r)
+{
+	ide_env_wake(r->ir_envid, r->ir_error);
+	page_decref((struct PageInfo *)r->ir_arg);
+	r->ir_next = ide_req_free_list;
+	ide_req_free_list = r;
+}
+
+/**
+ * 为环境 waiter 发起对物理页 pp 的异步读写(nsecs 个扇区，不超过一页)
+ * 物理页在传输期间被额外引用，环境在此期间退出也不会被重新分配
+ * 请求完成时唤醒 waiter；调用者负责将 waiter 置为 ENV_NOT_RUNNABLE 并让出 CPU
+ */
+int ide_env_io(int dev, uint64_t secno, struct PageInfo *pp, size_t nsecs, int write, envid_t waiter)
+{
+	struct IdeReq *r;
+
+	if (nsecs == 0 || nsecs > PGSIZE / SECTSIZE || secno + nsecs > ide_nsect(dev))
+		return -E_INVAL;
+	if (!(r = ide_req_free_list))
+		return -E_NO_MEM;
+	ide_req_free_list = r->ir_next;
+
+	memset(r, 0, sizeof(*r));
+	r->ir_dev = dev;
+	r->ir_write = write;
+	r->ir_lba = secno;
+	r->ir_nsect = nsecs;
+	r->ir_buf = page2kva(pp);
+	r->ir_done_fn = ide_env_done;
+	r->ir_arg = pp;
+	r->ir_envid = waiter;
+	pp->pp_ref++;
+	ide_submit(r);
+	return 0;
+}
@@ -0,0 +1,51 @@
+#ifndef ALVOS_KERN_IDE_H
+#define ALVOS_KERN_IDE_H
+#ifndef ALVOS_KERNEL
+# error "This is a AlvOS kernel header; user programs should not #include it"
+#endif
+
+#include "inc/types.h"
+#include "inc/env.h"
+struct PageInfo;
+
+#define SECTSIZE 512 // 磁盘扇区大小
+#define IDE_NDEV 2	 // 主 IDE 通道上的设备数(master/slave)
+// 单个请求一次最多传输的扇区数(LBA28 扇区数寄存器写 0 即 256)
+#define IDE_MAXSECTS 256
+
+/**
+ * 磁盘请求
+ * 请求按 (设备, 起始 LBA) 排序挂在驱动的等待队列上，由 IDE 中断(或同步等待时的轮询)推进
+ * ir_lba/ir_nsect/ir_buf 随传输进行而前移，完成时置 ir_done 并调用 ir_done_fn(若有)
+ */
+struct IdeReq
+{
+	int ir_dev;			  // 设备号(0 = master, 1 = slave)
+	int ir_write;		  // 1 = 写磁盘，0 = 读磁盘
+	uint64_t ir_lba;	  // 下一个要传输的扇区
+	uint32_t ir_nsect;	  // 剩余要传输的扇区数
+	uint32_t ir_count;	  // 本次命令的扇区总数
+	uint8_t *ir_buf;	  // 下一个扇区对应的内核虚拟地址
+	volatile int ir_done; // 请求已完成
+	int ir_error;		  // 0 或 -E_IO
+	void (*ir_done_fn)(struct IdeReq *r);
+	void *ir_arg;		  // 供 ir_done_fn 使用
+	envid_t ir_envid;	  // 等待该请求的环境(环境发起的请求)
+	struct IdeReq *ir_next;
+};
+
+void ide_init(void);
+void ide_intr(void);
+int ide_busy(void);
+uint64_t ide_nsect(int dev);
+
+void ide_submit(struct IdeReq *r);
+void ide_wait_req(struct IdeReq *r);
+int ide_rw(int dev, uint64_t secno, void *buf, size_t nsecs, int write);
+int ide_read(int dev, uint64_t secno, void *dst, size_t nsecs);
+int ide_write(int dev, uint64_t secno, const void *src, size_t nsecs);
+
+int ide_env_io(int dev, uint64_t secno, struct PageInfo *pp, size_t nsecs, int write, envid_t waiter);
+void ide_env_wake(envid_t envid, int error);
+
+#endif
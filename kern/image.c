@@ -0,0 +1,254 @@
+/**
+ * 程序映像缓存
+ * 以程序文件为键(嵌入内核的程序映像的起始地址，或文件在磁盘上的位置)，记录该 ELF 文件各页已读入的物理页
+ * 文件页的内容只由文件决定，因此运行同一程序的所有环境(create_proc()、spawn() 和 fork 出的子环境)
+ * 都从这里取页: 只读程序段(.text/.rodata)直接映射缓存的物理页，每个环境只增加一次 pp_ref；
+ * 可写程序段(.data)和不足一页的部分从缓存页复制到环境私有的物理页
+ * 缓存自身对每个已读入的页持有一次引用，映像的槽位被重用时才释放
+ *
+ * 来自磁盘的映像按需经由内核块缓存(kern/bio.c)同步读入文件页
+ * 文件系统服务器写磁盘之前调用 image_invalidate(): 被改写的块属于某个仍在使用的映像时，先读入该映像的
+ * 其余所有页再标记为过期，正在运行的程序不会看到新旧混合的代码；新的 spawn() 为改写后的文件建立新的映像
+ */
+#include "inc/types.h"
+#include "inc/elf.h"
+#include "inc/error.h"
+#include "inc/string.h"
+#include "inc/assert.h"
+
+#include "kern/image.h"
+#include "kern/kmem.h"
+#include "kern/pmap.h"
+#include "kern/bio.h"
+#include "kern/kdebug.h"
+
+static struct Image images[NIMAGE];
+
+// 由 ELF 头部计算嵌入的映像的大小: 程序段和节头表中结束位置最大的一个
+static size_t
+image_elf_size(const uint8_t *binary)
+{
+	const struct Elf *elf = (const struct Elf *)binary;
+	const struct Proghdr *ph = (const struct Proghdr *)(binary + elf->e_phoff);
+	size_t size = elf->e_shoff + (size_t)elf->e_shnum * elf->e_shentsize;
+	int i;
+
+	size = MAX(size, elf->e_phoff + (size_t)elf->e_phnum * sizeof(struct Proghdr));
+	for (i = 0; i < elf->e_phnum; i++)
+		size = MAX(size, ph[i].p_offset + ph[i].p_filesz);
+	return size;
+}
+
+// 释放映像 im 缓存的物理页和调试信息副本，槽位变为空闲
+static void
+image_free(struct Image *im)
+{
+	size_t i;
+
+	assert(im->im_ref == 0);
+	for (i = 0; i < im->im_npages; i++)
+		if (im->im_pages[i])
+			page_decref(im->im_pages[i]);
+	if (im->im_elf)
+	{
+		debuginfo_forget(im->im_elf);
+		kfree(im->im_elf);
+	}
+	kfree(im->im_pages);
+	kfree(im->im_secnos);
+	memset(im, 0, sizeof(struct Image));
+}
+
+/**
+ * 为大小为 size 的文件分配一个映像，引用为1
+ * 优先使用空闲槽位，否则重用一个没有环境引用的映像的槽位
+ * 槽位都在使用中或内存不足时返回 NULL
+ */
+static struct Image *
+image_alloc(size_t size)
+{
+	struct Image *im, *slot = NULL;
+
+	for (im = images; im < images + NIMAGE; im++)
+		if (im->im_ref == 0 && (!slot || !im->im_pages))
+			slot = im;
+	if (!slot)
+		return NULL;
+	if (slot->im_pages)
+		image_free(slot);
+
+	slot->im_size = size;
+	slot->im_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+	if (!(slot->im_pages = kmalloc(slot->im_npages * sizeof(struct PageInfo *))))
+		return NULL;
+	memset(slot->im_pages, 0, slot->im_npages * sizeof(struct PageInfo *));
+	slot->im_ref = 1;
+	return slot;
+}
+
+/**
+ * 返回嵌入内核的 ELF 映像 binary 对应的程序映像，并增加其引用
+ * 不在缓存中时新建，槽位都在使用中或内存不足时返回 NULL
+ */
+struct Image *
+image_mem(const uint8_t *binary)
+{
+	struct Image *im;
+
+	for (im = images; im < images + NIMAGE; im++)
+		if (im->im_pages && im->im_binary == binary)
+		{
+			im->im_ref++;
+			return im;
+		}
+	if ((im = image_alloc(image_elf_size(binary))))
+		im->im_binary = binary;
+	return im;
+}
+
+/**
+ * 返回设备 dev 上大小为 size 的文件对应的程序映像，并增加其引用
+ * secnos[i] 是第 i 个文件页(PGSIZE 字节)在磁盘上的起始扇区
+ * 不在缓存中(或缓存的映像已过期)时新建，槽位都在使用中或内存不足时返回 NULL
+ */
+struct Image *
+image_disk(int dev, const uint64_t *secnos, size_t size)
+{
+	struct Image *im;
+	size_t n = ROUNDUP(size, PGSIZE) / PGSIZE * sizeof(uint64_t);
+
+	for (im = images; im < images + NIMAGE; im++)
+		if (im->im_pages && im->im_secnos && !im->im_stale && im->im_dev == dev &&
+			im->im_size == size && memcmp(im->im_secnos, secnos, n) == 0)
+		{
+			im->im_ref++;
+			return im;
+		}
+	if (!(im = image_alloc(size)))
+		return NULL;
+	if (!(im->im_secnos = kmalloc(n)))
+	{
+		im->im_ref = 0;
+		image_free(im);
+		return NULL;
+	}
+	memmove(im->im_secnos, secnos, n);
+	im->im_dev = dev;
+	return im;
+}
+
+// 增加映像 im 的引用(子环境继承父环境的程序时)
+void image_hold(struct Image *im)
+{
+	im->im_ref++;
+}
+
+// 减少映像 im 的引用，缓存的页留到槽位被重用时才释放；过期的映像没有引用时立即释放
+void image_release(struct Image *im)
+{
+	assert(im->im_ref > 0);
+	if (--im->im_ref == 0 && im->im_stale)
+		image_free(im);
+}
+
+/**
+ * 设备 dev 上从扇区 secno 开始的 nsecs 个扇区即将被改写(sys_disk_io 写磁盘之前调用)
+ * 这些扇区属于某个磁盘映像时: 没有环境引用的映像直接释放；否则读入其余所有页并标记为过期
+ */
+void image_invalidate(int dev, uint64_t secno, size_t nsecs)
+{
+	struct Image *im;
+	size_t i;
+
+	for (im = images; im < images + NIMAGE; im++)
+	{
+		if (!im->im_pages || !im->im_secnos || im->im_stale || im->im_dev != dev)
+			continue;
+		for (i = 0; i < im->im_npages; i++)
+			if (im->im_secnos[i] < secno + nsecs && secno < im->im_secnos[i] + PGSIZE / SECTSIZE)
+				break;
+		if (i == im->im_npages)
+			continue;
+		if (im->im_ref == 0)
+		{
+			image_free(im);
+			continue;
+		}
+		for (i = 0; i < im->im_npages; i++)
+			image_page(im, i);
+		im->im_stale = 1;
+	}
+}
+
+/**
+ * 返回映像 im 的第 pgno 个文件页的物理页，尚未读入时分配物理页并读入(文件末尾之后的部分为零)
+ * 调用者映射该页时自行增加 pp_ref
+ * pgno 超出文件、内存不足、读磁盘出错，或映像已过期而该页未读入时返回 NULL
+ */
+struct PageInfo *
+image_page(struct Image *im, size_t pgno)
+{
+	struct PageInfo *pp;
+	size_t off = pgno * PGSIZE, n;
+
+	if (pgno >= im->im_npages)
+		return NULL;
+	if ((pp = im->im_pages[pgno]))
+		return pp;
+	// 磁盘上的文件已被改写，未读入的页无法再得到原来的内容
+	if (im->im_stale || !(pp = page_alloc(ALLOC_ZERO)))
+		return NULL;
+	n = MIN((size_t)PGSIZE, im->im_size - off);
+	if (im->im_binary)
+		memmove(page2kva(pp), im->im_binary + off, n);
+	else if (bio_read(im->im_dev, im->im_secnos[pgno], page2kva(pp), ROUNDUP(n, SECTSIZE) / SECTSIZE) < 0)
+	{
+		page_free(pp);
+		return NULL;
+	}
+	pp->pp_ref++;
+	im->im_pages[pgno] = pp;
+	return pp;
+}
+
+/**
+ * 从映像 im 的文件偏移 off 处复制 len 字节到 dst(内核地址)，所需的文件页按需读入缓存
+ * 成功返回0，超出文件返回 -E_INVAL，无法读入文件页返回 -E_NO_MEM
+ */
+int image_read(struct Image *im, size_t off, void *dst, size_t len)
+{
+	struct PageInfo *pp;
+	size_t n;
+
+	if (off + len > im->im_size)
+		return -E_INVAL;
+	while (len > 0)
+	{
+		if (!(pp = image_page(im, off / PGSIZE)))
+			return -E_NO_MEM;
+		n = MIN(len, PGSIZE - PGOFF(off));
+		memmove(dst, (uint8_t *)page2kva(pp) + PGOFF(off), n);
+		off += n;
+		dst += n;
+		len -= n;
+	}
+	return 0;
+}
+
+/**
+ * 返回映像 im 在内核中连续的 ELF 文件内容，供解析调试信息使用
+ * 来自磁盘的映像第一次调用时把整个文件读入一个副本，无法读入时返回 NULL
+ */
+const void *
+image_elf(struct Image *im)
+{
+	if (im->im_binary)
+		return im->im_binary;
+	if (!im->im_elf && (im->im_elf = kmalloc(im->im_size)) &&
+		image_read(im, 0, im->im_elf, im->im_size) < 0)
+	{
+		kfree(im->im_elf);
+		im->im_elf = NULL;
+	}
+	return im->im_elf;
+}
@@ -0,0 +1,41 @@
+#ifndef ALVOS_KERN_IMAGE_H
+#define ALVOS_KERN_IMAGE_H
+#ifndef ALVOS_KERNEL
+# error "This is a AlvOS kernel header; user programs should not #include it"
+#endif
+
+#include "inc/types.h"
+
+struct PageInfo;
+
+// 同时缓存的程序映像数
+#define NIMAGE 16
+
+/**
+ * 程序映像: 一个 ELF 文件的内容，以及按需读入的各文件页的物理页
+ * 文件来自内核中嵌入的程序(im_binary)，或文件系统所在磁盘上的一组页(im_secnos，由文件系统服务器提供)
+ * 由同一映像创建的所有环境的只读程序页映射同一个物理页(pp_ref 共享)，可写的页从中复制
+ */
+struct Image
+{
+	int im_ref;					// 引用该映像的环境数，为0时映像仍留在缓存中，直到槽位被重用
+	int im_stale;				// 磁盘上的文件已被改写，映像不再用于新的环境，最后一个引用释放时释放
+	const uint8_t *im_binary;	// 嵌入内核的 ELF 映像，NULL 表示来自磁盘
+	int im_dev;					// 来自磁盘: 所在设备
+	uint64_t *im_secnos;		// 来自磁盘: 各文件页在磁盘上的起始扇区
+	size_t im_size;				// 文件大小
+	size_t im_npages;			// 文件页数
+	struct PageInfo **im_pages; // 已读入的文件页，im_pages[i] 为 NULL 表示尚未读入；整个数组为 NULL 表示槽位空闲
+	uint8_t *im_elf;			// 来自磁盘: 文件在内核中的连续副本，第一次解析调试信息时读入
+};
+
+struct Image *image_mem(const uint8_t *binary);
+struct Image *image_disk(int dev, const uint64_t *secnos, size_t size);
+void image_hold(struct Image *im);
+void image_release(struct Image *im);
+void image_invalidate(int dev, uint64_t secno, size_t nsecs);
+struct PageInfo *image_page(struct Image *im, size_t pgno);
+int image_read(struct Image *im, size_t off, void *dst, size_t len);
+const void *image_elf(struct Image *im);
+
+#endif
@@ -16,6 +16,12 @@
 #include "kern/picirq.h"
 #include "kern/cpu.h"
 #include "kern/spinlock.h"
+#include "kern/vma.h"
+#include "kern/kmem.h"
+#include "kern/fpu.h"
+#include "kern/pmu.h"
+#include "kern/ide.h"
+#include "kern/bio.h"
 
 /**
  * 从 kern/entry.S 进入到内核初始化代码(进入内核后所有引用地址都是虚拟地址，而链接地址=虚拟地址)
@@ -32,11 +38,17 @@ void i386_init(void)
 	// GCC特性：这两个变量都是在链接（生成ELF文件时）产生的地址，GCC会在生成二进制文件的时候将这两个符号置换成地址
 	// edata: .bss节在内存中开始的位置，end: 内核可执行程序在内核中结束的位置，.bss是文件在内存中的个最后一部分
 	extern char edata[], end[];
+	// 进入 i386_init() 时的 TSC，与引导加载器在 BOOT_TSC_PADDR 记录的 TSC 相减得到引导耗时
+	uint64_t tsc_init = read_tsc();
+	uint64_t tsc_boot = *(uint64_t *)(KERNBASE + BOOT_TSC_PADDR);
 
 	// 在执行任何其他操作之前，必须先完成 ELF 加载过程.
 	// 为了确保所有静态/全局变量初始值为 0，清除程序中未初始化的全局数据(BSS)部分.
 	memset(edata, 0, end - edata);
 
+	// 通过 CPUID 选择 memset/memmove/memcpy 的实现(需在清除 BSS 之后，其结果保存在 BSS 中)
+	mem_init();
+
 	// 初始化控制台(包括显存的初始化、键盘的初始化).
 	cons_init();
 	p_init();
@@ -48,9 +60,15 @@ void i386_init(void)
 	// 因此 end 是 linker 没有 分配任何内核代码或全局变量的第一个虚拟地址/线性地址(.bss 段是已加载内核代码的最后一个段)
 	extern char end[];
 
+	// 探测 IDE 磁盘，之后内核经由块缓存读取磁盘上的 DWARF 调试段
+	ide_init();
+	bio_init();
+
 	// KELFHDR=(0x10000+KERNBASE): 内存中内核的ELF文件地址，因为开启了分页，需要加上内核映射基址
 	// end_debug 就是 (内核 + 内核 DWARF 调试段信息) 后的首地址
 	end_debug = read_section_headers(KELFHDR, (uintptr_t)end);
+	cprintf("Boot: %lu TSC cycles from boot loader to i386_init, %lu more to load DWARF sections\n",
+			tsc_init - tsc_boot, read_tsc() - tsc_init);
 
 	/**
 	 * BSP 调用mem_init()，主要创建页目录、pages数组、procs数组、映射pages数组/procs数组/BSP内核栈等到4级页表中
@@ -78,6 +96,14 @@ void i386_init(void)
 	 */
 	x64_vm_init();
 
+	// 分配按需调页使用的全局只读零页
+	vma_init();
+
+	// 创建 kmalloc 各个大小类的对象缓存
+	kmalloc_init();
+	// 记录物理页被哪些地址空间映射
+	page_rmap_init();
+
 	/**
 	 * BSP 调用 env_init()，初始化env_free_list；同时调用 env_init_percpu() 加载当前cpu的 GDT 和 gs/fs/es/ds/ss 段描述符
 	 * env_init()			// 初始化用户环境(procs[NENV], env_free_list逆序地包含所有的env)
@@ -93,6 +119,11 @@ void i386_init(void)
 	 */
 	trap_init();
 
+	// 允许用户环境使用 x87/SSE/AVX，环境的 FPU 状态在首次使用时惰性装载
+	fpu_init_percpu();
+	// 检测性能计数器，允许用户态 rdpmc
+	pmu_init_percpu();
+
 	/**
 	 * lapic_init() + mp_init() -> x86 多CPU初始化
 	 * mp_init() 函数通过调用 mpconfig() 从BIOS中读取浮动指针mp，从mp中找到struct mpconf多处理器配置表，
@@ -136,7 +167,7 @@ void i386_init(void)
 	 * obj/kern/kernel.sym 中链接器生成了一些符号(eg:_binary_obj_user_hello_start)
 	 * 这种符号为普通内核代码使用一种引入嵌入式二进制文件的方法
 	 * 
-	 * 这个宏相当于调用create_proc(_binary_obj_user_..._start, PROC_TYPE_USER)
+	 * 这个宏相当于调用create_proc(_binary_obj_user_..._start, type)
 	 * 从而指定了在之后的 env_run 中要执行的环境，user/...的 umain 环境
 	 * 
 	 * 创建用户环境的过程
@@ -147,11 +178,14 @@ void i386_init(void)
 	 *   - load_icode()		// 根据程序文件头部加载数据段、代码段等
 	 *     - region_alloc()	// 为用户环境映射一页内存作为栈空间（USTACKTOP - PGSIZE）
 	 */
-	CREATE_PROC(user_testbss);
-	// CREATE_PROC(user_loadDS);
-	// CREATE_PROC(user_stresssched);
-	// CREATE_PROC(user_sendpage);
-	// CREATE_PROC(user_primes);
+	// 文件系统服务器
+	CREATE_PROC(fs_fs, PROC_TYPE_FS);
+
+	// 其他用户程序由 init 从文件系统装入(user/init.c)
+	CREATE_PROC(user_init, PROC_TYPE_USER);
+
+	// 内核跟踪只对特权环境开放，tracedump 由内核直接创建
+	// CREATE_PROC(user_tracedump, PROC_TYPE_PRIV);
 
 	kbd_intr();
 	// 在函数env_run调用env_pop_tf之后，处理器开始执行trapentry.S下的代码
@@ -247,6 +281,8 @@ void mp_main(void)
 
 	// 始化当前 CPU 的 TSS 和 IDT，然后使用自旋锁设置启动完成标识
 	trap_init_percpu();
+	fpu_init_percpu();
+	pmu_init_percpu();
 	// 传递参数到 boot_aps(): 当前 CPU 已经启动
 	xchg(&thiscpu->cpu_status, CPU_STARTED);
 
@@ -282,6 +318,8 @@ void _panic(const char *file, int line, const char *fmt, ...)
 	vcprintf(fmt, ap);
 	cprintf("\n");
 	va_end(ap);
+	// 关中断后串口发送器空中断不会再到来，轮询发送完缓冲的输出
+	cons_flush();
 
 dead:
 	while (1)
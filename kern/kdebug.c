@@ -2,6 +2,7 @@
 #include "inc/string.h"
 #include "inc/memlayout.h"
 #include "inc/assert.h"
+#include "inc/error.h"
 
 #include "kern/kdebug.h"
 #include "kern/dwarf.h"
@@ -12,6 +13,9 @@
 
 #include "kern/pmap.h"
 #include "kern/env.h"
+#include "kern/cpu.h"
+#include "kern/addrindex.h"
+#include "kern/image.h"
 
 extern int _dwarf_init(Dwarf_Debug dbg, void *obj);
 extern int _get_next_cu(Dwarf_Debug dbg, Dwarf_CU *cu);
@@ -99,7 +103,7 @@ int list_func_die(struct Ripdebuginfo *info, Dwarf_Die *die, uint64_t addr)
 	low = _dwarf_attr_find(die, DW_AT_low_pc);
 	high = _dwarf_attr_find(die, DW_AT_high_pc);
 
-	if ((low && (low->u[0].u64 < addr)) && (high && (high->u[0].u64 > addr)))
+	if ((low && (low->u[0].u64 <= addr)) && (high && (high->u[0].u64 > addr)))
 	{
 		info->rip_file = die->cu_die->die_name;
 
@@ -175,19 +179,139 @@ int list_func_die(struct Ripdebuginfo *info, Dwarf_Die *die, uint64_t addr)
 	return 0;
 }
 
+/**************************** 函数地址索引 ****************************/
+
+/**
+ * 函数地址索引(见 kern/addrindex.c): 每个 ELF 映像以 .debug_info 中各 CU 的顶层函数 DIE
+ * 建立 [low_pc, high_pc) -> (函数 DIE 偏移, 所在 CU)，只需解析命中的函数 DIE，不再遍历整个 .debug_info
+ * 附属项是 CU 头，命中后从中定位函数 DIE
+ */
+
+// 同时索引的 ELF 映像数
+#define FUNCIDX_NIMAGES 8
+
+static struct AddrIndex func_indexes[FUNCIDX_NIMAGES];
+
+/**
+ * 遍历 dbg 中所有 CU 的顶层 DIE，把有地址范围的函数加入 ai
+ * 内存不足返回 -E_NO_MEM
+ */
+static int
+func_index_build(struct AddrIndex *ai)
+{
+	Dwarf_CU cu;
+	Dwarf_Die die, cudie, die2;
+	Dwarf_Attribute *low, *high;
+	int c;
+
+	while (_get_next_cu(dbg, &cu) == 0)
+	{
+		if (dwarf_siblingof(dbg, NULL, &cudie, &cu) == DW_DLE_NO_ENTRY)
+			continue;
+		if (dwarf_child(dbg, &cu, &cudie, &die) == DW_DLE_NO_ENTRY)
+			continue;
+		if ((c = addr_index_add_aux(ai, &cu)) < 0)
+			return c;
+		while (1)
+		{
+			low = _dwarf_attr_find(&die, DW_AT_low_pc);
+			high = _dwarf_attr_find(&die, DW_AT_high_pc);
+			if (die.die_tag == DW_TAG_subprogram && low && high && low->u[0].u64 < high->u[0].u64 &&
+				addr_index_add(ai, low->u[0].u64, high->u[0].u64, die.die_offset, c) < 0)
+				return -E_NO_MEM;
+			if (dwarf_siblingof(dbg, &die, &die2, &cu) < 0)
+				break;
+			die = die2;
+		}
+	}
+	addr_index_sort(ai);
+	return 0;
+}
+
+/**
+ * 返回 ELF 映像 elf 的函数地址索引，第一次调用时建立(dbg 须已按 elf 初始化)
+ * 无法建立索引时返回 NULL
+ */
+static struct AddrIndex *
+func_index_get(const void *elf)
+{
+	struct AddrIndex *ai;
+	int fresh;
+
+	ai = addr_index_get(func_indexes, FUNCIDX_NIMAGES, elf, sizeof(Dwarf_CU), &fresh);
+	if (fresh && func_index_build(ai) < 0)
+		addr_index_fail(ai);
+	return ai->ai_nranges >= 0 ? ai : NULL;
+}
+
+/**
+ * 在索引 ai 中查找包含 addr 的函数，找到后由 list_func_die() 填写 *info
+ * 找到返回0，否则返回 -1
+ */
+static int
+func_index_lookup(struct AddrIndex *ai, struct Ripdebuginfo *info, uint64_t addr)
+{
+	struct AddrRange *ar;
+	Dwarf_CU cu;
+	Dwarf_Die die, cudie;
+
+	if (!(ar = addr_index_lookup(ai, addr)))
+		return -1;
+
+	cu = ((Dwarf_CU *)ai->ai_aux)[ar->ar_aux];
+	if (dwarf_siblingof(dbg, NULL, &cudie, &cu) == DW_DLE_NO_ENTRY)
+		return -1;
+	cudie.cu_header = &cu;
+	cudie.cu_die = NULL;
+	if (dwarf_offdie(dbg, ar->ar_off, &die, cu) == DW_DLE_NO_ENTRY)
+		return -1;
+	die.cu_header = &cu;
+	die.cu_die = &cudie;
+	return list_func_die(info, &die, addr) ? 0 : -1;
+}
+
+// 当前 section_info 描述的 ELF 映像，NULL 表示内核自身
+static const void *lastelf = NULL;
+
 /**
- * 在'info'结构中填写关于参数指令地址'addr'的信息
+ * ELF 映像 elf(程序映像在内核中的副本)即将被释放: 丢弃为它建立的函数地址索引、FDE 查找表和行号表，
+ * 当前的调试段是它的时候换回内核的调试段，避免之后分配在同一地址的映像用到旧的信息
+ */
+void debuginfo_forget(const void *elf)
+{
+	addr_index_forget(func_indexes, FUNCIDX_NIMAGES, elf);
+	_dwarf_fde_index_forget(elf);
+	_dwarf_lineno_forget(elf);
+	if (lastelf == elf)
+	{
+		restore_kernel_debug_sections();
+		lastelf = NULL;
+	}
+}
+
+/**
+ * 在'info'结构中填写关于参数指令地址'addr'的信息，用户地址按当前环境的程序解释
  * 如果找到了信息，则返回0，否则返回负数
  * 但是即使它返回负数，但也已经在'*info'中存储了信息
  */
 int debuginfo_rip(uintptr_t addr, struct Ripdebuginfo *info)
 {
-	static struct Env *lastenv = NULL;
-	void *elf;
+	return debuginfo_rip_env(addr, curenv, info);
+}
+
+/**
+ * 同 debuginfo_rip()，但用户地址按环境 e 的程序解释
+ * 用户程序的调试段直接从 e 的程序映像(image_elf(e->env_image))读取，不需要切换到 e 的页表，
+ * 返回的 info->rip_fn_name 等指向该映像
+ */
+int debuginfo_rip_env(uintptr_t addr, struct Env *e, struct Ripdebuginfo *info)
+{
+	const void *elf;
 	Dwarf_Section *sect;
 	Dwarf_CU cu;
 	Dwarf_Die die, cudie, die2;
 	Dwarf_Regtable *rt = NULL;
+	struct AddrIndex *fx;
 	// 设置初试的pc
 	uint64_t pc = (uintptr_t)addr;
 
@@ -202,26 +326,37 @@ int debuginfo_rip(uintptr_t addr, struct Ripdebuginfo *info)
 	// 找到 stabs 的相关集合
 	if (addr >= ULIM)
 	{
+		if (lastelf)
+		{
+			restore_kernel_debug_sections();
+			lastelf = NULL;
+		}
 		elf = (void *)KELFHDR;
 	}
 	else
 	{
-		if (curenv != lastenv)
+		// 没有程序映像的环境无法提供调试信息
+		if (!e || !e->env_image || !(elf = image_elf(e->env_image)))
+			return -1;
+		if (elf != lastelf)
 		{
-			find_debug_sections((uintptr_t)curenv->elf);
-			lastenv = curenv;
+			find_debug_sections((uintptr_t)elf);
+			lastelf = elf;
 		}
-		elf = curenv->elf;
 	}
 	// DWARF 参数初始化，从DWARF信息中读取函数参数的相关信息
 	// _dwarf_init() 再调用 _dwarf_frame_params_init() 初始化调用帧相关参数
-	_dwarf_init(dbg, elf);
+	_dwarf_init(dbg, (void *)elf);
 
 	sect = _dwarf_find_section(".debug_info");
 	dbg->dbg_info_offset_elf = (uint64_t)sect->ds_data;
 	dbg->dbg_info_size = sect->ds_size;
 
 	assert(dbg->dbg_info_size);
+	if ((fx = func_index_get(elf)) != NULL)
+		return func_index_lookup(fx, info, addr);
+
+	// 无法建立索引时线性查找
 	while (_get_next_cu(dbg, &cu) == 0)
 	{
 		if (dwarf_siblingof(dbg, NULL, &cudie, &cu) == DW_DLE_NO_ENTRY)
@@ -254,3 +389,76 @@ int debuginfo_rip(uintptr_t addr, struct Ripdebuginfo *info)
 find_done:
 	return 0;
 }
+
+/****************************** 帧指针回溯 ******************************/
+
+/**
+ * 返回包含 [va, va+len) 的内核栈的栈顶，不在任何内核栈中返回 0
+ * 内核栈: 各 CPU 映射在 KSTACKTOP 之下的栈、percpu_kstacks(AP 启动时使用)和 bootstack
+ */
+static uintptr_t
+kstack_top(uintptr_t va, size_t len)
+{
+	extern char bootstack[], bootstacktop[];
+	uintptr_t top;
+	int i;
+
+	for (i = 0; i < NCPU; i++)
+	{
+		top = KSTACKTOP - i * (KSTKSIZE + KSTKGAP);
+		if (va >= top - KSTKSIZE && va + len <= top)
+			return top;
+		top = (uintptr_t)percpu_kstacks[i] + KSTKSIZE;
+		if (va >= top - KSTKSIZE && va + len <= top)
+			return top;
+	}
+	if (va >= (uintptr_t)bootstack && va + len <= (uintptr_t)bootstacktop)
+		return (uintptr_t)bootstacktop;
+	return 0;
+}
+
+// e 的用户地址 va 是否已映射且用户可读
+static bool
+user_readable(struct Env *e, uintptr_t va)
+{
+	pte_t *pte = pml4e_walk(e->env_pml4e, (void *)va, 0);
+
+	return pte && (*pte & (PTE_P | PTE_U)) == (PTE_P | PTE_U);
+}
+
+/**
+ * 沿帧指针链(内核以 -fno-omit-frame-pointer 编译)回溯调用栈:
+ * 帧 rbp 处依次是调用者的 %rbp 和返回地址
+ * 把返回地址依次存入 pcs，最多 n 个，返回个数
+ * e 为 NULL 时回溯内核栈，否则回溯 e 的用户栈(须在 e 的地址空间中调用)
+ * 每一帧都检查仍在同一个栈内(用户栈检查页表)且地址递增，不会访问未映射的内存也不会死循环，
+ * 代价只是每帧几次访存，可以在中断处理中使用
+ */
+int backtrace_fp(uintptr_t rbp, struct Env *e, uintptr_t *pcs, int n)
+{
+	uintptr_t top = 0, *frame;
+	int i = 0;
+
+	if (!e && !(top = kstack_top(rbp, 2 * sizeof(uintptr_t))))
+		return 0;
+	while (i < n && rbp && rbp % sizeof(uintptr_t) == 0)
+	{
+		if (e)
+		{
+			if (rbp >= UTOP - 2 * sizeof(uintptr_t) || !user_readable(e, rbp) ||
+				!user_readable(e, rbp + sizeof(uintptr_t)))
+				break;
+		}
+		else if (rbp + 2 * sizeof(uintptr_t) > top)
+			break;
+		frame = (uintptr_t *)rbp;
+		if (frame[1] == 0)
+			break;
+		pcs[i++] = frame[1];
+		// 调用者的帧一定在更高的地址
+		if (frame[0] <= rbp)
+			break;
+		rbp = frame[0];
+	}
+	return i;
+}
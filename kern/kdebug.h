@@ -18,6 +18,11 @@ struct Ripdebuginfo {
 	Dwarf_Regtable reg_table;	// DWARF 寄存器表
 };
 
+struct Env;
+
 int debuginfo_rip(uintptr_t rip, struct Ripdebuginfo *info);
+int debuginfo_rip_env(uintptr_t rip, struct Env *e, struct Ripdebuginfo *info);
+int backtrace_fp(uintptr_t rbp, struct Env *e, uintptr_t *pcs, int n);
+void debuginfo_forget(const void *elf);
 
 #endif
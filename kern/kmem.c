@@ -0,0 +1,567 @@
+/**
+ * slab 对象缓存分配器，建立在页分配器之上
+ * 每种对象一个 KmemCache，对象从 slab 中分配：一个 slab 是一个物理页，页首是 struct Slab，
+ * 之后是 km_perslab 个等大的对象，空闲对象以其第一个字链接成单链表
+ * 释放时通过对象地址向下取整到页首找到所属的 slab，因此分配和释放都是 O(1)，不会为小对象浪费整页
+ *
+ * 每个 CPU 有一个空闲对象栈(KmemCpuCache)，分配和释放大多只在其上压栈/出栈；
+ * 栈空时从 slab 批量取出一半，栈满时批量归还一半，最近释放的对象优先再分配(cache 中仍然是热的)
+ * 内核在大内核锁下运行，slab 链表不需要另外加锁；每个 CPU 的栈及其统计计数只由所属的 CPU 访问，快速路径不写共享数据
+ *
+ * kmalloc()/kfree() 建立在对象缓存之上: 不超过 KMALLOC_MAXSIZE 的请求向上取整到2的幂，
+ * 从对应大小类(16 ~ 2048字节)的缓存中分配；更大的请求分配物理地址连续的多个页(页首是 KmallocRun)
+ */
+#include "inc/string.h"
+#include "inc/assert.h"
+#include "inc/stdio.h"
+
+#include "kern/kmem.h"
+#include "kern/pmap.h"
+
+// 可以创建的缓存数
+#define KMEM_NCACHES 32
+
+// slab 的页首，所在物理页的其余部分存放对象
+struct Slab
+{
+	struct KmemCache *sl_cache;
+	struct Slab *sl_next; // 所在链表(km_partial/km_full/km_empty)中的前后 slab
+	struct Slab *sl_prev;
+	void *sl_free; // 空闲对象链表
+	int sl_inuse;  // 已分配的对象数
+};
+
+static struct KmemCache kmem_caches[KMEM_NCACHES];
+static int kmem_ncaches;
+
+// kmalloc 最小和最大的大小类
+#define KMALLOC_MINSHIFT 4
+#define KMALLOC_MAXSHIFT 11
+#define KMALLOC_MAXSIZE (1UL << KMALLOC_MAXSHIFT)
+#define KMALLOC_NCLASSES (KMALLOC_MAXSHIFT - KMALLOC_MINSHIFT + 1)
+// 标识多页分配的页首
+#define KMALLOC_MAGIC 0x6B6D616C6C6F6321UL
+
+// 多页分配的页首，返回给调用者的地址紧随其后(保持16字节对齐)
+struct KmallocRun
+{
+	uint64_t kr_magic;
+	uint64_t kr_npages;
+};
+
+static struct KmemCache *kmalloc_caches[KMALLOC_NCLASSES];
+// 多页分配的统计，多页分配要进入页分配器(大内核锁下)，不在快速路径上
+static uint64_t kmalloc_large_allocs;
+static uint64_t kmalloc_large_frees;
+static uint64_t kmalloc_large_pages; // 当前多页分配占用的物理页数
+
+static void check_kmalloc(void);
+
+static void
+slab_push(struct Slab **list, struct Slab *sl)
+{
+	sl->sl_prev = NULL;
+	sl->sl_next = *list;
+	if (*list)
+		(*list)->sl_prev = sl;
+	*list = sl;
+}
+
+static void
+slab_unlink(struct Slab **list, struct Slab *sl)
+{
+	if (sl->sl_prev)
+		sl->sl_prev->sl_next = sl->sl_next;
+	else
+		*list = sl->sl_next;
+	if (sl->sl_next)
+		sl->sl_next->sl_prev = sl->sl_prev;
+}
+
+/**
+ * 创建名为 name 的对象缓存，对象大小 size 字节，按 align 字节对齐(0 表示按8字节对齐，必须是2的幂)
+ * 一个物理页至少要能放下一个对象
+ * 成功返回缓存，缓存数达到上限或 size 过大时返回 NULL
+ */
+struct KmemCache *
+kmem_cache_create(const char *name, size_t size, size_t align)
+{
+	struct KmemCache *cache;
+
+	if (align < sizeof(void *))
+		align = sizeof(void *);
+	assert((align & (align - 1)) == 0);
+	size = ROUNDUP(MAX(size, sizeof(void *)), align);
+	if (kmem_ncaches == KMEM_NCACHES || ROUNDUP(sizeof(struct Slab), align) + size > PGSIZE)
+		return NULL;
+
+	cache = &kmem_caches[kmem_ncaches++];
+	memset(cache, 0, sizeof(*cache));
+	strncpy(cache->km_name, name, KMEM_NAMELEN - 1);
+	cache->km_size = size;
+	cache->km_offset = ROUNDUP(sizeof(struct Slab), align);
+	cache->km_perslab = (PGSIZE - cache->km_offset) / size;
+	return cache;
+}
+
+/**
+ * 为 cache 分配一个新的 slab，放入 km_partial
+ * 内存不足时返回 NULL
+ */
+static struct Slab *
+slab_grow(struct KmemCache *cache)
+{
+	struct PageInfo *pp;
+	struct Slab *sl;
+	char *obj;
+	int i;
+
+	if (!(pp = page_alloc(0)))
+		return NULL;
+	// slab 页一直被分配器引用，直到归还给页分配器
+	pp->pp_ref++;
+	sl = page2kva(pp);
+	sl->sl_cache = cache;
+	sl->sl_inuse = 0;
+	sl->sl_free = NULL;
+	// 按地址递减的顺序压入，第一次分配得到页中最前面的对象
+	obj = (char *)sl + cache->km_offset + (cache->km_perslab - 1) * cache->km_size;
+	for (i = 0; i < cache->km_perslab; i++, obj -= cache->km_size)
+	{
+		*(void **)obj = sl->sl_free;
+		sl->sl_free = obj;
+	}
+	slab_push(&cache->km_partial, sl);
+	cache->km_nslabs++;
+	return sl;
+}
+
+/**
+ * 从 cache 的 slab 中分配一个对象: 优先使用部分分配的 slab，其次是空 slab，最后分配新的 slab
+ * 内存不足时返回 NULL
+ */
+static void *
+slab_alloc(struct KmemCache *cache)
+{
+	struct Slab *sl;
+	void *obj;
+
+	if (!(sl = cache->km_partial))
+	{
+		if ((sl = cache->km_empty))
+		{
+			slab_unlink(&cache->km_empty, sl);
+			slab_push(&cache->km_partial, sl);
+		}
+		else if (!(sl = slab_grow(cache)))
+			return NULL;
+	}
+	obj = sl->sl_free;
+	sl->sl_free = *(void **)obj;
+	sl->sl_inuse++;
+	cache->km_inuse++;
+	if (sl->sl_inuse == cache->km_perslab)
+	{
+		slab_unlink(&cache->km_partial, sl);
+		slab_push(&cache->km_full, sl);
+	}
+	return obj;
+}
+
+/**
+ * 把对象 obj 归还给所属的 slab
+ * slab 变空时，若已经保留了一个空 slab，则把它的物理页还给页分配器
+ */
+static void
+slab_free(struct KmemCache *cache, void *obj)
+{
+	struct Slab *sl = ROUNDDOWN(obj, PGSIZE);
+
+	if (sl->sl_cache != cache)
+		panic("kmem_cache_free: %p does not belong to cache %s", obj, cache->km_name);
+	if (sl->sl_inuse == cache->km_perslab)
+	{
+		slab_unlink(&cache->km_full, sl);
+		slab_push(&cache->km_partial, sl);
+	}
+	*(void **)obj = sl->sl_free;
+	sl->sl_free = obj;
+	sl->sl_inuse--;
+	cache->km_inuse--;
+	if (sl->sl_inuse > 0)
+		return;
+
+	slab_unlink(&cache->km_partial, sl);
+	if (!cache->km_empty)
+	{
+		slab_push(&cache->km_empty, sl);
+		return;
+	}
+	sl->sl_cache = NULL;
+	cache->km_nslabs--;
+	page_decref(pa2page(PADDR(sl)));
+}
+
+/**
+ * 从 cache 中分配一个对象(内容未初始化)
+ * 先从当前 CPU 的空闲对象栈中取，栈空时从 slab 中取出半栈
+ * 内存不足时返回 NULL
+ */
+void *
+kmem_cache_alloc(struct KmemCache *cache)
+{
+	struct KmemCpuCache *kc = &cache->km_cpu[cpunum()];
+	void *obj;
+
+	if (kc->kc_count == 0)
+	{
+		while (kc->kc_count < KMEM_MAGSIZE / 2 && (obj = slab_alloc(cache)))
+			kc->kc_objs[kc->kc_count++] = obj;
+		if (kc->kc_count == 0)
+			return NULL;
+	}
+	kc->kc_allocs++;
+	return kc->kc_objs[--kc->kc_count];
+}
+
+/**
+ * 把 kmem_cache_alloc() 分配的对象 obj 还给 cache
+ * 先压入当前 CPU 的空闲对象栈，栈满时把较早释放的半栈还给 slab
+ */
+void kmem_cache_free(struct KmemCache *cache, void *obj)
+{
+	struct KmemCpuCache *kc = &cache->km_cpu[cpunum()];
+	int i;
+
+	if (!obj)
+		return;
+	if (kc->kc_count == KMEM_MAGSIZE)
+	{
+		for (i = 0; i < KMEM_MAGSIZE / 2; i++)
+			slab_free(cache, kc->kc_objs[i]);
+		memmove(kc->kc_objs, kc->kc_objs + KMEM_MAGSIZE / 2, (KMEM_MAGSIZE / 2) * sizeof(void *));
+		kc->kc_count -= KMEM_MAGSIZE / 2;
+	}
+	kc->kc_objs[kc->kc_count++] = obj;
+	kc->kc_frees++;
+}
+
+/**
+ * 把当前 CPU 空闲对象栈中的对象全部还给 slab
+ */
+static void
+kmem_cache_drain(struct KmemCache *cache)
+{
+	struct KmemCpuCache *kc = &cache->km_cpu[cpunum()];
+
+	while (kc->kc_count > 0)
+		slab_free(cache, kc->kc_objs[--kc->kc_count]);
+}
+
+/**
+ * 汇总 cache 各个 CPU 的统计计数，不需要的项传 NULL
+ */
+static void
+kmem_cache_stats(struct KmemCache *cache, uint64_t *allocs, uint64_t *frees, uint64_t *requested)
+{
+	struct KmemCpuCache *kc;
+	uint64_t a = 0, f = 0, r = 0;
+
+	for (kc = cache->km_cpu; kc < cache->km_cpu + NCPU; kc++)
+	{
+		a += kc->kc_allocs;
+		f += kc->kc_frees;
+		r += kc->kc_requested;
+	}
+	if (allocs)
+		*allocs = a;
+	if (frees)
+		*frees = f;
+	if (requested)
+		*requested = r;
+}
+
+static int
+slab_count(struct Slab *list)
+{
+	int n;
+
+	for (n = 0; list; list = list->sl_next)
+		n++;
+	return n;
+}
+
+/**
+ * 对象缓存的自检: slab 跨多个页的补充、对象对齐，以及释放时 slab 在 full/partial/empty 之间的迁移
+ * 测试缓存用完后撤销，页分配器的空闲页数应恢复原样
+ */
+static void
+check_kmem(void)
+{
+	struct KmemCache *cache;
+	struct Slab *sl;
+	void *objs[128];
+	size_t nfree0, nzero0, nfree, nzero;
+	uint64_t allocs, frees;
+	int i, j, n;
+
+	page_counts(&nfree0, &nzero0);
+	assert((cache = kmem_cache_create("kmem-test", 100, 64)));
+	assert(cache->km_size == 128 && cache->km_offset % 64 == 0);
+
+	// 分配两个满 slab 再多一个对象，需要补充多次、占用3个页
+	n = 2 * cache->km_perslab + 1;
+	assert(n <= (int)(sizeof(objs) / sizeof(objs[0])));
+	for (i = 0; i < n; i++)
+	{
+		assert((objs[i] = kmem_cache_alloc(cache)));
+		assert((uintptr_t)objs[i] % 64 == 0);
+		sl = ROUNDDOWN(objs[i], PGSIZE);
+		assert(sl->sl_cache == cache);
+		assert((char *)objs[i] >= (char *)sl + cache->km_offset);
+		assert((char *)objs[i] + cache->km_size <= (char *)sl + PGSIZE);
+		memset(objs[i], i, cache->km_size);
+	}
+	// 对象互不重叠
+	for (i = 0; i < n; i++)
+		for (j = 0; j < (int)cache->km_size; j++)
+			assert(((unsigned char *)objs[i])[j] == (unsigned char)i);
+	kmem_cache_drain(cache);
+	assert(cache->km_nslabs == 3 && cache->km_inuse == n);
+	assert(slab_count(cache->km_full) == 2 && slab_count(cache->km_partial) == 1);
+	assert(cache->km_partial->sl_inuse == 1 && !cache->km_empty);
+
+	// 释放一个满 slab 中除一个以外的对象: full -> partial
+	sl = cache->km_full;
+	for (i = 0, j = 0; i < n; i++)
+		if (ROUNDDOWN(objs[i], PGSIZE) == (void *)sl && ++j < cache->km_perslab)
+		{
+			kmem_cache_free(cache, objs[i]);
+			objs[i] = NULL;
+		}
+	kmem_cache_drain(cache);
+	assert(sl->sl_inuse == 1);
+	assert(slab_count(cache->km_full) == 1 && slab_count(cache->km_partial) == 2);
+
+	// 释放它的最后一个对象: partial -> empty
+	for (i = 0; i < n; i++)
+		if (ROUNDDOWN(objs[i], PGSIZE) == (void *)sl)
+		{
+			kmem_cache_free(cache, objs[i]);
+			objs[i] = NULL;
+		}
+	kmem_cache_drain(cache);
+	assert(cache->km_empty == sl && cache->km_nslabs == 3);
+
+	// 释放其余对象: 只保留一个空 slab，其余的页还给页分配器
+	for (i = 0; i < n; i++)
+		kmem_cache_free(cache, objs[i]);
+	kmem_cache_drain(cache);
+	assert(cache->km_inuse == 0 && cache->km_nslabs == 1);
+	assert(!cache->km_full && !cache->km_partial && cache->km_empty);
+	kmem_cache_stats(cache, &allocs, &frees, NULL);
+	assert(allocs == (uint64_t)n && frees == (uint64_t)n);
+
+	// 撤销测试缓存(它是最后创建的缓存)
+	assert(cache == &kmem_caches[kmem_ncaches - 1]);
+	page_decref(pa2page(PADDR(cache->km_empty)));
+	kmem_ncaches--;
+	page_counts(&nfree, &nzero);
+	assert(nfree + nzero == nfree0 + nzero0);
+
+	cprintf("check_kmem() succeeded!\n");
+}
+
+/**
+ * 创建 kmalloc 各个大小类的对象缓存，应在页分配器初始化之后调用
+ */
+void kmalloc_init(void)
+{
+	char name[KMEM_NAMELEN];
+	int i;
+
+	check_kmem();
+	for (i = 0; i < KMALLOC_NCLASSES; i++)
+	{
+		snprintf(name, sizeof(name), "kmalloc-%lu", 1UL << (i + KMALLOC_MINSHIFT));
+		if (!(kmalloc_caches[i] = kmem_cache_create(name, 1UL << (i + KMALLOC_MINSHIFT), 16)))
+			panic("kmalloc_init: cannot create cache %s", name);
+	}
+	check_kmalloc();
+}
+
+/**
+ * 分配 size 字节的内核内存(内容未初始化)，返回的地址按16字节对齐
+ * 不超过 KMALLOC_MAXSIZE 时从最小的能容纳它的大小类中分配(每个 CPU 的空闲对象栈)，
+ * 否则分配物理地址连续的多个页
+ * size 为0、内存不足或 kmalloc_init() 之前调用时返回 NULL
+ */
+void *
+kmalloc(size_t size)
+{
+	struct KmallocRun *kr;
+	struct PageInfo *pp;
+	size_t n, i;
+	int c = 0;
+	void *obj;
+
+	if (size == 0)
+		return NULL;
+	if (size <= KMALLOC_MAXSIZE)
+	{
+		while ((1UL << (c + KMALLOC_MINSHIFT)) < size)
+			c++;
+		// kmalloc_init() 之前(如启动早期 panic 时的 backtrace)没有大小类缓存
+		if (!kmalloc_caches[c])
+			return NULL;
+		// 请求的字节数与分配的字节数之比反映取整造成的内部碎片
+		if ((obj = kmem_cache_alloc(kmalloc_caches[c])))
+			kmalloc_caches[c]->km_cpu[cpunum()].kc_requested += size;
+		return obj;
+	}
+
+	n = ROUNDUP(size + sizeof(struct KmallocRun), PGSIZE) / PGSIZE;
+	if (size > npages * PGSIZE || !(pp = page_alloc_npages(n)))
+		return NULL;
+	// 与 slab 页一样，各页一直被分配器引用，直到 kfree()
+	for (i = 0; i < n; i++)
+		pp[i].pp_ref++;
+	kr = page2kva(pp);
+	kr->kr_magic = KMALLOC_MAGIC;
+	kr->kr_npages = n;
+	kmalloc_large_allocs++;
+	kmalloc_large_pages += n;
+	return kr + 1;
+}
+
+/**
+ * 释放 kmalloc() 分配的内存，ptr 为 NULL 时什么也不做
+ * 通过 ptr 所在页的页首区分两种分配: 多页分配的页首是 KmallocRun，否则是 slab 的页首
+ */
+void kfree(void *ptr)
+{
+	struct KmallocRun *kr = ROUNDDOWN(ptr, PGSIZE);
+	struct PageInfo *pp;
+	size_t i;
+
+	if (!ptr)
+		return;
+	if (ptr == (void *)(kr + 1) && kr->kr_magic == KMALLOC_MAGIC)
+	{
+		pp = pa2page(PADDR(kr));
+		kmalloc_large_frees++;
+		kmalloc_large_pages -= kr->kr_npages;
+		kr->kr_magic = 0;
+		for (i = kr->kr_npages; i > 0; i--)
+			page_decref(&pp[i - 1]);
+		return;
+	}
+	kmem_cache_free(((struct Slab *)kr)->sl_cache, ptr);
+}
+
+/**
+ * kmalloc()/kfree() 的自检: 每个大小类的边界大小、多页分配、两种释放以及释放后的重用
+ */
+static void
+check_kmalloc(void)
+{
+	struct KmallocRun *kr;
+	struct PageInfo *pp;
+	size_t nfree0, nzero0, nfree, nzero, sz;
+	size_t sizes[2];
+	void *p, *q;
+	int c, k, i;
+
+	assert(!kmalloc(0));
+	kfree(NULL);
+
+	// 每个大小类: 刚好超过上一个类的大小和恰好等于本类的大小都落在本类中，释放后立即重用同一个对象
+	for (c = 0; c < KMALLOC_NCLASSES; c++)
+	{
+		sz = 1UL << (c + KMALLOC_MINSHIFT);
+		sizes[0] = c == 0 ? 1 : sz / 2 + 1;
+		sizes[1] = sz;
+		for (k = 0; k < 2; k++)
+		{
+			assert((p = kmalloc(sizes[k])));
+			assert((uintptr_t)p % 16 == 0);
+			assert(((struct Slab *)ROUNDDOWN(p, PGSIZE))->sl_cache == kmalloc_caches[c]);
+			memset(p, 0xA5, sizes[k]);
+			kfree(p);
+			assert((q = kmalloc(sizes[k])) == p);
+			kfree(q);
+		}
+	}
+
+	// 多页分配: 页首是 KmallocRun，各页物理地址连续且被引用，释放后页数恢复并重用同一段
+	page_counts(&nfree0, &nzero0);
+	assert((p = kmalloc(3 * PGSIZE)));
+	assert((uintptr_t)p % 16 == 0);
+	kr = ROUNDDOWN(p, PGSIZE);
+	assert(p == (void *)(kr + 1) && kr->kr_magic == KMALLOC_MAGIC && kr->kr_npages == 4);
+	pp = pa2page(PADDR(kr));
+	for (i = 0; i < 4; i++)
+	{
+		assert(pp[i].pp_ref == 1);
+		assert(page2kva(&pp[i]) == (char *)kr + i * PGSIZE);
+	}
+	memset(p, 0x5A, 3 * PGSIZE);
+	page_counts(&nfree, &nzero);
+	assert(nfree + nzero == nfree0 + nzero0 - 4);
+	kfree(p);
+	assert(kr->kr_magic != KMALLOC_MAGIC);
+	for (i = 0; i < 4; i++)
+		assert(pp[i].pp_ref == 0);
+	page_counts(&nfree, &nzero);
+	assert(nfree + nzero == nfree0 + nzero0);
+	assert((q = kmalloc(3 * PGSIZE)) == p);
+	kfree(q);
+
+	// 刚好超过最大大小类的请求走多页路径
+	assert((p = kmalloc(KMALLOC_MAXSIZE + 1)));
+	kr = ROUNDDOWN(p, PGSIZE);
+	assert(p == (void *)(kr + 1) && kr->kr_magic == KMALLOC_MAGIC && kr->kr_npages == 1);
+	kfree(p);
+	page_counts(&nfree, &nzero);
+	assert(nfree + nzero == nfree0 + nzero0);
+
+	cprintf("check_kmalloc() succeeded!\n");
+}
+
+/**
+ * 输出所有对象缓存的统计(监视器的 slabs 命令)
+ */
+void kmem_report(void)
+{
+	struct KmemCache *cache;
+	uint64_t allocs, frees, requested;
+	int i, cpu, cached;
+
+	cprintf("  %-16s %6s %6s %6s %6s %6s %10s %10s\n",
+			"cache", "size", "slabs", "inuse", "cpu", "free", "allocs", "frees");
+	for (i = 0; i < kmem_ncaches; i++)
+	{
+		cache = &kmem_caches[i];
+		cached = 0;
+		for (cpu = 0; cpu < NCPU; cpu++)
+			cached += cache->km_cpu[cpu].kc_count;
+		kmem_cache_stats(cache, &allocs, &frees, NULL);
+		cprintf("  %-16s %6lu %6d %6d %6d %6d %10lu %10lu\n",
+				cache->km_name, cache->km_size, cache->km_nslabs, cache->km_inuse - cached,
+				cached, cache->km_nslabs * cache->km_perslab - cache->km_inuse, allocs, frees);
+	}
+
+	cprintf("  %-16s %10s %10s %6s\n", "kmalloc", "requested", "allocated", "used");
+	for (i = 0; i < KMALLOC_NCLASSES; i++)
+	{
+		if (!(cache = kmalloc_caches[i]))
+			continue;
+		kmem_cache_stats(cache, &allocs, NULL, &requested);
+		if (allocs == 0)
+			continue;
+		cprintf("  %-16s %10lu %10lu %5lu%%\n", cache->km_name, requested,
+				allocs * cache->km_size, requested * 100 / (allocs * cache->km_size));
+	}
+	cprintf("  %-16s allocs %lu frees %lu pages %lu\n", "kmalloc-large",
+			kmalloc_large_allocs, kmalloc_large_frees, kmalloc_large_pages);
+}
@@ -0,0 +1,52 @@
+#ifndef ALVOS_KERN_KMEM_H
+#define ALVOS_KERN_KMEM_H
+#ifndef ALVOS_KERNEL
+# error "This is a AlvOS kernel header; user programs should not #include it"
+#endif
+
+#include "inc/types.h"
+#include "kern/cpu.h"
+
+// 每个 CPU 的对象缓存最多缓存的空闲对象数
+#define KMEM_MAGSIZE 16
+// 缓存名的最大长度
+#define KMEM_NAMELEN 16
+
+struct Slab;
+
+// 每个 CPU 私有的空闲对象栈，分配和释放只在其为空或满时才访问 slab
+// 统计计数也按 CPU 记录，快速路径不写任何共享的缓存行
+struct KmemCpuCache
+{
+	int kc_count;
+	void *kc_objs[KMEM_MAGSIZE];
+	uint64_t kc_allocs;	   // 本 CPU 上的分配次数
+	uint64_t kc_frees;	   // 本 CPU 上的释放次数
+	uint64_t kc_requested; // kmalloc 在本 CPU 上请求的字节数(只用于 kmalloc 的大小类缓存)
+} __attribute__((aligned(64)));
+
+// 一种大小的对象的缓存(object cache)，由若干个 slab(各占一个物理页)组成
+struct KmemCache
+{
+	char km_name[KMEM_NAMELEN];
+	size_t km_size;	   // 对象大小(已按对齐要求向上取整)
+	size_t km_offset;  // slab 中第一个对象相对于页首的偏移
+	int km_perslab;	   // 每个 slab 中的对象数
+	struct Slab *km_partial; // 部分分配的 slab
+	struct Slab *km_full;	 // 已分配满的 slab
+	struct Slab *km_empty;	 // 没有分配对象的 slab(最多保留一个，其余还给页分配器)
+	int km_nslabs;			 // 当前占用的 slab(物理页)数
+	int km_inuse;			 // 从 slab 中取出的对象数(包括每个 CPU 栈中的空闲对象)
+	struct KmemCpuCache km_cpu[NCPU];
+};
+
+struct KmemCache *kmem_cache_create(const char *name, size_t size, size_t align);
+void *kmem_cache_alloc(struct KmemCache *cache);
+void kmem_cache_free(struct KmemCache *cache, void *obj);
+void kmem_report(void);
+
+void kmalloc_init(void);
+void *kmalloc(size_t size);
+void kfree(void *ptr);
+
+#endif
@@ -7,6 +7,7 @@
 #include "dwarf_error.h"
 #include "dwarf_define.h"
 #include "dwarf.h"
+#include "kern/addrindex.h"
 
 // #define FRAME_DEBUG
 #define printf cprintf
@@ -58,17 +59,139 @@ void _dwarf_frame_params_init(Dwarf_Debug dbg)
         dbg->dbg_frame_undefined_value = DW_FRAME_UNDEFINED_VAL;
 }
 
+/*
+ * FDE 查找表(相当于 .eh_frame_hdr 的二分查找表，见 kern/addrindex.c)
+ * 每个映像的 FDE 按 [initloc, initloc+adrange) 索引，附属项是解析好的 CIE，命中后只需解析那一个 FDE
+ * 只支持 .eh_frame 和32位长度的条目，否则不建立查找表，由调用者顺序扫描
+ */
+#define FDEIDX_NIMAGES 8
+
+static struct AddrIndex fde_indexes[FDEIDX_NIMAGES];
+
+/*
+ * 扫描整个 .eh_frame 建立 ai，内存不足或 .eh_frame 格式不支持时返回 -1
+ */
+static int
+_dwarf_fde_index_build(struct AddrIndex *ai)
+{
+        Dwarf_Section *ds = &debug_frame_sec;
+        struct _Dwarf_Fde fde;
+        struct _Dwarf_Cie cie, *cies;
+        uint64_t off, length, id, cieoff;
+        int i;
+
+        if (!is_eh_frame || ds->ds_data == NULL)
+                return (-1);
+
+        dbg->dbg_eh_offset = 0;
+        while ((off = dbg->dbg_eh_offset) < ds->ds_size)
+        {
+                /* 先看是 CIE 还是 FDE(只支持32位长度) */
+                length = dbg->read(ds->ds_data, &off, 4);
+                if (length == 0)
+                        break;
+                if (length == 0xffffffff)
+                        return (-1);
+                id = dbg->read(ds->ds_data, &off, 4);
+
+                memset(&fde, 0, sizeof(fde));
+                if (id == 0)
+                {
+                        memset(&cie, 0, sizeof(cie));
+                        fde.fde_cie = &cie;
+                        if (_dwarf_get_next_fde(dbg, 1, NULL, &fde) < 0 ||
+                            addr_index_add_aux(ai, &cie) < 0)
+                                return (-1);
+                        continue;
+                }
+
+                /* CIE 指针是相对于该字段自身的偏移 */
+                cieoff = off - 4 - id;
+                cies = ai->ai_aux;
+                for (i = 0; i < ai->ai_naux; i++)
+                        if (cies[i].cie_offset == cieoff)
+                                break;
+                if (i == ai->ai_naux)
+                        return (-1);
+                cie = cies[i];
+                fde.fde_cie = &cie;
+                if (_dwarf_get_next_fde(dbg, 1, NULL, &fde) < 0 ||
+                    addr_index_add(ai, fde.fde_initloc, fde.fde_initloc + fde.fde_adrange,
+                                   fde.fde_offset, i) < 0)
+                        return (-1);
+        }
+        addr_index_sort(ai);
+        return (0);
+}
+
+/*
+ * 返回当前映像(dbg->dbg_elf)的 FDE 查找表，第一次调用时建立
+ * 无法建立时返回 NULL
+ */
+static struct AddrIndex *
+_dwarf_fde_index_get(void)
+{
+        struct AddrIndex *ai;
+        uint64_t saved_off;
+        int fresh;
+
+        if (dbg->dbg_elf == NULL)
+                return (NULL);
+        ai = addr_index_get(fde_indexes, FDEIDX_NIMAGES, dbg->dbg_elf,
+                            sizeof(struct _Dwarf_Cie), &fresh);
+        if (fresh)
+        {
+                saved_off = dbg->dbg_eh_offset;
+                if (_dwarf_fde_index_build(ai) < 0)
+                        addr_index_fail(ai);
+                dbg->dbg_eh_offset = saved_off;
+        }
+        return (ai->ai_nranges >= 0 ? ai : NULL);
+}
+
+/*
+ * 丢弃映像 elf 的 FDE 查找表(映像即将被释放)
+ */
+void
+_dwarf_fde_index_forget(const void *elf)
+{
+
+        addr_index_forget(fde_indexes, FDEIDX_NIMAGES, elf);
+}
+
 int dwarf_get_fde_at_pc(Dwarf_Addr pc,
                         Dwarf_Addr *lopc, Dwarf_Addr *hipc, struct _Dwarf_Fde *ret_fde, Dwarf_Cie cie, Dwarf_Error *error)
 {
         Dwarf_Fde fde = ret_fde;
-        memset(fde, 0, sizeof(struct _Dwarf_Fde));
-        fde->fde_cie = cie;
+        struct AddrIndex *ai;
+        struct AddrRange *ar;
+        Dwarf_Unsigned off;
 
         if (ret_fde == NULL || lopc == NULL || hipc == NULL)
         {
                 return (DW_DLV_ERROR);
         }
+        memset(fde, 0, sizeof(struct _Dwarf_Fde));
+        fde->fde_cie = cie;
+
+        if ((ai = _dwarf_fde_index_get()) != NULL)
+        {
+                if ((ar = addr_index_lookup(ai, pc)) == NULL)
+                {
+                        DWARF_SET_ERROR(dbg, error, DW_DLE_NO_ENTRY);
+                        return (DW_DLV_NO_ENTRY);
+                }
+                /* 使用缓存的 CIE，只解析这一个 FDE */
+                *cie = ((struct _Dwarf_Cie *)ai->ai_aux)[ar->ar_aux];
+                off = ar->ar_off;
+                if (_dwarf_frame_set_fde(dbg, fde, &debug_frame_sec, &off, 1,
+                                         cie, error) != DW_DLE_NONE)
+                        return (DW_DLV_ERROR);
+                fde->fde_cie = cie;
+                *lopc = fde->fde_initloc;
+                *hipc = fde->fde_initloc + fde->fde_adrange - 1;
+                return (DW_DLV_OK);
+        }
 
         while (dbg->dbg_eh_offset < dbg->dbg_eh_size)
         {
@@ -25,9 +25,16 @@ int64_t
 _dwarf_decode_sleb128(uint8_t **dp);
 int _dwarf_find_section_enhanced(Dwarf_Section *ds);
 
+/*
+ * 执行行号程序
+ * nrowsp 为 NULL 时: li->li_line 为地址不超过 pc 的最后一行，遇到地址超过 pc 的行即停止
+ * nrowsp 非 NULL 时(行号表模式): 执行整个程序，把每一行(包括 end_sequence 行)依次存入 rows，
+ * *nrowsp 为行数；rows 为 NULL 时只计数
+ */
 static int
 _dwarf_lineno_run_program(Dwarf_CU *cu, Dwarf_LineInfo li, uint8_t *p,
-                          uint8_t *pe, Dwarf_Addr pc, Dwarf_Error *error)
+                          uint8_t *pe, Dwarf_Addr pc, struct LineRow *rows,
+                          int *nrowsp, Dwarf_Error *error)
 {
     Dwarf_Line ln, tln;
     uint64_t address, file, line, column, isa, opsize;
@@ -53,6 +60,18 @@ _dwarf_lineno_run_program(Dwarf_CU *cu, Dwarf_LineInfo li, uint8_t *p,
 #define APPEND_ROW                    \
     do                                \
     {                                 \
+        if (nrowsp != NULL)           \
+        {                             \
+            if (rows != NULL)         \
+            {                         \
+                rows[*nrowsp].lr_addr = address;     \
+                rows[*nrowsp].lr_line = line;        \
+                rows[*nrowsp].lr_file = file;        \
+                rows[*nrowsp].lr_endseq = end_sequence; \
+            }                         \
+            (*nrowsp)++;              \
+            break;                    \
+        }                             \
         if (pc < address)             \
         {                             \
             return DW_DLE_NONE;       \
@@ -96,6 +115,8 @@ _dwarf_lineno_run_program(Dwarf_CU *cu, Dwarf_LineInfo li, uint8_t *p,
             case DW_LNE_end_sequence:
                 p++;
                 end_sequence = 1;
+                if (nrowsp != NULL)
+                    APPEND_ROW;
                 RESET_REGISTERS;
                 break;
             case DW_LNE_set_address:
@@ -245,26 +266,25 @@ _dwarf_lineno_add_file(Dwarf_LineInfo li, uint8_t **p, const char *compdir,
     return (DW_DLE_NONE);
 }
 
-int _dwarf_lineno_init(Dwarf_Die *die, uint64_t offset, Dwarf_LineInfo linfo, Dwarf_Addr pc, Dwarf_Error *error)
+/*
+ * 读取 .debug_line 中 offset 处的行号程序头部到 li
+ * *pp 和 *pep 为行号程序的起止位置
+ */
+static int
+_dwarf_lineno_header(uint64_t offset, Dwarf_LineInfo li, uint8_t **pp,
+                     uint8_t **pep, Dwarf_Error *error)
 {
     Dwarf_Section myds = {.ds_name = ".debug_line"};
     Dwarf_Section *ds = &myds;
-    Dwarf_CU *cu;
-    Dwarf_Attribute at;
-    Dwarf_LineInfo li;
     //Dwarf_LineFile lf, tlf;
     uint64_t length, hdroff, endoff;
     uint8_t *p;
     int dwarf_size, i, ret;
 
-    cu = die->cu_header;
-    assert(cu != NULL);
     assert(dbg != NULL);
 
-    if ((_dwarf_find_section_enhanced(ds)) != 0)
-        return (DW_DLE_NONE);
-
-    li = linfo;
+    if ((_dwarf_find_section_enhanced(ds)) != 0 || ds->ds_data == NULL)
+        return (DW_DLE_NO_ENTRY);
     /*
      * Try to find out the dir where the CU was compiled. Later we
      * will use the dir to create full pathnames, if need.
@@ -391,16 +411,8 @@ int _dwarf_lineno_init(Dwarf_Die *die, uint64_t offset, Dwarf_LineInfo linfo, Dw
         goto fail_cleanup;
     }
 
-    /*
-     * Process line number program.
-     */
-    ret = _dwarf_lineno_run_program(cu, li, p, ds->ds_data + endoff, pc,
-                                    error);
-    if (ret != DW_DLE_NONE)
-        goto fail_cleanup;
-
-    //cu->cu_lineinfo = li;
-
+    *pp = p;
+    *pep = ds->ds_data + endoff;
     return (DW_DLE_NONE);
 
 fail_cleanup:
@@ -411,6 +423,214 @@ fail_cleanup:
     return (ret);
 }
 
+int _dwarf_lineno_init(Dwarf_Die *die, uint64_t offset, Dwarf_LineInfo linfo, Dwarf_Addr pc, Dwarf_Error *error)
+{
+    Dwarf_CU *cu;
+    uint8_t *p, *pe;
+    int ret;
+
+    cu = die->cu_header;
+    assert(cu != NULL);
+
+    if ((ret = _dwarf_lineno_header(offset, linfo, &p, &pe, error)) != DW_DLE_NONE)
+        return (ret == DW_DLE_NO_ENTRY ? DW_DLE_NONE : ret);
+
+    /*
+     * Process line number program.
+     */
+    return (_dwarf_lineno_run_program(cu, linfo, p, pe, pc, NULL, NULL, error));
+}
+
+/*
+ * 行号表缓存
+ * 每次查询都重新执行整个 CU 的行号程序代价很高，因此第一次查询某个 CU 时把它的行号程序
+ * 完整执行一次，解码为按地址排序的 (地址, 文件, 行号) 数组，之后的查询只需二分查找
+ * 所有行号表共享固定大小的行数组(内存预算)，空间不足时按 LRU 淘汰最久未使用的行号表并压缩
+ * 行号表以 (ELF 映像, .debug_line 偏移) 标识
+ */
+
+/* 缓存的行数(内存预算)和行号表数 */
+#define LINECACHE_NROWS 16384
+#define LINECACHE_NTABLES 64
+
+struct LineTable
+{
+    const void *lt_elf;       /* 所属的 ELF 映像，NULL 表示空闲 */
+    uint64_t lt_offset;       /* 行号程序在 .debug_line 中的偏移 */
+    struct LineRow *lt_rows;  /* 按地址排序 */
+    int lt_nrows;
+    uint64_t lt_lastuse;      /* 最近一次使用的时间(line_clock) */
+};
+
+static struct LineRow line_rows[LINECACHE_NROWS];
+static struct LineTable line_tables[LINECACHE_NTABLES];
+static int line_rows_used;
+static uint64_t line_clock;
+
+/* 把所有行号表移到行数组的开头，空闲空间集中在末尾 */
+static void
+_dwarf_lineno_compact(void)
+{
+    struct LineTable *order[LINECACHE_NTABLES], *lt;
+    struct LineRow *dst = line_rows;
+    int i, j, n = 0;
+
+    /* 按行数组中的位置排序，依次前移 */
+    for (i = 0; i < LINECACHE_NTABLES; i++)
+    {
+        if ((lt = &line_tables[i])->lt_elf == NULL)
+            continue;
+        for (j = n++; j > 0 && order[j - 1]->lt_rows > lt->lt_rows; j--)
+            order[j] = order[j - 1];
+        order[j] = lt;
+    }
+    for (i = 0; i < n; i++)
+    {
+        lt = order[i];
+        if (lt->lt_rows != dst)
+            memmove(dst, lt->lt_rows, lt->lt_nrows * sizeof(struct LineRow));
+        lt->lt_rows = dst;
+        dst += lt->lt_nrows;
+    }
+    line_rows_used = dst - line_rows;
+}
+
+/*
+ * 分配一个能容纳 nrows 行的行号表，必要时淘汰最久未使用的行号表
+ * nrows 超出内存预算时返回 NULL
+ */
+static struct LineTable *
+_dwarf_lineno_alloc(int nrows)
+{
+    struct LineTable *lt, *slot, *victim;
+    int i, used;
+
+    if (nrows > LINECACHE_NROWS)
+        return NULL;
+    while (1)
+    {
+        slot = victim = NULL;
+        used = 0;
+        for (i = 0; i < LINECACHE_NTABLES; i++)
+        {
+            lt = &line_tables[i];
+            if (lt->lt_elf == NULL)
+            {
+                if (slot == NULL)
+                    slot = lt;
+                continue;
+            }
+            used += lt->lt_nrows;
+            if (victim == NULL || lt->lt_lastuse < victim->lt_lastuse)
+                victim = lt;
+        }
+        if (slot != NULL && used + nrows <= LINECACHE_NROWS)
+            break;
+        victim->lt_elf = NULL;
+    }
+    if (line_rows_used + nrows > LINECACHE_NROWS)
+        _dwarf_lineno_compact();
+    slot->lt_rows = &line_rows[line_rows_used];
+    slot->lt_nrows = nrows;
+    line_rows_used += nrows;
+    return slot;
+}
+
+/*
+ * 丢弃映像 elf 的所有行号表(映像即将被释放)，其行空间在下次压缩时回收
+ */
+void
+_dwarf_lineno_forget(const void *elf)
+{
+    int i;
+
+    for (i = 0; i < LINECACHE_NTABLES; i++)
+        if (line_tables[i].lt_elf == elf)
+            line_tables[i].lt_elf = NULL;
+}
+
+/*
+ * 返回 die 所在 CU 的行号表(.debug_line 偏移 offset)，不在缓存中时解码
+ * 无法解码或超出内存预算时返回 NULL
+ */
+static struct LineTable *
+_dwarf_lineno_table(Dwarf_Die *die, uint64_t offset)
+{
+    _Dwarf_LineInfo li;
+    struct LineTable *lt;
+    struct LineRow tmp;
+    uint8_t *p, *pe;
+    int i, j, n = 0;
+
+    for (i = 0; i < LINECACHE_NTABLES; i++)
+        if (line_tables[i].lt_elf == dbg->dbg_elf && line_tables[i].lt_offset == offset)
+            return &line_tables[i];
+
+    /* 先计数，再分配空间并解码 */
+    memset(&li, 0, sizeof(_Dwarf_LineInfo));
+    if (_dwarf_lineno_header(offset, &li, &p, &pe, NULL) != DW_DLE_NONE ||
+        _dwarf_lineno_run_program(die->cu_header, &li, p, pe, 0, NULL, &n, NULL) != DW_DLE_NONE ||
+        (lt = _dwarf_lineno_alloc(n)) == NULL)
+        return NULL;
+    n = 0;
+    _dwarf_lineno_run_program(die->cu_header, &li, p, pe, 0, lt->lt_rows, &n, NULL);
+    lt->lt_elf = dbg->dbg_elf;
+    lt->lt_offset = offset;
+
+    /*
+     * 插入排序(各序列内部已按地址递增)，地址相同时 end_sequence 行排在前面，
+     * 这样二分查找找到的是同一地址上开始的新序列的行
+     */
+    for (i = 1; i < n; i++)
+    {
+        tmp = lt->lt_rows[i];
+        for (j = i; j > 0 && (lt->lt_rows[j - 1].lr_addr > tmp.lr_addr ||
+                              (lt->lt_rows[j - 1].lr_addr == tmp.lr_addr &&
+                               !lt->lt_rows[j - 1].lr_endseq && tmp.lr_endseq));
+             j--)
+            lt->lt_rows[j] = lt->lt_rows[j - 1];
+        lt->lt_rows[j] = tmp;
+    }
+    return lt;
+}
+
+/*
+ * 通过缓存的行号表查找 pc 所在的行，结果存入 linebuf
+ * pc 不在任何序列中时行号为 0
+ * 无法使用缓存时返回 -1
+ */
+static int
+_dwarf_lineno_lookup(Dwarf_Die *die, uint64_t offset, Dwarf_Addr pc, Dwarf_Line linebuf)
+{
+    struct LineTable *lt;
+    struct LineRow *lr;
+    int lo, hi, mid;
+
+    if ((lt = _dwarf_lineno_table(die, offset)) == NULL)
+        return -1;
+    lt->lt_lastuse = ++line_clock;
+
+    /* 找到最后一个地址 <= pc 的行 */
+    lo = 0;
+    hi = lt->lt_nrows;
+    while (lo < hi)
+    {
+        mid = (lo + hi) / 2;
+        if (lt->lt_rows[mid].lr_addr <= pc)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    memset(linebuf, 0, sizeof(_Dwarf_Line));
+    if (lo > 0 && !(lr = &lt->lt_rows[lo - 1])->lr_endseq)
+    {
+        linebuf->ln_addr = lr->lr_addr;
+        linebuf->ln_fileno = lr->lr_file;
+        linebuf->ln_lineno = lr->lr_line;
+    }
+    return 0;
+}
+
 int dwarf_srclines(Dwarf_Die *die, Dwarf_Line linebuf, Dwarf_Addr pc, Dwarf_Error *error)
 {
     _Dwarf_LineInfo li;
@@ -427,6 +647,10 @@ int dwarf_srclines(Dwarf_Die *die, Dwarf_Line linebuf, Dwarf_Addr pc, Dwarf_Erro
         return (DW_DLV_NO_ENTRY);
     }
 
+    if (_dwarf_lineno_lookup(die, at->u[0].u64, pc, linebuf) == 0)
+        return (DW_DLV_OK);
+
+    /* 行号表超出缓存的内存预算时直接执行行号程序 */
     if (_dwarf_lineno_init(die, at->u[0].u64, &li, pc, error) !=
         DW_DLE_NONE)
     {
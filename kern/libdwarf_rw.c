@@ -319,6 +319,7 @@ int _dwarf_init(Dwarf_Debug dbg, void *obj)
     dbg->curr_off_dbginfo = 0;
     dbg->dbg_info_size = 0;
     dbg->dbg_pointer_size = _dwarf_elf_get_pointer_size(obj);
+    dbg->dbg_elf = obj;
 
     if (_dwarf_elf_get_byte_order(obj) == DW_OBJECT_MSB)
     {
@@ -12,6 +12,13 @@
 #include "kern/kdebug.h"
 #include "kern/dwarf_api.h"
 #include "kern/trap.h"
+#include "kern/trace.h"
+#include "kern/prof.h"
+#include "kern/cpu.h"
+#include "kern/env.h"
+#include "kern/pmap.h"
+#include "kern/spinlock.h"
+#include "kern/kmem.h"
 
 #define CMDBUF_SIZE 80 // enough for one VGA text line
 
@@ -25,6 +32,18 @@ struct Command
 
 static struct Command commands[] = {
 	{"help", "Display this list of commands", mon_help},
+	{"kerninfo", "Display information about the kernel", mon_kerninfo},
+	{"backtrace", "Display a symbolized backtrace of the kernel stack", mon_backtrace},
+	{"cpus", "Per-CPU user/kernel/idle time", mon_cpus},
+	{"envs", "Environments with run counts, CPU time and page-table usage", mon_envs},
+	{"top", "Environments by CPU time with resource usage: top [n]", mon_top},
+	{"mem", "Physical page frame usage", mon_mem},
+	{"rmap", "Environments and addresses mapping a physical page: rmap <pa>", mon_rmap},
+	{"slabs", "Slab allocator caches and kmalloc usage", mon_slabs},
+	{"locks", "Spinlock acquisition and contention counts", mon_locks},
+	{"irqs", "Per-CPU trap and interrupt counts by vector", mon_irqs},
+	{"trace", "Kernel tracing: trace on|off|clear|dump [n]", mon_trace},
+	{"prof", "Sampling profiler: prof on|off|clear|report [n]", mon_prof},
 };
 #define NCOMMANDS (sizeof(commands) / sizeof(commands[0]))
 
@@ -39,6 +58,363 @@ int mon_help(int argc, char **argv, struct Trapframe *tf)
 	return 0;
 }
 
+/**
+ * 输出内核映像的各个段边界和内存占用
+ */
+int mon_kerninfo(int argc, char **argv, struct Trapframe *tf)
+{
+	extern char entry[], _bootstrap[], etext[], edata[], end[];
+
+	cprintf("Special kernel symbols:\n");
+	cprintf("  entry      %016lx (phys)\n", (uintptr_t)entry);
+	cprintf("  _bootstrap %016lx (virt)  %016lx (phys)\n", (uintptr_t)_bootstrap, (uintptr_t)_bootstrap - KERNBASE);
+	cprintf("  etext      %016lx (virt)  %016lx (phys)\n", (uintptr_t)etext, (uintptr_t)etext - KERNBASE);
+	cprintf("  edata      %016lx (virt)  %016lx (phys)\n", (uintptr_t)edata, (uintptr_t)edata - KERNBASE);
+	cprintf("  end        %016lx (virt)  %016lx (phys)\n", (uintptr_t)end, (uintptr_t)end - KERNBASE);
+	cprintf("Kernel executable memory footprint: %luKB\n",
+			ROUNDUP(end - _bootstrap, 1024) / 1024);
+	return 0;
+}
+
+// backtrace 最多显示的帧数
+#define BACKTRACE_MAX 32
+
+/**
+ * 沿帧指针链回溯内核栈，每一帧解析出文件、行号和函数
+ * 从内核态陷入(tf 不为 NULL)时从陷入点开始回溯，否则从监视器自身开始
+ */
+int mon_backtrace(int argc, char **argv, struct Trapframe *tf)
+{
+	uintptr_t pcs[BACKTRACE_MAX + 1];
+	struct Ripdebuginfo info;
+	int i, n = 0;
+
+	if (tf && (tf->tf_cs & 3) == 0)
+	{
+		pcs[n++] = tf->tf_rip;
+		n += backtrace_fp(tf->tf_regs.reg_rbp, NULL, pcs + n, BACKTRACE_MAX);
+	}
+	else
+		n = backtrace_fp(read_rbp(), NULL, pcs, BACKTRACE_MAX);
+
+	cprintf("Stack backtrace:\n");
+	for (i = 0; i < n; i++)
+	{
+		// 返回地址指向 call 的下一条指令，减 1 后解析才落在调用所在的行
+		uintptr_t rip = i == 0 && tf && (tf->tf_cs & 3) == 0 ? pcs[i] : pcs[i] - 1;
+
+		if (debuginfo_rip(rip, &info) == 0)
+			cprintf("  %016lx %s:%d: %.*s+%lx\n", pcs[i], info.rip_file, info.rip_line,
+					info.rip_fn_namelen, info.rip_fn_name, pcs[i] - info.rip_fn_addr);
+		else
+			cprintf("  %016lx <unknown>\n", pcs[i]);
+	}
+	return 0;
+}
+
+// 以千分之一为单位计算 part 占 whole 的比例
+static uint32_t
+permille(uint64_t part, uint64_t whole)
+{
+	// 先缩小两个数，避免乘法溢出
+	while (part > ~0ULL / 1000)
+	{
+		part >>= 1;
+		whole >>= 1;
+	}
+	return whole ? part * 1000 / whole : 0;
+}
+
+/**
+ * 输出每个 CPU 自启动以来运行用户环境、停机空闲和在内核中(含等待大内核锁)的时间(TSC 周期)
+ * 其他 CPU 正在停机或运行用户环境的这一段也计入
+ */
+int mon_cpus(int argc, char **argv, struct Trapframe *tf)
+{
+	static const char *const status[] = {"unused", "started", "halted"};
+	uint64_t now = read_tsc(), total, user, idle, kern;
+	struct CpuInfo *c;
+	int i;
+
+	cprintf("  %3s %-7s %-8s %16s %16s %6s %16s %6s %6s\n",
+			"cpu", "status", "env", "elapsed", "user", "%", "idle", "%", "kern%");
+	for (i = 0; i < ncpu; i++)
+	{
+		c = &cpus[i];
+		if (c->cpu_status == CPU_UNUSED || !c->cpu_start_tsc)
+			continue;
+		total = now - c->cpu_start_tsc;
+		user = c->cpu_user_tsc;
+		idle = c->cpu_idle_tsc;
+		if (c != thiscpu)
+		{
+			if (c->cpu_status == CPU_HALTED)
+				idle += now - c->cpu_mark_tsc;
+			else if (c->cpu_env && c->cpu_env->env_status == ENV_RUNNING &&
+					 c->cpu_env->env_cpunum == i)
+				user += now - c->cpu_mark_tsc;
+		}
+		kern = total > user + idle ? total - user - idle : 0;
+		cprintf("  %3d %-7s %08x %16lu %16lu %3u.%u%% %16lu %3u.%u%% %3u.%u%%\n",
+				i, status[c->cpu_status], c->cpu_env ? c->cpu_env->proc_id : 0, total,
+				user, permille(user, total) / 10, permille(user, total) % 10,
+				idle, permille(idle, total) / 10, permille(idle, total) % 10,
+				permille(kern, total) / 10, permille(kern, total) % 10);
+	}
+	return 0;
+}
+
+/**
+ * 输出所有环境的状态、运行次数、用户态时间(TSC 周期)、页表页数和映射的用户页数
+ */
+int mon_envs(int argc, char **argv, struct Trapframe *tf)
+{
+	static const char *const status[] = {"free", "dying", "runnable", "running", "blocked"};
+	struct Env *e;
+	size_t npt, nmapped, tpt = 0, tmapped = 0;
+	int i, n = 0;
+
+	cprintf("  %-8s %-8s %-8s %3s %10s %16s %8s %8s\n",
+			"env", "parent", "status", "cpu", "runs", "user", "ptpages", "mapped");
+	for (i = 0, e = env_live; i < env_nlive; i++, e = e->env_live_next)
+	{
+		npt = env_pgtable_pages(e, &nmapped);
+		tpt += npt;
+		tmapped += nmapped;
+		n++;
+		cprintf("  %08x %08x %-8s %3d %10u %16lu %8lu %8lu\n",
+				e->proc_id, e->env_parent_id, status[e->env_status],
+				e->env_status == ENV_RUNNING ? e->env_cpunum : -1,
+				e->env_runs, e->env_ru.ru_utime, npt, nmapped);
+	}
+	cprintf("%d environments, %lu page-table pages (%luKB), %lu mapped pages\n",
+			n, tpt, tpt * PGSIZE / 1024, tmapped);
+	return 0;
+}
+
+/**
+ * 按用户态加内核态时间降序输出前 n 个环境(默认10个)的资源使用统计
+ */
+int mon_top(int argc, char **argv, struct Trapframe *tf)
+{
+	static struct Env *sorted[NENV];
+	struct Env *e;
+	uint64_t cpu, all = 0;
+	int i, j, n, cnt = 0;
+
+	n = argc > 1 ? strtol(argv[1], NULL, 0) : 10;
+	if (n <= 0)
+		n = 10;
+	// 插入排序，环境数量很少
+	for (i = 0, e = env_live; i < env_nlive; i++, e = e->env_live_next)
+	{
+		cpu = e->env_ru.ru_utime + e->env_ru.ru_stime;
+		all += cpu;
+		for (j = cnt++; j > 0 && sorted[j - 1]->env_ru.ru_utime + sorted[j - 1]->env_ru.ru_stime < cpu; j--)
+			sorted[j] = sorted[j - 1];
+		sorted[j] = e;
+	}
+
+	cprintf("  %-8s %14s %14s %6s %8s %7s %6s %7s %7s %7s %7s\n", "env", "user", "sys", "cpu%",
+			"syscalls", "faults", "cow", "ipc-tx", "ipc-rx", "vcsw", "ivcsw");
+	for (i = 0; i < cnt && i < n; i++)
+	{
+		struct Rusage *ru = &sorted[i]->env_ru;
+		uint32_t pm = permille(ru->ru_utime + ru->ru_stime, all);
+
+		cprintf("  %08x %14lu %14lu %3u.%u%% %8lu %7lu %6lu %7lu %7lu %7lu %7lu\n",
+				sorted[i]->proc_id, ru->ru_utime, ru->ru_stime, pm / 10, pm % 10,
+				ru->ru_syscalls, ru->ru_pgfaults, ru->ru_cow, ru->ru_ipc_sent,
+				ru->ru_ipc_recv, ru->ru_nvcsw, ru->ru_nivcsw);
+	}
+	return 0;
+}
+
+/**
+ * 输出物理页的使用情况
+ */
+int mon_mem(int argc, char **argv, struct Trapframe *tf)
+{
+	size_t nfree, nzero, used;
+
+	page_counts(&nfree, &nzero);
+	used = npages - nfree - nzero;
+	cprintf("  total     %8lu pages %8luKB\n", npages, npages * PGSIZE / 1024);
+	cprintf("  used      %8lu pages %8luKB\n", used, used * PGSIZE / 1024);
+	cprintf("  free      %8lu pages %8luKB\n", nfree, nfree * PGSIZE / 1024);
+	cprintf("  prezeroed %8lu pages %8luKB\n", nzero, nzero * PGSIZE / 1024);
+	return 0;
+}
+
+/**
+ * 通过反向映射输出映射物理地址 pa 所在页的所有环境和虚拟地址
+ */
+int mon_rmap(int argc, char **argv, struct Trapframe *tf)
+{
+	struct PageInfo *pp;
+	struct Rmap **head, *rm;
+	struct Env *e;
+	physaddr_t pa;
+	int i;
+
+	if (argc < 2)
+	{
+		cprintf("usage: rmap <pa>\n");
+		return 0;
+	}
+	pa = strtol(argv[1], NULL, 0);
+	if (PGNUM(pa) >= npages)
+	{
+		cprintf("rmap: %lx is not a physical page\n", pa);
+		return 0;
+	}
+	pp = pa2page(pa);
+	cprintf("  page %lx ref %d\n", ROUNDDOWN(pa, PGSIZE), pp->pp_ref);
+	if (!(head = page_rmap_head(pp)))
+	{
+		cprintf("  (not tracked)\n");
+		return 0;
+	}
+	for (rm = *head; rm; rm = rm->rm_next)
+	{
+		// 按4级页表找到所属的环境
+		for (i = 0, e = env_live; i < env_nlive; i++, e = e->env_live_next)
+			if (e->env_pml4e == rm->rm_pml4e)
+				break;
+		cprintf("  %08x %016lx\n", i < env_nlive ? e->proc_id : 0, rm->rm_va);
+	}
+	return 0;
+}
+
+/**
+ * 输出 slab 分配器各个对象缓存和 kmalloc 的使用情况
+ */
+int mon_slabs(int argc, char **argv, struct Trapframe *tf)
+{
+	kmem_report();
+	return 0;
+}
+
+/**
+ * 输出自旋锁的竞争统计
+ */
+int mon_locks(int argc, char **argv, struct Trapframe *tf)
+{
+	spin_report();
+	return 0;
+}
+
+/**
+ * 输出每个 CPU 上各个向量的陷入次数，只列出发生过的向量
+ */
+int mon_irqs(int argc, char **argv, struct Trapframe *tf)
+{
+	char name[32];
+	uint64_t total;
+	int v, i;
+
+	cprintf("  %3s %-28s", "vec", "name");
+	for (i = 0; i < ncpu; i++)
+		cprintf(" %9s%d", "cpu", i);
+	cprintf(" %10s\n", "total");
+	for (v = 0; v < 256; v++)
+	{
+		total = 0;
+		for (i = 0; i < ncpu; i++)
+			total += trap_counts[i][v];
+		if (!total)
+			continue;
+		// 外部中断按 IRQ 号显示
+		if (v >= IRQ_OFFSET && v < IRQ_OFFSET + 32 && v != T_SYSCALL)
+			snprintf(name, sizeof(name), "IRQ %d", v - IRQ_OFFSET);
+		else
+			snprintf(name, sizeof(name), "%s", trapname(v));
+		cprintf("  %3d %-28s", v, name);
+		for (i = 0; i < ncpu; i++)
+			cprintf(" %10lu", trap_counts[i][v]);
+		cprintf(" %10lu\n", total);
+	}
+	return 0;
+}
+
+// trace dump 每个 CPU 最多显示的事件数
+#define TRACE_DUMPMAX 64
+
+/**
+ * 控制内核跟踪，或显示每个 CPU 环形缓冲区中最近的 n 个事件(默认16个)
+ * 时间戳显示为相对于所显示的最早事件的 TSC 周期数
+ */
+int mon_trace(int argc, char **argv, struct Trapframe *tf)
+{
+	static struct TraceEvent evs[TRACE_DUMPMAX];
+	uint64_t seq, base;
+	int cpu, i, n, cnt;
+
+	if (argc < 2)
+	{
+		cprintf("Usage: trace on|off|clear|dump [n]\n");
+		return 0;
+	}
+	if (strcmp(argv[1], "on") == 0)
+		trace_enable(1);
+	else if (strcmp(argv[1], "off") == 0)
+		trace_enable(0);
+	else if (strcmp(argv[1], "clear") == 0)
+		trace_clear();
+	else if (strcmp(argv[1], "dump") == 0)
+	{
+		n = argc > 2 ? strtol(argv[2], NULL, 0) : 16;
+		if (n <= 0 || n > TRACE_DUMPMAX)
+			n = TRACE_DUMPMAX;
+		for (cpu = 0; cpu < ncpu; cpu++)
+		{
+			// 序号取最大值，trace_read() 会把起点调整为最近的 n 个事件
+			seq = ~0ULL;
+			cnt = trace_read(cpu, &seq, evs, 0);
+			seq = seq > n ? seq - n : 0;
+			if ((cnt = trace_read(cpu, &seq, evs, n)) <= 0)
+				continue;
+			cprintf("CPU %d: %d events\n", cpu, cnt);
+			base = evs[0].te_tsc;
+			for (i = 0; i < cnt; i++)
+				cprintf("  +%-12llu [%08x] %-9s %016llx %016llx\n",
+						evs[i].te_tsc - base, evs[i].te_envid, trace_name(evs[i].te_id),
+						evs[i].te_args[0], evs[i].te_args[1]);
+		}
+	}
+	else
+		cprintf("Unknown trace command '%s'\n", argv[1]);
+	return 0;
+}
+
+/**
+ * 控制采样剖析器，或按函数输出样本数最多的 n 个函数(默认20个)
+ */
+int mon_prof(int argc, char **argv, struct Trapframe *tf)
+{
+	int n;
+
+	if (argc < 2)
+	{
+		cprintf("Usage: prof on|off|clear|report [n]\n");
+		return 0;
+	}
+	if (strcmp(argv[1], "on") == 0)
+		prof_enable(1);
+	else if (strcmp(argv[1], "off") == 0)
+		prof_enable(0);
+	else if (strcmp(argv[1], "clear") == 0)
+		prof_clear();
+	else if (strcmp(argv[1], "report") == 0)
+	{
+		n = argc > 2 ? strtol(argv[2], NULL, 0) : 20;
+		prof_report(n > 0 ? n : 20);
+	}
+	else
+		cprintf("Unknown prof command '%s'\n", argv[1]);
+	return 0;
+}
+
 /************************* 内核监控命令解释器 *************************/
 
 #define WHITESPACE "\t\r\n "
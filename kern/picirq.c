@@ -82,3 +82,14 @@ irq_setmask_8259A(uint16_t mask)
 	// cprintf("\n");
 }
 
+
+/**
+ * 向 8259A 发送 EOI
+ * 主片工作在自动 EOI 模式，只有从片上的 IRQ(8~15) 需要显式发送 EOI
+ */
+void
+irq_eoi_8259A(int irq)
+{
+	if (irq >= 8)
+		outb(IO_PIC2, 0x20);
+}
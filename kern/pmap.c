@@ -15,6 +15,9 @@
 #include "kern/multiboot.h"
 #include "kern/env.h"
 #include "kern/cpu.h"
+#include "kern/vma.h"
+#include "kern/spinlock.h"
+#include "kern/kmem.h"
 
 // boot 阶段的页表映射(5PGSIZE): - 1 pml4(包含1项)，2 pdpt(包含4项)，2 pde(包含2048个项)
 // extern uint64_t pml4phys;
@@ -36,6 +39,10 @@ physaddr_t boot_cr3;
 // 因此，物理地址和数组索引很方便相换算(<<PGSHIFT)
 struct PageInfo *pages;					// 物理页状态(PageInfo)数组
 static struct PageInfo *page_free_list; // 空闲物理页链表
+// 与 pages[] 平行的反向映射表头数组(只在内核中使用，不映射到 UPAGES)
+static struct Rmap **page_rmaps;
+// page_rmaps[] 中表示该页不记录反向映射的标记
+#define RMAP_UNTRACKED ((struct Rmap *)1)
 
 // --------------------------------------------------------------
 // 检测机器的物理内存设置.
@@ -225,6 +232,7 @@ static void mem_init_mp(void);
 static void boot_map_region(pml4e_t *pml4e, uintptr_t va, size_t size, physaddr_t pa, int perm);
 static void check_page_free_list(bool only_low_memory);
 static void check_page_alloc(void);
+static void check_rmap(void);
 static void check_boot_pml4e(pml4e_t *pml4e);
 static physaddr_t check_va2pa(pde_t *pgdir, uintptr_t va);
 static void page_check(void);
@@ -344,6 +352,10 @@ void x64_vm_init(void)
 	// cprintf("x64_vm_init: allocate memory for procs[%d].\n", NENV);
 	procs = (struct Env *)boot_alloc(sizeof(struct Env) * NENV);
 	memset(procs, 0, NENV * sizeof(struct Env));
+
+	// 与 pages[] 平行的反向映射表头数组，不映射到 UPAGES，用户环境不可见
+	page_rmaps = (struct Rmap **)boot_alloc(sizeof(struct Rmap *) * npages);
+	memset(page_rmaps, 0, npages * sizeof(struct Rmap *));
 	// size_t end_procs = PPN(PADDR(0x80045a4000));
 	// cprintf("end_procs: %p\n", end_procs);
 
@@ -544,11 +556,42 @@ void page_init(void)
 }
 
 /**
- * page_alloc() 函数将从 pages 数组空间中由后往前分配，通过使用 page_free_list 指针和 pp_link 成员返回链表第一个 PageInfo 结构地址
- * 当传入参数标识非 0 时，分配的空间将被清零。虽然一开始 pages 数组空间被清零，但此刻分配的空间可能是之前被使用后回收的，不一定为空
+ * 从空闲页链表 page_free_list 头部取出一个物理页，链表为空时返回 NULL
+ * 空闲页链表最后一个结点的 pp_link 指向自身(而非 NULL)，取出时需要特判
+ */
+static struct PageInfo *
+page_free_list_pop(void)
+{
+	struct PageInfo *phypage = page_free_list;
+	if (phypage)
+	{
+		// 将 page_init() 组织的空闲页链表 page_free_list 的第一个页结点取出，将头指针指向下一个页结点
+		// 判断是否为最后一个页结点
+		if (phypage->pp_link == phypage)
+			page_free_list = NULL;
+		else
+			page_free_list = phypage->pp_link;
+		// 为了能在 page_free() 双重错误检查，将*准备取出的页结点*的 pp_link 设置为 NULL
+		phypage->pp_link = NULL;
+	}
+	return phypage;
+}
+
+/**
+ * 预清零物理页池：CPU 空闲时(sched_halt)预先清零的空闲物理页，以 NULL 结尾的单链表
+ * page_alloc(ALLOC_ZERO) 优先从该池中取页，从而把清零的开销从缺页/系统调用路径上移到空闲 CPU 上
+ * page_free() 回收的物理页仍然进入 page_free_list(脏页)，由 page_zero_idle() 逐步补充到该池中
+ */
+static struct PageInfo *page_zero_list;
+static size_t page_zero_count;
+
+/**
+ * page_alloc() 优先从空闲页链表 page_free_list 取出物理页，返回对应的 PageInfo 结构地址
+ * 当 alloc_flags & ALLOC_ZERO 时，返回的物理页内容为全0：
+ * 优先从预清零页池 page_zero_list 中取出(无需再清零)，池为空时才从 page_free_list 取出并用 memset() 清零
+ * 不需要清零的分配优先使用 page_free_list 中的脏页，为清零请求保留预清零页池，脏页用尽后才使用预清零页
  * 
  * 具体实现：
- * (alloc_flags & ALLOC_ZERO)==true，则通过 page2kva() 和 memset() 用'\0'填充整个返回的物理页
  * 不增加物理页的引用次数，如果确实需要增加引用次数，调用者必须显式地调用 page_insert()
  * 确保将分配物理页的 pp_link 字段设置为 NULL，这样 page_free() 检查就可以双重保证
  * (pp->pp_ref == 0 和 pp->pp_link == NULL)
@@ -562,36 +605,172 @@ void page_init(void)
 struct PageInfo *
 page_alloc(int alloc_flags)
 {
-	// 获取空闲页链表的第一个物理页结点 phypage，准备从链表取出
-	struct PageInfo *phypage = page_free_list;
-	// 存在空闲的内存，更新空闲页链表
-	if (phypage)
+	struct PageInfo *phypage;
+
+	// 需要清零：优先使用预清零页池中的物理页
+	if ((alloc_flags & ALLOC_ZERO) && (phypage = page_zero_list))
 	{
-		// 与普通链表取出结点的步骤相同
-		// 将 page_init() 组织的空闲页链表 page_free_list 的第一个页结点取出，将头指针指向下一个页结点
-		// 空闲页链表page_free_list指向*准备取出的页结点*的下一个页结点
-		// 判断是否为最后一个页结点
-		if (phypage->pp_link == phypage)
-			page_free_list = NULL;
-		else
-			page_free_list = phypage->pp_link;
-		// 为了能在 page_free() 双重错误检查，将*准备取出的页结点*的 pp_link 设置为 NULL
+		page_zero_list = phypage->pp_link;
+		page_zero_count--;
 		phypage->pp_link = NULL;
+		return phypage;
+	}
 
-		// alloc_flags 和 ALLOC_ZERO 进行与运算，非0:需要将返回的页清零
+	// 获取空闲页链表的第一个物理页结点 phypage
+	if ((phypage = page_free_list_pop()))
+	{
 		// 一定记得 memset() 参数使用的是虚拟地址
-		// 获取*准备取出的页结点*对应的虚拟地址，
-		// 调用 memset 函数将*准备取出的页结点*对应物理页页表的虚拟地址 PGSIZE 字节清零，确保所有的 PTE_P 都是'\0'
 		if (alloc_flags & ALLOC_ZERO)
 			memset(page2kva(phypage), '\0', PGSIZE);
-		if (alloc_flags == 0)
-			memset(page2kva(phypage), 0, PGSIZE);
+		return phypage;
+	}
+
+	// 脏页用尽，不需要清零的分配也可以使用预清零页
+	if ((phypage = page_zero_list))
+	{
+		page_zero_list = phypage->pp_link;
+		page_zero_count--;
+		phypage->pp_link = NULL;
 		return phypage;
 	}
 	// 空闲内存不足，返回 NULL
 	return NULL;
 }
 
+/**
+ * page_alloc_npages() 使用的空闲页位图，覆盖内核支持的全部物理内存(256MB)
+ */
+#define MAXNPAGES (256 * 1024 * 1024 / PGSIZE)
+static uint64_t page_run_map[MAXNPAGES / 64];
+
+/**
+ * 分配 n 个物理地址连续的物理页，返回第一页的 PageInfo，各页的 pp_ref 为0、pp_link 为 NULL
+ * 1.遍历空闲页链表和预清零页池，在位图中标记空闲页
+ * 2.在位图中寻找 n 个连续的空闲页(从低地址开始)
+ * 3.重建两个链表，摘除这些页
+ * 开销与物理页数成正比，只用于较大的内核分配(kmalloc)；找不到时返回 NULL
+ * 返回的页内容未清零
+ */
+struct PageInfo *
+page_alloc_npages(int n)
+{
+	struct PageInfo *pp, *next, *head, *tail;
+	size_t i, start, run = 0;
+
+	if (n <= 0)
+		return NULL;
+	if (n == 1)
+		return page_alloc(0);
+
+	memset(page_run_map, 0, sizeof(page_run_map));
+	for (pp = page_free_list; pp; pp = pp->pp_link == pp ? NULL : pp->pp_link)
+		page_run_map[(pp - pages) / 64] |= 1ULL << ((pp - pages) % 64);
+	for (pp = page_zero_list; pp; pp = pp->pp_link)
+		page_run_map[(pp - pages) / 64] |= 1ULL << ((pp - pages) % 64);
+
+	for (i = 0, start = 0; i < npages && run < n; i++)
+	{
+		if (!(page_run_map[i / 64] & (1ULL << (i % 64))))
+		{
+			run = 0;
+			start = i + 1;
+		}
+		else
+			run++;
+	}
+	if (run < n)
+		return NULL;
+
+	// 空闲页链表的最后一个结点指向自身
+	head = tail = NULL;
+	for (pp = page_free_list; pp; pp = next)
+	{
+		next = pp->pp_link == pp ? NULL : pp->pp_link;
+		if (pp >= &pages[start] && pp < &pages[start + n])
+		{
+			pp->pp_link = NULL;
+			continue;
+		}
+		if (tail)
+			tail->pp_link = pp;
+		else
+			head = pp;
+		tail = pp;
+	}
+	if (tail)
+		tail->pp_link = tail;
+	page_free_list = head;
+
+	// 预清零页池以 NULL 结尾
+	head = tail = NULL;
+	for (pp = page_zero_list; pp; pp = next)
+	{
+		next = pp->pp_link;
+		if (pp >= &pages[start] && pp < &pages[start + n])
+		{
+			pp->pp_link = NULL;
+			page_zero_count--;
+			continue;
+		}
+		if (tail)
+			tail->pp_link = pp;
+		else
+			head = pp;
+		tail = pp;
+	}
+	if (tail)
+		tail->pp_link = NULL;
+	page_zero_list = head;
+
+	return &pages[start];
+}
+
+/**
+ * 使用非临时存储指令(movnti)将一个物理页清零
+ * 绕过 cache 直接写内存，避免后台清零时把正在运行环境的 cache 行挤出
+ * 最后的 sfence 保证这些弱序的写在物理页被分配出去之前全局可见
+ */
+static void
+page_zero_nt(void *kva)
+{
+	uint64_t *p = (uint64_t *)kva;
+	uint64_t *end = p + PGSIZE / sizeof(uint64_t);
+
+	for (; p < end; p += 4)
+		asm volatile("movnti %1, 0(%0)\n\t"
+					 "movnti %1, 8(%0)\n\t"
+					 "movnti %1, 16(%0)\n\t"
+					 "movnti %1, 24(%0)"
+					 :
+					 : "r"(p), "r"(0UL)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+}
+
+/**
+ * 由空闲的 CPU 在 sched_halt() 中调用(调用者持有内核锁)，为预清零页池补充最多 PAGE_ZERO_BATCH 个物理页
+ * 每次从 page_free_list 取出一个脏页后释放内核锁再清零，使其他 CPU 在清零期间可以进入内核；
+ * 取出的页已不在任何链表中，其他 CPU 无法访问，清零完成后重新获取内核锁并放入 page_zero_list
+ * 池中的页数达到 PAGE_ZERO_MAX 后不再补充，避免把所有空闲内存都提前清零
+ */
+void page_zero_idle(void)
+{
+	struct PageInfo *pp;
+	int i;
+
+	for (i = 0; i < PAGE_ZERO_BATCH && page_zero_count < PAGE_ZERO_MAX; i++)
+	{
+		if (!(pp = page_free_list_pop()))
+			break;
+		unlock_kernel();
+		page_zero_nt(page2kva(pp));
+		lock_kernel();
+		pp->pp_link = page_zero_list;
+		page_zero_list = pp;
+		page_zero_count++;
+	}
+}
+
 /**
  * 从空闲链表头添加函数参数PageInfo结点，page_free_list 相当于栈，后进先出
  * 将一个物理页返回到空闲链表(只有当 pp->pp_ref 等于0时才应该调用page_free)
@@ -633,6 +812,26 @@ void page_decref(struct PageInfo *pp)
 		page_free(pp);
 }
 
+/**
+ * 统计空闲物理页: *nfree 为空闲页链表中的脏页数，*nzero 为预清零页池中的页数
+ * 需要遍历空闲页链表，只供监视器使用
+ */
+void page_counts(size_t *nfree, size_t *nzero)
+{
+	struct PageInfo *pp;
+	size_t n = 0;
+
+	for (pp = page_free_list; pp; pp = pp->pp_link)
+	{
+		n++;
+		// 最后一个结点的 pp_link 指向自身
+		if (pp->pp_link == pp)
+			break;
+	}
+	*nfree = n;
+	*nzero = page_zero_count;
+}
+
 /**
  * 根据参数 pml4 pointer，pml4e_walk() 翻译4级页表映射，返回一个指向虚拟地址 va 的页表项(PTE)的指针
  * 
@@ -661,15 +860,14 @@ pml4e_walk(pml4e_t *pml4e, const void *va, int create)
 			// 存在，使用 page_alloc() 分配一个新的 PDPE 页
 			if (create)
 			{
-				struct PageInfo *pp = page_alloc(0);
+				struct PageInfo *pp = page_alloc(ALLOC_ZERO);
 				// 如果分配失败，返回 NULL
 				if (!pp)
 					return NULL;
-				// 增加新物理页的引用次数并将其清空，根据返回参数 pdpe_t pointer 调用 pdpe_walk()
+				// 增加新物理页(已清零)的引用次数，根据返回参数 pdpe_t pointer 调用 pdpe_walk()
 				pp->pp_ref++;
 				// pdp_entry 指向 PDP 页的虚拟地址
 				pdp_entry = (pdpe_t *)page2kva(pp);
-				memset(pdp_entry, 0, PGSIZE);
 
 				// 修改 pml4e表中 PDPE 页项的权限
 				// pml4_entry 的值为 PDPE 页项的物理地址
@@ -724,14 +922,13 @@ pdpe_walk(pdpe_t *pdpe, const void *va, int create)
 		// 存在，使用 page_alloc() 分配一个新的4级页表页
 		if (create)
 		{
-			struct PageInfo *pp = page_alloc(0);
+			struct PageInfo *pp = page_alloc(ALLOC_ZERO);
 			// 如果分配失败，返回 NULL
 			if (!pp)
 				return NULL;
-			// 增加新物理页的引用次数并将其清空，根据返回参数 pde_t pointer 调用 pgdir_walk()
+			// 增加新物理页(已清零)的引用次数，根据返回参数 pde_t pointer 调用 pgdir_walk()
 			pp->pp_ref++;
 			pd_entry = (pde_t *)page2kva(pp);
-			memset(pd_entry, 0, PGSIZE);
 
 			// 修改 pdpe 表中4级页表页项的权限
 			// pdp_entry 的值为4级页表页项的物理地址
@@ -781,13 +978,12 @@ pgdir_walk(pde_t *pgdir, const void *va, int create)
 		// 存在，使用 page_alloc() 分配一个新的 PDE 页
 		if (create)
 		{
-			struct PageInfo *pp = page_alloc(0);
+			struct PageInfo *pp = page_alloc(ALLOC_ZERO);
 			// 如果分配失败，返回 NULL
 			if (!pp)
 				return NULL;
-			// 增加新物理页的引用次数并将其清空，根据返回参数 pdpe_t pointer 调用 pdpe_walk()
+			// 增加新物理页(已清零)的引用次数，根据返回参数 pdpe_t pointer 调用 pdpe_walk()
 			pp->pp_ref++;
-			memset(page2kva(pp), 0, PGSIZE);
 			// 修改4级页表表中 PDE 页项的权限
 			// pd_entry 的值为 PDE 页项的物理地址
 			*pd_entry = page2pa(pp);
@@ -803,21 +999,59 @@ pgdir_walk(pde_t *pgdir, const void *va, int create)
 	return pt_entry;
 }
 
+/**
+ * 页表遍历游标: pml4e_walk() 每次都从 pml4 出发经过 pdpe, pde 三级才能找到页表项，
+ * 而 region_alloc(), boot_map_region() 等映射的都是连续的虚拟地址，相邻的页几乎总是落在同一个页表页(2MB)里.
+ * 游标缓存最近一次遍历得到的页表页，va 仍在同一个 2MB 区间时直接索引，只有跨越页表页边界才重新遍历.
+ */
+void pte_cursor_init(struct PteCursor *cursor, pml4e_t *pml4e)
+{
+	cursor->pc_pml4e = pml4e;
+	cursor->pc_base = 0;
+	cursor->pc_pt = NULL;
+}
+
+/**
+ * 返回 va 对应的页表项指针，语义与 pml4e_walk() 相同(create 非 0 则按需分配中间页表)
+ * 命中缓存的页表页时不访问 pml4/pdpe/pde
+ */
+pte_t *
+pte_cursor_walk(struct PteCursor *cursor, const void *va, int create)
+{
+	uintptr_t base = ROUNDDOWN((uintptr_t)va, PTSIZE);
+	pte_t *pt_entry;
+
+	if (cursor->pc_pt && cursor->pc_base == base)
+		return &cursor->pc_pt[PTX(va)];
+
+	pt_entry = pml4e_walk(cursor->pc_pml4e, va, create);
+	if (!pt_entry)
+		return NULL;
+	// 页表项指针减去页内索引即为页表页的首地址
+	cursor->pc_base = base;
+	cursor->pc_pt = pt_entry - PTX(va);
+	return pt_entry;
+}
+
 /**
  * 将虚拟地址空间 [va, va+size) 映射到位于 pml4e 页表中的物理地址空间 [pa, pa+size)
  * 大小是 PGSIZE 的倍数，对表项使用权限位 perm|PTE_P
  * boot_map_region() 仅用于设置 UTOP 之上的"内核静态"页映射，因此*不*应该更改映射页上的 pp_ref 字段
+ * 通过页表遍历游标，每个页表页(2MB)只遍历一次4级页表
  */
 static void
 boot_map_region(pml4e_t *pml4e, uintptr_t la, size_t size, physaddr_t pa, int perm)
 {
 	size_t i;
 	pte_t *pt_entry;
+	struct PteCursor cursor;
+
+	pte_cursor_init(&cursor, pml4e);
 	// 此循环已实现 ROUNDUP(size, PGSIZE) 的效果
 	for (i = 0; i < size; i += PGSIZE)
 	{
 		// 获取线性地址 (la+i) 对应的页表项 PTE 的地址，无则分配清零的页表页
-		pt_entry = pml4e_walk(pml4e, (void *)(la + i), ALLOC_ZERO);
+		pt_entry = pte_cursor_walk(&cursor, (void *)(la + i), ALLOC_ZERO);
 		if (pt_entry)
 		{
 			// 为了设置参数 la 对应的页表项 PTE，并授予的权限，清空权限位(低12-bit)
@@ -833,44 +1067,166 @@ boot_map_region(pml4e_t *pml4e, uintptr_t la, size_t size, physaddr_t pa, int pe
 	}
 }
 
+/**
+ * 反向映射项的对象缓存，由 page_rmap_init() 创建
+ * 创建之前(启动阶段的 check_page() 等)建立的映射不记录反向映射
+ */
+static struct KmemCache *rmap_cache;
+
+/**
+ * 返回物理页 pp 的反向映射表头: 映射该页的所有 (4级页表, 虚拟地址)，只记录 page_insert() 建立的 UTOP 之下的映射
+ * pp 不记录反向映射(page_rmap_untrack())时返回 NULL
+ */
+struct Rmap **
+page_rmap_head(struct PageInfo *pp)
+{
+	struct Rmap **prm = &page_rmaps[pp - pages];
+
+	return *prm == RMAP_UNTRACKED ? NULL : prm;
+}
+
+/**
+ * 不再为物理页 pp 记录反向映射，用于被大量地址空间共享且永不释放的页(如按需调页的零页)
+ * 否则其反向映射链表随映射数增长，每次取消映射都要线性查找；调用时 pp 不能有已记录的映射
+ */
+void page_rmap_untrack(struct PageInfo *pp)
+{
+	assert(page_rmaps[pp - pages] == NULL);
+	page_rmaps[pp - pages] = RMAP_UNTRACKED;
+}
+
+/**
+ * 创建反向映射项的对象缓存，应在 kmalloc_init() 之后、创建第一个环境之前调用
+ */
+void page_rmap_init(void)
+{
+	if (!(rmap_cache = kmem_cache_create("rmap", sizeof(struct Rmap), 0)))
+		panic("page_rmap_init: cannot create cache");
+	check_rmap();
+}
+
+/**
+ * 从物理页 pp 的反向映射中删除 (pml4e, va) 项，没有该项则什么也不做
+ */
+static void
+page_rmap_remove(struct PageInfo *pp, pml4e_t *pml4e, uintptr_t va)
+{
+	struct Rmap **prm, *rm;
+
+	if (!(prm = page_rmap_head(pp)))
+		return;
+	for (; (rm = *prm); prm = &rm->rm_next)
+		if (rm->rm_pml4e == pml4e && rm->rm_va == va)
+		{
+			*prm = rm->rm_next;
+			kmem_cache_free(rmap_cache, rm);
+			return;
+		}
+}
+
+/**
+ * 取消页表项 pt_entry 上的映射(pt_entry 是 va 在 pml4e 中的页表项)
+ * 页表项不存在则什么也不做，调用者已经持有页表项指针，因此无需再遍历4级页表
+ */
+static void
+page_remove_pte(pml4e_t *pml4e, pte_t *pt_entry, void *va)
+{
+	if (!(*pt_entry & PTE_P))
+		return;
+	page_rmap_remove(pa2page(PTE_ADDR(*pt_entry)), pml4e, ROUNDDOWN((uintptr_t)va, PGSIZE));
+	// 将pp->pp_ref减1，如果pp->pp_ref为0，需要释放该PageInfo结构（将其放入page_free_list链表中）
+	page_decref(pa2page(PTE_ADDR(*pt_entry)));
+	// 将页表项 PTE 对应的 PPN 设为0，令页表该项无法索引到物理页帧
+	*pt_entry = 0;
+	// 失效化 TLB 缓存，重新加载 TLB 的 pml4，否则数据不对应
+	tlb_invalidate(pml4e, va);
+}
+
+/**
+ * 将物理页 pp 以 perm|PTE_P 权限写入页表项 pt_entry，语义同 page_insert()
+ * 如果页表项上已有映射，则先取消(同一物理页重新插入即为修改权限)
+ * UTOP 之下的映射同时记入 pp 的反向映射，反向映射项分配失败时返回 -E_NO_MEM，页表项保持不变
+ */
+static int
+page_insert_pte(pml4e_t *pml4e, pte_t *pt_entry, struct PageInfo *pp, void *va, int perm)
+{
+	struct Rmap **head = page_rmap_head(pp);
+	struct Rmap *rm = NULL;
+
+	if (rmap_cache && head && (uintptr_t)va < UTOP)
+	{
+		if (!(rm = kmem_cache_alloc(rmap_cache)))
+			return -E_NO_MEM;
+		rm->rm_pml4e = pml4e;
+		rm->rm_va = ROUNDDOWN((uintptr_t)va, PGSIZE);
+	}
+	// 提前增加pp_ref引用次数，避免 pp 在插入page_free_list之前被释放的极端情况
+	pp->pp_ref += 1;
+	page_remove_pte(pml4e, pt_entry, va);
+	*pt_entry = page2pa(pp) | perm | PTE_P;
+	if (rm)
+	{
+		rm->rm_next = *head;
+		*head = rm;
+	}
+	return 0;
+}
+
 /**
  * 实现页式内存管理最重要的一个函数，建立页表页的映射及权限
  * 将物理页'pp'映射到虚拟地址'va', 页表项的权限(低12位)设置为'perm|PTE_P'.
  * 实现：
- * - 如果已经有一个映射到'va'的物理页帧，则该物理页帧会被 page_remove() 移除
+ * - 如果已经有一个映射到'va'的物理页帧，则该物理页帧会被移除
  * - 根据需要分配一个页表并插入到'pml4e through pdpe through pgdir'中
  * - 如果插入成功，则 pp->pp_ref 会递增
  * - 如果页曾出现在'va'中，则必须调用 tlb_invalidate() 使 TLB 无效，防止页表不对应
  * 分类讨论:
  * 1. pml4e 上没有映射虚拟地址 va 对应的页表项PPN(物理页)，那么这时直接修改相应的二级页表表项即可
- * 2. 如果已经挂载了物理页，且物理页和当前分配的物理页不一样，那么就调用 page_remove(dir,va) 卸下原来的物理页，再挂载新分配的物理页
+ * 2. 如果已经挂载了物理页，且物理页和当前分配的物理页不一样，那么就卸下原来的物理页，再挂载新分配的物理页
  * 3. 如果已经挂载了物理页，而且已挂载物理页和当前分配的物理页是同样的，这种情况非常普遍，
  * 就是当内核要修改一个物理页的访问权限时，它会将同一个物理页重新插入一次，传入不同的perm参数，即完成了权限修改。
+ * 
+ * 取消旧映射直接作用于已找到的页表项，整个插入过程只遍历一次4级页表
  */
 int page_insert(pml4e_t *pml4e, struct PageInfo *pp, void *va, int perm)
 {
 	// 通过4级页式地址转换机制 pml4e_walk()，获取虚拟地址 va 对应的页表项 PTE 地址，
 	// 如果 va 对应的页表还没有分配，则分配一个空的物理页作为页表
 	pte_t *page_entry = pml4e_walk(pml4e, va, ALLOC_ZERO);
-	// 分配页表项成功
-	if (page_entry)
-	{
-		// 提前增加pp_ref引用次数，避免 pp 在插入page_free_list之前被释放的极端情况
-		pp->pp_ref += 1;
+	// 分配页表项失败
+	if (!page_entry)
+		return -E_NO_MEM;
+	return page_insert_pte(pml4e, page_entry, pp, va, perm);
+}
+
+/**
+ * 为 pml4e 中的虚拟地址空间 [va, va+size) 逐页分配物理页并以 perm|PTE_P 权限映射(va, size 须页对齐)
+ * 区间内原有的映射会被取消；alloc_flags 传递给 page_alloc()
+ * 连续的页共享同一个页表页，通过页表遍历游标每 2MB 只遍历一次4级页表
+ * 
+ * 成功返回0，内存不足返回 -E_NO_MEM(此时已映射的部分保持不变，由调用者在销毁环境时统一回收)
+ */
+int page_alloc_range(pml4e_t *pml4e, uintptr_t va, size_t size, int perm, int alloc_flags)
+{
+	struct PteCursor cursor;
+	struct PageInfo *pp;
+	pte_t *pt_entry;
+	uintptr_t end = va + size;
 
-		// 当前虚拟地址va已经被映射过，需要先释放
-		// 无论是否和当前分配的物理页帧相同，最终都要修改perm权限设置，所以统一插入新的页表项
-		if (*page_entry & PTE_P)
+	pte_cursor_init(&cursor, pml4e);
+	for (; va < end; va += PGSIZE)
+	{
+		if (!(pt_entry = pte_cursor_walk(&cursor, (void *)va, ALLOC_ZERO)))
+			return -E_NO_MEM;
+		if (!(pp = page_alloc(alloc_flags)))
+			return -E_NO_MEM;
+		if (page_insert_pte(pml4e, pt_entry, pp, (void *)va, perm) < 0)
 		{
-			// 调用 page_remove 中删除页表中对应的页表项(取消映射)
-			page_remove(pml4e, va);
+			page_free(pp);
+			return -E_NO_MEM;
 		}
-		*page_entry = page2pa(pp);
-		*page_entry |= perm | PTE_P;
-		return 0;
 	}
-	// 分配页表项失败
-	return -E_NO_MEM;
+	return 0;
 }
 
 /** 
@@ -890,18 +1246,14 @@ page_lookup(pml4e_t *pml4e, void *va, pte_t **pte_store)
 {
 	// 获取给定虚拟地址 va 对应页表项的虚拟地址，将create置为0，如果对应的页表不存在，不再新分配
 	pte_t *pt_entry = pml4e_walk(pml4e, va, 0);
-	if (pt_entry)
-	{
-		// 	将 pte_store 指向页表项的虚拟地址 pte
-		if (pte_store)
-			*pte_store = pt_entry;
-		// 由 pt 接收给定虚拟地址 va 对应页表项的PPN索引(12-bit 清除权限设置)
-		physaddr_t pt = PTE_ADDR(*pt_entry);
-		// 返回物理页帧结构地址(虚拟地址)
-		return pa2page(pt);
-	}
-	// 对应的页表项不存在/无效，返回 NULL
-	return NULL;
+	// 页表项不存在，或页表项的 PTE_P=0，返回 NULL
+	if (!pt_entry || !(*pt_entry & PTE_P))
+		return NULL;
+	// 	将 pte_store 指向页表项的虚拟地址 pte
+	if (pte_store)
+		*pte_store = pt_entry;
+	// 返回物理页帧结构地址(虚拟地址)，PTE_ADDR 清除低12-bit权限设置得到物理页的PPN索引
+	return pa2page(PTE_ADDR(*pt_entry));
 }
 
 /**
@@ -912,26 +1264,135 @@ page_lookup(pml4e_t *pml4e, void *va, pte_t **pte_store)
  * 如果没有对应的虚拟地址就什么也不做。
  * 
  * 具体做法如下：
- * 1.找到va虚拟地址对应的物理页帧PageInfo结构的虚拟地址（调用page_lookup）
+ * 1.找到va虚拟地址对应的页表项(调用pml4e_walk，不分配页表)
  * 2.减少物理页帧PageInfo结构的引用数 / 物理页帧被释放（调用page_decref）
  * 3.虚拟地址 va 对应的页表项 PTE 应该被设置为0（如果存在 PTE）
  * 4.失效化 TLB 缓存，重新加载 TLB 的4级页表，否则数据不对应（调用tlb_invalidate）
  */
 void page_remove(pml4e_t *pml4e, void *va)
 {
-	pte_t *pt_entry = NULL;
-	// pp 获取线性地址 va 对应的物理页帧PageInfo的地址，pt_entry 指向页表项的虚拟地址
-	struct PageInfo *pp = page_lookup(pml4e, va, &pt_entry);
+	// pt_entry 指向线性地址 va 对应页表项的虚拟地址
+	pte_t *pt_entry = pml4e_walk(pml4e, va, 0);
 	// 只有当 va 映射到物理页，才需要取消映射，否则什么也不做
-	if (pp)
+	if (pt_entry)
+		page_remove_pte(pml4e, pt_entry, va);
+}
+
+/**
+ * 取消 pml4e 中虚拟地址空间 [va, va+size) 的所有映射(va, size 须页对齐)
+ * 与逐页调用 page_remove() 等价，但每个页表页只遍历一次，且跳过不存在的页表页
+ */
+void page_remove_range(pml4e_t *pml4e, uintptr_t va, size_t size)
+{
+	struct PteCursor cursor;
+	pte_t *pt_entry;
+	uintptr_t end = va + size;
+
+	pte_cursor_init(&cursor, pml4e);
+	while (va < end)
 	{
-		// 将pp->pp_ref减1，如果pp->pp_ref为0，需要释放该PageInfo结构（将其放入page_free_list链表中）
-		page_decref(pp);
-		// 将页表项 PTE 对应的 PPN 设为0，令二级页表该项无法索引到物理页帧
-		*pt_entry = 0;
-		// 失效化 TLB 缓存，重新加载 TLB 的 pml4，否则数据不对应
-		tlb_invalidate(pml4e, va);
+		if (!(pt_entry = pte_cursor_walk(&cursor, (void *)va, 0)))
+		{
+			// 整个页表页都不存在，直接跳到下一个 2MB 区间
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+			continue;
+		}
+		page_remove_pte(pml4e, pt_entry, (void *)va);
+		va += PGSIZE;
+	}
+}
+
+/**
+ * 通过反向映射取消物理页 pp 在所有地址空间中的映射(页面回收、迁移等需要)
+ * 不必扫描各个环境的页表；pp 只被这些映射引用时会被释放
+ * pp 必须记录反向映射
+ */
+void page_remove_all(struct PageInfo *pp)
+{
+	struct Rmap **head = page_rmap_head(pp);
+	struct Rmap *rm;
+	pte_t *pt_entry;
+
+	if (!head)
+		panic("page_remove_all: page %p has no rmap", page2pa(pp));
+	// 持有一次引用，避免取消最后一个映射时 pp 在遍历中途被释放
+	pp->pp_ref++;
+	while ((rm = *head))
+	{
+		pt_entry = pml4e_walk(rm->rm_pml4e, (void *)rm->rm_va, 0);
+		if (pt_entry && (*pt_entry & PTE_P) && pa2page(PTE_ADDR(*pt_entry)) == pp)
+			page_remove_pte(rm->rm_pml4e, pt_entry, (void *)rm->rm_va);
+		else
+			panic("page_remove_all: stale rmap %p in %p for page %p", rm->rm_va, rm->rm_pml4e, page2pa(pp));
 	}
+	page_decref(pp);
+}
+
+/**
+ * 释放 check_rmap() 的测试4级页表 pml4e 中映射 va 所在 2MB 区间的各级页表页，以及 pml4e 本身
+ */
+static void
+check_rmap_free(pml4e_t *pml4e, uintptr_t va)
+{
+	pdpe_t *pdpe = KADDR(PTE_ADDR(pml4e[PML4(va)]));
+	pde_t *pgdir = KADDR(PTE_ADDR(pdpe[PDPE(va)]));
+
+	page_decref(pa2page(PTE_ADDR(pgdir[PDX(va)])));
+	page_decref(pa2page(PTE_ADDR(pdpe[PDPE(va)])));
+	page_decref(pa2page(PTE_ADDR(pml4e[PML4(va)])));
+	page_decref(pa2page(PADDR(pml4e)));
+}
+
+/**
+ * 反向映射的自检: 同一物理页映射在两个4级页表的不同虚拟地址上，
+ * page_remove_all() 应取消全部映射、释放该页并清空反向映射；不记录反向映射的页不进入链表
+ */
+static void
+check_rmap(void)
+{
+	struct PageInfo *pp, *pa, *pb, *pz;
+	pml4e_t *pml4a, *pml4b;
+	uintptr_t va = (uintptr_t)UTEMP, vb = (uintptr_t)UTEMP + PGSIZE;
+	struct Rmap **head;
+	size_t nfree0, nzero0, nfree, nzero;
+
+	page_counts(&nfree0, &nzero0);
+	assert((pa = page_alloc(ALLOC_ZERO)) && (pb = page_alloc(ALLOC_ZERO)));
+	pa->pp_ref++;
+	pb->pp_ref++;
+	pml4a = page2kva(pa);
+	pml4b = page2kva(pb);
+
+	assert((pp = page_alloc(0)));
+	assert(page_insert(pml4a, pp, (void *)va, PTE_U | PTE_W) == 0);
+	assert(page_insert(pml4b, pp, (void *)vb, PTE_U) == 0);
+	// 重新插入同一映射(修改权限)不产生重复项
+	assert(page_insert(pml4b, pp, (void *)vb, PTE_U | PTE_W) == 0);
+	assert(pp->pp_ref == 2);
+	assert((head = page_rmap_head(pp)) && *head && (*head)->rm_next && !(*head)->rm_next->rm_next);
+
+	page_remove_all(pp);
+	assert(pp->pp_ref == 0);
+	assert(*page_rmap_head(pp) == NULL);
+	assert(!page_lookup(pml4a, (void *)va, NULL) && !page_lookup(pml4b, (void *)vb, NULL));
+
+	// 不记录反向映射的页照常映射和取消映射
+	assert((pz = page_alloc(0)));
+	pz->pp_ref++;
+	page_rmap_untrack(pz);
+	assert(!page_rmap_head(pz));
+	assert(page_insert(pml4a, pz, (void *)va, PTE_U) == 0 && pz->pp_ref == 2);
+	page_remove(pml4a, (void *)va);
+	assert(pz->pp_ref == 1);
+	page_rmaps[pz - pages] = NULL;
+	page_decref(pz);
+
+	check_rmap_free(pml4a, va);
+	check_rmap_free(pml4b, vb);
+	page_counts(&nfree, &nzero);
+	assert(nfree + nzero == nfree0 + nzero0);
+
+	cprintf("check_rmap() succeeded!\n");
 }
 
 /**
@@ -1011,6 +1472,10 @@ int user_mem_check(struct Env *env, const void *va, size_t len, int perm)
 	while (start < end)
 	{
 		struct PageInfo *p = page_lookup(env->env_pml4e, (void *)start, &page);
+		// 页尚未调入(或需要写却映射着只读零页)但位于环境的某个 VMA 中:
+		// 先按需调页，以免内核随后访问该地址时产生页错误
+		if ((!p || (perm & ~*page & PTE_W)) && start < ULIM && vma_fault(env, start, perm & PTE_W) == 0)
+			p = page_lookup(env->env_pml4e, (void *)start, &page);
 		// 物理页不存在 / 访问物理页的权限不足 / 当前虚拟地址 >= ULIM
 		if (!p || (*page & perm) != perm || start >= ULIM)
 		{
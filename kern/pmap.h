@@ -8,6 +8,14 @@
 #include "inc/assert.h"
 struct Env;
 
+// 反向映射项: 物理页被映射在 rm_pml4e 中的 rm_va 处
+struct Rmap
+{
+	pml4e_t *rm_pml4e;
+	uintptr_t rm_va;
+	struct Rmap *rm_next; // 映射同一物理页的下一项
+};
+
 // kern/entry.S 中设置的内核栈
 extern char bootstacktop[], bootstack[];
 
@@ -58,15 +66,39 @@ enum
 	ALLOC_NONE,
 };
 
+// 预清零页池的容量上限，以及 page_zero_idle() 每次最多补充的物理页数
+#define PAGE_ZERO_MAX 256
+#define PAGE_ZERO_BATCH 32
+
+/**
+ * 页表遍历游标，缓存最近一次遍历得到的页表页(映射 pc_base 开始的 2MB)
+ * 用于连续映射/取消映射一段虚拟地址时避免每一页都从 pml4 重新遍历
+ */
+struct PteCursor
+{
+	pml4e_t *pc_pml4e; // 遍历的4级页表
+	uintptr_t pc_base; // 缓存的页表页所映射区间的基址(PTSIZE 对齐)
+	pte_t *pc_pt;	   // 缓存的页表页的虚拟地址，NULL 表示缓存无效
+};
+
 void x64_vm_init();
 
 void page_init(void);
 struct PageInfo *page_alloc(int alloc_flags);
+struct PageInfo *page_alloc_npages(int n);
 void page_free(struct PageInfo *pp);
+void page_zero_idle(void);
 int page_insert(pml4e_t *pml4e, struct PageInfo *pp, void *va, int perm);
 void page_remove(pml4e_t *pml4e, void *va);
 struct PageInfo *page_lookup(pml4e_t *pml4e, void *va, pte_t **pte_store);
 void page_decref(struct PageInfo *pp);
+void page_counts(size_t *nfree, size_t *nzero);
+int page_alloc_range(pml4e_t *pml4e, uintptr_t va, size_t size, int perm, int alloc_flags);
+void page_remove_range(pml4e_t *pml4e, uintptr_t va, size_t size);
+void page_rmap_init(void);
+struct Rmap **page_rmap_head(struct PageInfo *pp);
+void page_rmap_untrack(struct PageInfo *pp);
+void page_remove_all(struct PageInfo *pp);
 
 void tlb_invalidate(pml4e_t *pml4e, void *va);
 
@@ -109,4 +141,7 @@ pte_t *pml4e_walk(pml4e_t *pml4e, const void *va, int create);
 
 pde_t *pdpe_walk(pdpe_t *pdpe, const void *va, int create);
 
+void pte_cursor_init(struct PteCursor *cursor, pml4e_t *pml4e);
+pte_t *pte_cursor_walk(struct PteCursor *cursor, const void *va, int create);
+
 #endif
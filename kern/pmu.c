@@ -0,0 +1,115 @@
+/**
+ * 按环境虚拟化的通用性能计数器(Intel 架构性能监控，CPUID 0xA)
+ * 环境通过 sys_pmu_config() 在计数器 idx 上选择事件，计数器只在用户态计数(USR=1, OS=0)，
+ * 因此内核代码不计入，也不需要在每次陷入内核时停止计数器
+ * 环境离开 CPU 时(pmu_leave)把硬件计数累加到 env_pmu_count 并停止计数器；
+ * 返回用户态之前(pmu_enter)把计数器清零并重新启用
+ * 用户态的值 = env_pmu_count[idx] + rdpmc(idx)，CR4.PCE 允许用户态直接执行 rdpmc，
+ * 两次读取之间环境被换出时 env_runs 会变化，据此重读(见 lib/pmu.c)
+ * 不使用计数器的环境在切换时只需检查 PMU_NCOUNTERS 个事件选择寄存器的副本
+ */
+#include "inc/x86.h"
+#include "inc/mmu.h"
+#include "inc/error.h"
+#include "inc/string.h"
+#include "inc/assert.h"
+
+#include "kern/pmu.h"
+#include "kern/cpu.h"
+
+// 性能监控相关的 MSR
+#define MSR_PERFEVTSEL0 0x186
+#define MSR_PMC0 0x0C1
+#define MSR_PERF_GLOBAL_CTRL 0x38F
+
+// IA32_PERFEVTSELx 的位
+#define EVTSEL_EVENT 0x0000FFFF // event select 与 umask
+#define EVTSEL_USR (1 << 16)	// 在 CPL > 0 时计数
+#define EVTSEL_OS (1 << 17)		// 在 CPL = 0 时计数
+#define EVTSEL_EN (1 << 22)		// 启用计数器
+
+// 可供环境使用的计数器数，0 表示不支持
+static int pmu_ncounters;
+// 计数器的有效位数掩码
+static uint64_t pmu_mask;
+
+/**
+ * 每个 CPU 调用一次: 通过 CPUID 0xA 检测架构性能监控，停止所有通用计数器，
+ * 版本 2 以上在 IA32_PERF_GLOBAL_CTRL 中启用这些计数器，最后置位 CR4.PCE 允许用户态 rdpmc
+ * 不支持时(AMD 或没有暴露 PMU 的虚拟机)环境的 sys_pmu_config() 返回 -E_NOT_SUPP
+ */
+void pmu_init_percpu(void)
+{
+	uint32_t max, eax;
+	int i, version, n;
+
+	cpuid(0, &max, NULL, NULL, NULL);
+	if (max < 0xA)
+		return;
+	cpuid(0xA, &eax, NULL, NULL, NULL);
+	version = eax & 0xFF;
+	n = (eax >> 8) & 0xFF;
+	if (version == 0 || n == 0)
+		return;
+
+	pmu_ncounters = MIN(n, PMU_NCOUNTERS);
+	pmu_mask = (1ULL << ((eax >> 16) & 0xFF)) - 1;
+	for (i = 0; i < pmu_ncounters; i++)
+		wrmsr(MSR_PERFEVTSEL0 + i, 0);
+	if (version >= 2)
+		wrmsr(MSR_PERF_GLOBAL_CTRL, rdmsr(MSR_PERF_GLOBAL_CTRL) | ((1ULL << pmu_ncounters) - 1));
+	lcr4(rcr4() | CR4_PCE);
+}
+
+/**
+ * env_run() 在返回用户态之前调用(只在切换到 e 时): 清零并启用 e 使用的计数器
+ */
+void pmu_enter(struct Env *e)
+{
+	int i;
+
+	for (i = 0; i < pmu_ncounters; i++)
+		if (e->env_pmu_evtsel[i])
+		{
+			wrmsr(MSR_PMC0 + i, 0);
+			wrmsr(MSR_PERFEVTSEL0 + i, e->env_pmu_evtsel[i]);
+		}
+}
+
+/**
+ * 环境 e 离开 CPU 时调用: 停止 e 使用的计数器，并把本次运行的计数累加到 env_pmu_count
+ */
+void pmu_leave(struct Env *e)
+{
+	int i;
+
+	for (i = 0; i < pmu_ncounters; i++)
+		if (e->env_pmu_evtsel[i])
+		{
+			wrmsr(MSR_PERFEVTSEL0 + i, 0);
+			e->env_pmu_count[i] += rdmsr(MSR_PMC0 + i) & pmu_mask;
+		}
+}
+
+/**
+ * 在当前 CPU 上运行的环境 e 的计数器 idx 上选择事件 event((umask << 8) | event select，
+ * 见 inc/pmu.h)，计数从0开始；event 为 0 时停止使用该计数器
+ * 成功返回0，错误返回:
+ *  -E_NOT_SUPP: CPU 不支持架构性能监控
+ *  -E_INVAL: idx 超出可用的计数器数，或 event 不是合法的事件编码
+ */
+int pmu_config(struct Env *e, int idx, uint64_t event)
+{
+	if (pmu_ncounters == 0)
+		return -E_NOT_SUPP;
+	if (idx < 0 || idx >= pmu_ncounters || (event & ~(uint64_t)EVTSEL_EVENT))
+		return -E_INVAL;
+
+	wrmsr(MSR_PERFEVTSEL0 + idx, 0);
+	e->env_pmu_evtsel[idx] = event ? event | EVTSEL_USR | EVTSEL_EN : 0;
+	e->env_pmu_count[idx] = 0;
+	wrmsr(MSR_PMC0 + idx, 0);
+	if (event)
+		wrmsr(MSR_PERFEVTSEL0 + idx, e->env_pmu_evtsel[idx]);
+	return 0;
+}
@@ -0,0 +1,14 @@
+#ifndef ALVOS_KERN_PMU_H
+#define ALVOS_KERN_PMU_H
+#ifndef ALVOS_KERNEL
+# error "This is a AlvOS kernel header; user programs should not #include it"
+#endif
+
+#include "inc/env.h"
+
+void pmu_init_percpu(void);
+void pmu_enter(struct Env *e);
+void pmu_leave(struct Env *e);
+int pmu_config(struct Env *e, int idx, uint64_t event);
+
+#endif
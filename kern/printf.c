@@ -1,19 +1,39 @@
-// 基于printfmt()和内核控制台的cputchar(), 为AlvOS内核简单实现了cprintf控制台输出
+// 基于printfmt()和内核控制台的cons_write(), 为AlvOS内核简单实现了cprintf控制台输出
 
 #include "inc/types.h"
 #include "inc/stdio.h"
 #include "inc/stdarg.h"
 
+#include "kern/console.h"
+
+// 输出缓冲区大小
+#define CPRINTBUF 256
+
+/**
+ * 每次 vcprintf() 调用的输出缓冲区，位于调用者(每个 CPU 各自)的内核栈上，因此不需要加锁，嵌套调用也互不影响
+ * 字符先收集在 buf 中，遇到换行、缓冲区满或调用结束时才通过 cons_write() 批量输出
+ */
+struct printbuf
+{
+	int idx; // 缓冲区中的字符数
+	int cnt; // 已输出的字符总数
+	char buf[CPRINTBUF];
+};
+
 /**
- * 输出一个字符在屏幕上
- * ch: 要输出的字符 [0, 7]:ASCII，[8, 15]:输出字符的格式，高16位未使用
- * cnt 只想要给整型变量的指针，每当 putch 函数输出一个字符就 cnt++.
+ * 输出一个字符到缓冲区
+ * ch: 要输出的字符 [0, 7]:ASCII，[8, 15]:输出字符的格式，高16位未使用(只保留低8位)
  */
 static void
-putch(int ch, int *cnt)
+putch(int ch, struct printbuf *b)
 {
-	cputchar(ch);
-	*cnt++;
+	b->buf[b->idx++] = ch;
+	b->cnt++;
+	if (ch == '\n' || b->idx == CPRINTBUF)
+	{
+		cons_write(b->buf, b->idx);
+		b->idx = 0;
+	}
 }
 
 /**
@@ -22,13 +42,18 @@ putch(int ch, int *cnt)
  */
 int vcprintf(const char *fmt, va_list ap)
 {
-	int cnt = 0;
+	struct printbuf b;
 	va_list aq;
+
+	b.idx = 0;
+	b.cnt = 0;
 	va_copy(aq, ap);
-	// putch 作为函数指针，输出一个字符在屏幕上
-	vprintfmt((void *)putch, &cnt, fmt, aq);
+	// putch 作为函数指针，输出一个字符到缓冲区
+	vprintfmt((void *)putch, &b, fmt, aq);
 	va_end(aq);
-	return cnt;
+	if (b.idx > 0)
+		cons_write(b.buf, b.idx);
+	return b.cnt;
 }
 
 /**
@@ -0,0 +1,284 @@
+/**
+ * 采样剖析器: 每次 LAPIC 时钟中断记录被打断的 %rip、环境和 CPU，
+ * 并沿帧指针链记录最近的几个调用者(backtrace_fp，不解析 CFI，中断中开销很小)
+ * 每个 CPU 一个固定大小的采样缓冲区，只有所属的 CPU 写入(内核中关中断)，因此不需要加锁:
+ * 先写样本，再(编译器屏障之后)递增 pb_count；缓冲区满后丢弃新样本并计数
+ * prof_report() 按函数汇总所有样本，输出平坦剖析(flat profile)
+ *
+ * 内核在关中断的状态下运行，时钟中断只能打断用户态和空闲 CPU(sched_halt 中的 hlt)，
+ * 因此内核态样本只反映空闲时间
+ */
+#include "inc/x86.h"
+#include "inc/stdio.h"
+#include "inc/string.h"
+#include "inc/memlayout.h"
+
+#include "kern/prof.h"
+#include "kern/trap.h"
+#include "kern/pmap.h"
+#include "kern/cpu.h"
+#include "kern/env.h"
+#include "kern/kdebug.h"
+#include "kern/image.h"
+
+struct ProfBuf
+{
+	volatile uint32_t pb_count;	  // 已记录的样本数
+	volatile uint32_t pb_dropped; // 缓冲区满后丢弃的样本数
+	struct ProfSample pb_samples[PROF_NSAMPLES];
+} __attribute__((aligned(64)));
+
+static struct ProfBuf prof_bufs[NCPU];
+
+volatile bool prof_enabled;
+
+/**
+ * 时钟中断处理中调用: 在当前 CPU 的缓冲区中记录被打断的位置
+ */
+void prof_sample(struct Trapframe *tf)
+{
+	int cpu = cpunum();
+	struct ProfBuf *pb = &prof_bufs[cpu];
+	uint32_t n = pb->pb_count;
+	struct ProfSample *ps;
+	int i;
+
+	if (n >= PROF_NSAMPLES)
+	{
+		pb->pb_dropped++;
+		return;
+	}
+	ps = &pb->pb_samples[n];
+	ps->ps_rip = tf->tf_rip;
+	ps->ps_user = (tf->tf_cs & 3) == 3;
+	ps->ps_envid = ps->ps_user && curenv ? curenv->proc_id : 0;
+	ps->ps_cpu = cpu;
+	// 用户态被打断时 %cr3 仍是 curenv 的页表，可以直接读用户栈
+	i = backtrace_fp(tf->tf_regs.reg_rbp, ps->ps_user ? curenv : NULL,
+					 ps->ps_callers, PROF_NCALLERS);
+	for (; i < PROF_NCALLERS; i++)
+		ps->ps_callers[i] = 0;
+	// 样本写完之后才发布
+	asm volatile("" ::: "memory");
+	pb->pb_count = n + 1;
+}
+
+// 开始或停止采样
+void prof_enable(bool on)
+{
+	prof_enabled = on;
+}
+
+// 丢弃所有 CPU 上已记录的样本(应在停止采样时调用)
+void prof_clear(void)
+{
+	int i;
+
+	for (i = 0; i < NCPU; i++)
+	{
+		prof_bufs[i].pb_count = 0;
+		prof_bufs[i].pb_dropped = 0;
+	}
+}
+
+/****************************** 报告 ******************************/
+
+// 按 (环境, 地址) 合并样本的哈希表大小(2的幂)
+#define PROF_NADDRS 4096
+// 报告中最多区分的函数数
+#define PROF_NFUNCS 256
+// 函数名的最大长度
+#define PROF_NAMELEN 32
+
+struct ProfAddr
+{
+	uintptr_t pa_rip;
+	envid_t pa_envid;
+	int pa_self;  // 在该地址被打断的样本数
+	int pa_total; // 调用链中包含该地址的样本数，0 表示空槽
+};
+
+struct ProfFunc
+{
+	const void *pf_elf; // 函数所在的 ELF 映像，NULL 表示无法解析
+	uintptr_t pf_addr;	// 函数的起始地址(无法解析时为采样地址)
+	envid_t pf_envid;	// 采样到的(第一个)环境，内核函数为 0
+	int pf_self;		// 在函数自身中的样本数
+	int pf_total;		// 包括其调用的函数在内的样本数
+	char pf_name[PROF_NAMELEN];
+};
+
+static struct ProfAddr prof_addrs[PROF_NADDRS];
+static struct ProfFunc prof_funcs[PROF_NFUNCS];
+
+/**
+ * 把环境 envid 中的地址 rip 计入按 (环境, 地址) 合并的哈希表，self 表示是否是被打断的地址
+ * 表满时返回 -1
+ */
+static int
+prof_add_addr(uintptr_t rip, envid_t envid, bool self)
+{
+	uint32_t h = (rip ^ (rip >> 12) ^ ((uint32_t)envid * 0x9E3779B1U)) & (PROF_NADDRS - 1);
+	int i;
+
+	for (i = 0; i < PROF_NADDRS; i++, h = (h + 1) & (PROF_NADDRS - 1))
+	{
+		struct ProfAddr *pa = &prof_addrs[h];
+
+		if (pa->pa_total == 0)
+		{
+			pa->pa_rip = rip;
+			pa->pa_envid = envid;
+		}
+		else if (pa->pa_rip != rip || pa->pa_envid != envid)
+			continue;
+		pa->pa_self += self;
+		pa->pa_total++;
+		return 0;
+	}
+	return -1;
+}
+
+/**
+ * 把一个样本计入哈希表: 被打断的地址和调用链中的每个返回地址
+ * 递归调用时同一地址在调用链中出现多次，只计一次
+ * 被打断的地址无法计入时返回 -1
+ */
+static int
+prof_add_sample(const struct ProfSample *ps)
+{
+	int i, j;
+
+	if (prof_add_addr(ps->ps_rip, ps->ps_envid, 1) < 0)
+		return -1;
+	for (i = 0; i < PROF_NCALLERS && ps->ps_callers[i]; i++)
+	{
+		for (j = 0; j < i; j++)
+			if (ps->ps_callers[j] == ps->ps_callers[i])
+				break;
+		if (j == i && ps->ps_callers[i] != ps->ps_rip)
+			prof_add_addr(ps->ps_callers[i], ps->ps_envid, 0);
+	}
+	return 0;
+}
+
+/**
+ * 通过 debuginfo_rip_env() 把地址 pa 解析为函数，结果填入 *pf(pf_count 除外)
+ * 用户地址按采样时的环境解释，环境已退出或没有程序映像时无法解析
+ */
+static void
+prof_symbolize(const struct ProfAddr *pa, struct ProfFunc *pf)
+{
+	struct Ripdebuginfo info;
+	struct Env *e = NULL;
+	int n;
+
+	pf->pf_elf = NULL;
+	pf->pf_addr = pa->pa_rip;
+	pf->pf_envid = pa->pa_envid;
+	pf->pf_name[0] = '\0';
+
+	if (pa->pa_rip < ULIM)
+	{
+		if (pa->pa_envid == 0 || envid2env(pa->pa_envid, &e, 0) < 0 || !e->env_image)
+			return;
+	}
+
+	// 用户程序的调试段直接从内核中的 ELF 映像读取，不需要切换到环境的地址空间
+	if (debuginfo_rip_env(pa->pa_rip, e, &info) == 0)
+	{
+		pf->pf_elf = e ? image_elf(e->env_image) : (const void *)KELFHDR;
+		pf->pf_addr = info.rip_fn_addr;
+		n = MIN(info.rip_fn_namelen, PROF_NAMELEN - 1);
+		memmove(pf->pf_name, info.rip_fn_name, n);
+		pf->pf_name[n] = '\0';
+	}
+}
+
+/**
+ * 汇总所有 CPU 的样本，按函数输出自身样本数最多的 n 个函数
+ * 1.按 (环境, 地址) 合并样本和调用链中的返回地址，相同地址只需解析一次
+ * 2.把每个地址解析为函数，按 (ELF 映像, 函数地址) 合并，同一程序的多个实例计入同一个函数
+ * 3.按自身样本数降序排列
+ * 包括调用的函数在内的样本数只统计了帧指针回溯得到的最近 PROF_NCALLERS 层调用者
+ * 应在停止采样后调用
+ */
+void prof_report(int n)
+{
+	struct ProfFunc key, tmp;
+	uint32_t cnt, total = 0, dropped = 0, other = 0, kern = 0;
+	int cpu, i, j, nfuncs = 0;
+
+	memset(prof_addrs, 0, sizeof(prof_addrs));
+	for (cpu = 0; cpu < ncpu; cpu++)
+	{
+		struct ProfBuf *pb = &prof_bufs[cpu];
+
+		cnt = pb->pb_count;
+		asm volatile("" ::: "memory");
+		for (i = 0; i < cnt; i++)
+		{
+			if (!pb->pb_samples[i].ps_user)
+				kern++;
+			if (prof_add_sample(&pb->pb_samples[i]) < 0)
+				other++;
+		}
+		total += cnt;
+		dropped += pb->pb_dropped;
+	}
+	if (total == 0)
+	{
+		cprintf("prof: no samples\n");
+		return;
+	}
+
+	for (i = 0; i < PROF_NADDRS; i++)
+	{
+		if (prof_addrs[i].pa_total == 0)
+			continue;
+		prof_symbolize(&prof_addrs[i], &key);
+		for (j = 0; j < nfuncs; j++)
+			if (prof_funcs[j].pf_elf == key.pf_elf && prof_funcs[j].pf_addr == key.pf_addr &&
+				(key.pf_elf || prof_funcs[j].pf_envid == key.pf_envid))
+				break;
+		if (j == nfuncs)
+		{
+			if (nfuncs == PROF_NFUNCS)
+			{
+				other += prof_addrs[i].pa_self;
+				continue;
+			}
+			key.pf_self = key.pf_total = 0;
+			prof_funcs[nfuncs++] = key;
+		}
+		prof_funcs[j].pf_self += prof_addrs[i].pa_self;
+		prof_funcs[j].pf_total += prof_addrs[i].pa_total;
+	}
+
+	// 插入排序，函数数量很少
+	for (i = 1; i < nfuncs; i++)
+	{
+		tmp = prof_funcs[i];
+		for (j = i; j > 0 && (prof_funcs[j - 1].pf_self < tmp.pf_self ||
+							  (prof_funcs[j - 1].pf_self == tmp.pf_self && prof_funcs[j - 1].pf_total < tmp.pf_total));
+			 j--)
+			prof_funcs[j] = prof_funcs[j - 1];
+		prof_funcs[j] = tmp;
+	}
+
+	cprintf("prof: %u samples (%u kernel/idle), %u dropped, %d functions\n",
+			total, kern, dropped, nfuncs);
+	cprintf("  %7s %6s %7s %6s  %-16s %-8s %s\n", "self", "%", "total", "%", "address", "env", "function");
+	for (i = 0; i < nfuncs && i < n; i++)
+	{
+		struct ProfFunc *pf = &prof_funcs[i];
+		uint32_t self = (uint64_t)pf->pf_self * 1000 / total;
+		uint32_t tot = (uint64_t)pf->pf_total * 1000 / total;
+
+		cprintf("  %7d %3u.%u%% %7d %3u.%u%%  %016lx %08x %s\n",
+				pf->pf_self, self / 10, self % 10, pf->pf_total, tot / 10, tot % 10,
+				pf->pf_addr, pf->pf_envid, pf->pf_name[0] ? pf->pf_name : "<unknown>");
+	}
+	if (other)
+		cprintf("  %7u  (not aggregated: tables full)\n", other);
+}
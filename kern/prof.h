@@ -0,0 +1,34 @@
+#ifndef ALVOS_KERN_PROF_H
+#define ALVOS_KERN_PROF_H
+#ifndef ALVOS_KERNEL
+# error "This is a AlvOS kernel header; user programs should not #include it"
+#endif
+
+#include "inc/types.h"
+
+struct Trapframe;
+
+// 每个 CPU 的采样缓冲区中的样本数
+#define PROF_NSAMPLES 2048
+// 每个样本记录的调用者(返回地址)数
+#define PROF_NCALLERS 4
+
+// 一次采样: 被时钟中断打断的指令地址、调用链及当时运行的环境
+struct ProfSample
+{
+	uintptr_t ps_rip;
+	uintptr_t ps_callers[PROF_NCALLERS]; // 由帧指针回溯得到，不足时为 0
+	int32_t ps_envid; // 内核态(空闲 CPU)为 0
+	uint16_t ps_cpu;
+	uint16_t ps_user; // 是否在用户态被打断
+};
+
+// 是否在时钟中断中采样(默认关闭，由 prof_enable() 打开)
+extern volatile bool prof_enabled;
+
+void prof_sample(struct Trapframe *tf);
+void prof_enable(bool on);
+void prof_clear(void);
+void prof_report(int n);
+
+#endif
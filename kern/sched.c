@@ -4,6 +4,10 @@
 #include "kern/env.h"
 #include "kern/pmap.h"
 #include "kern/monitor.h"
+#include "kern/fpu.h"
+#include "kern/pmu.h"
+#include "kern/ide.h"
+#include "kern/trace.h"
 
 void sched_halt(void);
 
@@ -16,28 +20,26 @@ void sched_yield(void)
 {
 	/**
 	 * 实现简单的轮询调度算法.
-	 * CPU 在上次运行环境之后，在 procs[] 中以循环的方式搜索 ENV_RUNNABLE 环境，切换到找到的第一个环境.
+	 * CPU 在上次运行环境之后，在已分配环境的循环链表 env_live 中搜索 ENV_RUNNABLE 环境，切换到找到的第一个环境.
+	 * 搜索的开销只与存在的环境数有关.
 	 * 如果没有可运行的环境，但是以前在 CPU 上运行的环境仍然是 ENV_RUNNING，那么选择这个环境.
 	 * 不能选择当前正在另一个 CPU 上运行的环境(env_status == ENV_RUNNING)，如果没有可运行的环境，将会停止 CPU.
 	 */
 
 	// idle: 上次在当前 CPU 运行的环境
-	struct Env *idle = thiscpu->cpu_env;
-	int i = 0, k;
+	struct Env *idle = thiscpu->cpu_env, *e;
+	int k;
 
-	// 获取上次运行环境的 id
-	if (idle)
-		i = ENVX(thiscpu->cpu_env->proc_id);
+	TRACE(TRACE_SCHED, idle ? idle->proc_id : 0, 0);
 
-	// 从上次运行环境的 id 开始，顺序循环搜索 ENV_RUNNABLE 环境
-	for (k = 0; k < NENV; k++)
+	// 从上次运行环境的下一个开始(上次运行的环境最后检查)，如果以前没有运行环境，则从链表头开始
+	e = idle && idle->env_live_next ? idle->env_live_next : env_live;
+	for (k = 0; k < env_nlive; k++, e = e->env_live_next)
 	{
-		// 如果以前没有运行环境，则从数组的开头开始
-		i = (i + 1) % NENV;
 		// 若找到则切换环境
-		if (procs[i].env_status == ENV_RUNNABLE)
+		if (e->env_status == ENV_RUNNABLE)
 		{
-			env_run(&procs[i]);
+			env_run(e);
 			return;
 		}
 	}
@@ -57,31 +59,50 @@ void sched_yield(void)
 // timer interrupt wakes it up. This function never returns.
 void sched_halt(void)
 {
+	struct Env *e = env_live;
 	int i;
 
 	// For debugging and testing purposes, if there are no runnable
 	// environments in the system, then drop into the kernel monitor.
-	for (i = 0; i < NENV; i++)
+	// Only allocated environments (env_live) need to be checked.
+	for (i = 0; i < env_nlive; i++, e = e->env_live_next)
 	{
-		if ((procs[i].env_status == ENV_RUNNABLE ||
-			 procs[i].env_status == ENV_RUNNING ||
-			 procs[i].env_status == ENV_DYING))
+		if ((e->env_status == ENV_RUNNABLE ||
+			 e->env_status == ENV_RUNNING ||
+			 e->env_status == ENV_DYING))
 			break;
 	}
-	if (i == NENV)
+	// Environments blocked on disk I/O will be woken by the IDE
+	// interrupt, so halt and wait for it instead.
+	if (i == env_nlive && !ide_busy())
 	{
 		cprintf("No runnable processes in the system!\n");
 		while (1)
 			monitor(NULL);
 	}
 
+	// Save the FPU state and performance counters of the environment
+	// leaving this CPU and charge it for the time spent in the kernel
+	if (curenv)
+	{
+		fpu_leave(curenv);
+		pmu_leave(curenv);
+		curenv->env_ru.ru_stime += read_tsc() - thiscpu->cpu_mark_tsc;
+	}
+
 	// Mark that no environment is running on this CPU
 	curenv = NULL;
 	lcr3(PADDR(boot_pml4e));
 
+	// Use the idle time to refill the pool of pre-zeroed pages,
+	// so that page_alloc(ALLOC_ZERO) rarely has to clear a page
+	// on the fault/syscall path.
+	page_zero_idle();
+
 	// Mark that this CPU is in the HALT state, so that when
 	// timer interupts come in, we know we should re-acquire the
 	// big kernel lock
+	thiscpu->cpu_mark_tsc = read_tsc();
 	xchg(&thiscpu->cpu_status, CPU_HALTED);
 
 	// Release the big kernel lock as if we were "leaving" the kernel
@@ -18,6 +18,11 @@ struct spinlock kernel_lock = {
 #endif
 };
 
+// 所有自旋锁的登记表，供 spin_report() 输出竞争统计；静态初始化的锁需要在这里列出
+#define NLOCKS 128
+static struct spinlock *locks[NLOCKS] = {&kernel_lock};
+static int nlocks = 1;
+
 #ifdef DEBUG_SPINLOCK
 // Record the current call stack in pcs[] by following the %ebp chain.
 static void
@@ -48,7 +53,14 @@ holding(struct spinlock *lock)
 
 void __spin_initlock(struct spinlock *lk, char *name)
 {
+	int i;
+
 	lk->locked = 0;
+	lk->acquires = lk->contended = lk->spins = 0;
+	for (i = 0; i < nlocks && locks[i] != lk; i++)
+		;
+	if (i == nlocks && nlocks < NLOCKS)
+		locks[nlocks++] = lk;
 #ifdef DEBUG_SPINLOCK
 	lk->name = name;
 	lk->cpu = 0;
@@ -65,11 +77,22 @@ void spin_lock(struct spinlock *lk)
 		panic("CPU %d cannot acquire %s: already holding", cpunum(), lk->name);
 #endif
 
-		// xchg 是原子操作，而且是序列化的，因此调用 acquire() 之后的读取不会在它之前被重新排序
-		while (xchg(&lk->locked, 1) != 0)
+	uint64_t spins = 0;
+
+	// xchg 是原子操作，而且是序列化的，因此调用 acquire() 之后的读取不会在它之前被重新排序
+	while (xchg(&lk->locked, 1) != 0)
+	{
+		spins++;
 		asm volatile("pause");
+	}
+	lk->acquires++;
+	if (spins)
+	{
+		lk->contended++;
+		lk->spins += spins;
+	}
 
-		// 记录关于调试的获取锁信息.
+	// 记录关于调试的获取锁信息.
 #ifdef DEBUG_SPINLOCK
 	lk->cpu = thiscpu;
 	get_caller_pcs(lk->pcs);
@@ -121,3 +144,46 @@ void spin_unlock(struct spinlock *lk)
 	// the above assignments (and after the critical section).
 	xchg(&lk->locked, 0);
 }
+
+/**
+ * 输出所有登记的自旋锁的竞争统计，同名的锁(如每个缓存块的锁)合并为一行
+ * 读取统计时不加锁，数值可能略有滞后
+ */
+void spin_report(void)
+{
+	uint64_t acquires, contended, spins;
+	const char *name;
+	int i, j;
+
+	cprintf("  %-16s %5s %12s %12s %14s\n", "lock", "count", "acquires", "contended", "spins");
+	for (i = 0; i < nlocks; i++)
+	{
+#ifdef DEBUG_SPINLOCK
+		name = locks[i]->name;
+		// 同名的锁在第一次出现时输出
+		for (j = 0; j < i && strcmp(locks[j]->name, name) != 0; j++)
+			;
+		if (j < i)
+			continue;
+#else
+		name = "?";
+#endif
+		acquires = contended = spins = 0;
+		int n = 0;
+		for (j = i; j < nlocks; j++)
+		{
+#ifdef DEBUG_SPINLOCK
+			if (strcmp(locks[j]->name, name) != 0)
+				continue;
+#else
+			if (j != i)
+				break;
+#endif
+			n++;
+			acquires += locks[j]->acquires;
+			contended += locks[j]->contended;
+			spins += locks[j]->spins;
+		}
+		cprintf("  %-16s %5d %12lu %12lu %14lu\n", name, n, acquires, contended, spins);
+	}
+}
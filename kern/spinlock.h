@@ -11,6 +11,11 @@ struct spinlock
 {
 	unsigned locked; // 标志是否已获取锁.
 
+	// 竞争统计，获取锁之后才更新，因此不需要原子操作
+	uint64_t acquires;	// 获取次数
+	uint64_t contended; // 第一次尝试没有获取到锁的次数
+	uint64_t spins;		// 等待锁时自旋的总次数
+
 #ifdef DEBUG_SPINLOCK
 	// For debugging:
 	// 锁的名词.
@@ -29,6 +34,7 @@ struct spinlock
 void __spin_initlock(struct spinlock *lk, char *name);
 void spin_lock(struct spinlock *lk);
 void spin_unlock(struct spinlock *lk);
+void spin_report(void);
 
 #define spin_initlock(lock) __spin_initlock(lock, #lock)
 
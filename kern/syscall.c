@@ -3,6 +3,7 @@
 #include "inc/error.h"
 #include "inc/string.h"
 #include "inc/assert.h"
+#include "inc/elf.h"
 
 #include "kern/env.h"
 #include "kern/pmap.h"
@@ -10,6 +11,13 @@
 #include "kern/syscall.h"
 #include "kern/console.h"
 #include "kern/sched.h"
+#include "kern/vma.h"
+#include "kern/ide.h"
+#include "kern/bio.h"
+#include "kern/image.h"
+#include "kern/trace.h"
+#include "kern/pmu.h"
+#include "kern/fpu.h"
 
 /**
  * 将字符串s打印到系统控制台，字符串长度正好是len个字符
@@ -72,6 +80,7 @@ sys_env_destroy(envid_t envid)
 static void
 sys_yield(void)
 {
+	curenv->env_ru.ru_nvcsw++;
 	sched_yield();
 }
 
@@ -104,6 +113,14 @@ sys_exofork(void)
 	child->env_tf.tf_regs.reg_rax = 0;
 	// 子环境的父id
 	child->env_parent_id = curenv->proc_id;
+	// 复制父环境的 x87/SSE/AVX 状态
+	if ((result = fpu_fork(child, curenv)) < 0)
+	{
+		env_free(child);
+		return result;
+	}
+	// 继承父环境的 VMA 和程序映像: 父环境尚未访问过的页在子环境中同样按需调页
+	vma_copy(child, curenv);
 	// 返回子环境的id
 	return child->proc_id;
 }
@@ -155,6 +172,8 @@ sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
 		cprintf("\n bad ENvid sys_env_set_pgfault_upcall %e \n", r);
 		return r;
 	}
+	// 检查(并按需调入) tf 所在的用户内存，内核随后直接读取它
+	user_mem_assert(curenv, tf, sizeof(struct Trapframe), PTE_U);
 	envnow->env_tf = *tf;
 	envnow->env_tf.tf_cs |= 3;
 	envnow->env_tf.tf_eflags |= FL_IF;
@@ -186,7 +205,7 @@ sys_env_set_pgfault_upcall(envid_t envid, void *func)
 
 /**
  * 分配一页物理内存，并将其以 perm 权限映射 envid 环境 va 所对应的一页地址空间
- * 对 pmap.c 中 page_alloc() 和 page_insert() 的封装
+ * 对 pmap.c 中 page_alloc_range() 的封装: 通过页表遍历游标(PteCursor)找到页表项，分配清零的物理页并插入
  * - 参数 perm 为 envid 对应环境的地址空间权限
  * - 清零页内容，防止脏数据产生异常
  * - 如果一个页已经映射到参数 va，那么该页将作为副作用取消映射
@@ -200,9 +219,9 @@ sys_env_set_pgfault_upcall(envid_t envid, void *func)
 static int
 sys_page_alloc(envid_t envid, void *va, int perm)
 {
-	// sys_page_alloc() 是对 page_alloc() 和 page_insert() 的封装
+	// sys_page_alloc() 是对 page_alloc_range() 的封装
 	//   但新增检查参数的正确性.
-	// 如果 page_insert() 失败，会释放分配的物理页!
+	// 先检查参数再分配物理页，参数错误时不会泄漏物理页
 	struct Env *envnow;
 	int r = envid2env(envid, &envnow, 1);
 	if (r < 0)
@@ -210,14 +229,6 @@ sys_page_alloc(envid_t envid, void *va, int perm)
 		cprintf("sys_page_alloc(): %e.\n", r);
 		return r;
 	}
-	// 分配一个空闲物理页
-	struct PageInfo *pp = page_alloc(0);
-	// 以下为错误检查
-	if (!pp)
-	{
-		cprintf("sys_page_alloc(): No memory to allocate page SYS_PAGE_ALLOC %e.\n", -E_NO_MEM);
-		return -E_NO_MEM;
-	}
 	if ((uint64_t)va >= UTOP || PGOFF(va))
 		return -E_INVAL;
 
@@ -227,16 +238,12 @@ sys_page_alloc(envid_t envid, void *va, int perm)
 		cprintf("sys_page_alloc(): permission error %e.\n", -E_INVAL);
 		return -E_INVAL;
 	}
-	// 在内核4级页表，建立页表页的映射及权限，映射物理页到虚拟地址 va, 页表项的权限(低12位)设置为 perm|PTE_P
-	if (page_insert(envnow->env_pml4e, pp, va, perm) < 0)
+	// 分配一个清零的物理页，在环境的4级页表中建立页表页的映射及权限，页表项的权限(低12位)设置为 perm|PTE_P
+	if (page_alloc_range(envnow->env_pml4e, (uintptr_t)va, PGSIZE, perm, ALLOC_ZERO) < 0)
 	{
 		cprintf("sys_page_alloc(): No memory to allocate page SYS_PAGE_ALLOC %e.\n", -E_NO_MEM);
-		// 内存不足则释放页结点回 page_free_list
-		page_free(pp);
 		return -E_NO_MEM;
 	}
-	// 将对应物理页清零
-	//memset(page2kva(pp), 0, PGSIZE);
 	return 0;
 }
 
@@ -274,8 +281,8 @@ sys_page_map(envid_t srcenvid, void *srcva, envid_t dstenvid, void *dstva, int p
 	// 检查页请求是否正确 (srcva 是否映射到 srcenvid 的地址空间)
 	struct PageInfo *map;
 	pte_t *p_entry;
-	// 在页式地址转换机制中查找 srcenv 4级页表的线性地址 srcva 所对应的物理页
-	map = page_lookup(srcenv->env_pml4e, srcva, &p_entry);
+	// 在页式地址转换机制中查找 srcenv 4级页表的线性地址 srcva 所对应的物理页，尚未调入的 VMA 页先调入
+	map = vma_page_lookup(srcenv, srcva, perm & PTE_W, &p_entry);
 	if (!map)
 	{
 		cprintf("\n No page available or not mapped properly SYS_PAGE_ALLOC %e \n", -E_NO_MEM);
@@ -385,8 +392,8 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
 			return -E_INVAL;
 		}
 		pte_t *entry;
-		// 在页式地址转换机制中查找线性地址srcva所对应的物理页结构PageInfo map
-		struct PageInfo *map = page_lookup(curenv->env_pml4e, srcva, &entry);
+		// 在页式地址转换机制中查找线性地址srcva所对应的物理页结构PageInfo map，尚未调入的 VMA 页先调入
+		struct PageInfo *map = vma_page_lookup(curenv, srcva, perm & PTE_W, &entry);
 		if (!(map) || ((perm & PTE_W) && !(*entry & PTE_W)))
 		{
 			cprintf("\n VA is not mapped in senders address space or Sending read only pages with write permissions not permissible\n");
@@ -405,6 +412,9 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
 	recvr->env_ipc_value = value;
 	// 发送进程置接收进程的进程状态为就绪态，让接收进程接收
 	recvr->env_status = ENV_RUNNABLE;
+	curenv->env_ru.ru_ipc_sent++;
+	recvr->env_ru.ru_ipc_recv++;
+	TRACE(TRACE_IPC_SEND, envid, value);
 	return 0;
 }
 
@@ -428,8 +438,10 @@ sys_ipc_recv(void *dstva)
 	}
 	// 目标线性地址
 	curenv->env_ipc_dstva = dstva;
+	TRACE(TRACE_IPC_RECV, dstva, 0);
 	// 阻塞态
 	curenv->env_status = ENV_NOT_RUNNABLE;
+	curenv->env_ru.ru_nvcsw++;
 	// RAX返回值
 	curenv->env_tf.tf_regs.reg_rax = 0;
 	// 让出CPU
@@ -437,6 +449,250 @@ sys_ipc_recv(void *dstva)
 	return 0;
 }
 
+/**
+ * 在磁盘 dev 上从扇区 secno 开始读写 nsecs 个扇区，数据位于当前环境虚拟地址 va 处的页
+ * 请求经由内核块缓存(kern/bio.c)：读命中时直接复制并返回 0；否则交给 IDE 驱动排队，
+ * 当前环境阻塞直到 IDE 中断完成传输，期间 CPU 可以运行其他环境，传输完成后系统调用返回 0 或 -E_IO
+ * va 必须页对齐且 nsecs 个扇区不超过一页；读磁盘时该页必须可写
+ * 错误时返回< 0。错误:
+ *   -E_BAD_ENV: 当前环境不是文件系统服务器
+ *   -E_INVAL: dev 不存在、va 不合法或扇区范围超出磁盘
+ *   -E_FAULT: 当前环境无权访问 va 处的页
+ *   -E_NO_MEM: 驱动的请求已用完
+ */
+static int
+sys_disk_io(int dev, uint64_t secno, void *va, size_t nsecs, int write)
+{
+	struct PageInfo *pp;
+	int r;
+
+	// 只有文件系统服务器可以直接访问磁盘
+	if (curenv->env_type != PROC_TYPE_FS)
+		return -E_BAD_ENV;
+	if ((uintptr_t)va >= UTOP || PGOFF(va) || nsecs == 0 || nsecs > PGSIZE / SECTSIZE)
+		return -E_INVAL;
+	// 按需调入该页(必要时触发写时分配)，然后检查权限
+	if (user_mem_check(curenv, va, nsecs * SECTSIZE, write ? PTE_U : PTE_U | PTE_W) < 0)
+		return -E_FAULT;
+	if (!(pp = page_lookup(curenv->env_pml4e, va, NULL)))
+		return -E_FAULT;
+	// 改写的扇区属于某个程序映像时，先让仍在运行的程序保留旧的内容
+	if (write)
+		image_invalidate(dev, secno, nsecs);
+	// 读命中内核块缓存时已复制完成，不需要阻塞
+	if ((r = bio_env_io(dev, secno, pp, nsecs, write, curenv->proc_id)) != 0)
+		return r < 0 ? r : 0;
+	// 阻塞态，由 IDE 中断设置返回值并唤醒
+	curenv->env_status = ENV_NOT_RUNNABLE;
+	curenv->env_ru.ru_nvcsw++;
+	curenv->env_tf.tf_regs.reg_rax = 0;
+	sched_yield();
+	return 0;
+}
+
+/**
+ * 为环境 envid 登记一段匿名的虚拟内存区域 [va, va+len)(VMA_ANON)，不分配物理页
+ * 环境首次访问其中某一页时才分配清零的物理页(只读访问映射共享零页)
+ * spawn 用它为子环境登记用户栈
+ * perm: PTE_U | PTE_P 必须置位，可选 PTE_W
+ *
+ * 成功返回0, 错误返回负的错误代码:
+ *  -E_BAD_ENV: envid 不存在, 或调用者没有修改 envid 环境的权限
+ *  -E_INVAL: va 没有页对齐、区域超出 UTOP 或 perm 不合法
+ *  -E_NO_MEM: 环境的 VMA 槽位已满
+ */
+static int
+sys_vma_alloc(envid_t envid, void *va, size_t len, int perm)
+{
+	struct Env *e;
+	int r;
+
+	if ((r = envid2env(envid, &e, 1)) < 0)
+		return r;
+	if (PGOFF(va) || len == 0 || (uintptr_t)va >= UTOP || len > UTOP - (uintptr_t)va)
+		return -E_INVAL;
+	if ((perm & (PTE_U | PTE_P)) != (PTE_U | PTE_P) || (perm & ~(PTE_U | PTE_P | PTE_W)))
+		return -E_INVAL;
+	return vma_add(e, VMA_ANON, (uintptr_t)va, len, perm, 0, 0);
+}
+
+/**
+ * 清空环境 envid 的所有 VMA
+ * sys_exofork() 创建的子环境继承了父环境的 VMA，spawn 为子环境装入另一个程序之前调用，
+ * 避免子环境访问未映射的页时按父环境的程序段填充
+ * 同时释放子环境继承的程序映像，其调试信息也一并清除
+ *
+ * 成功返回0, 错误返回 -E_BAD_ENV: envid 不存在, 或调用者没有修改 envid 环境的权限
+ */
+static int
+sys_vma_clear(envid_t envid)
+{
+	struct Env *e;
+	int r;
+
+	if ((r = envid2env(envid, &e, 1)) < 0)
+		return r;
+	vma_clear(e);
+	return 0;
+}
+
+/**
+ * 把设备 dev 上大小为 size 的程序文件设为环境 envid 的程序映像，替换其原来的映像
+ * secnos[i] 是文件第 i 页(PGSIZE 字节)在磁盘上的起始扇区
+ * spawn 通过文件系统服务器(FSREQ_EXEC)调用，之后用 sys_vma_binary() 登记程序段:
+ * 程序页在子环境首次访问时才经由内核块缓存读入，只读的页由运行同一文件的所有环境共享
+ * 环境保留映像，kdebug 和 prof 可以解析其调试信息
+ *
+ * 成功返回0, 错误返回负的错误代码:
+ *  -E_BAD_ENV: 当前环境不是文件系统服务器，envid 不存在或不处于 ENV_NOT_RUNNABLE
+ *  -E_INVAL: size 为0，dev 不存在或扇区超出磁盘
+ *  -E_FAULT: 当前环境无权访问 secnos
+ *  -E_NO_MEM: 映像缓存已满或内存不足
+ */
+static int
+sys_image_attach(envid_t envid, int dev, const uint64_t *secnos, size_t size)
+{
+	struct Env *e;
+	struct Image *im;
+	size_t i, npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+	int r;
+
+	// 扇区号决定子环境运行的代码，只能由文件系统服务器提供
+	if (curenv->env_type != PROC_TYPE_FS)
+		return -E_BAD_ENV;
+	if ((r = envid2env(envid, &e, 0)) < 0)
+		return r;
+	if (e->env_status != ENV_NOT_RUNNABLE)
+		return -E_BAD_ENV;
+	if (size == 0)
+		return -E_INVAL;
+	if (user_mem_check(curenv, secnos, npages * sizeof(uint64_t), PTE_U) < 0)
+		return -E_FAULT;
+	for (i = 0; i < npages; i++)
+		if (secnos[i] + PGSIZE / SECTSIZE < secnos[i] || secnos[i] + PGSIZE / SECTSIZE > ide_nsect(dev))
+			return -E_INVAL;
+	if (!(im = image_disk(dev, secnos, size)))
+		return -E_NO_MEM;
+	if (e->env_image)
+		image_release(e->env_image);
+	e->env_image = im;
+	return 0;
+}
+
+/**
+ * 为环境 envid 登记 ELF 程序段 *ph(VMA_BINARY)，内容来自 sys_image_attach() 设置的程序映像
+ * 不分配物理页，环境首次访问其中某一页时才填充；p_filesz 之后的部分(.bss)清零
+ * 只有 ELF_PROG_FLAG_WRITE 的程序段映射为可写
+ *
+ * 成功返回0, 错误返回负的错误代码:
+ *  -E_BAD_ENV: envid 不存在, 或调用者没有修改 envid 环境的权限
+ *  -E_FAULT: 当前环境无权访问 ph
+ *  -E_INVAL: envid 环境没有程序映像，程序段超出映像或 UTOP
+ *  -E_NO_MEM: 环境的 VMA 槽位已满
+ */
+static int
+sys_vma_binary(envid_t envid, const struct Proghdr *ph)
+{
+	struct Env *e;
+	struct Proghdr seg;
+	int r;
+
+	if ((r = envid2env(envid, &e, 1)) < 0)
+		return r;
+	if (user_mem_check(curenv, ph, sizeof(struct Proghdr), PTE_U) < 0)
+		return -E_FAULT;
+	seg = *ph;
+	return vma_add_segment(e, &seg);
+}
+
+/**
+ * 打开(enable != 0)或关闭内核跟踪；打开时先丢弃之前记录的事件
+ * 跟踪事件包含内核地址和其他环境的活动，只有特权环境可以使用
+ * 成功返回0，当前环境不是特权环境返回 -E_BAD_ENV
+ */
+static int
+sys_trace_ctl(int enable)
+{
+	if (curenv->env_type != PROC_TYPE_PRIV)
+		return -E_BAD_ENV;
+	if (enable)
+	{
+		trace_enable(0);
+		trace_clear();
+	}
+	trace_enable(enable != 0);
+	return 0;
+}
+
+/**
+ * 从 CPU cpu 的跟踪环形缓冲区读取序号 >= *seqp 的最多 n 个事件到 buf，并更新 *seqp
+ * 反复调用即可持续读取新事件(见 trace_read())
+ * 返回读取的事件数，错误返回:
+ *  -E_BAD_ENV: 当前环境不是特权环境
+ *  -E_INVAL: cpu 或 n 不合法
+ *  -E_FAULT: seqp 或 buf 不可写(环境被销毁)
+ */
+static int
+sys_trace_read(int cpu, uint64_t *seqp, struct TraceEvent *buf, int n)
+{
+	if (curenv->env_type != PROC_TYPE_PRIV)
+		return -E_BAD_ENV;
+	if (n < 0 || n > TRACE_NEVENTS)
+		return -E_INVAL;
+	user_mem_assert(curenv, seqp, sizeof(*seqp), PTE_U | PTE_W);
+	user_mem_assert(curenv, buf, n * sizeof(*buf), PTE_U | PTE_W);
+	return trace_read(cpu, seqp, buf, n);
+}
+
+/**
+ * 把环境 envid(0 表示当前环境)的资源使用统计复制到 ru
+ * 统计对所有环境公开，不检查权限
+ * 成功返回0，错误返回 -E_BAD_ENV: envid 不存在
+ */
+static int
+sys_getrusage(envid_t envid, struct Rusage *ru)
+{
+	struct Env *e;
+	int r;
+
+	if ((r = envid2env(envid, &e, 0)) < 0)
+		return r;
+	user_mem_assert(curenv, ru, sizeof(*ru), PTE_U | PTE_W);
+	*ru = e->env_ru;
+	// 当前环境本次陷入以来的内核态时间还没有计入
+	if (e == curenv)
+		ru->ru_stime += read_tsc() - thiscpu->cpu_mark_tsc;
+	return 0;
+}
+
+/**
+ * 在当前环境的性能计数器 idx 上选择事件 event(见 inc/pmu.h)，计数从0开始，event 为 0 时停止使用
+ * 计数器只统计用户态，环境可以用 rdpmc 直接读取(见 lib/pmu.c)
+ * 成功返回0，错误返回 pmu_config() 的错误: -E_NOT_SUPP, -E_INVAL
+ */
+static int
+sys_pmu_config(int idx, uint64_t event)
+{
+	return pmu_config(curenv, idx, event);
+}
+
+/**
+ * 返回第一个类型为 type 的环境的 envid(用于查找文件系统服务器等特殊环境)
+ * 只遍历已分配环境的链表 env_live，开销与存在的环境数有关，而不是 NENV
+ * 不存在时返回 -E_BAD_ENV
+ */
+static envid_t
+sys_env_find(int type)
+{
+	struct Env *e = env_live;
+	int i;
+
+	for (i = 0; i < env_nlive; i++, e = e->env_live_next)
+		if (e->env_type == type)
+			return e->proc_id;
+	return -E_BAD_ENV;
+}
+
 /**
  * syscall函数: 根据 syscallno 分派到对应的内核调用处理函数，并传递参数.
  * 参数:
@@ -447,6 +703,8 @@ sys_ipc_recv(void *dstva)
 int64_t
 syscall(uint64_t syscallno, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
 {
+	TRACE(TRACE_SYSCALL, syscallno, a1);
+	curenv->env_ru.ru_syscalls++;
 	// 调用对应于'syscallno'参数的函数. (0~12)
 	switch (syscallno)
 	{
@@ -479,6 +737,26 @@ syscall(uint64_t syscallno, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4,
 		return sys_ipc_recv((void *)a1);
 	case SYS_env_set_trapframe:
 		return sys_env_set_trapframe((envid_t)a1, (struct Trapframe *)a2);
+	case SYS_disk_io:
+		return sys_disk_io((int)a1, a2, (void *)a3, (size_t)a4, (int)a5);
+	case SYS_vma_alloc:
+		return sys_vma_alloc((envid_t)a1, (void *)a2, (size_t)a3, (int)a4);
+	case SYS_vma_clear:
+		return sys_vma_clear((envid_t)a1);
+	case SYS_trace_ctl:
+		return sys_trace_ctl((int)a1);
+	case SYS_trace_read:
+		return sys_trace_read((int)a1, (uint64_t *)a2, (struct TraceEvent *)a3, (int)a4);
+	case SYS_getrusage:
+		return sys_getrusage((envid_t)a1, (struct Rusage *)a2);
+	case SYS_pmu_config:
+		return sys_pmu_config((int)a1, a2);
+	case SYS_image_attach:
+		return sys_image_attach((envid_t)a1, (int)a2, (const uint64_t *)a3, (size_t)a4);
+	case SYS_vma_binary:
+		return sys_vma_binary((envid_t)a1, (const struct Proghdr *)a2);
+	case SYS_env_find:
+		return sys_env_find((int)a1);
 	default:
 		return -E_INVAL;
 	}
@@ -0,0 +1,112 @@
+/**
+ * 内核跟踪: 每个 CPU 一个固定大小的二进制事件环形缓冲区
+ * 只有所属的 CPU 向自己的环形缓冲区写入(内核中关中断，不会被同一 CPU 上的其他写者打断)，因此写入不需要加锁:
+ * 先写事件槽，再(编译器屏障之后)递增序号 tr_head
+ * 读者可以在任意 CPU 上读取，读取后再检查 tr_head，丢弃期间可能已被覆盖的事件
+ */
+#include "inc/x86.h"
+#include "inc/error.h"
+#include "inc/string.h"
+#include "inc/assert.h"
+
+#include "kern/trace.h"
+#include "kern/cpu.h"
+#include "kern/env.h"
+
+struct TraceRing
+{
+	// 已写入的事件总数，第 i 个事件位于 tr_events[i % TRACE_NEVENTS]
+	volatile uint64_t tr_head;
+	// trace_clear() 时的 tr_head，序号更早的事件视为已丢弃(只由读者使用，写者从不修改序号以外的状态)
+	volatile uint64_t tr_base;
+	struct TraceEvent tr_events[TRACE_NEVENTS];
+} __attribute__((aligned(64)));
+
+static struct TraceRing trace_rings[NCPU];
+
+volatile bool trace_enabled;
+
+/**
+ * 在当前 CPU 的环形缓冲区中记录一个事件，缓冲区满时覆盖最旧的事件
+ * 通过 TRACE() 调用
+ */
+void trace_event(int id, uint64_t a0, uint64_t a1)
+{
+	int cpu = cpunum();
+	struct TraceRing *tr = &trace_rings[cpu];
+	uint64_t head = tr->tr_head;
+	struct TraceEvent *ev = &tr->tr_events[head % TRACE_NEVENTS];
+
+	ev->te_tsc = read_tsc();
+	ev->te_cpu = cpu;
+	ev->te_id = id;
+	ev->te_envid = cpus[cpu].cpu_env ? cpus[cpu].cpu_env->proc_id : 0;
+	ev->te_args[0] = a0;
+	ev->te_args[1] = a1;
+	// 事件写完之后才发布
+	asm volatile("" ::: "memory");
+	tr->tr_head = head + 1;
+}
+
+// 打开或关闭跟踪
+void trace_enable(bool on)
+{
+	trace_enabled = on;
+}
+
+/**
+ * 丢弃所有 CPU 上已记录的事件
+ * 只把各环形缓冲区的 tr_base 推进到当前的 tr_head，不修改写者使用的 tr_head，
+ * 因此其他 CPU 可以同时写入事件
+ */
+void trace_clear(void)
+{
+	int i;
+
+	for (i = 0; i < NCPU; i++)
+		trace_rings[i].tr_base = trace_rings[i].tr_head;
+}
+
+/**
+ * 从 CPU cpu 的环形缓冲区读取序号 >= *seq 的最多 n 个事件到 buf
+ * *seq 早于缓冲区中最旧的事件时(已被覆盖或已被 trace_clear() 丢弃)，从最旧的事件开始读
+ * 返回读取的事件数，*seq 更新为下一个要读取的序号，因此可以反复调用以持续读取(流式读取)
+ * cpu 不合法返回 -E_INVAL
+ */
+int trace_read(int cpu, uint64_t *seq, struct TraceEvent *buf, int n)
+{
+	struct TraceRing *tr;
+	uint64_t head, start, oldest, i;
+
+	if (cpu < 0 || cpu >= NCPU || n < 0)
+		return -E_INVAL;
+	tr = &trace_rings[cpu];
+
+	head = tr->tr_head;
+	asm volatile("" ::: "memory");
+	start = MAX(*seq, tr->tr_base);
+	if (start > head)
+		start = head;
+	if (head - start > TRACE_NEVENTS)
+		start = head - TRACE_NEVENTS;
+	if (head - start > (uint64_t)n)
+		head = start + n;
+
+	for (i = start; i < head; i++)
+		buf[i - start] = tr->tr_events[i % TRACE_NEVENTS];
+
+	// 复制期间写者可能已覆盖了最前面的事件(序号 < oldest)，丢弃它们
+	// 写者正在写入的槽位(序号 tr_head)与序号 tr_head - TRACE_NEVENTS 的事件相同，也要丢弃
+	asm volatile("" ::: "memory");
+	oldest = tr->tr_head;
+	oldest = oldest >= TRACE_NEVENTS ? oldest - TRACE_NEVENTS + 1 : 0;
+	if (oldest > start)
+	{
+		if (oldest > head)
+			oldest = head;
+		memmove(buf, buf + (oldest - start), (head - oldest) * sizeof(*buf));
+		start = oldest;
+	}
+	*seq = head;
+	return head - start;
+}
@@ -0,0 +1,30 @@
+#ifndef ALVOS_KERN_TRACE_H
+#define ALVOS_KERN_TRACE_H
+#ifndef ALVOS_KERNEL
+# error "This is a AlvOS kernel header; user programs should not #include it"
+#endif
+
+#include "inc/trace.h"
+
+// 每个 CPU 的环形缓冲区中的事件数(2的幂)
+#define TRACE_NEVENTS 1024
+
+// 是否记录跟踪事件(默认关闭，由 trace_enable() 打开)
+extern volatile bool trace_enabled;
+
+void trace_event(int id, uint64_t a0, uint64_t a1);
+void trace_enable(bool on);
+void trace_clear(void);
+int trace_read(int cpu, uint64_t *seq, struct TraceEvent *buf, int n);
+
+/**
+ * 跟踪点: 关闭跟踪时只有一次判断的开销
+ */
+#define TRACE(id, a0, a1)                                             \
+	do                                                                \
+	{                                                                 \
+		if (trace_enabled)                                            \
+			trace_event((id), (uint64_t)(a0), (uint64_t)(a1));       \
+	} while (0)
+
+#endif
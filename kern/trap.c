@@ -12,6 +12,11 @@
 #include "kern/picirq.h"
 #include "kern/cpu.h"
 #include "kern/spinlock.h"
+#include "kern/vma.h"
+#include "kern/fpu.h"
+#include "kern/ide.h"
+#include "kern/trace.h"
+#include "kern/prof.h"
 
 extern uintptr_t gdtdesc_64;
 static struct Taskstate ts;
@@ -30,7 +35,10 @@ static struct Trapframe *last_tf;
 struct Gatedesc idt[256] = {{0}};
 struct Pseudodesc idt_pd = {0, 0};
 
-static const char *trapname(int trapno)
+// 每个 CPU 上各个中断向量发生的次数，只由所属的 CPU 在 trap() 中递增
+uint64_t trap_counts[NCPU][256];
+
+const char *trapname(int trapno)
 {
 	static const char *const excnames[] = {
 		"Divide error",					// 0.除法错误
@@ -163,7 +171,7 @@ void trap_init(void)
 	SETGATE(idt[T_OFLOW], interrupt, GD_KT, ALV_OFLOW, kern_dpl);
 	SETGATE(idt[T_BOUND], interrupt, GD_KT, ALV_BOUND, kern_dpl);
 	SETGATE(idt[T_ILLOP], interrupt, GD_KT, ALV_ILLOP, kern_dpl);
-	SETGATE(idt[T_DEVICE], trap, GD_KT, ALV_DEVICE, kern_dpl);
+	SETGATE(idt[T_DEVICE], interrupt, GD_KT, ALV_DEVICE, kern_dpl);
 	SETGATE(idt[T_DBLFLT], trap, GD_KT, ALV_DBLFLT, kern_dpl);
 	SETGATE(idt[T_TSS], trap, GD_KT, ALV_TSS, kern_dpl);
 	SETGATE(idt[T_SEGNP], trap, GD_KT, ALV_SEGNP, kern_dpl);
@@ -226,6 +234,9 @@ void trap_init_percpu(void)
 
 	// 4.加载 trap_init() 设置好的 IDT
 	lidt(&idt_pd);
+
+	// CPU 时间统计(监视器的 cpus 命令)从这里开始
+	thiscpu->cpu_start_tsc = read_tsc();
 }
 
 /**
@@ -308,8 +319,11 @@ trap_dispatch(struct Trapframe *tf)
 	// 处理时钟中断.
 	if (tf->tf_trapno == IRQ_OFFSET + IRQ_TIMER)
 	{
+		if (prof_enabled)
+			prof_sample(tf);
 		// 必须调用 lapic_eoi() 确认中断，才能 sched_yield() 调度环境
 		lapic_eoi();
+		thiscpu->cpu_preempted = 1;
 		sched_yield();
 		return;
 	}
@@ -325,6 +339,12 @@ trap_dispatch(struct Trapframe *tf)
 		serial_intr();
 		return;
 	}
+	// IDE 磁盘中断
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_IDE)
+	{
+		ide_intr();
+		return;
+	}
 
 	// 处理页错误中断
 	switch (tf->tf_trapno)
@@ -334,6 +354,11 @@ trap_dispatch(struct Trapframe *tf)
 		page_fault_handler(tf);
 		break;
 
+	// 设备不可用(CR0.TS 置位时使用 FPU): 惰性恢复环境的 FPU 状态
+	case T_DEVICE:
+		fpu_trap(tf);
+		break;
+
 	// 处理断点
 	case T_BRKPT:
 		// 切换到内核的监控器
@@ -389,13 +414,27 @@ void trap(struct Trapframe *tf)
 	if (panicstr)
 		asm volatile("hlt");
 
+	// 距离上一次进入用户态(env_run)或停机(sched_halt)的时间
+	struct CpuInfo *cpu = thiscpu;
+	uint64_t now = read_tsc(), delta = now - cpu->cpu_mark_tsc;
+
+	// 从这里到返回用户态的时间计为内核态时间(见 env_run())
+	cpu->cpu_mark_tsc = now;
+	trap_counts[cpu->cpu_id][tf->tf_trapno & 0xff]++;
+
 	// 如果在sched_yield()中停止，则重新获取大内核锁
-	if (xchg(&thiscpu->cpu_status, CPU_STARTED) == CPU_HALTED)
+	if (xchg(&cpu->cpu_status, CPU_STARTED) == CPU_HALTED)
+	{
+		cpu->cpu_idle_tsc += delta;
 		lock_kernel();
+	}
 
 	// 确保中断被禁用.
 	assert(!(read_eflags() & FL_IF));
 
+	// 跟踪点只写本 CPU 的环形缓冲区，不需要大内核锁
+	TRACE(TRACE_TRAP, tf->tf_trapno, tf->tf_rip);
+
 	// 如果从用户态陷入才需要将中断帧保存到环境的中断帧，并让中断帧指针忽略栈上TrapFrame.
 	// 但是此时RSP仍然指向栈中的中断帧入口
 	if ((tf->tf_cs & DPL_USER) == DPL_USER)
@@ -404,6 +443,8 @@ void trap(struct Trapframe *tf)
 		lock_kernel();
 		// 确保当前环境.
 		assert(curenv);
+		cpu->cpu_user_tsc += delta;
+		curenv->env_ru.ru_utime += delta;
 		// 如果当前环境是ENV_DYING 状态，则进行垃圾收集
 		if (curenv->env_status == ENV_DYING)
 		{
@@ -426,11 +467,17 @@ void trap(struct Trapframe *tf)
 	trap_dispatch(tf);
 
 	if (curenv && curenv->env_status == ENV_RUNNING)
+	{
+		TRACE(TRACE_TRAP_EXIT, tf->tf_trapno, curenv->proc_id);
 		// 恢复原环境
 		env_run(curenv);
+	}
 	else
+	{
+		TRACE(TRACE_TRAP_EXIT, tf->tf_trapno, 0);
 		// 否则进行环境调度
 		sched_yield();
+	}
 }
 
 /**
@@ -457,6 +504,7 @@ void page_fault_handler(struct Trapframe *tf)
 	// 并把导致页错误的线性地址保存到 CPU 中的 CR2 控制寄存器
 	// 为了找到页错误地址，读取 CR2 寄存器
 	fault_va = rcr2();
+	TRACE(TRACE_PGFAULT, fault_va, tf->tf_err);
 
 	// 处理内核态的页错误.
 	if (!(tf->tf_cs & 0x3))
@@ -467,6 +515,22 @@ void page_fault_handler(struct Trapframe *tf)
 	}
 
 	// 页错误发生在用户态中.
+	curenv->env_ru.ru_pgfaults++;
+
+	// 0.页不存在，或写访问共享的只读零页: 若 fault_va 位于环境的某个 VMA 中，
+	// 则按需分配、填充并映射该页，返回用户态重新执行出错的指令
+	if ((!(tf->tf_err & FEC_PR) || (tf->tf_err & FEC_WR)) &&
+		vma_fault(curenv, fault_va, tf->tf_err & FEC_WR) == 0)
+	{
+		// 写访问已映射的页只可能是替换零页
+		if (tf->tf_err & FEC_PR)
+			curenv->env_ru.ru_cow++;
+		return;
+	}
+
+	// 交给用户态处理的写保护错误是 fork() 的写时复制
+	if ((tf->tf_err & (FEC_PR | FEC_WR)) == (FEC_PR | FEC_WR))
+		curenv->env_ru.ru_cow++;
 
 	// 1.检测是否为页错误(已设置了页错误处理函数入口)
 	if (curenv->env_pgfault_upcall)
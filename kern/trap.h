@@ -10,9 +10,12 @@
 /* 内核的 IDT(interrupt descriptor table) */
 extern struct Gatedesc idt[];
 extern struct Pseudodesc idt_pd;
+// 每个 CPU 上各个中断向量发生的次数
+extern uint64_t trap_counts[][256];
 
 void trap_init(void);
 void trap_init_percpu(void);
+const char *trapname(int trapno);
 void print_regs(struct PushRegs *regs);
 void print_trapframe(struct Trapframe *tf);
 void page_fault_handler(struct Trapframe *);
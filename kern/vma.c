@@ -0,0 +1,195 @@
+/**
+ * 按需调页的虚拟内存区域(VMA)
+ * load_icode() 只为 ELF 的程序段、.bss 和用户栈登记 VMA，并不分配物理页
+ * 环境首次访问 VMA 中某一页时触发页错误(页不存在)，由 vma_fault() 分配物理页、按 VMA 填充内容并映射
+ * 对匿名内存的读访问只映射全局共享的只读零页，首次写访问时才分配私有的物理页
+ * 只读程序段的页直接映射程序映像缓存(kern/image.c)中的物理页，由同一映像创建的环境共享
+ */
+#include "inc/mmu.h"
+#include "inc/error.h"
+#include "inc/string.h"
+#include "inc/assert.h"
+#include "inc/elf.h"
+
+#include "kern/vma.h"
+#include "kern/env.h"
+#include "kern/pmap.h"
+#include "kern/image.h"
+
+// 全局共享的只读零页: 对匿名内存的读访问都映射到这一个物理页，首次写访问时才替换为私有的物理页
+static struct PageInfo *zero_page;
+
+/**
+ * 分配全局共享的零页，在 x64_vm_init() 之后调用
+ * 多持有一次引用，因此即使所有映射都被取消，零页也不会被释放
+ */
+void vma_init(void)
+{
+	if (!(zero_page = page_alloc(ALLOC_ZERO)))
+		panic("vma_init: no memory for the zero page");
+	zero_page->pp_ref++;
+	// 零页被所有环境的匿名内存共享，不记录反向映射
+	page_rmap_untrack(zero_page);
+}
+
+/**
+ * 为环境 e 登记一段虚拟内存区域 [va, va+len)(起止地址按页对齐扩展)
+ * type: VMA_ANON 或 VMA_BINARY；VMA_BINARY 的 [va, va+filesz) 的内容来自 e->env_image 中从 off 开始的部分
+ * 成功返回0，VMA 槽位已满返回 -E_NO_MEM
+ */
+int vma_add(struct Env *e, int type, uintptr_t va, size_t len, int perm,
+			size_t off, size_t filesz)
+{
+	struct Vma *vma;
+
+	for (vma = e->env_vmas; vma < e->env_vmas + NVMA; vma++)
+	{
+		if (vma->vma_type != VMA_UNUSED)
+			continue;
+		vma->vma_type = type;
+		vma->vma_perm = perm | PTE_U | PTE_P;
+		vma->vma_start = ROUNDDOWN(va, PGSIZE);
+		vma->vma_end = ROUNDUP(va + len, PGSIZE);
+		vma->vma_va = va;
+		vma->vma_off = off;
+		vma->vma_filesz = (type == VMA_BINARY) ? filesz : 0;
+		return 0;
+	}
+	return -E_NO_MEM;
+}
+
+/**
+ * 为环境 e 登记 ELF 程序段 ph(load_icode() 和 spawn 的 sys_vma_binary() 使用)
+ * 前 p_filesz 字节来自程序映像 e->env_image 中 p_offset 处，其余(.bss)清零；
+ * 只有可写的程序段(.data/.bss)映射为可写，代码段和只读数据段映射为只读
+ * 成功返回0(p_memsz 为0时什么也不做)；环境没有程序映像、程序段超出映像或用户地址空间返回 -E_INVAL；
+ * VMA 槽位已满返回 -E_NO_MEM
+ */
+int vma_add_segment(struct Env *e, const struct Proghdr *ph)
+{
+	struct Image *im = e->env_image;
+	int perm = PTE_U | PTE_P;
+
+	if (ph->p_memsz == 0)
+		return 0;
+	if (!im || ph->p_filesz > ph->p_memsz || ph->p_va >= UTOP || ph->p_memsz > UTOP - ph->p_va ||
+		ph->p_offset > im->im_size || ph->p_filesz > im->im_size - ph->p_offset)
+		return -E_INVAL;
+	if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+		perm |= PTE_W;
+	return vma_add(e, VMA_BINARY, ph->p_va, ph->p_memsz, perm, ph->p_offset, ph->p_filesz);
+}
+
+/**
+ * 查找环境 e 中包含虚拟地址 va 的 VMA，不存在则返回 NULL
+ */
+struct Vma *
+vma_lookup(struct Env *e, uintptr_t va)
+{
+	struct Vma *vma;
+
+	for (vma = e->env_vmas; vma < e->env_vmas + NVMA; vma++)
+		if (vma->vma_type != VMA_UNUSED && va >= vma->vma_start && va < vma->vma_end)
+			return vma;
+	return NULL;
+}
+
+/**
+ * 处理环境 e 在虚拟地址 va 上的页错误，va 必须位于某个 VMA 中(写访问还要求 VMA 可写)
+ * 1.页不存在且为读访问，该页没有文件内容(匿名内存/.bss): 只读映射全局零页，不分配也不清零物理页
+ * 2.只读的 VMA_BINARY 中直到页尾都是文件内容的页: 映射程序映像缓存的物理页，与同一映像的其他环境共享
+ *   (文件偏移与虚拟地址页内对齐时，该页在程序段之前的部分也是文件中的内容，与 ELF 的常规装载方式相同)
+ * 3.其他情况，或写访问映射着零页的页: 分配清零的物理页，
+ *   VMA_BINARY 再从程序映像复制与该页相交的文件部分，最后按 VMA 的权限映射(类似写时复制替换零页)
+ * 物理页通过内核地址填充，因此不需要切换到环境的地址空间
+ * 
+ * 成功返回0；va 不在任何 VMA 中、权限不符或页已映射(不是零页)返回 -E_FAULT；内存不足返回 -E_NO_MEM
+ */
+int vma_fault(struct Env *e, uintptr_t va, int write)
+{
+	struct Vma *vma = vma_lookup(e, va);
+	struct PageInfo *pp;
+	pte_t *pt_entry;
+	uintptr_t page = ROUNDDOWN(va, PGSIZE);
+	// 该页与文件部分 [vma_va, vma_va + vma_filesz) 的交集
+	uintptr_t lo, hi;
+	int64_t fileoff;
+	int r;
+
+	if (!vma || (write && !(vma->vma_perm & PTE_W)))
+		return -E_FAULT;
+	// 页已存在: 只有对零页的写访问需要处理
+	if ((pp = page_lookup(e->env_pml4e, (void *)page, &pt_entry)) && (pp != zero_page || !write))
+		return -E_FAULT;
+
+	lo = MAX(page, vma->vma_va);
+	hi = MIN(page + PGSIZE, vma->vma_va + vma->vma_filesz);
+
+	// 读访问没有文件内容的页: 映射只读零页(pp_ref 是16位，引用过多时退回到分配私有页)
+	if (!write && lo >= hi && zero_page->pp_ref < 0xff00)
+		return page_insert(e->env_pml4e, zero_page, (void *)page, vma->vma_perm & ~PTE_W);
+
+	// 该页页首对应的文件偏移(页首在程序段之前时可能为负)
+	fileoff = (int64_t)vma->vma_off + (int64_t)(page - vma->vma_va);
+	if (vma->vma_type == VMA_BINARY && !(vma->vma_perm & PTE_W) && hi == page + PGSIZE &&
+		fileoff >= 0 && PGOFF(fileoff) == 0 &&
+		(pp = image_page(e->env_image, fileoff / PGSIZE)) && pp->pp_ref < 0xff00)
+		return page_insert(e->env_pml4e, pp, (void *)page, vma->vma_perm);
+
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+		return -E_NO_MEM;
+	if (lo < hi && (r = image_read(e->env_image, vma->vma_off + (lo - vma->vma_va),
+								   (uint8_t *)page2kva(pp) + (lo - page), hi - lo)) < 0)
+	{
+		page_free(pp);
+		return r;
+	}
+
+	// page_insert() 同时取消原来的零页映射
+	if (page_insert(e->env_pml4e, pp, (void *)page, vma->vma_perm) < 0)
+	{
+		page_free(pp);
+		return -E_NO_MEM;
+	}
+	return 0;
+}
+
+/**
+ * 查找环境 e 中 va 处映射的物理页，语义同 page_lookup()
+ * 页尚未调入，或 write 时映射的是只读零页，先按 VMA 调入(sys_page_map、sys_ipc_try_send 等以页为参数的系统调用使用)
+ * va 不在可访问的 VMA 中时与 page_lookup() 的结果相同
+ */
+struct PageInfo *
+vma_page_lookup(struct Env *e, void *va, int write, pte_t **pte_store)
+{
+	pte_t *pt_entry;
+	struct PageInfo *pp = page_lookup(e->env_pml4e, va, &pt_entry);
+
+	if ((!pp || (write && !(*pt_entry & PTE_W))) && vma_fault(e, (uintptr_t)va, write) == 0)
+		pp = page_lookup(e->env_pml4e, va, &pt_entry);
+	if (pp && pte_store)
+		*pte_store = pt_entry;
+	return pp;
+}
+
+/**
+ * 子环境继承父环境的 VMA 和程序映像(sys_exofork 调用)
+ * 父环境中尚未访问过的页在子环境中同样按需调页，其内容与父环境一致
+ */
+void vma_copy(struct Env *dst, struct Env *src)
+{
+	memmove(dst->env_vmas, src->env_vmas, sizeof(dst->env_vmas));
+	if ((dst->env_image = src->env_image))
+		image_hold(dst->env_image);
+}
+
+/**
+ * 清空环境 e 的所有 VMA，并释放其程序映像
+ */
+void vma_clear(struct Env *e)
+{
+	memset(e->env_vmas, 0, sizeof(e->env_vmas));
+	if (e->env_image)
+		image_release(e->env_image);
+	e->env_image = NULL;
+}
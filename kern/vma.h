@@ -0,0 +1,21 @@
+#ifndef ALVOS_KERN_VMA_H
+#define ALVOS_KERN_VMA_H
+#ifndef ALVOS_KERNEL
+# error "This is a AlvOS kernel header; user programs should not #include it"
+#endif
+
+#include "inc/env.h"
+
+struct Proghdr;
+
+void vma_init(void);
+int vma_add(struct Env *e, int type, uintptr_t va, size_t len, int perm,
+			size_t off, size_t filesz);
+int vma_add_segment(struct Env *e, const struct Proghdr *ph);
+struct Vma *vma_lookup(struct Env *e, uintptr_t va);
+int vma_fault(struct Env *e, uintptr_t va, int write);
+struct PageInfo *vma_page_lookup(struct Env *e, void *va, int write, pte_t **pte_store);
+void vma_copy(struct Env *dst, struct Env *src);
+void vma_clear(struct Env *e);
+
+#endif
@@ -3,6 +3,6 @@
 void
 exit(void)
 {
+	close_all();
 	sys_env_destroy(0);
 }
-
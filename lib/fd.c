@@ -0,0 +1,298 @@
+// 类 posix 文件描述符仿真层
+
+#include "inc/lib.h"
+
+#define debug 0
+
+// 文件描述符的最大数量
+#define MAXFD 32
+// 文件描述符表从 FDTABLE 开始，每个 Fd 占一页
+#define FDTABLE 0xD0000000UL
+// 每个文件描述符对应的数据窗口从 FILEDATA 开始，每个窗口 FILEWINDOW 字节
+#define FILEDATA (FDTABLE + MAXFD * PGSIZE)
+
+// 返回第 i 个文件描述符的 Fd 页
+#define INDEX2FD(i) ((struct Fd *)(FDTABLE + (i) * PGSIZE))
+// 返回第 i 个文件描述符的数据窗口
+#define INDEX2DATA(i) ((char *)(FILEDATA + (i) * FILEWINDOW))
+
+/* ------------------------------- 文件描述符 ------------------------------- */
+
+// 返回 fd 的文件描述符号
+uint64_t
+fd2num(struct Fd *fd)
+{
+	return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+}
+
+// 返回 fd 的数据窗口
+char *
+fd2data(struct Fd *fd)
+{
+	return INDEX2DATA(fd2num(fd));
+}
+
+/**
+ * 找到编号最小的未使用的文件描述符(其 Fd 页未映射)，存入 *fd_store，但不分配 Fd 页
+ * 调用者需要在其上分配一个页面，否则该文件描述符不会被使用
+ * 所有文件描述符都已使用时返回 -E_MAX_OPEN，*fd_store 为 0
+ */
+int fd_alloc(struct Fd **fd_store)
+{
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++)
+	{
+		fd = INDEX2FD(i);
+		if (pageref(fd) == 0)
+		{
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+}
+
+/**
+ * 检查 fdnum 是否在范围内且已映射，是则 *fd_store 为对应的 Fd 页
+ * 否则返回 -E_INVAL
+ */
+int fd_lookup(int fdnum, struct Fd **fd_store)
+{
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD)
+	{
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisproc->proc_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+	if (pageref(fd) == 0)
+	{
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisproc->proc_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+	return 0;
+}
+
+/**
+ * 关闭文件描述符 fd 并释放其 Fd 页
+ * must_exist 为 0 时，fd 不是有效的打开文件描述符则直接返回 0；否则返回 fd_lookup 的错误
+ */
+int fd_close(struct Fd *fd, bool must_exist)
+{
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+		return (must_exist ? r : 0);
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0)
+	{
+		if (dev->dev_close)
+			r = (*dev->dev_close)(fd);
+		else
+			r = 0;
+	}
+	// 此时 fd 可能已被设备释放，再次释放是安全的
+	(void)sys_page_unmap(0, fd);
+	return r;
+}
+
+/* ------------------------------- 设备 ------------------------------- */
+
+static struct Dev *devtab[] =
+	{
+		&devfile,
+		0};
+
+int dev_lookup(int dev_id, struct Dev **dev)
+{
+	int i;
+
+	for (i = 0; devtab[i]; i++)
+		if (devtab[i]->dev_id == dev_id)
+		{
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisproc->proc_id, dev_id);
+	*dev = 0;
+	return -E_INVAL;
+}
+
+int close(int fdnum)
+{
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+
+void close_all(void)
+{
+	int i;
+
+	for (i = 0; i < MAXFD; i++)
+		close(i);
+}
+
+/**
+ * 将 oldfdnum 复制为 newfdnum(先关闭 newfdnum)
+ * 复制的两个文件描述符共享 Fd 页和数据窗口
+ */
+int dup(int oldfdnum, int newfdnum)
+{
+	int r;
+	char *ova, *nva;
+	uintptr_t off;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+		return r;
+	close(newfdnum);
+
+	newfd = INDEX2FD(newfdnum);
+	ova = fd2data(oldfd);
+	nva = fd2data(newfd);
+
+	for (off = 0; off < FILEWINDOW; off += PGSIZE)
+		if (va_is_mapped(ova + off))
+			if ((r = sys_page_map(0, ova + off, 0, nva + off,
+								  uvpt[VPN(ova + off)] & PTE_SYSCALL)) < 0)
+				goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[VPN(oldfd)] & PTE_SYSCALL)) < 0)
+		goto err;
+
+	return newfdnum;
+
+err:
+	sys_page_unmap(0, newfd);
+	for (off = 0; off < FILEWINDOW; off += PGSIZE)
+		if (va_is_mapped(nva + off))
+			sys_page_unmap(0, nva + off);
+	return r;
+}
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+	{
+		cprintf("[%08x] read %d -- bad mode\n", thisproc->proc_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+}
+
+// 读满 n 字节，或遇到文件末尾/错误为止
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m)
+	{
+		m = read(fdnum, (char *)buf + tot, n - tot);
+		if (m < 0)
+			return m;
+		if (m == 0)
+			break;
+	}
+	return tot;
+}
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+	{
+		cprintf("[%08x] write %d -- bad mode\n", thisproc->proc_id, fdnum);
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+				fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+}
+
+int seek(int fdnum, off_t offset)
+{
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+		return r;
+	fd->fd_offset = offset;
+	return 0;
+}
+
+int ftruncate(int fdnum, off_t newsize)
+{
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+	{
+		cprintf("[%08x] ftruncate %d -- bad mode\n", thisproc->proc_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+}
+
+int fstat(int fdnum, struct Stat *stat)
+{
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+		return r;
+	if (!dev->dev_stat)
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+	stat->st_size = 0;
+	stat->st_isdir = 0;
+	stat->st_dev = dev;
+	return (*dev->dev_stat)(fd, stat);
+}
+
+int stat(const char *path, struct Stat *stat)
+{
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+		return fd;
+	r = fstat(fd, stat);
+	close(fd);
+	return r;
+}
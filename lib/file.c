@@ -0,0 +1,236 @@
+// 普通文件：通过 IPC 请求文件系统服务器
+
+#include "inc/fs.h"
+#include "inc/string.h"
+#include "inc/lib.h"
+
+#define debug 0
+
+// 与文件系统服务器交换请求参数的页
+union Fsipc fsipcbuf __attribute__((aligned(PGSIZE)));
+
+/**
+ * 向文件系统服务器发送请求 type(参数在 fsipcbuf 中)并等待应答
+ * dstva 非空时，服务器返回的页映射到 dstva
+ * 返回服务器的结果
+ */
+static int
+fsipc(unsigned type, void *dstva)
+{
+	static envid_t fsenv;
+
+	if (fsenv == 0)
+		fsenv = ipc_find_env(PROC_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisproc->proc_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return ipc_recv(NULL, dstva, NULL);
+}
+
+static int devfile_flush(struct Fd *fd);
+static ssize_t devfile_read(struct Fd *fd, void *buf, size_t n);
+static ssize_t devfile_write(struct Fd *fd, const void *buf, size_t n);
+static int devfile_stat(struct Fd *fd, struct Stat *stat);
+static int devfile_trunc(struct Fd *fd, off_t newsize);
+
+struct Dev devfile =
+	{
+		.dev_id = 'f',
+		.dev_name = "file",
+		.dev_read = devfile_read,
+		.dev_close = devfile_flush,
+		.dev_stat = devfile_stat,
+		.dev_write = devfile_write,
+		.dev_trunc = devfile_trunc};
+
+/**
+ * 以 mode 打开文件 path
+ * 返回文件描述符号，错误时返回 < 0:
+ *   -E_BAD_PATH: 路径太长
+ *   -E_MAX_OPEN: 文件描述符已用完
+ *   以及服务器返回的错误
+ */
+int open(const char *path, int mode)
+{
+	struct Fd *fd;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+		return -E_BAD_PATH;
+
+	if ((r = fd_alloc(&fd)) < 0)
+		return r;
+
+	strcpy(fsipcbuf.open.req_path, path);
+	fsipcbuf.open.req_omode = mode;
+
+	// 服务器返回的 Fd 页映射到 fd
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0)
+	{
+		fd_close(fd, 0);
+		return r;
+	}
+
+	return fd2num(fd);
+}
+
+/**
+ * 把打开的程序文件 fdnum 设为子环境 child 的程序映像，供 spawn 使用
+ * 之后用 sys_vma_binary() 登记的程序段由内核按需从该文件填充
+ * 错误时返回 < 0: fdnum 不是打开的普通文件，或服务器返回的错误
+ */
+int fexec(int fdnum, envid_t child)
+{
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+		return -E_INVAL;
+	fsipcbuf.exec.req_fileid = fd->fd_file.id;
+	fsipcbuf.exec.req_envid = child;
+	return fsipc(FSREQ_EXEC, NULL);
+}
+
+// 解除 fd 的数据窗口中 [from, FILEWINDOW) 的块缓存页映射
+static void
+devfile_unmap(struct Fd *fd, off_t from)
+{
+	char *va = fd2data(fd);
+	uintptr_t off;
+
+	for (off = ROUNDUP(from, PGSIZE); off < FILEWINDOW; off += PGSIZE)
+		if (va_is_mapped(va + off))
+			sys_page_unmap(0, va + off);
+}
+
+/**
+ * 关闭文件时由 fd_close 调用：解除数据窗口的映射，并请求服务器将文件写回磁盘
+ * 服务器在 Fd 页的引用计数降为 1 时回收 OpenFile
+ */
+static int
+devfile_flush(struct Fd *fd)
+{
+	devfile_unmap(fd, 0);
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+	return fsipc(FSREQ_FLUSH, NULL);
+}
+
+/**
+ * 确保文件 offset(BLKSIZE 对齐)处的块已映射在 fd 的数据窗口中
+ * 未映射时请求服务器把块缓存页共享过来(FSREQ_MAP)
+ */
+static int
+devfile_map(struct Fd *fd, off_t offset)
+{
+	char *va = fd2data(fd) + offset;
+
+	if (va_is_mapped(va))
+		return 0;
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+	fsipcbuf.map.req_offset = offset;
+	return fsipc(FSREQ_MAP, va);
+}
+
+/**
+ * 从当前偏移读取最多 n 字节到 buf
+ * 文件块通过服务器共享的块缓存页直接映射在数据窗口中，只有首次访问某块时需要一次 IPC，
+ * 数据不经过 IPC 请求页复制
+ * 返回读取的字节数
+ */
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+	char *va = fd2data(fd);
+	off_t pos = fd->fd_offset, end;
+	size_t m;
+	int r;
+
+	if (pos >= fd->fd_file.size)
+		return 0;
+	end = MIN(pos + (off_t)n, fd->fd_file.size);
+	n = end - pos;
+
+	while (pos < end)
+	{
+		if ((r = devfile_map(fd, ROUNDDOWN(pos, BLKSIZE))) < 0)
+			return r;
+		m = MIN(end - pos, BLKSIZE - pos % BLKSIZE);
+		memmove(buf, va + pos, m);
+		buf += m;
+		pos += m;
+	}
+	fd->fd_offset = pos;
+	return n;
+}
+
+/**
+ * 将 buf 中最多 n 字节写到当前偏移，数据经由请求页交给服务器
+ * 服务器写入的就是客户端映射的块缓存页，因此已映射的块无需重新映射
+ * 返回写入的字节数
+ */
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+	size_t m, tot = 0;
+	int r;
+
+	while (tot < n)
+	{
+		m = MIN(n - tot, sizeof(fsipcbuf.write.req_buf));
+		fsipcbuf.write.req_fileid = fd->fd_file.id;
+		fsipcbuf.write.req_n = m;
+		memmove(fsipcbuf.write.req_buf, buf + tot, m);
+		if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+			return r;
+		assert(r <= m);
+		tot += r;
+		if (r < m)
+			break;
+	}
+	return tot;
+}
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+		return r;
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+	st->st_size = fsipcbuf.statRet.ret_size;
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+	return 0;
+}
+
+// 截断或扩展文件，截断时解除新大小之外的块的映射(这些块可能被服务器释放并重新分配)
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+	fsipcbuf.set_size.req_size = newsize;
+	devfile_unmap(fd, newsize);
+	return fsipc(FSREQ_SET_SIZE, NULL);
+}
+
+// 删除文件
+int remove(const char *path)
+{
+	if (strlen(path) >= MAXPATHLEN)
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+	return fsipc(FSREQ_REMOVE, NULL);
+}
+
+// 将文件系统的所有修改写回磁盘
+int sync(void)
+{
+	return fsipc(FSREQ_SYNC, NULL);
+}
@@ -76,12 +76,11 @@ ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
 // Find the first environment of the given type.  We'll use this to
 // find special environments.
 // Returns 0 if no such environment exists.
+// 内核只遍历已分配的环境(env_live)，不扫描整个 procs[]
 envid_t
 ipc_find_env(enum EnvType type)
 {
-	int i;
-	for (i = 0; i < NENV; i++)
-		if (procs[i].env_type == type)
-			return procs[i].proc_id;
-	return 0;
+	envid_t r = sys_env_find(type);
+
+	return r < 0 ? 0 : r;
 }
@@ -16,6 +16,9 @@ void libmain(int argc, char **argv)
 	// thisproc 指向当前环境的 Env 结构
 	thisproc = &procs[ENVX(sys_getprocid())];
 
+	// 通过 CPUID 选择 memset/memmove/memcpy 的实现
+	mem_init();
+
 	// 为了能让panic()提示用户错误，存储程序的名称
 	if (argc > 0)
 		binaryname = argv[0];
@@ -0,0 +1,19 @@
+#include "inc/lib.h"
+
+/**
+ * 虚拟地址 va 是否已映射
+ * 逐级检查页表，避免访问不存在的页表页
+ */
+bool va_is_mapped(void *va)
+{
+	return (uvpml4e[VPML4E(va)] & PTE_P) && (uvpde[VPDPE(va)] & PTE_P) &&
+		   (uvpd[VPD(va)] & PTE_P) && (uvpt[VPN(va)] & PTE_P);
+}
+
+// 返回虚拟地址 v 所在物理页的引用计数，v 未映射时返回 0
+int pageref(void *v)
+{
+	if (!va_is_mapped(v))
+		return 0;
+	return pages[PPN(PTE_ADDR(uvpt[VPN(v)]))].pp_ref;
+}
@@ -0,0 +1,36 @@
+// 按环境虚拟化的性能计数器的用户态接口(见 kern/pmu.c)
+
+#include "inc/lib.h"
+#include "inc/x86.h"
+
+/**
+ * 在计数器 idx 上开始统计事件 event(见 inc/pmu.h)，计数从0开始；event 为 0 时停止
+ */
+int pmu_open(int idx, uint64_t event)
+{
+	return sys_pmu_config(idx, event);
+}
+
+/**
+ * 读取计数器 idx 的当前值，不需要陷入内核
+ * 值 = 内核在环境换出时累加的 env_pmu_count[idx] + 硬件计数器(每次换入时清零)
+ * 每次返回用户态内核都会递增 env_runs，前后两次读到的 env_runs 相同说明两部分是一致的
+ * 计数器未启用时返回0
+ */
+uint64_t
+pmu_read(int idx)
+{
+	uint32_t runs;
+	uint64_t v;
+
+	if (idx < 0 || idx >= PMU_NCOUNTERS)
+		return 0;
+	do
+	{
+		runs = thisproc->env_runs;
+		if (!thisproc->env_pmu_evtsel[idx])
+			return 0;
+		v = thisproc->env_pmu_count[idx] + rdpmc(idx);
+	} while (thisproc->env_runs != runs);
+	return v;
+}
@@ -0,0 +1,218 @@
+// 从文件系统装入并运行用户程序
+
+#include "inc/lib.h"
+#include "inc/elf.h"
+
+// init_stack() 在 UTEMP 构造子环境的初始栈页，该页最终映射在子环境的 USTACKTOP - PGSIZE
+#define UTEMP2USTACK(addr) ((uintptr_t)(addr) + (USTACKTOP - PGSIZE) - (uintptr_t)UTEMP)
+
+// 读取 ELF 头部和程序头表的缓冲区大小
+#define ELFHDRSIZE 512
+
+static int init_stack(envid_t child, const char **argv, uintptr_t *init_rsp);
+static int map_segment(envid_t child, struct Proghdr *ph);
+static int copy_shared_pages(envid_t child);
+
+/**
+ * 从文件系统装入程序 prog，以参数 argv 创建并运行子环境
+ * 1.读取 ELF 头部，调用 sys_exofork() 创建子环境，清空其从父环境继承的 VMA，
+ *   再请求文件系统服务器把程序文件设为子环境的程序映像(fexec)
+ * 2.构造子环境的初始栈(argc/argv)
+ * 3.按程序头登记各程序段(map_segment)，不读取文件内容: 子环境首次访问某页时由内核从程序映像填充，
+ *   只读的页(.text/.rodata)由运行同一文件的所有环境共享，可写的页(.data)复制，.bss 清零
+ * 程序映像留在子环境上，backtrace/prof 可以解析其用户态符号
+ * 4.与子环境共享 PTE_SHARE 的页(打开的文件描述符)，设置寄存器并标记为 ENV_RUNNABLE
+ * 成功返回子环境的 envid，错误返回 < 0
+ */
+envid_t
+spawn(const char *prog, const char **argv)
+{
+	uint8_t elf_buf[ELFHDRSIZE];
+	struct Elf *elf = (struct Elf *)elf_buf;
+	struct Proghdr *ph;
+	struct Trapframe child_tf;
+	uintptr_t rsp;
+	envid_t child;
+	int fd, i, r;
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+		return r;
+	fd = r;
+
+	// 读取 ELF 头部，程序头表必须也在其中
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf) ||
+		elf->e_magic != ELF_MAGIC ||
+		elf->e_phoff + elf->e_phnum * sizeof(struct Proghdr) > sizeof(elf_buf))
+	{
+		close(fd);
+		cprintf("spawn: %s is not a valid ELF\n", prog);
+		return -E_NOT_EXEC;
+	}
+
+	if ((r = sys_exofork()) < 0)
+	{
+		close(fd);
+		return r;
+	}
+	child = r;
+
+	// 子环境继承了父环境的 VMA，装入新程序之前清空
+	if ((r = sys_vma_clear(child)) < 0 || (r = fexec(fd, child)) < 0)
+		goto error;
+
+	child_tf = procs[ENVX(child)].env_tf;
+	child_tf.tf_rip = elf->e_entry;
+	if ((r = init_stack(child, argv, &rsp)) < 0)
+		goto error;
+	child_tf.tf_rsp = rsp;
+
+	ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+	for (i = 0; i < elf->e_phnum; i++, ph++)
+		if (ph->p_type == ELF_PROG_LOAD && (r = map_segment(child, ph)) < 0)
+			goto error;
+	// 内核持有程序映像，之后改写程序文件时内核先为子环境保留旧的内容，不再需要 fd
+	close(fd);
+	fd = -1;
+
+	if ((r = copy_shared_pages(child)) < 0)
+		panic("copy_shared_pages: %e", r);
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+		panic("sys_env_set_trapframe: %e", r);
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+		panic("sys_env_set_status: %e", r);
+
+	return child;
+
+error:
+	sys_env_destroy(child);
+	if (fd >= 0)
+		close(fd);
+	return r;
+}
+
+/**
+ * 以可变参数调用 spawn，参数列表以 NULL 结尾
+ */
+envid_t
+spawnl(const char *prog, const char *arg0, ...)
+{
+	int argc = 0;
+	va_list vl;
+
+	// 统计参数个数，然后在栈上构造 argv 数组
+	va_start(vl, arg0);
+	while (va_arg(vl, void *) != NULL)
+		argc++;
+	va_end(vl);
+
+	const char *argv[argc + 2];
+	unsigned i;
+
+	argv[0] = arg0;
+	argv[argc + 1] = NULL;
+	va_start(vl, arg0);
+	for (i = 0; i < argc; i++)
+		argv[i + 1] = va_arg(vl, const char *);
+	va_end(vl);
+	return spawn(prog, argv);
+}
+
+/**
+ * 构造子环境的初始栈页，并把其中的 argv 字符串指针转换为子环境中的地址
+ * 栈页布局(从高到低): 参数字符串、argv[argc] = NULL ... argv[0]、argv 指针、argc
+ * lib/entry.S 发现 %rsp != USTACKTOP 时从栈上取出 argc 和 argv
+ * 栈页之下再登记一页匿名区域，与内核创建的环境一样共有两页初始栈
+ * 成功时 *init_rsp 为子环境的初始 %rsp
+ */
+static int
+init_stack(envid_t child, const char **argv, uintptr_t *init_rsp)
+{
+	size_t string_size;
+	int argc, i, r;
+	char *string_store;
+	uintptr_t *argv_store, *sp;
+
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+		string_size += strlen(argv[argc]) + 1;
+
+	string_store = (char *)UTEMP + PGSIZE - string_size;
+	// call libmain 之前 %rsp 按16字节对齐
+	sp = (uintptr_t *)ROUNDDOWN((uintptr_t)string_store - sizeof(uintptr_t) * (argc + 3), 16);
+	argv_store = sp + 2;
+	if ((void *)sp < UTEMP)
+		return -E_NO_MEM;
+
+	if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+		return r;
+
+	for (i = 0; i < argc; i++)
+	{
+		argv_store[i] = UTEMP2USTACK(string_store);
+		strcpy(string_store, argv[i]);
+		string_store += strlen(argv[i]) + 1;
+	}
+	argv_store[argc] = 0;
+	assert(string_store == (char *)UTEMP + PGSIZE);
+
+	sp[1] = UTEMP2USTACK(argv_store);
+	sp[0] = argc;
+	*init_rsp = UTEMP2USTACK(sp);
+
+	if ((r = sys_page_map(0, UTEMP, child, (void *)(USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+		goto error;
+	return sys_vma_alloc(child, (void *)(USTACKTOP - 2 * PGSIZE), PGSIZE, PTE_P | PTE_U | PTE_W);
+
+error:
+	sys_page_unmap(0, UTEMP);
+	return r;
+}
+
+/**
+ * 为子环境 child 登记程序段 ph(sys_vma_binary)，内容由内核从 fexec() 设置的程序映像按需填充
+ * 文件偏移与虚拟地址必须在页内对齐，内核才能把整页的文件内容映射到程序段中
+ */
+static int
+map_segment(envid_t child, struct Proghdr *ph)
+{
+	if (PGOFF(ph->p_offset) != PGOFF(ph->p_va) || ph->p_filesz > ph->p_memsz)
+		return -E_NOT_EXEC;
+	return sys_vma_binary(child, ph);
+}
+
+/**
+ * 把父环境中所有 PTE_SHARE 的页以相同的权限映射到子环境(文件描述符表和文件数据窗口)
+ * 按页表层次跳过不存在的页表，避免逐页扫描整个用户地址空间
+ */
+static int
+copy_shared_pages(envid_t child)
+{
+	uintptr_t va;
+	int r;
+
+	for (va = 0; va < UTOP; va += PGSIZE)
+	{
+		if (!(uvpml4e[VPML4E(va)] & PTE_P))
+		{
+			va = ROUNDDOWN(va, 1UL << PML4SHIFT) + (1UL << PML4SHIFT) - PGSIZE;
+			continue;
+		}
+		if (!(uvpde[VPDPE(va)] & PTE_P))
+		{
+			va = ROUNDDOWN(va, 1UL << PDPESHIFT) + (1UL << PDPESHIFT) - PGSIZE;
+			continue;
+		}
+		if (!(uvpd[VPD(va)] & PTE_P))
+		{
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE - PGSIZE;
+			continue;
+		}
+		if ((uvpt[VPN(va)] & (PTE_P | PTE_SHARE)) != (PTE_P | PTE_SHARE))
+			continue;
+		if ((r = sys_page_map(0, (void *)va, child, (void *)va, uvpt[VPN(va)] & PTE_SYSCALL)) < 0)
+			return r;
+	}
+	return 0;
+}
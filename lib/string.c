@@ -1,6 +1,7 @@
 // 基本的字符串处理例程
 
 #include "inc/string.h"
+#include "inc/x86.h"
 
 // 函数 memset/memmove 由C语言内嵌汇编实现
 // 在真正的硬件上会有一定程度的优化, 但在 Bochs 上会有更大的优化效果
@@ -116,20 +117,120 @@ strfind(const char *s, char c)
 }
 
 #if ASM
+/**
+ * memset/memmove/memcpy 根据长度和对齐选择实现，CPU 特性在 mem_init() 中通过 CPUID 探测：
+ * - 小块或未对齐：rep stosb/movsb
+ * - 8 字节对齐：rep stosq/movsq
+ * - 支持 ERMS(Enhanced REP MOVSB/STOSB) 且长度 >= MEM_ERMS_MIN：rep stosb/movsb(微码内部按 cache 行搬运)
+ * - 整页及以上且 8 字节对齐：movnti 非临时存储，绕过 cache 直接写内存，避免清零/复制页面时把工作集挤出 cache
+ * movnti 只使用通用寄存器，不依赖 CR4.OSFXSR，也不会破坏环境的 XMM/AVX 状态，因此内核与用户程序都可以使用
+ * 在 mem_init() 之前(例如内核清零 .bss)只使用 rep stos/movs，不依赖任何 CPU 特性
+ */
+#define MEM_ERMS_MIN 256
+#define MEM_NT_MIN 4096
+
+enum
+{
+	MEM_F_ERMS = 1 << 0, // CPUID.(EAX=7,ECX=0):EBX[9]
+	MEM_F_NT = 1 << 1,	 // CPUID.1:EDX[26] SSE2(movnti)
+};
+
+static int mem_features;
+
+void mem_init(void)
+{
+	uint32_t max, ebx, edx;
+
+	mem_features = 0;
+	cpuid(0, &max, NULL, NULL, NULL);
+	cpuid(1, NULL, NULL, NULL, &edx);
+	if (edx & (1 << 26))
+		mem_features |= MEM_F_NT;
+	if (max >= 7)
+	{
+		cpuid_count(7, 0, NULL, &ebx, NULL, NULL);
+		if (ebx & (1 << 9))
+			mem_features |= MEM_F_ERMS;
+	}
+}
+
+// 非临时存储填充 n 字节(v 8 字节对齐，n 为 32 的倍数)
+static void
+memset_nt(void *v, uint64_t pattern, size_t n)
+{
+	uint64_t *p = (uint64_t *)v;
+	uint64_t *end = p + n / 8;
+
+	for (; p < end; p += 4)
+		asm volatile("movnti %1, 0(%0)\n\t"
+					 "movnti %1, 8(%0)\n\t"
+					 "movnti %1, 16(%0)\n\t"
+					 "movnti %1, 24(%0)"
+					 :
+					 : "r"(p), "r"(pattern)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+}
+
+// 非临时存储复制 n 字节(dst/src 8 字节对齐且不重叠，n 为 32 的倍数)
+static void
+memcpy_nt(void *dst, const void *src, size_t n)
+{
+	uint64_t *d = (uint64_t *)dst;
+	const uint64_t *s = (const uint64_t *)src;
+	uint64_t *end = d + n / 8;
+	uint64_t t0, t1, t2, t3;
+
+	for (; d < end; d += 4, s += 4)
+		asm volatile("movq 0(%4), %0\n\t"
+					 "movq 8(%4), %1\n\t"
+					 "movq 16(%4), %2\n\t"
+					 "movq 24(%4), %3\n\t"
+					 "movnti %0, 0(%5)\n\t"
+					 "movnti %1, 8(%5)\n\t"
+					 "movnti %2, 16(%5)\n\t"
+					 "movnti %3, 24(%5)"
+					 : "=&r"(t0), "=&r"(t1), "=&r"(t2), "=&r"(t3)
+					 : "r"(s), "r"(d)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+}
+
+// 正向复制(dst 在 src 之前或两者不重叠)
+static void
+memcpy_fwd(void *dst, const void *src, size_t n)
+{
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+		memcpy_nt(dst, src, n);
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+					 : "cc", "memory");
+	else if ((((uint64_t)dst | (uint64_t)src | n) & 7) == 0)
+		asm volatile("cld; rep movsq\n" ::"D"(dst), "S"(src), "c"(n / 8)
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+					 : "cc", "memory");
+}
+
 void *
 memset(void *v, int c, size_t n)
 {
-	char *p;
+	uint64_t pattern;
 
 	if (n == 0)
 		return v;
-	if ((int64_t)v % 4 == 0 && n % 4 == 0)
-	{
-		c &= 0xFF;
-		c = (c << 24) | (c << 16) | (c << 8) | c;
-		asm volatile("cld; rep stosl\n" ::"D"(v), "a"(c), "c"(n / 4)
+	c &= 0xFF;
+	pattern = (uint64_t)c * 0x0101010101010101UL;
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)v | n) & 31) == 0)
+		memset_nt(v, pattern, n);
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+					 : "cc", "memory");
+	else if ((((uint64_t)v | n) & 7) == 0)
+		asm volatile("cld; rep stosq\n" ::"D"(v), "a"(pattern), "c"(n / 8)
 					 : "cc", "memory");
-	}
 	else
 		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
 					 : "cc", "memory");
@@ -146,10 +247,11 @@ memmove(void *dst, const void *src, size_t n)
 	d = dst;
 	if (s < d && s + n > d)
 	{
+		// 重叠且 dst 在 src 之后，只能反向复制(ERMS 对反向 rep movsb 没有优化)
 		s += n;
 		d += n;
-		if ((int64_t)s % 4 == 0 && (int64_t)d % 4 == 0 && n % 4 == 0)
-			asm volatile("std; rep movsl\n" ::"D"(d - 4), "S"(s - 4), "c"(n / 4)
+		if ((((uint64_t)s | (uint64_t)d | n) & 7) == 0)
+			asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
 						 : "cc", "memory");
 		else
 			asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
@@ -158,15 +260,16 @@ memmove(void *dst, const void *src, size_t n)
 		asm volatile("cld" ::
 						 : "cc");
 	}
-	else
-	{
-		if ((int64_t)s % 4 == 0 && (int64_t)d % 4 == 0 && n % 4 == 0)
-			asm volatile("cld; rep movsl\n" ::"D"(d), "S"(s), "c"(n / 4)
-						 : "cc", "memory");
-		else
-			asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
-						 : "cc", "memory");
-	}
+	else if (n)
+		memcpy_fwd(d, s, n);
+	return dst;
+}
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+	if (n)
+		memcpy_fwd(dst, src, n);
 	return dst;
 }
 
@@ -207,14 +310,17 @@ memmove(void *dst, const void *src, size_t n)
 
 	return dst;
 }
-#endif
-
 void *
 memcpy(void *dst, const void *src, size_t n)
 {
 	return memmove(dst, src, n);
 }
 
+void mem_init(void)
+{
+}
+#endif
+
 int memcmp(const void *v1, const void *v2, size_t n)
 {
 	const uint8_t *s1 = (const uint8_t *)v1;
@@ -125,3 +125,54 @@ int sys_ipc_recv(void *dstva)
 {
 	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
 }
+
+int sys_disk_io(int dev, uint64_t secno, void *va, size_t nsecs, int write)
+{
+	return syscall(SYS_disk_io, 0, dev, secno, (uint64_t)va, nsecs, write);
+}
+
+int sys_vma_alloc(envid_t envid, void *va, size_t len, int perm)
+{
+	return syscall(SYS_vma_alloc, 1, envid, (uint64_t)va, len, perm, 0);
+}
+
+int sys_vma_clear(envid_t envid)
+{
+	return syscall(SYS_vma_clear, 1, envid, 0, 0, 0, 0);
+}
+
+int sys_trace_ctl(int enable)
+{
+	return syscall(SYS_trace_ctl, 0, enable, 0, 0, 0, 0);
+}
+
+int sys_trace_read(int cpu, uint64_t *seq, struct TraceEvent *buf, int n)
+{
+	return syscall(SYS_trace_read, 0, cpu, (uint64_t)seq, (uint64_t)buf, n, 0);
+}
+
+int sys_getrusage(envid_t envid, struct Rusage *ru)
+{
+	return syscall(SYS_getrusage, 0, envid, (uint64_t)ru, 0, 0, 0);
+}
+
+int sys_pmu_config(int idx, uint64_t event)
+{
+	return syscall(SYS_pmu_config, 0, idx, event, 0, 0, 0);
+}
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+}
+
+int sys_image_attach(envid_t envid, int dev, const uint64_t *secnos, size_t size)
+{
+	return syscall(SYS_image_attach, 1, envid, dev, (uint64_t)secnos, size, 0);
+}
+
+int sys_vma_binary(envid_t envid, const struct Proghdr *ph)
+{
+	return syscall(SYS_vma_binary, 1, envid, (uint64_t)ph, 0, 0, 0);
+}
@@ -0,0 +1,402 @@
+
+obj/boot/boot.out:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00007c00 <start>:
+
+.globl multiboot_info
+.globl start
+start:
+  .code16                     # 声明以下为16位实模式的汇编代码
+  cli                         # 禁用中断，当前内核仍无法处理中断
+    7c00:	fa                   	cli
+  cld                         # 关闭字符串操作顺序递增(从低地址到高地址)
+    7c01:	fc                   	cld
+
+  # 初始化重要的段寄存器 (DS, ES, SS). 
+  xorw    %ax, %ax             # ax置零，为段寄存器赋值
+    7c02:	31 c0                	xor    %eax,%eax
+  movw    %ax, %ds             # 0 -> 数据段
+    7c04:	8e d8                	mov    %eax,%ds
+  movw    %ax, %es             # 0 -> 拓展段
+    7c06:	8e c0                	mov    %eax,%es
+  movw    %ax, %ss             # 0 -> 栈段
+    7c08:	8e d0                	mov    %eax,%ss
+
+  rdtsc                       # 记录引导开始的 TSC，由内核报告引导耗时(%ds 已为0，写入物理地址 BOOT_TSC_PADDR)
+    7c0a:	0f 31                	rdtsc
+  movl    %eax, BOOT_TSC_PADDR
+    7c0c:	66 a3 f0 6f 66 89    	mov    %ax,0x89666ff0
+  movl    %edx, BOOT_TSC_PADDR+4
+    7c12:	16                   	push   %ss
+    7c13:	f4                   	hlt
+    7c14:	6f                   	outsl  %ds:(%esi),(%dx)
+
+00007c15 <seta20.1>:
+
+  # 启用 A20:    —— A20总线是专门用来转换地址总线的第二十一位
+  #   为了向下兼容8086 CPU, 任何分段方式访问超过 1MB 的内存都会使得溢出的第二十一位(A20)为0
+  #   即使能够在保护模式下寻址 4GB 的地址空间，地址最终还是在 1MB 内.   下面这段代码会禁用这个设置.
+seta20.1:
+  inb     $0x64, %al               # 等待 0x64 号 I/O 端口空闲
+    7c15:	e4 64                	in     $0x64,%al
+  testb   $0x2, %al
+    7c17:	a8 02                	test   $0x2,%al
+  jnz     seta20.1
+    7c19:	75 fa                	jne    7c15 <seta20.1>
+
+  movb    $0xd1, %al               # 空闲: 0xd1 -> port 0x64
+    7c1b:	b0 d1                	mov    $0xd1,%al
+  outb    %al, $0x64
+    7c1d:	e6 64                	out    %al,$0x64
+
+00007c1f <seta20.2>:
+
+seta20.2:
+  inb     $0x64, %al               # 等待 0x64 号 I/O 端口空闲
+    7c1f:	e4 64                	in     $0x64,%al
+  testb   $0x2, %al
+    7c21:	a8 02                	test   $0x2,%al
+  jnz     seta20.2
+    7c23:	75 fa                	jne    7c1f <seta20.2>
+
+  movb    $0xdf, %al               # 空闲: 0xdf -> port 0x60
+    7c25:	b0 df                	mov    $0xdf,%al
+  outb    %al, $0x60
+    7c27:	e6 60                	out    %al,$0x60
+
+00007c29 <do_e820>:
+  # 从 BIOS 获取 E820 内存映射
+  # 通过 BIOS 中断服务程序 INT 15h 的主功能号 E820h 来获取物理地址空间
+  # 物理地址空间信息结构是 20B 的结构体(8B: 起始地址，8B: 长度(Byte)，4B: 内存类型)
+  # 内存类型: 可用物理内存、保留或无效值、ACPI 回收内存、ACPINVS 内存、未定义
+do_e820:
+  xorl %ebx, %ebx                 # %ebx = 0x0，第一次调用
+    7c29:	66 31 db             	xor    %bx,%bx
+  xorl %ebp, %ebp                 # %ebp = 已读取的内存映射长度
+    7c2c:	66 31 ed             	xor    %bp,%bp
+  movl $e820_map + 4, %edi        # es:edi => 返回结果的缓存区地址
+    7c2f:	66 bf 38 70          	mov    $0x7038,%di
+	...
+
+00007c35 <next_entry>:
+
+next_entry:
+  # 调用传入值(BIOS 可能修改 %eax, %ecx, %edx，每次调用都重新设置)
+  movl $0xe820, %eax              # %eax = 0xe820
+    7c35:	66 b8 20 e8          	mov    $0xe820,%ax
+    7c39:	00 00                	add    %al,(%eax)
+  movl $24, %ecx                  # %ecx = 预设返回结果的缓存区结构体长度，字节为单位
+    7c3b:	66 b9 18 00          	mov    $0x18,%cx
+    7c3f:	00 00                	add    %al,(%eax)
+  movl $0x534D4150, %edx          # %edx = 0x534D4150 = str "SMAP"
+    7c41:	66 ba 50 41          	mov    $0x4150,%dx
+    7c45:	4d                   	dec    %ebp
+    7c46:	53                   	push   %ebx
+  int $0x15                       # int 15h
+    7c47:	cd 15                	int    $0x15
+  jc done
+    7c49:	72 17                	jb     7c62 <done>
+  cmpl %eax, %edx
+    7c4b:	66 39 c2             	cmp    %ax,%dx
+  jne done
+    7c4e:	75 12                	jne    7c62 <done>
+  # 若调用 e820 成功，记录 entry 长度，%edi自增，下一个 entry
+  movl %ecx, -4(%edi)
+    7c50:	67 66 89 4f fc       	mov    %cx,-0x4(%bx)
+  addl $24, %edi
+    7c55:	66 83 c7 18          	add    $0x18,%di
+  addl $24, %ebp
+    7c59:	66 83 c5 18          	add    $0x18,%bp
+  testl %ebx, %ebx
+    7c5d:	66 85 db             	test   %bx,%bx
+  jne next_entry
+    7c60:	75 d3                	jne    7c35 <next_entry>
+
+00007c62 <done>:
+
+done:
+  # 物理地址空间信息读取完成，没有读到任何 entry 视为失败
+  testl %ebp, %ebp
+    7c62:	66 85 ed             	test   %bp,%bp
+  je failed
+    7c65:	74 14                	je     7c7b <failed>
+  movw $0x40, (MB_flag) # multiboot 的信息标志位
+    7c67:	c7 06 00 70 40 00    	movl   $0x407000,(%esi)
+  movl $e820_map, (MB_mmap_addr)
+    7c6d:	66 c7 06 30 70       	movw   $0x7030,(%esi)
+    7c72:	34 70                	xor    $0x70,%al
+    7c74:	00 00                	add    %al,(%eax)
+  movl %ebp, (MB_mmap_len)
+    7c76:	66 89 2e             	mov    %bp,(%esi)
+    7c79:	2c 70                	sub    $0x70,%al
+
+00007c7b <failed>:
+  
+failed:
+  # 将 GDT 表的首地址加载到 GDTR，并设置寄存器 cr0 的保护模式允许位，使处理器从实模式切换到保护模式
+  # 而且分段映射的虚拟地址与其对应的实际地址相同[0~4G]，因此有效内存映射在转换期间不会更改
+  lgdt    gdtdesc
+    7c7b:	0f 01 16             	lgdtl  (%esi)
+    7c7e:	c4 7c 0f 20          	les    0x20(%edi,%ecx,1),%edi
+  movl    %cr0, %eax
+    7c82:	c0 66 83 c8          	shlb   $0xc8,-0x7d(%esi)
+  orl     $CR0_PE_ON, %eax
+    7c86:	01 0f                	add    %ecx,(%edi)
+  movl    %eax, %cr0
+    7c88:	22 c0                	and    %al,%al
+ 
+  # $PROT_MODE_CSEG 代表的是段选择子0x0，偏移地址 $protcseg 接下来的链接地址
+  # 通过跳转刷新CPU流水线上的指令，刷新CS、IP等寄存器，从而切换处理器为32位保护模式
+  # 令CPU清空实模式下已经存在流水线中的指令，由于当前处于保护模式下执行实模式的指令会出现各种问题
+  ljmp    $PROT_MODE_CSEG, $protcseg
+    7c8a:	ea                   	.byte 0xea
+    7c8b:	8f                   	(bad)
+    7c8c:	7c 08                	jl     7c96 <protcseg+0x7>
+	...
+
+00007c8f <protcseg>:
+
+  .code32                     # 声明为32位保护模式汇编代码
+protcseg:
+  # 跳转至保护模式后，需要刷新数据段寄存器(因为32位引入了特权级保护，避免数据段寄存器之前的值不对而出现漏洞)
+  movw    $PROT_MODE_DSEG, %ax    # 数据段选择子
+    7c8f:	66 b8 10 00          	mov    $0x10,%ax
+  movw    %ax, %ds                # -> DS: 数据段
+    7c93:	8e d8                	mov    %eax,%ds
+  movw    %ax, %es                # -> ES: 拓展段
+    7c95:	8e c0                	mov    %eax,%es
+  movw    %ax, %fs                # -> FS
+    7c97:	8e e0                	mov    %eax,%fs
+  movw    %ax, %gs                # -> GS
+    7c99:	8e e8                	mov    %eax,%gs
+  movw    %ax, %ss                # -> SS: 栈段
+    7c9b:	8e d0                	mov    %eax,%ss
+  
+  # 设置栈指针ESP=0x7c00，从而可以调用C语言编写的 bootmain(为了尽量少用汇编语言写内核).
+  movl    $start, %esp
+    7c9d:	bc 00 7c 00 00       	mov    $0x7c00,%esp
+  # 调用 boot/main.c 的 bootmain
+  call bootmain
+    7ca2:	e8 dc 00 00 00       	call   7d83 <bootmain>
+
+00007ca7 <spin>:
+
+  # 如果指令从 bootmain 返回(正常情况下不会返回), 死循环.
+spin:
+  jmp spin
+    7ca7:	eb fe                	jmp    7ca7 <spin>
+    7ca9:	8d 76 00             	lea    0x0(%esi),%esi
+
+00007cac <gdt>:
+	...
+    7cb4:	ff                   	(bad)
+    7cb5:	ff 00                	incl   (%eax)
+    7cb7:	00 00                	add    %al,(%eax)
+    7cb9:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+    7cc0:	00                   	.byte 0x0
+    7cc1:	92                   	xchg   %eax,%edx
+    7cc2:	cf                   	iret
+	...
+
+00007cc4 <gdtdesc>:
+    7cc4:	17                   	pop    %ss
+    7cc5:	00                   	.byte 0x0
+    7cc6:	ac                   	lods   %ds:(%esi),%al
+    7cc7:	7c 00                	jl     7cc9 <gdtdesc+0x5>
+	...
+
+00007cca <readseg>:
+// 从内核的 offset 处读取 count 个字节到物理地址 pa 处
+// 可能读取会超过count个（扇区对齐）
+// 每条 READ SECTORS 命令固定读取 BATCH 个扇区，而不是每个扇区一条命令(PIO 仍需每个扇区等待一次 DRQ)
+// 每条命令的扇区都要全部读出，因此最多会多读 BATCH-1 个扇区
+void readseg(uint32_t pa, uint32_t count, uint32_t offset)
+{
+    7cca:	55                   	push   %ebp
+    7ccb:	89 e5                	mov    %esp,%ebp
+    7ccd:	57                   	push   %edi
+    7cce:	56                   	push   %esi
+    7ccf:	53                   	push   %ebx
+
+	// offset 从字节转换为硬盘的第i扇区，内核从扇区1开始
+	offset = (offset / SECTSIZE) + 1;
+
+	// 会在内存中写入比要求的更多的内容，但是没关系 —— 以递增的顺序加载.
+	for (n = 0; n || pa < end_pa; n--, pa += SECTSIZE)
+    7cd0:	31 db                	xor    %ebx,%ebx
+{
+    7cd2:	83 ec 08             	sub    $0x8,%esp
+    7cd5:	8b 45 08             	mov    0x8(%ebp),%eax
+	end_pa = pa + count;
+    7cd8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    7cdb:	01 c1                	add    %eax,%ecx
+	pa &= ~(SECTSIZE - 1);
+    7cdd:	25 00 fe ff ff       	and    $0xfffffe00,%eax
+    7ce2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	offset = (offset / SECTSIZE) + 1;
+    7ce5:	8b 45 10             	mov    0x10(%ebp),%eax
+	end_pa = pa + count;
+    7ce8:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+	offset = (offset / SECTSIZE) + 1;
+    7ceb:	c1 e8 09             	shr    $0x9,%eax
+    7cee:	8d 70 01             	lea    0x1(%eax),%esi
+	for (n = 0; n || pa < end_pa; n--, pa += SECTSIZE)
+    7cf1:	85 db                	test   %ebx,%ebx
+    7cf3:	74 27                	je     7d1c <readseg+0x52>
+
+static __inline uint8_t
+inb(int port)
+{
+	uint8_t data;
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+    7cf5:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7cfa:	ec                   	in     (%dx),%al
+	while ((inb(0x1F7) & 0xC0) != 0x40)
+    7cfb:	83 e0 c0             	and    $0xffffffc0,%eax
+    7cfe:	3c 40                	cmp    $0x40,%al
+    7d00:	75 f3                	jne    7cf5 <readseg+0x2b>
+}
+
+static __inline void
+insl(int port, void *addr, int cnt)
+{
+	__asm __volatile("cld\n\trepne\n\tinsl"			:
+    7d02:	8b 7d f0             	mov    -0x10(%ebp),%edi
+    7d05:	b9 80 00 00 00       	mov    $0x80,%ecx
+    7d0a:	ba f0 01 00 00       	mov    $0x1f0,%edx
+    7d0f:	fc                   	cld
+    7d10:	f2 6d                	repnz insl (%dx),%es:(%edi)
+	for (n = 0; n || pa < end_pa; n--, pa += SECTSIZE)
+    7d12:	81 45 f0 00 02 00 00 	addl   $0x200,-0x10(%ebp)
+    7d19:	4b                   	dec    %ebx
+    7d1a:	eb d5                	jmp    7cf1 <readseg+0x27>
+    7d1c:	8b 7d ec             	mov    -0x14(%ebp),%edi
+    7d1f:	39 7d f0             	cmp    %edi,-0x10(%ebp)
+    7d22:	73 58                	jae    7d7c <readseg+0xb2>
+	{
+		// 上一条命令的扇区已读完，发出一条新命令
+		if (n == 0)
+    7d24:	85 db                	test   %ebx,%ebx
+    7d26:	75 cd                	jne    7cf5 <readseg+0x2b>
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+    7d28:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7d2d:	ec                   	in     (%dx),%al
+	while ((inb(0x1F7) & 0xC0) != 0x40)
+    7d2e:	83 e0 c0             	and    $0xffffffc0,%eax
+    7d31:	3c 40                	cmp    $0x40,%al
+    7d33:	75 f3                	jne    7d28 <readseg+0x5e>
+}
+
+static __inline void
+outb(int port, uint8_t data)
+{
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+    7d35:	ba f2 01 00 00       	mov    $0x1f2,%edx
+    7d3a:	ee                   	out    %al,(%dx)
+    7d3b:	ba f3 01 00 00       	mov    $0x1f3,%edx
+    7d40:	89 f0                	mov    %esi,%eax
+    7d42:	ee                   	out    %al,(%dx)
+		{
+			waitdisk();
+			outb(0x1F2, BATCH);
+			outb(0x1F3, offset);
+			outb(0x1F4, offset >> 8);
+    7d43:	89 f0                	mov    %esi,%eax
+    7d45:	ba f4 01 00 00       	mov    $0x1f4,%edx
+    7d4a:	c1 e8 08             	shr    $0x8,%eax
+    7d4d:	ee                   	out    %al,(%dx)
+			outb(0x1F5, offset >> 16);
+    7d4e:	89 f0                	mov    %esi,%eax
+    7d50:	ba f5 01 00 00       	mov    $0x1f5,%edx
+    7d55:	c1 e8 10             	shr    $0x10,%eax
+    7d58:	ee                   	out    %al,(%dx)
+			outb(0x1F6, (offset >> 24) | 0xE0);
+    7d59:	89 f0                	mov    %esi,%eax
+    7d5b:	ba f6 01 00 00       	mov    $0x1f6,%edx
+    7d60:	c1 e8 18             	shr    $0x18,%eax
+    7d63:	83 c8 e0             	or     $0xffffffe0,%eax
+    7d66:	ee                   	out    %al,(%dx)
+    7d67:	b0 20                	mov    $0x20,%al
+    7d69:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7d6e:	ee                   	out    %al,(%dx)
+			outb(0x1F7, 0x20);
+			offset += BATCH;
+			n = BATCH;
+    7d6f:	bb 40 00 00 00       	mov    $0x40,%ebx
+			offset += BATCH;
+    7d74:	83 c6 40             	add    $0x40,%esi
+	while ((inb(0x1F7) & 0xC0) != 0x40)
+    7d77:	e9 79 ff ff ff       	jmp    7cf5 <readseg+0x2b>
+
+		// 循环等待磁盘就绪，读取一个扇区，数据存放在内存中的 pa
+		waitdisk();
+		insl(0x1F0, (uint8_t *)pa, SECTSIZE / 4);
+	}
+}
+    7d7c:	58                   	pop    %eax
+    7d7d:	5a                   	pop    %edx
+    7d7e:	5b                   	pop    %ebx
+    7d7f:	5e                   	pop    %esi
+    7d80:	5f                   	pop    %edi
+    7d81:	5d                   	pop    %ebp
+    7d82:	c3                   	ret
+
+00007d83 <bootmain>:
+{
+    7d83:	55                   	push   %ebp
+    7d84:	89 e5                	mov    %esp,%ebp
+    7d86:	56                   	push   %esi
+    7d87:	53                   	push   %ebx
+	readseg((uint32_t)ELFHDR, SECTSIZE * 8, 0);
+    7d88:	6a 00                	push   $0x0
+    7d8a:	68 00 10 00 00       	push   $0x1000
+    7d8f:	68 00 00 01 00       	push   $0x10000
+    7d94:	e8 31 ff ff ff       	call   7cca <readseg>
+	if (ELFHDR->e_magic != ELF_MAGIC)
+    7d99:	83 c4 0c             	add    $0xc,%esp
+    7d9c:	81 3d 00 00 01 00 7f 	cmpl   $0x464c457f,0x10000
+    7da3:	45 4c 46 
+    7da6:	75 44                	jne    7dec <bootmain+0x69>
+	eph = ph + ELFHDR->e_phnum;
+    7da8:	0f b7 35 38 00 01 00 	movzwl 0x10038,%esi
+	ph = (struct Proghdr *)((uint8_t *)ELFHDR + ELFHDR->e_phoff);
+    7daf:	a1 20 00 01 00       	mov    0x10020,%eax
+	eph = ph + ELFHDR->e_phnum;
+    7db4:	6b f6 38             	imul   $0x38,%esi,%esi
+	ph = (struct Proghdr *)((uint8_t *)ELFHDR + ELFHDR->e_phoff);
+    7db7:	8d 98 00 00 01 00    	lea    0x10000(%eax),%ebx
+	eph = ph + ELFHDR->e_phnum;
+    7dbd:	01 de                	add    %ebx,%esi
+	for (; ph < eph; ph++)
+    7dbf:	39 f3                	cmp    %esi,%ebx
+    7dc1:	73 16                	jae    7dd9 <bootmain+0x56>
+		readseg(ph->p_pa, ph->p_memsz, ph->p_offset);
+    7dc3:	ff 73 08             	push   0x8(%ebx)
+	for (; ph < eph; ph++)
+    7dc6:	83 c3 38             	add    $0x38,%ebx
+		readseg(ph->p_pa, ph->p_memsz, ph->p_offset);
+    7dc9:	ff 73 f0             	push   -0x10(%ebx)
+    7dcc:	ff 73 e0             	push   -0x20(%ebx)
+    7dcf:	e8 f6 fe ff ff       	call   7cca <readseg>
+	for (; ph < eph; ph++)
+    7dd4:	83 c4 0c             	add    $0xc,%esp
+    7dd7:	eb e6                	jmp    7dbf <bootmain+0x3c>
+	__asm __volatile("movl %0, %%ebx"
+    7dd9:	b8 00 70 00 00       	mov    $0x7000,%eax
+    7dde:	89 c3                	mov    %eax,%ebx
+}
+    7de0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    7de3:	5b                   	pop    %ebx
+    7de4:	5e                   	pop    %esi
+    7de5:	5d                   	pop    %ebp
+	((void (*)(void))((uint32_t)(ELFHDR->e_entry)))();
+    7de6:	ff 25 18 00 01 00    	jmp    *0x10018
+}
+    7dec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    7def:	5b                   	pop    %ebx
+    7df0:	5e                   	pop    %esi
+    7df1:	5d                   	pop    %ebp
+    7df2:	c3                   	ret
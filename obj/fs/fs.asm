@@ -0,0 +1,9389 @@
+
+obj/fs/fs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// entrypoint - 当最初被加载到一个新的环境中时，内核(或者父环境)在这里开始运行.
+.text
+.globl _start
+_start:
+	// 判断是否从栈上的参数开始初始化
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	// $USTACKTOP != %rsp 说明有参数，跳转到 args_exist
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// 如果不是(新环境被内核加载的时候)，则 push 伪造的 argc, argv 参数
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 f6 24 00 00       	call   802537 <libmain>
+
+// 不应该返回
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <diskaddr>:
+#include "fs/fs.h"
+
+// 返回块 blockno 在块缓存中的虚拟地址
+void *
+diskaddr(uint32_t blockno)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	48 83 ec 10          	sub    $0x10,%rsp
+  80004b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	if (blockno == 0 || (super && blockno >= super->s_nblocks))
+  80004e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800052:	74 27                	je     80007b <diskaddr+0x38>
+  800054:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80005b:	00 00 00 
+  80005e:	48 8b 00             	mov    (%rax),%rax
+  800061:	48 85 c0             	test   %rax,%rax
+  800064:	74 4b                	je     8000b1 <diskaddr+0x6e>
+  800066:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80006d:	00 00 00 
+  800070:	48 8b 00             	mov    (%rax),%rax
+  800073:	8b 40 04             	mov    0x4(%rax),%eax
+  800076:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  800079:	72 36                	jb     8000b1 <diskaddr+0x6e>
+		panic("bad block number %08x in diskaddr", blockno);
+  80007b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80007e:	89 c1                	mov    %eax,%ecx
+  800080:	48 b8 60 5c 80 00 00 	movabs $0x805c60,%rax
+  800087:	00 00 00 
+  80008a:	48 89 c2             	mov    %rax,%rdx
+  80008d:	be 11 00 00 00       	mov    $0x11,%esi
+  800092:	48 b8 82 5c 80 00 00 	movabs $0x805c82,%rax
+  800099:	00 00 00 
+  80009c:	48 89 c7             	mov    %rax,%rdi
+  80009f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a4:	49 b8 cc 25 80 00 00 	movabs $0x8025cc,%r8
+  8000ab:	00 00 00 
+  8000ae:	41 ff d0             	call   *%r8
+	return (char *)(DISKMAP + (uint64_t)blockno * BLKSIZE);
+  8000b1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000b4:	48 05 00 00 01 00    	add    $0x10000,%rax
+  8000ba:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8000be:	c9                   	leave
+  8000bf:	c3                   	ret
+
+00000000008000c0 <va_is_dirty>:
+
+// 虚拟地址 va 所在的页是否被写过
+bool va_is_dirty(void *va)
+{
+  8000c0:	55                   	push   %rbp
+  8000c1:	48 89 e5             	mov    %rsp,%rbp
+  8000c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8000c8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return (uvpt[VPN(va)] & PTE_D) != 0;
+  8000cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8000d0:	48 c1 e8 0c          	shr    $0xc,%rax
+  8000d4:	48 89 c2             	mov    %rax,%rdx
+  8000d7:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8000de:	01 00 00 
+  8000e1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8000e5:	83 e0 40             	and    $0x40,%eax
+  8000e8:	48 85 c0             	test   %rax,%rax
+  8000eb:	0f 95 c0             	setne  %al
+}
+  8000ee:	c9                   	leave
+  8000ef:	c3                   	ret
+
+00000000008000f0 <bc_pgfault>:
+/**
+ * 块缓存的页错误处理函数：为出错地址所在的块分配物理页并从磁盘读入
+ */
+static void
+bc_pgfault(struct UTrapframe *utf)
+{
+  8000f0:	55                   	push   %rbp
+  8000f1:	48 89 e5             	mov    %rsp,%rbp
+  8000f4:	48 83 ec 30          	sub    $0x30,%rsp
+  8000f8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	void *addr = (void *)utf->utf_fault_va;
+  8000fc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800100:	48 8b 00             	mov    (%rax),%rax
+  800103:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint32_t blockno = ((uint64_t)addr - DISKMAP) / BLKSIZE;
+  800107:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80010b:	48 2d 00 00 00 10    	sub    $0x10000000,%rax
+  800111:	48 c1 e8 0c          	shr    $0xc,%rax
+  800115:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	int r;
+
+	// 检查出错地址是否在块缓存区域内
+	if ((uint64_t)addr < DISKMAP || (uint64_t)addr >= DISKMAP + DISKSIZE)
+  800118:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80011c:	48 3d ff ff ff 0f    	cmp    $0xfffffff,%rax
+  800122:	76 0e                	jbe    800132 <bc_pgfault+0x42>
+  800124:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800128:	ba ff ff ff cf       	mov    $0xcfffffff,%edx
+  80012d:	48 39 c2             	cmp    %rax,%rdx
+  800130:	73 51                	jae    800183 <bc_pgfault+0x93>
+		panic("page fault in FS: rip %08lx, va %08lx, err %04x",
+  800132:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800136:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  80013a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80013e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800142:	48 8b 80 88 00 00 00 	mov    0x88(%rax),%rax
+  800149:	49 89 c9             	mov    %rcx,%r9
+  80014c:	49 89 d0             	mov    %rdx,%r8
+  80014f:	48 89 c1             	mov    %rax,%rcx
+  800152:	48 b8 90 5c 80 00 00 	movabs $0x805c90,%rax
+  800159:	00 00 00 
+  80015c:	48 89 c2             	mov    %rax,%rdx
+  80015f:	be 27 00 00 00       	mov    $0x27,%esi
+  800164:	48 b8 82 5c 80 00 00 	movabs $0x805c82,%rax
+  80016b:	00 00 00 
+  80016e:	48 89 c7             	mov    %rax,%rdi
+  800171:	b8 00 00 00 00       	mov    $0x0,%eax
+  800176:	49 ba cc 25 80 00 00 	movabs $0x8025cc,%r10
+  80017d:	00 00 00 
+  800180:	41 ff d2             	call   *%r10
+			  utf->utf_rip, (uint64_t)addr, utf->utf_err);
+
+	// 检查块号是否合法
+	if (super && blockno >= super->s_nblocks)
+  800183:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80018a:	00 00 00 
+  80018d:	48 8b 00             	mov    (%rax),%rax
+  800190:	48 85 c0             	test   %rax,%rax
+  800193:	74 4b                	je     8001e0 <bc_pgfault+0xf0>
+  800195:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80019c:	00 00 00 
+  80019f:	48 8b 00             	mov    (%rax),%rax
+  8001a2:	8b 40 04             	mov    0x4(%rax),%eax
+  8001a5:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+  8001a8:	72 36                	jb     8001e0 <bc_pgfault+0xf0>
+		panic("reading non-existent block %08x\n", blockno);
+  8001aa:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8001ad:	89 c1                	mov    %eax,%ecx
+  8001af:	48 b8 c0 5c 80 00 00 	movabs $0x805cc0,%rax
+  8001b6:	00 00 00 
+  8001b9:	48 89 c2             	mov    %rax,%rdx
+  8001bc:	be 2c 00 00 00       	mov    $0x2c,%esi
+  8001c1:	48 b8 82 5c 80 00 00 	movabs $0x805c82,%rax
+  8001c8:	00 00 00 
+  8001cb:	48 89 c7             	mov    %rax,%rdi
+  8001ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d3:	49 b8 cc 25 80 00 00 	movabs $0x8025cc,%r8
+  8001da:	00 00 00 
+  8001dd:	41 ff d0             	call   *%r8
+
+	addr = ROUNDDOWN(addr, BLKSIZE);
+  8001e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8001e4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  8001e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8001ec:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8001f2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if ((r = sys_page_alloc(0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  8001f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8001fa:	ba 07 00 00 00       	mov    $0x7,%edx
+  8001ff:	48 89 c6             	mov    %rax,%rsi
+  800202:	bf 00 00 00 00       	mov    $0x0,%edi
+  800207:	48 b8 fb 40 80 00 00 	movabs $0x8040fb,%rax
+  80020e:	00 00 00 
+  800211:	ff d0                	call   *%rax
+  800213:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  800216:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80021a:	79 36                	jns    800252 <bc_pgfault+0x162>
+		panic("in bc_pgfault, sys_page_alloc: %e", r);
+  80021c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80021f:	89 c1                	mov    %eax,%ecx
+  800221:	48 b8 e8 5c 80 00 00 	movabs $0x805ce8,%rax
+  800228:	00 00 00 
+  80022b:	48 89 c2             	mov    %rax,%rdx
+  80022e:	be 30 00 00 00       	mov    $0x30,%esi
+  800233:	48 b8 82 5c 80 00 00 	movabs $0x805c82,%rax
+  80023a:	00 00 00 
+  80023d:	48 89 c7             	mov    %rax,%rdi
+  800240:	b8 00 00 00 00       	mov    $0x0,%eax
+  800245:	49 b8 cc 25 80 00 00 	movabs $0x8025cc,%r8
+  80024c:	00 00 00 
+  80024f:	41 ff d0             	call   *%r8
+	if ((r = sys_disk_io(FSDEV, (uint64_t)blockno * BLKSECTS, addr, BLKSECTS, 0)) < 0)
+  800252:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800255:	48 8d 34 c5 00 00 00 	lea    0x0(,%rax,8),%rsi
+  80025c:	00 
+  80025d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800261:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800267:	b9 08 00 00 00       	mov    $0x8,%ecx
+  80026c:	48 89 c2             	mov    %rax,%rdx
+  80026f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800274:	48 b8 7b 43 80 00 00 	movabs $0x80437b,%rax
+  80027b:	00 00 00 
+  80027e:	ff d0                	call   *%rax
+  800280:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  800283:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800287:	79 36                	jns    8002bf <bc_pgfault+0x1cf>
+		panic("in bc_pgfault, sys_disk_io: %e", r);
+  800289:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80028c:	89 c1                	mov    %eax,%ecx
+  80028e:	48 b8 10 5d 80 00 00 	movabs $0x805d10,%rax
+  800295:	00 00 00 
+  800298:	48 89 c2             	mov    %rax,%rdx
+  80029b:	be 32 00 00 00       	mov    $0x32,%esi
+  8002a0:	48 b8 82 5c 80 00 00 	movabs $0x805c82,%rax
+  8002a7:	00 00 00 
+  8002aa:	48 89 c7             	mov    %rax,%rdi
+  8002ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b2:	49 b8 cc 25 80 00 00 	movabs $0x8025cc,%r8
+  8002b9:	00 00 00 
+  8002bc:	41 ff d0             	call   *%r8
+
+	// 读入磁盘数据时写了该页，重新映射以清除 Dirty 位
+	if ((r = sys_page_map(0, addr, 0, addr, uvpt[VPN(addr)] & PTE_SYSCALL)) < 0)
+  8002bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8002c3:	48 c1 e8 0c          	shr    $0xc,%rax
+  8002c7:	48 89 c2             	mov    %rax,%rdx
+  8002ca:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8002d1:	01 00 00 
+  8002d4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8002d8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8002dd:	89 c1                	mov    %eax,%ecx
+  8002df:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8002e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8002e7:	41 89 c8             	mov    %ecx,%r8d
+  8002ea:	48 89 d1             	mov    %rdx,%rcx
+  8002ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002f2:	48 89 c6             	mov    %rax,%rsi
+  8002f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002fa:	48 b8 4d 41 80 00 00 	movabs $0x80414d,%rax
+  800301:	00 00 00 
+  800304:	ff d0                	call   *%rax
+  800306:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  800309:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80030d:	79 36                	jns    800345 <bc_pgfault+0x255>
+		panic("in bc_pgfault, sys_page_map: %e", r);
+  80030f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800312:	89 c1                	mov    %eax,%ecx
+  800314:	48 b8 30 5d 80 00 00 	movabs $0x805d30,%rax
+  80031b:	00 00 00 
+  80031e:	48 89 c2             	mov    %rax,%rdx
+  800321:	be 36 00 00 00       	mov    $0x36,%esi
+  800326:	48 b8 82 5c 80 00 00 	movabs $0x805c82,%rax
+  80032d:	00 00 00 
+  800330:	48 89 c7             	mov    %rax,%rdi
+  800333:	b8 00 00 00 00       	mov    $0x0,%eax
+  800338:	49 b8 cc 25 80 00 00 	movabs $0x8025cc,%r8
+  80033f:	00 00 00 
+  800342:	41 ff d0             	call   *%r8
+
+	// 检查读入的块是否已分配(读入位图块之前无法检查)
+	if (bitmap && block_is_free(blockno))
+  800345:	48 b8 08 90 80 00 00 	movabs $0x809008,%rax
+  80034c:	00 00 00 
+  80034f:	48 8b 00             	mov    (%rax),%rax
+  800352:	48 85 c0             	test   %rax,%rax
+  800355:	74 4b                	je     8003a2 <bc_pgfault+0x2b2>
+  800357:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80035a:	89 c7                	mov    %eax,%edi
+  80035c:	48 b8 2e 06 80 00 00 	movabs $0x80062e,%rax
+  800363:	00 00 00 
+  800366:	ff d0                	call   *%rax
+  800368:	84 c0                	test   %al,%al
+  80036a:	74 36                	je     8003a2 <bc_pgfault+0x2b2>
+		panic("reading free block %08x\n", blockno);
+  80036c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80036f:	89 c1                	mov    %eax,%ecx
+  800371:	48 b8 50 5d 80 00 00 	movabs $0x805d50,%rax
+  800378:	00 00 00 
+  80037b:	48 89 c2             	mov    %rax,%rdx
+  80037e:	be 3a 00 00 00       	mov    $0x3a,%esi
+  800383:	48 b8 82 5c 80 00 00 	movabs $0x805c82,%rax
+  80038a:	00 00 00 
+  80038d:	48 89 c7             	mov    %rax,%rdi
+  800390:	b8 00 00 00 00       	mov    $0x0,%eax
+  800395:	49 b8 cc 25 80 00 00 	movabs $0x8025cc,%r8
+  80039c:	00 00 00 
+  80039f:	41 ff d0             	call   *%r8
+}
+  8003a2:	90                   	nop
+  8003a3:	c9                   	leave
+  8003a4:	c3                   	ret
+
+00000000008003a5 <flush_block>:
+
+/**
+ * 如果 addr 所在的块在缓存中且被修改过，将其写回磁盘，然后清除 Dirty 位
+ */
+void flush_block(void *addr)
+{
+  8003a5:	55                   	push   %rbp
+  8003a6:	48 89 e5             	mov    %rsp,%rbp
+  8003a9:	48 83 ec 30          	sub    $0x30,%rsp
+  8003ad:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	uint32_t blockno = ((uint64_t)addr - DISKMAP) / BLKSIZE;
+  8003b1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8003b5:	48 2d 00 00 00 10    	sub    $0x10000000,%rax
+  8003bb:	48 c1 e8 0c          	shr    $0xc,%rax
+  8003bf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	int r;
+
+	if ((uint64_t)addr < DISKMAP || (uint64_t)addr >= DISKMAP + DISKSIZE)
+  8003c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8003c6:	48 3d ff ff ff 0f    	cmp    $0xfffffff,%rax
+  8003cc:	76 0e                	jbe    8003dc <flush_block+0x37>
+  8003ce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8003d2:	ba ff ff ff cf       	mov    $0xcfffffff,%edx
+  8003d7:	48 39 c2             	cmp    %rax,%rdx
+  8003da:	73 38                	jae    800414 <flush_block+0x6f>
+		panic("flush_block of bad va %08lx", (uint64_t)addr);
+  8003dc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8003e0:	48 89 c1             	mov    %rax,%rcx
+  8003e3:	48 b8 69 5d 80 00 00 	movabs $0x805d69,%rax
+  8003ea:	00 00 00 
+  8003ed:	48 89 c2             	mov    %rax,%rdx
+  8003f0:	be 46 00 00 00       	mov    $0x46,%esi
+  8003f5:	48 b8 82 5c 80 00 00 	movabs $0x805c82,%rax
+  8003fc:	00 00 00 
+  8003ff:	48 89 c7             	mov    %rax,%rdi
+  800402:	b8 00 00 00 00       	mov    $0x0,%eax
+  800407:	49 b8 cc 25 80 00 00 	movabs $0x8025cc,%r8
+  80040e:	00 00 00 
+  800411:	41 ff d0             	call   *%r8
+
+	addr = ROUNDDOWN(addr, BLKSIZE);
+  800414:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800418:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80041c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800420:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  800426:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	if (!va_is_mapped(addr) || !va_is_dirty(addr))
+  80042a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80042e:	48 89 c7             	mov    %rax,%rdi
+  800431:	48 b8 34 51 80 00 00 	movabs $0x805134,%rax
+  800438:	00 00 00 
+  80043b:	ff d0                	call   *%rax
+  80043d:	83 f0 01             	xor    $0x1,%eax
+  800440:	84 c0                	test   %al,%al
+  800442:	0f 85 11 01 00 00    	jne    800559 <flush_block+0x1b4>
+  800448:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80044c:	48 89 c7             	mov    %rax,%rdi
+  80044f:	48 b8 c0 00 80 00 00 	movabs $0x8000c0,%rax
+  800456:	00 00 00 
+  800459:	ff d0                	call   *%rax
+  80045b:	83 f0 01             	xor    $0x1,%eax
+  80045e:	84 c0                	test   %al,%al
+  800460:	0f 85 f3 00 00 00    	jne    800559 <flush_block+0x1b4>
+		return;
+	if ((r = sys_disk_io(FSDEV, (uint64_t)blockno * BLKSECTS, addr, BLKSECTS, 1)) < 0)
+  800466:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800469:	48 8d 34 c5 00 00 00 	lea    0x0(,%rax,8),%rsi
+  800470:	00 
+  800471:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800475:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  80047b:	b9 08 00 00 00       	mov    $0x8,%ecx
+  800480:	48 89 c2             	mov    %rax,%rdx
+  800483:	bf 01 00 00 00       	mov    $0x1,%edi
+  800488:	48 b8 7b 43 80 00 00 	movabs $0x80437b,%rax
+  80048f:	00 00 00 
+  800492:	ff d0                	call   *%rax
+  800494:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800497:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80049b:	79 36                	jns    8004d3 <flush_block+0x12e>
+		panic("in flush_block, sys_disk_io: %e", r);
+  80049d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8004a0:	89 c1                	mov    %eax,%ecx
+  8004a2:	48 b8 88 5d 80 00 00 	movabs $0x805d88,%rax
+  8004a9:	00 00 00 
+  8004ac:	48 89 c2             	mov    %rax,%rdx
+  8004af:	be 4c 00 00 00       	mov    $0x4c,%esi
+  8004b4:	48 b8 82 5c 80 00 00 	movabs $0x805c82,%rax
+  8004bb:	00 00 00 
+  8004be:	48 89 c7             	mov    %rax,%rdi
+  8004c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c6:	49 b8 cc 25 80 00 00 	movabs $0x8025cc,%r8
+  8004cd:	00 00 00 
+  8004d0:	41 ff d0             	call   *%r8
+	if ((r = sys_page_map(0, addr, 0, addr, uvpt[VPN(addr)] & PTE_SYSCALL)) < 0)
+  8004d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8004d7:	48 c1 e8 0c          	shr    $0xc,%rax
+  8004db:	48 89 c2             	mov    %rax,%rdx
+  8004de:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8004e5:	01 00 00 
+  8004e8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8004ec:	25 07 0e 00 00       	and    $0xe07,%eax
+  8004f1:	89 c1                	mov    %eax,%ecx
+  8004f3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8004f7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8004fb:	41 89 c8             	mov    %ecx,%r8d
+  8004fe:	48 89 d1             	mov    %rdx,%rcx
+  800501:	ba 00 00 00 00       	mov    $0x0,%edx
+  800506:	48 89 c6             	mov    %rax,%rsi
+  800509:	bf 00 00 00 00       	mov    $0x0,%edi
+  80050e:	48 b8 4d 41 80 00 00 	movabs $0x80414d,%rax
+  800515:	00 00 00 
+  800518:	ff d0                	call   *%rax
+  80051a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80051d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800521:	79 37                	jns    80055a <flush_block+0x1b5>
+		panic("in flush_block, sys_page_map: %e", r);
+  800523:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800526:	89 c1                	mov    %eax,%ecx
+  800528:	48 b8 a8 5d 80 00 00 	movabs $0x805da8,%rax
+  80052f:	00 00 00 
+  800532:	48 89 c2             	mov    %rax,%rdx
+  800535:	be 4e 00 00 00       	mov    $0x4e,%esi
+  80053a:	48 b8 82 5c 80 00 00 	movabs $0x805c82,%rax
+  800541:	00 00 00 
+  800544:	48 89 c7             	mov    %rax,%rdi
+  800547:	b8 00 00 00 00       	mov    $0x0,%eax
+  80054c:	49 b8 cc 25 80 00 00 	movabs $0x8025cc,%r8
+  800553:	00 00 00 
+  800556:	41 ff d0             	call   *%r8
+		return;
+  800559:	90                   	nop
+}
+  80055a:	c9                   	leave
+  80055b:	c3                   	ret
+
+000000000080055c <bc_init>:
+
+void bc_init(void)
+{
+  80055c:	55                   	push   %rbp
+  80055d:	48 89 e5             	mov    %rsp,%rbp
+	set_pgfault_handler(bc_pgfault);
+  800560:	48 b8 f0 00 80 00 00 	movabs $0x8000f0,%rax
+  800567:	00 00 00 
+  80056a:	48 89 c7             	mov    %rax,%rdi
+  80056d:	48 b8 93 46 80 00 00 	movabs $0x804693,%rax
+  800574:	00 00 00 
+  800577:	ff d0                	call   *%rax
+}
+  800579:	90                   	nop
+  80057a:	5d                   	pop    %rbp
+  80057b:	c3                   	ret
+
+000000000080057c <check_super>:
+/* ---------------------------- 超级块 ---------------------------- */
+
+// 检查超级块
+static void
+check_super(void)
+{
+  80057c:	55                   	push   %rbp
+  80057d:	48 89 e5             	mov    %rsp,%rbp
+	if (super->s_magic != FS_MAGIC)
+  800580:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  800587:	00 00 00 
+  80058a:	48 8b 00             	mov    (%rax),%rax
+  80058d:	8b 00                	mov    (%rax),%eax
+  80058f:	3d 61 76 6c 41       	cmp    $0x416c7661,%eax
+  800594:	74 30                	je     8005c6 <check_super+0x4a>
+		panic("bad file system magic number");
+  800596:	48 b8 d0 5d 80 00 00 	movabs $0x805dd0,%rax
+  80059d:	00 00 00 
+  8005a0:	48 89 c2             	mov    %rax,%rdx
+  8005a3:	be 15 00 00 00       	mov    $0x15,%esi
+  8005a8:	48 b8 ed 5d 80 00 00 	movabs $0x805ded,%rax
+  8005af:	00 00 00 
+  8005b2:	48 89 c7             	mov    %rax,%rdi
+  8005b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ba:	48 b9 cc 25 80 00 00 	movabs $0x8025cc,%rcx
+  8005c1:	00 00 00 
+  8005c4:	ff d1                	call   *%rcx
+
+	if (super->s_nblocks > DISKSIZE / BLKSIZE)
+  8005c6:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8005cd:	00 00 00 
+  8005d0:	48 8b 00             	mov    (%rax),%rax
+  8005d3:	8b 40 04             	mov    0x4(%rax),%eax
+  8005d6:	3d 00 00 0c 00       	cmp    $0xc0000,%eax
+  8005db:	76 30                	jbe    80060d <check_super+0x91>
+		panic("file system is too large");
+  8005dd:	48 b8 f5 5d 80 00 00 	movabs $0x805df5,%rax
+  8005e4:	00 00 00 
+  8005e7:	48 89 c2             	mov    %rax,%rdx
+  8005ea:	be 18 00 00 00       	mov    $0x18,%esi
+  8005ef:	48 b8 ed 5d 80 00 00 	movabs $0x805ded,%rax
+  8005f6:	00 00 00 
+  8005f9:	48 89 c7             	mov    %rax,%rdi
+  8005fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800601:	48 b9 cc 25 80 00 00 	movabs $0x8025cc,%rcx
+  800608:	00 00 00 
+  80060b:	ff d1                	call   *%rcx
+
+	cprintf("superblock is good\n");
+  80060d:	48 b8 0e 5e 80 00 00 	movabs $0x805e0e,%rax
+  800614:	00 00 00 
+  800617:	48 89 c7             	mov    %rax,%rdi
+  80061a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80061f:	48 ba 0f 28 80 00 00 	movabs $0x80280f,%rdx
+  800626:	00 00 00 
+  800629:	ff d2                	call   *%rdx
+}
+  80062b:	90                   	nop
+  80062c:	5d                   	pop    %rbp
+  80062d:	c3                   	ret
+
+000000000080062e <block_is_free>:
+
+/* ---------------------------- 空闲块位图 ---------------------------- */
+
+// 块 blockno 是否空闲
+bool block_is_free(uint32_t blockno)
+{
+  80062e:	55                   	push   %rbp
+  80062f:	48 89 e5             	mov    %rsp,%rbp
+  800632:	48 83 ec 08          	sub    $0x8,%rsp
+  800636:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	if (super == 0 || blockno >= super->s_nblocks)
+  800639:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  800640:	00 00 00 
+  800643:	48 8b 00             	mov    (%rax),%rax
+  800646:	48 85 c0             	test   %rax,%rax
+  800649:	74 15                	je     800660 <block_is_free+0x32>
+  80064b:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  800652:	00 00 00 
+  800655:	48 8b 00             	mov    (%rax),%rax
+  800658:	8b 40 04             	mov    0x4(%rax),%eax
+  80065b:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  80065e:	72 07                	jb     800667 <block_is_free+0x39>
+		return 0;
+  800660:	b8 00 00 00 00       	mov    $0x0,%eax
+  800665:	eb 41                	jmp    8006a8 <block_is_free+0x7a>
+	if (bitmap[blockno / 32] & (1 << (blockno % 32)))
+  800667:	48 b8 08 90 80 00 00 	movabs $0x809008,%rax
+  80066e:	00 00 00 
+  800671:	48 8b 00             	mov    (%rax),%rax
+  800674:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800677:	c1 ea 05             	shr    $0x5,%edx
+  80067a:	89 d2                	mov    %edx,%edx
+  80067c:	48 c1 e2 02          	shl    $0x2,%rdx
+  800680:	48 01 d0             	add    %rdx,%rax
+  800683:	8b 00                	mov    (%rax),%eax
+  800685:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800688:	83 e2 1f             	and    $0x1f,%edx
+  80068b:	be 01 00 00 00       	mov    $0x1,%esi
+  800690:	89 d1                	mov    %edx,%ecx
+  800692:	d3 e6                	shl    %cl,%esi
+  800694:	89 f2                	mov    %esi,%edx
+  800696:	21 d0                	and    %edx,%eax
+  800698:	85 c0                	test   %eax,%eax
+  80069a:	74 07                	je     8006a3 <block_is_free+0x75>
+		return 1;
+  80069c:	b8 01 00 00 00       	mov    $0x1,%eax
+  8006a1:	eb 05                	jmp    8006a8 <block_is_free+0x7a>
+	return 0;
+  8006a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8006a8:	c9                   	leave
+  8006a9:	c3                   	ret
+
+00000000008006aa <free_block>:
+ * 客户端保留原来的物理页(仍是其打开的文件的数据)，块被重新分配后由 bc_pgfault 分配新的物理页，
+ * 其他文件的数据不会出现在客户端的映射中
+ */
+static void
+free_block(uint32_t blockno)
+{
+  8006aa:	55                   	push   %rbp
+  8006ab:	48 89 e5             	mov    %rsp,%rbp
+  8006ae:	48 83 ec 20          	sub    $0x20,%rsp
+  8006b2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	void *addr;
+	int r;
+
+	// 块 0 永远不会被释放
+	if (blockno == 0)
+  8006b5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8006b9:	75 30                	jne    8006eb <free_block+0x41>
+		panic("attempt to free zero block");
+  8006bb:	48 b8 22 5e 80 00 00 	movabs $0x805e22,%rax
+  8006c2:	00 00 00 
+  8006c5:	48 89 c2             	mov    %rax,%rdx
+  8006c8:	be 37 00 00 00       	mov    $0x37,%esi
+  8006cd:	48 b8 ed 5d 80 00 00 	movabs $0x805ded,%rax
+  8006d4:	00 00 00 
+  8006d7:	48 89 c7             	mov    %rax,%rdi
+  8006da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006df:	48 b9 cc 25 80 00 00 	movabs $0x8025cc,%rcx
+  8006e6:	00 00 00 
+  8006e9:	ff d1                	call   *%rcx
+	addr = diskaddr(blockno);
+  8006eb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8006ee:	89 c7                	mov    %eax,%edi
+  8006f0:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  8006f7:	00 00 00 
+  8006fa:	ff d0                	call   *%rax
+  8006fc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (pageref(addr) > 1 && (r = sys_page_unmap(0, addr)) < 0)
+  800700:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800704:	48 89 c7             	mov    %rax,%rdi
+  800707:	48 b8 d5 51 80 00 00 	movabs $0x8051d5,%rax
+  80070e:	00 00 00 
+  800711:	ff d0                	call   *%rax
+  800713:	83 f8 01             	cmp    $0x1,%eax
+  800716:	7e 57                	jle    80076f <free_block+0xc5>
+  800718:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80071c:	48 89 c6             	mov    %rax,%rsi
+  80071f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800724:	48 b8 ad 41 80 00 00 	movabs $0x8041ad,%rax
+  80072b:	00 00 00 
+  80072e:	ff d0                	call   *%rax
+  800730:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800733:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800737:	79 36                	jns    80076f <free_block+0xc5>
+		panic("free_block: sys_page_unmap: %e", r);
+  800739:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80073c:	89 c1                	mov    %eax,%ecx
+  80073e:	48 b8 40 5e 80 00 00 	movabs $0x805e40,%rax
+  800745:	00 00 00 
+  800748:	48 89 c2             	mov    %rax,%rdx
+  80074b:	be 3a 00 00 00       	mov    $0x3a,%esi
+  800750:	48 b8 ed 5d 80 00 00 	movabs $0x805ded,%rax
+  800757:	00 00 00 
+  80075a:	48 89 c7             	mov    %rax,%rdi
+  80075d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800762:	49 b8 cc 25 80 00 00 	movabs $0x8025cc,%r8
+  800769:	00 00 00 
+  80076c:	41 ff d0             	call   *%r8
+	bitmap[blockno / 32] |= 1 << (blockno % 32);
+  80076f:	48 b8 08 90 80 00 00 	movabs $0x809008,%rax
+  800776:	00 00 00 
+  800779:	48 8b 00             	mov    (%rax),%rax
+  80077c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80077f:	89 d6                	mov    %edx,%esi
+  800781:	c1 ee 05             	shr    $0x5,%esi
+  800784:	89 f2                	mov    %esi,%edx
+  800786:	48 c1 e2 02          	shl    $0x2,%rdx
+  80078a:	48 01 d0             	add    %rdx,%rax
+  80078d:	8b 10                	mov    (%rax),%edx
+  80078f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800792:	83 e0 1f             	and    $0x1f,%eax
+  800795:	bf 01 00 00 00       	mov    $0x1,%edi
+  80079a:	89 c1                	mov    %eax,%ecx
+  80079c:	d3 e7                	shl    %cl,%edi
+  80079e:	89 f8                	mov    %edi,%eax
+  8007a0:	89 c7                	mov    %eax,%edi
+  8007a2:	48 b8 08 90 80 00 00 	movabs $0x809008,%rax
+  8007a9:	00 00 00 
+  8007ac:	48 8b 00             	mov    (%rax),%rax
+  8007af:	89 f1                	mov    %esi,%ecx
+  8007b1:	48 c1 e1 02          	shl    $0x2,%rcx
+  8007b5:	48 01 c8             	add    %rcx,%rax
+  8007b8:	09 fa                	or     %edi,%edx
+  8007ba:	89 10                	mov    %edx,(%rax)
+}
+  8007bc:	90                   	nop
+  8007bd:	c9                   	leave
+  8007be:	c3                   	ret
+
+00000000008007bf <alloc_block>:
+ * 在位图中查找一个空闲块并标记为已使用，返回块号
+ * 修改位图后立即将其写回磁盘，以保持位图的一致性
+ * 没有空闲块时返回 -E_NO_DISK
+ */
+int alloc_block(void)
+{
+  8007bf:	55                   	push   %rbp
+  8007c0:	48 89 e5             	mov    %rsp,%rbp
+  8007c3:	48 83 ec 10          	sub    $0x10,%rsp
+	uint32_t blockno;
+
+	for (blockno = 2; blockno < super->s_nblocks; blockno++)
+  8007c7:	c7 45 fc 02 00 00 00 	movl   $0x2,-0x4(%rbp)
+  8007ce:	e9 98 00 00 00       	jmp    80086b <alloc_block+0xac>
+		if (block_is_free(blockno))
+  8007d3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8007d6:	89 c7                	mov    %eax,%edi
+  8007d8:	48 b8 2e 06 80 00 00 	movabs $0x80062e,%rax
+  8007df:	00 00 00 
+  8007e2:	ff d0                	call   *%rax
+  8007e4:	84 c0                	test   %al,%al
+  8007e6:	74 7f                	je     800867 <alloc_block+0xa8>
+		{
+			bitmap[blockno / 32] &= ~(1 << (blockno % 32));
+  8007e8:	48 b8 08 90 80 00 00 	movabs $0x809008,%rax
+  8007ef:	00 00 00 
+  8007f2:	48 8b 00             	mov    (%rax),%rax
+  8007f5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8007f8:	89 d6                	mov    %edx,%esi
+  8007fa:	c1 ee 05             	shr    $0x5,%esi
+  8007fd:	89 f2                	mov    %esi,%edx
+  8007ff:	48 c1 e2 02          	shl    $0x2,%rdx
+  800803:	48 01 d0             	add    %rdx,%rax
+  800806:	8b 10                	mov    (%rax),%edx
+  800808:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80080b:	83 e0 1f             	and    $0x1f,%eax
+  80080e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800813:	89 c1                	mov    %eax,%ecx
+  800815:	d3 e7                	shl    %cl,%edi
+  800817:	89 f8                	mov    %edi,%eax
+  800819:	f7 d0                	not    %eax
+  80081b:	89 c7                	mov    %eax,%edi
+  80081d:	48 b8 08 90 80 00 00 	movabs $0x809008,%rax
+  800824:	00 00 00 
+  800827:	48 8b 00             	mov    (%rax),%rax
+  80082a:	89 f1                	mov    %esi,%ecx
+  80082c:	48 c1 e1 02          	shl    $0x2,%rcx
+  800830:	48 01 c8             	add    %rcx,%rax
+  800833:	21 fa                	and    %edi,%edx
+  800835:	89 10                	mov    %edx,(%rax)
+			flush_block(&bitmap[blockno / 32]);
+  800837:	48 b8 08 90 80 00 00 	movabs $0x809008,%rax
+  80083e:	00 00 00 
+  800841:	48 8b 00             	mov    (%rax),%rax
+  800844:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800847:	c1 ea 05             	shr    $0x5,%edx
+  80084a:	89 d2                	mov    %edx,%edx
+  80084c:	48 c1 e2 02          	shl    $0x2,%rdx
+  800850:	48 01 d0             	add    %rdx,%rax
+  800853:	48 89 c7             	mov    %rax,%rdi
+  800856:	48 b8 a5 03 80 00 00 	movabs $0x8003a5,%rax
+  80085d:	00 00 00 
+  800860:	ff d0                	call   *%rax
+			return blockno;
+  800862:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800865:	eb 22                	jmp    800889 <alloc_block+0xca>
+	for (blockno = 2; blockno < super->s_nblocks; blockno++)
+  800867:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80086b:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  800872:	00 00 00 
+  800875:	48 8b 00             	mov    (%rax),%rax
+  800878:	8b 40 04             	mov    0x4(%rax),%eax
+  80087b:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  80087e:	0f 82 4f ff ff ff    	jb     8007d3 <alloc_block+0x14>
+		}
+	return -E_NO_DISK;
+  800884:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+}
+  800889:	c9                   	leave
+  80088a:	c3                   	ret
+
+000000000080088b <check_bitmap>:
+
+// 检查保留块和位图块都已标记为使用
+static void
+check_bitmap(void)
+{
+  80088b:	55                   	push   %rbp
+  80088c:	48 89 e5             	mov    %rsp,%rbp
+  80088f:	48 83 ec 10          	sub    $0x10,%rsp
+	uint32_t i;
+
+	// 确保所有位图块都标记为使用
+	for (i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  800893:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80089a:	eb 5a                	jmp    8008f6 <check_bitmap+0x6b>
+		assert(!block_is_free(2 + i));
+  80089c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80089f:	83 c0 02             	add    $0x2,%eax
+  8008a2:	89 c7                	mov    %eax,%edi
+  8008a4:	48 b8 2e 06 80 00 00 	movabs $0x80062e,%rax
+  8008ab:	00 00 00 
+  8008ae:	ff d0                	call   *%rax
+  8008b0:	84 c0                	test   %al,%al
+  8008b2:	74 3e                	je     8008f2 <check_bitmap+0x67>
+  8008b4:	48 b8 5f 5e 80 00 00 	movabs $0x805e5f,%rax
+  8008bb:	00 00 00 
+  8008be:	48 89 c1             	mov    %rax,%rcx
+  8008c1:	48 b8 75 5e 80 00 00 	movabs $0x805e75,%rax
+  8008c8:	00 00 00 
+  8008cb:	48 89 c2             	mov    %rax,%rdx
+  8008ce:	be 59 00 00 00       	mov    $0x59,%esi
+  8008d3:	48 b8 ed 5d 80 00 00 	movabs $0x805ded,%rax
+  8008da:	00 00 00 
+  8008dd:	48 89 c7             	mov    %rax,%rdi
+  8008e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e5:	49 b8 cc 25 80 00 00 	movabs $0x8025cc,%r8
+  8008ec:	00 00 00 
+  8008ef:	41 ff d0             	call   *%r8
+	for (i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  8008f2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8008f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8008f9:	c1 e0 0f             	shl    $0xf,%eax
+  8008fc:	89 c2                	mov    %eax,%edx
+  8008fe:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  800905:	00 00 00 
+  800908:	48 8b 00             	mov    (%rax),%rax
+  80090b:	8b 40 04             	mov    0x4(%rax),%eax
+  80090e:	39 c2                	cmp    %eax,%edx
+  800910:	72 8a                	jb     80089c <check_bitmap+0x11>
+
+	// 确保保留块和超级块都标记为使用
+	assert(!block_is_free(0));
+  800912:	bf 00 00 00 00       	mov    $0x0,%edi
+  800917:	48 b8 2e 06 80 00 00 	movabs $0x80062e,%rax
+  80091e:	00 00 00 
+  800921:	ff d0                	call   *%rax
+  800923:	84 c0                	test   %al,%al
+  800925:	74 3e                	je     800965 <check_bitmap+0xda>
+  800927:	48 b8 8a 5e 80 00 00 	movabs $0x805e8a,%rax
+  80092e:	00 00 00 
+  800931:	48 89 c1             	mov    %rax,%rcx
+  800934:	48 b8 75 5e 80 00 00 	movabs $0x805e75,%rax
+  80093b:	00 00 00 
+  80093e:	48 89 c2             	mov    %rax,%rdx
+  800941:	be 5c 00 00 00       	mov    $0x5c,%esi
+  800946:	48 b8 ed 5d 80 00 00 	movabs $0x805ded,%rax
+  80094d:	00 00 00 
+  800950:	48 89 c7             	mov    %rax,%rdi
+  800953:	b8 00 00 00 00       	mov    $0x0,%eax
+  800958:	49 b8 cc 25 80 00 00 	movabs $0x8025cc,%r8
+  80095f:	00 00 00 
+  800962:	41 ff d0             	call   *%r8
+	assert(!block_is_free(1));
+  800965:	bf 01 00 00 00       	mov    $0x1,%edi
+  80096a:	48 b8 2e 06 80 00 00 	movabs $0x80062e,%rax
+  800971:	00 00 00 
+  800974:	ff d0                	call   *%rax
+  800976:	84 c0                	test   %al,%al
+  800978:	74 3e                	je     8009b8 <check_bitmap+0x12d>
+  80097a:	48 b8 9c 5e 80 00 00 	movabs $0x805e9c,%rax
+  800981:	00 00 00 
+  800984:	48 89 c1             	mov    %rax,%rcx
+  800987:	48 b8 75 5e 80 00 00 	movabs $0x805e75,%rax
+  80098e:	00 00 00 
+  800991:	48 89 c2             	mov    %rax,%rdx
+  800994:	be 5d 00 00 00       	mov    $0x5d,%esi
+  800999:	48 b8 ed 5d 80 00 00 	movabs $0x805ded,%rax
+  8009a0:	00 00 00 
+  8009a3:	48 89 c7             	mov    %rax,%rdi
+  8009a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ab:	49 b8 cc 25 80 00 00 	movabs $0x8025cc,%r8
+  8009b2:	00 00 00 
+  8009b5:	41 ff d0             	call   *%r8
+
+	cprintf("bitmap is good\n");
+  8009b8:	48 b8 ae 5e 80 00 00 	movabs $0x805eae,%rax
+  8009bf:	00 00 00 
+  8009c2:	48 89 c7             	mov    %rax,%rdi
+  8009c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ca:	48 ba 0f 28 80 00 00 	movabs $0x80280f,%rdx
+  8009d1:	00 00 00 
+  8009d4:	ff d2                	call   *%rdx
+}
+  8009d6:	90                   	nop
+  8009d7:	c9                   	leave
+  8009d8:	c3                   	ret
+
+00000000008009d9 <fs_init>:
+
+/* ---------------------------- 文件系统结构 ---------------------------- */
+
+// 初始化文件系统
+void fs_init(void)
+{
+  8009d9:	55                   	push   %rbp
+  8009da:	48 89 e5             	mov    %rsp,%rbp
+	static_assert(sizeof(struct File) == 256);
+
+	bc_init();
+  8009dd:	48 b8 5c 05 80 00 00 	movabs $0x80055c,%rax
+  8009e4:	00 00 00 
+  8009e7:	ff d0                	call   *%rax
+
+	// 设置超级块和位图指针，首次访问时块缓存从磁盘读入
+	super = diskaddr(1);
+  8009e9:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009ee:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  8009f5:	00 00 00 
+  8009f8:	ff d0                	call   *%rax
+  8009fa:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  800a01:	00 00 00 
+  800a04:	48 89 02             	mov    %rax,(%rdx)
+	check_super();
+  800a07:	48 b8 7c 05 80 00 00 	movabs $0x80057c,%rax
+  800a0e:	00 00 00 
+  800a11:	ff d0                	call   *%rax
+
+	bitmap = diskaddr(2);
+  800a13:	bf 02 00 00 00       	mov    $0x2,%edi
+  800a18:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  800a1f:	00 00 00 
+  800a22:	ff d0                	call   *%rax
+  800a24:	48 ba 08 90 80 00 00 	movabs $0x809008,%rdx
+  800a2b:	00 00 00 
+  800a2e:	48 89 02             	mov    %rax,(%rdx)
+	check_bitmap();
+  800a31:	48 b8 8b 08 80 00 00 	movabs $0x80088b,%rax
+  800a38:	00 00 00 
+  800a3b:	ff d0                	call   *%rax
+}
+  800a3d:	90                   	nop
+  800a3e:	5d                   	pop    %rbp
+  800a3f:	c3                   	ret
+
+0000000000800a40 <file_block_walk>:
+ *   -E_NO_DISK: 无法分配间接块
+ *   -E_INVAL: filebno 超出范围
+ */
+static int
+file_block_walk(struct File *f, uint32_t filebno, uint32_t **ppdiskbno, bool alloc)
+{
+  800a40:	55                   	push   %rbp
+  800a41:	48 89 e5             	mov    %rsp,%rbp
+  800a44:	48 83 ec 30          	sub    $0x30,%rsp
+  800a48:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a4c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  800a4f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800a53:	89 c8                	mov    %ecx,%eax
+  800a55:	88 45 e0             	mov    %al,-0x20(%rbp)
+	int r;
+
+	if (filebno >= NDIRECT + NINDIRECT)
+  800a58:	81 7d e4 09 04 00 00 	cmpl   $0x409,-0x1c(%rbp)
+  800a5f:	76 0a                	jbe    800a6b <file_block_walk+0x2b>
+		return -E_INVAL;
+  800a61:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a66:	e9 ff 00 00 00       	jmp    800b6a <file_block_walk+0x12a>
+	if (filebno < NDIRECT)
+  800a6b:	83 7d e4 09          	cmpl   $0x9,-0x1c(%rbp)
+  800a6f:	77 2b                	ja     800a9c <file_block_walk+0x5c>
+	{
+		*ppdiskbno = &f->f_direct[filebno];
+  800a71:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800a74:	48 83 c0 20          	add    $0x20,%rax
+  800a78:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  800a7f:	00 
+  800a80:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a84:	48 01 d0             	add    %rdx,%rax
+  800a87:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a8b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a8f:	48 89 10             	mov    %rdx,(%rax)
+		return 0;
+  800a92:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a97:	e9 ce 00 00 00       	jmp    800b6a <file_block_walk+0x12a>
+	}
+	if (!f->f_indirect)
+  800a9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aa0:	8b 80 b0 00 00 00    	mov    0xb0(%rax),%eax
+  800aa6:	85 c0                	test   %eax,%eax
+  800aa8:	0f 85 89 00 00 00    	jne    800b37 <file_block_walk+0xf7>
+	{
+		if (!alloc)
+  800aae:	0f b6 45 e0          	movzbl -0x20(%rbp),%eax
+  800ab2:	83 f0 01             	xor    $0x1,%eax
+  800ab5:	84 c0                	test   %al,%al
+  800ab7:	74 0a                	je     800ac3 <file_block_walk+0x83>
+			return -E_NOT_FOUND;
+  800ab9:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  800abe:	e9 a7 00 00 00       	jmp    800b6a <file_block_walk+0x12a>
+		if ((r = alloc_block()) < 0)
+  800ac3:	48 b8 bf 07 80 00 00 	movabs $0x8007bf,%rax
+  800aca:	00 00 00 
+  800acd:	ff d0                	call   *%rax
+  800acf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800ad2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800ad6:	79 08                	jns    800ae0 <file_block_walk+0xa0>
+			return r;
+  800ad8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800adb:	e9 8a 00 00 00       	jmp    800b6a <file_block_walk+0x12a>
+		f->f_indirect = r;
+  800ae0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800ae3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ae7:	89 90 b0 00 00 00    	mov    %edx,0xb0(%rax)
+		memset(diskaddr(r), 0, BLKSIZE);
+  800aed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800af0:	89 c7                	mov    %eax,%edi
+  800af2:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  800af9:	00 00 00 
+  800afc:	ff d0                	call   *%rax
+  800afe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800b03:	be 00 00 00 00       	mov    $0x0,%esi
+  800b08:	48 89 c7             	mov    %rax,%rdi
+  800b0b:	48 b8 21 3a 80 00 00 	movabs $0x803a21,%rax
+  800b12:	00 00 00 
+  800b15:	ff d0                	call   *%rax
+		flush_block(diskaddr(r));
+  800b17:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800b1a:	89 c7                	mov    %eax,%edi
+  800b1c:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  800b23:	00 00 00 
+  800b26:	ff d0                	call   *%rax
+  800b28:	48 89 c7             	mov    %rax,%rdi
+  800b2b:	48 b8 a5 03 80 00 00 	movabs $0x8003a5,%rax
+  800b32:	00 00 00 
+  800b35:	ff d0                	call   *%rax
+	}
+	*ppdiskbno = (uint32_t *)diskaddr(f->f_indirect) + (filebno - NDIRECT);
+  800b37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b3b:	8b 80 b0 00 00 00    	mov    0xb0(%rax),%eax
+  800b41:	89 c7                	mov    %eax,%edi
+  800b43:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  800b4a:	00 00 00 
+  800b4d:	ff d0                	call   *%rax
+  800b4f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800b52:	83 ea 0a             	sub    $0xa,%edx
+  800b55:	89 d2                	mov    %edx,%edx
+  800b57:	48 c1 e2 02          	shl    $0x2,%rdx
+  800b5b:	48 01 c2             	add    %rax,%rdx
+  800b5e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b62:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  800b65:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b6a:	c9                   	leave
+  800b6b:	c3                   	ret
+
+0000000000800b6c <file_get_block>:
+ * 错误:
+ *   -E_NO_DISK: 无法分配块
+ *   -E_INVAL: filebno 超出范围
+ */
+int file_get_block(struct File *f, uint32_t filebno, char **blk)
+{
+  800b6c:	55                   	push   %rbp
+  800b6d:	48 89 e5             	mov    %rsp,%rbp
+  800b70:	48 83 ec 30          	sub    $0x30,%rsp
+  800b74:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b78:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  800b7b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint32_t *pdiskbno;
+	int r;
+
+	if ((r = file_block_walk(f, filebno, &pdiskbno, 1)) < 0)
+  800b7f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  800b83:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800b86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b8a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b8f:	48 89 c7             	mov    %rax,%rdi
+  800b92:	48 b8 40 0a 80 00 00 	movabs $0x800a40,%rax
+  800b99:	00 00 00 
+  800b9c:	ff d0                	call   *%rax
+  800b9e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800ba1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800ba5:	79 08                	jns    800baf <file_get_block+0x43>
+		return r;
+  800ba7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800baa:	e9 97 00 00 00       	jmp    800c46 <file_get_block+0xda>
+	if (!*pdiskbno)
+  800baf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800bb3:	8b 00                	mov    (%rax),%eax
+  800bb5:	85 c0                	test   %eax,%eax
+  800bb7:	75 6d                	jne    800c26 <file_get_block+0xba>
+	{
+		if ((r = alloc_block()) < 0)
+  800bb9:	48 b8 bf 07 80 00 00 	movabs $0x8007bf,%rax
+  800bc0:	00 00 00 
+  800bc3:	ff d0                	call   *%rax
+  800bc5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800bc8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800bcc:	79 05                	jns    800bd3 <file_get_block+0x67>
+			return r;
+  800bce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800bd1:	eb 73                	jmp    800c46 <file_get_block+0xda>
+		*pdiskbno = r;
+  800bd3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800bd7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800bda:	89 10                	mov    %edx,(%rax)
+		memset(diskaddr(r), 0, BLKSIZE);
+  800bdc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800bdf:	89 c7                	mov    %eax,%edi
+  800be1:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  800be8:	00 00 00 
+  800beb:	ff d0                	call   *%rax
+  800bed:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800bf2:	be 00 00 00 00       	mov    $0x0,%esi
+  800bf7:	48 89 c7             	mov    %rax,%rdi
+  800bfa:	48 b8 21 3a 80 00 00 	movabs $0x803a21,%rax
+  800c01:	00 00 00 
+  800c04:	ff d0                	call   *%rax
+		flush_block(diskaddr(r));
+  800c06:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800c09:	89 c7                	mov    %eax,%edi
+  800c0b:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  800c12:	00 00 00 
+  800c15:	ff d0                	call   *%rax
+  800c17:	48 89 c7             	mov    %rax,%rdi
+  800c1a:	48 b8 a5 03 80 00 00 	movabs $0x8003a5,%rax
+  800c21:	00 00 00 
+  800c24:	ff d0                	call   *%rax
+	}
+	*blk = diskaddr(*pdiskbno);
+  800c26:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c2a:	8b 00                	mov    (%rax),%eax
+  800c2c:	89 c7                	mov    %eax,%edi
+  800c2e:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  800c35:	00 00 00 
+  800c38:	ff d0                	call   *%rax
+  800c3a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800c3e:	48 89 02             	mov    %rax,(%rdx)
+	return 0;
+  800c41:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c46:	c9                   	leave
+  800c47:	c3                   	ret
+
+0000000000800c48 <dir_lookup>:
+ * 在目录 dir 中查找名为 name 的文件，找到时 *file 指向该文件的 struct File
+ * 错误: -E_NOT_FOUND
+ */
+static int
+dir_lookup(struct File *dir, const char *name, struct File **file)
+{
+  800c48:	55                   	push   %rbp
+  800c49:	48 89 e5             	mov    %rsp,%rbp
+  800c4c:	48 83 ec 40          	sub    $0x40,%rsp
+  800c50:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800c54:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  800c58:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	uint32_t i, j, nblock;
+	char *blk;
+	struct File *f;
+	int r;
+
+	assert((dir->f_size % BLKSIZE) == 0);
+  800c5c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c60:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  800c66:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800c6b:	85 c0                	test   %eax,%eax
+  800c6d:	74 3e                	je     800cad <dir_lookup+0x65>
+  800c6f:	48 b8 be 5e 80 00 00 	movabs $0x805ebe,%rax
+  800c76:	00 00 00 
+  800c79:	48 89 c1             	mov    %rax,%rcx
+  800c7c:	48 b8 75 5e 80 00 00 	movabs $0x805e75,%rax
+  800c83:	00 00 00 
+  800c86:	48 89 c2             	mov    %rax,%rdx
+  800c89:	be bb 00 00 00       	mov    $0xbb,%esi
+  800c8e:	48 b8 ed 5d 80 00 00 	movabs $0x805ded,%rax
+  800c95:	00 00 00 
+  800c98:	48 89 c7             	mov    %rax,%rdi
+  800c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca0:	49 b8 cc 25 80 00 00 	movabs $0x8025cc,%r8
+  800ca7:	00 00 00 
+  800caa:	41 ff d0             	call   *%r8
+	nblock = dir->f_size / BLKSIZE;
+  800cad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800cb1:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  800cb7:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  800cbd:	85 c0                	test   %eax,%eax
+  800cbf:	0f 48 c2             	cmovs  %edx,%eax
+  800cc2:	c1 f8 0c             	sar    $0xc,%eax
+  800cc5:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	for (i = 0; i < nblock; i++)
+  800cc8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800ccf:	e9 96 00 00 00       	jmp    800d6a <dir_lookup+0x122>
+	{
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+  800cd4:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  800cd8:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  800cdb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800cdf:	89 ce                	mov    %ecx,%esi
+  800ce1:	48 89 c7             	mov    %rax,%rdi
+  800ce4:	48 b8 6c 0b 80 00 00 	movabs $0x800b6c,%rax
+  800ceb:	00 00 00 
+  800cee:	ff d0                	call   *%rax
+  800cf0:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  800cf3:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  800cf7:	79 05                	jns    800cfe <dir_lookup+0xb6>
+			return r;
+  800cf9:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800cfc:	eb 7d                	jmp    800d7b <dir_lookup+0x133>
+		f = (struct File *)blk;
+  800cfe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d02:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		for (j = 0; j < BLKFILES; j++)
+  800d06:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  800d0d:	eb 51                	jmp    800d60 <dir_lookup+0x118>
+			if (strcmp(f[j].f_name, name) == 0)
+  800d0f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800d12:	48 c1 e0 08          	shl    $0x8,%rax
+  800d16:	48 89 c2             	mov    %rax,%rdx
+  800d19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d1d:	48 01 d0             	add    %rdx,%rax
+  800d20:	48 89 c2             	mov    %rax,%rdx
+  800d23:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d27:	48 89 c6             	mov    %rax,%rsi
+  800d2a:	48 89 d7             	mov    %rdx,%rdi
+  800d2d:	48 b8 f2 35 80 00 00 	movabs $0x8035f2,%rax
+  800d34:	00 00 00 
+  800d37:	ff d0                	call   *%rax
+  800d39:	85 c0                	test   %eax,%eax
+  800d3b:	75 1f                	jne    800d5c <dir_lookup+0x114>
+			{
+				*file = &f[j];
+  800d3d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800d40:	48 c1 e0 08          	shl    $0x8,%rax
+  800d44:	48 89 c2             	mov    %rax,%rdx
+  800d47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d4b:	48 01 c2             	add    %rax,%rdx
+  800d4e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d52:	48 89 10             	mov    %rdx,(%rax)
+				return 0;
+  800d55:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d5a:	eb 1f                	jmp    800d7b <dir_lookup+0x133>
+		for (j = 0; j < BLKFILES; j++)
+  800d5c:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+  800d60:	83 7d f8 0f          	cmpl   $0xf,-0x8(%rbp)
+  800d64:	76 a9                	jbe    800d0f <dir_lookup+0xc7>
+	for (i = 0; i < nblock; i++)
+  800d66:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800d6a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d6d:	3b 45 f4             	cmp    -0xc(%rbp),%eax
+  800d70:	0f 82 5e ff ff ff    	jb     800cd4 <dir_lookup+0x8c>
+			}
+	}
+	return -E_NOT_FOUND;
+  800d76:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+}
+  800d7b:	c9                   	leave
+  800d7c:	c3                   	ret
+
+0000000000800d7d <dir_alloc_file>:
+
+// 在目录 dir 中找到一个空闲的 struct File(必要时扩展目录)，存入 *file
+static int
+dir_alloc_file(struct File *dir, struct File **file)
+{
+  800d7d:	55                   	push   %rbp
+  800d7e:	48 89 e5             	mov    %rsp,%rbp
+  800d81:	48 83 ec 30          	sub    $0x30,%rsp
+  800d85:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800d89:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	uint32_t nblock, i, j;
+	char *blk;
+	struct File *f;
+	int r;
+
+	assert((dir->f_size % BLKSIZE) == 0);
+  800d8d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d91:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  800d97:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800d9c:	85 c0                	test   %eax,%eax
+  800d9e:	74 3e                	je     800dde <dir_alloc_file+0x61>
+  800da0:	48 b8 be 5e 80 00 00 	movabs $0x805ebe,%rax
+  800da7:	00 00 00 
+  800daa:	48 89 c1             	mov    %rax,%rcx
+  800dad:	48 b8 75 5e 80 00 00 	movabs $0x805e75,%rax
+  800db4:	00 00 00 
+  800db7:	48 89 c2             	mov    %rax,%rdx
+  800dba:	be d5 00 00 00       	mov    $0xd5,%esi
+  800dbf:	48 b8 ed 5d 80 00 00 	movabs $0x805ded,%rax
+  800dc6:	00 00 00 
+  800dc9:	48 89 c7             	mov    %rax,%rdi
+  800dcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dd1:	49 b8 cc 25 80 00 00 	movabs $0x8025cc,%r8
+  800dd8:	00 00 00 
+  800ddb:	41 ff d0             	call   *%r8
+	nblock = dir->f_size / BLKSIZE;
+  800dde:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800de2:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  800de8:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  800dee:	85 c0                	test   %eax,%eax
+  800df0:	0f 48 c2             	cmovs  %edx,%eax
+  800df3:	c1 f8 0c             	sar    $0xc,%eax
+  800df6:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	for (i = 0; i < nblock; i++)
+  800df9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800e00:	e9 83 00 00 00       	jmp    800e88 <dir_alloc_file+0x10b>
+	{
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+  800e05:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  800e09:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  800e0c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800e10:	89 ce                	mov    %ecx,%esi
+  800e12:	48 89 c7             	mov    %rax,%rdi
+  800e15:	48 b8 6c 0b 80 00 00 	movabs $0x800b6c,%rax
+  800e1c:	00 00 00 
+  800e1f:	ff d0                	call   *%rax
+  800e21:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  800e24:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  800e28:	79 08                	jns    800e32 <dir_alloc_file+0xb5>
+			return r;
+  800e2a:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800e2d:	e9 be 00 00 00       	jmp    800ef0 <dir_alloc_file+0x173>
+		f = (struct File *)blk;
+  800e32:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e36:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		for (j = 0; j < BLKFILES; j++)
+  800e3a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  800e41:	eb 3b                	jmp    800e7e <dir_alloc_file+0x101>
+			if (f[j].f_name[0] == '\0')
+  800e43:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800e46:	48 c1 e0 08          	shl    $0x8,%rax
+  800e4a:	48 89 c2             	mov    %rax,%rdx
+  800e4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e51:	48 01 d0             	add    %rdx,%rax
+  800e54:	0f b6 00             	movzbl (%rax),%eax
+  800e57:	84 c0                	test   %al,%al
+  800e59:	75 1f                	jne    800e7a <dir_alloc_file+0xfd>
+			{
+				*file = &f[j];
+  800e5b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800e5e:	48 c1 e0 08          	shl    $0x8,%rax
+  800e62:	48 89 c2             	mov    %rax,%rdx
+  800e65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e69:	48 01 c2             	add    %rax,%rdx
+  800e6c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e70:	48 89 10             	mov    %rdx,(%rax)
+				return 0;
+  800e73:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e78:	eb 76                	jmp    800ef0 <dir_alloc_file+0x173>
+		for (j = 0; j < BLKFILES; j++)
+  800e7a:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+  800e7e:	83 7d f8 0f          	cmpl   $0xf,-0x8(%rbp)
+  800e82:	76 bf                	jbe    800e43 <dir_alloc_file+0xc6>
+	for (i = 0; i < nblock; i++)
+  800e84:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800e88:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e8b:	3b 45 f4             	cmp    -0xc(%rbp),%eax
+  800e8e:	0f 82 71 ff ff ff    	jb     800e05 <dir_alloc_file+0x88>
+			}
+	}
+	dir->f_size += BLKSIZE;
+  800e94:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800e98:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  800e9e:	8d 90 00 10 00 00    	lea    0x1000(%rax),%edx
+  800ea4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ea8:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	if ((r = file_get_block(dir, i, &blk)) < 0)
+  800eae:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  800eb2:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  800eb5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800eb9:	89 ce                	mov    %ecx,%esi
+  800ebb:	48 89 c7             	mov    %rax,%rdi
+  800ebe:	48 b8 6c 0b 80 00 00 	movabs $0x800b6c,%rax
+  800ec5:	00 00 00 
+  800ec8:	ff d0                	call   *%rax
+  800eca:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  800ecd:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  800ed1:	79 05                	jns    800ed8 <dir_alloc_file+0x15b>
+		return r;
+  800ed3:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800ed6:	eb 18                	jmp    800ef0 <dir_alloc_file+0x173>
+	f = (struct File *)blk;
+  800ed8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800edc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	*file = &f[0];
+  800ee0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ee4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ee8:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  800eeb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ef0:	c9                   	leave
+  800ef1:	c3                   	ret
+
+0000000000800ef2 <skip_slash>:
+
+// 跳过开头的 '/'
+static const char *
+skip_slash(const char *p)
+{
+  800ef2:	55                   	push   %rbp
+  800ef3:	48 89 e5             	mov    %rsp,%rbp
+  800ef6:	48 83 ec 08          	sub    $0x8,%rsp
+  800efa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	while (*p == '/')
+  800efe:	eb 05                	jmp    800f05 <skip_slash+0x13>
+		p++;
+  800f00:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+	while (*p == '/')
+  800f05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800f09:	0f b6 00             	movzbl (%rax),%eax
+  800f0c:	3c 2f                	cmp    $0x2f,%al
+  800f0e:	74 f0                	je     800f00 <skip_slash+0xe>
+	return p;
+  800f10:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800f14:	c9                   	leave
+  800f15:	c3                   	ret
+
+0000000000800f16 <walk_path>:
+ * 成功时 *pf 为文件，*pdir 为其所在目录
+ * 只有最后一个路径分量不存在时，*pdir 为其所在目录、*pf 为 0，lastelem 中存放该分量，返回 -E_NOT_FOUND
+ */
+static int
+walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem)
+{
+  800f16:	55                   	push   %rbp
+  800f17:	48 89 e5             	mov    %rsp,%rbp
+  800f1a:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800f21:	48 89 bd 48 ff ff ff 	mov    %rdi,-0xb8(%rbp)
+  800f28:	48 89 b5 40 ff ff ff 	mov    %rsi,-0xc0(%rbp)
+  800f2f:	48 89 95 38 ff ff ff 	mov    %rdx,-0xc8(%rbp)
+  800f36:	48 89 8d 30 ff ff ff 	mov    %rcx,-0xd0(%rbp)
+	const char *p;
+	char name[MAXNAMELEN];
+	struct File *dir, *f;
+	int r;
+
+	path = skip_slash(path);
+  800f3d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  800f44:	48 89 c7             	mov    %rax,%rdi
+  800f47:	48 b8 f2 0e 80 00 00 	movabs $0x800ef2,%rax
+  800f4e:	00 00 00 
+  800f51:	ff d0                	call   *%rax
+  800f53:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	f = &super->s_root;
+  800f5a:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  800f61:	00 00 00 
+  800f64:	48 8b 00             	mov    (%rax),%rax
+  800f67:	48 83 c0 08          	add    $0x8,%rax
+  800f6b:	48 89 85 58 ff ff ff 	mov    %rax,-0xa8(%rbp)
+	dir = 0;
+  800f72:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  800f79:	00 
+	name[0] = 0;
+  800f7a:	c6 85 60 ff ff ff 00 	movb   $0x0,-0xa0(%rbp)
+
+	if (pdir)
+  800f81:	48 83 bd 40 ff ff ff 	cmpq   $0x0,-0xc0(%rbp)
+  800f88:	00 
+  800f89:	74 0e                	je     800f99 <walk_path+0x83>
+		*pdir = 0;
+  800f8b:	48 8b 85 40 ff ff ff 	mov    -0xc0(%rbp),%rax
+  800f92:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	*pf = 0;
+  800f99:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  800fa0:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	while (*path != '\0')
+  800fa7:	e9 61 01 00 00       	jmp    80110d <walk_path+0x1f7>
+	{
+		dir = f;
+  800fac:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  800fb3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+		p = path;
+  800fb7:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  800fbe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+		while (*path != '/' && *path != '\0')
+  800fc2:	eb 08                	jmp    800fcc <walk_path+0xb6>
+			path++;
+  800fc4:	48 83 85 48 ff ff ff 	addq   $0x1,-0xb8(%rbp)
+  800fcb:	01 
+		while (*path != '/' && *path != '\0')
+  800fcc:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  800fd3:	0f b6 00             	movzbl (%rax),%eax
+  800fd6:	3c 2f                	cmp    $0x2f,%al
+  800fd8:	74 0e                	je     800fe8 <walk_path+0xd2>
+  800fda:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  800fe1:	0f b6 00             	movzbl (%rax),%eax
+  800fe4:	84 c0                	test   %al,%al
+  800fe6:	75 dc                	jne    800fc4 <walk_path+0xae>
+		if (path - p >= MAXNAMELEN)
+  800fe8:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  800fef:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  800ff3:	48 83 f8 7f          	cmp    $0x7f,%rax
+  800ff7:	7e 0a                	jle    801003 <walk_path+0xed>
+			return -E_BAD_PATH;
+  800ff9:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  800ffe:	e9 4a 01 00 00       	jmp    80114d <walk_path+0x237>
+		memmove(name, p, path - p);
+  801003:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80100a:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  80100e:	48 89 c2             	mov    %rax,%rdx
+  801011:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801015:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  80101c:	48 89 ce             	mov    %rcx,%rsi
+  80101f:	48 89 c7             	mov    %rax,%rdi
+  801022:	48 b8 22 3b 80 00 00 	movabs $0x803b22,%rax
+  801029:	00 00 00 
+  80102c:	ff d0                	call   *%rax
+		name[path - p] = '\0';
+  80102e:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801035:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  801039:	c6 84 05 60 ff ff ff 	movb   $0x0,-0xa0(%rbp,%rax,1)
+  801040:	00 
+		path = skip_slash(path);
+  801041:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801048:	48 89 c7             	mov    %rax,%rdi
+  80104b:	48 b8 f2 0e 80 00 00 	movabs $0x800ef2,%rax
+  801052:	00 00 00 
+  801055:	ff d0                	call   *%rax
+  801057:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+
+		if (dir->f_type != FTYPE_DIR)
+  80105e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801062:	8b 80 84 00 00 00    	mov    0x84(%rax),%eax
+  801068:	83 f8 01             	cmp    $0x1,%eax
+  80106b:	74 0a                	je     801077 <walk_path+0x161>
+			return -E_NOT_FOUND;
+  80106d:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801072:	e9 d6 00 00 00       	jmp    80114d <walk_path+0x237>
+
+		if ((r = dir_lookup(dir, name, &f)) < 0)
+  801077:	48 8d 95 58 ff ff ff 	lea    -0xa8(%rbp),%rdx
+  80107e:	48 8d 8d 60 ff ff ff 	lea    -0xa0(%rbp),%rcx
+  801085:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801089:	48 89 ce             	mov    %rcx,%rsi
+  80108c:	48 89 c7             	mov    %rax,%rdi
+  80108f:	48 b8 48 0c 80 00 00 	movabs $0x800c48,%rax
+  801096:	00 00 00 
+  801099:	ff d0                	call   *%rax
+  80109b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80109e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8010a2:	79 69                	jns    80110d <walk_path+0x1f7>
+		{
+			if (r == -E_NOT_FOUND && *path == '\0')
+  8010a4:	83 7d ec f4          	cmpl   $0xfffffff4,-0x14(%rbp)
+  8010a8:	75 5e                	jne    801108 <walk_path+0x1f2>
+  8010aa:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8010b1:	0f b6 00             	movzbl (%rax),%eax
+  8010b4:	84 c0                	test   %al,%al
+  8010b6:	75 50                	jne    801108 <walk_path+0x1f2>
+			{
+				if (pdir)
+  8010b8:	48 83 bd 40 ff ff ff 	cmpq   $0x0,-0xc0(%rbp)
+  8010bf:	00 
+  8010c0:	74 0e                	je     8010d0 <walk_path+0x1ba>
+					*pdir = dir;
+  8010c2:	48 8b 85 40 ff ff ff 	mov    -0xc0(%rbp),%rax
+  8010c9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8010cd:	48 89 10             	mov    %rdx,(%rax)
+				if (lastelem)
+  8010d0:	48 83 bd 30 ff ff ff 	cmpq   $0x0,-0xd0(%rbp)
+  8010d7:	00 
+  8010d8:	74 20                	je     8010fa <walk_path+0x1e4>
+					strcpy(lastelem, name);
+  8010da:	48 8d 95 60 ff ff ff 	lea    -0xa0(%rbp),%rdx
+  8010e1:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+  8010e8:	48 89 d6             	mov    %rdx,%rsi
+  8010eb:	48 89 c7             	mov    %rax,%rdi
+  8010ee:	48 b8 96 34 80 00 00 	movabs $0x803496,%rax
+  8010f5:	00 00 00 
+  8010f8:	ff d0                	call   *%rax
+				*pf = 0;
+  8010fa:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  801101:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+			}
+			return r;
+  801108:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80110b:	eb 40                	jmp    80114d <walk_path+0x237>
+	while (*path != '\0')
+  80110d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801114:	0f b6 00             	movzbl (%rax),%eax
+  801117:	84 c0                	test   %al,%al
+  801119:	0f 85 8d fe ff ff    	jne    800fac <walk_path+0x96>
+		}
+	}
+
+	if (pdir)
+  80111f:	48 83 bd 40 ff ff ff 	cmpq   $0x0,-0xc0(%rbp)
+  801126:	00 
+  801127:	74 0e                	je     801137 <walk_path+0x221>
+		*pdir = dir;
+  801129:	48 8b 85 40 ff ff ff 	mov    -0xc0(%rbp),%rax
+  801130:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801134:	48 89 10             	mov    %rdx,(%rax)
+	*pf = f;
+  801137:	48 8b 95 58 ff ff ff 	mov    -0xa8(%rbp),%rdx
+  80113e:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  801145:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  801148:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80114d:	c9                   	leave
+  80114e:	c3                   	ret
+
+000000000080114f <file_create>:
+
+/* ---------------------------- 文件操作 ---------------------------- */
+
+// 创建文件 path，成功时 *pf 为新文件；文件已存在时返回 -E_FILE_EXISTS
+int file_create(const char *path, struct File **pf)
+{
+  80114f:	55                   	push   %rbp
+  801150:	48 89 e5             	mov    %rsp,%rbp
+  801153:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  80115a:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  801161:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+	char name[MAXNAMELEN];
+	int r;
+	struct File *dir, *f;
+
+	if ((r = walk_path(path, &dir, &f, name)) == 0)
+  801168:	48 8d 8d 70 ff ff ff 	lea    -0x90(%rbp),%rcx
+  80116f:	48 8d 95 60 ff ff ff 	lea    -0xa0(%rbp),%rdx
+  801176:	48 8d b5 68 ff ff ff 	lea    -0x98(%rbp),%rsi
+  80117d:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  801184:	48 89 c7             	mov    %rax,%rdi
+  801187:	48 b8 16 0f 80 00 00 	movabs $0x800f16,%rax
+  80118e:	00 00 00 
+  801191:	ff d0                	call   *%rax
+  801193:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801196:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80119a:	75 0a                	jne    8011a6 <file_create+0x57>
+		return -E_FILE_EXISTS;
+  80119c:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+  8011a1:	e9 94 00 00 00       	jmp    80123a <file_create+0xeb>
+	if (r != -E_NOT_FOUND || dir == 0)
+  8011a6:	83 7d fc f4          	cmpl   $0xfffffff4,-0x4(%rbp)
+  8011aa:	75 0c                	jne    8011b8 <file_create+0x69>
+  8011ac:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  8011b3:	48 85 c0             	test   %rax,%rax
+  8011b6:	75 05                	jne    8011bd <file_create+0x6e>
+		return r;
+  8011b8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8011bb:	eb 7d                	jmp    80123a <file_create+0xeb>
+	if ((r = dir_alloc_file(dir, &f)) < 0)
+  8011bd:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  8011c4:	48 8d 95 60 ff ff ff 	lea    -0xa0(%rbp),%rdx
+  8011cb:	48 89 d6             	mov    %rdx,%rsi
+  8011ce:	48 89 c7             	mov    %rax,%rdi
+  8011d1:	48 b8 7d 0d 80 00 00 	movabs $0x800d7d,%rax
+  8011d8:	00 00 00 
+  8011db:	ff d0                	call   *%rax
+  8011dd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8011e0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8011e4:	79 05                	jns    8011eb <file_create+0x9c>
+		return r;
+  8011e6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8011e9:	eb 4f                	jmp    80123a <file_create+0xeb>
+
+	strcpy(f->f_name, name);
+  8011eb:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  8011f2:	48 89 c2             	mov    %rax,%rdx
+  8011f5:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  8011fc:	48 89 c6             	mov    %rax,%rsi
+  8011ff:	48 89 d7             	mov    %rdx,%rdi
+  801202:	48 b8 96 34 80 00 00 	movabs $0x803496,%rax
+  801209:	00 00 00 
+  80120c:	ff d0                	call   *%rax
+	*pf = f;
+  80120e:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  801215:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  80121c:	48 89 10             	mov    %rdx,(%rax)
+	file_flush(dir);
+  80121f:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  801226:	48 89 c7             	mov    %rax,%rdi
+  801229:	48 b8 dc 16 80 00 00 	movabs $0x8016dc,%rax
+  801230:	00 00 00 
+  801233:	ff d0                	call   *%rax
+	return 0;
+  801235:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80123a:	c9                   	leave
+  80123b:	c3                   	ret
+
+000000000080123c <file_open>:
+
+// 打开文件 path，成功时 *pf 为该文件
+int file_open(const char *path, struct File **pf)
+{
+  80123c:	55                   	push   %rbp
+  80123d:	48 89 e5             	mov    %rsp,%rbp
+  801240:	48 83 ec 10          	sub    $0x10,%rsp
+  801244:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801248:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return walk_path(path, 0, pf, 0);
+  80124c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801250:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801254:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801259:	be 00 00 00 00       	mov    $0x0,%esi
+  80125e:	48 89 c7             	mov    %rax,%rdi
+  801261:	48 b8 16 0f 80 00 00 	movabs $0x800f16,%rax
+  801268:	00 00 00 
+  80126b:	ff d0                	call   *%rax
+}
+  80126d:	c9                   	leave
+  80126e:	c3                   	ret
+
+000000000080126f <file_read>:
+ * 从文件 f 的 offset 处读取 count 字节到 buf
+ * 返回读取的字节数，到达文件末尾时少于 count
+ */
+ssize_t
+file_read(struct File *f, void *buf, size_t count, off_t offset)
+{
+  80126f:	55                   	push   %rbp
+  801270:	48 89 e5             	mov    %rsp,%rbp
+  801273:	48 83 ec 60          	sub    $0x60,%rsp
+  801277:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80127b:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  80127f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801283:	89 4d a4             	mov    %ecx,-0x5c(%rbp)
+	int r, bn;
+	off_t pos;
+	char *blk;
+
+	if (offset >= f->f_size)
+  801286:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80128a:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  801290:	39 45 a4             	cmp    %eax,-0x5c(%rbp)
+  801293:	7c 0a                	jl     80129f <file_read+0x30>
+		return 0;
+  801295:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129a:	e9 2c 01 00 00       	jmp    8013cb <file_read+0x15c>
+
+	count = MIN(count, f->f_size - offset);
+  80129f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8012a3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8012a7:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8012ab:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  8012b1:	2b 45 a4             	sub    -0x5c(%rbp),%eax
+  8012b4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8012b7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8012ba:	48 63 d0             	movslq %eax,%rdx
+  8012bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012c1:	48 39 c2             	cmp    %rax,%rdx
+  8012c4:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8012c8:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+	for (pos = offset; pos < offset + count;)
+  8012cc:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+  8012cf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8012d2:	e9 d4 00 00 00       	jmp    8013ab <file_read+0x13c>
+	{
+		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+  8012d7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012da:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  8012e0:	85 c0                	test   %eax,%eax
+  8012e2:	0f 48 c2             	cmovs  %edx,%eax
+  8012e5:	c1 f8 0c             	sar    $0xc,%eax
+  8012e8:	89 c1                	mov    %eax,%ecx
+  8012ea:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8012ee:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8012f2:	89 ce                	mov    %ecx,%esi
+  8012f4:	48 89 c7             	mov    %rax,%rdi
+  8012f7:	48 b8 6c 0b 80 00 00 	movabs $0x800b6c,%rax
+  8012fe:	00 00 00 
+  801301:	ff d0                	call   *%rax
+  801303:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  801306:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80130a:	79 08                	jns    801314 <file_read+0xa5>
+			return r;
+  80130c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80130f:	e9 b7 00 00 00       	jmp    8013cb <file_read+0x15c>
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  801314:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801317:	89 d0                	mov    %edx,%eax
+  801319:	c1 f8 1f             	sar    $0x1f,%eax
+  80131c:	c1 e8 14             	shr    $0x14,%eax
+  80131f:	01 c2                	add    %eax,%edx
+  801321:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801327:	29 c2                	sub    %eax,%edx
+  801329:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80132e:	29 d0                	sub    %edx,%eax
+  801330:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  801333:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+  801336:	48 63 d0             	movslq %eax,%rdx
+  801339:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80133d:	48 01 c2             	add    %rax,%rdx
+  801340:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801343:	48 98                	cltq
+  801345:	48 29 c2             	sub    %rax,%rdx
+  801348:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80134c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80134f:	48 63 d0             	movslq %eax,%rdx
+  801352:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801356:	48 39 c2             	cmp    %rax,%rdx
+  801359:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80135d:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		memmove(buf, blk + pos % BLKSIZE, bn);
+  801360:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801363:	48 63 c8             	movslq %eax,%rcx
+  801366:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80136a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80136d:	89 d0                	mov    %edx,%eax
+  80136f:	c1 f8 1f             	sar    $0x1f,%eax
+  801372:	c1 e8 14             	shr    $0x14,%eax
+  801375:	01 c2                	add    %eax,%edx
+  801377:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80137d:	29 c2                	sub    %eax,%edx
+  80137f:	89 d0                	mov    %edx,%eax
+  801381:	48 98                	cltq
+  801383:	48 01 c6             	add    %rax,%rsi
+  801386:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80138a:	48 89 ca             	mov    %rcx,%rdx
+  80138d:	48 89 c7             	mov    %rax,%rdi
+  801390:	48 b8 22 3b 80 00 00 	movabs $0x803b22,%rax
+  801397:	00 00 00 
+  80139a:	ff d0                	call   *%rax
+		pos += bn;
+  80139c:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80139f:	01 45 fc             	add    %eax,-0x4(%rbp)
+		buf += bn;
+  8013a2:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8013a5:	48 98                	cltq
+  8013a7:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+	for (pos = offset; pos < offset + count;)
+  8013ab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8013ae:	48 63 d0             	movslq %eax,%rdx
+  8013b1:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+  8013b4:	48 63 c8             	movslq %eax,%rcx
+  8013b7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8013bb:	48 01 c8             	add    %rcx,%rax
+  8013be:	48 39 c2             	cmp    %rax,%rdx
+  8013c1:	0f 82 10 ff ff ff    	jb     8012d7 <file_read+0x68>
+	}
+
+	return count;
+  8013c7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  8013cb:	c9                   	leave
+  8013cc:	c3                   	ret
+
+00000000008013cd <file_write>:
+/**
+ * 将 buf 中的 count 字节写入文件 f 的 offset 处，必要时扩展文件
+ * 返回写入的字节数
+ */
+int file_write(struct File *f, const void *buf, size_t count, off_t offset)
+{
+  8013cd:	55                   	push   %rbp
+  8013ce:	48 89 e5             	mov    %rsp,%rbp
+  8013d1:	48 83 ec 50          	sub    $0x50,%rsp
+  8013d5:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8013d9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8013dd:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  8013e1:	89 4d b4             	mov    %ecx,-0x4c(%rbp)
+	int r, bn;
+	off_t pos;
+	char *blk;
+
+	// 必要时扩展文件
+	if (offset + count > f->f_size)
+  8013e4:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  8013e7:	48 63 d0             	movslq %eax,%rdx
+  8013ea:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8013ee:	48 01 c2             	add    %rax,%rdx
+  8013f1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013f5:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  8013fb:	48 98                	cltq
+  8013fd:	48 39 d0             	cmp    %rdx,%rax
+  801400:	73 33                	jae    801435 <file_write+0x68>
+		if ((r = file_set_size(f, offset + count)) < 0)
+  801402:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801406:	89 c2                	mov    %eax,%edx
+  801408:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  80140b:	01 d0                	add    %edx,%eax
+  80140d:	89 c2                	mov    %eax,%edx
+  80140f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801413:	89 d6                	mov    %edx,%esi
+  801415:	48 89 c7             	mov    %rax,%rdi
+  801418:	48 b8 7f 16 80 00 00 	movabs $0x80167f,%rax
+  80141f:	00 00 00 
+  801422:	ff d0                	call   *%rax
+  801424:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  801427:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80142b:	79 08                	jns    801435 <file_write+0x68>
+			return r;
+  80142d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801430:	e9 00 01 00 00       	jmp    801535 <file_write+0x168>
+
+	for (pos = offset; pos < offset + count;)
+  801435:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  801438:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80143b:	e9 d5 00 00 00       	jmp    801515 <file_write+0x148>
+	{
+		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+  801440:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801443:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  801449:	85 c0                	test   %eax,%eax
+  80144b:	0f 48 c2             	cmovs  %edx,%eax
+  80144e:	c1 f8 0c             	sar    $0xc,%eax
+  801451:	89 c1                	mov    %eax,%ecx
+  801453:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801457:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80145b:	89 ce                	mov    %ecx,%esi
+  80145d:	48 89 c7             	mov    %rax,%rdi
+  801460:	48 b8 6c 0b 80 00 00 	movabs $0x800b6c,%rax
+  801467:	00 00 00 
+  80146a:	ff d0                	call   *%rax
+  80146c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80146f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  801473:	79 08                	jns    80147d <file_write+0xb0>
+			return r;
+  801475:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801478:	e9 b8 00 00 00       	jmp    801535 <file_write+0x168>
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  80147d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801480:	89 d0                	mov    %edx,%eax
+  801482:	c1 f8 1f             	sar    $0x1f,%eax
+  801485:	c1 e8 14             	shr    $0x14,%eax
+  801488:	01 c2                	add    %eax,%edx
+  80148a:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801490:	29 c2                	sub    %eax,%edx
+  801492:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801497:	29 d0                	sub    %edx,%eax
+  801499:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  80149c:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  80149f:	48 63 d0             	movslq %eax,%rdx
+  8014a2:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8014a6:	48 01 c2             	add    %rax,%rdx
+  8014a9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8014ac:	48 98                	cltq
+  8014ae:	48 29 c2             	sub    %rax,%rdx
+  8014b1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8014b5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8014b8:	48 63 d0             	movslq %eax,%rdx
+  8014bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014bf:	48 39 c2             	cmp    %rax,%rdx
+  8014c2:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8014c6:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+		memmove(blk + pos % BLKSIZE, buf, bn);
+  8014c9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8014cc:	48 63 c8             	movslq %eax,%rcx
+  8014cf:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8014d3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8014d6:	89 d0                	mov    %edx,%eax
+  8014d8:	c1 f8 1f             	sar    $0x1f,%eax
+  8014db:	c1 e8 14             	shr    $0x14,%eax
+  8014de:	01 c2                	add    %eax,%edx
+  8014e0:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8014e6:	29 c2                	sub    %eax,%edx
+  8014e8:	89 d0                	mov    %edx,%eax
+  8014ea:	48 98                	cltq
+  8014ec:	48 8d 3c 06          	lea    (%rsi,%rax,1),%rdi
+  8014f0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8014f4:	48 89 ca             	mov    %rcx,%rdx
+  8014f7:	48 89 c6             	mov    %rax,%rsi
+  8014fa:	48 b8 22 3b 80 00 00 	movabs $0x803b22,%rax
+  801501:	00 00 00 
+  801504:	ff d0                	call   *%rax
+		pos += bn;
+  801506:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801509:	01 45 fc             	add    %eax,-0x4(%rbp)
+		buf += bn;
+  80150c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80150f:	48 98                	cltq
+  801511:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+	for (pos = offset; pos < offset + count;)
+  801515:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801518:	48 63 d0             	movslq %eax,%rdx
+  80151b:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  80151e:	48 63 c8             	movslq %eax,%rcx
+  801521:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801525:	48 01 c8             	add    %rcx,%rax
+  801528:	48 39 c2             	cmp    %rax,%rdx
+  80152b:	0f 82 0f ff ff ff    	jb     801440 <file_write+0x73>
+	}
+
+	return count;
+  801531:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+}
+  801535:	c9                   	leave
+  801536:	c3                   	ret
+
+0000000000801537 <file_free_block>:
+
+// 释放文件 f 的第 filebno 个块(如果存在)
+static int
+file_free_block(struct File *f, uint32_t filebno)
+{
+  801537:	55                   	push   %rbp
+  801538:	48 89 e5             	mov    %rsp,%rbp
+  80153b:	48 83 ec 20          	sub    $0x20,%rsp
+  80153f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801543:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	int r;
+	uint32_t *ptr;
+
+	if ((r = file_block_walk(f, filebno, &ptr, 0)) < 0)
+  801546:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80154a:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  80154d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801551:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801556:	48 89 c7             	mov    %rax,%rdi
+  801559:	48 b8 40 0a 80 00 00 	movabs $0x800a40,%rax
+  801560:	00 00 00 
+  801563:	ff d0                	call   *%rax
+  801565:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801568:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80156c:	79 05                	jns    801573 <file_free_block+0x3c>
+		return r;
+  80156e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801571:	eb 2d                	jmp    8015a0 <file_free_block+0x69>
+	if (*ptr)
+  801573:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801577:	8b 00                	mov    (%rax),%eax
+  801579:	85 c0                	test   %eax,%eax
+  80157b:	74 1e                	je     80159b <file_free_block+0x64>
+	{
+		free_block(*ptr);
+  80157d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801581:	8b 00                	mov    (%rax),%eax
+  801583:	89 c7                	mov    %eax,%edi
+  801585:	48 b8 aa 06 80 00 00 	movabs $0x8006aa,%rax
+  80158c:	00 00 00 
+  80158f:	ff d0                	call   *%rax
+		*ptr = 0;
+  801591:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801595:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	}
+	return 0;
+  80159b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015a0:	c9                   	leave
+  8015a1:	c3                   	ret
+
+00000000008015a2 <file_truncate_blocks>:
+ * 释放文件 f 在新大小 newsize 之外的块
+ * 新大小不需要间接块时，同时释放间接块
+ */
+static void
+file_truncate_blocks(struct File *f, off_t newsize)
+{
+  8015a2:	55                   	push   %rbp
+  8015a3:	48 89 e5             	mov    %rsp,%rbp
+  8015a6:	48 83 ec 20          	sub    $0x20,%rsp
+  8015aa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015ae:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	int r;
+	uint32_t bno, old_nblocks, new_nblocks;
+
+	old_nblocks = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+  8015b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015b5:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  8015bb:	05 ff 0f 00 00       	add    $0xfff,%eax
+  8015c0:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  8015c6:	85 c0                	test   %eax,%eax
+  8015c8:	0f 48 c2             	cmovs  %edx,%eax
+  8015cb:	c1 f8 0c             	sar    $0xc,%eax
+  8015ce:	89 45 f8             	mov    %eax,-0x8(%rbp)
+	new_nblocks = (newsize + BLKSIZE - 1) / BLKSIZE;
+  8015d1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8015d4:	05 ff 0f 00 00       	add    $0xfff,%eax
+  8015d9:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  8015df:	85 c0                	test   %eax,%eax
+  8015e1:	0f 48 c2             	cmovs  %edx,%eax
+  8015e4:	c1 f8 0c             	sar    $0xc,%eax
+  8015e7:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	for (bno = new_nblocks; bno < old_nblocks; bno++)
+  8015ea:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8015ed:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8015f0:	eb 48                	jmp    80163a <file_truncate_blocks+0x98>
+		if ((r = file_free_block(f, bno)) < 0)
+  8015f2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8015f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015f9:	89 d6                	mov    %edx,%esi
+  8015fb:	48 89 c7             	mov    %rax,%rdi
+  8015fe:	48 b8 37 15 80 00 00 	movabs $0x801537,%rax
+  801605:	00 00 00 
+  801608:	ff d0                	call   *%rax
+  80160a:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  80160d:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  801611:	79 23                	jns    801636 <file_truncate_blocks+0x94>
+			cprintf("warning: file_free_block: %e", r);
+  801613:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801616:	89 c6                	mov    %eax,%esi
+  801618:	48 b8 db 5e 80 00 00 	movabs $0x805edb,%rax
+  80161f:	00 00 00 
+  801622:	48 89 c7             	mov    %rax,%rdi
+  801625:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162a:	48 ba 0f 28 80 00 00 	movabs $0x80280f,%rdx
+  801631:	00 00 00 
+  801634:	ff d2                	call   *%rdx
+	for (bno = new_nblocks; bno < old_nblocks; bno++)
+  801636:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80163a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80163d:	3b 45 f8             	cmp    -0x8(%rbp),%eax
+  801640:	72 b0                	jb     8015f2 <file_truncate_blocks+0x50>
+
+	if (new_nblocks <= NDIRECT && f->f_indirect)
+  801642:	83 7d f4 0a          	cmpl   $0xa,-0xc(%rbp)
+  801646:	77 34                	ja     80167c <file_truncate_blocks+0xda>
+  801648:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80164c:	8b 80 b0 00 00 00    	mov    0xb0(%rax),%eax
+  801652:	85 c0                	test   %eax,%eax
+  801654:	74 26                	je     80167c <file_truncate_blocks+0xda>
+	{
+		free_block(f->f_indirect);
+  801656:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80165a:	8b 80 b0 00 00 00    	mov    0xb0(%rax),%eax
+  801660:	89 c7                	mov    %eax,%edi
+  801662:	48 b8 aa 06 80 00 00 	movabs $0x8006aa,%rax
+  801669:	00 00 00 
+  80166c:	ff d0                	call   *%rax
+		f->f_indirect = 0;
+  80166e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801672:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%rax)
+  801679:	00 00 00 
+	}
+}
+  80167c:	90                   	nop
+  80167d:	c9                   	leave
+  80167e:	c3                   	ret
+
+000000000080167f <file_set_size>:
+
+// 设置文件 f 的大小，缩小时释放多余的块
+int file_set_size(struct File *f, off_t newsize)
+{
+  80167f:	55                   	push   %rbp
+  801680:	48 89 e5             	mov    %rsp,%rbp
+  801683:	48 83 ec 10          	sub    $0x10,%rsp
+  801687:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80168b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	if (f->f_size > newsize)
+  80168e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801692:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  801698:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+  80169b:	7d 18                	jge    8016b5 <file_set_size+0x36>
+		file_truncate_blocks(f, newsize);
+  80169d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8016a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016a4:	89 d6                	mov    %edx,%esi
+  8016a6:	48 89 c7             	mov    %rax,%rdi
+  8016a9:	48 b8 a2 15 80 00 00 	movabs $0x8015a2,%rax
+  8016b0:	00 00 00 
+  8016b3:	ff d0                	call   *%rax
+	f->f_size = newsize;
+  8016b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016b9:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8016bc:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	flush_block(f);
+  8016c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016c6:	48 89 c7             	mov    %rax,%rdi
+  8016c9:	48 b8 a5 03 80 00 00 	movabs $0x8003a5,%rax
+  8016d0:	00 00 00 
+  8016d3:	ff d0                	call   *%rax
+	return 0;
+  8016d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016da:	c9                   	leave
+  8016db:	c3                   	ret
+
+00000000008016dc <file_flush>:
+
+// 将文件 f 的内容和元数据写回磁盘
+void file_flush(struct File *f)
+{
+  8016dc:	55                   	push   %rbp
+  8016dd:	48 89 e5             	mov    %rsp,%rbp
+  8016e0:	48 83 ec 20          	sub    $0x20,%rsp
+  8016e4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	uint32_t i;
+	uint32_t *pdiskbno;
+
+	for (i = 0; i < (f->f_size + BLKSIZE - 1) / BLKSIZE; i++)
+  8016e8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8016ef:	eb 60                	jmp    801751 <file_flush+0x75>
+	{
+		if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  8016f1:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8016f5:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  8016f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801701:	48 89 c7             	mov    %rax,%rdi
+  801704:	48 b8 40 0a 80 00 00 	movabs $0x800a40,%rax
+  80170b:	00 00 00 
+  80170e:	ff d0                	call   *%rax
+  801710:	85 c0                	test   %eax,%eax
+  801712:	78 38                	js     80174c <file_flush+0x70>
+			pdiskbno == NULL || *pdiskbno == 0)
+  801714:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+		if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  801718:	48 85 c0             	test   %rax,%rax
+  80171b:	74 2f                	je     80174c <file_flush+0x70>
+			pdiskbno == NULL || *pdiskbno == 0)
+  80171d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801721:	8b 00                	mov    (%rax),%eax
+  801723:	85 c0                	test   %eax,%eax
+  801725:	74 25                	je     80174c <file_flush+0x70>
+			continue;
+		flush_block(diskaddr(*pdiskbno));
+  801727:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80172b:	8b 00                	mov    (%rax),%eax
+  80172d:	89 c7                	mov    %eax,%edi
+  80172f:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  801736:	00 00 00 
+  801739:	ff d0                	call   *%rax
+  80173b:	48 89 c7             	mov    %rax,%rdi
+  80173e:	48 b8 a5 03 80 00 00 	movabs $0x8003a5,%rax
+  801745:	00 00 00 
+  801748:	ff d0                	call   *%rax
+  80174a:	eb 01                	jmp    80174d <file_flush+0x71>
+			continue;
+  80174c:	90                   	nop
+	for (i = 0; i < (f->f_size + BLKSIZE - 1) / BLKSIZE; i++)
+  80174d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  801751:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801755:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  80175b:	05 ff 0f 00 00       	add    $0xfff,%eax
+  801760:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  801766:	85 c0                	test   %eax,%eax
+  801768:	0f 48 c2             	cmovs  %edx,%eax
+  80176b:	c1 f8 0c             	sar    $0xc,%eax
+  80176e:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  801771:	0f 82 7a ff ff ff    	jb     8016f1 <file_flush+0x15>
+	}
+	flush_block(f);
+  801777:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80177b:	48 89 c7             	mov    %rax,%rdi
+  80177e:	48 b8 a5 03 80 00 00 	movabs $0x8003a5,%rax
+  801785:	00 00 00 
+  801788:	ff d0                	call   *%rax
+	if (f->f_indirect)
+  80178a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80178e:	8b 80 b0 00 00 00    	mov    0xb0(%rax),%eax
+  801794:	85 c0                	test   %eax,%eax
+  801796:	74 27                	je     8017bf <file_flush+0xe3>
+		flush_block(diskaddr(f->f_indirect));
+  801798:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80179c:	8b 80 b0 00 00 00    	mov    0xb0(%rax),%eax
+  8017a2:	89 c7                	mov    %eax,%edi
+  8017a4:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  8017ab:	00 00 00 
+  8017ae:	ff d0                	call   *%rax
+  8017b0:	48 89 c7             	mov    %rax,%rdi
+  8017b3:	48 b8 a5 03 80 00 00 	movabs $0x8003a5,%rax
+  8017ba:	00 00 00 
+  8017bd:	ff d0                	call   *%rax
+}
+  8017bf:	90                   	nop
+  8017c0:	c9                   	leave
+  8017c1:	c3                   	ret
+
+00000000008017c2 <file_remove>:
+
+// 删除文件 path
+int file_remove(const char *path)
+{
+  8017c2:	55                   	push   %rbp
+  8017c3:	48 89 e5             	mov    %rsp,%rbp
+  8017c6:	48 83 ec 20          	sub    $0x20,%rsp
+  8017ca:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int r;
+	struct File *f;
+
+	if ((r = walk_path(path, 0, &f, 0)) < 0)
+  8017ce:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8017d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017db:	be 00 00 00 00       	mov    $0x0,%esi
+  8017e0:	48 89 c7             	mov    %rax,%rdi
+  8017e3:	48 b8 16 0f 80 00 00 	movabs $0x800f16,%rax
+  8017ea:	00 00 00 
+  8017ed:	ff d0                	call   *%rax
+  8017ef:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8017f2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8017f6:	79 05                	jns    8017fd <file_remove+0x3b>
+		return r;
+  8017f8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8017fb:	eb 45                	jmp    801842 <file_remove+0x80>
+
+	file_truncate_blocks(f, 0);
+  8017fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801801:	be 00 00 00 00       	mov    $0x0,%esi
+  801806:	48 89 c7             	mov    %rax,%rdi
+  801809:	48 b8 a2 15 80 00 00 	movabs $0x8015a2,%rax
+  801810:	00 00 00 
+  801813:	ff d0                	call   *%rax
+	f->f_name[0] = '\0';
+  801815:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801819:	c6 00 00             	movb   $0x0,(%rax)
+	f->f_size = 0;
+  80181c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801820:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  801827:	00 00 00 
+	flush_block(f);
+  80182a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80182e:	48 89 c7             	mov    %rax,%rdi
+  801831:	48 b8 a5 03 80 00 00 	movabs $0x8003a5,%rax
+  801838:	00 00 00 
+  80183b:	ff d0                	call   *%rax
+
+	return 0;
+  80183d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801842:	c9                   	leave
+  801843:	c3                   	ret
+
+0000000000801844 <fs_sync>:
+
+// 将整个块缓存写回磁盘
+void fs_sync(void)
+{
+  801844:	55                   	push   %rbp
+  801845:	48 89 e5             	mov    %rsp,%rbp
+  801848:	48 83 ec 10          	sub    $0x10,%rsp
+	uint32_t i;
+
+	for (i = 1; i < super->s_nblocks; i++)
+  80184c:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  801853:	eb 24                	jmp    801879 <fs_sync+0x35>
+		flush_block(diskaddr(i));
+  801855:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801858:	89 c7                	mov    %eax,%edi
+  80185a:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  801861:	00 00 00 
+  801864:	ff d0                	call   *%rax
+  801866:	48 89 c7             	mov    %rax,%rdi
+  801869:	48 b8 a5 03 80 00 00 	movabs $0x8003a5,%rax
+  801870:	00 00 00 
+  801873:	ff d0                	call   *%rax
+	for (i = 1; i < super->s_nblocks; i++)
+  801875:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  801879:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  801880:	00 00 00 
+  801883:	48 8b 00             	mov    (%rax),%rax
+  801886:	8b 40 04             	mov    0x4(%rax),%eax
+  801889:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  80188c:	72 c7                	jb     801855 <fs_sync+0x11>
+}
+  80188e:	90                   	nop
+  80188f:	90                   	nop
+  801890:	c9                   	leave
+  801891:	c3                   	ret
+
+0000000000801892 <serve_init>:
+// 接收请求参数页的虚拟地址
+union Fsipc *fsreq = (union Fsipc *)0x0ffff000;
+
+static void
+serve_init(void)
+{
+  801892:	55                   	push   %rbp
+  801893:	48 89 e5             	mov    %rsp,%rbp
+  801896:	48 83 ec 10          	sub    $0x10,%rsp
+	int i;
+	uintptr_t va = FILEVA;
+  80189a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80189f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	for (i = 0; i < MAXOPEN; i++)
+  8018a3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8018aa:	eb 4a                	jmp    8018f6 <serve_init+0x64>
+	{
+		opentab[i].o_fileid = i;
+  8018ac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8018af:	48 b9 20 90 80 00 00 	movabs $0x809020,%rcx
+  8018b6:	00 00 00 
+  8018b9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8018bc:	48 63 d2             	movslq %edx,%rdx
+  8018bf:	48 c1 e2 05          	shl    $0x5,%rdx
+  8018c3:	48 01 ca             	add    %rcx,%rdx
+  8018c6:	89 02                	mov    %eax,(%rdx)
+		opentab[i].o_fd = (struct Fd *)va;
+  8018c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018cc:	48 b9 20 90 80 00 00 	movabs $0x809020,%rcx
+  8018d3:	00 00 00 
+  8018d6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8018d9:	48 63 d2             	movslq %edx,%rdx
+  8018dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8018e0:	48 01 ca             	add    %rcx,%rdx
+  8018e3:	48 83 c2 18          	add    $0x18,%rdx
+  8018e7:	48 89 02             	mov    %rax,(%rdx)
+		va += PGSIZE;
+  8018ea:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  8018f1:	00 
+	for (i = 0; i < MAXOPEN; i++)
+  8018f2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8018f6:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  8018fd:	7e ad                	jle    8018ac <serve_init+0x1a>
+	}
+}
+  8018ff:	90                   	nop
+  801900:	90                   	nop
+  801901:	c9                   	leave
+  801902:	c3                   	ret
+
+0000000000801903 <openfile_alloc>:
+
+// 分配一个 OpenFile
+static int
+openfile_alloc(struct OpenFile **o)
+{
+  801903:	55                   	push   %rbp
+  801904:	48 89 e5             	mov    %rsp,%rbp
+  801907:	48 83 ec 20          	sub    $0x20,%rsp
+  80190b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i, r;
+
+	for (i = 0; i < MAXOPEN; i++)
+  80190f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801916:	e9 1c 01 00 00       	jmp    801a37 <openfile_alloc+0x134>
+	{
+		switch (pageref(opentab[i].o_fd))
+  80191b:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  801922:	00 00 00 
+  801925:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801928:	48 98                	cltq
+  80192a:	48 c1 e0 05          	shl    $0x5,%rax
+  80192e:	48 01 d0             	add    %rdx,%rax
+  801931:	48 83 c0 18          	add    $0x18,%rax
+  801935:	48 8b 00             	mov    (%rax),%rax
+  801938:	48 89 c7             	mov    %rax,%rdi
+  80193b:	48 b8 d5 51 80 00 00 	movabs $0x8051d5,%rax
+  801942:	00 00 00 
+  801945:	ff d0                	call   *%rax
+  801947:	85 c0                	test   %eax,%eax
+  801949:	74 0a                	je     801955 <openfile_alloc+0x52>
+  80194b:	83 f8 01             	cmp    $0x1,%eax
+  80194e:	74 4c                	je     80199c <openfile_alloc+0x99>
+  801950:	e9 de 00 00 00       	jmp    801a33 <openfile_alloc+0x130>
+		{
+		case 0:
+			if ((r = sys_page_alloc(0, opentab[i].o_fd, PTE_P | PTE_U | PTE_W)) < 0)
+  801955:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  80195c:	00 00 00 
+  80195f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801962:	48 98                	cltq
+  801964:	48 c1 e0 05          	shl    $0x5,%rax
+  801968:	48 01 d0             	add    %rdx,%rax
+  80196b:	48 83 c0 18          	add    $0x18,%rax
+  80196f:	48 8b 00             	mov    (%rax),%rax
+  801972:	ba 07 00 00 00       	mov    $0x7,%edx
+  801977:	48 89 c6             	mov    %rax,%rsi
+  80197a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80197f:	48 b8 fb 40 80 00 00 	movabs $0x8040fb,%rax
+  801986:	00 00 00 
+  801989:	ff d0                	call   *%rax
+  80198b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80198e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  801992:	79 08                	jns    80199c <openfile_alloc+0x99>
+				return r;
+  801994:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801997:	e9 ad 00 00 00       	jmp    801a49 <openfile_alloc+0x146>
+			/* fall through */
+		case 1:
+			opentab[i].o_fileid += MAXOPEN;
+  80199c:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  8019a3:	00 00 00 
+  8019a6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019a9:	48 98                	cltq
+  8019ab:	48 c1 e0 05          	shl    $0x5,%rax
+  8019af:	48 01 d0             	add    %rdx,%rax
+  8019b2:	8b 00                	mov    (%rax),%eax
+  8019b4:	8d 90 00 04 00 00    	lea    0x400(%rax),%edx
+  8019ba:	48 b9 20 90 80 00 00 	movabs $0x809020,%rcx
+  8019c1:	00 00 00 
+  8019c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019c7:	48 98                	cltq
+  8019c9:	48 c1 e0 05          	shl    $0x5,%rax
+  8019cd:	48 01 c8             	add    %rcx,%rax
+  8019d0:	89 10                	mov    %edx,(%rax)
+			*o = &opentab[i];
+  8019d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019d5:	48 98                	cltq
+  8019d7:	48 c1 e0 05          	shl    $0x5,%rax
+  8019db:	48 89 c2             	mov    %rax,%rdx
+  8019de:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8019e5:	00 00 00 
+  8019e8:	48 01 c2             	add    %rax,%rdx
+  8019eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019ef:	48 89 10             	mov    %rdx,(%rax)
+			memset(opentab[i].o_fd, 0, PGSIZE);
+  8019f2:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  8019f9:	00 00 00 
+  8019fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019ff:	48 98                	cltq
+  801a01:	48 c1 e0 05          	shl    $0x5,%rax
+  801a05:	48 01 d0             	add    %rdx,%rax
+  801a08:	48 83 c0 18          	add    $0x18,%rax
+  801a0c:	48 8b 00             	mov    (%rax),%rax
+  801a0f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a14:	be 00 00 00 00       	mov    $0x0,%esi
+  801a19:	48 89 c7             	mov    %rax,%rdi
+  801a1c:	48 b8 21 3a 80 00 00 	movabs $0x803a21,%rax
+  801a23:	00 00 00 
+  801a26:	ff d0                	call   *%rax
+			return (*o)->o_fileid;
+  801a28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a2c:	48 8b 00             	mov    (%rax),%rax
+  801a2f:	8b 00                	mov    (%rax),%eax
+  801a31:	eb 16                	jmp    801a49 <openfile_alloc+0x146>
+	for (i = 0; i < MAXOPEN; i++)
+  801a33:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  801a37:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  801a3e:	0f 8e d7 fe ff ff    	jle    80191b <openfile_alloc+0x18>
+		}
+	}
+	return -E_MAX_OPEN;
+  801a44:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  801a49:	c9                   	leave
+  801a4a:	c3                   	ret
+
+0000000000801a4b <openfile_lookup>:
+
+// 查找环境 envid 打开的文件 fileid
+static int
+openfile_lookup(envid_t envid, uint32_t fileid, struct OpenFile **po)
+{
+  801a4b:	55                   	push   %rbp
+  801a4c:	48 89 e5             	mov    %rsp,%rbp
+  801a4f:	48 83 ec 20          	sub    $0x20,%rsp
+  801a53:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801a56:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  801a59:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+	struct OpenFile *o;
+
+	o = &opentab[fileid % MAXOPEN];
+  801a5d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801a60:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801a65:	89 c0                	mov    %eax,%eax
+  801a67:	48 c1 e0 05          	shl    $0x5,%rax
+  801a6b:	48 89 c2             	mov    %rax,%rdx
+  801a6e:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  801a75:	00 00 00 
+  801a78:	48 01 d0             	add    %rdx,%rax
+  801a7b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (pageref(o->o_fd) <= 1 || o->o_fileid != fileid)
+  801a7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a83:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801a87:	48 89 c7             	mov    %rax,%rdi
+  801a8a:	48 b8 d5 51 80 00 00 	movabs $0x8051d5,%rax
+  801a91:	00 00 00 
+  801a94:	ff d0                	call   *%rax
+  801a96:	83 f8 01             	cmp    $0x1,%eax
+  801a99:	7e 0b                	jle    801aa6 <openfile_lookup+0x5b>
+  801a9b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a9f:	8b 00                	mov    (%rax),%eax
+  801aa1:	39 45 e8             	cmp    %eax,-0x18(%rbp)
+  801aa4:	74 07                	je     801aad <openfile_lookup+0x62>
+		return -E_INVAL;
+  801aa6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801aab:	eb 10                	jmp    801abd <openfile_lookup+0x72>
+	*po = o;
+  801aad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ab1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ab5:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  801ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801abd:	c9                   	leave
+  801abe:	c3                   	ret
+
+0000000000801abf <serve_open>:
+ * 以 req->req_omode 打开 req->req_path，Fd 页通过 *pg_store 和 *perm_store 返回给客户端
+ */
+static int
+serve_open(envid_t envid, struct Fsreq_open *req,
+		   void **pg_store, int *perm_store)
+{
+  801abf:	55                   	push   %rbp
+  801ac0:	48 89 e5             	mov    %rsp,%rbp
+  801ac3:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  801aca:	89 bd dc fb ff ff    	mov    %edi,-0x424(%rbp)
+  801ad0:	48 89 b5 d0 fb ff ff 	mov    %rsi,-0x430(%rbp)
+  801ad7:	48 89 95 c8 fb ff ff 	mov    %rdx,-0x438(%rbp)
+  801ade:	48 89 8d c0 fb ff ff 	mov    %rcx,-0x440(%rbp)
+
+	if (debug)
+		cprintf("serve_open %08x %s 0x%x\n", envid, req->req_path, req->req_omode);
+
+	// 复制路径，确保以 NULL 结尾
+	memmove(path, req->req_path, MAXPATHLEN);
+  801ae5:	48 8b 8d d0 fb ff ff 	mov    -0x430(%rbp),%rcx
+  801aec:	48 8d 85 f0 fb ff ff 	lea    -0x410(%rbp),%rax
+  801af3:	ba 00 04 00 00       	mov    $0x400,%edx
+  801af8:	48 89 ce             	mov    %rcx,%rsi
+  801afb:	48 89 c7             	mov    %rax,%rdi
+  801afe:	48 b8 22 3b 80 00 00 	movabs $0x803b22,%rax
+  801b05:	00 00 00 
+  801b08:	ff d0                	call   *%rax
+	path[MAXPATHLEN - 1] = 0;
+  801b0a:	c6 45 ef 00          	movb   $0x0,-0x11(%rbp)
+
+	if ((r = openfile_alloc(&o)) < 0)
+  801b0e:	48 8d 85 e0 fb ff ff 	lea    -0x420(%rbp),%rax
+  801b15:	48 89 c7             	mov    %rax,%rdi
+  801b18:	48 b8 03 19 80 00 00 	movabs $0x801903,%rax
+  801b1f:	00 00 00 
+  801b22:	ff d0                	call   *%rax
+  801b24:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801b27:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b2b:	79 08                	jns    801b35 <serve_open+0x76>
+		return r;
+  801b2d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b30:	e9 99 01 00 00       	jmp    801cce <serve_open+0x20f>
+	fileid = r;
+  801b35:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b38:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+	if (req->req_omode & O_CREAT)
+  801b3b:	48 8b 85 d0 fb ff ff 	mov    -0x430(%rbp),%rax
+  801b42:	8b 80 00 04 00 00    	mov    0x400(%rax),%eax
+  801b48:	25 00 01 00 00       	and    $0x100,%eax
+  801b4d:	85 c0                	test   %eax,%eax
+  801b4f:	74 4d                	je     801b9e <serve_open+0xdf>
+	{
+		if ((r = file_create(path, &f)) < 0)
+  801b51:	48 8d 95 e8 fb ff ff 	lea    -0x418(%rbp),%rdx
+  801b58:	48 8d 85 f0 fb ff ff 	lea    -0x410(%rbp),%rax
+  801b5f:	48 89 d6             	mov    %rdx,%rsi
+  801b62:	48 89 c7             	mov    %rax,%rdi
+  801b65:	48 b8 4f 11 80 00 00 	movabs $0x80114f,%rax
+  801b6c:	00 00 00 
+  801b6f:	ff d0                	call   *%rax
+  801b71:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801b74:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b78:	79 59                	jns    801bd3 <serve_open+0x114>
+		{
+			if (!(req->req_omode & O_EXCL) && r == -E_FILE_EXISTS)
+  801b7a:	48 8b 85 d0 fb ff ff 	mov    -0x430(%rbp),%rax
+  801b81:	8b 80 00 04 00 00    	mov    0x400(%rax),%eax
+  801b87:	25 00 04 00 00       	and    $0x400,%eax
+  801b8c:	85 c0                	test   %eax,%eax
+  801b8e:	75 06                	jne    801b96 <serve_open+0xd7>
+  801b90:	83 7d fc f2          	cmpl   $0xfffffff2,-0x4(%rbp)
+  801b94:	74 0b                	je     801ba1 <serve_open+0xe2>
+				goto try_open;
+			return r;
+  801b96:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b99:	e9 30 01 00 00       	jmp    801cce <serve_open+0x20f>
+		}
+	}
+	else
+	{
+	try_open:
+  801b9e:	90                   	nop
+  801b9f:	eb 01                	jmp    801ba2 <serve_open+0xe3>
+				goto try_open;
+  801ba1:	90                   	nop
+		if ((r = file_open(path, &f)) < 0)
+  801ba2:	48 8d 95 e8 fb ff ff 	lea    -0x418(%rbp),%rdx
+  801ba9:	48 8d 85 f0 fb ff ff 	lea    -0x410(%rbp),%rax
+  801bb0:	48 89 d6             	mov    %rdx,%rsi
+  801bb3:	48 89 c7             	mov    %rax,%rdi
+  801bb6:	48 b8 3c 12 80 00 00 	movabs $0x80123c,%rax
+  801bbd:	00 00 00 
+  801bc0:	ff d0                	call   *%rax
+  801bc2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801bc5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801bc9:	79 08                	jns    801bd3 <serve_open+0x114>
+			return r;
+  801bcb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801bce:	e9 fb 00 00 00       	jmp    801cce <serve_open+0x20f>
+	}
+
+	if (req->req_omode & O_TRUNC)
+  801bd3:	48 8b 85 d0 fb ff ff 	mov    -0x430(%rbp),%rax
+  801bda:	8b 80 00 04 00 00    	mov    0x400(%rax),%eax
+  801be0:	25 00 02 00 00       	and    $0x200,%eax
+  801be5:	85 c0                	test   %eax,%eax
+  801be7:	74 2c                	je     801c15 <serve_open+0x156>
+	{
+		if ((r = file_set_size(f, 0)) < 0)
+  801be9:	48 8b 85 e8 fb ff ff 	mov    -0x418(%rbp),%rax
+  801bf0:	be 00 00 00 00       	mov    $0x0,%esi
+  801bf5:	48 89 c7             	mov    %rax,%rdi
+  801bf8:	48 b8 7f 16 80 00 00 	movabs $0x80167f,%rax
+  801bff:	00 00 00 
+  801c02:	ff d0                	call   *%rax
+  801c04:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801c07:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801c0b:	79 08                	jns    801c15 <serve_open+0x156>
+			return r;
+  801c0d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801c10:	e9 b9 00 00 00       	jmp    801cce <serve_open+0x20f>
+	}
+
+	o->o_file = f;
+  801c15:	48 8b 85 e0 fb ff ff 	mov    -0x420(%rbp),%rax
+  801c1c:	48 8b 95 e8 fb ff ff 	mov    -0x418(%rbp),%rdx
+  801c23:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	o->o_mode = req->req_omode;
+  801c27:	48 8b 85 e0 fb ff ff 	mov    -0x420(%rbp),%rax
+  801c2e:	48 8b 95 d0 fb ff ff 	mov    -0x430(%rbp),%rdx
+  801c35:	8b 92 00 04 00 00    	mov    0x400(%rdx),%edx
+  801c3b:	89 50 10             	mov    %edx,0x10(%rax)
+
+	// 填写 Fd 页
+	o->o_fd->fd_file.id = o->o_fileid;
+  801c3e:	48 8b 85 e0 fb ff ff 	mov    -0x420(%rbp),%rax
+  801c45:	8b 10                	mov    (%rax),%edx
+  801c47:	48 8b 85 e0 fb ff ff 	mov    -0x420(%rbp),%rax
+  801c4e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801c52:	89 50 0c             	mov    %edx,0xc(%rax)
+	o->o_fd->fd_file.size = f->f_size;
+  801c55:	48 8b 95 e8 fb ff ff 	mov    -0x418(%rbp),%rdx
+  801c5c:	48 8b 85 e0 fb ff ff 	mov    -0x420(%rbp),%rax
+  801c63:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801c67:	8b 92 80 00 00 00    	mov    0x80(%rdx),%edx
+  801c6d:	89 50 10             	mov    %edx,0x10(%rax)
+	o->o_fd->fd_omode = req->req_omode & O_ACCMODE;
+  801c70:	48 8b 85 d0 fb ff ff 	mov    -0x430(%rbp),%rax
+  801c77:	8b 90 00 04 00 00    	mov    0x400(%rax),%edx
+  801c7d:	48 8b 85 e0 fb ff ff 	mov    -0x420(%rbp),%rax
+  801c84:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801c88:	83 e2 03             	and    $0x3,%edx
+  801c8b:	89 50 08             	mov    %edx,0x8(%rax)
+	o->o_fd->fd_dev_id = devfile.dev_id;
+  801c8e:	48 8b 85 e0 fb ff ff 	mov    -0x420(%rbp),%rax
+  801c95:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801c99:	48 ba 80 80 80 00 00 	movabs $0x808080,%rdx
+  801ca0:	00 00 00 
+  801ca3:	8b 12                	mov    (%rdx),%edx
+  801ca5:	89 10                	mov    %edx,(%rax)
+
+	if (debug)
+		cprintf("sending success, page %08lx\n", (uintptr_t)o->o_fd);
+
+	// 与客户端共享 Fd 页
+	*pg_store = o->o_fd;
+  801ca7:	48 8b 85 e0 fb ff ff 	mov    -0x420(%rbp),%rax
+  801cae:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  801cb2:	48 8b 85 c8 fb ff ff 	mov    -0x438(%rbp),%rax
+  801cb9:	48 89 10             	mov    %rdx,(%rax)
+	*perm_store = PTE_P | PTE_U | PTE_W | PTE_SHARE;
+  801cbc:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  801cc3:	c7 00 07 04 00 00    	movl   $0x407,(%rax)
+
+	return 0;
+  801cc9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cce:	c9                   	leave
+  801ccf:	c3                   	ret
+
+0000000000801cd0 <serve_set_size>:
+
+// 设置文件大小
+static int
+serve_set_size(envid_t envid, union Fsipc *ipc)
+{
+  801cd0:	55                   	push   %rbp
+  801cd1:	48 89 e5             	mov    %rsp,%rbp
+  801cd4:	48 83 ec 30          	sub    $0x30,%rsp
+  801cd8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801cdb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Fsreq_set_size *req = &ipc->set_size;
+  801cdf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ce3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	struct OpenFile *o;
+	int r;
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  801ce7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ceb:	8b 00                	mov    (%rax),%eax
+  801ced:	89 c1                	mov    %eax,%ecx
+  801cef:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801cf3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801cf6:	89 ce                	mov    %ecx,%esi
+  801cf8:	89 c7                	mov    %eax,%edi
+  801cfa:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  801d01:	00 00 00 
+  801d04:	ff d0                	call   *%rax
+  801d06:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  801d09:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801d0d:	79 05                	jns    801d14 <serve_set_size+0x44>
+		return r;
+  801d0f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801d12:	eb 4c                	jmp    801d60 <serve_set_size+0x90>
+	if ((r = file_set_size(o->o_file, req->req_size)) < 0)
+  801d14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d18:	8b 50 04             	mov    0x4(%rax),%edx
+  801d1b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d1f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d23:	89 d6                	mov    %edx,%esi
+  801d25:	48 89 c7             	mov    %rax,%rdi
+  801d28:	48 b8 7f 16 80 00 00 	movabs $0x80167f,%rax
+  801d2f:	00 00 00 
+  801d32:	ff d0                	call   *%rax
+  801d34:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  801d37:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801d3b:	79 05                	jns    801d42 <serve_set_size+0x72>
+		return r;
+  801d3d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801d40:	eb 1e                	jmp    801d60 <serve_set_size+0x90>
+	o->o_fd->fd_file.size = o->o_file->f_size;
+  801d42:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d46:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  801d4a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d4e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801d52:	8b 92 80 00 00 00    	mov    0x80(%rdx),%edx
+  801d58:	89 50 10             	mov    %edx,0x10(%rax)
+	return 0;
+  801d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d60:	c9                   	leave
+  801d61:	c3                   	ret
+
+0000000000801d62 <serve_read>:
+
+// 从当前偏移读取最多 req_n 字节到请求页，返回读取的字节数
+static int
+serve_read(envid_t envid, union Fsipc *ipc)
+{
+  801d62:	55                   	push   %rbp
+  801d63:	48 89 e5             	mov    %rsp,%rbp
+  801d66:	48 83 ec 40          	sub    $0x40,%rsp
+  801d6a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  801d6d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	struct Fsreq_read *req = &ipc->read;
+  801d71:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801d75:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	struct Fsret_read *ret = &ipc->readRet;
+  801d79:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801d7d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	struct OpenFile *o;
+	int r;
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  801d81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d85:	8b 00                	mov    (%rax),%eax
+  801d87:	89 c1                	mov    %eax,%ecx
+  801d89:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  801d8d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801d90:	89 ce                	mov    %ecx,%esi
+  801d92:	89 c7                	mov    %eax,%edi
+  801d94:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  801d9b:	00 00 00 
+  801d9e:	ff d0                	call   *%rax
+  801da0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801da3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801da7:	79 05                	jns    801dae <serve_read+0x4c>
+		return r;
+  801da9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801dac:	eb 75                	jmp    801e23 <serve_read+0xc1>
+	if ((r = file_read(o->o_file, ret->ret_buf, MIN(req->req_n, sizeof(ret->ret_buf)),
+					   o->o_fd->fd_offset)) < 0)
+  801dae:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801db2:	48 8b 40 18          	mov    0x18(%rax),%rax
+	if ((r = file_read(o->o_file, ret->ret_buf, MIN(req->req_n, sizeof(ret->ret_buf)),
+  801db6:	8b 48 04             	mov    0x4(%rax),%ecx
+  801db9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801dbd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801dc1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801dc5:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  801dcc:	00 
+  801dcd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801dd1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dd5:	48 39 c2             	cmp    %rax,%rdx
+  801dd8:	48 0f 47 d0          	cmova  %rax,%rdx
+  801ddc:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801de0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801de4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801de8:	48 89 c7             	mov    %rax,%rdi
+  801deb:	48 b8 6f 12 80 00 00 	movabs $0x80126f,%rax
+  801df2:	00 00 00 
+  801df5:	ff d0                	call   *%rax
+  801df7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801dfa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801dfe:	79 05                	jns    801e05 <serve_read+0xa3>
+		return r;
+  801e00:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801e03:	eb 1e                	jmp    801e23 <serve_read+0xc1>
+	o->o_fd->fd_offset += r;
+  801e05:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e09:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e0d:	8b 48 04             	mov    0x4(%rax),%ecx
+  801e10:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e14:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e18:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801e1b:	01 ca                	add    %ecx,%edx
+  801e1d:	89 50 04             	mov    %edx,0x4(%rax)
+	return r;
+  801e20:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  801e23:	c9                   	leave
+  801e24:	c3                   	ret
+
+0000000000801e25 <serve_write>:
+
+// 将请求页中的 req_n 字节写到当前偏移，返回写入的字节数
+static int
+serve_write(envid_t envid, union Fsipc *ipc)
+{
+  801e25:	55                   	push   %rbp
+  801e26:	48 89 e5             	mov    %rsp,%rbp
+  801e29:	48 83 ec 40          	sub    $0x40,%rsp
+  801e2d:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  801e30:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	struct Fsreq_write *req = &ipc->write;
+  801e34:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801e38:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	struct OpenFile *o;
+	int r;
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  801e3c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e40:	8b 40 08             	mov    0x8(%rax),%eax
+  801e43:	89 c1                	mov    %eax,%ecx
+  801e45:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801e49:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801e4c:	89 ce                	mov    %ecx,%esi
+  801e4e:	89 c7                	mov    %eax,%edi
+  801e50:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  801e57:	00 00 00 
+  801e5a:	ff d0                	call   *%rax
+  801e5c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  801e5f:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801e63:	79 08                	jns    801e6d <serve_write+0x48>
+		return r;
+  801e65:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e68:	e9 91 00 00 00       	jmp    801efe <serve_write+0xd9>
+	if ((r = file_write(o->o_file, req->req_buf, MIN(req->req_n, sizeof(req->req_buf)),
+						o->o_fd->fd_offset)) < 0)
+  801e6d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e71:	48 8b 40 18          	mov    0x18(%rax),%rax
+	if ((r = file_write(o->o_file, req->req_buf, MIN(req->req_n, sizeof(req->req_buf)),
+  801e75:	8b 48 04             	mov    0x4(%rax),%ecx
+  801e78:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e7c:	48 8b 00             	mov    (%rax),%rax
+  801e7f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  801e83:	48 c7 45 e0 f4 0f 00 	movq   $0xff4,-0x20(%rbp)
+  801e8a:	00 
+  801e8b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e8f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e93:	48 39 c2             	cmp    %rax,%rdx
+  801e96:	48 0f 47 d0          	cmova  %rax,%rdx
+  801e9a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e9e:	48 8d 70 0c          	lea    0xc(%rax),%rsi
+  801ea2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ea6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801eaa:	48 89 c7             	mov    %rax,%rdi
+  801ead:	48 b8 cd 13 80 00 00 	movabs $0x8013cd,%rax
+  801eb4:	00 00 00 
+  801eb7:	ff d0                	call   *%rax
+  801eb9:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  801ebc:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801ec0:	79 05                	jns    801ec7 <serve_write+0xa2>
+		return r;
+  801ec2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801ec5:	eb 37                	jmp    801efe <serve_write+0xd9>
+	o->o_fd->fd_offset += r;
+  801ec7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ecb:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801ecf:	8b 48 04             	mov    0x4(%rax),%ecx
+  801ed2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ed6:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801eda:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  801edd:	01 ca                	add    %ecx,%edx
+  801edf:	89 50 04             	mov    %edx,0x4(%rax)
+	o->o_fd->fd_file.size = o->o_file->f_size;
+  801ee2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ee6:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  801eea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801eee:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801ef2:	8b 92 80 00 00 00    	mov    0x80(%rdx),%edx
+  801ef8:	89 50 10             	mov    %edx,0x10(%rax)
+	return r;
+  801efb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+}
+  801efe:	c9                   	leave
+  801eff:	c3                   	ret
+
+0000000000801f00 <serve_stat>:
+
+// 返回文件的名称、大小和类型
+static int
+serve_stat(envid_t envid, union Fsipc *ipc)
+{
+  801f00:	55                   	push   %rbp
+  801f01:	48 89 e5             	mov    %rsp,%rbp
+  801f04:	48 83 ec 30          	sub    $0x30,%rsp
+  801f08:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801f0b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Fsreq_stat *req = &ipc->stat;
+  801f0f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f13:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	struct Fsret_stat *ret = &ipc->statRet;
+  801f17:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f1b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	struct OpenFile *o;
+	int r;
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  801f1f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f23:	8b 00                	mov    (%rax),%eax
+  801f25:	89 c1                	mov    %eax,%ecx
+  801f27:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  801f2b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801f2e:	89 ce                	mov    %ecx,%esi
+  801f30:	89 c7                	mov    %eax,%edi
+  801f32:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  801f39:	00 00 00 
+  801f3c:	ff d0                	call   *%rax
+  801f3e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801f41:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801f45:	79 05                	jns    801f4c <serve_stat+0x4c>
+		return r;
+  801f47:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801f4a:	eb 5f                	jmp    801fab <serve_stat+0xab>
+
+	strcpy(ret->ret_name, o->o_file->f_name);
+  801f4c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f50:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f54:	48 89 c2             	mov    %rax,%rdx
+  801f57:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f5b:	48 89 d6             	mov    %rdx,%rsi
+  801f5e:	48 89 c7             	mov    %rax,%rdi
+  801f61:	48 b8 96 34 80 00 00 	movabs $0x803496,%rax
+  801f68:	00 00 00 
+  801f6b:	ff d0                	call   *%rax
+	ret->ret_size = o->o_file->f_size;
+  801f6d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f71:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f75:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  801f7b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f7f:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	ret->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+  801f85:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f89:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f8d:	8b 80 84 00 00 00    	mov    0x84(%rax),%eax
+  801f93:	83 f8 01             	cmp    $0x1,%eax
+  801f96:	0f 94 c0             	sete   %al
+  801f99:	0f b6 d0             	movzbl %al,%edx
+  801f9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801fa0:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  801fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fab:	c9                   	leave
+  801fac:	c3                   	ret
+
+0000000000801fad <serve_flush>:
+
+// 将文件写回磁盘
+static int
+serve_flush(envid_t envid, union Fsipc *ipc)
+{
+  801fad:	55                   	push   %rbp
+  801fae:	48 89 e5             	mov    %rsp,%rbp
+  801fb1:	48 83 ec 20          	sub    $0x20,%rsp
+  801fb5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801fb8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct OpenFile *o;
+	int r;
+
+	if ((r = openfile_lookup(envid, ipc->flush.req_fileid, &o)) < 0)
+  801fbc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801fc0:	8b 00                	mov    (%rax),%eax
+  801fc2:	89 c1                	mov    %eax,%ecx
+  801fc4:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  801fc8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801fcb:	89 ce                	mov    %ecx,%esi
+  801fcd:	89 c7                	mov    %eax,%edi
+  801fcf:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  801fd6:	00 00 00 
+  801fd9:	ff d0                	call   *%rax
+  801fdb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801fde:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801fe2:	79 05                	jns    801fe9 <serve_flush+0x3c>
+		return r;
+  801fe4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fe7:	eb 1c                	jmp    802005 <serve_flush+0x58>
+	file_flush(o->o_file);
+  801fe9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801fed:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801ff1:	48 89 c7             	mov    %rax,%rdi
+  801ff4:	48 b8 dc 16 80 00 00 	movabs $0x8016dc,%rax
+  801ffb:	00 00 00 
+  801ffe:	ff d0                	call   *%rax
+	return 0;
+  802000:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802005:	c9                   	leave
+  802006:	c3                   	ret
+
+0000000000802007 <serve_remove>:
+
+// 删除文件
+static int
+serve_remove(envid_t envid, union Fsipc *ipc)
+{
+  802007:	55                   	push   %rbp
+  802008:	48 89 e5             	mov    %rsp,%rbp
+  80200b:	48 81 ec 10 04 00 00 	sub    $0x410,%rsp
+  802012:	89 bd fc fb ff ff    	mov    %edi,-0x404(%rbp)
+  802018:	48 89 b5 f0 fb ff ff 	mov    %rsi,-0x410(%rbp)
+	char path[MAXPATHLEN];
+
+	memmove(path, ipc->remove.req_path, MAXPATHLEN);
+  80201f:	48 8b 8d f0 fb ff ff 	mov    -0x410(%rbp),%rcx
+  802026:	48 8d 85 00 fc ff ff 	lea    -0x400(%rbp),%rax
+  80202d:	ba 00 04 00 00       	mov    $0x400,%edx
+  802032:	48 89 ce             	mov    %rcx,%rsi
+  802035:	48 89 c7             	mov    %rax,%rdi
+  802038:	48 b8 22 3b 80 00 00 	movabs $0x803b22,%rax
+  80203f:	00 00 00 
+  802042:	ff d0                	call   *%rax
+	path[MAXPATHLEN - 1] = 0;
+  802044:	c6 45 ff 00          	movb   $0x0,-0x1(%rbp)
+	return file_remove(path);
+  802048:	48 8d 85 00 fc ff ff 	lea    -0x400(%rbp),%rax
+  80204f:	48 89 c7             	mov    %rax,%rdi
+  802052:	48 b8 c2 17 80 00 00 	movabs $0x8017c2,%rax
+  802059:	00 00 00 
+  80205c:	ff d0                	call   *%rax
+}
+  80205e:	c9                   	leave
+  80205f:	c3                   	ret
+
+0000000000802060 <serve_sync>:
+
+// 将整个文件系统写回磁盘
+static int
+serve_sync(envid_t envid, union Fsipc *req)
+{
+  802060:	55                   	push   %rbp
+  802061:	48 89 e5             	mov    %rsp,%rbp
+  802064:	48 83 ec 10          	sub    $0x10,%rsp
+  802068:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80206b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	fs_sync();
+  80206f:	48 b8 44 18 80 00 00 	movabs $0x801844,%rax
+  802076:	00 00 00 
+  802079:	ff d0                	call   *%rax
+	return 0;
+  80207b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802080:	c9                   	leave
+  802081:	c3                   	ret
+
+0000000000802082 <serve_map>:
+ * 把文件 req_offset 处的块缓存页只读地共享给客户端
+ * 客户端把它映射到自己的文件窗口中直接读取，不需要经过 IPC 复制数据
+ */
+static int
+serve_map(envid_t envid, struct Fsreq_map *req, void **pg_store, int *perm_store)
+{
+  802082:	55                   	push   %rbp
+  802083:	48 89 e5             	mov    %rsp,%rbp
+  802086:	48 83 ec 40          	sub    $0x40,%rsp
+  80208a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80208d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802091:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802095:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+	struct OpenFile *o;
+	char *blk;
+	int r;
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  802099:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80209d:	8b 00                	mov    (%rax),%eax
+  80209f:	89 c1                	mov    %eax,%ecx
+  8020a1:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8020a5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8020a8:	89 ce                	mov    %ecx,%esi
+  8020aa:	89 c7                	mov    %eax,%edi
+  8020ac:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  8020b3:	00 00 00 
+  8020b6:	ff d0                	call   *%rax
+  8020b8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8020bb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8020bf:	79 08                	jns    8020c9 <serve_map+0x47>
+		return r;
+  8020c1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020c4:	e9 9e 00 00 00       	jmp    802167 <serve_map+0xe5>
+	if (req->req_offset < 0 || req->req_offset % BLKSIZE ||
+  8020c9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020cd:	8b 40 04             	mov    0x4(%rax),%eax
+  8020d0:	85 c0                	test   %eax,%eax
+  8020d2:	78 29                	js     8020fd <serve_map+0x7b>
+  8020d4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020d8:	8b 40 04             	mov    0x4(%rax),%eax
+  8020db:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8020e0:	85 c0                	test   %eax,%eax
+  8020e2:	75 19                	jne    8020fd <serve_map+0x7b>
+		req->req_offset >= o->o_file->f_size)
+  8020e4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020e8:	8b 50 04             	mov    0x4(%rax),%edx
+  8020eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020ef:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8020f3:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+	if (req->req_offset < 0 || req->req_offset % BLKSIZE ||
+  8020f9:	39 c2                	cmp    %eax,%edx
+  8020fb:	7c 07                	jl     802104 <serve_map+0x82>
+		return -E_INVAL;
+  8020fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802102:	eb 63                	jmp    802167 <serve_map+0xe5>
+	if ((r = file_get_block(o->o_file, req->req_offset / BLKSIZE, &blk)) < 0)
+  802104:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802108:	8b 40 04             	mov    0x4(%rax),%eax
+  80210b:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  802111:	85 c0                	test   %eax,%eax
+  802113:	0f 48 c2             	cmovs  %edx,%eax
+  802116:	c1 f8 0c             	sar    $0xc,%eax
+  802119:	89 c1                	mov    %eax,%ecx
+  80211b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80211f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802123:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802127:	89 ce                	mov    %ecx,%esi
+  802129:	48 89 c7             	mov    %rax,%rdi
+  80212c:	48 b8 6c 0b 80 00 00 	movabs $0x800b6c,%rax
+  802133:	00 00 00 
+  802136:	ff d0                	call   *%rax
+  802138:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80213b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80213f:	79 05                	jns    802146 <serve_map+0xc4>
+		return r;
+  802141:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802144:	eb 21                	jmp    802167 <serve_map+0xe5>
+	// 确保块已读入缓存(缺页时由 bc_pgfault 读入)，才能通过 IPC 映射
+	(void)*(volatile char *)blk;
+  802146:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80214a:	0f b6 00             	movzbl (%rax),%eax
+
+	*pg_store = blk;
+  80214d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802151:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802155:	48 89 10             	mov    %rdx,(%rax)
+	*perm_store = PTE_P | PTE_U | PTE_SHARE;
+  802158:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80215c:	c7 00 05 04 00 00    	movl   $0x405,(%rax)
+	return 0;
+  802162:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802167:	c9                   	leave
+  802168:	c3                   	ret
+
+0000000000802169 <serve_exec>:
+ * 把文件设为请求者刚创建的子环境 req_envid 的程序映像(sys_image_attach)
+ * 先把文件写回磁盘，再把各块在磁盘上的位置交给内核，内核按需从磁盘读入程序页
+ */
+static int
+serve_exec(envid_t envid, union Fsipc *ipc)
+{
+  802169:	55                   	push   %rbp
+  80216a:	48 89 e5             	mov    %rsp,%rbp
+  80216d:	48 83 ec 60          	sub    $0x60,%rsp
+  802171:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  802174:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+	static uint64_t secnos[NDIRECT + NINDIRECT];
+	struct Fsreq_exec *req = &ipc->exec;
+  802178:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80217c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	const volatile struct Env *child = &procs[ENVX(req->req_envid)];
+  802180:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802184:	8b 40 04             	mov    0x4(%rax),%eax
+  802187:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80218c:	48 98                	cltq
+  80218e:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  802195:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  80219c:	00 00 00 
+  80219f:	48 01 d0             	add    %rdx,%rax
+  8021a2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct OpenFile *o;
+	char *blk;
+	uint32_t i, nblocks;
+	int r;
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  8021a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8021aa:	8b 00                	mov    (%rax),%eax
+  8021ac:	89 c1                	mov    %eax,%ecx
+  8021ae:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  8021b2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8021b5:	89 ce                	mov    %ecx,%esi
+  8021b7:	89 c7                	mov    %eax,%edi
+  8021b9:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  8021c0:	00 00 00 
+  8021c3:	ff d0                	call   *%rax
+  8021c5:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8021c8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8021cc:	79 08                	jns    8021d6 <serve_exec+0x6d>
+		return r;
+  8021ce:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8021d1:	e9 62 01 00 00       	jmp    802338 <serve_exec+0x1cf>
+	// 只能为自己尚未运行的子环境设置程序
+	if (child->proc_id != req->req_envid || child->env_parent_id != envid ||
+  8021d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021da:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  8021e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8021e4:	8b 40 04             	mov    0x4(%rax),%eax
+  8021e7:	39 c2                	cmp    %eax,%edx
+  8021e9:	75 1e                	jne    802209 <serve_exec+0xa0>
+  8021eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021ef:	8b 80 dc 00 00 00    	mov    0xdc(%rax),%eax
+  8021f5:	39 45 ac             	cmp    %eax,-0x54(%rbp)
+  8021f8:	75 0f                	jne    802209 <serve_exec+0xa0>
+		child->env_status != ENV_NOT_RUNNABLE)
+  8021fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021fe:	8b 80 e4 00 00 00    	mov    0xe4(%rax),%eax
+	if (child->proc_id != req->req_envid || child->env_parent_id != envid ||
+  802204:	83 f8 04             	cmp    $0x4,%eax
+  802207:	74 0a                	je     802213 <serve_exec+0xaa>
+		return -E_BAD_ENV;
+  802209:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  80220e:	e9 25 01 00 00       	jmp    802338 <serve_exec+0x1cf>
+	if (o->o_file->f_size <= 0)
+  802213:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802217:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80221b:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  802221:	85 c0                	test   %eax,%eax
+  802223:	7f 0a                	jg     80222f <serve_exec+0xc6>
+		return -E_NOT_EXEC;
+  802225:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80222a:	e9 09 01 00 00       	jmp    802338 <serve_exec+0x1cf>
+
+	nblocks = ROUNDUP(o->o_file->f_size, BLKSIZE) / BLKSIZE;
+  80222f:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802236:	00 
+  802237:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80223b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80223f:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  802245:	48 63 d0             	movslq %eax,%rdx
+  802248:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80224c:	48 01 d0             	add    %rdx,%rax
+  80224f:	48 83 e8 01          	sub    $0x1,%rax
+  802253:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802257:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80225b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802260:	48 f7 75 d8          	divq   -0x28(%rbp)
+  802264:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802268:	48 29 d0             	sub    %rdx,%rax
+  80226b:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  802271:	85 c0                	test   %eax,%eax
+  802273:	0f 48 c2             	cmovs  %edx,%eax
+  802276:	c1 f8 0c             	sar    $0xc,%eax
+  802279:	89 45 cc             	mov    %eax,-0x34(%rbp)
+	for (i = 0; i < nblocks; i++)
+  80227c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802283:	eb 5c                	jmp    8022e1 <serve_exec+0x178>
+	{
+		if ((r = file_get_block(o->o_file, i, &blk)) < 0)
+  802285:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802289:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80228d:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  802291:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  802294:	89 ce                	mov    %ecx,%esi
+  802296:	48 89 c7             	mov    %rax,%rdi
+  802299:	48 b8 6c 0b 80 00 00 	movabs $0x800b6c,%rax
+  8022a0:	00 00 00 
+  8022a3:	ff d0                	call   *%rax
+  8022a5:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8022a8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8022ac:	79 08                	jns    8022b6 <serve_exec+0x14d>
+			return r;
+  8022ae:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8022b1:	e9 82 00 00 00       	jmp    802338 <serve_exec+0x1cf>
+		secnos[i] = (uint64_t)(blk - (char *)DISKMAP) / BLKSIZE * BLKSECTS;
+  8022b6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8022ba:	48 2d 00 00 00 10    	sub    $0x10000000,%rax
+  8022c0:	48 c1 e8 0c          	shr    $0xc,%rax
+  8022c4:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+  8022cb:	00 
+  8022cc:	48 ba 20 10 81 00 00 	movabs $0x811020,%rdx
+  8022d3:	00 00 00 
+  8022d6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8022d9:	48 89 0c c2          	mov    %rcx,(%rdx,%rax,8)
+	for (i = 0; i < nblocks; i++)
+  8022dd:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8022e1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8022e4:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  8022e7:	72 9c                	jb     802285 <serve_exec+0x11c>
+	}
+	file_flush(o->o_file);
+  8022e9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022ed:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8022f1:	48 89 c7             	mov    %rax,%rdi
+  8022f4:	48 b8 dc 16 80 00 00 	movabs $0x8016dc,%rax
+  8022fb:	00 00 00 
+  8022fe:	ff d0                	call   *%rax
+	return sys_image_attach(req->req_envid, FSDEV, secnos, o->o_file->f_size);
+  802300:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802304:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802308:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  80230e:	48 63 d0             	movslq %eax,%rdx
+  802311:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802315:	8b 40 04             	mov    0x4(%rax),%eax
+  802318:	48 89 d1             	mov    %rdx,%rcx
+  80231b:	48 ba 20 10 81 00 00 	movabs $0x811020,%rdx
+  802322:	00 00 00 
+  802325:	be 01 00 00 00       	mov    $0x1,%esi
+  80232a:	89 c7                	mov    %eax,%edi
+  80232c:	48 b8 f0 45 80 00 00 	movabs $0x8045f0,%rax
+  802333:	00 00 00 
+  802336:	ff d0                	call   *%rax
+}
+  802338:	c9                   	leave
+  802339:	c3                   	ret
+
+000000000080233a <serve>:
+};
+#define NHANDLERS (sizeof(handlers) / sizeof(handlers[0]))
+
+static void
+serve(void)
+{
+  80233a:	55                   	push   %rbp
+  80233b:	48 89 e5             	mov    %rsp,%rbp
+  80233e:	48 83 ec 20          	sub    $0x20,%rsp
+	int perm, r;
+	void *pg;
+
+	while (1)
+	{
+		perm = 0;
+  802342:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+		req = ipc_recv(&whom, fsreq, &perm);
+  802349:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802350:	00 00 00 
+  802353:	48 8b 08             	mov    (%rax),%rcx
+  802356:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80235a:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  80235e:	48 89 ce             	mov    %rcx,%rsi
+  802361:	48 89 c7             	mov    %rax,%rdi
+  802364:	48 b8 bb 47 80 00 00 	movabs $0x8047bb,%rax
+  80236b:	00 00 00 
+  80236e:	ff d0                	call   *%rax
+  802370:	89 45 f8             	mov    %eax,-0x8(%rbp)
+		if (debug)
+			cprintf("fs req %d from %08x [page %08lx: %s]\n",
+					req, whom, uvpt[VPN(fsreq)], fsreq);
+
+		// 所有请求都必须带有参数页
+		if (!(perm & PTE_P))
+  802373:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802376:	83 e0 01             	and    $0x1,%eax
+  802379:	85 c0                	test   %eax,%eax
+  80237b:	75 28                	jne    8023a5 <serve+0x6b>
+		{
+			cprintf("Invalid request from %08x: no argument page\n", whom);
+  80237d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802380:	89 c6                	mov    %eax,%esi
+  802382:	48 b8 f8 5e 80 00 00 	movabs $0x805ef8,%rax
+  802389:	00 00 00 
+  80238c:	48 89 c7             	mov    %rax,%rdi
+  80238f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802394:	48 ba 0f 28 80 00 00 	movabs $0x80280f,%rdx
+  80239b:	00 00 00 
+  80239e:	ff d2                	call   *%rdx
+			continue;
+  8023a0:	e9 22 01 00 00       	jmp    8024c7 <serve+0x18d>
+		}
+
+		pg = NULL;
+  8023a5:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8023ac:	00 
+		if (req == FSREQ_OPEN)
+  8023ad:	83 7d f8 01          	cmpl   $0x1,-0x8(%rbp)
+  8023b1:	75 2e                	jne    8023e1 <serve+0xa7>
+			r = serve_open(whom, (struct Fsreq_open *)fsreq, &pg, &perm);
+  8023b3:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8023ba:	00 00 00 
+  8023bd:	48 8b 30             	mov    (%rax),%rsi
+  8023c0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8023c3:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  8023c7:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8023cb:	89 c7                	mov    %eax,%edi
+  8023cd:	48 b8 bf 1a 80 00 00 	movabs $0x801abf,%rax
+  8023d4:	00 00 00 
+  8023d7:	ff d0                	call   *%rax
+  8023d9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8023dc:	e9 aa 00 00 00       	jmp    80248b <serve+0x151>
+		else if (req == FSREQ_MAP)
+  8023e1:	83 7d f8 09          	cmpl   $0x9,-0x8(%rbp)
+  8023e5:	75 2e                	jne    802415 <serve+0xdb>
+			r = serve_map(whom, &fsreq->map, &pg, &perm);
+  8023e7:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8023ee:	00 00 00 
+  8023f1:	48 8b 00             	mov    (%rax),%rax
+  8023f4:	48 89 c6             	mov    %rax,%rsi
+  8023f7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8023fa:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  8023fe:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802402:	89 c7                	mov    %eax,%edi
+  802404:	48 b8 82 20 80 00 00 	movabs $0x802082,%rax
+  80240b:	00 00 00 
+  80240e:	ff d0                	call   *%rax
+  802410:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802413:	eb 76                	jmp    80248b <serve+0x151>
+		else if (req < NHANDLERS && handlers[req])
+  802415:	83 7d f8 0a          	cmpl   $0xa,-0x8(%rbp)
+  802419:	77 43                	ja     80245e <serve+0x124>
+  80241b:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  802422:	00 00 00 
+  802425:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802428:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80242c:	48 85 c0             	test   %rax,%rax
+  80242f:	74 2d                	je     80245e <serve+0x124>
+			r = handlers[req](whom, fsreq);
+  802431:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  802438:	00 00 00 
+  80243b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80243e:	48 8b 0c c2          	mov    (%rdx,%rax,8),%rcx
+  802442:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802449:	00 00 00 
+  80244c:	48 8b 10             	mov    (%rax),%rdx
+  80244f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802452:	48 89 d6             	mov    %rdx,%rsi
+  802455:	89 c7                	mov    %eax,%edi
+  802457:	ff d1                	call   *%rcx
+  802459:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80245c:	eb 2d                	jmp    80248b <serve+0x151>
+		else
+		{
+			cprintf("Invalid request code %d from %08x\n", req, whom);
+  80245e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802461:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802464:	89 c6                	mov    %eax,%esi
+  802466:	48 b8 28 5f 80 00 00 	movabs $0x805f28,%rax
+  80246d:	00 00 00 
+  802470:	48 89 c7             	mov    %rax,%rdi
+  802473:	b8 00 00 00 00       	mov    $0x0,%eax
+  802478:	48 b9 0f 28 80 00 00 	movabs $0x80280f,%rcx
+  80247f:	00 00 00 
+  802482:	ff d1                	call   *%rcx
+			r = -E_INVAL;
+  802484:	c7 45 fc fd ff ff ff 	movl   $0xfffffffd,-0x4(%rbp)
+		}
+		ipc_send(whom, r, pg, perm);
+  80248b:	8b 4d f0             	mov    -0x10(%rbp),%ecx
+  80248e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802492:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  802495:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802498:	89 c7                	mov    %eax,%edi
+  80249a:	48 b8 a5 48 80 00 00 	movabs $0x8048a5,%rax
+  8024a1:	00 00 00 
+  8024a4:	ff d0                	call   *%rax
+		sys_page_unmap(0, fsreq);
+  8024a6:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8024ad:	00 00 00 
+  8024b0:	48 8b 00             	mov    (%rax),%rax
+  8024b3:	48 89 c6             	mov    %rax,%rsi
+  8024b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024bb:	48 b8 ad 41 80 00 00 	movabs $0x8041ad,%rax
+  8024c2:	00 00 00 
+  8024c5:	ff d0                	call   *%rax
+		perm = 0;
+  8024c7:	e9 76 fe ff ff       	jmp    802342 <serve+0x8>
+
+00000000008024cc <umain>:
+	}
+}
+
+void umain(int argc, char **argv)
+{
+  8024cc:	55                   	push   %rbp
+  8024cd:	48 89 e5             	mov    %rsp,%rbp
+  8024d0:	48 83 ec 10          	sub    $0x10,%rsp
+  8024d4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024d7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	static_assert(sizeof(struct File) == 256);
+	binaryname = "fs";
+  8024db:	48 b8 78 80 80 00 00 	movabs $0x808078,%rax
+  8024e2:	00 00 00 
+  8024e5:	48 b9 4b 5f 80 00 00 	movabs $0x805f4b,%rcx
+  8024ec:	00 00 00 
+  8024ef:	48 89 08             	mov    %rcx,(%rax)
+	cprintf("FS is running\n");
+  8024f2:	48 b8 4e 5f 80 00 00 	movabs $0x805f4e,%rax
+  8024f9:	00 00 00 
+  8024fc:	48 89 c7             	mov    %rax,%rdi
+  8024ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802504:	48 ba 0f 28 80 00 00 	movabs $0x80280f,%rdx
+  80250b:	00 00 00 
+  80250e:	ff d2                	call   *%rdx
+
+	serve_init();
+  802510:	48 b8 92 18 80 00 00 	movabs $0x801892,%rax
+  802517:	00 00 00 
+  80251a:	ff d0                	call   *%rax
+	fs_init();
+  80251c:	48 b8 d9 09 80 00 00 	movabs $0x8009d9,%rax
+  802523:	00 00 00 
+  802526:	ff d0                	call   *%rax
+	serve();
+  802528:	48 b8 3a 23 80 00 00 	movabs $0x80233a,%rax
+  80252f:	00 00 00 
+  802532:	ff d0                	call   *%rax
+}
+  802534:	90                   	nop
+  802535:	c9                   	leave
+  802536:	c3                   	ret
+
+0000000000802537 <libmain>:
+
+/**
+ *  用户环境从lib/libmain.c中的函数libmain开始执行，这个函数进而调用umain，用户写的程序入口只能是umain
+ */
+void libmain(int argc, char **argv)
+{
+  802537:	55                   	push   %rbp
+  802538:	48 89 e5             	mov    %rsp,%rbp
+  80253b:	48 83 ec 10          	sub    $0x10,%rsp
+  80253f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802542:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 设置常量 thisproc 指向 procs[] 中当前环境的 Env 结构，ENVX 确保环境 id 未超过了 NENV
+	// thisproc 指向当前环境的 Env 结构
+	thisproc = &procs[ENVX(sys_getprocid())];
+  802546:	48 b8 82 40 80 00 00 	movabs $0x804082,%rax
+  80254d:	00 00 00 
+  802550:	ff d0                	call   *%rax
+  802552:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802557:	48 98                	cltq
+  802559:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  802560:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  802567:	00 00 00 
+  80256a:	48 01 c2             	add    %rax,%rdx
+  80256d:	48 b8 70 30 81 00 00 	movabs $0x813070,%rax
+  802574:	00 00 00 
+  802577:	48 89 10             	mov    %rdx,(%rax)
+
+	// 通过 CPUID 选择 memset/memmove/memcpy 的实现
+	mem_init();
+  80257a:	48 b8 2a 37 80 00 00 	movabs $0x80372a,%rax
+  802581:	00 00 00 
+  802584:	ff d0                	call   *%rax
+
+	// 为了能让panic()提示用户错误，存储程序的名称
+	if (argc > 0)
+  802586:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80258a:	7e 14                	jle    8025a0 <libmain+0x69>
+		binaryname = argv[0];
+  80258c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802590:	48 8b 00             	mov    (%rax),%rax
+  802593:	48 ba 78 80 80 00 00 	movabs $0x808078,%rdx
+  80259a:	00 00 00 
+  80259d:	48 89 02             	mov    %rax,(%rdx)
+
+	// 调用用户的主程序
+	umain(argc, argv);
+  8025a0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025a4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8025a7:	48 89 d6             	mov    %rdx,%rsi
+  8025aa:	89 c7                	mov    %eax,%edi
+  8025ac:	48 b8 cc 24 80 00 00 	movabs $0x8024cc,%rax
+  8025b3:	00 00 00 
+  8025b6:	ff d0                	call   *%rax
+
+	// 退出当前环境，env_destroy
+	sys_env_destroy(0);
+  8025b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025bd:	48 b8 3c 40 80 00 00 	movabs $0x80403c,%rax
+  8025c4:	00 00 00 
+  8025c7:	ff d0                	call   *%rax
+}
+  8025c9:	90                   	nop
+  8025ca:	c9                   	leave
+  8025cb:	c3                   	ret
+
+00000000008025cc <_panic>:
+/*
+ * 无法解决的致命错误会导致死机
+ * 打印"死机:<消息>”，然后导致处理器休眠进入HLT状态
+ */
+void _panic(const char *file, int line, const char *fmt, ...)
+{
+  8025cc:	55                   	push   %rbp
+  8025cd:	48 89 e5             	mov    %rsp,%rbp
+  8025d0:	53                   	push   %rbx
+  8025d1:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8025d8:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  8025df:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  8025e5:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  8025ec:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  8025f3:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  8025fa:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  802601:	84 c0                	test   %al,%al
+  802603:	74 23                	je     802628 <_panic+0x5c>
+  802605:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  80260c:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  802610:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  802614:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  802618:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  80261c:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  802620:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  802624:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  802628:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  80262f:	00 00 00 
+  802632:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  802639:	00 00 00 
+  80263c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802640:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  802647:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  80264e:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+	// 输出死机的信息
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802655:	48 b8 78 80 80 00 00 	movabs $0x808078,%rax
+  80265c:	00 00 00 
+  80265f:	48 8b 18             	mov    (%rax),%rbx
+  802662:	48 b8 82 40 80 00 00 	movabs $0x804082,%rax
+  802669:	00 00 00 
+  80266c:	ff d0                	call   *%rax
+  80266e:	89 c6                	mov    %eax,%esi
+  802670:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  802676:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80267d:	41 89 d0             	mov    %edx,%r8d
+  802680:	48 89 c1             	mov    %rax,%rcx
+  802683:	48 89 da             	mov    %rbx,%rdx
+  802686:	48 b8 68 5f 80 00 00 	movabs $0x805f68,%rax
+  80268d:	00 00 00 
+  802690:	48 89 c7             	mov    %rax,%rdi
+  802693:	b8 00 00 00 00       	mov    $0x0,%eax
+  802698:	49 b9 0f 28 80 00 00 	movabs $0x80280f,%r9
+  80269f:	00 00 00 
+  8026a2:	41 ff d1             	call   *%r9
+			sys_getprocid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8026a5:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  8026ac:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8026b3:	48 89 d6             	mov    %rdx,%rsi
+  8026b6:	48 89 c7             	mov    %rax,%rdi
+  8026b9:	48 b8 60 27 80 00 00 	movabs $0x802760,%rax
+  8026c0:	00 00 00 
+  8026c3:	ff d0                	call   *%rax
+	cprintf("\n");
+  8026c5:	48 b8 8b 5f 80 00 00 	movabs $0x805f8b,%rax
+  8026cc:	00 00 00 
+  8026cf:	48 89 c7             	mov    %rax,%rdi
+  8026d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026d7:	48 ba 0f 28 80 00 00 	movabs $0x80280f,%rdx
+  8026de:	00 00 00 
+  8026e1:	ff d2                	call   *%rdx
+
+	// 触发断点中断
+	while (1)
+		asm volatile("int3");
+  8026e3:	cc                   	int3
+  8026e4:	eb fd                	jmp    8026e3 <_panic+0x117>
+
+00000000008026e6 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8026e6:	55                   	push   %rbp
+  8026e7:	48 89 e5             	mov    %rsp,%rbp
+  8026ea:	48 83 ec 10          	sub    $0x10,%rsp
+  8026ee:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026f1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->buf[b->idx++] = ch;
+  8026f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8026f9:	8b 00                	mov    (%rax),%eax
+  8026fb:	8d 48 01             	lea    0x1(%rax),%ecx
+  8026fe:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802702:	89 0a                	mov    %ecx,(%rdx)
+  802704:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802707:	89 d1                	mov    %edx,%ecx
+  802709:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80270d:	48 98                	cltq
+  80270f:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+	if (b->idx == 256-1) {
+  802713:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802717:	8b 00                	mov    (%rax),%eax
+  802719:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80271e:	75 2c                	jne    80274c <putch+0x66>
+		sys_cputs(b->buf, b->idx);
+  802720:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802724:	8b 00                	mov    (%rax),%eax
+  802726:	48 98                	cltq
+  802728:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80272c:	48 83 c2 08          	add    $0x8,%rdx
+  802730:	48 89 c6             	mov    %rax,%rsi
+  802733:	48 89 d7             	mov    %rdx,%rdi
+  802736:	48 b8 b3 3f 80 00 00 	movabs $0x803fb3,%rax
+  80273d:	00 00 00 
+  802740:	ff d0                	call   *%rax
+		b->idx = 0;
+  802742:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802746:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	}
+	b->cnt++;
+  80274c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802750:	8b 40 04             	mov    0x4(%rax),%eax
+  802753:	8d 50 01             	lea    0x1(%rax),%edx
+  802756:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80275a:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80275d:	90                   	nop
+  80275e:	c9                   	leave
+  80275f:	c3                   	ret
+
+0000000000802760 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  802760:	55                   	push   %rbp
+  802761:	48 89 e5             	mov    %rsp,%rbp
+  802764:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80276b:	48 89 bd c8 fe ff ff 	mov    %rdi,-0x138(%rbp)
+  802772:	48 89 b5 c0 fe ff ff 	mov    %rsi,-0x140(%rbp)
+	struct printbuf b;
+	va_list aq;
+	va_copy(aq,ap);
+  802779:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  802780:	48 8b b5 c0 fe ff ff 	mov    -0x140(%rbp),%rsi
+  802787:	48 8b 06             	mov    (%rsi),%rax
+  80278a:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80278e:	48 89 01             	mov    %rax,(%rcx)
+  802791:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  802795:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  802799:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	b.idx = 0;
+  80279d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8027a4:	00 00 00 
+	b.cnt = 0;
+  8027a7:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8027ae:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, aq);
+  8027b1:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  8027b8:	48 8b 95 c8 fe ff ff 	mov    -0x138(%rbp),%rdx
+  8027bf:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8027c6:	48 89 c6             	mov    %rax,%rsi
+  8027c9:	48 b8 e6 26 80 00 00 	movabs $0x8026e6,%rax
+  8027d0:	00 00 00 
+  8027d3:	48 89 c7             	mov    %rax,%rdi
+  8027d6:	48 b8 ad 2b 80 00 00 	movabs $0x802bad,%rax
+  8027dd:	00 00 00 
+  8027e0:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  8027e2:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8027e8:	48 98                	cltq
+  8027ea:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8027f1:	48 83 c2 08          	add    $0x8,%rdx
+  8027f5:	48 89 c6             	mov    %rax,%rsi
+  8027f8:	48 89 d7             	mov    %rdx,%rdi
+  8027fb:	48 b8 b3 3f 80 00 00 	movabs $0x803fb3,%rax
+  802802:	00 00 00 
+  802805:	ff d0                	call   *%rax
+	va_end(aq);
+
+	return b.cnt;
+  802807:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80280d:	c9                   	leave
+  80280e:	c3                   	ret
+
+000000000080280f <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80280f:	55                   	push   %rbp
+  802810:	48 89 e5             	mov    %rsp,%rbp
+  802813:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  80281a:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  802821:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  802828:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80282f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  802836:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80283d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  802844:	84 c0                	test   %al,%al
+  802846:	74 20                	je     802868 <cprintf+0x59>
+  802848:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80284c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  802850:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  802854:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  802858:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80285c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  802860:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  802864:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+	va_list aq;
+	va_start(ap, fmt);
+  802868:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80286f:	00 00 00 
+  802872:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  802879:	00 00 00 
+  80287c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802880:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  802887:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80288e:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  802895:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80289c:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8028a3:	48 8b 06             	mov    (%rsi),%rax
+  8028a6:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8028aa:	48 89 01             	mov    %rax,(%rcx)
+  8028ad:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8028b1:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8028b5:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	cnt = vcprintf(fmt, aq);
+  8028b9:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8028c0:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8028c7:	48 89 d6             	mov    %rdx,%rsi
+  8028ca:	48 89 c7             	mov    %rax,%rdi
+  8028cd:	48 b8 60 27 80 00 00 	movabs $0x802760,%rax
+  8028d4:	00 00 00 
+  8028d7:	ff d0                	call   *%rax
+  8028d9:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return cnt;
+  8028df:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8028e5:	c9                   	leave
+  8028e6:	c3                   	ret
+
+00000000008028e7 <printnum>:
+ * num: 需要打印出来的整型数，base: 整型数的进制，其他参数同 vprintfmt
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+		 unsigned long long num, unsigned base, int width, int padc)
+{
+  8028e7:	55                   	push   %rbp
+  8028e8:	48 89 e5             	mov    %rsp,%rbp
+  8028eb:	48 83 ec 30          	sub    $0x30,%rsp
+  8028ef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028f3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8028f7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8028fb:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8028fe:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  802902:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+	// 当 num 超过一位数，首先递归函数自身打印所有高位的(更重要的)数字
+	if (num >= base)
+  802906:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802909:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  80290d:	72 54                	jb     802963 <printnum+0x7c>
+	{
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80290f:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  802912:	8d 78 ff             	lea    -0x1(%rax),%edi
+  802915:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  802918:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80291c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802921:	48 f7 f6             	div    %rsi
+  802924:	49 89 c2             	mov    %rax,%r10
+  802927:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80292a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80292d:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  802931:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802935:	41 89 c9             	mov    %ecx,%r9d
+  802938:	41 89 f8             	mov    %edi,%r8d
+  80293b:	89 d1                	mov    %edx,%ecx
+  80293d:	4c 89 d2             	mov    %r10,%rdx
+  802940:	48 89 c7             	mov    %rax,%rdi
+  802943:	48 b8 e7 28 80 00 00 	movabs $0x8028e7,%rax
+  80294a:	00 00 00 
+  80294d:	ff d0                	call   *%rax
+  80294f:	eb 1c                	jmp    80296d <printnum+0x86>
+	}
+	else
+	{
+		// 按照右对齐的格式在左侧补齐填充字符 padc
+		while (--width > 0)
+			putch(padc, putdat);
+  802951:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802955:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802958:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80295c:	48 89 d6             	mov    %rdx,%rsi
+  80295f:	89 c7                	mov    %eax,%edi
+  802961:	ff d1                	call   *%rcx
+		while (--width > 0)
+  802963:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  802967:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80296b:	7f e4                	jg     802951 <printnum+0x6a>
+	}
+
+	// 然后打印个位数字
+	putch("0123456789abcdef"[num % base], putdat);
+  80296d:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  802970:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802974:	ba 00 00 00 00       	mov    $0x0,%edx
+  802979:	48 f7 f1             	div    %rcx
+  80297c:	48 b8 90 61 80 00 00 	movabs $0x806190,%rax
+  802983:	00 00 00 
+  802986:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  80298a:	0f be c0             	movsbl %al,%eax
+  80298d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802991:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802995:	48 89 d6             	mov    %rdx,%rsi
+  802998:	89 c7                	mov    %eax,%edi
+  80299a:	ff d1                	call   *%rcx
+}
+  80299c:	90                   	nop
+  80299d:	c9                   	leave
+  80299e:	c3                   	ret
+
+000000000080299f <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  80299f:	55                   	push   %rbp
+  8029a0:	48 89 e5             	mov    %rsp,%rbp
+  8029a3:	48 83 ec 20          	sub    $0x20,%rsp
+  8029a7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8029ab:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;
+	if (lflag >= 2)
+  8029ae:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8029b2:	7e 4f                	jle    802a03 <getuint+0x64>
+		x = va_arg(*ap, unsigned long long);
+  8029b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029b8:	8b 00                	mov    (%rax),%eax
+  8029ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8029bd:	77 24                	ja     8029e3 <getuint+0x44>
+  8029bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029c3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8029c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029cb:	8b 00                	mov    (%rax),%eax
+  8029cd:	89 c0                	mov    %eax,%eax
+  8029cf:	48 01 d0             	add    %rdx,%rax
+  8029d2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8029d6:	8b 12                	mov    (%rdx),%edx
+  8029d8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8029db:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8029df:	89 0a                	mov    %ecx,(%rdx)
+  8029e1:	eb 14                	jmp    8029f7 <getuint+0x58>
+  8029e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029e7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8029eb:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8029ef:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8029f3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8029f7:	48 8b 00             	mov    (%rax),%rax
+  8029fa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8029fe:	e9 9d 00 00 00       	jmp    802aa0 <getuint+0x101>
+	else if (lflag)
+  802a03:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802a07:	74 4c                	je     802a55 <getuint+0xb6>
+		x = va_arg(*ap, unsigned long);
+  802a09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a0d:	8b 00                	mov    (%rax),%eax
+  802a0f:	83 f8 2f             	cmp    $0x2f,%eax
+  802a12:	77 24                	ja     802a38 <getuint+0x99>
+  802a14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a18:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802a1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a20:	8b 00                	mov    (%rax),%eax
+  802a22:	89 c0                	mov    %eax,%eax
+  802a24:	48 01 d0             	add    %rdx,%rax
+  802a27:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802a2b:	8b 12                	mov    (%rdx),%edx
+  802a2d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  802a30:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802a34:	89 0a                	mov    %ecx,(%rdx)
+  802a36:	eb 14                	jmp    802a4c <getuint+0xad>
+  802a38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a3c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802a40:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  802a44:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802a48:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  802a4c:	48 8b 00             	mov    (%rax),%rax
+  802a4f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802a53:	eb 4b                	jmp    802aa0 <getuint+0x101>
+	else
+		x = va_arg(*ap, unsigned int);
+  802a55:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a59:	8b 00                	mov    (%rax),%eax
+  802a5b:	83 f8 2f             	cmp    $0x2f,%eax
+  802a5e:	77 24                	ja     802a84 <getuint+0xe5>
+  802a60:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a64:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802a68:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a6c:	8b 00                	mov    (%rax),%eax
+  802a6e:	89 c0                	mov    %eax,%eax
+  802a70:	48 01 d0             	add    %rdx,%rax
+  802a73:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802a77:	8b 12                	mov    (%rdx),%edx
+  802a79:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  802a7c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802a80:	89 0a                	mov    %ecx,(%rdx)
+  802a82:	eb 14                	jmp    802a98 <getuint+0xf9>
+  802a84:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a88:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802a8c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  802a90:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802a94:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  802a98:	8b 00                	mov    (%rax),%eax
+  802a9a:	89 c0                	mov    %eax,%eax
+  802a9c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  802aa0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802aa4:	c9                   	leave
+  802aa5:	c3                   	ret
+
+0000000000802aa6 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  802aa6:	55                   	push   %rbp
+  802aa7:	48 89 e5             	mov    %rsp,%rbp
+  802aaa:	48 83 ec 20          	sub    $0x20,%rsp
+  802aae:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802ab2:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  802ab5:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  802ab9:	7e 4f                	jle    802b0a <getint+0x64>
+		x = va_arg(*ap, long long);
+  802abb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802abf:	8b 00                	mov    (%rax),%eax
+  802ac1:	83 f8 2f             	cmp    $0x2f,%eax
+  802ac4:	77 24                	ja     802aea <getint+0x44>
+  802ac6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802aca:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802ace:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ad2:	8b 00                	mov    (%rax),%eax
+  802ad4:	89 c0                	mov    %eax,%eax
+  802ad6:	48 01 d0             	add    %rdx,%rax
+  802ad9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802add:	8b 12                	mov    (%rdx),%edx
+  802adf:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  802ae2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802ae6:	89 0a                	mov    %ecx,(%rdx)
+  802ae8:	eb 14                	jmp    802afe <getint+0x58>
+  802aea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802aee:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802af2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  802af6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802afa:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  802afe:	48 8b 00             	mov    (%rax),%rax
+  802b01:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802b05:	e9 9d 00 00 00       	jmp    802ba7 <getint+0x101>
+	else if (lflag)
+  802b0a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802b0e:	74 4c                	je     802b5c <getint+0xb6>
+		x = va_arg(*ap, long);
+  802b10:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b14:	8b 00                	mov    (%rax),%eax
+  802b16:	83 f8 2f             	cmp    $0x2f,%eax
+  802b19:	77 24                	ja     802b3f <getint+0x99>
+  802b1b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b1f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802b23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b27:	8b 00                	mov    (%rax),%eax
+  802b29:	89 c0                	mov    %eax,%eax
+  802b2b:	48 01 d0             	add    %rdx,%rax
+  802b2e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802b32:	8b 12                	mov    (%rdx),%edx
+  802b34:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  802b37:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802b3b:	89 0a                	mov    %ecx,(%rdx)
+  802b3d:	eb 14                	jmp    802b53 <getint+0xad>
+  802b3f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b43:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802b47:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  802b4b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802b4f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  802b53:	48 8b 00             	mov    (%rax),%rax
+  802b56:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802b5a:	eb 4b                	jmp    802ba7 <getint+0x101>
+	else
+		x = va_arg(*ap, int);
+  802b5c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b60:	8b 00                	mov    (%rax),%eax
+  802b62:	83 f8 2f             	cmp    $0x2f,%eax
+  802b65:	77 24                	ja     802b8b <getint+0xe5>
+  802b67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b6b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802b6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b73:	8b 00                	mov    (%rax),%eax
+  802b75:	89 c0                	mov    %eax,%eax
+  802b77:	48 01 d0             	add    %rdx,%rax
+  802b7a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802b7e:	8b 12                	mov    (%rdx),%edx
+  802b80:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  802b83:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802b87:	89 0a                	mov    %ecx,(%rdx)
+  802b89:	eb 14                	jmp    802b9f <getint+0xf9>
+  802b8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b8f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802b93:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  802b97:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802b9b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  802b9f:	8b 00                	mov    (%rax),%eax
+  802ba1:	48 98                	cltq
+  802ba3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  802ba7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802bab:	c9                   	leave
+  802bac:	c3                   	ret
+
+0000000000802bad <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap)
+{
+  802bad:	55                   	push   %rbp
+  802bae:	48 89 e5             	mov    %rsp,%rbp
+  802bb1:	41 54                	push   %r12
+  802bb3:	53                   	push   %rbx
+  802bb4:	48 83 ec 60          	sub    $0x60,%rsp
+  802bb8:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802bbc:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  802bc0:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802bc4:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+	int base, lflag, width, precision, altflag;
+
+	// 填充字符，在显示字符串的'%'后读到'-'或'0'时，赋值到 padc
+	char padc;
+	va_list aq;
+	va_copy(aq, ap);
+  802bc8:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802bcc:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  802bd0:	48 8b 06             	mov    (%rsi),%rax
+  802bd3:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  802bd7:	48 89 01             	mov    %rax,(%rcx)
+  802bda:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  802bde:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  802be2:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1)
+	{
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  802be6:	eb 17                	jmp    802bff <vprintfmt+0x52>
+		{
+			if (ch == '\0')
+  802be8:	85 db                	test   %ebx,%ebx
+  802bea:	0f 84 b9 04 00 00    	je     8030a9 <vprintfmt+0x4fc>
+				return;
+			putch(ch, putdat);
+  802bf0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802bf4:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  802bf8:	48 89 c6             	mov    %rax,%rsi
+  802bfb:	89 df                	mov    %ebx,%edi
+  802bfd:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  802bff:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802c03:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802c07:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802c0b:	0f b6 00             	movzbl (%rax),%eax
+  802c0e:	0f b6 d8             	movzbl %al,%ebx
+  802c11:	83 fb 25             	cmp    $0x25,%ebx
+  802c14:	75 d2                	jne    802be8 <vprintfmt+0x3b>
+		}
+
+		// 处理 % 转义序列
+		// padc 初始化为空格符，padc='-'代表字符串左对齐，右边补空格，padc=' '代表右对齐，左边补空格，padc='0'右对齐，左边补0
+		padc = ' ';
+  802c16:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+		width = -1;
+  802c1a:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+		// 默认-1代表显示长度为字符串本来的长度
+		precision = -1;
+  802c21:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+		lflag = 0;
+  802c28:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+		altflag = 0;
+  802c2f:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *)fmt++)
+  802c36:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802c3a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802c3e:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  802c42:	0f b6 00             	movzbl (%rax),%eax
+  802c45:	0f b6 d8             	movzbl %al,%ebx
+  802c48:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  802c4b:	83 f8 55             	cmp    $0x55,%eax
+  802c4e:	0f 87 22 04 00 00    	ja     803076 <vprintfmt+0x4c9>
+  802c54:	89 c0                	mov    %eax,%eax
+  802c56:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802c5d:	00 
+  802c5e:	48 b8 b8 61 80 00 00 	movabs $0x8061b8,%rax
+  802c65:	00 00 00 
+  802c68:	48 01 d0             	add    %rdx,%rax
+  802c6b:	48 8b 00             	mov    (%rax),%rax
+  802c6e:	ff e0                	jmp    *%rax
+		{
+
+		// flag to pad on the right
+		case '-':
+			padc = '-';
+  802c70:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+			goto reswitch;
+  802c74:	eb c0                	jmp    802c36 <vprintfmt+0x89>
+
+		// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  802c76:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+			goto reswitch;
+  802c7a:	eb ba                	jmp    802c36 <vprintfmt+0x89>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0;; ++fmt)
+  802c7c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+			{
+				precision = precision * 10 + ch - '0';
+  802c83:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802c86:	89 d0                	mov    %edx,%eax
+  802c88:	c1 e0 02             	shl    $0x2,%eax
+  802c8b:	01 d0                	add    %edx,%eax
+  802c8d:	01 c0                	add    %eax,%eax
+  802c8f:	01 d8                	add    %ebx,%eax
+  802c91:	83 e8 30             	sub    $0x30,%eax
+  802c94:	89 45 d8             	mov    %eax,-0x28(%rbp)
+				ch = *fmt;
+  802c97:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802c9b:	0f b6 00             	movzbl (%rax),%eax
+  802c9e:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  802ca1:	83 fb 2f             	cmp    $0x2f,%ebx
+  802ca4:	7e 60                	jle    802d06 <vprintfmt+0x159>
+  802ca6:	83 fb 39             	cmp    $0x39,%ebx
+  802ca9:	7f 5b                	jg     802d06 <vprintfmt+0x159>
+			for (precision = 0;; ++fmt)
+  802cab:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+				precision = precision * 10 + ch - '0';
+  802cb0:	eb d1                	jmp    802c83 <vprintfmt+0xd6>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  802cb2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cb5:	83 f8 2f             	cmp    $0x2f,%eax
+  802cb8:	77 17                	ja     802cd1 <vprintfmt+0x124>
+  802cba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802cbe:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  802cc1:	89 d2                	mov    %edx,%edx
+  802cc3:	48 01 d0             	add    %rdx,%rax
+  802cc6:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  802cc9:	83 c2 08             	add    $0x8,%edx
+  802ccc:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  802ccf:	eb 0c                	jmp    802cdd <vprintfmt+0x130>
+  802cd1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802cd5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  802cd9:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  802cdd:	8b 00                	mov    (%rax),%eax
+  802cdf:	89 45 d8             	mov    %eax,-0x28(%rbp)
+			goto process_precision;
+  802ce2:	eb 23                	jmp    802d07 <vprintfmt+0x15a>
+
+		case '.':
+			if (width < 0)
+  802ce4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  802ce8:	0f 89 48 ff ff ff    	jns    802c36 <vprintfmt+0x89>
+				width = 0;
+  802cee:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+			goto reswitch;
+  802cf5:	e9 3c ff ff ff       	jmp    802c36 <vprintfmt+0x89>
+
+		case '#':
+			altflag = 1;
+  802cfa:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+			goto reswitch;
+  802d01:	e9 30 ff ff ff       	jmp    802c36 <vprintfmt+0x89>
+			goto process_precision;
+  802d06:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  802d07:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  802d0b:	0f 89 25 ff ff ff    	jns    802c36 <vprintfmt+0x89>
+				width = precision, precision = -1;
+  802d11:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802d14:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  802d17:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+			goto reswitch;
+  802d1e:	e9 13 ff ff ff       	jmp    802c36 <vprintfmt+0x89>
+
+		// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  802d23:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+			goto reswitch;
+  802d27:	e9 0a ff ff ff       	jmp    802c36 <vprintfmt+0x89>
+
+		// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  802d2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d2f:	83 f8 2f             	cmp    $0x2f,%eax
+  802d32:	77 17                	ja     802d4b <vprintfmt+0x19e>
+  802d34:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d38:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  802d3b:	89 d2                	mov    %edx,%edx
+  802d3d:	48 01 d0             	add    %rdx,%rax
+  802d40:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  802d43:	83 c2 08             	add    $0x8,%edx
+  802d46:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  802d49:	eb 0c                	jmp    802d57 <vprintfmt+0x1aa>
+  802d4b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802d4f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  802d53:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  802d57:	8b 00                	mov    (%rax),%eax
+  802d59:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  802d5d:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802d61:	48 89 d6             	mov    %rdx,%rsi
+  802d64:	89 c7                	mov    %eax,%edi
+  802d66:	ff d1                	call   *%rcx
+			break;
+  802d68:	e9 37 03 00 00       	jmp    8030a4 <vprintfmt+0x4f7>
+
+		// error message
+		case 'e':
+			err = va_arg(aq, int);
+  802d6d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d70:	83 f8 2f             	cmp    $0x2f,%eax
+  802d73:	77 17                	ja     802d8c <vprintfmt+0x1df>
+  802d75:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d79:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  802d7c:	89 d2                	mov    %edx,%edx
+  802d7e:	48 01 d0             	add    %rdx,%rax
+  802d81:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  802d84:	83 c2 08             	add    $0x8,%edx
+  802d87:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  802d8a:	eb 0c                	jmp    802d98 <vprintfmt+0x1eb>
+  802d8c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802d90:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  802d94:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  802d98:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  802d9a:	85 db                	test   %ebx,%ebx
+  802d9c:	79 02                	jns    802da0 <vprintfmt+0x1f3>
+				err = -err;
+  802d9e:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802da0:	83 fb 11             	cmp    $0x11,%ebx
+  802da3:	7f 16                	jg     802dbb <vprintfmt+0x20e>
+  802da5:	48 ba 00 61 80 00 00 	movabs $0x806100,%rdx
+  802dac:	00 00 00 
+  802daf:	48 63 c3             	movslq %ebx,%rax
+  802db2:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  802db6:	4d 85 e4             	test   %r12,%r12
+  802db9:	75 2e                	jne    802de9 <vprintfmt+0x23c>
+				printfmt(putch, putdat, "error %d", err);
+  802dbb:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  802dbf:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802dc3:	89 d9                	mov    %ebx,%ecx
+  802dc5:	48 ba a1 61 80 00 00 	movabs $0x8061a1,%rdx
+  802dcc:	00 00 00 
+  802dcf:	48 89 c7             	mov    %rax,%rdi
+  802dd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dd7:	49 b8 b3 30 80 00 00 	movabs $0x8030b3,%r8
+  802dde:	00 00 00 
+  802de1:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  802de4:	e9 bb 02 00 00       	jmp    8030a4 <vprintfmt+0x4f7>
+				printfmt(putch, putdat, "%s", p);
+  802de9:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  802ded:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802df1:	4c 89 e1             	mov    %r12,%rcx
+  802df4:	48 ba aa 61 80 00 00 	movabs $0x8061aa,%rdx
+  802dfb:	00 00 00 
+  802dfe:	48 89 c7             	mov    %rax,%rdi
+  802e01:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e06:	49 b8 b3 30 80 00 00 	movabs $0x8030b3,%r8
+  802e0d:	00 00 00 
+  802e10:	41 ff d0             	call   *%r8
+			break;
+  802e13:	e9 8c 02 00 00       	jmp    8030a4 <vprintfmt+0x4f7>
+
+		// string
+		case 's':
+			// 从可变参数中读入字符串指针
+			if ((p = va_arg(aq, char *)) == NULL)
+  802e18:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e1b:	83 f8 2f             	cmp    $0x2f,%eax
+  802e1e:	77 17                	ja     802e37 <vprintfmt+0x28a>
+  802e20:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e24:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  802e27:	89 d2                	mov    %edx,%edx
+  802e29:	48 01 d0             	add    %rdx,%rax
+  802e2c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  802e2f:	83 c2 08             	add    $0x8,%edx
+  802e32:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  802e35:	eb 0c                	jmp    802e43 <vprintfmt+0x296>
+  802e37:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802e3b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  802e3f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  802e43:	4c 8b 20             	mov    (%rax),%r12
+  802e46:	4d 85 e4             	test   %r12,%r12
+  802e49:	75 0a                	jne    802e55 <vprintfmt+0x2a8>
+				p = "(null)"; // 当字符串为空时，将它指向"(null)"字符串
+  802e4b:	49 bc ad 61 80 00 00 	movabs $0x8061ad,%r12
+  802e52:	00 00 00 
+			// 判断左对齐还是右对齐，pad='-'左对齐，否则右对齐
+			if (width > 0 && padc != '-')
+  802e55:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  802e59:	7e 78                	jle    802ed3 <vprintfmt+0x326>
+  802e5b:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  802e5f:	74 72                	je     802ed3 <vprintfmt+0x326>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802e61:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802e64:	48 98                	cltq
+  802e66:	48 89 c6             	mov    %rax,%rsi
+  802e69:	4c 89 e7             	mov    %r12,%rdi
+  802e6c:	48 b8 58 34 80 00 00 	movabs $0x803458,%rax
+  802e73:	00 00 00 
+  802e76:	ff d0                	call   *%rax
+  802e78:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  802e7b:	eb 17                	jmp    802e94 <vprintfmt+0x2e7>
+					putch(padc, putdat); // 字符串右对齐，左边补相应数量(width-实际长度)的空格或者 0
+  802e7d:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  802e81:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  802e85:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802e89:	48 89 d6             	mov    %rdx,%rsi
+  802e8c:	89 c7                	mov    %eax,%edi
+  802e8e:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802e90:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  802e94:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  802e98:	7f e3                	jg     802e7d <vprintfmt+0x2d0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802e9a:	eb 37                	jmp    802ed3 <vprintfmt+0x326>
+				if (altflag && (ch < ' ' || ch > '~'))
+  802e9c:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  802ea0:	74 1e                	je     802ec0 <vprintfmt+0x313>
+  802ea2:	83 fb 1f             	cmp    $0x1f,%ebx
+  802ea5:	7e 05                	jle    802eac <vprintfmt+0x2ff>
+  802ea7:	83 fb 7e             	cmp    $0x7e,%ebx
+  802eaa:	7e 14                	jle    802ec0 <vprintfmt+0x313>
+					putch('?', putdat);
+  802eac:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802eb0:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  802eb4:	48 89 c6             	mov    %rax,%rsi
+  802eb7:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  802ebc:	ff d2                	call   *%rdx
+  802ebe:	eb 0f                	jmp    802ecf <vprintfmt+0x322>
+				else
+					putch(ch, putdat); // 打印相应长度的字符串
+  802ec0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802ec4:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  802ec8:	48 89 c6             	mov    %rax,%rsi
+  802ecb:	89 df                	mov    %ebx,%edi
+  802ecd:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802ecf:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  802ed3:	4c 89 e0             	mov    %r12,%rax
+  802ed6:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  802eda:	0f b6 00             	movzbl (%rax),%eax
+  802edd:	0f be d8             	movsbl %al,%ebx
+  802ee0:	85 db                	test   %ebx,%ebx
+  802ee2:	74 28                	je     802f0c <vprintfmt+0x35f>
+  802ee4:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  802ee8:	78 b2                	js     802e9c <vprintfmt+0x2ef>
+  802eea:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  802eee:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  802ef2:	79 a8                	jns    802e9c <vprintfmt+0x2ef>
+			for (; width > 0; width--)
+  802ef4:	eb 16                	jmp    802f0c <vprintfmt+0x35f>
+				putch(' ', putdat); // 当字符串是左对齐的时候打印相应数量的空格
+  802ef6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802efa:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  802efe:	48 89 c6             	mov    %rax,%rsi
+  802f01:	bf 20 00 00 00       	mov    $0x20,%edi
+  802f06:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  802f08:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  802f0c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  802f10:	7f e4                	jg     802ef6 <vprintfmt+0x349>
+			break;
+  802f12:	e9 8d 01 00 00       	jmp    8030a4 <vprintfmt+0x4f7>
+
+		// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  802f17:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  802f1b:	be 03 00 00 00       	mov    $0x3,%esi
+  802f20:	48 89 c7             	mov    %rax,%rdi
+  802f23:	48 b8 a6 2a 80 00 00 	movabs $0x802aa6,%rax
+  802f2a:	00 00 00 
+  802f2d:	ff d0                	call   *%rax
+  802f2f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((long long)num < 0)
+  802f33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f37:	48 85 c0             	test   %rax,%rax
+  802f3a:	79 1d                	jns    802f59 <vprintfmt+0x3ac>
+			{
+				putch('-', putdat);
+  802f3c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802f40:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  802f44:	48 89 c6             	mov    %rax,%rsi
+  802f47:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802f4c:	ff d2                	call   *%rdx
+				num = -(long long)num;
+  802f4e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f52:	48 f7 d8             	neg    %rax
+  802f55:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			}
+			base = 10;
+  802f59:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  802f60:	e9 d2 00 00 00       	jmp    803037 <vprintfmt+0x48a>
+
+		// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  802f65:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  802f69:	be 03 00 00 00       	mov    $0x3,%esi
+  802f6e:	48 89 c7             	mov    %rax,%rdi
+  802f71:	48 b8 9f 29 80 00 00 	movabs $0x80299f,%rax
+  802f78:	00 00 00 
+  802f7b:	ff d0                	call   *%rax
+  802f7d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 10;
+  802f81:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  802f88:	e9 aa 00 00 00       	jmp    803037 <vprintfmt+0x48a>
+		// (unsigned) octal
+		case 'o':
+			// Gets the variable argument with type integer from the point which was processed last by va_arg
+			// calls getuint which returns a long long value, which then calls printnum which prints based on
+			// base value.
+			num = getuint(&aq, 3);
+  802f8d:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  802f91:	be 03 00 00 00       	mov    $0x3,%esi
+  802f96:	48 89 c7             	mov    %rax,%rdi
+  802f99:	48 b8 9f 29 80 00 00 	movabs $0x80299f,%rax
+  802fa0:	00 00 00 
+  802fa3:	ff d0                	call   *%rax
+  802fa5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 8;
+  802fa9:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+			goto number;
+  802fb0:	e9 82 00 00 00       	jmp    803037 <vprintfmt+0x48a>
+
+		// pointer
+		case 'p':
+			putch('0', putdat);
+  802fb5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802fb9:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  802fbd:	48 89 c6             	mov    %rax,%rsi
+  802fc0:	bf 30 00 00 00       	mov    $0x30,%edi
+  802fc5:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  802fc7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802fcb:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  802fcf:	48 89 c6             	mov    %rax,%rsi
+  802fd2:	bf 78 00 00 00       	mov    $0x78,%edi
+  802fd7:	ff d2                	call   *%rdx
+			num = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  802fd9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802fdc:	83 f8 2f             	cmp    $0x2f,%eax
+  802fdf:	77 17                	ja     802ff8 <vprintfmt+0x44b>
+  802fe1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802fe5:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  802fe8:	89 d2                	mov    %edx,%edx
+  802fea:	48 01 d0             	add    %rdx,%rax
+  802fed:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  802ff0:	83 c2 08             	add    $0x8,%edx
+  802ff3:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  802ff6:	eb 0c                	jmp    803004 <vprintfmt+0x457>
+  802ff8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802ffc:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803000:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803004:	48 8b 00             	mov    (%rax),%rax
+  803007:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  80300b:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+			goto number;
+  803012:	eb 23                	jmp    803037 <vprintfmt+0x48a>
+
+		// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  803014:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803018:	be 03 00 00 00       	mov    $0x3,%esi
+  80301d:	48 89 c7             	mov    %rax,%rdi
+  803020:	48 b8 9f 29 80 00 00 	movabs $0x80299f,%rax
+  803027:	00 00 00 
+  80302a:	ff d0                	call   *%rax
+  80302c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  803030:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  803037:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  80303c:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80303f:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  803042:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803046:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80304a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80304e:	45 89 c1             	mov    %r8d,%r9d
+  803051:	41 89 f8             	mov    %edi,%r8d
+  803054:	48 89 c7             	mov    %rax,%rdi
+  803057:	48 b8 e7 28 80 00 00 	movabs $0x8028e7,%rax
+  80305e:	00 00 00 
+  803061:	ff d0                	call   *%rax
+			break;
+  803063:	eb 3f                	jmp    8030a4 <vprintfmt+0x4f7>
+
+		// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  803065:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803069:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80306d:	48 89 c6             	mov    %rax,%rsi
+  803070:	89 df                	mov    %ebx,%edi
+  803072:	ff d2                	call   *%rdx
+			break;
+  803074:	eb 2e                	jmp    8030a4 <vprintfmt+0x4f7>
+
+		// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  803076:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80307a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80307e:	48 89 c6             	mov    %rax,%rsi
+  803081:	bf 25 00 00 00       	mov    $0x25,%edi
+  803086:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  803088:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  80308d:	eb 05                	jmp    803094 <vprintfmt+0x4e7>
+  80308f:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  803094:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803098:	48 83 e8 01          	sub    $0x1,%rax
+  80309c:	0f b6 00             	movzbl (%rax),%eax
+  80309f:	3c 25                	cmp    $0x25,%al
+  8030a1:	75 ec                	jne    80308f <vprintfmt+0x4e2>
+				/* do nothing */;
+			break;
+  8030a3:	90                   	nop
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  8030a4:	e9 56 fb ff ff       	jmp    802bff <vprintfmt+0x52>
+				return;
+  8030a9:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  8030aa:	48 83 c4 60          	add    $0x60,%rsp
+  8030ae:	5b                   	pop    %rbx
+  8030af:	41 5c                	pop    %r12
+  8030b1:	5d                   	pop    %rbp
+  8030b2:	c3                   	ret
+
+00000000008030b3 <printfmt>:
+
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...)
+{
+  8030b3:	55                   	push   %rbp
+  8030b4:	48 89 e5             	mov    %rsp,%rbp
+  8030b7:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8030be:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8030c5:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8030cc:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8030d3:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8030da:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8030e1:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8030e8:	84 c0                	test   %al,%al
+  8030ea:	74 20                	je     80310c <printfmt+0x59>
+  8030ec:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8030f0:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8030f4:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8030f8:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8030fc:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803100:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803104:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803108:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80310c:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  803113:	00 00 00 
+  803116:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80311d:	00 00 00 
+  803120:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803124:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80312b:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803132:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  803139:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  803140:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803147:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  80314e:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803155:	48 89 c7             	mov    %rax,%rdi
+  803158:	48 b8 ad 2b 80 00 00 	movabs $0x802bad,%rax
+  80315f:	00 00 00 
+  803162:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  803164:	90                   	nop
+  803165:	c9                   	leave
+  803166:	c3                   	ret
+
+0000000000803167 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  803167:	55                   	push   %rbp
+  803168:	48 89 e5             	mov    %rsp,%rbp
+  80316b:	48 83 ec 10          	sub    $0x10,%rsp
+  80316f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803172:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  803176:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80317a:	8b 40 10             	mov    0x10(%rax),%eax
+  80317d:	8d 50 01             	lea    0x1(%rax),%edx
+  803180:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803184:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  803187:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80318b:	48 8b 10             	mov    (%rax),%rdx
+  80318e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803192:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803196:	48 39 c2             	cmp    %rax,%rdx
+  803199:	73 17                	jae    8031b2 <sprintputch+0x4b>
+		*b->buf++ = ch;
+  80319b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80319f:	48 8b 00             	mov    (%rax),%rax
+  8031a2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8031a6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8031aa:	48 89 0a             	mov    %rcx,(%rdx)
+  8031ad:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8031b0:	88 10                	mov    %dl,(%rax)
+}
+  8031b2:	90                   	nop
+  8031b3:	c9                   	leave
+  8031b4:	c3                   	ret
+
+00000000008031b5 <vsnprintf>:
+
+int vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8031b5:	55                   	push   %rbp
+  8031b6:	48 89 e5             	mov    %rsp,%rbp
+  8031b9:	48 83 ec 50          	sub    $0x50,%rsp
+  8031bd:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8031c1:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  8031c4:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  8031c8:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+	va_list aq;
+	va_copy(aq, ap);
+  8031cc:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  8031d0:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  8031d4:	48 8b 06             	mov    (%rsi),%rax
+  8031d7:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8031db:	48 89 01             	mov    %rax,(%rcx)
+  8031de:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8031e2:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8031e6:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	struct sprintbuf b = {buf, buf + n - 1, 0};
+  8031ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031ee:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8031f2:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8031f5:	48 98                	cltq
+  8031f7:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8031fb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031ff:	48 01 d0             	add    %rdx,%rax
+  803202:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  803206:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+
+	if (buf == NULL || n < 1)
+  80320d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803212:	74 06                	je     80321a <vsnprintf+0x65>
+  803214:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  803218:	7f 07                	jg     803221 <vsnprintf+0x6c>
+		return -E_INVAL;
+  80321a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80321f:	eb 32                	jmp    803253 <vsnprintf+0x9e>
+
+	// print the string to the buffer
+	vprintfmt((void *)sprintputch, &b, fmt, aq);
+  803221:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  803225:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803229:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80322d:	48 89 c6             	mov    %rax,%rsi
+  803230:	48 b8 67 31 80 00 00 	movabs $0x803167,%rax
+  803237:	00 00 00 
+  80323a:	48 89 c7             	mov    %rax,%rdi
+  80323d:	48 b8 ad 2b 80 00 00 	movabs $0x802bad,%rax
+  803244:	00 00 00 
+  803247:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  803249:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80324d:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  803250:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  803253:	c9                   	leave
+  803254:	c3                   	ret
+
+0000000000803255 <snprintf>:
+
+int snprintf(char *buf, int n, const char *fmt, ...)
+{
+  803255:	55                   	push   %rbp
+  803256:	48 89 e5             	mov    %rsp,%rbp
+  803259:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  803260:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  803267:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  80326d:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  803274:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80327b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803282:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803289:	84 c0                	test   %al,%al
+  80328b:	74 20                	je     8032ad <snprintf+0x58>
+  80328d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803291:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803295:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803299:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80329d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8032a1:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8032a5:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8032a9:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  8032ad:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8032b4:	00 00 00 
+  8032b7:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8032be:	00 00 00 
+  8032c1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8032c5:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8032cc:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8032d3:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq, ap);
+  8032da:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8032e1:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8032e8:	48 8b 06             	mov    (%rsi),%rax
+  8032eb:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8032ef:	48 89 01             	mov    %rax,(%rcx)
+  8032f2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8032f6:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8032fa:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  8032fe:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  803305:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  80330c:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  803312:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  803319:	48 89 c7             	mov    %rax,%rdi
+  80331c:	48 b8 b5 31 80 00 00 	movabs $0x8031b5,%rax
+  803323:	00 00 00 
+  803326:	ff d0                	call   *%rax
+  803328:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  80332e:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  803334:	c9                   	leave
+  803335:	c3                   	ret
+
+0000000000803336 <cpuid>:
+#define read_rip(var) __asm __volatile("leaq (%%rip), %0" : "=r" (var)::"cc","memory")
+
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  803336:	55                   	push   %rbp
+  803337:	48 89 e5             	mov    %rsp,%rbp
+  80333a:	53                   	push   %rbx
+  80333b:	48 83 ec 38          	sub    $0x38,%rsp
+  80333f:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  803342:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803346:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80334a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80334e:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid" 
+  803352:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803355:	0f a2                	cpuid
+  803357:	89 de                	mov    %ebx,%esi
+  803359:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  80335c:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  80335f:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  803362:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info));
+	if (eaxp)
+  803365:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80336a:	74 09                	je     803375 <cpuid+0x3f>
+		*eaxp = eax;
+  80336c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803370:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803373:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  803375:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80337a:	74 09                	je     803385 <cpuid+0x4f>
+		*ebxp = ebx;
+  80337c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803380:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  803383:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  803385:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80338a:	74 09                	je     803395 <cpuid+0x5f>
+		*ecxp = ecx;
+  80338c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803390:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803393:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  803395:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80339a:	74 09                	je     8033a5 <cpuid+0x6f>
+		*edxp = edx;
+  80339c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8033a0:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8033a3:	89 10                	mov    %edx,(%rax)
+}
+  8033a5:	90                   	nop
+  8033a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033aa:	c9                   	leave
+  8033ab:	c3                   	ret
+
+00000000008033ac <cpuid_count>:
+
+// 带子功能号(%ecx = count)的 cpuid，用于 leaf 4/7/0xB/0xD 等
+static __inline void
+cpuid_count(uint32_t info, uint32_t count, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  8033ac:	55                   	push   %rbp
+  8033ad:	48 89 e5             	mov    %rsp,%rbp
+  8033b0:	53                   	push   %rbx
+  8033b1:	48 83 ec 38          	sub    $0x38,%rsp
+  8033b5:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  8033b8:	89 75 e0             	mov    %esi,-0x20(%rbp)
+  8033bb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8033bf:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  8033c3:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+  8033c7:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8033cb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8033ce:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8033d1:	89 d1                	mov    %edx,%ecx
+  8033d3:	0f a2                	cpuid
+  8033d5:	89 de                	mov    %ebx,%esi
+  8033d7:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8033da:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  8033dd:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  8033e0:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info), "c" (count));
+	if (eaxp)
+  8033e3:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8033e8:	74 09                	je     8033f3 <cpuid_count+0x47>
+		*eaxp = eax;
+  8033ea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8033ee:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8033f1:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  8033f3:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8033f8:	74 09                	je     803403 <cpuid_count+0x57>
+		*ebxp = ebx;
+  8033fa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033fe:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  803401:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  803403:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803408:	74 09                	je     803413 <cpuid_count+0x67>
+		*ecxp = ecx;
+  80340a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80340e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803411:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  803413:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803418:	74 09                	je     803423 <cpuid_count+0x77>
+		*edxp = edx;
+  80341a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80341e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803421:	89 10                	mov    %edx,(%rax)
+}
+  803423:	90                   	nop
+  803424:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803428:	c9                   	leave
+  803429:	c3                   	ret
+
+000000000080342a <strlen>:
+// 在真正的硬件上会有一定程度的优化, 但在 Bochs 上会有更大的优化效果
+// 用这种方法, Primespipe 的运行速度快了3倍
+#define ASM 1
+
+int strlen(const char *s)
+{
+  80342a:	55                   	push   %rbp
+  80342b:	48 89 e5             	mov    %rsp,%rbp
+  80342e:	48 83 ec 18          	sub    $0x18,%rsp
+  803432:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  803436:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80343d:	eb 09                	jmp    803448 <strlen+0x1e>
+		n++;
+  80343f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  803443:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  803448:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80344c:	0f b6 00             	movzbl (%rax),%eax
+  80344f:	84 c0                	test   %al,%al
+  803451:	75 ec                	jne    80343f <strlen+0x15>
+	return n;
+  803453:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803456:	c9                   	leave
+  803457:	c3                   	ret
+
+0000000000803458 <strnlen>:
+
+int strnlen(const char *s, size_t size)
+{
+  803458:	55                   	push   %rbp
+  803459:	48 89 e5             	mov    %rsp,%rbp
+  80345c:	48 83 ec 20          	sub    $0x20,%rsp
+  803460:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803464:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  803468:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80346f:	eb 0e                	jmp    80347f <strnlen+0x27>
+		n++;
+  803471:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  803475:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80347a:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  80347f:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803484:	74 0b                	je     803491 <strnlen+0x39>
+  803486:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80348a:	0f b6 00             	movzbl (%rax),%eax
+  80348d:	84 c0                	test   %al,%al
+  80348f:	75 e0                	jne    803471 <strnlen+0x19>
+	return n;
+  803491:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803494:	c9                   	leave
+  803495:	c3                   	ret
+
+0000000000803496 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  803496:	55                   	push   %rbp
+  803497:	48 89 e5             	mov    %rsp,%rbp
+  80349a:	48 83 ec 20          	sub    $0x20,%rsp
+  80349e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8034a2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  8034a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034aa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  8034ae:	90                   	nop
+  8034af:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8034b3:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8034b7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8034bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034bf:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8034c3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8034c7:	0f b6 12             	movzbl (%rdx),%edx
+  8034ca:	88 10                	mov    %dl,(%rax)
+  8034cc:	0f b6 00             	movzbl (%rax),%eax
+  8034cf:	84 c0                	test   %al,%al
+  8034d1:	75 dc                	jne    8034af <strcpy+0x19>
+		/* do nothing */;
+	return ret;
+  8034d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8034d7:	c9                   	leave
+  8034d8:	c3                   	ret
+
+00000000008034d9 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8034d9:	55                   	push   %rbp
+  8034da:	48 89 e5             	mov    %rsp,%rbp
+  8034dd:	48 83 ec 20          	sub    $0x20,%rsp
+  8034e1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8034e5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int len = strlen(dst);
+  8034e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034ed:	48 89 c7             	mov    %rax,%rdi
+  8034f0:	48 b8 2a 34 80 00 00 	movabs $0x80342a,%rax
+  8034f7:	00 00 00 
+  8034fa:	ff d0                	call   *%rax
+  8034fc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	strcpy(dst + len, src);
+  8034ff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803502:	48 63 d0             	movslq %eax,%rdx
+  803505:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803509:	48 01 c2             	add    %rax,%rdx
+  80350c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803510:	48 89 c6             	mov    %rax,%rsi
+  803513:	48 89 d7             	mov    %rdx,%rdi
+  803516:	48 b8 96 34 80 00 00 	movabs $0x803496,%rax
+  80351d:	00 00 00 
+  803520:	ff d0                	call   *%rax
+	return dst;
+  803522:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  803526:	c9                   	leave
+  803527:	c3                   	ret
+
+0000000000803528 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  803528:	55                   	push   %rbp
+  803529:	48 89 e5             	mov    %rsp,%rbp
+  80352c:	48 83 ec 28          	sub    $0x28,%rsp
+  803530:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803534:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803538:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  80353c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803540:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++)
+  803544:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80354b:	00 
+  80354c:	eb 2a                	jmp    803578 <strncpy+0x50>
+	{
+		*dst++ = *src;
+  80354e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803552:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803556:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80355a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80355e:	0f b6 12             	movzbl (%rdx),%edx
+  803561:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  803563:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803567:	0f b6 00             	movzbl (%rax),%eax
+  80356a:	84 c0                	test   %al,%al
+  80356c:	74 05                	je     803573 <strncpy+0x4b>
+			src++;
+  80356e:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++)
+  803573:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  803578:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80357c:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803580:	72 cc                	jb     80354e <strncpy+0x26>
+	}
+	return ret;
+  803582:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  803586:	c9                   	leave
+  803587:	c3                   	ret
+
+0000000000803588 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  803588:	55                   	push   %rbp
+  803589:	48 89 e5             	mov    %rsp,%rbp
+  80358c:	48 83 ec 28          	sub    $0x28,%rsp
+  803590:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803594:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803598:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  80359c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035a0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0)
+  8035a4:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8035a9:	74 3d                	je     8035e8 <strlcpy+0x60>
+	{
+		while (--size > 0 && *src != '\0')
+  8035ab:	eb 1d                	jmp    8035ca <strlcpy+0x42>
+			*dst++ = *src++;
+  8035ad:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8035b1:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8035b5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8035b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035bd:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8035c1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8035c5:	0f b6 12             	movzbl (%rdx),%edx
+  8035c8:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  8035ca:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8035cf:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8035d4:	74 0b                	je     8035e1 <strlcpy+0x59>
+  8035d6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035da:	0f b6 00             	movzbl (%rax),%eax
+  8035dd:	84 c0                	test   %al,%al
+  8035df:	75 cc                	jne    8035ad <strlcpy+0x25>
+		*dst = '\0';
+  8035e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035e5:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8035e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035ec:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8035f0:	c9                   	leave
+  8035f1:	c3                   	ret
+
+00000000008035f2 <strcmp>:
+
+int strcmp(const char *p, const char *q)
+{
+  8035f2:	55                   	push   %rbp
+  8035f3:	48 89 e5             	mov    %rsp,%rbp
+  8035f6:	48 83 ec 10          	sub    $0x10,%rsp
+  8035fa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8035fe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  803602:	eb 0a                	jmp    80360e <strcmp+0x1c>
+		p++, q++;
+  803604:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  803609:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  80360e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803612:	0f b6 00             	movzbl (%rax),%eax
+  803615:	84 c0                	test   %al,%al
+  803617:	74 12                	je     80362b <strcmp+0x39>
+  803619:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80361d:	0f b6 10             	movzbl (%rax),%edx
+  803620:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803624:	0f b6 00             	movzbl (%rax),%eax
+  803627:	38 c2                	cmp    %al,%dl
+  803629:	74 d9                	je     803604 <strcmp+0x12>
+	return (int)((unsigned char)*p - (unsigned char)*q);
+  80362b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80362f:	0f b6 00             	movzbl (%rax),%eax
+  803632:	0f b6 d0             	movzbl %al,%edx
+  803635:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803639:	0f b6 00             	movzbl (%rax),%eax
+  80363c:	0f b6 c0             	movzbl %al,%eax
+  80363f:	29 c2                	sub    %eax,%edx
+  803641:	89 d0                	mov    %edx,%eax
+}
+  803643:	c9                   	leave
+  803644:	c3                   	ret
+
+0000000000803645 <strncmp>:
+
+int strncmp(const char *p, const char *q, size_t n)
+{
+  803645:	55                   	push   %rbp
+  803646:	48 89 e5             	mov    %rsp,%rbp
+  803649:	48 83 ec 18          	sub    $0x18,%rsp
+  80364d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803651:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803655:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  803659:	eb 0f                	jmp    80366a <strncmp+0x25>
+		n--, p++, q++;
+  80365b:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  803660:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  803665:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80366a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80366f:	74 1d                	je     80368e <strncmp+0x49>
+  803671:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803675:	0f b6 00             	movzbl (%rax),%eax
+  803678:	84 c0                	test   %al,%al
+  80367a:	74 12                	je     80368e <strncmp+0x49>
+  80367c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803680:	0f b6 10             	movzbl (%rax),%edx
+  803683:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803687:	0f b6 00             	movzbl (%rax),%eax
+  80368a:	38 c2                	cmp    %al,%dl
+  80368c:	74 cd                	je     80365b <strncmp+0x16>
+	if (n == 0)
+  80368e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803693:	75 07                	jne    80369c <strncmp+0x57>
+		return 0;
+  803695:	ba 00 00 00 00       	mov    $0x0,%edx
+  80369a:	eb 16                	jmp    8036b2 <strncmp+0x6d>
+	else
+		return (int)((unsigned char)*p - (unsigned char)*q);
+  80369c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036a0:	0f b6 00             	movzbl (%rax),%eax
+  8036a3:	0f b6 d0             	movzbl %al,%edx
+  8036a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036aa:	0f b6 00             	movzbl (%rax),%eax
+  8036ad:	0f b6 c0             	movzbl %al,%eax
+  8036b0:	29 c2                	sub    %eax,%edx
+}
+  8036b2:	89 d0                	mov    %edx,%eax
+  8036b4:	c9                   	leave
+  8036b5:	c3                   	ret
+
+00000000008036b6 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8036b6:	55                   	push   %rbp
+  8036b7:	48 89 e5             	mov    %rsp,%rbp
+  8036ba:	48 83 ec 10          	sub    $0x10,%rsp
+  8036be:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8036c2:	89 f0                	mov    %esi,%eax
+  8036c4:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8036c7:	eb 17                	jmp    8036e0 <strchr+0x2a>
+		if (*s == c)
+  8036c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036cd:	0f b6 00             	movzbl (%rax),%eax
+  8036d0:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8036d3:	75 06                	jne    8036db <strchr+0x25>
+			return (char *)s;
+  8036d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036d9:	eb 15                	jmp    8036f0 <strchr+0x3a>
+	for (; *s; s++)
+  8036db:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8036e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036e4:	0f b6 00             	movzbl (%rax),%eax
+  8036e7:	84 c0                	test   %al,%al
+  8036e9:	75 de                	jne    8036c9 <strchr+0x13>
+	return 0;
+  8036eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036f0:	c9                   	leave
+  8036f1:	c3                   	ret
+
+00000000008036f2 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8036f2:	55                   	push   %rbp
+  8036f3:	48 89 e5             	mov    %rsp,%rbp
+  8036f6:	48 83 ec 10          	sub    $0x10,%rsp
+  8036fa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8036fe:	89 f0                	mov    %esi,%eax
+  803700:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  803703:	eb 11                	jmp    803716 <strfind+0x24>
+		if (*s == c)
+  803705:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803709:	0f b6 00             	movzbl (%rax),%eax
+  80370c:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80370f:	74 12                	je     803723 <strfind+0x31>
+	for (; *s; s++)
+  803711:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  803716:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80371a:	0f b6 00             	movzbl (%rax),%eax
+  80371d:	84 c0                	test   %al,%al
+  80371f:	75 e4                	jne    803705 <strfind+0x13>
+  803721:	eb 01                	jmp    803724 <strfind+0x32>
+			break;
+  803723:	90                   	nop
+	return (char *)s;
+  803724:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  803728:	c9                   	leave
+  803729:	c3                   	ret
+
+000000000080372a <mem_init>:
+};
+
+static int mem_features;
+
+void mem_init(void)
+{
+  80372a:	55                   	push   %rbp
+  80372b:	48 89 e5             	mov    %rsp,%rbp
+  80372e:	48 83 ec 10          	sub    $0x10,%rsp
+	uint32_t max, ebx, edx;
+
+	mem_features = 0;
+  803732:	48 b8 78 30 81 00 00 	movabs $0x813078,%rax
+  803739:	00 00 00 
+  80373c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	cpuid(0, &max, NULL, NULL, NULL);
+  803742:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+  803746:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80374c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803751:	ba 00 00 00 00       	mov    $0x0,%edx
+  803756:	48 89 c6             	mov    %rax,%rsi
+  803759:	bf 00 00 00 00       	mov    $0x0,%edi
+  80375e:	48 b8 36 33 80 00 00 	movabs $0x803336,%rax
+  803765:	00 00 00 
+  803768:	ff d0                	call   *%rax
+	cpuid(1, NULL, NULL, NULL, &edx);
+  80376a:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  80376e:	49 89 c0             	mov    %rax,%r8
+  803771:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803776:	ba 00 00 00 00       	mov    $0x0,%edx
+  80377b:	be 00 00 00 00       	mov    $0x0,%esi
+  803780:	bf 01 00 00 00       	mov    $0x1,%edi
+  803785:	48 b8 36 33 80 00 00 	movabs $0x803336,%rax
+  80378c:	00 00 00 
+  80378f:	ff d0                	call   *%rax
+	if (edx & (1 << 26))
+  803791:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803794:	25 00 00 00 04       	and    $0x4000000,%eax
+  803799:	85 c0                	test   %eax,%eax
+  80379b:	74 1d                	je     8037ba <mem_init+0x90>
+		mem_features |= MEM_F_NT;
+  80379d:	48 b8 78 30 81 00 00 	movabs $0x813078,%rax
+  8037a4:	00 00 00 
+  8037a7:	8b 00                	mov    (%rax),%eax
+  8037a9:	83 c8 02             	or     $0x2,%eax
+  8037ac:	89 c2                	mov    %eax,%edx
+  8037ae:	48 b8 78 30 81 00 00 	movabs $0x813078,%rax
+  8037b5:	00 00 00 
+  8037b8:	89 10                	mov    %edx,(%rax)
+	if (max >= 7)
+  8037ba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8037bd:	83 f8 06             	cmp    $0x6,%eax
+  8037c0:	76 57                	jbe    803819 <mem_init+0xef>
+	{
+		cpuid_count(7, 0, NULL, &ebx, NULL, NULL);
+  8037c2:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  8037c6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8037cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8037d2:	48 89 c1             	mov    %rax,%rcx
+  8037d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037da:	be 00 00 00 00       	mov    $0x0,%esi
+  8037df:	bf 07 00 00 00       	mov    $0x7,%edi
+  8037e4:	48 b8 ac 33 80 00 00 	movabs $0x8033ac,%rax
+  8037eb:	00 00 00 
+  8037ee:	ff d0                	call   *%rax
+		if (ebx & (1 << 9))
+  8037f0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8037f3:	25 00 02 00 00       	and    $0x200,%eax
+  8037f8:	85 c0                	test   %eax,%eax
+  8037fa:	74 1d                	je     803819 <mem_init+0xef>
+			mem_features |= MEM_F_ERMS;
+  8037fc:	48 b8 78 30 81 00 00 	movabs $0x813078,%rax
+  803803:	00 00 00 
+  803806:	8b 00                	mov    (%rax),%eax
+  803808:	83 c8 01             	or     $0x1,%eax
+  80380b:	89 c2                	mov    %eax,%edx
+  80380d:	48 b8 78 30 81 00 00 	movabs $0x813078,%rax
+  803814:	00 00 00 
+  803817:	89 10                	mov    %edx,(%rax)
+	}
+}
+  803819:	90                   	nop
+  80381a:	c9                   	leave
+  80381b:	c3                   	ret
+
+000000000080381c <memset_nt>:
+
+// 非临时存储填充 n 字节(v 8 字节对齐，n 为 32 的倍数)
+static void
+memset_nt(void *v, uint64_t pattern, size_t n)
+{
+  80381c:	55                   	push   %rbp
+  80381d:	48 89 e5             	mov    %rsp,%rbp
+  803820:	48 83 ec 28          	sub    $0x28,%rsp
+  803824:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803828:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80382c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t *p = (uint64_t *)v;
+  803830:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803834:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint64_t *end = p + n / 8;
+  803838:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80383c:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  803840:	48 89 c2             	mov    %rax,%rdx
+  803843:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803847:	48 01 d0             	add    %rdx,%rax
+  80384a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	for (; p < end; p += 4)
+  80384e:	eb 20                	jmp    803870 <memset_nt+0x54>
+		asm volatile("movnti %1, 0(%0)\n\t"
+  803850:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803854:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803858:	48 0f c3 10          	movnti %rdx,(%rax)
+  80385c:	48 0f c3 50 08       	movnti %rdx,0x8(%rax)
+  803861:	48 0f c3 50 10       	movnti %rdx,0x10(%rax)
+  803866:	48 0f c3 50 18       	movnti %rdx,0x18(%rax)
+	for (; p < end; p += 4)
+  80386b:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  803870:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803874:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  803878:	72 d6                	jb     803850 <memset_nt+0x34>
+					 "movnti %1, 16(%0)\n\t"
+					 "movnti %1, 24(%0)"
+					 :
+					 : "r"(p), "r"(pattern)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  80387a:	0f ae f8             	sfence
+}
+  80387d:	90                   	nop
+  80387e:	c9                   	leave
+  80387f:	c3                   	ret
+
+0000000000803880 <memcpy_nt>:
+
+// 非临时存储复制 n 字节(dst/src 8 字节对齐且不重叠，n 为 32 的倍数)
+static void
+memcpy_nt(void *dst, const void *src, size_t n)
+{
+  803880:	55                   	push   %rbp
+  803881:	48 89 e5             	mov    %rsp,%rbp
+  803884:	48 83 ec 58          	sub    $0x58,%rsp
+  803888:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80388c:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  803890:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	uint64_t *d = (uint64_t *)dst;
+  803894:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803898:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint64_t *s = (const uint64_t *)src;
+  80389c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8038a0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	uint64_t *end = d + n / 8;
+  8038a4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8038a8:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  8038ac:	48 89 c2             	mov    %rax,%rdx
+  8038af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8038b3:	48 01 d0             	add    %rdx,%rax
+  8038b6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint64_t t0, t1, t2, t3;
+
+	for (; d < end; d += 4, s += 4)
+  8038ba:	eb 44                	jmp    803900 <memcpy_nt+0x80>
+		asm volatile("movq 0(%4), %0\n\t"
+  8038bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038c0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8038c4:	4c 8b 00             	mov    (%rax),%r8
+  8038c7:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  8038cb:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  8038cf:	48 8b 48 18          	mov    0x18(%rax),%rcx
+  8038d3:	4c 0f c3 02          	movnti %r8,(%rdx)
+  8038d7:	48 0f c3 7a 08       	movnti %rdi,0x8(%rdx)
+  8038dc:	48 0f c3 72 10       	movnti %rsi,0x10(%rdx)
+  8038e1:	48 0f c3 4a 18       	movnti %rcx,0x18(%rdx)
+  8038e6:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8038ea:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8038ee:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8038f2:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+	for (; d < end; d += 4, s += 4)
+  8038f6:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  8038fb:	48 83 45 f0 20       	addq   $0x20,-0x10(%rbp)
+  803900:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803904:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  803908:	72 b2                	jb     8038bc <memcpy_nt+0x3c>
+					 "movnti %2, 16(%5)\n\t"
+					 "movnti %3, 24(%5)"
+					 : "=&r"(t0), "=&r"(t1), "=&r"(t2), "=&r"(t3)
+					 : "r"(s), "r"(d)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  80390a:	0f ae f8             	sfence
+}
+  80390d:	90                   	nop
+  80390e:	c9                   	leave
+  80390f:	c3                   	ret
+
+0000000000803910 <memcpy_fwd>:
+
+// 正向复制(dst 在 src 之前或两者不重叠)
+static void
+memcpy_fwd(void *dst, const void *src, size_t n)
+{
+  803910:	55                   	push   %rbp
+  803911:	48 89 e5             	mov    %rsp,%rbp
+  803914:	48 83 ec 18          	sub    $0x18,%rsp
+  803918:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80391c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803920:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  803924:	48 b8 78 30 81 00 00 	movabs $0x813078,%rax
+  80392b:	00 00 00 
+  80392e:	8b 00                	mov    (%rax),%eax
+  803930:	83 e0 02             	and    $0x2,%eax
+  803933:	85 c0                	test   %eax,%eax
+  803935:	74 66                	je     80399d <memcpy_fwd+0x8d>
+  803937:	48 81 7d e8 ff 0f 00 	cmpq   $0xfff,-0x18(%rbp)
+  80393e:	00 
+  80393f:	76 5c                	jbe    80399d <memcpy_fwd+0x8d>
+  803941:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803945:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803949:	48 09 d0             	or     %rdx,%rax
+  80394c:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  803950:	83 e0 1f             	and    $0x1f,%eax
+  803953:	48 85 c0             	test   %rax,%rax
+  803956:	75 45                	jne    80399d <memcpy_fwd+0x8d>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  803958:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80395c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803960:	48 01 d0             	add    %rdx,%rax
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  803963:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  803967:	73 11                	jae    80397a <memcpy_fwd+0x6a>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  803969:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80396d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803971:	48 01 d0             	add    %rdx,%rax
+  803974:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  803978:	72 23                	jb     80399d <memcpy_fwd+0x8d>
+		memcpy_nt(dst, src, n);
+  80397a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80397e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  803982:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803986:	48 89 ce             	mov    %rcx,%rsi
+  803989:	48 89 c7             	mov    %rax,%rdi
+  80398c:	48 b8 80 38 80 00 00 	movabs $0x803880,%rax
+  803993:	00 00 00 
+  803996:	ff d0                	call   *%rax
+  803998:	e9 81 00 00 00       	jmp    803a1e <memcpy_fwd+0x10e>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  80399d:	48 b8 78 30 81 00 00 	movabs $0x813078,%rax
+  8039a4:	00 00 00 
+  8039a7:	8b 00                	mov    (%rax),%eax
+  8039a9:	83 e0 01             	and    $0x1,%eax
+  8039ac:	85 c0                	test   %eax,%eax
+  8039ae:	74 21                	je     8039d1 <memcpy_fwd+0xc1>
+  8039b0:	48 81 7d e8 ff 00 00 	cmpq   $0xff,-0x18(%rbp)
+  8039b7:	00 
+  8039b8:	76 17                	jbe    8039d1 <memcpy_fwd+0xc1>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  8039ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039be:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8039c2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8039c6:	48 89 c7             	mov    %rax,%rdi
+  8039c9:	48 89 d6             	mov    %rdx,%rsi
+  8039cc:	fc                   	cld
+  8039cd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8039cf:	eb 4d                	jmp    803a1e <memcpy_fwd+0x10e>
+					 : "cc", "memory");
+	else if ((((uint64_t)dst | (uint64_t)src | n) & 7) == 0)
+  8039d1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8039d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039d9:	48 09 d0             	or     %rdx,%rax
+  8039dc:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  8039e0:	83 e0 07             	and    $0x7,%eax
+  8039e3:	48 85 c0             	test   %rax,%rax
+  8039e6:	75 1f                	jne    803a07 <memcpy_fwd+0xf7>
+		asm volatile("cld; rep movsq\n" ::"D"(dst), "S"(src), "c"(n / 8)
+  8039e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039ec:	48 c1 e8 03          	shr    $0x3,%rax
+  8039f0:	48 89 c1             	mov    %rax,%rcx
+  8039f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039f7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8039fb:	48 89 c7             	mov    %rax,%rdi
+  8039fe:	48 89 d6             	mov    %rdx,%rsi
+  803a01:	fc                   	cld
+  803a02:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+					 : "cc", "memory");
+}
+  803a05:	eb 17                	jmp    803a1e <memcpy_fwd+0x10e>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  803a07:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a0b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803a0f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803a13:	48 89 c7             	mov    %rax,%rdi
+  803a16:	48 89 d6             	mov    %rdx,%rsi
+  803a19:	fc                   	cld
+  803a1a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+  803a1c:	eb 00                	jmp    803a1e <memcpy_fwd+0x10e>
+  803a1e:	90                   	nop
+  803a1f:	c9                   	leave
+  803a20:	c3                   	ret
+
+0000000000803a21 <memset>:
+
+void *
+memset(void *v, int c, size_t n)
+{
+  803a21:	55                   	push   %rbp
+  803a22:	48 89 e5             	mov    %rsp,%rbp
+  803a25:	48 83 ec 28          	sub    $0x28,%rsp
+  803a29:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803a2d:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  803a30:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t pattern;
+
+	if (n == 0)
+  803a34:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803a39:	75 09                	jne    803a44 <memset+0x23>
+		return v;
+  803a3b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a3f:	e9 dc 00 00 00       	jmp    803b20 <memset+0xff>
+	c &= 0xFF;
+  803a44:	81 65 e4 ff 00 00 00 	andl   $0xff,-0x1c(%rbp)
+	pattern = (uint64_t)c * 0x0101010101010101UL;
+  803a4b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803a4e:	48 98                	cltq
+  803a50:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  803a57:	01 01 01 
+  803a5a:	48 0f af c2          	imul   %rdx,%rax
+  803a5e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)v | n) & 31) == 0)
+  803a62:	48 b8 78 30 81 00 00 	movabs $0x813078,%rax
+  803a69:	00 00 00 
+  803a6c:	8b 00                	mov    (%rax),%eax
+  803a6e:	83 e0 02             	and    $0x2,%eax
+  803a71:	85 c0                	test   %eax,%eax
+  803a73:	74 3a                	je     803aaf <memset+0x8e>
+  803a75:	48 81 7d d8 ff 0f 00 	cmpq   $0xfff,-0x28(%rbp)
+  803a7c:	00 
+  803a7d:	76 30                	jbe    803aaf <memset+0x8e>
+  803a7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a83:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  803a87:	83 e0 1f             	and    $0x1f,%eax
+  803a8a:	48 85 c0             	test   %rax,%rax
+  803a8d:	75 20                	jne    803aaf <memset+0x8e>
+		memset_nt(v, pattern, n);
+  803a8f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a93:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  803a97:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a9b:	48 89 ce             	mov    %rcx,%rsi
+  803a9e:	48 89 c7             	mov    %rax,%rdi
+  803aa1:	48 b8 1c 38 80 00 00 	movabs $0x80381c,%rax
+  803aa8:	00 00 00 
+  803aab:	ff d0                	call   *%rax
+  803aad:	eb 6d                	jmp    803b1c <memset+0xfb>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  803aaf:	48 b8 78 30 81 00 00 	movabs $0x813078,%rax
+  803ab6:	00 00 00 
+  803ab9:	8b 00                	mov    (%rax),%eax
+  803abb:	83 e0 01             	and    $0x1,%eax
+  803abe:	85 c0                	test   %eax,%eax
+  803ac0:	74 1d                	je     803adf <memset+0xbe>
+  803ac2:	48 81 7d d8 ff 00 00 	cmpq   $0xff,-0x28(%rbp)
+  803ac9:	00 
+  803aca:	76 13                	jbe    803adf <memset+0xbe>
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  803acc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803ad0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803ad3:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803ad7:	48 89 d7             	mov    %rdx,%rdi
+  803ada:	fc                   	cld
+  803adb:	f3 aa                	rep stos %al,%es:(%rdi)
+  803add:	eb 3d                	jmp    803b1c <memset+0xfb>
+					 : "cc", "memory");
+	else if ((((uint64_t)v | n) & 7) == 0)
+  803adf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ae3:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  803ae7:	83 e0 07             	and    $0x7,%eax
+  803aea:	48 85 c0             	test   %rax,%rax
+  803aed:	75 1c                	jne    803b0b <memset+0xea>
+		asm volatile("cld; rep stosq\n" ::"D"(v), "a"(pattern), "c"(n / 8)
+  803aef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803af3:	48 c1 e8 03          	shr    $0x3,%rax
+  803af7:	48 89 c1             	mov    %rax,%rcx
+  803afa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803afe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b02:	48 89 d7             	mov    %rdx,%rdi
+  803b05:	fc                   	cld
+  803b06:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  803b09:	eb 11                	jmp    803b1c <memset+0xfb>
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  803b0b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803b0f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803b12:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803b16:	48 89 d7             	mov    %rdx,%rdi
+  803b19:	fc                   	cld
+  803b1a:	f3 aa                	rep stos %al,%es:(%rdi)
+					 : "cc", "memory");
+	return v;
+  803b1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  803b20:	c9                   	leave
+  803b21:	c3                   	ret
+
+0000000000803b22 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  803b22:	55                   	push   %rbp
+  803b23:	48 89 e5             	mov    %rsp,%rbp
+  803b26:	48 83 ec 28          	sub    $0x28,%rsp
+  803b2a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803b2e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803b32:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  803b36:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b3a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  803b3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b42:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d)
+  803b46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b4a:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  803b4e:	73 7c                	jae    803bcc <memmove+0xaa>
+  803b50:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803b54:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b58:	48 01 d0             	add    %rdx,%rax
+  803b5b:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  803b5f:	73 6b                	jae    803bcc <memmove+0xaa>
+	{
+		// 重叠且 dst 在 src 之后，只能反向复制(ERMS 对反向 rep movsb 没有优化)
+		s += n;
+  803b61:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b65:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  803b69:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b6d:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((((uint64_t)s | (uint64_t)d | n) & 7) == 0)
+  803b71:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803b75:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b79:	48 09 d0             	or     %rdx,%rax
+  803b7c:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  803b80:	83 e0 07             	and    $0x7,%eax
+  803b83:	48 85 c0             	test   %rax,%rax
+  803b86:	75 24                	jne    803bac <memmove+0x8a>
+			asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803b88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b8c:	48 83 e8 08          	sub    $0x8,%rax
+  803b90:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803b94:	48 83 ea 08          	sub    $0x8,%rdx
+  803b98:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803b9c:	48 c1 e9 03          	shr    $0x3,%rcx
+  803ba0:	48 89 c7             	mov    %rax,%rdi
+  803ba3:	48 89 d6             	mov    %rdx,%rsi
+  803ba6:	fd                   	std
+  803ba7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  803baa:	eb 1d                	jmp    803bc9 <memmove+0xa7>
+						 : "cc", "memory");
+		else
+			asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803bac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803bb0:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803bb4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803bb8:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+  803bbc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803bc0:	48 89 d7             	mov    %rdx,%rdi
+  803bc3:	48 89 c1             	mov    %rax,%rcx
+  803bc6:	fd                   	std
+  803bc7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+						 : "cc", "memory");
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::
+  803bc9:	fc                   	cld
+  803bca:	eb 25                	jmp    803bf1 <memmove+0xcf>
+						 : "cc");
+	}
+	else if (n)
+  803bcc:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803bd1:	74 1e                	je     803bf1 <memmove+0xcf>
+		memcpy_fwd(d, s, n);
+  803bd3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803bd7:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  803bdb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803bdf:	48 89 ce             	mov    %rcx,%rsi
+  803be2:	48 89 c7             	mov    %rax,%rdi
+  803be5:	48 b8 10 39 80 00 00 	movabs $0x803910,%rax
+  803bec:	00 00 00 
+  803bef:	ff d0                	call   *%rax
+	return dst;
+  803bf1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  803bf5:	c9                   	leave
+  803bf6:	c3                   	ret
+
+0000000000803bf7 <memcpy>:
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  803bf7:	55                   	push   %rbp
+  803bf8:	48 89 e5             	mov    %rsp,%rbp
+  803bfb:	48 83 ec 18          	sub    $0x18,%rsp
+  803bff:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803c03:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803c07:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (n)
+  803c0b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803c10:	74 1e                	je     803c30 <memcpy+0x39>
+		memcpy_fwd(dst, src, n);
+  803c12:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803c16:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  803c1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803c1e:	48 89 ce             	mov    %rcx,%rsi
+  803c21:	48 89 c7             	mov    %rax,%rdi
+  803c24:	48 b8 10 39 80 00 00 	movabs $0x803910,%rax
+  803c2b:	00 00 00 
+  803c2e:	ff d0                	call   *%rax
+	return dst;
+  803c30:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  803c34:	c9                   	leave
+  803c35:	c3                   	ret
+
+0000000000803c36 <memcmp>:
+{
+}
+#endif
+
+int memcmp(const void *v1, const void *v2, size_t n)
+{
+  803c36:	55                   	push   %rbp
+  803c37:	48 89 e5             	mov    %rsp,%rbp
+  803c3a:	48 83 ec 28          	sub    $0x28,%rsp
+  803c3e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803c42:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803c46:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *)v1;
+  803c4a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c4e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *)v2;
+  803c52:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c56:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0)
+  803c5a:	eb 34                	jmp    803c90 <memcmp+0x5a>
+	{
+		if (*s1 != *s2)
+  803c5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803c60:	0f b6 10             	movzbl (%rax),%edx
+  803c63:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c67:	0f b6 00             	movzbl (%rax),%eax
+  803c6a:	38 c2                	cmp    %al,%dl
+  803c6c:	74 18                	je     803c86 <memcmp+0x50>
+			return (int)*s1 - (int)*s2;
+  803c6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803c72:	0f b6 00             	movzbl (%rax),%eax
+  803c75:	0f b6 d0             	movzbl %al,%edx
+  803c78:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c7c:	0f b6 00             	movzbl (%rax),%eax
+  803c7f:	0f b6 c0             	movzbl %al,%eax
+  803c82:	29 c2                	sub    %eax,%edx
+  803c84:	eb 20                	jmp    803ca6 <memcmp+0x70>
+		s1++, s2++;
+  803c86:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  803c8b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0)
+  803c90:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c94:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803c98:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  803c9c:	48 85 c0             	test   %rax,%rax
+  803c9f:	75 bb                	jne    803c5c <memcmp+0x26>
+	}
+
+	return 0;
+  803ca1:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  803ca6:	89 d0                	mov    %edx,%eax
+  803ca8:	c9                   	leave
+  803ca9:	c3                   	ret
+
+0000000000803caa <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  803caa:	55                   	push   %rbp
+  803cab:	48 89 e5             	mov    %rsp,%rbp
+  803cae:	48 83 ec 28          	sub    $0x28,%rsp
+  803cb2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803cb6:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  803cb9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *)s + n;
+  803cbd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803cc1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803cc5:	48 01 d0             	add    %rdx,%rax
+  803cc8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  803ccc:	eb 13                	jmp    803ce1 <memfind+0x37>
+		if (*(const unsigned char *)s == (unsigned char)c)
+  803cce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cd2:	0f b6 00             	movzbl (%rax),%eax
+  803cd5:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803cd8:	38 d0                	cmp    %dl,%al
+  803cda:	74 11                	je     803ced <memfind+0x43>
+	for (; s < ends; s++)
+  803cdc:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  803ce1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ce5:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  803ce9:	72 e3                	jb     803cce <memfind+0x24>
+  803ceb:	eb 01                	jmp    803cee <memfind+0x44>
+			break;
+  803ced:	90                   	nop
+	return (void *)s;
+  803cee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  803cf2:	c9                   	leave
+  803cf3:	c3                   	ret
+
+0000000000803cf4 <strtol>:
+
+long strtol(const char *s, char **endptr, int base)
+{
+  803cf4:	55                   	push   %rbp
+  803cf5:	48 89 e5             	mov    %rsp,%rbp
+  803cf8:	48 83 ec 38          	sub    $0x38,%rsp
+  803cfc:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803d00:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803d04:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  803d07:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  803d0e:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803d15:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  803d16:	eb 05                	jmp    803d1d <strtol+0x29>
+		s++;
+  803d18:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  803d1d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d21:	0f b6 00             	movzbl (%rax),%eax
+  803d24:	3c 20                	cmp    $0x20,%al
+  803d26:	74 f0                	je     803d18 <strtol+0x24>
+  803d28:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d2c:	0f b6 00             	movzbl (%rax),%eax
+  803d2f:	3c 09                	cmp    $0x9,%al
+  803d31:	74 e5                	je     803d18 <strtol+0x24>
+
+	// plus/minus sign
+	if (*s == '+')
+  803d33:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d37:	0f b6 00             	movzbl (%rax),%eax
+  803d3a:	3c 2b                	cmp    $0x2b,%al
+  803d3c:	75 07                	jne    803d45 <strtol+0x51>
+		s++;
+  803d3e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  803d43:	eb 17                	jmp    803d5c <strtol+0x68>
+	else if (*s == '-')
+  803d45:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d49:	0f b6 00             	movzbl (%rax),%eax
+  803d4c:	3c 2d                	cmp    $0x2d,%al
+  803d4e:	75 0c                	jne    803d5c <strtol+0x68>
+		s++, neg = 1;
+  803d50:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  803d55:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803d5c:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  803d60:	74 06                	je     803d68 <strtol+0x74>
+  803d62:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  803d66:	75 28                	jne    803d90 <strtol+0x9c>
+  803d68:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d6c:	0f b6 00             	movzbl (%rax),%eax
+  803d6f:	3c 30                	cmp    $0x30,%al
+  803d71:	75 1d                	jne    803d90 <strtol+0x9c>
+  803d73:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d77:	48 83 c0 01          	add    $0x1,%rax
+  803d7b:	0f b6 00             	movzbl (%rax),%eax
+  803d7e:	3c 78                	cmp    $0x78,%al
+  803d80:	75 0e                	jne    803d90 <strtol+0x9c>
+		s += 2, base = 16;
+  803d82:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  803d87:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  803d8e:	eb 2c                	jmp    803dbc <strtol+0xc8>
+	else if (base == 0 && s[0] == '0')
+  803d90:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  803d94:	75 19                	jne    803daf <strtol+0xbb>
+  803d96:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d9a:	0f b6 00             	movzbl (%rax),%eax
+  803d9d:	3c 30                	cmp    $0x30,%al
+  803d9f:	75 0e                	jne    803daf <strtol+0xbb>
+		s++, base = 8;
+  803da1:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  803da6:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  803dad:	eb 0d                	jmp    803dbc <strtol+0xc8>
+	else if (base == 0)
+  803daf:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  803db3:	75 07                	jne    803dbc <strtol+0xc8>
+		base = 10;
+  803db5:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+	// digits
+	while (1)
+	{
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  803dbc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803dc0:	0f b6 00             	movzbl (%rax),%eax
+  803dc3:	3c 2f                	cmp    $0x2f,%al
+  803dc5:	7e 1d                	jle    803de4 <strtol+0xf0>
+  803dc7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803dcb:	0f b6 00             	movzbl (%rax),%eax
+  803dce:	3c 39                	cmp    $0x39,%al
+  803dd0:	7f 12                	jg     803de4 <strtol+0xf0>
+			dig = *s - '0';
+  803dd2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803dd6:	0f b6 00             	movzbl (%rax),%eax
+  803dd9:	0f be c0             	movsbl %al,%eax
+  803ddc:	83 e8 30             	sub    $0x30,%eax
+  803ddf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803de2:	eb 4e                	jmp    803e32 <strtol+0x13e>
+		else if (*s >= 'a' && *s <= 'z')
+  803de4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803de8:	0f b6 00             	movzbl (%rax),%eax
+  803deb:	3c 60                	cmp    $0x60,%al
+  803ded:	7e 1d                	jle    803e0c <strtol+0x118>
+  803def:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803df3:	0f b6 00             	movzbl (%rax),%eax
+  803df6:	3c 7a                	cmp    $0x7a,%al
+  803df8:	7f 12                	jg     803e0c <strtol+0x118>
+			dig = *s - 'a' + 10;
+  803dfa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803dfe:	0f b6 00             	movzbl (%rax),%eax
+  803e01:	0f be c0             	movsbl %al,%eax
+  803e04:	83 e8 57             	sub    $0x57,%eax
+  803e07:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803e0a:	eb 26                	jmp    803e32 <strtol+0x13e>
+		else if (*s >= 'A' && *s <= 'Z')
+  803e0c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e10:	0f b6 00             	movzbl (%rax),%eax
+  803e13:	3c 40                	cmp    $0x40,%al
+  803e15:	7e 47                	jle    803e5e <strtol+0x16a>
+  803e17:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e1b:	0f b6 00             	movzbl (%rax),%eax
+  803e1e:	3c 5a                	cmp    $0x5a,%al
+  803e20:	7f 3c                	jg     803e5e <strtol+0x16a>
+			dig = *s - 'A' + 10;
+  803e22:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e26:	0f b6 00             	movzbl (%rax),%eax
+  803e29:	0f be c0             	movsbl %al,%eax
+  803e2c:	83 e8 37             	sub    $0x37,%eax
+  803e2f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  803e32:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e35:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  803e38:	7d 23                	jge    803e5d <strtol+0x169>
+			break;
+		s++, val = (val * base) + dig;
+  803e3a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  803e3f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803e42:	48 98                	cltq
+  803e44:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  803e49:	48 89 c2             	mov    %rax,%rdx
+  803e4c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e4f:	48 98                	cltq
+  803e51:	48 01 d0             	add    %rdx,%rax
+  803e54:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+  803e58:	e9 5f ff ff ff       	jmp    803dbc <strtol+0xc8>
+			break;
+  803e5d:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  803e5e:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803e63:	74 0b                	je     803e70 <strtol+0x17c>
+		*endptr = (char *)s;
+  803e65:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803e69:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803e6d:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  803e70:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e74:	74 09                	je     803e7f <strtol+0x18b>
+  803e76:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e7a:	48 f7 d8             	neg    %rax
+  803e7d:	eb 04                	jmp    803e83 <strtol+0x18f>
+  803e7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  803e83:	c9                   	leave
+  803e84:	c3                   	ret
+
+0000000000803e85 <strstr>:
+
+char *strstr(const char *in, const char *str)
+{
+  803e85:	55                   	push   %rbp
+  803e86:	48 89 e5             	mov    %rsp,%rbp
+  803e89:	48 83 ec 30          	sub    $0x30,%rsp
+  803e8d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803e91:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  803e95:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803e99:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803e9d:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803ea1:	0f b6 00             	movzbl (%rax),%eax
+  803ea4:	88 45 ff             	mov    %al,-0x1(%rbp)
+	if (!c)
+  803ea7:	80 7d ff 00          	cmpb   $0x0,-0x1(%rbp)
+  803eab:	75 06                	jne    803eb3 <strstr+0x2e>
+		return (char *)in; // Trivial empty string case
+  803ead:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803eb1:	eb 6b                	jmp    803f1e <strstr+0x99>
+
+	len = strlen(str);
+  803eb3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803eb7:	48 89 c7             	mov    %rax,%rdi
+  803eba:	48 b8 2a 34 80 00 00 	movabs $0x80342a,%rax
+  803ec1:	00 00 00 
+  803ec4:	ff d0                	call   *%rax
+  803ec6:	48 98                	cltq
+  803ec8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+		char sc;
+
+		do
+		{
+			sc = *in++;
+  803ecc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ed0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803ed4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  803ed8:	0f b6 00             	movzbl (%rax),%eax
+  803edb:	88 45 ef             	mov    %al,-0x11(%rbp)
+			if (!sc)
+  803ede:	80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+  803ee2:	75 07                	jne    803eeb <strstr+0x66>
+				return (char *)0;
+  803ee4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ee9:	eb 33                	jmp    803f1e <strstr+0x99>
+		} while (sc != c);
+  803eeb:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+  803eef:	3a 45 ff             	cmp    -0x1(%rbp),%al
+  803ef2:	75 d8                	jne    803ecc <strstr+0x47>
+	} while (strncmp(in, str, len) != 0);
+  803ef4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803ef8:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803efc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f00:	48 89 ce             	mov    %rcx,%rsi
+  803f03:	48 89 c7             	mov    %rax,%rdi
+  803f06:	48 b8 45 36 80 00 00 	movabs $0x803645,%rax
+  803f0d:	00 00 00 
+  803f10:	ff d0                	call   *%rax
+  803f12:	85 c0                	test   %eax,%eax
+  803f14:	75 b6                	jne    803ecc <strstr+0x47>
+
+	return (char *)(in - 1);
+  803f16:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f1a:	48 83 e8 01          	sub    $0x1,%rax
+}
+  803f1e:	c9                   	leave
+  803f1f:	c3                   	ret
+
+0000000000803f20 <syscall>:
+ * 用户的指令式系统调用，该函数将系统调用序号放入eax寄存器，五个参数依次放入edx, ecx, ebx, edi, esi，然后执行指令int 0x30，
+ * 发生中断后，去IDT中查找中断处理函数，最终会走到kern/trap.c的trap_dispatch()中
+ */
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  803f20:	55                   	push   %rbp
+  803f21:	48 89 e5             	mov    %rsp,%rbp
+  803f24:	53                   	push   %rbx
+  803f25:	48 83 ec 48          	sub    $0x48,%rsp
+  803f29:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803f2c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  803f2f:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803f33:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803f37:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  803f3b:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	 * volatile 告诉汇编程序不要因为不使用返回值就优化该指令
+	 * 最后一个子句告诉汇编程序，指令可能会改变条件代码cx和任意内存memory位置
+	 * 由汇编编译器做好数据保存和恢复工作(栈)
+	 */
+
+	asm volatile("int %1\n"			// code: int T_SYSCALL
+  803f3f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f42:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803f46:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803f4a:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  803f4e:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803f52:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  803f56:	4c 89 c3             	mov    %r8,%rbx
+  803f59:	cd 30                	int    $0x30
+  803f5b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+				   "D"(a4),			// edi = a4
+				   "S"(a5)			// esi = a5
+				 : "cc", "memory"); // 指令可能会改变条件代码cx和任意内存memory位置
+									// 由汇编编译器做好数据保存和恢复工作(栈)
+
+	if (check && ret > 0)
+  803f5f:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  803f63:	74 44                	je     803fa9 <syscall+0x89>
+  803f65:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803f6a:	7e 3d                	jle    803fa9 <syscall+0x89>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  803f6c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803f70:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f73:	49 89 d0             	mov    %rdx,%r8
+  803f76:	89 c1                	mov    %eax,%ecx
+  803f78:	48 b8 68 64 80 00 00 	movabs $0x806468,%rax
+  803f7f:	00 00 00 
+  803f82:	48 89 c2             	mov    %rax,%rdx
+  803f85:	be 34 00 00 00       	mov    $0x34,%esi
+  803f8a:	48 b8 85 64 80 00 00 	movabs $0x806485,%rax
+  803f91:	00 00 00 
+  803f94:	48 89 c7             	mov    %rax,%rdi
+  803f97:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f9c:	49 b9 cc 25 80 00 00 	movabs $0x8025cc,%r9
+  803fa3:	00 00 00 
+  803fa6:	41 ff d1             	call   *%r9
+
+	return ret;
+  803fa9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  803fad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803fb1:	c9                   	leave
+  803fb2:	c3                   	ret
+
+0000000000803fb3 <sys_cputs>:
+
+void sys_cputs(const char *s, size_t len)
+{
+  803fb3:	55                   	push   %rbp
+  803fb4:	48 89 e5             	mov    %rsp,%rbp
+  803fb7:	48 83 ec 10          	sub    $0x10,%rsp
+  803fbb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803fbf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 调用lib/syscall.c中的syscall()
+	// SYS_cputs: 系统调用序号(eax)，s: 需要输出的字符数组，len: 数组长度
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  803fc3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803fc7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803fcb:	48 83 ec 08          	sub    $0x8,%rsp
+  803fcf:	6a 00                	push   $0x0
+  803fd1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803fd7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803fdd:	48 89 d1             	mov    %rdx,%rcx
+  803fe0:	48 89 c2             	mov    %rax,%rdx
+  803fe3:	be 00 00 00 00       	mov    $0x0,%esi
+  803fe8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fed:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  803ff4:	00 00 00 
+  803ff7:	ff d0                	call   *%rax
+  803ff9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803ffd:	90                   	nop
+  803ffe:	c9                   	leave
+  803fff:	c3                   	ret
+
+0000000000804000 <sys_cgetc>:
+
+int sys_cgetc(void)
+{
+  804000:	55                   	push   %rbp
+  804001:	48 89 e5             	mov    %rsp,%rbp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  804004:	48 83 ec 08          	sub    $0x8,%rsp
+  804008:	6a 00                	push   $0x0
+  80400a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804010:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804016:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80401b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804020:	be 00 00 00 00       	mov    $0x0,%esi
+  804025:	bf 01 00 00 00       	mov    $0x1,%edi
+  80402a:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  804031:	00 00 00 
+  804034:	ff d0                	call   *%rax
+  804036:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80403a:	c9                   	leave
+  80403b:	c3                   	ret
+
+000000000080403c <sys_env_destroy>:
+
+int sys_env_destroy(envid_t envid)
+{
+  80403c:	55                   	push   %rbp
+  80403d:	48 89 e5             	mov    %rsp,%rbp
+  804040:	48 83 ec 10          	sub    $0x10,%rsp
+  804044:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	// 销毁envid对应的环境
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  804047:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80404a:	48 98                	cltq
+  80404c:	48 83 ec 08          	sub    $0x8,%rsp
+  804050:	6a 00                	push   $0x0
+  804052:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804058:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80405e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804063:	48 89 c2             	mov    %rax,%rdx
+  804066:	be 01 00 00 00       	mov    $0x1,%esi
+  80406b:	bf 03 00 00 00       	mov    $0x3,%edi
+  804070:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  804077:	00 00 00 
+  80407a:	ff d0                	call   *%rax
+  80407c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  804080:	c9                   	leave
+  804081:	c3                   	ret
+
+0000000000804082 <sys_getprocid>:
+
+envid_t
+sys_getprocid(void)
+{
+  804082:	55                   	push   %rbp
+  804083:	48 89 e5             	mov    %rsp,%rbp
+	// 获取当前用户环境id
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  804086:	48 83 ec 08          	sub    $0x8,%rsp
+  80408a:	6a 00                	push   $0x0
+  80408c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804092:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804098:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80409d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8040a7:	bf 02 00 00 00       	mov    $0x2,%edi
+  8040ac:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  8040b3:	00 00 00 
+  8040b6:	ff d0                	call   *%rax
+  8040b8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8040bc:	c9                   	leave
+  8040bd:	c3                   	ret
+
+00000000008040be <sys_yield>:
+
+void sys_yield(void)
+{
+  8040be:	55                   	push   %rbp
+  8040bf:	48 89 e5             	mov    %rsp,%rbp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8040c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8040c6:	6a 00                	push   $0x0
+  8040c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8040ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8040d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8040d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040de:	be 00 00 00 00       	mov    $0x0,%esi
+  8040e3:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8040e8:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  8040ef:	00 00 00 
+  8040f2:	ff d0                	call   *%rax
+  8040f4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8040f8:	90                   	nop
+  8040f9:	c9                   	leave
+  8040fa:	c3                   	ret
+
+00000000008040fb <sys_page_alloc>:
+
+int sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8040fb:	55                   	push   %rbp
+  8040fc:	48 89 e5             	mov    %rsp,%rbp
+  8040ff:	48 83 ec 10          	sub    $0x10,%rsp
+  804103:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804106:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80410a:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  80410d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804110:	48 63 c8             	movslq %eax,%rcx
+  804113:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804117:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80411a:	48 98                	cltq
+  80411c:	48 83 ec 08          	sub    $0x8,%rsp
+  804120:	6a 00                	push   $0x0
+  804122:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804128:	49 89 c8             	mov    %rcx,%r8
+  80412b:	48 89 d1             	mov    %rdx,%rcx
+  80412e:	48 89 c2             	mov    %rax,%rdx
+  804131:	be 01 00 00 00       	mov    $0x1,%esi
+  804136:	bf 04 00 00 00       	mov    $0x4,%edi
+  80413b:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  804142:	00 00 00 
+  804145:	ff d0                	call   *%rax
+  804147:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80414b:	c9                   	leave
+  80414c:	c3                   	ret
+
+000000000080414d <sys_page_map>:
+
+int sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80414d:	55                   	push   %rbp
+  80414e:	48 89 e5             	mov    %rsp,%rbp
+  804151:	48 83 ec 20          	sub    $0x20,%rsp
+  804155:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804158:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80415c:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80415f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804163:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  804167:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80416a:	48 63 c8             	movslq %eax,%rcx
+  80416d:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  804171:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804174:	48 63 f0             	movslq %eax,%rsi
+  804177:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80417b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80417e:	48 98                	cltq
+  804180:	48 83 ec 08          	sub    $0x8,%rsp
+  804184:	51                   	push   %rcx
+  804185:	49 89 f9             	mov    %rdi,%r9
+  804188:	49 89 f0             	mov    %rsi,%r8
+  80418b:	48 89 d1             	mov    %rdx,%rcx
+  80418e:	48 89 c2             	mov    %rax,%rdx
+  804191:	be 01 00 00 00       	mov    $0x1,%esi
+  804196:	bf 05 00 00 00       	mov    $0x5,%edi
+  80419b:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  8041a2:	00 00 00 
+  8041a5:	ff d0                	call   *%rax
+  8041a7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8041ab:	c9                   	leave
+  8041ac:	c3                   	ret
+
+00000000008041ad <sys_page_unmap>:
+
+int sys_page_unmap(envid_t envid, void *va)
+{
+  8041ad:	55                   	push   %rbp
+  8041ae:	48 89 e5             	mov    %rsp,%rbp
+  8041b1:	48 83 ec 10          	sub    $0x10,%rsp
+  8041b5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8041b8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  8041bc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8041c0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8041c3:	48 98                	cltq
+  8041c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8041c9:	6a 00                	push   $0x0
+  8041cb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8041d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8041d7:	48 89 d1             	mov    %rdx,%rcx
+  8041da:	48 89 c2             	mov    %rax,%rdx
+  8041dd:	be 01 00 00 00       	mov    $0x1,%esi
+  8041e2:	bf 06 00 00 00       	mov    $0x6,%edi
+  8041e7:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  8041ee:	00 00 00 
+  8041f1:	ff d0                	call   *%rax
+  8041f3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8041f7:	c9                   	leave
+  8041f8:	c3                   	ret
+
+00000000008041f9 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int sys_env_set_status(envid_t envid, int status)
+{
+  8041f9:	55                   	push   %rbp
+  8041fa:	48 89 e5             	mov    %rsp,%rbp
+  8041fd:	48 83 ec 10          	sub    $0x10,%rsp
+  804201:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804204:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  804207:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80420a:	48 63 d0             	movslq %eax,%rdx
+  80420d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804210:	48 98                	cltq
+  804212:	48 83 ec 08          	sub    $0x8,%rsp
+  804216:	6a 00                	push   $0x0
+  804218:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80421e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804224:	48 89 d1             	mov    %rdx,%rcx
+  804227:	48 89 c2             	mov    %rax,%rdx
+  80422a:	be 01 00 00 00       	mov    $0x1,%esi
+  80422f:	bf 08 00 00 00       	mov    $0x8,%edi
+  804234:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  80423b:	00 00 00 
+  80423e:	ff d0                	call   *%rax
+  804240:	48 83 c4 10          	add    $0x10,%rsp
+}
+  804244:	c9                   	leave
+  804245:	c3                   	ret
+
+0000000000804246 <sys_env_set_trapframe>:
+
+int sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  804246:	55                   	push   %rbp
+  804247:	48 89 e5             	mov    %rsp,%rbp
+  80424a:	48 83 ec 10          	sub    $0x10,%rsp
+  80424e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804251:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  804255:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804259:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80425c:	48 98                	cltq
+  80425e:	48 83 ec 08          	sub    $0x8,%rsp
+  804262:	6a 00                	push   $0x0
+  804264:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80426a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804270:	48 89 d1             	mov    %rdx,%rcx
+  804273:	48 89 c2             	mov    %rax,%rdx
+  804276:	be 01 00 00 00       	mov    $0x1,%esi
+  80427b:	bf 09 00 00 00       	mov    $0x9,%edi
+  804280:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  804287:	00 00 00 
+  80428a:	ff d0                	call   *%rax
+  80428c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  804290:	c9                   	leave
+  804291:	c3                   	ret
+
+0000000000804292 <sys_env_set_pgfault_upcall>:
+
+int sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  804292:	55                   	push   %rbp
+  804293:	48 89 e5             	mov    %rsp,%rbp
+  804296:	48 83 ec 10          	sub    $0x10,%rsp
+  80429a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80429d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  8042a1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8042a5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8042a8:	48 98                	cltq
+  8042aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8042ae:	6a 00                	push   $0x0
+  8042b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8042b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8042bc:	48 89 d1             	mov    %rdx,%rcx
+  8042bf:	48 89 c2             	mov    %rax,%rdx
+  8042c2:	be 01 00 00 00       	mov    $0x1,%esi
+  8042c7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8042cc:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  8042d3:	00 00 00 
+  8042d6:	ff d0                	call   *%rax
+  8042d8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8042dc:	c9                   	leave
+  8042dd:	c3                   	ret
+
+00000000008042de <sys_ipc_try_send>:
+
+int sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8042de:	55                   	push   %rbp
+  8042df:	48 89 e5             	mov    %rsp,%rbp
+  8042e2:	48 83 ec 20          	sub    $0x20,%rsp
+  8042e6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8042e9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8042ed:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8042f1:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8042f4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8042f7:	48 63 f0             	movslq %eax,%rsi
+  8042fa:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8042fe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804301:	48 98                	cltq
+  804303:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804307:	48 83 ec 08          	sub    $0x8,%rsp
+  80430b:	6a 00                	push   $0x0
+  80430d:	49 89 f1             	mov    %rsi,%r9
+  804310:	49 89 c8             	mov    %rcx,%r8
+  804313:	48 89 d1             	mov    %rdx,%rcx
+  804316:	48 89 c2             	mov    %rax,%rdx
+  804319:	be 00 00 00 00       	mov    $0x0,%esi
+  80431e:	bf 0c 00 00 00       	mov    $0xc,%edi
+  804323:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  80432a:	00 00 00 
+  80432d:	ff d0                	call   *%rax
+  80432f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  804333:	c9                   	leave
+  804334:	c3                   	ret
+
+0000000000804335 <sys_ipc_recv>:
+
+int sys_ipc_recv(void *dstva)
+{
+  804335:	55                   	push   %rbp
+  804336:	48 89 e5             	mov    %rsp,%rbp
+  804339:	48 83 ec 10          	sub    $0x10,%rsp
+  80433d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  804341:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804345:	48 83 ec 08          	sub    $0x8,%rsp
+  804349:	6a 00                	push   $0x0
+  80434b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804351:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804357:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80435c:	48 89 c2             	mov    %rax,%rdx
+  80435f:	be 01 00 00 00       	mov    $0x1,%esi
+  804364:	bf 0d 00 00 00       	mov    $0xd,%edi
+  804369:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  804370:	00 00 00 
+  804373:	ff d0                	call   *%rax
+  804375:	48 83 c4 10          	add    $0x10,%rsp
+}
+  804379:	c9                   	leave
+  80437a:	c3                   	ret
+
+000000000080437b <sys_disk_io>:
+
+int sys_disk_io(int dev, uint64_t secno, void *va, size_t nsecs, int write)
+{
+  80437b:	55                   	push   %rbp
+  80437c:	48 89 e5             	mov    %rsp,%rbp
+  80437f:	48 83 ec 20          	sub    $0x20,%rsp
+  804383:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804386:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80438a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80438e:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  804392:	44 89 45 f8          	mov    %r8d,-0x8(%rbp)
+	return syscall(SYS_disk_io, 0, dev, secno, (uint64_t)va, nsecs, write);
+  804396:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804399:	48 63 c8             	movslq %eax,%rcx
+  80439c:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8043a0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8043a3:	48 98                	cltq
+  8043a5:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8043a9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8043ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8043b1:	51                   	push   %rcx
+  8043b2:	49 89 f9             	mov    %rdi,%r9
+  8043b5:	49 89 f0             	mov    %rsi,%r8
+  8043b8:	48 89 d1             	mov    %rdx,%rcx
+  8043bb:	48 89 c2             	mov    %rax,%rdx
+  8043be:	be 00 00 00 00       	mov    $0x0,%esi
+  8043c3:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8043c8:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  8043cf:	00 00 00 
+  8043d2:	ff d0                	call   *%rax
+  8043d4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8043d8:	c9                   	leave
+  8043d9:	c3                   	ret
+
+00000000008043da <sys_vma_alloc>:
+
+int sys_vma_alloc(envid_t envid, void *va, size_t len, int perm)
+{
+  8043da:	55                   	push   %rbp
+  8043db:	48 89 e5             	mov    %rsp,%rbp
+  8043de:	48 83 ec 20          	sub    $0x20,%rsp
+  8043e2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8043e5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8043e9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8043ed:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_vma_alloc, 1, envid, (uint64_t)va, len, perm, 0);
+  8043f0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8043f3:	48 63 f0             	movslq %eax,%rsi
+  8043f6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8043fa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8043fd:	48 98                	cltq
+  8043ff:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804403:	48 83 ec 08          	sub    $0x8,%rsp
+  804407:	6a 00                	push   $0x0
+  804409:	49 89 f1             	mov    %rsi,%r9
+  80440c:	49 89 c8             	mov    %rcx,%r8
+  80440f:	48 89 d1             	mov    %rdx,%rcx
+  804412:	48 89 c2             	mov    %rax,%rdx
+  804415:	be 01 00 00 00       	mov    $0x1,%esi
+  80441a:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80441f:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  804426:	00 00 00 
+  804429:	ff d0                	call   *%rax
+  80442b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80442f:	c9                   	leave
+  804430:	c3                   	ret
+
+0000000000804431 <sys_vma_clear>:
+
+int sys_vma_clear(envid_t envid)
+{
+  804431:	55                   	push   %rbp
+  804432:	48 89 e5             	mov    %rsp,%rbp
+  804435:	48 83 ec 10          	sub    $0x10,%rsp
+  804439:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_vma_clear, 1, envid, 0, 0, 0, 0);
+  80443c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80443f:	48 98                	cltq
+  804441:	48 83 ec 08          	sub    $0x8,%rsp
+  804445:	6a 00                	push   $0x0
+  804447:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80444d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804453:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804458:	48 89 c2             	mov    %rax,%rdx
+  80445b:	be 01 00 00 00       	mov    $0x1,%esi
+  804460:	bf 10 00 00 00       	mov    $0x10,%edi
+  804465:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  80446c:	00 00 00 
+  80446f:	ff d0                	call   *%rax
+  804471:	48 83 c4 10          	add    $0x10,%rsp
+}
+  804475:	c9                   	leave
+  804476:	c3                   	ret
+
+0000000000804477 <sys_trace_ctl>:
+
+int sys_trace_ctl(int enable)
+{
+  804477:	55                   	push   %rbp
+  804478:	48 89 e5             	mov    %rsp,%rbp
+  80447b:	48 83 ec 10          	sub    $0x10,%rsp
+  80447f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_trace_ctl, 0, enable, 0, 0, 0, 0);
+  804482:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804485:	48 98                	cltq
+  804487:	48 83 ec 08          	sub    $0x8,%rsp
+  80448b:	6a 00                	push   $0x0
+  80448d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804493:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804499:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80449e:	48 89 c2             	mov    %rax,%rdx
+  8044a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8044a6:	bf 11 00 00 00       	mov    $0x11,%edi
+  8044ab:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  8044b2:	00 00 00 
+  8044b5:	ff d0                	call   *%rax
+  8044b7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8044bb:	c9                   	leave
+  8044bc:	c3                   	ret
+
+00000000008044bd <sys_trace_read>:
+
+int sys_trace_read(int cpu, uint64_t *seq, struct TraceEvent *buf, int n)
+{
+  8044bd:	55                   	push   %rbp
+  8044be:	48 89 e5             	mov    %rsp,%rbp
+  8044c1:	48 83 ec 20          	sub    $0x20,%rsp
+  8044c5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8044c8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8044cc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8044d0:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_trace_read, 0, cpu, (uint64_t)seq, (uint64_t)buf, n, 0);
+  8044d3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8044d6:	48 63 f0             	movslq %eax,%rsi
+  8044d9:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8044dd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8044e1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8044e4:	48 98                	cltq
+  8044e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8044ea:	6a 00                	push   $0x0
+  8044ec:	49 89 f1             	mov    %rsi,%r9
+  8044ef:	49 89 c8             	mov    %rcx,%r8
+  8044f2:	48 89 d1             	mov    %rdx,%rcx
+  8044f5:	48 89 c2             	mov    %rax,%rdx
+  8044f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8044fd:	bf 12 00 00 00       	mov    $0x12,%edi
+  804502:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  804509:	00 00 00 
+  80450c:	ff d0                	call   *%rax
+  80450e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  804512:	c9                   	leave
+  804513:	c3                   	ret
+
+0000000000804514 <sys_getrusage>:
+
+int sys_getrusage(envid_t envid, struct Rusage *ru)
+{
+  804514:	55                   	push   %rbp
+  804515:	48 89 e5             	mov    %rsp,%rbp
+  804518:	48 83 ec 10          	sub    $0x10,%rsp
+  80451c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80451f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_getrusage, 0, envid, (uint64_t)ru, 0, 0, 0);
+  804523:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804527:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80452a:	48 98                	cltq
+  80452c:	48 83 ec 08          	sub    $0x8,%rsp
+  804530:	6a 00                	push   $0x0
+  804532:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804538:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80453e:	48 89 d1             	mov    %rdx,%rcx
+  804541:	48 89 c2             	mov    %rax,%rdx
+  804544:	be 00 00 00 00       	mov    $0x0,%esi
+  804549:	bf 13 00 00 00       	mov    $0x13,%edi
+  80454e:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  804555:	00 00 00 
+  804558:	ff d0                	call   *%rax
+  80455a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80455e:	c9                   	leave
+  80455f:	c3                   	ret
+
+0000000000804560 <sys_pmu_config>:
+
+int sys_pmu_config(int idx, uint64_t event)
+{
+  804560:	55                   	push   %rbp
+  804561:	48 89 e5             	mov    %rsp,%rbp
+  804564:	48 83 ec 10          	sub    $0x10,%rsp
+  804568:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80456b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_pmu_config, 0, idx, event, 0, 0, 0);
+  80456f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804572:	48 98                	cltq
+  804574:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804578:	48 83 ec 08          	sub    $0x8,%rsp
+  80457c:	6a 00                	push   $0x0
+  80457e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804584:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80458a:	48 89 d1             	mov    %rdx,%rcx
+  80458d:	48 89 c2             	mov    %rax,%rdx
+  804590:	be 00 00 00 00       	mov    $0x0,%esi
+  804595:	bf 14 00 00 00       	mov    $0x14,%edi
+  80459a:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  8045a1:	00 00 00 
+  8045a4:	ff d0                	call   *%rax
+  8045a6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8045aa:	c9                   	leave
+  8045ab:	c3                   	ret
+
+00000000008045ac <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  8045ac:	55                   	push   %rbp
+  8045ad:	48 89 e5             	mov    %rsp,%rbp
+  8045b0:	48 83 ec 10          	sub    $0x10,%rsp
+  8045b4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+  8045b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8045ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8045be:	6a 00                	push   $0x0
+  8045c0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8045c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8045cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8045d1:	48 89 c2             	mov    %rax,%rdx
+  8045d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8045d9:	bf 15 00 00 00       	mov    $0x15,%edi
+  8045de:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  8045e5:	00 00 00 
+  8045e8:	ff d0                	call   *%rax
+  8045ea:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8045ee:	c9                   	leave
+  8045ef:	c3                   	ret
+
+00000000008045f0 <sys_image_attach>:
+
+int sys_image_attach(envid_t envid, int dev, const uint64_t *secnos, size_t size)
+{
+  8045f0:	55                   	push   %rbp
+  8045f1:	48 89 e5             	mov    %rsp,%rbp
+  8045f4:	48 83 ec 20          	sub    $0x20,%rsp
+  8045f8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8045fb:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  8045fe:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804602:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+	return syscall(SYS_image_attach, 1, envid, dev, (uint64_t)secnos, size, 0);
+  804606:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80460a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80460d:	48 63 d0             	movslq %eax,%rdx
+  804610:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804613:	48 98                	cltq
+  804615:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  804619:	48 83 ec 08          	sub    $0x8,%rsp
+  80461d:	6a 00                	push   $0x0
+  80461f:	49 89 f1             	mov    %rsi,%r9
+  804622:	49 89 c8             	mov    %rcx,%r8
+  804625:	48 89 d1             	mov    %rdx,%rcx
+  804628:	48 89 c2             	mov    %rax,%rdx
+  80462b:	be 01 00 00 00       	mov    $0x1,%esi
+  804630:	bf 16 00 00 00       	mov    $0x16,%edi
+  804635:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  80463c:	00 00 00 
+  80463f:	ff d0                	call   *%rax
+  804641:	48 83 c4 10          	add    $0x10,%rsp
+}
+  804645:	c9                   	leave
+  804646:	c3                   	ret
+
+0000000000804647 <sys_vma_binary>:
+
+int sys_vma_binary(envid_t envid, const struct Proghdr *ph)
+{
+  804647:	55                   	push   %rbp
+  804648:	48 89 e5             	mov    %rsp,%rbp
+  80464b:	48 83 ec 10          	sub    $0x10,%rsp
+  80464f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804652:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_vma_binary, 1, envid, (uint64_t)ph, 0, 0, 0);
+  804656:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80465a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80465d:	48 98                	cltq
+  80465f:	48 83 ec 08          	sub    $0x8,%rsp
+  804663:	6a 00                	push   $0x0
+  804665:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80466b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804671:	48 89 d1             	mov    %rdx,%rcx
+  804674:	48 89 c2             	mov    %rax,%rdx
+  804677:	be 01 00 00 00       	mov    $0x1,%esi
+  80467c:	bf 17 00 00 00       	mov    $0x17,%edi
+  804681:	48 b8 20 3f 80 00 00 	movabs $0x803f20,%rax
+  804688:	00 00 00 
+  80468b:	ff d0                	call   *%rax
+  80468d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  804691:	c9                   	leave
+  804692:	c3                   	ret
+
+0000000000804693 <set_pgfault_handler>:
+ * 包含用户异常栈的初始化和页错误处理函数的设置，利用 kern/syscall.c sys_env_set_pgfault_upcall() 注册(utf字段)用户页错误处理函数
+ * 第一次注册处理程序时，需要分配一个异常堆栈(顶部位于UXSTACKTOP的一页内存)
+ * 并告诉内核在页错误发生时调用汇编语言 _pgfault_upcall 例程
+ */
+void set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804693:	55                   	push   %rbp
+  804694:	48 89 e5             	mov    %rsp,%rbp
+  804697:	48 83 ec 10          	sub    $0x10,%rsp
+  80469b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	if (_pgfault_handler == 0)
+  80469f:	48 b8 80 30 81 00 00 	movabs $0x813080,%rax
+  8046a6:	00 00 00 
+  8046a9:	48 8b 00             	mov    (%rax),%rax
+  8046ac:	48 85 c0             	test   %rax,%rax
+  8046af:	75 72                	jne    804723 <set_pgfault_handler+0x90>
+	{
+		// 第一次出错，创建用户异常栈
+		if (sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_W | PTE_U | PTE_P) == 0)
+  8046b1:	ba 07 00 00 00       	mov    $0x7,%edx
+  8046b6:	b8 00 f0 7f ef       	mov    $0xef7ff000,%eax
+  8046bb:	48 89 c6             	mov    %rax,%rsi
+  8046be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046c3:	48 b8 fb 40 80 00 00 	movabs $0x8040fb,%rax
+  8046ca:	00 00 00 
+  8046cd:	ff d0                	call   *%rax
+  8046cf:	85 c0                	test   %eax,%eax
+  8046d1:	75 20                	jne    8046f3 <set_pgfault_handler+0x60>
+			sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8046d3:	48 b8 37 47 80 00 00 	movabs $0x804737,%rax
+  8046da:	00 00 00 
+  8046dd:	48 89 c6             	mov    %rax,%rsi
+  8046e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046e5:	48 b8 92 42 80 00 00 	movabs $0x804292,%rax
+  8046ec:	00 00 00 
+  8046ef:	ff d0                	call   *%rax
+  8046f1:	eb 30                	jmp    804723 <set_pgfault_handler+0x90>
+		else
+			panic("set_pgfault_handler(): no memory");
+  8046f3:	48 b8 98 64 80 00 00 	movabs $0x806498,%rax
+  8046fa:	00 00 00 
+  8046fd:	48 89 c2             	mov    %rax,%rdx
+  804700:	be 1b 00 00 00       	mov    $0x1b,%esi
+  804705:	48 b8 b9 64 80 00 00 	movabs $0x8064b9,%rax
+  80470c:	00 00 00 
+  80470f:	48 89 c7             	mov    %rax,%rdi
+  804712:	b8 00 00 00 00       	mov    $0x0,%eax
+  804717:	48 b9 cc 25 80 00 00 	movabs $0x8025cc,%rcx
+  80471e:	00 00 00 
+  804721:	ff d1                	call   *%rcx
+	}
+
+	// 存储汇编语言调用的处理函数指针.
+	_pgfault_handler = handler;
+  804723:	48 ba 80 30 81 00 00 	movabs $0x813080,%rdx
+  80472a:	00 00 00 
+  80472d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804731:	48 89 02             	mov    %rax,(%rdx)
+}
+  804734:	90                   	nop
+  804735:	c9                   	leave
+  804736:	c3                   	ret
+
+0000000000804737 <_pgfault_upcall>:
+
+	// 调用C代码中的页错误处理函数.
+	// 函数参数: 指向 UTrapframe 的指针
+
+	// 通过 %rdi 传递函数参数
+	movq  %rsp, %rdi
+  804737:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  80473a:	48 a1 80 30 81 00 00 	movabs 0x813080,%rax
+  804741:	00 00 00 
+	call *%rax
+  804744:	ff d0                	call   *%rax
+			regs: 15*8 = 120-Byte,
+			eflags: 8-Byte,
+			rip: 8-Byte
+	*/
+
+	addq $16, %rsp	/* 跳过用户异常栈中的 utf_fault_va 和 utf_err(不需要) */
+  804746:	48 83 c4 10          	add    $0x10,%rsp
+	
+	/* 用户异常栈: %rsp 指向 end of struct PushRegs */
+	
+	movq 120(%rsp), %r10	/* %r10 = %rip */
+  80474a:	4c 8b 54 24 78       	mov    0x78(%rsp),%r10
+	movq 136(%rsp), %r11	/* %r11 = %rsp */
+  80474f:	4c 8b 9c 24 88 00 00 	mov    0x88(%rsp),%r11
+  804756:	00 
+
+	subq $8, %r11			/* %r11(trap-time %rsp) - 8 */
+  804757:	49 83 eb 08          	sub    $0x8,%r11
+	movq %r10, (%r11)		/* %r11(trap-time %rsp) 指向的值为 %rip */
+  80475b:	4d 89 13             	mov    %r10,(%r11)
+	movq %r11, 136(%rsp)	/* 更新 trap-time %rsp 的值 */
+  80475e:	4c 89 9c 24 88 00 00 	mov    %r11,0x88(%rsp)
+  804765:	00 
+		trap-time eflags
+		trap-time rip
+	*/
+
+	// 恢复 trap-time 寄存器集.  接下来不能再修改任何通用寄存器集 PushRegs.
+	POPA_	/* 之前已经通过增加 16-Byte 跳过了 fault_va 和 utf_err，所以只需使用 POPA_ 恢复 */
+  804766:	4c 8b 3c 24          	mov    (%rsp),%r15
+  80476a:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  80476f:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  804774:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  804779:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80477e:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  804783:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  804788:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80478d:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  804792:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  804797:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80479c:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  8047a1:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8047a6:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  8047ab:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8047b0:	48 83 c4 78          	add    $0x78,%rsp
+
+	// 从栈中恢复 %eflags.  接下来不能再使用修改 %eflags 的指令，比如算术指令sub, cmp等.
+	addq $8, %rsp	/* 跳过 %rip，指向 %eflags */
+  8047b4:	48 83 c4 08          	add    $0x8,%rsp
+	popfq			/* 从栈中恢复 %eflags */
+  8047b8:	9d                   	popf
+		(blank 8-Byte)
+		trap-time rip
+	*/
+
+	// 切换回调整后的 trap-time 栈.
+	popq %rsp		/* 已经指向 %rsp，直接 pop 恢复 */
+  8047b9:	5c                   	pop    %rsp
+
+	// 返回重新执行引起页错误的环境指令.
+	ret				/* popq %rip */
+  8047ba:	c3                   	ret
+
+00000000008047bb <ipc_recv>:
+ * 如果 pg 为空，则传递 sys_ipc_recv 一个值，它将理解为“no page”的意思
+ * (Zero 不是正确的值，因为这是映射页面的完美有效位置)
+ */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8047bb:	55                   	push   %rbp
+  8047bc:	48 89 e5             	mov    %rsp,%rbp
+  8047bf:	48 83 ec 30          	sub    $0x30,%rsp
+  8047c3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8047c7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8047cb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	int r = 0;
+  8047cf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	if(pg) {
+  8047d6:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8047db:	74 18                	je     8047f5 <ipc_recv+0x3a>
+		r = sys_ipc_recv(pg);
+  8047dd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8047e1:	48 89 c7             	mov    %rax,%rdi
+  8047e4:	48 b8 35 43 80 00 00 	movabs $0x804335,%rax
+  8047eb:	00 00 00 
+  8047ee:	ff d0                	call   *%rax
+  8047f0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8047f3:	eb 1c                	jmp    804811 <ipc_recv+0x56>
+	}
+	// pg == 0, pg > UTOP
+	else {
+		r = sys_ipc_recv((void*)KERNBASE);
+  8047f5:	48 b8 00 00 00 04 80 	movabs $0x8004000000,%rax
+  8047fc:	00 00 00 
+  8047ff:	48 89 c7             	mov    %rax,%rdi
+  804802:	48 b8 35 43 80 00 00 	movabs $0x804335,%rax
+  804809:	00 00 00 
+  80480c:	ff d0                	call   *%rax
+  80480e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	}
+	if (r < 0) {
+  804811:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804815:	79 39                	jns    804850 <ipc_recv+0x95>
+		*from_env_store =  (from_env_store != NULL) ? (envid_t)0 : *from_env_store;
+  804817:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80481c:	75 08                	jne    804826 <ipc_recv+0x6b>
+  80481e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804822:	8b 00                	mov    (%rax),%eax
+  804824:	eb 05                	jmp    80482b <ipc_recv+0x70>
+  804826:	b8 00 00 00 00       	mov    $0x0,%eax
+  80482b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80482f:	89 02                	mov    %eax,(%rdx)
+		*perm_store = (perm_store != NULL) ? (int)0 : *perm_store;
+  804831:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804836:	75 08                	jne    804840 <ipc_recv+0x85>
+  804838:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80483c:	8b 00                	mov    (%rax),%eax
+  80483e:	eb 05                	jmp    804845 <ipc_recv+0x8a>
+  804840:	b8 00 00 00 00       	mov    $0x0,%eax
+  804845:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804849:	89 02                	mov    %eax,(%rdx)
+		return r;
+  80484b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80484e:	eb 53                	jmp    8048a3 <ipc_recv+0xe8>
+	}
+	// 设置from_env_store为发送进程的进程ID
+	if(from_env_store) {
+  804850:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804855:	74 19                	je     804870 <ipc_recv+0xb5>
+		*from_env_store = thisproc->env_ipc_from;
+  804857:	48 b8 70 30 81 00 00 	movabs $0x813070,%rax
+  80485e:	00 00 00 
+  804861:	48 8b 00             	mov    (%rax),%rax
+  804864:	8b 90 6c 01 00 00    	mov    0x16c(%rax),%edx
+  80486a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80486e:	89 10                	mov    %edx,(%rax)
+	}
+	// 如果传递物理页，该位不为0，设置perm_store为物理页的权限
+	if(perm_store) {
+  804870:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804875:	74 19                	je     804890 <ipc_recv+0xd5>
+		*perm_store = thisproc->env_ipc_perm;
+  804877:	48 b8 70 30 81 00 00 	movabs $0x813070,%rax
+  80487e:	00 00 00 
+  804881:	48 8b 00             	mov    (%rax),%rax
+  804884:	8b 90 70 01 00 00    	mov    0x170(%rax),%edx
+  80488a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80488e:	89 10                	mov    %edx,(%rax)
+	}
+	// 返回发送进程发送的值
+	return thisproc->env_ipc_value;
+  804890:	48 b8 70 30 81 00 00 	movabs $0x813070,%rax
+  804897:	00 00 00 
+  80489a:	48 8b 00             	mov    (%rax),%rax
+  80489d:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8048a3:	c9                   	leave
+  8048a4:	c3                   	ret
+
+00000000008048a5 <ipc_send>:
+ * 使用sys_yield()使cpu友好
+ * 如果'pg'为null，则给sys_ipc_recv传递一个它会理解为“无页面”的值(0不是正确的值)
+ */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8048a5:	55                   	push   %rbp
+  8048a6:	48 89 e5             	mov    %rsp,%rbp
+  8048a9:	48 83 ec 30          	sub    $0x30,%rsp
+  8048ad:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8048b0:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8048b3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8048b7:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	int r = -E_IPC_NOT_RECV;
+  8048ba:	c7 45 fc f8 ff ff ff 	movl   $0xfffffff8,-0x4(%rbp)
+	// 子进程不是接收状态
+	while(r == -E_IPC_NOT_RECV) {
+  8048c1:	eb 59                	jmp    80491c <ipc_send+0x77>
+		if(pg) {
+  8048c3:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8048c8:	74 20                	je     8048ea <ipc_send+0x45>
+			// 传递物理页
+			r = sys_ipc_try_send(to_env, val, pg, perm);
+  8048ca:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8048cd:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8048d0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8048d4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048d7:	89 c7                	mov    %eax,%edi
+  8048d9:	48 b8 de 42 80 00 00 	movabs $0x8042de,%rax
+  8048e0:	00 00 00 
+  8048e3:	ff d0                	call   *%rax
+  8048e5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048e8:	eb 26                	jmp    804910 <ipc_send+0x6b>
+		}
+		// pg == 0, pg > UTOP
+		else {
+			// (void*)KERNBASE > UTOP
+			r = sys_ipc_try_send(to_env, val, (void*)KERNBASE, perm);
+  8048ea:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8048ed:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8048f0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048f3:	89 d1                	mov    %edx,%ecx
+  8048f5:	48 ba 00 00 00 04 80 	movabs $0x8004000000,%rdx
+  8048fc:	00 00 00 
+  8048ff:	89 c7                	mov    %eax,%edi
+  804901:	48 b8 de 42 80 00 00 	movabs $0x8042de,%rax
+  804908:	00 00 00 
+  80490b:	ff d0                	call   *%rax
+  80490d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+		}
+		// 让出CPU
+		sys_yield();
+  804910:	48 b8 be 40 80 00 00 	movabs $0x8040be,%rax
+  804917:	00 00 00 
+  80491a:	ff d0                	call   *%rax
+	while(r == -E_IPC_NOT_RECV) {
+  80491c:	83 7d fc f8          	cmpl   $0xfffffff8,-0x4(%rbp)
+  804920:	74 a1                	je     8048c3 <ipc_send+0x1e>
+	}
+	if (r != 0) {
+  804922:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804926:	74 30                	je     804958 <ipc_send+0xb3>
+		panic("something went wrong with sending the page");
+  804928:	48 b8 c8 64 80 00 00 	movabs $0x8064c8,%rax
+  80492f:	00 00 00 
+  804932:	48 89 c2             	mov    %rax,%rdx
+  804935:	be 48 00 00 00       	mov    $0x48,%esi
+  80493a:	48 b8 f3 64 80 00 00 	movabs $0x8064f3,%rax
+  804941:	00 00 00 
+  804944:	48 89 c7             	mov    %rax,%rdi
+  804947:	b8 00 00 00 00       	mov    $0x0,%eax
+  80494c:	48 b9 cc 25 80 00 00 	movabs $0x8025cc,%rcx
+  804953:	00 00 00 
+  804956:	ff d1                	call   *%rcx
+	}
+}
+  804958:	90                   	nop
+  804959:	c9                   	leave
+  80495a:	c3                   	ret
+
+000000000080495b <ipc_find_env>:
+// find special environments.
+// Returns 0 if no such environment exists.
+// 内核只遍历已分配的环境(env_live)，不扫描整个 procs[]
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80495b:	55                   	push   %rbp
+  80495c:	48 89 e5             	mov    %rsp,%rbp
+  80495f:	48 83 ec 20          	sub    $0x20,%rsp
+  804963:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	envid_t r = sys_env_find(type);
+  804966:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804969:	89 c7                	mov    %eax,%edi
+  80496b:	48 b8 ac 45 80 00 00 	movabs $0x8045ac,%rax
+  804972:	00 00 00 
+  804975:	ff d0                	call   *%rax
+  804977:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+	return r < 0 ? 0 : r;
+  80497a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80497d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804982:	85 c0                	test   %eax,%eax
+  804984:	0f 48 c2             	cmovs  %edx,%eax
+}
+  804987:	c9                   	leave
+  804988:	c3                   	ret
+
+0000000000804989 <fsipc>:
+ * dstva 非空时，服务器返回的页映射到 dstva
+ * 返回服务器的结果
+ */
+static int
+fsipc(unsigned type, void *dstva)
+{
+  804989:	55                   	push   %rbp
+  80498a:	48 89 e5             	mov    %rsp,%rbp
+  80498d:	48 83 ec 10          	sub    $0x10,%rsp
+  804991:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804994:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	static envid_t fsenv;
+
+	if (fsenv == 0)
+  804998:	48 b8 00 50 81 00 00 	movabs $0x815000,%rax
+  80499f:	00 00 00 
+  8049a2:	8b 00                	mov    (%rax),%eax
+  8049a4:	85 c0                	test   %eax,%eax
+  8049a6:	75 1d                	jne    8049c5 <fsipc+0x3c>
+		fsenv = ipc_find_env(PROC_TYPE_FS);
+  8049a8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8049ad:	48 b8 5b 49 80 00 00 	movabs $0x80495b,%rax
+  8049b4:	00 00 00 
+  8049b7:	ff d0                	call   *%rax
+  8049b9:	48 ba 00 50 81 00 00 	movabs $0x815000,%rdx
+  8049c0:	00 00 00 
+  8049c3:	89 02                	mov    %eax,(%rdx)
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisproc->proc_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8049c5:	48 b8 00 50 81 00 00 	movabs $0x815000,%rax
+  8049cc:	00 00 00 
+  8049cf:	8b 00                	mov    (%rax),%eax
+  8049d1:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  8049d4:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8049d9:	48 ba 00 40 81 00 00 	movabs $0x814000,%rdx
+  8049e0:	00 00 00 
+  8049e3:	89 c7                	mov    %eax,%edi
+  8049e5:	48 b8 a5 48 80 00 00 	movabs $0x8048a5,%rax
+  8049ec:	00 00 00 
+  8049ef:	ff d0                	call   *%rax
+	return ipc_recv(NULL, dstva, NULL);
+  8049f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049fa:	48 89 c6             	mov    %rax,%rsi
+  8049fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a02:	48 b8 bb 47 80 00 00 	movabs $0x8047bb,%rax
+  804a09:	00 00 00 
+  804a0c:	ff d0                	call   *%rax
+}
+  804a0e:	c9                   	leave
+  804a0f:	c3                   	ret
+
+0000000000804a10 <open>:
+ *   -E_BAD_PATH: 路径太长
+ *   -E_MAX_OPEN: 文件描述符已用完
+ *   以及服务器返回的错误
+ */
+int open(const char *path, int mode)
+{
+  804a10:	55                   	push   %rbp
+  804a11:	48 89 e5             	mov    %rsp,%rbp
+  804a14:	48 83 ec 20          	sub    $0x20,%rsp
+  804a18:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804a1c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  804a1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a23:	48 89 c7             	mov    %rax,%rdi
+  804a26:	48 b8 2a 34 80 00 00 	movabs $0x80342a,%rax
+  804a2d:	00 00 00 
+  804a30:	ff d0                	call   *%rax
+  804a32:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804a37:	7e 0a                	jle    804a43 <open+0x33>
+		return -E_BAD_PATH;
+  804a39:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804a3e:	e9 a8 00 00 00       	jmp    804aeb <open+0xdb>
+
+	if ((r = fd_alloc(&fd)) < 0)
+  804a43:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804a47:	48 89 c7             	mov    %rax,%rdi
+  804a4a:	48 b8 cb 52 80 00 00 	movabs $0x8052cb,%rax
+  804a51:	00 00 00 
+  804a54:	ff d0                	call   *%rax
+  804a56:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804a59:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804a5d:	79 08                	jns    804a67 <open+0x57>
+		return r;
+  804a5f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a62:	e9 84 00 00 00       	jmp    804aeb <open+0xdb>
+
+	strcpy(fsipcbuf.open.req_path, path);
+  804a67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a6b:	48 89 c6             	mov    %rax,%rsi
+  804a6e:	48 b8 00 40 81 00 00 	movabs $0x814000,%rax
+  804a75:	00 00 00 
+  804a78:	48 89 c7             	mov    %rax,%rdi
+  804a7b:	48 b8 96 34 80 00 00 	movabs $0x803496,%rax
+  804a82:	00 00 00 
+  804a85:	ff d0                	call   *%rax
+	fsipcbuf.open.req_omode = mode;
+  804a87:	48 ba 00 40 81 00 00 	movabs $0x814000,%rdx
+  804a8e:	00 00 00 
+  804a91:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804a94:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+	// 服务器返回的 Fd 页映射到 fd
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0)
+  804a9a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a9e:	48 89 c6             	mov    %rax,%rsi
+  804aa1:	bf 01 00 00 00       	mov    $0x1,%edi
+  804aa6:	48 b8 89 49 80 00 00 	movabs $0x804989,%rax
+  804aad:	00 00 00 
+  804ab0:	ff d0                	call   *%rax
+  804ab2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804ab5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ab9:	79 1d                	jns    804ad8 <open+0xc8>
+	{
+		fd_close(fd, 0);
+  804abb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804abf:	be 00 00 00 00       	mov    $0x0,%esi
+  804ac4:	48 89 c7             	mov    %rax,%rdi
+  804ac7:	48 b8 9f 53 80 00 00 	movabs $0x80539f,%rax
+  804ace:	00 00 00 
+  804ad1:	ff d0                	call   *%rax
+		return r;
+  804ad3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ad6:	eb 13                	jmp    804aeb <open+0xdb>
+	}
+
+	return fd2num(fd);
+  804ad8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804adc:	48 89 c7             	mov    %rax,%rdi
+  804adf:	48 b8 4c 52 80 00 00 	movabs $0x80524c,%rax
+  804ae6:	00 00 00 
+  804ae9:	ff d0                	call   *%rax
+}
+  804aeb:	c9                   	leave
+  804aec:	c3                   	ret
+
+0000000000804aed <fexec>:
+ * 把打开的程序文件 fdnum 设为子环境 child 的程序映像，供 spawn 使用
+ * 之后用 sys_vma_binary() 登记的程序段由内核按需从该文件填充
+ * 错误时返回 < 0: fdnum 不是打开的普通文件，或服务器返回的错误
+ */
+int fexec(int fdnum, envid_t child)
+{
+  804aed:	55                   	push   %rbp
+  804aee:	48 89 e5             	mov    %rsp,%rbp
+  804af1:	48 83 ec 20          	sub    $0x20,%rsp
+  804af5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804af8:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804afb:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804aff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b02:	48 89 d6             	mov    %rdx,%rsi
+  804b05:	89 c7                	mov    %eax,%edi
+  804b07:	48 b8 39 53 80 00 00 	movabs $0x805339,%rax
+  804b0e:	00 00 00 
+  804b11:	ff d0                	call   *%rax
+  804b13:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804b16:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b1a:	79 05                	jns    804b21 <fexec+0x34>
+		return r;
+  804b1c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804b1f:	eb 56                	jmp    804b77 <fexec+0x8a>
+	if (fd->fd_dev_id != devfile.dev_id)
+  804b21:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b25:	8b 10                	mov    (%rax),%edx
+  804b27:	48 b8 80 80 80 00 00 	movabs $0x808080,%rax
+  804b2e:	00 00 00 
+  804b31:	8b 00                	mov    (%rax),%eax
+  804b33:	39 c2                	cmp    %eax,%edx
+  804b35:	74 07                	je     804b3e <fexec+0x51>
+		return -E_INVAL;
+  804b37:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804b3c:	eb 39                	jmp    804b77 <fexec+0x8a>
+	fsipcbuf.exec.req_fileid = fd->fd_file.id;
+  804b3e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b42:	8b 40 0c             	mov    0xc(%rax),%eax
+  804b45:	48 ba 00 40 81 00 00 	movabs $0x814000,%rdx
+  804b4c:	00 00 00 
+  804b4f:	89 02                	mov    %eax,(%rdx)
+	fsipcbuf.exec.req_envid = child;
+  804b51:	48 ba 00 40 81 00 00 	movabs $0x814000,%rdx
+  804b58:	00 00 00 
+  804b5b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b5e:	89 42 04             	mov    %eax,0x4(%rdx)
+	return fsipc(FSREQ_EXEC, NULL);
+  804b61:	be 00 00 00 00       	mov    $0x0,%esi
+  804b66:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804b6b:	48 b8 89 49 80 00 00 	movabs $0x804989,%rax
+  804b72:	00 00 00 
+  804b75:	ff d0                	call   *%rax
+}
+  804b77:	c9                   	leave
+  804b78:	c3                   	ret
+
+0000000000804b79 <devfile_unmap>:
+
+// 解除 fd 的数据窗口中 [from, FILEWINDOW) 的块缓存页映射
+static void
+devfile_unmap(struct Fd *fd, off_t from)
+{
+  804b79:	55                   	push   %rbp
+  804b7a:	48 89 e5             	mov    %rsp,%rbp
+  804b7d:	48 83 ec 40          	sub    $0x40,%rsp
+  804b81:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804b85:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+	char *va = fd2data(fd);
+  804b88:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b8c:	48 89 c7             	mov    %rax,%rdi
+  804b8f:	48 b8 6f 52 80 00 00 	movabs $0x80526f,%rax
+  804b96:	00 00 00 
+  804b99:	ff d0                	call   *%rax
+  804b9b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	uintptr_t off;
+
+	for (off = ROUNDUP(from, PGSIZE); off < FILEWINDOW; off += PGSIZE)
+  804b9f:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  804ba6:	00 
+  804ba7:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804baa:	48 63 d0             	movslq %eax,%rdx
+  804bad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bb1:	48 01 d0             	add    %rdx,%rax
+  804bb4:	48 83 e8 01          	sub    $0x1,%rax
+  804bb8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804bbc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bc5:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804bc9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bcd:	48 29 d0             	sub    %rdx,%rax
+  804bd0:	48 98                	cltq
+  804bd2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804bd6:	eb 45                	jmp    804c1d <devfile_unmap+0xa4>
+		if (va_is_mapped(va + off))
+  804bd8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804bdc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804be0:	48 01 d0             	add    %rdx,%rax
+  804be3:	48 89 c7             	mov    %rax,%rdi
+  804be6:	48 b8 34 51 80 00 00 	movabs $0x805134,%rax
+  804bed:	00 00 00 
+  804bf0:	ff d0                	call   *%rax
+  804bf2:	84 c0                	test   %al,%al
+  804bf4:	74 1f                	je     804c15 <devfile_unmap+0x9c>
+			sys_page_unmap(0, va + off);
+  804bf6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804bfa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bfe:	48 01 d0             	add    %rdx,%rax
+  804c01:	48 89 c6             	mov    %rax,%rsi
+  804c04:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c09:	48 b8 ad 41 80 00 00 	movabs $0x8041ad,%rax
+  804c10:	00 00 00 
+  804c13:	ff d0                	call   *%rax
+	for (off = ROUNDUP(from, PGSIZE); off < FILEWINDOW; off += PGSIZE)
+  804c15:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  804c1c:	00 
+  804c1d:	48 c7 45 d8 00 00 20 	movq   $0x200000,-0x28(%rbp)
+  804c24:	00 
+  804c25:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c29:	48 05 ff 9f 40 00    	add    $0x409fff,%rax
+  804c2f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804c33:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c37:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c3c:	48 f7 75 d8          	divq   -0x28(%rbp)
+  804c40:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c44:	48 29 d0             	sub    %rdx,%rax
+  804c47:	48 98                	cltq
+  804c49:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  804c4d:	72 89                	jb     804bd8 <devfile_unmap+0x5f>
+}
+  804c4f:	90                   	nop
+  804c50:	90                   	nop
+  804c51:	c9                   	leave
+  804c52:	c3                   	ret
+
+0000000000804c53 <devfile_flush>:
+ * 关闭文件时由 fd_close 调用：解除数据窗口的映射，并请求服务器将文件写回磁盘
+ * 服务器在 Fd 页的引用计数降为 1 时回收 OpenFile
+ */
+static int
+devfile_flush(struct Fd *fd)
+{
+  804c53:	55                   	push   %rbp
+  804c54:	48 89 e5             	mov    %rsp,%rbp
+  804c57:	48 83 ec 10          	sub    $0x10,%rsp
+  804c5b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	devfile_unmap(fd, 0);
+  804c5f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c63:	be 00 00 00 00       	mov    $0x0,%esi
+  804c68:	48 89 c7             	mov    %rax,%rdi
+  804c6b:	48 b8 79 4b 80 00 00 	movabs $0x804b79,%rax
+  804c72:	00 00 00 
+  804c75:	ff d0                	call   *%rax
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  804c77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c7b:	8b 40 0c             	mov    0xc(%rax),%eax
+  804c7e:	48 ba 00 40 81 00 00 	movabs $0x814000,%rdx
+  804c85:	00 00 00 
+  804c88:	89 02                	mov    %eax,(%rdx)
+	return fsipc(FSREQ_FLUSH, NULL);
+  804c8a:	be 00 00 00 00       	mov    $0x0,%esi
+  804c8f:	bf 06 00 00 00       	mov    $0x6,%edi
+  804c94:	48 b8 89 49 80 00 00 	movabs $0x804989,%rax
+  804c9b:	00 00 00 
+  804c9e:	ff d0                	call   *%rax
+}
+  804ca0:	c9                   	leave
+  804ca1:	c3                   	ret
+
+0000000000804ca2 <devfile_map>:
+ * 确保文件 offset(BLKSIZE 对齐)处的块已映射在 fd 的数据窗口中
+ * 未映射时请求服务器把块缓存页共享过来(FSREQ_MAP)
+ */
+static int
+devfile_map(struct Fd *fd, off_t offset)
+{
+  804ca2:	55                   	push   %rbp
+  804ca3:	48 89 e5             	mov    %rsp,%rbp
+  804ca6:	48 83 ec 20          	sub    $0x20,%rsp
+  804caa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804cae:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	char *va = fd2data(fd) + offset;
+  804cb1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cb5:	48 89 c7             	mov    %rax,%rdi
+  804cb8:	48 b8 6f 52 80 00 00 	movabs $0x80526f,%rax
+  804cbf:	00 00 00 
+  804cc2:	ff d0                	call   *%rax
+  804cc4:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804cc7:	48 63 d2             	movslq %edx,%rdx
+  804cca:	48 01 d0             	add    %rdx,%rax
+  804ccd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+	if (va_is_mapped(va))
+  804cd1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cd5:	48 89 c7             	mov    %rax,%rdi
+  804cd8:	48 b8 34 51 80 00 00 	movabs $0x805134,%rax
+  804cdf:	00 00 00 
+  804ce2:	ff d0                	call   *%rax
+  804ce4:	84 c0                	test   %al,%al
+  804ce6:	74 07                	je     804cef <devfile_map+0x4d>
+		return 0;
+  804ce8:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ced:	eb 3b                	jmp    804d2a <devfile_map+0x88>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  804cef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cf3:	8b 40 0c             	mov    0xc(%rax),%eax
+  804cf6:	48 ba 00 40 81 00 00 	movabs $0x814000,%rdx
+  804cfd:	00 00 00 
+  804d00:	89 02                	mov    %eax,(%rdx)
+	fsipcbuf.map.req_offset = offset;
+  804d02:	48 ba 00 40 81 00 00 	movabs $0x814000,%rdx
+  804d09:	00 00 00 
+  804d0c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804d0f:	89 42 04             	mov    %eax,0x4(%rdx)
+	return fsipc(FSREQ_MAP, va);
+  804d12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d16:	48 89 c6             	mov    %rax,%rsi
+  804d19:	bf 09 00 00 00       	mov    $0x9,%edi
+  804d1e:	48 b8 89 49 80 00 00 	movabs $0x804989,%rax
+  804d25:	00 00 00 
+  804d28:	ff d0                	call   *%rax
+}
+  804d2a:	c9                   	leave
+  804d2b:	c3                   	ret
+
+0000000000804d2c <devfile_read>:
+ * 数据不经过 IPC 请求页复制
+ * 返回读取的字节数
+ */
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  804d2c:	55                   	push   %rbp
+  804d2d:	48 89 e5             	mov    %rsp,%rbp
+  804d30:	48 83 ec 60          	sub    $0x60,%rsp
+  804d34:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  804d38:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  804d3c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	char *va = fd2data(fd);
+  804d40:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804d44:	48 89 c7             	mov    %rax,%rdi
+  804d47:	48 b8 6f 52 80 00 00 	movabs $0x80526f,%rax
+  804d4e:	00 00 00 
+  804d51:	ff d0                	call   *%rax
+  804d53:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	off_t pos = fd->fd_offset, end;
+  804d57:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804d5b:	8b 40 04             	mov    0x4(%rax),%eax
+  804d5e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	size_t m;
+	int r;
+
+	if (pos >= fd->fd_file.size)
+  804d61:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804d65:	8b 40 10             	mov    0x10(%rax),%eax
+  804d68:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  804d6b:	7c 0a                	jl     804d77 <devfile_read+0x4b>
+		return 0;
+  804d6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d72:	e9 02 01 00 00       	jmp    804e79 <devfile_read+0x14d>
+	end = MIN(pos + (off_t)n, fd->fd_file.size);
+  804d77:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804d7b:	89 c2                	mov    %eax,%edx
+  804d7d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d80:	01 d0                	add    %edx,%eax
+  804d82:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d85:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804d89:	8b 40 10             	mov    0x10(%rax),%eax
+  804d8c:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  804d8f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804d92:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804d95:	39 c2                	cmp    %eax,%edx
+  804d97:	0f 4e c2             	cmovle %edx,%eax
+  804d9a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	n = end - pos;
+  804d9d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804da0:	2b 45 fc             	sub    -0x4(%rbp),%eax
+  804da3:	48 98                	cltq
+  804da5:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+	while (pos < end)
+  804da9:	e9 b1 00 00 00       	jmp    804e5f <devfile_read+0x133>
+	{
+		if ((r = devfile_map(fd, ROUNDDOWN(pos, BLKSIZE))) < 0)
+  804dae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804db1:	48 98                	cltq
+  804db3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804db7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804dbb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  804dc0:	89 c2                	mov    %eax,%edx
+  804dc2:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804dc6:	89 d6                	mov    %edx,%esi
+  804dc8:	48 89 c7             	mov    %rax,%rdi
+  804dcb:	48 b8 a2 4c 80 00 00 	movabs $0x804ca2,%rax
+  804dd2:	00 00 00 
+  804dd5:	ff d0                	call   *%rax
+  804dd7:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  804dda:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  804dde:	79 08                	jns    804de8 <devfile_read+0xbc>
+			return r;
+  804de0:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804de3:	e9 91 00 00 00       	jmp    804e79 <devfile_read+0x14d>
+		m = MIN(end - pos, BLKSIZE - pos % BLKSIZE);
+  804de8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804deb:	2b 45 fc             	sub    -0x4(%rbp),%eax
+  804dee:	89 45 d0             	mov    %eax,-0x30(%rbp)
+  804df1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  804df4:	89 d0                	mov    %edx,%eax
+  804df6:	c1 f8 1f             	sar    $0x1f,%eax
+  804df9:	c1 e8 14             	shr    $0x14,%eax
+  804dfc:	01 c2                	add    %eax,%edx
+  804dfe:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  804e04:	29 c2                	sub    %eax,%edx
+  804e06:	b8 00 10 00 00       	mov    $0x1000,%eax
+  804e0b:	29 d0                	sub    %edx,%eax
+  804e0d:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  804e10:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  804e13:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804e16:	39 c2                	cmp    %eax,%edx
+  804e18:	0f 4e c2             	cmovle %edx,%eax
+  804e1b:	48 98                	cltq
+  804e1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+		memmove(buf, va + pos, m);
+  804e21:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e24:	48 63 d0             	movslq %eax,%rdx
+  804e27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804e2b:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804e2f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804e33:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804e37:	48 89 ce             	mov    %rcx,%rsi
+  804e3a:	48 89 c7             	mov    %rax,%rdi
+  804e3d:	48 b8 22 3b 80 00 00 	movabs $0x803b22,%rax
+  804e44:	00 00 00 
+  804e47:	ff d0                	call   *%rax
+		buf += m;
+  804e49:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e4d:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+		pos += m;
+  804e51:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e55:	89 c2                	mov    %eax,%edx
+  804e57:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e5a:	01 d0                	add    %edx,%eax
+  804e5c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	while (pos < end)
+  804e5f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e62:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804e65:	0f 8c 43 ff ff ff    	jl     804dae <devfile_read+0x82>
+	}
+	fd->fd_offset = pos;
+  804e6b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804e6f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  804e72:	89 50 04             	mov    %edx,0x4(%rax)
+	return n;
+  804e75:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  804e79:	c9                   	leave
+  804e7a:	c3                   	ret
+
+0000000000804e7b <devfile_write>:
+ * 服务器写入的就是客户端映射的块缓存页，因此已映射的块无需重新映射
+ * 返回写入的字节数
+ */
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804e7b:	55                   	push   %rbp
+  804e7c:	48 89 e5             	mov    %rsp,%rbp
+  804e7f:	48 83 ec 50          	sub    $0x50,%rsp
+  804e83:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804e87:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804e8b:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	size_t m, tot = 0;
+  804e8f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804e96:	00 
+	int r;
+
+	while (tot < n)
+  804e97:	e9 fc 00 00 00       	jmp    804f98 <devfile_write+0x11d>
+	{
+		m = MIN(n - tot, sizeof(fsipcbuf.write.req_buf));
+  804e9c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804ea0:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  804ea4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  804ea8:	48 c7 45 e8 f4 0f 00 	movq   $0xff4,-0x18(%rbp)
+  804eaf:	00 
+  804eb0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804eb4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804eb8:	48 39 c2             	cmp    %rax,%rdx
+  804ebb:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804ebf:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		fsipcbuf.write.req_fileid = fd->fd_file.id;
+  804ec3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ec7:	8b 40 0c             	mov    0xc(%rax),%eax
+  804eca:	48 ba 00 40 81 00 00 	movabs $0x814000,%rdx
+  804ed1:	00 00 00 
+  804ed4:	89 42 08             	mov    %eax,0x8(%rdx)
+		fsipcbuf.write.req_n = m;
+  804ed7:	48 ba 00 40 81 00 00 	movabs $0x814000,%rdx
+  804ede:	00 00 00 
+  804ee1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ee5:	48 89 02             	mov    %rax,(%rdx)
+		memmove(fsipcbuf.write.req_buf, buf + tot, m);
+  804ee8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804eec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ef0:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804ef4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ef8:	48 89 c2             	mov    %rax,%rdx
+  804efb:	48 89 ce             	mov    %rcx,%rsi
+  804efe:	48 b8 0c 40 81 00 00 	movabs $0x81400c,%rax
+  804f05:	00 00 00 
+  804f08:	48 89 c7             	mov    %rax,%rdi
+  804f0b:	48 b8 22 3b 80 00 00 	movabs $0x803b22,%rax
+  804f12:	00 00 00 
+  804f15:	ff d0                	call   *%rax
+		if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  804f17:	be 00 00 00 00       	mov    $0x0,%esi
+  804f1c:	bf 04 00 00 00       	mov    $0x4,%edi
+  804f21:	48 b8 89 49 80 00 00 	movabs $0x804989,%rax
+  804f28:	00 00 00 
+  804f2b:	ff d0                	call   *%rax
+  804f2d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804f30:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804f34:	79 05                	jns    804f3b <devfile_write+0xc0>
+			return r;
+  804f36:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f39:	eb 72                	jmp    804fad <devfile_write+0x132>
+		assert(r <= m);
+  804f3b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f3e:	48 98                	cltq
+  804f40:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  804f44:	73 3e                	jae    804f84 <devfile_write+0x109>
+  804f46:	48 b8 02 65 80 00 00 	movabs $0x806502,%rax
+  804f4d:	00 00 00 
+  804f50:	48 89 c1             	mov    %rax,%rcx
+  804f53:	48 b8 09 65 80 00 00 	movabs $0x806509,%rax
+  804f5a:	00 00 00 
+  804f5d:	48 89 c2             	mov    %rax,%rdx
+  804f60:	be bf 00 00 00       	mov    $0xbf,%esi
+  804f65:	48 b8 1e 65 80 00 00 	movabs $0x80651e,%rax
+  804f6c:	00 00 00 
+  804f6f:	48 89 c7             	mov    %rax,%rdi
+  804f72:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f77:	49 b8 cc 25 80 00 00 	movabs $0x8025cc,%r8
+  804f7e:	00 00 00 
+  804f81:	41 ff d0             	call   *%r8
+		tot += r;
+  804f84:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f87:	48 98                	cltq
+  804f89:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		if (r < m)
+  804f8d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f90:	48 98                	cltq
+  804f92:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  804f96:	72 10                	jb     804fa8 <devfile_write+0x12d>
+	while (tot < n)
+  804f98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f9c:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  804fa0:	0f 82 f6 fe ff ff    	jb     804e9c <devfile_write+0x21>
+  804fa6:	eb 01                	jmp    804fa9 <devfile_write+0x12e>
+			break;
+  804fa8:	90                   	nop
+	}
+	return tot;
+  804fa9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804fad:	c9                   	leave
+  804fae:	c3                   	ret
+
+0000000000804faf <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  804faf:	55                   	push   %rbp
+  804fb0:	48 89 e5             	mov    %rsp,%rbp
+  804fb3:	48 83 ec 20          	sub    $0x20,%rsp
+  804fb7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804fbb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804fbf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fc3:	8b 40 0c             	mov    0xc(%rax),%eax
+  804fc6:	48 ba 00 40 81 00 00 	movabs $0x814000,%rdx
+  804fcd:	00 00 00 
+  804fd0:	89 02                	mov    %eax,(%rdx)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804fd2:	be 00 00 00 00       	mov    $0x0,%esi
+  804fd7:	bf 05 00 00 00       	mov    $0x5,%edi
+  804fdc:	48 b8 89 49 80 00 00 	movabs $0x804989,%rax
+  804fe3:	00 00 00 
+  804fe6:	ff d0                	call   *%rax
+  804fe8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804feb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804fef:	79 05                	jns    804ff6 <devfile_stat+0x47>
+		return r;
+  804ff1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ff4:	eb 59                	jmp    80504f <devfile_stat+0xa0>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804ff6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ffa:	48 ba 00 40 81 00 00 	movabs $0x814000,%rdx
+  805001:	00 00 00 
+  805004:	48 89 d6             	mov    %rdx,%rsi
+  805007:	48 89 c7             	mov    %rax,%rdi
+  80500a:	48 b8 96 34 80 00 00 	movabs $0x803496,%rax
+  805011:	00 00 00 
+  805014:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  805016:	48 b8 00 40 81 00 00 	movabs $0x814000,%rax
+  80501d:	00 00 00 
+  805020:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  805026:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80502a:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  805030:	48 b8 00 40 81 00 00 	movabs $0x814000,%rax
+  805037:	00 00 00 
+  80503a:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  805040:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805044:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  80504a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80504f:	c9                   	leave
+  805050:	c3                   	ret
+
+0000000000805051 <devfile_trunc>:
+
+// 截断或扩展文件，截断时解除新大小之外的块的映射(这些块可能被服务器释放并重新分配)
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  805051:	55                   	push   %rbp
+  805052:	48 89 e5             	mov    %rsp,%rbp
+  805055:	48 83 ec 10          	sub    $0x10,%rsp
+  805059:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80505d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  805060:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805064:	8b 40 0c             	mov    0xc(%rax),%eax
+  805067:	48 ba 00 40 81 00 00 	movabs $0x814000,%rdx
+  80506e:	00 00 00 
+  805071:	89 02                	mov    %eax,(%rdx)
+	fsipcbuf.set_size.req_size = newsize;
+  805073:	48 ba 00 40 81 00 00 	movabs $0x814000,%rdx
+  80507a:	00 00 00 
+  80507d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805080:	89 42 04             	mov    %eax,0x4(%rdx)
+	devfile_unmap(fd, newsize);
+  805083:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805086:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80508a:	89 d6                	mov    %edx,%esi
+  80508c:	48 89 c7             	mov    %rax,%rdi
+  80508f:	48 b8 79 4b 80 00 00 	movabs $0x804b79,%rax
+  805096:	00 00 00 
+  805099:	ff d0                	call   *%rax
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80509b:	be 00 00 00 00       	mov    $0x0,%esi
+  8050a0:	bf 02 00 00 00       	mov    $0x2,%edi
+  8050a5:	48 b8 89 49 80 00 00 	movabs $0x804989,%rax
+  8050ac:	00 00 00 
+  8050af:	ff d0                	call   *%rax
+}
+  8050b1:	c9                   	leave
+  8050b2:	c3                   	ret
+
+00000000008050b3 <remove>:
+
+// 删除文件
+int remove(const char *path)
+{
+  8050b3:	55                   	push   %rbp
+  8050b4:	48 89 e5             	mov    %rsp,%rbp
+  8050b7:	48 83 ec 10          	sub    $0x10,%rsp
+  8050bb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  8050bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050c3:	48 89 c7             	mov    %rax,%rdi
+  8050c6:	48 b8 2a 34 80 00 00 	movabs $0x80342a,%rax
+  8050cd:	00 00 00 
+  8050d0:	ff d0                	call   *%rax
+  8050d2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8050d7:	7e 07                	jle    8050e0 <remove+0x2d>
+		return -E_BAD_PATH;
+  8050d9:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8050de:	eb 36                	jmp    805116 <remove+0x63>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8050e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050e4:	48 89 c6             	mov    %rax,%rsi
+  8050e7:	48 b8 00 40 81 00 00 	movabs $0x814000,%rax
+  8050ee:	00 00 00 
+  8050f1:	48 89 c7             	mov    %rax,%rdi
+  8050f4:	48 b8 96 34 80 00 00 	movabs $0x803496,%rax
+  8050fb:	00 00 00 
+  8050fe:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  805100:	be 00 00 00 00       	mov    $0x0,%esi
+  805105:	bf 07 00 00 00       	mov    $0x7,%edi
+  80510a:	48 b8 89 49 80 00 00 	movabs $0x804989,%rax
+  805111:	00 00 00 
+  805114:	ff d0                	call   *%rax
+}
+  805116:	c9                   	leave
+  805117:	c3                   	ret
+
+0000000000805118 <sync>:
+
+// 将文件系统的所有修改写回磁盘
+int sync(void)
+{
+  805118:	55                   	push   %rbp
+  805119:	48 89 e5             	mov    %rsp,%rbp
+	return fsipc(FSREQ_SYNC, NULL);
+  80511c:	be 00 00 00 00       	mov    $0x0,%esi
+  805121:	bf 08 00 00 00       	mov    $0x8,%edi
+  805126:	48 b8 89 49 80 00 00 	movabs $0x804989,%rax
+  80512d:	00 00 00 
+  805130:	ff d0                	call   *%rax
+}
+  805132:	5d                   	pop    %rbp
+  805133:	c3                   	ret
+
+0000000000805134 <va_is_mapped>:
+/**
+ * 虚拟地址 va 是否已映射
+ * 逐级检查页表，避免访问不存在的页表页
+ */
+bool va_is_mapped(void *va)
+{
+  805134:	55                   	push   %rbp
+  805135:	48 89 e5             	mov    %rsp,%rbp
+  805138:	48 83 ec 08          	sub    $0x8,%rsp
+  80513c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return (uvpml4e[VPML4E(va)] & PTE_P) && (uvpde[VPDPE(va)] & PTE_P) &&
+  805140:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805144:	48 c1 e8 27          	shr    $0x27,%rax
+  805148:	48 89 c2             	mov    %rax,%rdx
+  80514b:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  805152:	01 00 00 
+  805155:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805159:	83 e0 01             	and    $0x1,%eax
+		   (uvpd[VPD(va)] & PTE_P) && (uvpt[VPN(va)] & PTE_P);
+  80515c:	48 85 c0             	test   %rax,%rax
+  80515f:	74 6a                	je     8051cb <va_is_mapped+0x97>
+	return (uvpml4e[VPML4E(va)] & PTE_P) && (uvpde[VPDPE(va)] & PTE_P) &&
+  805161:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805165:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805169:	48 89 c2             	mov    %rax,%rdx
+  80516c:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805173:	01 00 00 
+  805176:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80517a:	83 e0 01             	and    $0x1,%eax
+  80517d:	48 85 c0             	test   %rax,%rax
+  805180:	74 49                	je     8051cb <va_is_mapped+0x97>
+		   (uvpd[VPD(va)] & PTE_P) && (uvpt[VPN(va)] & PTE_P);
+  805182:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805186:	48 c1 e8 15          	shr    $0x15,%rax
+  80518a:	48 89 c2             	mov    %rax,%rdx
+  80518d:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805194:	01 00 00 
+  805197:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80519b:	83 e0 01             	and    $0x1,%eax
+	return (uvpml4e[VPML4E(va)] & PTE_P) && (uvpde[VPDPE(va)] & PTE_P) &&
+  80519e:	48 85 c0             	test   %rax,%rax
+  8051a1:	74 28                	je     8051cb <va_is_mapped+0x97>
+		   (uvpd[VPD(va)] & PTE_P) && (uvpt[VPN(va)] & PTE_P);
+  8051a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051a7:	48 c1 e8 0c          	shr    $0xc,%rax
+  8051ab:	48 89 c2             	mov    %rax,%rdx
+  8051ae:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8051b5:	01 00 00 
+  8051b8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8051bc:	83 e0 01             	and    $0x1,%eax
+  8051bf:	48 85 c0             	test   %rax,%rax
+  8051c2:	74 07                	je     8051cb <va_is_mapped+0x97>
+  8051c4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8051c9:	eb 05                	jmp    8051d0 <va_is_mapped+0x9c>
+  8051cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051d0:	83 e0 01             	and    $0x1,%eax
+}
+  8051d3:	c9                   	leave
+  8051d4:	c3                   	ret
+
+00000000008051d5 <pageref>:
+
+// 返回虚拟地址 v 所在物理页的引用计数，v 未映射时返回 0
+int pageref(void *v)
+{
+  8051d5:	55                   	push   %rbp
+  8051d6:	48 89 e5             	mov    %rsp,%rbp
+  8051d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8051dd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	if (!va_is_mapped(v))
+  8051e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051e5:	48 89 c7             	mov    %rax,%rdi
+  8051e8:	48 b8 34 51 80 00 00 	movabs $0x805134,%rax
+  8051ef:	00 00 00 
+  8051f2:	ff d0                	call   *%rax
+  8051f4:	83 f0 01             	xor    $0x1,%eax
+  8051f7:	84 c0                	test   %al,%al
+  8051f9:	74 07                	je     805202 <pageref+0x2d>
+		return 0;
+  8051fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  805200:	eb 48                	jmp    80524a <pageref+0x75>
+	return pages[PPN(PTE_ADDR(uvpt[VPN(v)]))].pp_ref;
+  805202:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805206:	48 c1 e8 0c          	shr    $0xc,%rax
+  80520a:	48 89 c2             	mov    %rax,%rdx
+  80520d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805214:	01 00 00 
+  805217:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80521b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80521f:	48 89 c2             	mov    %rax,%rdx
+  805222:	48 b8 ff ff ff ff ff 	movabs $0xfffffffffffff,%rax
+  805229:	ff 0f 00 
+  80522c:	48 21 d0             	and    %rdx,%rax
+  80522f:	48 ba 00 00 a0 00 80 	movabs $0x8000a00000,%rdx
+  805236:	00 00 00 
+  805239:	48 c1 e0 04          	shl    $0x4,%rax
+  80523d:	48 01 d0             	add    %rdx,%rax
+  805240:	48 83 c0 08          	add    $0x8,%rax
+  805244:	0f b7 00             	movzwl (%rax),%eax
+  805247:	0f b7 c0             	movzwl %ax,%eax
+}
+  80524a:	c9                   	leave
+  80524b:	c3                   	ret
+
+000000000080524c <fd2num>:
+/* ------------------------------- 文件描述符 ------------------------------- */
+
+// 返回 fd 的文件描述符号
+uint64_t
+fd2num(struct Fd *fd)
+{
+  80524c:	55                   	push   %rbp
+  80524d:	48 89 e5             	mov    %rsp,%rbp
+  805250:	48 83 ec 08          	sub    $0x8,%rsp
+  805254:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  805258:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80525c:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  805263:	ff ff ff 
+  805266:	48 01 d0             	add    %rdx,%rax
+  805269:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80526d:	c9                   	leave
+  80526e:	c3                   	ret
+
+000000000080526f <fd2data>:
+
+// 返回 fd 的数据窗口
+char *
+fd2data(struct Fd *fd)
+{
+  80526f:	55                   	push   %rbp
+  805270:	48 89 e5             	mov    %rsp,%rbp
+  805273:	48 83 ec 18          	sub    $0x18,%rsp
+  805277:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  80527b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80527f:	48 89 c7             	mov    %rax,%rdi
+  805282:	48 b8 4c 52 80 00 00 	movabs $0x80524c,%rax
+  805289:	00 00 00 
+  80528c:	ff d0                	call   *%rax
+  80528e:	48 89 c1             	mov    %rax,%rcx
+  805291:	48 c7 45 f8 00 00 20 	movq   $0x200000,-0x8(%rbp)
+  805298:	00 
+  805299:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80529d:	48 05 ff 9f 40 00    	add    $0x409fff,%rax
+  8052a3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8052a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052b0:	48 f7 75 f8          	divq   -0x8(%rbp)
+  8052b4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052b8:	48 29 d0             	sub    %rdx,%rax
+  8052bb:	48 98                	cltq
+  8052bd:	48 0f af c1          	imul   %rcx,%rax
+  8052c1:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  8052c6:	48 01 d0             	add    %rdx,%rax
+}
+  8052c9:	c9                   	leave
+  8052ca:	c3                   	ret
+
+00000000008052cb <fd_alloc>:
+ * 找到编号最小的未使用的文件描述符(其 Fd 页未映射)，存入 *fd_store，但不分配 Fd 页
+ * 调用者需要在其上分配一个页面，否则该文件描述符不会被使用
+ * 所有文件描述符都已使用时返回 -E_MAX_OPEN，*fd_store 为 0
+ */
+int fd_alloc(struct Fd **fd_store)
+{
+  8052cb:	55                   	push   %rbp
+  8052cc:	48 89 e5             	mov    %rsp,%rbp
+  8052cf:	48 83 ec 20          	sub    $0x20,%rsp
+  8052d3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++)
+  8052d7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8052de:	eb 41                	jmp    805321 <fd_alloc+0x56>
+	{
+		fd = INDEX2FD(i);
+  8052e0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8052e3:	c1 e0 0c             	shl    $0xc,%eax
+  8052e6:	48 98                	cltq
+  8052e8:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8052ed:	48 01 d0             	add    %rdx,%rax
+  8052f0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+		if (pageref(fd) == 0)
+  8052f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052f8:	48 89 c7             	mov    %rax,%rdi
+  8052fb:	48 b8 d5 51 80 00 00 	movabs $0x8051d5,%rax
+  805302:	00 00 00 
+  805305:	ff d0                	call   *%rax
+  805307:	85 c0                	test   %eax,%eax
+  805309:	75 12                	jne    80531d <fd_alloc+0x52>
+		{
+			*fd_store = fd;
+  80530b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80530f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805313:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  805316:	b8 00 00 00 00       	mov    $0x0,%eax
+  80531b:	eb 1a                	jmp    805337 <fd_alloc+0x6c>
+	for (i = 0; i < MAXFD; i++)
+  80531d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805321:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  805325:	7e b9                	jle    8052e0 <fd_alloc+0x15>
+		}
+	}
+	*fd_store = 0;
+  805327:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80532b:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  805332:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  805337:	c9                   	leave
+  805338:	c3                   	ret
+
+0000000000805339 <fd_lookup>:
+/**
+ * 检查 fdnum 是否在范围内且已映射，是则 *fd_store 为对应的 Fd 页
+ * 否则返回 -E_INVAL
+ */
+int fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  805339:	55                   	push   %rbp
+  80533a:	48 89 e5             	mov    %rsp,%rbp
+  80533d:	48 83 ec 20          	sub    $0x20,%rsp
+  805341:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805344:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD)
+  805348:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80534c:	78 06                	js     805354 <fd_lookup+0x1b>
+  80534e:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  805352:	7e 07                	jle    80535b <fd_lookup+0x22>
+	{
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisproc->proc_id, fdnum);
+		return -E_INVAL;
+  805354:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805359:	eb 42                	jmp    80539d <fd_lookup+0x64>
+	}
+	fd = INDEX2FD(fdnum);
+  80535b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80535e:	c1 e0 0c             	shl    $0xc,%eax
+  805361:	48 98                	cltq
+  805363:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  805368:	48 01 d0             	add    %rdx,%rax
+  80536b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (pageref(fd) == 0)
+  80536f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805373:	48 89 c7             	mov    %rax,%rdi
+  805376:	48 b8 d5 51 80 00 00 	movabs $0x8051d5,%rax
+  80537d:	00 00 00 
+  805380:	ff d0                	call   *%rax
+  805382:	85 c0                	test   %eax,%eax
+  805384:	75 07                	jne    80538d <fd_lookup+0x54>
+	{
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisproc->proc_id, fdnum);
+		return -E_INVAL;
+  805386:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80538b:	eb 10                	jmp    80539d <fd_lookup+0x64>
+	}
+	*fd_store = fd;
+  80538d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805391:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805395:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  805398:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80539d:	c9                   	leave
+  80539e:	c3                   	ret
+
+000000000080539f <fd_close>:
+/**
+ * 关闭文件描述符 fd 并释放其 Fd 页
+ * must_exist 为 0 时，fd 不是有效的打开文件描述符则直接返回 0；否则返回 fd_lookup 的错误
+ */
+int fd_close(struct Fd *fd, bool must_exist)
+{
+  80539f:	55                   	push   %rbp
+  8053a0:	48 89 e5             	mov    %rsp,%rbp
+  8053a3:	48 83 ec 30          	sub    $0x30,%rsp
+  8053a7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8053ab:	89 f0                	mov    %esi,%eax
+  8053ad:	88 45 d4             	mov    %al,-0x2c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  8053b0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8053b4:	48 89 c7             	mov    %rax,%rdi
+  8053b7:	48 b8 4c 52 80 00 00 	movabs $0x80524c,%rax
+  8053be:	00 00 00 
+  8053c1:	ff d0                	call   *%rax
+  8053c3:	89 c2                	mov    %eax,%edx
+  8053c5:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8053c9:	48 89 c6             	mov    %rax,%rsi
+  8053cc:	89 d7                	mov    %edx,%edi
+  8053ce:	48 b8 39 53 80 00 00 	movabs $0x805339,%rax
+  8053d5:	00 00 00 
+  8053d8:	ff d0                	call   *%rax
+  8053da:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8053dd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8053e1:	78 0a                	js     8053ed <fd_close+0x4e>
+  8053e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053e7:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8053eb:	74 12                	je     8053ff <fd_close+0x60>
+		return (must_exist ? r : 0);
+  8053ed:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  8053f1:	74 05                	je     8053f8 <fd_close+0x59>
+  8053f3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8053f6:	eb 70                	jmp    805468 <fd_close+0xc9>
+  8053f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053fd:	eb 69                	jmp    805468 <fd_close+0xc9>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0)
+  8053ff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805403:	8b 00                	mov    (%rax),%eax
+  805405:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  805409:	48 89 d6             	mov    %rdx,%rsi
+  80540c:	89 c7                	mov    %eax,%edi
+  80540e:	48 b8 6a 54 80 00 00 	movabs $0x80546a,%rax
+  805415:	00 00 00 
+  805418:	ff d0                	call   *%rax
+  80541a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80541d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805421:	78 2a                	js     80544d <fd_close+0xae>
+	{
+		if (dev->dev_close)
+  805423:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805427:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80542b:	48 85 c0             	test   %rax,%rax
+  80542e:	74 16                	je     805446 <fd_close+0xa7>
+			r = (*dev->dev_close)(fd);
+  805430:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805434:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  805438:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80543c:	48 89 c7             	mov    %rax,%rdi
+  80543f:	ff d2                	call   *%rdx
+  805441:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805444:	eb 07                	jmp    80544d <fd_close+0xae>
+		else
+			r = 0;
+  805446:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	}
+	// 此时 fd 可能已被设备释放，再次释放是安全的
+	(void)sys_page_unmap(0, fd);
+  80544d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805451:	48 89 c6             	mov    %rax,%rsi
+  805454:	bf 00 00 00 00       	mov    $0x0,%edi
+  805459:	48 b8 ad 41 80 00 00 	movabs $0x8041ad,%rax
+  805460:	00 00 00 
+  805463:	ff d0                	call   *%rax
+	return r;
+  805465:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805468:	c9                   	leave
+  805469:	c3                   	ret
+
+000000000080546a <dev_lookup>:
+	{
+		&devfile,
+		0};
+
+int dev_lookup(int dev_id, struct Dev **dev)
+{
+  80546a:	55                   	push   %rbp
+  80546b:	48 89 e5             	mov    %rsp,%rbp
+  80546e:	48 83 ec 20          	sub    $0x20,%rsp
+  805472:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805475:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int i;
+
+	for (i = 0; devtab[i]; i++)
+  805479:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805480:	eb 3f                	jmp    8054c1 <dev_lookup+0x57>
+		if (devtab[i]->dev_id == dev_id)
+  805482:	48 ba c0 80 80 00 00 	movabs $0x8080c0,%rdx
+  805489:	00 00 00 
+  80548c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80548f:	48 98                	cltq
+  805491:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  805495:	8b 00                	mov    (%rax),%eax
+  805497:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80549a:	75 21                	jne    8054bd <dev_lookup+0x53>
+		{
+			*dev = devtab[i];
+  80549c:	48 ba c0 80 80 00 00 	movabs $0x8080c0,%rdx
+  8054a3:	00 00 00 
+  8054a6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8054a9:	48 98                	cltq
+  8054ab:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8054af:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054b3:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  8054b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054bb:	eb 62                	jmp    80551f <dev_lookup+0xb5>
+	for (i = 0; devtab[i]; i++)
+  8054bd:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8054c1:	48 ba c0 80 80 00 00 	movabs $0x8080c0,%rdx
+  8054c8:	00 00 00 
+  8054cb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8054ce:	48 98                	cltq
+  8054d0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8054d4:	48 85 c0             	test   %rax,%rax
+  8054d7:	75 a9                	jne    805482 <dev_lookup+0x18>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisproc->proc_id, dev_id);
+  8054d9:	48 b8 70 30 81 00 00 	movabs $0x813070,%rax
+  8054e0:	00 00 00 
+  8054e3:	48 8b 00             	mov    (%rax),%rax
+  8054e6:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8054ec:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8054ef:	89 c6                	mov    %eax,%esi
+  8054f1:	48 b8 30 65 80 00 00 	movabs $0x806530,%rax
+  8054f8:	00 00 00 
+  8054fb:	48 89 c7             	mov    %rax,%rdi
+  8054fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  805503:	48 b9 0f 28 80 00 00 	movabs $0x80280f,%rcx
+  80550a:	00 00 00 
+  80550d:	ff d1                	call   *%rcx
+	*dev = 0;
+  80550f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805513:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  80551a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80551f:	c9                   	leave
+  805520:	c3                   	ret
+
+0000000000805521 <close>:
+
+int close(int fdnum)
+{
+  805521:	55                   	push   %rbp
+  805522:	48 89 e5             	mov    %rsp,%rbp
+  805525:	48 83 ec 20          	sub    $0x20,%rsp
+  805529:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80552c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805530:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805533:	48 89 d6             	mov    %rdx,%rsi
+  805536:	89 c7                	mov    %eax,%edi
+  805538:	48 b8 39 53 80 00 00 	movabs $0x805339,%rax
+  80553f:	00 00 00 
+  805542:	ff d0                	call   *%rax
+  805544:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805547:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80554b:	79 05                	jns    805552 <close+0x31>
+		return r;
+  80554d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805550:	eb 18                	jmp    80556a <close+0x49>
+	else
+		return fd_close(fd, 1);
+  805552:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805556:	be 01 00 00 00       	mov    $0x1,%esi
+  80555b:	48 89 c7             	mov    %rax,%rdi
+  80555e:	48 b8 9f 53 80 00 00 	movabs $0x80539f,%rax
+  805565:	00 00 00 
+  805568:	ff d0                	call   *%rax
+}
+  80556a:	c9                   	leave
+  80556b:	c3                   	ret
+
+000000000080556c <close_all>:
+
+void close_all(void)
+{
+  80556c:	55                   	push   %rbp
+  80556d:	48 89 e5             	mov    %rsp,%rbp
+  805570:	48 83 ec 10          	sub    $0x10,%rsp
+	int i;
+
+	for (i = 0; i < MAXFD; i++)
+  805574:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80557b:	eb 15                	jmp    805592 <close_all+0x26>
+		close(i);
+  80557d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805580:	89 c7                	mov    %eax,%edi
+  805582:	48 b8 21 55 80 00 00 	movabs $0x805521,%rax
+  805589:	00 00 00 
+  80558c:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  80558e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805592:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  805596:	7e e5                	jle    80557d <close_all+0x11>
+}
+  805598:	90                   	nop
+  805599:	90                   	nop
+  80559a:	c9                   	leave
+  80559b:	c3                   	ret
+
+000000000080559c <dup>:
+/**
+ * 将 oldfdnum 复制为 newfdnum(先关闭 newfdnum)
+ * 复制的两个文件描述符共享 Fd 页和数据窗口
+ */
+int dup(int oldfdnum, int newfdnum)
+{
+  80559c:	55                   	push   %rbp
+  80559d:	48 89 e5             	mov    %rsp,%rbp
+  8055a0:	48 83 ec 60          	sub    $0x60,%rsp
+  8055a4:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  8055a7:	89 75 a8             	mov    %esi,-0x58(%rbp)
+	int r;
+	char *ova, *nva;
+	uintptr_t off;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8055aa:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+  8055ae:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8055b1:	48 89 d6             	mov    %rdx,%rsi
+  8055b4:	89 c7                	mov    %eax,%edi
+  8055b6:	48 b8 39 53 80 00 00 	movabs $0x805339,%rax
+  8055bd:	00 00 00 
+  8055c0:	ff d0                	call   *%rax
+  8055c2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8055c5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8055c9:	79 08                	jns    8055d3 <dup+0x37>
+		return r;
+  8055cb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8055ce:	e9 1d 02 00 00       	jmp    8057f0 <dup+0x254>
+	close(newfdnum);
+  8055d3:	8b 45 a8             	mov    -0x58(%rbp),%eax
+  8055d6:	89 c7                	mov    %eax,%edi
+  8055d8:	48 b8 21 55 80 00 00 	movabs $0x805521,%rax
+  8055df:	00 00 00 
+  8055e2:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  8055e4:	8b 45 a8             	mov    -0x58(%rbp),%eax
+  8055e7:	c1 e0 0c             	shl    $0xc,%eax
+  8055ea:	48 98                	cltq
+  8055ec:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8055f1:	48 01 d0             	add    %rdx,%rax
+  8055f4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	ova = fd2data(oldfd);
+  8055f8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8055fc:	48 89 c7             	mov    %rax,%rdi
+  8055ff:	48 b8 6f 52 80 00 00 	movabs $0x80526f,%rax
+  805606:	00 00 00 
+  805609:	ff d0                	call   *%rax
+  80560b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	nva = fd2data(newfd);
+  80560f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805613:	48 89 c7             	mov    %rax,%rdi
+  805616:	48 b8 6f 52 80 00 00 	movabs $0x80526f,%rax
+  80561d:	00 00 00 
+  805620:	ff d0                	call   *%rax
+  805622:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+	for (off = 0; off < FILEWINDOW; off += PGSIZE)
+  805626:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80562d:	00 
+  80562e:	e9 8f 00 00 00       	jmp    8056c2 <dup+0x126>
+		if (va_is_mapped(ova + off))
+  805633:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805637:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80563b:	48 01 d0             	add    %rdx,%rax
+  80563e:	48 89 c7             	mov    %rax,%rdi
+  805641:	48 b8 34 51 80 00 00 	movabs $0x805134,%rax
+  805648:	00 00 00 
+  80564b:	ff d0                	call   *%rax
+  80564d:	84 c0                	test   %al,%al
+  80564f:	74 69                	je     8056ba <dup+0x11e>
+			if ((r = sys_page_map(0, ova + off, 0, nva + off,
+								  uvpt[VPN(ova + off)] & PTE_SYSCALL)) < 0)
+  805651:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805655:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805659:	48 01 d0             	add    %rdx,%rax
+  80565c:	48 c1 e8 0c          	shr    $0xc,%rax
+  805660:	48 89 c2             	mov    %rax,%rdx
+  805663:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80566a:	01 00 00 
+  80566d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+			if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  805671:	25 07 0e 00 00       	and    $0xe07,%eax
+  805676:	89 c6                	mov    %eax,%esi
+  805678:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80567c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805680:	48 01 c2             	add    %rax,%rdx
+  805683:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805687:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80568b:	48 01 c8             	add    %rcx,%rax
+  80568e:	41 89 f0             	mov    %esi,%r8d
+  805691:	48 89 d1             	mov    %rdx,%rcx
+  805694:	ba 00 00 00 00       	mov    $0x0,%edx
+  805699:	48 89 c6             	mov    %rax,%rsi
+  80569c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056a1:	48 b8 4d 41 80 00 00 	movabs $0x80414d,%rax
+  8056a8:	00 00 00 
+  8056ab:	ff d0                	call   *%rax
+  8056ad:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8056b0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8056b4:	0f 88 96 00 00 00    	js     805750 <dup+0x1b4>
+	for (off = 0; off < FILEWINDOW; off += PGSIZE)
+  8056ba:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  8056c1:	00 
+  8056c2:	48 c7 45 d0 00 00 20 	movq   $0x200000,-0x30(%rbp)
+  8056c9:	00 
+  8056ca:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8056ce:	48 05 ff 9f 40 00    	add    $0x409fff,%rax
+  8056d4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8056d8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8056dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8056e1:	48 f7 75 d0          	divq   -0x30(%rbp)
+  8056e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8056e9:	48 29 d0             	sub    %rdx,%rax
+  8056ec:	48 98                	cltq
+  8056ee:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8056f2:	0f 82 3b ff ff ff    	jb     805633 <dup+0x97>
+				goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[VPN(oldfd)] & PTE_SYSCALL)) < 0)
+  8056f8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8056fc:	48 c1 e8 0c          	shr    $0xc,%rax
+  805700:	48 89 c2             	mov    %rax,%rdx
+  805703:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80570a:	01 00 00 
+  80570d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805711:	25 07 0e 00 00       	and    $0xe07,%eax
+  805716:	89 c1                	mov    %eax,%ecx
+  805718:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80571c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805720:	41 89 c8             	mov    %ecx,%r8d
+  805723:	48 89 d1             	mov    %rdx,%rcx
+  805726:	ba 00 00 00 00       	mov    $0x0,%edx
+  80572b:	48 89 c6             	mov    %rax,%rsi
+  80572e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805733:	48 b8 4d 41 80 00 00 	movabs $0x80414d,%rax
+  80573a:	00 00 00 
+  80573d:	ff d0                	call   *%rax
+  80573f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805742:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805746:	78 0b                	js     805753 <dup+0x1b7>
+		goto err;
+
+	return newfdnum;
+  805748:	8b 45 a8             	mov    -0x58(%rbp),%eax
+  80574b:	e9 a0 00 00 00       	jmp    8057f0 <dup+0x254>
+				goto err;
+  805750:	90                   	nop
+  805751:	eb 01                	jmp    805754 <dup+0x1b8>
+		goto err;
+  805753:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  805754:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805758:	48 89 c6             	mov    %rax,%rsi
+  80575b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805760:	48 b8 ad 41 80 00 00 	movabs $0x8041ad,%rax
+  805767:	00 00 00 
+  80576a:	ff d0                	call   *%rax
+	for (off = 0; off < FILEWINDOW; off += PGSIZE)
+  80576c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  805773:	00 
+  805774:	eb 45                	jmp    8057bb <dup+0x21f>
+		if (va_is_mapped(nva + off))
+  805776:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80577a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80577e:	48 01 d0             	add    %rdx,%rax
+  805781:	48 89 c7             	mov    %rax,%rdi
+  805784:	48 b8 34 51 80 00 00 	movabs $0x805134,%rax
+  80578b:	00 00 00 
+  80578e:	ff d0                	call   *%rax
+  805790:	84 c0                	test   %al,%al
+  805792:	74 1f                	je     8057b3 <dup+0x217>
+			sys_page_unmap(0, nva + off);
+  805794:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805798:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80579c:	48 01 d0             	add    %rdx,%rax
+  80579f:	48 89 c6             	mov    %rax,%rsi
+  8057a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057a7:	48 b8 ad 41 80 00 00 	movabs $0x8041ad,%rax
+  8057ae:	00 00 00 
+  8057b1:	ff d0                	call   *%rax
+	for (off = 0; off < FILEWINDOW; off += PGSIZE)
+  8057b3:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  8057ba:	00 
+  8057bb:	48 c7 45 c0 00 00 20 	movq   $0x200000,-0x40(%rbp)
+  8057c2:	00 
+  8057c3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8057c7:	48 05 ff 9f 40 00    	add    $0x409fff,%rax
+  8057cd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8057d1:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8057d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8057da:	48 f7 75 c0          	divq   -0x40(%rbp)
+  8057de:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8057e2:	48 29 d0             	sub    %rdx,%rax
+  8057e5:	48 98                	cltq
+  8057e7:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8057eb:	72 89                	jb     805776 <dup+0x1da>
+	return r;
+  8057ed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8057f0:	c9                   	leave
+  8057f1:	c3                   	ret
+
+00000000008057f2 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8057f2:	55                   	push   %rbp
+  8057f3:	48 89 e5             	mov    %rsp,%rbp
+  8057f6:	48 83 ec 40          	sub    $0x40,%rsp
+  8057fa:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8057fd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805801:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  805805:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  805809:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80580c:	48 89 d6             	mov    %rdx,%rsi
+  80580f:	89 c7                	mov    %eax,%edi
+  805811:	48 b8 39 53 80 00 00 	movabs $0x805339,%rax
+  805818:	00 00 00 
+  80581b:	ff d0                	call   *%rax
+  80581d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805820:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805824:	78 24                	js     80584a <read+0x58>
+  805826:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80582a:	8b 00                	mov    (%rax),%eax
+  80582c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805830:	48 89 d6             	mov    %rdx,%rsi
+  805833:	89 c7                	mov    %eax,%edi
+  805835:	48 b8 6a 54 80 00 00 	movabs $0x80546a,%rax
+  80583c:	00 00 00 
+  80583f:	ff d0                	call   *%rax
+  805841:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805844:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805848:	79 05                	jns    80584f <read+0x5d>
+		return r;
+  80584a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80584d:	eb 7d                	jmp    8058cc <read+0xda>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  80584f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805853:	8b 40 08             	mov    0x8(%rax),%eax
+  805856:	83 e0 03             	and    $0x3,%eax
+  805859:	83 f8 01             	cmp    $0x1,%eax
+  80585c:	75 3d                	jne    80589b <read+0xa9>
+	{
+		cprintf("[%08x] read %d -- bad mode\n", thisproc->proc_id, fdnum);
+  80585e:	48 b8 70 30 81 00 00 	movabs $0x813070,%rax
+  805865:	00 00 00 
+  805868:	48 8b 00             	mov    (%rax),%rax
+  80586b:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805871:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805874:	89 c6                	mov    %eax,%esi
+  805876:	48 b8 4f 65 80 00 00 	movabs $0x80654f,%rax
+  80587d:	00 00 00 
+  805880:	48 89 c7             	mov    %rax,%rdi
+  805883:	b8 00 00 00 00       	mov    $0x0,%eax
+  805888:	48 b9 0f 28 80 00 00 	movabs $0x80280f,%rcx
+  80588f:	00 00 00 
+  805892:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  805894:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805899:	eb 31                	jmp    8058cc <read+0xda>
+	}
+	if (!dev->dev_read)
+  80589b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80589f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8058a3:	48 85 c0             	test   %rax,%rax
+  8058a6:	75 07                	jne    8058af <read+0xbd>
+		return -E_NOT_SUPP;
+  8058a8:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8058ad:	eb 1d                	jmp    8058cc <read+0xda>
+	return (*dev->dev_read)(fd, buf, n);
+  8058af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8058b3:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8058b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8058bb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8058bf:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8058c3:	48 89 ce             	mov    %rcx,%rsi
+  8058c6:	48 89 c7             	mov    %rax,%rdi
+  8058c9:	41 ff d0             	call   *%r8
+}
+  8058cc:	c9                   	leave
+  8058cd:	c3                   	ret
+
+00000000008058ce <readn>:
+
+// 读满 n 字节，或遇到文件末尾/错误为止
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8058ce:	55                   	push   %rbp
+  8058cf:	48 89 e5             	mov    %rsp,%rbp
+  8058d2:	48 83 ec 30          	sub    $0x30,%rsp
+  8058d6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8058d9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8058dd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m)
+  8058e1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8058e8:	eb 47                	jmp    805931 <readn+0x63>
+	{
+		m = read(fdnum, (char *)buf + tot, n - tot);
+  8058ea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8058ed:	48 98                	cltq
+  8058ef:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8058f3:	48 29 c2             	sub    %rax,%rdx
+  8058f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8058f9:	48 63 c8             	movslq %eax,%rcx
+  8058fc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805900:	48 01 c1             	add    %rax,%rcx
+  805903:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805906:	48 89 ce             	mov    %rcx,%rsi
+  805909:	89 c7                	mov    %eax,%edi
+  80590b:	48 b8 f2 57 80 00 00 	movabs $0x8057f2,%rax
+  805912:	00 00 00 
+  805915:	ff d0                	call   *%rax
+  805917:	89 45 f8             	mov    %eax,-0x8(%rbp)
+		if (m < 0)
+  80591a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80591e:	79 05                	jns    805925 <readn+0x57>
+			return m;
+  805920:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805923:	eb 1d                	jmp    805942 <readn+0x74>
+		if (m == 0)
+  805925:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805929:	74 13                	je     80593e <readn+0x70>
+	for (tot = 0; tot < n; tot += m)
+  80592b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80592e:	01 45 fc             	add    %eax,-0x4(%rbp)
+  805931:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805934:	48 98                	cltq
+  805936:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80593a:	72 ae                	jb     8058ea <readn+0x1c>
+  80593c:	eb 01                	jmp    80593f <readn+0x71>
+			break;
+  80593e:	90                   	nop
+	}
+	return tot;
+  80593f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805942:	c9                   	leave
+  805943:	c3                   	ret
+
+0000000000805944 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  805944:	55                   	push   %rbp
+  805945:	48 89 e5             	mov    %rsp,%rbp
+  805948:	48 83 ec 40          	sub    $0x40,%rsp
+  80594c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80594f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805953:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  805957:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80595b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80595e:	48 89 d6             	mov    %rdx,%rsi
+  805961:	89 c7                	mov    %eax,%edi
+  805963:	48 b8 39 53 80 00 00 	movabs $0x805339,%rax
+  80596a:	00 00 00 
+  80596d:	ff d0                	call   *%rax
+  80596f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805972:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805976:	78 24                	js     80599c <write+0x58>
+  805978:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80597c:	8b 00                	mov    (%rax),%eax
+  80597e:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805982:	48 89 d6             	mov    %rdx,%rsi
+  805985:	89 c7                	mov    %eax,%edi
+  805987:	48 b8 6a 54 80 00 00 	movabs $0x80546a,%rax
+  80598e:	00 00 00 
+  805991:	ff d0                	call   *%rax
+  805993:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805996:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80599a:	79 05                	jns    8059a1 <write+0x5d>
+		return r;
+  80599c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80599f:	eb 7c                	jmp    805a1d <write+0xd9>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8059a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8059a5:	8b 40 08             	mov    0x8(%rax),%eax
+  8059a8:	83 e0 03             	and    $0x3,%eax
+  8059ab:	85 c0                	test   %eax,%eax
+  8059ad:	75 3d                	jne    8059ec <write+0xa8>
+	{
+		cprintf("[%08x] write %d -- bad mode\n", thisproc->proc_id, fdnum);
+  8059af:	48 b8 70 30 81 00 00 	movabs $0x813070,%rax
+  8059b6:	00 00 00 
+  8059b9:	48 8b 00             	mov    (%rax),%rax
+  8059bc:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8059c2:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8059c5:	89 c6                	mov    %eax,%esi
+  8059c7:	48 b8 6b 65 80 00 00 	movabs $0x80656b,%rax
+  8059ce:	00 00 00 
+  8059d1:	48 89 c7             	mov    %rax,%rdi
+  8059d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059d9:	48 b9 0f 28 80 00 00 	movabs $0x80280f,%rcx
+  8059e0:	00 00 00 
+  8059e3:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8059e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8059ea:	eb 31                	jmp    805a1d <write+0xd9>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+				fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8059ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059f0:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8059f4:	48 85 c0             	test   %rax,%rax
+  8059f7:	75 07                	jne    805a00 <write+0xbc>
+		return -E_NOT_SUPP;
+  8059f9:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8059fe:	eb 1d                	jmp    805a1d <write+0xd9>
+	return (*dev->dev_write)(fd, buf, n);
+  805a00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a04:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  805a08:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805a0c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805a10:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805a14:	48 89 ce             	mov    %rcx,%rsi
+  805a17:	48 89 c7             	mov    %rax,%rdi
+  805a1a:	41 ff d0             	call   *%r8
+}
+  805a1d:	c9                   	leave
+  805a1e:	c3                   	ret
+
+0000000000805a1f <seek>:
+
+int seek(int fdnum, off_t offset)
+{
+  805a1f:	55                   	push   %rbp
+  805a20:	48 89 e5             	mov    %rsp,%rbp
+  805a23:	48 83 ec 20          	sub    $0x20,%rsp
+  805a27:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805a2a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805a2d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805a31:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a34:	48 89 d6             	mov    %rdx,%rsi
+  805a37:	89 c7                	mov    %eax,%edi
+  805a39:	48 b8 39 53 80 00 00 	movabs $0x805339,%rax
+  805a40:	00 00 00 
+  805a43:	ff d0                	call   *%rax
+  805a45:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805a48:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805a4c:	79 05                	jns    805a53 <seek+0x34>
+		return r;
+  805a4e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a51:	eb 0f                	jmp    805a62 <seek+0x43>
+	fd->fd_offset = offset;
+  805a53:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a57:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805a5a:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  805a5d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805a62:	c9                   	leave
+  805a63:	c3                   	ret
+
+0000000000805a64 <ftruncate>:
+
+int ftruncate(int fdnum, off_t newsize)
+{
+  805a64:	55                   	push   %rbp
+  805a65:	48 89 e5             	mov    %rsp,%rbp
+  805a68:	48 83 ec 30          	sub    $0x30,%rsp
+  805a6c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805a6f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  805a72:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  805a76:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805a79:	48 89 d6             	mov    %rdx,%rsi
+  805a7c:	89 c7                	mov    %eax,%edi
+  805a7e:	48 b8 39 53 80 00 00 	movabs $0x805339,%rax
+  805a85:	00 00 00 
+  805a88:	ff d0                	call   *%rax
+  805a8a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805a8d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805a91:	78 24                	js     805ab7 <ftruncate+0x53>
+  805a93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805a97:	8b 00                	mov    (%rax),%eax
+  805a99:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805a9d:	48 89 d6             	mov    %rdx,%rsi
+  805aa0:	89 c7                	mov    %eax,%edi
+  805aa2:	48 b8 6a 54 80 00 00 	movabs $0x80546a,%rax
+  805aa9:	00 00 00 
+  805aac:	ff d0                	call   *%rax
+  805aae:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805ab1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805ab5:	79 05                	jns    805abc <ftruncate+0x58>
+		return r;
+  805ab7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805aba:	eb 75                	jmp    805b31 <ftruncate+0xcd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  805abc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ac0:	8b 40 08             	mov    0x8(%rax),%eax
+  805ac3:	83 e0 03             	and    $0x3,%eax
+  805ac6:	85 c0                	test   %eax,%eax
+  805ac8:	75 3d                	jne    805b07 <ftruncate+0xa3>
+	{
+		cprintf("[%08x] ftruncate %d -- bad mode\n", thisproc->proc_id, fdnum);
+  805aca:	48 b8 70 30 81 00 00 	movabs $0x813070,%rax
+  805ad1:	00 00 00 
+  805ad4:	48 8b 00             	mov    (%rax),%rax
+  805ad7:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805add:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805ae0:	89 c6                	mov    %eax,%esi
+  805ae2:	48 b8 88 65 80 00 00 	movabs $0x806588,%rax
+  805ae9:	00 00 00 
+  805aec:	48 89 c7             	mov    %rax,%rdi
+  805aef:	b8 00 00 00 00       	mov    $0x0,%eax
+  805af4:	48 b9 0f 28 80 00 00 	movabs $0x80280f,%rcx
+  805afb:	00 00 00 
+  805afe:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  805b00:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805b05:	eb 2a                	jmp    805b31 <ftruncate+0xcd>
+	}
+	if (!dev->dev_trunc)
+  805b07:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805b0b:	48 8b 40 30          	mov    0x30(%rax),%rax
+  805b0f:	48 85 c0             	test   %rax,%rax
+  805b12:	75 07                	jne    805b1b <ftruncate+0xb7>
+		return -E_NOT_SUPP;
+  805b14:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  805b19:	eb 16                	jmp    805b31 <ftruncate+0xcd>
+	return (*dev->dev_trunc)(fd, newsize);
+  805b1b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805b1f:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  805b23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b27:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805b2a:	89 d6                	mov    %edx,%esi
+  805b2c:	48 89 c7             	mov    %rax,%rdi
+  805b2f:	ff d1                	call   *%rcx
+}
+  805b31:	c9                   	leave
+  805b32:	c3                   	ret
+
+0000000000805b33 <fstat>:
+
+int fstat(int fdnum, struct Stat *stat)
+{
+  805b33:	55                   	push   %rbp
+  805b34:	48 89 e5             	mov    %rsp,%rbp
+  805b37:	48 83 ec 30          	sub    $0x30,%rsp
+  805b3b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805b3e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  805b42:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  805b46:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805b49:	48 89 d6             	mov    %rdx,%rsi
+  805b4c:	89 c7                	mov    %eax,%edi
+  805b4e:	48 b8 39 53 80 00 00 	movabs $0x805339,%rax
+  805b55:	00 00 00 
+  805b58:	ff d0                	call   *%rax
+  805b5a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805b5d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805b61:	78 24                	js     805b87 <fstat+0x54>
+  805b63:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b67:	8b 00                	mov    (%rax),%eax
+  805b69:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805b6d:	48 89 d6             	mov    %rdx,%rsi
+  805b70:	89 c7                	mov    %eax,%edi
+  805b72:	48 b8 6a 54 80 00 00 	movabs $0x80546a,%rax
+  805b79:	00 00 00 
+  805b7c:	ff d0                	call   *%rax
+  805b7e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805b81:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805b85:	79 05                	jns    805b8c <fstat+0x59>
+		return r;
+  805b87:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b8a:	eb 5e                	jmp    805bea <fstat+0xb7>
+	if (!dev->dev_stat)
+  805b8c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805b90:	48 8b 40 28          	mov    0x28(%rax),%rax
+  805b94:	48 85 c0             	test   %rax,%rax
+  805b97:	75 07                	jne    805ba0 <fstat+0x6d>
+		return -E_NOT_SUPP;
+  805b99:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  805b9e:	eb 4a                	jmp    805bea <fstat+0xb7>
+	stat->st_name[0] = 0;
+  805ba0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805ba4:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  805ba7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805bab:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  805bb2:	00 00 00 
+	stat->st_isdir = 0;
+  805bb5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805bb9:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805bc0:	00 00 00 
+	stat->st_dev = dev;
+  805bc3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805bc7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805bcb:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  805bd2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805bd6:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  805bda:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805bde:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805be2:	48 89 d6             	mov    %rdx,%rsi
+  805be5:	48 89 c7             	mov    %rax,%rdi
+  805be8:	ff d1                	call   *%rcx
+}
+  805bea:	c9                   	leave
+  805beb:	c3                   	ret
+
+0000000000805bec <stat>:
+
+int stat(const char *path, struct Stat *stat)
+{
+  805bec:	55                   	push   %rbp
+  805bed:	48 89 e5             	mov    %rsp,%rbp
+  805bf0:	48 83 ec 20          	sub    $0x20,%rsp
+  805bf4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805bf8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  805bfc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c00:	be 00 00 00 00       	mov    $0x0,%esi
+  805c05:	48 89 c7             	mov    %rax,%rdi
+  805c08:	48 b8 10 4a 80 00 00 	movabs $0x804a10,%rax
+  805c0f:	00 00 00 
+  805c12:	ff d0                	call   *%rax
+  805c14:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805c17:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805c1b:	79 05                	jns    805c22 <stat+0x36>
+		return fd;
+  805c1d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c20:	eb 2f                	jmp    805c51 <stat+0x65>
+	r = fstat(fd, stat);
+  805c22:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805c26:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c29:	48 89 d6             	mov    %rdx,%rsi
+  805c2c:	89 c7                	mov    %eax,%edi
+  805c2e:	48 b8 33 5b 80 00 00 	movabs $0x805b33,%rax
+  805c35:	00 00 00 
+  805c38:	ff d0                	call   *%rax
+  805c3a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+	close(fd);
+  805c3d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c40:	89 c7                	mov    %eax,%edi
+  805c42:	48 b8 21 55 80 00 00 	movabs $0x805521,%rax
+  805c49:	00 00 00 
+  805c4c:	ff d0                	call   *%rax
+	return r;
+  805c4e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  805c51:	c9                   	leave
+  805c52:	c3                   	ret
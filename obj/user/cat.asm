@@ -0,0 +1,5851 @@
+
+obj/user/cat.debug:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// entrypoint - 当最初被加载到一个新的环境中时，内核(或者父环境)在这里开始运行.
+.text
+.globl _start
+_start:
+	// 判断是否从栈上的参数开始初始化
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	// $USTACKTOP != %rsp 说明有参数，跳转到 args_exist
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// 如果不是(新环境被内核加载的时候)，则 push 伪造的 argc, argv 参数
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 6f 01 00 00       	call   8001b0 <libmain>
+
+// 不应该返回
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <cat>:
+#include "inc/lib.h"
+
+char buf[8192];
+
+void cat(const char *path)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	48 83 ec 20          	sub    $0x20,%rsp
+  80004b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int fd;
+	ssize_t n;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80004f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800053:	be 00 00 00 00       	mov    $0x0,%esi
+  800058:	48 89 c7             	mov    %rax,%rdi
+  80005b:	48 b8 80 2c 80 00 00 	movabs $0x802c80,%rax
+  800062:	00 00 00 
+  800065:	ff d0                	call   *%rax
+  800067:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80006a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80006e:	79 4e                	jns    8000be <cat+0x7b>
+	{
+		cprintf("cat: open %s: %e\n", path, fd);
+  800070:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800073:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800077:	48 89 c6             	mov    %rax,%rsi
+  80007a:	48 b8 c0 37 80 00 00 	movabs $0x8037c0,%rax
+  800081:	00 00 00 
+  800084:	48 89 c7             	mov    %rax,%rdi
+  800087:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008c:	48 b9 6e 03 80 00 00 	movabs $0x80036e,%rcx
+  800093:	00 00 00 
+  800096:	ff d1                	call   *%rcx
+		return;
+  800098:	e9 8c 00 00 00       	jmp    800129 <cat+0xe6>
+	}
+	while ((n = read(fd, buf, sizeof(buf))) > 0)
+		sys_cputs(buf, n);
+  80009d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8000a0:	48 98                	cltq
+  8000a2:	48 89 c6             	mov    %rax,%rsi
+  8000a5:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8000ac:	00 00 00 
+  8000af:	48 89 c7             	mov    %rax,%rdi
+  8000b2:	48 b8 12 1b 80 00 00 	movabs $0x801b12,%rax
+  8000b9:	00 00 00 
+  8000bc:	ff d0                	call   *%rax
+	while ((n = read(fd, buf, sizeof(buf))) > 0)
+  8000be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000c1:	ba 00 20 00 00       	mov    $0x2000,%edx
+  8000c6:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  8000cd:	00 00 00 
+  8000d0:	48 89 ce             	mov    %rcx,%rsi
+  8000d3:	89 c7                	mov    %eax,%edi
+  8000d5:	48 b8 98 27 80 00 00 	movabs $0x802798,%rax
+  8000dc:	00 00 00 
+  8000df:	ff d0                	call   *%rax
+  8000e1:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8000e4:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8000e8:	7f b3                	jg     80009d <cat+0x5a>
+	if (n < 0)
+  8000ea:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8000ee:	79 28                	jns    800118 <cat+0xd5>
+		cprintf("cat: read %s: %e\n", path, n);
+  8000f0:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8000f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8000f7:	48 89 c6             	mov    %rax,%rsi
+  8000fa:	48 b8 d2 37 80 00 00 	movabs $0x8037d2,%rax
+  800101:	00 00 00 
+  800104:	48 89 c7             	mov    %rax,%rdi
+  800107:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010c:	48 b9 6e 03 80 00 00 	movabs $0x80036e,%rcx
+  800113:	00 00 00 
+  800116:	ff d1                	call   *%rcx
+	close(fd);
+  800118:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80011b:	89 c7                	mov    %eax,%edi
+  80011d:	48 b8 c7 24 80 00 00 	movabs $0x8024c7,%rax
+  800124:	00 00 00 
+  800127:	ff d0                	call   *%rax
+}
+  800129:	c9                   	leave
+  80012a:	c3                   	ret
+
+000000000080012b <umain>:
+
+void umain(int argc, char **argv)
+{
+  80012b:	55                   	push   %rbp
+  80012c:	48 89 e5             	mov    %rsp,%rbp
+  80012f:	48 83 ec 20          	sub    $0x20,%rsp
+  800133:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800136:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int i;
+
+	binaryname = "cat";
+  80013a:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800141:	00 00 00 
+  800144:	48 b9 e4 37 80 00 00 	movabs $0x8037e4,%rcx
+  80014b:	00 00 00 
+  80014e:	48 89 08             	mov    %rcx,(%rax)
+	if (argc < 2)
+  800151:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+  800155:	7f 1b                	jg     800172 <umain+0x47>
+		cat("/motd");
+  800157:	48 b8 e8 37 80 00 00 	movabs $0x8037e8,%rax
+  80015e:	00 00 00 
+  800161:	48 89 c7             	mov    %rax,%rdi
+  800164:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  80016b:	00 00 00 
+  80016e:	ff d0                	call   *%rax
+	else
+		for (i = 1; i < argc; i++)
+			cat(argv[i]);
+}
+  800170:	eb 3b                	jmp    8001ad <umain+0x82>
+		for (i = 1; i < argc; i++)
+  800172:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  800179:	eb 2a                	jmp    8001a5 <umain+0x7a>
+			cat(argv[i]);
+  80017b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80017e:	48 98                	cltq
+  800180:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800187:	00 
+  800188:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80018c:	48 01 d0             	add    %rdx,%rax
+  80018f:	48 8b 00             	mov    (%rax),%rax
+  800192:	48 89 c7             	mov    %rax,%rdi
+  800195:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  80019c:	00 00 00 
+  80019f:	ff d0                	call   *%rax
+		for (i = 1; i < argc; i++)
+  8001a1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8001a5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8001a8:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+  8001ab:	7c ce                	jl     80017b <umain+0x50>
+}
+  8001ad:	90                   	nop
+  8001ae:	c9                   	leave
+  8001af:	c3                   	ret
+
+00000000008001b0 <libmain>:
+
+/**
+ *  用户环境从lib/libmain.c中的函数libmain开始执行，这个函数进而调用umain，用户写的程序入口只能是umain
+ */
+void libmain(int argc, char **argv)
+{
+  8001b0:	55                   	push   %rbp
+  8001b1:	48 89 e5             	mov    %rsp,%rbp
+  8001b4:	48 83 ec 10          	sub    $0x10,%rsp
+  8001b8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8001bb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 设置常量 thisproc 指向 procs[] 中当前环境的 Env 结构，ENVX 确保环境 id 未超过了 NENV
+	// thisproc 指向当前环境的 Env 结构
+	thisproc = &procs[ENVX(sys_getprocid())];
+  8001bf:	48 b8 e1 1b 80 00 00 	movabs $0x801be1,%rax
+  8001c6:	00 00 00 
+  8001c9:	ff d0                	call   *%rax
+  8001cb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001d0:	48 98                	cltq
+  8001d2:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  8001d9:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  8001e0:	00 00 00 
+  8001e3:	48 01 c2             	add    %rax,%rdx
+  8001e6:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8001ed:	00 00 00 
+  8001f0:	48 89 10             	mov    %rdx,(%rax)
+
+	// 通过 CPUID 选择 memset/memmove/memcpy 的实现
+	mem_init();
+  8001f3:	48 b8 89 12 80 00 00 	movabs $0x801289,%rax
+  8001fa:	00 00 00 
+  8001fd:	ff d0                	call   *%rax
+
+	// 为了能让panic()提示用户错误，存储程序的名称
+	if (argc > 0)
+  8001ff:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800203:	7e 14                	jle    800219 <libmain+0x69>
+		binaryname = argv[0];
+  800205:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800209:	48 8b 00             	mov    (%rax),%rax
+  80020c:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800213:	00 00 00 
+  800216:	48 89 02             	mov    %rax,(%rdx)
+
+	// 调用用户的主程序
+	umain(argc, argv);
+  800219:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80021d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800220:	48 89 d6             	mov    %rdx,%rsi
+  800223:	89 c7                	mov    %eax,%edi
+  800225:	48 b8 2b 01 80 00 00 	movabs $0x80012b,%rax
+  80022c:	00 00 00 
+  80022f:	ff d0                	call   *%rax
+
+	// 退出当前环境，env_destroy
+	sys_env_destroy(0);
+  800231:	bf 00 00 00 00       	mov    $0x0,%edi
+  800236:	48 b8 9b 1b 80 00 00 	movabs $0x801b9b,%rax
+  80023d:	00 00 00 
+  800240:	ff d0                	call   *%rax
+}
+  800242:	90                   	nop
+  800243:	c9                   	leave
+  800244:	c3                   	ret
+
+0000000000800245 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800245:	55                   	push   %rbp
+  800246:	48 89 e5             	mov    %rsp,%rbp
+  800249:	48 83 ec 10          	sub    $0x10,%rsp
+  80024d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800250:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->buf[b->idx++] = ch;
+  800254:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800258:	8b 00                	mov    (%rax),%eax
+  80025a:	8d 48 01             	lea    0x1(%rax),%ecx
+  80025d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800261:	89 0a                	mov    %ecx,(%rdx)
+  800263:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800266:	89 d1                	mov    %edx,%ecx
+  800268:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80026c:	48 98                	cltq
+  80026e:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+	if (b->idx == 256-1) {
+  800272:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800276:	8b 00                	mov    (%rax),%eax
+  800278:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80027d:	75 2c                	jne    8002ab <putch+0x66>
+		sys_cputs(b->buf, b->idx);
+  80027f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800283:	8b 00                	mov    (%rax),%eax
+  800285:	48 98                	cltq
+  800287:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80028b:	48 83 c2 08          	add    $0x8,%rdx
+  80028f:	48 89 c6             	mov    %rax,%rsi
+  800292:	48 89 d7             	mov    %rdx,%rdi
+  800295:	48 b8 12 1b 80 00 00 	movabs $0x801b12,%rax
+  80029c:	00 00 00 
+  80029f:	ff d0                	call   *%rax
+		b->idx = 0;
+  8002a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002a5:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	}
+	b->cnt++;
+  8002ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002af:	8b 40 04             	mov    0x4(%rax),%eax
+  8002b2:	8d 50 01             	lea    0x1(%rax),%edx
+  8002b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002b9:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8002bc:	90                   	nop
+  8002bd:	c9                   	leave
+  8002be:	c3                   	ret
+
+00000000008002bf <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002bf:	55                   	push   %rbp
+  8002c0:	48 89 e5             	mov    %rsp,%rbp
+  8002c3:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8002ca:	48 89 bd c8 fe ff ff 	mov    %rdi,-0x138(%rbp)
+  8002d1:	48 89 b5 c0 fe ff ff 	mov    %rsi,-0x140(%rbp)
+	struct printbuf b;
+	va_list aq;
+	va_copy(aq,ap);
+  8002d8:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  8002df:	48 8b b5 c0 fe ff ff 	mov    -0x140(%rbp),%rsi
+  8002e6:	48 8b 06             	mov    (%rsi),%rax
+  8002e9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8002ed:	48 89 01             	mov    %rax,(%rcx)
+  8002f0:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8002f4:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8002f8:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	b.idx = 0;
+  8002fc:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800303:	00 00 00 
+	b.cnt = 0;
+  800306:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80030d:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, aq);
+  800310:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  800317:	48 8b 95 c8 fe ff ff 	mov    -0x138(%rbp),%rdx
+  80031e:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800325:	48 89 c6             	mov    %rax,%rsi
+  800328:	48 b8 45 02 80 00 00 	movabs $0x800245,%rax
+  80032f:	00 00 00 
+  800332:	48 89 c7             	mov    %rax,%rdi
+  800335:	48 b8 0c 07 80 00 00 	movabs $0x80070c,%rax
+  80033c:	00 00 00 
+  80033f:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  800341:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  800347:	48 98                	cltq
+  800349:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800350:	48 83 c2 08          	add    $0x8,%rdx
+  800354:	48 89 c6             	mov    %rax,%rsi
+  800357:	48 89 d7             	mov    %rdx,%rdi
+  80035a:	48 b8 12 1b 80 00 00 	movabs $0x801b12,%rax
+  800361:	00 00 00 
+  800364:	ff d0                	call   *%rax
+	va_end(aq);
+
+	return b.cnt;
+  800366:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80036c:	c9                   	leave
+  80036d:	c3                   	ret
+
+000000000080036e <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80036e:	55                   	push   %rbp
+  80036f:	48 89 e5             	mov    %rsp,%rbp
+  800372:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800379:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800380:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800387:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80038e:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800395:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80039c:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8003a3:	84 c0                	test   %al,%al
+  8003a5:	74 20                	je     8003c7 <cprintf+0x59>
+  8003a7:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8003ab:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8003af:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8003b3:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8003b7:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8003bb:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8003bf:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8003c3:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+	va_list aq;
+	va_start(ap, fmt);
+  8003c7:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8003ce:	00 00 00 
+  8003d1:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8003d8:	00 00 00 
+  8003db:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003df:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8003e6:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8003ed:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  8003f4:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8003fb:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800402:	48 8b 06             	mov    (%rsi),%rax
+  800405:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800409:	48 89 01             	mov    %rax,(%rcx)
+  80040c:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800410:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800414:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	cnt = vcprintf(fmt, aq);
+  800418:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80041f:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800426:	48 89 d6             	mov    %rdx,%rsi
+  800429:	48 89 c7             	mov    %rax,%rdi
+  80042c:	48 b8 bf 02 80 00 00 	movabs $0x8002bf,%rax
+  800433:	00 00 00 
+  800436:	ff d0                	call   *%rax
+  800438:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return cnt;
+  80043e:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800444:	c9                   	leave
+  800445:	c3                   	ret
+
+0000000000800446 <printnum>:
+ * num: 需要打印出来的整型数，base: 整型数的进制，其他参数同 vprintfmt
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+		 unsigned long long num, unsigned base, int width, int padc)
+{
+  800446:	55                   	push   %rbp
+  800447:	48 89 e5             	mov    %rsp,%rbp
+  80044a:	48 83 ec 30          	sub    $0x30,%rsp
+  80044e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800452:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800456:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80045a:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  80045d:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  800461:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+	// 当 num 超过一位数，首先递归函数自身打印所有高位的(更重要的)数字
+	if (num >= base)
+  800465:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800468:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  80046c:	72 54                	jb     8004c2 <printnum+0x7c>
+	{
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80046e:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800471:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800474:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800477:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80047b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800480:	48 f7 f6             	div    %rsi
+  800483:	49 89 c2             	mov    %rax,%r10
+  800486:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800489:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80048c:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800490:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800494:	41 89 c9             	mov    %ecx,%r9d
+  800497:	41 89 f8             	mov    %edi,%r8d
+  80049a:	89 d1                	mov    %edx,%ecx
+  80049c:	4c 89 d2             	mov    %r10,%rdx
+  80049f:	48 89 c7             	mov    %rax,%rdi
+  8004a2:	48 b8 46 04 80 00 00 	movabs $0x800446,%rax
+  8004a9:	00 00 00 
+  8004ac:	ff d0                	call   *%rax
+  8004ae:	eb 1c                	jmp    8004cc <printnum+0x86>
+	}
+	else
+	{
+		// 按照右对齐的格式在左侧补齐填充字符 padc
+		while (--width > 0)
+			putch(padc, putdat);
+  8004b0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8004b4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8004b7:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8004bb:	48 89 d6             	mov    %rdx,%rsi
+  8004be:	89 c7                	mov    %eax,%edi
+  8004c0:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8004c2:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  8004c6:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8004ca:	7f e4                	jg     8004b0 <printnum+0x6a>
+	}
+
+	// 然后打印个位数字
+	putch("0123456789abcdef"[num % base], putdat);
+  8004cc:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8004cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004d8:	48 f7 f1             	div    %rcx
+  8004db:	48 b8 f0 39 80 00 00 	movabs $0x8039f0,%rax
+  8004e2:	00 00 00 
+  8004e5:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8004e9:	0f be c0             	movsbl %al,%eax
+  8004ec:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8004f0:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8004f4:	48 89 d6             	mov    %rdx,%rsi
+  8004f7:	89 c7                	mov    %eax,%edi
+  8004f9:	ff d1                	call   *%rcx
+}
+  8004fb:	90                   	nop
+  8004fc:	c9                   	leave
+  8004fd:	c3                   	ret
+
+00000000008004fe <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  8004fe:	55                   	push   %rbp
+  8004ff:	48 89 e5             	mov    %rsp,%rbp
+  800502:	48 83 ec 20          	sub    $0x20,%rsp
+  800506:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80050a:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;
+	if (lflag >= 2)
+  80050d:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800511:	7e 4f                	jle    800562 <getuint+0x64>
+		x = va_arg(*ap, unsigned long long);
+  800513:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800517:	8b 00                	mov    (%rax),%eax
+  800519:	83 f8 2f             	cmp    $0x2f,%eax
+  80051c:	77 24                	ja     800542 <getuint+0x44>
+  80051e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800522:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800526:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80052a:	8b 00                	mov    (%rax),%eax
+  80052c:	89 c0                	mov    %eax,%eax
+  80052e:	48 01 d0             	add    %rdx,%rax
+  800531:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800535:	8b 12                	mov    (%rdx),%edx
+  800537:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80053a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80053e:	89 0a                	mov    %ecx,(%rdx)
+  800540:	eb 14                	jmp    800556 <getuint+0x58>
+  800542:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800546:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80054a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80054e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800552:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800556:	48 8b 00             	mov    (%rax),%rax
+  800559:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80055d:	e9 9d 00 00 00       	jmp    8005ff <getuint+0x101>
+	else if (lflag)
+  800562:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800566:	74 4c                	je     8005b4 <getuint+0xb6>
+		x = va_arg(*ap, unsigned long);
+  800568:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80056c:	8b 00                	mov    (%rax),%eax
+  80056e:	83 f8 2f             	cmp    $0x2f,%eax
+  800571:	77 24                	ja     800597 <getuint+0x99>
+  800573:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800577:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80057b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80057f:	8b 00                	mov    (%rax),%eax
+  800581:	89 c0                	mov    %eax,%eax
+  800583:	48 01 d0             	add    %rdx,%rax
+  800586:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80058a:	8b 12                	mov    (%rdx),%edx
+  80058c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80058f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800593:	89 0a                	mov    %ecx,(%rdx)
+  800595:	eb 14                	jmp    8005ab <getuint+0xad>
+  800597:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80059b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80059f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005a3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005a7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005ab:	48 8b 00             	mov    (%rax),%rax
+  8005ae:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8005b2:	eb 4b                	jmp    8005ff <getuint+0x101>
+	else
+		x = va_arg(*ap, unsigned int);
+  8005b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005b8:	8b 00                	mov    (%rax),%eax
+  8005ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8005bd:	77 24                	ja     8005e3 <getuint+0xe5>
+  8005bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005c3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005cb:	8b 00                	mov    (%rax),%eax
+  8005cd:	89 c0                	mov    %eax,%eax
+  8005cf:	48 01 d0             	add    %rdx,%rax
+  8005d2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005d6:	8b 12                	mov    (%rdx),%edx
+  8005d8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005db:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005df:	89 0a                	mov    %ecx,(%rdx)
+  8005e1:	eb 14                	jmp    8005f7 <getuint+0xf9>
+  8005e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005e7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005eb:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005ef:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005f3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005f7:	8b 00                	mov    (%rax),%eax
+  8005f9:	89 c0                	mov    %eax,%eax
+  8005fb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8005ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800603:	c9                   	leave
+  800604:	c3                   	ret
+
+0000000000800605 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800605:	55                   	push   %rbp
+  800606:	48 89 e5             	mov    %rsp,%rbp
+  800609:	48 83 ec 20          	sub    $0x20,%rsp
+  80060d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800611:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800614:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800618:	7e 4f                	jle    800669 <getint+0x64>
+		x = va_arg(*ap, long long);
+  80061a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80061e:	8b 00                	mov    (%rax),%eax
+  800620:	83 f8 2f             	cmp    $0x2f,%eax
+  800623:	77 24                	ja     800649 <getint+0x44>
+  800625:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800629:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80062d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800631:	8b 00                	mov    (%rax),%eax
+  800633:	89 c0                	mov    %eax,%eax
+  800635:	48 01 d0             	add    %rdx,%rax
+  800638:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80063c:	8b 12                	mov    (%rdx),%edx
+  80063e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800641:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800645:	89 0a                	mov    %ecx,(%rdx)
+  800647:	eb 14                	jmp    80065d <getint+0x58>
+  800649:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80064d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800651:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800655:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800659:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80065d:	48 8b 00             	mov    (%rax),%rax
+  800660:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800664:	e9 9d 00 00 00       	jmp    800706 <getint+0x101>
+	else if (lflag)
+  800669:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80066d:	74 4c                	je     8006bb <getint+0xb6>
+		x = va_arg(*ap, long);
+  80066f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800673:	8b 00                	mov    (%rax),%eax
+  800675:	83 f8 2f             	cmp    $0x2f,%eax
+  800678:	77 24                	ja     80069e <getint+0x99>
+  80067a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80067e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800682:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800686:	8b 00                	mov    (%rax),%eax
+  800688:	89 c0                	mov    %eax,%eax
+  80068a:	48 01 d0             	add    %rdx,%rax
+  80068d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800691:	8b 12                	mov    (%rdx),%edx
+  800693:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800696:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80069a:	89 0a                	mov    %ecx,(%rdx)
+  80069c:	eb 14                	jmp    8006b2 <getint+0xad>
+  80069e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006a2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006a6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006aa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006ae:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006b2:	48 8b 00             	mov    (%rax),%rax
+  8006b5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8006b9:	eb 4b                	jmp    800706 <getint+0x101>
+	else
+		x = va_arg(*ap, int);
+  8006bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006bf:	8b 00                	mov    (%rax),%eax
+  8006c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c4:	77 24                	ja     8006ea <getint+0xe5>
+  8006c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006ca:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006d2:	8b 00                	mov    (%rax),%eax
+  8006d4:	89 c0                	mov    %eax,%eax
+  8006d6:	48 01 d0             	add    %rdx,%rax
+  8006d9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006dd:	8b 12                	mov    (%rdx),%edx
+  8006df:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006e2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006e6:	89 0a                	mov    %ecx,(%rdx)
+  8006e8:	eb 14                	jmp    8006fe <getint+0xf9>
+  8006ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006ee:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006f2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006f6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006fa:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006fe:	8b 00                	mov    (%rax),%eax
+  800700:	48 98                	cltq
+  800702:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800706:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80070a:	c9                   	leave
+  80070b:	c3                   	ret
+
+000000000080070c <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap)
+{
+  80070c:	55                   	push   %rbp
+  80070d:	48 89 e5             	mov    %rsp,%rbp
+  800710:	41 54                	push   %r12
+  800712:	53                   	push   %rbx
+  800713:	48 83 ec 60          	sub    $0x60,%rsp
+  800717:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80071b:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80071f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800723:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+	int base, lflag, width, precision, altflag;
+
+	// 填充字符，在显示字符串的'%'后读到'-'或'0'时，赋值到 padc
+	char padc;
+	va_list aq;
+	va_copy(aq, ap);
+  800727:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80072b:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80072f:	48 8b 06             	mov    (%rsi),%rax
+  800732:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800736:	48 89 01             	mov    %rax,(%rcx)
+  800739:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80073d:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800741:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1)
+	{
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800745:	eb 17                	jmp    80075e <vprintfmt+0x52>
+		{
+			if (ch == '\0')
+  800747:	85 db                	test   %ebx,%ebx
+  800749:	0f 84 b9 04 00 00    	je     800c08 <vprintfmt+0x4fc>
+				return;
+			putch(ch, putdat);
+  80074f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800753:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800757:	48 89 c6             	mov    %rax,%rsi
+  80075a:	89 df                	mov    %ebx,%edi
+  80075c:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  80075e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800762:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800766:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80076a:	0f b6 00             	movzbl (%rax),%eax
+  80076d:	0f b6 d8             	movzbl %al,%ebx
+  800770:	83 fb 25             	cmp    $0x25,%ebx
+  800773:	75 d2                	jne    800747 <vprintfmt+0x3b>
+		}
+
+		// 处理 % 转义序列
+		// padc 初始化为空格符，padc='-'代表字符串左对齐，右边补空格，padc=' '代表右对齐，左边补空格，padc='0'右对齐，左边补0
+		padc = ' ';
+  800775:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+		width = -1;
+  800779:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+		// 默认-1代表显示长度为字符串本来的长度
+		precision = -1;
+  800780:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+		lflag = 0;
+  800787:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+		altflag = 0;
+  80078e:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *)fmt++)
+  800795:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800799:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80079d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8007a1:	0f b6 00             	movzbl (%rax),%eax
+  8007a4:	0f b6 d8             	movzbl %al,%ebx
+  8007a7:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8007aa:	83 f8 55             	cmp    $0x55,%eax
+  8007ad:	0f 87 22 04 00 00    	ja     800bd5 <vprintfmt+0x4c9>
+  8007b3:	89 c0                	mov    %eax,%eax
+  8007b5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8007bc:	00 
+  8007bd:	48 b8 18 3a 80 00 00 	movabs $0x803a18,%rax
+  8007c4:	00 00 00 
+  8007c7:	48 01 d0             	add    %rdx,%rax
+  8007ca:	48 8b 00             	mov    (%rax),%rax
+  8007cd:	ff e0                	jmp    *%rax
+		{
+
+		// flag to pad on the right
+		case '-':
+			padc = '-';
+  8007cf:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+			goto reswitch;
+  8007d3:	eb c0                	jmp    800795 <vprintfmt+0x89>
+
+		// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  8007d5:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+			goto reswitch;
+  8007d9:	eb ba                	jmp    800795 <vprintfmt+0x89>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0;; ++fmt)
+  8007db:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+			{
+				precision = precision * 10 + ch - '0';
+  8007e2:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8007e5:	89 d0                	mov    %edx,%eax
+  8007e7:	c1 e0 02             	shl    $0x2,%eax
+  8007ea:	01 d0                	add    %edx,%eax
+  8007ec:	01 c0                	add    %eax,%eax
+  8007ee:	01 d8                	add    %ebx,%eax
+  8007f0:	83 e8 30             	sub    $0x30,%eax
+  8007f3:	89 45 d8             	mov    %eax,-0x28(%rbp)
+				ch = *fmt;
+  8007f6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8007fa:	0f b6 00             	movzbl (%rax),%eax
+  8007fd:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800800:	83 fb 2f             	cmp    $0x2f,%ebx
+  800803:	7e 60                	jle    800865 <vprintfmt+0x159>
+  800805:	83 fb 39             	cmp    $0x39,%ebx
+  800808:	7f 5b                	jg     800865 <vprintfmt+0x159>
+			for (precision = 0;; ++fmt)
+  80080a:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+				precision = precision * 10 + ch - '0';
+  80080f:	eb d1                	jmp    8007e2 <vprintfmt+0xd6>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800811:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800814:	83 f8 2f             	cmp    $0x2f,%eax
+  800817:	77 17                	ja     800830 <vprintfmt+0x124>
+  800819:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80081d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800820:	89 d2                	mov    %edx,%edx
+  800822:	48 01 d0             	add    %rdx,%rax
+  800825:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800828:	83 c2 08             	add    $0x8,%edx
+  80082b:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80082e:	eb 0c                	jmp    80083c <vprintfmt+0x130>
+  800830:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800834:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800838:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80083c:	8b 00                	mov    (%rax),%eax
+  80083e:	89 45 d8             	mov    %eax,-0x28(%rbp)
+			goto process_precision;
+  800841:	eb 23                	jmp    800866 <vprintfmt+0x15a>
+
+		case '.':
+			if (width < 0)
+  800843:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800847:	0f 89 48 ff ff ff    	jns    800795 <vprintfmt+0x89>
+				width = 0;
+  80084d:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+			goto reswitch;
+  800854:	e9 3c ff ff ff       	jmp    800795 <vprintfmt+0x89>
+
+		case '#':
+			altflag = 1;
+  800859:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+			goto reswitch;
+  800860:	e9 30 ff ff ff       	jmp    800795 <vprintfmt+0x89>
+			goto process_precision;
+  800865:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800866:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80086a:	0f 89 25 ff ff ff    	jns    800795 <vprintfmt+0x89>
+				width = precision, precision = -1;
+  800870:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800873:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800876:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+			goto reswitch;
+  80087d:	e9 13 ff ff ff       	jmp    800795 <vprintfmt+0x89>
+
+		// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800882:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+			goto reswitch;
+  800886:	e9 0a ff ff ff       	jmp    800795 <vprintfmt+0x89>
+
+		// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  80088b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088e:	83 f8 2f             	cmp    $0x2f,%eax
+  800891:	77 17                	ja     8008aa <vprintfmt+0x19e>
+  800893:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800897:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80089a:	89 d2                	mov    %edx,%edx
+  80089c:	48 01 d0             	add    %rdx,%rax
+  80089f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008a2:	83 c2 08             	add    $0x8,%edx
+  8008a5:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8008a8:	eb 0c                	jmp    8008b6 <vprintfmt+0x1aa>
+  8008aa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8008ae:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8008b2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8008b6:	8b 00                	mov    (%rax),%eax
+  8008b8:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8008bc:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8008c0:	48 89 d6             	mov    %rdx,%rsi
+  8008c3:	89 c7                	mov    %eax,%edi
+  8008c5:	ff d1                	call   *%rcx
+			break;
+  8008c7:	e9 37 03 00 00       	jmp    800c03 <vprintfmt+0x4f7>
+
+		// error message
+		case 'e':
+			err = va_arg(aq, int);
+  8008cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d2:	77 17                	ja     8008eb <vprintfmt+0x1df>
+  8008d4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8008d8:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008db:	89 d2                	mov    %edx,%edx
+  8008dd:	48 01 d0             	add    %rdx,%rax
+  8008e0:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008e3:	83 c2 08             	add    $0x8,%edx
+  8008e6:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8008e9:	eb 0c                	jmp    8008f7 <vprintfmt+0x1eb>
+  8008eb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8008ef:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8008f3:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8008f7:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  8008f9:	85 db                	test   %ebx,%ebx
+  8008fb:	79 02                	jns    8008ff <vprintfmt+0x1f3>
+				err = -err;
+  8008fd:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8008ff:	83 fb 11             	cmp    $0x11,%ebx
+  800902:	7f 16                	jg     80091a <vprintfmt+0x20e>
+  800904:	48 ba 60 39 80 00 00 	movabs $0x803960,%rdx
+  80090b:	00 00 00 
+  80090e:	48 63 c3             	movslq %ebx,%rax
+  800911:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800915:	4d 85 e4             	test   %r12,%r12
+  800918:	75 2e                	jne    800948 <vprintfmt+0x23c>
+				printfmt(putch, putdat, "error %d", err);
+  80091a:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80091e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800922:	89 d9                	mov    %ebx,%ecx
+  800924:	48 ba 01 3a 80 00 00 	movabs $0x803a01,%rdx
+  80092b:	00 00 00 
+  80092e:	48 89 c7             	mov    %rax,%rdi
+  800931:	b8 00 00 00 00       	mov    $0x0,%eax
+  800936:	49 b8 12 0c 80 00 00 	movabs $0x800c12,%r8
+  80093d:	00 00 00 
+  800940:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800943:	e9 bb 02 00 00       	jmp    800c03 <vprintfmt+0x4f7>
+				printfmt(putch, putdat, "%s", p);
+  800948:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80094c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800950:	4c 89 e1             	mov    %r12,%rcx
+  800953:	48 ba 0a 3a 80 00 00 	movabs $0x803a0a,%rdx
+  80095a:	00 00 00 
+  80095d:	48 89 c7             	mov    %rax,%rdi
+  800960:	b8 00 00 00 00       	mov    $0x0,%eax
+  800965:	49 b8 12 0c 80 00 00 	movabs $0x800c12,%r8
+  80096c:	00 00 00 
+  80096f:	41 ff d0             	call   *%r8
+			break;
+  800972:	e9 8c 02 00 00       	jmp    800c03 <vprintfmt+0x4f7>
+
+		// string
+		case 's':
+			// 从可变参数中读入字符串指针
+			if ((p = va_arg(aq, char *)) == NULL)
+  800977:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097a:	83 f8 2f             	cmp    $0x2f,%eax
+  80097d:	77 17                	ja     800996 <vprintfmt+0x28a>
+  80097f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800983:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800986:	89 d2                	mov    %edx,%edx
+  800988:	48 01 d0             	add    %rdx,%rax
+  80098b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80098e:	83 c2 08             	add    $0x8,%edx
+  800991:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800994:	eb 0c                	jmp    8009a2 <vprintfmt+0x296>
+  800996:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80099a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80099e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8009a2:	4c 8b 20             	mov    (%rax),%r12
+  8009a5:	4d 85 e4             	test   %r12,%r12
+  8009a8:	75 0a                	jne    8009b4 <vprintfmt+0x2a8>
+				p = "(null)"; // 当字符串为空时，将它指向"(null)"字符串
+  8009aa:	49 bc 0d 3a 80 00 00 	movabs $0x803a0d,%r12
+  8009b1:	00 00 00 
+			// 判断左对齐还是右对齐，pad='-'左对齐，否则右对齐
+			if (width > 0 && padc != '-')
+  8009b4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8009b8:	7e 78                	jle    800a32 <vprintfmt+0x326>
+  8009ba:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  8009be:	74 72                	je     800a32 <vprintfmt+0x326>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009c0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8009c3:	48 98                	cltq
+  8009c5:	48 89 c6             	mov    %rax,%rsi
+  8009c8:	4c 89 e7             	mov    %r12,%rdi
+  8009cb:	48 b8 b7 0f 80 00 00 	movabs $0x800fb7,%rax
+  8009d2:	00 00 00 
+  8009d5:	ff d0                	call   *%rax
+  8009d7:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  8009da:	eb 17                	jmp    8009f3 <vprintfmt+0x2e7>
+					putch(padc, putdat); // 字符串右对齐，左边补相应数量(width-实际长度)的空格或者 0
+  8009dc:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  8009e0:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8009e4:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8009e8:	48 89 d6             	mov    %rdx,%rsi
+  8009eb:	89 c7                	mov    %eax,%edi
+  8009ed:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009ef:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8009f3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8009f7:	7f e3                	jg     8009dc <vprintfmt+0x2d0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8009f9:	eb 37                	jmp    800a32 <vprintfmt+0x326>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8009fb:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8009ff:	74 1e                	je     800a1f <vprintfmt+0x313>
+  800a01:	83 fb 1f             	cmp    $0x1f,%ebx
+  800a04:	7e 05                	jle    800a0b <vprintfmt+0x2ff>
+  800a06:	83 fb 7e             	cmp    $0x7e,%ebx
+  800a09:	7e 14                	jle    800a1f <vprintfmt+0x313>
+					putch('?', putdat);
+  800a0b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a0f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a13:	48 89 c6             	mov    %rax,%rsi
+  800a16:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a1b:	ff d2                	call   *%rdx
+  800a1d:	eb 0f                	jmp    800a2e <vprintfmt+0x322>
+				else
+					putch(ch, putdat); // 打印相应长度的字符串
+  800a1f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a23:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a27:	48 89 c6             	mov    %rax,%rsi
+  800a2a:	89 df                	mov    %ebx,%edi
+  800a2c:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a2e:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800a32:	4c 89 e0             	mov    %r12,%rax
+  800a35:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800a39:	0f b6 00             	movzbl (%rax),%eax
+  800a3c:	0f be d8             	movsbl %al,%ebx
+  800a3f:	85 db                	test   %ebx,%ebx
+  800a41:	74 28                	je     800a6b <vprintfmt+0x35f>
+  800a43:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800a47:	78 b2                	js     8009fb <vprintfmt+0x2ef>
+  800a49:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800a4d:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800a51:	79 a8                	jns    8009fb <vprintfmt+0x2ef>
+			for (; width > 0; width--)
+  800a53:	eb 16                	jmp    800a6b <vprintfmt+0x35f>
+				putch(' ', putdat); // 当字符串是左对齐的时候打印相应数量的空格
+  800a55:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a59:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a5d:	48 89 c6             	mov    %rax,%rsi
+  800a60:	bf 20 00 00 00       	mov    $0x20,%edi
+  800a65:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800a67:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800a6b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a6f:	7f e4                	jg     800a55 <vprintfmt+0x349>
+			break;
+  800a71:	e9 8d 01 00 00       	jmp    800c03 <vprintfmt+0x4f7>
+
+		// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800a76:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a7a:	be 03 00 00 00       	mov    $0x3,%esi
+  800a7f:	48 89 c7             	mov    %rax,%rdi
+  800a82:	48 b8 05 06 80 00 00 	movabs $0x800605,%rax
+  800a89:	00 00 00 
+  800a8c:	ff d0                	call   *%rax
+  800a8e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((long long)num < 0)
+  800a92:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a96:	48 85 c0             	test   %rax,%rax
+  800a99:	79 1d                	jns    800ab8 <vprintfmt+0x3ac>
+			{
+				putch('-', putdat);
+  800a9b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a9f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800aa3:	48 89 c6             	mov    %rax,%rsi
+  800aa6:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800aab:	ff d2                	call   *%rdx
+				num = -(long long)num;
+  800aad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ab1:	48 f7 d8             	neg    %rax
+  800ab4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			}
+			base = 10;
+  800ab8:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800abf:	e9 d2 00 00 00       	jmp    800b96 <vprintfmt+0x48a>
+
+		// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800ac4:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800ac8:	be 03 00 00 00       	mov    $0x3,%esi
+  800acd:	48 89 c7             	mov    %rax,%rdi
+  800ad0:	48 b8 fe 04 80 00 00 	movabs $0x8004fe,%rax
+  800ad7:	00 00 00 
+  800ada:	ff d0                	call   *%rax
+  800adc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 10;
+  800ae0:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800ae7:	e9 aa 00 00 00       	jmp    800b96 <vprintfmt+0x48a>
+		// (unsigned) octal
+		case 'o':
+			// Gets the variable argument with type integer from the point which was processed last by va_arg
+			// calls getuint which returns a long long value, which then calls printnum which prints based on
+			// base value.
+			num = getuint(&aq, 3);
+  800aec:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800af0:	be 03 00 00 00       	mov    $0x3,%esi
+  800af5:	48 89 c7             	mov    %rax,%rdi
+  800af8:	48 b8 fe 04 80 00 00 	movabs $0x8004fe,%rax
+  800aff:	00 00 00 
+  800b02:	ff d0                	call   *%rax
+  800b04:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 8;
+  800b08:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+			goto number;
+  800b0f:	e9 82 00 00 00       	jmp    800b96 <vprintfmt+0x48a>
+
+		// pointer
+		case 'p':
+			putch('0', putdat);
+  800b14:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b18:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b1c:	48 89 c6             	mov    %rax,%rsi
+  800b1f:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b24:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800b26:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b2a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b2e:	48 89 c6             	mov    %rax,%rsi
+  800b31:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b36:	ff d2                	call   *%rdx
+			num = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800b38:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b3b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b3e:	77 17                	ja     800b57 <vprintfmt+0x44b>
+  800b40:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b44:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b47:	89 d2                	mov    %edx,%edx
+  800b49:	48 01 d0             	add    %rdx,%rax
+  800b4c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b4f:	83 c2 08             	add    $0x8,%edx
+  800b52:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b55:	eb 0c                	jmp    800b63 <vprintfmt+0x457>
+  800b57:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b5b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b5f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b63:	48 8b 00             	mov    (%rax),%rax
+  800b66:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800b6a:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+			goto number;
+  800b71:	eb 23                	jmp    800b96 <vprintfmt+0x48a>
+
+		// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800b73:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b77:	be 03 00 00 00       	mov    $0x3,%esi
+  800b7c:	48 89 c7             	mov    %rax,%rdi
+  800b7f:	48 b8 fe 04 80 00 00 	movabs $0x8004fe,%rax
+  800b86:	00 00 00 
+  800b89:	ff d0                	call   *%rax
+  800b8b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800b8f:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800b96:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800b9b:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800b9e:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800ba1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ba5:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800ba9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800bad:	45 89 c1             	mov    %r8d,%r9d
+  800bb0:	41 89 f8             	mov    %edi,%r8d
+  800bb3:	48 89 c7             	mov    %rax,%rdi
+  800bb6:	48 b8 46 04 80 00 00 	movabs $0x800446,%rax
+  800bbd:	00 00 00 
+  800bc0:	ff d0                	call   *%rax
+			break;
+  800bc2:	eb 3f                	jmp    800c03 <vprintfmt+0x4f7>
+
+		// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800bc4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bc8:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800bcc:	48 89 c6             	mov    %rax,%rsi
+  800bcf:	89 df                	mov    %ebx,%edi
+  800bd1:	ff d2                	call   *%rdx
+			break;
+  800bd3:	eb 2e                	jmp    800c03 <vprintfmt+0x4f7>
+
+		// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800bd5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bd9:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800bdd:	48 89 c6             	mov    %rax,%rsi
+  800be0:	bf 25 00 00 00       	mov    $0x25,%edi
+  800be5:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800be7:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800bec:	eb 05                	jmp    800bf3 <vprintfmt+0x4e7>
+  800bee:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800bf3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800bf7:	48 83 e8 01          	sub    $0x1,%rax
+  800bfb:	0f b6 00             	movzbl (%rax),%eax
+  800bfe:	3c 25                	cmp    $0x25,%al
+  800c00:	75 ec                	jne    800bee <vprintfmt+0x4e2>
+				/* do nothing */;
+			break;
+  800c02:	90                   	nop
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800c03:	e9 56 fb ff ff       	jmp    80075e <vprintfmt+0x52>
+				return;
+  800c08:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800c09:	48 83 c4 60          	add    $0x60,%rsp
+  800c0d:	5b                   	pop    %rbx
+  800c0e:	41 5c                	pop    %r12
+  800c10:	5d                   	pop    %rbp
+  800c11:	c3                   	ret
+
+0000000000800c12 <printfmt>:
+
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...)
+{
+  800c12:	55                   	push   %rbp
+  800c13:	48 89 e5             	mov    %rsp,%rbp
+  800c16:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800c1d:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800c24:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800c2b:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800c32:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800c39:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800c40:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800c47:	84 c0                	test   %al,%al
+  800c49:	74 20                	je     800c6b <printfmt+0x59>
+  800c4b:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800c4f:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800c53:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800c57:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800c5b:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800c5f:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800c63:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800c67:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800c6b:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800c72:	00 00 00 
+  800c75:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800c7c:	00 00 00 
+  800c7f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c83:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800c8a:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800c91:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800c98:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800c9f:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800ca6:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800cad:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800cb4:	48 89 c7             	mov    %rax,%rdi
+  800cb7:	48 b8 0c 07 80 00 00 	movabs $0x80070c,%rax
+  800cbe:	00 00 00 
+  800cc1:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  800cc3:	90                   	nop
+  800cc4:	c9                   	leave
+  800cc5:	c3                   	ret
+
+0000000000800cc6 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800cc6:	55                   	push   %rbp
+  800cc7:	48 89 e5             	mov    %rsp,%rbp
+  800cca:	48 83 ec 10          	sub    $0x10,%rsp
+  800cce:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800cd1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  800cd5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800cd9:	8b 40 10             	mov    0x10(%rax),%eax
+  800cdc:	8d 50 01             	lea    0x1(%rax),%edx
+  800cdf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ce3:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  800ce6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800cea:	48 8b 10             	mov    (%rax),%rdx
+  800ced:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800cf1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800cf5:	48 39 c2             	cmp    %rax,%rdx
+  800cf8:	73 17                	jae    800d11 <sprintputch+0x4b>
+		*b->buf++ = ch;
+  800cfa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800cfe:	48 8b 00             	mov    (%rax),%rax
+  800d01:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800d05:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800d09:	48 89 0a             	mov    %rcx,(%rdx)
+  800d0c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800d0f:	88 10                	mov    %dl,(%rax)
+}
+  800d11:	90                   	nop
+  800d12:	c9                   	leave
+  800d13:	c3                   	ret
+
+0000000000800d14 <vsnprintf>:
+
+int vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800d14:	55                   	push   %rbp
+  800d15:	48 89 e5             	mov    %rsp,%rbp
+  800d18:	48 83 ec 50          	sub    $0x50,%rsp
+  800d1c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  800d20:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  800d23:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  800d27:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+	va_list aq;
+	va_copy(aq, ap);
+  800d2b:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800d2f:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800d33:	48 8b 06             	mov    (%rsi),%rax
+  800d36:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800d3a:	48 89 01             	mov    %rax,(%rcx)
+  800d3d:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d41:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800d45:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	struct sprintbuf b = {buf, buf + n - 1, 0};
+  800d49:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d4d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800d51:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  800d54:	48 98                	cltq
+  800d56:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800d5a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d5e:	48 01 d0             	add    %rdx,%rax
+  800d61:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  800d65:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+
+	if (buf == NULL || n < 1)
+  800d6c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800d71:	74 06                	je     800d79 <vsnprintf+0x65>
+  800d73:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800d77:	7f 07                	jg     800d80 <vsnprintf+0x6c>
+		return -E_INVAL;
+  800d79:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d7e:	eb 32                	jmp    800db2 <vsnprintf+0x9e>
+
+	// print the string to the buffer
+	vprintfmt((void *)sprintputch, &b, fmt, aq);
+  800d80:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800d84:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  800d88:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d8c:	48 89 c6             	mov    %rax,%rsi
+  800d8f:	48 b8 c6 0c 80 00 00 	movabs $0x800cc6,%rax
+  800d96:	00 00 00 
+  800d99:	48 89 c7             	mov    %rax,%rdi
+  800d9c:	48 b8 0c 07 80 00 00 	movabs $0x80070c,%rax
+  800da3:	00 00 00 
+  800da6:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  800da8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800dac:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800daf:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  800db2:	c9                   	leave
+  800db3:	c3                   	ret
+
+0000000000800db4 <snprintf>:
+
+int snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800db4:	55                   	push   %rbp
+  800db5:	48 89 e5             	mov    %rsp,%rbp
+  800db8:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800dbf:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800dc6:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800dcc:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800dd3:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800dda:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800de1:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800de8:	84 c0                	test   %al,%al
+  800dea:	74 20                	je     800e0c <snprintf+0x58>
+  800dec:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800df0:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800df4:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800df8:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800dfc:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800e00:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800e04:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800e08:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  800e0c:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800e13:	00 00 00 
+  800e16:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800e1d:	00 00 00 
+  800e20:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e24:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800e2b:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800e32:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq, ap);
+  800e39:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800e40:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800e47:	48 8b 06             	mov    (%rsi),%rax
+  800e4a:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800e4e:	48 89 01             	mov    %rax,(%rcx)
+  800e51:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800e55:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800e59:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  800e5d:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800e64:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  800e6b:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  800e71:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800e78:	48 89 c7             	mov    %rax,%rdi
+  800e7b:	48 b8 14 0d 80 00 00 	movabs $0x800d14,%rax
+  800e82:	00 00 00 
+  800e85:	ff d0                	call   *%rax
+  800e87:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  800e8d:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800e93:	c9                   	leave
+  800e94:	c3                   	ret
+
+0000000000800e95 <cpuid>:
+#define read_rip(var) __asm __volatile("leaq (%%rip), %0" : "=r" (var)::"cc","memory")
+
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800e95:	55                   	push   %rbp
+  800e96:	48 89 e5             	mov    %rsp,%rbp
+  800e99:	53                   	push   %rbx
+  800e9a:	48 83 ec 38          	sub    $0x38,%rsp
+  800e9e:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800ea1:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800ea5:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800ea9:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800ead:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid" 
+  800eb1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800eb4:	0f a2                	cpuid
+  800eb6:	89 de                	mov    %ebx,%esi
+  800eb8:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800ebb:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800ebe:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800ec1:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info));
+	if (eaxp)
+  800ec4:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800ec9:	74 09                	je     800ed4 <cpuid+0x3f>
+		*eaxp = eax;
+  800ecb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ecf:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800ed2:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  800ed4:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800ed9:	74 09                	je     800ee4 <cpuid+0x4f>
+		*ebxp = ebx;
+  800edb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800edf:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800ee2:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  800ee4:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800ee9:	74 09                	je     800ef4 <cpuid+0x5f>
+		*ecxp = ecx;
+  800eeb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800eef:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800ef2:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  800ef4:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800ef9:	74 09                	je     800f04 <cpuid+0x6f>
+		*edxp = edx;
+  800efb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800eff:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800f02:	89 10                	mov    %edx,(%rax)
+}
+  800f04:	90                   	nop
+  800f05:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f09:	c9                   	leave
+  800f0a:	c3                   	ret
+
+0000000000800f0b <cpuid_count>:
+
+// 带子功能号(%ecx = count)的 cpuid，用于 leaf 4/7/0xB/0xD 等
+static __inline void
+cpuid_count(uint32_t info, uint32_t count, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800f0b:	55                   	push   %rbp
+  800f0c:	48 89 e5             	mov    %rsp,%rbp
+  800f0f:	53                   	push   %rbx
+  800f10:	48 83 ec 38          	sub    $0x38,%rsp
+  800f14:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800f17:	89 75 e0             	mov    %esi,-0x20(%rbp)
+  800f1a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800f1e:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  800f22:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+  800f26:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800f2a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800f2d:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800f30:	89 d1                	mov    %edx,%ecx
+  800f32:	0f a2                	cpuid
+  800f34:	89 de                	mov    %ebx,%esi
+  800f36:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800f39:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800f3c:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800f3f:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info), "c" (count));
+	if (eaxp)
+  800f42:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800f47:	74 09                	je     800f52 <cpuid_count+0x47>
+		*eaxp = eax;
+  800f49:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f4d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800f50:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  800f52:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800f57:	74 09                	je     800f62 <cpuid_count+0x57>
+		*ebxp = ebx;
+  800f59:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f5d:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800f60:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  800f62:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800f67:	74 09                	je     800f72 <cpuid_count+0x67>
+		*ecxp = ecx;
+  800f69:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f6d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800f70:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  800f72:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800f77:	74 09                	je     800f82 <cpuid_count+0x77>
+		*edxp = edx;
+  800f79:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800f7d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800f80:	89 10                	mov    %edx,(%rax)
+}
+  800f82:	90                   	nop
+  800f83:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f87:	c9                   	leave
+  800f88:	c3                   	ret
+
+0000000000800f89 <strlen>:
+// 在真正的硬件上会有一定程度的优化, 但在 Bochs 上会有更大的优化效果
+// 用这种方法, Primespipe 的运行速度快了3倍
+#define ASM 1
+
+int strlen(const char *s)
+{
+  800f89:	55                   	push   %rbp
+  800f8a:	48 89 e5             	mov    %rsp,%rbp
+  800f8d:	48 83 ec 18          	sub    $0x18,%rsp
+  800f91:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800f95:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800f9c:	eb 09                	jmp    800fa7 <strlen+0x1e>
+		n++;
+  800f9e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  800fa2:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800fa7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fab:	0f b6 00             	movzbl (%rax),%eax
+  800fae:	84 c0                	test   %al,%al
+  800fb0:	75 ec                	jne    800f9e <strlen+0x15>
+	return n;
+  800fb2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800fb5:	c9                   	leave
+  800fb6:	c3                   	ret
+
+0000000000800fb7 <strnlen>:
+
+int strnlen(const char *s, size_t size)
+{
+  800fb7:	55                   	push   %rbp
+  800fb8:	48 89 e5             	mov    %rsp,%rbp
+  800fbb:	48 83 ec 20          	sub    $0x20,%rsp
+  800fbf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800fc3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800fc7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800fce:	eb 0e                	jmp    800fde <strnlen+0x27>
+		n++;
+  800fd0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800fd4:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800fd9:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  800fde:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800fe3:	74 0b                	je     800ff0 <strnlen+0x39>
+  800fe5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fe9:	0f b6 00             	movzbl (%rax),%eax
+  800fec:	84 c0                	test   %al,%al
+  800fee:	75 e0                	jne    800fd0 <strnlen+0x19>
+	return n;
+  800ff0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800ff3:	c9                   	leave
+  800ff4:	c3                   	ret
+
+0000000000800ff5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800ff5:	55                   	push   %rbp
+  800ff6:	48 89 e5             	mov    %rsp,%rbp
+  800ff9:	48 83 ec 20          	sub    $0x20,%rsp
+  800ffd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801001:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801005:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801009:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  80100d:	90                   	nop
+  80100e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801012:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801016:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80101a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80101e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801022:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801026:	0f b6 12             	movzbl (%rdx),%edx
+  801029:	88 10                	mov    %dl,(%rax)
+  80102b:	0f b6 00             	movzbl (%rax),%eax
+  80102e:	84 c0                	test   %al,%al
+  801030:	75 dc                	jne    80100e <strcpy+0x19>
+		/* do nothing */;
+	return ret;
+  801032:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801036:	c9                   	leave
+  801037:	c3                   	ret
+
+0000000000801038 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801038:	55                   	push   %rbp
+  801039:	48 89 e5             	mov    %rsp,%rbp
+  80103c:	48 83 ec 20          	sub    $0x20,%rsp
+  801040:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801044:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int len = strlen(dst);
+  801048:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80104c:	48 89 c7             	mov    %rax,%rdi
+  80104f:	48 b8 89 0f 80 00 00 	movabs $0x800f89,%rax
+  801056:	00 00 00 
+  801059:	ff d0                	call   *%rax
+  80105b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	strcpy(dst + len, src);
+  80105e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801061:	48 63 d0             	movslq %eax,%rdx
+  801064:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801068:	48 01 c2             	add    %rax,%rdx
+  80106b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80106f:	48 89 c6             	mov    %rax,%rsi
+  801072:	48 89 d7             	mov    %rdx,%rdi
+  801075:	48 b8 f5 0f 80 00 00 	movabs $0x800ff5,%rax
+  80107c:	00 00 00 
+  80107f:	ff d0                	call   *%rax
+	return dst;
+  801081:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801085:	c9                   	leave
+  801086:	c3                   	ret
+
+0000000000801087 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  801087:	55                   	push   %rbp
+  801088:	48 89 e5             	mov    %rsp,%rbp
+  80108b:	48 83 ec 28          	sub    $0x28,%rsp
+  80108f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801093:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801097:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  80109b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80109f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++)
+  8010a3:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8010aa:	00 
+  8010ab:	eb 2a                	jmp    8010d7 <strncpy+0x50>
+	{
+		*dst++ = *src;
+  8010ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010b1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8010b5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8010b9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8010bd:	0f b6 12             	movzbl (%rdx),%edx
+  8010c0:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  8010c2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8010c6:	0f b6 00             	movzbl (%rax),%eax
+  8010c9:	84 c0                	test   %al,%al
+  8010cb:	74 05                	je     8010d2 <strncpy+0x4b>
+			src++;
+  8010cd:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++)
+  8010d2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8010d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010db:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8010df:	72 cc                	jb     8010ad <strncpy+0x26>
+	}
+	return ret;
+  8010e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8010e5:	c9                   	leave
+  8010e6:	c3                   	ret
+
+00000000008010e7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8010e7:	55                   	push   %rbp
+  8010e8:	48 89 e5             	mov    %rsp,%rbp
+  8010eb:	48 83 ec 28          	sub    $0x28,%rsp
+  8010ef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8010f3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8010f7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  8010fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010ff:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0)
+  801103:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801108:	74 3d                	je     801147 <strlcpy+0x60>
+	{
+		while (--size > 0 && *src != '\0')
+  80110a:	eb 1d                	jmp    801129 <strlcpy+0x42>
+			*dst++ = *src++;
+  80110c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801110:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801114:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801118:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80111c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801120:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801124:	0f b6 12             	movzbl (%rdx),%edx
+  801127:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801129:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80112e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801133:	74 0b                	je     801140 <strlcpy+0x59>
+  801135:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801139:	0f b6 00             	movzbl (%rax),%eax
+  80113c:	84 c0                	test   %al,%al
+  80113e:	75 cc                	jne    80110c <strlcpy+0x25>
+		*dst = '\0';
+  801140:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801144:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801147:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80114b:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80114f:	c9                   	leave
+  801150:	c3                   	ret
+
+0000000000801151 <strcmp>:
+
+int strcmp(const char *p, const char *q)
+{
+  801151:	55                   	push   %rbp
+  801152:	48 89 e5             	mov    %rsp,%rbp
+  801155:	48 83 ec 10          	sub    $0x10,%rsp
+  801159:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80115d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801161:	eb 0a                	jmp    80116d <strcmp+0x1c>
+		p++, q++;
+  801163:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801168:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  80116d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801171:	0f b6 00             	movzbl (%rax),%eax
+  801174:	84 c0                	test   %al,%al
+  801176:	74 12                	je     80118a <strcmp+0x39>
+  801178:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80117c:	0f b6 10             	movzbl (%rax),%edx
+  80117f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801183:	0f b6 00             	movzbl (%rax),%eax
+  801186:	38 c2                	cmp    %al,%dl
+  801188:	74 d9                	je     801163 <strcmp+0x12>
+	return (int)((unsigned char)*p - (unsigned char)*q);
+  80118a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80118e:	0f b6 00             	movzbl (%rax),%eax
+  801191:	0f b6 d0             	movzbl %al,%edx
+  801194:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801198:	0f b6 00             	movzbl (%rax),%eax
+  80119b:	0f b6 c0             	movzbl %al,%eax
+  80119e:	29 c2                	sub    %eax,%edx
+  8011a0:	89 d0                	mov    %edx,%eax
+}
+  8011a2:	c9                   	leave
+  8011a3:	c3                   	ret
+
+00000000008011a4 <strncmp>:
+
+int strncmp(const char *p, const char *q, size_t n)
+{
+  8011a4:	55                   	push   %rbp
+  8011a5:	48 89 e5             	mov    %rsp,%rbp
+  8011a8:	48 83 ec 18          	sub    $0x18,%rsp
+  8011ac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8011b0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8011b4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8011b8:	eb 0f                	jmp    8011c9 <strncmp+0x25>
+		n--, p++, q++;
+  8011ba:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8011bf:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8011c4:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8011c9:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8011ce:	74 1d                	je     8011ed <strncmp+0x49>
+  8011d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011d4:	0f b6 00             	movzbl (%rax),%eax
+  8011d7:	84 c0                	test   %al,%al
+  8011d9:	74 12                	je     8011ed <strncmp+0x49>
+  8011db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011df:	0f b6 10             	movzbl (%rax),%edx
+  8011e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011e6:	0f b6 00             	movzbl (%rax),%eax
+  8011e9:	38 c2                	cmp    %al,%dl
+  8011eb:	74 cd                	je     8011ba <strncmp+0x16>
+	if (n == 0)
+  8011ed:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8011f2:	75 07                	jne    8011fb <strncmp+0x57>
+		return 0;
+  8011f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011f9:	eb 16                	jmp    801211 <strncmp+0x6d>
+	else
+		return (int)((unsigned char)*p - (unsigned char)*q);
+  8011fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011ff:	0f b6 00             	movzbl (%rax),%eax
+  801202:	0f b6 d0             	movzbl %al,%edx
+  801205:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801209:	0f b6 00             	movzbl (%rax),%eax
+  80120c:	0f b6 c0             	movzbl %al,%eax
+  80120f:	29 c2                	sub    %eax,%edx
+}
+  801211:	89 d0                	mov    %edx,%eax
+  801213:	c9                   	leave
+  801214:	c3                   	ret
+
+0000000000801215 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801215:	55                   	push   %rbp
+  801216:	48 89 e5             	mov    %rsp,%rbp
+  801219:	48 83 ec 10          	sub    $0x10,%rsp
+  80121d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801221:	89 f0                	mov    %esi,%eax
+  801223:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801226:	eb 17                	jmp    80123f <strchr+0x2a>
+		if (*s == c)
+  801228:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80122c:	0f b6 00             	movzbl (%rax),%eax
+  80122f:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801232:	75 06                	jne    80123a <strchr+0x25>
+			return (char *)s;
+  801234:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801238:	eb 15                	jmp    80124f <strchr+0x3a>
+	for (; *s; s++)
+  80123a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80123f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801243:	0f b6 00             	movzbl (%rax),%eax
+  801246:	84 c0                	test   %al,%al
+  801248:	75 de                	jne    801228 <strchr+0x13>
+	return 0;
+  80124a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80124f:	c9                   	leave
+  801250:	c3                   	ret
+
+0000000000801251 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801251:	55                   	push   %rbp
+  801252:	48 89 e5             	mov    %rsp,%rbp
+  801255:	48 83 ec 10          	sub    $0x10,%rsp
+  801259:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80125d:	89 f0                	mov    %esi,%eax
+  80125f:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801262:	eb 11                	jmp    801275 <strfind+0x24>
+		if (*s == c)
+  801264:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801268:	0f b6 00             	movzbl (%rax),%eax
+  80126b:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80126e:	74 12                	je     801282 <strfind+0x31>
+	for (; *s; s++)
+  801270:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801275:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801279:	0f b6 00             	movzbl (%rax),%eax
+  80127c:	84 c0                	test   %al,%al
+  80127e:	75 e4                	jne    801264 <strfind+0x13>
+  801280:	eb 01                	jmp    801283 <strfind+0x32>
+			break;
+  801282:	90                   	nop
+	return (char *)s;
+  801283:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801287:	c9                   	leave
+  801288:	c3                   	ret
+
+0000000000801289 <mem_init>:
+};
+
+static int mem_features;
+
+void mem_init(void)
+{
+  801289:	55                   	push   %rbp
+  80128a:	48 89 e5             	mov    %rsp,%rbp
+  80128d:	48 83 ec 10          	sub    $0x10,%rsp
+	uint32_t max, ebx, edx;
+
+	mem_features = 0;
+  801291:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  801298:	00 00 00 
+  80129b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	cpuid(0, &max, NULL, NULL, NULL);
+  8012a1:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+  8012a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b5:	48 89 c6             	mov    %rax,%rsi
+  8012b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012bd:	48 b8 95 0e 80 00 00 	movabs $0x800e95,%rax
+  8012c4:	00 00 00 
+  8012c7:	ff d0                	call   *%rax
+	cpuid(1, NULL, NULL, NULL, &edx);
+  8012c9:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  8012cd:	49 89 c0             	mov    %rax,%r8
+  8012d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012da:	be 00 00 00 00       	mov    $0x0,%esi
+  8012df:	bf 01 00 00 00       	mov    $0x1,%edi
+  8012e4:	48 b8 95 0e 80 00 00 	movabs $0x800e95,%rax
+  8012eb:	00 00 00 
+  8012ee:	ff d0                	call   *%rax
+	if (edx & (1 << 26))
+  8012f0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8012f3:	25 00 00 00 04       	and    $0x4000000,%eax
+  8012f8:	85 c0                	test   %eax,%eax
+  8012fa:	74 1d                	je     801319 <mem_init+0x90>
+		mem_features |= MEM_F_NT;
+  8012fc:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  801303:	00 00 00 
+  801306:	8b 00                	mov    (%rax),%eax
+  801308:	83 c8 02             	or     $0x2,%eax
+  80130b:	89 c2                	mov    %eax,%edx
+  80130d:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  801314:	00 00 00 
+  801317:	89 10                	mov    %edx,(%rax)
+	if (max >= 7)
+  801319:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80131c:	83 f8 06             	cmp    $0x6,%eax
+  80131f:	76 57                	jbe    801378 <mem_init+0xef>
+	{
+		cpuid_count(7, 0, NULL, &ebx, NULL, NULL);
+  801321:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801325:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80132b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801331:	48 89 c1             	mov    %rax,%rcx
+  801334:	ba 00 00 00 00       	mov    $0x0,%edx
+  801339:	be 00 00 00 00       	mov    $0x0,%esi
+  80133e:	bf 07 00 00 00       	mov    $0x7,%edi
+  801343:	48 b8 0b 0f 80 00 00 	movabs $0x800f0b,%rax
+  80134a:	00 00 00 
+  80134d:	ff d0                	call   *%rax
+		if (ebx & (1 << 9))
+  80134f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801352:	25 00 02 00 00       	and    $0x200,%eax
+  801357:	85 c0                	test   %eax,%eax
+  801359:	74 1d                	je     801378 <mem_init+0xef>
+			mem_features |= MEM_F_ERMS;
+  80135b:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  801362:	00 00 00 
+  801365:	8b 00                	mov    (%rax),%eax
+  801367:	83 c8 01             	or     $0x1,%eax
+  80136a:	89 c2                	mov    %eax,%edx
+  80136c:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  801373:	00 00 00 
+  801376:	89 10                	mov    %edx,(%rax)
+	}
+}
+  801378:	90                   	nop
+  801379:	c9                   	leave
+  80137a:	c3                   	ret
+
+000000000080137b <memset_nt>:
+
+// 非临时存储填充 n 字节(v 8 字节对齐，n 为 32 的倍数)
+static void
+memset_nt(void *v, uint64_t pattern, size_t n)
+{
+  80137b:	55                   	push   %rbp
+  80137c:	48 89 e5             	mov    %rsp,%rbp
+  80137f:	48 83 ec 28          	sub    $0x28,%rsp
+  801383:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801387:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80138b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t *p = (uint64_t *)v;
+  80138f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801393:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint64_t *end = p + n / 8;
+  801397:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80139b:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  80139f:	48 89 c2             	mov    %rax,%rdx
+  8013a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013a6:	48 01 d0             	add    %rdx,%rax
+  8013a9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	for (; p < end; p += 4)
+  8013ad:	eb 20                	jmp    8013cf <memset_nt+0x54>
+		asm volatile("movnti %1, 0(%0)\n\t"
+  8013af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013b3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8013b7:	48 0f c3 10          	movnti %rdx,(%rax)
+  8013bb:	48 0f c3 50 08       	movnti %rdx,0x8(%rax)
+  8013c0:	48 0f c3 50 10       	movnti %rdx,0x10(%rax)
+  8013c5:	48 0f c3 50 18       	movnti %rdx,0x18(%rax)
+	for (; p < end; p += 4)
+  8013ca:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  8013cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013d3:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8013d7:	72 d6                	jb     8013af <memset_nt+0x34>
+					 "movnti %1, 16(%0)\n\t"
+					 "movnti %1, 24(%0)"
+					 :
+					 : "r"(p), "r"(pattern)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  8013d9:	0f ae f8             	sfence
+}
+  8013dc:	90                   	nop
+  8013dd:	c9                   	leave
+  8013de:	c3                   	ret
+
+00000000008013df <memcpy_nt>:
+
+// 非临时存储复制 n 字节(dst/src 8 字节对齐且不重叠，n 为 32 的倍数)
+static void
+memcpy_nt(void *dst, const void *src, size_t n)
+{
+  8013df:	55                   	push   %rbp
+  8013e0:	48 89 e5             	mov    %rsp,%rbp
+  8013e3:	48 83 ec 58          	sub    $0x58,%rsp
+  8013e7:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8013eb:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8013ef:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	uint64_t *d = (uint64_t *)dst;
+  8013f3:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8013f7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint64_t *s = (const uint64_t *)src;
+  8013fb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8013ff:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	uint64_t *end = d + n / 8;
+  801403:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801407:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  80140b:	48 89 c2             	mov    %rax,%rdx
+  80140e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801412:	48 01 d0             	add    %rdx,%rax
+  801415:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint64_t t0, t1, t2, t3;
+
+	for (; d < end; d += 4, s += 4)
+  801419:	eb 44                	jmp    80145f <memcpy_nt+0x80>
+		asm volatile("movq 0(%4), %0\n\t"
+  80141b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80141f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801423:	4c 8b 00             	mov    (%rax),%r8
+  801426:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  80142a:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  80142e:	48 8b 48 18          	mov    0x18(%rax),%rcx
+  801432:	4c 0f c3 02          	movnti %r8,(%rdx)
+  801436:	48 0f c3 7a 08       	movnti %rdi,0x8(%rdx)
+  80143b:	48 0f c3 72 10       	movnti %rsi,0x10(%rdx)
+  801440:	48 0f c3 4a 18       	movnti %rcx,0x18(%rdx)
+  801445:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  801449:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80144d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801451:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+	for (; d < end; d += 4, s += 4)
+  801455:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  80145a:	48 83 45 f0 20       	addq   $0x20,-0x10(%rbp)
+  80145f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801463:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  801467:	72 b2                	jb     80141b <memcpy_nt+0x3c>
+					 "movnti %2, 16(%5)\n\t"
+					 "movnti %3, 24(%5)"
+					 : "=&r"(t0), "=&r"(t1), "=&r"(t2), "=&r"(t3)
+					 : "r"(s), "r"(d)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  801469:	0f ae f8             	sfence
+}
+  80146c:	90                   	nop
+  80146d:	c9                   	leave
+  80146e:	c3                   	ret
+
+000000000080146f <memcpy_fwd>:
+
+// 正向复制(dst 在 src 之前或两者不重叠)
+static void
+memcpy_fwd(void *dst, const void *src, size_t n)
+{
+  80146f:	55                   	push   %rbp
+  801470:	48 89 e5             	mov    %rsp,%rbp
+  801473:	48 83 ec 18          	sub    $0x18,%rsp
+  801477:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80147b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80147f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  801483:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  80148a:	00 00 00 
+  80148d:	8b 00                	mov    (%rax),%eax
+  80148f:	83 e0 02             	and    $0x2,%eax
+  801492:	85 c0                	test   %eax,%eax
+  801494:	74 66                	je     8014fc <memcpy_fwd+0x8d>
+  801496:	48 81 7d e8 ff 0f 00 	cmpq   $0xfff,-0x18(%rbp)
+  80149d:	00 
+  80149e:	76 5c                	jbe    8014fc <memcpy_fwd+0x8d>
+  8014a0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8014a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014a8:	48 09 d0             	or     %rdx,%rax
+  8014ab:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  8014af:	83 e0 1f             	and    $0x1f,%eax
+  8014b2:	48 85 c0             	test   %rax,%rax
+  8014b5:	75 45                	jne    8014fc <memcpy_fwd+0x8d>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  8014b7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8014bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014bf:	48 01 d0             	add    %rdx,%rax
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  8014c2:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8014c6:	73 11                	jae    8014d9 <memcpy_fwd+0x6a>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  8014c8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8014cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014d0:	48 01 d0             	add    %rdx,%rax
+  8014d3:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8014d7:	72 23                	jb     8014fc <memcpy_fwd+0x8d>
+		memcpy_nt(dst, src, n);
+  8014d9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8014dd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8014e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014e5:	48 89 ce             	mov    %rcx,%rsi
+  8014e8:	48 89 c7             	mov    %rax,%rdi
+  8014eb:	48 b8 df 13 80 00 00 	movabs $0x8013df,%rax
+  8014f2:	00 00 00 
+  8014f5:	ff d0                	call   *%rax
+  8014f7:	e9 81 00 00 00       	jmp    80157d <memcpy_fwd+0x10e>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  8014fc:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  801503:	00 00 00 
+  801506:	8b 00                	mov    (%rax),%eax
+  801508:	83 e0 01             	and    $0x1,%eax
+  80150b:	85 c0                	test   %eax,%eax
+  80150d:	74 21                	je     801530 <memcpy_fwd+0xc1>
+  80150f:	48 81 7d e8 ff 00 00 	cmpq   $0xff,-0x18(%rbp)
+  801516:	00 
+  801517:	76 17                	jbe    801530 <memcpy_fwd+0xc1>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  801519:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80151d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801521:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801525:	48 89 c7             	mov    %rax,%rdi
+  801528:	48 89 d6             	mov    %rdx,%rsi
+  80152b:	fc                   	cld
+  80152c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80152e:	eb 4d                	jmp    80157d <memcpy_fwd+0x10e>
+					 : "cc", "memory");
+	else if ((((uint64_t)dst | (uint64_t)src | n) & 7) == 0)
+  801530:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801534:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801538:	48 09 d0             	or     %rdx,%rax
+  80153b:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  80153f:	83 e0 07             	and    $0x7,%eax
+  801542:	48 85 c0             	test   %rax,%rax
+  801545:	75 1f                	jne    801566 <memcpy_fwd+0xf7>
+		asm volatile("cld; rep movsq\n" ::"D"(dst), "S"(src), "c"(n / 8)
+  801547:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80154b:	48 c1 e8 03          	shr    $0x3,%rax
+  80154f:	48 89 c1             	mov    %rax,%rcx
+  801552:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801556:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80155a:	48 89 c7             	mov    %rax,%rdi
+  80155d:	48 89 d6             	mov    %rdx,%rsi
+  801560:	fc                   	cld
+  801561:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+					 : "cc", "memory");
+}
+  801564:	eb 17                	jmp    80157d <memcpy_fwd+0x10e>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  801566:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80156a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80156e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801572:	48 89 c7             	mov    %rax,%rdi
+  801575:	48 89 d6             	mov    %rdx,%rsi
+  801578:	fc                   	cld
+  801579:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+  80157b:	eb 00                	jmp    80157d <memcpy_fwd+0x10e>
+  80157d:	90                   	nop
+  80157e:	c9                   	leave
+  80157f:	c3                   	ret
+
+0000000000801580 <memset>:
+
+void *
+memset(void *v, int c, size_t n)
+{
+  801580:	55                   	push   %rbp
+  801581:	48 89 e5             	mov    %rsp,%rbp
+  801584:	48 83 ec 28          	sub    $0x28,%rsp
+  801588:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80158c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  80158f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t pattern;
+
+	if (n == 0)
+  801593:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801598:	75 09                	jne    8015a3 <memset+0x23>
+		return v;
+  80159a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80159e:	e9 dc 00 00 00       	jmp    80167f <memset+0xff>
+	c &= 0xFF;
+  8015a3:	81 65 e4 ff 00 00 00 	andl   $0xff,-0x1c(%rbp)
+	pattern = (uint64_t)c * 0x0101010101010101UL;
+  8015aa:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8015ad:	48 98                	cltq
+  8015af:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8015b6:	01 01 01 
+  8015b9:	48 0f af c2          	imul   %rdx,%rax
+  8015bd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)v | n) & 31) == 0)
+  8015c1:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  8015c8:	00 00 00 
+  8015cb:	8b 00                	mov    (%rax),%eax
+  8015cd:	83 e0 02             	and    $0x2,%eax
+  8015d0:	85 c0                	test   %eax,%eax
+  8015d2:	74 3a                	je     80160e <memset+0x8e>
+  8015d4:	48 81 7d d8 ff 0f 00 	cmpq   $0xfff,-0x28(%rbp)
+  8015db:	00 
+  8015dc:	76 30                	jbe    80160e <memset+0x8e>
+  8015de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015e2:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  8015e6:	83 e0 1f             	and    $0x1f,%eax
+  8015e9:	48 85 c0             	test   %rax,%rax
+  8015ec:	75 20                	jne    80160e <memset+0x8e>
+		memset_nt(v, pattern, n);
+  8015ee:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8015f2:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8015f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015fa:	48 89 ce             	mov    %rcx,%rsi
+  8015fd:	48 89 c7             	mov    %rax,%rdi
+  801600:	48 b8 7b 13 80 00 00 	movabs $0x80137b,%rax
+  801607:	00 00 00 
+  80160a:	ff d0                	call   *%rax
+  80160c:	eb 6d                	jmp    80167b <memset+0xfb>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  80160e:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  801615:	00 00 00 
+  801618:	8b 00                	mov    (%rax),%eax
+  80161a:	83 e0 01             	and    $0x1,%eax
+  80161d:	85 c0                	test   %eax,%eax
+  80161f:	74 1d                	je     80163e <memset+0xbe>
+  801621:	48 81 7d d8 ff 00 00 	cmpq   $0xff,-0x28(%rbp)
+  801628:	00 
+  801629:	76 13                	jbe    80163e <memset+0xbe>
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  80162b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80162f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801632:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801636:	48 89 d7             	mov    %rdx,%rdi
+  801639:	fc                   	cld
+  80163a:	f3 aa                	rep stos %al,%es:(%rdi)
+  80163c:	eb 3d                	jmp    80167b <memset+0xfb>
+					 : "cc", "memory");
+	else if ((((uint64_t)v | n) & 7) == 0)
+  80163e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801642:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  801646:	83 e0 07             	and    $0x7,%eax
+  801649:	48 85 c0             	test   %rax,%rax
+  80164c:	75 1c                	jne    80166a <memset+0xea>
+		asm volatile("cld; rep stosq\n" ::"D"(v), "a"(pattern), "c"(n / 8)
+  80164e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801652:	48 c1 e8 03          	shr    $0x3,%rax
+  801656:	48 89 c1             	mov    %rax,%rcx
+  801659:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80165d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801661:	48 89 d7             	mov    %rdx,%rdi
+  801664:	fc                   	cld
+  801665:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801668:	eb 11                	jmp    80167b <memset+0xfb>
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  80166a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80166e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801671:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801675:	48 89 d7             	mov    %rdx,%rdi
+  801678:	fc                   	cld
+  801679:	f3 aa                	rep stos %al,%es:(%rdi)
+					 : "cc", "memory");
+	return v;
+  80167b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80167f:	c9                   	leave
+  801680:	c3                   	ret
+
+0000000000801681 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801681:	55                   	push   %rbp
+  801682:	48 89 e5             	mov    %rsp,%rbp
+  801685:	48 83 ec 28          	sub    $0x28,%rsp
+  801689:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80168d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801691:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801695:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801699:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  80169d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016a1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d)
+  8016a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016a9:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8016ad:	73 7c                	jae    80172b <memmove+0xaa>
+  8016af:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8016b3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016b7:	48 01 d0             	add    %rdx,%rax
+  8016ba:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8016be:	73 6b                	jae    80172b <memmove+0xaa>
+	{
+		// 重叠且 dst 在 src 之后，只能反向复制(ERMS 对反向 rep movsb 没有优化)
+		s += n;
+  8016c0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016c4:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  8016c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016cc:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((((uint64_t)s | (uint64_t)d | n) & 7) == 0)
+  8016d0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8016d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016d8:	48 09 d0             	or     %rdx,%rax
+  8016db:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  8016df:	83 e0 07             	and    $0x7,%eax
+  8016e2:	48 85 c0             	test   %rax,%rax
+  8016e5:	75 24                	jne    80170b <memmove+0x8a>
+			asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8016e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016eb:	48 83 e8 08          	sub    $0x8,%rax
+  8016ef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8016f3:	48 83 ea 08          	sub    $0x8,%rdx
+  8016f7:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8016fb:	48 c1 e9 03          	shr    $0x3,%rcx
+  8016ff:	48 89 c7             	mov    %rax,%rdi
+  801702:	48 89 d6             	mov    %rdx,%rsi
+  801705:	fd                   	std
+  801706:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801709:	eb 1d                	jmp    801728 <memmove+0xa7>
+						 : "cc", "memory");
+		else
+			asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80170b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80170f:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801713:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801717:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+  80171b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80171f:	48 89 d7             	mov    %rdx,%rdi
+  801722:	48 89 c1             	mov    %rax,%rcx
+  801725:	fd                   	std
+  801726:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+						 : "cc", "memory");
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::
+  801728:	fc                   	cld
+  801729:	eb 25                	jmp    801750 <memmove+0xcf>
+						 : "cc");
+	}
+	else if (n)
+  80172b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801730:	74 1e                	je     801750 <memmove+0xcf>
+		memcpy_fwd(d, s, n);
+  801732:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801736:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80173a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80173e:	48 89 ce             	mov    %rcx,%rsi
+  801741:	48 89 c7             	mov    %rax,%rdi
+  801744:	48 b8 6f 14 80 00 00 	movabs $0x80146f,%rax
+  80174b:	00 00 00 
+  80174e:	ff d0                	call   *%rax
+	return dst;
+  801750:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801754:	c9                   	leave
+  801755:	c3                   	ret
+
+0000000000801756 <memcpy>:
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801756:	55                   	push   %rbp
+  801757:	48 89 e5             	mov    %rsp,%rbp
+  80175a:	48 83 ec 18          	sub    $0x18,%rsp
+  80175e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801762:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801766:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (n)
+  80176a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80176f:	74 1e                	je     80178f <memcpy+0x39>
+		memcpy_fwd(dst, src, n);
+  801771:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801775:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801779:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80177d:	48 89 ce             	mov    %rcx,%rsi
+  801780:	48 89 c7             	mov    %rax,%rdi
+  801783:	48 b8 6f 14 80 00 00 	movabs $0x80146f,%rax
+  80178a:	00 00 00 
+  80178d:	ff d0                	call   *%rax
+	return dst;
+  80178f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801793:	c9                   	leave
+  801794:	c3                   	ret
+
+0000000000801795 <memcmp>:
+{
+}
+#endif
+
+int memcmp(const void *v1, const void *v2, size_t n)
+{
+  801795:	55                   	push   %rbp
+  801796:	48 89 e5             	mov    %rsp,%rbp
+  801799:	48 83 ec 28          	sub    $0x28,%rsp
+  80179d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017a1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8017a5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *)v1;
+  8017a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017ad:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *)v2;
+  8017b1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017b5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0)
+  8017b9:	eb 34                	jmp    8017ef <memcmp+0x5a>
+	{
+		if (*s1 != *s2)
+  8017bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017bf:	0f b6 10             	movzbl (%rax),%edx
+  8017c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017c6:	0f b6 00             	movzbl (%rax),%eax
+  8017c9:	38 c2                	cmp    %al,%dl
+  8017cb:	74 18                	je     8017e5 <memcmp+0x50>
+			return (int)*s1 - (int)*s2;
+  8017cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017d1:	0f b6 00             	movzbl (%rax),%eax
+  8017d4:	0f b6 d0             	movzbl %al,%edx
+  8017d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017db:	0f b6 00             	movzbl (%rax),%eax
+  8017de:	0f b6 c0             	movzbl %al,%eax
+  8017e1:	29 c2                	sub    %eax,%edx
+  8017e3:	eb 20                	jmp    801805 <memcmp+0x70>
+		s1++, s2++;
+  8017e5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017ea:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0)
+  8017ef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017f3:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8017f7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8017fb:	48 85 c0             	test   %rax,%rax
+  8017fe:	75 bb                	jne    8017bb <memcmp+0x26>
+	}
+
+	return 0;
+  801800:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801805:	89 d0                	mov    %edx,%eax
+  801807:	c9                   	leave
+  801808:	c3                   	ret
+
+0000000000801809 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801809:	55                   	push   %rbp
+  80180a:	48 89 e5             	mov    %rsp,%rbp
+  80180d:	48 83 ec 28          	sub    $0x28,%rsp
+  801811:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801815:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801818:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *)s + n;
+  80181c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801820:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801824:	48 01 d0             	add    %rdx,%rax
+  801827:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  80182b:	eb 13                	jmp    801840 <memfind+0x37>
+		if (*(const unsigned char *)s == (unsigned char)c)
+  80182d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801831:	0f b6 00             	movzbl (%rax),%eax
+  801834:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801837:	38 d0                	cmp    %dl,%al
+  801839:	74 11                	je     80184c <memfind+0x43>
+	for (; s < ends; s++)
+  80183b:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801840:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801844:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801848:	72 e3                	jb     80182d <memfind+0x24>
+  80184a:	eb 01                	jmp    80184d <memfind+0x44>
+			break;
+  80184c:	90                   	nop
+	return (void *)s;
+  80184d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801851:	c9                   	leave
+  801852:	c3                   	ret
+
+0000000000801853 <strtol>:
+
+long strtol(const char *s, char **endptr, int base)
+{
+  801853:	55                   	push   %rbp
+  801854:	48 89 e5             	mov    %rsp,%rbp
+  801857:	48 83 ec 38          	sub    $0x38,%rsp
+  80185b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80185f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801863:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801866:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  80186d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801874:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801875:	eb 05                	jmp    80187c <strtol+0x29>
+		s++;
+  801877:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  80187c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801880:	0f b6 00             	movzbl (%rax),%eax
+  801883:	3c 20                	cmp    $0x20,%al
+  801885:	74 f0                	je     801877 <strtol+0x24>
+  801887:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80188b:	0f b6 00             	movzbl (%rax),%eax
+  80188e:	3c 09                	cmp    $0x9,%al
+  801890:	74 e5                	je     801877 <strtol+0x24>
+
+	// plus/minus sign
+	if (*s == '+')
+  801892:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801896:	0f b6 00             	movzbl (%rax),%eax
+  801899:	3c 2b                	cmp    $0x2b,%al
+  80189b:	75 07                	jne    8018a4 <strtol+0x51>
+		s++;
+  80189d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8018a2:	eb 17                	jmp    8018bb <strtol+0x68>
+	else if (*s == '-')
+  8018a4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018a8:	0f b6 00             	movzbl (%rax),%eax
+  8018ab:	3c 2d                	cmp    $0x2d,%al
+  8018ad:	75 0c                	jne    8018bb <strtol+0x68>
+		s++, neg = 1;
+  8018af:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8018b4:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8018bb:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8018bf:	74 06                	je     8018c7 <strtol+0x74>
+  8018c1:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  8018c5:	75 28                	jne    8018ef <strtol+0x9c>
+  8018c7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018cb:	0f b6 00             	movzbl (%rax),%eax
+  8018ce:	3c 30                	cmp    $0x30,%al
+  8018d0:	75 1d                	jne    8018ef <strtol+0x9c>
+  8018d2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018d6:	48 83 c0 01          	add    $0x1,%rax
+  8018da:	0f b6 00             	movzbl (%rax),%eax
+  8018dd:	3c 78                	cmp    $0x78,%al
+  8018df:	75 0e                	jne    8018ef <strtol+0x9c>
+		s += 2, base = 16;
+  8018e1:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8018e6:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8018ed:	eb 2c                	jmp    80191b <strtol+0xc8>
+	else if (base == 0 && s[0] == '0')
+  8018ef:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8018f3:	75 19                	jne    80190e <strtol+0xbb>
+  8018f5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018f9:	0f b6 00             	movzbl (%rax),%eax
+  8018fc:	3c 30                	cmp    $0x30,%al
+  8018fe:	75 0e                	jne    80190e <strtol+0xbb>
+		s++, base = 8;
+  801900:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801905:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  80190c:	eb 0d                	jmp    80191b <strtol+0xc8>
+	else if (base == 0)
+  80190e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801912:	75 07                	jne    80191b <strtol+0xc8>
+		base = 10;
+  801914:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+	// digits
+	while (1)
+	{
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  80191b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80191f:	0f b6 00             	movzbl (%rax),%eax
+  801922:	3c 2f                	cmp    $0x2f,%al
+  801924:	7e 1d                	jle    801943 <strtol+0xf0>
+  801926:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80192a:	0f b6 00             	movzbl (%rax),%eax
+  80192d:	3c 39                	cmp    $0x39,%al
+  80192f:	7f 12                	jg     801943 <strtol+0xf0>
+			dig = *s - '0';
+  801931:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801935:	0f b6 00             	movzbl (%rax),%eax
+  801938:	0f be c0             	movsbl %al,%eax
+  80193b:	83 e8 30             	sub    $0x30,%eax
+  80193e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801941:	eb 4e                	jmp    801991 <strtol+0x13e>
+		else if (*s >= 'a' && *s <= 'z')
+  801943:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801947:	0f b6 00             	movzbl (%rax),%eax
+  80194a:	3c 60                	cmp    $0x60,%al
+  80194c:	7e 1d                	jle    80196b <strtol+0x118>
+  80194e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801952:	0f b6 00             	movzbl (%rax),%eax
+  801955:	3c 7a                	cmp    $0x7a,%al
+  801957:	7f 12                	jg     80196b <strtol+0x118>
+			dig = *s - 'a' + 10;
+  801959:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80195d:	0f b6 00             	movzbl (%rax),%eax
+  801960:	0f be c0             	movsbl %al,%eax
+  801963:	83 e8 57             	sub    $0x57,%eax
+  801966:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801969:	eb 26                	jmp    801991 <strtol+0x13e>
+		else if (*s >= 'A' && *s <= 'Z')
+  80196b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80196f:	0f b6 00             	movzbl (%rax),%eax
+  801972:	3c 40                	cmp    $0x40,%al
+  801974:	7e 47                	jle    8019bd <strtol+0x16a>
+  801976:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80197a:	0f b6 00             	movzbl (%rax),%eax
+  80197d:	3c 5a                	cmp    $0x5a,%al
+  80197f:	7f 3c                	jg     8019bd <strtol+0x16a>
+			dig = *s - 'A' + 10;
+  801981:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801985:	0f b6 00             	movzbl (%rax),%eax
+  801988:	0f be c0             	movsbl %al,%eax
+  80198b:	83 e8 37             	sub    $0x37,%eax
+  80198e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801991:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801994:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801997:	7d 23                	jge    8019bc <strtol+0x169>
+			break;
+		s++, val = (val * base) + dig;
+  801999:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80199e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8019a1:	48 98                	cltq
+  8019a3:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  8019a8:	48 89 c2             	mov    %rax,%rdx
+  8019ab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8019ae:	48 98                	cltq
+  8019b0:	48 01 d0             	add    %rdx,%rax
+  8019b3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+  8019b7:	e9 5f ff ff ff       	jmp    80191b <strtol+0xc8>
+			break;
+  8019bc:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8019bd:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8019c2:	74 0b                	je     8019cf <strtol+0x17c>
+		*endptr = (char *)s;
+  8019c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019c8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8019cc:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  8019cf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8019d3:	74 09                	je     8019de <strtol+0x18b>
+  8019d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019d9:	48 f7 d8             	neg    %rax
+  8019dc:	eb 04                	jmp    8019e2 <strtol+0x18f>
+  8019de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8019e2:	c9                   	leave
+  8019e3:	c3                   	ret
+
+00000000008019e4 <strstr>:
+
+char *strstr(const char *in, const char *str)
+{
+  8019e4:	55                   	push   %rbp
+  8019e5:	48 89 e5             	mov    %rsp,%rbp
+  8019e8:	48 83 ec 30          	sub    $0x30,%rsp
+  8019ec:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8019f0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  8019f4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019f8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8019fc:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801a00:	0f b6 00             	movzbl (%rax),%eax
+  801a03:	88 45 ff             	mov    %al,-0x1(%rbp)
+	if (!c)
+  801a06:	80 7d ff 00          	cmpb   $0x0,-0x1(%rbp)
+  801a0a:	75 06                	jne    801a12 <strstr+0x2e>
+		return (char *)in; // Trivial empty string case
+  801a0c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a10:	eb 6b                	jmp    801a7d <strstr+0x99>
+
+	len = strlen(str);
+  801a12:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a16:	48 89 c7             	mov    %rax,%rdi
+  801a19:	48 b8 89 0f 80 00 00 	movabs $0x800f89,%rax
+  801a20:	00 00 00 
+  801a23:	ff d0                	call   *%rax
+  801a25:	48 98                	cltq
+  801a27:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+		char sc;
+
+		do
+		{
+			sc = *in++;
+  801a2b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a2f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a33:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801a37:	0f b6 00             	movzbl (%rax),%eax
+  801a3a:	88 45 ef             	mov    %al,-0x11(%rbp)
+			if (!sc)
+  801a3d:	80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+  801a41:	75 07                	jne    801a4a <strstr+0x66>
+				return (char *)0;
+  801a43:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a48:	eb 33                	jmp    801a7d <strstr+0x99>
+		} while (sc != c);
+  801a4a:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+  801a4e:	3a 45 ff             	cmp    -0x1(%rbp),%al
+  801a51:	75 d8                	jne    801a2b <strstr+0x47>
+	} while (strncmp(in, str, len) != 0);
+  801a53:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a57:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801a5b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a5f:	48 89 ce             	mov    %rcx,%rsi
+  801a62:	48 89 c7             	mov    %rax,%rdi
+  801a65:	48 b8 a4 11 80 00 00 	movabs $0x8011a4,%rax
+  801a6c:	00 00 00 
+  801a6f:	ff d0                	call   *%rax
+  801a71:	85 c0                	test   %eax,%eax
+  801a73:	75 b6                	jne    801a2b <strstr+0x47>
+
+	return (char *)(in - 1);
+  801a75:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a79:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801a7d:	c9                   	leave
+  801a7e:	c3                   	ret
+
+0000000000801a7f <syscall>:
+ * 用户的指令式系统调用，该函数将系统调用序号放入eax寄存器，五个参数依次放入edx, ecx, ebx, edi, esi，然后执行指令int 0x30，
+ * 发生中断后，去IDT中查找中断处理函数，最终会走到kern/trap.c的trap_dispatch()中
+ */
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801a7f:	55                   	push   %rbp
+  801a80:	48 89 e5             	mov    %rsp,%rbp
+  801a83:	53                   	push   %rbx
+  801a84:	48 83 ec 48          	sub    $0x48,%rsp
+  801a88:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801a8b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801a8e:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801a92:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801a96:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801a9a:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	 * volatile 告诉汇编程序不要因为不使用返回值就优化该指令
+	 * 最后一个子句告诉汇编程序，指令可能会改变条件代码cx和任意内存memory位置
+	 * 由汇编编译器做好数据保存和恢复工作(栈)
+	 */
+
+	asm volatile("int %1\n"			// code: int T_SYSCALL
+  801a9e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801aa1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801aa5:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801aa9:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801aad:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801ab1:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801ab5:	4c 89 c3             	mov    %r8,%rbx
+  801ab8:	cd 30                	int    $0x30
+  801aba:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+				   "D"(a4),			// edi = a4
+				   "S"(a5)			// esi = a5
+				 : "cc", "memory"); // 指令可能会改变条件代码cx和任意内存memory位置
+									// 由汇编编译器做好数据保存和恢复工作(栈)
+
+	if (check && ret > 0)
+  801abe:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801ac2:	74 44                	je     801b08 <syscall+0x89>
+  801ac4:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801ac9:	7e 3d                	jle    801b08 <syscall+0x89>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801acb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801acf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801ad2:	49 89 d0             	mov    %rdx,%r8
+  801ad5:	89 c1                	mov    %eax,%ecx
+  801ad7:	48 b8 c8 3c 80 00 00 	movabs $0x803cc8,%rax
+  801ade:	00 00 00 
+  801ae1:	48 89 c2             	mov    %rax,%rdx
+  801ae4:	be 34 00 00 00       	mov    $0x34,%esi
+  801ae9:	48 b8 e5 3c 80 00 00 	movabs $0x803ce5,%rax
+  801af0:	00 00 00 
+  801af3:	48 89 c7             	mov    %rax,%rdi
+  801af6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801afb:	49 b9 bc 34 80 00 00 	movabs $0x8034bc,%r9
+  801b02:	00 00 00 
+  801b05:	41 ff d1             	call   *%r9
+
+	return ret;
+  801b08:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801b0c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b10:	c9                   	leave
+  801b11:	c3                   	ret
+
+0000000000801b12 <sys_cputs>:
+
+void sys_cputs(const char *s, size_t len)
+{
+  801b12:	55                   	push   %rbp
+  801b13:	48 89 e5             	mov    %rsp,%rbp
+  801b16:	48 83 ec 10          	sub    $0x10,%rsp
+  801b1a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801b1e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 调用lib/syscall.c中的syscall()
+	// SYS_cputs: 系统调用序号(eax)，s: 需要输出的字符数组，len: 数组长度
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801b22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b26:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801b2a:	48 83 ec 08          	sub    $0x8,%rsp
+  801b2e:	6a 00                	push   $0x0
+  801b30:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b36:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b3c:	48 89 d1             	mov    %rdx,%rcx
+  801b3f:	48 89 c2             	mov    %rax,%rdx
+  801b42:	be 00 00 00 00       	mov    $0x0,%esi
+  801b47:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b4c:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  801b53:	00 00 00 
+  801b56:	ff d0                	call   *%rax
+  801b58:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801b5c:	90                   	nop
+  801b5d:	c9                   	leave
+  801b5e:	c3                   	ret
+
+0000000000801b5f <sys_cgetc>:
+
+int sys_cgetc(void)
+{
+  801b5f:	55                   	push   %rbp
+  801b60:	48 89 e5             	mov    %rsp,%rbp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801b63:	48 83 ec 08          	sub    $0x8,%rsp
+  801b67:	6a 00                	push   $0x0
+  801b69:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b6f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b75:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b7f:	be 00 00 00 00       	mov    $0x0,%esi
+  801b84:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b89:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  801b90:	00 00 00 
+  801b93:	ff d0                	call   *%rax
+  801b95:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801b99:	c9                   	leave
+  801b9a:	c3                   	ret
+
+0000000000801b9b <sys_env_destroy>:
+
+int sys_env_destroy(envid_t envid)
+{
+  801b9b:	55                   	push   %rbp
+  801b9c:	48 89 e5             	mov    %rsp,%rbp
+  801b9f:	48 83 ec 10          	sub    $0x10,%rsp
+  801ba3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	// 销毁envid对应的环境
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801ba6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ba9:	48 98                	cltq
+  801bab:	48 83 ec 08          	sub    $0x8,%rsp
+  801baf:	6a 00                	push   $0x0
+  801bb1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801bb7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801bbd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bc2:	48 89 c2             	mov    %rax,%rdx
+  801bc5:	be 01 00 00 00       	mov    $0x1,%esi
+  801bca:	bf 03 00 00 00       	mov    $0x3,%edi
+  801bcf:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  801bd6:	00 00 00 
+  801bd9:	ff d0                	call   *%rax
+  801bdb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801bdf:	c9                   	leave
+  801be0:	c3                   	ret
+
+0000000000801be1 <sys_getprocid>:
+
+envid_t
+sys_getprocid(void)
+{
+  801be1:	55                   	push   %rbp
+  801be2:	48 89 e5             	mov    %rsp,%rbp
+	// 获取当前用户环境id
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801be5:	48 83 ec 08          	sub    $0x8,%rsp
+  801be9:	6a 00                	push   $0x0
+  801beb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801bf1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801bf7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c01:	be 00 00 00 00       	mov    $0x0,%esi
+  801c06:	bf 02 00 00 00       	mov    $0x2,%edi
+  801c0b:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  801c12:	00 00 00 
+  801c15:	ff d0                	call   *%rax
+  801c17:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c1b:	c9                   	leave
+  801c1c:	c3                   	ret
+
+0000000000801c1d <sys_yield>:
+
+void sys_yield(void)
+{
+  801c1d:	55                   	push   %rbp
+  801c1e:	48 89 e5             	mov    %rsp,%rbp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801c21:	48 83 ec 08          	sub    $0x8,%rsp
+  801c25:	6a 00                	push   $0x0
+  801c27:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801c2d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c38:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c3d:	be 00 00 00 00       	mov    $0x0,%esi
+  801c42:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801c47:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  801c4e:	00 00 00 
+  801c51:	ff d0                	call   *%rax
+  801c53:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c57:	90                   	nop
+  801c58:	c9                   	leave
+  801c59:	c3                   	ret
+
+0000000000801c5a <sys_page_alloc>:
+
+int sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801c5a:	55                   	push   %rbp
+  801c5b:	48 89 e5             	mov    %rsp,%rbp
+  801c5e:	48 83 ec 10          	sub    $0x10,%rsp
+  801c62:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801c65:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801c69:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  801c6c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801c6f:	48 63 c8             	movslq %eax,%rcx
+  801c72:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c76:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801c79:	48 98                	cltq
+  801c7b:	48 83 ec 08          	sub    $0x8,%rsp
+  801c7f:	6a 00                	push   $0x0
+  801c81:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801c87:	49 89 c8             	mov    %rcx,%r8
+  801c8a:	48 89 d1             	mov    %rdx,%rcx
+  801c8d:	48 89 c2             	mov    %rax,%rdx
+  801c90:	be 01 00 00 00       	mov    $0x1,%esi
+  801c95:	bf 04 00 00 00       	mov    $0x4,%edi
+  801c9a:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  801ca1:	00 00 00 
+  801ca4:	ff d0                	call   *%rax
+  801ca6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801caa:	c9                   	leave
+  801cab:	c3                   	ret
+
+0000000000801cac <sys_page_map>:
+
+int sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801cac:	55                   	push   %rbp
+  801cad:	48 89 e5             	mov    %rsp,%rbp
+  801cb0:	48 83 ec 20          	sub    $0x20,%rsp
+  801cb4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801cb7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801cbb:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801cbe:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801cc2:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  801cc6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801cc9:	48 63 c8             	movslq %eax,%rcx
+  801ccc:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  801cd0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801cd3:	48 63 f0             	movslq %eax,%rsi
+  801cd6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801cda:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801cdd:	48 98                	cltq
+  801cdf:	48 83 ec 08          	sub    $0x8,%rsp
+  801ce3:	51                   	push   %rcx
+  801ce4:	49 89 f9             	mov    %rdi,%r9
+  801ce7:	49 89 f0             	mov    %rsi,%r8
+  801cea:	48 89 d1             	mov    %rdx,%rcx
+  801ced:	48 89 c2             	mov    %rax,%rdx
+  801cf0:	be 01 00 00 00       	mov    $0x1,%esi
+  801cf5:	bf 05 00 00 00       	mov    $0x5,%edi
+  801cfa:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  801d01:	00 00 00 
+  801d04:	ff d0                	call   *%rax
+  801d06:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d0a:	c9                   	leave
+  801d0b:	c3                   	ret
+
+0000000000801d0c <sys_page_unmap>:
+
+int sys_page_unmap(envid_t envid, void *va)
+{
+  801d0c:	55                   	push   %rbp
+  801d0d:	48 89 e5             	mov    %rsp,%rbp
+  801d10:	48 83 ec 10          	sub    $0x10,%rsp
+  801d14:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801d17:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  801d1b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d1f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d22:	48 98                	cltq
+  801d24:	48 83 ec 08          	sub    $0x8,%rsp
+  801d28:	6a 00                	push   $0x0
+  801d2a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d30:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d36:	48 89 d1             	mov    %rdx,%rcx
+  801d39:	48 89 c2             	mov    %rax,%rdx
+  801d3c:	be 01 00 00 00       	mov    $0x1,%esi
+  801d41:	bf 06 00 00 00       	mov    $0x6,%edi
+  801d46:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  801d4d:	00 00 00 
+  801d50:	ff d0                	call   *%rax
+  801d52:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d56:	c9                   	leave
+  801d57:	c3                   	ret
+
+0000000000801d58 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int sys_env_set_status(envid_t envid, int status)
+{
+  801d58:	55                   	push   %rbp
+  801d59:	48 89 e5             	mov    %rsp,%rbp
+  801d5c:	48 83 ec 10          	sub    $0x10,%rsp
+  801d60:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801d63:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801d66:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801d69:	48 63 d0             	movslq %eax,%rdx
+  801d6c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d6f:	48 98                	cltq
+  801d71:	48 83 ec 08          	sub    $0x8,%rsp
+  801d75:	6a 00                	push   $0x0
+  801d77:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d7d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d83:	48 89 d1             	mov    %rdx,%rcx
+  801d86:	48 89 c2             	mov    %rax,%rdx
+  801d89:	be 01 00 00 00       	mov    $0x1,%esi
+  801d8e:	bf 08 00 00 00       	mov    $0x8,%edi
+  801d93:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  801d9a:	00 00 00 
+  801d9d:	ff d0                	call   *%rax
+  801d9f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801da3:	c9                   	leave
+  801da4:	c3                   	ret
+
+0000000000801da5 <sys_env_set_trapframe>:
+
+int sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801da5:	55                   	push   %rbp
+  801da6:	48 89 e5             	mov    %rsp,%rbp
+  801da9:	48 83 ec 10          	sub    $0x10,%rsp
+  801dad:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801db0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  801db4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801db8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801dbb:	48 98                	cltq
+  801dbd:	48 83 ec 08          	sub    $0x8,%rsp
+  801dc1:	6a 00                	push   $0x0
+  801dc3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801dc9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801dcf:	48 89 d1             	mov    %rdx,%rcx
+  801dd2:	48 89 c2             	mov    %rax,%rdx
+  801dd5:	be 01 00 00 00       	mov    $0x1,%esi
+  801dda:	bf 09 00 00 00       	mov    $0x9,%edi
+  801ddf:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  801de6:	00 00 00 
+  801de9:	ff d0                	call   *%rax
+  801deb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801def:	c9                   	leave
+  801df0:	c3                   	ret
+
+0000000000801df1 <sys_env_set_pgfault_upcall>:
+
+int sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801df1:	55                   	push   %rbp
+  801df2:	48 89 e5             	mov    %rsp,%rbp
+  801df5:	48 83 ec 10          	sub    $0x10,%rsp
+  801df9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801dfc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  801e00:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e04:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e07:	48 98                	cltq
+  801e09:	48 83 ec 08          	sub    $0x8,%rsp
+  801e0d:	6a 00                	push   $0x0
+  801e0f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e15:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e1b:	48 89 d1             	mov    %rdx,%rcx
+  801e1e:	48 89 c2             	mov    %rax,%rdx
+  801e21:	be 01 00 00 00       	mov    $0x1,%esi
+  801e26:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801e2b:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  801e32:	00 00 00 
+  801e35:	ff d0                	call   *%rax
+  801e37:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e3b:	c9                   	leave
+  801e3c:	c3                   	ret
+
+0000000000801e3d <sys_ipc_try_send>:
+
+int sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  801e3d:	55                   	push   %rbp
+  801e3e:	48 89 e5             	mov    %rsp,%rbp
+  801e41:	48 83 ec 20          	sub    $0x20,%rsp
+  801e45:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e48:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801e4c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801e50:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  801e53:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801e56:	48 63 f0             	movslq %eax,%rsi
+  801e59:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801e5d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e60:	48 98                	cltq
+  801e62:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e66:	48 83 ec 08          	sub    $0x8,%rsp
+  801e6a:	6a 00                	push   $0x0
+  801e6c:	49 89 f1             	mov    %rsi,%r9
+  801e6f:	49 89 c8             	mov    %rcx,%r8
+  801e72:	48 89 d1             	mov    %rdx,%rcx
+  801e75:	48 89 c2             	mov    %rax,%rdx
+  801e78:	be 00 00 00 00       	mov    $0x0,%esi
+  801e7d:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801e82:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  801e89:	00 00 00 
+  801e8c:	ff d0                	call   *%rax
+  801e8e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e92:	c9                   	leave
+  801e93:	c3                   	ret
+
+0000000000801e94 <sys_ipc_recv>:
+
+int sys_ipc_recv(void *dstva)
+{
+  801e94:	55                   	push   %rbp
+  801e95:	48 89 e5             	mov    %rsp,%rbp
+  801e98:	48 83 ec 10          	sub    $0x10,%rsp
+  801e9c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  801ea0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ea4:	48 83 ec 08          	sub    $0x8,%rsp
+  801ea8:	6a 00                	push   $0x0
+  801eaa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801eb0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801eb6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ebb:	48 89 c2             	mov    %rax,%rdx
+  801ebe:	be 01 00 00 00       	mov    $0x1,%esi
+  801ec3:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801ec8:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  801ecf:	00 00 00 
+  801ed2:	ff d0                	call   *%rax
+  801ed4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ed8:	c9                   	leave
+  801ed9:	c3                   	ret
+
+0000000000801eda <sys_disk_io>:
+
+int sys_disk_io(int dev, uint64_t secno, void *va, size_t nsecs, int write)
+{
+  801eda:	55                   	push   %rbp
+  801edb:	48 89 e5             	mov    %rsp,%rbp
+  801ede:	48 83 ec 20          	sub    $0x20,%rsp
+  801ee2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801ee5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801ee9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801eed:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  801ef1:	44 89 45 f8          	mov    %r8d,-0x8(%rbp)
+	return syscall(SYS_disk_io, 0, dev, secno, (uint64_t)va, nsecs, write);
+  801ef5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801ef8:	48 63 c8             	movslq %eax,%rcx
+  801efb:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  801eff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f02:	48 98                	cltq
+  801f04:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  801f08:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801f0c:	48 83 ec 08          	sub    $0x8,%rsp
+  801f10:	51                   	push   %rcx
+  801f11:	49 89 f9             	mov    %rdi,%r9
+  801f14:	49 89 f0             	mov    %rsi,%r8
+  801f17:	48 89 d1             	mov    %rdx,%rcx
+  801f1a:	48 89 c2             	mov    %rax,%rdx
+  801f1d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f22:	bf 0e 00 00 00       	mov    $0xe,%edi
+  801f27:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  801f2e:	00 00 00 
+  801f31:	ff d0                	call   *%rax
+  801f33:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f37:	c9                   	leave
+  801f38:	c3                   	ret
+
+0000000000801f39 <sys_vma_alloc>:
+
+int sys_vma_alloc(envid_t envid, void *va, size_t len, int perm)
+{
+  801f39:	55                   	push   %rbp
+  801f3a:	48 89 e5             	mov    %rsp,%rbp
+  801f3d:	48 83 ec 20          	sub    $0x20,%rsp
+  801f41:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f44:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f48:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801f4c:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_vma_alloc, 1, envid, (uint64_t)va, len, perm, 0);
+  801f4f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801f52:	48 63 f0             	movslq %eax,%rsi
+  801f55:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801f59:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f5c:	48 98                	cltq
+  801f5e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801f62:	48 83 ec 08          	sub    $0x8,%rsp
+  801f66:	6a 00                	push   $0x0
+  801f68:	49 89 f1             	mov    %rsi,%r9
+  801f6b:	49 89 c8             	mov    %rcx,%r8
+  801f6e:	48 89 d1             	mov    %rdx,%rcx
+  801f71:	48 89 c2             	mov    %rax,%rdx
+  801f74:	be 01 00 00 00       	mov    $0x1,%esi
+  801f79:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801f7e:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  801f85:	00 00 00 
+  801f88:	ff d0                	call   *%rax
+  801f8a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f8e:	c9                   	leave
+  801f8f:	c3                   	ret
+
+0000000000801f90 <sys_vma_clear>:
+
+int sys_vma_clear(envid_t envid)
+{
+  801f90:	55                   	push   %rbp
+  801f91:	48 89 e5             	mov    %rsp,%rbp
+  801f94:	48 83 ec 10          	sub    $0x10,%rsp
+  801f98:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_vma_clear, 1, envid, 0, 0, 0, 0);
+  801f9b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f9e:	48 98                	cltq
+  801fa0:	48 83 ec 08          	sub    $0x8,%rsp
+  801fa4:	6a 00                	push   $0x0
+  801fa6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fb2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fb7:	48 89 c2             	mov    %rax,%rdx
+  801fba:	be 01 00 00 00       	mov    $0x1,%esi
+  801fbf:	bf 10 00 00 00       	mov    $0x10,%edi
+  801fc4:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  801fcb:	00 00 00 
+  801fce:	ff d0                	call   *%rax
+  801fd0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fd4:	c9                   	leave
+  801fd5:	c3                   	ret
+
+0000000000801fd6 <sys_trace_ctl>:
+
+int sys_trace_ctl(int enable)
+{
+  801fd6:	55                   	push   %rbp
+  801fd7:	48 89 e5             	mov    %rsp,%rbp
+  801fda:	48 83 ec 10          	sub    $0x10,%rsp
+  801fde:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_trace_ctl, 0, enable, 0, 0, 0, 0);
+  801fe1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fe4:	48 98                	cltq
+  801fe6:	48 83 ec 08          	sub    $0x8,%rsp
+  801fea:	6a 00                	push   $0x0
+  801fec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ff2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ff8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ffd:	48 89 c2             	mov    %rax,%rdx
+  802000:	be 00 00 00 00       	mov    $0x0,%esi
+  802005:	bf 11 00 00 00       	mov    $0x11,%edi
+  80200a:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  802011:	00 00 00 
+  802014:	ff d0                	call   *%rax
+  802016:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80201a:	c9                   	leave
+  80201b:	c3                   	ret
+
+000000000080201c <sys_trace_read>:
+
+int sys_trace_read(int cpu, uint64_t *seq, struct TraceEvent *buf, int n)
+{
+  80201c:	55                   	push   %rbp
+  80201d:	48 89 e5             	mov    %rsp,%rbp
+  802020:	48 83 ec 20          	sub    $0x20,%rsp
+  802024:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802027:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80202b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80202f:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_trace_read, 0, cpu, (uint64_t)seq, (uint64_t)buf, n, 0);
+  802032:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802035:	48 63 f0             	movslq %eax,%rsi
+  802038:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80203c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802040:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802043:	48 98                	cltq
+  802045:	48 83 ec 08          	sub    $0x8,%rsp
+  802049:	6a 00                	push   $0x0
+  80204b:	49 89 f1             	mov    %rsi,%r9
+  80204e:	49 89 c8             	mov    %rcx,%r8
+  802051:	48 89 d1             	mov    %rdx,%rcx
+  802054:	48 89 c2             	mov    %rax,%rdx
+  802057:	be 00 00 00 00       	mov    $0x0,%esi
+  80205c:	bf 12 00 00 00       	mov    $0x12,%edi
+  802061:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  802068:	00 00 00 
+  80206b:	ff d0                	call   *%rax
+  80206d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802071:	c9                   	leave
+  802072:	c3                   	ret
+
+0000000000802073 <sys_getrusage>:
+
+int sys_getrusage(envid_t envid, struct Rusage *ru)
+{
+  802073:	55                   	push   %rbp
+  802074:	48 89 e5             	mov    %rsp,%rbp
+  802077:	48 83 ec 10          	sub    $0x10,%rsp
+  80207b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80207e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_getrusage, 0, envid, (uint64_t)ru, 0, 0, 0);
+  802082:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802086:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802089:	48 98                	cltq
+  80208b:	48 83 ec 08          	sub    $0x8,%rsp
+  80208f:	6a 00                	push   $0x0
+  802091:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802097:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80209d:	48 89 d1             	mov    %rdx,%rcx
+  8020a0:	48 89 c2             	mov    %rax,%rdx
+  8020a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8020a8:	bf 13 00 00 00       	mov    $0x13,%edi
+  8020ad:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  8020b4:	00 00 00 
+  8020b7:	ff d0                	call   *%rax
+  8020b9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020bd:	c9                   	leave
+  8020be:	c3                   	ret
+
+00000000008020bf <sys_pmu_config>:
+
+int sys_pmu_config(int idx, uint64_t event)
+{
+  8020bf:	55                   	push   %rbp
+  8020c0:	48 89 e5             	mov    %rsp,%rbp
+  8020c3:	48 83 ec 10          	sub    $0x10,%rsp
+  8020c7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020ca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_pmu_config, 0, idx, event, 0, 0, 0);
+  8020ce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020d1:	48 98                	cltq
+  8020d3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8020d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8020db:	6a 00                	push   $0x0
+  8020dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020e9:	48 89 d1             	mov    %rdx,%rcx
+  8020ec:	48 89 c2             	mov    %rax,%rdx
+  8020ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8020f4:	bf 14 00 00 00       	mov    $0x14,%edi
+  8020f9:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  802100:	00 00 00 
+  802103:	ff d0                	call   *%rax
+  802105:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802109:	c9                   	leave
+  80210a:	c3                   	ret
+
+000000000080210b <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  80210b:	55                   	push   %rbp
+  80210c:	48 89 e5             	mov    %rsp,%rbp
+  80210f:	48 83 ec 10          	sub    $0x10,%rsp
+  802113:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+  802116:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802119:	48 83 ec 08          	sub    $0x8,%rsp
+  80211d:	6a 00                	push   $0x0
+  80211f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802125:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80212b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802130:	48 89 c2             	mov    %rax,%rdx
+  802133:	be 00 00 00 00       	mov    $0x0,%esi
+  802138:	bf 15 00 00 00       	mov    $0x15,%edi
+  80213d:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  802144:	00 00 00 
+  802147:	ff d0                	call   *%rax
+  802149:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80214d:	c9                   	leave
+  80214e:	c3                   	ret
+
+000000000080214f <sys_image_attach>:
+
+int sys_image_attach(envid_t envid, int dev, const uint64_t *secnos, size_t size)
+{
+  80214f:	55                   	push   %rbp
+  802150:	48 89 e5             	mov    %rsp,%rbp
+  802153:	48 83 ec 20          	sub    $0x20,%rsp
+  802157:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80215a:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  80215d:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  802161:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+	return syscall(SYS_image_attach, 1, envid, dev, (uint64_t)secnos, size, 0);
+  802165:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802169:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80216c:	48 63 d0             	movslq %eax,%rdx
+  80216f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802172:	48 98                	cltq
+  802174:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802178:	48 83 ec 08          	sub    $0x8,%rsp
+  80217c:	6a 00                	push   $0x0
+  80217e:	49 89 f1             	mov    %rsi,%r9
+  802181:	49 89 c8             	mov    %rcx,%r8
+  802184:	48 89 d1             	mov    %rdx,%rcx
+  802187:	48 89 c2             	mov    %rax,%rdx
+  80218a:	be 01 00 00 00       	mov    $0x1,%esi
+  80218f:	bf 16 00 00 00       	mov    $0x16,%edi
+  802194:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  80219b:	00 00 00 
+  80219e:	ff d0                	call   *%rax
+  8021a0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021a4:	c9                   	leave
+  8021a5:	c3                   	ret
+
+00000000008021a6 <sys_vma_binary>:
+
+int sys_vma_binary(envid_t envid, const struct Proghdr *ph)
+{
+  8021a6:	55                   	push   %rbp
+  8021a7:	48 89 e5             	mov    %rsp,%rbp
+  8021aa:	48 83 ec 10          	sub    $0x10,%rsp
+  8021ae:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021b1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_vma_binary, 1, envid, (uint64_t)ph, 0, 0, 0);
+  8021b5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021bc:	48 98                	cltq
+  8021be:	48 83 ec 08          	sub    $0x8,%rsp
+  8021c2:	6a 00                	push   $0x0
+  8021c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021d0:	48 89 d1             	mov    %rdx,%rcx
+  8021d3:	48 89 c2             	mov    %rax,%rdx
+  8021d6:	be 01 00 00 00       	mov    $0x1,%esi
+  8021db:	bf 17 00 00 00       	mov    $0x17,%edi
+  8021e0:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  8021e7:	00 00 00 
+  8021ea:	ff d0                	call   *%rax
+  8021ec:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021f0:	c9                   	leave
+  8021f1:	c3                   	ret
+
+00000000008021f2 <fd2num>:
+/* ------------------------------- 文件描述符 ------------------------------- */
+
+// 返回 fd 的文件描述符号
+uint64_t
+fd2num(struct Fd *fd)
+{
+  8021f2:	55                   	push   %rbp
+  8021f3:	48 89 e5             	mov    %rsp,%rbp
+  8021f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8021fa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8021fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802202:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802209:	ff ff ff 
+  80220c:	48 01 d0             	add    %rdx,%rax
+  80220f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802213:	c9                   	leave
+  802214:	c3                   	ret
+
+0000000000802215 <fd2data>:
+
+// 返回 fd 的数据窗口
+char *
+fd2data(struct Fd *fd)
+{
+  802215:	55                   	push   %rbp
+  802216:	48 89 e5             	mov    %rsp,%rbp
+  802219:	48 83 ec 18          	sub    $0x18,%rsp
+  80221d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  802221:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802225:	48 89 c7             	mov    %rax,%rdi
+  802228:	48 b8 f2 21 80 00 00 	movabs $0x8021f2,%rax
+  80222f:	00 00 00 
+  802232:	ff d0                	call   *%rax
+  802234:	48 89 c1             	mov    %rax,%rcx
+  802237:	48 c7 45 f8 00 00 20 	movq   $0x200000,-0x8(%rbp)
+  80223e:	00 
+  80223f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802243:	48 05 ff 9f 40 00    	add    $0x409fff,%rax
+  802249:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80224d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802251:	ba 00 00 00 00       	mov    $0x0,%edx
+  802256:	48 f7 75 f8          	divq   -0x8(%rbp)
+  80225a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80225e:	48 29 d0             	sub    %rdx,%rax
+  802261:	48 98                	cltq
+  802263:	48 0f af c1          	imul   %rcx,%rax
+  802267:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  80226c:	48 01 d0             	add    %rdx,%rax
+}
+  80226f:	c9                   	leave
+  802270:	c3                   	ret
+
+0000000000802271 <fd_alloc>:
+ * 找到编号最小的未使用的文件描述符(其 Fd 页未映射)，存入 *fd_store，但不分配 Fd 页
+ * 调用者需要在其上分配一个页面，否则该文件描述符不会被使用
+ * 所有文件描述符都已使用时返回 -E_MAX_OPEN，*fd_store 为 0
+ */
+int fd_alloc(struct Fd **fd_store)
+{
+  802271:	55                   	push   %rbp
+  802272:	48 89 e5             	mov    %rsp,%rbp
+  802275:	48 83 ec 20          	sub    $0x20,%rsp
+  802279:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++)
+  80227d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802284:	eb 41                	jmp    8022c7 <fd_alloc+0x56>
+	{
+		fd = INDEX2FD(i);
+  802286:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802289:	c1 e0 0c             	shl    $0xc,%eax
+  80228c:	48 98                	cltq
+  80228e:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802293:	48 01 d0             	add    %rdx,%rax
+  802296:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+		if (pageref(fd) == 0)
+  80229a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80229e:	48 89 c7             	mov    %rax,%rdi
+  8022a1:	48 b8 45 34 80 00 00 	movabs $0x803445,%rax
+  8022a8:	00 00 00 
+  8022ab:	ff d0                	call   *%rax
+  8022ad:	85 c0                	test   %eax,%eax
+  8022af:	75 12                	jne    8022c3 <fd_alloc+0x52>
+		{
+			*fd_store = fd;
+  8022b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022b5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022b9:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  8022bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c1:	eb 1a                	jmp    8022dd <fd_alloc+0x6c>
+	for (i = 0; i < MAXFD; i++)
+  8022c3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8022c7:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8022cb:	7e b9                	jle    802286 <fd_alloc+0x15>
+		}
+	}
+	*fd_store = 0;
+  8022cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022d1:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  8022d8:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  8022dd:	c9                   	leave
+  8022de:	c3                   	ret
+
+00000000008022df <fd_lookup>:
+/**
+ * 检查 fdnum 是否在范围内且已映射，是则 *fd_store 为对应的 Fd 页
+ * 否则返回 -E_INVAL
+ */
+int fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8022df:	55                   	push   %rbp
+  8022e0:	48 89 e5             	mov    %rsp,%rbp
+  8022e3:	48 83 ec 20          	sub    $0x20,%rsp
+  8022e7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8022ea:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD)
+  8022ee:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8022f2:	78 06                	js     8022fa <fd_lookup+0x1b>
+  8022f4:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8022f8:	7e 07                	jle    802301 <fd_lookup+0x22>
+	{
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisproc->proc_id, fdnum);
+		return -E_INVAL;
+  8022fa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022ff:	eb 42                	jmp    802343 <fd_lookup+0x64>
+	}
+	fd = INDEX2FD(fdnum);
+  802301:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802304:	c1 e0 0c             	shl    $0xc,%eax
+  802307:	48 98                	cltq
+  802309:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  80230e:	48 01 d0             	add    %rdx,%rax
+  802311:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (pageref(fd) == 0)
+  802315:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802319:	48 89 c7             	mov    %rax,%rdi
+  80231c:	48 b8 45 34 80 00 00 	movabs $0x803445,%rax
+  802323:	00 00 00 
+  802326:	ff d0                	call   *%rax
+  802328:	85 c0                	test   %eax,%eax
+  80232a:	75 07                	jne    802333 <fd_lookup+0x54>
+	{
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisproc->proc_id, fdnum);
+		return -E_INVAL;
+  80232c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802331:	eb 10                	jmp    802343 <fd_lookup+0x64>
+	}
+	*fd_store = fd;
+  802333:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802337:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80233b:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  80233e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802343:	c9                   	leave
+  802344:	c3                   	ret
+
+0000000000802345 <fd_close>:
+/**
+ * 关闭文件描述符 fd 并释放其 Fd 页
+ * must_exist 为 0 时，fd 不是有效的打开文件描述符则直接返回 0；否则返回 fd_lookup 的错误
+ */
+int fd_close(struct Fd *fd, bool must_exist)
+{
+  802345:	55                   	push   %rbp
+  802346:	48 89 e5             	mov    %rsp,%rbp
+  802349:	48 83 ec 30          	sub    $0x30,%rsp
+  80234d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802351:	89 f0                	mov    %esi,%eax
+  802353:	88 45 d4             	mov    %al,-0x2c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  802356:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80235a:	48 89 c7             	mov    %rax,%rdi
+  80235d:	48 b8 f2 21 80 00 00 	movabs $0x8021f2,%rax
+  802364:	00 00 00 
+  802367:	ff d0                	call   *%rax
+  802369:	89 c2                	mov    %eax,%edx
+  80236b:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80236f:	48 89 c6             	mov    %rax,%rsi
+  802372:	89 d7                	mov    %edx,%edi
+  802374:	48 b8 df 22 80 00 00 	movabs $0x8022df,%rax
+  80237b:	00 00 00 
+  80237e:	ff d0                	call   *%rax
+  802380:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802383:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802387:	78 0a                	js     802393 <fd_close+0x4e>
+  802389:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80238d:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  802391:	74 12                	je     8023a5 <fd_close+0x60>
+		return (must_exist ? r : 0);
+  802393:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  802397:	74 05                	je     80239e <fd_close+0x59>
+  802399:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80239c:	eb 70                	jmp    80240e <fd_close+0xc9>
+  80239e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023a3:	eb 69                	jmp    80240e <fd_close+0xc9>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0)
+  8023a5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023a9:	8b 00                	mov    (%rax),%eax
+  8023ab:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8023af:	48 89 d6             	mov    %rdx,%rsi
+  8023b2:	89 c7                	mov    %eax,%edi
+  8023b4:	48 b8 10 24 80 00 00 	movabs $0x802410,%rax
+  8023bb:	00 00 00 
+  8023be:	ff d0                	call   *%rax
+  8023c0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8023c3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8023c7:	78 2a                	js     8023f3 <fd_close+0xae>
+	{
+		if (dev->dev_close)
+  8023c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023cd:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8023d1:	48 85 c0             	test   %rax,%rax
+  8023d4:	74 16                	je     8023ec <fd_close+0xa7>
+			r = (*dev->dev_close)(fd);
+  8023d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023da:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8023de:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023e2:	48 89 c7             	mov    %rax,%rdi
+  8023e5:	ff d2                	call   *%rdx
+  8023e7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8023ea:	eb 07                	jmp    8023f3 <fd_close+0xae>
+		else
+			r = 0;
+  8023ec:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	}
+	// 此时 fd 可能已被设备释放，再次释放是安全的
+	(void)sys_page_unmap(0, fd);
+  8023f3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023f7:	48 89 c6             	mov    %rax,%rsi
+  8023fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023ff:	48 b8 0c 1d 80 00 00 	movabs $0x801d0c,%rax
+  802406:	00 00 00 
+  802409:	ff d0                	call   *%rax
+	return r;
+  80240b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80240e:	c9                   	leave
+  80240f:	c3                   	ret
+
+0000000000802410 <dev_lookup>:
+	{
+		&devfile,
+		0};
+
+int dev_lookup(int dev_id, struct Dev **dev)
+{
+  802410:	55                   	push   %rbp
+  802411:	48 89 e5             	mov    %rsp,%rbp
+  802414:	48 83 ec 20          	sub    $0x20,%rsp
+  802418:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80241b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int i;
+
+	for (i = 0; devtab[i]; i++)
+  80241f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802426:	eb 3f                	jmp    802467 <dev_lookup+0x57>
+		if (devtab[i]->dev_id == dev_id)
+  802428:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80242f:	00 00 00 
+  802432:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802435:	48 98                	cltq
+  802437:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80243b:	8b 00                	mov    (%rax),%eax
+  80243d:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  802440:	75 21                	jne    802463 <dev_lookup+0x53>
+		{
+			*dev = devtab[i];
+  802442:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  802449:	00 00 00 
+  80244c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80244f:	48 98                	cltq
+  802451:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802455:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802459:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  80245c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802461:	eb 62                	jmp    8024c5 <dev_lookup+0xb5>
+	for (i = 0; devtab[i]; i++)
+  802463:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802467:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80246e:	00 00 00 
+  802471:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802474:	48 98                	cltq
+  802476:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80247a:	48 85 c0             	test   %rax,%rax
+  80247d:	75 a9                	jne    802428 <dev_lookup+0x18>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisproc->proc_id, dev_id);
+  80247f:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802486:	00 00 00 
+  802489:	48 8b 00             	mov    (%rax),%rax
+  80248c:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  802492:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802495:	89 c6                	mov    %eax,%esi
+  802497:	48 b8 f8 3c 80 00 00 	movabs $0x803cf8,%rax
+  80249e:	00 00 00 
+  8024a1:	48 89 c7             	mov    %rax,%rdi
+  8024a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a9:	48 b9 6e 03 80 00 00 	movabs $0x80036e,%rcx
+  8024b0:	00 00 00 
+  8024b3:	ff d1                	call   *%rcx
+	*dev = 0;
+  8024b5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8024b9:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  8024c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8024c5:	c9                   	leave
+  8024c6:	c3                   	ret
+
+00000000008024c7 <close>:
+
+int close(int fdnum)
+{
+  8024c7:	55                   	push   %rbp
+  8024c8:	48 89 e5             	mov    %rsp,%rbp
+  8024cb:	48 83 ec 20          	sub    $0x20,%rsp
+  8024cf:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024d2:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8024d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8024d9:	48 89 d6             	mov    %rdx,%rsi
+  8024dc:	89 c7                	mov    %eax,%edi
+  8024de:	48 b8 df 22 80 00 00 	movabs $0x8022df,%rax
+  8024e5:	00 00 00 
+  8024e8:	ff d0                	call   *%rax
+  8024ea:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8024ed:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8024f1:	79 05                	jns    8024f8 <close+0x31>
+		return r;
+  8024f3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024f6:	eb 18                	jmp    802510 <close+0x49>
+	else
+		return fd_close(fd, 1);
+  8024f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8024fc:	be 01 00 00 00       	mov    $0x1,%esi
+  802501:	48 89 c7             	mov    %rax,%rdi
+  802504:	48 b8 45 23 80 00 00 	movabs $0x802345,%rax
+  80250b:	00 00 00 
+  80250e:	ff d0                	call   *%rax
+}
+  802510:	c9                   	leave
+  802511:	c3                   	ret
+
+0000000000802512 <close_all>:
+
+void close_all(void)
+{
+  802512:	55                   	push   %rbp
+  802513:	48 89 e5             	mov    %rsp,%rbp
+  802516:	48 83 ec 10          	sub    $0x10,%rsp
+	int i;
+
+	for (i = 0; i < MAXFD; i++)
+  80251a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802521:	eb 15                	jmp    802538 <close_all+0x26>
+		close(i);
+  802523:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802526:	89 c7                	mov    %eax,%edi
+  802528:	48 b8 c7 24 80 00 00 	movabs $0x8024c7,%rax
+  80252f:	00 00 00 
+  802532:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  802534:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802538:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80253c:	7e e5                	jle    802523 <close_all+0x11>
+}
+  80253e:	90                   	nop
+  80253f:	90                   	nop
+  802540:	c9                   	leave
+  802541:	c3                   	ret
+
+0000000000802542 <dup>:
+/**
+ * 将 oldfdnum 复制为 newfdnum(先关闭 newfdnum)
+ * 复制的两个文件描述符共享 Fd 页和数据窗口
+ */
+int dup(int oldfdnum, int newfdnum)
+{
+  802542:	55                   	push   %rbp
+  802543:	48 89 e5             	mov    %rsp,%rbp
+  802546:	48 83 ec 60          	sub    $0x60,%rsp
+  80254a:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  80254d:	89 75 a8             	mov    %esi,-0x58(%rbp)
+	int r;
+	char *ova, *nva;
+	uintptr_t off;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802550:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+  802554:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802557:	48 89 d6             	mov    %rdx,%rsi
+  80255a:	89 c7                	mov    %eax,%edi
+  80255c:	48 b8 df 22 80 00 00 	movabs $0x8022df,%rax
+  802563:	00 00 00 
+  802566:	ff d0                	call   *%rax
+  802568:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80256b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80256f:	79 08                	jns    802579 <dup+0x37>
+		return r;
+  802571:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802574:	e9 1d 02 00 00       	jmp    802796 <dup+0x254>
+	close(newfdnum);
+  802579:	8b 45 a8             	mov    -0x58(%rbp),%eax
+  80257c:	89 c7                	mov    %eax,%edi
+  80257e:	48 b8 c7 24 80 00 00 	movabs $0x8024c7,%rax
+  802585:	00 00 00 
+  802588:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  80258a:	8b 45 a8             	mov    -0x58(%rbp),%eax
+  80258d:	c1 e0 0c             	shl    $0xc,%eax
+  802590:	48 98                	cltq
+  802592:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802597:	48 01 d0             	add    %rdx,%rax
+  80259a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	ova = fd2data(oldfd);
+  80259e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8025a2:	48 89 c7             	mov    %rax,%rdi
+  8025a5:	48 b8 15 22 80 00 00 	movabs $0x802215,%rax
+  8025ac:	00 00 00 
+  8025af:	ff d0                	call   *%rax
+  8025b1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	nva = fd2data(newfd);
+  8025b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8025b9:	48 89 c7             	mov    %rax,%rdi
+  8025bc:	48 b8 15 22 80 00 00 	movabs $0x802215,%rax
+  8025c3:	00 00 00 
+  8025c6:	ff d0                	call   *%rax
+  8025c8:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+	for (off = 0; off < FILEWINDOW; off += PGSIZE)
+  8025cc:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8025d3:	00 
+  8025d4:	e9 8f 00 00 00       	jmp    802668 <dup+0x126>
+		if (va_is_mapped(ova + off))
+  8025d9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8025dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8025e1:	48 01 d0             	add    %rdx,%rax
+  8025e4:	48 89 c7             	mov    %rax,%rdi
+  8025e7:	48 b8 a4 33 80 00 00 	movabs $0x8033a4,%rax
+  8025ee:	00 00 00 
+  8025f1:	ff d0                	call   *%rax
+  8025f3:	84 c0                	test   %al,%al
+  8025f5:	74 69                	je     802660 <dup+0x11e>
+			if ((r = sys_page_map(0, ova + off, 0, nva + off,
+								  uvpt[VPN(ova + off)] & PTE_SYSCALL)) < 0)
+  8025f7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8025fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8025ff:	48 01 d0             	add    %rdx,%rax
+  802602:	48 c1 e8 0c          	shr    $0xc,%rax
+  802606:	48 89 c2             	mov    %rax,%rdx
+  802609:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802610:	01 00 00 
+  802613:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+			if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  802617:	25 07 0e 00 00       	and    $0xe07,%eax
+  80261c:	89 c6                	mov    %eax,%esi
+  80261e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802622:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802626:	48 01 c2             	add    %rax,%rdx
+  802629:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80262d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802631:	48 01 c8             	add    %rcx,%rax
+  802634:	41 89 f0             	mov    %esi,%r8d
+  802637:	48 89 d1             	mov    %rdx,%rcx
+  80263a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80263f:	48 89 c6             	mov    %rax,%rsi
+  802642:	bf 00 00 00 00       	mov    $0x0,%edi
+  802647:	48 b8 ac 1c 80 00 00 	movabs $0x801cac,%rax
+  80264e:	00 00 00 
+  802651:	ff d0                	call   *%rax
+  802653:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802656:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80265a:	0f 88 96 00 00 00    	js     8026f6 <dup+0x1b4>
+	for (off = 0; off < FILEWINDOW; off += PGSIZE)
+  802660:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  802667:	00 
+  802668:	48 c7 45 d0 00 00 20 	movq   $0x200000,-0x30(%rbp)
+  80266f:	00 
+  802670:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802674:	48 05 ff 9f 40 00    	add    $0x409fff,%rax
+  80267a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80267e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802682:	ba 00 00 00 00       	mov    $0x0,%edx
+  802687:	48 f7 75 d0          	divq   -0x30(%rbp)
+  80268b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80268f:	48 29 d0             	sub    %rdx,%rax
+  802692:	48 98                	cltq
+  802694:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  802698:	0f 82 3b ff ff ff    	jb     8025d9 <dup+0x97>
+				goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[VPN(oldfd)] & PTE_SYSCALL)) < 0)
+  80269e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8026a2:	48 c1 e8 0c          	shr    $0xc,%rax
+  8026a6:	48 89 c2             	mov    %rax,%rdx
+  8026a9:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8026b0:	01 00 00 
+  8026b3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8026b7:	25 07 0e 00 00       	and    $0xe07,%eax
+  8026bc:	89 c1                	mov    %eax,%ecx
+  8026be:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8026c2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8026c6:	41 89 c8             	mov    %ecx,%r8d
+  8026c9:	48 89 d1             	mov    %rdx,%rcx
+  8026cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026d1:	48 89 c6             	mov    %rax,%rsi
+  8026d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026d9:	48 b8 ac 1c 80 00 00 	movabs $0x801cac,%rax
+  8026e0:	00 00 00 
+  8026e3:	ff d0                	call   *%rax
+  8026e5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8026e8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8026ec:	78 0b                	js     8026f9 <dup+0x1b7>
+		goto err;
+
+	return newfdnum;
+  8026ee:	8b 45 a8             	mov    -0x58(%rbp),%eax
+  8026f1:	e9 a0 00 00 00       	jmp    802796 <dup+0x254>
+				goto err;
+  8026f6:	90                   	nop
+  8026f7:	eb 01                	jmp    8026fa <dup+0x1b8>
+		goto err;
+  8026f9:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  8026fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026fe:	48 89 c6             	mov    %rax,%rsi
+  802701:	bf 00 00 00 00       	mov    $0x0,%edi
+  802706:	48 b8 0c 1d 80 00 00 	movabs $0x801d0c,%rax
+  80270d:	00 00 00 
+  802710:	ff d0                	call   *%rax
+	for (off = 0; off < FILEWINDOW; off += PGSIZE)
+  802712:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802719:	00 
+  80271a:	eb 45                	jmp    802761 <dup+0x21f>
+		if (va_is_mapped(nva + off))
+  80271c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802720:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802724:	48 01 d0             	add    %rdx,%rax
+  802727:	48 89 c7             	mov    %rax,%rdi
+  80272a:	48 b8 a4 33 80 00 00 	movabs $0x8033a4,%rax
+  802731:	00 00 00 
+  802734:	ff d0                	call   *%rax
+  802736:	84 c0                	test   %al,%al
+  802738:	74 1f                	je     802759 <dup+0x217>
+			sys_page_unmap(0, nva + off);
+  80273a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80273e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802742:	48 01 d0             	add    %rdx,%rax
+  802745:	48 89 c6             	mov    %rax,%rsi
+  802748:	bf 00 00 00 00       	mov    $0x0,%edi
+  80274d:	48 b8 0c 1d 80 00 00 	movabs $0x801d0c,%rax
+  802754:	00 00 00 
+  802757:	ff d0                	call   *%rax
+	for (off = 0; off < FILEWINDOW; off += PGSIZE)
+  802759:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  802760:	00 
+  802761:	48 c7 45 c0 00 00 20 	movq   $0x200000,-0x40(%rbp)
+  802768:	00 
+  802769:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80276d:	48 05 ff 9f 40 00    	add    $0x409fff,%rax
+  802773:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802777:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80277b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802780:	48 f7 75 c0          	divq   -0x40(%rbp)
+  802784:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802788:	48 29 d0             	sub    %rdx,%rax
+  80278b:	48 98                	cltq
+  80278d:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  802791:	72 89                	jb     80271c <dup+0x1da>
+	return r;
+  802793:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802796:	c9                   	leave
+  802797:	c3                   	ret
+
+0000000000802798 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802798:	55                   	push   %rbp
+  802799:	48 89 e5             	mov    %rsp,%rbp
+  80279c:	48 83 ec 40          	sub    $0x40,%rsp
+  8027a0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8027a3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8027a7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8027ab:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8027af:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8027b2:	48 89 d6             	mov    %rdx,%rsi
+  8027b5:	89 c7                	mov    %eax,%edi
+  8027b7:	48 b8 df 22 80 00 00 	movabs $0x8022df,%rax
+  8027be:	00 00 00 
+  8027c1:	ff d0                	call   *%rax
+  8027c3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8027c6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8027ca:	78 24                	js     8027f0 <read+0x58>
+  8027cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027d0:	8b 00                	mov    (%rax),%eax
+  8027d2:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8027d6:	48 89 d6             	mov    %rdx,%rsi
+  8027d9:	89 c7                	mov    %eax,%edi
+  8027db:	48 b8 10 24 80 00 00 	movabs $0x802410,%rax
+  8027e2:	00 00 00 
+  8027e5:	ff d0                	call   *%rax
+  8027e7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8027ea:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8027ee:	79 05                	jns    8027f5 <read+0x5d>
+		return r;
+  8027f0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8027f3:	eb 7d                	jmp    802872 <read+0xda>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8027f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027f9:	8b 40 08             	mov    0x8(%rax),%eax
+  8027fc:	83 e0 03             	and    $0x3,%eax
+  8027ff:	83 f8 01             	cmp    $0x1,%eax
+  802802:	75 3d                	jne    802841 <read+0xa9>
+	{
+		cprintf("[%08x] read %d -- bad mode\n", thisproc->proc_id, fdnum);
+  802804:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80280b:	00 00 00 
+  80280e:	48 8b 00             	mov    (%rax),%rax
+  802811:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  802817:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80281a:	89 c6                	mov    %eax,%esi
+  80281c:	48 b8 17 3d 80 00 00 	movabs $0x803d17,%rax
+  802823:	00 00 00 
+  802826:	48 89 c7             	mov    %rax,%rdi
+  802829:	b8 00 00 00 00       	mov    $0x0,%eax
+  80282e:	48 b9 6e 03 80 00 00 	movabs $0x80036e,%rcx
+  802835:	00 00 00 
+  802838:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80283a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80283f:	eb 31                	jmp    802872 <read+0xda>
+	}
+	if (!dev->dev_read)
+  802841:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802845:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802849:	48 85 c0             	test   %rax,%rax
+  80284c:	75 07                	jne    802855 <read+0xbd>
+		return -E_NOT_SUPP;
+  80284e:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802853:	eb 1d                	jmp    802872 <read+0xda>
+	return (*dev->dev_read)(fd, buf, n);
+  802855:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802859:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  80285d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802861:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802865:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802869:	48 89 ce             	mov    %rcx,%rsi
+  80286c:	48 89 c7             	mov    %rax,%rdi
+  80286f:	41 ff d0             	call   *%r8
+}
+  802872:	c9                   	leave
+  802873:	c3                   	ret
+
+0000000000802874 <readn>:
+
+// 读满 n 字节，或遇到文件末尾/错误为止
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802874:	55                   	push   %rbp
+  802875:	48 89 e5             	mov    %rsp,%rbp
+  802878:	48 83 ec 30          	sub    $0x30,%rsp
+  80287c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80287f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802883:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m)
+  802887:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80288e:	eb 47                	jmp    8028d7 <readn+0x63>
+	{
+		m = read(fdnum, (char *)buf + tot, n - tot);
+  802890:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802893:	48 98                	cltq
+  802895:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802899:	48 29 c2             	sub    %rax,%rdx
+  80289c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80289f:	48 63 c8             	movslq %eax,%rcx
+  8028a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8028a6:	48 01 c1             	add    %rax,%rcx
+  8028a9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8028ac:	48 89 ce             	mov    %rcx,%rsi
+  8028af:	89 c7                	mov    %eax,%edi
+  8028b1:	48 b8 98 27 80 00 00 	movabs $0x802798,%rax
+  8028b8:	00 00 00 
+  8028bb:	ff d0                	call   *%rax
+  8028bd:	89 45 f8             	mov    %eax,-0x8(%rbp)
+		if (m < 0)
+  8028c0:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8028c4:	79 05                	jns    8028cb <readn+0x57>
+			return m;
+  8028c6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8028c9:	eb 1d                	jmp    8028e8 <readn+0x74>
+		if (m == 0)
+  8028cb:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8028cf:	74 13                	je     8028e4 <readn+0x70>
+	for (tot = 0; tot < n; tot += m)
+  8028d1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8028d4:	01 45 fc             	add    %eax,-0x4(%rbp)
+  8028d7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8028da:	48 98                	cltq
+  8028dc:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8028e0:	72 ae                	jb     802890 <readn+0x1c>
+  8028e2:	eb 01                	jmp    8028e5 <readn+0x71>
+			break;
+  8028e4:	90                   	nop
+	}
+	return tot;
+  8028e5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8028e8:	c9                   	leave
+  8028e9:	c3                   	ret
+
+00000000008028ea <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8028ea:	55                   	push   %rbp
+  8028eb:	48 89 e5             	mov    %rsp,%rbp
+  8028ee:	48 83 ec 40          	sub    $0x40,%rsp
+  8028f2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8028f5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8028f9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8028fd:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802901:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802904:	48 89 d6             	mov    %rdx,%rsi
+  802907:	89 c7                	mov    %eax,%edi
+  802909:	48 b8 df 22 80 00 00 	movabs $0x8022df,%rax
+  802910:	00 00 00 
+  802913:	ff d0                	call   *%rax
+  802915:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802918:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80291c:	78 24                	js     802942 <write+0x58>
+  80291e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802922:	8b 00                	mov    (%rax),%eax
+  802924:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802928:	48 89 d6             	mov    %rdx,%rsi
+  80292b:	89 c7                	mov    %eax,%edi
+  80292d:	48 b8 10 24 80 00 00 	movabs $0x802410,%rax
+  802934:	00 00 00 
+  802937:	ff d0                	call   *%rax
+  802939:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80293c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802940:	79 05                	jns    802947 <write+0x5d>
+		return r;
+  802942:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802945:	eb 7c                	jmp    8029c3 <write+0xd9>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802947:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80294b:	8b 40 08             	mov    0x8(%rax),%eax
+  80294e:	83 e0 03             	and    $0x3,%eax
+  802951:	85 c0                	test   %eax,%eax
+  802953:	75 3d                	jne    802992 <write+0xa8>
+	{
+		cprintf("[%08x] write %d -- bad mode\n", thisproc->proc_id, fdnum);
+  802955:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80295c:	00 00 00 
+  80295f:	48 8b 00             	mov    (%rax),%rax
+  802962:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  802968:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80296b:	89 c6                	mov    %eax,%esi
+  80296d:	48 b8 33 3d 80 00 00 	movabs $0x803d33,%rax
+  802974:	00 00 00 
+  802977:	48 89 c7             	mov    %rax,%rdi
+  80297a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80297f:	48 b9 6e 03 80 00 00 	movabs $0x80036e,%rcx
+  802986:	00 00 00 
+  802989:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80298b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802990:	eb 31                	jmp    8029c3 <write+0xd9>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+				fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802992:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802996:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80299a:	48 85 c0             	test   %rax,%rax
+  80299d:	75 07                	jne    8029a6 <write+0xbc>
+		return -E_NOT_SUPP;
+  80299f:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8029a4:	eb 1d                	jmp    8029c3 <write+0xd9>
+	return (*dev->dev_write)(fd, buf, n);
+  8029a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8029aa:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8029ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029b2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8029b6:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8029ba:	48 89 ce             	mov    %rcx,%rsi
+  8029bd:	48 89 c7             	mov    %rax,%rdi
+  8029c0:	41 ff d0             	call   *%r8
+}
+  8029c3:	c9                   	leave
+  8029c4:	c3                   	ret
+
+00000000008029c5 <seek>:
+
+int seek(int fdnum, off_t offset)
+{
+  8029c5:	55                   	push   %rbp
+  8029c6:	48 89 e5             	mov    %rsp,%rbp
+  8029c9:	48 83 ec 20          	sub    $0x20,%rsp
+  8029cd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8029d0:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029d3:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8029d7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8029da:	48 89 d6             	mov    %rdx,%rsi
+  8029dd:	89 c7                	mov    %eax,%edi
+  8029df:	48 b8 df 22 80 00 00 	movabs $0x8022df,%rax
+  8029e6:	00 00 00 
+  8029e9:	ff d0                	call   *%rax
+  8029eb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8029ee:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8029f2:	79 05                	jns    8029f9 <seek+0x34>
+		return r;
+  8029f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8029f7:	eb 0f                	jmp    802a08 <seek+0x43>
+	fd->fd_offset = offset;
+  8029f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8029fd:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802a00:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  802a03:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a08:	c9                   	leave
+  802a09:	c3                   	ret
+
+0000000000802a0a <ftruncate>:
+
+int ftruncate(int fdnum, off_t newsize)
+{
+  802a0a:	55                   	push   %rbp
+  802a0b:	48 89 e5             	mov    %rsp,%rbp
+  802a0e:	48 83 ec 30          	sub    $0x30,%rsp
+  802a12:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802a15:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802a18:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802a1c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802a1f:	48 89 d6             	mov    %rdx,%rsi
+  802a22:	89 c7                	mov    %eax,%edi
+  802a24:	48 b8 df 22 80 00 00 	movabs $0x8022df,%rax
+  802a2b:	00 00 00 
+  802a2e:	ff d0                	call   *%rax
+  802a30:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802a33:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802a37:	78 24                	js     802a5d <ftruncate+0x53>
+  802a39:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a3d:	8b 00                	mov    (%rax),%eax
+  802a3f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802a43:	48 89 d6             	mov    %rdx,%rsi
+  802a46:	89 c7                	mov    %eax,%edi
+  802a48:	48 b8 10 24 80 00 00 	movabs $0x802410,%rax
+  802a4f:	00 00 00 
+  802a52:	ff d0                	call   *%rax
+  802a54:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802a57:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802a5b:	79 05                	jns    802a62 <ftruncate+0x58>
+		return r;
+  802a5d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a60:	eb 75                	jmp    802ad7 <ftruncate+0xcd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802a62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a66:	8b 40 08             	mov    0x8(%rax),%eax
+  802a69:	83 e0 03             	and    $0x3,%eax
+  802a6c:	85 c0                	test   %eax,%eax
+  802a6e:	75 3d                	jne    802aad <ftruncate+0xa3>
+	{
+		cprintf("[%08x] ftruncate %d -- bad mode\n", thisproc->proc_id, fdnum);
+  802a70:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802a77:	00 00 00 
+  802a7a:	48 8b 00             	mov    (%rax),%rax
+  802a7d:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  802a83:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802a86:	89 c6                	mov    %eax,%esi
+  802a88:	48 b8 50 3d 80 00 00 	movabs $0x803d50,%rax
+  802a8f:	00 00 00 
+  802a92:	48 89 c7             	mov    %rax,%rdi
+  802a95:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a9a:	48 b9 6e 03 80 00 00 	movabs $0x80036e,%rcx
+  802aa1:	00 00 00 
+  802aa4:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  802aa6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802aab:	eb 2a                	jmp    802ad7 <ftruncate+0xcd>
+	}
+	if (!dev->dev_trunc)
+  802aad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ab1:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802ab5:	48 85 c0             	test   %rax,%rax
+  802ab8:	75 07                	jne    802ac1 <ftruncate+0xb7>
+		return -E_NOT_SUPP;
+  802aba:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802abf:	eb 16                	jmp    802ad7 <ftruncate+0xcd>
+	return (*dev->dev_trunc)(fd, newsize);
+  802ac1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ac5:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  802ac9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802acd:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802ad0:	89 d6                	mov    %edx,%esi
+  802ad2:	48 89 c7             	mov    %rax,%rdi
+  802ad5:	ff d1                	call   *%rcx
+}
+  802ad7:	c9                   	leave
+  802ad8:	c3                   	ret
+
+0000000000802ad9 <fstat>:
+
+int fstat(int fdnum, struct Stat *stat)
+{
+  802ad9:	55                   	push   %rbp
+  802ada:	48 89 e5             	mov    %rsp,%rbp
+  802add:	48 83 ec 30          	sub    $0x30,%rsp
+  802ae1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802ae4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802ae8:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802aec:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802aef:	48 89 d6             	mov    %rdx,%rsi
+  802af2:	89 c7                	mov    %eax,%edi
+  802af4:	48 b8 df 22 80 00 00 	movabs $0x8022df,%rax
+  802afb:	00 00 00 
+  802afe:	ff d0                	call   *%rax
+  802b00:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802b03:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b07:	78 24                	js     802b2d <fstat+0x54>
+  802b09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b0d:	8b 00                	mov    (%rax),%eax
+  802b0f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802b13:	48 89 d6             	mov    %rdx,%rsi
+  802b16:	89 c7                	mov    %eax,%edi
+  802b18:	48 b8 10 24 80 00 00 	movabs $0x802410,%rax
+  802b1f:	00 00 00 
+  802b22:	ff d0                	call   *%rax
+  802b24:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802b27:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b2b:	79 05                	jns    802b32 <fstat+0x59>
+		return r;
+  802b2d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b30:	eb 5e                	jmp    802b90 <fstat+0xb7>
+	if (!dev->dev_stat)
+  802b32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b36:	48 8b 40 28          	mov    0x28(%rax),%rax
+  802b3a:	48 85 c0             	test   %rax,%rax
+  802b3d:	75 07                	jne    802b46 <fstat+0x6d>
+		return -E_NOT_SUPP;
+  802b3f:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802b44:	eb 4a                	jmp    802b90 <fstat+0xb7>
+	stat->st_name[0] = 0;
+  802b46:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b4a:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  802b4d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b51:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  802b58:	00 00 00 
+	stat->st_isdir = 0;
+  802b5b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b5f:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  802b66:	00 00 00 
+	stat->st_dev = dev;
+  802b69:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b6d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b71:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  802b78:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b7c:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  802b80:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b84:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802b88:	48 89 d6             	mov    %rdx,%rsi
+  802b8b:	48 89 c7             	mov    %rax,%rdi
+  802b8e:	ff d1                	call   *%rcx
+}
+  802b90:	c9                   	leave
+  802b91:	c3                   	ret
+
+0000000000802b92 <stat>:
+
+int stat(const char *path, struct Stat *stat)
+{
+  802b92:	55                   	push   %rbp
+  802b93:	48 89 e5             	mov    %rsp,%rbp
+  802b96:	48 83 ec 20          	sub    $0x20,%rsp
+  802b9a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802b9e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802ba2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ba6:	be 00 00 00 00       	mov    $0x0,%esi
+  802bab:	48 89 c7             	mov    %rax,%rdi
+  802bae:	48 b8 80 2c 80 00 00 	movabs $0x802c80,%rax
+  802bb5:	00 00 00 
+  802bb8:	ff d0                	call   *%rax
+  802bba:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802bbd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802bc1:	79 05                	jns    802bc8 <stat+0x36>
+		return fd;
+  802bc3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802bc6:	eb 2f                	jmp    802bf7 <stat+0x65>
+	r = fstat(fd, stat);
+  802bc8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802bcc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802bcf:	48 89 d6             	mov    %rdx,%rsi
+  802bd2:	89 c7                	mov    %eax,%edi
+  802bd4:	48 b8 d9 2a 80 00 00 	movabs $0x802ad9,%rax
+  802bdb:	00 00 00 
+  802bde:	ff d0                	call   *%rax
+  802be0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+	close(fd);
+  802be3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802be6:	89 c7                	mov    %eax,%edi
+  802be8:	48 b8 c7 24 80 00 00 	movabs $0x8024c7,%rax
+  802bef:	00 00 00 
+  802bf2:	ff d0                	call   *%rax
+	return r;
+  802bf4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802bf7:	c9                   	leave
+  802bf8:	c3                   	ret
+
+0000000000802bf9 <fsipc>:
+ * dstva 非空时，服务器返回的页映射到 dstva
+ * 返回服务器的结果
+ */
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802bf9:	55                   	push   %rbp
+  802bfa:	48 89 e5             	mov    %rsp,%rbp
+  802bfd:	48 83 ec 10          	sub    $0x10,%rsp
+  802c01:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802c04:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	static envid_t fsenv;
+
+	if (fsenv == 0)
+  802c08:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  802c0f:	00 00 00 
+  802c12:	8b 00                	mov    (%rax),%eax
+  802c14:	85 c0                	test   %eax,%eax
+  802c16:	75 1d                	jne    802c35 <fsipc+0x3c>
+		fsenv = ipc_find_env(PROC_TYPE_FS);
+  802c18:	bf 01 00 00 00       	mov    $0x1,%edi
+  802c1d:	48 b8 76 37 80 00 00 	movabs $0x803776,%rax
+  802c24:	00 00 00 
+  802c27:	ff d0                	call   *%rax
+  802c29:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  802c30:	00 00 00 
+  802c33:	89 02                	mov    %eax,(%rdx)
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisproc->proc_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802c35:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  802c3c:	00 00 00 
+  802c3f:	8b 00                	mov    (%rax),%eax
+  802c41:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  802c44:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802c49:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  802c50:	00 00 00 
+  802c53:	89 c7                	mov    %eax,%edi
+  802c55:	48 b8 c0 36 80 00 00 	movabs $0x8036c0,%rax
+  802c5c:	00 00 00 
+  802c5f:	ff d0                	call   *%rax
+	return ipc_recv(NULL, dstva, NULL);
+  802c61:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c65:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c6a:	48 89 c6             	mov    %rax,%rsi
+  802c6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c72:	48 b8 d6 35 80 00 00 	movabs $0x8035d6,%rax
+  802c79:	00 00 00 
+  802c7c:	ff d0                	call   *%rax
+}
+  802c7e:	c9                   	leave
+  802c7f:	c3                   	ret
+
+0000000000802c80 <open>:
+ *   -E_BAD_PATH: 路径太长
+ *   -E_MAX_OPEN: 文件描述符已用完
+ *   以及服务器返回的错误
+ */
+int open(const char *path, int mode)
+{
+  802c80:	55                   	push   %rbp
+  802c81:	48 89 e5             	mov    %rsp,%rbp
+  802c84:	48 83 ec 20          	sub    $0x20,%rsp
+  802c88:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802c8c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802c8f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c93:	48 89 c7             	mov    %rax,%rdi
+  802c96:	48 b8 89 0f 80 00 00 	movabs $0x800f89,%rax
+  802c9d:	00 00 00 
+  802ca0:	ff d0                	call   *%rax
+  802ca2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802ca7:	7e 0a                	jle    802cb3 <open+0x33>
+		return -E_BAD_PATH;
+  802ca9:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802cae:	e9 a8 00 00 00       	jmp    802d5b <open+0xdb>
+
+	if ((r = fd_alloc(&fd)) < 0)
+  802cb3:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802cb7:	48 89 c7             	mov    %rax,%rdi
+  802cba:	48 b8 71 22 80 00 00 	movabs $0x802271,%rax
+  802cc1:	00 00 00 
+  802cc4:	ff d0                	call   *%rax
+  802cc6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cc9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ccd:	79 08                	jns    802cd7 <open+0x57>
+		return r;
+  802ccf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cd2:	e9 84 00 00 00       	jmp    802d5b <open+0xdb>
+
+	strcpy(fsipcbuf.open.req_path, path);
+  802cd7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cdb:	48 89 c6             	mov    %rax,%rsi
+  802cde:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  802ce5:	00 00 00 
+  802ce8:	48 89 c7             	mov    %rax,%rdi
+  802ceb:	48 b8 f5 0f 80 00 00 	movabs $0x800ff5,%rax
+  802cf2:	00 00 00 
+  802cf5:	ff d0                	call   *%rax
+	fsipcbuf.open.req_omode = mode;
+  802cf7:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  802cfe:	00 00 00 
+  802d01:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802d04:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+	// 服务器返回的 Fd 页映射到 fd
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0)
+  802d0a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d0e:	48 89 c6             	mov    %rax,%rsi
+  802d11:	bf 01 00 00 00       	mov    $0x1,%edi
+  802d16:	48 b8 f9 2b 80 00 00 	movabs $0x802bf9,%rax
+  802d1d:	00 00 00 
+  802d20:	ff d0                	call   *%rax
+  802d22:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d25:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d29:	79 1d                	jns    802d48 <open+0xc8>
+	{
+		fd_close(fd, 0);
+  802d2b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d2f:	be 00 00 00 00       	mov    $0x0,%esi
+  802d34:	48 89 c7             	mov    %rax,%rdi
+  802d37:	48 b8 45 23 80 00 00 	movabs $0x802345,%rax
+  802d3e:	00 00 00 
+  802d41:	ff d0                	call   *%rax
+		return r;
+  802d43:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d46:	eb 13                	jmp    802d5b <open+0xdb>
+	}
+
+	return fd2num(fd);
+  802d48:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d4c:	48 89 c7             	mov    %rax,%rdi
+  802d4f:	48 b8 f2 21 80 00 00 	movabs $0x8021f2,%rax
+  802d56:	00 00 00 
+  802d59:	ff d0                	call   *%rax
+}
+  802d5b:	c9                   	leave
+  802d5c:	c3                   	ret
+
+0000000000802d5d <fexec>:
+ * 把打开的程序文件 fdnum 设为子环境 child 的程序映像，供 spawn 使用
+ * 之后用 sys_vma_binary() 登记的程序段由内核按需从该文件填充
+ * 错误时返回 < 0: fdnum 不是打开的普通文件，或服务器返回的错误
+ */
+int fexec(int fdnum, envid_t child)
+{
+  802d5d:	55                   	push   %rbp
+  802d5e:	48 89 e5             	mov    %rsp,%rbp
+  802d61:	48 83 ec 20          	sub    $0x20,%rsp
+  802d65:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d68:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d6b:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802d6f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d72:	48 89 d6             	mov    %rdx,%rsi
+  802d75:	89 c7                	mov    %eax,%edi
+  802d77:	48 b8 df 22 80 00 00 	movabs $0x8022df,%rax
+  802d7e:	00 00 00 
+  802d81:	ff d0                	call   *%rax
+  802d83:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d86:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d8a:	79 05                	jns    802d91 <fexec+0x34>
+		return r;
+  802d8c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d8f:	eb 56                	jmp    802de7 <fexec+0x8a>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802d91:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d95:	8b 10                	mov    (%rax),%edx
+  802d97:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  802d9e:	00 00 00 
+  802da1:	8b 00                	mov    (%rax),%eax
+  802da3:	39 c2                	cmp    %eax,%edx
+  802da5:	74 07                	je     802dae <fexec+0x51>
+		return -E_INVAL;
+  802da7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802dac:	eb 39                	jmp    802de7 <fexec+0x8a>
+	fsipcbuf.exec.req_fileid = fd->fd_file.id;
+  802dae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802db2:	8b 40 0c             	mov    0xc(%rax),%eax
+  802db5:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  802dbc:	00 00 00 
+  802dbf:	89 02                	mov    %eax,(%rdx)
+	fsipcbuf.exec.req_envid = child;
+  802dc1:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  802dc8:	00 00 00 
+  802dcb:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802dce:	89 42 04             	mov    %eax,0x4(%rdx)
+	return fsipc(FSREQ_EXEC, NULL);
+  802dd1:	be 00 00 00 00       	mov    $0x0,%esi
+  802dd6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802ddb:	48 b8 f9 2b 80 00 00 	movabs $0x802bf9,%rax
+  802de2:	00 00 00 
+  802de5:	ff d0                	call   *%rax
+}
+  802de7:	c9                   	leave
+  802de8:	c3                   	ret
+
+0000000000802de9 <devfile_unmap>:
+
+// 解除 fd 的数据窗口中 [from, FILEWINDOW) 的块缓存页映射
+static void
+devfile_unmap(struct Fd *fd, off_t from)
+{
+  802de9:	55                   	push   %rbp
+  802dea:	48 89 e5             	mov    %rsp,%rbp
+  802ded:	48 83 ec 40          	sub    $0x40,%rsp
+  802df1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802df5:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+	char *va = fd2data(fd);
+  802df8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dfc:	48 89 c7             	mov    %rax,%rdi
+  802dff:	48 b8 15 22 80 00 00 	movabs $0x802215,%rax
+  802e06:	00 00 00 
+  802e09:	ff d0                	call   *%rax
+  802e0b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	uintptr_t off;
+
+	for (off = ROUNDUP(from, PGSIZE); off < FILEWINDOW; off += PGSIZE)
+  802e0f:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802e16:	00 
+  802e17:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802e1a:	48 63 d0             	movslq %eax,%rdx
+  802e1d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e21:	48 01 d0             	add    %rdx,%rax
+  802e24:	48 83 e8 01          	sub    $0x1,%rax
+  802e28:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802e2c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e30:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e35:	48 f7 75 e8          	divq   -0x18(%rbp)
+  802e39:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e3d:	48 29 d0             	sub    %rdx,%rax
+  802e40:	48 98                	cltq
+  802e42:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802e46:	eb 45                	jmp    802e8d <devfile_unmap+0xa4>
+		if (va_is_mapped(va + off))
+  802e48:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802e4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e50:	48 01 d0             	add    %rdx,%rax
+  802e53:	48 89 c7             	mov    %rax,%rdi
+  802e56:	48 b8 a4 33 80 00 00 	movabs $0x8033a4,%rax
+  802e5d:	00 00 00 
+  802e60:	ff d0                	call   *%rax
+  802e62:	84 c0                	test   %al,%al
+  802e64:	74 1f                	je     802e85 <devfile_unmap+0x9c>
+			sys_page_unmap(0, va + off);
+  802e66:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802e6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e6e:	48 01 d0             	add    %rdx,%rax
+  802e71:	48 89 c6             	mov    %rax,%rsi
+  802e74:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e79:	48 b8 0c 1d 80 00 00 	movabs $0x801d0c,%rax
+  802e80:	00 00 00 
+  802e83:	ff d0                	call   *%rax
+	for (off = ROUNDUP(from, PGSIZE); off < FILEWINDOW; off += PGSIZE)
+  802e85:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  802e8c:	00 
+  802e8d:	48 c7 45 d8 00 00 20 	movq   $0x200000,-0x28(%rbp)
+  802e94:	00 
+  802e95:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e99:	48 05 ff 9f 40 00    	add    $0x409fff,%rax
+  802e9f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802ea3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ea7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eac:	48 f7 75 d8          	divq   -0x28(%rbp)
+  802eb0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802eb4:	48 29 d0             	sub    %rdx,%rax
+  802eb7:	48 98                	cltq
+  802eb9:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  802ebd:	72 89                	jb     802e48 <devfile_unmap+0x5f>
+}
+  802ebf:	90                   	nop
+  802ec0:	90                   	nop
+  802ec1:	c9                   	leave
+  802ec2:	c3                   	ret
+
+0000000000802ec3 <devfile_flush>:
+ * 关闭文件时由 fd_close 调用：解除数据窗口的映射，并请求服务器将文件写回磁盘
+ * 服务器在 Fd 页的引用计数降为 1 时回收 OpenFile
+ */
+static int
+devfile_flush(struct Fd *fd)
+{
+  802ec3:	55                   	push   %rbp
+  802ec4:	48 89 e5             	mov    %rsp,%rbp
+  802ec7:	48 83 ec 10          	sub    $0x10,%rsp
+  802ecb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	devfile_unmap(fd, 0);
+  802ecf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ed3:	be 00 00 00 00       	mov    $0x0,%esi
+  802ed8:	48 89 c7             	mov    %rax,%rdi
+  802edb:	48 b8 e9 2d 80 00 00 	movabs $0x802de9,%rax
+  802ee2:	00 00 00 
+  802ee5:	ff d0                	call   *%rax
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802ee7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802eeb:	8b 40 0c             	mov    0xc(%rax),%eax
+  802eee:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  802ef5:	00 00 00 
+  802ef8:	89 02                	mov    %eax,(%rdx)
+	return fsipc(FSREQ_FLUSH, NULL);
+  802efa:	be 00 00 00 00       	mov    $0x0,%esi
+  802eff:	bf 06 00 00 00       	mov    $0x6,%edi
+  802f04:	48 b8 f9 2b 80 00 00 	movabs $0x802bf9,%rax
+  802f0b:	00 00 00 
+  802f0e:	ff d0                	call   *%rax
+}
+  802f10:	c9                   	leave
+  802f11:	c3                   	ret
+
+0000000000802f12 <devfile_map>:
+ * 确保文件 offset(BLKSIZE 对齐)处的块已映射在 fd 的数据窗口中
+ * 未映射时请求服务器把块缓存页共享过来(FSREQ_MAP)
+ */
+static int
+devfile_map(struct Fd *fd, off_t offset)
+{
+  802f12:	55                   	push   %rbp
+  802f13:	48 89 e5             	mov    %rsp,%rbp
+  802f16:	48 83 ec 20          	sub    $0x20,%rsp
+  802f1a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802f1e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	char *va = fd2data(fd) + offset;
+  802f21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f25:	48 89 c7             	mov    %rax,%rdi
+  802f28:	48 b8 15 22 80 00 00 	movabs $0x802215,%rax
+  802f2f:	00 00 00 
+  802f32:	ff d0                	call   *%rax
+  802f34:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802f37:	48 63 d2             	movslq %edx,%rdx
+  802f3a:	48 01 d0             	add    %rdx,%rax
+  802f3d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+	if (va_is_mapped(va))
+  802f41:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f45:	48 89 c7             	mov    %rax,%rdi
+  802f48:	48 b8 a4 33 80 00 00 	movabs $0x8033a4,%rax
+  802f4f:	00 00 00 
+  802f52:	ff d0                	call   *%rax
+  802f54:	84 c0                	test   %al,%al
+  802f56:	74 07                	je     802f5f <devfile_map+0x4d>
+		return 0;
+  802f58:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f5d:	eb 3b                	jmp    802f9a <devfile_map+0x88>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802f5f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f63:	8b 40 0c             	mov    0xc(%rax),%eax
+  802f66:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  802f6d:	00 00 00 
+  802f70:	89 02                	mov    %eax,(%rdx)
+	fsipcbuf.map.req_offset = offset;
+  802f72:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  802f79:	00 00 00 
+  802f7c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802f7f:	89 42 04             	mov    %eax,0x4(%rdx)
+	return fsipc(FSREQ_MAP, va);
+  802f82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f86:	48 89 c6             	mov    %rax,%rsi
+  802f89:	bf 09 00 00 00       	mov    $0x9,%edi
+  802f8e:	48 b8 f9 2b 80 00 00 	movabs $0x802bf9,%rax
+  802f95:	00 00 00 
+  802f98:	ff d0                	call   *%rax
+}
+  802f9a:	c9                   	leave
+  802f9b:	c3                   	ret
+
+0000000000802f9c <devfile_read>:
+ * 数据不经过 IPC 请求页复制
+ * 返回读取的字节数
+ */
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  802f9c:	55                   	push   %rbp
+  802f9d:	48 89 e5             	mov    %rsp,%rbp
+  802fa0:	48 83 ec 60          	sub    $0x60,%rsp
+  802fa4:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802fa8:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802fac:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	char *va = fd2data(fd);
+  802fb0:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802fb4:	48 89 c7             	mov    %rax,%rdi
+  802fb7:	48 b8 15 22 80 00 00 	movabs $0x802215,%rax
+  802fbe:	00 00 00 
+  802fc1:	ff d0                	call   *%rax
+  802fc3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	off_t pos = fd->fd_offset, end;
+  802fc7:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802fcb:	8b 40 04             	mov    0x4(%rax),%eax
+  802fce:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	size_t m;
+	int r;
+
+	if (pos >= fd->fd_file.size)
+  802fd1:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802fd5:	8b 40 10             	mov    0x10(%rax),%eax
+  802fd8:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  802fdb:	7c 0a                	jl     802fe7 <devfile_read+0x4b>
+		return 0;
+  802fdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fe2:	e9 02 01 00 00       	jmp    8030e9 <devfile_read+0x14d>
+	end = MIN(pos + (off_t)n, fd->fd_file.size);
+  802fe7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802feb:	89 c2                	mov    %eax,%edx
+  802fed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ff0:	01 d0                	add    %edx,%eax
+  802ff2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ff5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802ff9:	8b 40 10             	mov    0x10(%rax),%eax
+  802ffc:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  802fff:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803002:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803005:	39 c2                	cmp    %eax,%edx
+  803007:	0f 4e c2             	cmovle %edx,%eax
+  80300a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	n = end - pos;
+  80300d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803010:	2b 45 fc             	sub    -0x4(%rbp),%eax
+  803013:	48 98                	cltq
+  803015:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+	while (pos < end)
+  803019:	e9 b1 00 00 00       	jmp    8030cf <devfile_read+0x133>
+	{
+		if ((r = devfile_map(fd, ROUNDDOWN(pos, BLKSIZE))) < 0)
+  80301e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803021:	48 98                	cltq
+  803023:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  803027:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80302b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803030:	89 c2                	mov    %eax,%edx
+  803032:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803036:	89 d6                	mov    %edx,%esi
+  803038:	48 89 c7             	mov    %rax,%rdi
+  80303b:	48 b8 12 2f 80 00 00 	movabs $0x802f12,%rax
+  803042:	00 00 00 
+  803045:	ff d0                	call   *%rax
+  803047:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  80304a:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  80304e:	79 08                	jns    803058 <devfile_read+0xbc>
+			return r;
+  803050:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803053:	e9 91 00 00 00       	jmp    8030e9 <devfile_read+0x14d>
+		m = MIN(end - pos, BLKSIZE - pos % BLKSIZE);
+  803058:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80305b:	2b 45 fc             	sub    -0x4(%rbp),%eax
+  80305e:	89 45 d0             	mov    %eax,-0x30(%rbp)
+  803061:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803064:	89 d0                	mov    %edx,%eax
+  803066:	c1 f8 1f             	sar    $0x1f,%eax
+  803069:	c1 e8 14             	shr    $0x14,%eax
+  80306c:	01 c2                	add    %eax,%edx
+  80306e:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803074:	29 c2                	sub    %eax,%edx
+  803076:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80307b:	29 d0                	sub    %edx,%eax
+  80307d:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  803080:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  803083:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803086:	39 c2                	cmp    %eax,%edx
+  803088:	0f 4e c2             	cmovle %edx,%eax
+  80308b:	48 98                	cltq
+  80308d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+		memmove(buf, va + pos, m);
+  803091:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803094:	48 63 d0             	movslq %eax,%rdx
+  803097:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80309b:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80309f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8030a3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8030a7:	48 89 ce             	mov    %rcx,%rsi
+  8030aa:	48 89 c7             	mov    %rax,%rdi
+  8030ad:	48 b8 81 16 80 00 00 	movabs $0x801681,%rax
+  8030b4:	00 00 00 
+  8030b7:	ff d0                	call   *%rax
+		buf += m;
+  8030b9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8030bd:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+		pos += m;
+  8030c1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8030c5:	89 c2                	mov    %eax,%edx
+  8030c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030ca:	01 d0                	add    %edx,%eax
+  8030cc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	while (pos < end)
+  8030cf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030d2:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8030d5:	0f 8c 43 ff ff ff    	jl     80301e <devfile_read+0x82>
+	}
+	fd->fd_offset = pos;
+  8030db:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8030df:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8030e2:	89 50 04             	mov    %edx,0x4(%rax)
+	return n;
+  8030e5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  8030e9:	c9                   	leave
+  8030ea:	c3                   	ret
+
+00000000008030eb <devfile_write>:
+ * 服务器写入的就是客户端映射的块缓存页，因此已映射的块无需重新映射
+ * 返回写入的字节数
+ */
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8030eb:	55                   	push   %rbp
+  8030ec:	48 89 e5             	mov    %rsp,%rbp
+  8030ef:	48 83 ec 50          	sub    $0x50,%rsp
+  8030f3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8030f7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8030fb:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	size_t m, tot = 0;
+  8030ff:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803106:	00 
+	int r;
+
+	while (tot < n)
+  803107:	e9 fc 00 00 00       	jmp    803208 <devfile_write+0x11d>
+	{
+		m = MIN(n - tot, sizeof(fsipcbuf.write.req_buf));
+  80310c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803110:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  803114:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803118:	48 c7 45 e8 f4 0f 00 	movq   $0xff4,-0x18(%rbp)
+  80311f:	00 
+  803120:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803124:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803128:	48 39 c2             	cmp    %rax,%rdx
+  80312b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80312f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803133:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803137:	8b 40 0c             	mov    0xc(%rax),%eax
+  80313a:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803141:	00 00 00 
+  803144:	89 42 08             	mov    %eax,0x8(%rdx)
+		fsipcbuf.write.req_n = m;
+  803147:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80314e:	00 00 00 
+  803151:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803155:	48 89 02             	mov    %rax,(%rdx)
+		memmove(fsipcbuf.write.req_buf, buf + tot, m);
+  803158:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80315c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803160:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  803164:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803168:	48 89 c2             	mov    %rax,%rdx
+  80316b:	48 89 ce             	mov    %rcx,%rsi
+  80316e:	48 b8 0c 90 80 00 00 	movabs $0x80900c,%rax
+  803175:	00 00 00 
+  803178:	48 89 c7             	mov    %rax,%rdi
+  80317b:	48 b8 81 16 80 00 00 	movabs $0x801681,%rax
+  803182:	00 00 00 
+  803185:	ff d0                	call   *%rax
+		if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  803187:	be 00 00 00 00       	mov    $0x0,%esi
+  80318c:	bf 04 00 00 00       	mov    $0x4,%edi
+  803191:	48 b8 f9 2b 80 00 00 	movabs $0x802bf9,%rax
+  803198:	00 00 00 
+  80319b:	ff d0                	call   *%rax
+  80319d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8031a0:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8031a4:	79 05                	jns    8031ab <devfile_write+0xc0>
+			return r;
+  8031a6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8031a9:	eb 72                	jmp    80321d <devfile_write+0x132>
+		assert(r <= m);
+  8031ab:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8031ae:	48 98                	cltq
+  8031b0:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  8031b4:	73 3e                	jae    8031f4 <devfile_write+0x109>
+  8031b6:	48 b8 76 3d 80 00 00 	movabs $0x803d76,%rax
+  8031bd:	00 00 00 
+  8031c0:	48 89 c1             	mov    %rax,%rcx
+  8031c3:	48 b8 7d 3d 80 00 00 	movabs $0x803d7d,%rax
+  8031ca:	00 00 00 
+  8031cd:	48 89 c2             	mov    %rax,%rdx
+  8031d0:	be bf 00 00 00       	mov    $0xbf,%esi
+  8031d5:	48 b8 92 3d 80 00 00 	movabs $0x803d92,%rax
+  8031dc:	00 00 00 
+  8031df:	48 89 c7             	mov    %rax,%rdi
+  8031e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031e7:	49 b8 bc 34 80 00 00 	movabs $0x8034bc,%r8
+  8031ee:	00 00 00 
+  8031f1:	41 ff d0             	call   *%r8
+		tot += r;
+  8031f4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8031f7:	48 98                	cltq
+  8031f9:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		if (r < m)
+  8031fd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803200:	48 98                	cltq
+  803202:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  803206:	72 10                	jb     803218 <devfile_write+0x12d>
+	while (tot < n)
+  803208:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80320c:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  803210:	0f 82 f6 fe ff ff    	jb     80310c <devfile_write+0x21>
+  803216:	eb 01                	jmp    803219 <devfile_write+0x12e>
+			break;
+  803218:	90                   	nop
+	}
+	return tot;
+  803219:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80321d:	c9                   	leave
+  80321e:	c3                   	ret
+
+000000000080321f <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  80321f:	55                   	push   %rbp
+  803220:	48 89 e5             	mov    %rsp,%rbp
+  803223:	48 83 ec 20          	sub    $0x20,%rsp
+  803227:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80322b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80322f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803233:	8b 40 0c             	mov    0xc(%rax),%eax
+  803236:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80323d:	00 00 00 
+  803240:	89 02                	mov    %eax,(%rdx)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803242:	be 00 00 00 00       	mov    $0x0,%esi
+  803247:	bf 05 00 00 00       	mov    $0x5,%edi
+  80324c:	48 b8 f9 2b 80 00 00 	movabs $0x802bf9,%rax
+  803253:	00 00 00 
+  803256:	ff d0                	call   *%rax
+  803258:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80325b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80325f:	79 05                	jns    803266 <devfile_stat+0x47>
+		return r;
+  803261:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803264:	eb 59                	jmp    8032bf <devfile_stat+0xa0>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803266:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80326a:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803271:	00 00 00 
+  803274:	48 89 d6             	mov    %rdx,%rsi
+  803277:	48 89 c7             	mov    %rax,%rdi
+  80327a:	48 b8 f5 0f 80 00 00 	movabs $0x800ff5,%rax
+  803281:	00 00 00 
+  803284:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  803286:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80328d:	00 00 00 
+  803290:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  803296:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80329a:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8032a0:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8032a7:	00 00 00 
+  8032aa:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  8032b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032b4:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  8032ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032bf:	c9                   	leave
+  8032c0:	c3                   	ret
+
+00000000008032c1 <devfile_trunc>:
+
+// 截断或扩展文件，截断时解除新大小之外的块的映射(这些块可能被服务器释放并重新分配)
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8032c1:	55                   	push   %rbp
+  8032c2:	48 89 e5             	mov    %rsp,%rbp
+  8032c5:	48 83 ec 10          	sub    $0x10,%rsp
+  8032c9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8032cd:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8032d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032d4:	8b 40 0c             	mov    0xc(%rax),%eax
+  8032d7:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8032de:	00 00 00 
+  8032e1:	89 02                	mov    %eax,(%rdx)
+	fsipcbuf.set_size.req_size = newsize;
+  8032e3:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8032ea:	00 00 00 
+  8032ed:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8032f0:	89 42 04             	mov    %eax,0x4(%rdx)
+	devfile_unmap(fd, newsize);
+  8032f3:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8032f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032fa:	89 d6                	mov    %edx,%esi
+  8032fc:	48 89 c7             	mov    %rax,%rdi
+  8032ff:	48 b8 e9 2d 80 00 00 	movabs $0x802de9,%rax
+  803306:	00 00 00 
+  803309:	ff d0                	call   *%rax
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80330b:	be 00 00 00 00       	mov    $0x0,%esi
+  803310:	bf 02 00 00 00       	mov    $0x2,%edi
+  803315:	48 b8 f9 2b 80 00 00 	movabs $0x802bf9,%rax
+  80331c:	00 00 00 
+  80331f:	ff d0                	call   *%rax
+}
+  803321:	c9                   	leave
+  803322:	c3                   	ret
+
+0000000000803323 <remove>:
+
+// 删除文件
+int remove(const char *path)
+{
+  803323:	55                   	push   %rbp
+  803324:	48 89 e5             	mov    %rsp,%rbp
+  803327:	48 83 ec 10          	sub    $0x10,%rsp
+  80332b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  80332f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803333:	48 89 c7             	mov    %rax,%rdi
+  803336:	48 b8 89 0f 80 00 00 	movabs $0x800f89,%rax
+  80333d:	00 00 00 
+  803340:	ff d0                	call   *%rax
+  803342:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803347:	7e 07                	jle    803350 <remove+0x2d>
+		return -E_BAD_PATH;
+  803349:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80334e:	eb 36                	jmp    803386 <remove+0x63>
+	strcpy(fsipcbuf.remove.req_path, path);
+  803350:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803354:	48 89 c6             	mov    %rax,%rsi
+  803357:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80335e:	00 00 00 
+  803361:	48 89 c7             	mov    %rax,%rdi
+  803364:	48 b8 f5 0f 80 00 00 	movabs $0x800ff5,%rax
+  80336b:	00 00 00 
+  80336e:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  803370:	be 00 00 00 00       	mov    $0x0,%esi
+  803375:	bf 07 00 00 00       	mov    $0x7,%edi
+  80337a:	48 b8 f9 2b 80 00 00 	movabs $0x802bf9,%rax
+  803381:	00 00 00 
+  803384:	ff d0                	call   *%rax
+}
+  803386:	c9                   	leave
+  803387:	c3                   	ret
+
+0000000000803388 <sync>:
+
+// 将文件系统的所有修改写回磁盘
+int sync(void)
+{
+  803388:	55                   	push   %rbp
+  803389:	48 89 e5             	mov    %rsp,%rbp
+	return fsipc(FSREQ_SYNC, NULL);
+  80338c:	be 00 00 00 00       	mov    $0x0,%esi
+  803391:	bf 08 00 00 00       	mov    $0x8,%edi
+  803396:	48 b8 f9 2b 80 00 00 	movabs $0x802bf9,%rax
+  80339d:	00 00 00 
+  8033a0:	ff d0                	call   *%rax
+}
+  8033a2:	5d                   	pop    %rbp
+  8033a3:	c3                   	ret
+
+00000000008033a4 <va_is_mapped>:
+/**
+ * 虚拟地址 va 是否已映射
+ * 逐级检查页表，避免访问不存在的页表页
+ */
+bool va_is_mapped(void *va)
+{
+  8033a4:	55                   	push   %rbp
+  8033a5:	48 89 e5             	mov    %rsp,%rbp
+  8033a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8033ac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return (uvpml4e[VPML4E(va)] & PTE_P) && (uvpde[VPDPE(va)] & PTE_P) &&
+  8033b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033b4:	48 c1 e8 27          	shr    $0x27,%rax
+  8033b8:	48 89 c2             	mov    %rax,%rdx
+  8033bb:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8033c2:	01 00 00 
+  8033c5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033c9:	83 e0 01             	and    $0x1,%eax
+		   (uvpd[VPD(va)] & PTE_P) && (uvpt[VPN(va)] & PTE_P);
+  8033cc:	48 85 c0             	test   %rax,%rax
+  8033cf:	74 6a                	je     80343b <va_is_mapped+0x97>
+	return (uvpml4e[VPML4E(va)] & PTE_P) && (uvpde[VPDPE(va)] & PTE_P) &&
+  8033d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033d5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8033d9:	48 89 c2             	mov    %rax,%rdx
+  8033dc:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8033e3:	01 00 00 
+  8033e6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033ea:	83 e0 01             	and    $0x1,%eax
+  8033ed:	48 85 c0             	test   %rax,%rax
+  8033f0:	74 49                	je     80343b <va_is_mapped+0x97>
+		   (uvpd[VPD(va)] & PTE_P) && (uvpt[VPN(va)] & PTE_P);
+  8033f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033f6:	48 c1 e8 15          	shr    $0x15,%rax
+  8033fa:	48 89 c2             	mov    %rax,%rdx
+  8033fd:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803404:	01 00 00 
+  803407:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80340b:	83 e0 01             	and    $0x1,%eax
+	return (uvpml4e[VPML4E(va)] & PTE_P) && (uvpde[VPDPE(va)] & PTE_P) &&
+  80340e:	48 85 c0             	test   %rax,%rax
+  803411:	74 28                	je     80343b <va_is_mapped+0x97>
+		   (uvpd[VPD(va)] & PTE_P) && (uvpt[VPN(va)] & PTE_P);
+  803413:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803417:	48 c1 e8 0c          	shr    $0xc,%rax
+  80341b:	48 89 c2             	mov    %rax,%rdx
+  80341e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803425:	01 00 00 
+  803428:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80342c:	83 e0 01             	and    $0x1,%eax
+  80342f:	48 85 c0             	test   %rax,%rax
+  803432:	74 07                	je     80343b <va_is_mapped+0x97>
+  803434:	b8 01 00 00 00       	mov    $0x1,%eax
+  803439:	eb 05                	jmp    803440 <va_is_mapped+0x9c>
+  80343b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803440:	83 e0 01             	and    $0x1,%eax
+}
+  803443:	c9                   	leave
+  803444:	c3                   	ret
+
+0000000000803445 <pageref>:
+
+// 返回虚拟地址 v 所在物理页的引用计数，v 未映射时返回 0
+int pageref(void *v)
+{
+  803445:	55                   	push   %rbp
+  803446:	48 89 e5             	mov    %rsp,%rbp
+  803449:	48 83 ec 08          	sub    $0x8,%rsp
+  80344d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	if (!va_is_mapped(v))
+  803451:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803455:	48 89 c7             	mov    %rax,%rdi
+  803458:	48 b8 a4 33 80 00 00 	movabs $0x8033a4,%rax
+  80345f:	00 00 00 
+  803462:	ff d0                	call   *%rax
+  803464:	83 f0 01             	xor    $0x1,%eax
+  803467:	84 c0                	test   %al,%al
+  803469:	74 07                	je     803472 <pageref+0x2d>
+		return 0;
+  80346b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803470:	eb 48                	jmp    8034ba <pageref+0x75>
+	return pages[PPN(PTE_ADDR(uvpt[VPN(v)]))].pp_ref;
+  803472:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803476:	48 c1 e8 0c          	shr    $0xc,%rax
+  80347a:	48 89 c2             	mov    %rax,%rdx
+  80347d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803484:	01 00 00 
+  803487:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80348b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80348f:	48 89 c2             	mov    %rax,%rdx
+  803492:	48 b8 ff ff ff ff ff 	movabs $0xfffffffffffff,%rax
+  803499:	ff 0f 00 
+  80349c:	48 21 d0             	and    %rdx,%rax
+  80349f:	48 ba 00 00 a0 00 80 	movabs $0x8000a00000,%rdx
+  8034a6:	00 00 00 
+  8034a9:	48 c1 e0 04          	shl    $0x4,%rax
+  8034ad:	48 01 d0             	add    %rdx,%rax
+  8034b0:	48 83 c0 08          	add    $0x8,%rax
+  8034b4:	0f b7 00             	movzwl (%rax),%eax
+  8034b7:	0f b7 c0             	movzwl %ax,%eax
+}
+  8034ba:	c9                   	leave
+  8034bb:	c3                   	ret
+
+00000000008034bc <_panic>:
+/*
+ * 无法解决的致命错误会导致死机
+ * 打印"死机:<消息>”，然后导致处理器休眠进入HLT状态
+ */
+void _panic(const char *file, int line, const char *fmt, ...)
+{
+  8034bc:	55                   	push   %rbp
+  8034bd:	48 89 e5             	mov    %rsp,%rbp
+  8034c0:	53                   	push   %rbx
+  8034c1:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8034c8:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  8034cf:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  8034d5:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  8034dc:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  8034e3:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  8034ea:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  8034f1:	84 c0                	test   %al,%al
+  8034f3:	74 23                	je     803518 <_panic+0x5c>
+  8034f5:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  8034fc:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  803500:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  803504:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  803508:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  80350c:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  803510:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  803514:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  803518:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  80351f:	00 00 00 
+  803522:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  803529:	00 00 00 
+  80352c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803530:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  803537:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  80353e:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+	// 输出死机的信息
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803545:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  80354c:	00 00 00 
+  80354f:	48 8b 18             	mov    (%rax),%rbx
+  803552:	48 b8 e1 1b 80 00 00 	movabs $0x801be1,%rax
+  803559:	00 00 00 
+  80355c:	ff d0                	call   *%rax
+  80355e:	89 c6                	mov    %eax,%esi
+  803560:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  803566:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80356d:	41 89 d0             	mov    %edx,%r8d
+  803570:	48 89 c1             	mov    %rax,%rcx
+  803573:	48 89 da             	mov    %rbx,%rdx
+  803576:	48 b8 a0 3d 80 00 00 	movabs $0x803da0,%rax
+  80357d:	00 00 00 
+  803580:	48 89 c7             	mov    %rax,%rdi
+  803583:	b8 00 00 00 00       	mov    $0x0,%eax
+  803588:	49 b9 6e 03 80 00 00 	movabs $0x80036e,%r9
+  80358f:	00 00 00 
+  803592:	41 ff d1             	call   *%r9
+			sys_getprocid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803595:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  80359c:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8035a3:	48 89 d6             	mov    %rdx,%rsi
+  8035a6:	48 89 c7             	mov    %rax,%rdi
+  8035a9:	48 b8 bf 02 80 00 00 	movabs $0x8002bf,%rax
+  8035b0:	00 00 00 
+  8035b3:	ff d0                	call   *%rax
+	cprintf("\n");
+  8035b5:	48 b8 c3 3d 80 00 00 	movabs $0x803dc3,%rax
+  8035bc:	00 00 00 
+  8035bf:	48 89 c7             	mov    %rax,%rdi
+  8035c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035c7:	48 ba 6e 03 80 00 00 	movabs $0x80036e,%rdx
+  8035ce:	00 00 00 
+  8035d1:	ff d2                	call   *%rdx
+
+	// 触发断点中断
+	while (1)
+		asm volatile("int3");
+  8035d3:	cc                   	int3
+  8035d4:	eb fd                	jmp    8035d3 <_panic+0x117>
+
+00000000008035d6 <ipc_recv>:
+ * 如果 pg 为空，则传递 sys_ipc_recv 一个值，它将理解为“no page”的意思
+ * (Zero 不是正确的值，因为这是映射页面的完美有效位置)
+ */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8035d6:	55                   	push   %rbp
+  8035d7:	48 89 e5             	mov    %rsp,%rbp
+  8035da:	48 83 ec 30          	sub    $0x30,%rsp
+  8035de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8035e2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8035e6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	int r = 0;
+  8035ea:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	if(pg) {
+  8035f1:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8035f6:	74 18                	je     803610 <ipc_recv+0x3a>
+		r = sys_ipc_recv(pg);
+  8035f8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035fc:	48 89 c7             	mov    %rax,%rdi
+  8035ff:	48 b8 94 1e 80 00 00 	movabs $0x801e94,%rax
+  803606:	00 00 00 
+  803609:	ff d0                	call   *%rax
+  80360b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80360e:	eb 1c                	jmp    80362c <ipc_recv+0x56>
+	}
+	// pg == 0, pg > UTOP
+	else {
+		r = sys_ipc_recv((void*)KERNBASE);
+  803610:	48 b8 00 00 00 04 80 	movabs $0x8004000000,%rax
+  803617:	00 00 00 
+  80361a:	48 89 c7             	mov    %rax,%rdi
+  80361d:	48 b8 94 1e 80 00 00 	movabs $0x801e94,%rax
+  803624:	00 00 00 
+  803627:	ff d0                	call   *%rax
+  803629:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	}
+	if (r < 0) {
+  80362c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803630:	79 39                	jns    80366b <ipc_recv+0x95>
+		*from_env_store =  (from_env_store != NULL) ? (envid_t)0 : *from_env_store;
+  803632:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803637:	75 08                	jne    803641 <ipc_recv+0x6b>
+  803639:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80363d:	8b 00                	mov    (%rax),%eax
+  80363f:	eb 05                	jmp    803646 <ipc_recv+0x70>
+  803641:	b8 00 00 00 00       	mov    $0x0,%eax
+  803646:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80364a:	89 02                	mov    %eax,(%rdx)
+		*perm_store = (perm_store != NULL) ? (int)0 : *perm_store;
+  80364c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803651:	75 08                	jne    80365b <ipc_recv+0x85>
+  803653:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803657:	8b 00                	mov    (%rax),%eax
+  803659:	eb 05                	jmp    803660 <ipc_recv+0x8a>
+  80365b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803660:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803664:	89 02                	mov    %eax,(%rdx)
+		return r;
+  803666:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803669:	eb 53                	jmp    8036be <ipc_recv+0xe8>
+	}
+	// 设置from_env_store为发送进程的进程ID
+	if(from_env_store) {
+  80366b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803670:	74 19                	je     80368b <ipc_recv+0xb5>
+		*from_env_store = thisproc->env_ipc_from;
+  803672:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803679:	00 00 00 
+  80367c:	48 8b 00             	mov    (%rax),%rax
+  80367f:	8b 90 6c 01 00 00    	mov    0x16c(%rax),%edx
+  803685:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803689:	89 10                	mov    %edx,(%rax)
+	}
+	// 如果传递物理页，该位不为0，设置perm_store为物理页的权限
+	if(perm_store) {
+  80368b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803690:	74 19                	je     8036ab <ipc_recv+0xd5>
+		*perm_store = thisproc->env_ipc_perm;
+  803692:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803699:	00 00 00 
+  80369c:	48 8b 00             	mov    (%rax),%rax
+  80369f:	8b 90 70 01 00 00    	mov    0x170(%rax),%edx
+  8036a5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8036a9:	89 10                	mov    %edx,(%rax)
+	}
+	// 返回发送进程发送的值
+	return thisproc->env_ipc_value;
+  8036ab:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8036b2:	00 00 00 
+  8036b5:	48 8b 00             	mov    (%rax),%rax
+  8036b8:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8036be:	c9                   	leave
+  8036bf:	c3                   	ret
+
+00000000008036c0 <ipc_send>:
+ * 使用sys_yield()使cpu友好
+ * 如果'pg'为null，则给sys_ipc_recv传递一个它会理解为“无页面”的值(0不是正确的值)
+ */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8036c0:	55                   	push   %rbp
+  8036c1:	48 89 e5             	mov    %rsp,%rbp
+  8036c4:	48 83 ec 30          	sub    $0x30,%rsp
+  8036c8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8036cb:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8036ce:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8036d2:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	int r = -E_IPC_NOT_RECV;
+  8036d5:	c7 45 fc f8 ff ff ff 	movl   $0xfffffff8,-0x4(%rbp)
+	// 子进程不是接收状态
+	while(r == -E_IPC_NOT_RECV) {
+  8036dc:	eb 59                	jmp    803737 <ipc_send+0x77>
+		if(pg) {
+  8036de:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8036e3:	74 20                	je     803705 <ipc_send+0x45>
+			// 传递物理页
+			r = sys_ipc_try_send(to_env, val, pg, perm);
+  8036e5:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8036e8:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8036eb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8036ef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8036f2:	89 c7                	mov    %eax,%edi
+  8036f4:	48 b8 3d 1e 80 00 00 	movabs $0x801e3d,%rax
+  8036fb:	00 00 00 
+  8036fe:	ff d0                	call   *%rax
+  803700:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803703:	eb 26                	jmp    80372b <ipc_send+0x6b>
+		}
+		// pg == 0, pg > UTOP
+		else {
+			// (void*)KERNBASE > UTOP
+			r = sys_ipc_try_send(to_env, val, (void*)KERNBASE, perm);
+  803705:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  803708:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80370b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80370e:	89 d1                	mov    %edx,%ecx
+  803710:	48 ba 00 00 00 04 80 	movabs $0x8004000000,%rdx
+  803717:	00 00 00 
+  80371a:	89 c7                	mov    %eax,%edi
+  80371c:	48 b8 3d 1e 80 00 00 	movabs $0x801e3d,%rax
+  803723:	00 00 00 
+  803726:	ff d0                	call   *%rax
+  803728:	89 45 fc             	mov    %eax,-0x4(%rbp)
+		}
+		// 让出CPU
+		sys_yield();
+  80372b:	48 b8 1d 1c 80 00 00 	movabs $0x801c1d,%rax
+  803732:	00 00 00 
+  803735:	ff d0                	call   *%rax
+	while(r == -E_IPC_NOT_RECV) {
+  803737:	83 7d fc f8          	cmpl   $0xfffffff8,-0x4(%rbp)
+  80373b:	74 a1                	je     8036de <ipc_send+0x1e>
+	}
+	if (r != 0) {
+  80373d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803741:	74 30                	je     803773 <ipc_send+0xb3>
+		panic("something went wrong with sending the page");
+  803743:	48 b8 c8 3d 80 00 00 	movabs $0x803dc8,%rax
+  80374a:	00 00 00 
+  80374d:	48 89 c2             	mov    %rax,%rdx
+  803750:	be 48 00 00 00       	mov    $0x48,%esi
+  803755:	48 b8 f3 3d 80 00 00 	movabs $0x803df3,%rax
+  80375c:	00 00 00 
+  80375f:	48 89 c7             	mov    %rax,%rdi
+  803762:	b8 00 00 00 00       	mov    $0x0,%eax
+  803767:	48 b9 bc 34 80 00 00 	movabs $0x8034bc,%rcx
+  80376e:	00 00 00 
+  803771:	ff d1                	call   *%rcx
+	}
+}
+  803773:	90                   	nop
+  803774:	c9                   	leave
+  803775:	c3                   	ret
+
+0000000000803776 <ipc_find_env>:
+// find special environments.
+// Returns 0 if no such environment exists.
+// 内核只遍历已分配的环境(env_live)，不扫描整个 procs[]
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803776:	55                   	push   %rbp
+  803777:	48 89 e5             	mov    %rsp,%rbp
+  80377a:	48 83 ec 20          	sub    $0x20,%rsp
+  80377e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	envid_t r = sys_env_find(type);
+  803781:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803784:	89 c7                	mov    %eax,%edi
+  803786:	48 b8 0b 21 80 00 00 	movabs $0x80210b,%rax
+  80378d:	00 00 00 
+  803790:	ff d0                	call   *%rax
+  803792:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+	return r < 0 ? 0 : r;
+  803795:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803798:	ba 00 00 00 00       	mov    $0x0,%edx
+  80379d:	85 c0                	test   %eax,%eax
+  80379f:	0f 48 c2             	cmovs  %edx,%eax
+}
+  8037a2:	c9                   	leave
+  8037a3:	c3                   	ret
@@ -0,0 +1,3862 @@
+
+obj/user/dumbfork.debug:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// entrypoint - 当最初被加载到一个新的环境中时，内核(或者父环境)在这里开始运行.
+.text
+.globl _start
+_start:
+	// 判断是否从栈上的参数开始初始化
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	// $USTACKTOP != %rsp 说明有参数，跳转到 args_exist
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// 如果不是(新环境被内核加载的时候)，则 push 伪造的 argc, argv 参数
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 38 03 00 00       	call   800379 <libmain>
+
+// 不应该返回
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+#include "inc/lib.h"
+
+int32_t dumbfork(void);
+
+void umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	48 83 ec 20          	sub    $0x20,%rsp
+  80004b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80004e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int32_t who;
+	int i;
+
+	// fork一个子进程
+	who = dumbfork();
+  800052:	48 b8 1b 02 80 00 00 	movabs $0x80021b,%rax
+  800059:	00 00 00 
+  80005c:	ff d0                	call   *%rax
+  80005e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+	// print a message and yield to the other a few times
+	for (i = 0; i < (who ? 10 : 20); i++)
+  800061:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800068:	eb 52                	jmp    8000bc <umain+0x79>
+	{
+		cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  80006a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80006e:	74 0c                	je     80007c <umain+0x39>
+  800070:	48 b8 e0 24 80 00 00 	movabs $0x8024e0,%rax
+  800077:	00 00 00 
+  80007a:	eb 0a                	jmp    800086 <umain+0x43>
+  80007c:	48 b8 e7 24 80 00 00 	movabs $0x8024e7,%rax
+  800083:	00 00 00 
+  800086:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  800089:	48 89 c2             	mov    %rax,%rdx
+  80008c:	89 ce                	mov    %ecx,%esi
+  80008e:	48 b8 ed 24 80 00 00 	movabs $0x8024ed,%rax
+  800095:	00 00 00 
+  800098:	48 89 c7             	mov    %rax,%rdi
+  80009b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a0:	48 b9 51 06 80 00 00 	movabs $0x800651,%rcx
+  8000a7:	00 00 00 
+  8000aa:	ff d1                	call   *%rcx
+		sys_yield();
+  8000ac:	48 b8 00 1f 80 00 00 	movabs $0x801f00,%rax
+  8000b3:	00 00 00 
+  8000b6:	ff d0                	call   *%rax
+	for (i = 0; i < (who ? 10 : 20); i++)
+  8000b8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8000bc:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8000c0:	74 07                	je     8000c9 <umain+0x86>
+  8000c2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8000c7:	eb 05                	jmp    8000ce <umain+0x8b>
+  8000c9:	b8 14 00 00 00       	mov    $0x14,%eax
+  8000ce:	3b 45 fc             	cmp    -0x4(%rbp),%eax
+  8000d1:	7f 97                	jg     80006a <umain+0x27>
+	}
+}
+  8000d3:	90                   	nop
+  8000d4:	90                   	nop
+  8000d5:	c9                   	leave
+  8000d6:	c3                   	ret
+
+00000000008000d7 <duppage>:
+
+void duppage(int32_t dstenv, void *addr)
+{
+  8000d7:	55                   	push   %rbp
+  8000d8:	48 89 e5             	mov    %rsp,%rbp
+  8000db:	48 83 ec 20          	sub    $0x20,%rsp
+  8000df:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8000e2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int r;
+
+	// 这不是fork应该做的事，只是为了测试.
+	if ((r = sys_page_alloc(dstenv, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  8000e6:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8000ea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000ed:	ba 07 00 00 00       	mov    $0x7,%edx
+  8000f2:	48 89 ce             	mov    %rcx,%rsi
+  8000f5:	89 c7                	mov    %eax,%edi
+  8000f7:	48 b8 3d 1f 80 00 00 	movabs $0x801f3d,%rax
+  8000fe:	00 00 00 
+  800101:	ff d0                	call   *%rax
+  800103:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800106:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80010a:	79 36                	jns    800142 <duppage+0x6b>
+		panic("sys_page_alloc: %e", r);
+  80010c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80010f:	89 c1                	mov    %eax,%ecx
+  800111:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  800118:	00 00 00 
+  80011b:	48 89 c2             	mov    %rax,%rdx
+  80011e:	be 1f 00 00 00       	mov    $0x1f,%esi
+  800123:	48 b8 12 25 80 00 00 	movabs $0x802512,%rax
+  80012a:	00 00 00 
+  80012d:	48 89 c7             	mov    %rax,%rdi
+  800130:	b8 00 00 00 00       	mov    $0x0,%eax
+  800135:	49 b8 0e 04 80 00 00 	movabs $0x80040e,%r8
+  80013c:	00 00 00 
+  80013f:	41 ff d0             	call   *%r8
+	if ((r = sys_page_map(dstenv, addr, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  800142:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800146:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800149:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  80014f:	b9 00 00 40 00       	mov    $0x400000,%ecx
+  800154:	ba 00 00 00 00       	mov    $0x0,%edx
+  800159:	89 c7                	mov    %eax,%edi
+  80015b:	48 b8 8f 1f 80 00 00 	movabs $0x801f8f,%rax
+  800162:	00 00 00 
+  800165:	ff d0                	call   *%rax
+  800167:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80016a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80016e:	79 36                	jns    8001a6 <duppage+0xcf>
+		panic("sys_page_map: %e", r);
+  800170:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800173:	89 c1                	mov    %eax,%ecx
+  800175:	48 b8 22 25 80 00 00 	movabs $0x802522,%rax
+  80017c:	00 00 00 
+  80017f:	48 89 c2             	mov    %rax,%rdx
+  800182:	be 21 00 00 00       	mov    $0x21,%esi
+  800187:	48 b8 12 25 80 00 00 	movabs $0x802512,%rax
+  80018e:	00 00 00 
+  800191:	48 89 c7             	mov    %rax,%rdi
+  800194:	b8 00 00 00 00       	mov    $0x0,%eax
+  800199:	49 b8 0e 04 80 00 00 	movabs $0x80040e,%r8
+  8001a0:	00 00 00 
+  8001a3:	41 ff d0             	call   *%r8
+	memmove(UTEMP, addr, PGSIZE);
+  8001a6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8001aa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8001af:	48 89 c6             	mov    %rax,%rsi
+  8001b2:	bf 00 00 40 00       	mov    $0x400000,%edi
+  8001b7:	48 b8 64 19 80 00 00 	movabs $0x801964,%rax
+  8001be:	00 00 00 
+  8001c1:	ff d0                	call   *%rax
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  8001c3:	be 00 00 40 00       	mov    $0x400000,%esi
+  8001c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001cd:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  8001d4:	00 00 00 
+  8001d7:	ff d0                	call   *%rax
+  8001d9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8001dc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8001e0:	79 36                	jns    800218 <duppage+0x141>
+		panic("sys_page_unmap: %e", r);
+  8001e2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8001e5:	89 c1                	mov    %eax,%ecx
+  8001e7:	48 b8 33 25 80 00 00 	movabs $0x802533,%rax
+  8001ee:	00 00 00 
+  8001f1:	48 89 c2             	mov    %rax,%rdx
+  8001f4:	be 24 00 00 00       	mov    $0x24,%esi
+  8001f9:	48 b8 12 25 80 00 00 	movabs $0x802512,%rax
+  800200:	00 00 00 
+  800203:	48 89 c7             	mov    %rax,%rdi
+  800206:	b8 00 00 00 00       	mov    $0x0,%eax
+  80020b:	49 b8 0e 04 80 00 00 	movabs $0x80040e,%r8
+  800212:	00 00 00 
+  800215:	41 ff d0             	call   *%r8
+}
+  800218:	90                   	nop
+  800219:	c9                   	leave
+  80021a:	c3                   	ret
+
+000000000080021b <dumbfork>:
+
+int32_t
+dumbfork(void)
+{
+  80021b:	55                   	push   %rbp
+  80021c:	48 89 e5             	mov    %rsp,%rbp
+  80021f:	48 83 ec 20          	sub    $0x20,%rsp
+// 必须内联.
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  800223:	b8 07 00 00 00       	mov    $0x7,%eax
+  800228:	cd 30                	int    $0x30
+  80022a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+					 : "=a"(ret)
+					 : "a"(SYS_exofork),
+					   "i"(T_SYSCALL));
+	return ret;
+  80022d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+	extern unsigned char end[];
+
+	// 分配一个新的子环境.
+	// 内核会用寄存器集的一个副本来初始化它，这样子进程就会看起来也调用了sys_exofork()
+	// 除了在子进程中，这个对sys_exofork()的“假”调用会返回0而不是孩子的envid.
+	envid = sys_exofork();
+  800230:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	if (envid < 0)
+  800233:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800237:	79 36                	jns    80026f <dumbfork+0x54>
+		panic("S_alloc_proc: %e", envid);
+  800239:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80023c:	89 c1                	mov    %eax,%ecx
+  80023e:	48 b8 46 25 80 00 00 	movabs $0x802546,%rax
+  800245:	00 00 00 
+  800248:	48 89 c2             	mov    %rax,%rdx
+  80024b:	be 34 00 00 00       	mov    $0x34,%esi
+  800250:	48 b8 12 25 80 00 00 	movabs $0x802512,%rax
+  800257:	00 00 00 
+  80025a:	48 89 c7             	mov    %rax,%rdi
+  80025d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800262:	49 b8 0e 04 80 00 00 	movabs $0x80040e,%r8
+  800269:	00 00 00 
+  80026c:	41 ff d0             	call   *%r8
+	if (envid == 0)
+  80026f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800273:	75 3e                	jne    8002b3 <dumbfork+0x98>
+	{
+		// We're the child.
+		// The copied value of the global variable 'thisproc'
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisproc = &procs[ENVX(sys_getprocid())];
+  800275:	48 b8 c4 1e 80 00 00 	movabs $0x801ec4,%rax
+  80027c:	00 00 00 
+  80027f:	ff d0                	call   *%rax
+  800281:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800286:	48 98                	cltq
+  800288:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  80028f:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  800296:	00 00 00 
+  800299:	48 01 c2             	add    %rax,%rdx
+  80029c:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  8002a3:	00 00 00 
+  8002a6:	48 89 10             	mov    %rdx,(%rax)
+		return 0;
+  8002a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ae:	e9 c4 00 00 00       	jmp    800377 <dumbfork+0x15c>
+	}
+
+	// We're the parent.
+	// Eagerly copy our entire address space into the child.
+	// This is NOT what you should do in your fork implementation.
+	for (addr = (uint8_t *)UTEXT; addr < end; addr += PGSIZE)
+  8002b3:	48 c7 45 e0 00 00 80 	movq   $0x800000,-0x20(%rbp)
+  8002ba:	00 
+  8002bb:	eb 26                	jmp    8002e3 <dumbfork+0xc8>
+		duppage(envid, addr);
+  8002bd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8002c1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8002c4:	48 89 d6             	mov    %rdx,%rsi
+  8002c7:	89 c7                	mov    %eax,%edi
+  8002c9:	48 b8 d7 00 80 00 00 	movabs $0x8000d7,%rax
+  8002d0:	00 00 00 
+  8002d3:	ff d0                	call   *%rax
+	for (addr = (uint8_t *)UTEXT; addr < end; addr += PGSIZE)
+  8002d5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8002d9:	48 05 00 10 00 00    	add    $0x1000,%rax
+  8002df:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8002e3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8002e7:	48 b8 14 40 80 00 00 	movabs $0x804014,%rax
+  8002ee:	00 00 00 
+  8002f1:	48 39 c2             	cmp    %rax,%rdx
+  8002f4:	72 c7                	jb     8002bd <dumbfork+0xa2>
+
+	// Also copy the stack we are currently running on.
+	duppage(envid, ROUNDDOWN(&addr, PGSIZE));
+  8002f6:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8002fa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8002fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800302:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  800308:	48 89 c2             	mov    %rax,%rdx
+  80030b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80030e:	48 89 d6             	mov    %rdx,%rsi
+  800311:	89 c7                	mov    %eax,%edi
+  800313:	48 b8 d7 00 80 00 00 	movabs $0x8000d7,%rax
+  80031a:	00 00 00 
+  80031d:	ff d0                	call   *%rax
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  80031f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800322:	be 02 00 00 00       	mov    $0x2,%esi
+  800327:	89 c7                	mov    %eax,%edi
+  800329:	48 b8 3b 20 80 00 00 	movabs $0x80203b,%rax
+  800330:	00 00 00 
+  800333:	ff d0                	call   *%rax
+  800335:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800338:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80033c:	79 36                	jns    800374 <dumbfork+0x159>
+		panic("sys_env_set_status: %e", r);
+  80033e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800341:	89 c1                	mov    %eax,%ecx
+  800343:	48 b8 57 25 80 00 00 	movabs $0x802557,%rax
+  80034a:	00 00 00 
+  80034d:	48 89 c2             	mov    %rax,%rdx
+  800350:	be 4a 00 00 00       	mov    $0x4a,%esi
+  800355:	48 b8 12 25 80 00 00 	movabs $0x802512,%rax
+  80035c:	00 00 00 
+  80035f:	48 89 c7             	mov    %rax,%rdi
+  800362:	b8 00 00 00 00       	mov    $0x0,%eax
+  800367:	49 b8 0e 04 80 00 00 	movabs $0x80040e,%r8
+  80036e:	00 00 00 
+  800371:	41 ff d0             	call   *%r8
+
+	return envid;
+  800374:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800377:	c9                   	leave
+  800378:	c3                   	ret
+
+0000000000800379 <libmain>:
+
+/**
+ *  用户环境从lib/libmain.c中的函数libmain开始执行，这个函数进而调用umain，用户写的程序入口只能是umain
+ */
+void libmain(int argc, char **argv)
+{
+  800379:	55                   	push   %rbp
+  80037a:	48 89 e5             	mov    %rsp,%rbp
+  80037d:	48 83 ec 10          	sub    $0x10,%rsp
+  800381:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800384:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 设置常量 thisproc 指向 procs[] 中当前环境的 Env 结构，ENVX 确保环境 id 未超过了 NENV
+	// thisproc 指向当前环境的 Env 结构
+	thisproc = &procs[ENVX(sys_getprocid())];
+  800388:	48 b8 c4 1e 80 00 00 	movabs $0x801ec4,%rax
+  80038f:	00 00 00 
+  800392:	ff d0                	call   *%rax
+  800394:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800399:	48 98                	cltq
+  80039b:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  8003a2:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  8003a9:	00 00 00 
+  8003ac:	48 01 c2             	add    %rax,%rdx
+  8003af:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  8003b6:	00 00 00 
+  8003b9:	48 89 10             	mov    %rdx,(%rax)
+
+	// 通过 CPUID 选择 memset/memmove/memcpy 的实现
+	mem_init();
+  8003bc:	48 b8 6c 15 80 00 00 	movabs $0x80156c,%rax
+  8003c3:	00 00 00 
+  8003c6:	ff d0                	call   *%rax
+
+	// 为了能让panic()提示用户错误，存储程序的名称
+	if (argc > 0)
+  8003c8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8003cc:	7e 14                	jle    8003e2 <libmain+0x69>
+		binaryname = argv[0];
+  8003ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003d2:	48 8b 00             	mov    (%rax),%rax
+  8003d5:	48 ba 00 40 80 00 00 	movabs $0x804000,%rdx
+  8003dc:	00 00 00 
+  8003df:	48 89 02             	mov    %rax,(%rdx)
+
+	// 调用用户的主程序
+	umain(argc, argv);
+  8003e2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8003e6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8003e9:	48 89 d6             	mov    %rdx,%rsi
+  8003ec:	89 c7                	mov    %eax,%edi
+  8003ee:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  8003f5:	00 00 00 
+  8003f8:	ff d0                	call   *%rax
+
+	// 退出当前环境，env_destroy
+	sys_env_destroy(0);
+  8003fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003ff:	48 b8 7e 1e 80 00 00 	movabs $0x801e7e,%rax
+  800406:	00 00 00 
+  800409:	ff d0                	call   *%rax
+}
+  80040b:	90                   	nop
+  80040c:	c9                   	leave
+  80040d:	c3                   	ret
+
+000000000080040e <_panic>:
+/*
+ * 无法解决的致命错误会导致死机
+ * 打印"死机:<消息>”，然后导致处理器休眠进入HLT状态
+ */
+void _panic(const char *file, int line, const char *fmt, ...)
+{
+  80040e:	55                   	push   %rbp
+  80040f:	48 89 e5             	mov    %rsp,%rbp
+  800412:	53                   	push   %rbx
+  800413:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80041a:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  800421:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  800427:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  80042e:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  800435:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  80043c:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  800443:	84 c0                	test   %al,%al
+  800445:	74 23                	je     80046a <_panic+0x5c>
+  800447:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  80044e:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  800452:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  800456:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  80045a:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  80045e:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  800462:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  800466:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80046a:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  800471:	00 00 00 
+  800474:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  80047b:	00 00 00 
+  80047e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800482:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  800489:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  800490:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+	// 输出死机的信息
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800497:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80049e:	00 00 00 
+  8004a1:	48 8b 18             	mov    (%rax),%rbx
+  8004a4:	48 b8 c4 1e 80 00 00 	movabs $0x801ec4,%rax
+  8004ab:	00 00 00 
+  8004ae:	ff d0                	call   *%rax
+  8004b0:	89 c6                	mov    %eax,%esi
+  8004b2:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  8004b8:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8004bf:	41 89 d0             	mov    %edx,%r8d
+  8004c2:	48 89 c1             	mov    %rax,%rcx
+  8004c5:	48 89 da             	mov    %rbx,%rdx
+  8004c8:	48 b8 78 25 80 00 00 	movabs $0x802578,%rax
+  8004cf:	00 00 00 
+  8004d2:	48 89 c7             	mov    %rax,%rdi
+  8004d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004da:	49 b9 51 06 80 00 00 	movabs $0x800651,%r9
+  8004e1:	00 00 00 
+  8004e4:	41 ff d1             	call   *%r9
+			sys_getprocid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8004e7:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  8004ee:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8004f5:	48 89 d6             	mov    %rdx,%rsi
+  8004f8:	48 89 c7             	mov    %rax,%rdi
+  8004fb:	48 b8 a2 05 80 00 00 	movabs $0x8005a2,%rax
+  800502:	00 00 00 
+  800505:	ff d0                	call   *%rax
+	cprintf("\n");
+  800507:	48 b8 9b 25 80 00 00 	movabs $0x80259b,%rax
+  80050e:	00 00 00 
+  800511:	48 89 c7             	mov    %rax,%rdi
+  800514:	b8 00 00 00 00       	mov    $0x0,%eax
+  800519:	48 ba 51 06 80 00 00 	movabs $0x800651,%rdx
+  800520:	00 00 00 
+  800523:	ff d2                	call   *%rdx
+
+	// 触发断点中断
+	while (1)
+		asm volatile("int3");
+  800525:	cc                   	int3
+  800526:	eb fd                	jmp    800525 <_panic+0x117>
+
+0000000000800528 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800528:	55                   	push   %rbp
+  800529:	48 89 e5             	mov    %rsp,%rbp
+  80052c:	48 83 ec 10          	sub    $0x10,%rsp
+  800530:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800533:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->buf[b->idx++] = ch;
+  800537:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80053b:	8b 00                	mov    (%rax),%eax
+  80053d:	8d 48 01             	lea    0x1(%rax),%ecx
+  800540:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800544:	89 0a                	mov    %ecx,(%rdx)
+  800546:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800549:	89 d1                	mov    %edx,%ecx
+  80054b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80054f:	48 98                	cltq
+  800551:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+	if (b->idx == 256-1) {
+  800555:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800559:	8b 00                	mov    (%rax),%eax
+  80055b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800560:	75 2c                	jne    80058e <putch+0x66>
+		sys_cputs(b->buf, b->idx);
+  800562:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800566:	8b 00                	mov    (%rax),%eax
+  800568:	48 98                	cltq
+  80056a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80056e:	48 83 c2 08          	add    $0x8,%rdx
+  800572:	48 89 c6             	mov    %rax,%rsi
+  800575:	48 89 d7             	mov    %rdx,%rdi
+  800578:	48 b8 f5 1d 80 00 00 	movabs $0x801df5,%rax
+  80057f:	00 00 00 
+  800582:	ff d0                	call   *%rax
+		b->idx = 0;
+  800584:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800588:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	}
+	b->cnt++;
+  80058e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800592:	8b 40 04             	mov    0x4(%rax),%eax
+  800595:	8d 50 01             	lea    0x1(%rax),%edx
+  800598:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80059c:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80059f:	90                   	nop
+  8005a0:	c9                   	leave
+  8005a1:	c3                   	ret
+
+00000000008005a2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8005a2:	55                   	push   %rbp
+  8005a3:	48 89 e5             	mov    %rsp,%rbp
+  8005a6:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8005ad:	48 89 bd c8 fe ff ff 	mov    %rdi,-0x138(%rbp)
+  8005b4:	48 89 b5 c0 fe ff ff 	mov    %rsi,-0x140(%rbp)
+	struct printbuf b;
+	va_list aq;
+	va_copy(aq,ap);
+  8005bb:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  8005c2:	48 8b b5 c0 fe ff ff 	mov    -0x140(%rbp),%rsi
+  8005c9:	48 8b 06             	mov    (%rsi),%rax
+  8005cc:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8005d0:	48 89 01             	mov    %rax,(%rcx)
+  8005d3:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8005d7:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8005db:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	b.idx = 0;
+  8005df:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8005e6:	00 00 00 
+	b.cnt = 0;
+  8005e9:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8005f0:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, aq);
+  8005f3:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  8005fa:	48 8b 95 c8 fe ff ff 	mov    -0x138(%rbp),%rdx
+  800601:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800608:	48 89 c6             	mov    %rax,%rsi
+  80060b:	48 b8 28 05 80 00 00 	movabs $0x800528,%rax
+  800612:	00 00 00 
+  800615:	48 89 c7             	mov    %rax,%rdi
+  800618:	48 b8 ef 09 80 00 00 	movabs $0x8009ef,%rax
+  80061f:	00 00 00 
+  800622:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  800624:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  80062a:	48 98                	cltq
+  80062c:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800633:	48 83 c2 08          	add    $0x8,%rdx
+  800637:	48 89 c6             	mov    %rax,%rsi
+  80063a:	48 89 d7             	mov    %rdx,%rdi
+  80063d:	48 b8 f5 1d 80 00 00 	movabs $0x801df5,%rax
+  800644:	00 00 00 
+  800647:	ff d0                	call   *%rax
+	va_end(aq);
+
+	return b.cnt;
+  800649:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80064f:	c9                   	leave
+  800650:	c3                   	ret
+
+0000000000800651 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800651:	55                   	push   %rbp
+  800652:	48 89 e5             	mov    %rsp,%rbp
+  800655:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  80065c:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800663:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80066a:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800671:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800678:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80067f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800686:	84 c0                	test   %al,%al
+  800688:	74 20                	je     8006aa <cprintf+0x59>
+  80068a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80068e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800692:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800696:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80069a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80069e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8006a2:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8006a6:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+	va_list aq;
+	va_start(ap, fmt);
+  8006aa:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8006b1:	00 00 00 
+  8006b4:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8006bb:	00 00 00 
+  8006be:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006c2:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8006c9:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8006d0:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  8006d7:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8006de:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8006e5:	48 8b 06             	mov    (%rsi),%rax
+  8006e8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8006ec:	48 89 01             	mov    %rax,(%rcx)
+  8006ef:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8006f3:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8006f7:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	cnt = vcprintf(fmt, aq);
+  8006fb:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800702:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800709:	48 89 d6             	mov    %rdx,%rsi
+  80070c:	48 89 c7             	mov    %rax,%rdi
+  80070f:	48 b8 a2 05 80 00 00 	movabs $0x8005a2,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+  80071b:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return cnt;
+  800721:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800727:	c9                   	leave
+  800728:	c3                   	ret
+
+0000000000800729 <printnum>:
+ * num: 需要打印出来的整型数，base: 整型数的进制，其他参数同 vprintfmt
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+		 unsigned long long num, unsigned base, int width, int padc)
+{
+  800729:	55                   	push   %rbp
+  80072a:	48 89 e5             	mov    %rsp,%rbp
+  80072d:	48 83 ec 30          	sub    $0x30,%rsp
+  800731:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800735:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800739:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80073d:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  800740:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  800744:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+	// 当 num 超过一位数，首先递归函数自身打印所有高位的(更重要的)数字
+	if (num >= base)
+  800748:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80074b:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  80074f:	72 54                	jb     8007a5 <printnum+0x7c>
+	{
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800751:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800754:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800757:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  80075a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80075e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800763:	48 f7 f6             	div    %rsi
+  800766:	49 89 c2             	mov    %rax,%r10
+  800769:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80076c:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80076f:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800773:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800777:	41 89 c9             	mov    %ecx,%r9d
+  80077a:	41 89 f8             	mov    %edi,%r8d
+  80077d:	89 d1                	mov    %edx,%ecx
+  80077f:	4c 89 d2             	mov    %r10,%rdx
+  800782:	48 89 c7             	mov    %rax,%rdi
+  800785:	48 b8 29 07 80 00 00 	movabs $0x800729,%rax
+  80078c:	00 00 00 
+  80078f:	ff d0                	call   *%rax
+  800791:	eb 1c                	jmp    8007af <printnum+0x86>
+	}
+	else
+	{
+		// 按照右对齐的格式在左侧补齐填充字符 padc
+		while (--width > 0)
+			putch(padc, putdat);
+  800793:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800797:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80079a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80079e:	48 89 d6             	mov    %rdx,%rsi
+  8007a1:	89 c7                	mov    %eax,%edi
+  8007a3:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8007a5:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  8007a9:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8007ad:	7f e4                	jg     800793 <printnum+0x6a>
+	}
+
+	// 然后打印个位数字
+	putch("0123456789abcdef"[num % base], putdat);
+  8007af:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8007b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007bb:	48 f7 f1             	div    %rcx
+  8007be:	48 b8 90 27 80 00 00 	movabs $0x802790,%rax
+  8007c5:	00 00 00 
+  8007c8:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8007cc:	0f be c0             	movsbl %al,%eax
+  8007cf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8007d3:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8007d7:	48 89 d6             	mov    %rdx,%rsi
+  8007da:	89 c7                	mov    %eax,%edi
+  8007dc:	ff d1                	call   *%rcx
+}
+  8007de:	90                   	nop
+  8007df:	c9                   	leave
+  8007e0:	c3                   	ret
+
+00000000008007e1 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  8007e1:	55                   	push   %rbp
+  8007e2:	48 89 e5             	mov    %rsp,%rbp
+  8007e5:	48 83 ec 20          	sub    $0x20,%rsp
+  8007e9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8007ed:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;
+	if (lflag >= 2)
+  8007f0:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8007f4:	7e 4f                	jle    800845 <getuint+0x64>
+		x = va_arg(*ap, unsigned long long);
+  8007f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007fa:	8b 00                	mov    (%rax),%eax
+  8007fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ff:	77 24                	ja     800825 <getuint+0x44>
+  800801:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800805:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800809:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80080d:	8b 00                	mov    (%rax),%eax
+  80080f:	89 c0                	mov    %eax,%eax
+  800811:	48 01 d0             	add    %rdx,%rax
+  800814:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800818:	8b 12                	mov    (%rdx),%edx
+  80081a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80081d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800821:	89 0a                	mov    %ecx,(%rdx)
+  800823:	eb 14                	jmp    800839 <getuint+0x58>
+  800825:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800829:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80082d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800831:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800835:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800839:	48 8b 00             	mov    (%rax),%rax
+  80083c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800840:	e9 9d 00 00 00       	jmp    8008e2 <getuint+0x101>
+	else if (lflag)
+  800845:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800849:	74 4c                	je     800897 <getuint+0xb6>
+		x = va_arg(*ap, unsigned long);
+  80084b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80084f:	8b 00                	mov    (%rax),%eax
+  800851:	83 f8 2f             	cmp    $0x2f,%eax
+  800854:	77 24                	ja     80087a <getuint+0x99>
+  800856:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80085a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80085e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800862:	8b 00                	mov    (%rax),%eax
+  800864:	89 c0                	mov    %eax,%eax
+  800866:	48 01 d0             	add    %rdx,%rax
+  800869:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80086d:	8b 12                	mov    (%rdx),%edx
+  80086f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800872:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800876:	89 0a                	mov    %ecx,(%rdx)
+  800878:	eb 14                	jmp    80088e <getuint+0xad>
+  80087a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80087e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800882:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800886:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80088a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80088e:	48 8b 00             	mov    (%rax),%rax
+  800891:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800895:	eb 4b                	jmp    8008e2 <getuint+0x101>
+	else
+		x = va_arg(*ap, unsigned int);
+  800897:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80089b:	8b 00                	mov    (%rax),%eax
+  80089d:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a0:	77 24                	ja     8008c6 <getuint+0xe5>
+  8008a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008a6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008ae:	8b 00                	mov    (%rax),%eax
+  8008b0:	89 c0                	mov    %eax,%eax
+  8008b2:	48 01 d0             	add    %rdx,%rax
+  8008b5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008b9:	8b 12                	mov    (%rdx),%edx
+  8008bb:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008be:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008c2:	89 0a                	mov    %ecx,(%rdx)
+  8008c4:	eb 14                	jmp    8008da <getuint+0xf9>
+  8008c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008ca:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008ce:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008d2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008d6:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008da:	8b 00                	mov    (%rax),%eax
+  8008dc:	89 c0                	mov    %eax,%eax
+  8008de:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8008e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8008e6:	c9                   	leave
+  8008e7:	c3                   	ret
+
+00000000008008e8 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  8008e8:	55                   	push   %rbp
+  8008e9:	48 89 e5             	mov    %rsp,%rbp
+  8008ec:	48 83 ec 20          	sub    $0x20,%rsp
+  8008f0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8008f4:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  8008f7:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8008fb:	7e 4f                	jle    80094c <getint+0x64>
+		x = va_arg(*ap, long long);
+  8008fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800901:	8b 00                	mov    (%rax),%eax
+  800903:	83 f8 2f             	cmp    $0x2f,%eax
+  800906:	77 24                	ja     80092c <getint+0x44>
+  800908:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80090c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800910:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800914:	8b 00                	mov    (%rax),%eax
+  800916:	89 c0                	mov    %eax,%eax
+  800918:	48 01 d0             	add    %rdx,%rax
+  80091b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80091f:	8b 12                	mov    (%rdx),%edx
+  800921:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800924:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800928:	89 0a                	mov    %ecx,(%rdx)
+  80092a:	eb 14                	jmp    800940 <getint+0x58>
+  80092c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800930:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800934:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800938:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80093c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800940:	48 8b 00             	mov    (%rax),%rax
+  800943:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800947:	e9 9d 00 00 00       	jmp    8009e9 <getint+0x101>
+	else if (lflag)
+  80094c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800950:	74 4c                	je     80099e <getint+0xb6>
+		x = va_arg(*ap, long);
+  800952:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800956:	8b 00                	mov    (%rax),%eax
+  800958:	83 f8 2f             	cmp    $0x2f,%eax
+  80095b:	77 24                	ja     800981 <getint+0x99>
+  80095d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800961:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800965:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800969:	8b 00                	mov    (%rax),%eax
+  80096b:	89 c0                	mov    %eax,%eax
+  80096d:	48 01 d0             	add    %rdx,%rax
+  800970:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800974:	8b 12                	mov    (%rdx),%edx
+  800976:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800979:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80097d:	89 0a                	mov    %ecx,(%rdx)
+  80097f:	eb 14                	jmp    800995 <getint+0xad>
+  800981:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800985:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800989:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80098d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800991:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800995:	48 8b 00             	mov    (%rax),%rax
+  800998:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80099c:	eb 4b                	jmp    8009e9 <getint+0x101>
+	else
+		x = va_arg(*ap, int);
+  80099e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009a2:	8b 00                	mov    (%rax),%eax
+  8009a4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a7:	77 24                	ja     8009cd <getint+0xe5>
+  8009a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009ad:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009b5:	8b 00                	mov    (%rax),%eax
+  8009b7:	89 c0                	mov    %eax,%eax
+  8009b9:	48 01 d0             	add    %rdx,%rax
+  8009bc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009c0:	8b 12                	mov    (%rdx),%edx
+  8009c2:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009c5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009c9:	89 0a                	mov    %ecx,(%rdx)
+  8009cb:	eb 14                	jmp    8009e1 <getint+0xf9>
+  8009cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009d1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009d5:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009d9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009dd:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009e1:	8b 00                	mov    (%rax),%eax
+  8009e3:	48 98                	cltq
+  8009e5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8009e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8009ed:	c9                   	leave
+  8009ee:	c3                   	ret
+
+00000000008009ef <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap)
+{
+  8009ef:	55                   	push   %rbp
+  8009f0:	48 89 e5             	mov    %rsp,%rbp
+  8009f3:	41 54                	push   %r12
+  8009f5:	53                   	push   %rbx
+  8009f6:	48 83 ec 60          	sub    $0x60,%rsp
+  8009fa:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8009fe:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800a02:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800a06:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+	int base, lflag, width, precision, altflag;
+
+	// 填充字符，在显示字符串的'%'后读到'-'或'0'时，赋值到 padc
+	char padc;
+	va_list aq;
+	va_copy(aq, ap);
+  800a0a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800a0e:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800a12:	48 8b 06             	mov    (%rsi),%rax
+  800a15:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800a19:	48 89 01             	mov    %rax,(%rcx)
+  800a1c:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800a20:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800a24:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1)
+	{
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800a28:	eb 17                	jmp    800a41 <vprintfmt+0x52>
+		{
+			if (ch == '\0')
+  800a2a:	85 db                	test   %ebx,%ebx
+  800a2c:	0f 84 b9 04 00 00    	je     800eeb <vprintfmt+0x4fc>
+				return;
+			putch(ch, putdat);
+  800a32:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a36:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a3a:	48 89 c6             	mov    %rax,%rsi
+  800a3d:	89 df                	mov    %ebx,%edi
+  800a3f:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800a41:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a45:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a49:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800a4d:	0f b6 00             	movzbl (%rax),%eax
+  800a50:	0f b6 d8             	movzbl %al,%ebx
+  800a53:	83 fb 25             	cmp    $0x25,%ebx
+  800a56:	75 d2                	jne    800a2a <vprintfmt+0x3b>
+		}
+
+		// 处理 % 转义序列
+		// padc 初始化为空格符，padc='-'代表字符串左对齐，右边补空格，padc=' '代表右对齐，左边补空格，padc='0'右对齐，左边补0
+		padc = ' ';
+  800a58:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+		width = -1;
+  800a5c:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+		// 默认-1代表显示长度为字符串本来的长度
+		precision = -1;
+  800a63:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+		lflag = 0;
+  800a6a:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+		altflag = 0;
+  800a71:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *)fmt++)
+  800a78:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a7c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a80:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800a84:	0f b6 00             	movzbl (%rax),%eax
+  800a87:	0f b6 d8             	movzbl %al,%ebx
+  800a8a:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800a8d:	83 f8 55             	cmp    $0x55,%eax
+  800a90:	0f 87 22 04 00 00    	ja     800eb8 <vprintfmt+0x4c9>
+  800a96:	89 c0                	mov    %eax,%eax
+  800a98:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800a9f:	00 
+  800aa0:	48 b8 b8 27 80 00 00 	movabs $0x8027b8,%rax
+  800aa7:	00 00 00 
+  800aaa:	48 01 d0             	add    %rdx,%rax
+  800aad:	48 8b 00             	mov    (%rax),%rax
+  800ab0:	ff e0                	jmp    *%rax
+		{
+
+		// flag to pad on the right
+		case '-':
+			padc = '-';
+  800ab2:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+			goto reswitch;
+  800ab6:	eb c0                	jmp    800a78 <vprintfmt+0x89>
+
+		// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800ab8:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+			goto reswitch;
+  800abc:	eb ba                	jmp    800a78 <vprintfmt+0x89>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0;; ++fmt)
+  800abe:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+			{
+				precision = precision * 10 + ch - '0';
+  800ac5:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800ac8:	89 d0                	mov    %edx,%eax
+  800aca:	c1 e0 02             	shl    $0x2,%eax
+  800acd:	01 d0                	add    %edx,%eax
+  800acf:	01 c0                	add    %eax,%eax
+  800ad1:	01 d8                	add    %ebx,%eax
+  800ad3:	83 e8 30             	sub    $0x30,%eax
+  800ad6:	89 45 d8             	mov    %eax,-0x28(%rbp)
+				ch = *fmt;
+  800ad9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800add:	0f b6 00             	movzbl (%rax),%eax
+  800ae0:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800ae3:	83 fb 2f             	cmp    $0x2f,%ebx
+  800ae6:	7e 60                	jle    800b48 <vprintfmt+0x159>
+  800ae8:	83 fb 39             	cmp    $0x39,%ebx
+  800aeb:	7f 5b                	jg     800b48 <vprintfmt+0x159>
+			for (precision = 0;; ++fmt)
+  800aed:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+				precision = precision * 10 + ch - '0';
+  800af2:	eb d1                	jmp    800ac5 <vprintfmt+0xd6>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800af4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af7:	83 f8 2f             	cmp    $0x2f,%eax
+  800afa:	77 17                	ja     800b13 <vprintfmt+0x124>
+  800afc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b00:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b03:	89 d2                	mov    %edx,%edx
+  800b05:	48 01 d0             	add    %rdx,%rax
+  800b08:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b0b:	83 c2 08             	add    $0x8,%edx
+  800b0e:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b11:	eb 0c                	jmp    800b1f <vprintfmt+0x130>
+  800b13:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b17:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b1b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b1f:	8b 00                	mov    (%rax),%eax
+  800b21:	89 45 d8             	mov    %eax,-0x28(%rbp)
+			goto process_precision;
+  800b24:	eb 23                	jmp    800b49 <vprintfmt+0x15a>
+
+		case '.':
+			if (width < 0)
+  800b26:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b2a:	0f 89 48 ff ff ff    	jns    800a78 <vprintfmt+0x89>
+				width = 0;
+  800b30:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+			goto reswitch;
+  800b37:	e9 3c ff ff ff       	jmp    800a78 <vprintfmt+0x89>
+
+		case '#':
+			altflag = 1;
+  800b3c:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+			goto reswitch;
+  800b43:	e9 30 ff ff ff       	jmp    800a78 <vprintfmt+0x89>
+			goto process_precision;
+  800b48:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800b49:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b4d:	0f 89 25 ff ff ff    	jns    800a78 <vprintfmt+0x89>
+				width = precision, precision = -1;
+  800b53:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800b56:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800b59:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+			goto reswitch;
+  800b60:	e9 13 ff ff ff       	jmp    800a78 <vprintfmt+0x89>
+
+		// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800b65:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+			goto reswitch;
+  800b69:	e9 0a ff ff ff       	jmp    800a78 <vprintfmt+0x89>
+
+		// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800b6e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b71:	83 f8 2f             	cmp    $0x2f,%eax
+  800b74:	77 17                	ja     800b8d <vprintfmt+0x19e>
+  800b76:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b7a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b7d:	89 d2                	mov    %edx,%edx
+  800b7f:	48 01 d0             	add    %rdx,%rax
+  800b82:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b85:	83 c2 08             	add    $0x8,%edx
+  800b88:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b8b:	eb 0c                	jmp    800b99 <vprintfmt+0x1aa>
+  800b8d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b91:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b95:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b99:	8b 00                	mov    (%rax),%eax
+  800b9b:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800b9f:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800ba3:	48 89 d6             	mov    %rdx,%rsi
+  800ba6:	89 c7                	mov    %eax,%edi
+  800ba8:	ff d1                	call   *%rcx
+			break;
+  800baa:	e9 37 03 00 00       	jmp    800ee6 <vprintfmt+0x4f7>
+
+		// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800baf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb2:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb5:	77 17                	ja     800bce <vprintfmt+0x1df>
+  800bb7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800bbb:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800bbe:	89 d2                	mov    %edx,%edx
+  800bc0:	48 01 d0             	add    %rdx,%rax
+  800bc3:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800bc6:	83 c2 08             	add    $0x8,%edx
+  800bc9:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800bcc:	eb 0c                	jmp    800bda <vprintfmt+0x1eb>
+  800bce:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800bd2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800bd6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800bda:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800bdc:	85 db                	test   %ebx,%ebx
+  800bde:	79 02                	jns    800be2 <vprintfmt+0x1f3>
+				err = -err;
+  800be0:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800be2:	83 fb 11             	cmp    $0x11,%ebx
+  800be5:	7f 16                	jg     800bfd <vprintfmt+0x20e>
+  800be7:	48 ba 00 27 80 00 00 	movabs $0x802700,%rdx
+  800bee:	00 00 00 
+  800bf1:	48 63 c3             	movslq %ebx,%rax
+  800bf4:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800bf8:	4d 85 e4             	test   %r12,%r12
+  800bfb:	75 2e                	jne    800c2b <vprintfmt+0x23c>
+				printfmt(putch, putdat, "error %d", err);
+  800bfd:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800c01:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c05:	89 d9                	mov    %ebx,%ecx
+  800c07:	48 ba a1 27 80 00 00 	movabs $0x8027a1,%rdx
+  800c0e:	00 00 00 
+  800c11:	48 89 c7             	mov    %rax,%rdi
+  800c14:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c19:	49 b8 f5 0e 80 00 00 	movabs $0x800ef5,%r8
+  800c20:	00 00 00 
+  800c23:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800c26:	e9 bb 02 00 00       	jmp    800ee6 <vprintfmt+0x4f7>
+				printfmt(putch, putdat, "%s", p);
+  800c2b:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800c2f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c33:	4c 89 e1             	mov    %r12,%rcx
+  800c36:	48 ba aa 27 80 00 00 	movabs $0x8027aa,%rdx
+  800c3d:	00 00 00 
+  800c40:	48 89 c7             	mov    %rax,%rdi
+  800c43:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c48:	49 b8 f5 0e 80 00 00 	movabs $0x800ef5,%r8
+  800c4f:	00 00 00 
+  800c52:	41 ff d0             	call   *%r8
+			break;
+  800c55:	e9 8c 02 00 00       	jmp    800ee6 <vprintfmt+0x4f7>
+
+		// string
+		case 's':
+			// 从可变参数中读入字符串指针
+			if ((p = va_arg(aq, char *)) == NULL)
+  800c5a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c5d:	83 f8 2f             	cmp    $0x2f,%eax
+  800c60:	77 17                	ja     800c79 <vprintfmt+0x28a>
+  800c62:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c66:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c69:	89 d2                	mov    %edx,%edx
+  800c6b:	48 01 d0             	add    %rdx,%rax
+  800c6e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c71:	83 c2 08             	add    $0x8,%edx
+  800c74:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800c77:	eb 0c                	jmp    800c85 <vprintfmt+0x296>
+  800c79:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800c7d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c81:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800c85:	4c 8b 20             	mov    (%rax),%r12
+  800c88:	4d 85 e4             	test   %r12,%r12
+  800c8b:	75 0a                	jne    800c97 <vprintfmt+0x2a8>
+				p = "(null)"; // 当字符串为空时，将它指向"(null)"字符串
+  800c8d:	49 bc ad 27 80 00 00 	movabs $0x8027ad,%r12
+  800c94:	00 00 00 
+			// 判断左对齐还是右对齐，pad='-'左对齐，否则右对齐
+			if (width > 0 && padc != '-')
+  800c97:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800c9b:	7e 78                	jle    800d15 <vprintfmt+0x326>
+  800c9d:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800ca1:	74 72                	je     800d15 <vprintfmt+0x326>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ca3:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800ca6:	48 98                	cltq
+  800ca8:	48 89 c6             	mov    %rax,%rsi
+  800cab:	4c 89 e7             	mov    %r12,%rdi
+  800cae:	48 b8 9a 12 80 00 00 	movabs $0x80129a,%rax
+  800cb5:	00 00 00 
+  800cb8:	ff d0                	call   *%rax
+  800cba:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800cbd:	eb 17                	jmp    800cd6 <vprintfmt+0x2e7>
+					putch(padc, putdat); // 字符串右对齐，左边补相应数量(width-实际长度)的空格或者 0
+  800cbf:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800cc3:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800cc7:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800ccb:	48 89 d6             	mov    %rdx,%rsi
+  800cce:	89 c7                	mov    %eax,%edi
+  800cd0:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800cd2:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800cd6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800cda:	7f e3                	jg     800cbf <vprintfmt+0x2d0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800cdc:	eb 37                	jmp    800d15 <vprintfmt+0x326>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800cde:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800ce2:	74 1e                	je     800d02 <vprintfmt+0x313>
+  800ce4:	83 fb 1f             	cmp    $0x1f,%ebx
+  800ce7:	7e 05                	jle    800cee <vprintfmt+0x2ff>
+  800ce9:	83 fb 7e             	cmp    $0x7e,%ebx
+  800cec:	7e 14                	jle    800d02 <vprintfmt+0x313>
+					putch('?', putdat);
+  800cee:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800cf2:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800cf6:	48 89 c6             	mov    %rax,%rsi
+  800cf9:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800cfe:	ff d2                	call   *%rdx
+  800d00:	eb 0f                	jmp    800d11 <vprintfmt+0x322>
+				else
+					putch(ch, putdat); // 打印相应长度的字符串
+  800d02:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d06:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d0a:	48 89 c6             	mov    %rax,%rsi
+  800d0d:	89 df                	mov    %ebx,%edi
+  800d0f:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800d11:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800d15:	4c 89 e0             	mov    %r12,%rax
+  800d18:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800d1c:	0f b6 00             	movzbl (%rax),%eax
+  800d1f:	0f be d8             	movsbl %al,%ebx
+  800d22:	85 db                	test   %ebx,%ebx
+  800d24:	74 28                	je     800d4e <vprintfmt+0x35f>
+  800d26:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800d2a:	78 b2                	js     800cde <vprintfmt+0x2ef>
+  800d2c:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800d30:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800d34:	79 a8                	jns    800cde <vprintfmt+0x2ef>
+			for (; width > 0; width--)
+  800d36:	eb 16                	jmp    800d4e <vprintfmt+0x35f>
+				putch(' ', putdat); // 当字符串是左对齐的时候打印相应数量的空格
+  800d38:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d3c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d40:	48 89 c6             	mov    %rax,%rsi
+  800d43:	bf 20 00 00 00       	mov    $0x20,%edi
+  800d48:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800d4a:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800d4e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800d52:	7f e4                	jg     800d38 <vprintfmt+0x349>
+			break;
+  800d54:	e9 8d 01 00 00       	jmp    800ee6 <vprintfmt+0x4f7>
+
+		// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800d59:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800d5d:	be 03 00 00 00       	mov    $0x3,%esi
+  800d62:	48 89 c7             	mov    %rax,%rdi
+  800d65:	48 b8 e8 08 80 00 00 	movabs $0x8008e8,%rax
+  800d6c:	00 00 00 
+  800d6f:	ff d0                	call   *%rax
+  800d71:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((long long)num < 0)
+  800d75:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d79:	48 85 c0             	test   %rax,%rax
+  800d7c:	79 1d                	jns    800d9b <vprintfmt+0x3ac>
+			{
+				putch('-', putdat);
+  800d7e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d82:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d86:	48 89 c6             	mov    %rax,%rsi
+  800d89:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800d8e:	ff d2                	call   *%rdx
+				num = -(long long)num;
+  800d90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d94:	48 f7 d8             	neg    %rax
+  800d97:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			}
+			base = 10;
+  800d9b:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800da2:	e9 d2 00 00 00       	jmp    800e79 <vprintfmt+0x48a>
+
+		// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800da7:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800dab:	be 03 00 00 00       	mov    $0x3,%esi
+  800db0:	48 89 c7             	mov    %rax,%rdi
+  800db3:	48 b8 e1 07 80 00 00 	movabs $0x8007e1,%rax
+  800dba:	00 00 00 
+  800dbd:	ff d0                	call   *%rax
+  800dbf:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 10;
+  800dc3:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800dca:	e9 aa 00 00 00       	jmp    800e79 <vprintfmt+0x48a>
+		// (unsigned) octal
+		case 'o':
+			// Gets the variable argument with type integer from the point which was processed last by va_arg
+			// calls getuint which returns a long long value, which then calls printnum which prints based on
+			// base value.
+			num = getuint(&aq, 3);
+  800dcf:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800dd3:	be 03 00 00 00       	mov    $0x3,%esi
+  800dd8:	48 89 c7             	mov    %rax,%rdi
+  800ddb:	48 b8 e1 07 80 00 00 	movabs $0x8007e1,%rax
+  800de2:	00 00 00 
+  800de5:	ff d0                	call   *%rax
+  800de7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 8;
+  800deb:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+			goto number;
+  800df2:	e9 82 00 00 00       	jmp    800e79 <vprintfmt+0x48a>
+
+		// pointer
+		case 'p':
+			putch('0', putdat);
+  800df7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800dfb:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800dff:	48 89 c6             	mov    %rax,%rsi
+  800e02:	bf 30 00 00 00       	mov    $0x30,%edi
+  800e07:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800e09:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e0d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e11:	48 89 c6             	mov    %rax,%rsi
+  800e14:	bf 78 00 00 00       	mov    $0x78,%edi
+  800e19:	ff d2                	call   *%rdx
+			num = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800e1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e1e:	83 f8 2f             	cmp    $0x2f,%eax
+  800e21:	77 17                	ja     800e3a <vprintfmt+0x44b>
+  800e23:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e27:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800e2a:	89 d2                	mov    %edx,%edx
+  800e2c:	48 01 d0             	add    %rdx,%rax
+  800e2f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800e32:	83 c2 08             	add    $0x8,%edx
+  800e35:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800e38:	eb 0c                	jmp    800e46 <vprintfmt+0x457>
+  800e3a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800e3e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e42:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800e46:	48 8b 00             	mov    (%rax),%rax
+  800e49:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800e4d:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+			goto number;
+  800e54:	eb 23                	jmp    800e79 <vprintfmt+0x48a>
+
+		// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800e56:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800e5a:	be 03 00 00 00       	mov    $0x3,%esi
+  800e5f:	48 89 c7             	mov    %rax,%rdi
+  800e62:	48 b8 e1 07 80 00 00 	movabs $0x8007e1,%rax
+  800e69:	00 00 00 
+  800e6c:	ff d0                	call   *%rax
+  800e6e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800e72:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800e79:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800e7e:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800e81:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800e84:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e88:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800e8c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e90:	45 89 c1             	mov    %r8d,%r9d
+  800e93:	41 89 f8             	mov    %edi,%r8d
+  800e96:	48 89 c7             	mov    %rax,%rdi
+  800e99:	48 b8 29 07 80 00 00 	movabs $0x800729,%rax
+  800ea0:	00 00 00 
+  800ea3:	ff d0                	call   *%rax
+			break;
+  800ea5:	eb 3f                	jmp    800ee6 <vprintfmt+0x4f7>
+
+		// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800ea7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800eab:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800eaf:	48 89 c6             	mov    %rax,%rsi
+  800eb2:	89 df                	mov    %ebx,%edi
+  800eb4:	ff d2                	call   *%rdx
+			break;
+  800eb6:	eb 2e                	jmp    800ee6 <vprintfmt+0x4f7>
+
+		// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800eb8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ebc:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ec0:	48 89 c6             	mov    %rax,%rsi
+  800ec3:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ec8:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800eca:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800ecf:	eb 05                	jmp    800ed6 <vprintfmt+0x4e7>
+  800ed1:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800ed6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800eda:	48 83 e8 01          	sub    $0x1,%rax
+  800ede:	0f b6 00             	movzbl (%rax),%eax
+  800ee1:	3c 25                	cmp    $0x25,%al
+  800ee3:	75 ec                	jne    800ed1 <vprintfmt+0x4e2>
+				/* do nothing */;
+			break;
+  800ee5:	90                   	nop
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800ee6:	e9 56 fb ff ff       	jmp    800a41 <vprintfmt+0x52>
+				return;
+  800eeb:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800eec:	48 83 c4 60          	add    $0x60,%rsp
+  800ef0:	5b                   	pop    %rbx
+  800ef1:	41 5c                	pop    %r12
+  800ef3:	5d                   	pop    %rbp
+  800ef4:	c3                   	ret
+
+0000000000800ef5 <printfmt>:
+
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...)
+{
+  800ef5:	55                   	push   %rbp
+  800ef6:	48 89 e5             	mov    %rsp,%rbp
+  800ef9:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800f00:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800f07:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800f0e:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800f15:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f1c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f23:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f2a:	84 c0                	test   %al,%al
+  800f2c:	74 20                	je     800f4e <printfmt+0x59>
+  800f2e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f32:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f36:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f3a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f3e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f42:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f46:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f4a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800f4e:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800f55:	00 00 00 
+  800f58:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800f5f:	00 00 00 
+  800f62:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f66:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800f6d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f74:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800f7b:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800f82:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800f89:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800f90:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800f97:	48 89 c7             	mov    %rax,%rdi
+  800f9a:	48 b8 ef 09 80 00 00 	movabs $0x8009ef,%rax
+  800fa1:	00 00 00 
+  800fa4:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  800fa6:	90                   	nop
+  800fa7:	c9                   	leave
+  800fa8:	c3                   	ret
+
+0000000000800fa9 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800fa9:	55                   	push   %rbp
+  800faa:	48 89 e5             	mov    %rsp,%rbp
+  800fad:	48 83 ec 10          	sub    $0x10,%rsp
+  800fb1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800fb4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  800fb8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fbc:	8b 40 10             	mov    0x10(%rax),%eax
+  800fbf:	8d 50 01             	lea    0x1(%rax),%edx
+  800fc2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fc6:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  800fc9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fcd:	48 8b 10             	mov    (%rax),%rdx
+  800fd0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fd4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800fd8:	48 39 c2             	cmp    %rax,%rdx
+  800fdb:	73 17                	jae    800ff4 <sprintputch+0x4b>
+		*b->buf++ = ch;
+  800fdd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fe1:	48 8b 00             	mov    (%rax),%rax
+  800fe4:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800fe8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800fec:	48 89 0a             	mov    %rcx,(%rdx)
+  800fef:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800ff2:	88 10                	mov    %dl,(%rax)
+}
+  800ff4:	90                   	nop
+  800ff5:	c9                   	leave
+  800ff6:	c3                   	ret
+
+0000000000800ff7 <vsnprintf>:
+
+int vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800ff7:	55                   	push   %rbp
+  800ff8:	48 89 e5             	mov    %rsp,%rbp
+  800ffb:	48 83 ec 50          	sub    $0x50,%rsp
+  800fff:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801003:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801006:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  80100a:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+	va_list aq;
+	va_copy(aq, ap);
+  80100e:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  801012:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801016:	48 8b 06             	mov    (%rsi),%rax
+  801019:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80101d:	48 89 01             	mov    %rax,(%rcx)
+  801020:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801024:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801028:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	struct sprintbuf b = {buf, buf + n - 1, 0};
+  80102c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801030:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  801034:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801037:	48 98                	cltq
+  801039:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80103d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801041:	48 01 d0             	add    %rdx,%rax
+  801044:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  801048:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+
+	if (buf == NULL || n < 1)
+  80104f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801054:	74 06                	je     80105c <vsnprintf+0x65>
+  801056:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  80105a:	7f 07                	jg     801063 <vsnprintf+0x6c>
+		return -E_INVAL;
+  80105c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801061:	eb 32                	jmp    801095 <vsnprintf+0x9e>
+
+	// print the string to the buffer
+	vprintfmt((void *)sprintputch, &b, fmt, aq);
+  801063:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  801067:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80106b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80106f:	48 89 c6             	mov    %rax,%rsi
+  801072:	48 b8 a9 0f 80 00 00 	movabs $0x800fa9,%rax
+  801079:	00 00 00 
+  80107c:	48 89 c7             	mov    %rax,%rdi
+  80107f:	48 b8 ef 09 80 00 00 	movabs $0x8009ef,%rax
+  801086:	00 00 00 
+  801089:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  80108b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80108f:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  801092:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  801095:	c9                   	leave
+  801096:	c3                   	ret
+
+0000000000801097 <snprintf>:
+
+int snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801097:	55                   	push   %rbp
+  801098:	48 89 e5             	mov    %rsp,%rbp
+  80109b:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8010a2:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8010a9:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8010af:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8010b6:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8010bd:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8010c4:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8010cb:	84 c0                	test   %al,%al
+  8010cd:	74 20                	je     8010ef <snprintf+0x58>
+  8010cf:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8010d3:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8010d7:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8010db:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8010df:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8010e3:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8010e7:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8010eb:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  8010ef:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8010f6:	00 00 00 
+  8010f9:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801100:	00 00 00 
+  801103:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801107:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80110e:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801115:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq, ap);
+  80111c:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801123:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  80112a:	48 8b 06             	mov    (%rsi),%rax
+  80112d:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801131:	48 89 01             	mov    %rax,(%rcx)
+  801134:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801138:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80113c:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  801140:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801147:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  80114e:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801154:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80115b:	48 89 c7             	mov    %rax,%rdi
+  80115e:	48 b8 f7 0f 80 00 00 	movabs $0x800ff7,%rax
+  801165:	00 00 00 
+  801168:	ff d0                	call   *%rax
+  80116a:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801170:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801176:	c9                   	leave
+  801177:	c3                   	ret
+
+0000000000801178 <cpuid>:
+#define read_rip(var) __asm __volatile("leaq (%%rip), %0" : "=r" (var)::"cc","memory")
+
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  801178:	55                   	push   %rbp
+  801179:	48 89 e5             	mov    %rsp,%rbp
+  80117c:	53                   	push   %rbx
+  80117d:	48 83 ec 38          	sub    $0x38,%rsp
+  801181:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  801184:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801188:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80118c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801190:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid" 
+  801194:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801197:	0f a2                	cpuid
+  801199:	89 de                	mov    %ebx,%esi
+  80119b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  80119e:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  8011a1:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  8011a4:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info));
+	if (eaxp)
+  8011a7:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8011ac:	74 09                	je     8011b7 <cpuid+0x3f>
+		*eaxp = eax;
+  8011ae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8011b2:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8011b5:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  8011b7:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8011bc:	74 09                	je     8011c7 <cpuid+0x4f>
+		*ebxp = ebx;
+  8011be:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8011c2:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8011c5:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  8011c7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8011cc:	74 09                	je     8011d7 <cpuid+0x5f>
+		*ecxp = ecx;
+  8011ce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8011d2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8011d5:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  8011d7:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8011dc:	74 09                	je     8011e7 <cpuid+0x6f>
+		*edxp = edx;
+  8011de:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8011e2:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8011e5:	89 10                	mov    %edx,(%rax)
+}
+  8011e7:	90                   	nop
+  8011e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ec:	c9                   	leave
+  8011ed:	c3                   	ret
+
+00000000008011ee <cpuid_count>:
+
+// 带子功能号(%ecx = count)的 cpuid，用于 leaf 4/7/0xB/0xD 等
+static __inline void
+cpuid_count(uint32_t info, uint32_t count, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  8011ee:	55                   	push   %rbp
+  8011ef:	48 89 e5             	mov    %rsp,%rbp
+  8011f2:	53                   	push   %rbx
+  8011f3:	48 83 ec 38          	sub    $0x38,%rsp
+  8011f7:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  8011fa:	89 75 e0             	mov    %esi,-0x20(%rbp)
+  8011fd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801201:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  801205:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+  801209:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  80120d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801210:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  801213:	89 d1                	mov    %edx,%ecx
+  801215:	0f a2                	cpuid
+  801217:	89 de                	mov    %ebx,%esi
+  801219:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  80121c:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  80121f:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  801222:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info), "c" (count));
+	if (eaxp)
+  801225:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80122a:	74 09                	je     801235 <cpuid_count+0x47>
+		*eaxp = eax;
+  80122c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801230:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  801233:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  801235:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80123a:	74 09                	je     801245 <cpuid_count+0x57>
+		*ebxp = ebx;
+  80123c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801240:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  801243:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  801245:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80124a:	74 09                	je     801255 <cpuid_count+0x67>
+		*ecxp = ecx;
+  80124c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801250:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801253:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  801255:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80125a:	74 09                	je     801265 <cpuid_count+0x77>
+		*edxp = edx;
+  80125c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801260:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801263:	89 10                	mov    %edx,(%rax)
+}
+  801265:	90                   	nop
+  801266:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80126a:	c9                   	leave
+  80126b:	c3                   	ret
+
+000000000080126c <strlen>:
+// 在真正的硬件上会有一定程度的优化, 但在 Bochs 上会有更大的优化效果
+// 用这种方法, Primespipe 的运行速度快了3倍
+#define ASM 1
+
+int strlen(const char *s)
+{
+  80126c:	55                   	push   %rbp
+  80126d:	48 89 e5             	mov    %rsp,%rbp
+  801270:	48 83 ec 18          	sub    $0x18,%rsp
+  801274:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801278:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80127f:	eb 09                	jmp    80128a <strlen+0x1e>
+		n++;
+  801281:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801285:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80128a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80128e:	0f b6 00             	movzbl (%rax),%eax
+  801291:	84 c0                	test   %al,%al
+  801293:	75 ec                	jne    801281 <strlen+0x15>
+	return n;
+  801295:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801298:	c9                   	leave
+  801299:	c3                   	ret
+
+000000000080129a <strnlen>:
+
+int strnlen(const char *s, size_t size)
+{
+  80129a:	55                   	push   %rbp
+  80129b:	48 89 e5             	mov    %rsp,%rbp
+  80129e:	48 83 ec 20          	sub    $0x20,%rsp
+  8012a2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012a6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8012aa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8012b1:	eb 0e                	jmp    8012c1 <strnlen+0x27>
+		n++;
+  8012b3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8012b7:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8012bc:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8012c1:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8012c6:	74 0b                	je     8012d3 <strnlen+0x39>
+  8012c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012cc:	0f b6 00             	movzbl (%rax),%eax
+  8012cf:	84 c0                	test   %al,%al
+  8012d1:	75 e0                	jne    8012b3 <strnlen+0x19>
+	return n;
+  8012d3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8012d6:	c9                   	leave
+  8012d7:	c3                   	ret
+
+00000000008012d8 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8012d8:	55                   	push   %rbp
+  8012d9:	48 89 e5             	mov    %rsp,%rbp
+  8012dc:	48 83 ec 20          	sub    $0x20,%rsp
+  8012e0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012e4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  8012e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012ec:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  8012f0:	90                   	nop
+  8012f1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8012f5:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8012f9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8012fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801301:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801305:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801309:	0f b6 12             	movzbl (%rdx),%edx
+  80130c:	88 10                	mov    %dl,(%rax)
+  80130e:	0f b6 00             	movzbl (%rax),%eax
+  801311:	84 c0                	test   %al,%al
+  801313:	75 dc                	jne    8012f1 <strcpy+0x19>
+		/* do nothing */;
+	return ret;
+  801315:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801319:	c9                   	leave
+  80131a:	c3                   	ret
+
+000000000080131b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80131b:	55                   	push   %rbp
+  80131c:	48 89 e5             	mov    %rsp,%rbp
+  80131f:	48 83 ec 20          	sub    $0x20,%rsp
+  801323:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801327:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int len = strlen(dst);
+  80132b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80132f:	48 89 c7             	mov    %rax,%rdi
+  801332:	48 b8 6c 12 80 00 00 	movabs $0x80126c,%rax
+  801339:	00 00 00 
+  80133c:	ff d0                	call   *%rax
+  80133e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	strcpy(dst + len, src);
+  801341:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801344:	48 63 d0             	movslq %eax,%rdx
+  801347:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80134b:	48 01 c2             	add    %rax,%rdx
+  80134e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801352:	48 89 c6             	mov    %rax,%rsi
+  801355:	48 89 d7             	mov    %rdx,%rdi
+  801358:	48 b8 d8 12 80 00 00 	movabs $0x8012d8,%rax
+  80135f:	00 00 00 
+  801362:	ff d0                	call   *%rax
+	return dst;
+  801364:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801368:	c9                   	leave
+  801369:	c3                   	ret
+
+000000000080136a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  80136a:	55                   	push   %rbp
+  80136b:	48 89 e5             	mov    %rsp,%rbp
+  80136e:	48 83 ec 28          	sub    $0x28,%rsp
+  801372:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801376:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80137a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  80137e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801382:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++)
+  801386:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80138d:	00 
+  80138e:	eb 2a                	jmp    8013ba <strncpy+0x50>
+	{
+		*dst++ = *src;
+  801390:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801394:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801398:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80139c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8013a0:	0f b6 12             	movzbl (%rdx),%edx
+  8013a3:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  8013a5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013a9:	0f b6 00             	movzbl (%rax),%eax
+  8013ac:	84 c0                	test   %al,%al
+  8013ae:	74 05                	je     8013b5 <strncpy+0x4b>
+			src++;
+  8013b0:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++)
+  8013b5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8013ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013be:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8013c2:	72 cc                	jb     801390 <strncpy+0x26>
+	}
+	return ret;
+  8013c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8013c8:	c9                   	leave
+  8013c9:	c3                   	ret
+
+00000000008013ca <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8013ca:	55                   	push   %rbp
+  8013cb:	48 89 e5             	mov    %rsp,%rbp
+  8013ce:	48 83 ec 28          	sub    $0x28,%rsp
+  8013d2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013d6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8013da:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  8013de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013e2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0)
+  8013e6:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8013eb:	74 3d                	je     80142a <strlcpy+0x60>
+	{
+		while (--size > 0 && *src != '\0')
+  8013ed:	eb 1d                	jmp    80140c <strlcpy+0x42>
+			*dst++ = *src++;
+  8013ef:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8013f3:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8013f7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8013fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013ff:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801403:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801407:	0f b6 12             	movzbl (%rdx),%edx
+  80140a:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  80140c:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801411:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801416:	74 0b                	je     801423 <strlcpy+0x59>
+  801418:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80141c:	0f b6 00             	movzbl (%rax),%eax
+  80141f:	84 c0                	test   %al,%al
+  801421:	75 cc                	jne    8013ef <strlcpy+0x25>
+		*dst = '\0';
+  801423:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801427:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  80142a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80142e:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801432:	c9                   	leave
+  801433:	c3                   	ret
+
+0000000000801434 <strcmp>:
+
+int strcmp(const char *p, const char *q)
+{
+  801434:	55                   	push   %rbp
+  801435:	48 89 e5             	mov    %rsp,%rbp
+  801438:	48 83 ec 10          	sub    $0x10,%rsp
+  80143c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801440:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801444:	eb 0a                	jmp    801450 <strcmp+0x1c>
+		p++, q++;
+  801446:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80144b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801450:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801454:	0f b6 00             	movzbl (%rax),%eax
+  801457:	84 c0                	test   %al,%al
+  801459:	74 12                	je     80146d <strcmp+0x39>
+  80145b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80145f:	0f b6 10             	movzbl (%rax),%edx
+  801462:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801466:	0f b6 00             	movzbl (%rax),%eax
+  801469:	38 c2                	cmp    %al,%dl
+  80146b:	74 d9                	je     801446 <strcmp+0x12>
+	return (int)((unsigned char)*p - (unsigned char)*q);
+  80146d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801471:	0f b6 00             	movzbl (%rax),%eax
+  801474:	0f b6 d0             	movzbl %al,%edx
+  801477:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80147b:	0f b6 00             	movzbl (%rax),%eax
+  80147e:	0f b6 c0             	movzbl %al,%eax
+  801481:	29 c2                	sub    %eax,%edx
+  801483:	89 d0                	mov    %edx,%eax
+}
+  801485:	c9                   	leave
+  801486:	c3                   	ret
+
+0000000000801487 <strncmp>:
+
+int strncmp(const char *p, const char *q, size_t n)
+{
+  801487:	55                   	push   %rbp
+  801488:	48 89 e5             	mov    %rsp,%rbp
+  80148b:	48 83 ec 18          	sub    $0x18,%rsp
+  80148f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801493:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801497:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80149b:	eb 0f                	jmp    8014ac <strncmp+0x25>
+		n--, p++, q++;
+  80149d:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8014a2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8014a7:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8014ac:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8014b1:	74 1d                	je     8014d0 <strncmp+0x49>
+  8014b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014b7:	0f b6 00             	movzbl (%rax),%eax
+  8014ba:	84 c0                	test   %al,%al
+  8014bc:	74 12                	je     8014d0 <strncmp+0x49>
+  8014be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014c2:	0f b6 10             	movzbl (%rax),%edx
+  8014c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014c9:	0f b6 00             	movzbl (%rax),%eax
+  8014cc:	38 c2                	cmp    %al,%dl
+  8014ce:	74 cd                	je     80149d <strncmp+0x16>
+	if (n == 0)
+  8014d0:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8014d5:	75 07                	jne    8014de <strncmp+0x57>
+		return 0;
+  8014d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014dc:	eb 16                	jmp    8014f4 <strncmp+0x6d>
+	else
+		return (int)((unsigned char)*p - (unsigned char)*q);
+  8014de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014e2:	0f b6 00             	movzbl (%rax),%eax
+  8014e5:	0f b6 d0             	movzbl %al,%edx
+  8014e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014ec:	0f b6 00             	movzbl (%rax),%eax
+  8014ef:	0f b6 c0             	movzbl %al,%eax
+  8014f2:	29 c2                	sub    %eax,%edx
+}
+  8014f4:	89 d0                	mov    %edx,%eax
+  8014f6:	c9                   	leave
+  8014f7:	c3                   	ret
+
+00000000008014f8 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8014f8:	55                   	push   %rbp
+  8014f9:	48 89 e5             	mov    %rsp,%rbp
+  8014fc:	48 83 ec 10          	sub    $0x10,%rsp
+  801500:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801504:	89 f0                	mov    %esi,%eax
+  801506:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801509:	eb 17                	jmp    801522 <strchr+0x2a>
+		if (*s == c)
+  80150b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80150f:	0f b6 00             	movzbl (%rax),%eax
+  801512:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801515:	75 06                	jne    80151d <strchr+0x25>
+			return (char *)s;
+  801517:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80151b:	eb 15                	jmp    801532 <strchr+0x3a>
+	for (; *s; s++)
+  80151d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801522:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801526:	0f b6 00             	movzbl (%rax),%eax
+  801529:	84 c0                	test   %al,%al
+  80152b:	75 de                	jne    80150b <strchr+0x13>
+	return 0;
+  80152d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801532:	c9                   	leave
+  801533:	c3                   	ret
+
+0000000000801534 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801534:	55                   	push   %rbp
+  801535:	48 89 e5             	mov    %rsp,%rbp
+  801538:	48 83 ec 10          	sub    $0x10,%rsp
+  80153c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801540:	89 f0                	mov    %esi,%eax
+  801542:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801545:	eb 11                	jmp    801558 <strfind+0x24>
+		if (*s == c)
+  801547:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80154b:	0f b6 00             	movzbl (%rax),%eax
+  80154e:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801551:	74 12                	je     801565 <strfind+0x31>
+	for (; *s; s++)
+  801553:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801558:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80155c:	0f b6 00             	movzbl (%rax),%eax
+  80155f:	84 c0                	test   %al,%al
+  801561:	75 e4                	jne    801547 <strfind+0x13>
+  801563:	eb 01                	jmp    801566 <strfind+0x32>
+			break;
+  801565:	90                   	nop
+	return (char *)s;
+  801566:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80156a:	c9                   	leave
+  80156b:	c3                   	ret
+
+000000000080156c <mem_init>:
+};
+
+static int mem_features;
+
+void mem_init(void)
+{
+  80156c:	55                   	push   %rbp
+  80156d:	48 89 e5             	mov    %rsp,%rbp
+  801570:	48 83 ec 10          	sub    $0x10,%rsp
+	uint32_t max, ebx, edx;
+
+	mem_features = 0;
+  801574:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  80157b:	00 00 00 
+  80157e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	cpuid(0, &max, NULL, NULL, NULL);
+  801584:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+  801588:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80158e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801593:	ba 00 00 00 00       	mov    $0x0,%edx
+  801598:	48 89 c6             	mov    %rax,%rsi
+  80159b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015a0:	48 b8 78 11 80 00 00 	movabs $0x801178,%rax
+  8015a7:	00 00 00 
+  8015aa:	ff d0                	call   *%rax
+	cpuid(1, NULL, NULL, NULL, &edx);
+  8015ac:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  8015b0:	49 89 c0             	mov    %rax,%r8
+  8015b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8015c7:	48 b8 78 11 80 00 00 	movabs $0x801178,%rax
+  8015ce:	00 00 00 
+  8015d1:	ff d0                	call   *%rax
+	if (edx & (1 << 26))
+  8015d3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8015d6:	25 00 00 00 04       	and    $0x4000000,%eax
+  8015db:	85 c0                	test   %eax,%eax
+  8015dd:	74 1d                	je     8015fc <mem_init+0x90>
+		mem_features |= MEM_F_NT;
+  8015df:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8015e6:	00 00 00 
+  8015e9:	8b 00                	mov    (%rax),%eax
+  8015eb:	83 c8 02             	or     $0x2,%eax
+  8015ee:	89 c2                	mov    %eax,%edx
+  8015f0:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8015f7:	00 00 00 
+  8015fa:	89 10                	mov    %edx,(%rax)
+	if (max >= 7)
+  8015fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8015ff:	83 f8 06             	cmp    $0x6,%eax
+  801602:	76 57                	jbe    80165b <mem_init+0xef>
+	{
+		cpuid_count(7, 0, NULL, &ebx, NULL, NULL);
+  801604:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801608:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80160e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801614:	48 89 c1             	mov    %rax,%rcx
+  801617:	ba 00 00 00 00       	mov    $0x0,%edx
+  80161c:	be 00 00 00 00       	mov    $0x0,%esi
+  801621:	bf 07 00 00 00       	mov    $0x7,%edi
+  801626:	48 b8 ee 11 80 00 00 	movabs $0x8011ee,%rax
+  80162d:	00 00 00 
+  801630:	ff d0                	call   *%rax
+		if (ebx & (1 << 9))
+  801632:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801635:	25 00 02 00 00       	and    $0x200,%eax
+  80163a:	85 c0                	test   %eax,%eax
+  80163c:	74 1d                	je     80165b <mem_init+0xef>
+			mem_features |= MEM_F_ERMS;
+  80163e:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  801645:	00 00 00 
+  801648:	8b 00                	mov    (%rax),%eax
+  80164a:	83 c8 01             	or     $0x1,%eax
+  80164d:	89 c2                	mov    %eax,%edx
+  80164f:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  801656:	00 00 00 
+  801659:	89 10                	mov    %edx,(%rax)
+	}
+}
+  80165b:	90                   	nop
+  80165c:	c9                   	leave
+  80165d:	c3                   	ret
+
+000000000080165e <memset_nt>:
+
+// 非临时存储填充 n 字节(v 8 字节对齐，n 为 32 的倍数)
+static void
+memset_nt(void *v, uint64_t pattern, size_t n)
+{
+  80165e:	55                   	push   %rbp
+  80165f:	48 89 e5             	mov    %rsp,%rbp
+  801662:	48 83 ec 28          	sub    $0x28,%rsp
+  801666:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80166a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80166e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t *p = (uint64_t *)v;
+  801672:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801676:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint64_t *end = p + n / 8;
+  80167a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80167e:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  801682:	48 89 c2             	mov    %rax,%rdx
+  801685:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801689:	48 01 d0             	add    %rdx,%rax
+  80168c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	for (; p < end; p += 4)
+  801690:	eb 20                	jmp    8016b2 <memset_nt+0x54>
+		asm volatile("movnti %1, 0(%0)\n\t"
+  801692:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801696:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80169a:	48 0f c3 10          	movnti %rdx,(%rax)
+  80169e:	48 0f c3 50 08       	movnti %rdx,0x8(%rax)
+  8016a3:	48 0f c3 50 10       	movnti %rdx,0x10(%rax)
+  8016a8:	48 0f c3 50 18       	movnti %rdx,0x18(%rax)
+	for (; p < end; p += 4)
+  8016ad:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  8016b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016b6:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8016ba:	72 d6                	jb     801692 <memset_nt+0x34>
+					 "movnti %1, 16(%0)\n\t"
+					 "movnti %1, 24(%0)"
+					 :
+					 : "r"(p), "r"(pattern)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  8016bc:	0f ae f8             	sfence
+}
+  8016bf:	90                   	nop
+  8016c0:	c9                   	leave
+  8016c1:	c3                   	ret
+
+00000000008016c2 <memcpy_nt>:
+
+// 非临时存储复制 n 字节(dst/src 8 字节对齐且不重叠，n 为 32 的倍数)
+static void
+memcpy_nt(void *dst, const void *src, size_t n)
+{
+  8016c2:	55                   	push   %rbp
+  8016c3:	48 89 e5             	mov    %rsp,%rbp
+  8016c6:	48 83 ec 58          	sub    $0x58,%rsp
+  8016ca:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8016ce:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8016d2:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	uint64_t *d = (uint64_t *)dst;
+  8016d6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8016da:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint64_t *s = (const uint64_t *)src;
+  8016de:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8016e2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	uint64_t *end = d + n / 8;
+  8016e6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8016ea:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  8016ee:	48 89 c2             	mov    %rax,%rdx
+  8016f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016f5:	48 01 d0             	add    %rdx,%rax
+  8016f8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint64_t t0, t1, t2, t3;
+
+	for (; d < end; d += 4, s += 4)
+  8016fc:	eb 44                	jmp    801742 <memcpy_nt+0x80>
+		asm volatile("movq 0(%4), %0\n\t"
+  8016fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801702:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801706:	4c 8b 00             	mov    (%rax),%r8
+  801709:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  80170d:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  801711:	48 8b 48 18          	mov    0x18(%rax),%rcx
+  801715:	4c 0f c3 02          	movnti %r8,(%rdx)
+  801719:	48 0f c3 7a 08       	movnti %rdi,0x8(%rdx)
+  80171e:	48 0f c3 72 10       	movnti %rsi,0x10(%rdx)
+  801723:	48 0f c3 4a 18       	movnti %rcx,0x18(%rdx)
+  801728:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80172c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801730:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801734:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+	for (; d < end; d += 4, s += 4)
+  801738:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  80173d:	48 83 45 f0 20       	addq   $0x20,-0x10(%rbp)
+  801742:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801746:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  80174a:	72 b2                	jb     8016fe <memcpy_nt+0x3c>
+					 "movnti %2, 16(%5)\n\t"
+					 "movnti %3, 24(%5)"
+					 : "=&r"(t0), "=&r"(t1), "=&r"(t2), "=&r"(t3)
+					 : "r"(s), "r"(d)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  80174c:	0f ae f8             	sfence
+}
+  80174f:	90                   	nop
+  801750:	c9                   	leave
+  801751:	c3                   	ret
+
+0000000000801752 <memcpy_fwd>:
+
+// 正向复制(dst 在 src 之前或两者不重叠)
+static void
+memcpy_fwd(void *dst, const void *src, size_t n)
+{
+  801752:	55                   	push   %rbp
+  801753:	48 89 e5             	mov    %rsp,%rbp
+  801756:	48 83 ec 18          	sub    $0x18,%rsp
+  80175a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80175e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801762:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  801766:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  80176d:	00 00 00 
+  801770:	8b 00                	mov    (%rax),%eax
+  801772:	83 e0 02             	and    $0x2,%eax
+  801775:	85 c0                	test   %eax,%eax
+  801777:	74 66                	je     8017df <memcpy_fwd+0x8d>
+  801779:	48 81 7d e8 ff 0f 00 	cmpq   $0xfff,-0x18(%rbp)
+  801780:	00 
+  801781:	76 5c                	jbe    8017df <memcpy_fwd+0x8d>
+  801783:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801787:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80178b:	48 09 d0             	or     %rdx,%rax
+  80178e:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  801792:	83 e0 1f             	and    $0x1f,%eax
+  801795:	48 85 c0             	test   %rax,%rax
+  801798:	75 45                	jne    8017df <memcpy_fwd+0x8d>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  80179a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80179e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017a2:	48 01 d0             	add    %rdx,%rax
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  8017a5:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8017a9:	73 11                	jae    8017bc <memcpy_fwd+0x6a>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  8017ab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017b3:	48 01 d0             	add    %rdx,%rax
+  8017b6:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8017ba:	72 23                	jb     8017df <memcpy_fwd+0x8d>
+		memcpy_nt(dst, src, n);
+  8017bc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8017c0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8017c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017c8:	48 89 ce             	mov    %rcx,%rsi
+  8017cb:	48 89 c7             	mov    %rax,%rdi
+  8017ce:	48 b8 c2 16 80 00 00 	movabs $0x8016c2,%rax
+  8017d5:	00 00 00 
+  8017d8:	ff d0                	call   *%rax
+  8017da:	e9 81 00 00 00       	jmp    801860 <memcpy_fwd+0x10e>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  8017df:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8017e6:	00 00 00 
+  8017e9:	8b 00                	mov    (%rax),%eax
+  8017eb:	83 e0 01             	and    $0x1,%eax
+  8017ee:	85 c0                	test   %eax,%eax
+  8017f0:	74 21                	je     801813 <memcpy_fwd+0xc1>
+  8017f2:	48 81 7d e8 ff 00 00 	cmpq   $0xff,-0x18(%rbp)
+  8017f9:	00 
+  8017fa:	76 17                	jbe    801813 <memcpy_fwd+0xc1>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  8017fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801800:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801804:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801808:	48 89 c7             	mov    %rax,%rdi
+  80180b:	48 89 d6             	mov    %rdx,%rsi
+  80180e:	fc                   	cld
+  80180f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801811:	eb 4d                	jmp    801860 <memcpy_fwd+0x10e>
+					 : "cc", "memory");
+	else if ((((uint64_t)dst | (uint64_t)src | n) & 7) == 0)
+  801813:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801817:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80181b:	48 09 d0             	or     %rdx,%rax
+  80181e:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  801822:	83 e0 07             	and    $0x7,%eax
+  801825:	48 85 c0             	test   %rax,%rax
+  801828:	75 1f                	jne    801849 <memcpy_fwd+0xf7>
+		asm volatile("cld; rep movsq\n" ::"D"(dst), "S"(src), "c"(n / 8)
+  80182a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80182e:	48 c1 e8 03          	shr    $0x3,%rax
+  801832:	48 89 c1             	mov    %rax,%rcx
+  801835:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801839:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80183d:	48 89 c7             	mov    %rax,%rdi
+  801840:	48 89 d6             	mov    %rdx,%rsi
+  801843:	fc                   	cld
+  801844:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+					 : "cc", "memory");
+}
+  801847:	eb 17                	jmp    801860 <memcpy_fwd+0x10e>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  801849:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80184d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801851:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801855:	48 89 c7             	mov    %rax,%rdi
+  801858:	48 89 d6             	mov    %rdx,%rsi
+  80185b:	fc                   	cld
+  80185c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+  80185e:	eb 00                	jmp    801860 <memcpy_fwd+0x10e>
+  801860:	90                   	nop
+  801861:	c9                   	leave
+  801862:	c3                   	ret
+
+0000000000801863 <memset>:
+
+void *
+memset(void *v, int c, size_t n)
+{
+  801863:	55                   	push   %rbp
+  801864:	48 89 e5             	mov    %rsp,%rbp
+  801867:	48 83 ec 28          	sub    $0x28,%rsp
+  80186b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80186f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801872:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t pattern;
+
+	if (n == 0)
+  801876:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80187b:	75 09                	jne    801886 <memset+0x23>
+		return v;
+  80187d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801881:	e9 dc 00 00 00       	jmp    801962 <memset+0xff>
+	c &= 0xFF;
+  801886:	81 65 e4 ff 00 00 00 	andl   $0xff,-0x1c(%rbp)
+	pattern = (uint64_t)c * 0x0101010101010101UL;
+  80188d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801890:	48 98                	cltq
+  801892:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801899:	01 01 01 
+  80189c:	48 0f af c2          	imul   %rdx,%rax
+  8018a0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)v | n) & 31) == 0)
+  8018a4:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8018ab:	00 00 00 
+  8018ae:	8b 00                	mov    (%rax),%eax
+  8018b0:	83 e0 02             	and    $0x2,%eax
+  8018b3:	85 c0                	test   %eax,%eax
+  8018b5:	74 3a                	je     8018f1 <memset+0x8e>
+  8018b7:	48 81 7d d8 ff 0f 00 	cmpq   $0xfff,-0x28(%rbp)
+  8018be:	00 
+  8018bf:	76 30                	jbe    8018f1 <memset+0x8e>
+  8018c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018c5:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  8018c9:	83 e0 1f             	and    $0x1f,%eax
+  8018cc:	48 85 c0             	test   %rax,%rax
+  8018cf:	75 20                	jne    8018f1 <memset+0x8e>
+		memset_nt(v, pattern, n);
+  8018d1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8018d5:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8018d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018dd:	48 89 ce             	mov    %rcx,%rsi
+  8018e0:	48 89 c7             	mov    %rax,%rdi
+  8018e3:	48 b8 5e 16 80 00 00 	movabs $0x80165e,%rax
+  8018ea:	00 00 00 
+  8018ed:	ff d0                	call   *%rax
+  8018ef:	eb 6d                	jmp    80195e <memset+0xfb>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  8018f1:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8018f8:	00 00 00 
+  8018fb:	8b 00                	mov    (%rax),%eax
+  8018fd:	83 e0 01             	and    $0x1,%eax
+  801900:	85 c0                	test   %eax,%eax
+  801902:	74 1d                	je     801921 <memset+0xbe>
+  801904:	48 81 7d d8 ff 00 00 	cmpq   $0xff,-0x28(%rbp)
+  80190b:	00 
+  80190c:	76 13                	jbe    801921 <memset+0xbe>
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  80190e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801912:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801915:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801919:	48 89 d7             	mov    %rdx,%rdi
+  80191c:	fc                   	cld
+  80191d:	f3 aa                	rep stos %al,%es:(%rdi)
+  80191f:	eb 3d                	jmp    80195e <memset+0xfb>
+					 : "cc", "memory");
+	else if ((((uint64_t)v | n) & 7) == 0)
+  801921:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801925:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  801929:	83 e0 07             	and    $0x7,%eax
+  80192c:	48 85 c0             	test   %rax,%rax
+  80192f:	75 1c                	jne    80194d <memset+0xea>
+		asm volatile("cld; rep stosq\n" ::"D"(v), "a"(pattern), "c"(n / 8)
+  801931:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801935:	48 c1 e8 03          	shr    $0x3,%rax
+  801939:	48 89 c1             	mov    %rax,%rcx
+  80193c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801940:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801944:	48 89 d7             	mov    %rdx,%rdi
+  801947:	fc                   	cld
+  801948:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  80194b:	eb 11                	jmp    80195e <memset+0xfb>
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  80194d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801951:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801954:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801958:	48 89 d7             	mov    %rdx,%rdi
+  80195b:	fc                   	cld
+  80195c:	f3 aa                	rep stos %al,%es:(%rdi)
+					 : "cc", "memory");
+	return v;
+  80195e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801962:	c9                   	leave
+  801963:	c3                   	ret
+
+0000000000801964 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801964:	55                   	push   %rbp
+  801965:	48 89 e5             	mov    %rsp,%rbp
+  801968:	48 83 ec 28          	sub    $0x28,%rsp
+  80196c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801970:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801974:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801978:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80197c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801980:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801984:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d)
+  801988:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80198c:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801990:	73 7c                	jae    801a0e <memmove+0xaa>
+  801992:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801996:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80199a:	48 01 d0             	add    %rdx,%rax
+  80199d:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8019a1:	73 6b                	jae    801a0e <memmove+0xaa>
+	{
+		// 重叠且 dst 在 src 之后，只能反向复制(ERMS 对反向 rep movsb 没有优化)
+		s += n;
+  8019a3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019a7:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  8019ab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019af:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((((uint64_t)s | (uint64_t)d | n) & 7) == 0)
+  8019b3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019bb:	48 09 d0             	or     %rdx,%rax
+  8019be:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  8019c2:	83 e0 07             	and    $0x7,%eax
+  8019c5:	48 85 c0             	test   %rax,%rax
+  8019c8:	75 24                	jne    8019ee <memmove+0x8a>
+			asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8019ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019ce:	48 83 e8 08          	sub    $0x8,%rax
+  8019d2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019d6:	48 83 ea 08          	sub    $0x8,%rdx
+  8019da:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8019de:	48 c1 e9 03          	shr    $0x3,%rcx
+  8019e2:	48 89 c7             	mov    %rax,%rdi
+  8019e5:	48 89 d6             	mov    %rdx,%rsi
+  8019e8:	fd                   	std
+  8019e9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8019ec:	eb 1d                	jmp    801a0b <memmove+0xa7>
+						 : "cc", "memory");
+		else
+			asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8019ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019f2:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019fa:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+  8019fe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a02:	48 89 d7             	mov    %rdx,%rdi
+  801a05:	48 89 c1             	mov    %rax,%rcx
+  801a08:	fd                   	std
+  801a09:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+						 : "cc", "memory");
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::
+  801a0b:	fc                   	cld
+  801a0c:	eb 25                	jmp    801a33 <memmove+0xcf>
+						 : "cc");
+	}
+	else if (n)
+  801a0e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801a13:	74 1e                	je     801a33 <memmove+0xcf>
+		memcpy_fwd(d, s, n);
+  801a15:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801a19:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801a1d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a21:	48 89 ce             	mov    %rcx,%rsi
+  801a24:	48 89 c7             	mov    %rax,%rdi
+  801a27:	48 b8 52 17 80 00 00 	movabs $0x801752,%rax
+  801a2e:	00 00 00 
+  801a31:	ff d0                	call   *%rax
+	return dst;
+  801a33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801a37:	c9                   	leave
+  801a38:	c3                   	ret
+
+0000000000801a39 <memcpy>:
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801a39:	55                   	push   %rbp
+  801a3a:	48 89 e5             	mov    %rsp,%rbp
+  801a3d:	48 83 ec 18          	sub    $0x18,%rsp
+  801a41:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a45:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801a49:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (n)
+  801a4d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801a52:	74 1e                	je     801a72 <memcpy+0x39>
+		memcpy_fwd(dst, src, n);
+  801a54:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a58:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801a5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a60:	48 89 ce             	mov    %rcx,%rsi
+  801a63:	48 89 c7             	mov    %rax,%rdi
+  801a66:	48 b8 52 17 80 00 00 	movabs $0x801752,%rax
+  801a6d:	00 00 00 
+  801a70:	ff d0                	call   *%rax
+	return dst;
+  801a72:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801a76:	c9                   	leave
+  801a77:	c3                   	ret
+
+0000000000801a78 <memcmp>:
+{
+}
+#endif
+
+int memcmp(const void *v1, const void *v2, size_t n)
+{
+  801a78:	55                   	push   %rbp
+  801a79:	48 89 e5             	mov    %rsp,%rbp
+  801a7c:	48 83 ec 28          	sub    $0x28,%rsp
+  801a80:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a84:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801a88:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *)v1;
+  801a8c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a90:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *)v2;
+  801a94:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a98:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0)
+  801a9c:	eb 34                	jmp    801ad2 <memcmp+0x5a>
+	{
+		if (*s1 != *s2)
+  801a9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aa2:	0f b6 10             	movzbl (%rax),%edx
+  801aa5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801aa9:	0f b6 00             	movzbl (%rax),%eax
+  801aac:	38 c2                	cmp    %al,%dl
+  801aae:	74 18                	je     801ac8 <memcmp+0x50>
+			return (int)*s1 - (int)*s2;
+  801ab0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ab4:	0f b6 00             	movzbl (%rax),%eax
+  801ab7:	0f b6 d0             	movzbl %al,%edx
+  801aba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801abe:	0f b6 00             	movzbl (%rax),%eax
+  801ac1:	0f b6 c0             	movzbl %al,%eax
+  801ac4:	29 c2                	sub    %eax,%edx
+  801ac6:	eb 20                	jmp    801ae8 <memcmp+0x70>
+		s1++, s2++;
+  801ac8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801acd:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0)
+  801ad2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ad6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801ada:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801ade:	48 85 c0             	test   %rax,%rax
+  801ae1:	75 bb                	jne    801a9e <memcmp+0x26>
+	}
+
+	return 0;
+  801ae3:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801ae8:	89 d0                	mov    %edx,%eax
+  801aea:	c9                   	leave
+  801aeb:	c3                   	ret
+
+0000000000801aec <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801aec:	55                   	push   %rbp
+  801aed:	48 89 e5             	mov    %rsp,%rbp
+  801af0:	48 83 ec 28          	sub    $0x28,%rsp
+  801af4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801af8:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801afb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *)s + n;
+  801aff:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b03:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b07:	48 01 d0             	add    %rdx,%rax
+  801b0a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801b0e:	eb 13                	jmp    801b23 <memfind+0x37>
+		if (*(const unsigned char *)s == (unsigned char)c)
+  801b10:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b14:	0f b6 00             	movzbl (%rax),%eax
+  801b17:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801b1a:	38 d0                	cmp    %dl,%al
+  801b1c:	74 11                	je     801b2f <memfind+0x43>
+	for (; s < ends; s++)
+  801b1e:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801b23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b27:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801b2b:	72 e3                	jb     801b10 <memfind+0x24>
+  801b2d:	eb 01                	jmp    801b30 <memfind+0x44>
+			break;
+  801b2f:	90                   	nop
+	return (void *)s;
+  801b30:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801b34:	c9                   	leave
+  801b35:	c3                   	ret
+
+0000000000801b36 <strtol>:
+
+long strtol(const char *s, char **endptr, int base)
+{
+  801b36:	55                   	push   %rbp
+  801b37:	48 89 e5             	mov    %rsp,%rbp
+  801b3a:	48 83 ec 38          	sub    $0x38,%rsp
+  801b3e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b42:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801b46:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801b49:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801b50:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801b57:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801b58:	eb 05                	jmp    801b5f <strtol+0x29>
+		s++;
+  801b5a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801b5f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b63:	0f b6 00             	movzbl (%rax),%eax
+  801b66:	3c 20                	cmp    $0x20,%al
+  801b68:	74 f0                	je     801b5a <strtol+0x24>
+  801b6a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b6e:	0f b6 00             	movzbl (%rax),%eax
+  801b71:	3c 09                	cmp    $0x9,%al
+  801b73:	74 e5                	je     801b5a <strtol+0x24>
+
+	// plus/minus sign
+	if (*s == '+')
+  801b75:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b79:	0f b6 00             	movzbl (%rax),%eax
+  801b7c:	3c 2b                	cmp    $0x2b,%al
+  801b7e:	75 07                	jne    801b87 <strtol+0x51>
+		s++;
+  801b80:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801b85:	eb 17                	jmp    801b9e <strtol+0x68>
+	else if (*s == '-')
+  801b87:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b8b:	0f b6 00             	movzbl (%rax),%eax
+  801b8e:	3c 2d                	cmp    $0x2d,%al
+  801b90:	75 0c                	jne    801b9e <strtol+0x68>
+		s++, neg = 1;
+  801b92:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801b97:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801b9e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801ba2:	74 06                	je     801baa <strtol+0x74>
+  801ba4:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801ba8:	75 28                	jne    801bd2 <strtol+0x9c>
+  801baa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bae:	0f b6 00             	movzbl (%rax),%eax
+  801bb1:	3c 30                	cmp    $0x30,%al
+  801bb3:	75 1d                	jne    801bd2 <strtol+0x9c>
+  801bb5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bb9:	48 83 c0 01          	add    $0x1,%rax
+  801bbd:	0f b6 00             	movzbl (%rax),%eax
+  801bc0:	3c 78                	cmp    $0x78,%al
+  801bc2:	75 0e                	jne    801bd2 <strtol+0x9c>
+		s += 2, base = 16;
+  801bc4:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801bc9:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801bd0:	eb 2c                	jmp    801bfe <strtol+0xc8>
+	else if (base == 0 && s[0] == '0')
+  801bd2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801bd6:	75 19                	jne    801bf1 <strtol+0xbb>
+  801bd8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bdc:	0f b6 00             	movzbl (%rax),%eax
+  801bdf:	3c 30                	cmp    $0x30,%al
+  801be1:	75 0e                	jne    801bf1 <strtol+0xbb>
+		s++, base = 8;
+  801be3:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801be8:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801bef:	eb 0d                	jmp    801bfe <strtol+0xc8>
+	else if (base == 0)
+  801bf1:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801bf5:	75 07                	jne    801bfe <strtol+0xc8>
+		base = 10;
+  801bf7:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+	// digits
+	while (1)
+	{
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801bfe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c02:	0f b6 00             	movzbl (%rax),%eax
+  801c05:	3c 2f                	cmp    $0x2f,%al
+  801c07:	7e 1d                	jle    801c26 <strtol+0xf0>
+  801c09:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c0d:	0f b6 00             	movzbl (%rax),%eax
+  801c10:	3c 39                	cmp    $0x39,%al
+  801c12:	7f 12                	jg     801c26 <strtol+0xf0>
+			dig = *s - '0';
+  801c14:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c18:	0f b6 00             	movzbl (%rax),%eax
+  801c1b:	0f be c0             	movsbl %al,%eax
+  801c1e:	83 e8 30             	sub    $0x30,%eax
+  801c21:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c24:	eb 4e                	jmp    801c74 <strtol+0x13e>
+		else if (*s >= 'a' && *s <= 'z')
+  801c26:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c2a:	0f b6 00             	movzbl (%rax),%eax
+  801c2d:	3c 60                	cmp    $0x60,%al
+  801c2f:	7e 1d                	jle    801c4e <strtol+0x118>
+  801c31:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c35:	0f b6 00             	movzbl (%rax),%eax
+  801c38:	3c 7a                	cmp    $0x7a,%al
+  801c3a:	7f 12                	jg     801c4e <strtol+0x118>
+			dig = *s - 'a' + 10;
+  801c3c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c40:	0f b6 00             	movzbl (%rax),%eax
+  801c43:	0f be c0             	movsbl %al,%eax
+  801c46:	83 e8 57             	sub    $0x57,%eax
+  801c49:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c4c:	eb 26                	jmp    801c74 <strtol+0x13e>
+		else if (*s >= 'A' && *s <= 'Z')
+  801c4e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c52:	0f b6 00             	movzbl (%rax),%eax
+  801c55:	3c 40                	cmp    $0x40,%al
+  801c57:	7e 47                	jle    801ca0 <strtol+0x16a>
+  801c59:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c5d:	0f b6 00             	movzbl (%rax),%eax
+  801c60:	3c 5a                	cmp    $0x5a,%al
+  801c62:	7f 3c                	jg     801ca0 <strtol+0x16a>
+			dig = *s - 'A' + 10;
+  801c64:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c68:	0f b6 00             	movzbl (%rax),%eax
+  801c6b:	0f be c0             	movsbl %al,%eax
+  801c6e:	83 e8 37             	sub    $0x37,%eax
+  801c71:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801c74:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801c77:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801c7a:	7d 23                	jge    801c9f <strtol+0x169>
+			break;
+		s++, val = (val * base) + dig;
+  801c7c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c81:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801c84:	48 98                	cltq
+  801c86:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801c8b:	48 89 c2             	mov    %rax,%rdx
+  801c8e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801c91:	48 98                	cltq
+  801c93:	48 01 d0             	add    %rdx,%rax
+  801c96:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+  801c9a:	e9 5f ff ff ff       	jmp    801bfe <strtol+0xc8>
+			break;
+  801c9f:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801ca0:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801ca5:	74 0b                	je     801cb2 <strtol+0x17c>
+		*endptr = (char *)s;
+  801ca7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cab:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801caf:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801cb2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801cb6:	74 09                	je     801cc1 <strtol+0x18b>
+  801cb8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801cbc:	48 f7 d8             	neg    %rax
+  801cbf:	eb 04                	jmp    801cc5 <strtol+0x18f>
+  801cc1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801cc5:	c9                   	leave
+  801cc6:	c3                   	ret
+
+0000000000801cc7 <strstr>:
+
+char *strstr(const char *in, const char *str)
+{
+  801cc7:	55                   	push   %rbp
+  801cc8:	48 89 e5             	mov    %rsp,%rbp
+  801ccb:	48 83 ec 30          	sub    $0x30,%rsp
+  801ccf:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801cd3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801cd7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cdb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801cdf:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801ce3:	0f b6 00             	movzbl (%rax),%eax
+  801ce6:	88 45 ff             	mov    %al,-0x1(%rbp)
+	if (!c)
+  801ce9:	80 7d ff 00          	cmpb   $0x0,-0x1(%rbp)
+  801ced:	75 06                	jne    801cf5 <strstr+0x2e>
+		return (char *)in; // Trivial empty string case
+  801cef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cf3:	eb 6b                	jmp    801d60 <strstr+0x99>
+
+	len = strlen(str);
+  801cf5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cf9:	48 89 c7             	mov    %rax,%rdi
+  801cfc:	48 b8 6c 12 80 00 00 	movabs $0x80126c,%rax
+  801d03:	00 00 00 
+  801d06:	ff d0                	call   *%rax
+  801d08:	48 98                	cltq
+  801d0a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+		char sc;
+
+		do
+		{
+			sc = *in++;
+  801d0e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d12:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d16:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801d1a:	0f b6 00             	movzbl (%rax),%eax
+  801d1d:	88 45 ef             	mov    %al,-0x11(%rbp)
+			if (!sc)
+  801d20:	80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+  801d24:	75 07                	jne    801d2d <strstr+0x66>
+				return (char *)0;
+  801d26:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d2b:	eb 33                	jmp    801d60 <strstr+0x99>
+		} while (sc != c);
+  801d2d:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+  801d31:	3a 45 ff             	cmp    -0x1(%rbp),%al
+  801d34:	75 d8                	jne    801d0e <strstr+0x47>
+	} while (strncmp(in, str, len) != 0);
+  801d36:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d3a:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801d3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d42:	48 89 ce             	mov    %rcx,%rsi
+  801d45:	48 89 c7             	mov    %rax,%rdi
+  801d48:	48 b8 87 14 80 00 00 	movabs $0x801487,%rax
+  801d4f:	00 00 00 
+  801d52:	ff d0                	call   *%rax
+  801d54:	85 c0                	test   %eax,%eax
+  801d56:	75 b6                	jne    801d0e <strstr+0x47>
+
+	return (char *)(in - 1);
+  801d58:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d5c:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801d60:	c9                   	leave
+  801d61:	c3                   	ret
+
+0000000000801d62 <syscall>:
+ * 用户的指令式系统调用，该函数将系统调用序号放入eax寄存器，五个参数依次放入edx, ecx, ebx, edi, esi，然后执行指令int 0x30，
+ * 发生中断后，去IDT中查找中断处理函数，最终会走到kern/trap.c的trap_dispatch()中
+ */
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801d62:	55                   	push   %rbp
+  801d63:	48 89 e5             	mov    %rsp,%rbp
+  801d66:	53                   	push   %rbx
+  801d67:	48 83 ec 48          	sub    $0x48,%rsp
+  801d6b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801d6e:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801d71:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801d75:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801d79:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801d7d:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	 * volatile 告诉汇编程序不要因为不使用返回值就优化该指令
+	 * 最后一个子句告诉汇编程序，指令可能会改变条件代码cx和任意内存memory位置
+	 * 由汇编编译器做好数据保存和恢复工作(栈)
+	 */
+
+	asm volatile("int %1\n"			// code: int T_SYSCALL
+  801d81:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d84:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801d88:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801d8c:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801d90:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801d94:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801d98:	4c 89 c3             	mov    %r8,%rbx
+  801d9b:	cd 30                	int    $0x30
+  801d9d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+				   "D"(a4),			// edi = a4
+				   "S"(a5)			// esi = a5
+				 : "cc", "memory"); // 指令可能会改变条件代码cx和任意内存memory位置
+									// 由汇编编译器做好数据保存和恢复工作(栈)
+
+	if (check && ret > 0)
+  801da1:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801da5:	74 44                	je     801deb <syscall+0x89>
+  801da7:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801dac:	7e 3d                	jle    801deb <syscall+0x89>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801dae:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801db2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801db5:	49 89 d0             	mov    %rdx,%r8
+  801db8:	89 c1                	mov    %eax,%ecx
+  801dba:	48 b8 68 2a 80 00 00 	movabs $0x802a68,%rax
+  801dc1:	00 00 00 
+  801dc4:	48 89 c2             	mov    %rax,%rdx
+  801dc7:	be 34 00 00 00       	mov    $0x34,%esi
+  801dcc:	48 b8 85 2a 80 00 00 	movabs $0x802a85,%rax
+  801dd3:	00 00 00 
+  801dd6:	48 89 c7             	mov    %rax,%rdi
+  801dd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dde:	49 b9 0e 04 80 00 00 	movabs $0x80040e,%r9
+  801de5:	00 00 00 
+  801de8:	41 ff d1             	call   *%r9
+
+	return ret;
+  801deb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801def:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801df3:	c9                   	leave
+  801df4:	c3                   	ret
+
+0000000000801df5 <sys_cputs>:
+
+void sys_cputs(const char *s, size_t len)
+{
+  801df5:	55                   	push   %rbp
+  801df6:	48 89 e5             	mov    %rsp,%rbp
+  801df9:	48 83 ec 10          	sub    $0x10,%rsp
+  801dfd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e01:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 调用lib/syscall.c中的syscall()
+	// SYS_cputs: 系统调用序号(eax)，s: 需要输出的字符数组，len: 数组长度
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801e05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e09:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e0d:	48 83 ec 08          	sub    $0x8,%rsp
+  801e11:	6a 00                	push   $0x0
+  801e13:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e19:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e1f:	48 89 d1             	mov    %rdx,%rcx
+  801e22:	48 89 c2             	mov    %rax,%rdx
+  801e25:	be 00 00 00 00       	mov    $0x0,%esi
+  801e2a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e2f:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  801e36:	00 00 00 
+  801e39:	ff d0                	call   *%rax
+  801e3b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e3f:	90                   	nop
+  801e40:	c9                   	leave
+  801e41:	c3                   	ret
+
+0000000000801e42 <sys_cgetc>:
+
+int sys_cgetc(void)
+{
+  801e42:	55                   	push   %rbp
+  801e43:	48 89 e5             	mov    %rsp,%rbp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801e46:	48 83 ec 08          	sub    $0x8,%rsp
+  801e4a:	6a 00                	push   $0x0
+  801e4c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e52:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e58:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e62:	be 00 00 00 00       	mov    $0x0,%esi
+  801e67:	bf 01 00 00 00       	mov    $0x1,%edi
+  801e6c:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  801e73:	00 00 00 
+  801e76:	ff d0                	call   *%rax
+  801e78:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e7c:	c9                   	leave
+  801e7d:	c3                   	ret
+
+0000000000801e7e <sys_env_destroy>:
+
+int sys_env_destroy(envid_t envid)
+{
+  801e7e:	55                   	push   %rbp
+  801e7f:	48 89 e5             	mov    %rsp,%rbp
+  801e82:	48 83 ec 10          	sub    $0x10,%rsp
+  801e86:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	// 销毁envid对应的环境
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801e89:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e8c:	48 98                	cltq
+  801e8e:	48 83 ec 08          	sub    $0x8,%rsp
+  801e92:	6a 00                	push   $0x0
+  801e94:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e9a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ea0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ea5:	48 89 c2             	mov    %rax,%rdx
+  801ea8:	be 01 00 00 00       	mov    $0x1,%esi
+  801ead:	bf 03 00 00 00       	mov    $0x3,%edi
+  801eb2:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  801eb9:	00 00 00 
+  801ebc:	ff d0                	call   *%rax
+  801ebe:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ec2:	c9                   	leave
+  801ec3:	c3                   	ret
+
+0000000000801ec4 <sys_getprocid>:
+
+envid_t
+sys_getprocid(void)
+{
+  801ec4:	55                   	push   %rbp
+  801ec5:	48 89 e5             	mov    %rsp,%rbp
+	// 获取当前用户环境id
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801ec8:	48 83 ec 08          	sub    $0x8,%rsp
+  801ecc:	6a 00                	push   $0x0
+  801ece:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ed4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801eda:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801edf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ee4:	be 00 00 00 00       	mov    $0x0,%esi
+  801ee9:	bf 02 00 00 00       	mov    $0x2,%edi
+  801eee:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  801ef5:	00 00 00 
+  801ef8:	ff d0                	call   *%rax
+  801efa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801efe:	c9                   	leave
+  801eff:	c3                   	ret
+
+0000000000801f00 <sys_yield>:
+
+void sys_yield(void)
+{
+  801f00:	55                   	push   %rbp
+  801f01:	48 89 e5             	mov    %rsp,%rbp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801f04:	48 83 ec 08          	sub    $0x8,%rsp
+  801f08:	6a 00                	push   $0x0
+  801f0a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f10:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f16:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f20:	be 00 00 00 00       	mov    $0x0,%esi
+  801f25:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801f2a:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  801f31:	00 00 00 
+  801f34:	ff d0                	call   *%rax
+  801f36:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f3a:	90                   	nop
+  801f3b:	c9                   	leave
+  801f3c:	c3                   	ret
+
+0000000000801f3d <sys_page_alloc>:
+
+int sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801f3d:	55                   	push   %rbp
+  801f3e:	48 89 e5             	mov    %rsp,%rbp
+  801f41:	48 83 ec 10          	sub    $0x10,%rsp
+  801f45:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f48:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f4c:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  801f4f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801f52:	48 63 c8             	movslq %eax,%rcx
+  801f55:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801f59:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f5c:	48 98                	cltq
+  801f5e:	48 83 ec 08          	sub    $0x8,%rsp
+  801f62:	6a 00                	push   $0x0
+  801f64:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f6a:	49 89 c8             	mov    %rcx,%r8
+  801f6d:	48 89 d1             	mov    %rdx,%rcx
+  801f70:	48 89 c2             	mov    %rax,%rdx
+  801f73:	be 01 00 00 00       	mov    $0x1,%esi
+  801f78:	bf 04 00 00 00       	mov    $0x4,%edi
+  801f7d:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  801f84:	00 00 00 
+  801f87:	ff d0                	call   *%rax
+  801f89:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f8d:	c9                   	leave
+  801f8e:	c3                   	ret
+
+0000000000801f8f <sys_page_map>:
+
+int sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801f8f:	55                   	push   %rbp
+  801f90:	48 89 e5             	mov    %rsp,%rbp
+  801f93:	48 83 ec 20          	sub    $0x20,%rsp
+  801f97:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f9a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f9e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801fa1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801fa5:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  801fa9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801fac:	48 63 c8             	movslq %eax,%rcx
+  801faf:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  801fb3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801fb6:	48 63 f0             	movslq %eax,%rsi
+  801fb9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801fbd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fc0:	48 98                	cltq
+  801fc2:	48 83 ec 08          	sub    $0x8,%rsp
+  801fc6:	51                   	push   %rcx
+  801fc7:	49 89 f9             	mov    %rdi,%r9
+  801fca:	49 89 f0             	mov    %rsi,%r8
+  801fcd:	48 89 d1             	mov    %rdx,%rcx
+  801fd0:	48 89 c2             	mov    %rax,%rdx
+  801fd3:	be 01 00 00 00       	mov    $0x1,%esi
+  801fd8:	bf 05 00 00 00       	mov    $0x5,%edi
+  801fdd:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  801fe4:	00 00 00 
+  801fe7:	ff d0                	call   *%rax
+  801fe9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fed:	c9                   	leave
+  801fee:	c3                   	ret
+
+0000000000801fef <sys_page_unmap>:
+
+int sys_page_unmap(envid_t envid, void *va)
+{
+  801fef:	55                   	push   %rbp
+  801ff0:	48 89 e5             	mov    %rsp,%rbp
+  801ff3:	48 83 ec 10          	sub    $0x10,%rsp
+  801ff7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801ffa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  801ffe:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802002:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802005:	48 98                	cltq
+  802007:	48 83 ec 08          	sub    $0x8,%rsp
+  80200b:	6a 00                	push   $0x0
+  80200d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802013:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802019:	48 89 d1             	mov    %rdx,%rcx
+  80201c:	48 89 c2             	mov    %rax,%rdx
+  80201f:	be 01 00 00 00       	mov    $0x1,%esi
+  802024:	bf 06 00 00 00       	mov    $0x6,%edi
+  802029:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  802030:	00 00 00 
+  802033:	ff d0                	call   *%rax
+  802035:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802039:	c9                   	leave
+  80203a:	c3                   	ret
+
+000000000080203b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int sys_env_set_status(envid_t envid, int status)
+{
+  80203b:	55                   	push   %rbp
+  80203c:	48 89 e5             	mov    %rsp,%rbp
+  80203f:	48 83 ec 10          	sub    $0x10,%rsp
+  802043:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802046:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802049:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80204c:	48 63 d0             	movslq %eax,%rdx
+  80204f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802052:	48 98                	cltq
+  802054:	48 83 ec 08          	sub    $0x8,%rsp
+  802058:	6a 00                	push   $0x0
+  80205a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802060:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802066:	48 89 d1             	mov    %rdx,%rcx
+  802069:	48 89 c2             	mov    %rax,%rdx
+  80206c:	be 01 00 00 00       	mov    $0x1,%esi
+  802071:	bf 08 00 00 00       	mov    $0x8,%edi
+  802076:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  80207d:	00 00 00 
+  802080:	ff d0                	call   *%rax
+  802082:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802086:	c9                   	leave
+  802087:	c3                   	ret
+
+0000000000802088 <sys_env_set_trapframe>:
+
+int sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802088:	55                   	push   %rbp
+  802089:	48 89 e5             	mov    %rsp,%rbp
+  80208c:	48 83 ec 10          	sub    $0x10,%rsp
+  802090:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802093:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  802097:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80209b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80209e:	48 98                	cltq
+  8020a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8020a4:	6a 00                	push   $0x0
+  8020a6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020b2:	48 89 d1             	mov    %rdx,%rcx
+  8020b5:	48 89 c2             	mov    %rax,%rdx
+  8020b8:	be 01 00 00 00       	mov    $0x1,%esi
+  8020bd:	bf 09 00 00 00       	mov    $0x9,%edi
+  8020c2:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  8020c9:	00 00 00 
+  8020cc:	ff d0                	call   *%rax
+  8020ce:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020d2:	c9                   	leave
+  8020d3:	c3                   	ret
+
+00000000008020d4 <sys_env_set_pgfault_upcall>:
+
+int sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8020d4:	55                   	push   %rbp
+  8020d5:	48 89 e5             	mov    %rsp,%rbp
+  8020d8:	48 83 ec 10          	sub    $0x10,%rsp
+  8020dc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020df:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  8020e3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8020e7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020ea:	48 98                	cltq
+  8020ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8020f0:	6a 00                	push   $0x0
+  8020f2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020fe:	48 89 d1             	mov    %rdx,%rcx
+  802101:	48 89 c2             	mov    %rax,%rdx
+  802104:	be 01 00 00 00       	mov    $0x1,%esi
+  802109:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80210e:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  802115:	00 00 00 
+  802118:	ff d0                	call   *%rax
+  80211a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80211e:	c9                   	leave
+  80211f:	c3                   	ret
+
+0000000000802120 <sys_ipc_try_send>:
+
+int sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802120:	55                   	push   %rbp
+  802121:	48 89 e5             	mov    %rsp,%rbp
+  802124:	48 83 ec 20          	sub    $0x20,%rsp
+  802128:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80212b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80212f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802133:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  802136:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802139:	48 63 f0             	movslq %eax,%rsi
+  80213c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802140:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802143:	48 98                	cltq
+  802145:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802149:	48 83 ec 08          	sub    $0x8,%rsp
+  80214d:	6a 00                	push   $0x0
+  80214f:	49 89 f1             	mov    %rsi,%r9
+  802152:	49 89 c8             	mov    %rcx,%r8
+  802155:	48 89 d1             	mov    %rdx,%rcx
+  802158:	48 89 c2             	mov    %rax,%rdx
+  80215b:	be 00 00 00 00       	mov    $0x0,%esi
+  802160:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802165:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  80216c:	00 00 00 
+  80216f:	ff d0                	call   *%rax
+  802171:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802175:	c9                   	leave
+  802176:	c3                   	ret
+
+0000000000802177 <sys_ipc_recv>:
+
+int sys_ipc_recv(void *dstva)
+{
+  802177:	55                   	push   %rbp
+  802178:	48 89 e5             	mov    %rsp,%rbp
+  80217b:	48 83 ec 10          	sub    $0x10,%rsp
+  80217f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  802183:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802187:	48 83 ec 08          	sub    $0x8,%rsp
+  80218b:	6a 00                	push   $0x0
+  80218d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802193:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802199:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80219e:	48 89 c2             	mov    %rax,%rdx
+  8021a1:	be 01 00 00 00       	mov    $0x1,%esi
+  8021a6:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8021ab:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  8021b2:	00 00 00 
+  8021b5:	ff d0                	call   *%rax
+  8021b7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021bb:	c9                   	leave
+  8021bc:	c3                   	ret
+
+00000000008021bd <sys_disk_io>:
+
+int sys_disk_io(int dev, uint64_t secno, void *va, size_t nsecs, int write)
+{
+  8021bd:	55                   	push   %rbp
+  8021be:	48 89 e5             	mov    %rsp,%rbp
+  8021c1:	48 83 ec 20          	sub    $0x20,%rsp
+  8021c5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021c8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8021cc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8021d0:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  8021d4:	44 89 45 f8          	mov    %r8d,-0x8(%rbp)
+	return syscall(SYS_disk_io, 0, dev, secno, (uint64_t)va, nsecs, write);
+  8021d8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8021db:	48 63 c8             	movslq %eax,%rcx
+  8021de:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8021e2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021e5:	48 98                	cltq
+  8021e7:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8021eb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8021f3:	51                   	push   %rcx
+  8021f4:	49 89 f9             	mov    %rdi,%r9
+  8021f7:	49 89 f0             	mov    %rsi,%r8
+  8021fa:	48 89 d1             	mov    %rdx,%rcx
+  8021fd:	48 89 c2             	mov    %rax,%rdx
+  802200:	be 00 00 00 00       	mov    $0x0,%esi
+  802205:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80220a:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  802211:	00 00 00 
+  802214:	ff d0                	call   *%rax
+  802216:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80221a:	c9                   	leave
+  80221b:	c3                   	ret
+
+000000000080221c <sys_vma_alloc>:
+
+int sys_vma_alloc(envid_t envid, void *va, size_t len, int perm)
+{
+  80221c:	55                   	push   %rbp
+  80221d:	48 89 e5             	mov    %rsp,%rbp
+  802220:	48 83 ec 20          	sub    $0x20,%rsp
+  802224:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802227:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80222b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80222f:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_vma_alloc, 1, envid, (uint64_t)va, len, perm, 0);
+  802232:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802235:	48 63 f0             	movslq %eax,%rsi
+  802238:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80223c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80223f:	48 98                	cltq
+  802241:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802245:	48 83 ec 08          	sub    $0x8,%rsp
+  802249:	6a 00                	push   $0x0
+  80224b:	49 89 f1             	mov    %rsi,%r9
+  80224e:	49 89 c8             	mov    %rcx,%r8
+  802251:	48 89 d1             	mov    %rdx,%rcx
+  802254:	48 89 c2             	mov    %rax,%rdx
+  802257:	be 01 00 00 00       	mov    $0x1,%esi
+  80225c:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802261:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  802268:	00 00 00 
+  80226b:	ff d0                	call   *%rax
+  80226d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802271:	c9                   	leave
+  802272:	c3                   	ret
+
+0000000000802273 <sys_vma_clear>:
+
+int sys_vma_clear(envid_t envid)
+{
+  802273:	55                   	push   %rbp
+  802274:	48 89 e5             	mov    %rsp,%rbp
+  802277:	48 83 ec 10          	sub    $0x10,%rsp
+  80227b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_vma_clear, 1, envid, 0, 0, 0, 0);
+  80227e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802281:	48 98                	cltq
+  802283:	48 83 ec 08          	sub    $0x8,%rsp
+  802287:	6a 00                	push   $0x0
+  802289:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80228f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802295:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80229a:	48 89 c2             	mov    %rax,%rdx
+  80229d:	be 01 00 00 00       	mov    $0x1,%esi
+  8022a2:	bf 10 00 00 00       	mov    $0x10,%edi
+  8022a7:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  8022ae:	00 00 00 
+  8022b1:	ff d0                	call   *%rax
+  8022b3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022b7:	c9                   	leave
+  8022b8:	c3                   	ret
+
+00000000008022b9 <sys_trace_ctl>:
+
+int sys_trace_ctl(int enable)
+{
+  8022b9:	55                   	push   %rbp
+  8022ba:	48 89 e5             	mov    %rsp,%rbp
+  8022bd:	48 83 ec 10          	sub    $0x10,%rsp
+  8022c1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_trace_ctl, 0, enable, 0, 0, 0, 0);
+  8022c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8022c7:	48 98                	cltq
+  8022c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8022cd:	6a 00                	push   $0x0
+  8022cf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022e0:	48 89 c2             	mov    %rax,%rdx
+  8022e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8022e8:	bf 11 00 00 00       	mov    $0x11,%edi
+  8022ed:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  8022f4:	00 00 00 
+  8022f7:	ff d0                	call   *%rax
+  8022f9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022fd:	c9                   	leave
+  8022fe:	c3                   	ret
+
+00000000008022ff <sys_trace_read>:
+
+int sys_trace_read(int cpu, uint64_t *seq, struct TraceEvent *buf, int n)
+{
+  8022ff:	55                   	push   %rbp
+  802300:	48 89 e5             	mov    %rsp,%rbp
+  802303:	48 83 ec 20          	sub    $0x20,%rsp
+  802307:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80230a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80230e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802312:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_trace_read, 0, cpu, (uint64_t)seq, (uint64_t)buf, n, 0);
+  802315:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802318:	48 63 f0             	movslq %eax,%rsi
+  80231b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80231f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802323:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802326:	48 98                	cltq
+  802328:	48 83 ec 08          	sub    $0x8,%rsp
+  80232c:	6a 00                	push   $0x0
+  80232e:	49 89 f1             	mov    %rsi,%r9
+  802331:	49 89 c8             	mov    %rcx,%r8
+  802334:	48 89 d1             	mov    %rdx,%rcx
+  802337:	48 89 c2             	mov    %rax,%rdx
+  80233a:	be 00 00 00 00       	mov    $0x0,%esi
+  80233f:	bf 12 00 00 00       	mov    $0x12,%edi
+  802344:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  80234b:	00 00 00 
+  80234e:	ff d0                	call   *%rax
+  802350:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802354:	c9                   	leave
+  802355:	c3                   	ret
+
+0000000000802356 <sys_getrusage>:
+
+int sys_getrusage(envid_t envid, struct Rusage *ru)
+{
+  802356:	55                   	push   %rbp
+  802357:	48 89 e5             	mov    %rsp,%rbp
+  80235a:	48 83 ec 10          	sub    $0x10,%rsp
+  80235e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802361:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_getrusage, 0, envid, (uint64_t)ru, 0, 0, 0);
+  802365:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802369:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80236c:	48 98                	cltq
+  80236e:	48 83 ec 08          	sub    $0x8,%rsp
+  802372:	6a 00                	push   $0x0
+  802374:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80237a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802380:	48 89 d1             	mov    %rdx,%rcx
+  802383:	48 89 c2             	mov    %rax,%rdx
+  802386:	be 00 00 00 00       	mov    $0x0,%esi
+  80238b:	bf 13 00 00 00       	mov    $0x13,%edi
+  802390:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  802397:	00 00 00 
+  80239a:	ff d0                	call   *%rax
+  80239c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023a0:	c9                   	leave
+  8023a1:	c3                   	ret
+
+00000000008023a2 <sys_pmu_config>:
+
+int sys_pmu_config(int idx, uint64_t event)
+{
+  8023a2:	55                   	push   %rbp
+  8023a3:	48 89 e5             	mov    %rsp,%rbp
+  8023a6:	48 83 ec 10          	sub    $0x10,%rsp
+  8023aa:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023ad:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_pmu_config, 0, idx, event, 0, 0, 0);
+  8023b1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8023b4:	48 98                	cltq
+  8023b6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8023be:	6a 00                	push   $0x0
+  8023c0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023cc:	48 89 d1             	mov    %rdx,%rcx
+  8023cf:	48 89 c2             	mov    %rax,%rdx
+  8023d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8023d7:	bf 14 00 00 00       	mov    $0x14,%edi
+  8023dc:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  8023e3:	00 00 00 
+  8023e6:	ff d0                	call   *%rax
+  8023e8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023ec:	c9                   	leave
+  8023ed:	c3                   	ret
+
+00000000008023ee <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  8023ee:	55                   	push   %rbp
+  8023ef:	48 89 e5             	mov    %rsp,%rbp
+  8023f2:	48 83 ec 10          	sub    $0x10,%rsp
+  8023f6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+  8023f9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8023fc:	48 83 ec 08          	sub    $0x8,%rsp
+  802400:	6a 00                	push   $0x0
+  802402:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802408:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80240e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802413:	48 89 c2             	mov    %rax,%rdx
+  802416:	be 00 00 00 00       	mov    $0x0,%esi
+  80241b:	bf 15 00 00 00       	mov    $0x15,%edi
+  802420:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  802427:	00 00 00 
+  80242a:	ff d0                	call   *%rax
+  80242c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802430:	c9                   	leave
+  802431:	c3                   	ret
+
+0000000000802432 <sys_image_attach>:
+
+int sys_image_attach(envid_t envid, int dev, const uint64_t *secnos, size_t size)
+{
+  802432:	55                   	push   %rbp
+  802433:	48 89 e5             	mov    %rsp,%rbp
+  802436:	48 83 ec 20          	sub    $0x20,%rsp
+  80243a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80243d:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  802440:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  802444:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+	return syscall(SYS_image_attach, 1, envid, dev, (uint64_t)secnos, size, 0);
+  802448:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80244c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80244f:	48 63 d0             	movslq %eax,%rdx
+  802452:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802455:	48 98                	cltq
+  802457:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80245b:	48 83 ec 08          	sub    $0x8,%rsp
+  80245f:	6a 00                	push   $0x0
+  802461:	49 89 f1             	mov    %rsi,%r9
+  802464:	49 89 c8             	mov    %rcx,%r8
+  802467:	48 89 d1             	mov    %rdx,%rcx
+  80246a:	48 89 c2             	mov    %rax,%rdx
+  80246d:	be 01 00 00 00       	mov    $0x1,%esi
+  802472:	bf 16 00 00 00       	mov    $0x16,%edi
+  802477:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  80247e:	00 00 00 
+  802481:	ff d0                	call   *%rax
+  802483:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802487:	c9                   	leave
+  802488:	c3                   	ret
+
+0000000000802489 <sys_vma_binary>:
+
+int sys_vma_binary(envid_t envid, const struct Proghdr *ph)
+{
+  802489:	55                   	push   %rbp
+  80248a:	48 89 e5             	mov    %rsp,%rbp
+  80248d:	48 83 ec 10          	sub    $0x10,%rsp
+  802491:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802494:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_vma_binary, 1, envid, (uint64_t)ph, 0, 0, 0);
+  802498:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80249c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80249f:	48 98                	cltq
+  8024a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8024a5:	6a 00                	push   $0x0
+  8024a7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024b3:	48 89 d1             	mov    %rdx,%rcx
+  8024b6:	48 89 c2             	mov    %rax,%rdx
+  8024b9:	be 01 00 00 00       	mov    $0x1,%esi
+  8024be:	bf 17 00 00 00       	mov    $0x17,%edi
+  8024c3:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  8024ca:	00 00 00 
+  8024cd:	ff d0                	call   *%rax
+  8024cf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024d3:	c9                   	leave
+  8024d4:	c3                   	ret
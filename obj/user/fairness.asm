@@ -0,0 +1,3842 @@
+
+obj/user/fairness.debug:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// entrypoint - 当最初被加载到一个新的环境中时，内核(或者父环境)在这里开始运行.
+.text
+.globl _start
+_start:
+	// 判断是否从栈上的参数开始初始化
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	// $USTACKTOP != %rsp 说明有参数，跳转到 args_exist
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// 如果不是(新环境被内核加载的时候)，则 push 伪造的 argc, argv 参数
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 e3 00 00 00       	call   800124 <libmain>
+
+// 不应该返回
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+// (user/idle is env 0).
+
+#include "inc/lib.h"
+
+void umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	48 83 ec 20          	sub    $0x20,%rsp
+  80004b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80004e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int32_t who, id;
+
+	id = sys_getprocid();
+  800052:	48 b8 55 1b 80 00 00 	movabs $0x801b55,%rax
+  800059:	00 00 00 
+  80005c:	ff d0                	call   *%rax
+  80005e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+	if (thisproc == &procs[1])
+  800061:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  800068:	00 00 00 
+  80006b:	48 8b 10             	mov    (%rax),%rdx
+  80006e:	48 b8 50 03 80 00 80 	movabs $0x8000800350,%rax
+  800075:	00 00 00 
+  800078:	48 39 c2             	cmp    %rax,%rdx
+  80007b:	75 45                	jne    8000c2 <umain+0x7f>
+	{
+		while (1)
+		{
+			ipc_recv(&who, 0, 0);
+  80007d:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  800081:	ba 00 00 00 00       	mov    $0x0,%edx
+  800086:	be 00 00 00 00       	mov    $0x0,%esi
+  80008b:	48 89 c7             	mov    %rax,%rdi
+  80008e:	48 b8 66 21 80 00 00 	movabs $0x802166,%rax
+  800095:	00 00 00 
+  800098:	ff d0                	call   *%rax
+			cprintf("%x recv from %x\n", id, who);
+  80009a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80009d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000a0:	89 c6                	mov    %eax,%esi
+  8000a2:	48 b8 60 24 80 00 00 	movabs $0x802460,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 89 c7             	mov    %rax,%rdi
+  8000af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b4:	48 b9 e2 02 80 00 00 	movabs $0x8002e2,%rcx
+  8000bb:	00 00 00 
+  8000be:	ff d1                	call   *%rcx
+			ipc_recv(&who, 0, 0);
+  8000c0:	eb bb                	jmp    80007d <umain+0x3a>
+		}
+	}
+	else
+	{
+		cprintf("%x loop sending to %x\n", id, procs[1].proc_id);
+  8000c2:	48 b8 00 00 80 00 80 	movabs $0x8000800000,%rax
+  8000c9:	00 00 00 
+  8000cc:	8b 90 28 04 00 00    	mov    0x428(%rax),%edx
+  8000d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000d5:	89 c6                	mov    %eax,%esi
+  8000d7:	48 b8 71 24 80 00 00 	movabs $0x802471,%rax
+  8000de:	00 00 00 
+  8000e1:	48 89 c7             	mov    %rax,%rdi
+  8000e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e9:	48 b9 e2 02 80 00 00 	movabs $0x8002e2,%rcx
+  8000f0:	00 00 00 
+  8000f3:	ff d1                	call   *%rcx
+		while (1)
+			ipc_send(procs[1].proc_id, 0, 0, 0);
+  8000f5:	48 b8 00 00 80 00 80 	movabs $0x8000800000,%rax
+  8000fc:	00 00 00 
+  8000ff:	8b 80 28 04 00 00    	mov    0x428(%rax),%eax
+  800105:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80010a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80010f:	be 00 00 00 00       	mov    $0x0,%esi
+  800114:	89 c7                	mov    %eax,%edi
+  800116:	48 b8 50 22 80 00 00 	movabs $0x802250,%rax
+  80011d:	00 00 00 
+  800120:	ff d0                	call   *%rax
+  800122:	eb d1                	jmp    8000f5 <umain+0xb2>
+
+0000000000800124 <libmain>:
+
+/**
+ *  用户环境从lib/libmain.c中的函数libmain开始执行，这个函数进而调用umain，用户写的程序入口只能是umain
+ */
+void libmain(int argc, char **argv)
+{
+  800124:	55                   	push   %rbp
+  800125:	48 89 e5             	mov    %rsp,%rbp
+  800128:	48 83 ec 10          	sub    $0x10,%rsp
+  80012c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80012f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 设置常量 thisproc 指向 procs[] 中当前环境的 Env 结构，ENVX 确保环境 id 未超过了 NENV
+	// thisproc 指向当前环境的 Env 结构
+	thisproc = &procs[ENVX(sys_getprocid())];
+  800133:	48 b8 55 1b 80 00 00 	movabs $0x801b55,%rax
+  80013a:	00 00 00 
+  80013d:	ff d0                	call   *%rax
+  80013f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800144:	48 98                	cltq
+  800146:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  80014d:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  800154:	00 00 00 
+  800157:	48 01 c2             	add    %rax,%rdx
+  80015a:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  800161:	00 00 00 
+  800164:	48 89 10             	mov    %rdx,(%rax)
+
+	// 通过 CPUID 选择 memset/memmove/memcpy 的实现
+	mem_init();
+  800167:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  80016e:	00 00 00 
+  800171:	ff d0                	call   *%rax
+
+	// 为了能让panic()提示用户错误，存储程序的名称
+	if (argc > 0)
+  800173:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800177:	7e 14                	jle    80018d <libmain+0x69>
+		binaryname = argv[0];
+  800179:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80017d:	48 8b 00             	mov    (%rax),%rax
+  800180:	48 ba 00 40 80 00 00 	movabs $0x804000,%rdx
+  800187:	00 00 00 
+  80018a:	48 89 02             	mov    %rax,(%rdx)
+
+	// 调用用户的主程序
+	umain(argc, argv);
+  80018d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800191:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800194:	48 89 d6             	mov    %rdx,%rsi
+  800197:	89 c7                	mov    %eax,%edi
+  800199:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  8001a0:	00 00 00 
+  8001a3:	ff d0                	call   *%rax
+
+	// 退出当前环境，env_destroy
+	sys_env_destroy(0);
+  8001a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001aa:	48 b8 0f 1b 80 00 00 	movabs $0x801b0f,%rax
+  8001b1:	00 00 00 
+  8001b4:	ff d0                	call   *%rax
+}
+  8001b6:	90                   	nop
+  8001b7:	c9                   	leave
+  8001b8:	c3                   	ret
+
+00000000008001b9 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001b9:	55                   	push   %rbp
+  8001ba:	48 89 e5             	mov    %rsp,%rbp
+  8001bd:	48 83 ec 10          	sub    $0x10,%rsp
+  8001c1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8001c4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->buf[b->idx++] = ch;
+  8001c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001cc:	8b 00                	mov    (%rax),%eax
+  8001ce:	8d 48 01             	lea    0x1(%rax),%ecx
+  8001d1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001d5:	89 0a                	mov    %ecx,(%rdx)
+  8001d7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8001da:	89 d1                	mov    %edx,%ecx
+  8001dc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001e0:	48 98                	cltq
+  8001e2:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+	if (b->idx == 256-1) {
+  8001e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001ea:	8b 00                	mov    (%rax),%eax
+  8001ec:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001f1:	75 2c                	jne    80021f <putch+0x66>
+		sys_cputs(b->buf, b->idx);
+  8001f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001f7:	8b 00                	mov    (%rax),%eax
+  8001f9:	48 98                	cltq
+  8001fb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001ff:	48 83 c2 08          	add    $0x8,%rdx
+  800203:	48 89 c6             	mov    %rax,%rsi
+  800206:	48 89 d7             	mov    %rdx,%rdi
+  800209:	48 b8 86 1a 80 00 00 	movabs $0x801a86,%rax
+  800210:	00 00 00 
+  800213:	ff d0                	call   *%rax
+		b->idx = 0;
+  800215:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800219:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	}
+	b->cnt++;
+  80021f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800223:	8b 40 04             	mov    0x4(%rax),%eax
+  800226:	8d 50 01             	lea    0x1(%rax),%edx
+  800229:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80022d:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800230:	90                   	nop
+  800231:	c9                   	leave
+  800232:	c3                   	ret
+
+0000000000800233 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800233:	55                   	push   %rbp
+  800234:	48 89 e5             	mov    %rsp,%rbp
+  800237:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80023e:	48 89 bd c8 fe ff ff 	mov    %rdi,-0x138(%rbp)
+  800245:	48 89 b5 c0 fe ff ff 	mov    %rsi,-0x140(%rbp)
+	struct printbuf b;
+	va_list aq;
+	va_copy(aq,ap);
+  80024c:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  800253:	48 8b b5 c0 fe ff ff 	mov    -0x140(%rbp),%rsi
+  80025a:	48 8b 06             	mov    (%rsi),%rax
+  80025d:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800261:	48 89 01             	mov    %rax,(%rcx)
+  800264:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800268:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80026c:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	b.idx = 0;
+  800270:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800277:	00 00 00 
+	b.cnt = 0;
+  80027a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800281:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, aq);
+  800284:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  80028b:	48 8b 95 c8 fe ff ff 	mov    -0x138(%rbp),%rdx
+  800292:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800299:	48 89 c6             	mov    %rax,%rsi
+  80029c:	48 b8 b9 01 80 00 00 	movabs $0x8001b9,%rax
+  8002a3:	00 00 00 
+  8002a6:	48 89 c7             	mov    %rax,%rdi
+  8002a9:	48 b8 80 06 80 00 00 	movabs $0x800680,%rax
+  8002b0:	00 00 00 
+  8002b3:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  8002b5:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8002bb:	48 98                	cltq
+  8002bd:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8002c4:	48 83 c2 08          	add    $0x8,%rdx
+  8002c8:	48 89 c6             	mov    %rax,%rsi
+  8002cb:	48 89 d7             	mov    %rdx,%rdi
+  8002ce:	48 b8 86 1a 80 00 00 	movabs $0x801a86,%rax
+  8002d5:	00 00 00 
+  8002d8:	ff d0                	call   *%rax
+	va_end(aq);
+
+	return b.cnt;
+  8002da:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8002e0:	c9                   	leave
+  8002e1:	c3                   	ret
+
+00000000008002e2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002e2:	55                   	push   %rbp
+  8002e3:	48 89 e5             	mov    %rsp,%rbp
+  8002e6:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  8002ed:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8002f4:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8002fb:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800302:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800309:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800310:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800317:	84 c0                	test   %al,%al
+  800319:	74 20                	je     80033b <cprintf+0x59>
+  80031b:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80031f:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800323:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800327:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80032b:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80032f:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800333:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800337:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+	va_list aq;
+	va_start(ap, fmt);
+  80033b:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800342:	00 00 00 
+  800345:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80034c:	00 00 00 
+  80034f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800353:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80035a:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800361:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  800368:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80036f:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800376:	48 8b 06             	mov    (%rsi),%rax
+  800379:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80037d:	48 89 01             	mov    %rax,(%rcx)
+  800380:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800384:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800388:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	cnt = vcprintf(fmt, aq);
+  80038c:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800393:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80039a:	48 89 d6             	mov    %rdx,%rsi
+  80039d:	48 89 c7             	mov    %rax,%rdi
+  8003a0:	48 b8 33 02 80 00 00 	movabs $0x800233,%rax
+  8003a7:	00 00 00 
+  8003aa:	ff d0                	call   *%rax
+  8003ac:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return cnt;
+  8003b2:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8003b8:	c9                   	leave
+  8003b9:	c3                   	ret
+
+00000000008003ba <printnum>:
+ * num: 需要打印出来的整型数，base: 整型数的进制，其他参数同 vprintfmt
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+		 unsigned long long num, unsigned base, int width, int padc)
+{
+  8003ba:	55                   	push   %rbp
+  8003bb:	48 89 e5             	mov    %rsp,%rbp
+  8003be:	48 83 ec 30          	sub    $0x30,%rsp
+  8003c2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8003c6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8003ca:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8003ce:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8003d1:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8003d5:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+	// 当 num 超过一位数，首先递归函数自身打印所有高位的(更重要的)数字
+	if (num >= base)
+  8003d9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8003dc:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8003e0:	72 54                	jb     800436 <printnum+0x7c>
+	{
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003e2:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8003e5:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8003e8:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8003eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8003ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003f4:	48 f7 f6             	div    %rsi
+  8003f7:	49 89 c2             	mov    %rax,%r10
+  8003fa:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8003fd:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800400:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800404:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800408:	41 89 c9             	mov    %ecx,%r9d
+  80040b:	41 89 f8             	mov    %edi,%r8d
+  80040e:	89 d1                	mov    %edx,%ecx
+  800410:	4c 89 d2             	mov    %r10,%rdx
+  800413:	48 89 c7             	mov    %rax,%rdi
+  800416:	48 b8 ba 03 80 00 00 	movabs $0x8003ba,%rax
+  80041d:	00 00 00 
+  800420:	ff d0                	call   *%rax
+  800422:	eb 1c                	jmp    800440 <printnum+0x86>
+	}
+	else
+	{
+		// 按照右对齐的格式在左侧补齐填充字符 padc
+		while (--width > 0)
+			putch(padc, putdat);
+  800424:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800428:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80042b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80042f:	48 89 d6             	mov    %rdx,%rsi
+  800432:	89 c7                	mov    %eax,%edi
+  800434:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800436:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  80043a:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80043e:	7f e4                	jg     800424 <printnum+0x6a>
+	}
+
+	// 然后打印个位数字
+	putch("0123456789abcdef"[num % base], putdat);
+  800440:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800443:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800447:	ba 00 00 00 00       	mov    $0x0,%edx
+  80044c:	48 f7 f1             	div    %rcx
+  80044f:	48 b8 90 26 80 00 00 	movabs $0x802690,%rax
+  800456:	00 00 00 
+  800459:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  80045d:	0f be c0             	movsbl %al,%eax
+  800460:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800464:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800468:	48 89 d6             	mov    %rdx,%rsi
+  80046b:	89 c7                	mov    %eax,%edi
+  80046d:	ff d1                	call   *%rcx
+}
+  80046f:	90                   	nop
+  800470:	c9                   	leave
+  800471:	c3                   	ret
+
+0000000000800472 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800472:	55                   	push   %rbp
+  800473:	48 89 e5             	mov    %rsp,%rbp
+  800476:	48 83 ec 20          	sub    $0x20,%rsp
+  80047a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80047e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;
+	if (lflag >= 2)
+  800481:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800485:	7e 4f                	jle    8004d6 <getuint+0x64>
+		x = va_arg(*ap, unsigned long long);
+  800487:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80048b:	8b 00                	mov    (%rax),%eax
+  80048d:	83 f8 2f             	cmp    $0x2f,%eax
+  800490:	77 24                	ja     8004b6 <getuint+0x44>
+  800492:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800496:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80049a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80049e:	8b 00                	mov    (%rax),%eax
+  8004a0:	89 c0                	mov    %eax,%eax
+  8004a2:	48 01 d0             	add    %rdx,%rax
+  8004a5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8004a9:	8b 12                	mov    (%rdx),%edx
+  8004ab:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8004ae:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8004b2:	89 0a                	mov    %ecx,(%rdx)
+  8004b4:	eb 14                	jmp    8004ca <getuint+0x58>
+  8004b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004ba:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8004be:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8004c2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8004c6:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8004ca:	48 8b 00             	mov    (%rax),%rax
+  8004cd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8004d1:	e9 9d 00 00 00       	jmp    800573 <getuint+0x101>
+	else if (lflag)
+  8004d6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8004da:	74 4c                	je     800528 <getuint+0xb6>
+		x = va_arg(*ap, unsigned long);
+  8004dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004e0:	8b 00                	mov    (%rax),%eax
+  8004e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8004e5:	77 24                	ja     80050b <getuint+0x99>
+  8004e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004eb:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004f3:	8b 00                	mov    (%rax),%eax
+  8004f5:	89 c0                	mov    %eax,%eax
+  8004f7:	48 01 d0             	add    %rdx,%rax
+  8004fa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8004fe:	8b 12                	mov    (%rdx),%edx
+  800500:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800503:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800507:	89 0a                	mov    %ecx,(%rdx)
+  800509:	eb 14                	jmp    80051f <getuint+0xad>
+  80050b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80050f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800513:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800517:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80051b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80051f:	48 8b 00             	mov    (%rax),%rax
+  800522:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800526:	eb 4b                	jmp    800573 <getuint+0x101>
+	else
+		x = va_arg(*ap, unsigned int);
+  800528:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80052c:	8b 00                	mov    (%rax),%eax
+  80052e:	83 f8 2f             	cmp    $0x2f,%eax
+  800531:	77 24                	ja     800557 <getuint+0xe5>
+  800533:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800537:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80053b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80053f:	8b 00                	mov    (%rax),%eax
+  800541:	89 c0                	mov    %eax,%eax
+  800543:	48 01 d0             	add    %rdx,%rax
+  800546:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80054a:	8b 12                	mov    (%rdx),%edx
+  80054c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80054f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800553:	89 0a                	mov    %ecx,(%rdx)
+  800555:	eb 14                	jmp    80056b <getuint+0xf9>
+  800557:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80055b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80055f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800563:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800567:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80056b:	8b 00                	mov    (%rax),%eax
+  80056d:	89 c0                	mov    %eax,%eax
+  80056f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800573:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800577:	c9                   	leave
+  800578:	c3                   	ret
+
+0000000000800579 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800579:	55                   	push   %rbp
+  80057a:	48 89 e5             	mov    %rsp,%rbp
+  80057d:	48 83 ec 20          	sub    $0x20,%rsp
+  800581:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800585:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800588:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  80058c:	7e 4f                	jle    8005dd <getint+0x64>
+		x = va_arg(*ap, long long);
+  80058e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800592:	8b 00                	mov    (%rax),%eax
+  800594:	83 f8 2f             	cmp    $0x2f,%eax
+  800597:	77 24                	ja     8005bd <getint+0x44>
+  800599:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80059d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005a5:	8b 00                	mov    (%rax),%eax
+  8005a7:	89 c0                	mov    %eax,%eax
+  8005a9:	48 01 d0             	add    %rdx,%rax
+  8005ac:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005b0:	8b 12                	mov    (%rdx),%edx
+  8005b2:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005b5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005b9:	89 0a                	mov    %ecx,(%rdx)
+  8005bb:	eb 14                	jmp    8005d1 <getint+0x58>
+  8005bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005c1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005c5:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005c9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005cd:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005d1:	48 8b 00             	mov    (%rax),%rax
+  8005d4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8005d8:	e9 9d 00 00 00       	jmp    80067a <getint+0x101>
+	else if (lflag)
+  8005dd:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8005e1:	74 4c                	je     80062f <getint+0xb6>
+		x = va_arg(*ap, long);
+  8005e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005e7:	8b 00                	mov    (%rax),%eax
+  8005e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8005ec:	77 24                	ja     800612 <getint+0x99>
+  8005ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005f2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005fa:	8b 00                	mov    (%rax),%eax
+  8005fc:	89 c0                	mov    %eax,%eax
+  8005fe:	48 01 d0             	add    %rdx,%rax
+  800601:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800605:	8b 12                	mov    (%rdx),%edx
+  800607:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80060a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80060e:	89 0a                	mov    %ecx,(%rdx)
+  800610:	eb 14                	jmp    800626 <getint+0xad>
+  800612:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800616:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80061a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80061e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800622:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800626:	48 8b 00             	mov    (%rax),%rax
+  800629:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80062d:	eb 4b                	jmp    80067a <getint+0x101>
+	else
+		x = va_arg(*ap, int);
+  80062f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800633:	8b 00                	mov    (%rax),%eax
+  800635:	83 f8 2f             	cmp    $0x2f,%eax
+  800638:	77 24                	ja     80065e <getint+0xe5>
+  80063a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80063e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800642:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800646:	8b 00                	mov    (%rax),%eax
+  800648:	89 c0                	mov    %eax,%eax
+  80064a:	48 01 d0             	add    %rdx,%rax
+  80064d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800651:	8b 12                	mov    (%rdx),%edx
+  800653:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800656:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80065a:	89 0a                	mov    %ecx,(%rdx)
+  80065c:	eb 14                	jmp    800672 <getint+0xf9>
+  80065e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800662:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800666:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80066a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80066e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800672:	8b 00                	mov    (%rax),%eax
+  800674:	48 98                	cltq
+  800676:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80067a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80067e:	c9                   	leave
+  80067f:	c3                   	ret
+
+0000000000800680 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap)
+{
+  800680:	55                   	push   %rbp
+  800681:	48 89 e5             	mov    %rsp,%rbp
+  800684:	41 54                	push   %r12
+  800686:	53                   	push   %rbx
+  800687:	48 83 ec 60          	sub    $0x60,%rsp
+  80068b:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80068f:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800693:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800697:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+	int base, lflag, width, precision, altflag;
+
+	// 填充字符，在显示字符串的'%'后读到'-'或'0'时，赋值到 padc
+	char padc;
+	va_list aq;
+	va_copy(aq, ap);
+  80069b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80069f:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8006a3:	48 8b 06             	mov    (%rsi),%rax
+  8006a6:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8006aa:	48 89 01             	mov    %rax,(%rcx)
+  8006ad:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8006b1:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8006b5:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1)
+	{
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  8006b9:	eb 17                	jmp    8006d2 <vprintfmt+0x52>
+		{
+			if (ch == '\0')
+  8006bb:	85 db                	test   %ebx,%ebx
+  8006bd:	0f 84 b9 04 00 00    	je     800b7c <vprintfmt+0x4fc>
+				return;
+			putch(ch, putdat);
+  8006c3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006c7:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8006cb:	48 89 c6             	mov    %rax,%rsi
+  8006ce:	89 df                	mov    %ebx,%edi
+  8006d0:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  8006d2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8006d6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006da:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8006de:	0f b6 00             	movzbl (%rax),%eax
+  8006e1:	0f b6 d8             	movzbl %al,%ebx
+  8006e4:	83 fb 25             	cmp    $0x25,%ebx
+  8006e7:	75 d2                	jne    8006bb <vprintfmt+0x3b>
+		}
+
+		// 处理 % 转义序列
+		// padc 初始化为空格符，padc='-'代表字符串左对齐，右边补空格，padc=' '代表右对齐，左边补空格，padc='0'右对齐，左边补0
+		padc = ' ';
+  8006e9:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+		width = -1;
+  8006ed:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+		// 默认-1代表显示长度为字符串本来的长度
+		precision = -1;
+  8006f4:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+		lflag = 0;
+  8006fb:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+		altflag = 0;
+  800702:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *)fmt++)
+  800709:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80070d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800711:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800715:	0f b6 00             	movzbl (%rax),%eax
+  800718:	0f b6 d8             	movzbl %al,%ebx
+  80071b:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  80071e:	83 f8 55             	cmp    $0x55,%eax
+  800721:	0f 87 22 04 00 00    	ja     800b49 <vprintfmt+0x4c9>
+  800727:	89 c0                	mov    %eax,%eax
+  800729:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800730:	00 
+  800731:	48 b8 b8 26 80 00 00 	movabs $0x8026b8,%rax
+  800738:	00 00 00 
+  80073b:	48 01 d0             	add    %rdx,%rax
+  80073e:	48 8b 00             	mov    (%rax),%rax
+  800741:	ff e0                	jmp    *%rax
+		{
+
+		// flag to pad on the right
+		case '-':
+			padc = '-';
+  800743:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+			goto reswitch;
+  800747:	eb c0                	jmp    800709 <vprintfmt+0x89>
+
+		// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800749:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+			goto reswitch;
+  80074d:	eb ba                	jmp    800709 <vprintfmt+0x89>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0;; ++fmt)
+  80074f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+			{
+				precision = precision * 10 + ch - '0';
+  800756:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800759:	89 d0                	mov    %edx,%eax
+  80075b:	c1 e0 02             	shl    $0x2,%eax
+  80075e:	01 d0                	add    %edx,%eax
+  800760:	01 c0                	add    %eax,%eax
+  800762:	01 d8                	add    %ebx,%eax
+  800764:	83 e8 30             	sub    $0x30,%eax
+  800767:	89 45 d8             	mov    %eax,-0x28(%rbp)
+				ch = *fmt;
+  80076a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80076e:	0f b6 00             	movzbl (%rax),%eax
+  800771:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800774:	83 fb 2f             	cmp    $0x2f,%ebx
+  800777:	7e 60                	jle    8007d9 <vprintfmt+0x159>
+  800779:	83 fb 39             	cmp    $0x39,%ebx
+  80077c:	7f 5b                	jg     8007d9 <vprintfmt+0x159>
+			for (precision = 0;; ++fmt)
+  80077e:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+				precision = precision * 10 + ch - '0';
+  800783:	eb d1                	jmp    800756 <vprintfmt+0xd6>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800785:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800788:	83 f8 2f             	cmp    $0x2f,%eax
+  80078b:	77 17                	ja     8007a4 <vprintfmt+0x124>
+  80078d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800791:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800794:	89 d2                	mov    %edx,%edx
+  800796:	48 01 d0             	add    %rdx,%rax
+  800799:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80079c:	83 c2 08             	add    $0x8,%edx
+  80079f:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8007a2:	eb 0c                	jmp    8007b0 <vprintfmt+0x130>
+  8007a4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8007a8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8007ac:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8007b0:	8b 00                	mov    (%rax),%eax
+  8007b2:	89 45 d8             	mov    %eax,-0x28(%rbp)
+			goto process_precision;
+  8007b5:	eb 23                	jmp    8007da <vprintfmt+0x15a>
+
+		case '.':
+			if (width < 0)
+  8007b7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8007bb:	0f 89 48 ff ff ff    	jns    800709 <vprintfmt+0x89>
+				width = 0;
+  8007c1:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+			goto reswitch;
+  8007c8:	e9 3c ff ff ff       	jmp    800709 <vprintfmt+0x89>
+
+		case '#':
+			altflag = 1;
+  8007cd:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+			goto reswitch;
+  8007d4:	e9 30 ff ff ff       	jmp    800709 <vprintfmt+0x89>
+			goto process_precision;
+  8007d9:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  8007da:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8007de:	0f 89 25 ff ff ff    	jns    800709 <vprintfmt+0x89>
+				width = precision, precision = -1;
+  8007e4:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8007e7:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8007ea:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+			goto reswitch;
+  8007f1:	e9 13 ff ff ff       	jmp    800709 <vprintfmt+0x89>
+
+		// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  8007f6:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+			goto reswitch;
+  8007fa:	e9 0a ff ff ff       	jmp    800709 <vprintfmt+0x89>
+
+		// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  8007ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800802:	83 f8 2f             	cmp    $0x2f,%eax
+  800805:	77 17                	ja     80081e <vprintfmt+0x19e>
+  800807:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80080b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80080e:	89 d2                	mov    %edx,%edx
+  800810:	48 01 d0             	add    %rdx,%rax
+  800813:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800816:	83 c2 08             	add    $0x8,%edx
+  800819:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80081c:	eb 0c                	jmp    80082a <vprintfmt+0x1aa>
+  80081e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800822:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800826:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80082a:	8b 00                	mov    (%rax),%eax
+  80082c:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800830:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800834:	48 89 d6             	mov    %rdx,%rsi
+  800837:	89 c7                	mov    %eax,%edi
+  800839:	ff d1                	call   *%rcx
+			break;
+  80083b:	e9 37 03 00 00       	jmp    800b77 <vprintfmt+0x4f7>
+
+		// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800840:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800843:	83 f8 2f             	cmp    $0x2f,%eax
+  800846:	77 17                	ja     80085f <vprintfmt+0x1df>
+  800848:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80084c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80084f:	89 d2                	mov    %edx,%edx
+  800851:	48 01 d0             	add    %rdx,%rax
+  800854:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800857:	83 c2 08             	add    $0x8,%edx
+  80085a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80085d:	eb 0c                	jmp    80086b <vprintfmt+0x1eb>
+  80085f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800863:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800867:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80086b:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  80086d:	85 db                	test   %ebx,%ebx
+  80086f:	79 02                	jns    800873 <vprintfmt+0x1f3>
+				err = -err;
+  800871:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800873:	83 fb 11             	cmp    $0x11,%ebx
+  800876:	7f 16                	jg     80088e <vprintfmt+0x20e>
+  800878:	48 ba 00 26 80 00 00 	movabs $0x802600,%rdx
+  80087f:	00 00 00 
+  800882:	48 63 c3             	movslq %ebx,%rax
+  800885:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800889:	4d 85 e4             	test   %r12,%r12
+  80088c:	75 2e                	jne    8008bc <vprintfmt+0x23c>
+				printfmt(putch, putdat, "error %d", err);
+  80088e:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800892:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800896:	89 d9                	mov    %ebx,%ecx
+  800898:	48 ba a1 26 80 00 00 	movabs $0x8026a1,%rdx
+  80089f:	00 00 00 
+  8008a2:	48 89 c7             	mov    %rax,%rdi
+  8008a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008aa:	49 b8 86 0b 80 00 00 	movabs $0x800b86,%r8
+  8008b1:	00 00 00 
+  8008b4:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  8008b7:	e9 bb 02 00 00       	jmp    800b77 <vprintfmt+0x4f7>
+				printfmt(putch, putdat, "%s", p);
+  8008bc:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8008c0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8008c4:	4c 89 e1             	mov    %r12,%rcx
+  8008c7:	48 ba aa 26 80 00 00 	movabs $0x8026aa,%rdx
+  8008ce:	00 00 00 
+  8008d1:	48 89 c7             	mov    %rax,%rdi
+  8008d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d9:	49 b8 86 0b 80 00 00 	movabs $0x800b86,%r8
+  8008e0:	00 00 00 
+  8008e3:	41 ff d0             	call   *%r8
+			break;
+  8008e6:	e9 8c 02 00 00       	jmp    800b77 <vprintfmt+0x4f7>
+
+		// string
+		case 's':
+			// 从可变参数中读入字符串指针
+			if ((p = va_arg(aq, char *)) == NULL)
+  8008eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ee:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f1:	77 17                	ja     80090a <vprintfmt+0x28a>
+  8008f3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8008f7:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008fa:	89 d2                	mov    %edx,%edx
+  8008fc:	48 01 d0             	add    %rdx,%rax
+  8008ff:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800902:	83 c2 08             	add    $0x8,%edx
+  800905:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800908:	eb 0c                	jmp    800916 <vprintfmt+0x296>
+  80090a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80090e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800912:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800916:	4c 8b 20             	mov    (%rax),%r12
+  800919:	4d 85 e4             	test   %r12,%r12
+  80091c:	75 0a                	jne    800928 <vprintfmt+0x2a8>
+				p = "(null)"; // 当字符串为空时，将它指向"(null)"字符串
+  80091e:	49 bc ad 26 80 00 00 	movabs $0x8026ad,%r12
+  800925:	00 00 00 
+			// 判断左对齐还是右对齐，pad='-'左对齐，否则右对齐
+			if (width > 0 && padc != '-')
+  800928:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80092c:	7e 78                	jle    8009a6 <vprintfmt+0x326>
+  80092e:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800932:	74 72                	je     8009a6 <vprintfmt+0x326>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800934:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800937:	48 98                	cltq
+  800939:	48 89 c6             	mov    %rax,%rsi
+  80093c:	4c 89 e7             	mov    %r12,%rdi
+  80093f:	48 b8 2b 0f 80 00 00 	movabs $0x800f2b,%rax
+  800946:	00 00 00 
+  800949:	ff d0                	call   *%rax
+  80094b:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  80094e:	eb 17                	jmp    800967 <vprintfmt+0x2e7>
+					putch(padc, putdat); // 字符串右对齐，左边补相应数量(width-实际长度)的空格或者 0
+  800950:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800954:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800958:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80095c:	48 89 d6             	mov    %rdx,%rsi
+  80095f:	89 c7                	mov    %eax,%edi
+  800961:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800963:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800967:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80096b:	7f e3                	jg     800950 <vprintfmt+0x2d0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80096d:	eb 37                	jmp    8009a6 <vprintfmt+0x326>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80096f:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800973:	74 1e                	je     800993 <vprintfmt+0x313>
+  800975:	83 fb 1f             	cmp    $0x1f,%ebx
+  800978:	7e 05                	jle    80097f <vprintfmt+0x2ff>
+  80097a:	83 fb 7e             	cmp    $0x7e,%ebx
+  80097d:	7e 14                	jle    800993 <vprintfmt+0x313>
+					putch('?', putdat);
+  80097f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800983:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800987:	48 89 c6             	mov    %rax,%rsi
+  80098a:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80098f:	ff d2                	call   *%rdx
+  800991:	eb 0f                	jmp    8009a2 <vprintfmt+0x322>
+				else
+					putch(ch, putdat); // 打印相应长度的字符串
+  800993:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800997:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80099b:	48 89 c6             	mov    %rax,%rsi
+  80099e:	89 df                	mov    %ebx,%edi
+  8009a0:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8009a2:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8009a6:	4c 89 e0             	mov    %r12,%rax
+  8009a9:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009ad:	0f b6 00             	movzbl (%rax),%eax
+  8009b0:	0f be d8             	movsbl %al,%ebx
+  8009b3:	85 db                	test   %ebx,%ebx
+  8009b5:	74 28                	je     8009df <vprintfmt+0x35f>
+  8009b7:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8009bb:	78 b2                	js     80096f <vprintfmt+0x2ef>
+  8009bd:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8009c1:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8009c5:	79 a8                	jns    80096f <vprintfmt+0x2ef>
+			for (; width > 0; width--)
+  8009c7:	eb 16                	jmp    8009df <vprintfmt+0x35f>
+				putch(' ', putdat); // 当字符串是左对齐的时候打印相应数量的空格
+  8009c9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009cd:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009d1:	48 89 c6             	mov    %rax,%rsi
+  8009d4:	bf 20 00 00 00       	mov    $0x20,%edi
+  8009d9:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  8009db:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8009df:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8009e3:	7f e4                	jg     8009c9 <vprintfmt+0x349>
+			break;
+  8009e5:	e9 8d 01 00 00       	jmp    800b77 <vprintfmt+0x4f7>
+
+		// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  8009ea:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8009ee:	be 03 00 00 00       	mov    $0x3,%esi
+  8009f3:	48 89 c7             	mov    %rax,%rdi
+  8009f6:	48 b8 79 05 80 00 00 	movabs $0x800579,%rax
+  8009fd:	00 00 00 
+  800a00:	ff d0                	call   *%rax
+  800a02:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((long long)num < 0)
+  800a06:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a0a:	48 85 c0             	test   %rax,%rax
+  800a0d:	79 1d                	jns    800a2c <vprintfmt+0x3ac>
+			{
+				putch('-', putdat);
+  800a0f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a13:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a17:	48 89 c6             	mov    %rax,%rsi
+  800a1a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a1f:	ff d2                	call   *%rdx
+				num = -(long long)num;
+  800a21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a25:	48 f7 d8             	neg    %rax
+  800a28:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			}
+			base = 10;
+  800a2c:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800a33:	e9 d2 00 00 00       	jmp    800b0a <vprintfmt+0x48a>
+
+		// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800a38:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a3c:	be 03 00 00 00       	mov    $0x3,%esi
+  800a41:	48 89 c7             	mov    %rax,%rdi
+  800a44:	48 b8 72 04 80 00 00 	movabs $0x800472,%rax
+  800a4b:	00 00 00 
+  800a4e:	ff d0                	call   *%rax
+  800a50:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 10;
+  800a54:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800a5b:	e9 aa 00 00 00       	jmp    800b0a <vprintfmt+0x48a>
+		// (unsigned) octal
+		case 'o':
+			// Gets the variable argument with type integer from the point which was processed last by va_arg
+			// calls getuint which returns a long long value, which then calls printnum which prints based on
+			// base value.
+			num = getuint(&aq, 3);
+  800a60:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a64:	be 03 00 00 00       	mov    $0x3,%esi
+  800a69:	48 89 c7             	mov    %rax,%rdi
+  800a6c:	48 b8 72 04 80 00 00 	movabs $0x800472,%rax
+  800a73:	00 00 00 
+  800a76:	ff d0                	call   *%rax
+  800a78:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 8;
+  800a7c:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+			goto number;
+  800a83:	e9 82 00 00 00       	jmp    800b0a <vprintfmt+0x48a>
+
+		// pointer
+		case 'p':
+			putch('0', putdat);
+  800a88:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a8c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a90:	48 89 c6             	mov    %rax,%rsi
+  800a93:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a98:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800a9a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a9e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800aa2:	48 89 c6             	mov    %rax,%rsi
+  800aa5:	bf 78 00 00 00       	mov    $0x78,%edi
+  800aaa:	ff d2                	call   *%rdx
+			num = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800aac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aaf:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab2:	77 17                	ja     800acb <vprintfmt+0x44b>
+  800ab4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ab8:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800abb:	89 d2                	mov    %edx,%edx
+  800abd:	48 01 d0             	add    %rdx,%rax
+  800ac0:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ac3:	83 c2 08             	add    $0x8,%edx
+  800ac6:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800ac9:	eb 0c                	jmp    800ad7 <vprintfmt+0x457>
+  800acb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800acf:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ad3:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800ad7:	48 8b 00             	mov    (%rax),%rax
+  800ada:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800ade:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+			goto number;
+  800ae5:	eb 23                	jmp    800b0a <vprintfmt+0x48a>
+
+		// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800ae7:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800aeb:	be 03 00 00 00       	mov    $0x3,%esi
+  800af0:	48 89 c7             	mov    %rax,%rdi
+  800af3:	48 b8 72 04 80 00 00 	movabs $0x800472,%rax
+  800afa:	00 00 00 
+  800afd:	ff d0                	call   *%rax
+  800aff:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800b03:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800b0a:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800b0f:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800b12:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800b15:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b19:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800b1d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b21:	45 89 c1             	mov    %r8d,%r9d
+  800b24:	41 89 f8             	mov    %edi,%r8d
+  800b27:	48 89 c7             	mov    %rax,%rdi
+  800b2a:	48 b8 ba 03 80 00 00 	movabs $0x8003ba,%rax
+  800b31:	00 00 00 
+  800b34:	ff d0                	call   *%rax
+			break;
+  800b36:	eb 3f                	jmp    800b77 <vprintfmt+0x4f7>
+
+		// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800b38:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b3c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b40:	48 89 c6             	mov    %rax,%rsi
+  800b43:	89 df                	mov    %ebx,%edi
+  800b45:	ff d2                	call   *%rdx
+			break;
+  800b47:	eb 2e                	jmp    800b77 <vprintfmt+0x4f7>
+
+		// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800b49:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b4d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b51:	48 89 c6             	mov    %rax,%rsi
+  800b54:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b59:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b5b:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800b60:	eb 05                	jmp    800b67 <vprintfmt+0x4e7>
+  800b62:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800b67:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800b6b:	48 83 e8 01          	sub    $0x1,%rax
+  800b6f:	0f b6 00             	movzbl (%rax),%eax
+  800b72:	3c 25                	cmp    $0x25,%al
+  800b74:	75 ec                	jne    800b62 <vprintfmt+0x4e2>
+				/* do nothing */;
+			break;
+  800b76:	90                   	nop
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800b77:	e9 56 fb ff ff       	jmp    8006d2 <vprintfmt+0x52>
+				return;
+  800b7c:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800b7d:	48 83 c4 60          	add    $0x60,%rsp
+  800b81:	5b                   	pop    %rbx
+  800b82:	41 5c                	pop    %r12
+  800b84:	5d                   	pop    %rbp
+  800b85:	c3                   	ret
+
+0000000000800b86 <printfmt>:
+
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...)
+{
+  800b86:	55                   	push   %rbp
+  800b87:	48 89 e5             	mov    %rsp,%rbp
+  800b8a:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800b91:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800b98:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800b9f:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800ba6:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800bad:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800bb4:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800bbb:	84 c0                	test   %al,%al
+  800bbd:	74 20                	je     800bdf <printfmt+0x59>
+  800bbf:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800bc3:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800bc7:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800bcb:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800bcf:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800bd3:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800bd7:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800bdb:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800bdf:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800be6:	00 00 00 
+  800be9:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800bf0:	00 00 00 
+  800bf3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bf7:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800bfe:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800c05:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800c0c:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800c13:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800c1a:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800c21:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800c28:	48 89 c7             	mov    %rax,%rdi
+  800c2b:	48 b8 80 06 80 00 00 	movabs $0x800680,%rax
+  800c32:	00 00 00 
+  800c35:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  800c37:	90                   	nop
+  800c38:	c9                   	leave
+  800c39:	c3                   	ret
+
+0000000000800c3a <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800c3a:	55                   	push   %rbp
+  800c3b:	48 89 e5             	mov    %rsp,%rbp
+  800c3e:	48 83 ec 10          	sub    $0x10,%rsp
+  800c42:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800c45:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  800c49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c4d:	8b 40 10             	mov    0x10(%rax),%eax
+  800c50:	8d 50 01             	lea    0x1(%rax),%edx
+  800c53:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c57:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  800c5a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c5e:	48 8b 10             	mov    (%rax),%rdx
+  800c61:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c65:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c69:	48 39 c2             	cmp    %rax,%rdx
+  800c6c:	73 17                	jae    800c85 <sprintputch+0x4b>
+		*b->buf++ = ch;
+  800c6e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c72:	48 8b 00             	mov    (%rax),%rax
+  800c75:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800c79:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800c7d:	48 89 0a             	mov    %rcx,(%rdx)
+  800c80:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800c83:	88 10                	mov    %dl,(%rax)
+}
+  800c85:	90                   	nop
+  800c86:	c9                   	leave
+  800c87:	c3                   	ret
+
+0000000000800c88 <vsnprintf>:
+
+int vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800c88:	55                   	push   %rbp
+  800c89:	48 89 e5             	mov    %rsp,%rbp
+  800c8c:	48 83 ec 50          	sub    $0x50,%rsp
+  800c90:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  800c94:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  800c97:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  800c9b:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+	va_list aq;
+	va_copy(aq, ap);
+  800c9f:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800ca3:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800ca7:	48 8b 06             	mov    (%rsi),%rax
+  800caa:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800cae:	48 89 01             	mov    %rax,(%rcx)
+  800cb1:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cb5:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800cb9:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	struct sprintbuf b = {buf, buf + n - 1, 0};
+  800cbd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800cc1:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800cc5:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  800cc8:	48 98                	cltq
+  800cca:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800cce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800cd2:	48 01 d0             	add    %rdx,%rax
+  800cd5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  800cd9:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+
+	if (buf == NULL || n < 1)
+  800ce0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800ce5:	74 06                	je     800ced <vsnprintf+0x65>
+  800ce7:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800ceb:	7f 07                	jg     800cf4 <vsnprintf+0x6c>
+		return -E_INVAL;
+  800ced:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cf2:	eb 32                	jmp    800d26 <vsnprintf+0x9e>
+
+	// print the string to the buffer
+	vprintfmt((void *)sprintputch, &b, fmt, aq);
+  800cf4:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800cf8:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  800cfc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d00:	48 89 c6             	mov    %rax,%rsi
+  800d03:	48 b8 3a 0c 80 00 00 	movabs $0x800c3a,%rax
+  800d0a:	00 00 00 
+  800d0d:	48 89 c7             	mov    %rax,%rdi
+  800d10:	48 b8 80 06 80 00 00 	movabs $0x800680,%rax
+  800d17:	00 00 00 
+  800d1a:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  800d1c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d20:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800d23:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  800d26:	c9                   	leave
+  800d27:	c3                   	ret
+
+0000000000800d28 <snprintf>:
+
+int snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800d28:	55                   	push   %rbp
+  800d29:	48 89 e5             	mov    %rsp,%rbp
+  800d2c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800d33:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800d3a:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800d40:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800d47:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800d4e:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800d55:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800d5c:	84 c0                	test   %al,%al
+  800d5e:	74 20                	je     800d80 <snprintf+0x58>
+  800d60:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800d64:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800d68:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800d6c:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800d70:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800d74:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800d78:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800d7c:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  800d80:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800d87:	00 00 00 
+  800d8a:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800d91:	00 00 00 
+  800d94:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d98:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800d9f:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800da6:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq, ap);
+  800dad:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800db4:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800dbb:	48 8b 06             	mov    (%rsi),%rax
+  800dbe:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800dc2:	48 89 01             	mov    %rax,(%rcx)
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800dcd:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  800dd1:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800dd8:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  800ddf:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  800de5:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800dec:	48 89 c7             	mov    %rax,%rdi
+  800def:	48 b8 88 0c 80 00 00 	movabs $0x800c88,%rax
+  800df6:	00 00 00 
+  800df9:	ff d0                	call   *%rax
+  800dfb:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  800e01:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800e07:	c9                   	leave
+  800e08:	c3                   	ret
+
+0000000000800e09 <cpuid>:
+#define read_rip(var) __asm __volatile("leaq (%%rip), %0" : "=r" (var)::"cc","memory")
+
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800e09:	55                   	push   %rbp
+  800e0a:	48 89 e5             	mov    %rsp,%rbp
+  800e0d:	53                   	push   %rbx
+  800e0e:	48 83 ec 38          	sub    $0x38,%rsp
+  800e12:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800e15:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800e19:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800e1d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800e21:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid" 
+  800e25:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800e28:	0f a2                	cpuid
+  800e2a:	89 de                	mov    %ebx,%esi
+  800e2c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800e2f:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800e32:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800e35:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info));
+	if (eaxp)
+  800e38:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800e3d:	74 09                	je     800e48 <cpuid+0x3f>
+		*eaxp = eax;
+  800e3f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800e43:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800e46:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  800e48:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800e4d:	74 09                	je     800e58 <cpuid+0x4f>
+		*ebxp = ebx;
+  800e4f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e53:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800e56:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  800e58:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800e5d:	74 09                	je     800e68 <cpuid+0x5f>
+		*ecxp = ecx;
+  800e5f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e63:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800e66:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  800e68:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800e6d:	74 09                	je     800e78 <cpuid+0x6f>
+		*edxp = edx;
+  800e6f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800e73:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800e76:	89 10                	mov    %edx,(%rax)
+}
+  800e78:	90                   	nop
+  800e79:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800e7d:	c9                   	leave
+  800e7e:	c3                   	ret
+
+0000000000800e7f <cpuid_count>:
+
+// 带子功能号(%ecx = count)的 cpuid，用于 leaf 4/7/0xB/0xD 等
+static __inline void
+cpuid_count(uint32_t info, uint32_t count, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800e7f:	55                   	push   %rbp
+  800e80:	48 89 e5             	mov    %rsp,%rbp
+  800e83:	53                   	push   %rbx
+  800e84:	48 83 ec 38          	sub    $0x38,%rsp
+  800e88:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800e8b:	89 75 e0             	mov    %esi,-0x20(%rbp)
+  800e8e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800e92:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  800e96:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+  800e9a:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800e9e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800ea1:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800ea4:	89 d1                	mov    %edx,%ecx
+  800ea6:	0f a2                	cpuid
+  800ea8:	89 de                	mov    %ebx,%esi
+  800eaa:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800ead:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800eb0:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800eb3:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info), "c" (count));
+	if (eaxp)
+  800eb6:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800ebb:	74 09                	je     800ec6 <cpuid_count+0x47>
+		*eaxp = eax;
+  800ebd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ec1:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800ec4:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  800ec6:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800ecb:	74 09                	je     800ed6 <cpuid_count+0x57>
+		*ebxp = ebx;
+  800ecd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ed1:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800ed4:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  800ed6:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800edb:	74 09                	je     800ee6 <cpuid_count+0x67>
+		*ecxp = ecx;
+  800edd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ee1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800ee4:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  800ee6:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800eeb:	74 09                	je     800ef6 <cpuid_count+0x77>
+		*edxp = edx;
+  800eed:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800ef1:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800ef4:	89 10                	mov    %edx,(%rax)
+}
+  800ef6:	90                   	nop
+  800ef7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800efb:	c9                   	leave
+  800efc:	c3                   	ret
+
+0000000000800efd <strlen>:
+// 在真正的硬件上会有一定程度的优化, 但在 Bochs 上会有更大的优化效果
+// 用这种方法, Primespipe 的运行速度快了3倍
+#define ASM 1
+
+int strlen(const char *s)
+{
+  800efd:	55                   	push   %rbp
+  800efe:	48 89 e5             	mov    %rsp,%rbp
+  800f01:	48 83 ec 18          	sub    $0x18,%rsp
+  800f05:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800f09:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800f10:	eb 09                	jmp    800f1b <strlen+0x1e>
+		n++;
+  800f12:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  800f16:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800f1b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f1f:	0f b6 00             	movzbl (%rax),%eax
+  800f22:	84 c0                	test   %al,%al
+  800f24:	75 ec                	jne    800f12 <strlen+0x15>
+	return n;
+  800f26:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800f29:	c9                   	leave
+  800f2a:	c3                   	ret
+
+0000000000800f2b <strnlen>:
+
+int strnlen(const char *s, size_t size)
+{
+  800f2b:	55                   	push   %rbp
+  800f2c:	48 89 e5             	mov    %rsp,%rbp
+  800f2f:	48 83 ec 20          	sub    $0x20,%rsp
+  800f33:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800f37:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f3b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800f42:	eb 0e                	jmp    800f52 <strnlen+0x27>
+		n++;
+  800f44:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f48:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800f4d:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  800f52:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800f57:	74 0b                	je     800f64 <strnlen+0x39>
+  800f59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f5d:	0f b6 00             	movzbl (%rax),%eax
+  800f60:	84 c0                	test   %al,%al
+  800f62:	75 e0                	jne    800f44 <strnlen+0x19>
+	return n;
+  800f64:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800f67:	c9                   	leave
+  800f68:	c3                   	ret
+
+0000000000800f69 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800f69:	55                   	push   %rbp
+  800f6a:	48 89 e5             	mov    %rsp,%rbp
+  800f6d:	48 83 ec 20          	sub    $0x20,%rsp
+  800f71:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800f75:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  800f79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f7d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  800f81:	90                   	nop
+  800f82:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f86:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  800f8a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800f8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f92:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800f96:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f9a:	0f b6 12             	movzbl (%rdx),%edx
+  800f9d:	88 10                	mov    %dl,(%rax)
+  800f9f:	0f b6 00             	movzbl (%rax),%eax
+  800fa2:	84 c0                	test   %al,%al
+  800fa4:	75 dc                	jne    800f82 <strcpy+0x19>
+		/* do nothing */;
+	return ret;
+  800fa6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800faa:	c9                   	leave
+  800fab:	c3                   	ret
+
+0000000000800fac <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800fac:	55                   	push   %rbp
+  800fad:	48 89 e5             	mov    %rsp,%rbp
+  800fb0:	48 83 ec 20          	sub    $0x20,%rsp
+  800fb4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800fb8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int len = strlen(dst);
+  800fbc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fc0:	48 89 c7             	mov    %rax,%rdi
+  800fc3:	48 b8 fd 0e 80 00 00 	movabs $0x800efd,%rax
+  800fca:	00 00 00 
+  800fcd:	ff d0                	call   *%rax
+  800fcf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	strcpy(dst + len, src);
+  800fd2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800fd5:	48 63 d0             	movslq %eax,%rdx
+  800fd8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fdc:	48 01 c2             	add    %rax,%rdx
+  800fdf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800fe3:	48 89 c6             	mov    %rax,%rsi
+  800fe6:	48 89 d7             	mov    %rdx,%rdi
+  800fe9:	48 b8 69 0f 80 00 00 	movabs $0x800f69,%rax
+  800ff0:	00 00 00 
+  800ff3:	ff d0                	call   *%rax
+	return dst;
+  800ff5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  800ff9:	c9                   	leave
+  800ffa:	c3                   	ret
+
+0000000000800ffb <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800ffb:	55                   	push   %rbp
+  800ffc:	48 89 e5             	mov    %rsp,%rbp
+  800fff:	48 83 ec 28          	sub    $0x28,%rsp
+  801003:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801007:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80100b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  80100f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801013:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++)
+  801017:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80101e:	00 
+  80101f:	eb 2a                	jmp    80104b <strncpy+0x50>
+	{
+		*dst++ = *src;
+  801021:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801025:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801029:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80102d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801031:	0f b6 12             	movzbl (%rdx),%edx
+  801034:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801036:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80103a:	0f b6 00             	movzbl (%rax),%eax
+  80103d:	84 c0                	test   %al,%al
+  80103f:	74 05                	je     801046 <strncpy+0x4b>
+			src++;
+  801041:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++)
+  801046:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80104b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80104f:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801053:	72 cc                	jb     801021 <strncpy+0x26>
+	}
+	return ret;
+  801055:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801059:	c9                   	leave
+  80105a:	c3                   	ret
+
+000000000080105b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80105b:	55                   	push   %rbp
+  80105c:	48 89 e5             	mov    %rsp,%rbp
+  80105f:	48 83 ec 28          	sub    $0x28,%rsp
+  801063:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801067:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80106b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  80106f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801073:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0)
+  801077:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80107c:	74 3d                	je     8010bb <strlcpy+0x60>
+	{
+		while (--size > 0 && *src != '\0')
+  80107e:	eb 1d                	jmp    80109d <strlcpy+0x42>
+			*dst++ = *src++;
+  801080:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801084:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801088:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80108c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801090:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801094:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801098:	0f b6 12             	movzbl (%rdx),%edx
+  80109b:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  80109d:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8010a2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8010a7:	74 0b                	je     8010b4 <strlcpy+0x59>
+  8010a9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8010ad:	0f b6 00             	movzbl (%rax),%eax
+  8010b0:	84 c0                	test   %al,%al
+  8010b2:	75 cc                	jne    801080 <strlcpy+0x25>
+		*dst = '\0';
+  8010b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010b8:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8010bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010bf:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8010c3:	c9                   	leave
+  8010c4:	c3                   	ret
+
+00000000008010c5 <strcmp>:
+
+int strcmp(const char *p, const char *q)
+{
+  8010c5:	55                   	push   %rbp
+  8010c6:	48 89 e5             	mov    %rsp,%rbp
+  8010c9:	48 83 ec 10          	sub    $0x10,%rsp
+  8010cd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8010d1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8010d5:	eb 0a                	jmp    8010e1 <strcmp+0x1c>
+		p++, q++;
+  8010d7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8010dc:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8010e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010e5:	0f b6 00             	movzbl (%rax),%eax
+  8010e8:	84 c0                	test   %al,%al
+  8010ea:	74 12                	je     8010fe <strcmp+0x39>
+  8010ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010f0:	0f b6 10             	movzbl (%rax),%edx
+  8010f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8010f7:	0f b6 00             	movzbl (%rax),%eax
+  8010fa:	38 c2                	cmp    %al,%dl
+  8010fc:	74 d9                	je     8010d7 <strcmp+0x12>
+	return (int)((unsigned char)*p - (unsigned char)*q);
+  8010fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801102:	0f b6 00             	movzbl (%rax),%eax
+  801105:	0f b6 d0             	movzbl %al,%edx
+  801108:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80110c:	0f b6 00             	movzbl (%rax),%eax
+  80110f:	0f b6 c0             	movzbl %al,%eax
+  801112:	29 c2                	sub    %eax,%edx
+  801114:	89 d0                	mov    %edx,%eax
+}
+  801116:	c9                   	leave
+  801117:	c3                   	ret
+
+0000000000801118 <strncmp>:
+
+int strncmp(const char *p, const char *q, size_t n)
+{
+  801118:	55                   	push   %rbp
+  801119:	48 89 e5             	mov    %rsp,%rbp
+  80111c:	48 83 ec 18          	sub    $0x18,%rsp
+  801120:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801124:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801128:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80112c:	eb 0f                	jmp    80113d <strncmp+0x25>
+		n--, p++, q++;
+  80112e:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801133:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801138:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80113d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801142:	74 1d                	je     801161 <strncmp+0x49>
+  801144:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801148:	0f b6 00             	movzbl (%rax),%eax
+  80114b:	84 c0                	test   %al,%al
+  80114d:	74 12                	je     801161 <strncmp+0x49>
+  80114f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801153:	0f b6 10             	movzbl (%rax),%edx
+  801156:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80115a:	0f b6 00             	movzbl (%rax),%eax
+  80115d:	38 c2                	cmp    %al,%dl
+  80115f:	74 cd                	je     80112e <strncmp+0x16>
+	if (n == 0)
+  801161:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801166:	75 07                	jne    80116f <strncmp+0x57>
+		return 0;
+  801168:	ba 00 00 00 00       	mov    $0x0,%edx
+  80116d:	eb 16                	jmp    801185 <strncmp+0x6d>
+	else
+		return (int)((unsigned char)*p - (unsigned char)*q);
+  80116f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801173:	0f b6 00             	movzbl (%rax),%eax
+  801176:	0f b6 d0             	movzbl %al,%edx
+  801179:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80117d:	0f b6 00             	movzbl (%rax),%eax
+  801180:	0f b6 c0             	movzbl %al,%eax
+  801183:	29 c2                	sub    %eax,%edx
+}
+  801185:	89 d0                	mov    %edx,%eax
+  801187:	c9                   	leave
+  801188:	c3                   	ret
+
+0000000000801189 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801189:	55                   	push   %rbp
+  80118a:	48 89 e5             	mov    %rsp,%rbp
+  80118d:	48 83 ec 10          	sub    $0x10,%rsp
+  801191:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801195:	89 f0                	mov    %esi,%eax
+  801197:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80119a:	eb 17                	jmp    8011b3 <strchr+0x2a>
+		if (*s == c)
+  80119c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011a0:	0f b6 00             	movzbl (%rax),%eax
+  8011a3:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8011a6:	75 06                	jne    8011ae <strchr+0x25>
+			return (char *)s;
+  8011a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011ac:	eb 15                	jmp    8011c3 <strchr+0x3a>
+	for (; *s; s++)
+  8011ae:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8011b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011b7:	0f b6 00             	movzbl (%rax),%eax
+  8011ba:	84 c0                	test   %al,%al
+  8011bc:	75 de                	jne    80119c <strchr+0x13>
+	return 0;
+  8011be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011c3:	c9                   	leave
+  8011c4:	c3                   	ret
+
+00000000008011c5 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8011c5:	55                   	push   %rbp
+  8011c6:	48 89 e5             	mov    %rsp,%rbp
+  8011c9:	48 83 ec 10          	sub    $0x10,%rsp
+  8011cd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8011d1:	89 f0                	mov    %esi,%eax
+  8011d3:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8011d6:	eb 11                	jmp    8011e9 <strfind+0x24>
+		if (*s == c)
+  8011d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011dc:	0f b6 00             	movzbl (%rax),%eax
+  8011df:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8011e2:	74 12                	je     8011f6 <strfind+0x31>
+	for (; *s; s++)
+  8011e4:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8011e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011ed:	0f b6 00             	movzbl (%rax),%eax
+  8011f0:	84 c0                	test   %al,%al
+  8011f2:	75 e4                	jne    8011d8 <strfind+0x13>
+  8011f4:	eb 01                	jmp    8011f7 <strfind+0x32>
+			break;
+  8011f6:	90                   	nop
+	return (char *)s;
+  8011f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8011fb:	c9                   	leave
+  8011fc:	c3                   	ret
+
+00000000008011fd <mem_init>:
+};
+
+static int mem_features;
+
+void mem_init(void)
+{
+  8011fd:	55                   	push   %rbp
+  8011fe:	48 89 e5             	mov    %rsp,%rbp
+  801201:	48 83 ec 10          	sub    $0x10,%rsp
+	uint32_t max, ebx, edx;
+
+	mem_features = 0;
+  801205:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  80120c:	00 00 00 
+  80120f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	cpuid(0, &max, NULL, NULL, NULL);
+  801215:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+  801219:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80121f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801224:	ba 00 00 00 00       	mov    $0x0,%edx
+  801229:	48 89 c6             	mov    %rax,%rsi
+  80122c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801231:	48 b8 09 0e 80 00 00 	movabs $0x800e09,%rax
+  801238:	00 00 00 
+  80123b:	ff d0                	call   *%rax
+	cpuid(1, NULL, NULL, NULL, &edx);
+  80123d:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  801241:	49 89 c0             	mov    %rax,%r8
+  801244:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801249:	ba 00 00 00 00       	mov    $0x0,%edx
+  80124e:	be 00 00 00 00       	mov    $0x0,%esi
+  801253:	bf 01 00 00 00       	mov    $0x1,%edi
+  801258:	48 b8 09 0e 80 00 00 	movabs $0x800e09,%rax
+  80125f:	00 00 00 
+  801262:	ff d0                	call   *%rax
+	if (edx & (1 << 26))
+  801264:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801267:	25 00 00 00 04       	and    $0x4000000,%eax
+  80126c:	85 c0                	test   %eax,%eax
+  80126e:	74 1d                	je     80128d <mem_init+0x90>
+		mem_features |= MEM_F_NT;
+  801270:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  801277:	00 00 00 
+  80127a:	8b 00                	mov    (%rax),%eax
+  80127c:	83 c8 02             	or     $0x2,%eax
+  80127f:	89 c2                	mov    %eax,%edx
+  801281:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  801288:	00 00 00 
+  80128b:	89 10                	mov    %edx,(%rax)
+	if (max >= 7)
+  80128d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801290:	83 f8 06             	cmp    $0x6,%eax
+  801293:	76 57                	jbe    8012ec <mem_init+0xef>
+	{
+		cpuid_count(7, 0, NULL, &ebx, NULL, NULL);
+  801295:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801299:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80129f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012a5:	48 89 c1             	mov    %rax,%rcx
+  8012a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b2:	bf 07 00 00 00       	mov    $0x7,%edi
+  8012b7:	48 b8 7f 0e 80 00 00 	movabs $0x800e7f,%rax
+  8012be:	00 00 00 
+  8012c1:	ff d0                	call   *%rax
+		if (ebx & (1 << 9))
+  8012c3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8012c6:	25 00 02 00 00       	and    $0x200,%eax
+  8012cb:	85 c0                	test   %eax,%eax
+  8012cd:	74 1d                	je     8012ec <mem_init+0xef>
+			mem_features |= MEM_F_ERMS;
+  8012cf:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8012d6:	00 00 00 
+  8012d9:	8b 00                	mov    (%rax),%eax
+  8012db:	83 c8 01             	or     $0x1,%eax
+  8012de:	89 c2                	mov    %eax,%edx
+  8012e0:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8012e7:	00 00 00 
+  8012ea:	89 10                	mov    %edx,(%rax)
+	}
+}
+  8012ec:	90                   	nop
+  8012ed:	c9                   	leave
+  8012ee:	c3                   	ret
+
+00000000008012ef <memset_nt>:
+
+// 非临时存储填充 n 字节(v 8 字节对齐，n 为 32 的倍数)
+static void
+memset_nt(void *v, uint64_t pattern, size_t n)
+{
+  8012ef:	55                   	push   %rbp
+  8012f0:	48 89 e5             	mov    %rsp,%rbp
+  8012f3:	48 83 ec 28          	sub    $0x28,%rsp
+  8012f7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012fb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8012ff:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t *p = (uint64_t *)v;
+  801303:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801307:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint64_t *end = p + n / 8;
+  80130b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80130f:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  801313:	48 89 c2             	mov    %rax,%rdx
+  801316:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80131a:	48 01 d0             	add    %rdx,%rax
+  80131d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	for (; p < end; p += 4)
+  801321:	eb 20                	jmp    801343 <memset_nt+0x54>
+		asm volatile("movnti %1, 0(%0)\n\t"
+  801323:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801327:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80132b:	48 0f c3 10          	movnti %rdx,(%rax)
+  80132f:	48 0f c3 50 08       	movnti %rdx,0x8(%rax)
+  801334:	48 0f c3 50 10       	movnti %rdx,0x10(%rax)
+  801339:	48 0f c3 50 18       	movnti %rdx,0x18(%rax)
+	for (; p < end; p += 4)
+  80133e:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  801343:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801347:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80134b:	72 d6                	jb     801323 <memset_nt+0x34>
+					 "movnti %1, 16(%0)\n\t"
+					 "movnti %1, 24(%0)"
+					 :
+					 : "r"(p), "r"(pattern)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  80134d:	0f ae f8             	sfence
+}
+  801350:	90                   	nop
+  801351:	c9                   	leave
+  801352:	c3                   	ret
+
+0000000000801353 <memcpy_nt>:
+
+// 非临时存储复制 n 字节(dst/src 8 字节对齐且不重叠，n 为 32 的倍数)
+static void
+memcpy_nt(void *dst, const void *src, size_t n)
+{
+  801353:	55                   	push   %rbp
+  801354:	48 89 e5             	mov    %rsp,%rbp
+  801357:	48 83 ec 58          	sub    $0x58,%rsp
+  80135b:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80135f:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801363:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	uint64_t *d = (uint64_t *)dst;
+  801367:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80136b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint64_t *s = (const uint64_t *)src;
+  80136f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801373:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	uint64_t *end = d + n / 8;
+  801377:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80137b:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  80137f:	48 89 c2             	mov    %rax,%rdx
+  801382:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801386:	48 01 d0             	add    %rdx,%rax
+  801389:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint64_t t0, t1, t2, t3;
+
+	for (; d < end; d += 4, s += 4)
+  80138d:	eb 44                	jmp    8013d3 <memcpy_nt+0x80>
+		asm volatile("movq 0(%4), %0\n\t"
+  80138f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801393:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801397:	4c 8b 00             	mov    (%rax),%r8
+  80139a:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  80139e:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  8013a2:	48 8b 48 18          	mov    0x18(%rax),%rcx
+  8013a6:	4c 0f c3 02          	movnti %r8,(%rdx)
+  8013aa:	48 0f c3 7a 08       	movnti %rdi,0x8(%rdx)
+  8013af:	48 0f c3 72 10       	movnti %rsi,0x10(%rdx)
+  8013b4:	48 0f c3 4a 18       	movnti %rcx,0x18(%rdx)
+  8013b9:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8013bd:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8013c1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8013c5:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+	for (; d < end; d += 4, s += 4)
+  8013c9:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  8013ce:	48 83 45 f0 20       	addq   $0x20,-0x10(%rbp)
+  8013d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013d7:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  8013db:	72 b2                	jb     80138f <memcpy_nt+0x3c>
+					 "movnti %2, 16(%5)\n\t"
+					 "movnti %3, 24(%5)"
+					 : "=&r"(t0), "=&r"(t1), "=&r"(t2), "=&r"(t3)
+					 : "r"(s), "r"(d)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  8013dd:	0f ae f8             	sfence
+}
+  8013e0:	90                   	nop
+  8013e1:	c9                   	leave
+  8013e2:	c3                   	ret
+
+00000000008013e3 <memcpy_fwd>:
+
+// 正向复制(dst 在 src 之前或两者不重叠)
+static void
+memcpy_fwd(void *dst, const void *src, size_t n)
+{
+  8013e3:	55                   	push   %rbp
+  8013e4:	48 89 e5             	mov    %rsp,%rbp
+  8013e7:	48 83 ec 18          	sub    $0x18,%rsp
+  8013eb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8013ef:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8013f3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  8013f7:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8013fe:	00 00 00 
+  801401:	8b 00                	mov    (%rax),%eax
+  801403:	83 e0 02             	and    $0x2,%eax
+  801406:	85 c0                	test   %eax,%eax
+  801408:	74 66                	je     801470 <memcpy_fwd+0x8d>
+  80140a:	48 81 7d e8 ff 0f 00 	cmpq   $0xfff,-0x18(%rbp)
+  801411:	00 
+  801412:	76 5c                	jbe    801470 <memcpy_fwd+0x8d>
+  801414:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801418:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80141c:	48 09 d0             	or     %rdx,%rax
+  80141f:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  801423:	83 e0 1f             	and    $0x1f,%eax
+  801426:	48 85 c0             	test   %rax,%rax
+  801429:	75 45                	jne    801470 <memcpy_fwd+0x8d>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  80142b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80142f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801433:	48 01 d0             	add    %rdx,%rax
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  801436:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80143a:	73 11                	jae    80144d <memcpy_fwd+0x6a>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  80143c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801440:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801444:	48 01 d0             	add    %rdx,%rax
+  801447:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80144b:	72 23                	jb     801470 <memcpy_fwd+0x8d>
+		memcpy_nt(dst, src, n);
+  80144d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801451:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801455:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801459:	48 89 ce             	mov    %rcx,%rsi
+  80145c:	48 89 c7             	mov    %rax,%rdi
+  80145f:	48 b8 53 13 80 00 00 	movabs $0x801353,%rax
+  801466:	00 00 00 
+  801469:	ff d0                	call   *%rax
+  80146b:	e9 81 00 00 00       	jmp    8014f1 <memcpy_fwd+0x10e>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  801470:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  801477:	00 00 00 
+  80147a:	8b 00                	mov    (%rax),%eax
+  80147c:	83 e0 01             	and    $0x1,%eax
+  80147f:	85 c0                	test   %eax,%eax
+  801481:	74 21                	je     8014a4 <memcpy_fwd+0xc1>
+  801483:	48 81 7d e8 ff 00 00 	cmpq   $0xff,-0x18(%rbp)
+  80148a:	00 
+  80148b:	76 17                	jbe    8014a4 <memcpy_fwd+0xc1>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  80148d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801491:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801495:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801499:	48 89 c7             	mov    %rax,%rdi
+  80149c:	48 89 d6             	mov    %rdx,%rsi
+  80149f:	fc                   	cld
+  8014a0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8014a2:	eb 4d                	jmp    8014f1 <memcpy_fwd+0x10e>
+					 : "cc", "memory");
+	else if ((((uint64_t)dst | (uint64_t)src | n) & 7) == 0)
+  8014a4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8014a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014ac:	48 09 d0             	or     %rdx,%rax
+  8014af:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  8014b3:	83 e0 07             	and    $0x7,%eax
+  8014b6:	48 85 c0             	test   %rax,%rax
+  8014b9:	75 1f                	jne    8014da <memcpy_fwd+0xf7>
+		asm volatile("cld; rep movsq\n" ::"D"(dst), "S"(src), "c"(n / 8)
+  8014bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014bf:	48 c1 e8 03          	shr    $0x3,%rax
+  8014c3:	48 89 c1             	mov    %rax,%rcx
+  8014c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014ca:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8014ce:	48 89 c7             	mov    %rax,%rdi
+  8014d1:	48 89 d6             	mov    %rdx,%rsi
+  8014d4:	fc                   	cld
+  8014d5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+					 : "cc", "memory");
+}
+  8014d8:	eb 17                	jmp    8014f1 <memcpy_fwd+0x10e>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  8014da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014de:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8014e2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8014e6:	48 89 c7             	mov    %rax,%rdi
+  8014e9:	48 89 d6             	mov    %rdx,%rsi
+  8014ec:	fc                   	cld
+  8014ed:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+  8014ef:	eb 00                	jmp    8014f1 <memcpy_fwd+0x10e>
+  8014f1:	90                   	nop
+  8014f2:	c9                   	leave
+  8014f3:	c3                   	ret
+
+00000000008014f4 <memset>:
+
+void *
+memset(void *v, int c, size_t n)
+{
+  8014f4:	55                   	push   %rbp
+  8014f5:	48 89 e5             	mov    %rsp,%rbp
+  8014f8:	48 83 ec 28          	sub    $0x28,%rsp
+  8014fc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801500:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801503:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t pattern;
+
+	if (n == 0)
+  801507:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80150c:	75 09                	jne    801517 <memset+0x23>
+		return v;
+  80150e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801512:	e9 dc 00 00 00       	jmp    8015f3 <memset+0xff>
+	c &= 0xFF;
+  801517:	81 65 e4 ff 00 00 00 	andl   $0xff,-0x1c(%rbp)
+	pattern = (uint64_t)c * 0x0101010101010101UL;
+  80151e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801521:	48 98                	cltq
+  801523:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  80152a:	01 01 01 
+  80152d:	48 0f af c2          	imul   %rdx,%rax
+  801531:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)v | n) & 31) == 0)
+  801535:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  80153c:	00 00 00 
+  80153f:	8b 00                	mov    (%rax),%eax
+  801541:	83 e0 02             	and    $0x2,%eax
+  801544:	85 c0                	test   %eax,%eax
+  801546:	74 3a                	je     801582 <memset+0x8e>
+  801548:	48 81 7d d8 ff 0f 00 	cmpq   $0xfff,-0x28(%rbp)
+  80154f:	00 
+  801550:	76 30                	jbe    801582 <memset+0x8e>
+  801552:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801556:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  80155a:	83 e0 1f             	and    $0x1f,%eax
+  80155d:	48 85 c0             	test   %rax,%rax
+  801560:	75 20                	jne    801582 <memset+0x8e>
+		memset_nt(v, pattern, n);
+  801562:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801566:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80156a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80156e:	48 89 ce             	mov    %rcx,%rsi
+  801571:	48 89 c7             	mov    %rax,%rdi
+  801574:	48 b8 ef 12 80 00 00 	movabs $0x8012ef,%rax
+  80157b:	00 00 00 
+  80157e:	ff d0                	call   *%rax
+  801580:	eb 6d                	jmp    8015ef <memset+0xfb>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  801582:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  801589:	00 00 00 
+  80158c:	8b 00                	mov    (%rax),%eax
+  80158e:	83 e0 01             	and    $0x1,%eax
+  801591:	85 c0                	test   %eax,%eax
+  801593:	74 1d                	je     8015b2 <memset+0xbe>
+  801595:	48 81 7d d8 ff 00 00 	cmpq   $0xff,-0x28(%rbp)
+  80159c:	00 
+  80159d:	76 13                	jbe    8015b2 <memset+0xbe>
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  80159f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8015a3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8015a6:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8015aa:	48 89 d7             	mov    %rdx,%rdi
+  8015ad:	fc                   	cld
+  8015ae:	f3 aa                	rep stos %al,%es:(%rdi)
+  8015b0:	eb 3d                	jmp    8015ef <memset+0xfb>
+					 : "cc", "memory");
+	else if ((((uint64_t)v | n) & 7) == 0)
+  8015b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015b6:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  8015ba:	83 e0 07             	and    $0x7,%eax
+  8015bd:	48 85 c0             	test   %rax,%rax
+  8015c0:	75 1c                	jne    8015de <memset+0xea>
+		asm volatile("cld; rep stosq\n" ::"D"(v), "a"(pattern), "c"(n / 8)
+  8015c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015c6:	48 c1 e8 03          	shr    $0x3,%rax
+  8015ca:	48 89 c1             	mov    %rax,%rcx
+  8015cd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8015d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015d5:	48 89 d7             	mov    %rdx,%rdi
+  8015d8:	fc                   	cld
+  8015d9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8015dc:	eb 11                	jmp    8015ef <memset+0xfb>
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  8015de:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8015e2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8015e5:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8015e9:	48 89 d7             	mov    %rdx,%rdi
+  8015ec:	fc                   	cld
+  8015ed:	f3 aa                	rep stos %al,%es:(%rdi)
+					 : "cc", "memory");
+	return v;
+  8015ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8015f3:	c9                   	leave
+  8015f4:	c3                   	ret
+
+00000000008015f5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8015f5:	55                   	push   %rbp
+  8015f6:	48 89 e5             	mov    %rsp,%rbp
+  8015f9:	48 83 ec 28          	sub    $0x28,%rsp
+  8015fd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801601:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801605:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801609:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80160d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801611:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801615:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d)
+  801619:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80161d:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801621:	73 7c                	jae    80169f <memmove+0xaa>
+  801623:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801627:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80162b:	48 01 d0             	add    %rdx,%rax
+  80162e:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801632:	73 6b                	jae    80169f <memmove+0xaa>
+	{
+		// 重叠且 dst 在 src 之后，只能反向复制(ERMS 对反向 rep movsb 没有优化)
+		s += n;
+  801634:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801638:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  80163c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801640:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((((uint64_t)s | (uint64_t)d | n) & 7) == 0)
+  801644:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801648:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80164c:	48 09 d0             	or     %rdx,%rax
+  80164f:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  801653:	83 e0 07             	and    $0x7,%eax
+  801656:	48 85 c0             	test   %rax,%rax
+  801659:	75 24                	jne    80167f <memmove+0x8a>
+			asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80165b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80165f:	48 83 e8 08          	sub    $0x8,%rax
+  801663:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801667:	48 83 ea 08          	sub    $0x8,%rdx
+  80166b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80166f:	48 c1 e9 03          	shr    $0x3,%rcx
+  801673:	48 89 c7             	mov    %rax,%rdi
+  801676:	48 89 d6             	mov    %rdx,%rsi
+  801679:	fd                   	std
+  80167a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80167d:	eb 1d                	jmp    80169c <memmove+0xa7>
+						 : "cc", "memory");
+		else
+			asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80167f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801683:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801687:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80168b:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+  80168f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801693:	48 89 d7             	mov    %rdx,%rdi
+  801696:	48 89 c1             	mov    %rax,%rcx
+  801699:	fd                   	std
+  80169a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+						 : "cc", "memory");
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::
+  80169c:	fc                   	cld
+  80169d:	eb 25                	jmp    8016c4 <memmove+0xcf>
+						 : "cc");
+	}
+	else if (n)
+  80169f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016a4:	74 1e                	je     8016c4 <memmove+0xcf>
+		memcpy_fwd(d, s, n);
+  8016a6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8016aa:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8016ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016b2:	48 89 ce             	mov    %rcx,%rsi
+  8016b5:	48 89 c7             	mov    %rax,%rdi
+  8016b8:	48 b8 e3 13 80 00 00 	movabs $0x8013e3,%rax
+  8016bf:	00 00 00 
+  8016c2:	ff d0                	call   *%rax
+	return dst;
+  8016c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8016c8:	c9                   	leave
+  8016c9:	c3                   	ret
+
+00000000008016ca <memcpy>:
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8016ca:	55                   	push   %rbp
+  8016cb:	48 89 e5             	mov    %rsp,%rbp
+  8016ce:	48 83 ec 18          	sub    $0x18,%rsp
+  8016d2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016d6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8016da:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (n)
+  8016de:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8016e3:	74 1e                	je     801703 <memcpy+0x39>
+		memcpy_fwd(dst, src, n);
+  8016e5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8016e9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8016ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016f1:	48 89 ce             	mov    %rcx,%rsi
+  8016f4:	48 89 c7             	mov    %rax,%rdi
+  8016f7:	48 b8 e3 13 80 00 00 	movabs $0x8013e3,%rax
+  8016fe:	00 00 00 
+  801701:	ff d0                	call   *%rax
+	return dst;
+  801703:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801707:	c9                   	leave
+  801708:	c3                   	ret
+
+0000000000801709 <memcmp>:
+{
+}
+#endif
+
+int memcmp(const void *v1, const void *v2, size_t n)
+{
+  801709:	55                   	push   %rbp
+  80170a:	48 89 e5             	mov    %rsp,%rbp
+  80170d:	48 83 ec 28          	sub    $0x28,%rsp
+  801711:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801715:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801719:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *)v1;
+  80171d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801721:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *)v2;
+  801725:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801729:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0)
+  80172d:	eb 34                	jmp    801763 <memcmp+0x5a>
+	{
+		if (*s1 != *s2)
+  80172f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801733:	0f b6 10             	movzbl (%rax),%edx
+  801736:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80173a:	0f b6 00             	movzbl (%rax),%eax
+  80173d:	38 c2                	cmp    %al,%dl
+  80173f:	74 18                	je     801759 <memcmp+0x50>
+			return (int)*s1 - (int)*s2;
+  801741:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801745:	0f b6 00             	movzbl (%rax),%eax
+  801748:	0f b6 d0             	movzbl %al,%edx
+  80174b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80174f:	0f b6 00             	movzbl (%rax),%eax
+  801752:	0f b6 c0             	movzbl %al,%eax
+  801755:	29 c2                	sub    %eax,%edx
+  801757:	eb 20                	jmp    801779 <memcmp+0x70>
+		s1++, s2++;
+  801759:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80175e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0)
+  801763:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801767:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80176b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80176f:	48 85 c0             	test   %rax,%rax
+  801772:	75 bb                	jne    80172f <memcmp+0x26>
+	}
+
+	return 0;
+  801774:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801779:	89 d0                	mov    %edx,%eax
+  80177b:	c9                   	leave
+  80177c:	c3                   	ret
+
+000000000080177d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80177d:	55                   	push   %rbp
+  80177e:	48 89 e5             	mov    %rsp,%rbp
+  801781:	48 83 ec 28          	sub    $0x28,%rsp
+  801785:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801789:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  80178c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *)s + n;
+  801790:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801794:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801798:	48 01 d0             	add    %rdx,%rax
+  80179b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  80179f:	eb 13                	jmp    8017b4 <memfind+0x37>
+		if (*(const unsigned char *)s == (unsigned char)c)
+  8017a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017a5:	0f b6 00             	movzbl (%rax),%eax
+  8017a8:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8017ab:	38 d0                	cmp    %dl,%al
+  8017ad:	74 11                	je     8017c0 <memfind+0x43>
+	for (; s < ends; s++)
+  8017af:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8017b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017b8:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8017bc:	72 e3                	jb     8017a1 <memfind+0x24>
+  8017be:	eb 01                	jmp    8017c1 <memfind+0x44>
+			break;
+  8017c0:	90                   	nop
+	return (void *)s;
+  8017c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8017c5:	c9                   	leave
+  8017c6:	c3                   	ret
+
+00000000008017c7 <strtol>:
+
+long strtol(const char *s, char **endptr, int base)
+{
+  8017c7:	55                   	push   %rbp
+  8017c8:	48 89 e5             	mov    %rsp,%rbp
+  8017cb:	48 83 ec 38          	sub    $0x38,%rsp
+  8017cf:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8017d3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8017d7:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  8017da:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  8017e1:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8017e8:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8017e9:	eb 05                	jmp    8017f0 <strtol+0x29>
+		s++;
+  8017eb:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  8017f0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017f4:	0f b6 00             	movzbl (%rax),%eax
+  8017f7:	3c 20                	cmp    $0x20,%al
+  8017f9:	74 f0                	je     8017eb <strtol+0x24>
+  8017fb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017ff:	0f b6 00             	movzbl (%rax),%eax
+  801802:	3c 09                	cmp    $0x9,%al
+  801804:	74 e5                	je     8017eb <strtol+0x24>
+
+	// plus/minus sign
+	if (*s == '+')
+  801806:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80180a:	0f b6 00             	movzbl (%rax),%eax
+  80180d:	3c 2b                	cmp    $0x2b,%al
+  80180f:	75 07                	jne    801818 <strtol+0x51>
+		s++;
+  801811:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801816:	eb 17                	jmp    80182f <strtol+0x68>
+	else if (*s == '-')
+  801818:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80181c:	0f b6 00             	movzbl (%rax),%eax
+  80181f:	3c 2d                	cmp    $0x2d,%al
+  801821:	75 0c                	jne    80182f <strtol+0x68>
+		s++, neg = 1;
+  801823:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801828:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80182f:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801833:	74 06                	je     80183b <strtol+0x74>
+  801835:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801839:	75 28                	jne    801863 <strtol+0x9c>
+  80183b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80183f:	0f b6 00             	movzbl (%rax),%eax
+  801842:	3c 30                	cmp    $0x30,%al
+  801844:	75 1d                	jne    801863 <strtol+0x9c>
+  801846:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80184a:	48 83 c0 01          	add    $0x1,%rax
+  80184e:	0f b6 00             	movzbl (%rax),%eax
+  801851:	3c 78                	cmp    $0x78,%al
+  801853:	75 0e                	jne    801863 <strtol+0x9c>
+		s += 2, base = 16;
+  801855:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  80185a:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801861:	eb 2c                	jmp    80188f <strtol+0xc8>
+	else if (base == 0 && s[0] == '0')
+  801863:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801867:	75 19                	jne    801882 <strtol+0xbb>
+  801869:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80186d:	0f b6 00             	movzbl (%rax),%eax
+  801870:	3c 30                	cmp    $0x30,%al
+  801872:	75 0e                	jne    801882 <strtol+0xbb>
+		s++, base = 8;
+  801874:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801879:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801880:	eb 0d                	jmp    80188f <strtol+0xc8>
+	else if (base == 0)
+  801882:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801886:	75 07                	jne    80188f <strtol+0xc8>
+		base = 10;
+  801888:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+	// digits
+	while (1)
+	{
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  80188f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801893:	0f b6 00             	movzbl (%rax),%eax
+  801896:	3c 2f                	cmp    $0x2f,%al
+  801898:	7e 1d                	jle    8018b7 <strtol+0xf0>
+  80189a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80189e:	0f b6 00             	movzbl (%rax),%eax
+  8018a1:	3c 39                	cmp    $0x39,%al
+  8018a3:	7f 12                	jg     8018b7 <strtol+0xf0>
+			dig = *s - '0';
+  8018a5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018a9:	0f b6 00             	movzbl (%rax),%eax
+  8018ac:	0f be c0             	movsbl %al,%eax
+  8018af:	83 e8 30             	sub    $0x30,%eax
+  8018b2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8018b5:	eb 4e                	jmp    801905 <strtol+0x13e>
+		else if (*s >= 'a' && *s <= 'z')
+  8018b7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018bb:	0f b6 00             	movzbl (%rax),%eax
+  8018be:	3c 60                	cmp    $0x60,%al
+  8018c0:	7e 1d                	jle    8018df <strtol+0x118>
+  8018c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018c6:	0f b6 00             	movzbl (%rax),%eax
+  8018c9:	3c 7a                	cmp    $0x7a,%al
+  8018cb:	7f 12                	jg     8018df <strtol+0x118>
+			dig = *s - 'a' + 10;
+  8018cd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018d1:	0f b6 00             	movzbl (%rax),%eax
+  8018d4:	0f be c0             	movsbl %al,%eax
+  8018d7:	83 e8 57             	sub    $0x57,%eax
+  8018da:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8018dd:	eb 26                	jmp    801905 <strtol+0x13e>
+		else if (*s >= 'A' && *s <= 'Z')
+  8018df:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018e3:	0f b6 00             	movzbl (%rax),%eax
+  8018e6:	3c 40                	cmp    $0x40,%al
+  8018e8:	7e 47                	jle    801931 <strtol+0x16a>
+  8018ea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018ee:	0f b6 00             	movzbl (%rax),%eax
+  8018f1:	3c 5a                	cmp    $0x5a,%al
+  8018f3:	7f 3c                	jg     801931 <strtol+0x16a>
+			dig = *s - 'A' + 10;
+  8018f5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018f9:	0f b6 00             	movzbl (%rax),%eax
+  8018fc:	0f be c0             	movsbl %al,%eax
+  8018ff:	83 e8 37             	sub    $0x37,%eax
+  801902:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801905:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801908:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  80190b:	7d 23                	jge    801930 <strtol+0x169>
+			break;
+		s++, val = (val * base) + dig;
+  80190d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801912:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801915:	48 98                	cltq
+  801917:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  80191c:	48 89 c2             	mov    %rax,%rdx
+  80191f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801922:	48 98                	cltq
+  801924:	48 01 d0             	add    %rdx,%rax
+  801927:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+  80192b:	e9 5f ff ff ff       	jmp    80188f <strtol+0xc8>
+			break;
+  801930:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801931:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801936:	74 0b                	je     801943 <strtol+0x17c>
+		*endptr = (char *)s;
+  801938:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80193c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801940:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801943:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801947:	74 09                	je     801952 <strtol+0x18b>
+  801949:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80194d:	48 f7 d8             	neg    %rax
+  801950:	eb 04                	jmp    801956 <strtol+0x18f>
+  801952:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801956:	c9                   	leave
+  801957:	c3                   	ret
+
+0000000000801958 <strstr>:
+
+char *strstr(const char *in, const char *str)
+{
+  801958:	55                   	push   %rbp
+  801959:	48 89 e5             	mov    %rsp,%rbp
+  80195c:	48 83 ec 30          	sub    $0x30,%rsp
+  801960:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801964:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801968:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80196c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801970:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801974:	0f b6 00             	movzbl (%rax),%eax
+  801977:	88 45 ff             	mov    %al,-0x1(%rbp)
+	if (!c)
+  80197a:	80 7d ff 00          	cmpb   $0x0,-0x1(%rbp)
+  80197e:	75 06                	jne    801986 <strstr+0x2e>
+		return (char *)in; // Trivial empty string case
+  801980:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801984:	eb 6b                	jmp    8019f1 <strstr+0x99>
+
+	len = strlen(str);
+  801986:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80198a:	48 89 c7             	mov    %rax,%rdi
+  80198d:	48 b8 fd 0e 80 00 00 	movabs $0x800efd,%rax
+  801994:	00 00 00 
+  801997:	ff d0                	call   *%rax
+  801999:	48 98                	cltq
+  80199b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+		char sc;
+
+		do
+		{
+			sc = *in++;
+  80199f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019a3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8019a7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8019ab:	0f b6 00             	movzbl (%rax),%eax
+  8019ae:	88 45 ef             	mov    %al,-0x11(%rbp)
+			if (!sc)
+  8019b1:	80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+  8019b5:	75 07                	jne    8019be <strstr+0x66>
+				return (char *)0;
+  8019b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019bc:	eb 33                	jmp    8019f1 <strstr+0x99>
+		} while (sc != c);
+  8019be:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+  8019c2:	3a 45 ff             	cmp    -0x1(%rbp),%al
+  8019c5:	75 d8                	jne    80199f <strstr+0x47>
+	} while (strncmp(in, str, len) != 0);
+  8019c7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8019cb:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8019cf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019d3:	48 89 ce             	mov    %rcx,%rsi
+  8019d6:	48 89 c7             	mov    %rax,%rdi
+  8019d9:	48 b8 18 11 80 00 00 	movabs $0x801118,%rax
+  8019e0:	00 00 00 
+  8019e3:	ff d0                	call   *%rax
+  8019e5:	85 c0                	test   %eax,%eax
+  8019e7:	75 b6                	jne    80199f <strstr+0x47>
+
+	return (char *)(in - 1);
+  8019e9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019ed:	48 83 e8 01          	sub    $0x1,%rax
+}
+  8019f1:	c9                   	leave
+  8019f2:	c3                   	ret
+
+00000000008019f3 <syscall>:
+ * 用户的指令式系统调用，该函数将系统调用序号放入eax寄存器，五个参数依次放入edx, ecx, ebx, edi, esi，然后执行指令int 0x30，
+ * 发生中断后，去IDT中查找中断处理函数，最终会走到kern/trap.c的trap_dispatch()中
+ */
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  8019f3:	55                   	push   %rbp
+  8019f4:	48 89 e5             	mov    %rsp,%rbp
+  8019f7:	53                   	push   %rbx
+  8019f8:	48 83 ec 48          	sub    $0x48,%rsp
+  8019fc:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8019ff:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801a02:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801a06:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801a0a:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801a0e:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	 * volatile 告诉汇编程序不要因为不使用返回值就优化该指令
+	 * 最后一个子句告诉汇编程序，指令可能会改变条件代码cx和任意内存memory位置
+	 * 由汇编编译器做好数据保存和恢复工作(栈)
+	 */
+
+	asm volatile("int %1\n"			// code: int T_SYSCALL
+  801a12:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801a15:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801a19:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a1d:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801a21:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801a25:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801a29:	4c 89 c3             	mov    %r8,%rbx
+  801a2c:	cd 30                	int    $0x30
+  801a2e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+				   "D"(a4),			// edi = a4
+				   "S"(a5)			// esi = a5
+				 : "cc", "memory"); // 指令可能会改变条件代码cx和任意内存memory位置
+									// 由汇编编译器做好数据保存和恢复工作(栈)
+
+	if (check && ret > 0)
+  801a32:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801a36:	74 44                	je     801a7c <syscall+0x89>
+  801a38:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801a3d:	7e 3d                	jle    801a7c <syscall+0x89>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a3f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a43:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801a46:	49 89 d0             	mov    %rdx,%r8
+  801a49:	89 c1                	mov    %eax,%ecx
+  801a4b:	48 b8 68 29 80 00 00 	movabs $0x802968,%rax
+  801a52:	00 00 00 
+  801a55:	48 89 c2             	mov    %rax,%rdx
+  801a58:	be 34 00 00 00       	mov    $0x34,%esi
+  801a5d:	48 b8 85 29 80 00 00 	movabs $0x802985,%rax
+  801a64:	00 00 00 
+  801a67:	48 89 c7             	mov    %rax,%rdi
+  801a6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a6f:	49 b9 34 23 80 00 00 	movabs $0x802334,%r9
+  801a76:	00 00 00 
+  801a79:	41 ff d1             	call   *%r9
+
+	return ret;
+  801a7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801a80:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a84:	c9                   	leave
+  801a85:	c3                   	ret
+
+0000000000801a86 <sys_cputs>:
+
+void sys_cputs(const char *s, size_t len)
+{
+  801a86:	55                   	push   %rbp
+  801a87:	48 89 e5             	mov    %rsp,%rbp
+  801a8a:	48 83 ec 10          	sub    $0x10,%rsp
+  801a8e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a92:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 调用lib/syscall.c中的syscall()
+	// SYS_cputs: 系统调用序号(eax)，s: 需要输出的字符数组，len: 数组长度
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801a96:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a9a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a9e:	48 83 ec 08          	sub    $0x8,%rsp
+  801aa2:	6a 00                	push   $0x0
+  801aa4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801aaa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ab0:	48 89 d1             	mov    %rdx,%rcx
+  801ab3:	48 89 c2             	mov    %rax,%rdx
+  801ab6:	be 00 00 00 00       	mov    $0x0,%esi
+  801abb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ac0:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  801ac7:	00 00 00 
+  801aca:	ff d0                	call   *%rax
+  801acc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ad0:	90                   	nop
+  801ad1:	c9                   	leave
+  801ad2:	c3                   	ret
+
+0000000000801ad3 <sys_cgetc>:
+
+int sys_cgetc(void)
+{
+  801ad3:	55                   	push   %rbp
+  801ad4:	48 89 e5             	mov    %rsp,%rbp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801ad7:	48 83 ec 08          	sub    $0x8,%rsp
+  801adb:	6a 00                	push   $0x0
+  801add:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ae3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ae9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801aee:	ba 00 00 00 00       	mov    $0x0,%edx
+  801af3:	be 00 00 00 00       	mov    $0x0,%esi
+  801af8:	bf 01 00 00 00       	mov    $0x1,%edi
+  801afd:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  801b04:	00 00 00 
+  801b07:	ff d0                	call   *%rax
+  801b09:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801b0d:	c9                   	leave
+  801b0e:	c3                   	ret
+
+0000000000801b0f <sys_env_destroy>:
+
+int sys_env_destroy(envid_t envid)
+{
+  801b0f:	55                   	push   %rbp
+  801b10:	48 89 e5             	mov    %rsp,%rbp
+  801b13:	48 83 ec 10          	sub    $0x10,%rsp
+  801b17:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	// 销毁envid对应的环境
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801b1a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b1d:	48 98                	cltq
+  801b1f:	48 83 ec 08          	sub    $0x8,%rsp
+  801b23:	6a 00                	push   $0x0
+  801b25:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b2b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b31:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b36:	48 89 c2             	mov    %rax,%rdx
+  801b39:	be 01 00 00 00       	mov    $0x1,%esi
+  801b3e:	bf 03 00 00 00       	mov    $0x3,%edi
+  801b43:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  801b4a:	00 00 00 
+  801b4d:	ff d0                	call   *%rax
+  801b4f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801b53:	c9                   	leave
+  801b54:	c3                   	ret
+
+0000000000801b55 <sys_getprocid>:
+
+envid_t
+sys_getprocid(void)
+{
+  801b55:	55                   	push   %rbp
+  801b56:	48 89 e5             	mov    %rsp,%rbp
+	// 获取当前用户环境id
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801b59:	48 83 ec 08          	sub    $0x8,%rsp
+  801b5d:	6a 00                	push   $0x0
+  801b5f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b65:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b6b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b70:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b75:	be 00 00 00 00       	mov    $0x0,%esi
+  801b7a:	bf 02 00 00 00       	mov    $0x2,%edi
+  801b7f:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  801b86:	00 00 00 
+  801b89:	ff d0                	call   *%rax
+  801b8b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801b8f:	c9                   	leave
+  801b90:	c3                   	ret
+
+0000000000801b91 <sys_yield>:
+
+void sys_yield(void)
+{
+  801b91:	55                   	push   %rbp
+  801b92:	48 89 e5             	mov    %rsp,%rbp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801b95:	48 83 ec 08          	sub    $0x8,%rsp
+  801b99:	6a 00                	push   $0x0
+  801b9b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ba1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ba7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bac:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bb1:	be 00 00 00 00       	mov    $0x0,%esi
+  801bb6:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801bbb:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  801bc2:	00 00 00 
+  801bc5:	ff d0                	call   *%rax
+  801bc7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801bcb:	90                   	nop
+  801bcc:	c9                   	leave
+  801bcd:	c3                   	ret
+
+0000000000801bce <sys_page_alloc>:
+
+int sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801bce:	55                   	push   %rbp
+  801bcf:	48 89 e5             	mov    %rsp,%rbp
+  801bd2:	48 83 ec 10          	sub    $0x10,%rsp
+  801bd6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801bd9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801bdd:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  801be0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801be3:	48 63 c8             	movslq %eax,%rcx
+  801be6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801bea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801bed:	48 98                	cltq
+  801bef:	48 83 ec 08          	sub    $0x8,%rsp
+  801bf3:	6a 00                	push   $0x0
+  801bf5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801bfb:	49 89 c8             	mov    %rcx,%r8
+  801bfe:	48 89 d1             	mov    %rdx,%rcx
+  801c01:	48 89 c2             	mov    %rax,%rdx
+  801c04:	be 01 00 00 00       	mov    $0x1,%esi
+  801c09:	bf 04 00 00 00       	mov    $0x4,%edi
+  801c0e:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  801c15:	00 00 00 
+  801c18:	ff d0                	call   *%rax
+  801c1a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c1e:	c9                   	leave
+  801c1f:	c3                   	ret
+
+0000000000801c20 <sys_page_map>:
+
+int sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801c20:	55                   	push   %rbp
+  801c21:	48 89 e5             	mov    %rsp,%rbp
+  801c24:	48 83 ec 20          	sub    $0x20,%rsp
+  801c28:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801c2b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801c2f:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801c32:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801c36:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  801c3a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801c3d:	48 63 c8             	movslq %eax,%rcx
+  801c40:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  801c44:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801c47:	48 63 f0             	movslq %eax,%rsi
+  801c4a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c4e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801c51:	48 98                	cltq
+  801c53:	48 83 ec 08          	sub    $0x8,%rsp
+  801c57:	51                   	push   %rcx
+  801c58:	49 89 f9             	mov    %rdi,%r9
+  801c5b:	49 89 f0             	mov    %rsi,%r8
+  801c5e:	48 89 d1             	mov    %rdx,%rcx
+  801c61:	48 89 c2             	mov    %rax,%rdx
+  801c64:	be 01 00 00 00       	mov    $0x1,%esi
+  801c69:	bf 05 00 00 00       	mov    $0x5,%edi
+  801c6e:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  801c75:	00 00 00 
+  801c78:	ff d0                	call   *%rax
+  801c7a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c7e:	c9                   	leave
+  801c7f:	c3                   	ret
+
+0000000000801c80 <sys_page_unmap>:
+
+int sys_page_unmap(envid_t envid, void *va)
+{
+  801c80:	55                   	push   %rbp
+  801c81:	48 89 e5             	mov    %rsp,%rbp
+  801c84:	48 83 ec 10          	sub    $0x10,%rsp
+  801c88:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801c8b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  801c8f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c93:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801c96:	48 98                	cltq
+  801c98:	48 83 ec 08          	sub    $0x8,%rsp
+  801c9c:	6a 00                	push   $0x0
+  801c9e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ca4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801caa:	48 89 d1             	mov    %rdx,%rcx
+  801cad:	48 89 c2             	mov    %rax,%rdx
+  801cb0:	be 01 00 00 00       	mov    $0x1,%esi
+  801cb5:	bf 06 00 00 00       	mov    $0x6,%edi
+  801cba:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  801cc1:	00 00 00 
+  801cc4:	ff d0                	call   *%rax
+  801cc6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801cca:	c9                   	leave
+  801ccb:	c3                   	ret
+
+0000000000801ccc <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int sys_env_set_status(envid_t envid, int status)
+{
+  801ccc:	55                   	push   %rbp
+  801ccd:	48 89 e5             	mov    %rsp,%rbp
+  801cd0:	48 83 ec 10          	sub    $0x10,%rsp
+  801cd4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801cd7:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801cda:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801cdd:	48 63 d0             	movslq %eax,%rdx
+  801ce0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ce3:	48 98                	cltq
+  801ce5:	48 83 ec 08          	sub    $0x8,%rsp
+  801ce9:	6a 00                	push   $0x0
+  801ceb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801cf1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801cf7:	48 89 d1             	mov    %rdx,%rcx
+  801cfa:	48 89 c2             	mov    %rax,%rdx
+  801cfd:	be 01 00 00 00       	mov    $0x1,%esi
+  801d02:	bf 08 00 00 00       	mov    $0x8,%edi
+  801d07:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  801d0e:	00 00 00 
+  801d11:	ff d0                	call   *%rax
+  801d13:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d17:	c9                   	leave
+  801d18:	c3                   	ret
+
+0000000000801d19 <sys_env_set_trapframe>:
+
+int sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801d19:	55                   	push   %rbp
+  801d1a:	48 89 e5             	mov    %rsp,%rbp
+  801d1d:	48 83 ec 10          	sub    $0x10,%rsp
+  801d21:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801d24:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  801d28:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d2c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d2f:	48 98                	cltq
+  801d31:	48 83 ec 08          	sub    $0x8,%rsp
+  801d35:	6a 00                	push   $0x0
+  801d37:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d3d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d43:	48 89 d1             	mov    %rdx,%rcx
+  801d46:	48 89 c2             	mov    %rax,%rdx
+  801d49:	be 01 00 00 00       	mov    $0x1,%esi
+  801d4e:	bf 09 00 00 00       	mov    $0x9,%edi
+  801d53:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  801d5a:	00 00 00 
+  801d5d:	ff d0                	call   *%rax
+  801d5f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d63:	c9                   	leave
+  801d64:	c3                   	ret
+
+0000000000801d65 <sys_env_set_pgfault_upcall>:
+
+int sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801d65:	55                   	push   %rbp
+  801d66:	48 89 e5             	mov    %rsp,%rbp
+  801d69:	48 83 ec 10          	sub    $0x10,%rsp
+  801d6d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801d70:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  801d74:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d78:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d7b:	48 98                	cltq
+  801d7d:	48 83 ec 08          	sub    $0x8,%rsp
+  801d81:	6a 00                	push   $0x0
+  801d83:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d89:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d8f:	48 89 d1             	mov    %rdx,%rcx
+  801d92:	48 89 c2             	mov    %rax,%rdx
+  801d95:	be 01 00 00 00       	mov    $0x1,%esi
+  801d9a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801d9f:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  801da6:	00 00 00 
+  801da9:	ff d0                	call   *%rax
+  801dab:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801daf:	c9                   	leave
+  801db0:	c3                   	ret
+
+0000000000801db1 <sys_ipc_try_send>:
+
+int sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  801db1:	55                   	push   %rbp
+  801db2:	48 89 e5             	mov    %rsp,%rbp
+  801db5:	48 83 ec 20          	sub    $0x20,%rsp
+  801db9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801dbc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801dc0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801dc4:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  801dc7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801dca:	48 63 f0             	movslq %eax,%rsi
+  801dcd:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801dd1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801dd4:	48 98                	cltq
+  801dd6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801dda:	48 83 ec 08          	sub    $0x8,%rsp
+  801dde:	6a 00                	push   $0x0
+  801de0:	49 89 f1             	mov    %rsi,%r9
+  801de3:	49 89 c8             	mov    %rcx,%r8
+  801de6:	48 89 d1             	mov    %rdx,%rcx
+  801de9:	48 89 c2             	mov    %rax,%rdx
+  801dec:	be 00 00 00 00       	mov    $0x0,%esi
+  801df1:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801df6:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  801dfd:	00 00 00 
+  801e00:	ff d0                	call   *%rax
+  801e02:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e06:	c9                   	leave
+  801e07:	c3                   	ret
+
+0000000000801e08 <sys_ipc_recv>:
+
+int sys_ipc_recv(void *dstva)
+{
+  801e08:	55                   	push   %rbp
+  801e09:	48 89 e5             	mov    %rsp,%rbp
+  801e0c:	48 83 ec 10          	sub    $0x10,%rsp
+  801e10:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  801e14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e18:	48 83 ec 08          	sub    $0x8,%rsp
+  801e1c:	6a 00                	push   $0x0
+  801e1e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e24:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e2f:	48 89 c2             	mov    %rax,%rdx
+  801e32:	be 01 00 00 00       	mov    $0x1,%esi
+  801e37:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801e3c:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  801e43:	00 00 00 
+  801e46:	ff d0                	call   *%rax
+  801e48:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e4c:	c9                   	leave
+  801e4d:	c3                   	ret
+
+0000000000801e4e <sys_disk_io>:
+
+int sys_disk_io(int dev, uint64_t secno, void *va, size_t nsecs, int write)
+{
+  801e4e:	55                   	push   %rbp
+  801e4f:	48 89 e5             	mov    %rsp,%rbp
+  801e52:	48 83 ec 20          	sub    $0x20,%rsp
+  801e56:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e59:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801e5d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801e61:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  801e65:	44 89 45 f8          	mov    %r8d,-0x8(%rbp)
+	return syscall(SYS_disk_io, 0, dev, secno, (uint64_t)va, nsecs, write);
+  801e69:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801e6c:	48 63 c8             	movslq %eax,%rcx
+  801e6f:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  801e73:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e76:	48 98                	cltq
+  801e78:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  801e7c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e80:	48 83 ec 08          	sub    $0x8,%rsp
+  801e84:	51                   	push   %rcx
+  801e85:	49 89 f9             	mov    %rdi,%r9
+  801e88:	49 89 f0             	mov    %rsi,%r8
+  801e8b:	48 89 d1             	mov    %rdx,%rcx
+  801e8e:	48 89 c2             	mov    %rax,%rdx
+  801e91:	be 00 00 00 00       	mov    $0x0,%esi
+  801e96:	bf 0e 00 00 00       	mov    $0xe,%edi
+  801e9b:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  801ea2:	00 00 00 
+  801ea5:	ff d0                	call   *%rax
+  801ea7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801eab:	c9                   	leave
+  801eac:	c3                   	ret
+
+0000000000801ead <sys_vma_alloc>:
+
+int sys_vma_alloc(envid_t envid, void *va, size_t len, int perm)
+{
+  801ead:	55                   	push   %rbp
+  801eae:	48 89 e5             	mov    %rsp,%rbp
+  801eb1:	48 83 ec 20          	sub    $0x20,%rsp
+  801eb5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801eb8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801ebc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801ec0:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_vma_alloc, 1, envid, (uint64_t)va, len, perm, 0);
+  801ec3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801ec6:	48 63 f0             	movslq %eax,%rsi
+  801ec9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801ecd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ed0:	48 98                	cltq
+  801ed2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801ed6:	48 83 ec 08          	sub    $0x8,%rsp
+  801eda:	6a 00                	push   $0x0
+  801edc:	49 89 f1             	mov    %rsi,%r9
+  801edf:	49 89 c8             	mov    %rcx,%r8
+  801ee2:	48 89 d1             	mov    %rdx,%rcx
+  801ee5:	48 89 c2             	mov    %rax,%rdx
+  801ee8:	be 01 00 00 00       	mov    $0x1,%esi
+  801eed:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801ef2:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  801ef9:	00 00 00 
+  801efc:	ff d0                	call   *%rax
+  801efe:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f02:	c9                   	leave
+  801f03:	c3                   	ret
+
+0000000000801f04 <sys_vma_clear>:
+
+int sys_vma_clear(envid_t envid)
+{
+  801f04:	55                   	push   %rbp
+  801f05:	48 89 e5             	mov    %rsp,%rbp
+  801f08:	48 83 ec 10          	sub    $0x10,%rsp
+  801f0c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_vma_clear, 1, envid, 0, 0, 0, 0);
+  801f0f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f12:	48 98                	cltq
+  801f14:	48 83 ec 08          	sub    $0x8,%rsp
+  801f18:	6a 00                	push   $0x0
+  801f1a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f20:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f26:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f2b:	48 89 c2             	mov    %rax,%rdx
+  801f2e:	be 01 00 00 00       	mov    $0x1,%esi
+  801f33:	bf 10 00 00 00       	mov    $0x10,%edi
+  801f38:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  801f3f:	00 00 00 
+  801f42:	ff d0                	call   *%rax
+  801f44:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f48:	c9                   	leave
+  801f49:	c3                   	ret
+
+0000000000801f4a <sys_trace_ctl>:
+
+int sys_trace_ctl(int enable)
+{
+  801f4a:	55                   	push   %rbp
+  801f4b:	48 89 e5             	mov    %rsp,%rbp
+  801f4e:	48 83 ec 10          	sub    $0x10,%rsp
+  801f52:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_trace_ctl, 0, enable, 0, 0, 0, 0);
+  801f55:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f58:	48 98                	cltq
+  801f5a:	48 83 ec 08          	sub    $0x8,%rsp
+  801f5e:	6a 00                	push   $0x0
+  801f60:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f66:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f71:	48 89 c2             	mov    %rax,%rdx
+  801f74:	be 00 00 00 00       	mov    $0x0,%esi
+  801f79:	bf 11 00 00 00       	mov    $0x11,%edi
+  801f7e:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  801f85:	00 00 00 
+  801f88:	ff d0                	call   *%rax
+  801f8a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f8e:	c9                   	leave
+  801f8f:	c3                   	ret
+
+0000000000801f90 <sys_trace_read>:
+
+int sys_trace_read(int cpu, uint64_t *seq, struct TraceEvent *buf, int n)
+{
+  801f90:	55                   	push   %rbp
+  801f91:	48 89 e5             	mov    %rsp,%rbp
+  801f94:	48 83 ec 20          	sub    $0x20,%rsp
+  801f98:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f9b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f9f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801fa3:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_trace_read, 0, cpu, (uint64_t)seq, (uint64_t)buf, n, 0);
+  801fa6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801fa9:	48 63 f0             	movslq %eax,%rsi
+  801fac:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801fb0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801fb4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fb7:	48 98                	cltq
+  801fb9:	48 83 ec 08          	sub    $0x8,%rsp
+  801fbd:	6a 00                	push   $0x0
+  801fbf:	49 89 f1             	mov    %rsi,%r9
+  801fc2:	49 89 c8             	mov    %rcx,%r8
+  801fc5:	48 89 d1             	mov    %rdx,%rcx
+  801fc8:	48 89 c2             	mov    %rax,%rdx
+  801fcb:	be 00 00 00 00       	mov    $0x0,%esi
+  801fd0:	bf 12 00 00 00       	mov    $0x12,%edi
+  801fd5:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  801fdc:	00 00 00 
+  801fdf:	ff d0                	call   *%rax
+  801fe1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fe5:	c9                   	leave
+  801fe6:	c3                   	ret
+
+0000000000801fe7 <sys_getrusage>:
+
+int sys_getrusage(envid_t envid, struct Rusage *ru)
+{
+  801fe7:	55                   	push   %rbp
+  801fe8:	48 89 e5             	mov    %rsp,%rbp
+  801feb:	48 83 ec 10          	sub    $0x10,%rsp
+  801fef:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801ff2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_getrusage, 0, envid, (uint64_t)ru, 0, 0, 0);
+  801ff6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801ffa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ffd:	48 98                	cltq
+  801fff:	48 83 ec 08          	sub    $0x8,%rsp
+  802003:	6a 00                	push   $0x0
+  802005:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80200b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802011:	48 89 d1             	mov    %rdx,%rcx
+  802014:	48 89 c2             	mov    %rax,%rdx
+  802017:	be 00 00 00 00       	mov    $0x0,%esi
+  80201c:	bf 13 00 00 00       	mov    $0x13,%edi
+  802021:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  802028:	00 00 00 
+  80202b:	ff d0                	call   *%rax
+  80202d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802031:	c9                   	leave
+  802032:	c3                   	ret
+
+0000000000802033 <sys_pmu_config>:
+
+int sys_pmu_config(int idx, uint64_t event)
+{
+  802033:	55                   	push   %rbp
+  802034:	48 89 e5             	mov    %rsp,%rbp
+  802037:	48 83 ec 10          	sub    $0x10,%rsp
+  80203b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80203e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_pmu_config, 0, idx, event, 0, 0, 0);
+  802042:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802045:	48 98                	cltq
+  802047:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80204b:	48 83 ec 08          	sub    $0x8,%rsp
+  80204f:	6a 00                	push   $0x0
+  802051:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802057:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80205d:	48 89 d1             	mov    %rdx,%rcx
+  802060:	48 89 c2             	mov    %rax,%rdx
+  802063:	be 00 00 00 00       	mov    $0x0,%esi
+  802068:	bf 14 00 00 00       	mov    $0x14,%edi
+  80206d:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  802074:	00 00 00 
+  802077:	ff d0                	call   *%rax
+  802079:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80207d:	c9                   	leave
+  80207e:	c3                   	ret
+
+000000000080207f <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  80207f:	55                   	push   %rbp
+  802080:	48 89 e5             	mov    %rsp,%rbp
+  802083:	48 83 ec 10          	sub    $0x10,%rsp
+  802087:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+  80208a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80208d:	48 83 ec 08          	sub    $0x8,%rsp
+  802091:	6a 00                	push   $0x0
+  802093:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802099:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80209f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020a4:	48 89 c2             	mov    %rax,%rdx
+  8020a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8020ac:	bf 15 00 00 00       	mov    $0x15,%edi
+  8020b1:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  8020b8:	00 00 00 
+  8020bb:	ff d0                	call   *%rax
+  8020bd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020c1:	c9                   	leave
+  8020c2:	c3                   	ret
+
+00000000008020c3 <sys_image_attach>:
+
+int sys_image_attach(envid_t envid, int dev, const uint64_t *secnos, size_t size)
+{
+  8020c3:	55                   	push   %rbp
+  8020c4:	48 89 e5             	mov    %rsp,%rbp
+  8020c7:	48 83 ec 20          	sub    $0x20,%rsp
+  8020cb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020ce:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  8020d1:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8020d5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+	return syscall(SYS_image_attach, 1, envid, dev, (uint64_t)secnos, size, 0);
+  8020d9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8020dd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8020e0:	48 63 d0             	movslq %eax,%rdx
+  8020e3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020e6:	48 98                	cltq
+  8020e8:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8020ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8020f0:	6a 00                	push   $0x0
+  8020f2:	49 89 f1             	mov    %rsi,%r9
+  8020f5:	49 89 c8             	mov    %rcx,%r8
+  8020f8:	48 89 d1             	mov    %rdx,%rcx
+  8020fb:	48 89 c2             	mov    %rax,%rdx
+  8020fe:	be 01 00 00 00       	mov    $0x1,%esi
+  802103:	bf 16 00 00 00       	mov    $0x16,%edi
+  802108:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  80210f:	00 00 00 
+  802112:	ff d0                	call   *%rax
+  802114:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802118:	c9                   	leave
+  802119:	c3                   	ret
+
+000000000080211a <sys_vma_binary>:
+
+int sys_vma_binary(envid_t envid, const struct Proghdr *ph)
+{
+  80211a:	55                   	push   %rbp
+  80211b:	48 89 e5             	mov    %rsp,%rbp
+  80211e:	48 83 ec 10          	sub    $0x10,%rsp
+  802122:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802125:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_vma_binary, 1, envid, (uint64_t)ph, 0, 0, 0);
+  802129:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80212d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802130:	48 98                	cltq
+  802132:	48 83 ec 08          	sub    $0x8,%rsp
+  802136:	6a 00                	push   $0x0
+  802138:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80213e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802144:	48 89 d1             	mov    %rdx,%rcx
+  802147:	48 89 c2             	mov    %rax,%rdx
+  80214a:	be 01 00 00 00       	mov    $0x1,%esi
+  80214f:	bf 17 00 00 00       	mov    $0x17,%edi
+  802154:	48 b8 f3 19 80 00 00 	movabs $0x8019f3,%rax
+  80215b:	00 00 00 
+  80215e:	ff d0                	call   *%rax
+  802160:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802164:	c9                   	leave
+  802165:	c3                   	ret
+
+0000000000802166 <ipc_recv>:
+ * 如果 pg 为空，则传递 sys_ipc_recv 一个值，它将理解为“no page”的意思
+ * (Zero 不是正确的值，因为这是映射页面的完美有效位置)
+ */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802166:	55                   	push   %rbp
+  802167:	48 89 e5             	mov    %rsp,%rbp
+  80216a:	48 83 ec 30          	sub    $0x30,%rsp
+  80216e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802172:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802176:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	int r = 0;
+  80217a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	if(pg) {
+  802181:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802186:	74 18                	je     8021a0 <ipc_recv+0x3a>
+		r = sys_ipc_recv(pg);
+  802188:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80218c:	48 89 c7             	mov    %rax,%rdi
+  80218f:	48 b8 08 1e 80 00 00 	movabs $0x801e08,%rax
+  802196:	00 00 00 
+  802199:	ff d0                	call   *%rax
+  80219b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80219e:	eb 1c                	jmp    8021bc <ipc_recv+0x56>
+	}
+	// pg == 0, pg > UTOP
+	else {
+		r = sys_ipc_recv((void*)KERNBASE);
+  8021a0:	48 b8 00 00 00 04 80 	movabs $0x8004000000,%rax
+  8021a7:	00 00 00 
+  8021aa:	48 89 c7             	mov    %rax,%rdi
+  8021ad:	48 b8 08 1e 80 00 00 	movabs $0x801e08,%rax
+  8021b4:	00 00 00 
+  8021b7:	ff d0                	call   *%rax
+  8021b9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	}
+	if (r < 0) {
+  8021bc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8021c0:	79 39                	jns    8021fb <ipc_recv+0x95>
+		*from_env_store =  (from_env_store != NULL) ? (envid_t)0 : *from_env_store;
+  8021c2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8021c7:	75 08                	jne    8021d1 <ipc_recv+0x6b>
+  8021c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021cd:	8b 00                	mov    (%rax),%eax
+  8021cf:	eb 05                	jmp    8021d6 <ipc_recv+0x70>
+  8021d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8021da:	89 02                	mov    %eax,(%rdx)
+		*perm_store = (perm_store != NULL) ? (int)0 : *perm_store;
+  8021dc:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8021e1:	75 08                	jne    8021eb <ipc_recv+0x85>
+  8021e3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021e7:	8b 00                	mov    (%rax),%eax
+  8021e9:	eb 05                	jmp    8021f0 <ipc_recv+0x8a>
+  8021eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021f0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8021f4:	89 02                	mov    %eax,(%rdx)
+		return r;
+  8021f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021f9:	eb 53                	jmp    80224e <ipc_recv+0xe8>
+	}
+	// 设置from_env_store为发送进程的进程ID
+	if(from_env_store) {
+  8021fb:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802200:	74 19                	je     80221b <ipc_recv+0xb5>
+		*from_env_store = thisproc->env_ipc_from;
+  802202:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  802209:	00 00 00 
+  80220c:	48 8b 00             	mov    (%rax),%rax
+  80220f:	8b 90 6c 01 00 00    	mov    0x16c(%rax),%edx
+  802215:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802219:	89 10                	mov    %edx,(%rax)
+	}
+	// 如果传递物理页，该位不为0，设置perm_store为物理页的权限
+	if(perm_store) {
+  80221b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  802220:	74 19                	je     80223b <ipc_recv+0xd5>
+		*perm_store = thisproc->env_ipc_perm;
+  802222:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  802229:	00 00 00 
+  80222c:	48 8b 00             	mov    (%rax),%rax
+  80222f:	8b 90 70 01 00 00    	mov    0x170(%rax),%edx
+  802235:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802239:	89 10                	mov    %edx,(%rax)
+	}
+	// 返回发送进程发送的值
+	return thisproc->env_ipc_value;
+  80223b:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  802242:	00 00 00 
+  802245:	48 8b 00             	mov    (%rax),%rax
+  802248:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  80224e:	c9                   	leave
+  80224f:	c3                   	ret
+
+0000000000802250 <ipc_send>:
+ * 使用sys_yield()使cpu友好
+ * 如果'pg'为null，则给sys_ipc_recv传递一个它会理解为“无页面”的值(0不是正确的值)
+ */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802250:	55                   	push   %rbp
+  802251:	48 89 e5             	mov    %rsp,%rbp
+  802254:	48 83 ec 30          	sub    $0x30,%rsp
+  802258:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80225b:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  80225e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802262:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	int r = -E_IPC_NOT_RECV;
+  802265:	c7 45 fc f8 ff ff ff 	movl   $0xfffffff8,-0x4(%rbp)
+	// 子进程不是接收状态
+	while(r == -E_IPC_NOT_RECV) {
+  80226c:	eb 59                	jmp    8022c7 <ipc_send+0x77>
+		if(pg) {
+  80226e:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802273:	74 20                	je     802295 <ipc_send+0x45>
+			// 传递物理页
+			r = sys_ipc_try_send(to_env, val, pg, perm);
+  802275:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  802278:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80227b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80227f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802282:	89 c7                	mov    %eax,%edi
+  802284:	48 b8 b1 1d 80 00 00 	movabs $0x801db1,%rax
+  80228b:	00 00 00 
+  80228e:	ff d0                	call   *%rax
+  802290:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802293:	eb 26                	jmp    8022bb <ipc_send+0x6b>
+		}
+		// pg == 0, pg > UTOP
+		else {
+			// (void*)KERNBASE > UTOP
+			r = sys_ipc_try_send(to_env, val, (void*)KERNBASE, perm);
+  802295:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  802298:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80229b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80229e:	89 d1                	mov    %edx,%ecx
+  8022a0:	48 ba 00 00 00 04 80 	movabs $0x8004000000,%rdx
+  8022a7:	00 00 00 
+  8022aa:	89 c7                	mov    %eax,%edi
+  8022ac:	48 b8 b1 1d 80 00 00 	movabs $0x801db1,%rax
+  8022b3:	00 00 00 
+  8022b6:	ff d0                	call   *%rax
+  8022b8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+		}
+		// 让出CPU
+		sys_yield();
+  8022bb:	48 b8 91 1b 80 00 00 	movabs $0x801b91,%rax
+  8022c2:	00 00 00 
+  8022c5:	ff d0                	call   *%rax
+	while(r == -E_IPC_NOT_RECV) {
+  8022c7:	83 7d fc f8          	cmpl   $0xfffffff8,-0x4(%rbp)
+  8022cb:	74 a1                	je     80226e <ipc_send+0x1e>
+	}
+	if (r != 0) {
+  8022cd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8022d1:	74 30                	je     802303 <ipc_send+0xb3>
+		panic("something went wrong with sending the page");
+  8022d3:	48 b8 98 29 80 00 00 	movabs $0x802998,%rax
+  8022da:	00 00 00 
+  8022dd:	48 89 c2             	mov    %rax,%rdx
+  8022e0:	be 48 00 00 00       	mov    $0x48,%esi
+  8022e5:	48 b8 c3 29 80 00 00 	movabs $0x8029c3,%rax
+  8022ec:	00 00 00 
+  8022ef:	48 89 c7             	mov    %rax,%rdi
+  8022f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022f7:	48 b9 34 23 80 00 00 	movabs $0x802334,%rcx
+  8022fe:	00 00 00 
+  802301:	ff d1                	call   *%rcx
+	}
+}
+  802303:	90                   	nop
+  802304:	c9                   	leave
+  802305:	c3                   	ret
+
+0000000000802306 <ipc_find_env>:
+// find special environments.
+// Returns 0 if no such environment exists.
+// 内核只遍历已分配的环境(env_live)，不扫描整个 procs[]
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802306:	55                   	push   %rbp
+  802307:	48 89 e5             	mov    %rsp,%rbp
+  80230a:	48 83 ec 20          	sub    $0x20,%rsp
+  80230e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	envid_t r = sys_env_find(type);
+  802311:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802314:	89 c7                	mov    %eax,%edi
+  802316:	48 b8 7f 20 80 00 00 	movabs $0x80207f,%rax
+  80231d:	00 00 00 
+  802320:	ff d0                	call   *%rax
+  802322:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+	return r < 0 ? 0 : r;
+  802325:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802328:	ba 00 00 00 00       	mov    $0x0,%edx
+  80232d:	85 c0                	test   %eax,%eax
+  80232f:	0f 48 c2             	cmovs  %edx,%eax
+}
+  802332:	c9                   	leave
+  802333:	c3                   	ret
+
+0000000000802334 <_panic>:
+/*
+ * 无法解决的致命错误会导致死机
+ * 打印"死机:<消息>”，然后导致处理器休眠进入HLT状态
+ */
+void _panic(const char *file, int line, const char *fmt, ...)
+{
+  802334:	55                   	push   %rbp
+  802335:	48 89 e5             	mov    %rsp,%rbp
+  802338:	53                   	push   %rbx
+  802339:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  802340:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  802347:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  80234d:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  802354:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  80235b:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  802362:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  802369:	84 c0                	test   %al,%al
+  80236b:	74 23                	je     802390 <_panic+0x5c>
+  80236d:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  802374:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  802378:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  80237c:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  802380:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  802384:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  802388:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  80238c:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  802390:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  802397:	00 00 00 
+  80239a:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  8023a1:	00 00 00 
+  8023a4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8023a8:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  8023af:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  8023b6:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+	// 输出死机的信息
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8023bd:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8023c4:	00 00 00 
+  8023c7:	48 8b 18             	mov    (%rax),%rbx
+  8023ca:	48 b8 55 1b 80 00 00 	movabs $0x801b55,%rax
+  8023d1:	00 00 00 
+  8023d4:	ff d0                	call   *%rax
+  8023d6:	89 c6                	mov    %eax,%esi
+  8023d8:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  8023de:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8023e5:	41 89 d0             	mov    %edx,%r8d
+  8023e8:	48 89 c1             	mov    %rax,%rcx
+  8023eb:	48 89 da             	mov    %rbx,%rdx
+  8023ee:	48 b8 d0 29 80 00 00 	movabs $0x8029d0,%rax
+  8023f5:	00 00 00 
+  8023f8:	48 89 c7             	mov    %rax,%rdi
+  8023fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802400:	49 b9 e2 02 80 00 00 	movabs $0x8002e2,%r9
+  802407:	00 00 00 
+  80240a:	41 ff d1             	call   *%r9
+			sys_getprocid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80240d:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  802414:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80241b:	48 89 d6             	mov    %rdx,%rsi
+  80241e:	48 89 c7             	mov    %rax,%rdi
+  802421:	48 b8 33 02 80 00 00 	movabs $0x800233,%rax
+  802428:	00 00 00 
+  80242b:	ff d0                	call   *%rax
+	cprintf("\n");
+  80242d:	48 b8 f3 29 80 00 00 	movabs $0x8029f3,%rax
+  802434:	00 00 00 
+  802437:	48 89 c7             	mov    %rax,%rdi
+  80243a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80243f:	48 ba e2 02 80 00 00 	movabs $0x8002e2,%rdx
+  802446:	00 00 00 
+  802449:	ff d2                	call   *%rdx
+
+	// 触发断点中断
+	while (1)
+		asm volatile("int3");
+  80244b:	cc                   	int3
+  80244c:	eb fd                	jmp    80244b <_panic+0x117>
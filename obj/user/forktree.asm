@@ -0,0 +1,6673 @@
+
+obj/user/forktree.debug:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// entrypoint - 当最初被加载到一个新的环境中时，内核(或者父环境)在这里开始运行.
+.text
+.globl _start
+_start:
+	// 判断是否从栈上的参数开始初始化
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	// $USTACKTOP != %rsp 说明有参数，跳转到 args_exist
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// 如果不是(新环境被内核加载的时候)，则 push 伪造的 argc, argv 参数
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 34 01 00 00       	call   800175 <libmain>
+
+// 不应该返回
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <forkchild>:
+#define DEPTH 10
+
+void forktree(const char *cur);
+
+void forkchild(const char *cur, char branch)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	48 83 ec 20          	sub    $0x20,%rsp
+  80004b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80004f:	89 f0                	mov    %esi,%eax
+  800051:	88 45 e4             	mov    %al,-0x1c(%rbp)
+	char nxt[DEPTH + 1];
+
+	// 字符串的长度 = 树结构深度就结束
+	if (strlen(cur) >= DEPTH)
+  800054:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800058:	48 89 c7             	mov    %rax,%rdi
+  80005b:	48 b8 72 0f 80 00 00 	movabs $0x800f72,%rax
+  800062:	00 00 00 
+  800065:	ff d0                	call   *%rax
+  800067:	83 f8 09             	cmp    $0x9,%eax
+  80006a:	7f 67                	jg     8000d3 <forkchild+0x90>
+		return;
+
+	snprintf(nxt, DEPTH + 1, "%s%c", cur, branch);
+  80006c:	0f be 4d e4          	movsbl -0x1c(%rbp),%ecx
+  800070:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800074:	48 8d 45 f5          	lea    -0xb(%rbp),%rax
+  800078:	41 89 c8             	mov    %ecx,%r8d
+  80007b:	48 89 d1             	mov    %rdx,%rcx
+  80007e:	48 ba 20 40 80 00 00 	movabs $0x804020,%rdx
+  800085:	00 00 00 
+  800088:	be 0b 00 00 00       	mov    $0xb,%esi
+  80008d:	48 89 c7             	mov    %rax,%rdi
+  800090:	b8 00 00 00 00       	mov    $0x0,%eax
+  800095:	49 b9 9d 0d 80 00 00 	movabs $0x800d9d,%r9
+  80009c:	00 00 00 
+  80009f:	41 ff d1             	call   *%r9
+	if (fork() == 0)
+  8000a2:	48 b8 b4 25 80 00 00 	movabs $0x8025b4,%rax
+  8000a9:	00 00 00 
+  8000ac:	ff d0                	call   *%rax
+  8000ae:	85 c0                	test   %eax,%eax
+  8000b0:	75 22                	jne    8000d4 <forkchild+0x91>
+	{
+		forktree(nxt);
+  8000b2:	48 8d 45 f5          	lea    -0xb(%rbp),%rax
+  8000b6:	48 89 c7             	mov    %rax,%rdi
+  8000b9:	48 b8 d6 00 80 00 00 	movabs $0x8000d6,%rax
+  8000c0:	00 00 00 
+  8000c3:	ff d0                	call   *%rax
+		exit();
+  8000c5:	48 b8 0a 02 80 00 00 	movabs $0x80020a,%rax
+  8000cc:	00 00 00 
+  8000cf:	ff d0                	call   *%rax
+  8000d1:	eb 01                	jmp    8000d4 <forkchild+0x91>
+		return;
+  8000d3:	90                   	nop
+	}
+}
+  8000d4:	c9                   	leave
+  8000d5:	c3                   	ret
+
+00000000008000d6 <forktree>:
+
+void forktree(const char *cur)
+{
+  8000d6:	55                   	push   %rbp
+  8000d7:	48 89 e5             	mov    %rsp,%rbp
+  8000da:	48 83 ec 10          	sub    $0x10,%rsp
+  8000de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	// 输出进程的树结构
+	cprintf("%04x: I am '%s'\n", sys_getprocid(), cur);
+  8000e2:	48 b8 ca 1b 80 00 00 	movabs $0x801bca,%rax
+  8000e9:	00 00 00 
+  8000ec:	ff d0                	call   *%rax
+  8000ee:	89 c1                	mov    %eax,%ecx
+  8000f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8000f4:	48 89 c2             	mov    %rax,%rdx
+  8000f7:	89 ce                	mov    %ecx,%esi
+  8000f9:	48 b8 25 40 80 00 00 	movabs $0x804025,%rax
+  800100:	00 00 00 
+  800103:	48 89 c7             	mov    %rax,%rdi
+  800106:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010b:	48 b9 57 03 80 00 00 	movabs $0x800357,%rcx
+  800112:	00 00 00 
+  800115:	ff d1                	call   *%rcx
+
+	// fork为二叉树
+	forkchild(cur, '0');
+  800117:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80011b:	be 30 00 00 00       	mov    $0x30,%esi
+  800120:	48 89 c7             	mov    %rax,%rdi
+  800123:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  80012a:	00 00 00 
+  80012d:	ff d0                	call   *%rax
+	forkchild(cur, '1');
+  80012f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800133:	be 31 00 00 00       	mov    $0x31,%esi
+  800138:	48 89 c7             	mov    %rax,%rdi
+  80013b:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  800142:	00 00 00 
+  800145:	ff d0                	call   *%rax
+}
+  800147:	90                   	nop
+  800148:	c9                   	leave
+  800149:	c3                   	ret
+
+000000000080014a <umain>:
+
+void umain(int argc, char **argv)
+{
+  80014a:	55                   	push   %rbp
+  80014b:	48 89 e5             	mov    %rsp,%rbp
+  80014e:	48 83 ec 10          	sub    $0x10,%rsp
+  800152:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800155:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	forktree("");
+  800159:	48 b8 36 40 80 00 00 	movabs $0x804036,%rax
+  800160:	00 00 00 
+  800163:	48 89 c7             	mov    %rax,%rdi
+  800166:	48 b8 d6 00 80 00 00 	movabs $0x8000d6,%rax
+  80016d:	00 00 00 
+  800170:	ff d0                	call   *%rax
+}
+  800172:	90                   	nop
+  800173:	c9                   	leave
+  800174:	c3                   	ret
+
+0000000000800175 <libmain>:
+
+/**
+ *  用户环境从lib/libmain.c中的函数libmain开始执行，这个函数进而调用umain，用户写的程序入口只能是umain
+ */
+void libmain(int argc, char **argv)
+{
+  800175:	55                   	push   %rbp
+  800176:	48 89 e5             	mov    %rsp,%rbp
+  800179:	48 83 ec 10          	sub    $0x10,%rsp
+  80017d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800180:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 设置常量 thisproc 指向 procs[] 中当前环境的 Env 结构，ENVX 确保环境 id 未超过了 NENV
+	// thisproc 指向当前环境的 Env 结构
+	thisproc = &procs[ENVX(sys_getprocid())];
+  800184:	48 b8 ca 1b 80 00 00 	movabs $0x801bca,%rax
+  80018b:	00 00 00 
+  80018e:	ff d0                	call   *%rax
+  800190:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800195:	48 98                	cltq
+  800197:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  80019e:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  8001a5:	00 00 00 
+  8001a8:	48 01 c2             	add    %rax,%rdx
+  8001ab:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8001b2:	00 00 00 
+  8001b5:	48 89 10             	mov    %rdx,(%rax)
+
+	// 通过 CPUID 选择 memset/memmove/memcpy 的实现
+	mem_init();
+  8001b8:	48 b8 72 12 80 00 00 	movabs $0x801272,%rax
+  8001bf:	00 00 00 
+  8001c2:	ff d0                	call   *%rax
+
+	// 为了能让panic()提示用户错误，存储程序的名称
+	if (argc > 0)
+  8001c4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8001c8:	7e 14                	jle    8001de <libmain+0x69>
+		binaryname = argv[0];
+  8001ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001ce:	48 8b 00             	mov    (%rax),%rax
+  8001d1:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8001d8:	00 00 00 
+  8001db:	48 89 02             	mov    %rax,(%rdx)
+
+	// 调用用户的主程序
+	umain(argc, argv);
+  8001de:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001e2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8001e5:	48 89 d6             	mov    %rdx,%rsi
+  8001e8:	89 c7                	mov    %eax,%edi
+  8001ea:	48 b8 4a 01 80 00 00 	movabs $0x80014a,%rax
+  8001f1:	00 00 00 
+  8001f4:	ff d0                	call   *%rax
+
+	// 退出当前环境，env_destroy
+	sys_env_destroy(0);
+  8001f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001fb:	48 b8 84 1b 80 00 00 	movabs $0x801b84,%rax
+  800202:	00 00 00 
+  800205:	ff d0                	call   *%rax
+}
+  800207:	90                   	nop
+  800208:	c9                   	leave
+  800209:	c3                   	ret
+
+000000000080020a <exit>:
+#include "inc/lib.h"
+
+void
+exit(void)
+{
+  80020a:	55                   	push   %rbp
+  80020b:	48 89 e5             	mov    %rsp,%rbp
+	close_all();
+  80020e:	48 b8 50 2c 80 00 00 	movabs $0x802c50,%rax
+  800215:	00 00 00 
+  800218:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  80021a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80021f:	48 b8 84 1b 80 00 00 	movabs $0x801b84,%rax
+  800226:	00 00 00 
+  800229:	ff d0                	call   *%rax
+}
+  80022b:	90                   	nop
+  80022c:	5d                   	pop    %rbp
+  80022d:	c3                   	ret
+
+000000000080022e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80022e:	55                   	push   %rbp
+  80022f:	48 89 e5             	mov    %rsp,%rbp
+  800232:	48 83 ec 10          	sub    $0x10,%rsp
+  800236:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800239:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->buf[b->idx++] = ch;
+  80023d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800241:	8b 00                	mov    (%rax),%eax
+  800243:	8d 48 01             	lea    0x1(%rax),%ecx
+  800246:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80024a:	89 0a                	mov    %ecx,(%rdx)
+  80024c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80024f:	89 d1                	mov    %edx,%ecx
+  800251:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800255:	48 98                	cltq
+  800257:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+	if (b->idx == 256-1) {
+  80025b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80025f:	8b 00                	mov    (%rax),%eax
+  800261:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800266:	75 2c                	jne    800294 <putch+0x66>
+		sys_cputs(b->buf, b->idx);
+  800268:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80026c:	8b 00                	mov    (%rax),%eax
+  80026e:	48 98                	cltq
+  800270:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800274:	48 83 c2 08          	add    $0x8,%rdx
+  800278:	48 89 c6             	mov    %rax,%rsi
+  80027b:	48 89 d7             	mov    %rdx,%rdi
+  80027e:	48 b8 fb 1a 80 00 00 	movabs $0x801afb,%rax
+  800285:	00 00 00 
+  800288:	ff d0                	call   *%rax
+		b->idx = 0;
+  80028a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80028e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	}
+	b->cnt++;
+  800294:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800298:	8b 40 04             	mov    0x4(%rax),%eax
+  80029b:	8d 50 01             	lea    0x1(%rax),%edx
+  80029e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002a2:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8002a5:	90                   	nop
+  8002a6:	c9                   	leave
+  8002a7:	c3                   	ret
+
+00000000008002a8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002a8:	55                   	push   %rbp
+  8002a9:	48 89 e5             	mov    %rsp,%rbp
+  8002ac:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8002b3:	48 89 bd c8 fe ff ff 	mov    %rdi,-0x138(%rbp)
+  8002ba:	48 89 b5 c0 fe ff ff 	mov    %rsi,-0x140(%rbp)
+	struct printbuf b;
+	va_list aq;
+	va_copy(aq,ap);
+  8002c1:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  8002c8:	48 8b b5 c0 fe ff ff 	mov    -0x140(%rbp),%rsi
+  8002cf:	48 8b 06             	mov    (%rsi),%rax
+  8002d2:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8002d6:	48 89 01             	mov    %rax,(%rcx)
+  8002d9:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8002dd:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8002e1:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	b.idx = 0;
+  8002e5:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8002ec:	00 00 00 
+	b.cnt = 0;
+  8002ef:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8002f6:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, aq);
+  8002f9:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  800300:	48 8b 95 c8 fe ff ff 	mov    -0x138(%rbp),%rdx
+  800307:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  80030e:	48 89 c6             	mov    %rax,%rsi
+  800311:	48 b8 2e 02 80 00 00 	movabs $0x80022e,%rax
+  800318:	00 00 00 
+  80031b:	48 89 c7             	mov    %rax,%rdi
+  80031e:	48 b8 f5 06 80 00 00 	movabs $0x8006f5,%rax
+  800325:	00 00 00 
+  800328:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  80032a:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  800330:	48 98                	cltq
+  800332:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800339:	48 83 c2 08          	add    $0x8,%rdx
+  80033d:	48 89 c6             	mov    %rax,%rsi
+  800340:	48 89 d7             	mov    %rdx,%rdi
+  800343:	48 b8 fb 1a 80 00 00 	movabs $0x801afb,%rax
+  80034a:	00 00 00 
+  80034d:	ff d0                	call   *%rax
+	va_end(aq);
+
+	return b.cnt;
+  80034f:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  800355:	c9                   	leave
+  800356:	c3                   	ret
+
+0000000000800357 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800357:	55                   	push   %rbp
+  800358:	48 89 e5             	mov    %rsp,%rbp
+  80035b:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800362:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800369:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800370:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800377:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80037e:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800385:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80038c:	84 c0                	test   %al,%al
+  80038e:	74 20                	je     8003b0 <cprintf+0x59>
+  800390:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800394:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800398:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80039c:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8003a0:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8003a4:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8003a8:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8003ac:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+	va_list aq;
+	va_start(ap, fmt);
+  8003b0:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8003b7:	00 00 00 
+  8003ba:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8003c1:	00 00 00 
+  8003c4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003c8:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8003cf:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8003d6:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  8003dd:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8003e4:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8003eb:	48 8b 06             	mov    (%rsi),%rax
+  8003ee:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8003f2:	48 89 01             	mov    %rax,(%rcx)
+  8003f5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8003f9:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8003fd:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	cnt = vcprintf(fmt, aq);
+  800401:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800408:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80040f:	48 89 d6             	mov    %rdx,%rsi
+  800412:	48 89 c7             	mov    %rax,%rdi
+  800415:	48 b8 a8 02 80 00 00 	movabs $0x8002a8,%rax
+  80041c:	00 00 00 
+  80041f:	ff d0                	call   *%rax
+  800421:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return cnt;
+  800427:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80042d:	c9                   	leave
+  80042e:	c3                   	ret
+
+000000000080042f <printnum>:
+ * num: 需要打印出来的整型数，base: 整型数的进制，其他参数同 vprintfmt
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+		 unsigned long long num, unsigned base, int width, int padc)
+{
+  80042f:	55                   	push   %rbp
+  800430:	48 89 e5             	mov    %rsp,%rbp
+  800433:	48 83 ec 30          	sub    $0x30,%rsp
+  800437:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80043b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80043f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800443:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  800446:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  80044a:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+	// 当 num 超过一位数，首先递归函数自身打印所有高位的(更重要的)数字
+	if (num >= base)
+  80044e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800451:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  800455:	72 54                	jb     8004ab <printnum+0x7c>
+	{
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800457:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80045a:	8d 78 ff             	lea    -0x1(%rax),%edi
+  80045d:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800460:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800464:	ba 00 00 00 00       	mov    $0x0,%edx
+  800469:	48 f7 f6             	div    %rsi
+  80046c:	49 89 c2             	mov    %rax,%r10
+  80046f:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800472:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800475:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800479:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80047d:	41 89 c9             	mov    %ecx,%r9d
+  800480:	41 89 f8             	mov    %edi,%r8d
+  800483:	89 d1                	mov    %edx,%ecx
+  800485:	4c 89 d2             	mov    %r10,%rdx
+  800488:	48 89 c7             	mov    %rax,%rdi
+  80048b:	48 b8 2f 04 80 00 00 	movabs $0x80042f,%rax
+  800492:	00 00 00 
+  800495:	ff d0                	call   *%rax
+  800497:	eb 1c                	jmp    8004b5 <printnum+0x86>
+	}
+	else
+	{
+		// 按照右对齐的格式在左侧补齐填充字符 padc
+		while (--width > 0)
+			putch(padc, putdat);
+  800499:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80049d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8004a0:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8004a4:	48 89 d6             	mov    %rdx,%rsi
+  8004a7:	89 c7                	mov    %eax,%edi
+  8004a9:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8004ab:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  8004af:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8004b3:	7f e4                	jg     800499 <printnum+0x6a>
+	}
+
+	// 然后打印个位数字
+	putch("0123456789abcdef"[num % base], putdat);
+  8004b5:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8004b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004c1:	48 f7 f1             	div    %rcx
+  8004c4:	48 b8 50 42 80 00 00 	movabs $0x804250,%rax
+  8004cb:	00 00 00 
+  8004ce:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8004d2:	0f be c0             	movsbl %al,%eax
+  8004d5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8004d9:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8004dd:	48 89 d6             	mov    %rdx,%rsi
+  8004e0:	89 c7                	mov    %eax,%edi
+  8004e2:	ff d1                	call   *%rcx
+}
+  8004e4:	90                   	nop
+  8004e5:	c9                   	leave
+  8004e6:	c3                   	ret
+
+00000000008004e7 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  8004e7:	55                   	push   %rbp
+  8004e8:	48 89 e5             	mov    %rsp,%rbp
+  8004eb:	48 83 ec 20          	sub    $0x20,%rsp
+  8004ef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8004f3:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;
+	if (lflag >= 2)
+  8004f6:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8004fa:	7e 4f                	jle    80054b <getuint+0x64>
+		x = va_arg(*ap, unsigned long long);
+  8004fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800500:	8b 00                	mov    (%rax),%eax
+  800502:	83 f8 2f             	cmp    $0x2f,%eax
+  800505:	77 24                	ja     80052b <getuint+0x44>
+  800507:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80050b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80050f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800513:	8b 00                	mov    (%rax),%eax
+  800515:	89 c0                	mov    %eax,%eax
+  800517:	48 01 d0             	add    %rdx,%rax
+  80051a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80051e:	8b 12                	mov    (%rdx),%edx
+  800520:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800523:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800527:	89 0a                	mov    %ecx,(%rdx)
+  800529:	eb 14                	jmp    80053f <getuint+0x58>
+  80052b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80052f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800533:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800537:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80053b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80053f:	48 8b 00             	mov    (%rax),%rax
+  800542:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800546:	e9 9d 00 00 00       	jmp    8005e8 <getuint+0x101>
+	else if (lflag)
+  80054b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80054f:	74 4c                	je     80059d <getuint+0xb6>
+		x = va_arg(*ap, unsigned long);
+  800551:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800555:	8b 00                	mov    (%rax),%eax
+  800557:	83 f8 2f             	cmp    $0x2f,%eax
+  80055a:	77 24                	ja     800580 <getuint+0x99>
+  80055c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800560:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800564:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800568:	8b 00                	mov    (%rax),%eax
+  80056a:	89 c0                	mov    %eax,%eax
+  80056c:	48 01 d0             	add    %rdx,%rax
+  80056f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800573:	8b 12                	mov    (%rdx),%edx
+  800575:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800578:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80057c:	89 0a                	mov    %ecx,(%rdx)
+  80057e:	eb 14                	jmp    800594 <getuint+0xad>
+  800580:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800584:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800588:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80058c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800590:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800594:	48 8b 00             	mov    (%rax),%rax
+  800597:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80059b:	eb 4b                	jmp    8005e8 <getuint+0x101>
+	else
+		x = va_arg(*ap, unsigned int);
+  80059d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005a1:	8b 00                	mov    (%rax),%eax
+  8005a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8005a6:	77 24                	ja     8005cc <getuint+0xe5>
+  8005a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005ac:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005b4:	8b 00                	mov    (%rax),%eax
+  8005b6:	89 c0                	mov    %eax,%eax
+  8005b8:	48 01 d0             	add    %rdx,%rax
+  8005bb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005bf:	8b 12                	mov    (%rdx),%edx
+  8005c1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005c4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005c8:	89 0a                	mov    %ecx,(%rdx)
+  8005ca:	eb 14                	jmp    8005e0 <getuint+0xf9>
+  8005cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005d0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005d4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005d8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005dc:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005e0:	8b 00                	mov    (%rax),%eax
+  8005e2:	89 c0                	mov    %eax,%eax
+  8005e4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8005e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8005ec:	c9                   	leave
+  8005ed:	c3                   	ret
+
+00000000008005ee <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  8005ee:	55                   	push   %rbp
+  8005ef:	48 89 e5             	mov    %rsp,%rbp
+  8005f2:	48 83 ec 20          	sub    $0x20,%rsp
+  8005f6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8005fa:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  8005fd:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800601:	7e 4f                	jle    800652 <getint+0x64>
+		x = va_arg(*ap, long long);
+  800603:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800607:	8b 00                	mov    (%rax),%eax
+  800609:	83 f8 2f             	cmp    $0x2f,%eax
+  80060c:	77 24                	ja     800632 <getint+0x44>
+  80060e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800612:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800616:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80061a:	8b 00                	mov    (%rax),%eax
+  80061c:	89 c0                	mov    %eax,%eax
+  80061e:	48 01 d0             	add    %rdx,%rax
+  800621:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800625:	8b 12                	mov    (%rdx),%edx
+  800627:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80062a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80062e:	89 0a                	mov    %ecx,(%rdx)
+  800630:	eb 14                	jmp    800646 <getint+0x58>
+  800632:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800636:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80063a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80063e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800642:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800646:	48 8b 00             	mov    (%rax),%rax
+  800649:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80064d:	e9 9d 00 00 00       	jmp    8006ef <getint+0x101>
+	else if (lflag)
+  800652:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800656:	74 4c                	je     8006a4 <getint+0xb6>
+		x = va_arg(*ap, long);
+  800658:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80065c:	8b 00                	mov    (%rax),%eax
+  80065e:	83 f8 2f             	cmp    $0x2f,%eax
+  800661:	77 24                	ja     800687 <getint+0x99>
+  800663:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800667:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80066b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80066f:	8b 00                	mov    (%rax),%eax
+  800671:	89 c0                	mov    %eax,%eax
+  800673:	48 01 d0             	add    %rdx,%rax
+  800676:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80067a:	8b 12                	mov    (%rdx),%edx
+  80067c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80067f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800683:	89 0a                	mov    %ecx,(%rdx)
+  800685:	eb 14                	jmp    80069b <getint+0xad>
+  800687:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80068b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80068f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800693:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800697:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80069b:	48 8b 00             	mov    (%rax),%rax
+  80069e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8006a2:	eb 4b                	jmp    8006ef <getint+0x101>
+	else
+		x = va_arg(*ap, int);
+  8006a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006a8:	8b 00                	mov    (%rax),%eax
+  8006aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ad:	77 24                	ja     8006d3 <getint+0xe5>
+  8006af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006b3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006bb:	8b 00                	mov    (%rax),%eax
+  8006bd:	89 c0                	mov    %eax,%eax
+  8006bf:	48 01 d0             	add    %rdx,%rax
+  8006c2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006c6:	8b 12                	mov    (%rdx),%edx
+  8006c8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006cb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006cf:	89 0a                	mov    %ecx,(%rdx)
+  8006d1:	eb 14                	jmp    8006e7 <getint+0xf9>
+  8006d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006d7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006db:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006df:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006e3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006e7:	8b 00                	mov    (%rax),%eax
+  8006e9:	48 98                	cltq
+  8006eb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8006ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8006f3:	c9                   	leave
+  8006f4:	c3                   	ret
+
+00000000008006f5 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap)
+{
+  8006f5:	55                   	push   %rbp
+  8006f6:	48 89 e5             	mov    %rsp,%rbp
+  8006f9:	41 54                	push   %r12
+  8006fb:	53                   	push   %rbx
+  8006fc:	48 83 ec 60          	sub    $0x60,%rsp
+  800700:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800704:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800708:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80070c:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+	int base, lflag, width, precision, altflag;
+
+	// 填充字符，在显示字符串的'%'后读到'-'或'0'时，赋值到 padc
+	char padc;
+	va_list aq;
+	va_copy(aq, ap);
+  800710:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800714:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800718:	48 8b 06             	mov    (%rsi),%rax
+  80071b:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80071f:	48 89 01             	mov    %rax,(%rcx)
+  800722:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800726:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80072a:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1)
+	{
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  80072e:	eb 17                	jmp    800747 <vprintfmt+0x52>
+		{
+			if (ch == '\0')
+  800730:	85 db                	test   %ebx,%ebx
+  800732:	0f 84 b9 04 00 00    	je     800bf1 <vprintfmt+0x4fc>
+				return;
+			putch(ch, putdat);
+  800738:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80073c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800740:	48 89 c6             	mov    %rax,%rsi
+  800743:	89 df                	mov    %ebx,%edi
+  800745:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800747:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80074b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80074f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800753:	0f b6 00             	movzbl (%rax),%eax
+  800756:	0f b6 d8             	movzbl %al,%ebx
+  800759:	83 fb 25             	cmp    $0x25,%ebx
+  80075c:	75 d2                	jne    800730 <vprintfmt+0x3b>
+		}
+
+		// 处理 % 转义序列
+		// padc 初始化为空格符，padc='-'代表字符串左对齐，右边补空格，padc=' '代表右对齐，左边补空格，padc='0'右对齐，左边补0
+		padc = ' ';
+  80075e:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+		width = -1;
+  800762:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+		// 默认-1代表显示长度为字符串本来的长度
+		precision = -1;
+  800769:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+		lflag = 0;
+  800770:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+		altflag = 0;
+  800777:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *)fmt++)
+  80077e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800782:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800786:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80078a:	0f b6 00             	movzbl (%rax),%eax
+  80078d:	0f b6 d8             	movzbl %al,%ebx
+  800790:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800793:	83 f8 55             	cmp    $0x55,%eax
+  800796:	0f 87 22 04 00 00    	ja     800bbe <vprintfmt+0x4c9>
+  80079c:	89 c0                	mov    %eax,%eax
+  80079e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8007a5:	00 
+  8007a6:	48 b8 78 42 80 00 00 	movabs $0x804278,%rax
+  8007ad:	00 00 00 
+  8007b0:	48 01 d0             	add    %rdx,%rax
+  8007b3:	48 8b 00             	mov    (%rax),%rax
+  8007b6:	ff e0                	jmp    *%rax
+		{
+
+		// flag to pad on the right
+		case '-':
+			padc = '-';
+  8007b8:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+			goto reswitch;
+  8007bc:	eb c0                	jmp    80077e <vprintfmt+0x89>
+
+		// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  8007be:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+			goto reswitch;
+  8007c2:	eb ba                	jmp    80077e <vprintfmt+0x89>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0;; ++fmt)
+  8007c4:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+			{
+				precision = precision * 10 + ch - '0';
+  8007cb:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8007ce:	89 d0                	mov    %edx,%eax
+  8007d0:	c1 e0 02             	shl    $0x2,%eax
+  8007d3:	01 d0                	add    %edx,%eax
+  8007d5:	01 c0                	add    %eax,%eax
+  8007d7:	01 d8                	add    %ebx,%eax
+  8007d9:	83 e8 30             	sub    $0x30,%eax
+  8007dc:	89 45 d8             	mov    %eax,-0x28(%rbp)
+				ch = *fmt;
+  8007df:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8007e3:	0f b6 00             	movzbl (%rax),%eax
+  8007e6:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  8007e9:	83 fb 2f             	cmp    $0x2f,%ebx
+  8007ec:	7e 60                	jle    80084e <vprintfmt+0x159>
+  8007ee:	83 fb 39             	cmp    $0x39,%ebx
+  8007f1:	7f 5b                	jg     80084e <vprintfmt+0x159>
+			for (precision = 0;; ++fmt)
+  8007f3:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+				precision = precision * 10 + ch - '0';
+  8007f8:	eb d1                	jmp    8007cb <vprintfmt+0xd6>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  8007fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fd:	83 f8 2f             	cmp    $0x2f,%eax
+  800800:	77 17                	ja     800819 <vprintfmt+0x124>
+  800802:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800806:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800809:	89 d2                	mov    %edx,%edx
+  80080b:	48 01 d0             	add    %rdx,%rax
+  80080e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800811:	83 c2 08             	add    $0x8,%edx
+  800814:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800817:	eb 0c                	jmp    800825 <vprintfmt+0x130>
+  800819:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80081d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800821:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800825:	8b 00                	mov    (%rax),%eax
+  800827:	89 45 d8             	mov    %eax,-0x28(%rbp)
+			goto process_precision;
+  80082a:	eb 23                	jmp    80084f <vprintfmt+0x15a>
+
+		case '.':
+			if (width < 0)
+  80082c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800830:	0f 89 48 ff ff ff    	jns    80077e <vprintfmt+0x89>
+				width = 0;
+  800836:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+			goto reswitch;
+  80083d:	e9 3c ff ff ff       	jmp    80077e <vprintfmt+0x89>
+
+		case '#':
+			altflag = 1;
+  800842:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+			goto reswitch;
+  800849:	e9 30 ff ff ff       	jmp    80077e <vprintfmt+0x89>
+			goto process_precision;
+  80084e:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  80084f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800853:	0f 89 25 ff ff ff    	jns    80077e <vprintfmt+0x89>
+				width = precision, precision = -1;
+  800859:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80085c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80085f:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+			goto reswitch;
+  800866:	e9 13 ff ff ff       	jmp    80077e <vprintfmt+0x89>
+
+		// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  80086b:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+			goto reswitch;
+  80086f:	e9 0a ff ff ff       	jmp    80077e <vprintfmt+0x89>
+
+		// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800874:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800877:	83 f8 2f             	cmp    $0x2f,%eax
+  80087a:	77 17                	ja     800893 <vprintfmt+0x19e>
+  80087c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800880:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800883:	89 d2                	mov    %edx,%edx
+  800885:	48 01 d0             	add    %rdx,%rax
+  800888:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80088b:	83 c2 08             	add    $0x8,%edx
+  80088e:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800891:	eb 0c                	jmp    80089f <vprintfmt+0x1aa>
+  800893:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800897:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80089b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80089f:	8b 00                	mov    (%rax),%eax
+  8008a1:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8008a5:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8008a9:	48 89 d6             	mov    %rdx,%rsi
+  8008ac:	89 c7                	mov    %eax,%edi
+  8008ae:	ff d1                	call   *%rcx
+			break;
+  8008b0:	e9 37 03 00 00       	jmp    800bec <vprintfmt+0x4f7>
+
+		// error message
+		case 'e':
+			err = va_arg(aq, int);
+  8008b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8008bb:	77 17                	ja     8008d4 <vprintfmt+0x1df>
+  8008bd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8008c1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008c4:	89 d2                	mov    %edx,%edx
+  8008c6:	48 01 d0             	add    %rdx,%rax
+  8008c9:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008cc:	83 c2 08             	add    $0x8,%edx
+  8008cf:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8008d2:	eb 0c                	jmp    8008e0 <vprintfmt+0x1eb>
+  8008d4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8008d8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8008dc:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8008e0:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  8008e2:	85 db                	test   %ebx,%ebx
+  8008e4:	79 02                	jns    8008e8 <vprintfmt+0x1f3>
+				err = -err;
+  8008e6:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8008e8:	83 fb 11             	cmp    $0x11,%ebx
+  8008eb:	7f 16                	jg     800903 <vprintfmt+0x20e>
+  8008ed:	48 ba c0 41 80 00 00 	movabs $0x8041c0,%rdx
+  8008f4:	00 00 00 
+  8008f7:	48 63 c3             	movslq %ebx,%rax
+  8008fa:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  8008fe:	4d 85 e4             	test   %r12,%r12
+  800901:	75 2e                	jne    800931 <vprintfmt+0x23c>
+				printfmt(putch, putdat, "error %d", err);
+  800903:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800907:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80090b:	89 d9                	mov    %ebx,%ecx
+  80090d:	48 ba 61 42 80 00 00 	movabs $0x804261,%rdx
+  800914:	00 00 00 
+  800917:	48 89 c7             	mov    %rax,%rdi
+  80091a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80091f:	49 b8 fb 0b 80 00 00 	movabs $0x800bfb,%r8
+  800926:	00 00 00 
+  800929:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  80092c:	e9 bb 02 00 00       	jmp    800bec <vprintfmt+0x4f7>
+				printfmt(putch, putdat, "%s", p);
+  800931:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800935:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800939:	4c 89 e1             	mov    %r12,%rcx
+  80093c:	48 ba 6a 42 80 00 00 	movabs $0x80426a,%rdx
+  800943:	00 00 00 
+  800946:	48 89 c7             	mov    %rax,%rdi
+  800949:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094e:	49 b8 fb 0b 80 00 00 	movabs $0x800bfb,%r8
+  800955:	00 00 00 
+  800958:	41 ff d0             	call   *%r8
+			break;
+  80095b:	e9 8c 02 00 00       	jmp    800bec <vprintfmt+0x4f7>
+
+		// string
+		case 's':
+			// 从可变参数中读入字符串指针
+			if ((p = va_arg(aq, char *)) == NULL)
+  800960:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800963:	83 f8 2f             	cmp    $0x2f,%eax
+  800966:	77 17                	ja     80097f <vprintfmt+0x28a>
+  800968:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80096c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80096f:	89 d2                	mov    %edx,%edx
+  800971:	48 01 d0             	add    %rdx,%rax
+  800974:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800977:	83 c2 08             	add    $0x8,%edx
+  80097a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80097d:	eb 0c                	jmp    80098b <vprintfmt+0x296>
+  80097f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800983:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800987:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80098b:	4c 8b 20             	mov    (%rax),%r12
+  80098e:	4d 85 e4             	test   %r12,%r12
+  800991:	75 0a                	jne    80099d <vprintfmt+0x2a8>
+				p = "(null)"; // 当字符串为空时，将它指向"(null)"字符串
+  800993:	49 bc 6d 42 80 00 00 	movabs $0x80426d,%r12
+  80099a:	00 00 00 
+			// 判断左对齐还是右对齐，pad='-'左对齐，否则右对齐
+			if (width > 0 && padc != '-')
+  80099d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8009a1:	7e 78                	jle    800a1b <vprintfmt+0x326>
+  8009a3:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  8009a7:	74 72                	je     800a1b <vprintfmt+0x326>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009a9:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8009ac:	48 98                	cltq
+  8009ae:	48 89 c6             	mov    %rax,%rsi
+  8009b1:	4c 89 e7             	mov    %r12,%rdi
+  8009b4:	48 b8 a0 0f 80 00 00 	movabs $0x800fa0,%rax
+  8009bb:	00 00 00 
+  8009be:	ff d0                	call   *%rax
+  8009c0:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  8009c3:	eb 17                	jmp    8009dc <vprintfmt+0x2e7>
+					putch(padc, putdat); // 字符串右对齐，左边补相应数量(width-实际长度)的空格或者 0
+  8009c5:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  8009c9:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8009cd:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8009d1:	48 89 d6             	mov    %rdx,%rsi
+  8009d4:	89 c7                	mov    %eax,%edi
+  8009d6:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009d8:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8009dc:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8009e0:	7f e3                	jg     8009c5 <vprintfmt+0x2d0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8009e2:	eb 37                	jmp    800a1b <vprintfmt+0x326>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8009e4:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8009e8:	74 1e                	je     800a08 <vprintfmt+0x313>
+  8009ea:	83 fb 1f             	cmp    $0x1f,%ebx
+  8009ed:	7e 05                	jle    8009f4 <vprintfmt+0x2ff>
+  8009ef:	83 fb 7e             	cmp    $0x7e,%ebx
+  8009f2:	7e 14                	jle    800a08 <vprintfmt+0x313>
+					putch('?', putdat);
+  8009f4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009f8:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009fc:	48 89 c6             	mov    %rax,%rsi
+  8009ff:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a04:	ff d2                	call   *%rdx
+  800a06:	eb 0f                	jmp    800a17 <vprintfmt+0x322>
+				else
+					putch(ch, putdat); // 打印相应长度的字符串
+  800a08:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a0c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a10:	48 89 c6             	mov    %rax,%rsi
+  800a13:	89 df                	mov    %ebx,%edi
+  800a15:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a17:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800a1b:	4c 89 e0             	mov    %r12,%rax
+  800a1e:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800a22:	0f b6 00             	movzbl (%rax),%eax
+  800a25:	0f be d8             	movsbl %al,%ebx
+  800a28:	85 db                	test   %ebx,%ebx
+  800a2a:	74 28                	je     800a54 <vprintfmt+0x35f>
+  800a2c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800a30:	78 b2                	js     8009e4 <vprintfmt+0x2ef>
+  800a32:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800a36:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800a3a:	79 a8                	jns    8009e4 <vprintfmt+0x2ef>
+			for (; width > 0; width--)
+  800a3c:	eb 16                	jmp    800a54 <vprintfmt+0x35f>
+				putch(' ', putdat); // 当字符串是左对齐的时候打印相应数量的空格
+  800a3e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a42:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a46:	48 89 c6             	mov    %rax,%rsi
+  800a49:	bf 20 00 00 00       	mov    $0x20,%edi
+  800a4e:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800a50:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800a54:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a58:	7f e4                	jg     800a3e <vprintfmt+0x349>
+			break;
+  800a5a:	e9 8d 01 00 00       	jmp    800bec <vprintfmt+0x4f7>
+
+		// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800a5f:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a63:	be 03 00 00 00       	mov    $0x3,%esi
+  800a68:	48 89 c7             	mov    %rax,%rdi
+  800a6b:	48 b8 ee 05 80 00 00 	movabs $0x8005ee,%rax
+  800a72:	00 00 00 
+  800a75:	ff d0                	call   *%rax
+  800a77:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((long long)num < 0)
+  800a7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a7f:	48 85 c0             	test   %rax,%rax
+  800a82:	79 1d                	jns    800aa1 <vprintfmt+0x3ac>
+			{
+				putch('-', putdat);
+  800a84:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a88:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a8c:	48 89 c6             	mov    %rax,%rsi
+  800a8f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a94:	ff d2                	call   *%rdx
+				num = -(long long)num;
+  800a96:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a9a:	48 f7 d8             	neg    %rax
+  800a9d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			}
+			base = 10;
+  800aa1:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800aa8:	e9 d2 00 00 00       	jmp    800b7f <vprintfmt+0x48a>
+
+		// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800aad:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800ab1:	be 03 00 00 00       	mov    $0x3,%esi
+  800ab6:	48 89 c7             	mov    %rax,%rdi
+  800ab9:	48 b8 e7 04 80 00 00 	movabs $0x8004e7,%rax
+  800ac0:	00 00 00 
+  800ac3:	ff d0                	call   *%rax
+  800ac5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 10;
+  800ac9:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800ad0:	e9 aa 00 00 00       	jmp    800b7f <vprintfmt+0x48a>
+		// (unsigned) octal
+		case 'o':
+			// Gets the variable argument with type integer from the point which was processed last by va_arg
+			// calls getuint which returns a long long value, which then calls printnum which prints based on
+			// base value.
+			num = getuint(&aq, 3);
+  800ad5:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800ad9:	be 03 00 00 00       	mov    $0x3,%esi
+  800ade:	48 89 c7             	mov    %rax,%rdi
+  800ae1:	48 b8 e7 04 80 00 00 	movabs $0x8004e7,%rax
+  800ae8:	00 00 00 
+  800aeb:	ff d0                	call   *%rax
+  800aed:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 8;
+  800af1:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+			goto number;
+  800af8:	e9 82 00 00 00       	jmp    800b7f <vprintfmt+0x48a>
+
+		// pointer
+		case 'p':
+			putch('0', putdat);
+  800afd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b01:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b05:	48 89 c6             	mov    %rax,%rsi
+  800b08:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b0d:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800b0f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b13:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b17:	48 89 c6             	mov    %rax,%rsi
+  800b1a:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b1f:	ff d2                	call   *%rdx
+			num = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800b21:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b24:	83 f8 2f             	cmp    $0x2f,%eax
+  800b27:	77 17                	ja     800b40 <vprintfmt+0x44b>
+  800b29:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b2d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b30:	89 d2                	mov    %edx,%edx
+  800b32:	48 01 d0             	add    %rdx,%rax
+  800b35:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b38:	83 c2 08             	add    $0x8,%edx
+  800b3b:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b3e:	eb 0c                	jmp    800b4c <vprintfmt+0x457>
+  800b40:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b44:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b48:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b4c:	48 8b 00             	mov    (%rax),%rax
+  800b4f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800b53:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+			goto number;
+  800b5a:	eb 23                	jmp    800b7f <vprintfmt+0x48a>
+
+		// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800b5c:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b60:	be 03 00 00 00       	mov    $0x3,%esi
+  800b65:	48 89 c7             	mov    %rax,%rdi
+  800b68:	48 b8 e7 04 80 00 00 	movabs $0x8004e7,%rax
+  800b6f:	00 00 00 
+  800b72:	ff d0                	call   *%rax
+  800b74:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800b78:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800b7f:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800b84:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800b87:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800b8a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b8e:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800b92:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b96:	45 89 c1             	mov    %r8d,%r9d
+  800b99:	41 89 f8             	mov    %edi,%r8d
+  800b9c:	48 89 c7             	mov    %rax,%rdi
+  800b9f:	48 b8 2f 04 80 00 00 	movabs $0x80042f,%rax
+  800ba6:	00 00 00 
+  800ba9:	ff d0                	call   *%rax
+			break;
+  800bab:	eb 3f                	jmp    800bec <vprintfmt+0x4f7>
+
+		// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800bad:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bb1:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800bb5:	48 89 c6             	mov    %rax,%rsi
+  800bb8:	89 df                	mov    %ebx,%edi
+  800bba:	ff d2                	call   *%rdx
+			break;
+  800bbc:	eb 2e                	jmp    800bec <vprintfmt+0x4f7>
+
+		// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800bbe:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bc2:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800bc6:	48 89 c6             	mov    %rax,%rsi
+  800bc9:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bce:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800bd0:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800bd5:	eb 05                	jmp    800bdc <vprintfmt+0x4e7>
+  800bd7:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800bdc:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800be0:	48 83 e8 01          	sub    $0x1,%rax
+  800be4:	0f b6 00             	movzbl (%rax),%eax
+  800be7:	3c 25                	cmp    $0x25,%al
+  800be9:	75 ec                	jne    800bd7 <vprintfmt+0x4e2>
+				/* do nothing */;
+			break;
+  800beb:	90                   	nop
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800bec:	e9 56 fb ff ff       	jmp    800747 <vprintfmt+0x52>
+				return;
+  800bf1:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800bf2:	48 83 c4 60          	add    $0x60,%rsp
+  800bf6:	5b                   	pop    %rbx
+  800bf7:	41 5c                	pop    %r12
+  800bf9:	5d                   	pop    %rbp
+  800bfa:	c3                   	ret
+
+0000000000800bfb <printfmt>:
+
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...)
+{
+  800bfb:	55                   	push   %rbp
+  800bfc:	48 89 e5             	mov    %rsp,%rbp
+  800bff:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800c06:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800c0d:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800c14:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800c1b:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800c22:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800c29:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800c30:	84 c0                	test   %al,%al
+  800c32:	74 20                	je     800c54 <printfmt+0x59>
+  800c34:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800c38:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800c3c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800c40:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800c44:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800c48:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800c4c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800c50:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800c54:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800c5b:	00 00 00 
+  800c5e:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800c65:	00 00 00 
+  800c68:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c6c:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800c73:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800c7a:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800c81:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800c88:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800c8f:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800c96:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800c9d:	48 89 c7             	mov    %rax,%rdi
+  800ca0:	48 b8 f5 06 80 00 00 	movabs $0x8006f5,%rax
+  800ca7:	00 00 00 
+  800caa:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  800cac:	90                   	nop
+  800cad:	c9                   	leave
+  800cae:	c3                   	ret
+
+0000000000800caf <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800caf:	55                   	push   %rbp
+  800cb0:	48 89 e5             	mov    %rsp,%rbp
+  800cb3:	48 83 ec 10          	sub    $0x10,%rsp
+  800cb7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800cba:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  800cbe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800cc2:	8b 40 10             	mov    0x10(%rax),%eax
+  800cc5:	8d 50 01             	lea    0x1(%rax),%edx
+  800cc8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ccc:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  800ccf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800cd3:	48 8b 10             	mov    (%rax),%rdx
+  800cd6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800cda:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800cde:	48 39 c2             	cmp    %rax,%rdx
+  800ce1:	73 17                	jae    800cfa <sprintputch+0x4b>
+		*b->buf++ = ch;
+  800ce3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ce7:	48 8b 00             	mov    (%rax),%rax
+  800cea:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800cee:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800cf2:	48 89 0a             	mov    %rcx,(%rdx)
+  800cf5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800cf8:	88 10                	mov    %dl,(%rax)
+}
+  800cfa:	90                   	nop
+  800cfb:	c9                   	leave
+  800cfc:	c3                   	ret
+
+0000000000800cfd <vsnprintf>:
+
+int vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800cfd:	55                   	push   %rbp
+  800cfe:	48 89 e5             	mov    %rsp,%rbp
+  800d01:	48 83 ec 50          	sub    $0x50,%rsp
+  800d05:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  800d09:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  800d0c:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  800d10:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+	va_list aq;
+	va_copy(aq, ap);
+  800d14:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800d18:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800d1c:	48 8b 06             	mov    (%rsi),%rax
+  800d1f:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800d23:	48 89 01             	mov    %rax,(%rcx)
+  800d26:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d2a:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800d2e:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	struct sprintbuf b = {buf, buf + n - 1, 0};
+  800d32:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d36:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800d3a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  800d3d:	48 98                	cltq
+  800d3f:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800d43:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d47:	48 01 d0             	add    %rdx,%rax
+  800d4a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  800d4e:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+
+	if (buf == NULL || n < 1)
+  800d55:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800d5a:	74 06                	je     800d62 <vsnprintf+0x65>
+  800d5c:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800d60:	7f 07                	jg     800d69 <vsnprintf+0x6c>
+		return -E_INVAL;
+  800d62:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d67:	eb 32                	jmp    800d9b <vsnprintf+0x9e>
+
+	// print the string to the buffer
+	vprintfmt((void *)sprintputch, &b, fmt, aq);
+  800d69:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800d6d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  800d71:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d75:	48 89 c6             	mov    %rax,%rsi
+  800d78:	48 b8 af 0c 80 00 00 	movabs $0x800caf,%rax
+  800d7f:	00 00 00 
+  800d82:	48 89 c7             	mov    %rax,%rdi
+  800d85:	48 b8 f5 06 80 00 00 	movabs $0x8006f5,%rax
+  800d8c:	00 00 00 
+  800d8f:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  800d91:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d95:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800d98:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  800d9b:	c9                   	leave
+  800d9c:	c3                   	ret
+
+0000000000800d9d <snprintf>:
+
+int snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800d9d:	55                   	push   %rbp
+  800d9e:	48 89 e5             	mov    %rsp,%rbp
+  800da1:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800da8:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800daf:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800db5:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800dbc:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800dc3:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800dca:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800dd1:	84 c0                	test   %al,%al
+  800dd3:	74 20                	je     800df5 <snprintf+0x58>
+  800dd5:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800dd9:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800ddd:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800de1:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800de5:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800de9:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800ded:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800df1:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  800df5:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800dfc:	00 00 00 
+  800dff:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800e06:	00 00 00 
+  800e09:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e0d:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800e14:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800e1b:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq, ap);
+  800e22:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800e29:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800e30:	48 8b 06             	mov    (%rsi),%rax
+  800e33:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800e37:	48 89 01             	mov    %rax,(%rcx)
+  800e3a:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800e3e:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800e42:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  800e46:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800e4d:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  800e54:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  800e5a:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800e61:	48 89 c7             	mov    %rax,%rdi
+  800e64:	48 b8 fd 0c 80 00 00 	movabs $0x800cfd,%rax
+  800e6b:	00 00 00 
+  800e6e:	ff d0                	call   *%rax
+  800e70:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  800e76:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800e7c:	c9                   	leave
+  800e7d:	c3                   	ret
+
+0000000000800e7e <cpuid>:
+#define read_rip(var) __asm __volatile("leaq (%%rip), %0" : "=r" (var)::"cc","memory")
+
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800e7e:	55                   	push   %rbp
+  800e7f:	48 89 e5             	mov    %rsp,%rbp
+  800e82:	53                   	push   %rbx
+  800e83:	48 83 ec 38          	sub    $0x38,%rsp
+  800e87:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800e8a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800e8e:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800e92:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800e96:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid" 
+  800e9a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800e9d:	0f a2                	cpuid
+  800e9f:	89 de                	mov    %ebx,%esi
+  800ea1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800ea4:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800ea7:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800eaa:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info));
+	if (eaxp)
+  800ead:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800eb2:	74 09                	je     800ebd <cpuid+0x3f>
+		*eaxp = eax;
+  800eb4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800eb8:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800ebb:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  800ebd:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800ec2:	74 09                	je     800ecd <cpuid+0x4f>
+		*ebxp = ebx;
+  800ec4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ec8:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800ecb:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  800ecd:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800ed2:	74 09                	je     800edd <cpuid+0x5f>
+		*ecxp = ecx;
+  800ed4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ed8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800edb:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  800edd:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800ee2:	74 09                	je     800eed <cpuid+0x6f>
+		*edxp = edx;
+  800ee4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800ee8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800eeb:	89 10                	mov    %edx,(%rax)
+}
+  800eed:	90                   	nop
+  800eee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ef2:	c9                   	leave
+  800ef3:	c3                   	ret
+
+0000000000800ef4 <cpuid_count>:
+
+// 带子功能号(%ecx = count)的 cpuid，用于 leaf 4/7/0xB/0xD 等
+static __inline void
+cpuid_count(uint32_t info, uint32_t count, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800ef4:	55                   	push   %rbp
+  800ef5:	48 89 e5             	mov    %rsp,%rbp
+  800ef8:	53                   	push   %rbx
+  800ef9:	48 83 ec 38          	sub    $0x38,%rsp
+  800efd:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800f00:	89 75 e0             	mov    %esi,-0x20(%rbp)
+  800f03:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800f07:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  800f0b:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+  800f0f:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800f13:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800f16:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800f19:	89 d1                	mov    %edx,%ecx
+  800f1b:	0f a2                	cpuid
+  800f1d:	89 de                	mov    %ebx,%esi
+  800f1f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800f22:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800f25:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800f28:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info), "c" (count));
+	if (eaxp)
+  800f2b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800f30:	74 09                	je     800f3b <cpuid_count+0x47>
+		*eaxp = eax;
+  800f32:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f36:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800f39:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  800f3b:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800f40:	74 09                	je     800f4b <cpuid_count+0x57>
+		*ebxp = ebx;
+  800f42:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f46:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800f49:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  800f4b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800f50:	74 09                	je     800f5b <cpuid_count+0x67>
+		*ecxp = ecx;
+  800f52:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f56:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800f59:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  800f5b:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800f60:	74 09                	je     800f6b <cpuid_count+0x77>
+		*edxp = edx;
+  800f62:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800f66:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800f69:	89 10                	mov    %edx,(%rax)
+}
+  800f6b:	90                   	nop
+  800f6c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f70:	c9                   	leave
+  800f71:	c3                   	ret
+
+0000000000800f72 <strlen>:
+// 在真正的硬件上会有一定程度的优化, 但在 Bochs 上会有更大的优化效果
+// 用这种方法, Primespipe 的运行速度快了3倍
+#define ASM 1
+
+int strlen(const char *s)
+{
+  800f72:	55                   	push   %rbp
+  800f73:	48 89 e5             	mov    %rsp,%rbp
+  800f76:	48 83 ec 18          	sub    $0x18,%rsp
+  800f7a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800f7e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800f85:	eb 09                	jmp    800f90 <strlen+0x1e>
+		n++;
+  800f87:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  800f8b:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800f90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f94:	0f b6 00             	movzbl (%rax),%eax
+  800f97:	84 c0                	test   %al,%al
+  800f99:	75 ec                	jne    800f87 <strlen+0x15>
+	return n;
+  800f9b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800f9e:	c9                   	leave
+  800f9f:	c3                   	ret
+
+0000000000800fa0 <strnlen>:
+
+int strnlen(const char *s, size_t size)
+{
+  800fa0:	55                   	push   %rbp
+  800fa1:	48 89 e5             	mov    %rsp,%rbp
+  800fa4:	48 83 ec 20          	sub    $0x20,%rsp
+  800fa8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800fac:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800fb0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800fb7:	eb 0e                	jmp    800fc7 <strnlen+0x27>
+		n++;
+  800fb9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800fbd:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800fc2:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  800fc7:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800fcc:	74 0b                	je     800fd9 <strnlen+0x39>
+  800fce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fd2:	0f b6 00             	movzbl (%rax),%eax
+  800fd5:	84 c0                	test   %al,%al
+  800fd7:	75 e0                	jne    800fb9 <strnlen+0x19>
+	return n;
+  800fd9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800fdc:	c9                   	leave
+  800fdd:	c3                   	ret
+
+0000000000800fde <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800fde:	55                   	push   %rbp
+  800fdf:	48 89 e5             	mov    %rsp,%rbp
+  800fe2:	48 83 ec 20          	sub    $0x20,%rsp
+  800fe6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800fea:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  800fee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ff2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  800ff6:	90                   	nop
+  800ff7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800ffb:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  800fff:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801003:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801007:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80100b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80100f:	0f b6 12             	movzbl (%rdx),%edx
+  801012:	88 10                	mov    %dl,(%rax)
+  801014:	0f b6 00             	movzbl (%rax),%eax
+  801017:	84 c0                	test   %al,%al
+  801019:	75 dc                	jne    800ff7 <strcpy+0x19>
+		/* do nothing */;
+	return ret;
+  80101b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80101f:	c9                   	leave
+  801020:	c3                   	ret
+
+0000000000801021 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801021:	55                   	push   %rbp
+  801022:	48 89 e5             	mov    %rsp,%rbp
+  801025:	48 83 ec 20          	sub    $0x20,%rsp
+  801029:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80102d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int len = strlen(dst);
+  801031:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801035:	48 89 c7             	mov    %rax,%rdi
+  801038:	48 b8 72 0f 80 00 00 	movabs $0x800f72,%rax
+  80103f:	00 00 00 
+  801042:	ff d0                	call   *%rax
+  801044:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	strcpy(dst + len, src);
+  801047:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80104a:	48 63 d0             	movslq %eax,%rdx
+  80104d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801051:	48 01 c2             	add    %rax,%rdx
+  801054:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801058:	48 89 c6             	mov    %rax,%rsi
+  80105b:	48 89 d7             	mov    %rdx,%rdi
+  80105e:	48 b8 de 0f 80 00 00 	movabs $0x800fde,%rax
+  801065:	00 00 00 
+  801068:	ff d0                	call   *%rax
+	return dst;
+  80106a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80106e:	c9                   	leave
+  80106f:	c3                   	ret
+
+0000000000801070 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  801070:	55                   	push   %rbp
+  801071:	48 89 e5             	mov    %rsp,%rbp
+  801074:	48 83 ec 28          	sub    $0x28,%rsp
+  801078:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80107c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801080:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801084:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801088:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++)
+  80108c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801093:	00 
+  801094:	eb 2a                	jmp    8010c0 <strncpy+0x50>
+	{
+		*dst++ = *src;
+  801096:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80109a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80109e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8010a2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8010a6:	0f b6 12             	movzbl (%rdx),%edx
+  8010a9:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  8010ab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8010af:	0f b6 00             	movzbl (%rax),%eax
+  8010b2:	84 c0                	test   %al,%al
+  8010b4:	74 05                	je     8010bb <strncpy+0x4b>
+			src++;
+  8010b6:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++)
+  8010bb:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8010c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010c4:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8010c8:	72 cc                	jb     801096 <strncpy+0x26>
+	}
+	return ret;
+  8010ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8010ce:	c9                   	leave
+  8010cf:	c3                   	ret
+
+00000000008010d0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8010d0:	55                   	push   %rbp
+  8010d1:	48 89 e5             	mov    %rsp,%rbp
+  8010d4:	48 83 ec 28          	sub    $0x28,%rsp
+  8010d8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8010dc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8010e0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  8010e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010e8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0)
+  8010ec:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8010f1:	74 3d                	je     801130 <strlcpy+0x60>
+	{
+		while (--size > 0 && *src != '\0')
+  8010f3:	eb 1d                	jmp    801112 <strlcpy+0x42>
+			*dst++ = *src++;
+  8010f5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8010f9:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8010fd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801101:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801105:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801109:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80110d:	0f b6 12             	movzbl (%rdx),%edx
+  801110:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801112:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801117:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80111c:	74 0b                	je     801129 <strlcpy+0x59>
+  80111e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801122:	0f b6 00             	movzbl (%rax),%eax
+  801125:	84 c0                	test   %al,%al
+  801127:	75 cc                	jne    8010f5 <strlcpy+0x25>
+		*dst = '\0';
+  801129:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80112d:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801130:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801134:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801138:	c9                   	leave
+  801139:	c3                   	ret
+
+000000000080113a <strcmp>:
+
+int strcmp(const char *p, const char *q)
+{
+  80113a:	55                   	push   %rbp
+  80113b:	48 89 e5             	mov    %rsp,%rbp
+  80113e:	48 83 ec 10          	sub    $0x10,%rsp
+  801142:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801146:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  80114a:	eb 0a                	jmp    801156 <strcmp+0x1c>
+		p++, q++;
+  80114c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801151:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801156:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80115a:	0f b6 00             	movzbl (%rax),%eax
+  80115d:	84 c0                	test   %al,%al
+  80115f:	74 12                	je     801173 <strcmp+0x39>
+  801161:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801165:	0f b6 10             	movzbl (%rax),%edx
+  801168:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80116c:	0f b6 00             	movzbl (%rax),%eax
+  80116f:	38 c2                	cmp    %al,%dl
+  801171:	74 d9                	je     80114c <strcmp+0x12>
+	return (int)((unsigned char)*p - (unsigned char)*q);
+  801173:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801177:	0f b6 00             	movzbl (%rax),%eax
+  80117a:	0f b6 d0             	movzbl %al,%edx
+  80117d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801181:	0f b6 00             	movzbl (%rax),%eax
+  801184:	0f b6 c0             	movzbl %al,%eax
+  801187:	29 c2                	sub    %eax,%edx
+  801189:	89 d0                	mov    %edx,%eax
+}
+  80118b:	c9                   	leave
+  80118c:	c3                   	ret
+
+000000000080118d <strncmp>:
+
+int strncmp(const char *p, const char *q, size_t n)
+{
+  80118d:	55                   	push   %rbp
+  80118e:	48 89 e5             	mov    %rsp,%rbp
+  801191:	48 83 ec 18          	sub    $0x18,%rsp
+  801195:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801199:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80119d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8011a1:	eb 0f                	jmp    8011b2 <strncmp+0x25>
+		n--, p++, q++;
+  8011a3:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8011a8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8011ad:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8011b2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8011b7:	74 1d                	je     8011d6 <strncmp+0x49>
+  8011b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011bd:	0f b6 00             	movzbl (%rax),%eax
+  8011c0:	84 c0                	test   %al,%al
+  8011c2:	74 12                	je     8011d6 <strncmp+0x49>
+  8011c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011c8:	0f b6 10             	movzbl (%rax),%edx
+  8011cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011cf:	0f b6 00             	movzbl (%rax),%eax
+  8011d2:	38 c2                	cmp    %al,%dl
+  8011d4:	74 cd                	je     8011a3 <strncmp+0x16>
+	if (n == 0)
+  8011d6:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8011db:	75 07                	jne    8011e4 <strncmp+0x57>
+		return 0;
+  8011dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e2:	eb 16                	jmp    8011fa <strncmp+0x6d>
+	else
+		return (int)((unsigned char)*p - (unsigned char)*q);
+  8011e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011e8:	0f b6 00             	movzbl (%rax),%eax
+  8011eb:	0f b6 d0             	movzbl %al,%edx
+  8011ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011f2:	0f b6 00             	movzbl (%rax),%eax
+  8011f5:	0f b6 c0             	movzbl %al,%eax
+  8011f8:	29 c2                	sub    %eax,%edx
+}
+  8011fa:	89 d0                	mov    %edx,%eax
+  8011fc:	c9                   	leave
+  8011fd:	c3                   	ret
+
+00000000008011fe <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8011fe:	55                   	push   %rbp
+  8011ff:	48 89 e5             	mov    %rsp,%rbp
+  801202:	48 83 ec 10          	sub    $0x10,%rsp
+  801206:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80120a:	89 f0                	mov    %esi,%eax
+  80120c:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80120f:	eb 17                	jmp    801228 <strchr+0x2a>
+		if (*s == c)
+  801211:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801215:	0f b6 00             	movzbl (%rax),%eax
+  801218:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80121b:	75 06                	jne    801223 <strchr+0x25>
+			return (char *)s;
+  80121d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801221:	eb 15                	jmp    801238 <strchr+0x3a>
+	for (; *s; s++)
+  801223:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801228:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80122c:	0f b6 00             	movzbl (%rax),%eax
+  80122f:	84 c0                	test   %al,%al
+  801231:	75 de                	jne    801211 <strchr+0x13>
+	return 0;
+  801233:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801238:	c9                   	leave
+  801239:	c3                   	ret
+
+000000000080123a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80123a:	55                   	push   %rbp
+  80123b:	48 89 e5             	mov    %rsp,%rbp
+  80123e:	48 83 ec 10          	sub    $0x10,%rsp
+  801242:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801246:	89 f0                	mov    %esi,%eax
+  801248:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80124b:	eb 11                	jmp    80125e <strfind+0x24>
+		if (*s == c)
+  80124d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801251:	0f b6 00             	movzbl (%rax),%eax
+  801254:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801257:	74 12                	je     80126b <strfind+0x31>
+	for (; *s; s++)
+  801259:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80125e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801262:	0f b6 00             	movzbl (%rax),%eax
+  801265:	84 c0                	test   %al,%al
+  801267:	75 e4                	jne    80124d <strfind+0x13>
+  801269:	eb 01                	jmp    80126c <strfind+0x32>
+			break;
+  80126b:	90                   	nop
+	return (char *)s;
+  80126c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801270:	c9                   	leave
+  801271:	c3                   	ret
+
+0000000000801272 <mem_init>:
+};
+
+static int mem_features;
+
+void mem_init(void)
+{
+  801272:	55                   	push   %rbp
+  801273:	48 89 e5             	mov    %rsp,%rbp
+  801276:	48 83 ec 10          	sub    $0x10,%rsp
+	uint32_t max, ebx, edx;
+
+	mem_features = 0;
+  80127a:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801281:	00 00 00 
+  801284:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	cpuid(0, &max, NULL, NULL, NULL);
+  80128a:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+  80128e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801294:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801299:	ba 00 00 00 00       	mov    $0x0,%edx
+  80129e:	48 89 c6             	mov    %rax,%rsi
+  8012a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012a6:	48 b8 7e 0e 80 00 00 	movabs $0x800e7e,%rax
+  8012ad:	00 00 00 
+  8012b0:	ff d0                	call   *%rax
+	cpuid(1, NULL, NULL, NULL, &edx);
+  8012b2:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  8012b6:	49 89 c0             	mov    %rax,%r8
+  8012b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8012cd:	48 b8 7e 0e 80 00 00 	movabs $0x800e7e,%rax
+  8012d4:	00 00 00 
+  8012d7:	ff d0                	call   *%rax
+	if (edx & (1 << 26))
+  8012d9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8012dc:	25 00 00 00 04       	and    $0x4000000,%eax
+  8012e1:	85 c0                	test   %eax,%eax
+  8012e3:	74 1d                	je     801302 <mem_init+0x90>
+		mem_features |= MEM_F_NT;
+  8012e5:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  8012ec:	00 00 00 
+  8012ef:	8b 00                	mov    (%rax),%eax
+  8012f1:	83 c8 02             	or     $0x2,%eax
+  8012f4:	89 c2                	mov    %eax,%edx
+  8012f6:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  8012fd:	00 00 00 
+  801300:	89 10                	mov    %edx,(%rax)
+	if (max >= 7)
+  801302:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801305:	83 f8 06             	cmp    $0x6,%eax
+  801308:	76 57                	jbe    801361 <mem_init+0xef>
+	{
+		cpuid_count(7, 0, NULL, &ebx, NULL, NULL);
+  80130a:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  80130e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801314:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80131a:	48 89 c1             	mov    %rax,%rcx
+  80131d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801322:	be 00 00 00 00       	mov    $0x0,%esi
+  801327:	bf 07 00 00 00       	mov    $0x7,%edi
+  80132c:	48 b8 f4 0e 80 00 00 	movabs $0x800ef4,%rax
+  801333:	00 00 00 
+  801336:	ff d0                	call   *%rax
+		if (ebx & (1 << 9))
+  801338:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80133b:	25 00 02 00 00       	and    $0x200,%eax
+  801340:	85 c0                	test   %eax,%eax
+  801342:	74 1d                	je     801361 <mem_init+0xef>
+			mem_features |= MEM_F_ERMS;
+  801344:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80134b:	00 00 00 
+  80134e:	8b 00                	mov    (%rax),%eax
+  801350:	83 c8 01             	or     $0x1,%eax
+  801353:	89 c2                	mov    %eax,%edx
+  801355:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80135c:	00 00 00 
+  80135f:	89 10                	mov    %edx,(%rax)
+	}
+}
+  801361:	90                   	nop
+  801362:	c9                   	leave
+  801363:	c3                   	ret
+
+0000000000801364 <memset_nt>:
+
+// 非临时存储填充 n 字节(v 8 字节对齐，n 为 32 的倍数)
+static void
+memset_nt(void *v, uint64_t pattern, size_t n)
+{
+  801364:	55                   	push   %rbp
+  801365:	48 89 e5             	mov    %rsp,%rbp
+  801368:	48 83 ec 28          	sub    $0x28,%rsp
+  80136c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801370:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801374:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t *p = (uint64_t *)v;
+  801378:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80137c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint64_t *end = p + n / 8;
+  801380:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801384:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  801388:	48 89 c2             	mov    %rax,%rdx
+  80138b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80138f:	48 01 d0             	add    %rdx,%rax
+  801392:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	for (; p < end; p += 4)
+  801396:	eb 20                	jmp    8013b8 <memset_nt+0x54>
+		asm volatile("movnti %1, 0(%0)\n\t"
+  801398:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80139c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8013a0:	48 0f c3 10          	movnti %rdx,(%rax)
+  8013a4:	48 0f c3 50 08       	movnti %rdx,0x8(%rax)
+  8013a9:	48 0f c3 50 10       	movnti %rdx,0x10(%rax)
+  8013ae:	48 0f c3 50 18       	movnti %rdx,0x18(%rax)
+	for (; p < end; p += 4)
+  8013b3:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  8013b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013bc:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8013c0:	72 d6                	jb     801398 <memset_nt+0x34>
+					 "movnti %1, 16(%0)\n\t"
+					 "movnti %1, 24(%0)"
+					 :
+					 : "r"(p), "r"(pattern)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  8013c2:	0f ae f8             	sfence
+}
+  8013c5:	90                   	nop
+  8013c6:	c9                   	leave
+  8013c7:	c3                   	ret
+
+00000000008013c8 <memcpy_nt>:
+
+// 非临时存储复制 n 字节(dst/src 8 字节对齐且不重叠，n 为 32 的倍数)
+static void
+memcpy_nt(void *dst, const void *src, size_t n)
+{
+  8013c8:	55                   	push   %rbp
+  8013c9:	48 89 e5             	mov    %rsp,%rbp
+  8013cc:	48 83 ec 58          	sub    $0x58,%rsp
+  8013d0:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8013d4:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8013d8:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	uint64_t *d = (uint64_t *)dst;
+  8013dc:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8013e0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint64_t *s = (const uint64_t *)src;
+  8013e4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8013e8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	uint64_t *end = d + n / 8;
+  8013ec:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8013f0:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  8013f4:	48 89 c2             	mov    %rax,%rdx
+  8013f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013fb:	48 01 d0             	add    %rdx,%rax
+  8013fe:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint64_t t0, t1, t2, t3;
+
+	for (; d < end; d += 4, s += 4)
+  801402:	eb 44                	jmp    801448 <memcpy_nt+0x80>
+		asm volatile("movq 0(%4), %0\n\t"
+  801404:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801408:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80140c:	4c 8b 00             	mov    (%rax),%r8
+  80140f:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  801413:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  801417:	48 8b 48 18          	mov    0x18(%rax),%rcx
+  80141b:	4c 0f c3 02          	movnti %r8,(%rdx)
+  80141f:	48 0f c3 7a 08       	movnti %rdi,0x8(%rdx)
+  801424:	48 0f c3 72 10       	movnti %rsi,0x10(%rdx)
+  801429:	48 0f c3 4a 18       	movnti %rcx,0x18(%rdx)
+  80142e:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  801432:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801436:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80143a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+	for (; d < end; d += 4, s += 4)
+  80143e:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  801443:	48 83 45 f0 20       	addq   $0x20,-0x10(%rbp)
+  801448:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80144c:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  801450:	72 b2                	jb     801404 <memcpy_nt+0x3c>
+					 "movnti %2, 16(%5)\n\t"
+					 "movnti %3, 24(%5)"
+					 : "=&r"(t0), "=&r"(t1), "=&r"(t2), "=&r"(t3)
+					 : "r"(s), "r"(d)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  801452:	0f ae f8             	sfence
+}
+  801455:	90                   	nop
+  801456:	c9                   	leave
+  801457:	c3                   	ret
+
+0000000000801458 <memcpy_fwd>:
+
+// 正向复制(dst 在 src 之前或两者不重叠)
+static void
+memcpy_fwd(void *dst, const void *src, size_t n)
+{
+  801458:	55                   	push   %rbp
+  801459:	48 89 e5             	mov    %rsp,%rbp
+  80145c:	48 83 ec 18          	sub    $0x18,%rsp
+  801460:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801464:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801468:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  80146c:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801473:	00 00 00 
+  801476:	8b 00                	mov    (%rax),%eax
+  801478:	83 e0 02             	and    $0x2,%eax
+  80147b:	85 c0                	test   %eax,%eax
+  80147d:	74 66                	je     8014e5 <memcpy_fwd+0x8d>
+  80147f:	48 81 7d e8 ff 0f 00 	cmpq   $0xfff,-0x18(%rbp)
+  801486:	00 
+  801487:	76 5c                	jbe    8014e5 <memcpy_fwd+0x8d>
+  801489:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80148d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801491:	48 09 d0             	or     %rdx,%rax
+  801494:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  801498:	83 e0 1f             	and    $0x1f,%eax
+  80149b:	48 85 c0             	test   %rax,%rax
+  80149e:	75 45                	jne    8014e5 <memcpy_fwd+0x8d>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  8014a0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8014a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014a8:	48 01 d0             	add    %rdx,%rax
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  8014ab:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8014af:	73 11                	jae    8014c2 <memcpy_fwd+0x6a>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  8014b1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8014b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014b9:	48 01 d0             	add    %rdx,%rax
+  8014bc:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8014c0:	72 23                	jb     8014e5 <memcpy_fwd+0x8d>
+		memcpy_nt(dst, src, n);
+  8014c2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8014c6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8014ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014ce:	48 89 ce             	mov    %rcx,%rsi
+  8014d1:	48 89 c7             	mov    %rax,%rdi
+  8014d4:	48 b8 c8 13 80 00 00 	movabs $0x8013c8,%rax
+  8014db:	00 00 00 
+  8014de:	ff d0                	call   *%rax
+  8014e0:	e9 81 00 00 00       	jmp    801566 <memcpy_fwd+0x10e>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  8014e5:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  8014ec:	00 00 00 
+  8014ef:	8b 00                	mov    (%rax),%eax
+  8014f1:	83 e0 01             	and    $0x1,%eax
+  8014f4:	85 c0                	test   %eax,%eax
+  8014f6:	74 21                	je     801519 <memcpy_fwd+0xc1>
+  8014f8:	48 81 7d e8 ff 00 00 	cmpq   $0xff,-0x18(%rbp)
+  8014ff:	00 
+  801500:	76 17                	jbe    801519 <memcpy_fwd+0xc1>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  801502:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801506:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80150a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80150e:	48 89 c7             	mov    %rax,%rdi
+  801511:	48 89 d6             	mov    %rdx,%rsi
+  801514:	fc                   	cld
+  801515:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801517:	eb 4d                	jmp    801566 <memcpy_fwd+0x10e>
+					 : "cc", "memory");
+	else if ((((uint64_t)dst | (uint64_t)src | n) & 7) == 0)
+  801519:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80151d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801521:	48 09 d0             	or     %rdx,%rax
+  801524:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  801528:	83 e0 07             	and    $0x7,%eax
+  80152b:	48 85 c0             	test   %rax,%rax
+  80152e:	75 1f                	jne    80154f <memcpy_fwd+0xf7>
+		asm volatile("cld; rep movsq\n" ::"D"(dst), "S"(src), "c"(n / 8)
+  801530:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801534:	48 c1 e8 03          	shr    $0x3,%rax
+  801538:	48 89 c1             	mov    %rax,%rcx
+  80153b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80153f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801543:	48 89 c7             	mov    %rax,%rdi
+  801546:	48 89 d6             	mov    %rdx,%rsi
+  801549:	fc                   	cld
+  80154a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+					 : "cc", "memory");
+}
+  80154d:	eb 17                	jmp    801566 <memcpy_fwd+0x10e>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  80154f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801553:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801557:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80155b:	48 89 c7             	mov    %rax,%rdi
+  80155e:	48 89 d6             	mov    %rdx,%rsi
+  801561:	fc                   	cld
+  801562:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+  801564:	eb 00                	jmp    801566 <memcpy_fwd+0x10e>
+  801566:	90                   	nop
+  801567:	c9                   	leave
+  801568:	c3                   	ret
+
+0000000000801569 <memset>:
+
+void *
+memset(void *v, int c, size_t n)
+{
+  801569:	55                   	push   %rbp
+  80156a:	48 89 e5             	mov    %rsp,%rbp
+  80156d:	48 83 ec 28          	sub    $0x28,%rsp
+  801571:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801575:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801578:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t pattern;
+
+	if (n == 0)
+  80157c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801581:	75 09                	jne    80158c <memset+0x23>
+		return v;
+  801583:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801587:	e9 dc 00 00 00       	jmp    801668 <memset+0xff>
+	c &= 0xFF;
+  80158c:	81 65 e4 ff 00 00 00 	andl   $0xff,-0x1c(%rbp)
+	pattern = (uint64_t)c * 0x0101010101010101UL;
+  801593:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801596:	48 98                	cltq
+  801598:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  80159f:	01 01 01 
+  8015a2:	48 0f af c2          	imul   %rdx,%rax
+  8015a6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)v | n) & 31) == 0)
+  8015aa:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  8015b1:	00 00 00 
+  8015b4:	8b 00                	mov    (%rax),%eax
+  8015b6:	83 e0 02             	and    $0x2,%eax
+  8015b9:	85 c0                	test   %eax,%eax
+  8015bb:	74 3a                	je     8015f7 <memset+0x8e>
+  8015bd:	48 81 7d d8 ff 0f 00 	cmpq   $0xfff,-0x28(%rbp)
+  8015c4:	00 
+  8015c5:	76 30                	jbe    8015f7 <memset+0x8e>
+  8015c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015cb:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  8015cf:	83 e0 1f             	and    $0x1f,%eax
+  8015d2:	48 85 c0             	test   %rax,%rax
+  8015d5:	75 20                	jne    8015f7 <memset+0x8e>
+		memset_nt(v, pattern, n);
+  8015d7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8015db:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8015df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015e3:	48 89 ce             	mov    %rcx,%rsi
+  8015e6:	48 89 c7             	mov    %rax,%rdi
+  8015e9:	48 b8 64 13 80 00 00 	movabs $0x801364,%rax
+  8015f0:	00 00 00 
+  8015f3:	ff d0                	call   *%rax
+  8015f5:	eb 6d                	jmp    801664 <memset+0xfb>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  8015f7:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  8015fe:	00 00 00 
+  801601:	8b 00                	mov    (%rax),%eax
+  801603:	83 e0 01             	and    $0x1,%eax
+  801606:	85 c0                	test   %eax,%eax
+  801608:	74 1d                	je     801627 <memset+0xbe>
+  80160a:	48 81 7d d8 ff 00 00 	cmpq   $0xff,-0x28(%rbp)
+  801611:	00 
+  801612:	76 13                	jbe    801627 <memset+0xbe>
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  801614:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801618:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80161b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80161f:	48 89 d7             	mov    %rdx,%rdi
+  801622:	fc                   	cld
+  801623:	f3 aa                	rep stos %al,%es:(%rdi)
+  801625:	eb 3d                	jmp    801664 <memset+0xfb>
+					 : "cc", "memory");
+	else if ((((uint64_t)v | n) & 7) == 0)
+  801627:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80162b:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  80162f:	83 e0 07             	and    $0x7,%eax
+  801632:	48 85 c0             	test   %rax,%rax
+  801635:	75 1c                	jne    801653 <memset+0xea>
+		asm volatile("cld; rep stosq\n" ::"D"(v), "a"(pattern), "c"(n / 8)
+  801637:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80163b:	48 c1 e8 03          	shr    $0x3,%rax
+  80163f:	48 89 c1             	mov    %rax,%rcx
+  801642:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801646:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80164a:	48 89 d7             	mov    %rdx,%rdi
+  80164d:	fc                   	cld
+  80164e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801651:	eb 11                	jmp    801664 <memset+0xfb>
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  801653:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801657:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80165a:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80165e:	48 89 d7             	mov    %rdx,%rdi
+  801661:	fc                   	cld
+  801662:	f3 aa                	rep stos %al,%es:(%rdi)
+					 : "cc", "memory");
+	return v;
+  801664:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801668:	c9                   	leave
+  801669:	c3                   	ret
+
+000000000080166a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80166a:	55                   	push   %rbp
+  80166b:	48 89 e5             	mov    %rsp,%rbp
+  80166e:	48 83 ec 28          	sub    $0x28,%rsp
+  801672:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801676:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80167a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  80167e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801682:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801686:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80168a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d)
+  80168e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801692:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801696:	73 7c                	jae    801714 <memmove+0xaa>
+  801698:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80169c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016a0:	48 01 d0             	add    %rdx,%rax
+  8016a3:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8016a7:	73 6b                	jae    801714 <memmove+0xaa>
+	{
+		// 重叠且 dst 在 src 之后，只能反向复制(ERMS 对反向 rep movsb 没有优化)
+		s += n;
+  8016a9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016ad:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  8016b1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016b5:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((((uint64_t)s | (uint64_t)d | n) & 7) == 0)
+  8016b9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8016bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016c1:	48 09 d0             	or     %rdx,%rax
+  8016c4:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  8016c8:	83 e0 07             	and    $0x7,%eax
+  8016cb:	48 85 c0             	test   %rax,%rax
+  8016ce:	75 24                	jne    8016f4 <memmove+0x8a>
+			asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8016d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016d4:	48 83 e8 08          	sub    $0x8,%rax
+  8016d8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8016dc:	48 83 ea 08          	sub    $0x8,%rdx
+  8016e0:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8016e4:	48 c1 e9 03          	shr    $0x3,%rcx
+  8016e8:	48 89 c7             	mov    %rax,%rdi
+  8016eb:	48 89 d6             	mov    %rdx,%rsi
+  8016ee:	fd                   	std
+  8016ef:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8016f2:	eb 1d                	jmp    801711 <memmove+0xa7>
+						 : "cc", "memory");
+		else
+			asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8016f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016f8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8016fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801700:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+  801704:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801708:	48 89 d7             	mov    %rdx,%rdi
+  80170b:	48 89 c1             	mov    %rax,%rcx
+  80170e:	fd                   	std
+  80170f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+						 : "cc", "memory");
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::
+  801711:	fc                   	cld
+  801712:	eb 25                	jmp    801739 <memmove+0xcf>
+						 : "cc");
+	}
+	else if (n)
+  801714:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801719:	74 1e                	je     801739 <memmove+0xcf>
+		memcpy_fwd(d, s, n);
+  80171b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80171f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801723:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801727:	48 89 ce             	mov    %rcx,%rsi
+  80172a:	48 89 c7             	mov    %rax,%rdi
+  80172d:	48 b8 58 14 80 00 00 	movabs $0x801458,%rax
+  801734:	00 00 00 
+  801737:	ff d0                	call   *%rax
+	return dst;
+  801739:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80173d:	c9                   	leave
+  80173e:	c3                   	ret
+
+000000000080173f <memcpy>:
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80173f:	55                   	push   %rbp
+  801740:	48 89 e5             	mov    %rsp,%rbp
+  801743:	48 83 ec 18          	sub    $0x18,%rsp
+  801747:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80174b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80174f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (n)
+  801753:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801758:	74 1e                	je     801778 <memcpy+0x39>
+		memcpy_fwd(dst, src, n);
+  80175a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80175e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801762:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801766:	48 89 ce             	mov    %rcx,%rsi
+  801769:	48 89 c7             	mov    %rax,%rdi
+  80176c:	48 b8 58 14 80 00 00 	movabs $0x801458,%rax
+  801773:	00 00 00 
+  801776:	ff d0                	call   *%rax
+	return dst;
+  801778:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80177c:	c9                   	leave
+  80177d:	c3                   	ret
+
+000000000080177e <memcmp>:
+{
+}
+#endif
+
+int memcmp(const void *v1, const void *v2, size_t n)
+{
+  80177e:	55                   	push   %rbp
+  80177f:	48 89 e5             	mov    %rsp,%rbp
+  801782:	48 83 ec 28          	sub    $0x28,%rsp
+  801786:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80178a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80178e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *)v1;
+  801792:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801796:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *)v2;
+  80179a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80179e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0)
+  8017a2:	eb 34                	jmp    8017d8 <memcmp+0x5a>
+	{
+		if (*s1 != *s2)
+  8017a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017a8:	0f b6 10             	movzbl (%rax),%edx
+  8017ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017af:	0f b6 00             	movzbl (%rax),%eax
+  8017b2:	38 c2                	cmp    %al,%dl
+  8017b4:	74 18                	je     8017ce <memcmp+0x50>
+			return (int)*s1 - (int)*s2;
+  8017b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017ba:	0f b6 00             	movzbl (%rax),%eax
+  8017bd:	0f b6 d0             	movzbl %al,%edx
+  8017c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017c4:	0f b6 00             	movzbl (%rax),%eax
+  8017c7:	0f b6 c0             	movzbl %al,%eax
+  8017ca:	29 c2                	sub    %eax,%edx
+  8017cc:	eb 20                	jmp    8017ee <memcmp+0x70>
+		s1++, s2++;
+  8017ce:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017d3:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0)
+  8017d8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017dc:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8017e0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8017e4:	48 85 c0             	test   %rax,%rax
+  8017e7:	75 bb                	jne    8017a4 <memcmp+0x26>
+	}
+
+	return 0;
+  8017e9:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  8017ee:	89 d0                	mov    %edx,%eax
+  8017f0:	c9                   	leave
+  8017f1:	c3                   	ret
+
+00000000008017f2 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8017f2:	55                   	push   %rbp
+  8017f3:	48 89 e5             	mov    %rsp,%rbp
+  8017f6:	48 83 ec 28          	sub    $0x28,%rsp
+  8017fa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017fe:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801801:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *)s + n;
+  801805:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801809:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80180d:	48 01 d0             	add    %rdx,%rax
+  801810:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801814:	eb 13                	jmp    801829 <memfind+0x37>
+		if (*(const unsigned char *)s == (unsigned char)c)
+  801816:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80181a:	0f b6 00             	movzbl (%rax),%eax
+  80181d:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801820:	38 d0                	cmp    %dl,%al
+  801822:	74 11                	je     801835 <memfind+0x43>
+	for (; s < ends; s++)
+  801824:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801829:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80182d:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801831:	72 e3                	jb     801816 <memfind+0x24>
+  801833:	eb 01                	jmp    801836 <memfind+0x44>
+			break;
+  801835:	90                   	nop
+	return (void *)s;
+  801836:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80183a:	c9                   	leave
+  80183b:	c3                   	ret
+
+000000000080183c <strtol>:
+
+long strtol(const char *s, char **endptr, int base)
+{
+  80183c:	55                   	push   %rbp
+  80183d:	48 89 e5             	mov    %rsp,%rbp
+  801840:	48 83 ec 38          	sub    $0x38,%rsp
+  801844:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801848:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80184c:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  80184f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801856:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80185d:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80185e:	eb 05                	jmp    801865 <strtol+0x29>
+		s++;
+  801860:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801865:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801869:	0f b6 00             	movzbl (%rax),%eax
+  80186c:	3c 20                	cmp    $0x20,%al
+  80186e:	74 f0                	je     801860 <strtol+0x24>
+  801870:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801874:	0f b6 00             	movzbl (%rax),%eax
+  801877:	3c 09                	cmp    $0x9,%al
+  801879:	74 e5                	je     801860 <strtol+0x24>
+
+	// plus/minus sign
+	if (*s == '+')
+  80187b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80187f:	0f b6 00             	movzbl (%rax),%eax
+  801882:	3c 2b                	cmp    $0x2b,%al
+  801884:	75 07                	jne    80188d <strtol+0x51>
+		s++;
+  801886:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80188b:	eb 17                	jmp    8018a4 <strtol+0x68>
+	else if (*s == '-')
+  80188d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801891:	0f b6 00             	movzbl (%rax),%eax
+  801894:	3c 2d                	cmp    $0x2d,%al
+  801896:	75 0c                	jne    8018a4 <strtol+0x68>
+		s++, neg = 1;
+  801898:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80189d:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8018a4:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8018a8:	74 06                	je     8018b0 <strtol+0x74>
+  8018aa:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  8018ae:	75 28                	jne    8018d8 <strtol+0x9c>
+  8018b0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018b4:	0f b6 00             	movzbl (%rax),%eax
+  8018b7:	3c 30                	cmp    $0x30,%al
+  8018b9:	75 1d                	jne    8018d8 <strtol+0x9c>
+  8018bb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018bf:	48 83 c0 01          	add    $0x1,%rax
+  8018c3:	0f b6 00             	movzbl (%rax),%eax
+  8018c6:	3c 78                	cmp    $0x78,%al
+  8018c8:	75 0e                	jne    8018d8 <strtol+0x9c>
+		s += 2, base = 16;
+  8018ca:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8018cf:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8018d6:	eb 2c                	jmp    801904 <strtol+0xc8>
+	else if (base == 0 && s[0] == '0')
+  8018d8:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8018dc:	75 19                	jne    8018f7 <strtol+0xbb>
+  8018de:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018e2:	0f b6 00             	movzbl (%rax),%eax
+  8018e5:	3c 30                	cmp    $0x30,%al
+  8018e7:	75 0e                	jne    8018f7 <strtol+0xbb>
+		s++, base = 8;
+  8018e9:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8018ee:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  8018f5:	eb 0d                	jmp    801904 <strtol+0xc8>
+	else if (base == 0)
+  8018f7:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8018fb:	75 07                	jne    801904 <strtol+0xc8>
+		base = 10;
+  8018fd:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+	// digits
+	while (1)
+	{
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801904:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801908:	0f b6 00             	movzbl (%rax),%eax
+  80190b:	3c 2f                	cmp    $0x2f,%al
+  80190d:	7e 1d                	jle    80192c <strtol+0xf0>
+  80190f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801913:	0f b6 00             	movzbl (%rax),%eax
+  801916:	3c 39                	cmp    $0x39,%al
+  801918:	7f 12                	jg     80192c <strtol+0xf0>
+			dig = *s - '0';
+  80191a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80191e:	0f b6 00             	movzbl (%rax),%eax
+  801921:	0f be c0             	movsbl %al,%eax
+  801924:	83 e8 30             	sub    $0x30,%eax
+  801927:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80192a:	eb 4e                	jmp    80197a <strtol+0x13e>
+		else if (*s >= 'a' && *s <= 'z')
+  80192c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801930:	0f b6 00             	movzbl (%rax),%eax
+  801933:	3c 60                	cmp    $0x60,%al
+  801935:	7e 1d                	jle    801954 <strtol+0x118>
+  801937:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80193b:	0f b6 00             	movzbl (%rax),%eax
+  80193e:	3c 7a                	cmp    $0x7a,%al
+  801940:	7f 12                	jg     801954 <strtol+0x118>
+			dig = *s - 'a' + 10;
+  801942:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801946:	0f b6 00             	movzbl (%rax),%eax
+  801949:	0f be c0             	movsbl %al,%eax
+  80194c:	83 e8 57             	sub    $0x57,%eax
+  80194f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801952:	eb 26                	jmp    80197a <strtol+0x13e>
+		else if (*s >= 'A' && *s <= 'Z')
+  801954:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801958:	0f b6 00             	movzbl (%rax),%eax
+  80195b:	3c 40                	cmp    $0x40,%al
+  80195d:	7e 47                	jle    8019a6 <strtol+0x16a>
+  80195f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801963:	0f b6 00             	movzbl (%rax),%eax
+  801966:	3c 5a                	cmp    $0x5a,%al
+  801968:	7f 3c                	jg     8019a6 <strtol+0x16a>
+			dig = *s - 'A' + 10;
+  80196a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80196e:	0f b6 00             	movzbl (%rax),%eax
+  801971:	0f be c0             	movsbl %al,%eax
+  801974:	83 e8 37             	sub    $0x37,%eax
+  801977:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  80197a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80197d:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801980:	7d 23                	jge    8019a5 <strtol+0x169>
+			break;
+		s++, val = (val * base) + dig;
+  801982:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801987:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80198a:	48 98                	cltq
+  80198c:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801991:	48 89 c2             	mov    %rax,%rdx
+  801994:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801997:	48 98                	cltq
+  801999:	48 01 d0             	add    %rdx,%rax
+  80199c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+  8019a0:	e9 5f ff ff ff       	jmp    801904 <strtol+0xc8>
+			break;
+  8019a5:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8019a6:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8019ab:	74 0b                	je     8019b8 <strtol+0x17c>
+		*endptr = (char *)s;
+  8019ad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019b1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8019b5:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  8019b8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8019bc:	74 09                	je     8019c7 <strtol+0x18b>
+  8019be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019c2:	48 f7 d8             	neg    %rax
+  8019c5:	eb 04                	jmp    8019cb <strtol+0x18f>
+  8019c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8019cb:	c9                   	leave
+  8019cc:	c3                   	ret
+
+00000000008019cd <strstr>:
+
+char *strstr(const char *in, const char *str)
+{
+  8019cd:	55                   	push   %rbp
+  8019ce:	48 89 e5             	mov    %rsp,%rbp
+  8019d1:	48 83 ec 30          	sub    $0x30,%rsp
+  8019d5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8019d9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  8019dd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019e1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8019e5:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8019e9:	0f b6 00             	movzbl (%rax),%eax
+  8019ec:	88 45 ff             	mov    %al,-0x1(%rbp)
+	if (!c)
+  8019ef:	80 7d ff 00          	cmpb   $0x0,-0x1(%rbp)
+  8019f3:	75 06                	jne    8019fb <strstr+0x2e>
+		return (char *)in; // Trivial empty string case
+  8019f5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019f9:	eb 6b                	jmp    801a66 <strstr+0x99>
+
+	len = strlen(str);
+  8019fb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019ff:	48 89 c7             	mov    %rax,%rdi
+  801a02:	48 b8 72 0f 80 00 00 	movabs $0x800f72,%rax
+  801a09:	00 00 00 
+  801a0c:	ff d0                	call   *%rax
+  801a0e:	48 98                	cltq
+  801a10:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+		char sc;
+
+		do
+		{
+			sc = *in++;
+  801a14:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a18:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a1c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801a20:	0f b6 00             	movzbl (%rax),%eax
+  801a23:	88 45 ef             	mov    %al,-0x11(%rbp)
+			if (!sc)
+  801a26:	80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+  801a2a:	75 07                	jne    801a33 <strstr+0x66>
+				return (char *)0;
+  801a2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a31:	eb 33                	jmp    801a66 <strstr+0x99>
+		} while (sc != c);
+  801a33:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+  801a37:	3a 45 ff             	cmp    -0x1(%rbp),%al
+  801a3a:	75 d8                	jne    801a14 <strstr+0x47>
+	} while (strncmp(in, str, len) != 0);
+  801a3c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a40:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801a44:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a48:	48 89 ce             	mov    %rcx,%rsi
+  801a4b:	48 89 c7             	mov    %rax,%rdi
+  801a4e:	48 b8 8d 11 80 00 00 	movabs $0x80118d,%rax
+  801a55:	00 00 00 
+  801a58:	ff d0                	call   *%rax
+  801a5a:	85 c0                	test   %eax,%eax
+  801a5c:	75 b6                	jne    801a14 <strstr+0x47>
+
+	return (char *)(in - 1);
+  801a5e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a62:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801a66:	c9                   	leave
+  801a67:	c3                   	ret
+
+0000000000801a68 <syscall>:
+ * 用户的指令式系统调用，该函数将系统调用序号放入eax寄存器，五个参数依次放入edx, ecx, ebx, edi, esi，然后执行指令int 0x30，
+ * 发生中断后，去IDT中查找中断处理函数，最终会走到kern/trap.c的trap_dispatch()中
+ */
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801a68:	55                   	push   %rbp
+  801a69:	48 89 e5             	mov    %rsp,%rbp
+  801a6c:	53                   	push   %rbx
+  801a6d:	48 83 ec 48          	sub    $0x48,%rsp
+  801a71:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801a74:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801a77:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801a7b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801a7f:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801a83:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	 * volatile 告诉汇编程序不要因为不使用返回值就优化该指令
+	 * 最后一个子句告诉汇编程序，指令可能会改变条件代码cx和任意内存memory位置
+	 * 由汇编编译器做好数据保存和恢复工作(栈)
+	 */
+
+	asm volatile("int %1\n"			// code: int T_SYSCALL
+  801a87:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801a8a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801a8e:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a92:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801a96:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801a9a:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801a9e:	4c 89 c3             	mov    %r8,%rbx
+  801aa1:	cd 30                	int    $0x30
+  801aa3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+				   "D"(a4),			// edi = a4
+				   "S"(a5)			// esi = a5
+				 : "cc", "memory"); // 指令可能会改变条件代码cx和任意内存memory位置
+									// 由汇编编译器做好数据保存和恢复工作(栈)
+
+	if (check && ret > 0)
+  801aa7:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801aab:	74 44                	je     801af1 <syscall+0x89>
+  801aad:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801ab2:	7e 3d                	jle    801af1 <syscall+0x89>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801ab4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801ab8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801abb:	49 89 d0             	mov    %rdx,%r8
+  801abe:	89 c1                	mov    %eax,%ecx
+  801ac0:	48 b8 28 45 80 00 00 	movabs $0x804528,%rax
+  801ac7:	00 00 00 
+  801aca:	48 89 c2             	mov    %rax,%rdx
+  801acd:	be 34 00 00 00       	mov    $0x34,%esi
+  801ad2:	48 b8 45 45 80 00 00 	movabs $0x804545,%rax
+  801ad9:	00 00 00 
+  801adc:	48 89 c7             	mov    %rax,%rdi
+  801adf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae4:	49 b9 fa 3b 80 00 00 	movabs $0x803bfa,%r9
+  801aeb:	00 00 00 
+  801aee:	41 ff d1             	call   *%r9
+
+	return ret;
+  801af1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801af5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801af9:	c9                   	leave
+  801afa:	c3                   	ret
+
+0000000000801afb <sys_cputs>:
+
+void sys_cputs(const char *s, size_t len)
+{
+  801afb:	55                   	push   %rbp
+  801afc:	48 89 e5             	mov    %rsp,%rbp
+  801aff:	48 83 ec 10          	sub    $0x10,%rsp
+  801b03:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801b07:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 调用lib/syscall.c中的syscall()
+	// SYS_cputs: 系统调用序号(eax)，s: 需要输出的字符数组，len: 数组长度
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801b0b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b0f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801b13:	48 83 ec 08          	sub    $0x8,%rsp
+  801b17:	6a 00                	push   $0x0
+  801b19:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b1f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b25:	48 89 d1             	mov    %rdx,%rcx
+  801b28:	48 89 c2             	mov    %rax,%rdx
+  801b2b:	be 00 00 00 00       	mov    $0x0,%esi
+  801b30:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b35:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  801b3c:	00 00 00 
+  801b3f:	ff d0                	call   *%rax
+  801b41:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801b45:	90                   	nop
+  801b46:	c9                   	leave
+  801b47:	c3                   	ret
+
+0000000000801b48 <sys_cgetc>:
+
+int sys_cgetc(void)
+{
+  801b48:	55                   	push   %rbp
+  801b49:	48 89 e5             	mov    %rsp,%rbp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801b4c:	48 83 ec 08          	sub    $0x8,%rsp
+  801b50:	6a 00                	push   $0x0
+  801b52:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b58:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b63:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b68:	be 00 00 00 00       	mov    $0x0,%esi
+  801b6d:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b72:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  801b79:	00 00 00 
+  801b7c:	ff d0                	call   *%rax
+  801b7e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801b82:	c9                   	leave
+  801b83:	c3                   	ret
+
+0000000000801b84 <sys_env_destroy>:
+
+int sys_env_destroy(envid_t envid)
+{
+  801b84:	55                   	push   %rbp
+  801b85:	48 89 e5             	mov    %rsp,%rbp
+  801b88:	48 83 ec 10          	sub    $0x10,%rsp
+  801b8c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	// 销毁envid对应的环境
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801b8f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b92:	48 98                	cltq
+  801b94:	48 83 ec 08          	sub    $0x8,%rsp
+  801b98:	6a 00                	push   $0x0
+  801b9a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ba0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ba6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bab:	48 89 c2             	mov    %rax,%rdx
+  801bae:	be 01 00 00 00       	mov    $0x1,%esi
+  801bb3:	bf 03 00 00 00       	mov    $0x3,%edi
+  801bb8:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  801bbf:	00 00 00 
+  801bc2:	ff d0                	call   *%rax
+  801bc4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801bc8:	c9                   	leave
+  801bc9:	c3                   	ret
+
+0000000000801bca <sys_getprocid>:
+
+envid_t
+sys_getprocid(void)
+{
+  801bca:	55                   	push   %rbp
+  801bcb:	48 89 e5             	mov    %rsp,%rbp
+	// 获取当前用户环境id
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801bce:	48 83 ec 08          	sub    $0x8,%rsp
+  801bd2:	6a 00                	push   $0x0
+  801bd4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801bda:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801be0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801be5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bea:	be 00 00 00 00       	mov    $0x0,%esi
+  801bef:	bf 02 00 00 00       	mov    $0x2,%edi
+  801bf4:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  801bfb:	00 00 00 
+  801bfe:	ff d0                	call   *%rax
+  801c00:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c04:	c9                   	leave
+  801c05:	c3                   	ret
+
+0000000000801c06 <sys_yield>:
+
+void sys_yield(void)
+{
+  801c06:	55                   	push   %rbp
+  801c07:	48 89 e5             	mov    %rsp,%rbp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801c0a:	48 83 ec 08          	sub    $0x8,%rsp
+  801c0e:	6a 00                	push   $0x0
+  801c10:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801c16:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c1c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c21:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c26:	be 00 00 00 00       	mov    $0x0,%esi
+  801c2b:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801c30:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  801c37:	00 00 00 
+  801c3a:	ff d0                	call   *%rax
+  801c3c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c40:	90                   	nop
+  801c41:	c9                   	leave
+  801c42:	c3                   	ret
+
+0000000000801c43 <sys_page_alloc>:
+
+int sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801c43:	55                   	push   %rbp
+  801c44:	48 89 e5             	mov    %rsp,%rbp
+  801c47:	48 83 ec 10          	sub    $0x10,%rsp
+  801c4b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801c4e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801c52:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  801c55:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801c58:	48 63 c8             	movslq %eax,%rcx
+  801c5b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c5f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801c62:	48 98                	cltq
+  801c64:	48 83 ec 08          	sub    $0x8,%rsp
+  801c68:	6a 00                	push   $0x0
+  801c6a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801c70:	49 89 c8             	mov    %rcx,%r8
+  801c73:	48 89 d1             	mov    %rdx,%rcx
+  801c76:	48 89 c2             	mov    %rax,%rdx
+  801c79:	be 01 00 00 00       	mov    $0x1,%esi
+  801c7e:	bf 04 00 00 00       	mov    $0x4,%edi
+  801c83:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  801c8a:	00 00 00 
+  801c8d:	ff d0                	call   *%rax
+  801c8f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c93:	c9                   	leave
+  801c94:	c3                   	ret
+
+0000000000801c95 <sys_page_map>:
+
+int sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801c95:	55                   	push   %rbp
+  801c96:	48 89 e5             	mov    %rsp,%rbp
+  801c99:	48 83 ec 20          	sub    $0x20,%rsp
+  801c9d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801ca0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801ca4:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801ca7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801cab:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  801caf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801cb2:	48 63 c8             	movslq %eax,%rcx
+  801cb5:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  801cb9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801cbc:	48 63 f0             	movslq %eax,%rsi
+  801cbf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801cc3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801cc6:	48 98                	cltq
+  801cc8:	48 83 ec 08          	sub    $0x8,%rsp
+  801ccc:	51                   	push   %rcx
+  801ccd:	49 89 f9             	mov    %rdi,%r9
+  801cd0:	49 89 f0             	mov    %rsi,%r8
+  801cd3:	48 89 d1             	mov    %rdx,%rcx
+  801cd6:	48 89 c2             	mov    %rax,%rdx
+  801cd9:	be 01 00 00 00       	mov    $0x1,%esi
+  801cde:	bf 05 00 00 00       	mov    $0x5,%edi
+  801ce3:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  801cea:	00 00 00 
+  801ced:	ff d0                	call   *%rax
+  801cef:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801cf3:	c9                   	leave
+  801cf4:	c3                   	ret
+
+0000000000801cf5 <sys_page_unmap>:
+
+int sys_page_unmap(envid_t envid, void *va)
+{
+  801cf5:	55                   	push   %rbp
+  801cf6:	48 89 e5             	mov    %rsp,%rbp
+  801cf9:	48 83 ec 10          	sub    $0x10,%rsp
+  801cfd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801d00:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  801d04:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d08:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d0b:	48 98                	cltq
+  801d0d:	48 83 ec 08          	sub    $0x8,%rsp
+  801d11:	6a 00                	push   $0x0
+  801d13:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d19:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d1f:	48 89 d1             	mov    %rdx,%rcx
+  801d22:	48 89 c2             	mov    %rax,%rdx
+  801d25:	be 01 00 00 00       	mov    $0x1,%esi
+  801d2a:	bf 06 00 00 00       	mov    $0x6,%edi
+  801d2f:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  801d36:	00 00 00 
+  801d39:	ff d0                	call   *%rax
+  801d3b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d3f:	c9                   	leave
+  801d40:	c3                   	ret
+
+0000000000801d41 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int sys_env_set_status(envid_t envid, int status)
+{
+  801d41:	55                   	push   %rbp
+  801d42:	48 89 e5             	mov    %rsp,%rbp
+  801d45:	48 83 ec 10          	sub    $0x10,%rsp
+  801d49:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801d4c:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801d4f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801d52:	48 63 d0             	movslq %eax,%rdx
+  801d55:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d58:	48 98                	cltq
+  801d5a:	48 83 ec 08          	sub    $0x8,%rsp
+  801d5e:	6a 00                	push   $0x0
+  801d60:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d66:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d6c:	48 89 d1             	mov    %rdx,%rcx
+  801d6f:	48 89 c2             	mov    %rax,%rdx
+  801d72:	be 01 00 00 00       	mov    $0x1,%esi
+  801d77:	bf 08 00 00 00       	mov    $0x8,%edi
+  801d7c:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  801d83:	00 00 00 
+  801d86:	ff d0                	call   *%rax
+  801d88:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d8c:	c9                   	leave
+  801d8d:	c3                   	ret
+
+0000000000801d8e <sys_env_set_trapframe>:
+
+int sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801d8e:	55                   	push   %rbp
+  801d8f:	48 89 e5             	mov    %rsp,%rbp
+  801d92:	48 83 ec 10          	sub    $0x10,%rsp
+  801d96:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801d99:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  801d9d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801da1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801da4:	48 98                	cltq
+  801da6:	48 83 ec 08          	sub    $0x8,%rsp
+  801daa:	6a 00                	push   $0x0
+  801dac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801db2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801db8:	48 89 d1             	mov    %rdx,%rcx
+  801dbb:	48 89 c2             	mov    %rax,%rdx
+  801dbe:	be 01 00 00 00       	mov    $0x1,%esi
+  801dc3:	bf 09 00 00 00       	mov    $0x9,%edi
+  801dc8:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  801dcf:	00 00 00 
+  801dd2:	ff d0                	call   *%rax
+  801dd4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801dd8:	c9                   	leave
+  801dd9:	c3                   	ret
+
+0000000000801dda <sys_env_set_pgfault_upcall>:
+
+int sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801dda:	55                   	push   %rbp
+  801ddb:	48 89 e5             	mov    %rsp,%rbp
+  801dde:	48 83 ec 10          	sub    $0x10,%rsp
+  801de2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801de5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  801de9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801ded:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801df0:	48 98                	cltq
+  801df2:	48 83 ec 08          	sub    $0x8,%rsp
+  801df6:	6a 00                	push   $0x0
+  801df8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801dfe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e04:	48 89 d1             	mov    %rdx,%rcx
+  801e07:	48 89 c2             	mov    %rax,%rdx
+  801e0a:	be 01 00 00 00       	mov    $0x1,%esi
+  801e0f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801e14:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  801e1b:	00 00 00 
+  801e1e:	ff d0                	call   *%rax
+  801e20:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e24:	c9                   	leave
+  801e25:	c3                   	ret
+
+0000000000801e26 <sys_ipc_try_send>:
+
+int sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  801e26:	55                   	push   %rbp
+  801e27:	48 89 e5             	mov    %rsp,%rbp
+  801e2a:	48 83 ec 20          	sub    $0x20,%rsp
+  801e2e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e31:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801e35:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801e39:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  801e3c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801e3f:	48 63 f0             	movslq %eax,%rsi
+  801e42:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801e46:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e49:	48 98                	cltq
+  801e4b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e4f:	48 83 ec 08          	sub    $0x8,%rsp
+  801e53:	6a 00                	push   $0x0
+  801e55:	49 89 f1             	mov    %rsi,%r9
+  801e58:	49 89 c8             	mov    %rcx,%r8
+  801e5b:	48 89 d1             	mov    %rdx,%rcx
+  801e5e:	48 89 c2             	mov    %rax,%rdx
+  801e61:	be 00 00 00 00       	mov    $0x0,%esi
+  801e66:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801e6b:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  801e72:	00 00 00 
+  801e75:	ff d0                	call   *%rax
+  801e77:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e7b:	c9                   	leave
+  801e7c:	c3                   	ret
+
+0000000000801e7d <sys_ipc_recv>:
+
+int sys_ipc_recv(void *dstva)
+{
+  801e7d:	55                   	push   %rbp
+  801e7e:	48 89 e5             	mov    %rsp,%rbp
+  801e81:	48 83 ec 10          	sub    $0x10,%rsp
+  801e85:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  801e89:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e8d:	48 83 ec 08          	sub    $0x8,%rsp
+  801e91:	6a 00                	push   $0x0
+  801e93:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e99:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e9f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ea4:	48 89 c2             	mov    %rax,%rdx
+  801ea7:	be 01 00 00 00       	mov    $0x1,%esi
+  801eac:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801eb1:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  801eb8:	00 00 00 
+  801ebb:	ff d0                	call   *%rax
+  801ebd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ec1:	c9                   	leave
+  801ec2:	c3                   	ret
+
+0000000000801ec3 <sys_disk_io>:
+
+int sys_disk_io(int dev, uint64_t secno, void *va, size_t nsecs, int write)
+{
+  801ec3:	55                   	push   %rbp
+  801ec4:	48 89 e5             	mov    %rsp,%rbp
+  801ec7:	48 83 ec 20          	sub    $0x20,%rsp
+  801ecb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801ece:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801ed2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801ed6:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  801eda:	44 89 45 f8          	mov    %r8d,-0x8(%rbp)
+	return syscall(SYS_disk_io, 0, dev, secno, (uint64_t)va, nsecs, write);
+  801ede:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801ee1:	48 63 c8             	movslq %eax,%rcx
+  801ee4:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  801ee8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801eeb:	48 98                	cltq
+  801eed:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  801ef1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801ef5:	48 83 ec 08          	sub    $0x8,%rsp
+  801ef9:	51                   	push   %rcx
+  801efa:	49 89 f9             	mov    %rdi,%r9
+  801efd:	49 89 f0             	mov    %rsi,%r8
+  801f00:	48 89 d1             	mov    %rdx,%rcx
+  801f03:	48 89 c2             	mov    %rax,%rdx
+  801f06:	be 00 00 00 00       	mov    $0x0,%esi
+  801f0b:	bf 0e 00 00 00       	mov    $0xe,%edi
+  801f10:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  801f17:	00 00 00 
+  801f1a:	ff d0                	call   *%rax
+  801f1c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f20:	c9                   	leave
+  801f21:	c3                   	ret
+
+0000000000801f22 <sys_vma_alloc>:
+
+int sys_vma_alloc(envid_t envid, void *va, size_t len, int perm)
+{
+  801f22:	55                   	push   %rbp
+  801f23:	48 89 e5             	mov    %rsp,%rbp
+  801f26:	48 83 ec 20          	sub    $0x20,%rsp
+  801f2a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f2d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f31:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801f35:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_vma_alloc, 1, envid, (uint64_t)va, len, perm, 0);
+  801f38:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801f3b:	48 63 f0             	movslq %eax,%rsi
+  801f3e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801f42:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f45:	48 98                	cltq
+  801f47:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801f4b:	48 83 ec 08          	sub    $0x8,%rsp
+  801f4f:	6a 00                	push   $0x0
+  801f51:	49 89 f1             	mov    %rsi,%r9
+  801f54:	49 89 c8             	mov    %rcx,%r8
+  801f57:	48 89 d1             	mov    %rdx,%rcx
+  801f5a:	48 89 c2             	mov    %rax,%rdx
+  801f5d:	be 01 00 00 00       	mov    $0x1,%esi
+  801f62:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801f67:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  801f6e:	00 00 00 
+  801f71:	ff d0                	call   *%rax
+  801f73:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f77:	c9                   	leave
+  801f78:	c3                   	ret
+
+0000000000801f79 <sys_vma_clear>:
+
+int sys_vma_clear(envid_t envid)
+{
+  801f79:	55                   	push   %rbp
+  801f7a:	48 89 e5             	mov    %rsp,%rbp
+  801f7d:	48 83 ec 10          	sub    $0x10,%rsp
+  801f81:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_vma_clear, 1, envid, 0, 0, 0, 0);
+  801f84:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f87:	48 98                	cltq
+  801f89:	48 83 ec 08          	sub    $0x8,%rsp
+  801f8d:	6a 00                	push   $0x0
+  801f8f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f95:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f9b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fa0:	48 89 c2             	mov    %rax,%rdx
+  801fa3:	be 01 00 00 00       	mov    $0x1,%esi
+  801fa8:	bf 10 00 00 00       	mov    $0x10,%edi
+  801fad:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  801fb4:	00 00 00 
+  801fb7:	ff d0                	call   *%rax
+  801fb9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fbd:	c9                   	leave
+  801fbe:	c3                   	ret
+
+0000000000801fbf <sys_trace_ctl>:
+
+int sys_trace_ctl(int enable)
+{
+  801fbf:	55                   	push   %rbp
+  801fc0:	48 89 e5             	mov    %rsp,%rbp
+  801fc3:	48 83 ec 10          	sub    $0x10,%rsp
+  801fc7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_trace_ctl, 0, enable, 0, 0, 0, 0);
+  801fca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fcd:	48 98                	cltq
+  801fcf:	48 83 ec 08          	sub    $0x8,%rsp
+  801fd3:	6a 00                	push   $0x0
+  801fd5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fdb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fe1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fe6:	48 89 c2             	mov    %rax,%rdx
+  801fe9:	be 00 00 00 00       	mov    $0x0,%esi
+  801fee:	bf 11 00 00 00       	mov    $0x11,%edi
+  801ff3:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  801ffa:	00 00 00 
+  801ffd:	ff d0                	call   *%rax
+  801fff:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802003:	c9                   	leave
+  802004:	c3                   	ret
+
+0000000000802005 <sys_trace_read>:
+
+int sys_trace_read(int cpu, uint64_t *seq, struct TraceEvent *buf, int n)
+{
+  802005:	55                   	push   %rbp
+  802006:	48 89 e5             	mov    %rsp,%rbp
+  802009:	48 83 ec 20          	sub    $0x20,%rsp
+  80200d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802010:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802014:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802018:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_trace_read, 0, cpu, (uint64_t)seq, (uint64_t)buf, n, 0);
+  80201b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80201e:	48 63 f0             	movslq %eax,%rsi
+  802021:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802025:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802029:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80202c:	48 98                	cltq
+  80202e:	48 83 ec 08          	sub    $0x8,%rsp
+  802032:	6a 00                	push   $0x0
+  802034:	49 89 f1             	mov    %rsi,%r9
+  802037:	49 89 c8             	mov    %rcx,%r8
+  80203a:	48 89 d1             	mov    %rdx,%rcx
+  80203d:	48 89 c2             	mov    %rax,%rdx
+  802040:	be 00 00 00 00       	mov    $0x0,%esi
+  802045:	bf 12 00 00 00       	mov    $0x12,%edi
+  80204a:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  802051:	00 00 00 
+  802054:	ff d0                	call   *%rax
+  802056:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80205a:	c9                   	leave
+  80205b:	c3                   	ret
+
+000000000080205c <sys_getrusage>:
+
+int sys_getrusage(envid_t envid, struct Rusage *ru)
+{
+  80205c:	55                   	push   %rbp
+  80205d:	48 89 e5             	mov    %rsp,%rbp
+  802060:	48 83 ec 10          	sub    $0x10,%rsp
+  802064:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802067:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_getrusage, 0, envid, (uint64_t)ru, 0, 0, 0);
+  80206b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80206f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802072:	48 98                	cltq
+  802074:	48 83 ec 08          	sub    $0x8,%rsp
+  802078:	6a 00                	push   $0x0
+  80207a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802080:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802086:	48 89 d1             	mov    %rdx,%rcx
+  802089:	48 89 c2             	mov    %rax,%rdx
+  80208c:	be 00 00 00 00       	mov    $0x0,%esi
+  802091:	bf 13 00 00 00       	mov    $0x13,%edi
+  802096:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  80209d:	00 00 00 
+  8020a0:	ff d0                	call   *%rax
+  8020a2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020a6:	c9                   	leave
+  8020a7:	c3                   	ret
+
+00000000008020a8 <sys_pmu_config>:
+
+int sys_pmu_config(int idx, uint64_t event)
+{
+  8020a8:	55                   	push   %rbp
+  8020a9:	48 89 e5             	mov    %rsp,%rbp
+  8020ac:	48 83 ec 10          	sub    $0x10,%rsp
+  8020b0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020b3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_pmu_config, 0, idx, event, 0, 0, 0);
+  8020b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020ba:	48 98                	cltq
+  8020bc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8020c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8020c4:	6a 00                	push   $0x0
+  8020c6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020d2:	48 89 d1             	mov    %rdx,%rcx
+  8020d5:	48 89 c2             	mov    %rax,%rdx
+  8020d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8020dd:	bf 14 00 00 00       	mov    $0x14,%edi
+  8020e2:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  8020e9:	00 00 00 
+  8020ec:	ff d0                	call   *%rax
+  8020ee:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020f2:	c9                   	leave
+  8020f3:	c3                   	ret
+
+00000000008020f4 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  8020f4:	55                   	push   %rbp
+  8020f5:	48 89 e5             	mov    %rsp,%rbp
+  8020f8:	48 83 ec 10          	sub    $0x10,%rsp
+  8020fc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+  8020ff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802102:	48 83 ec 08          	sub    $0x8,%rsp
+  802106:	6a 00                	push   $0x0
+  802108:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80210e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802114:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802119:	48 89 c2             	mov    %rax,%rdx
+  80211c:	be 00 00 00 00       	mov    $0x0,%esi
+  802121:	bf 15 00 00 00       	mov    $0x15,%edi
+  802126:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  80212d:	00 00 00 
+  802130:	ff d0                	call   *%rax
+  802132:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802136:	c9                   	leave
+  802137:	c3                   	ret
+
+0000000000802138 <sys_image_attach>:
+
+int sys_image_attach(envid_t envid, int dev, const uint64_t *secnos, size_t size)
+{
+  802138:	55                   	push   %rbp
+  802139:	48 89 e5             	mov    %rsp,%rbp
+  80213c:	48 83 ec 20          	sub    $0x20,%rsp
+  802140:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802143:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  802146:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  80214a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+	return syscall(SYS_image_attach, 1, envid, dev, (uint64_t)secnos, size, 0);
+  80214e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802152:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802155:	48 63 d0             	movslq %eax,%rdx
+  802158:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80215b:	48 98                	cltq
+  80215d:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802161:	48 83 ec 08          	sub    $0x8,%rsp
+  802165:	6a 00                	push   $0x0
+  802167:	49 89 f1             	mov    %rsi,%r9
+  80216a:	49 89 c8             	mov    %rcx,%r8
+  80216d:	48 89 d1             	mov    %rdx,%rcx
+  802170:	48 89 c2             	mov    %rax,%rdx
+  802173:	be 01 00 00 00       	mov    $0x1,%esi
+  802178:	bf 16 00 00 00       	mov    $0x16,%edi
+  80217d:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  802184:	00 00 00 
+  802187:	ff d0                	call   *%rax
+  802189:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80218d:	c9                   	leave
+  80218e:	c3                   	ret
+
+000000000080218f <sys_vma_binary>:
+
+int sys_vma_binary(envid_t envid, const struct Proghdr *ph)
+{
+  80218f:	55                   	push   %rbp
+  802190:	48 89 e5             	mov    %rsp,%rbp
+  802193:	48 83 ec 10          	sub    $0x10,%rsp
+  802197:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80219a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_vma_binary, 1, envid, (uint64_t)ph, 0, 0, 0);
+  80219e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021a5:	48 98                	cltq
+  8021a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8021ab:	6a 00                	push   $0x0
+  8021ad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021b9:	48 89 d1             	mov    %rdx,%rcx
+  8021bc:	48 89 c2             	mov    %rax,%rdx
+  8021bf:	be 01 00 00 00       	mov    $0x1,%esi
+  8021c4:	bf 17 00 00 00       	mov    $0x17,%edi
+  8021c9:	48 b8 68 1a 80 00 00 	movabs $0x801a68,%rax
+  8021d0:	00 00 00 
+  8021d3:	ff d0                	call   *%rax
+  8021d5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021d9:	c9                   	leave
+  8021da:	c3                   	ret
+
+00000000008021db <pgfault>:
+ * 自定义页错误处理函数.
+ * 当出现页错误，主要是对标志为可写的或者COW的物理页分配新页，复制旧页的数据到新页并映射到旧页的地址空间
+ */
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8021db:	55                   	push   %rbp
+  8021dc:	48 89 e5             	mov    %rsp,%rbp
+  8021df:	48 83 ec 40          	sub    $0x40,%rsp
+  8021e3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	void *addr = (void *)utf->utf_fault_va;
+  8021e7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021eb:	48 8b 00             	mov    (%rax),%rax
+  8021ee:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint32_t err = utf->utf_err;
+  8021f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021f6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8021fa:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	int r;
+
+	// 检查出错的访问(1)写，(2)COW页.  若不是，调用panic().
+	// pte_t entry = uvpt[VPN(addr)];
+	// 分配一个新页，将其映射到临时位置(PFTEMP)，将旧页数据复制到新页，然后将新页移动到旧页的地址.
+	if ((err & FEC_WR) && (uvpt[VPN(addr)] & PTE_COW))
+  8021fd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802200:	83 e0 02             	and    $0x2,%eax
+  802203:	85 c0                	test   %eax,%eax
+  802205:	0f 84 61 01 00 00    	je     80236c <pgfault+0x191>
+  80220b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80220f:	48 c1 e8 0c          	shr    $0xc,%rax
+  802213:	48 89 c2             	mov    %rax,%rdx
+  802216:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80221d:	01 00 00 
+  802220:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802224:	25 00 08 00 00       	and    $0x800,%eax
+  802229:	48 85 c0             	test   %rax,%rax
+  80222c:	0f 84 3a 01 00 00    	je     80236c <pgfault+0x191>
+	{
+		if (sys_page_alloc(0, (void *)PFTEMP, PTE_U | PTE_P | PTE_W) == 0)
+  802232:	ba 07 00 00 00       	mov    $0x7,%edx
+  802237:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  80223c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802241:	48 b8 43 1c 80 00 00 	movabs $0x801c43,%rax
+  802248:	00 00 00 
+  80224b:	ff d0                	call   *%rax
+  80224d:	85 c0                	test   %eax,%eax
+  80224f:	0f 85 e7 00 00 00    	jne    80233c <pgfault+0x161>
+		{
+			// 分配了新的物理页以后准备从原页面开始拷贝数据时，记得将地址和物理页大小对齐
+			void *pg_addr = ROUNDDOWN(addr, PGSIZE);
+  802255:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802259:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  80225d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802261:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802267:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+			memmove(PFTEMP, pg_addr, PGSIZE);
+  80226b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80226f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802274:	48 89 c6             	mov    %rax,%rsi
+  802277:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  80227c:	48 b8 6a 16 80 00 00 	movabs $0x80166a,%rax
+  802283:	00 00 00 
+  802286:	ff d0                	call   *%rax
+			r = sys_page_map(0, (void *)PFTEMP, 0, pg_addr, PTE_U | PTE_W | PTE_P);
+  802288:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80228c:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802292:	48 89 c1             	mov    %rax,%rcx
+  802295:	ba 00 00 00 00       	mov    $0x0,%edx
+  80229a:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  80229f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022a4:	48 b8 95 1c 80 00 00 	movabs $0x801c95,%rax
+  8022ab:	00 00 00 
+  8022ae:	ff d0                	call   *%rax
+  8022b0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			if (r < 0)
+  8022b3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8022b7:	79 30                	jns    8022e9 <pgfault+0x10e>
+			{
+				panic("pgfault...something wrong with page_map");
+  8022b9:	48 b8 58 45 80 00 00 	movabs $0x804558,%rax
+  8022c0:	00 00 00 
+  8022c3:	48 89 c2             	mov    %rax,%rdx
+  8022c6:	be 22 00 00 00       	mov    $0x22,%esi
+  8022cb:	48 b8 80 45 80 00 00 	movabs $0x804580,%rax
+  8022d2:	00 00 00 
+  8022d5:	48 89 c7             	mov    %rax,%rdi
+  8022d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022dd:	48 b9 fa 3b 80 00 00 	movabs $0x803bfa,%rcx
+  8022e4:	00 00 00 
+  8022e7:	ff d1                	call   *%rcx
+			}
+			r = sys_page_unmap(0, PFTEMP);
+  8022e9:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8022ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022f3:	48 b8 f5 1c 80 00 00 	movabs $0x801cf5,%rax
+  8022fa:	00 00 00 
+  8022fd:	ff d0                	call   *%rax
+  8022ff:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			if (r < 0)
+  802302:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  802306:	0f 89 96 00 00 00    	jns    8023a2 <pgfault+0x1c7>
+			{
+				panic("pgfault...something wrong with page_unmap");
+  80230c:	48 b8 90 45 80 00 00 	movabs $0x804590,%rax
+  802313:	00 00 00 
+  802316:	48 89 c2             	mov    %rax,%rdx
+  802319:	be 27 00 00 00       	mov    $0x27,%esi
+  80231e:	48 b8 80 45 80 00 00 	movabs $0x804580,%rax
+  802325:	00 00 00 
+  802328:	48 89 c7             	mov    %rax,%rdi
+  80232b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802330:	48 b9 fa 3b 80 00 00 	movabs $0x803bfa,%rcx
+  802337:	00 00 00 
+  80233a:	ff d1                	call   *%rcx
+			}
+			return;
+		}
+		else
+		{
+			panic("pgfault...something wrong with page_alloc");
+  80233c:	48 b8 c0 45 80 00 00 	movabs $0x8045c0,%rax
+  802343:	00 00 00 
+  802346:	48 89 c2             	mov    %rax,%rdx
+  802349:	be 2d 00 00 00       	mov    $0x2d,%esi
+  80234e:	48 b8 80 45 80 00 00 	movabs $0x804580,%rax
+  802355:	00 00 00 
+  802358:	48 89 c7             	mov    %rax,%rdi
+  80235b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802360:	48 b9 fa 3b 80 00 00 	movabs $0x803bfa,%rcx
+  802367:	00 00 00 
+  80236a:	ff d1                	call   *%rcx
+		}
+	}
+	else
+	{
+		panic("pgfault...wrong error %e", err);
+  80236c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80236f:	89 c1                	mov    %eax,%ecx
+  802371:	48 b8 ea 45 80 00 00 	movabs $0x8045ea,%rax
+  802378:	00 00 00 
+  80237b:	48 89 c2             	mov    %rax,%rdx
+  80237e:	be 32 00 00 00       	mov    $0x32,%esi
+  802383:	48 b8 80 45 80 00 00 	movabs $0x804580,%rax
+  80238a:	00 00 00 
+  80238d:	48 89 c7             	mov    %rax,%rdi
+  802390:	b8 00 00 00 00       	mov    $0x0,%eax
+  802395:	49 b8 fa 3b 80 00 00 	movabs $0x803bfa,%r8
+  80239c:	00 00 00 
+  80239f:	41 ff d0             	call   *%r8
+			return;
+  8023a2:	90                   	nop
+	}
+}
+  8023a3:	c9                   	leave
+  8023a4:	c3                   	ret
+
+00000000008023a5 <duppage>:
+ * 映射: 将的虚拟页pn(地址: pn*PGSIZE)映射到相同虚拟地址的 envid 中.
+ * 成功: 返回0，失败调用 panic()
+ */
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  8023a5:	55                   	push   %rbp
+  8023a6:	48 89 e5             	mov    %rsp,%rbp
+  8023a9:	48 83 ec 30          	sub    $0x30,%rsp
+  8023ad:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8023b0:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	pte_t entry = uvpt[pn];
+  8023b3:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  8023ba:	01 00 00 
+  8023bd:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8023c0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8023c4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	void *addr = (void *)((uintptr_t)pn * PGSIZE);
+  8023c8:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8023cb:	48 c1 e0 0c          	shl    $0xc,%rax
+  8023cf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	int perm = entry & PTE_SYSCALL;
+  8023d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023d7:	25 07 0e 00 00       	and    $0xe07,%eax
+  8023dc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm & PTE_SHARE)
+  8023df:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023e2:	25 00 04 00 00       	and    $0x400,%eax
+  8023e7:	85 c0                	test   %eax,%eax
+  8023e9:	74 68                	je     802453 <duppage+0xae>
+	{
+		r = sys_page_map(0, addr, envid, addr, perm);
+  8023eb:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8023ee:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023f2:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8023f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8023f9:	41 89 f0             	mov    %esi,%r8d
+  8023fc:	48 89 c6             	mov    %rax,%rsi
+  8023ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  802404:	48 b8 95 1c 80 00 00 	movabs $0x801c95,%rax
+  80240b:	00 00 00 
+  80240e:	ff d0                	call   *%rax
+  802410:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  802413:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802417:	0f 89 90 01 00 00    	jns    8025ad <duppage+0x208>
+		{
+			panic("Something went wrong on duppage %e", r);
+  80241d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802420:	89 c1                	mov    %eax,%ecx
+  802422:	48 b8 08 46 80 00 00 	movabs $0x804608,%rax
+  802429:	00 00 00 
+  80242c:	48 89 c2             	mov    %rax,%rdx
+  80242f:	be 48 00 00 00       	mov    $0x48,%esi
+  802434:	48 b8 80 45 80 00 00 	movabs $0x804580,%rax
+  80243b:	00 00 00 
+  80243e:	48 89 c7             	mov    %rax,%rdi
+  802441:	b8 00 00 00 00       	mov    $0x0,%eax
+  802446:	49 b8 fa 3b 80 00 00 	movabs $0x803bfa,%r8
+  80244d:	00 00 00 
+  802450:	41 ff d0             	call   *%r8
+		}
+	}
+	else if ((perm & PTE_COW) || (perm & PTE_W))
+  802453:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802456:	25 00 08 00 00       	and    $0x800,%eax
+  80245b:	85 c0                	test   %eax,%eax
+  80245d:	75 0e                	jne    80246d <duppage+0xc8>
+  80245f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802462:	83 e0 02             	and    $0x2,%eax
+  802465:	85 c0                	test   %eax,%eax
+  802467:	0f 84 dc 00 00 00    	je     802549 <duppage+0x1a4>
+	{
+		perm &= ~PTE_W;
+  80246d:	83 65 ec fd          	andl   $0xfffffffd,-0x14(%rbp)
+		perm |= PTE_COW;
+  802471:	81 4d ec 00 08 00 00 	orl    $0x800,-0x14(%rbp)
+		r = sys_page_map(0, addr, envid, addr, perm);
+  802478:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80247b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80247f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802482:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802486:	41 89 f0             	mov    %esi,%r8d
+  802489:	48 89 c6             	mov    %rax,%rsi
+  80248c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802491:	48 b8 95 1c 80 00 00 	movabs $0x801c95,%rax
+  802498:	00 00 00 
+  80249b:	ff d0                	call   *%rax
+  80249d:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  8024a0:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8024a4:	79 36                	jns    8024dc <duppage+0x137>
+		{
+			panic("Something went wrong on duppage %e", r);
+  8024a6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8024a9:	89 c1                	mov    %eax,%ecx
+  8024ab:	48 b8 08 46 80 00 00 	movabs $0x804608,%rax
+  8024b2:	00 00 00 
+  8024b5:	48 89 c2             	mov    %rax,%rdx
+  8024b8:	be 52 00 00 00       	mov    $0x52,%esi
+  8024bd:	48 b8 80 45 80 00 00 	movabs $0x804580,%rax
+  8024c4:	00 00 00 
+  8024c7:	48 89 c7             	mov    %rax,%rdi
+  8024ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024cf:	49 b8 fa 3b 80 00 00 	movabs $0x803bfa,%r8
+  8024d6:	00 00 00 
+  8024d9:	41 ff d0             	call   *%r8
+		}
+		r = sys_page_map(0, addr, 0, addr, perm);
+  8024dc:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  8024df:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8024e7:	41 89 c8             	mov    %ecx,%r8d
+  8024ea:	48 89 d1             	mov    %rdx,%rcx
+  8024ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024f2:	48 89 c6             	mov    %rax,%rsi
+  8024f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024fa:	48 b8 95 1c 80 00 00 	movabs $0x801c95,%rax
+  802501:	00 00 00 
+  802504:	ff d0                	call   *%rax
+  802506:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  802509:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80250d:	0f 89 9a 00 00 00    	jns    8025ad <duppage+0x208>
+		{
+			panic("Something went wrong on duppage %e", r);
+  802513:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802516:	89 c1                	mov    %eax,%ecx
+  802518:	48 b8 08 46 80 00 00 	movabs $0x804608,%rax
+  80251f:	00 00 00 
+  802522:	48 89 c2             	mov    %rax,%rdx
+  802525:	be 57 00 00 00       	mov    $0x57,%esi
+  80252a:	48 b8 80 45 80 00 00 	movabs $0x804580,%rax
+  802531:	00 00 00 
+  802534:	48 89 c7             	mov    %rax,%rdi
+  802537:	b8 00 00 00 00       	mov    $0x0,%eax
+  80253c:	49 b8 fa 3b 80 00 00 	movabs $0x803bfa,%r8
+  802543:	00 00 00 
+  802546:	41 ff d0             	call   *%r8
+		}
+	}
+	else
+	{
+		r = sys_page_map(0, addr, envid, addr, perm);
+  802549:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80254c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802550:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802553:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802557:	41 89 f0             	mov    %esi,%r8d
+  80255a:	48 89 c6             	mov    %rax,%rsi
+  80255d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802562:	48 b8 95 1c 80 00 00 	movabs $0x801c95,%rax
+  802569:	00 00 00 
+  80256c:	ff d0                	call   *%rax
+  80256e:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  802571:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802575:	79 36                	jns    8025ad <duppage+0x208>
+		{
+			panic("Something went wrong on duppage %e", r);
+  802577:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80257a:	89 c1                	mov    %eax,%ecx
+  80257c:	48 b8 08 46 80 00 00 	movabs $0x804608,%rax
+  802583:	00 00 00 
+  802586:	48 89 c2             	mov    %rax,%rdx
+  802589:	be 5f 00 00 00       	mov    $0x5f,%esi
+  80258e:	48 b8 80 45 80 00 00 	movabs $0x804580,%rax
+  802595:	00 00 00 
+  802598:	48 89 c7             	mov    %rax,%rdi
+  80259b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025a0:	49 b8 fa 3b 80 00 00 	movabs $0x803bfa,%r8
+  8025a7:	00 00 00 
+  8025aa:	41 ff d0             	call   *%r8
+		}
+	}
+	return 0;
+  8025ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025b2:	c9                   	leave
+  8025b3:	c3                   	ret
+
+00000000008025b4 <fork>:
+ * 
+ * 两个用户异常栈都不应该被标记为COW，所以必须为子环境的异常栈分配一个新页
+ */
+envid_t
+fork(void)
+{
+  8025b4:	55                   	push   %rbp
+  8025b5:	48 89 e5             	mov    %rsp,%rbp
+  8025b8:	48 83 ec 50          	sub    $0x50,%rsp
+	int r = 0;
+  8025bc:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	set_pgfault_handler(pgfault);
+  8025c3:	48 b8 db 21 80 00 00 	movabs $0x8021db,%rax
+  8025ca:	00 00 00 
+  8025cd:	48 89 c7             	mov    %rax,%rdi
+  8025d0:	48 b8 14 3d 80 00 00 	movabs $0x803d14,%rax
+  8025d7:	00 00 00 
+  8025da:	ff d0                	call   *%rax
+// 必须内联.
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8025dc:	b8 07 00 00 00       	mov    $0x7,%eax
+  8025e1:	cd 30                	int    $0x30
+  8025e3:	89 45 bc             	mov    %eax,-0x44(%rbp)
+					 : "=a"(ret)
+					 : "a"(SYS_exofork),
+					   "i"(T_SYSCALL));
+	return ret;
+  8025e6:	8b 45 bc             	mov    -0x44(%rbp),%eax
+	envid_t childid = sys_exofork();
+  8025e9:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	if (childid < 0)
+  8025ec:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  8025f0:	79 36                	jns    802628 <fork+0x74>
+	{
+		panic("\n couldn't call fork %e\n", childid);
+  8025f2:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8025f5:	89 c1                	mov    %eax,%ecx
+  8025f7:	48 b8 2b 46 80 00 00 	movabs $0x80462b,%rax
+  8025fe:	00 00 00 
+  802601:	48 89 c2             	mov    %rax,%rdx
+  802604:	be 7a 00 00 00       	mov    $0x7a,%esi
+  802609:	48 b8 80 45 80 00 00 	movabs $0x804580,%rax
+  802610:	00 00 00 
+  802613:	48 89 c7             	mov    %rax,%rdi
+  802616:	b8 00 00 00 00       	mov    $0x0,%eax
+  80261b:	49 b8 fa 3b 80 00 00 	movabs $0x803bfa,%r8
+  802622:	00 00 00 
+  802625:	41 ff d0             	call   *%r8
+	}
+	if (childid == 0)
+  802628:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  80262c:	75 3e                	jne    80266c <fork+0xb8>
+	{
+		// thisproc 父进程
+		thisproc = &procs[ENVX(sys_getprocid())];
+  80262e:	48 b8 ca 1b 80 00 00 	movabs $0x801bca,%rax
+  802635:	00 00 00 
+  802638:	ff d0                	call   *%rax
+  80263a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80263f:	48 98                	cltq
+  802641:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  802648:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  80264f:	00 00 00 
+  802652:	48 01 c2             	add    %rax,%rdx
+  802655:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80265c:	00 00 00 
+  80265f:	48 89 10             	mov    %rdx,(%rax)
+		// 子环境的返回值
+		return 0;
+  802662:	b8 00 00 00 00       	mov    $0x0,%eax
+  802667:	e9 c2 02 00 00       	jmp    80292e <fork+0x37a>
+	}
+	r = sys_page_alloc(childid, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_W | PTE_U);
+  80266c:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80266f:	ba 07 00 00 00       	mov    $0x7,%edx
+  802674:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  802679:	48 89 ce             	mov    %rcx,%rsi
+  80267c:	89 c7                	mov    %eax,%edi
+  80267e:	48 b8 43 1c 80 00 00 	movabs $0x801c43,%rax
+  802685:	00 00 00 
+  802688:	ff d0                	call   *%rax
+  80268a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if (r < 0)
+  80268d:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  802691:	79 36                	jns    8026c9 <fork+0x115>
+		panic("\n couldn't call fork %e\n", r);
+  802693:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802696:	89 c1                	mov    %eax,%ecx
+  802698:	48 b8 2b 46 80 00 00 	movabs $0x80462b,%rax
+  80269f:	00 00 00 
+  8026a2:	48 89 c2             	mov    %rax,%rdx
+  8026a5:	be 85 00 00 00       	mov    $0x85,%esi
+  8026aa:	48 b8 80 45 80 00 00 	movabs $0x804580,%rax
+  8026b1:	00 00 00 
+  8026b4:	48 89 c7             	mov    %rax,%rdi
+  8026b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026bc:	49 b8 fa 3b 80 00 00 	movabs $0x803bfa,%r8
+  8026c3:	00 00 00 
+  8026c6:	41 ff d0             	call   *%r8
+
+	uint64_t pml;
+	uint64_t pdpe;
+	uint64_t pde;
+	uint64_t pte;
+	uint64_t each_pde = 0;
+  8026c9:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8026d0:	00 
+	uint64_t each_pte = 0;
+  8026d1:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8026d8:	00 
+	uint64_t each_pdpe = 0;
+  8026d9:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8026e0:	00 
+
+	// 拷贝[0, UXSTACKTOP)的所有用户页，接下来为用户异常栈创建物理页
+	// 因为在创建用户环境时，已经在 env_setup_vm() 中映射了内核所有页
+	for (pml = 0; pml < VPML4E(UTOP); pml++)
+  8026e1:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8026e8:	00 
+  8026e9:	e9 80 01 00 00       	jmp    80286e <fork+0x2ba>
+	{
+		if (uvpml4e[pml] & PTE_P)
+  8026ee:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8026f5:	01 00 00 
+  8026f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026fc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802700:	83 e0 01             	and    $0x1,%eax
+  802703:	48 85 c0             	test   %rax,%rax
+  802706:	0f 84 4d 01 00 00    	je     802859 <fork+0x2a5>
+		{
+
+			for (pdpe = 0; pdpe < NPDPENTRIES; pdpe++, each_pdpe++)
+  80270c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802713:	00 
+  802714:	e9 30 01 00 00       	jmp    802849 <fork+0x295>
+			{
+				if (uvpde[each_pdpe] & PTE_P)
+  802719:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802720:	01 00 00 
+  802723:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802727:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80272b:	83 e0 01             	and    $0x1,%eax
+  80272e:	48 85 c0             	test   %rax,%rax
+  802731:	0f 84 f8 00 00 00    	je     80282f <fork+0x27b>
+				{
+
+					for (pde = 0; pde < NPDENTRIES; pde++, each_pde++)
+  802737:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80273e:	00 
+  80273f:	e9 db 00 00 00       	jmp    80281f <fork+0x26b>
+					{
+						if (uvpd[each_pde] & PTE_P)
+  802744:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80274b:	01 00 00 
+  80274e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802752:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802756:	83 e0 01             	and    $0x1,%eax
+  802759:	48 85 c0             	test   %rax,%rax
+  80275c:	0f 84 a3 00 00 00    	je     802805 <fork+0x251>
+						{
+
+							for (pte = 0; pte < NPTENTRIES; pte++, each_pte++)
+  802762:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802769:	00 
+  80276a:	e9 86 00 00 00       	jmp    8027f5 <fork+0x241>
+							{
+								if (uvpt[each_pte] & PTE_P)
+  80276f:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802776:	01 00 00 
+  802779:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80277d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802781:	83 e0 01             	and    $0x1,%eax
+  802784:	48 85 c0             	test   %rax,%rax
+  802787:	74 62                	je     8027eb <fork+0x237>
+								{
+
+									if (each_pte != VPN(UXSTACKTOP - PGSIZE))
+  802789:	48 81 7d d0 ff f7 0e 	cmpq   $0xef7ff,-0x30(%rbp)
+  802790:	00 
+  802791:	74 58                	je     8027eb <fork+0x237>
+									{
+										r = duppage(childid, (unsigned)each_pte);
+  802793:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802797:	89 c2                	mov    %eax,%edx
+  802799:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80279c:	89 d6                	mov    %edx,%esi
+  80279e:	89 c7                	mov    %eax,%edi
+  8027a0:	48 b8 a5 23 80 00 00 	movabs $0x8023a5,%rax
+  8027a7:	00 00 00 
+  8027aa:	ff d0                	call   *%rax
+  8027ac:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+										if (r < 0)
+  8027af:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  8027b3:	79 36                	jns    8027eb <fork+0x237>
+											panic("\n couldn't call fork %e\n", r);
+  8027b5:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8027b8:	89 c1                	mov    %eax,%ecx
+  8027ba:	48 b8 2b 46 80 00 00 	movabs $0x80462b,%rax
+  8027c1:	00 00 00 
+  8027c4:	48 89 c2             	mov    %rax,%rdx
+  8027c7:	be a9 00 00 00       	mov    $0xa9,%esi
+  8027cc:	48 b8 80 45 80 00 00 	movabs $0x804580,%rax
+  8027d3:	00 00 00 
+  8027d6:	48 89 c7             	mov    %rax,%rdi
+  8027d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027de:	49 b8 fa 3b 80 00 00 	movabs $0x803bfa,%r8
+  8027e5:	00 00 00 
+  8027e8:	41 ff d0             	call   *%r8
+							for (pte = 0; pte < NPTENTRIES; pte++, each_pte++)
+  8027eb:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  8027f0:	48 83 45 d0 01       	addq   $0x1,-0x30(%rbp)
+  8027f5:	48 81 7d e0 ff 01 00 	cmpq   $0x1ff,-0x20(%rbp)
+  8027fc:	00 
+  8027fd:	0f 86 6c ff ff ff    	jbe    80276f <fork+0x1bb>
+  802803:	eb 10                	jmp    802815 <fork+0x261>
+								}
+							}
+						}
+						else
+						{
+							each_pte = (each_pde + 1) * NPTENTRIES;
+  802805:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802809:	48 83 c0 01          	add    $0x1,%rax
+  80280d:	48 c1 e0 09          	shl    $0x9,%rax
+  802811:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+					for (pde = 0; pde < NPDENTRIES; pde++, each_pde++)
+  802815:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80281a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80281f:	48 81 7d e8 ff 01 00 	cmpq   $0x1ff,-0x18(%rbp)
+  802826:	00 
+  802827:	0f 86 17 ff ff ff    	jbe    802744 <fork+0x190>
+  80282d:	eb 10                	jmp    80283f <fork+0x28b>
+						}
+					}
+				}
+				else
+				{
+					each_pde = (each_pdpe + 1) * NPDENTRIES;
+  80282f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802833:	48 83 c0 01          	add    $0x1,%rax
+  802837:	48 c1 e0 09          	shl    $0x9,%rax
+  80283b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			for (pdpe = 0; pdpe < NPDPENTRIES; pdpe++, each_pdpe++)
+  80283f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  802844:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  802849:	48 81 7d f0 ff 01 00 	cmpq   $0x1ff,-0x10(%rbp)
+  802850:	00 
+  802851:	0f 86 c2 fe ff ff    	jbe    802719 <fork+0x165>
+  802857:	eb 10                	jmp    802869 <fork+0x2b5>
+				}
+			}
+		}
+		else
+		{
+			each_pdpe = (pml + 1) * NPDPENTRIES;
+  802859:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80285d:	48 83 c0 01          	add    $0x1,%rax
+  802861:	48 c1 e0 09          	shl    $0x9,%rax
+  802865:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	for (pml = 0; pml < VPML4E(UTOP); pml++)
+  802869:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80286e:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802873:	0f 84 75 fe ff ff    	je     8026ee <fork+0x13a>
+
+	extern void _pgfault_upcall(void);
+	// 为子环境设置页错误处理函数.
+	// 因为使用env_alloc()创建的env的处理函数指针都为空，但是这时已经明确的为其错误栈分配了物理页面
+	// 所以可以直接使用系统调用指定错误处理的入口，_pgfault_upcall()为所有用户页错误处理函数的总入口
+	r = sys_env_set_pgfault_upcall(childid, _pgfault_upcall);
+  802879:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80287c:	48 ba b8 3d 80 00 00 	movabs $0x803db8,%rdx
+  802883:	00 00 00 
+  802886:	48 89 d6             	mov    %rdx,%rsi
+  802889:	89 c7                	mov    %eax,%edi
+  80288b:	48 b8 da 1d 80 00 00 	movabs $0x801dda,%rax
+  802892:	00 00 00 
+  802895:	ff d0                	call   *%rax
+  802897:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if (r < 0)
+  80289a:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  80289e:	79 36                	jns    8028d6 <fork+0x322>
+		panic("\n couldn't call fork %e\n", r);
+  8028a0:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8028a3:	89 c1                	mov    %eax,%ecx
+  8028a5:	48 b8 2b 46 80 00 00 	movabs $0x80462b,%rax
+  8028ac:	00 00 00 
+  8028af:	48 89 c2             	mov    %rax,%rdx
+  8028b2:	be c6 00 00 00       	mov    $0xc6,%esi
+  8028b7:	48 b8 80 45 80 00 00 	movabs $0x804580,%rax
+  8028be:	00 00 00 
+  8028c1:	48 89 c7             	mov    %rax,%rdi
+  8028c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c9:	49 b8 fa 3b 80 00 00 	movabs $0x803bfa,%r8
+  8028d0:	00 00 00 
+  8028d3:	41 ff d0             	call   *%r8
+
+	r = sys_env_set_status(childid, ENV_RUNNABLE);
+  8028d6:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8028d9:	be 02 00 00 00       	mov    $0x2,%esi
+  8028de:	89 c7                	mov    %eax,%edi
+  8028e0:	48 b8 41 1d 80 00 00 	movabs $0x801d41,%rax
+  8028e7:	00 00 00 
+  8028ea:	ff d0                	call   *%rax
+  8028ec:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if (r < 0)
+  8028ef:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  8028f3:	79 36                	jns    80292b <fork+0x377>
+		panic("\n couldn't call fork %e\n", r);
+  8028f5:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8028f8:	89 c1                	mov    %eax,%ecx
+  8028fa:	48 b8 2b 46 80 00 00 	movabs $0x80462b,%rax
+  802901:	00 00 00 
+  802904:	48 89 c2             	mov    %rax,%rdx
+  802907:	be ca 00 00 00       	mov    $0xca,%esi
+  80290c:	48 b8 80 45 80 00 00 	movabs $0x804580,%rax
+  802913:	00 00 00 
+  802916:	48 89 c7             	mov    %rax,%rdi
+  802919:	b8 00 00 00 00       	mov    $0x0,%eax
+  80291e:	49 b8 fa 3b 80 00 00 	movabs $0x803bfa,%r8
+  802925:	00 00 00 
+  802928:	41 ff d0             	call   *%r8
+
+	return childid;
+  80292b:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  80292e:	c9                   	leave
+  80292f:	c3                   	ret
+
+0000000000802930 <fd2num>:
+/* ------------------------------- 文件描述符 ------------------------------- */
+
+// 返回 fd 的文件描述符号
+uint64_t
+fd2num(struct Fd *fd)
+{
+  802930:	55                   	push   %rbp
+  802931:	48 89 e5             	mov    %rsp,%rbp
+  802934:	48 83 ec 08          	sub    $0x8,%rsp
+  802938:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80293c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802940:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802947:	ff ff ff 
+  80294a:	48 01 d0             	add    %rdx,%rax
+  80294d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802951:	c9                   	leave
+  802952:	c3                   	ret
+
+0000000000802953 <fd2data>:
+
+// 返回 fd 的数据窗口
+char *
+fd2data(struct Fd *fd)
+{
+  802953:	55                   	push   %rbp
+  802954:	48 89 e5             	mov    %rsp,%rbp
+  802957:	48 83 ec 18          	sub    $0x18,%rsp
+  80295b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  80295f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802963:	48 89 c7             	mov    %rax,%rdi
+  802966:	48 b8 30 29 80 00 00 	movabs $0x802930,%rax
+  80296d:	00 00 00 
+  802970:	ff d0                	call   *%rax
+  802972:	48 89 c1             	mov    %rax,%rcx
+  802975:	48 c7 45 f8 00 00 20 	movq   $0x200000,-0x8(%rbp)
+  80297c:	00 
+  80297d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802981:	48 05 ff 9f 40 00    	add    $0x409fff,%rax
+  802987:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80298b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80298f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802994:	48 f7 75 f8          	divq   -0x8(%rbp)
+  802998:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80299c:	48 29 d0             	sub    %rdx,%rax
+  80299f:	48 98                	cltq
+  8029a1:	48 0f af c1          	imul   %rcx,%rax
+  8029a5:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  8029aa:	48 01 d0             	add    %rdx,%rax
+}
+  8029ad:	c9                   	leave
+  8029ae:	c3                   	ret
+
+00000000008029af <fd_alloc>:
+ * 找到编号最小的未使用的文件描述符(其 Fd 页未映射)，存入 *fd_store，但不分配 Fd 页
+ * 调用者需要在其上分配一个页面，否则该文件描述符不会被使用
+ * 所有文件描述符都已使用时返回 -E_MAX_OPEN，*fd_store 为 0
+ */
+int fd_alloc(struct Fd **fd_store)
+{
+  8029af:	55                   	push   %rbp
+  8029b0:	48 89 e5             	mov    %rsp,%rbp
+  8029b3:	48 83 ec 20          	sub    $0x20,%rsp
+  8029b7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++)
+  8029bb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8029c2:	eb 41                	jmp    802a05 <fd_alloc+0x56>
+	{
+		fd = INDEX2FD(i);
+  8029c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8029c7:	c1 e0 0c             	shl    $0xc,%eax
+  8029ca:	48 98                	cltq
+  8029cc:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8029d1:	48 01 d0             	add    %rdx,%rax
+  8029d4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+		if (pageref(fd) == 0)
+  8029d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8029dc:	48 89 c7             	mov    %rax,%rdi
+  8029df:	48 b8 83 3b 80 00 00 	movabs $0x803b83,%rax
+  8029e6:	00 00 00 
+  8029e9:	ff d0                	call   *%rax
+  8029eb:	85 c0                	test   %eax,%eax
+  8029ed:	75 12                	jne    802a01 <fd_alloc+0x52>
+		{
+			*fd_store = fd;
+  8029ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029f3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8029f7:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  8029fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ff:	eb 1a                	jmp    802a1b <fd_alloc+0x6c>
+	for (i = 0; i < MAXFD; i++)
+  802a01:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802a05:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802a09:	7e b9                	jle    8029c4 <fd_alloc+0x15>
+		}
+	}
+	*fd_store = 0;
+  802a0b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a0f:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  802a16:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  802a1b:	c9                   	leave
+  802a1c:	c3                   	ret
+
+0000000000802a1d <fd_lookup>:
+/**
+ * 检查 fdnum 是否在范围内且已映射，是则 *fd_store 为对应的 Fd 页
+ * 否则返回 -E_INVAL
+ */
+int fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802a1d:	55                   	push   %rbp
+  802a1e:	48 89 e5             	mov    %rsp,%rbp
+  802a21:	48 83 ec 20          	sub    $0x20,%rsp
+  802a25:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802a28:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD)
+  802a2c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802a30:	78 06                	js     802a38 <fd_lookup+0x1b>
+  802a32:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802a36:	7e 07                	jle    802a3f <fd_lookup+0x22>
+	{
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisproc->proc_id, fdnum);
+		return -E_INVAL;
+  802a38:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a3d:	eb 42                	jmp    802a81 <fd_lookup+0x64>
+	}
+	fd = INDEX2FD(fdnum);
+  802a3f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a42:	c1 e0 0c             	shl    $0xc,%eax
+  802a45:	48 98                	cltq
+  802a47:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802a4c:	48 01 d0             	add    %rdx,%rax
+  802a4f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (pageref(fd) == 0)
+  802a53:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a57:	48 89 c7             	mov    %rax,%rdi
+  802a5a:	48 b8 83 3b 80 00 00 	movabs $0x803b83,%rax
+  802a61:	00 00 00 
+  802a64:	ff d0                	call   *%rax
+  802a66:	85 c0                	test   %eax,%eax
+  802a68:	75 07                	jne    802a71 <fd_lookup+0x54>
+	{
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisproc->proc_id, fdnum);
+		return -E_INVAL;
+  802a6a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a6f:	eb 10                	jmp    802a81 <fd_lookup+0x64>
+	}
+	*fd_store = fd;
+  802a71:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a75:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a79:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  802a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a81:	c9                   	leave
+  802a82:	c3                   	ret
+
+0000000000802a83 <fd_close>:
+/**
+ * 关闭文件描述符 fd 并释放其 Fd 页
+ * must_exist 为 0 时，fd 不是有效的打开文件描述符则直接返回 0；否则返回 fd_lookup 的错误
+ */
+int fd_close(struct Fd *fd, bool must_exist)
+{
+  802a83:	55                   	push   %rbp
+  802a84:	48 89 e5             	mov    %rsp,%rbp
+  802a87:	48 83 ec 30          	sub    $0x30,%rsp
+  802a8b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802a8f:	89 f0                	mov    %esi,%eax
+  802a91:	88 45 d4             	mov    %al,-0x2c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  802a94:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a98:	48 89 c7             	mov    %rax,%rdi
+  802a9b:	48 b8 30 29 80 00 00 	movabs $0x802930,%rax
+  802aa2:	00 00 00 
+  802aa5:	ff d0                	call   *%rax
+  802aa7:	89 c2                	mov    %eax,%edx
+  802aa9:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802aad:	48 89 c6             	mov    %rax,%rsi
+  802ab0:	89 d7                	mov    %edx,%edi
+  802ab2:	48 b8 1d 2a 80 00 00 	movabs $0x802a1d,%rax
+  802ab9:	00 00 00 
+  802abc:	ff d0                	call   *%rax
+  802abe:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ac1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ac5:	78 0a                	js     802ad1 <fd_close+0x4e>
+  802ac7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802acb:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  802acf:	74 12                	je     802ae3 <fd_close+0x60>
+		return (must_exist ? r : 0);
+  802ad1:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  802ad5:	74 05                	je     802adc <fd_close+0x59>
+  802ad7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ada:	eb 70                	jmp    802b4c <fd_close+0xc9>
+  802adc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ae1:	eb 69                	jmp    802b4c <fd_close+0xc9>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0)
+  802ae3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ae7:	8b 00                	mov    (%rax),%eax
+  802ae9:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802aed:	48 89 d6             	mov    %rdx,%rsi
+  802af0:	89 c7                	mov    %eax,%edi
+  802af2:	48 b8 4e 2b 80 00 00 	movabs $0x802b4e,%rax
+  802af9:	00 00 00 
+  802afc:	ff d0                	call   *%rax
+  802afe:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802b01:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b05:	78 2a                	js     802b31 <fd_close+0xae>
+	{
+		if (dev->dev_close)
+  802b07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b0b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802b0f:	48 85 c0             	test   %rax,%rax
+  802b12:	74 16                	je     802b2a <fd_close+0xa7>
+			r = (*dev->dev_close)(fd);
+  802b14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b18:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802b1c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b20:	48 89 c7             	mov    %rax,%rdi
+  802b23:	ff d2                	call   *%rdx
+  802b25:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802b28:	eb 07                	jmp    802b31 <fd_close+0xae>
+		else
+			r = 0;
+  802b2a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	}
+	// 此时 fd 可能已被设备释放，再次释放是安全的
+	(void)sys_page_unmap(0, fd);
+  802b31:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b35:	48 89 c6             	mov    %rax,%rsi
+  802b38:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b3d:	48 b8 f5 1c 80 00 00 	movabs $0x801cf5,%rax
+  802b44:	00 00 00 
+  802b47:	ff d0                	call   *%rax
+	return r;
+  802b49:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802b4c:	c9                   	leave
+  802b4d:	c3                   	ret
+
+0000000000802b4e <dev_lookup>:
+	{
+		&devfile,
+		0};
+
+int dev_lookup(int dev_id, struct Dev **dev)
+{
+  802b4e:	55                   	push   %rbp
+  802b4f:	48 89 e5             	mov    %rsp,%rbp
+  802b52:	48 83 ec 20          	sub    $0x20,%rsp
+  802b56:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802b59:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int i;
+
+	for (i = 0; devtab[i]; i++)
+  802b5d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802b64:	eb 3f                	jmp    802ba5 <dev_lookup+0x57>
+		if (devtab[i]->dev_id == dev_id)
+  802b66:	48 ba 10 60 80 00 00 	movabs $0x806010,%rdx
+  802b6d:	00 00 00 
+  802b70:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b73:	48 98                	cltq
+  802b75:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b79:	8b 00                	mov    (%rax),%eax
+  802b7b:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  802b7e:	75 21                	jne    802ba1 <dev_lookup+0x53>
+		{
+			*dev = devtab[i];
+  802b80:	48 ba 10 60 80 00 00 	movabs $0x806010,%rdx
+  802b87:	00 00 00 
+  802b8a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b8d:	48 98                	cltq
+  802b8f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b93:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b97:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802b9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b9f:	eb 62                	jmp    802c03 <dev_lookup+0xb5>
+	for (i = 0; devtab[i]; i++)
+  802ba1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802ba5:	48 ba 10 60 80 00 00 	movabs $0x806010,%rdx
+  802bac:	00 00 00 
+  802baf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802bb2:	48 98                	cltq
+  802bb4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802bb8:	48 85 c0             	test   %rax,%rax
+  802bbb:	75 a9                	jne    802b66 <dev_lookup+0x18>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisproc->proc_id, dev_id);
+  802bbd:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802bc4:	00 00 00 
+  802bc7:	48 8b 00             	mov    (%rax),%rax
+  802bca:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  802bd0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802bd3:	89 c6                	mov    %eax,%esi
+  802bd5:	48 b8 48 46 80 00 00 	movabs $0x804648,%rax
+  802bdc:	00 00 00 
+  802bdf:	48 89 c7             	mov    %rax,%rdi
+  802be2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be7:	48 b9 57 03 80 00 00 	movabs $0x800357,%rcx
+  802bee:	00 00 00 
+  802bf1:	ff d1                	call   *%rcx
+	*dev = 0;
+  802bf3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802bf7:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  802bfe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802c03:	c9                   	leave
+  802c04:	c3                   	ret
+
+0000000000802c05 <close>:
+
+int close(int fdnum)
+{
+  802c05:	55                   	push   %rbp
+  802c06:	48 89 e5             	mov    %rsp,%rbp
+  802c09:	48 83 ec 20          	sub    $0x20,%rsp
+  802c0d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c10:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802c14:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c17:	48 89 d6             	mov    %rdx,%rsi
+  802c1a:	89 c7                	mov    %eax,%edi
+  802c1c:	48 b8 1d 2a 80 00 00 	movabs $0x802a1d,%rax
+  802c23:	00 00 00 
+  802c26:	ff d0                	call   *%rax
+  802c28:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c2b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c2f:	79 05                	jns    802c36 <close+0x31>
+		return r;
+  802c31:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c34:	eb 18                	jmp    802c4e <close+0x49>
+	else
+		return fd_close(fd, 1);
+  802c36:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c3a:	be 01 00 00 00       	mov    $0x1,%esi
+  802c3f:	48 89 c7             	mov    %rax,%rdi
+  802c42:	48 b8 83 2a 80 00 00 	movabs $0x802a83,%rax
+  802c49:	00 00 00 
+  802c4c:	ff d0                	call   *%rax
+}
+  802c4e:	c9                   	leave
+  802c4f:	c3                   	ret
+
+0000000000802c50 <close_all>:
+
+void close_all(void)
+{
+  802c50:	55                   	push   %rbp
+  802c51:	48 89 e5             	mov    %rsp,%rbp
+  802c54:	48 83 ec 10          	sub    $0x10,%rsp
+	int i;
+
+	for (i = 0; i < MAXFD; i++)
+  802c58:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802c5f:	eb 15                	jmp    802c76 <close_all+0x26>
+		close(i);
+  802c61:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c64:	89 c7                	mov    %eax,%edi
+  802c66:	48 b8 05 2c 80 00 00 	movabs $0x802c05,%rax
+  802c6d:	00 00 00 
+  802c70:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  802c72:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802c76:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802c7a:	7e e5                	jle    802c61 <close_all+0x11>
+}
+  802c7c:	90                   	nop
+  802c7d:	90                   	nop
+  802c7e:	c9                   	leave
+  802c7f:	c3                   	ret
+
+0000000000802c80 <dup>:
+/**
+ * 将 oldfdnum 复制为 newfdnum(先关闭 newfdnum)
+ * 复制的两个文件描述符共享 Fd 页和数据窗口
+ */
+int dup(int oldfdnum, int newfdnum)
+{
+  802c80:	55                   	push   %rbp
+  802c81:	48 89 e5             	mov    %rsp,%rbp
+  802c84:	48 83 ec 60          	sub    $0x60,%rsp
+  802c88:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  802c8b:	89 75 a8             	mov    %esi,-0x58(%rbp)
+	int r;
+	char *ova, *nva;
+	uintptr_t off;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802c8e:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+  802c92:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802c95:	48 89 d6             	mov    %rdx,%rsi
+  802c98:	89 c7                	mov    %eax,%edi
+  802c9a:	48 b8 1d 2a 80 00 00 	movabs $0x802a1d,%rax
+  802ca1:	00 00 00 
+  802ca4:	ff d0                	call   *%rax
+  802ca6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ca9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cad:	79 08                	jns    802cb7 <dup+0x37>
+		return r;
+  802caf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cb2:	e9 1d 02 00 00       	jmp    802ed4 <dup+0x254>
+	close(newfdnum);
+  802cb7:	8b 45 a8             	mov    -0x58(%rbp),%eax
+  802cba:	89 c7                	mov    %eax,%edi
+  802cbc:	48 b8 05 2c 80 00 00 	movabs $0x802c05,%rax
+  802cc3:	00 00 00 
+  802cc6:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  802cc8:	8b 45 a8             	mov    -0x58(%rbp),%eax
+  802ccb:	c1 e0 0c             	shl    $0xc,%eax
+  802cce:	48 98                	cltq
+  802cd0:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802cd5:	48 01 d0             	add    %rdx,%rax
+  802cd8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	ova = fd2data(oldfd);
+  802cdc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ce0:	48 89 c7             	mov    %rax,%rdi
+  802ce3:	48 b8 53 29 80 00 00 	movabs $0x802953,%rax
+  802cea:	00 00 00 
+  802ced:	ff d0                	call   *%rax
+  802cef:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	nva = fd2data(newfd);
+  802cf3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cf7:	48 89 c7             	mov    %rax,%rdi
+  802cfa:	48 b8 53 29 80 00 00 	movabs $0x802953,%rax
+  802d01:	00 00 00 
+  802d04:	ff d0                	call   *%rax
+  802d06:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+	for (off = 0; off < FILEWINDOW; off += PGSIZE)
+  802d0a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802d11:	00 
+  802d12:	e9 8f 00 00 00       	jmp    802da6 <dup+0x126>
+		if (va_is_mapped(ova + off))
+  802d17:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802d1b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d1f:	48 01 d0             	add    %rdx,%rax
+  802d22:	48 89 c7             	mov    %rax,%rdi
+  802d25:	48 b8 e2 3a 80 00 00 	movabs $0x803ae2,%rax
+  802d2c:	00 00 00 
+  802d2f:	ff d0                	call   *%rax
+  802d31:	84 c0                	test   %al,%al
+  802d33:	74 69                	je     802d9e <dup+0x11e>
+			if ((r = sys_page_map(0, ova + off, 0, nva + off,
+								  uvpt[VPN(ova + off)] & PTE_SYSCALL)) < 0)
+  802d35:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802d39:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d3d:	48 01 d0             	add    %rdx,%rax
+  802d40:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d44:	48 89 c2             	mov    %rax,%rdx
+  802d47:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802d4e:	01 00 00 
+  802d51:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+			if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  802d55:	25 07 0e 00 00       	and    $0xe07,%eax
+  802d5a:	89 c6                	mov    %eax,%esi
+  802d5c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802d60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d64:	48 01 c2             	add    %rax,%rdx
+  802d67:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802d6b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d6f:	48 01 c8             	add    %rcx,%rax
+  802d72:	41 89 f0             	mov    %esi,%r8d
+  802d75:	48 89 d1             	mov    %rdx,%rcx
+  802d78:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d7d:	48 89 c6             	mov    %rax,%rsi
+  802d80:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d85:	48 b8 95 1c 80 00 00 	movabs $0x801c95,%rax
+  802d8c:	00 00 00 
+  802d8f:	ff d0                	call   *%rax
+  802d91:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d94:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d98:	0f 88 96 00 00 00    	js     802e34 <dup+0x1b4>
+	for (off = 0; off < FILEWINDOW; off += PGSIZE)
+  802d9e:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  802da5:	00 
+  802da6:	48 c7 45 d0 00 00 20 	movq   $0x200000,-0x30(%rbp)
+  802dad:	00 
+  802dae:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802db2:	48 05 ff 9f 40 00    	add    $0x409fff,%rax
+  802db8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802dbc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dc5:	48 f7 75 d0          	divq   -0x30(%rbp)
+  802dc9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dcd:	48 29 d0             	sub    %rdx,%rax
+  802dd0:	48 98                	cltq
+  802dd2:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  802dd6:	0f 82 3b ff ff ff    	jb     802d17 <dup+0x97>
+				goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[VPN(oldfd)] & PTE_SYSCALL)) < 0)
+  802ddc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802de0:	48 c1 e8 0c          	shr    $0xc,%rax
+  802de4:	48 89 c2             	mov    %rax,%rdx
+  802de7:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802dee:	01 00 00 
+  802df1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802df5:	25 07 0e 00 00       	and    $0xe07,%eax
+  802dfa:	89 c1                	mov    %eax,%ecx
+  802dfc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802e00:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802e04:	41 89 c8             	mov    %ecx,%r8d
+  802e07:	48 89 d1             	mov    %rdx,%rcx
+  802e0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e0f:	48 89 c6             	mov    %rax,%rsi
+  802e12:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e17:	48 b8 95 1c 80 00 00 	movabs $0x801c95,%rax
+  802e1e:	00 00 00 
+  802e21:	ff d0                	call   *%rax
+  802e23:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e26:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e2a:	78 0b                	js     802e37 <dup+0x1b7>
+		goto err;
+
+	return newfdnum;
+  802e2c:	8b 45 a8             	mov    -0x58(%rbp),%eax
+  802e2f:	e9 a0 00 00 00       	jmp    802ed4 <dup+0x254>
+				goto err;
+  802e34:	90                   	nop
+  802e35:	eb 01                	jmp    802e38 <dup+0x1b8>
+		goto err;
+  802e37:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  802e38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e3c:	48 89 c6             	mov    %rax,%rsi
+  802e3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e44:	48 b8 f5 1c 80 00 00 	movabs $0x801cf5,%rax
+  802e4b:	00 00 00 
+  802e4e:	ff d0                	call   *%rax
+	for (off = 0; off < FILEWINDOW; off += PGSIZE)
+  802e50:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802e57:	00 
+  802e58:	eb 45                	jmp    802e9f <dup+0x21f>
+		if (va_is_mapped(nva + off))
+  802e5a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802e5e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e62:	48 01 d0             	add    %rdx,%rax
+  802e65:	48 89 c7             	mov    %rax,%rdi
+  802e68:	48 b8 e2 3a 80 00 00 	movabs $0x803ae2,%rax
+  802e6f:	00 00 00 
+  802e72:	ff d0                	call   *%rax
+  802e74:	84 c0                	test   %al,%al
+  802e76:	74 1f                	je     802e97 <dup+0x217>
+			sys_page_unmap(0, nva + off);
+  802e78:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802e7c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e80:	48 01 d0             	add    %rdx,%rax
+  802e83:	48 89 c6             	mov    %rax,%rsi
+  802e86:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e8b:	48 b8 f5 1c 80 00 00 	movabs $0x801cf5,%rax
+  802e92:	00 00 00 
+  802e95:	ff d0                	call   *%rax
+	for (off = 0; off < FILEWINDOW; off += PGSIZE)
+  802e97:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  802e9e:	00 
+  802e9f:	48 c7 45 c0 00 00 20 	movq   $0x200000,-0x40(%rbp)
+  802ea6:	00 
+  802ea7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802eab:	48 05 ff 9f 40 00    	add    $0x409fff,%rax
+  802eb1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802eb5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802eb9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ebe:	48 f7 75 c0          	divq   -0x40(%rbp)
+  802ec2:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802ec6:	48 29 d0             	sub    %rdx,%rax
+  802ec9:	48 98                	cltq
+  802ecb:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  802ecf:	72 89                	jb     802e5a <dup+0x1da>
+	return r;
+  802ed1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802ed4:	c9                   	leave
+  802ed5:	c3                   	ret
+
+0000000000802ed6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802ed6:	55                   	push   %rbp
+  802ed7:	48 89 e5             	mov    %rsp,%rbp
+  802eda:	48 83 ec 40          	sub    $0x40,%rsp
+  802ede:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802ee1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802ee5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802ee9:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802eed:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802ef0:	48 89 d6             	mov    %rdx,%rsi
+  802ef3:	89 c7                	mov    %eax,%edi
+  802ef5:	48 b8 1d 2a 80 00 00 	movabs $0x802a1d,%rax
+  802efc:	00 00 00 
+  802eff:	ff d0                	call   *%rax
+  802f01:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f04:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f08:	78 24                	js     802f2e <read+0x58>
+  802f0a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f0e:	8b 00                	mov    (%rax),%eax
+  802f10:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802f14:	48 89 d6             	mov    %rdx,%rsi
+  802f17:	89 c7                	mov    %eax,%edi
+  802f19:	48 b8 4e 2b 80 00 00 	movabs $0x802b4e,%rax
+  802f20:	00 00 00 
+  802f23:	ff d0                	call   *%rax
+  802f25:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f28:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f2c:	79 05                	jns    802f33 <read+0x5d>
+		return r;
+  802f2e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f31:	eb 7d                	jmp    802fb0 <read+0xda>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  802f33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f37:	8b 40 08             	mov    0x8(%rax),%eax
+  802f3a:	83 e0 03             	and    $0x3,%eax
+  802f3d:	83 f8 01             	cmp    $0x1,%eax
+  802f40:	75 3d                	jne    802f7f <read+0xa9>
+	{
+		cprintf("[%08x] read %d -- bad mode\n", thisproc->proc_id, fdnum);
+  802f42:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802f49:	00 00 00 
+  802f4c:	48 8b 00             	mov    (%rax),%rax
+  802f4f:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  802f55:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802f58:	89 c6                	mov    %eax,%esi
+  802f5a:	48 b8 67 46 80 00 00 	movabs $0x804667,%rax
+  802f61:	00 00 00 
+  802f64:	48 89 c7             	mov    %rax,%rdi
+  802f67:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f6c:	48 b9 57 03 80 00 00 	movabs $0x800357,%rcx
+  802f73:	00 00 00 
+  802f76:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  802f78:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f7d:	eb 31                	jmp    802fb0 <read+0xda>
+	}
+	if (!dev->dev_read)
+  802f7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f83:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802f87:	48 85 c0             	test   %rax,%rax
+  802f8a:	75 07                	jne    802f93 <read+0xbd>
+		return -E_NOT_SUPP;
+  802f8c:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802f91:	eb 1d                	jmp    802fb0 <read+0xda>
+	return (*dev->dev_read)(fd, buf, n);
+  802f93:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f97:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  802f9b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f9f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802fa3:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802fa7:	48 89 ce             	mov    %rcx,%rsi
+  802faa:	48 89 c7             	mov    %rax,%rdi
+  802fad:	41 ff d0             	call   *%r8
+}
+  802fb0:	c9                   	leave
+  802fb1:	c3                   	ret
+
+0000000000802fb2 <readn>:
+
+// 读满 n 字节，或遇到文件末尾/错误为止
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802fb2:	55                   	push   %rbp
+  802fb3:	48 89 e5             	mov    %rsp,%rbp
+  802fb6:	48 83 ec 30          	sub    $0x30,%rsp
+  802fba:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802fbd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802fc1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m)
+  802fc5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802fcc:	eb 47                	jmp    803015 <readn+0x63>
+	{
+		m = read(fdnum, (char *)buf + tot, n - tot);
+  802fce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fd1:	48 98                	cltq
+  802fd3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802fd7:	48 29 c2             	sub    %rax,%rdx
+  802fda:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fdd:	48 63 c8             	movslq %eax,%rcx
+  802fe0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802fe4:	48 01 c1             	add    %rax,%rcx
+  802fe7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802fea:	48 89 ce             	mov    %rcx,%rsi
+  802fed:	89 c7                	mov    %eax,%edi
+  802fef:	48 b8 d6 2e 80 00 00 	movabs $0x802ed6,%rax
+  802ff6:	00 00 00 
+  802ff9:	ff d0                	call   *%rax
+  802ffb:	89 45 f8             	mov    %eax,-0x8(%rbp)
+		if (m < 0)
+  802ffe:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803002:	79 05                	jns    803009 <readn+0x57>
+			return m;
+  803004:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803007:	eb 1d                	jmp    803026 <readn+0x74>
+		if (m == 0)
+  803009:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80300d:	74 13                	je     803022 <readn+0x70>
+	for (tot = 0; tot < n; tot += m)
+  80300f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803012:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803015:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803018:	48 98                	cltq
+  80301a:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80301e:	72 ae                	jb     802fce <readn+0x1c>
+  803020:	eb 01                	jmp    803023 <readn+0x71>
+			break;
+  803022:	90                   	nop
+	}
+	return tot;
+  803023:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803026:	c9                   	leave
+  803027:	c3                   	ret
+
+0000000000803028 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  803028:	55                   	push   %rbp
+  803029:	48 89 e5             	mov    %rsp,%rbp
+  80302c:	48 83 ec 40          	sub    $0x40,%rsp
+  803030:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803033:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803037:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80303b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80303f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803042:	48 89 d6             	mov    %rdx,%rsi
+  803045:	89 c7                	mov    %eax,%edi
+  803047:	48 b8 1d 2a 80 00 00 	movabs $0x802a1d,%rax
+  80304e:	00 00 00 
+  803051:	ff d0                	call   *%rax
+  803053:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803056:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80305a:	78 24                	js     803080 <write+0x58>
+  80305c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803060:	8b 00                	mov    (%rax),%eax
+  803062:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803066:	48 89 d6             	mov    %rdx,%rsi
+  803069:	89 c7                	mov    %eax,%edi
+  80306b:	48 b8 4e 2b 80 00 00 	movabs $0x802b4e,%rax
+  803072:	00 00 00 
+  803075:	ff d0                	call   *%rax
+  803077:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80307a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80307e:	79 05                	jns    803085 <write+0x5d>
+		return r;
+  803080:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803083:	eb 7c                	jmp    803101 <write+0xd9>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  803085:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803089:	8b 40 08             	mov    0x8(%rax),%eax
+  80308c:	83 e0 03             	and    $0x3,%eax
+  80308f:	85 c0                	test   %eax,%eax
+  803091:	75 3d                	jne    8030d0 <write+0xa8>
+	{
+		cprintf("[%08x] write %d -- bad mode\n", thisproc->proc_id, fdnum);
+  803093:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80309a:	00 00 00 
+  80309d:	48 8b 00             	mov    (%rax),%rax
+  8030a0:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8030a6:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8030a9:	89 c6                	mov    %eax,%esi
+  8030ab:	48 b8 83 46 80 00 00 	movabs $0x804683,%rax
+  8030b2:	00 00 00 
+  8030b5:	48 89 c7             	mov    %rax,%rdi
+  8030b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030bd:	48 b9 57 03 80 00 00 	movabs $0x800357,%rcx
+  8030c4:	00 00 00 
+  8030c7:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8030c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030ce:	eb 31                	jmp    803101 <write+0xd9>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+				fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8030d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030d4:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8030d8:	48 85 c0             	test   %rax,%rax
+  8030db:	75 07                	jne    8030e4 <write+0xbc>
+		return -E_NOT_SUPP;
+  8030dd:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8030e2:	eb 1d                	jmp    803101 <write+0xd9>
+	return (*dev->dev_write)(fd, buf, n);
+  8030e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030e8:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8030ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030f0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8030f4:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8030f8:	48 89 ce             	mov    %rcx,%rsi
+  8030fb:	48 89 c7             	mov    %rax,%rdi
+  8030fe:	41 ff d0             	call   *%r8
+}
+  803101:	c9                   	leave
+  803102:	c3                   	ret
+
+0000000000803103 <seek>:
+
+int seek(int fdnum, off_t offset)
+{
+  803103:	55                   	push   %rbp
+  803104:	48 89 e5             	mov    %rsp,%rbp
+  803107:	48 83 ec 20          	sub    $0x20,%rsp
+  80310b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80310e:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803111:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803115:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803118:	48 89 d6             	mov    %rdx,%rsi
+  80311b:	89 c7                	mov    %eax,%edi
+  80311d:	48 b8 1d 2a 80 00 00 	movabs $0x802a1d,%rax
+  803124:	00 00 00 
+  803127:	ff d0                	call   *%rax
+  803129:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80312c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803130:	79 05                	jns    803137 <seek+0x34>
+		return r;
+  803132:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803135:	eb 0f                	jmp    803146 <seek+0x43>
+	fd->fd_offset = offset;
+  803137:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80313b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80313e:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  803141:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803146:	c9                   	leave
+  803147:	c3                   	ret
+
+0000000000803148 <ftruncate>:
+
+int ftruncate(int fdnum, off_t newsize)
+{
+  803148:	55                   	push   %rbp
+  803149:	48 89 e5             	mov    %rsp,%rbp
+  80314c:	48 83 ec 30          	sub    $0x30,%rsp
+  803150:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803153:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803156:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80315a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80315d:	48 89 d6             	mov    %rdx,%rsi
+  803160:	89 c7                	mov    %eax,%edi
+  803162:	48 b8 1d 2a 80 00 00 	movabs $0x802a1d,%rax
+  803169:	00 00 00 
+  80316c:	ff d0                	call   *%rax
+  80316e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803171:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803175:	78 24                	js     80319b <ftruncate+0x53>
+  803177:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80317b:	8b 00                	mov    (%rax),%eax
+  80317d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803181:	48 89 d6             	mov    %rdx,%rsi
+  803184:	89 c7                	mov    %eax,%edi
+  803186:	48 b8 4e 2b 80 00 00 	movabs $0x802b4e,%rax
+  80318d:	00 00 00 
+  803190:	ff d0                	call   *%rax
+  803192:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803195:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803199:	79 05                	jns    8031a0 <ftruncate+0x58>
+		return r;
+  80319b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80319e:	eb 75                	jmp    803215 <ftruncate+0xcd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8031a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031a4:	8b 40 08             	mov    0x8(%rax),%eax
+  8031a7:	83 e0 03             	and    $0x3,%eax
+  8031aa:	85 c0                	test   %eax,%eax
+  8031ac:	75 3d                	jne    8031eb <ftruncate+0xa3>
+	{
+		cprintf("[%08x] ftruncate %d -- bad mode\n", thisproc->proc_id, fdnum);
+  8031ae:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8031b5:	00 00 00 
+  8031b8:	48 8b 00             	mov    (%rax),%rax
+  8031bb:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8031c1:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8031c4:	89 c6                	mov    %eax,%esi
+  8031c6:	48 b8 a0 46 80 00 00 	movabs $0x8046a0,%rax
+  8031cd:	00 00 00 
+  8031d0:	48 89 c7             	mov    %rax,%rdi
+  8031d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031d8:	48 b9 57 03 80 00 00 	movabs $0x800357,%rcx
+  8031df:	00 00 00 
+  8031e2:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8031e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031e9:	eb 2a                	jmp    803215 <ftruncate+0xcd>
+	}
+	if (!dev->dev_trunc)
+  8031eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031ef:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8031f3:	48 85 c0             	test   %rax,%rax
+  8031f6:	75 07                	jne    8031ff <ftruncate+0xb7>
+		return -E_NOT_SUPP;
+  8031f8:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8031fd:	eb 16                	jmp    803215 <ftruncate+0xcd>
+	return (*dev->dev_trunc)(fd, newsize);
+  8031ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803203:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803207:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80320b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80320e:	89 d6                	mov    %edx,%esi
+  803210:	48 89 c7             	mov    %rax,%rdi
+  803213:	ff d1                	call   *%rcx
+}
+  803215:	c9                   	leave
+  803216:	c3                   	ret
+
+0000000000803217 <fstat>:
+
+int fstat(int fdnum, struct Stat *stat)
+{
+  803217:	55                   	push   %rbp
+  803218:	48 89 e5             	mov    %rsp,%rbp
+  80321b:	48 83 ec 30          	sub    $0x30,%rsp
+  80321f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803222:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803226:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80322a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80322d:	48 89 d6             	mov    %rdx,%rsi
+  803230:	89 c7                	mov    %eax,%edi
+  803232:	48 b8 1d 2a 80 00 00 	movabs $0x802a1d,%rax
+  803239:	00 00 00 
+  80323c:	ff d0                	call   *%rax
+  80323e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803241:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803245:	78 24                	js     80326b <fstat+0x54>
+  803247:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80324b:	8b 00                	mov    (%rax),%eax
+  80324d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803251:	48 89 d6             	mov    %rdx,%rsi
+  803254:	89 c7                	mov    %eax,%edi
+  803256:	48 b8 4e 2b 80 00 00 	movabs $0x802b4e,%rax
+  80325d:	00 00 00 
+  803260:	ff d0                	call   *%rax
+  803262:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803265:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803269:	79 05                	jns    803270 <fstat+0x59>
+		return r;
+  80326b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80326e:	eb 5e                	jmp    8032ce <fstat+0xb7>
+	if (!dev->dev_stat)
+  803270:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803274:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803278:	48 85 c0             	test   %rax,%rax
+  80327b:	75 07                	jne    803284 <fstat+0x6d>
+		return -E_NOT_SUPP;
+  80327d:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803282:	eb 4a                	jmp    8032ce <fstat+0xb7>
+	stat->st_name[0] = 0;
+  803284:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803288:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  80328b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80328f:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803296:	00 00 00 
+	stat->st_isdir = 0;
+  803299:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80329d:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8032a4:	00 00 00 
+	stat->st_dev = dev;
+  8032a7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8032ab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032af:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  8032b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032ba:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8032be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032c2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8032c6:	48 89 d6             	mov    %rdx,%rsi
+  8032c9:	48 89 c7             	mov    %rax,%rdi
+  8032cc:	ff d1                	call   *%rcx
+}
+  8032ce:	c9                   	leave
+  8032cf:	c3                   	ret
+
+00000000008032d0 <stat>:
+
+int stat(const char *path, struct Stat *stat)
+{
+  8032d0:	55                   	push   %rbp
+  8032d1:	48 89 e5             	mov    %rsp,%rbp
+  8032d4:	48 83 ec 20          	sub    $0x20,%rsp
+  8032d8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8032dc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8032e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8032e9:	48 89 c7             	mov    %rax,%rdi
+  8032ec:	48 b8 be 33 80 00 00 	movabs $0x8033be,%rax
+  8032f3:	00 00 00 
+  8032f6:	ff d0                	call   *%rax
+  8032f8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032fb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8032ff:	79 05                	jns    803306 <stat+0x36>
+		return fd;
+  803301:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803304:	eb 2f                	jmp    803335 <stat+0x65>
+	r = fstat(fd, stat);
+  803306:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80330a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80330d:	48 89 d6             	mov    %rdx,%rsi
+  803310:	89 c7                	mov    %eax,%edi
+  803312:	48 b8 17 32 80 00 00 	movabs $0x803217,%rax
+  803319:	00 00 00 
+  80331c:	ff d0                	call   *%rax
+  80331e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+	close(fd);
+  803321:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803324:	89 c7                	mov    %eax,%edi
+  803326:	48 b8 05 2c 80 00 00 	movabs $0x802c05,%rax
+  80332d:	00 00 00 
+  803330:	ff d0                	call   *%rax
+	return r;
+  803332:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803335:	c9                   	leave
+  803336:	c3                   	ret
+
+0000000000803337 <fsipc>:
+ * dstva 非空时，服务器返回的页映射到 dstva
+ * 返回服务器的结果
+ */
+static int
+fsipc(unsigned type, void *dstva)
+{
+  803337:	55                   	push   %rbp
+  803338:	48 89 e5             	mov    %rsp,%rbp
+  80333b:	48 83 ec 10          	sub    $0x10,%rsp
+  80333f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803342:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	static envid_t fsenv;
+
+	if (fsenv == 0)
+  803346:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80334d:	00 00 00 
+  803350:	8b 00                	mov    (%rax),%eax
+  803352:	85 c0                	test   %eax,%eax
+  803354:	75 1d                	jne    803373 <fsipc+0x3c>
+		fsenv = ipc_find_env(PROC_TYPE_FS);
+  803356:	bf 01 00 00 00       	mov    $0x1,%edi
+  80335b:	48 b8 dc 3f 80 00 00 	movabs $0x803fdc,%rax
+  803362:	00 00 00 
+  803365:	ff d0                	call   *%rax
+  803367:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80336e:	00 00 00 
+  803371:	89 02                	mov    %eax,(%rdx)
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisproc->proc_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803373:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80337a:	00 00 00 
+  80337d:	8b 00                	mov    (%rax),%eax
+  80337f:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  803382:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803387:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80338e:	00 00 00 
+  803391:	89 c7                	mov    %eax,%edi
+  803393:	48 b8 26 3f 80 00 00 	movabs $0x803f26,%rax
+  80339a:	00 00 00 
+  80339d:	ff d0                	call   *%rax
+	return ipc_recv(NULL, dstva, NULL);
+  80339f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033a8:	48 89 c6             	mov    %rax,%rsi
+  8033ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033b0:	48 b8 3c 3e 80 00 00 	movabs $0x803e3c,%rax
+  8033b7:	00 00 00 
+  8033ba:	ff d0                	call   *%rax
+}
+  8033bc:	c9                   	leave
+  8033bd:	c3                   	ret
+
+00000000008033be <open>:
+ *   -E_BAD_PATH: 路径太长
+ *   -E_MAX_OPEN: 文件描述符已用完
+ *   以及服务器返回的错误
+ */
+int open(const char *path, int mode)
+{
+  8033be:	55                   	push   %rbp
+  8033bf:	48 89 e5             	mov    %rsp,%rbp
+  8033c2:	48 83 ec 20          	sub    $0x20,%rsp
+  8033c6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8033ca:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8033cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033d1:	48 89 c7             	mov    %rax,%rdi
+  8033d4:	48 b8 72 0f 80 00 00 	movabs $0x800f72,%rax
+  8033db:	00 00 00 
+  8033de:	ff d0                	call   *%rax
+  8033e0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8033e5:	7e 0a                	jle    8033f1 <open+0x33>
+		return -E_BAD_PATH;
+  8033e7:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8033ec:	e9 a8 00 00 00       	jmp    803499 <open+0xdb>
+
+	if ((r = fd_alloc(&fd)) < 0)
+  8033f1:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8033f5:	48 89 c7             	mov    %rax,%rdi
+  8033f8:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  8033ff:	00 00 00 
+  803402:	ff d0                	call   *%rax
+  803404:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803407:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80340b:	79 08                	jns    803415 <open+0x57>
+		return r;
+  80340d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803410:	e9 84 00 00 00       	jmp    803499 <open+0xdb>
+
+	strcpy(fsipcbuf.open.req_path, path);
+  803415:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803419:	48 89 c6             	mov    %rax,%rsi
+  80341c:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803423:	00 00 00 
+  803426:	48 89 c7             	mov    %rax,%rdi
+  803429:	48 b8 de 0f 80 00 00 	movabs $0x800fde,%rax
+  803430:	00 00 00 
+  803433:	ff d0                	call   *%rax
+	fsipcbuf.open.req_omode = mode;
+  803435:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80343c:	00 00 00 
+  80343f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803442:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+	// 服务器返回的 Fd 页映射到 fd
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0)
+  803448:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80344c:	48 89 c6             	mov    %rax,%rsi
+  80344f:	bf 01 00 00 00       	mov    $0x1,%edi
+  803454:	48 b8 37 33 80 00 00 	movabs $0x803337,%rax
+  80345b:	00 00 00 
+  80345e:	ff d0                	call   *%rax
+  803460:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803463:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803467:	79 1d                	jns    803486 <open+0xc8>
+	{
+		fd_close(fd, 0);
+  803469:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80346d:	be 00 00 00 00       	mov    $0x0,%esi
+  803472:	48 89 c7             	mov    %rax,%rdi
+  803475:	48 b8 83 2a 80 00 00 	movabs $0x802a83,%rax
+  80347c:	00 00 00 
+  80347f:	ff d0                	call   *%rax
+		return r;
+  803481:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803484:	eb 13                	jmp    803499 <open+0xdb>
+	}
+
+	return fd2num(fd);
+  803486:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80348a:	48 89 c7             	mov    %rax,%rdi
+  80348d:	48 b8 30 29 80 00 00 	movabs $0x802930,%rax
+  803494:	00 00 00 
+  803497:	ff d0                	call   *%rax
+}
+  803499:	c9                   	leave
+  80349a:	c3                   	ret
+
+000000000080349b <fexec>:
+ * 把打开的程序文件 fdnum 设为子环境 child 的程序映像，供 spawn 使用
+ * 之后用 sys_vma_binary() 登记的程序段由内核按需从该文件填充
+ * 错误时返回 < 0: fdnum 不是打开的普通文件，或服务器返回的错误
+ */
+int fexec(int fdnum, envid_t child)
+{
+  80349b:	55                   	push   %rbp
+  80349c:	48 89 e5             	mov    %rsp,%rbp
+  80349f:	48 83 ec 20          	sub    $0x20,%rsp
+  8034a3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8034a6:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8034a9:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8034ad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034b0:	48 89 d6             	mov    %rdx,%rsi
+  8034b3:	89 c7                	mov    %eax,%edi
+  8034b5:	48 b8 1d 2a 80 00 00 	movabs $0x802a1d,%rax
+  8034bc:	00 00 00 
+  8034bf:	ff d0                	call   *%rax
+  8034c1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8034c4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8034c8:	79 05                	jns    8034cf <fexec+0x34>
+		return r;
+  8034ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8034cd:	eb 56                	jmp    803525 <fexec+0x8a>
+	if (fd->fd_dev_id != devfile.dev_id)
+  8034cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034d3:	8b 10                	mov    (%rax),%edx
+  8034d5:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8034dc:	00 00 00 
+  8034df:	8b 00                	mov    (%rax),%eax
+  8034e1:	39 c2                	cmp    %eax,%edx
+  8034e3:	74 07                	je     8034ec <fexec+0x51>
+		return -E_INVAL;
+  8034e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034ea:	eb 39                	jmp    803525 <fexec+0x8a>
+	fsipcbuf.exec.req_fileid = fd->fd_file.id;
+  8034ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034f0:	8b 40 0c             	mov    0xc(%rax),%eax
+  8034f3:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8034fa:	00 00 00 
+  8034fd:	89 02                	mov    %eax,(%rdx)
+	fsipcbuf.exec.req_envid = child;
+  8034ff:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803506:	00 00 00 
+  803509:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80350c:	89 42 04             	mov    %eax,0x4(%rdx)
+	return fsipc(FSREQ_EXEC, NULL);
+  80350f:	be 00 00 00 00       	mov    $0x0,%esi
+  803514:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803519:	48 b8 37 33 80 00 00 	movabs $0x803337,%rax
+  803520:	00 00 00 
+  803523:	ff d0                	call   *%rax
+}
+  803525:	c9                   	leave
+  803526:	c3                   	ret
+
+0000000000803527 <devfile_unmap>:
+
+// 解除 fd 的数据窗口中 [from, FILEWINDOW) 的块缓存页映射
+static void
+devfile_unmap(struct Fd *fd, off_t from)
+{
+  803527:	55                   	push   %rbp
+  803528:	48 89 e5             	mov    %rsp,%rbp
+  80352b:	48 83 ec 40          	sub    $0x40,%rsp
+  80352f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803533:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+	char *va = fd2data(fd);
+  803536:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80353a:	48 89 c7             	mov    %rax,%rdi
+  80353d:	48 b8 53 29 80 00 00 	movabs $0x802953,%rax
+  803544:	00 00 00 
+  803547:	ff d0                	call   *%rax
+  803549:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	uintptr_t off;
+
+	for (off = ROUNDUP(from, PGSIZE); off < FILEWINDOW; off += PGSIZE)
+  80354d:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  803554:	00 
+  803555:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803558:	48 63 d0             	movslq %eax,%rdx
+  80355b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80355f:	48 01 d0             	add    %rdx,%rax
+  803562:	48 83 e8 01          	sub    $0x1,%rax
+  803566:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80356a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80356e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803573:	48 f7 75 e8          	divq   -0x18(%rbp)
+  803577:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80357b:	48 29 d0             	sub    %rdx,%rax
+  80357e:	48 98                	cltq
+  803580:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  803584:	eb 45                	jmp    8035cb <devfile_unmap+0xa4>
+		if (va_is_mapped(va + off))
+  803586:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80358a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80358e:	48 01 d0             	add    %rdx,%rax
+  803591:	48 89 c7             	mov    %rax,%rdi
+  803594:	48 b8 e2 3a 80 00 00 	movabs $0x803ae2,%rax
+  80359b:	00 00 00 
+  80359e:	ff d0                	call   *%rax
+  8035a0:	84 c0                	test   %al,%al
+  8035a2:	74 1f                	je     8035c3 <devfile_unmap+0x9c>
+			sys_page_unmap(0, va + off);
+  8035a4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8035a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035ac:	48 01 d0             	add    %rdx,%rax
+  8035af:	48 89 c6             	mov    %rax,%rsi
+  8035b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035b7:	48 b8 f5 1c 80 00 00 	movabs $0x801cf5,%rax
+  8035be:	00 00 00 
+  8035c1:	ff d0                	call   *%rax
+	for (off = ROUNDUP(from, PGSIZE); off < FILEWINDOW; off += PGSIZE)
+  8035c3:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  8035ca:	00 
+  8035cb:	48 c7 45 d8 00 00 20 	movq   $0x200000,-0x28(%rbp)
+  8035d2:	00 
+  8035d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8035d7:	48 05 ff 9f 40 00    	add    $0x409fff,%rax
+  8035dd:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8035e1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8035e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035ea:	48 f7 75 d8          	divq   -0x28(%rbp)
+  8035ee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8035f2:	48 29 d0             	sub    %rdx,%rax
+  8035f5:	48 98                	cltq
+  8035f7:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8035fb:	72 89                	jb     803586 <devfile_unmap+0x5f>
+}
+  8035fd:	90                   	nop
+  8035fe:	90                   	nop
+  8035ff:	c9                   	leave
+  803600:	c3                   	ret
+
+0000000000803601 <devfile_flush>:
+ * 关闭文件时由 fd_close 调用：解除数据窗口的映射，并请求服务器将文件写回磁盘
+ * 服务器在 Fd 页的引用计数降为 1 时回收 OpenFile
+ */
+static int
+devfile_flush(struct Fd *fd)
+{
+  803601:	55                   	push   %rbp
+  803602:	48 89 e5             	mov    %rsp,%rbp
+  803605:	48 83 ec 10          	sub    $0x10,%rsp
+  803609:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	devfile_unmap(fd, 0);
+  80360d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803611:	be 00 00 00 00       	mov    $0x0,%esi
+  803616:	48 89 c7             	mov    %rax,%rdi
+  803619:	48 b8 27 35 80 00 00 	movabs $0x803527,%rax
+  803620:	00 00 00 
+  803623:	ff d0                	call   *%rax
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803625:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803629:	8b 40 0c             	mov    0xc(%rax),%eax
+  80362c:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803633:	00 00 00 
+  803636:	89 02                	mov    %eax,(%rdx)
+	return fsipc(FSREQ_FLUSH, NULL);
+  803638:	be 00 00 00 00       	mov    $0x0,%esi
+  80363d:	bf 06 00 00 00       	mov    $0x6,%edi
+  803642:	48 b8 37 33 80 00 00 	movabs $0x803337,%rax
+  803649:	00 00 00 
+  80364c:	ff d0                	call   *%rax
+}
+  80364e:	c9                   	leave
+  80364f:	c3                   	ret
+
+0000000000803650 <devfile_map>:
+ * 确保文件 offset(BLKSIZE 对齐)处的块已映射在 fd 的数据窗口中
+ * 未映射时请求服务器把块缓存页共享过来(FSREQ_MAP)
+ */
+static int
+devfile_map(struct Fd *fd, off_t offset)
+{
+  803650:	55                   	push   %rbp
+  803651:	48 89 e5             	mov    %rsp,%rbp
+  803654:	48 83 ec 20          	sub    $0x20,%rsp
+  803658:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80365c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	char *va = fd2data(fd) + offset;
+  80365f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803663:	48 89 c7             	mov    %rax,%rdi
+  803666:	48 b8 53 29 80 00 00 	movabs $0x802953,%rax
+  80366d:	00 00 00 
+  803670:	ff d0                	call   *%rax
+  803672:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803675:	48 63 d2             	movslq %edx,%rdx
+  803678:	48 01 d0             	add    %rdx,%rax
+  80367b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+	if (va_is_mapped(va))
+  80367f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803683:	48 89 c7             	mov    %rax,%rdi
+  803686:	48 b8 e2 3a 80 00 00 	movabs $0x803ae2,%rax
+  80368d:	00 00 00 
+  803690:	ff d0                	call   *%rax
+  803692:	84 c0                	test   %al,%al
+  803694:	74 07                	je     80369d <devfile_map+0x4d>
+		return 0;
+  803696:	b8 00 00 00 00       	mov    $0x0,%eax
+  80369b:	eb 3b                	jmp    8036d8 <devfile_map+0x88>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80369d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036a1:	8b 40 0c             	mov    0xc(%rax),%eax
+  8036a4:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8036ab:	00 00 00 
+  8036ae:	89 02                	mov    %eax,(%rdx)
+	fsipcbuf.map.req_offset = offset;
+  8036b0:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8036b7:	00 00 00 
+  8036ba:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8036bd:	89 42 04             	mov    %eax,0x4(%rdx)
+	return fsipc(FSREQ_MAP, va);
+  8036c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036c4:	48 89 c6             	mov    %rax,%rsi
+  8036c7:	bf 09 00 00 00       	mov    $0x9,%edi
+  8036cc:	48 b8 37 33 80 00 00 	movabs $0x803337,%rax
+  8036d3:	00 00 00 
+  8036d6:	ff d0                	call   *%rax
+}
+  8036d8:	c9                   	leave
+  8036d9:	c3                   	ret
+
+00000000008036da <devfile_read>:
+ * 数据不经过 IPC 请求页复制
+ * 返回读取的字节数
+ */
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  8036da:	55                   	push   %rbp
+  8036db:	48 89 e5             	mov    %rsp,%rbp
+  8036de:	48 83 ec 60          	sub    $0x60,%rsp
+  8036e2:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8036e6:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8036ea:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	char *va = fd2data(fd);
+  8036ee:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8036f2:	48 89 c7             	mov    %rax,%rdi
+  8036f5:	48 b8 53 29 80 00 00 	movabs $0x802953,%rax
+  8036fc:	00 00 00 
+  8036ff:	ff d0                	call   *%rax
+  803701:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	off_t pos = fd->fd_offset, end;
+  803705:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803709:	8b 40 04             	mov    0x4(%rax),%eax
+  80370c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	size_t m;
+	int r;
+
+	if (pos >= fd->fd_file.size)
+  80370f:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803713:	8b 40 10             	mov    0x10(%rax),%eax
+  803716:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  803719:	7c 0a                	jl     803725 <devfile_read+0x4b>
+		return 0;
+  80371b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803720:	e9 02 01 00 00       	jmp    803827 <devfile_read+0x14d>
+	end = MIN(pos + (off_t)n, fd->fd_file.size);
+  803725:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803729:	89 c2                	mov    %eax,%edx
+  80372b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80372e:	01 d0                	add    %edx,%eax
+  803730:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803733:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803737:	8b 40 10             	mov    0x10(%rax),%eax
+  80373a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  80373d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803740:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803743:	39 c2                	cmp    %eax,%edx
+  803745:	0f 4e c2             	cmovle %edx,%eax
+  803748:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	n = end - pos;
+  80374b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80374e:	2b 45 fc             	sub    -0x4(%rbp),%eax
+  803751:	48 98                	cltq
+  803753:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+	while (pos < end)
+  803757:	e9 b1 00 00 00       	jmp    80380d <devfile_read+0x133>
+	{
+		if ((r = devfile_map(fd, ROUNDDOWN(pos, BLKSIZE))) < 0)
+  80375c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80375f:	48 98                	cltq
+  803761:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  803765:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803769:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80376e:	89 c2                	mov    %eax,%edx
+  803770:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803774:	89 d6                	mov    %edx,%esi
+  803776:	48 89 c7             	mov    %rax,%rdi
+  803779:	48 b8 50 36 80 00 00 	movabs $0x803650,%rax
+  803780:	00 00 00 
+  803783:	ff d0                	call   *%rax
+  803785:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803788:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  80378c:	79 08                	jns    803796 <devfile_read+0xbc>
+			return r;
+  80378e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803791:	e9 91 00 00 00       	jmp    803827 <devfile_read+0x14d>
+		m = MIN(end - pos, BLKSIZE - pos % BLKSIZE);
+  803796:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803799:	2b 45 fc             	sub    -0x4(%rbp),%eax
+  80379c:	89 45 d0             	mov    %eax,-0x30(%rbp)
+  80379f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8037a2:	89 d0                	mov    %edx,%eax
+  8037a4:	c1 f8 1f             	sar    $0x1f,%eax
+  8037a7:	c1 e8 14             	shr    $0x14,%eax
+  8037aa:	01 c2                	add    %eax,%edx
+  8037ac:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8037b2:	29 c2                	sub    %eax,%edx
+  8037b4:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8037b9:	29 d0                	sub    %edx,%eax
+  8037bb:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8037be:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  8037c1:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8037c4:	39 c2                	cmp    %eax,%edx
+  8037c6:	0f 4e c2             	cmovle %edx,%eax
+  8037c9:	48 98                	cltq
+  8037cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+		memmove(buf, va + pos, m);
+  8037cf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8037d2:	48 63 d0             	movslq %eax,%rdx
+  8037d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037d9:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8037dd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037e1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8037e5:	48 89 ce             	mov    %rcx,%rsi
+  8037e8:	48 89 c7             	mov    %rax,%rdi
+  8037eb:	48 b8 6a 16 80 00 00 	movabs $0x80166a,%rax
+  8037f2:	00 00 00 
+  8037f5:	ff d0                	call   *%rax
+		buf += m;
+  8037f7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8037fb:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+		pos += m;
+  8037ff:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803803:	89 c2                	mov    %eax,%edx
+  803805:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803808:	01 d0                	add    %edx,%eax
+  80380a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	while (pos < end)
+  80380d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803810:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  803813:	0f 8c 43 ff ff ff    	jl     80375c <devfile_read+0x82>
+	}
+	fd->fd_offset = pos;
+  803819:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80381d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803820:	89 50 04             	mov    %edx,0x4(%rax)
+	return n;
+  803823:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  803827:	c9                   	leave
+  803828:	c3                   	ret
+
+0000000000803829 <devfile_write>:
+ * 服务器写入的就是客户端映射的块缓存页，因此已映射的块无需重新映射
+ * 返回写入的字节数
+ */
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  803829:	55                   	push   %rbp
+  80382a:	48 89 e5             	mov    %rsp,%rbp
+  80382d:	48 83 ec 50          	sub    $0x50,%rsp
+  803831:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803835:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803839:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	size_t m, tot = 0;
+  80383d:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803844:	00 
+	int r;
+
+	while (tot < n)
+  803845:	e9 fc 00 00 00       	jmp    803946 <devfile_write+0x11d>
+	{
+		m = MIN(n - tot, sizeof(fsipcbuf.write.req_buf));
+  80384a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80384e:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  803852:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803856:	48 c7 45 e8 f4 0f 00 	movq   $0xff4,-0x18(%rbp)
+  80385d:	00 
+  80385e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803862:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803866:	48 39 c2             	cmp    %rax,%rdx
+  803869:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80386d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803871:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803875:	8b 40 0c             	mov    0xc(%rax),%eax
+  803878:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80387f:	00 00 00 
+  803882:	89 42 08             	mov    %eax,0x8(%rdx)
+		fsipcbuf.write.req_n = m;
+  803885:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80388c:	00 00 00 
+  80388f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803893:	48 89 02             	mov    %rax,(%rdx)
+		memmove(fsipcbuf.write.req_buf, buf + tot, m);
+  803896:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80389a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80389e:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8038a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038a6:	48 89 c2             	mov    %rax,%rdx
+  8038a9:	48 89 ce             	mov    %rcx,%rsi
+  8038ac:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  8038b3:	00 00 00 
+  8038b6:	48 89 c7             	mov    %rax,%rdi
+  8038b9:	48 b8 6a 16 80 00 00 	movabs $0x80166a,%rax
+  8038c0:	00 00 00 
+  8038c3:	ff d0                	call   *%rax
+		if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8038c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8038ca:	bf 04 00 00 00       	mov    $0x4,%edi
+  8038cf:	48 b8 37 33 80 00 00 	movabs $0x803337,%rax
+  8038d6:	00 00 00 
+  8038d9:	ff d0                	call   *%rax
+  8038db:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8038de:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8038e2:	79 05                	jns    8038e9 <devfile_write+0xc0>
+			return r;
+  8038e4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8038e7:	eb 72                	jmp    80395b <devfile_write+0x132>
+		assert(r <= m);
+  8038e9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8038ec:	48 98                	cltq
+  8038ee:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  8038f2:	73 3e                	jae    803932 <devfile_write+0x109>
+  8038f4:	48 b8 c6 46 80 00 00 	movabs $0x8046c6,%rax
+  8038fb:	00 00 00 
+  8038fe:	48 89 c1             	mov    %rax,%rcx
+  803901:	48 b8 cd 46 80 00 00 	movabs $0x8046cd,%rax
+  803908:	00 00 00 
+  80390b:	48 89 c2             	mov    %rax,%rdx
+  80390e:	be bf 00 00 00       	mov    $0xbf,%esi
+  803913:	48 b8 e2 46 80 00 00 	movabs $0x8046e2,%rax
+  80391a:	00 00 00 
+  80391d:	48 89 c7             	mov    %rax,%rdi
+  803920:	b8 00 00 00 00       	mov    $0x0,%eax
+  803925:	49 b8 fa 3b 80 00 00 	movabs $0x803bfa,%r8
+  80392c:	00 00 00 
+  80392f:	41 ff d0             	call   *%r8
+		tot += r;
+  803932:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803935:	48 98                	cltq
+  803937:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		if (r < m)
+  80393b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80393e:	48 98                	cltq
+  803940:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  803944:	72 10                	jb     803956 <devfile_write+0x12d>
+	while (tot < n)
+  803946:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80394a:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80394e:	0f 82 f6 fe ff ff    	jb     80384a <devfile_write+0x21>
+  803954:	eb 01                	jmp    803957 <devfile_write+0x12e>
+			break;
+  803956:	90                   	nop
+	}
+	return tot;
+  803957:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80395b:	c9                   	leave
+  80395c:	c3                   	ret
+
+000000000080395d <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  80395d:	55                   	push   %rbp
+  80395e:	48 89 e5             	mov    %rsp,%rbp
+  803961:	48 83 ec 20          	sub    $0x20,%rsp
+  803965:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803969:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80396d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803971:	8b 40 0c             	mov    0xc(%rax),%eax
+  803974:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80397b:	00 00 00 
+  80397e:	89 02                	mov    %eax,(%rdx)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803980:	be 00 00 00 00       	mov    $0x0,%esi
+  803985:	bf 05 00 00 00       	mov    $0x5,%edi
+  80398a:	48 b8 37 33 80 00 00 	movabs $0x803337,%rax
+  803991:	00 00 00 
+  803994:	ff d0                	call   *%rax
+  803996:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803999:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80399d:	79 05                	jns    8039a4 <devfile_stat+0x47>
+		return r;
+  80399f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039a2:	eb 59                	jmp    8039fd <devfile_stat+0xa0>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8039a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039a8:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8039af:	00 00 00 
+  8039b2:	48 89 d6             	mov    %rdx,%rsi
+  8039b5:	48 89 c7             	mov    %rax,%rdi
+  8039b8:	48 b8 de 0f 80 00 00 	movabs $0x800fde,%rax
+  8039bf:	00 00 00 
+  8039c2:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8039c4:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8039cb:	00 00 00 
+  8039ce:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  8039d4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039d8:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8039de:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8039e5:	00 00 00 
+  8039e8:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  8039ee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039f2:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  8039f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039fd:	c9                   	leave
+  8039fe:	c3                   	ret
+
+00000000008039ff <devfile_trunc>:
+
+// 截断或扩展文件，截断时解除新大小之外的块的映射(这些块可能被服务器释放并重新分配)
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8039ff:	55                   	push   %rbp
+  803a00:	48 89 e5             	mov    %rsp,%rbp
+  803a03:	48 83 ec 10          	sub    $0x10,%rsp
+  803a07:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803a0b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803a0e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a12:	8b 40 0c             	mov    0xc(%rax),%eax
+  803a15:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803a1c:	00 00 00 
+  803a1f:	89 02                	mov    %eax,(%rdx)
+	fsipcbuf.set_size.req_size = newsize;
+  803a21:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803a28:	00 00 00 
+  803a2b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a2e:	89 42 04             	mov    %eax,0x4(%rdx)
+	devfile_unmap(fd, newsize);
+  803a31:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803a34:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a38:	89 d6                	mov    %edx,%esi
+  803a3a:	48 89 c7             	mov    %rax,%rdi
+  803a3d:	48 b8 27 35 80 00 00 	movabs $0x803527,%rax
+  803a44:	00 00 00 
+  803a47:	ff d0                	call   *%rax
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  803a49:	be 00 00 00 00       	mov    $0x0,%esi
+  803a4e:	bf 02 00 00 00       	mov    $0x2,%edi
+  803a53:	48 b8 37 33 80 00 00 	movabs $0x803337,%rax
+  803a5a:	00 00 00 
+  803a5d:	ff d0                	call   *%rax
+}
+  803a5f:	c9                   	leave
+  803a60:	c3                   	ret
+
+0000000000803a61 <remove>:
+
+// 删除文件
+int remove(const char *path)
+{
+  803a61:	55                   	push   %rbp
+  803a62:	48 89 e5             	mov    %rsp,%rbp
+  803a65:	48 83 ec 10          	sub    $0x10,%rsp
+  803a69:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  803a6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a71:	48 89 c7             	mov    %rax,%rdi
+  803a74:	48 b8 72 0f 80 00 00 	movabs $0x800f72,%rax
+  803a7b:	00 00 00 
+  803a7e:	ff d0                	call   *%rax
+  803a80:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803a85:	7e 07                	jle    803a8e <remove+0x2d>
+		return -E_BAD_PATH;
+  803a87:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803a8c:	eb 36                	jmp    803ac4 <remove+0x63>
+	strcpy(fsipcbuf.remove.req_path, path);
+  803a8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a92:	48 89 c6             	mov    %rax,%rsi
+  803a95:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803a9c:	00 00 00 
+  803a9f:	48 89 c7             	mov    %rax,%rdi
+  803aa2:	48 b8 de 0f 80 00 00 	movabs $0x800fde,%rax
+  803aa9:	00 00 00 
+  803aac:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  803aae:	be 00 00 00 00       	mov    $0x0,%esi
+  803ab3:	bf 07 00 00 00       	mov    $0x7,%edi
+  803ab8:	48 b8 37 33 80 00 00 	movabs $0x803337,%rax
+  803abf:	00 00 00 
+  803ac2:	ff d0                	call   *%rax
+}
+  803ac4:	c9                   	leave
+  803ac5:	c3                   	ret
+
+0000000000803ac6 <sync>:
+
+// 将文件系统的所有修改写回磁盘
+int sync(void)
+{
+  803ac6:	55                   	push   %rbp
+  803ac7:	48 89 e5             	mov    %rsp,%rbp
+	return fsipc(FSREQ_SYNC, NULL);
+  803aca:	be 00 00 00 00       	mov    $0x0,%esi
+  803acf:	bf 08 00 00 00       	mov    $0x8,%edi
+  803ad4:	48 b8 37 33 80 00 00 	movabs $0x803337,%rax
+  803adb:	00 00 00 
+  803ade:	ff d0                	call   *%rax
+}
+  803ae0:	5d                   	pop    %rbp
+  803ae1:	c3                   	ret
+
+0000000000803ae2 <va_is_mapped>:
+/**
+ * 虚拟地址 va 是否已映射
+ * 逐级检查页表，避免访问不存在的页表页
+ */
+bool va_is_mapped(void *va)
+{
+  803ae2:	55                   	push   %rbp
+  803ae3:	48 89 e5             	mov    %rsp,%rbp
+  803ae6:	48 83 ec 08          	sub    $0x8,%rsp
+  803aea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return (uvpml4e[VPML4E(va)] & PTE_P) && (uvpde[VPDPE(va)] & PTE_P) &&
+  803aee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803af2:	48 c1 e8 27          	shr    $0x27,%rax
+  803af6:	48 89 c2             	mov    %rax,%rdx
+  803af9:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803b00:	01 00 00 
+  803b03:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803b07:	83 e0 01             	and    $0x1,%eax
+		   (uvpd[VPD(va)] & PTE_P) && (uvpt[VPN(va)] & PTE_P);
+  803b0a:	48 85 c0             	test   %rax,%rax
+  803b0d:	74 6a                	je     803b79 <va_is_mapped+0x97>
+	return (uvpml4e[VPML4E(va)] & PTE_P) && (uvpde[VPDPE(va)] & PTE_P) &&
+  803b0f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b13:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803b17:	48 89 c2             	mov    %rax,%rdx
+  803b1a:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803b21:	01 00 00 
+  803b24:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803b28:	83 e0 01             	and    $0x1,%eax
+  803b2b:	48 85 c0             	test   %rax,%rax
+  803b2e:	74 49                	je     803b79 <va_is_mapped+0x97>
+		   (uvpd[VPD(va)] & PTE_P) && (uvpt[VPN(va)] & PTE_P);
+  803b30:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b34:	48 c1 e8 15          	shr    $0x15,%rax
+  803b38:	48 89 c2             	mov    %rax,%rdx
+  803b3b:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803b42:	01 00 00 
+  803b45:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803b49:	83 e0 01             	and    $0x1,%eax
+	return (uvpml4e[VPML4E(va)] & PTE_P) && (uvpde[VPDPE(va)] & PTE_P) &&
+  803b4c:	48 85 c0             	test   %rax,%rax
+  803b4f:	74 28                	je     803b79 <va_is_mapped+0x97>
+		   (uvpd[VPD(va)] & PTE_P) && (uvpt[VPN(va)] & PTE_P);
+  803b51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b55:	48 c1 e8 0c          	shr    $0xc,%rax
+  803b59:	48 89 c2             	mov    %rax,%rdx
+  803b5c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803b63:	01 00 00 
+  803b66:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803b6a:	83 e0 01             	and    $0x1,%eax
+  803b6d:	48 85 c0             	test   %rax,%rax
+  803b70:	74 07                	je     803b79 <va_is_mapped+0x97>
+  803b72:	b8 01 00 00 00       	mov    $0x1,%eax
+  803b77:	eb 05                	jmp    803b7e <va_is_mapped+0x9c>
+  803b79:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b7e:	83 e0 01             	and    $0x1,%eax
+}
+  803b81:	c9                   	leave
+  803b82:	c3                   	ret
+
+0000000000803b83 <pageref>:
+
+// 返回虚拟地址 v 所在物理页的引用计数，v 未映射时返回 0
+int pageref(void *v)
+{
+  803b83:	55                   	push   %rbp
+  803b84:	48 89 e5             	mov    %rsp,%rbp
+  803b87:	48 83 ec 08          	sub    $0x8,%rsp
+  803b8b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	if (!va_is_mapped(v))
+  803b8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b93:	48 89 c7             	mov    %rax,%rdi
+  803b96:	48 b8 e2 3a 80 00 00 	movabs $0x803ae2,%rax
+  803b9d:	00 00 00 
+  803ba0:	ff d0                	call   *%rax
+  803ba2:	83 f0 01             	xor    $0x1,%eax
+  803ba5:	84 c0                	test   %al,%al
+  803ba7:	74 07                	je     803bb0 <pageref+0x2d>
+		return 0;
+  803ba9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bae:	eb 48                	jmp    803bf8 <pageref+0x75>
+	return pages[PPN(PTE_ADDR(uvpt[VPN(v)]))].pp_ref;
+  803bb0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803bb4:	48 c1 e8 0c          	shr    $0xc,%rax
+  803bb8:	48 89 c2             	mov    %rax,%rdx
+  803bbb:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803bc2:	01 00 00 
+  803bc5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803bc9:	48 c1 e8 0c          	shr    $0xc,%rax
+  803bcd:	48 89 c2             	mov    %rax,%rdx
+  803bd0:	48 b8 ff ff ff ff ff 	movabs $0xfffffffffffff,%rax
+  803bd7:	ff 0f 00 
+  803bda:	48 21 d0             	and    %rdx,%rax
+  803bdd:	48 ba 00 00 a0 00 80 	movabs $0x8000a00000,%rdx
+  803be4:	00 00 00 
+  803be7:	48 c1 e0 04          	shl    $0x4,%rax
+  803beb:	48 01 d0             	add    %rdx,%rax
+  803bee:	48 83 c0 08          	add    $0x8,%rax
+  803bf2:	0f b7 00             	movzwl (%rax),%eax
+  803bf5:	0f b7 c0             	movzwl %ax,%eax
+}
+  803bf8:	c9                   	leave
+  803bf9:	c3                   	ret
+
+0000000000803bfa <_panic>:
+/*
+ * 无法解决的致命错误会导致死机
+ * 打印"死机:<消息>”，然后导致处理器休眠进入HLT状态
+ */
+void _panic(const char *file, int line, const char *fmt, ...)
+{
+  803bfa:	55                   	push   %rbp
+  803bfb:	48 89 e5             	mov    %rsp,%rbp
+  803bfe:	53                   	push   %rbx
+  803bff:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  803c06:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  803c0d:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  803c13:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  803c1a:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  803c21:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  803c28:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  803c2f:	84 c0                	test   %al,%al
+  803c31:	74 23                	je     803c56 <_panic+0x5c>
+  803c33:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  803c3a:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  803c3e:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  803c42:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  803c46:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  803c4a:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  803c4e:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  803c52:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  803c56:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  803c5d:	00 00 00 
+  803c60:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  803c67:	00 00 00 
+  803c6a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803c6e:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  803c75:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  803c7c:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+	// 输出死机的信息
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803c83:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  803c8a:	00 00 00 
+  803c8d:	48 8b 18             	mov    (%rax),%rbx
+  803c90:	48 b8 ca 1b 80 00 00 	movabs $0x801bca,%rax
+  803c97:	00 00 00 
+  803c9a:	ff d0                	call   *%rax
+  803c9c:	89 c6                	mov    %eax,%esi
+  803c9e:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  803ca4:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  803cab:	41 89 d0             	mov    %edx,%r8d
+  803cae:	48 89 c1             	mov    %rax,%rcx
+  803cb1:	48 89 da             	mov    %rbx,%rdx
+  803cb4:	48 b8 f0 46 80 00 00 	movabs $0x8046f0,%rax
+  803cbb:	00 00 00 
+  803cbe:	48 89 c7             	mov    %rax,%rdi
+  803cc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cc6:	49 b9 57 03 80 00 00 	movabs $0x800357,%r9
+  803ccd:	00 00 00 
+  803cd0:	41 ff d1             	call   *%r9
+			sys_getprocid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803cd3:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  803cda:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  803ce1:	48 89 d6             	mov    %rdx,%rsi
+  803ce4:	48 89 c7             	mov    %rax,%rdi
+  803ce7:	48 b8 a8 02 80 00 00 	movabs $0x8002a8,%rax
+  803cee:	00 00 00 
+  803cf1:	ff d0                	call   *%rax
+	cprintf("\n");
+  803cf3:	48 b8 13 47 80 00 00 	movabs $0x804713,%rax
+  803cfa:	00 00 00 
+  803cfd:	48 89 c7             	mov    %rax,%rdi
+  803d00:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d05:	48 ba 57 03 80 00 00 	movabs $0x800357,%rdx
+  803d0c:	00 00 00 
+  803d0f:	ff d2                	call   *%rdx
+
+	// 触发断点中断
+	while (1)
+		asm volatile("int3");
+  803d11:	cc                   	int3
+  803d12:	eb fd                	jmp    803d11 <_panic+0x117>
+
+0000000000803d14 <set_pgfault_handler>:
+ * 包含用户异常栈的初始化和页错误处理函数的设置，利用 kern/syscall.c sys_env_set_pgfault_upcall() 注册(utf字段)用户页错误处理函数
+ * 第一次注册处理程序时，需要分配一个异常堆栈(顶部位于UXSTACKTOP的一页内存)
+ * 并告诉内核在页错误发生时调用汇编语言 _pgfault_upcall 例程
+ */
+void set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803d14:	55                   	push   %rbp
+  803d15:	48 89 e5             	mov    %rsp,%rbp
+  803d18:	48 83 ec 10          	sub    $0x10,%rsp
+  803d1c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	if (_pgfault_handler == 0)
+  803d20:	48 b8 08 90 80 00 00 	movabs $0x809008,%rax
+  803d27:	00 00 00 
+  803d2a:	48 8b 00             	mov    (%rax),%rax
+  803d2d:	48 85 c0             	test   %rax,%rax
+  803d30:	75 72                	jne    803da4 <set_pgfault_handler+0x90>
+	{
+		// 第一次出错，创建用户异常栈
+		if (sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_W | PTE_U | PTE_P) == 0)
+  803d32:	ba 07 00 00 00       	mov    $0x7,%edx
+  803d37:	b8 00 f0 7f ef       	mov    $0xef7ff000,%eax
+  803d3c:	48 89 c6             	mov    %rax,%rsi
+  803d3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d44:	48 b8 43 1c 80 00 00 	movabs $0x801c43,%rax
+  803d4b:	00 00 00 
+  803d4e:	ff d0                	call   *%rax
+  803d50:	85 c0                	test   %eax,%eax
+  803d52:	75 20                	jne    803d74 <set_pgfault_handler+0x60>
+			sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  803d54:	48 b8 b8 3d 80 00 00 	movabs $0x803db8,%rax
+  803d5b:	00 00 00 
+  803d5e:	48 89 c6             	mov    %rax,%rsi
+  803d61:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d66:	48 b8 da 1d 80 00 00 	movabs $0x801dda,%rax
+  803d6d:	00 00 00 
+  803d70:	ff d0                	call   *%rax
+  803d72:	eb 30                	jmp    803da4 <set_pgfault_handler+0x90>
+		else
+			panic("set_pgfault_handler(): no memory");
+  803d74:	48 b8 18 47 80 00 00 	movabs $0x804718,%rax
+  803d7b:	00 00 00 
+  803d7e:	48 89 c2             	mov    %rax,%rdx
+  803d81:	be 1b 00 00 00       	mov    $0x1b,%esi
+  803d86:	48 b8 39 47 80 00 00 	movabs $0x804739,%rax
+  803d8d:	00 00 00 
+  803d90:	48 89 c7             	mov    %rax,%rdi
+  803d93:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d98:	48 b9 fa 3b 80 00 00 	movabs $0x803bfa,%rcx
+  803d9f:	00 00 00 
+  803da2:	ff d1                	call   *%rcx
+	}
+
+	// 存储汇编语言调用的处理函数指针.
+	_pgfault_handler = handler;
+  803da4:	48 ba 08 90 80 00 00 	movabs $0x809008,%rdx
+  803dab:	00 00 00 
+  803dae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803db2:	48 89 02             	mov    %rax,(%rdx)
+}
+  803db5:	90                   	nop
+  803db6:	c9                   	leave
+  803db7:	c3                   	ret
+
+0000000000803db8 <_pgfault_upcall>:
+
+	// 调用C代码中的页错误处理函数.
+	// 函数参数: 指向 UTrapframe 的指针
+
+	// 通过 %rdi 传递函数参数
+	movq  %rsp, %rdi
+  803db8:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  803dbb:	48 a1 08 90 80 00 00 	movabs 0x809008,%rax
+  803dc2:	00 00 00 
+	call *%rax
+  803dc5:	ff d0                	call   *%rax
+			regs: 15*8 = 120-Byte,
+			eflags: 8-Byte,
+			rip: 8-Byte
+	*/
+
+	addq $16, %rsp	/* 跳过用户异常栈中的 utf_fault_va 和 utf_err(不需要) */
+  803dc7:	48 83 c4 10          	add    $0x10,%rsp
+	
+	/* 用户异常栈: %rsp 指向 end of struct PushRegs */
+	
+	movq 120(%rsp), %r10	/* %r10 = %rip */
+  803dcb:	4c 8b 54 24 78       	mov    0x78(%rsp),%r10
+	movq 136(%rsp), %r11	/* %r11 = %rsp */
+  803dd0:	4c 8b 9c 24 88 00 00 	mov    0x88(%rsp),%r11
+  803dd7:	00 
+
+	subq $8, %r11			/* %r11(trap-time %rsp) - 8 */
+  803dd8:	49 83 eb 08          	sub    $0x8,%r11
+	movq %r10, (%r11)		/* %r11(trap-time %rsp) 指向的值为 %rip */
+  803ddc:	4d 89 13             	mov    %r10,(%r11)
+	movq %r11, 136(%rsp)	/* 更新 trap-time %rsp 的值 */
+  803ddf:	4c 89 9c 24 88 00 00 	mov    %r11,0x88(%rsp)
+  803de6:	00 
+		trap-time eflags
+		trap-time rip
+	*/
+
+	// 恢复 trap-time 寄存器集.  接下来不能再修改任何通用寄存器集 PushRegs.
+	POPA_	/* 之前已经通过增加 16-Byte 跳过了 fault_va 和 utf_err，所以只需使用 POPA_ 恢复 */
+  803de7:	4c 8b 3c 24          	mov    (%rsp),%r15
+  803deb:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  803df0:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  803df5:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  803dfa:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  803dff:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  803e04:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  803e09:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  803e0e:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  803e13:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  803e18:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  803e1d:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  803e22:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  803e27:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  803e2c:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  803e31:	48 83 c4 78          	add    $0x78,%rsp
+
+	// 从栈中恢复 %eflags.  接下来不能再使用修改 %eflags 的指令，比如算术指令sub, cmp等.
+	addq $8, %rsp	/* 跳过 %rip，指向 %eflags */
+  803e35:	48 83 c4 08          	add    $0x8,%rsp
+	popfq			/* 从栈中恢复 %eflags */
+  803e39:	9d                   	popf
+		(blank 8-Byte)
+		trap-time rip
+	*/
+
+	// 切换回调整后的 trap-time 栈.
+	popq %rsp		/* 已经指向 %rsp，直接 pop 恢复 */
+  803e3a:	5c                   	pop    %rsp
+
+	// 返回重新执行引起页错误的环境指令.
+	ret				/* popq %rip */
+  803e3b:	c3                   	ret
+
+0000000000803e3c <ipc_recv>:
+ * 如果 pg 为空，则传递 sys_ipc_recv 一个值，它将理解为“no page”的意思
+ * (Zero 不是正确的值，因为这是映射页面的完美有效位置)
+ */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803e3c:	55                   	push   %rbp
+  803e3d:	48 89 e5             	mov    %rsp,%rbp
+  803e40:	48 83 ec 30          	sub    $0x30,%rsp
+  803e44:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803e48:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803e4c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	int r = 0;
+  803e50:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	if(pg) {
+  803e57:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803e5c:	74 18                	je     803e76 <ipc_recv+0x3a>
+		r = sys_ipc_recv(pg);
+  803e5e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e62:	48 89 c7             	mov    %rax,%rdi
+  803e65:	48 b8 7d 1e 80 00 00 	movabs $0x801e7d,%rax
+  803e6c:	00 00 00 
+  803e6f:	ff d0                	call   *%rax
+  803e71:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e74:	eb 1c                	jmp    803e92 <ipc_recv+0x56>
+	}
+	// pg == 0, pg > UTOP
+	else {
+		r = sys_ipc_recv((void*)KERNBASE);
+  803e76:	48 b8 00 00 00 04 80 	movabs $0x8004000000,%rax
+  803e7d:	00 00 00 
+  803e80:	48 89 c7             	mov    %rax,%rdi
+  803e83:	48 b8 7d 1e 80 00 00 	movabs $0x801e7d,%rax
+  803e8a:	00 00 00 
+  803e8d:	ff d0                	call   *%rax
+  803e8f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	}
+	if (r < 0) {
+  803e92:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e96:	79 39                	jns    803ed1 <ipc_recv+0x95>
+		*from_env_store =  (from_env_store != NULL) ? (envid_t)0 : *from_env_store;
+  803e98:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803e9d:	75 08                	jne    803ea7 <ipc_recv+0x6b>
+  803e9f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ea3:	8b 00                	mov    (%rax),%eax
+  803ea5:	eb 05                	jmp    803eac <ipc_recv+0x70>
+  803ea7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eac:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803eb0:	89 02                	mov    %eax,(%rdx)
+		*perm_store = (perm_store != NULL) ? (int)0 : *perm_store;
+  803eb2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803eb7:	75 08                	jne    803ec1 <ipc_recv+0x85>
+  803eb9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ebd:	8b 00                	mov    (%rax),%eax
+  803ebf:	eb 05                	jmp    803ec6 <ipc_recv+0x8a>
+  803ec1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ec6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803eca:	89 02                	mov    %eax,(%rdx)
+		return r;
+  803ecc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ecf:	eb 53                	jmp    803f24 <ipc_recv+0xe8>
+	}
+	// 设置from_env_store为发送进程的进程ID
+	if(from_env_store) {
+  803ed1:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803ed6:	74 19                	je     803ef1 <ipc_recv+0xb5>
+		*from_env_store = thisproc->env_ipc_from;
+  803ed8:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803edf:	00 00 00 
+  803ee2:	48 8b 00             	mov    (%rax),%rax
+  803ee5:	8b 90 6c 01 00 00    	mov    0x16c(%rax),%edx
+  803eeb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803eef:	89 10                	mov    %edx,(%rax)
+	}
+	// 如果传递物理页，该位不为0，设置perm_store为物理页的权限
+	if(perm_store) {
+  803ef1:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803ef6:	74 19                	je     803f11 <ipc_recv+0xd5>
+		*perm_store = thisproc->env_ipc_perm;
+  803ef8:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803eff:	00 00 00 
+  803f02:	48 8b 00             	mov    (%rax),%rax
+  803f05:	8b 90 70 01 00 00    	mov    0x170(%rax),%edx
+  803f0b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f0f:	89 10                	mov    %edx,(%rax)
+	}
+	// 返回发送进程发送的值
+	return thisproc->env_ipc_value;
+  803f11:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803f18:	00 00 00 
+  803f1b:	48 8b 00             	mov    (%rax),%rax
+  803f1e:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  803f24:	c9                   	leave
+  803f25:	c3                   	ret
+
+0000000000803f26 <ipc_send>:
+ * 使用sys_yield()使cpu友好
+ * 如果'pg'为null，则给sys_ipc_recv传递一个它会理解为“无页面”的值(0不是正确的值)
+ */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803f26:	55                   	push   %rbp
+  803f27:	48 89 e5             	mov    %rsp,%rbp
+  803f2a:	48 83 ec 30          	sub    $0x30,%rsp
+  803f2e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803f31:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  803f34:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803f38:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	int r = -E_IPC_NOT_RECV;
+  803f3b:	c7 45 fc f8 ff ff ff 	movl   $0xfffffff8,-0x4(%rbp)
+	// 子进程不是接收状态
+	while(r == -E_IPC_NOT_RECV) {
+  803f42:	eb 59                	jmp    803f9d <ipc_send+0x77>
+		if(pg) {
+  803f44:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803f49:	74 20                	je     803f6b <ipc_send+0x45>
+			// 传递物理页
+			r = sys_ipc_try_send(to_env, val, pg, perm);
+  803f4b:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  803f4e:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  803f51:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803f55:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f58:	89 c7                	mov    %eax,%edi
+  803f5a:	48 b8 26 1e 80 00 00 	movabs $0x801e26,%rax
+  803f61:	00 00 00 
+  803f64:	ff d0                	call   *%rax
+  803f66:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f69:	eb 26                	jmp    803f91 <ipc_send+0x6b>
+		}
+		// pg == 0, pg > UTOP
+		else {
+			// (void*)KERNBASE > UTOP
+			r = sys_ipc_try_send(to_env, val, (void*)KERNBASE, perm);
+  803f6b:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  803f6e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803f71:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f74:	89 d1                	mov    %edx,%ecx
+  803f76:	48 ba 00 00 00 04 80 	movabs $0x8004000000,%rdx
+  803f7d:	00 00 00 
+  803f80:	89 c7                	mov    %eax,%edi
+  803f82:	48 b8 26 1e 80 00 00 	movabs $0x801e26,%rax
+  803f89:	00 00 00 
+  803f8c:	ff d0                	call   *%rax
+  803f8e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+		}
+		// 让出CPU
+		sys_yield();
+  803f91:	48 b8 06 1c 80 00 00 	movabs $0x801c06,%rax
+  803f98:	00 00 00 
+  803f9b:	ff d0                	call   *%rax
+	while(r == -E_IPC_NOT_RECV) {
+  803f9d:	83 7d fc f8          	cmpl   $0xfffffff8,-0x4(%rbp)
+  803fa1:	74 a1                	je     803f44 <ipc_send+0x1e>
+	}
+	if (r != 0) {
+  803fa3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803fa7:	74 30                	je     803fd9 <ipc_send+0xb3>
+		panic("something went wrong with sending the page");
+  803fa9:	48 b8 48 47 80 00 00 	movabs $0x804748,%rax
+  803fb0:	00 00 00 
+  803fb3:	48 89 c2             	mov    %rax,%rdx
+  803fb6:	be 48 00 00 00       	mov    $0x48,%esi
+  803fbb:	48 b8 73 47 80 00 00 	movabs $0x804773,%rax
+  803fc2:	00 00 00 
+  803fc5:	48 89 c7             	mov    %rax,%rdi
+  803fc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fcd:	48 b9 fa 3b 80 00 00 	movabs $0x803bfa,%rcx
+  803fd4:	00 00 00 
+  803fd7:	ff d1                	call   *%rcx
+	}
+}
+  803fd9:	90                   	nop
+  803fda:	c9                   	leave
+  803fdb:	c3                   	ret
+
+0000000000803fdc <ipc_find_env>:
+// find special environments.
+// Returns 0 if no such environment exists.
+// 内核只遍历已分配的环境(env_live)，不扫描整个 procs[]
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803fdc:	55                   	push   %rbp
+  803fdd:	48 89 e5             	mov    %rsp,%rbp
+  803fe0:	48 83 ec 20          	sub    $0x20,%rsp
+  803fe4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	envid_t r = sys_env_find(type);
+  803fe7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fea:	89 c7                	mov    %eax,%edi
+  803fec:	48 b8 f4 20 80 00 00 	movabs $0x8020f4,%rax
+  803ff3:	00 00 00 
+  803ff6:	ff d0                	call   *%rax
+  803ff8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+	return r < 0 ? 0 : r;
+  803ffb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ffe:	ba 00 00 00 00       	mov    $0x0,%edx
+  804003:	85 c0                	test   %eax,%eax
+  804005:	0f 48 c2             	cmovs  %edx,%eax
+}
+  804008:	c9                   	leave
+  804009:	c3                   	ret
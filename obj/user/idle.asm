@@ -0,0 +1,3582 @@
+
+obj/user/idle.debug:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// entrypoint - 当最初被加载到一个新的环境中时，内核(或者父环境)在这里开始运行.
+.text
+.globl _start
+_start:
+	// 判断是否从栈上的参数开始初始化
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	// $USTACKTOP != %rsp 说明有参数，跳转到 args_exist
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// 如果不是(新环境被内核加载的时候)，则 push 伪造的 argc, argv 参数
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 36 00 00 00       	call   800077 <libmain>
+
+// 不应该返回
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+
+#include "inc/x86.h"
+#include "inc/lib.h"
+
+void umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	48 83 ec 10          	sub    $0x10,%rsp
+  80004b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80004e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	binaryname = "idle";
+  800052:	48 b8 00 30 80 00 00 	movabs $0x803000,%rax
+  800059:	00 00 00 
+  80005c:	48 ba e0 21 80 00 00 	movabs $0x8021e0,%rdx
+  800063:	00 00 00 
+  800066:	48 89 10             	mov    %rdx,(%rax)
+	// 死循环，简单地试图放弃不同的进程
+	// 真正实现时，与其像这样忙着等待，不如使用处理器的HLT指令使处理器停止执行，
+	// 直到下一个中断唤醒 —— 这样做可以使处理器更有效地节能
+	while (1)
+	{
+		sys_yield();
+  800069:	48 b8 94 0e 80 00 00 	movabs $0x800e94,%rax
+  800070:	00 00 00 
+  800073:	ff d0                	call   *%rax
+  800075:	eb f2                	jmp    800069 <umain+0x26>
+
+0000000000800077 <libmain>:
+
+/**
+ *  用户环境从lib/libmain.c中的函数libmain开始执行，这个函数进而调用umain，用户写的程序入口只能是umain
+ */
+void libmain(int argc, char **argv)
+{
+  800077:	55                   	push   %rbp
+  800078:	48 89 e5             	mov    %rsp,%rbp
+  80007b:	48 83 ec 10          	sub    $0x10,%rsp
+  80007f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800082:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 设置常量 thisproc 指向 procs[] 中当前环境的 Env 结构，ENVX 确保环境 id 未超过了 NENV
+	// thisproc 指向当前环境的 Env 结构
+	thisproc = &procs[ENVX(sys_getprocid())];
+  800086:	48 b8 58 0e 80 00 00 	movabs $0x800e58,%rax
+  80008d:	00 00 00 
+  800090:	ff d0                	call   *%rax
+  800092:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800097:	48 98                	cltq
+  800099:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  8000a0:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  8000a7:	00 00 00 
+  8000aa:	48 01 c2             	add    %rax,%rdx
+  8000ad:	48 b8 08 30 80 00 00 	movabs $0x803008,%rax
+  8000b4:	00 00 00 
+  8000b7:	48 89 10             	mov    %rdx,(%rax)
+
+	// 通过 CPUID 选择 memset/memmove/memcpy 的实现
+	mem_init();
+  8000ba:	48 b8 00 05 80 00 00 	movabs $0x800500,%rax
+  8000c1:	00 00 00 
+  8000c4:	ff d0                	call   *%rax
+
+	// 为了能让panic()提示用户错误，存储程序的名称
+	if (argc > 0)
+  8000c6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8000ca:	7e 14                	jle    8000e0 <libmain+0x69>
+		binaryname = argv[0];
+  8000cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8000d0:	48 8b 00             	mov    (%rax),%rax
+  8000d3:	48 ba 00 30 80 00 00 	movabs $0x803000,%rdx
+  8000da:	00 00 00 
+  8000dd:	48 89 02             	mov    %rax,(%rdx)
+
+	// 调用用户的主程序
+	umain(argc, argv);
+  8000e0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8000e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000e7:	48 89 d6             	mov    %rdx,%rsi
+  8000ea:	89 c7                	mov    %eax,%edi
+  8000ec:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+
+	// 退出当前环境，env_destroy
+	sys_env_destroy(0);
+  8000f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000fd:	48 b8 12 0e 80 00 00 	movabs $0x800e12,%rax
+  800104:	00 00 00 
+  800107:	ff d0                	call   *%rax
+}
+  800109:	90                   	nop
+  80010a:	c9                   	leave
+  80010b:	c3                   	ret
+
+000000000080010c <cpuid>:
+#define read_rip(var) __asm __volatile("leaq (%%rip), %0" : "=r" (var)::"cc","memory")
+
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  80010c:	55                   	push   %rbp
+  80010d:	48 89 e5             	mov    %rsp,%rbp
+  800110:	53                   	push   %rbx
+  800111:	48 83 ec 38          	sub    $0x38,%rsp
+  800115:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800118:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80011c:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800120:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800124:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid" 
+  800128:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80012b:	0f a2                	cpuid
+  80012d:	89 de                	mov    %ebx,%esi
+  80012f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800132:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800135:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800138:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info));
+	if (eaxp)
+  80013b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800140:	74 09                	je     80014b <cpuid+0x3f>
+		*eaxp = eax;
+  800142:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800146:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800149:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  80014b:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800150:	74 09                	je     80015b <cpuid+0x4f>
+		*ebxp = ebx;
+  800152:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800156:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800159:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  80015b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800160:	74 09                	je     80016b <cpuid+0x5f>
+		*ecxp = ecx;
+  800162:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800166:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800169:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  80016b:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800170:	74 09                	je     80017b <cpuid+0x6f>
+		*edxp = edx;
+  800172:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800176:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800179:	89 10                	mov    %edx,(%rax)
+}
+  80017b:	90                   	nop
+  80017c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800180:	c9                   	leave
+  800181:	c3                   	ret
+
+0000000000800182 <cpuid_count>:
+
+// 带子功能号(%ecx = count)的 cpuid，用于 leaf 4/7/0xB/0xD 等
+static __inline void
+cpuid_count(uint32_t info, uint32_t count, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800182:	55                   	push   %rbp
+  800183:	48 89 e5             	mov    %rsp,%rbp
+  800186:	53                   	push   %rbx
+  800187:	48 83 ec 38          	sub    $0x38,%rsp
+  80018b:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  80018e:	89 75 e0             	mov    %esi,-0x20(%rbp)
+  800191:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800195:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  800199:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+  80019d:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8001a1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8001a4:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8001a7:	89 d1                	mov    %edx,%ecx
+  8001a9:	0f a2                	cpuid
+  8001ab:	89 de                	mov    %ebx,%esi
+  8001ad:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8001b0:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  8001b3:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  8001b6:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info), "c" (count));
+	if (eaxp)
+  8001b9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8001be:	74 09                	je     8001c9 <cpuid_count+0x47>
+		*eaxp = eax;
+  8001c0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8001c4:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8001c7:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  8001c9:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8001ce:	74 09                	je     8001d9 <cpuid_count+0x57>
+		*ebxp = ebx;
+  8001d0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8001d4:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8001d7:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  8001d9:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8001de:	74 09                	je     8001e9 <cpuid_count+0x67>
+		*ecxp = ecx;
+  8001e0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8001e4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8001e7:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  8001e9:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8001ee:	74 09                	je     8001f9 <cpuid_count+0x77>
+		*edxp = edx;
+  8001f0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8001f4:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8001f7:	89 10                	mov    %edx,(%rax)
+}
+  8001f9:	90                   	nop
+  8001fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001fe:	c9                   	leave
+  8001ff:	c3                   	ret
+
+0000000000800200 <strlen>:
+// 在真正的硬件上会有一定程度的优化, 但在 Bochs 上会有更大的优化效果
+// 用这种方法, Primespipe 的运行速度快了3倍
+#define ASM 1
+
+int strlen(const char *s)
+{
+  800200:	55                   	push   %rbp
+  800201:	48 89 e5             	mov    %rsp,%rbp
+  800204:	48 83 ec 18          	sub    $0x18,%rsp
+  800208:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80020c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800213:	eb 09                	jmp    80021e <strlen+0x1e>
+		n++;
+  800215:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  800219:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80021e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800222:	0f b6 00             	movzbl (%rax),%eax
+  800225:	84 c0                	test   %al,%al
+  800227:	75 ec                	jne    800215 <strlen+0x15>
+	return n;
+  800229:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80022c:	c9                   	leave
+  80022d:	c3                   	ret
+
+000000000080022e <strnlen>:
+
+int strnlen(const char *s, size_t size)
+{
+  80022e:	55                   	push   %rbp
+  80022f:	48 89 e5             	mov    %rsp,%rbp
+  800232:	48 83 ec 20          	sub    $0x20,%rsp
+  800236:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80023a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80023e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800245:	eb 0e                	jmp    800255 <strnlen+0x27>
+		n++;
+  800247:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80024b:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800250:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  800255:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80025a:	74 0b                	je     800267 <strnlen+0x39>
+  80025c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800260:	0f b6 00             	movzbl (%rax),%eax
+  800263:	84 c0                	test   %al,%al
+  800265:	75 e0                	jne    800247 <strnlen+0x19>
+	return n;
+  800267:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80026a:	c9                   	leave
+  80026b:	c3                   	ret
+
+000000000080026c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80026c:	55                   	push   %rbp
+  80026d:	48 89 e5             	mov    %rsp,%rbp
+  800270:	48 83 ec 20          	sub    $0x20,%rsp
+  800274:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800278:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  80027c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800280:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  800284:	90                   	nop
+  800285:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800289:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80028d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800291:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800295:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800299:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80029d:	0f b6 12             	movzbl (%rdx),%edx
+  8002a0:	88 10                	mov    %dl,(%rax)
+  8002a2:	0f b6 00             	movzbl (%rax),%eax
+  8002a5:	84 c0                	test   %al,%al
+  8002a7:	75 dc                	jne    800285 <strcpy+0x19>
+		/* do nothing */;
+	return ret;
+  8002a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8002ad:	c9                   	leave
+  8002ae:	c3                   	ret
+
+00000000008002af <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8002af:	55                   	push   %rbp
+  8002b0:	48 89 e5             	mov    %rsp,%rbp
+  8002b3:	48 83 ec 20          	sub    $0x20,%rsp
+  8002b7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8002bb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int len = strlen(dst);
+  8002bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8002c3:	48 89 c7             	mov    %rax,%rdi
+  8002c6:	48 b8 00 02 80 00 00 	movabs $0x800200,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+  8002d2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	strcpy(dst + len, src);
+  8002d5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8002d8:	48 63 d0             	movslq %eax,%rdx
+  8002db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8002df:	48 01 c2             	add    %rax,%rdx
+  8002e2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8002e6:	48 89 c6             	mov    %rax,%rsi
+  8002e9:	48 89 d7             	mov    %rdx,%rdi
+  8002ec:	48 b8 6c 02 80 00 00 	movabs $0x80026c,%rax
+  8002f3:	00 00 00 
+  8002f6:	ff d0                	call   *%rax
+	return dst;
+  8002f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8002fc:	c9                   	leave
+  8002fd:	c3                   	ret
+
+00000000008002fe <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8002fe:	55                   	push   %rbp
+  8002ff:	48 89 e5             	mov    %rsp,%rbp
+  800302:	48 83 ec 28          	sub    $0x28,%rsp
+  800306:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80030a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80030e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  800312:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800316:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++)
+  80031a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  800321:	00 
+  800322:	eb 2a                	jmp    80034e <strncpy+0x50>
+	{
+		*dst++ = *src;
+  800324:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800328:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80032c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800330:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800334:	0f b6 12             	movzbl (%rdx),%edx
+  800337:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  800339:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80033d:	0f b6 00             	movzbl (%rax),%eax
+  800340:	84 c0                	test   %al,%al
+  800342:	74 05                	je     800349 <strncpy+0x4b>
+			src++;
+  800344:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++)
+  800349:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80034e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800352:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  800356:	72 cc                	jb     800324 <strncpy+0x26>
+	}
+	return ret;
+  800358:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80035c:	c9                   	leave
+  80035d:	c3                   	ret
+
+000000000080035e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80035e:	55                   	push   %rbp
+  80035f:	48 89 e5             	mov    %rsp,%rbp
+  800362:	48 83 ec 28          	sub    $0x28,%rsp
+  800366:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80036a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80036e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  800372:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800376:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0)
+  80037a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80037f:	74 3d                	je     8003be <strlcpy+0x60>
+	{
+		while (--size > 0 && *src != '\0')
+  800381:	eb 1d                	jmp    8003a0 <strlcpy+0x42>
+			*dst++ = *src++;
+  800383:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800387:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80038b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80038f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800393:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800397:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80039b:	0f b6 12             	movzbl (%rdx),%edx
+  80039e:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  8003a0:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8003a5:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8003aa:	74 0b                	je     8003b7 <strlcpy+0x59>
+  8003ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8003b0:	0f b6 00             	movzbl (%rax),%eax
+  8003b3:	84 c0                	test   %al,%al
+  8003b5:	75 cc                	jne    800383 <strlcpy+0x25>
+		*dst = '\0';
+  8003b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8003bb:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8003be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8003c2:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8003c6:	c9                   	leave
+  8003c7:	c3                   	ret
+
+00000000008003c8 <strcmp>:
+
+int strcmp(const char *p, const char *q)
+{
+  8003c8:	55                   	push   %rbp
+  8003c9:	48 89 e5             	mov    %rsp,%rbp
+  8003cc:	48 83 ec 10          	sub    $0x10,%rsp
+  8003d0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8003d4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8003d8:	eb 0a                	jmp    8003e4 <strcmp+0x1c>
+		p++, q++;
+  8003da:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8003df:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8003e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003e8:	0f b6 00             	movzbl (%rax),%eax
+  8003eb:	84 c0                	test   %al,%al
+  8003ed:	74 12                	je     800401 <strcmp+0x39>
+  8003ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003f3:	0f b6 10             	movzbl (%rax),%edx
+  8003f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003fa:	0f b6 00             	movzbl (%rax),%eax
+  8003fd:	38 c2                	cmp    %al,%dl
+  8003ff:	74 d9                	je     8003da <strcmp+0x12>
+	return (int)((unsigned char)*p - (unsigned char)*q);
+  800401:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800405:	0f b6 00             	movzbl (%rax),%eax
+  800408:	0f b6 d0             	movzbl %al,%edx
+  80040b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80040f:	0f b6 00             	movzbl (%rax),%eax
+  800412:	0f b6 c0             	movzbl %al,%eax
+  800415:	29 c2                	sub    %eax,%edx
+  800417:	89 d0                	mov    %edx,%eax
+}
+  800419:	c9                   	leave
+  80041a:	c3                   	ret
+
+000000000080041b <strncmp>:
+
+int strncmp(const char *p, const char *q, size_t n)
+{
+  80041b:	55                   	push   %rbp
+  80041c:	48 89 e5             	mov    %rsp,%rbp
+  80041f:	48 83 ec 18          	sub    $0x18,%rsp
+  800423:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800427:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80042b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80042f:	eb 0f                	jmp    800440 <strncmp+0x25>
+		n--, p++, q++;
+  800431:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  800436:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80043b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  800440:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  800445:	74 1d                	je     800464 <strncmp+0x49>
+  800447:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80044b:	0f b6 00             	movzbl (%rax),%eax
+  80044e:	84 c0                	test   %al,%al
+  800450:	74 12                	je     800464 <strncmp+0x49>
+  800452:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800456:	0f b6 10             	movzbl (%rax),%edx
+  800459:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80045d:	0f b6 00             	movzbl (%rax),%eax
+  800460:	38 c2                	cmp    %al,%dl
+  800462:	74 cd                	je     800431 <strncmp+0x16>
+	if (n == 0)
+  800464:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  800469:	75 07                	jne    800472 <strncmp+0x57>
+		return 0;
+  80046b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800470:	eb 16                	jmp    800488 <strncmp+0x6d>
+	else
+		return (int)((unsigned char)*p - (unsigned char)*q);
+  800472:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800476:	0f b6 00             	movzbl (%rax),%eax
+  800479:	0f b6 d0             	movzbl %al,%edx
+  80047c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800480:	0f b6 00             	movzbl (%rax),%eax
+  800483:	0f b6 c0             	movzbl %al,%eax
+  800486:	29 c2                	sub    %eax,%edx
+}
+  800488:	89 d0                	mov    %edx,%eax
+  80048a:	c9                   	leave
+  80048b:	c3                   	ret
+
+000000000080048c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80048c:	55                   	push   %rbp
+  80048d:	48 89 e5             	mov    %rsp,%rbp
+  800490:	48 83 ec 10          	sub    $0x10,%rsp
+  800494:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800498:	89 f0                	mov    %esi,%eax
+  80049a:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80049d:	eb 17                	jmp    8004b6 <strchr+0x2a>
+		if (*s == c)
+  80049f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004a3:	0f b6 00             	movzbl (%rax),%eax
+  8004a6:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8004a9:	75 06                	jne    8004b1 <strchr+0x25>
+			return (char *)s;
+  8004ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004af:	eb 15                	jmp    8004c6 <strchr+0x3a>
+	for (; *s; s++)
+  8004b1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8004b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004ba:	0f b6 00             	movzbl (%rax),%eax
+  8004bd:	84 c0                	test   %al,%al
+  8004bf:	75 de                	jne    80049f <strchr+0x13>
+	return 0;
+  8004c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8004c6:	c9                   	leave
+  8004c7:	c3                   	ret
+
+00000000008004c8 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8004c8:	55                   	push   %rbp
+  8004c9:	48 89 e5             	mov    %rsp,%rbp
+  8004cc:	48 83 ec 10          	sub    $0x10,%rsp
+  8004d0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8004d4:	89 f0                	mov    %esi,%eax
+  8004d6:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8004d9:	eb 11                	jmp    8004ec <strfind+0x24>
+		if (*s == c)
+  8004db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004df:	0f b6 00             	movzbl (%rax),%eax
+  8004e2:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8004e5:	74 12                	je     8004f9 <strfind+0x31>
+	for (; *s; s++)
+  8004e7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8004ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004f0:	0f b6 00             	movzbl (%rax),%eax
+  8004f3:	84 c0                	test   %al,%al
+  8004f5:	75 e4                	jne    8004db <strfind+0x13>
+  8004f7:	eb 01                	jmp    8004fa <strfind+0x32>
+			break;
+  8004f9:	90                   	nop
+	return (char *)s;
+  8004fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8004fe:	c9                   	leave
+  8004ff:	c3                   	ret
+
+0000000000800500 <mem_init>:
+};
+
+static int mem_features;
+
+void mem_init(void)
+{
+  800500:	55                   	push   %rbp
+  800501:	48 89 e5             	mov    %rsp,%rbp
+  800504:	48 83 ec 10          	sub    $0x10,%rsp
+	uint32_t max, ebx, edx;
+
+	mem_features = 0;
+  800508:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  80050f:	00 00 00 
+  800512:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	cpuid(0, &max, NULL, NULL, NULL);
+  800518:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+  80051c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800522:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800527:	ba 00 00 00 00       	mov    $0x0,%edx
+  80052c:	48 89 c6             	mov    %rax,%rsi
+  80052f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800534:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  80053b:	00 00 00 
+  80053e:	ff d0                	call   *%rax
+	cpuid(1, NULL, NULL, NULL, &edx);
+  800540:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  800544:	49 89 c0             	mov    %rax,%r8
+  800547:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80054c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800551:	be 00 00 00 00       	mov    $0x0,%esi
+  800556:	bf 01 00 00 00       	mov    $0x1,%edi
+  80055b:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  800562:	00 00 00 
+  800565:	ff d0                	call   *%rax
+	if (edx & (1 << 26))
+  800567:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80056a:	25 00 00 00 04       	and    $0x4000000,%eax
+  80056f:	85 c0                	test   %eax,%eax
+  800571:	74 1d                	je     800590 <mem_init+0x90>
+		mem_features |= MEM_F_NT;
+  800573:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  80057a:	00 00 00 
+  80057d:	8b 00                	mov    (%rax),%eax
+  80057f:	83 c8 02             	or     $0x2,%eax
+  800582:	89 c2                	mov    %eax,%edx
+  800584:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  80058b:	00 00 00 
+  80058e:	89 10                	mov    %edx,(%rax)
+	if (max >= 7)
+  800590:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800593:	83 f8 06             	cmp    $0x6,%eax
+  800596:	76 57                	jbe    8005ef <mem_init+0xef>
+	{
+		cpuid_count(7, 0, NULL, &ebx, NULL, NULL);
+  800598:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  80059c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8005a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005a8:	48 89 c1             	mov    %rax,%rcx
+  8005ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8005b5:	bf 07 00 00 00       	mov    $0x7,%edi
+  8005ba:	48 b8 82 01 80 00 00 	movabs $0x800182,%rax
+  8005c1:	00 00 00 
+  8005c4:	ff d0                	call   *%rax
+		if (ebx & (1 << 9))
+  8005c6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8005c9:	25 00 02 00 00       	and    $0x200,%eax
+  8005ce:	85 c0                	test   %eax,%eax
+  8005d0:	74 1d                	je     8005ef <mem_init+0xef>
+			mem_features |= MEM_F_ERMS;
+  8005d2:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  8005d9:	00 00 00 
+  8005dc:	8b 00                	mov    (%rax),%eax
+  8005de:	83 c8 01             	or     $0x1,%eax
+  8005e1:	89 c2                	mov    %eax,%edx
+  8005e3:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  8005ea:	00 00 00 
+  8005ed:	89 10                	mov    %edx,(%rax)
+	}
+}
+  8005ef:	90                   	nop
+  8005f0:	c9                   	leave
+  8005f1:	c3                   	ret
+
+00000000008005f2 <memset_nt>:
+
+// 非临时存储填充 n 字节(v 8 字节对齐，n 为 32 的倍数)
+static void
+memset_nt(void *v, uint64_t pattern, size_t n)
+{
+  8005f2:	55                   	push   %rbp
+  8005f3:	48 89 e5             	mov    %rsp,%rbp
+  8005f6:	48 83 ec 28          	sub    $0x28,%rsp
+  8005fa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8005fe:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800602:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t *p = (uint64_t *)v;
+  800606:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80060a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint64_t *end = p + n / 8;
+  80060e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800612:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  800616:	48 89 c2             	mov    %rax,%rdx
+  800619:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80061d:	48 01 d0             	add    %rdx,%rax
+  800620:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	for (; p < end; p += 4)
+  800624:	eb 20                	jmp    800646 <memset_nt+0x54>
+		asm volatile("movnti %1, 0(%0)\n\t"
+  800626:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80062a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80062e:	48 0f c3 10          	movnti %rdx,(%rax)
+  800632:	48 0f c3 50 08       	movnti %rdx,0x8(%rax)
+  800637:	48 0f c3 50 10       	movnti %rdx,0x10(%rax)
+  80063c:	48 0f c3 50 18       	movnti %rdx,0x18(%rax)
+	for (; p < end; p += 4)
+  800641:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  800646:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80064a:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80064e:	72 d6                	jb     800626 <memset_nt+0x34>
+					 "movnti %1, 16(%0)\n\t"
+					 "movnti %1, 24(%0)"
+					 :
+					 : "r"(p), "r"(pattern)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  800650:	0f ae f8             	sfence
+}
+  800653:	90                   	nop
+  800654:	c9                   	leave
+  800655:	c3                   	ret
+
+0000000000800656 <memcpy_nt>:
+
+// 非临时存储复制 n 字节(dst/src 8 字节对齐且不重叠，n 为 32 的倍数)
+static void
+memcpy_nt(void *dst, const void *src, size_t n)
+{
+  800656:	55                   	push   %rbp
+  800657:	48 89 e5             	mov    %rsp,%rbp
+  80065a:	48 83 ec 58          	sub    $0x58,%rsp
+  80065e:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  800662:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  800666:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	uint64_t *d = (uint64_t *)dst;
+  80066a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80066e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint64_t *s = (const uint64_t *)src;
+  800672:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800676:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	uint64_t *end = d + n / 8;
+  80067a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80067e:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  800682:	48 89 c2             	mov    %rax,%rdx
+  800685:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800689:	48 01 d0             	add    %rdx,%rax
+  80068c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint64_t t0, t1, t2, t3;
+
+	for (; d < end; d += 4, s += 4)
+  800690:	eb 44                	jmp    8006d6 <memcpy_nt+0x80>
+		asm volatile("movq 0(%4), %0\n\t"
+  800692:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800696:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80069a:	4c 8b 00             	mov    (%rax),%r8
+  80069d:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  8006a1:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  8006a5:	48 8b 48 18          	mov    0x18(%rax),%rcx
+  8006a9:	4c 0f c3 02          	movnti %r8,(%rdx)
+  8006ad:	48 0f c3 7a 08       	movnti %rdi,0x8(%rdx)
+  8006b2:	48 0f c3 72 10       	movnti %rsi,0x10(%rdx)
+  8006b7:	48 0f c3 4a 18       	movnti %rcx,0x18(%rdx)
+  8006bc:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8006c0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8006c4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8006c8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+	for (; d < end; d += 4, s += 4)
+  8006cc:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  8006d1:	48 83 45 f0 20       	addq   $0x20,-0x10(%rbp)
+  8006d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006da:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  8006de:	72 b2                	jb     800692 <memcpy_nt+0x3c>
+					 "movnti %2, 16(%5)\n\t"
+					 "movnti %3, 24(%5)"
+					 : "=&r"(t0), "=&r"(t1), "=&r"(t2), "=&r"(t3)
+					 : "r"(s), "r"(d)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  8006e0:	0f ae f8             	sfence
+}
+  8006e3:	90                   	nop
+  8006e4:	c9                   	leave
+  8006e5:	c3                   	ret
+
+00000000008006e6 <memcpy_fwd>:
+
+// 正向复制(dst 在 src 之前或两者不重叠)
+static void
+memcpy_fwd(void *dst, const void *src, size_t n)
+{
+  8006e6:	55                   	push   %rbp
+  8006e7:	48 89 e5             	mov    %rsp,%rbp
+  8006ea:	48 83 ec 18          	sub    $0x18,%rsp
+  8006ee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006f2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8006f6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  8006fa:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  800701:	00 00 00 
+  800704:	8b 00                	mov    (%rax),%eax
+  800706:	83 e0 02             	and    $0x2,%eax
+  800709:	85 c0                	test   %eax,%eax
+  80070b:	74 66                	je     800773 <memcpy_fwd+0x8d>
+  80070d:	48 81 7d e8 ff 0f 00 	cmpq   $0xfff,-0x18(%rbp)
+  800714:	00 
+  800715:	76 5c                	jbe    800773 <memcpy_fwd+0x8d>
+  800717:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80071b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80071f:	48 09 d0             	or     %rdx,%rax
+  800722:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  800726:	83 e0 1f             	and    $0x1f,%eax
+  800729:	48 85 c0             	test   %rax,%rax
+  80072c:	75 45                	jne    800773 <memcpy_fwd+0x8d>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  80072e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800732:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800736:	48 01 d0             	add    %rdx,%rax
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  800739:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80073d:	73 11                	jae    800750 <memcpy_fwd+0x6a>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  80073f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800743:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800747:	48 01 d0             	add    %rdx,%rax
+  80074a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80074e:	72 23                	jb     800773 <memcpy_fwd+0x8d>
+		memcpy_nt(dst, src, n);
+  800750:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800754:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800758:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80075c:	48 89 ce             	mov    %rcx,%rsi
+  80075f:	48 89 c7             	mov    %rax,%rdi
+  800762:	48 b8 56 06 80 00 00 	movabs $0x800656,%rax
+  800769:	00 00 00 
+  80076c:	ff d0                	call   *%rax
+  80076e:	e9 81 00 00 00       	jmp    8007f4 <memcpy_fwd+0x10e>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  800773:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  80077a:	00 00 00 
+  80077d:	8b 00                	mov    (%rax),%eax
+  80077f:	83 e0 01             	and    $0x1,%eax
+  800782:	85 c0                	test   %eax,%eax
+  800784:	74 21                	je     8007a7 <memcpy_fwd+0xc1>
+  800786:	48 81 7d e8 ff 00 00 	cmpq   $0xff,-0x18(%rbp)
+  80078d:	00 
+  80078e:	76 17                	jbe    8007a7 <memcpy_fwd+0xc1>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  800790:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800794:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800798:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80079c:	48 89 c7             	mov    %rax,%rdi
+  80079f:	48 89 d6             	mov    %rdx,%rsi
+  8007a2:	fc                   	cld
+  8007a3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8007a5:	eb 4d                	jmp    8007f4 <memcpy_fwd+0x10e>
+					 : "cc", "memory");
+	else if ((((uint64_t)dst | (uint64_t)src | n) & 7) == 0)
+  8007a7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8007af:	48 09 d0             	or     %rdx,%rax
+  8007b2:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  8007b6:	83 e0 07             	and    $0x7,%eax
+  8007b9:	48 85 c0             	test   %rax,%rax
+  8007bc:	75 1f                	jne    8007dd <memcpy_fwd+0xf7>
+		asm volatile("cld; rep movsq\n" ::"D"(dst), "S"(src), "c"(n / 8)
+  8007be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007c2:	48 c1 e8 03          	shr    $0x3,%rax
+  8007c6:	48 89 c1             	mov    %rax,%rcx
+  8007c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007cd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8007d1:	48 89 c7             	mov    %rax,%rdi
+  8007d4:	48 89 d6             	mov    %rdx,%rsi
+  8007d7:	fc                   	cld
+  8007d8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+					 : "cc", "memory");
+}
+  8007db:	eb 17                	jmp    8007f4 <memcpy_fwd+0x10e>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  8007dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007e1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8007e5:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8007e9:	48 89 c7             	mov    %rax,%rdi
+  8007ec:	48 89 d6             	mov    %rdx,%rsi
+  8007ef:	fc                   	cld
+  8007f0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+  8007f2:	eb 00                	jmp    8007f4 <memcpy_fwd+0x10e>
+  8007f4:	90                   	nop
+  8007f5:	c9                   	leave
+  8007f6:	c3                   	ret
+
+00000000008007f7 <memset>:
+
+void *
+memset(void *v, int c, size_t n)
+{
+  8007f7:	55                   	push   %rbp
+  8007f8:	48 89 e5             	mov    %rsp,%rbp
+  8007fb:	48 83 ec 28          	sub    $0x28,%rsp
+  8007ff:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800803:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  800806:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t pattern;
+
+	if (n == 0)
+  80080a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80080f:	75 09                	jne    80081a <memset+0x23>
+		return v;
+  800811:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800815:	e9 dc 00 00 00       	jmp    8008f6 <memset+0xff>
+	c &= 0xFF;
+  80081a:	81 65 e4 ff 00 00 00 	andl   $0xff,-0x1c(%rbp)
+	pattern = (uint64_t)c * 0x0101010101010101UL;
+  800821:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800824:	48 98                	cltq
+  800826:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  80082d:	01 01 01 
+  800830:	48 0f af c2          	imul   %rdx,%rax
+  800834:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)v | n) & 31) == 0)
+  800838:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  80083f:	00 00 00 
+  800842:	8b 00                	mov    (%rax),%eax
+  800844:	83 e0 02             	and    $0x2,%eax
+  800847:	85 c0                	test   %eax,%eax
+  800849:	74 3a                	je     800885 <memset+0x8e>
+  80084b:	48 81 7d d8 ff 0f 00 	cmpq   $0xfff,-0x28(%rbp)
+  800852:	00 
+  800853:	76 30                	jbe    800885 <memset+0x8e>
+  800855:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800859:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  80085d:	83 e0 1f             	and    $0x1f,%eax
+  800860:	48 85 c0             	test   %rax,%rax
+  800863:	75 20                	jne    800885 <memset+0x8e>
+		memset_nt(v, pattern, n);
+  800865:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800869:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80086d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800871:	48 89 ce             	mov    %rcx,%rsi
+  800874:	48 89 c7             	mov    %rax,%rdi
+  800877:	48 b8 f2 05 80 00 00 	movabs $0x8005f2,%rax
+  80087e:	00 00 00 
+  800881:	ff d0                	call   *%rax
+  800883:	eb 6d                	jmp    8008f2 <memset+0xfb>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  800885:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  80088c:	00 00 00 
+  80088f:	8b 00                	mov    (%rax),%eax
+  800891:	83 e0 01             	and    $0x1,%eax
+  800894:	85 c0                	test   %eax,%eax
+  800896:	74 1d                	je     8008b5 <memset+0xbe>
+  800898:	48 81 7d d8 ff 00 00 	cmpq   $0xff,-0x28(%rbp)
+  80089f:	00 
+  8008a0:	76 13                	jbe    8008b5 <memset+0xbe>
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  8008a2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008a6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8008a9:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8008ad:	48 89 d7             	mov    %rdx,%rdi
+  8008b0:	fc                   	cld
+  8008b1:	f3 aa                	rep stos %al,%es:(%rdi)
+  8008b3:	eb 3d                	jmp    8008f2 <memset+0xfb>
+					 : "cc", "memory");
+	else if ((((uint64_t)v | n) & 7) == 0)
+  8008b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008b9:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  8008bd:	83 e0 07             	and    $0x7,%eax
+  8008c0:	48 85 c0             	test   %rax,%rax
+  8008c3:	75 1c                	jne    8008e1 <memset+0xea>
+		asm volatile("cld; rep stosq\n" ::"D"(v), "a"(pattern), "c"(n / 8)
+  8008c5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8008c9:	48 c1 e8 03          	shr    $0x3,%rax
+  8008cd:	48 89 c1             	mov    %rax,%rcx
+  8008d0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008d8:	48 89 d7             	mov    %rdx,%rdi
+  8008db:	fc                   	cld
+  8008dc:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8008df:	eb 11                	jmp    8008f2 <memset+0xfb>
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  8008e1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008e5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8008e8:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8008ec:	48 89 d7             	mov    %rdx,%rdi
+  8008ef:	fc                   	cld
+  8008f0:	f3 aa                	rep stos %al,%es:(%rdi)
+					 : "cc", "memory");
+	return v;
+  8008f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8008f6:	c9                   	leave
+  8008f7:	c3                   	ret
+
+00000000008008f8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008f8:	55                   	push   %rbp
+  8008f9:	48 89 e5             	mov    %rsp,%rbp
+  8008fc:	48 83 ec 28          	sub    $0x28,%rsp
+  800900:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800904:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800908:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  80090c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800910:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  800914:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800918:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d)
+  80091c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800920:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  800924:	73 7c                	jae    8009a2 <memmove+0xaa>
+  800926:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80092a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80092e:	48 01 d0             	add    %rdx,%rax
+  800931:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  800935:	73 6b                	jae    8009a2 <memmove+0xaa>
+	{
+		// 重叠且 dst 在 src 之后，只能反向复制(ERMS 对反向 rep movsb 没有优化)
+		s += n;
+  800937:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80093b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  80093f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800943:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((((uint64_t)s | (uint64_t)d | n) & 7) == 0)
+  800947:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80094b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80094f:	48 09 d0             	or     %rdx,%rax
+  800952:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  800956:	83 e0 07             	and    $0x7,%eax
+  800959:	48 85 c0             	test   %rax,%rax
+  80095c:	75 24                	jne    800982 <memmove+0x8a>
+			asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80095e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800962:	48 83 e8 08          	sub    $0x8,%rax
+  800966:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80096a:	48 83 ea 08          	sub    $0x8,%rdx
+  80096e:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  800972:	48 c1 e9 03          	shr    $0x3,%rcx
+  800976:	48 89 c7             	mov    %rax,%rdi
+  800979:	48 89 d6             	mov    %rdx,%rsi
+  80097c:	fd                   	std
+  80097d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800980:	eb 1d                	jmp    80099f <memmove+0xa7>
+						 : "cc", "memory");
+		else
+			asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800982:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800986:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80098a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80098e:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+  800992:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800996:	48 89 d7             	mov    %rdx,%rdi
+  800999:	48 89 c1             	mov    %rax,%rcx
+  80099c:	fd                   	std
+  80099d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+						 : "cc", "memory");
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::
+  80099f:	fc                   	cld
+  8009a0:	eb 25                	jmp    8009c7 <memmove+0xcf>
+						 : "cc");
+	}
+	else if (n)
+  8009a2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8009a7:	74 1e                	je     8009c7 <memmove+0xcf>
+		memcpy_fwd(d, s, n);
+  8009a9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8009ad:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8009b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8009b5:	48 89 ce             	mov    %rcx,%rsi
+  8009b8:	48 89 c7             	mov    %rax,%rdi
+  8009bb:	48 b8 e6 06 80 00 00 	movabs $0x8006e6,%rax
+  8009c2:	00 00 00 
+  8009c5:	ff d0                	call   *%rax
+	return dst;
+  8009c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8009cb:	c9                   	leave
+  8009cc:	c3                   	ret
+
+00000000008009cd <memcpy>:
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009cd:	55                   	push   %rbp
+  8009ce:	48 89 e5             	mov    %rsp,%rbp
+  8009d1:	48 83 ec 18          	sub    $0x18,%rsp
+  8009d5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8009d9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8009dd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (n)
+  8009e1:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8009e6:	74 1e                	je     800a06 <memcpy+0x39>
+		memcpy_fwd(dst, src, n);
+  8009e8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009ec:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8009f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009f4:	48 89 ce             	mov    %rcx,%rsi
+  8009f7:	48 89 c7             	mov    %rax,%rdi
+  8009fa:	48 b8 e6 06 80 00 00 	movabs $0x8006e6,%rax
+  800a01:	00 00 00 
+  800a04:	ff d0                	call   *%rax
+	return dst;
+  800a06:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800a0a:	c9                   	leave
+  800a0b:	c3                   	ret
+
+0000000000800a0c <memcmp>:
+{
+}
+#endif
+
+int memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a0c:	55                   	push   %rbp
+  800a0d:	48 89 e5             	mov    %rsp,%rbp
+  800a10:	48 83 ec 28          	sub    $0x28,%rsp
+  800a14:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a18:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800a1c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *)v1;
+  800a20:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a24:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *)v2;
+  800a28:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800a2c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0)
+  800a30:	eb 34                	jmp    800a66 <memcmp+0x5a>
+	{
+		if (*s1 != *s2)
+  800a32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a36:	0f b6 10             	movzbl (%rax),%edx
+  800a39:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800a3d:	0f b6 00             	movzbl (%rax),%eax
+  800a40:	38 c2                	cmp    %al,%dl
+  800a42:	74 18                	je     800a5c <memcmp+0x50>
+			return (int)*s1 - (int)*s2;
+  800a44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a48:	0f b6 00             	movzbl (%rax),%eax
+  800a4b:	0f b6 d0             	movzbl %al,%edx
+  800a4e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800a52:	0f b6 00             	movzbl (%rax),%eax
+  800a55:	0f b6 c0             	movzbl %al,%eax
+  800a58:	29 c2                	sub    %eax,%edx
+  800a5a:	eb 20                	jmp    800a7c <memcmp+0x70>
+		s1++, s2++;
+  800a5c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800a61:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0)
+  800a66:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a6a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800a6e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800a72:	48 85 c0             	test   %rax,%rax
+  800a75:	75 bb                	jne    800a32 <memcmp+0x26>
+	}
+
+	return 0;
+  800a77:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  800a7c:	89 d0                	mov    %edx,%eax
+  800a7e:	c9                   	leave
+  800a7f:	c3                   	ret
+
+0000000000800a80 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a80:	55                   	push   %rbp
+  800a81:	48 89 e5             	mov    %rsp,%rbp
+  800a84:	48 83 ec 28          	sub    $0x28,%rsp
+  800a88:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a8c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  800a8f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *)s + n;
+  800a93:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a97:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a9b:	48 01 d0             	add    %rdx,%rax
+  800a9e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  800aa2:	eb 13                	jmp    800ab7 <memfind+0x37>
+		if (*(const unsigned char *)s == (unsigned char)c)
+  800aa4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aa8:	0f b6 00             	movzbl (%rax),%eax
+  800aab:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800aae:	38 d0                	cmp    %dl,%al
+  800ab0:	74 11                	je     800ac3 <memfind+0x43>
+	for (; s < ends; s++)
+  800ab2:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800ab7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800abb:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  800abf:	72 e3                	jb     800aa4 <memfind+0x24>
+  800ac1:	eb 01                	jmp    800ac4 <memfind+0x44>
+			break;
+  800ac3:	90                   	nop
+	return (void *)s;
+  800ac4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  800ac8:	c9                   	leave
+  800ac9:	c3                   	ret
+
+0000000000800aca <strtol>:
+
+long strtol(const char *s, char **endptr, int base)
+{
+  800aca:	55                   	push   %rbp
+  800acb:	48 89 e5             	mov    %rsp,%rbp
+  800ace:	48 83 ec 38          	sub    $0x38,%rsp
+  800ad2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800ad6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  800ada:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  800add:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  800ae4:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  800aeb:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800aec:	eb 05                	jmp    800af3 <strtol+0x29>
+		s++;
+  800aee:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  800af3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800af7:	0f b6 00             	movzbl (%rax),%eax
+  800afa:	3c 20                	cmp    $0x20,%al
+  800afc:	74 f0                	je     800aee <strtol+0x24>
+  800afe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b02:	0f b6 00             	movzbl (%rax),%eax
+  800b05:	3c 09                	cmp    $0x9,%al
+  800b07:	74 e5                	je     800aee <strtol+0x24>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b09:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b0d:	0f b6 00             	movzbl (%rax),%eax
+  800b10:	3c 2b                	cmp    $0x2b,%al
+  800b12:	75 07                	jne    800b1b <strtol+0x51>
+		s++;
+  800b14:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  800b19:	eb 17                	jmp    800b32 <strtol+0x68>
+	else if (*s == '-')
+  800b1b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b1f:	0f b6 00             	movzbl (%rax),%eax
+  800b22:	3c 2d                	cmp    $0x2d,%al
+  800b24:	75 0c                	jne    800b32 <strtol+0x68>
+		s++, neg = 1;
+  800b26:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  800b2b:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b32:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800b36:	74 06                	je     800b3e <strtol+0x74>
+  800b38:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  800b3c:	75 28                	jne    800b66 <strtol+0x9c>
+  800b3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b42:	0f b6 00             	movzbl (%rax),%eax
+  800b45:	3c 30                	cmp    $0x30,%al
+  800b47:	75 1d                	jne    800b66 <strtol+0x9c>
+  800b49:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b4d:	48 83 c0 01          	add    $0x1,%rax
+  800b51:	0f b6 00             	movzbl (%rax),%eax
+  800b54:	3c 78                	cmp    $0x78,%al
+  800b56:	75 0e                	jne    800b66 <strtol+0x9c>
+		s += 2, base = 16;
+  800b58:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  800b5d:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  800b64:	eb 2c                	jmp    800b92 <strtol+0xc8>
+	else if (base == 0 && s[0] == '0')
+  800b66:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800b6a:	75 19                	jne    800b85 <strtol+0xbb>
+  800b6c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b70:	0f b6 00             	movzbl (%rax),%eax
+  800b73:	3c 30                	cmp    $0x30,%al
+  800b75:	75 0e                	jne    800b85 <strtol+0xbb>
+		s++, base = 8;
+  800b77:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  800b7c:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  800b83:	eb 0d                	jmp    800b92 <strtol+0xc8>
+	else if (base == 0)
+  800b85:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800b89:	75 07                	jne    800b92 <strtol+0xc8>
+		base = 10;
+  800b8b:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+	// digits
+	while (1)
+	{
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  800b92:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b96:	0f b6 00             	movzbl (%rax),%eax
+  800b99:	3c 2f                	cmp    $0x2f,%al
+  800b9b:	7e 1d                	jle    800bba <strtol+0xf0>
+  800b9d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ba1:	0f b6 00             	movzbl (%rax),%eax
+  800ba4:	3c 39                	cmp    $0x39,%al
+  800ba6:	7f 12                	jg     800bba <strtol+0xf0>
+			dig = *s - '0';
+  800ba8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bac:	0f b6 00             	movzbl (%rax),%eax
+  800baf:	0f be c0             	movsbl %al,%eax
+  800bb2:	83 e8 30             	sub    $0x30,%eax
+  800bb5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800bb8:	eb 4e                	jmp    800c08 <strtol+0x13e>
+		else if (*s >= 'a' && *s <= 'z')
+  800bba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bbe:	0f b6 00             	movzbl (%rax),%eax
+  800bc1:	3c 60                	cmp    $0x60,%al
+  800bc3:	7e 1d                	jle    800be2 <strtol+0x118>
+  800bc5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bc9:	0f b6 00             	movzbl (%rax),%eax
+  800bcc:	3c 7a                	cmp    $0x7a,%al
+  800bce:	7f 12                	jg     800be2 <strtol+0x118>
+			dig = *s - 'a' + 10;
+  800bd0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bd4:	0f b6 00             	movzbl (%rax),%eax
+  800bd7:	0f be c0             	movsbl %al,%eax
+  800bda:	83 e8 57             	sub    $0x57,%eax
+  800bdd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800be0:	eb 26                	jmp    800c08 <strtol+0x13e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800be2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800be6:	0f b6 00             	movzbl (%rax),%eax
+  800be9:	3c 40                	cmp    $0x40,%al
+  800beb:	7e 47                	jle    800c34 <strtol+0x16a>
+  800bed:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bf1:	0f b6 00             	movzbl (%rax),%eax
+  800bf4:	3c 5a                	cmp    $0x5a,%al
+  800bf6:	7f 3c                	jg     800c34 <strtol+0x16a>
+			dig = *s - 'A' + 10;
+  800bf8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bfc:	0f b6 00             	movzbl (%rax),%eax
+  800bff:	0f be c0             	movsbl %al,%eax
+  800c02:	83 e8 37             	sub    $0x37,%eax
+  800c05:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  800c08:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800c0b:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  800c0e:	7d 23                	jge    800c33 <strtol+0x169>
+			break;
+		s++, val = (val * base) + dig;
+  800c10:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  800c15:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800c18:	48 98                	cltq
+  800c1a:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  800c1f:	48 89 c2             	mov    %rax,%rdx
+  800c22:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800c25:	48 98                	cltq
+  800c27:	48 01 d0             	add    %rdx,%rax
+  800c2a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+  800c2e:	e9 5f ff ff ff       	jmp    800b92 <strtol+0xc8>
+			break;
+  800c33:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c34:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800c39:	74 0b                	je     800c46 <strtol+0x17c>
+		*endptr = (char *)s;
+  800c3b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c3f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800c43:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  800c46:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800c4a:	74 09                	je     800c55 <strtol+0x18b>
+  800c4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c50:	48 f7 d8             	neg    %rax
+  800c53:	eb 04                	jmp    800c59 <strtol+0x18f>
+  800c55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  800c59:	c9                   	leave
+  800c5a:	c3                   	ret
+
+0000000000800c5b <strstr>:
+
+char *strstr(const char *in, const char *str)
+{
+  800c5b:	55                   	push   %rbp
+  800c5c:	48 89 e5             	mov    %rsp,%rbp
+  800c5f:	48 83 ec 30          	sub    $0x30,%rsp
+  800c63:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800c67:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  800c6b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c6f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c73:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800c77:	0f b6 00             	movzbl (%rax),%eax
+  800c7a:	88 45 ff             	mov    %al,-0x1(%rbp)
+	if (!c)
+  800c7d:	80 7d ff 00          	cmpb   $0x0,-0x1(%rbp)
+  800c81:	75 06                	jne    800c89 <strstr+0x2e>
+		return (char *)in; // Trivial empty string case
+  800c83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c87:	eb 6b                	jmp    800cf4 <strstr+0x99>
+
+	len = strlen(str);
+  800c89:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c8d:	48 89 c7             	mov    %rax,%rdi
+  800c90:	48 b8 00 02 80 00 00 	movabs $0x800200,%rax
+  800c97:	00 00 00 
+  800c9a:	ff d0                	call   *%rax
+  800c9c:	48 98                	cltq
+  800c9e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+		char sc;
+
+		do
+		{
+			sc = *in++;
+  800ca2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ca6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800caa:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800cae:	0f b6 00             	movzbl (%rax),%eax
+  800cb1:	88 45 ef             	mov    %al,-0x11(%rbp)
+			if (!sc)
+  800cb4:	80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+  800cb8:	75 07                	jne    800cc1 <strstr+0x66>
+				return (char *)0;
+  800cba:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cbf:	eb 33                	jmp    800cf4 <strstr+0x99>
+		} while (sc != c);
+  800cc1:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+  800cc5:	3a 45 ff             	cmp    -0x1(%rbp),%al
+  800cc8:	75 d8                	jne    800ca2 <strstr+0x47>
+	} while (strncmp(in, str, len) != 0);
+  800cca:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800cce:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  800cd2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800cd6:	48 89 ce             	mov    %rcx,%rsi
+  800cd9:	48 89 c7             	mov    %rax,%rdi
+  800cdc:	48 b8 1b 04 80 00 00 	movabs $0x80041b,%rax
+  800ce3:	00 00 00 
+  800ce6:	ff d0                	call   *%rax
+  800ce8:	85 c0                	test   %eax,%eax
+  800cea:	75 b6                	jne    800ca2 <strstr+0x47>
+
+	return (char *)(in - 1);
+  800cec:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800cf0:	48 83 e8 01          	sub    $0x1,%rax
+}
+  800cf4:	c9                   	leave
+  800cf5:	c3                   	ret
+
+0000000000800cf6 <syscall>:
+ * 用户的指令式系统调用，该函数将系统调用序号放入eax寄存器，五个参数依次放入edx, ecx, ebx, edi, esi，然后执行指令int 0x30，
+ * 发生中断后，去IDT中查找中断处理函数，最终会走到kern/trap.c的trap_dispatch()中
+ */
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  800cf6:	55                   	push   %rbp
+  800cf7:	48 89 e5             	mov    %rsp,%rbp
+  800cfa:	53                   	push   %rbx
+  800cfb:	48 83 ec 48          	sub    $0x48,%rsp
+  800cff:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800d02:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  800d05:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800d09:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800d0d:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  800d11:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	 * volatile 告诉汇编程序不要因为不使用返回值就优化该指令
+	 * 最后一个子句告诉汇编程序，指令可能会改变条件代码cx和任意内存memory位置
+	 * 由汇编编译器做好数据保存和恢复工作(栈)
+	 */
+
+	asm volatile("int %1\n"			// code: int T_SYSCALL
+  800d15:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800d18:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800d1c:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  800d20:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  800d24:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  800d28:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  800d2c:	4c 89 c3             	mov    %r8,%rbx
+  800d2f:	cd 30                	int    $0x30
+  800d31:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+				   "D"(a4),			// edi = a4
+				   "S"(a5)			// esi = a5
+				 : "cc", "memory"); // 指令可能会改变条件代码cx和任意内存memory位置
+									// 由汇编编译器做好数据保存和恢复工作(栈)
+
+	if (check && ret > 0)
+  800d35:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800d39:	74 44                	je     800d7f <syscall+0x89>
+  800d3b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  800d40:	7e 3d                	jle    800d7f <syscall+0x89>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d42:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d46:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800d49:	49 89 d0             	mov    %rdx,%r8
+  800d4c:	89 c1                	mov    %eax,%ecx
+  800d4e:	48 b8 ef 21 80 00 00 	movabs $0x8021ef,%rax
+  800d55:	00 00 00 
+  800d58:	48 89 c2             	mov    %rax,%rdx
+  800d5b:	be 34 00 00 00       	mov    $0x34,%esi
+  800d60:	48 b8 0c 22 80 00 00 	movabs $0x80220c,%rax
+  800d67:	00 00 00 
+  800d6a:	48 89 c7             	mov    %rax,%rdi
+  800d6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d72:	49 b9 69 14 80 00 00 	movabs $0x801469,%r9
+  800d79:	00 00 00 
+  800d7c:	41 ff d1             	call   *%r9
+
+	return ret;
+  800d7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  800d83:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800d87:	c9                   	leave
+  800d88:	c3                   	ret
+
+0000000000800d89 <sys_cputs>:
+
+void sys_cputs(const char *s, size_t len)
+{
+  800d89:	55                   	push   %rbp
+  800d8a:	48 89 e5             	mov    %rsp,%rbp
+  800d8d:	48 83 ec 10          	sub    $0x10,%rsp
+  800d91:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800d95:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 调用lib/syscall.c中的syscall()
+	// SYS_cputs: 系统调用序号(eax)，s: 需要输出的字符数组，len: 数组长度
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  800d99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d9d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800da1:	48 83 ec 08          	sub    $0x8,%rsp
+  800da5:	6a 00                	push   $0x0
+  800da7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800dad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800db3:	48 89 d1             	mov    %rdx,%rcx
+  800db6:	48 89 c2             	mov    %rax,%rdx
+  800db9:	be 00 00 00 00       	mov    $0x0,%esi
+  800dbe:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dc3:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  800dca:	00 00 00 
+  800dcd:	ff d0                	call   *%rax
+  800dcf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800dd3:	90                   	nop
+  800dd4:	c9                   	leave
+  800dd5:	c3                   	ret
+
+0000000000800dd6 <sys_cgetc>:
+
+int sys_cgetc(void)
+{
+  800dd6:	55                   	push   %rbp
+  800dd7:	48 89 e5             	mov    %rsp,%rbp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800dda:	48 83 ec 08          	sub    $0x8,%rsp
+  800dde:	6a 00                	push   $0x0
+  800de0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800de6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800dec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800df1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800df6:	be 00 00 00 00       	mov    $0x0,%esi
+  800dfb:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e00:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  800e07:	00 00 00 
+  800e0a:	ff d0                	call   *%rax
+  800e0c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800e10:	c9                   	leave
+  800e11:	c3                   	ret
+
+0000000000800e12 <sys_env_destroy>:
+
+int sys_env_destroy(envid_t envid)
+{
+  800e12:	55                   	push   %rbp
+  800e13:	48 89 e5             	mov    %rsp,%rbp
+  800e16:	48 83 ec 10          	sub    $0x10,%rsp
+  800e1a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	// 销毁envid对应的环境
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800e1d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e20:	48 98                	cltq
+  800e22:	48 83 ec 08          	sub    $0x8,%rsp
+  800e26:	6a 00                	push   $0x0
+  800e28:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800e2e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e34:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e39:	48 89 c2             	mov    %rax,%rdx
+  800e3c:	be 01 00 00 00       	mov    $0x1,%esi
+  800e41:	bf 03 00 00 00       	mov    $0x3,%edi
+  800e46:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  800e4d:	00 00 00 
+  800e50:	ff d0                	call   *%rax
+  800e52:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800e56:	c9                   	leave
+  800e57:	c3                   	ret
+
+0000000000800e58 <sys_getprocid>:
+
+envid_t
+sys_getprocid(void)
+{
+  800e58:	55                   	push   %rbp
+  800e59:	48 89 e5             	mov    %rsp,%rbp
+	// 获取当前用户环境id
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800e5c:	48 83 ec 08          	sub    $0x8,%rsp
+  800e60:	6a 00                	push   $0x0
+  800e62:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800e68:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e73:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e78:	be 00 00 00 00       	mov    $0x0,%esi
+  800e7d:	bf 02 00 00 00       	mov    $0x2,%edi
+  800e82:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  800e89:	00 00 00 
+  800e8c:	ff d0                	call   *%rax
+  800e8e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800e92:	c9                   	leave
+  800e93:	c3                   	ret
+
+0000000000800e94 <sys_yield>:
+
+void sys_yield(void)
+{
+  800e94:	55                   	push   %rbp
+  800e95:	48 89 e5             	mov    %rsp,%rbp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  800e98:	48 83 ec 08          	sub    $0x8,%rsp
+  800e9c:	6a 00                	push   $0x0
+  800e9e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800ea4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800eaa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eaf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eb4:	be 00 00 00 00       	mov    $0x0,%esi
+  800eb9:	bf 0b 00 00 00       	mov    $0xb,%edi
+  800ebe:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  800ec5:	00 00 00 
+  800ec8:	ff d0                	call   *%rax
+  800eca:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800ece:	90                   	nop
+  800ecf:	c9                   	leave
+  800ed0:	c3                   	ret
+
+0000000000800ed1 <sys_page_alloc>:
+
+int sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ed1:	55                   	push   %rbp
+  800ed2:	48 89 e5             	mov    %rsp,%rbp
+  800ed5:	48 83 ec 10          	sub    $0x10,%rsp
+  800ed9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800edc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800ee0:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  800ee3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800ee6:	48 63 c8             	movslq %eax,%rcx
+  800ee9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800eed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ef0:	48 98                	cltq
+  800ef2:	48 83 ec 08          	sub    $0x8,%rsp
+  800ef6:	6a 00                	push   $0x0
+  800ef8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800efe:	49 89 c8             	mov    %rcx,%r8
+  800f01:	48 89 d1             	mov    %rdx,%rcx
+  800f04:	48 89 c2             	mov    %rax,%rdx
+  800f07:	be 01 00 00 00       	mov    $0x1,%esi
+  800f0c:	bf 04 00 00 00       	mov    $0x4,%edi
+  800f11:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  800f18:	00 00 00 
+  800f1b:	ff d0                	call   *%rax
+  800f1d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800f21:	c9                   	leave
+  800f22:	c3                   	ret
+
+0000000000800f23 <sys_page_map>:
+
+int sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f23:	55                   	push   %rbp
+  800f24:	48 89 e5             	mov    %rsp,%rbp
+  800f27:	48 83 ec 20          	sub    $0x20,%rsp
+  800f2b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800f2e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800f32:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  800f35:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f39:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  800f3d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800f40:	48 63 c8             	movslq %eax,%rcx
+  800f43:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  800f47:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800f4a:	48 63 f0             	movslq %eax,%rsi
+  800f4d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800f51:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800f54:	48 98                	cltq
+  800f56:	48 83 ec 08          	sub    $0x8,%rsp
+  800f5a:	51                   	push   %rcx
+  800f5b:	49 89 f9             	mov    %rdi,%r9
+  800f5e:	49 89 f0             	mov    %rsi,%r8
+  800f61:	48 89 d1             	mov    %rdx,%rcx
+  800f64:	48 89 c2             	mov    %rax,%rdx
+  800f67:	be 01 00 00 00       	mov    $0x1,%esi
+  800f6c:	bf 05 00 00 00       	mov    $0x5,%edi
+  800f71:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  800f78:	00 00 00 
+  800f7b:	ff d0                	call   *%rax
+  800f7d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800f81:	c9                   	leave
+  800f82:	c3                   	ret
+
+0000000000800f83 <sys_page_unmap>:
+
+int sys_page_unmap(envid_t envid, void *va)
+{
+  800f83:	55                   	push   %rbp
+  800f84:	48 89 e5             	mov    %rsp,%rbp
+  800f87:	48 83 ec 10          	sub    $0x10,%rsp
+  800f8b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800f8e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  800f92:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800f96:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800f99:	48 98                	cltq
+  800f9b:	48 83 ec 08          	sub    $0x8,%rsp
+  800f9f:	6a 00                	push   $0x0
+  800fa1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800fa7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fad:	48 89 d1             	mov    %rdx,%rcx
+  800fb0:	48 89 c2             	mov    %rax,%rdx
+  800fb3:	be 01 00 00 00       	mov    $0x1,%esi
+  800fb8:	bf 06 00 00 00       	mov    $0x6,%edi
+  800fbd:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  800fc4:	00 00 00 
+  800fc7:	ff d0                	call   *%rax
+  800fc9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800fcd:	c9                   	leave
+  800fce:	c3                   	ret
+
+0000000000800fcf <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int sys_env_set_status(envid_t envid, int status)
+{
+  800fcf:	55                   	push   %rbp
+  800fd0:	48 89 e5             	mov    %rsp,%rbp
+  800fd3:	48 83 ec 10          	sub    $0x10,%rsp
+  800fd7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800fda:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  800fdd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800fe0:	48 63 d0             	movslq %eax,%rdx
+  800fe3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800fe6:	48 98                	cltq
+  800fe8:	48 83 ec 08          	sub    $0x8,%rsp
+  800fec:	6a 00                	push   $0x0
+  800fee:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800ff4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800ffa:	48 89 d1             	mov    %rdx,%rcx
+  800ffd:	48 89 c2             	mov    %rax,%rdx
+  801000:	be 01 00 00 00       	mov    $0x1,%esi
+  801005:	bf 08 00 00 00       	mov    $0x8,%edi
+  80100a:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  801011:	00 00 00 
+  801014:	ff d0                	call   *%rax
+  801016:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80101a:	c9                   	leave
+  80101b:	c3                   	ret
+
+000000000080101c <sys_env_set_trapframe>:
+
+int sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80101c:	55                   	push   %rbp
+  80101d:	48 89 e5             	mov    %rsp,%rbp
+  801020:	48 83 ec 10          	sub    $0x10,%rsp
+  801024:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801027:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  80102b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80102f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801032:	48 98                	cltq
+  801034:	48 83 ec 08          	sub    $0x8,%rsp
+  801038:	6a 00                	push   $0x0
+  80103a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801040:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801046:	48 89 d1             	mov    %rdx,%rcx
+  801049:	48 89 c2             	mov    %rax,%rdx
+  80104c:	be 01 00 00 00       	mov    $0x1,%esi
+  801051:	bf 09 00 00 00       	mov    $0x9,%edi
+  801056:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  80105d:	00 00 00 
+  801060:	ff d0                	call   *%rax
+  801062:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801066:	c9                   	leave
+  801067:	c3                   	ret
+
+0000000000801068 <sys_env_set_pgfault_upcall>:
+
+int sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801068:	55                   	push   %rbp
+  801069:	48 89 e5             	mov    %rsp,%rbp
+  80106c:	48 83 ec 10          	sub    $0x10,%rsp
+  801070:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801073:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  801077:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80107b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80107e:	48 98                	cltq
+  801080:	48 83 ec 08          	sub    $0x8,%rsp
+  801084:	6a 00                	push   $0x0
+  801086:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80108c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801092:	48 89 d1             	mov    %rdx,%rcx
+  801095:	48 89 c2             	mov    %rax,%rdx
+  801098:	be 01 00 00 00       	mov    $0x1,%esi
+  80109d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8010a2:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  8010a9:	00 00 00 
+  8010ac:	ff d0                	call   *%rax
+  8010ae:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8010b2:	c9                   	leave
+  8010b3:	c3                   	ret
+
+00000000008010b4 <sys_ipc_try_send>:
+
+int sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8010b4:	55                   	push   %rbp
+  8010b5:	48 89 e5             	mov    %rsp,%rbp
+  8010b8:	48 83 ec 20          	sub    $0x20,%rsp
+  8010bc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8010bf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8010c3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8010c7:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8010ca:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8010cd:	48 63 f0             	movslq %eax,%rsi
+  8010d0:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8010d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8010d7:	48 98                	cltq
+  8010d9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8010dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8010e1:	6a 00                	push   $0x0
+  8010e3:	49 89 f1             	mov    %rsi,%r9
+  8010e6:	49 89 c8             	mov    %rcx,%r8
+  8010e9:	48 89 d1             	mov    %rdx,%rcx
+  8010ec:	48 89 c2             	mov    %rax,%rdx
+  8010ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8010f4:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8010f9:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  801100:	00 00 00 
+  801103:	ff d0                	call   *%rax
+  801105:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801109:	c9                   	leave
+  80110a:	c3                   	ret
+
+000000000080110b <sys_ipc_recv>:
+
+int sys_ipc_recv(void *dstva)
+{
+  80110b:	55                   	push   %rbp
+  80110c:	48 89 e5             	mov    %rsp,%rbp
+  80110f:	48 83 ec 10          	sub    $0x10,%rsp
+  801113:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  801117:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80111b:	48 83 ec 08          	sub    $0x8,%rsp
+  80111f:	6a 00                	push   $0x0
+  801121:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801127:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80112d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801132:	48 89 c2             	mov    %rax,%rdx
+  801135:	be 01 00 00 00       	mov    $0x1,%esi
+  80113a:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80113f:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  801146:	00 00 00 
+  801149:	ff d0                	call   *%rax
+  80114b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80114f:	c9                   	leave
+  801150:	c3                   	ret
+
+0000000000801151 <sys_disk_io>:
+
+int sys_disk_io(int dev, uint64_t secno, void *va, size_t nsecs, int write)
+{
+  801151:	55                   	push   %rbp
+  801152:	48 89 e5             	mov    %rsp,%rbp
+  801155:	48 83 ec 20          	sub    $0x20,%rsp
+  801159:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80115c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801160:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801164:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  801168:	44 89 45 f8          	mov    %r8d,-0x8(%rbp)
+	return syscall(SYS_disk_io, 0, dev, secno, (uint64_t)va, nsecs, write);
+  80116c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80116f:	48 63 c8             	movslq %eax,%rcx
+  801172:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  801176:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801179:	48 98                	cltq
+  80117b:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80117f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801183:	48 83 ec 08          	sub    $0x8,%rsp
+  801187:	51                   	push   %rcx
+  801188:	49 89 f9             	mov    %rdi,%r9
+  80118b:	49 89 f0             	mov    %rsi,%r8
+  80118e:	48 89 d1             	mov    %rdx,%rcx
+  801191:	48 89 c2             	mov    %rax,%rdx
+  801194:	be 00 00 00 00       	mov    $0x0,%esi
+  801199:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80119e:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  8011a5:	00 00 00 
+  8011a8:	ff d0                	call   *%rax
+  8011aa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8011ae:	c9                   	leave
+  8011af:	c3                   	ret
+
+00000000008011b0 <sys_vma_alloc>:
+
+int sys_vma_alloc(envid_t envid, void *va, size_t len, int perm)
+{
+  8011b0:	55                   	push   %rbp
+  8011b1:	48 89 e5             	mov    %rsp,%rbp
+  8011b4:	48 83 ec 20          	sub    $0x20,%rsp
+  8011b8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8011bb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8011bf:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8011c3:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_vma_alloc, 1, envid, (uint64_t)va, len, perm, 0);
+  8011c6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8011c9:	48 63 f0             	movslq %eax,%rsi
+  8011cc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8011d0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8011d3:	48 98                	cltq
+  8011d5:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8011d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8011dd:	6a 00                	push   $0x0
+  8011df:	49 89 f1             	mov    %rsi,%r9
+  8011e2:	49 89 c8             	mov    %rcx,%r8
+  8011e5:	48 89 d1             	mov    %rdx,%rcx
+  8011e8:	48 89 c2             	mov    %rax,%rdx
+  8011eb:	be 01 00 00 00       	mov    $0x1,%esi
+  8011f0:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8011f5:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  8011fc:	00 00 00 
+  8011ff:	ff d0                	call   *%rax
+  801201:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801205:	c9                   	leave
+  801206:	c3                   	ret
+
+0000000000801207 <sys_vma_clear>:
+
+int sys_vma_clear(envid_t envid)
+{
+  801207:	55                   	push   %rbp
+  801208:	48 89 e5             	mov    %rsp,%rbp
+  80120b:	48 83 ec 10          	sub    $0x10,%rsp
+  80120f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_vma_clear, 1, envid, 0, 0, 0, 0);
+  801212:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801215:	48 98                	cltq
+  801217:	48 83 ec 08          	sub    $0x8,%rsp
+  80121b:	6a 00                	push   $0x0
+  80121d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801223:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801229:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80122e:	48 89 c2             	mov    %rax,%rdx
+  801231:	be 01 00 00 00       	mov    $0x1,%esi
+  801236:	bf 10 00 00 00       	mov    $0x10,%edi
+  80123b:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  801242:	00 00 00 
+  801245:	ff d0                	call   *%rax
+  801247:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80124b:	c9                   	leave
+  80124c:	c3                   	ret
+
+000000000080124d <sys_trace_ctl>:
+
+int sys_trace_ctl(int enable)
+{
+  80124d:	55                   	push   %rbp
+  80124e:	48 89 e5             	mov    %rsp,%rbp
+  801251:	48 83 ec 10          	sub    $0x10,%rsp
+  801255:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_trace_ctl, 0, enable, 0, 0, 0, 0);
+  801258:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80125b:	48 98                	cltq
+  80125d:	48 83 ec 08          	sub    $0x8,%rsp
+  801261:	6a 00                	push   $0x0
+  801263:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801269:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80126f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801274:	48 89 c2             	mov    %rax,%rdx
+  801277:	be 00 00 00 00       	mov    $0x0,%esi
+  80127c:	bf 11 00 00 00       	mov    $0x11,%edi
+  801281:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  801288:	00 00 00 
+  80128b:	ff d0                	call   *%rax
+  80128d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801291:	c9                   	leave
+  801292:	c3                   	ret
+
+0000000000801293 <sys_trace_read>:
+
+int sys_trace_read(int cpu, uint64_t *seq, struct TraceEvent *buf, int n)
+{
+  801293:	55                   	push   %rbp
+  801294:	48 89 e5             	mov    %rsp,%rbp
+  801297:	48 83 ec 20          	sub    $0x20,%rsp
+  80129b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80129e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8012a2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8012a6:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_trace_read, 0, cpu, (uint64_t)seq, (uint64_t)buf, n, 0);
+  8012a9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8012ac:	48 63 f0             	movslq %eax,%rsi
+  8012af:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8012b3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8012b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012ba:	48 98                	cltq
+  8012bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8012c0:	6a 00                	push   $0x0
+  8012c2:	49 89 f1             	mov    %rsi,%r9
+  8012c5:	49 89 c8             	mov    %rcx,%r8
+  8012c8:	48 89 d1             	mov    %rdx,%rcx
+  8012cb:	48 89 c2             	mov    %rax,%rdx
+  8012ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d3:	bf 12 00 00 00       	mov    $0x12,%edi
+  8012d8:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  8012df:	00 00 00 
+  8012e2:	ff d0                	call   *%rax
+  8012e4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8012e8:	c9                   	leave
+  8012e9:	c3                   	ret
+
+00000000008012ea <sys_getrusage>:
+
+int sys_getrusage(envid_t envid, struct Rusage *ru)
+{
+  8012ea:	55                   	push   %rbp
+  8012eb:	48 89 e5             	mov    %rsp,%rbp
+  8012ee:	48 83 ec 10          	sub    $0x10,%rsp
+  8012f2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8012f5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_getrusage, 0, envid, (uint64_t)ru, 0, 0, 0);
+  8012f9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8012fd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801300:	48 98                	cltq
+  801302:	48 83 ec 08          	sub    $0x8,%rsp
+  801306:	6a 00                	push   $0x0
+  801308:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80130e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801314:	48 89 d1             	mov    %rdx,%rcx
+  801317:	48 89 c2             	mov    %rax,%rdx
+  80131a:	be 00 00 00 00       	mov    $0x0,%esi
+  80131f:	bf 13 00 00 00       	mov    $0x13,%edi
+  801324:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  80132b:	00 00 00 
+  80132e:	ff d0                	call   *%rax
+  801330:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801334:	c9                   	leave
+  801335:	c3                   	ret
+
+0000000000801336 <sys_pmu_config>:
+
+int sys_pmu_config(int idx, uint64_t event)
+{
+  801336:	55                   	push   %rbp
+  801337:	48 89 e5             	mov    %rsp,%rbp
+  80133a:	48 83 ec 10          	sub    $0x10,%rsp
+  80133e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801341:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_pmu_config, 0, idx, event, 0, 0, 0);
+  801345:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801348:	48 98                	cltq
+  80134a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80134e:	48 83 ec 08          	sub    $0x8,%rsp
+  801352:	6a 00                	push   $0x0
+  801354:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80135a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801360:	48 89 d1             	mov    %rdx,%rcx
+  801363:	48 89 c2             	mov    %rax,%rdx
+  801366:	be 00 00 00 00       	mov    $0x0,%esi
+  80136b:	bf 14 00 00 00       	mov    $0x14,%edi
+  801370:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  801377:	00 00 00 
+  80137a:	ff d0                	call   *%rax
+  80137c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801380:	c9                   	leave
+  801381:	c3                   	ret
+
+0000000000801382 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  801382:	55                   	push   %rbp
+  801383:	48 89 e5             	mov    %rsp,%rbp
+  801386:	48 83 ec 10          	sub    $0x10,%rsp
+  80138a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+  80138d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801390:	48 83 ec 08          	sub    $0x8,%rsp
+  801394:	6a 00                	push   $0x0
+  801396:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80139c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013a7:	48 89 c2             	mov    %rax,%rdx
+  8013aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8013af:	bf 15 00 00 00       	mov    $0x15,%edi
+  8013b4:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  8013bb:	00 00 00 
+  8013be:	ff d0                	call   *%rax
+  8013c0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8013c4:	c9                   	leave
+  8013c5:	c3                   	ret
+
+00000000008013c6 <sys_image_attach>:
+
+int sys_image_attach(envid_t envid, int dev, const uint64_t *secnos, size_t size)
+{
+  8013c6:	55                   	push   %rbp
+  8013c7:	48 89 e5             	mov    %rsp,%rbp
+  8013ca:	48 83 ec 20          	sub    $0x20,%rsp
+  8013ce:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8013d1:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  8013d4:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8013d8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+	return syscall(SYS_image_attach, 1, envid, dev, (uint64_t)secnos, size, 0);
+  8013dc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8013e0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8013e3:	48 63 d0             	movslq %eax,%rdx
+  8013e6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8013e9:	48 98                	cltq
+  8013eb:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8013ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8013f3:	6a 00                	push   $0x0
+  8013f5:	49 89 f1             	mov    %rsi,%r9
+  8013f8:	49 89 c8             	mov    %rcx,%r8
+  8013fb:	48 89 d1             	mov    %rdx,%rcx
+  8013fe:	48 89 c2             	mov    %rax,%rdx
+  801401:	be 01 00 00 00       	mov    $0x1,%esi
+  801406:	bf 16 00 00 00       	mov    $0x16,%edi
+  80140b:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  801412:	00 00 00 
+  801415:	ff d0                	call   *%rax
+  801417:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80141b:	c9                   	leave
+  80141c:	c3                   	ret
+
+000000000080141d <sys_vma_binary>:
+
+int sys_vma_binary(envid_t envid, const struct Proghdr *ph)
+{
+  80141d:	55                   	push   %rbp
+  80141e:	48 89 e5             	mov    %rsp,%rbp
+  801421:	48 83 ec 10          	sub    $0x10,%rsp
+  801425:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801428:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_vma_binary, 1, envid, (uint64_t)ph, 0, 0, 0);
+  80142c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801430:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801433:	48 98                	cltq
+  801435:	48 83 ec 08          	sub    $0x8,%rsp
+  801439:	6a 00                	push   $0x0
+  80143b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801441:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801447:	48 89 d1             	mov    %rdx,%rcx
+  80144a:	48 89 c2             	mov    %rax,%rdx
+  80144d:	be 01 00 00 00       	mov    $0x1,%esi
+  801452:	bf 17 00 00 00       	mov    $0x17,%edi
+  801457:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  80145e:	00 00 00 
+  801461:	ff d0                	call   *%rax
+  801463:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801467:	c9                   	leave
+  801468:	c3                   	ret
+
+0000000000801469 <_panic>:
+/*
+ * 无法解决的致命错误会导致死机
+ * 打印"死机:<消息>”，然后导致处理器休眠进入HLT状态
+ */
+void _panic(const char *file, int line, const char *fmt, ...)
+{
+  801469:	55                   	push   %rbp
+  80146a:	48 89 e5             	mov    %rsp,%rbp
+  80146d:	53                   	push   %rbx
+  80146e:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  801475:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  80147c:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  801482:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  801489:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  801490:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  801497:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  80149e:	84 c0                	test   %al,%al
+  8014a0:	74 23                	je     8014c5 <_panic+0x5c>
+  8014a2:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  8014a9:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  8014ad:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  8014b1:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  8014b5:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  8014b9:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  8014bd:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  8014c1:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8014c5:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  8014cc:	00 00 00 
+  8014cf:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  8014d6:	00 00 00 
+  8014d9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014dd:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  8014e4:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  8014eb:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+	// 输出死机的信息
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8014f2:	48 b8 00 30 80 00 00 	movabs $0x803000,%rax
+  8014f9:	00 00 00 
+  8014fc:	48 8b 18             	mov    (%rax),%rbx
+  8014ff:	48 b8 58 0e 80 00 00 	movabs $0x800e58,%rax
+  801506:	00 00 00 
+  801509:	ff d0                	call   *%rax
+  80150b:	89 c6                	mov    %eax,%esi
+  80150d:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  801513:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80151a:	41 89 d0             	mov    %edx,%r8d
+  80151d:	48 89 c1             	mov    %rax,%rcx
+  801520:	48 89 da             	mov    %rbx,%rdx
+  801523:	48 b8 20 22 80 00 00 	movabs $0x802220,%rax
+  80152a:	00 00 00 
+  80152d:	48 89 c7             	mov    %rax,%rdi
+  801530:	b8 00 00 00 00       	mov    $0x0,%eax
+  801535:	49 b9 ac 16 80 00 00 	movabs $0x8016ac,%r9
+  80153c:	00 00 00 
+  80153f:	41 ff d1             	call   *%r9
+			sys_getprocid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801542:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  801549:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801550:	48 89 d6             	mov    %rdx,%rsi
+  801553:	48 89 c7             	mov    %rax,%rdi
+  801556:	48 b8 fd 15 80 00 00 	movabs $0x8015fd,%rax
+  80155d:	00 00 00 
+  801560:	ff d0                	call   *%rax
+	cprintf("\n");
+  801562:	48 b8 43 22 80 00 00 	movabs $0x802243,%rax
+  801569:	00 00 00 
+  80156c:	48 89 c7             	mov    %rax,%rdi
+  80156f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801574:	48 ba ac 16 80 00 00 	movabs $0x8016ac,%rdx
+  80157b:	00 00 00 
+  80157e:	ff d2                	call   *%rdx
+
+	// 触发断点中断
+	while (1)
+		asm volatile("int3");
+  801580:	cc                   	int3
+  801581:	eb fd                	jmp    801580 <_panic+0x117>
+
+0000000000801583 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801583:	55                   	push   %rbp
+  801584:	48 89 e5             	mov    %rsp,%rbp
+  801587:	48 83 ec 10          	sub    $0x10,%rsp
+  80158b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80158e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->buf[b->idx++] = ch;
+  801592:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801596:	8b 00                	mov    (%rax),%eax
+  801598:	8d 48 01             	lea    0x1(%rax),%ecx
+  80159b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80159f:	89 0a                	mov    %ecx,(%rdx)
+  8015a1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8015a4:	89 d1                	mov    %edx,%ecx
+  8015a6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8015aa:	48 98                	cltq
+  8015ac:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+	if (b->idx == 256-1) {
+  8015b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015b4:	8b 00                	mov    (%rax),%eax
+  8015b6:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8015bb:	75 2c                	jne    8015e9 <putch+0x66>
+		sys_cputs(b->buf, b->idx);
+  8015bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015c1:	8b 00                	mov    (%rax),%eax
+  8015c3:	48 98                	cltq
+  8015c5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8015c9:	48 83 c2 08          	add    $0x8,%rdx
+  8015cd:	48 89 c6             	mov    %rax,%rsi
+  8015d0:	48 89 d7             	mov    %rdx,%rdi
+  8015d3:	48 b8 89 0d 80 00 00 	movabs $0x800d89,%rax
+  8015da:	00 00 00 
+  8015dd:	ff d0                	call   *%rax
+		b->idx = 0;
+  8015df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015e3:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	}
+	b->cnt++;
+  8015e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015ed:	8b 40 04             	mov    0x4(%rax),%eax
+  8015f0:	8d 50 01             	lea    0x1(%rax),%edx
+  8015f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015f7:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8015fa:	90                   	nop
+  8015fb:	c9                   	leave
+  8015fc:	c3                   	ret
+
+00000000008015fd <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8015fd:	55                   	push   %rbp
+  8015fe:	48 89 e5             	mov    %rsp,%rbp
+  801601:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  801608:	48 89 bd c8 fe ff ff 	mov    %rdi,-0x138(%rbp)
+  80160f:	48 89 b5 c0 fe ff ff 	mov    %rsi,-0x140(%rbp)
+	struct printbuf b;
+	va_list aq;
+	va_copy(aq,ap);
+  801616:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  80161d:	48 8b b5 c0 fe ff ff 	mov    -0x140(%rbp),%rsi
+  801624:	48 8b 06             	mov    (%rsi),%rax
+  801627:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80162b:	48 89 01             	mov    %rax,(%rcx)
+  80162e:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801632:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801636:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	b.idx = 0;
+  80163a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  801641:	00 00 00 
+	b.cnt = 0;
+  801644:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80164b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, aq);
+  80164e:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  801655:	48 8b 95 c8 fe ff ff 	mov    -0x138(%rbp),%rdx
+  80165c:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  801663:	48 89 c6             	mov    %rax,%rsi
+  801666:	48 b8 83 15 80 00 00 	movabs $0x801583,%rax
+  80166d:	00 00 00 
+  801670:	48 89 c7             	mov    %rax,%rdi
+  801673:	48 b8 4a 1a 80 00 00 	movabs $0x801a4a,%rax
+  80167a:	00 00 00 
+  80167d:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  80167f:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  801685:	48 98                	cltq
+  801687:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  80168e:	48 83 c2 08          	add    $0x8,%rdx
+  801692:	48 89 c6             	mov    %rax,%rsi
+  801695:	48 89 d7             	mov    %rdx,%rdi
+  801698:	48 b8 89 0d 80 00 00 	movabs $0x800d89,%rax
+  80169f:	00 00 00 
+  8016a2:	ff d0                	call   *%rax
+	va_end(aq);
+
+	return b.cnt;
+  8016a4:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8016aa:	c9                   	leave
+  8016ab:	c3                   	ret
+
+00000000008016ac <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8016ac:	55                   	push   %rbp
+  8016ad:	48 89 e5             	mov    %rsp,%rbp
+  8016b0:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  8016b7:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8016be:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8016c5:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8016cc:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8016d3:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8016da:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8016e1:	84 c0                	test   %al,%al
+  8016e3:	74 20                	je     801705 <cprintf+0x59>
+  8016e5:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8016e9:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8016ed:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8016f1:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8016f5:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8016f9:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8016fd:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801701:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+	va_list aq;
+	va_start(ap, fmt);
+  801705:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80170c:	00 00 00 
+  80170f:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801716:	00 00 00 
+  801719:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80171d:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801724:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80172b:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  801732:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801739:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801740:	48 8b 06             	mov    (%rsi),%rax
+  801743:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801747:	48 89 01             	mov    %rax,(%rcx)
+  80174a:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80174e:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801752:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	cnt = vcprintf(fmt, aq);
+  801756:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80175d:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801764:	48 89 d6             	mov    %rdx,%rsi
+  801767:	48 89 c7             	mov    %rax,%rdi
+  80176a:	48 b8 fd 15 80 00 00 	movabs $0x8015fd,%rax
+  801771:	00 00 00 
+  801774:	ff d0                	call   *%rax
+  801776:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return cnt;
+  80177c:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801782:	c9                   	leave
+  801783:	c3                   	ret
+
+0000000000801784 <printnum>:
+ * num: 需要打印出来的整型数，base: 整型数的进制，其他参数同 vprintfmt
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+		 unsigned long long num, unsigned base, int width, int padc)
+{
+  801784:	55                   	push   %rbp
+  801785:	48 89 e5             	mov    %rsp,%rbp
+  801788:	48 83 ec 30          	sub    $0x30,%rsp
+  80178c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801790:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801794:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801798:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  80179b:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  80179f:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+	// 当 num 超过一位数，首先递归函数自身打印所有高位的(更重要的)数字
+	if (num >= base)
+  8017a3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8017a6:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8017aa:	72 54                	jb     801800 <printnum+0x7c>
+	{
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8017ac:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8017af:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8017b2:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8017b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017be:	48 f7 f6             	div    %rsi
+  8017c1:	49 89 c2             	mov    %rax,%r10
+  8017c4:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8017c7:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8017ca:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8017ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017d2:	41 89 c9             	mov    %ecx,%r9d
+  8017d5:	41 89 f8             	mov    %edi,%r8d
+  8017d8:	89 d1                	mov    %edx,%ecx
+  8017da:	4c 89 d2             	mov    %r10,%rdx
+  8017dd:	48 89 c7             	mov    %rax,%rdi
+  8017e0:	48 b8 84 17 80 00 00 	movabs $0x801784,%rax
+  8017e7:	00 00 00 
+  8017ea:	ff d0                	call   *%rax
+  8017ec:	eb 1c                	jmp    80180a <printnum+0x86>
+	}
+	else
+	{
+		// 按照右对齐的格式在左侧补齐填充字符 padc
+		while (--width > 0)
+			putch(padc, putdat);
+  8017ee:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8017f2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8017f5:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8017f9:	48 89 d6             	mov    %rdx,%rsi
+  8017fc:	89 c7                	mov    %eax,%edi
+  8017fe:	ff d1                	call   *%rcx
+		while (--width > 0)
+  801800:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  801804:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  801808:	7f e4                	jg     8017ee <printnum+0x6a>
+	}
+
+	// 然后打印个位数字
+	putch("0123456789abcdef"[num % base], putdat);
+  80180a:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80180d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801811:	ba 00 00 00 00       	mov    $0x0,%edx
+  801816:	48 f7 f1             	div    %rcx
+  801819:	48 b8 50 24 80 00 00 	movabs $0x802450,%rax
+  801820:	00 00 00 
+  801823:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  801827:	0f be c0             	movsbl %al,%eax
+  80182a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80182e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801832:	48 89 d6             	mov    %rdx,%rsi
+  801835:	89 c7                	mov    %eax,%edi
+  801837:	ff d1                	call   *%rcx
+}
+  801839:	90                   	nop
+  80183a:	c9                   	leave
+  80183b:	c3                   	ret
+
+000000000080183c <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  80183c:	55                   	push   %rbp
+  80183d:	48 89 e5             	mov    %rsp,%rbp
+  801840:	48 83 ec 20          	sub    $0x20,%rsp
+  801844:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801848:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;
+	if (lflag >= 2)
+  80184b:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  80184f:	7e 4f                	jle    8018a0 <getuint+0x64>
+		x = va_arg(*ap, unsigned long long);
+  801851:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801855:	8b 00                	mov    (%rax),%eax
+  801857:	83 f8 2f             	cmp    $0x2f,%eax
+  80185a:	77 24                	ja     801880 <getuint+0x44>
+  80185c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801860:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801864:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801868:	8b 00                	mov    (%rax),%eax
+  80186a:	89 c0                	mov    %eax,%eax
+  80186c:	48 01 d0             	add    %rdx,%rax
+  80186f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801873:	8b 12                	mov    (%rdx),%edx
+  801875:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801878:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80187c:	89 0a                	mov    %ecx,(%rdx)
+  80187e:	eb 14                	jmp    801894 <getuint+0x58>
+  801880:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801884:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801888:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80188c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801890:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801894:	48 8b 00             	mov    (%rax),%rax
+  801897:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80189b:	e9 9d 00 00 00       	jmp    80193d <getuint+0x101>
+	else if (lflag)
+  8018a0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8018a4:	74 4c                	je     8018f2 <getuint+0xb6>
+		x = va_arg(*ap, unsigned long);
+  8018a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018aa:	8b 00                	mov    (%rax),%eax
+  8018ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8018af:	77 24                	ja     8018d5 <getuint+0x99>
+  8018b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018b5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8018b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018bd:	8b 00                	mov    (%rax),%eax
+  8018bf:	89 c0                	mov    %eax,%eax
+  8018c1:	48 01 d0             	add    %rdx,%rax
+  8018c4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018c8:	8b 12                	mov    (%rdx),%edx
+  8018ca:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8018cd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018d1:	89 0a                	mov    %ecx,(%rdx)
+  8018d3:	eb 14                	jmp    8018e9 <getuint+0xad>
+  8018d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018d9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8018dd:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8018e1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018e5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8018e9:	48 8b 00             	mov    (%rax),%rax
+  8018ec:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8018f0:	eb 4b                	jmp    80193d <getuint+0x101>
+	else
+		x = va_arg(*ap, unsigned int);
+  8018f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018f6:	8b 00                	mov    (%rax),%eax
+  8018f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8018fb:	77 24                	ja     801921 <getuint+0xe5>
+  8018fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801901:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801905:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801909:	8b 00                	mov    (%rax),%eax
+  80190b:	89 c0                	mov    %eax,%eax
+  80190d:	48 01 d0             	add    %rdx,%rax
+  801910:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801914:	8b 12                	mov    (%rdx),%edx
+  801916:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801919:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80191d:	89 0a                	mov    %ecx,(%rdx)
+  80191f:	eb 14                	jmp    801935 <getuint+0xf9>
+  801921:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801925:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801929:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80192d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801931:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801935:	8b 00                	mov    (%rax),%eax
+  801937:	89 c0                	mov    %eax,%eax
+  801939:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80193d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801941:	c9                   	leave
+  801942:	c3                   	ret
+
+0000000000801943 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  801943:	55                   	push   %rbp
+  801944:	48 89 e5             	mov    %rsp,%rbp
+  801947:	48 83 ec 20          	sub    $0x20,%rsp
+  80194b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80194f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  801952:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  801956:	7e 4f                	jle    8019a7 <getint+0x64>
+		x = va_arg(*ap, long long);
+  801958:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80195c:	8b 00                	mov    (%rax),%eax
+  80195e:	83 f8 2f             	cmp    $0x2f,%eax
+  801961:	77 24                	ja     801987 <getint+0x44>
+  801963:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801967:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80196b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80196f:	8b 00                	mov    (%rax),%eax
+  801971:	89 c0                	mov    %eax,%eax
+  801973:	48 01 d0             	add    %rdx,%rax
+  801976:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80197a:	8b 12                	mov    (%rdx),%edx
+  80197c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80197f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801983:	89 0a                	mov    %ecx,(%rdx)
+  801985:	eb 14                	jmp    80199b <getint+0x58>
+  801987:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80198b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80198f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801993:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801997:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80199b:	48 8b 00             	mov    (%rax),%rax
+  80199e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8019a2:	e9 9d 00 00 00       	jmp    801a44 <getint+0x101>
+	else if (lflag)
+  8019a7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8019ab:	74 4c                	je     8019f9 <getint+0xb6>
+		x = va_arg(*ap, long);
+  8019ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019b1:	8b 00                	mov    (%rax),%eax
+  8019b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8019b6:	77 24                	ja     8019dc <getint+0x99>
+  8019b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019bc:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8019c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019c4:	8b 00                	mov    (%rax),%eax
+  8019c6:	89 c0                	mov    %eax,%eax
+  8019c8:	48 01 d0             	add    %rdx,%rax
+  8019cb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8019cf:	8b 12                	mov    (%rdx),%edx
+  8019d1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8019d4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8019d8:	89 0a                	mov    %ecx,(%rdx)
+  8019da:	eb 14                	jmp    8019f0 <getint+0xad>
+  8019dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019e0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8019e4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8019e8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8019ec:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8019f0:	48 8b 00             	mov    (%rax),%rax
+  8019f3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8019f7:	eb 4b                	jmp    801a44 <getint+0x101>
+	else
+		x = va_arg(*ap, int);
+  8019f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019fd:	8b 00                	mov    (%rax),%eax
+  8019ff:	83 f8 2f             	cmp    $0x2f,%eax
+  801a02:	77 24                	ja     801a28 <getint+0xe5>
+  801a04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a08:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801a0c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a10:	8b 00                	mov    (%rax),%eax
+  801a12:	89 c0                	mov    %eax,%eax
+  801a14:	48 01 d0             	add    %rdx,%rax
+  801a17:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a1b:	8b 12                	mov    (%rdx),%edx
+  801a1d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801a20:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a24:	89 0a                	mov    %ecx,(%rdx)
+  801a26:	eb 14                	jmp    801a3c <getint+0xf9>
+  801a28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a2c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801a30:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801a34:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a38:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801a3c:	8b 00                	mov    (%rax),%eax
+  801a3e:	48 98                	cltq
+  801a40:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  801a44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801a48:	c9                   	leave
+  801a49:	c3                   	ret
+
+0000000000801a4a <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap)
+{
+  801a4a:	55                   	push   %rbp
+  801a4b:	48 89 e5             	mov    %rsp,%rbp
+  801a4e:	41 54                	push   %r12
+  801a50:	53                   	push   %rbx
+  801a51:	48 83 ec 60          	sub    $0x60,%rsp
+  801a55:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801a59:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  801a5d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  801a61:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+	int base, lflag, width, precision, altflag;
+
+	// 填充字符，在显示字符串的'%'后读到'-'或'0'时，赋值到 padc
+	char padc;
+	va_list aq;
+	va_copy(aq, ap);
+  801a65:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801a69:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801a6d:	48 8b 06             	mov    (%rsi),%rax
+  801a70:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801a74:	48 89 01             	mov    %rax,(%rcx)
+  801a77:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801a7b:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801a7f:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1)
+	{
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  801a83:	eb 17                	jmp    801a9c <vprintfmt+0x52>
+		{
+			if (ch == '\0')
+  801a85:	85 db                	test   %ebx,%ebx
+  801a87:	0f 84 b9 04 00 00    	je     801f46 <vprintfmt+0x4fc>
+				return;
+			putch(ch, putdat);
+  801a8d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a91:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801a95:	48 89 c6             	mov    %rax,%rsi
+  801a98:	89 df                	mov    %ebx,%edi
+  801a9a:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  801a9c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801aa0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801aa4:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  801aa8:	0f b6 00             	movzbl (%rax),%eax
+  801aab:	0f b6 d8             	movzbl %al,%ebx
+  801aae:	83 fb 25             	cmp    $0x25,%ebx
+  801ab1:	75 d2                	jne    801a85 <vprintfmt+0x3b>
+		}
+
+		// 处理 % 转义序列
+		// padc 初始化为空格符，padc='-'代表字符串左对齐，右边补空格，padc=' '代表右对齐，左边补空格，padc='0'右对齐，左边补0
+		padc = ' ';
+  801ab3:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+		width = -1;
+  801ab7:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+		// 默认-1代表显示长度为字符串本来的长度
+		precision = -1;
+  801abe:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+		lflag = 0;
+  801ac5:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+		altflag = 0;
+  801acc:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *)fmt++)
+  801ad3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801ad7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801adb:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  801adf:	0f b6 00             	movzbl (%rax),%eax
+  801ae2:	0f b6 d8             	movzbl %al,%ebx
+  801ae5:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  801ae8:	83 f8 55             	cmp    $0x55,%eax
+  801aeb:	0f 87 22 04 00 00    	ja     801f13 <vprintfmt+0x4c9>
+  801af1:	89 c0                	mov    %eax,%eax
+  801af3:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801afa:	00 
+  801afb:	48 b8 78 24 80 00 00 	movabs $0x802478,%rax
+  801b02:	00 00 00 
+  801b05:	48 01 d0             	add    %rdx,%rax
+  801b08:	48 8b 00             	mov    (%rax),%rax
+  801b0b:	ff e0                	jmp    *%rax
+		{
+
+		// flag to pad on the right
+		case '-':
+			padc = '-';
+  801b0d:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+			goto reswitch;
+  801b11:	eb c0                	jmp    801ad3 <vprintfmt+0x89>
+
+		// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  801b13:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+			goto reswitch;
+  801b17:	eb ba                	jmp    801ad3 <vprintfmt+0x89>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0;; ++fmt)
+  801b19:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+			{
+				precision = precision * 10 + ch - '0';
+  801b20:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  801b23:	89 d0                	mov    %edx,%eax
+  801b25:	c1 e0 02             	shl    $0x2,%eax
+  801b28:	01 d0                	add    %edx,%eax
+  801b2a:	01 c0                	add    %eax,%eax
+  801b2c:	01 d8                	add    %ebx,%eax
+  801b2e:	83 e8 30             	sub    $0x30,%eax
+  801b31:	89 45 d8             	mov    %eax,-0x28(%rbp)
+				ch = *fmt;
+  801b34:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801b38:	0f b6 00             	movzbl (%rax),%eax
+  801b3b:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  801b3e:	83 fb 2f             	cmp    $0x2f,%ebx
+  801b41:	7e 60                	jle    801ba3 <vprintfmt+0x159>
+  801b43:	83 fb 39             	cmp    $0x39,%ebx
+  801b46:	7f 5b                	jg     801ba3 <vprintfmt+0x159>
+			for (precision = 0;; ++fmt)
+  801b48:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+				precision = precision * 10 + ch - '0';
+  801b4d:	eb d1                	jmp    801b20 <vprintfmt+0xd6>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  801b4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b52:	83 f8 2f             	cmp    $0x2f,%eax
+  801b55:	77 17                	ja     801b6e <vprintfmt+0x124>
+  801b57:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b5b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801b5e:	89 d2                	mov    %edx,%edx
+  801b60:	48 01 d0             	add    %rdx,%rax
+  801b63:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801b66:	83 c2 08             	add    $0x8,%edx
+  801b69:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801b6c:	eb 0c                	jmp    801b7a <vprintfmt+0x130>
+  801b6e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801b72:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801b76:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801b7a:	8b 00                	mov    (%rax),%eax
+  801b7c:	89 45 d8             	mov    %eax,-0x28(%rbp)
+			goto process_precision;
+  801b7f:	eb 23                	jmp    801ba4 <vprintfmt+0x15a>
+
+		case '.':
+			if (width < 0)
+  801b81:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801b85:	0f 89 48 ff ff ff    	jns    801ad3 <vprintfmt+0x89>
+				width = 0;
+  801b8b:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+			goto reswitch;
+  801b92:	e9 3c ff ff ff       	jmp    801ad3 <vprintfmt+0x89>
+
+		case '#':
+			altflag = 1;
+  801b97:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+			goto reswitch;
+  801b9e:	e9 30 ff ff ff       	jmp    801ad3 <vprintfmt+0x89>
+			goto process_precision;
+  801ba3:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  801ba4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801ba8:	0f 89 25 ff ff ff    	jns    801ad3 <vprintfmt+0x89>
+				width = precision, precision = -1;
+  801bae:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  801bb1:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801bb4:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+			goto reswitch;
+  801bbb:	e9 13 ff ff ff       	jmp    801ad3 <vprintfmt+0x89>
+
+		// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  801bc0:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+			goto reswitch;
+  801bc4:	e9 0a ff ff ff       	jmp    801ad3 <vprintfmt+0x89>
+
+		// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  801bc9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bcc:	83 f8 2f             	cmp    $0x2f,%eax
+  801bcf:	77 17                	ja     801be8 <vprintfmt+0x19e>
+  801bd1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bd5:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801bd8:	89 d2                	mov    %edx,%edx
+  801bda:	48 01 d0             	add    %rdx,%rax
+  801bdd:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801be0:	83 c2 08             	add    $0x8,%edx
+  801be3:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801be6:	eb 0c                	jmp    801bf4 <vprintfmt+0x1aa>
+  801be8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801bec:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801bf0:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801bf4:	8b 00                	mov    (%rax),%eax
+  801bf6:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  801bfa:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801bfe:	48 89 d6             	mov    %rdx,%rsi
+  801c01:	89 c7                	mov    %eax,%edi
+  801c03:	ff d1                	call   *%rcx
+			break;
+  801c05:	e9 37 03 00 00       	jmp    801f41 <vprintfmt+0x4f7>
+
+		// error message
+		case 'e':
+			err = va_arg(aq, int);
+  801c0a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c0d:	83 f8 2f             	cmp    $0x2f,%eax
+  801c10:	77 17                	ja     801c29 <vprintfmt+0x1df>
+  801c12:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c16:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801c19:	89 d2                	mov    %edx,%edx
+  801c1b:	48 01 d0             	add    %rdx,%rax
+  801c1e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801c21:	83 c2 08             	add    $0x8,%edx
+  801c24:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801c27:	eb 0c                	jmp    801c35 <vprintfmt+0x1eb>
+  801c29:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801c2d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801c31:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801c35:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  801c37:	85 db                	test   %ebx,%ebx
+  801c39:	79 02                	jns    801c3d <vprintfmt+0x1f3>
+				err = -err;
+  801c3b:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801c3d:	83 fb 11             	cmp    $0x11,%ebx
+  801c40:	7f 16                	jg     801c58 <vprintfmt+0x20e>
+  801c42:	48 ba c0 23 80 00 00 	movabs $0x8023c0,%rdx
+  801c49:	00 00 00 
+  801c4c:	48 63 c3             	movslq %ebx,%rax
+  801c4f:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  801c53:	4d 85 e4             	test   %r12,%r12
+  801c56:	75 2e                	jne    801c86 <vprintfmt+0x23c>
+				printfmt(putch, putdat, "error %d", err);
+  801c58:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801c5c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801c60:	89 d9                	mov    %ebx,%ecx
+  801c62:	48 ba 61 24 80 00 00 	movabs $0x802461,%rdx
+  801c69:	00 00 00 
+  801c6c:	48 89 c7             	mov    %rax,%rdi
+  801c6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c74:	49 b8 50 1f 80 00 00 	movabs $0x801f50,%r8
+  801c7b:	00 00 00 
+  801c7e:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  801c81:	e9 bb 02 00 00       	jmp    801f41 <vprintfmt+0x4f7>
+				printfmt(putch, putdat, "%s", p);
+  801c86:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801c8a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801c8e:	4c 89 e1             	mov    %r12,%rcx
+  801c91:	48 ba 6a 24 80 00 00 	movabs $0x80246a,%rdx
+  801c98:	00 00 00 
+  801c9b:	48 89 c7             	mov    %rax,%rdi
+  801c9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ca3:	49 b8 50 1f 80 00 00 	movabs $0x801f50,%r8
+  801caa:	00 00 00 
+  801cad:	41 ff d0             	call   *%r8
+			break;
+  801cb0:	e9 8c 02 00 00       	jmp    801f41 <vprintfmt+0x4f7>
+
+		// string
+		case 's':
+			// 从可变参数中读入字符串指针
+			if ((p = va_arg(aq, char *)) == NULL)
+  801cb5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cb8:	83 f8 2f             	cmp    $0x2f,%eax
+  801cbb:	77 17                	ja     801cd4 <vprintfmt+0x28a>
+  801cbd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cc1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801cc4:	89 d2                	mov    %edx,%edx
+  801cc6:	48 01 d0             	add    %rdx,%rax
+  801cc9:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801ccc:	83 c2 08             	add    $0x8,%edx
+  801ccf:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801cd2:	eb 0c                	jmp    801ce0 <vprintfmt+0x296>
+  801cd4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801cd8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801cdc:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801ce0:	4c 8b 20             	mov    (%rax),%r12
+  801ce3:	4d 85 e4             	test   %r12,%r12
+  801ce6:	75 0a                	jne    801cf2 <vprintfmt+0x2a8>
+				p = "(null)"; // 当字符串为空时，将它指向"(null)"字符串
+  801ce8:	49 bc 6d 24 80 00 00 	movabs $0x80246d,%r12
+  801cef:	00 00 00 
+			// 判断左对齐还是右对齐，pad='-'左对齐，否则右对齐
+			if (width > 0 && padc != '-')
+  801cf2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801cf6:	7e 78                	jle    801d70 <vprintfmt+0x326>
+  801cf8:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  801cfc:	74 72                	je     801d70 <vprintfmt+0x326>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801cfe:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  801d01:	48 98                	cltq
+  801d03:	48 89 c6             	mov    %rax,%rsi
+  801d06:	4c 89 e7             	mov    %r12,%rdi
+  801d09:	48 b8 2e 02 80 00 00 	movabs $0x80022e,%rax
+  801d10:	00 00 00 
+  801d13:	ff d0                	call   *%rax
+  801d15:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  801d18:	eb 17                	jmp    801d31 <vprintfmt+0x2e7>
+					putch(padc, putdat); // 字符串右对齐，左边补相应数量(width-实际长度)的空格或者 0
+  801d1a:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  801d1e:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  801d22:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801d26:	48 89 d6             	mov    %rdx,%rsi
+  801d29:	89 c7                	mov    %eax,%edi
+  801d2b:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801d2d:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  801d31:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801d35:	7f e3                	jg     801d1a <vprintfmt+0x2d0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801d37:	eb 37                	jmp    801d70 <vprintfmt+0x326>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801d39:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  801d3d:	74 1e                	je     801d5d <vprintfmt+0x313>
+  801d3f:	83 fb 1f             	cmp    $0x1f,%ebx
+  801d42:	7e 05                	jle    801d49 <vprintfmt+0x2ff>
+  801d44:	83 fb 7e             	cmp    $0x7e,%ebx
+  801d47:	7e 14                	jle    801d5d <vprintfmt+0x313>
+					putch('?', putdat);
+  801d49:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801d4d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801d51:	48 89 c6             	mov    %rax,%rsi
+  801d54:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801d59:	ff d2                	call   *%rdx
+  801d5b:	eb 0f                	jmp    801d6c <vprintfmt+0x322>
+				else
+					putch(ch, putdat); // 打印相应长度的字符串
+  801d5d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801d61:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801d65:	48 89 c6             	mov    %rax,%rsi
+  801d68:	89 df                	mov    %ebx,%edi
+  801d6a:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801d6c:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  801d70:	4c 89 e0             	mov    %r12,%rax
+  801d73:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801d77:	0f b6 00             	movzbl (%rax),%eax
+  801d7a:	0f be d8             	movsbl %al,%ebx
+  801d7d:	85 db                	test   %ebx,%ebx
+  801d7f:	74 28                	je     801da9 <vprintfmt+0x35f>
+  801d81:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801d85:	78 b2                	js     801d39 <vprintfmt+0x2ef>
+  801d87:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  801d8b:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801d8f:	79 a8                	jns    801d39 <vprintfmt+0x2ef>
+			for (; width > 0; width--)
+  801d91:	eb 16                	jmp    801da9 <vprintfmt+0x35f>
+				putch(' ', putdat); // 当字符串是左对齐的时候打印相应数量的空格
+  801d93:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801d97:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801d9b:	48 89 c6             	mov    %rax,%rsi
+  801d9e:	bf 20 00 00 00       	mov    $0x20,%edi
+  801da3:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  801da5:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  801da9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801dad:	7f e4                	jg     801d93 <vprintfmt+0x349>
+			break;
+  801daf:	e9 8d 01 00 00       	jmp    801f41 <vprintfmt+0x4f7>
+
+		// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  801db4:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801db8:	be 03 00 00 00       	mov    $0x3,%esi
+  801dbd:	48 89 c7             	mov    %rax,%rdi
+  801dc0:	48 b8 43 19 80 00 00 	movabs $0x801943,%rax
+  801dc7:	00 00 00 
+  801dca:	ff d0                	call   *%rax
+  801dcc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((long long)num < 0)
+  801dd0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801dd4:	48 85 c0             	test   %rax,%rax
+  801dd7:	79 1d                	jns    801df6 <vprintfmt+0x3ac>
+			{
+				putch('-', putdat);
+  801dd9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801ddd:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801de1:	48 89 c6             	mov    %rax,%rsi
+  801de4:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801de9:	ff d2                	call   *%rdx
+				num = -(long long)num;
+  801deb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801def:	48 f7 d8             	neg    %rax
+  801df2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			}
+			base = 10;
+  801df6:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  801dfd:	e9 d2 00 00 00       	jmp    801ed4 <vprintfmt+0x48a>
+
+		// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  801e02:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801e06:	be 03 00 00 00       	mov    $0x3,%esi
+  801e0b:	48 89 c7             	mov    %rax,%rdi
+  801e0e:	48 b8 3c 18 80 00 00 	movabs $0x80183c,%rax
+  801e15:	00 00 00 
+  801e18:	ff d0                	call   *%rax
+  801e1a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 10;
+  801e1e:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  801e25:	e9 aa 00 00 00       	jmp    801ed4 <vprintfmt+0x48a>
+		// (unsigned) octal
+		case 'o':
+			// Gets the variable argument with type integer from the point which was processed last by va_arg
+			// calls getuint which returns a long long value, which then calls printnum which prints based on
+			// base value.
+			num = getuint(&aq, 3);
+  801e2a:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801e2e:	be 03 00 00 00       	mov    $0x3,%esi
+  801e33:	48 89 c7             	mov    %rax,%rdi
+  801e36:	48 b8 3c 18 80 00 00 	movabs $0x80183c,%rax
+  801e3d:	00 00 00 
+  801e40:	ff d0                	call   *%rax
+  801e42:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 8;
+  801e46:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+			goto number;
+  801e4d:	e9 82 00 00 00       	jmp    801ed4 <vprintfmt+0x48a>
+
+		// pointer
+		case 'p':
+			putch('0', putdat);
+  801e52:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801e56:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801e5a:	48 89 c6             	mov    %rax,%rsi
+  801e5d:	bf 30 00 00 00       	mov    $0x30,%edi
+  801e62:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  801e64:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801e68:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801e6c:	48 89 c6             	mov    %rax,%rsi
+  801e6f:	bf 78 00 00 00       	mov    $0x78,%edi
+  801e74:	ff d2                	call   *%rdx
+			num = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  801e76:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e79:	83 f8 2f             	cmp    $0x2f,%eax
+  801e7c:	77 17                	ja     801e95 <vprintfmt+0x44b>
+  801e7e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e82:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801e85:	89 d2                	mov    %edx,%edx
+  801e87:	48 01 d0             	add    %rdx,%rax
+  801e8a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801e8d:	83 c2 08             	add    $0x8,%edx
+  801e90:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801e93:	eb 0c                	jmp    801ea1 <vprintfmt+0x457>
+  801e95:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801e99:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801e9d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801ea1:	48 8b 00             	mov    (%rax),%rax
+  801ea4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  801ea8:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+			goto number;
+  801eaf:	eb 23                	jmp    801ed4 <vprintfmt+0x48a>
+
+		// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  801eb1:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801eb5:	be 03 00 00 00       	mov    $0x3,%esi
+  801eba:	48 89 c7             	mov    %rax,%rdi
+  801ebd:	48 b8 3c 18 80 00 00 	movabs $0x80183c,%rax
+  801ec4:	00 00 00 
+  801ec7:	ff d0                	call   *%rax
+  801ec9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  801ecd:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  801ed4:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  801ed9:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  801edc:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  801edf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801ee3:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801ee7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801eeb:	45 89 c1             	mov    %r8d,%r9d
+  801eee:	41 89 f8             	mov    %edi,%r8d
+  801ef1:	48 89 c7             	mov    %rax,%rdi
+  801ef4:	48 b8 84 17 80 00 00 	movabs $0x801784,%rax
+  801efb:	00 00 00 
+  801efe:	ff d0                	call   *%rax
+			break;
+  801f00:	eb 3f                	jmp    801f41 <vprintfmt+0x4f7>
+
+		// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  801f02:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801f06:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801f0a:	48 89 c6             	mov    %rax,%rsi
+  801f0d:	89 df                	mov    %ebx,%edi
+  801f0f:	ff d2                	call   *%rdx
+			break;
+  801f11:	eb 2e                	jmp    801f41 <vprintfmt+0x4f7>
+
+		// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  801f13:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801f17:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801f1b:	48 89 c6             	mov    %rax,%rsi
+  801f1e:	bf 25 00 00 00       	mov    $0x25,%edi
+  801f23:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801f25:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  801f2a:	eb 05                	jmp    801f31 <vprintfmt+0x4e7>
+  801f2c:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  801f31:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801f35:	48 83 e8 01          	sub    $0x1,%rax
+  801f39:	0f b6 00             	movzbl (%rax),%eax
+  801f3c:	3c 25                	cmp    $0x25,%al
+  801f3e:	75 ec                	jne    801f2c <vprintfmt+0x4e2>
+				/* do nothing */;
+			break;
+  801f40:	90                   	nop
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  801f41:	e9 56 fb ff ff       	jmp    801a9c <vprintfmt+0x52>
+				return;
+  801f46:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  801f47:	48 83 c4 60          	add    $0x60,%rsp
+  801f4b:	5b                   	pop    %rbx
+  801f4c:	41 5c                	pop    %r12
+  801f4e:	5d                   	pop    %rbp
+  801f4f:	c3                   	ret
+
+0000000000801f50 <printfmt>:
+
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...)
+{
+  801f50:	55                   	push   %rbp
+  801f51:	48 89 e5             	mov    %rsp,%rbp
+  801f54:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801f5b:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801f62:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  801f69:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801f70:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801f77:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801f7e:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801f85:	84 c0                	test   %al,%al
+  801f87:	74 20                	je     801fa9 <printfmt+0x59>
+  801f89:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801f8d:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801f91:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801f95:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801f99:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801f9d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801fa1:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801fa5:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801fa9:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801fb0:	00 00 00 
+  801fb3:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801fba:	00 00 00 
+  801fbd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801fc1:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801fc8:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801fcf:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  801fd6:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801fdd:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801fe4:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801feb:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801ff2:	48 89 c7             	mov    %rax,%rdi
+  801ff5:	48 b8 4a 1a 80 00 00 	movabs $0x801a4a,%rax
+  801ffc:	00 00 00 
+  801fff:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  802001:	90                   	nop
+  802002:	c9                   	leave
+  802003:	c3                   	ret
+
+0000000000802004 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  802004:	55                   	push   %rbp
+  802005:	48 89 e5             	mov    %rsp,%rbp
+  802008:	48 83 ec 10          	sub    $0x10,%rsp
+  80200c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80200f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  802013:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802017:	8b 40 10             	mov    0x10(%rax),%eax
+  80201a:	8d 50 01             	lea    0x1(%rax),%edx
+  80201d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802021:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  802024:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802028:	48 8b 10             	mov    (%rax),%rdx
+  80202b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80202f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802033:	48 39 c2             	cmp    %rax,%rdx
+  802036:	73 17                	jae    80204f <sprintputch+0x4b>
+		*b->buf++ = ch;
+  802038:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80203c:	48 8b 00             	mov    (%rax),%rax
+  80203f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  802043:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802047:	48 89 0a             	mov    %rcx,(%rdx)
+  80204a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80204d:	88 10                	mov    %dl,(%rax)
+}
+  80204f:	90                   	nop
+  802050:	c9                   	leave
+  802051:	c3                   	ret
+
+0000000000802052 <vsnprintf>:
+
+int vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  802052:	55                   	push   %rbp
+  802053:	48 89 e5             	mov    %rsp,%rbp
+  802056:	48 83 ec 50          	sub    $0x50,%rsp
+  80205a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80205e:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  802061:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  802065:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+	va_list aq;
+	va_copy(aq, ap);
+  802069:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  80206d:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802071:	48 8b 06             	mov    (%rsi),%rax
+  802074:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  802078:	48 89 01             	mov    %rax,(%rcx)
+  80207b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80207f:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  802083:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	struct sprintbuf b = {buf, buf + n - 1, 0};
+  802087:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80208b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80208f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802092:	48 98                	cltq
+  802094:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802098:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80209c:	48 01 d0             	add    %rdx,%rax
+  80209f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8020a3:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+
+	if (buf == NULL || n < 1)
+  8020aa:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8020af:	74 06                	je     8020b7 <vsnprintf+0x65>
+  8020b1:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  8020b5:	7f 07                	jg     8020be <vsnprintf+0x6c>
+		return -E_INVAL;
+  8020b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020bc:	eb 32                	jmp    8020f0 <vsnprintf+0x9e>
+
+	// print the string to the buffer
+	vprintfmt((void *)sprintputch, &b, fmt, aq);
+  8020be:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  8020c2:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8020c6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8020ca:	48 89 c6             	mov    %rax,%rsi
+  8020cd:	48 b8 04 20 80 00 00 	movabs $0x802004,%rax
+  8020d4:	00 00 00 
+  8020d7:	48 89 c7             	mov    %rax,%rdi
+  8020da:	48 b8 4a 1a 80 00 00 	movabs $0x801a4a,%rax
+  8020e1:	00 00 00 
+  8020e4:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  8020e6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020ea:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  8020ed:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  8020f0:	c9                   	leave
+  8020f1:	c3                   	ret
+
+00000000008020f2 <snprintf>:
+
+int snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8020f2:	55                   	push   %rbp
+  8020f3:	48 89 e5             	mov    %rsp,%rbp
+  8020f6:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8020fd:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  802104:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  80210a:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  802111:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  802118:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80211f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  802126:	84 c0                	test   %al,%al
+  802128:	74 20                	je     80214a <snprintf+0x58>
+  80212a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80212e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  802132:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  802136:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80213a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80213e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  802142:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  802146:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  80214a:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  802151:	00 00 00 
+  802154:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80215b:	00 00 00 
+  80215e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802162:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  802169:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  802170:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq, ap);
+  802177:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80217e:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  802185:	48 8b 06             	mov    (%rsi),%rax
+  802188:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80218c:	48 89 01             	mov    %rax,(%rcx)
+  80218f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  802193:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  802197:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  80219b:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8021a2:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  8021a9:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  8021af:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8021b6:	48 89 c7             	mov    %rax,%rdi
+  8021b9:	48 b8 52 20 80 00 00 	movabs $0x802052,%rax
+  8021c0:	00 00 00 
+  8021c3:	ff d0                	call   *%rax
+  8021c5:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  8021cb:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8021d1:	c9                   	leave
+  8021d2:	c3                   	ret
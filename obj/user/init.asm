@@ -0,0 +1,6754 @@
+
+obj/user/init.debug:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// entrypoint - 当最初被加载到一个新的环境中时，内核(或者父环境)在这里开始运行.
+.text
+.globl _start
+_start:
+	// 判断是否从栈上的参数开始初始化
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	// $USTACKTOP != %rsp 说明有参数，跳转到 args_exist
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// 如果不是(新环境被内核加载的时候)，则 push 伪造的 argc, argv 参数
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 d5 00 00 00       	call   800116 <libmain>
+
+// 不应该返回
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+	// "/primes",
+	// "/cat",
+	NULL};
+
+void umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	48 83 ec 30          	sub    $0x30,%rsp
+  80004b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80004e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	const char **p;
+	const char *name;
+	envid_t r;
+
+	binaryname = "init";
+  800052:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  800059:	00 00 00 
+  80005c:	48 be c9 42 80 00 00 	movabs $0x8042c9,%rsi
+  800063:	00 00 00 
+  800066:	48 89 30             	mov    %rsi,(%rax)
+	for (p = progs; *p; p++)
+  800069:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800070:	00 00 00 
+  800073:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800077:	e9 86 00 00 00       	jmp    800102 <umain+0xbf>
+	{
+		// argv[0] 为去掉 '/' 的程序名
+		name = (*p)[0] == '/' ? *p + 1 : *p;
+  80007c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800080:	48 8b 00             	mov    (%rax),%rax
+  800083:	0f b6 00             	movzbl (%rax),%eax
+  800086:	3c 2f                	cmp    $0x2f,%al
+  800088:	75 0d                	jne    800097 <umain+0x54>
+  80008a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80008e:	48 8b 00             	mov    (%rax),%rax
+  800091:	48 83 c0 01          	add    $0x1,%rax
+  800095:	eb 07                	jmp    80009e <umain+0x5b>
+  800097:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80009b:	48 8b 00             	mov    (%rax),%rax
+  80009e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+		if ((r = spawnl(*p, name, (const char *)NULL)) < 0)
+  8000a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8000a6:	48 8b 00             	mov    (%rax),%rax
+  8000a9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8000ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000b2:	48 89 ce             	mov    %rcx,%rsi
+  8000b5:	48 89 c7             	mov    %rax,%rdi
+  8000b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bd:	48 b9 0d 26 80 00 00 	movabs $0x80260d,%rcx
+  8000c4:	00 00 00 
+  8000c7:	ff d1                	call   *%rcx
+  8000c9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8000cc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000d0:	79 2b                	jns    8000fd <umain+0xba>
+			cprintf("init: spawn %s: %e\n", *p, r);
+  8000d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8000d6:	48 8b 00             	mov    (%rax),%rax
+  8000d9:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8000dc:	48 89 c6             	mov    %rax,%rsi
+  8000df:	48 b8 ce 42 80 00 00 	movabs $0x8042ce,%rax
+  8000e6:	00 00 00 
+  8000e9:	48 89 c7             	mov    %rax,%rdi
+  8000ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f1:	48 b9 d4 02 80 00 00 	movabs $0x8002d4,%rcx
+  8000f8:	00 00 00 
+  8000fb:	ff d1                	call   *%rcx
+	for (p = progs; *p; p++)
+  8000fd:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  800102:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800106:	48 8b 00             	mov    (%rax),%rax
+  800109:	48 85 c0             	test   %rax,%rax
+  80010c:	0f 85 6a ff ff ff    	jne    80007c <umain+0x39>
+	}
+}
+  800112:	90                   	nop
+  800113:	90                   	nop
+  800114:	c9                   	leave
+  800115:	c3                   	ret
+
+0000000000800116 <libmain>:
+
+/**
+ *  用户环境从lib/libmain.c中的函数libmain开始执行，这个函数进而调用umain，用户写的程序入口只能是umain
+ */
+void libmain(int argc, char **argv)
+{
+  800116:	55                   	push   %rbp
+  800117:	48 89 e5             	mov    %rsp,%rbp
+  80011a:	48 83 ec 10          	sub    $0x10,%rsp
+  80011e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800121:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 设置常量 thisproc 指向 procs[] 中当前环境的 Env 结构，ENVX 确保环境 id 未超过了 NENV
+	// thisproc 指向当前环境的 Env 结构
+	thisproc = &procs[ENVX(sys_getprocid())];
+  800125:	48 b8 47 1b 80 00 00 	movabs $0x801b47,%rax
+  80012c:	00 00 00 
+  80012f:	ff d0                	call   *%rax
+  800131:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800136:	48 98                	cltq
+  800138:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  80013f:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  800146:	00 00 00 
+  800149:	48 01 c2             	add    %rax,%rdx
+  80014c:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800153:	00 00 00 
+  800156:	48 89 10             	mov    %rdx,(%rax)
+
+	// 通过 CPUID 选择 memset/memmove/memcpy 的实现
+	mem_init();
+  800159:	48 b8 ef 11 80 00 00 	movabs $0x8011ef,%rax
+  800160:	00 00 00 
+  800163:	ff d0                	call   *%rax
+
+	// 为了能让panic()提示用户错误，存储程序的名称
+	if (argc > 0)
+  800165:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800169:	7e 14                	jle    80017f <libmain+0x69>
+		binaryname = argv[0];
+  80016b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80016f:	48 8b 00             	mov    (%rax),%rax
+  800172:	48 ba 10 60 80 00 00 	movabs $0x806010,%rdx
+  800179:	00 00 00 
+  80017c:	48 89 02             	mov    %rax,(%rdx)
+
+	// 调用用户的主程序
+	umain(argc, argv);
+  80017f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800183:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800186:	48 89 d6             	mov    %rdx,%rsi
+  800189:	89 c7                	mov    %eax,%edi
+  80018b:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  800192:	00 00 00 
+  800195:	ff d0                	call   *%rax
+
+	// 退出当前环境，env_destroy
+	sys_env_destroy(0);
+  800197:	bf 00 00 00 00       	mov    $0x0,%edi
+  80019c:	48 b8 01 1b 80 00 00 	movabs $0x801b01,%rax
+  8001a3:	00 00 00 
+  8001a6:	ff d0                	call   *%rax
+}
+  8001a8:	90                   	nop
+  8001a9:	c9                   	leave
+  8001aa:	c3                   	ret
+
+00000000008001ab <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001ab:	55                   	push   %rbp
+  8001ac:	48 89 e5             	mov    %rsp,%rbp
+  8001af:	48 83 ec 10          	sub    $0x10,%rsp
+  8001b3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8001b6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->buf[b->idx++] = ch;
+  8001ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001be:	8b 00                	mov    (%rax),%eax
+  8001c0:	8d 48 01             	lea    0x1(%rax),%ecx
+  8001c3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001c7:	89 0a                	mov    %ecx,(%rdx)
+  8001c9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8001cc:	89 d1                	mov    %edx,%ecx
+  8001ce:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001d2:	48 98                	cltq
+  8001d4:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+	if (b->idx == 256-1) {
+  8001d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001dc:	8b 00                	mov    (%rax),%eax
+  8001de:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001e3:	75 2c                	jne    800211 <putch+0x66>
+		sys_cputs(b->buf, b->idx);
+  8001e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001e9:	8b 00                	mov    (%rax),%eax
+  8001eb:	48 98                	cltq
+  8001ed:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001f1:	48 83 c2 08          	add    $0x8,%rdx
+  8001f5:	48 89 c6             	mov    %rax,%rsi
+  8001f8:	48 89 d7             	mov    %rdx,%rdi
+  8001fb:	48 b8 78 1a 80 00 00 	movabs $0x801a78,%rax
+  800202:	00 00 00 
+  800205:	ff d0                	call   *%rax
+		b->idx = 0;
+  800207:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80020b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	}
+	b->cnt++;
+  800211:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800215:	8b 40 04             	mov    0x4(%rax),%eax
+  800218:	8d 50 01             	lea    0x1(%rax),%edx
+  80021b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80021f:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800222:	90                   	nop
+  800223:	c9                   	leave
+  800224:	c3                   	ret
+
+0000000000800225 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800225:	55                   	push   %rbp
+  800226:	48 89 e5             	mov    %rsp,%rbp
+  800229:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  800230:	48 89 bd c8 fe ff ff 	mov    %rdi,-0x138(%rbp)
+  800237:	48 89 b5 c0 fe ff ff 	mov    %rsi,-0x140(%rbp)
+	struct printbuf b;
+	va_list aq;
+	va_copy(aq,ap);
+  80023e:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  800245:	48 8b b5 c0 fe ff ff 	mov    -0x140(%rbp),%rsi
+  80024c:	48 8b 06             	mov    (%rsi),%rax
+  80024f:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800253:	48 89 01             	mov    %rax,(%rcx)
+  800256:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80025a:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80025e:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	b.idx = 0;
+  800262:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800269:	00 00 00 
+	b.cnt = 0;
+  80026c:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800273:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, aq);
+  800276:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  80027d:	48 8b 95 c8 fe ff ff 	mov    -0x138(%rbp),%rdx
+  800284:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  80028b:	48 89 c6             	mov    %rax,%rsi
+  80028e:	48 b8 ab 01 80 00 00 	movabs $0x8001ab,%rax
+  800295:	00 00 00 
+  800298:	48 89 c7             	mov    %rax,%rdi
+  80029b:	48 b8 72 06 80 00 00 	movabs $0x800672,%rax
+  8002a2:	00 00 00 
+  8002a5:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  8002a7:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8002ad:	48 98                	cltq
+  8002af:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8002b6:	48 83 c2 08          	add    $0x8,%rdx
+  8002ba:	48 89 c6             	mov    %rax,%rsi
+  8002bd:	48 89 d7             	mov    %rdx,%rdi
+  8002c0:	48 b8 78 1a 80 00 00 	movabs $0x801a78,%rax
+  8002c7:	00 00 00 
+  8002ca:	ff d0                	call   *%rax
+	va_end(aq);
+
+	return b.cnt;
+  8002cc:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8002d2:	c9                   	leave
+  8002d3:	c3                   	ret
+
+00000000008002d4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002d4:	55                   	push   %rbp
+  8002d5:	48 89 e5             	mov    %rsp,%rbp
+  8002d8:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  8002df:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8002e6:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8002ed:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8002f4:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8002fb:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800302:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800309:	84 c0                	test   %al,%al
+  80030b:	74 20                	je     80032d <cprintf+0x59>
+  80030d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800311:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800315:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800319:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80031d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800321:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800325:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800329:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+	va_list aq;
+	va_start(ap, fmt);
+  80032d:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800334:	00 00 00 
+  800337:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80033e:	00 00 00 
+  800341:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800345:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80034c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800353:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  80035a:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800361:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800368:	48 8b 06             	mov    (%rsi),%rax
+  80036b:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80036f:	48 89 01             	mov    %rax,(%rcx)
+  800372:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800376:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80037a:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	cnt = vcprintf(fmt, aq);
+  80037e:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800385:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80038c:	48 89 d6             	mov    %rdx,%rsi
+  80038f:	48 89 c7             	mov    %rax,%rdi
+  800392:	48 b8 25 02 80 00 00 	movabs $0x800225,%rax
+  800399:	00 00 00 
+  80039c:	ff d0                	call   *%rax
+  80039e:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return cnt;
+  8003a4:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8003aa:	c9                   	leave
+  8003ab:	c3                   	ret
+
+00000000008003ac <printnum>:
+ * num: 需要打印出来的整型数，base: 整型数的进制，其他参数同 vprintfmt
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+		 unsigned long long num, unsigned base, int width, int padc)
+{
+  8003ac:	55                   	push   %rbp
+  8003ad:	48 89 e5             	mov    %rsp,%rbp
+  8003b0:	48 83 ec 30          	sub    $0x30,%rsp
+  8003b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8003b8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8003bc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8003c0:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8003c3:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8003c7:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+	// 当 num 超过一位数，首先递归函数自身打印所有高位的(更重要的)数字
+	if (num >= base)
+  8003cb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8003ce:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8003d2:	72 54                	jb     800428 <printnum+0x7c>
+	{
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003d4:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8003d7:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8003da:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8003dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8003e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003e6:	48 f7 f6             	div    %rsi
+  8003e9:	49 89 c2             	mov    %rax,%r10
+  8003ec:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8003ef:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8003f2:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8003f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003fa:	41 89 c9             	mov    %ecx,%r9d
+  8003fd:	41 89 f8             	mov    %edi,%r8d
+  800400:	89 d1                	mov    %edx,%ecx
+  800402:	4c 89 d2             	mov    %r10,%rdx
+  800405:	48 89 c7             	mov    %rax,%rdi
+  800408:	48 b8 ac 03 80 00 00 	movabs $0x8003ac,%rax
+  80040f:	00 00 00 
+  800412:	ff d0                	call   *%rax
+  800414:	eb 1c                	jmp    800432 <printnum+0x86>
+	}
+	else
+	{
+		// 按照右对齐的格式在左侧补齐填充字符 padc
+		while (--width > 0)
+			putch(padc, putdat);
+  800416:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80041a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80041d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800421:	48 89 d6             	mov    %rdx,%rsi
+  800424:	89 c7                	mov    %eax,%edi
+  800426:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800428:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  80042c:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800430:	7f e4                	jg     800416 <printnum+0x6a>
+	}
+
+	// 然后打印个位数字
+	putch("0123456789abcdef"[num % base], putdat);
+  800432:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800435:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800439:	ba 00 00 00 00       	mov    $0x0,%edx
+  80043e:	48 f7 f1             	div    %rcx
+  800441:	48 b8 f0 44 80 00 00 	movabs $0x8044f0,%rax
+  800448:	00 00 00 
+  80044b:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  80044f:	0f be c0             	movsbl %al,%eax
+  800452:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800456:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80045a:	48 89 d6             	mov    %rdx,%rsi
+  80045d:	89 c7                	mov    %eax,%edi
+  80045f:	ff d1                	call   *%rcx
+}
+  800461:	90                   	nop
+  800462:	c9                   	leave
+  800463:	c3                   	ret
+
+0000000000800464 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800464:	55                   	push   %rbp
+  800465:	48 89 e5             	mov    %rsp,%rbp
+  800468:	48 83 ec 20          	sub    $0x20,%rsp
+  80046c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800470:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;
+	if (lflag >= 2)
+  800473:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800477:	7e 4f                	jle    8004c8 <getuint+0x64>
+		x = va_arg(*ap, unsigned long long);
+  800479:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80047d:	8b 00                	mov    (%rax),%eax
+  80047f:	83 f8 2f             	cmp    $0x2f,%eax
+  800482:	77 24                	ja     8004a8 <getuint+0x44>
+  800484:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800488:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80048c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800490:	8b 00                	mov    (%rax),%eax
+  800492:	89 c0                	mov    %eax,%eax
+  800494:	48 01 d0             	add    %rdx,%rax
+  800497:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80049b:	8b 12                	mov    (%rdx),%edx
+  80049d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8004a0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8004a4:	89 0a                	mov    %ecx,(%rdx)
+  8004a6:	eb 14                	jmp    8004bc <getuint+0x58>
+  8004a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004ac:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8004b0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8004b4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8004b8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8004bc:	48 8b 00             	mov    (%rax),%rax
+  8004bf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8004c3:	e9 9d 00 00 00       	jmp    800565 <getuint+0x101>
+	else if (lflag)
+  8004c8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8004cc:	74 4c                	je     80051a <getuint+0xb6>
+		x = va_arg(*ap, unsigned long);
+  8004ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004d2:	8b 00                	mov    (%rax),%eax
+  8004d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8004d7:	77 24                	ja     8004fd <getuint+0x99>
+  8004d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004dd:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004e5:	8b 00                	mov    (%rax),%eax
+  8004e7:	89 c0                	mov    %eax,%eax
+  8004e9:	48 01 d0             	add    %rdx,%rax
+  8004ec:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8004f0:	8b 12                	mov    (%rdx),%edx
+  8004f2:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8004f5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8004f9:	89 0a                	mov    %ecx,(%rdx)
+  8004fb:	eb 14                	jmp    800511 <getuint+0xad>
+  8004fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800501:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800505:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800509:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80050d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800511:	48 8b 00             	mov    (%rax),%rax
+  800514:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800518:	eb 4b                	jmp    800565 <getuint+0x101>
+	else
+		x = va_arg(*ap, unsigned int);
+  80051a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80051e:	8b 00                	mov    (%rax),%eax
+  800520:	83 f8 2f             	cmp    $0x2f,%eax
+  800523:	77 24                	ja     800549 <getuint+0xe5>
+  800525:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800529:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80052d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800531:	8b 00                	mov    (%rax),%eax
+  800533:	89 c0                	mov    %eax,%eax
+  800535:	48 01 d0             	add    %rdx,%rax
+  800538:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80053c:	8b 12                	mov    (%rdx),%edx
+  80053e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800541:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800545:	89 0a                	mov    %ecx,(%rdx)
+  800547:	eb 14                	jmp    80055d <getuint+0xf9>
+  800549:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80054d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800551:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800555:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800559:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80055d:	8b 00                	mov    (%rax),%eax
+  80055f:	89 c0                	mov    %eax,%eax
+  800561:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800565:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800569:	c9                   	leave
+  80056a:	c3                   	ret
+
+000000000080056b <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  80056b:	55                   	push   %rbp
+  80056c:	48 89 e5             	mov    %rsp,%rbp
+  80056f:	48 83 ec 20          	sub    $0x20,%rsp
+  800573:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800577:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  80057a:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  80057e:	7e 4f                	jle    8005cf <getint+0x64>
+		x = va_arg(*ap, long long);
+  800580:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800584:	8b 00                	mov    (%rax),%eax
+  800586:	83 f8 2f             	cmp    $0x2f,%eax
+  800589:	77 24                	ja     8005af <getint+0x44>
+  80058b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80058f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800593:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800597:	8b 00                	mov    (%rax),%eax
+  800599:	89 c0                	mov    %eax,%eax
+  80059b:	48 01 d0             	add    %rdx,%rax
+  80059e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005a2:	8b 12                	mov    (%rdx),%edx
+  8005a4:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005a7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005ab:	89 0a                	mov    %ecx,(%rdx)
+  8005ad:	eb 14                	jmp    8005c3 <getint+0x58>
+  8005af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005b3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005b7:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005bb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005bf:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005c3:	48 8b 00             	mov    (%rax),%rax
+  8005c6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8005ca:	e9 9d 00 00 00       	jmp    80066c <getint+0x101>
+	else if (lflag)
+  8005cf:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8005d3:	74 4c                	je     800621 <getint+0xb6>
+		x = va_arg(*ap, long);
+  8005d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005d9:	8b 00                	mov    (%rax),%eax
+  8005db:	83 f8 2f             	cmp    $0x2f,%eax
+  8005de:	77 24                	ja     800604 <getint+0x99>
+  8005e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005e4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005ec:	8b 00                	mov    (%rax),%eax
+  8005ee:	89 c0                	mov    %eax,%eax
+  8005f0:	48 01 d0             	add    %rdx,%rax
+  8005f3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005f7:	8b 12                	mov    (%rdx),%edx
+  8005f9:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005fc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800600:	89 0a                	mov    %ecx,(%rdx)
+  800602:	eb 14                	jmp    800618 <getint+0xad>
+  800604:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800608:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80060c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800610:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800614:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800618:	48 8b 00             	mov    (%rax),%rax
+  80061b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80061f:	eb 4b                	jmp    80066c <getint+0x101>
+	else
+		x = va_arg(*ap, int);
+  800621:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800625:	8b 00                	mov    (%rax),%eax
+  800627:	83 f8 2f             	cmp    $0x2f,%eax
+  80062a:	77 24                	ja     800650 <getint+0xe5>
+  80062c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800630:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800634:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800638:	8b 00                	mov    (%rax),%eax
+  80063a:	89 c0                	mov    %eax,%eax
+  80063c:	48 01 d0             	add    %rdx,%rax
+  80063f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800643:	8b 12                	mov    (%rdx),%edx
+  800645:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800648:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80064c:	89 0a                	mov    %ecx,(%rdx)
+  80064e:	eb 14                	jmp    800664 <getint+0xf9>
+  800650:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800654:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800658:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80065c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800660:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800664:	8b 00                	mov    (%rax),%eax
+  800666:	48 98                	cltq
+  800668:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80066c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800670:	c9                   	leave
+  800671:	c3                   	ret
+
+0000000000800672 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap)
+{
+  800672:	55                   	push   %rbp
+  800673:	48 89 e5             	mov    %rsp,%rbp
+  800676:	41 54                	push   %r12
+  800678:	53                   	push   %rbx
+  800679:	48 83 ec 60          	sub    $0x60,%rsp
+  80067d:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800681:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800685:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800689:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+	int base, lflag, width, precision, altflag;
+
+	// 填充字符，在显示字符串的'%'后读到'-'或'0'时，赋值到 padc
+	char padc;
+	va_list aq;
+	va_copy(aq, ap);
+  80068d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800691:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800695:	48 8b 06             	mov    (%rsi),%rax
+  800698:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80069c:	48 89 01             	mov    %rax,(%rcx)
+  80069f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8006a3:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8006a7:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1)
+	{
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  8006ab:	eb 17                	jmp    8006c4 <vprintfmt+0x52>
+		{
+			if (ch == '\0')
+  8006ad:	85 db                	test   %ebx,%ebx
+  8006af:	0f 84 b9 04 00 00    	je     800b6e <vprintfmt+0x4fc>
+				return;
+			putch(ch, putdat);
+  8006b5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006b9:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8006bd:	48 89 c6             	mov    %rax,%rsi
+  8006c0:	89 df                	mov    %ebx,%edi
+  8006c2:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  8006c4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8006c8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006cc:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8006d0:	0f b6 00             	movzbl (%rax),%eax
+  8006d3:	0f b6 d8             	movzbl %al,%ebx
+  8006d6:	83 fb 25             	cmp    $0x25,%ebx
+  8006d9:	75 d2                	jne    8006ad <vprintfmt+0x3b>
+		}
+
+		// 处理 % 转义序列
+		// padc 初始化为空格符，padc='-'代表字符串左对齐，右边补空格，padc=' '代表右对齐，左边补空格，padc='0'右对齐，左边补0
+		padc = ' ';
+  8006db:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+		width = -1;
+  8006df:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+		// 默认-1代表显示长度为字符串本来的长度
+		precision = -1;
+  8006e6:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+		lflag = 0;
+  8006ed:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+		altflag = 0;
+  8006f4:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *)fmt++)
+  8006fb:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8006ff:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800703:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800707:	0f b6 00             	movzbl (%rax),%eax
+  80070a:	0f b6 d8             	movzbl %al,%ebx
+  80070d:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800710:	83 f8 55             	cmp    $0x55,%eax
+  800713:	0f 87 22 04 00 00    	ja     800b3b <vprintfmt+0x4c9>
+  800719:	89 c0                	mov    %eax,%eax
+  80071b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800722:	00 
+  800723:	48 b8 18 45 80 00 00 	movabs $0x804518,%rax
+  80072a:	00 00 00 
+  80072d:	48 01 d0             	add    %rdx,%rax
+  800730:	48 8b 00             	mov    (%rax),%rax
+  800733:	ff e0                	jmp    *%rax
+		{
+
+		// flag to pad on the right
+		case '-':
+			padc = '-';
+  800735:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+			goto reswitch;
+  800739:	eb c0                	jmp    8006fb <vprintfmt+0x89>
+
+		// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  80073b:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+			goto reswitch;
+  80073f:	eb ba                	jmp    8006fb <vprintfmt+0x89>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0;; ++fmt)
+  800741:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+			{
+				precision = precision * 10 + ch - '0';
+  800748:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80074b:	89 d0                	mov    %edx,%eax
+  80074d:	c1 e0 02             	shl    $0x2,%eax
+  800750:	01 d0                	add    %edx,%eax
+  800752:	01 c0                	add    %eax,%eax
+  800754:	01 d8                	add    %ebx,%eax
+  800756:	83 e8 30             	sub    $0x30,%eax
+  800759:	89 45 d8             	mov    %eax,-0x28(%rbp)
+				ch = *fmt;
+  80075c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800760:	0f b6 00             	movzbl (%rax),%eax
+  800763:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800766:	83 fb 2f             	cmp    $0x2f,%ebx
+  800769:	7e 60                	jle    8007cb <vprintfmt+0x159>
+  80076b:	83 fb 39             	cmp    $0x39,%ebx
+  80076e:	7f 5b                	jg     8007cb <vprintfmt+0x159>
+			for (precision = 0;; ++fmt)
+  800770:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+				precision = precision * 10 + ch - '0';
+  800775:	eb d1                	jmp    800748 <vprintfmt+0xd6>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800777:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80077a:	83 f8 2f             	cmp    $0x2f,%eax
+  80077d:	77 17                	ja     800796 <vprintfmt+0x124>
+  80077f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800783:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800786:	89 d2                	mov    %edx,%edx
+  800788:	48 01 d0             	add    %rdx,%rax
+  80078b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80078e:	83 c2 08             	add    $0x8,%edx
+  800791:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800794:	eb 0c                	jmp    8007a2 <vprintfmt+0x130>
+  800796:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80079a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80079e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8007a2:	8b 00                	mov    (%rax),%eax
+  8007a4:	89 45 d8             	mov    %eax,-0x28(%rbp)
+			goto process_precision;
+  8007a7:	eb 23                	jmp    8007cc <vprintfmt+0x15a>
+
+		case '.':
+			if (width < 0)
+  8007a9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8007ad:	0f 89 48 ff ff ff    	jns    8006fb <vprintfmt+0x89>
+				width = 0;
+  8007b3:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+			goto reswitch;
+  8007ba:	e9 3c ff ff ff       	jmp    8006fb <vprintfmt+0x89>
+
+		case '#':
+			altflag = 1;
+  8007bf:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+			goto reswitch;
+  8007c6:	e9 30 ff ff ff       	jmp    8006fb <vprintfmt+0x89>
+			goto process_precision;
+  8007cb:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  8007cc:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8007d0:	0f 89 25 ff ff ff    	jns    8006fb <vprintfmt+0x89>
+				width = precision, precision = -1;
+  8007d6:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8007d9:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8007dc:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+			goto reswitch;
+  8007e3:	e9 13 ff ff ff       	jmp    8006fb <vprintfmt+0x89>
+
+		// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  8007e8:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+			goto reswitch;
+  8007ec:	e9 0a ff ff ff       	jmp    8006fb <vprintfmt+0x89>
+
+		// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  8007f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f7:	77 17                	ja     800810 <vprintfmt+0x19e>
+  8007f9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007fd:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800800:	89 d2                	mov    %edx,%edx
+  800802:	48 01 d0             	add    %rdx,%rax
+  800805:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800808:	83 c2 08             	add    $0x8,%edx
+  80080b:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80080e:	eb 0c                	jmp    80081c <vprintfmt+0x1aa>
+  800810:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800814:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800818:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80081c:	8b 00                	mov    (%rax),%eax
+  80081e:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800822:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800826:	48 89 d6             	mov    %rdx,%rsi
+  800829:	89 c7                	mov    %eax,%edi
+  80082b:	ff d1                	call   *%rcx
+			break;
+  80082d:	e9 37 03 00 00       	jmp    800b69 <vprintfmt+0x4f7>
+
+		// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800832:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800835:	83 f8 2f             	cmp    $0x2f,%eax
+  800838:	77 17                	ja     800851 <vprintfmt+0x1df>
+  80083a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80083e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800841:	89 d2                	mov    %edx,%edx
+  800843:	48 01 d0             	add    %rdx,%rax
+  800846:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800849:	83 c2 08             	add    $0x8,%edx
+  80084c:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80084f:	eb 0c                	jmp    80085d <vprintfmt+0x1eb>
+  800851:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800855:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800859:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80085d:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  80085f:	85 db                	test   %ebx,%ebx
+  800861:	79 02                	jns    800865 <vprintfmt+0x1f3>
+				err = -err;
+  800863:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800865:	83 fb 11             	cmp    $0x11,%ebx
+  800868:	7f 16                	jg     800880 <vprintfmt+0x20e>
+  80086a:	48 ba 60 44 80 00 00 	movabs $0x804460,%rdx
+  800871:	00 00 00 
+  800874:	48 63 c3             	movslq %ebx,%rax
+  800877:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  80087b:	4d 85 e4             	test   %r12,%r12
+  80087e:	75 2e                	jne    8008ae <vprintfmt+0x23c>
+				printfmt(putch, putdat, "error %d", err);
+  800880:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800884:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800888:	89 d9                	mov    %ebx,%ecx
+  80088a:	48 ba 01 45 80 00 00 	movabs $0x804501,%rdx
+  800891:	00 00 00 
+  800894:	48 89 c7             	mov    %rax,%rdi
+  800897:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089c:	49 b8 78 0b 80 00 00 	movabs $0x800b78,%r8
+  8008a3:	00 00 00 
+  8008a6:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  8008a9:	e9 bb 02 00 00       	jmp    800b69 <vprintfmt+0x4f7>
+				printfmt(putch, putdat, "%s", p);
+  8008ae:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8008b2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8008b6:	4c 89 e1             	mov    %r12,%rcx
+  8008b9:	48 ba 0a 45 80 00 00 	movabs $0x80450a,%rdx
+  8008c0:	00 00 00 
+  8008c3:	48 89 c7             	mov    %rax,%rdi
+  8008c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008cb:	49 b8 78 0b 80 00 00 	movabs $0x800b78,%r8
+  8008d2:	00 00 00 
+  8008d5:	41 ff d0             	call   *%r8
+			break;
+  8008d8:	e9 8c 02 00 00       	jmp    800b69 <vprintfmt+0x4f7>
+
+		// string
+		case 's':
+			// 从可变参数中读入字符串指针
+			if ((p = va_arg(aq, char *)) == NULL)
+  8008dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e3:	77 17                	ja     8008fc <vprintfmt+0x28a>
+  8008e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8008e9:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008ec:	89 d2                	mov    %edx,%edx
+  8008ee:	48 01 d0             	add    %rdx,%rax
+  8008f1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008f4:	83 c2 08             	add    $0x8,%edx
+  8008f7:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8008fa:	eb 0c                	jmp    800908 <vprintfmt+0x296>
+  8008fc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800900:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800904:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800908:	4c 8b 20             	mov    (%rax),%r12
+  80090b:	4d 85 e4             	test   %r12,%r12
+  80090e:	75 0a                	jne    80091a <vprintfmt+0x2a8>
+				p = "(null)"; // 当字符串为空时，将它指向"(null)"字符串
+  800910:	49 bc 0d 45 80 00 00 	movabs $0x80450d,%r12
+  800917:	00 00 00 
+			// 判断左对齐还是右对齐，pad='-'左对齐，否则右对齐
+			if (width > 0 && padc != '-')
+  80091a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80091e:	7e 78                	jle    800998 <vprintfmt+0x326>
+  800920:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800924:	74 72                	je     800998 <vprintfmt+0x326>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800926:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800929:	48 98                	cltq
+  80092b:	48 89 c6             	mov    %rax,%rsi
+  80092e:	4c 89 e7             	mov    %r12,%rdi
+  800931:	48 b8 1d 0f 80 00 00 	movabs $0x800f1d,%rax
+  800938:	00 00 00 
+  80093b:	ff d0                	call   *%rax
+  80093d:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800940:	eb 17                	jmp    800959 <vprintfmt+0x2e7>
+					putch(padc, putdat); // 字符串右对齐，左边补相应数量(width-实际长度)的空格或者 0
+  800942:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800946:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80094a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80094e:	48 89 d6             	mov    %rdx,%rsi
+  800951:	89 c7                	mov    %eax,%edi
+  800953:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800955:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800959:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80095d:	7f e3                	jg     800942 <vprintfmt+0x2d0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80095f:	eb 37                	jmp    800998 <vprintfmt+0x326>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800961:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800965:	74 1e                	je     800985 <vprintfmt+0x313>
+  800967:	83 fb 1f             	cmp    $0x1f,%ebx
+  80096a:	7e 05                	jle    800971 <vprintfmt+0x2ff>
+  80096c:	83 fb 7e             	cmp    $0x7e,%ebx
+  80096f:	7e 14                	jle    800985 <vprintfmt+0x313>
+					putch('?', putdat);
+  800971:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800975:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800979:	48 89 c6             	mov    %rax,%rsi
+  80097c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800981:	ff d2                	call   *%rdx
+  800983:	eb 0f                	jmp    800994 <vprintfmt+0x322>
+				else
+					putch(ch, putdat); // 打印相应长度的字符串
+  800985:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800989:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80098d:	48 89 c6             	mov    %rax,%rsi
+  800990:	89 df                	mov    %ebx,%edi
+  800992:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800994:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800998:	4c 89 e0             	mov    %r12,%rax
+  80099b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80099f:	0f b6 00             	movzbl (%rax),%eax
+  8009a2:	0f be d8             	movsbl %al,%ebx
+  8009a5:	85 db                	test   %ebx,%ebx
+  8009a7:	74 28                	je     8009d1 <vprintfmt+0x35f>
+  8009a9:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8009ad:	78 b2                	js     800961 <vprintfmt+0x2ef>
+  8009af:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8009b3:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8009b7:	79 a8                	jns    800961 <vprintfmt+0x2ef>
+			for (; width > 0; width--)
+  8009b9:	eb 16                	jmp    8009d1 <vprintfmt+0x35f>
+				putch(' ', putdat); // 当字符串是左对齐的时候打印相应数量的空格
+  8009bb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009bf:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009c3:	48 89 c6             	mov    %rax,%rsi
+  8009c6:	bf 20 00 00 00       	mov    $0x20,%edi
+  8009cb:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  8009cd:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8009d1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8009d5:	7f e4                	jg     8009bb <vprintfmt+0x349>
+			break;
+  8009d7:	e9 8d 01 00 00       	jmp    800b69 <vprintfmt+0x4f7>
+
+		// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  8009dc:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8009e0:	be 03 00 00 00       	mov    $0x3,%esi
+  8009e5:	48 89 c7             	mov    %rax,%rdi
+  8009e8:	48 b8 6b 05 80 00 00 	movabs $0x80056b,%rax
+  8009ef:	00 00 00 
+  8009f2:	ff d0                	call   *%rax
+  8009f4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((long long)num < 0)
+  8009f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009fc:	48 85 c0             	test   %rax,%rax
+  8009ff:	79 1d                	jns    800a1e <vprintfmt+0x3ac>
+			{
+				putch('-', putdat);
+  800a01:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a05:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a09:	48 89 c6             	mov    %rax,%rsi
+  800a0c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a11:	ff d2                	call   *%rdx
+				num = -(long long)num;
+  800a13:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a17:	48 f7 d8             	neg    %rax
+  800a1a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			}
+			base = 10;
+  800a1e:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800a25:	e9 d2 00 00 00       	jmp    800afc <vprintfmt+0x48a>
+
+		// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800a2a:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a2e:	be 03 00 00 00       	mov    $0x3,%esi
+  800a33:	48 89 c7             	mov    %rax,%rdi
+  800a36:	48 b8 64 04 80 00 00 	movabs $0x800464,%rax
+  800a3d:	00 00 00 
+  800a40:	ff d0                	call   *%rax
+  800a42:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 10;
+  800a46:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800a4d:	e9 aa 00 00 00       	jmp    800afc <vprintfmt+0x48a>
+		// (unsigned) octal
+		case 'o':
+			// Gets the variable argument with type integer from the point which was processed last by va_arg
+			// calls getuint which returns a long long value, which then calls printnum which prints based on
+			// base value.
+			num = getuint(&aq, 3);
+  800a52:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a56:	be 03 00 00 00       	mov    $0x3,%esi
+  800a5b:	48 89 c7             	mov    %rax,%rdi
+  800a5e:	48 b8 64 04 80 00 00 	movabs $0x800464,%rax
+  800a65:	00 00 00 
+  800a68:	ff d0                	call   *%rax
+  800a6a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 8;
+  800a6e:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+			goto number;
+  800a75:	e9 82 00 00 00       	jmp    800afc <vprintfmt+0x48a>
+
+		// pointer
+		case 'p':
+			putch('0', putdat);
+  800a7a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a7e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a82:	48 89 c6             	mov    %rax,%rsi
+  800a85:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a8a:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800a8c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a90:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a94:	48 89 c6             	mov    %rax,%rsi
+  800a97:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a9c:	ff d2                	call   *%rdx
+			num = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800a9e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa1:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa4:	77 17                	ja     800abd <vprintfmt+0x44b>
+  800aa6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800aaa:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800aad:	89 d2                	mov    %edx,%edx
+  800aaf:	48 01 d0             	add    %rdx,%rax
+  800ab2:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ab5:	83 c2 08             	add    $0x8,%edx
+  800ab8:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800abb:	eb 0c                	jmp    800ac9 <vprintfmt+0x457>
+  800abd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800ac1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ac5:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800ac9:	48 8b 00             	mov    (%rax),%rax
+  800acc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800ad0:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+			goto number;
+  800ad7:	eb 23                	jmp    800afc <vprintfmt+0x48a>
+
+		// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800ad9:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800add:	be 03 00 00 00       	mov    $0x3,%esi
+  800ae2:	48 89 c7             	mov    %rax,%rdi
+  800ae5:	48 b8 64 04 80 00 00 	movabs $0x800464,%rax
+  800aec:	00 00 00 
+  800aef:	ff d0                	call   *%rax
+  800af1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800af5:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800afc:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800b01:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800b04:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800b07:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b0b:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800b0f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b13:	45 89 c1             	mov    %r8d,%r9d
+  800b16:	41 89 f8             	mov    %edi,%r8d
+  800b19:	48 89 c7             	mov    %rax,%rdi
+  800b1c:	48 b8 ac 03 80 00 00 	movabs $0x8003ac,%rax
+  800b23:	00 00 00 
+  800b26:	ff d0                	call   *%rax
+			break;
+  800b28:	eb 3f                	jmp    800b69 <vprintfmt+0x4f7>
+
+		// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800b2a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b2e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b32:	48 89 c6             	mov    %rax,%rsi
+  800b35:	89 df                	mov    %ebx,%edi
+  800b37:	ff d2                	call   *%rdx
+			break;
+  800b39:	eb 2e                	jmp    800b69 <vprintfmt+0x4f7>
+
+		// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800b3b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b3f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b43:	48 89 c6             	mov    %rax,%rsi
+  800b46:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b4b:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b4d:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800b52:	eb 05                	jmp    800b59 <vprintfmt+0x4e7>
+  800b54:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800b59:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800b5d:	48 83 e8 01          	sub    $0x1,%rax
+  800b61:	0f b6 00             	movzbl (%rax),%eax
+  800b64:	3c 25                	cmp    $0x25,%al
+  800b66:	75 ec                	jne    800b54 <vprintfmt+0x4e2>
+				/* do nothing */;
+			break;
+  800b68:	90                   	nop
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800b69:	e9 56 fb ff ff       	jmp    8006c4 <vprintfmt+0x52>
+				return;
+  800b6e:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800b6f:	48 83 c4 60          	add    $0x60,%rsp
+  800b73:	5b                   	pop    %rbx
+  800b74:	41 5c                	pop    %r12
+  800b76:	5d                   	pop    %rbp
+  800b77:	c3                   	ret
+
+0000000000800b78 <printfmt>:
+
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...)
+{
+  800b78:	55                   	push   %rbp
+  800b79:	48 89 e5             	mov    %rsp,%rbp
+  800b7c:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800b83:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800b8a:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800b91:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800b98:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800b9f:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800ba6:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800bad:	84 c0                	test   %al,%al
+  800baf:	74 20                	je     800bd1 <printfmt+0x59>
+  800bb1:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800bb5:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800bb9:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800bbd:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800bc1:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800bc5:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800bc9:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800bcd:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800bd1:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800bd8:	00 00 00 
+  800bdb:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800be2:	00 00 00 
+  800be5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800be9:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800bf0:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800bf7:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800bfe:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800c05:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800c0c:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800c13:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800c1a:	48 89 c7             	mov    %rax,%rdi
+  800c1d:	48 b8 72 06 80 00 00 	movabs $0x800672,%rax
+  800c24:	00 00 00 
+  800c27:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  800c29:	90                   	nop
+  800c2a:	c9                   	leave
+  800c2b:	c3                   	ret
+
+0000000000800c2c <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800c2c:	55                   	push   %rbp
+  800c2d:	48 89 e5             	mov    %rsp,%rbp
+  800c30:	48 83 ec 10          	sub    $0x10,%rsp
+  800c34:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800c37:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  800c3b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c3f:	8b 40 10             	mov    0x10(%rax),%eax
+  800c42:	8d 50 01             	lea    0x1(%rax),%edx
+  800c45:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c49:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  800c4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c50:	48 8b 10             	mov    (%rax),%rdx
+  800c53:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c57:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c5b:	48 39 c2             	cmp    %rax,%rdx
+  800c5e:	73 17                	jae    800c77 <sprintputch+0x4b>
+		*b->buf++ = ch;
+  800c60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c64:	48 8b 00             	mov    (%rax),%rax
+  800c67:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800c6b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800c6f:	48 89 0a             	mov    %rcx,(%rdx)
+  800c72:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800c75:	88 10                	mov    %dl,(%rax)
+}
+  800c77:	90                   	nop
+  800c78:	c9                   	leave
+  800c79:	c3                   	ret
+
+0000000000800c7a <vsnprintf>:
+
+int vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800c7a:	55                   	push   %rbp
+  800c7b:	48 89 e5             	mov    %rsp,%rbp
+  800c7e:	48 83 ec 50          	sub    $0x50,%rsp
+  800c82:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  800c86:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  800c89:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  800c8d:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+	va_list aq;
+	va_copy(aq, ap);
+  800c91:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800c95:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800c99:	48 8b 06             	mov    (%rsi),%rax
+  800c9c:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800ca0:	48 89 01             	mov    %rax,(%rcx)
+  800ca3:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800ca7:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800cab:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	struct sprintbuf b = {buf, buf + n - 1, 0};
+  800caf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800cb3:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800cb7:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  800cba:	48 98                	cltq
+  800cbc:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800cc0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800cc4:	48 01 d0             	add    %rdx,%rax
+  800cc7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  800ccb:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+
+	if (buf == NULL || n < 1)
+  800cd2:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800cd7:	74 06                	je     800cdf <vsnprintf+0x65>
+  800cd9:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800cdd:	7f 07                	jg     800ce6 <vsnprintf+0x6c>
+		return -E_INVAL;
+  800cdf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ce4:	eb 32                	jmp    800d18 <vsnprintf+0x9e>
+
+	// print the string to the buffer
+	vprintfmt((void *)sprintputch, &b, fmt, aq);
+  800ce6:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800cea:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  800cee:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800cf2:	48 89 c6             	mov    %rax,%rsi
+  800cf5:	48 b8 2c 0c 80 00 00 	movabs $0x800c2c,%rax
+  800cfc:	00 00 00 
+  800cff:	48 89 c7             	mov    %rax,%rdi
+  800d02:	48 b8 72 06 80 00 00 	movabs $0x800672,%rax
+  800d09:	00 00 00 
+  800d0c:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  800d0e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d12:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800d15:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  800d18:	c9                   	leave
+  800d19:	c3                   	ret
+
+0000000000800d1a <snprintf>:
+
+int snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800d1a:	55                   	push   %rbp
+  800d1b:	48 89 e5             	mov    %rsp,%rbp
+  800d1e:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800d25:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800d2c:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800d32:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800d39:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800d40:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800d47:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800d4e:	84 c0                	test   %al,%al
+  800d50:	74 20                	je     800d72 <snprintf+0x58>
+  800d52:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800d56:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800d5a:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800d5e:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800d62:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800d66:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800d6a:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800d6e:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  800d72:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800d79:	00 00 00 
+  800d7c:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800d83:	00 00 00 
+  800d86:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d8a:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800d91:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800d98:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq, ap);
+  800d9f:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800da6:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800dad:	48 8b 06             	mov    (%rsi),%rax
+  800db0:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800db4:	48 89 01             	mov    %rax,(%rcx)
+  800db7:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dbb:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800dbf:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  800dc3:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800dca:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  800dd1:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  800dd7:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800dde:	48 89 c7             	mov    %rax,%rdi
+  800de1:	48 b8 7a 0c 80 00 00 	movabs $0x800c7a,%rax
+  800de8:	00 00 00 
+  800deb:	ff d0                	call   *%rax
+  800ded:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  800df3:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800df9:	c9                   	leave
+  800dfa:	c3                   	ret
+
+0000000000800dfb <cpuid>:
+#define read_rip(var) __asm __volatile("leaq (%%rip), %0" : "=r" (var)::"cc","memory")
+
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800dfb:	55                   	push   %rbp
+  800dfc:	48 89 e5             	mov    %rsp,%rbp
+  800dff:	53                   	push   %rbx
+  800e00:	48 83 ec 38          	sub    $0x38,%rsp
+  800e04:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800e07:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800e0b:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800e0f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800e13:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid" 
+  800e17:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800e1a:	0f a2                	cpuid
+  800e1c:	89 de                	mov    %ebx,%esi
+  800e1e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800e21:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800e24:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800e27:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info));
+	if (eaxp)
+  800e2a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800e2f:	74 09                	je     800e3a <cpuid+0x3f>
+		*eaxp = eax;
+  800e31:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800e35:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800e38:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  800e3a:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800e3f:	74 09                	je     800e4a <cpuid+0x4f>
+		*ebxp = ebx;
+  800e41:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e45:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800e48:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  800e4a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800e4f:	74 09                	je     800e5a <cpuid+0x5f>
+		*ecxp = ecx;
+  800e51:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e55:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800e58:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  800e5a:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800e5f:	74 09                	je     800e6a <cpuid+0x6f>
+		*edxp = edx;
+  800e61:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800e65:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800e68:	89 10                	mov    %edx,(%rax)
+}
+  800e6a:	90                   	nop
+  800e6b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800e6f:	c9                   	leave
+  800e70:	c3                   	ret
+
+0000000000800e71 <cpuid_count>:
+
+// 带子功能号(%ecx = count)的 cpuid，用于 leaf 4/7/0xB/0xD 等
+static __inline void
+cpuid_count(uint32_t info, uint32_t count, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800e71:	55                   	push   %rbp
+  800e72:	48 89 e5             	mov    %rsp,%rbp
+  800e75:	53                   	push   %rbx
+  800e76:	48 83 ec 38          	sub    $0x38,%rsp
+  800e7a:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800e7d:	89 75 e0             	mov    %esi,-0x20(%rbp)
+  800e80:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800e84:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  800e88:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+  800e8c:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800e90:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800e93:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800e96:	89 d1                	mov    %edx,%ecx
+  800e98:	0f a2                	cpuid
+  800e9a:	89 de                	mov    %ebx,%esi
+  800e9c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800e9f:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800ea2:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800ea5:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info), "c" (count));
+	if (eaxp)
+  800ea8:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800ead:	74 09                	je     800eb8 <cpuid_count+0x47>
+		*eaxp = eax;
+  800eaf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800eb3:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800eb6:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  800eb8:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800ebd:	74 09                	je     800ec8 <cpuid_count+0x57>
+		*ebxp = ebx;
+  800ebf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ec3:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800ec6:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  800ec8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800ecd:	74 09                	je     800ed8 <cpuid_count+0x67>
+		*ecxp = ecx;
+  800ecf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ed3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800ed6:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  800ed8:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800edd:	74 09                	je     800ee8 <cpuid_count+0x77>
+		*edxp = edx;
+  800edf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800ee3:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800ee6:	89 10                	mov    %edx,(%rax)
+}
+  800ee8:	90                   	nop
+  800ee9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800eed:	c9                   	leave
+  800eee:	c3                   	ret
+
+0000000000800eef <strlen>:
+// 在真正的硬件上会有一定程度的优化, 但在 Bochs 上会有更大的优化效果
+// 用这种方法, Primespipe 的运行速度快了3倍
+#define ASM 1
+
+int strlen(const char *s)
+{
+  800eef:	55                   	push   %rbp
+  800ef0:	48 89 e5             	mov    %rsp,%rbp
+  800ef3:	48 83 ec 18          	sub    $0x18,%rsp
+  800ef7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800efb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800f02:	eb 09                	jmp    800f0d <strlen+0x1e>
+		n++;
+  800f04:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  800f08:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800f0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f11:	0f b6 00             	movzbl (%rax),%eax
+  800f14:	84 c0                	test   %al,%al
+  800f16:	75 ec                	jne    800f04 <strlen+0x15>
+	return n;
+  800f18:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800f1b:	c9                   	leave
+  800f1c:	c3                   	ret
+
+0000000000800f1d <strnlen>:
+
+int strnlen(const char *s, size_t size)
+{
+  800f1d:	55                   	push   %rbp
+  800f1e:	48 89 e5             	mov    %rsp,%rbp
+  800f21:	48 83 ec 20          	sub    $0x20,%rsp
+  800f25:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800f29:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f2d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800f34:	eb 0e                	jmp    800f44 <strnlen+0x27>
+		n++;
+  800f36:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f3a:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800f3f:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  800f44:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800f49:	74 0b                	je     800f56 <strnlen+0x39>
+  800f4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f4f:	0f b6 00             	movzbl (%rax),%eax
+  800f52:	84 c0                	test   %al,%al
+  800f54:	75 e0                	jne    800f36 <strnlen+0x19>
+	return n;
+  800f56:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800f59:	c9                   	leave
+  800f5a:	c3                   	ret
+
+0000000000800f5b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800f5b:	55                   	push   %rbp
+  800f5c:	48 89 e5             	mov    %rsp,%rbp
+  800f5f:	48 83 ec 20          	sub    $0x20,%rsp
+  800f63:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800f67:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  800f6b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f6f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  800f73:	90                   	nop
+  800f74:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f78:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  800f7c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800f80:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f84:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800f88:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f8c:	0f b6 12             	movzbl (%rdx),%edx
+  800f8f:	88 10                	mov    %dl,(%rax)
+  800f91:	0f b6 00             	movzbl (%rax),%eax
+  800f94:	84 c0                	test   %al,%al
+  800f96:	75 dc                	jne    800f74 <strcpy+0x19>
+		/* do nothing */;
+	return ret;
+  800f98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800f9c:	c9                   	leave
+  800f9d:	c3                   	ret
+
+0000000000800f9e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800f9e:	55                   	push   %rbp
+  800f9f:	48 89 e5             	mov    %rsp,%rbp
+  800fa2:	48 83 ec 20          	sub    $0x20,%rsp
+  800fa6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800faa:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int len = strlen(dst);
+  800fae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fb2:	48 89 c7             	mov    %rax,%rdi
+  800fb5:	48 b8 ef 0e 80 00 00 	movabs $0x800eef,%rax
+  800fbc:	00 00 00 
+  800fbf:	ff d0                	call   *%rax
+  800fc1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	strcpy(dst + len, src);
+  800fc4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800fc7:	48 63 d0             	movslq %eax,%rdx
+  800fca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fce:	48 01 c2             	add    %rax,%rdx
+  800fd1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800fd5:	48 89 c6             	mov    %rax,%rsi
+  800fd8:	48 89 d7             	mov    %rdx,%rdi
+  800fdb:	48 b8 5b 0f 80 00 00 	movabs $0x800f5b,%rax
+  800fe2:	00 00 00 
+  800fe5:	ff d0                	call   *%rax
+	return dst;
+  800fe7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  800feb:	c9                   	leave
+  800fec:	c3                   	ret
+
+0000000000800fed <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800fed:	55                   	push   %rbp
+  800fee:	48 89 e5             	mov    %rsp,%rbp
+  800ff1:	48 83 ec 28          	sub    $0x28,%rsp
+  800ff5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ff9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800ffd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801001:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801005:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++)
+  801009:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801010:	00 
+  801011:	eb 2a                	jmp    80103d <strncpy+0x50>
+	{
+		*dst++ = *src;
+  801013:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801017:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80101b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80101f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801023:	0f b6 12             	movzbl (%rdx),%edx
+  801026:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801028:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80102c:	0f b6 00             	movzbl (%rax),%eax
+  80102f:	84 c0                	test   %al,%al
+  801031:	74 05                	je     801038 <strncpy+0x4b>
+			src++;
+  801033:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++)
+  801038:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80103d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801041:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801045:	72 cc                	jb     801013 <strncpy+0x26>
+	}
+	return ret;
+  801047:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80104b:	c9                   	leave
+  80104c:	c3                   	ret
+
+000000000080104d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80104d:	55                   	push   %rbp
+  80104e:	48 89 e5             	mov    %rsp,%rbp
+  801051:	48 83 ec 28          	sub    $0x28,%rsp
+  801055:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801059:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80105d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801061:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801065:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0)
+  801069:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80106e:	74 3d                	je     8010ad <strlcpy+0x60>
+	{
+		while (--size > 0 && *src != '\0')
+  801070:	eb 1d                	jmp    80108f <strlcpy+0x42>
+			*dst++ = *src++;
+  801072:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801076:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80107a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80107e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801082:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801086:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80108a:	0f b6 12             	movzbl (%rdx),%edx
+  80108d:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  80108f:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801094:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801099:	74 0b                	je     8010a6 <strlcpy+0x59>
+  80109b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80109f:	0f b6 00             	movzbl (%rax),%eax
+  8010a2:	84 c0                	test   %al,%al
+  8010a4:	75 cc                	jne    801072 <strlcpy+0x25>
+		*dst = '\0';
+  8010a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010aa:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8010ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010b1:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8010b5:	c9                   	leave
+  8010b6:	c3                   	ret
+
+00000000008010b7 <strcmp>:
+
+int strcmp(const char *p, const char *q)
+{
+  8010b7:	55                   	push   %rbp
+  8010b8:	48 89 e5             	mov    %rsp,%rbp
+  8010bb:	48 83 ec 10          	sub    $0x10,%rsp
+  8010bf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8010c3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8010c7:	eb 0a                	jmp    8010d3 <strcmp+0x1c>
+		p++, q++;
+  8010c9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8010ce:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8010d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010d7:	0f b6 00             	movzbl (%rax),%eax
+  8010da:	84 c0                	test   %al,%al
+  8010dc:	74 12                	je     8010f0 <strcmp+0x39>
+  8010de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010e2:	0f b6 10             	movzbl (%rax),%edx
+  8010e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8010e9:	0f b6 00             	movzbl (%rax),%eax
+  8010ec:	38 c2                	cmp    %al,%dl
+  8010ee:	74 d9                	je     8010c9 <strcmp+0x12>
+	return (int)((unsigned char)*p - (unsigned char)*q);
+  8010f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010f4:	0f b6 00             	movzbl (%rax),%eax
+  8010f7:	0f b6 d0             	movzbl %al,%edx
+  8010fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8010fe:	0f b6 00             	movzbl (%rax),%eax
+  801101:	0f b6 c0             	movzbl %al,%eax
+  801104:	29 c2                	sub    %eax,%edx
+  801106:	89 d0                	mov    %edx,%eax
+}
+  801108:	c9                   	leave
+  801109:	c3                   	ret
+
+000000000080110a <strncmp>:
+
+int strncmp(const char *p, const char *q, size_t n)
+{
+  80110a:	55                   	push   %rbp
+  80110b:	48 89 e5             	mov    %rsp,%rbp
+  80110e:	48 83 ec 18          	sub    $0x18,%rsp
+  801112:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801116:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80111a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80111e:	eb 0f                	jmp    80112f <strncmp+0x25>
+		n--, p++, q++;
+  801120:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801125:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80112a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80112f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801134:	74 1d                	je     801153 <strncmp+0x49>
+  801136:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80113a:	0f b6 00             	movzbl (%rax),%eax
+  80113d:	84 c0                	test   %al,%al
+  80113f:	74 12                	je     801153 <strncmp+0x49>
+  801141:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801145:	0f b6 10             	movzbl (%rax),%edx
+  801148:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80114c:	0f b6 00             	movzbl (%rax),%eax
+  80114f:	38 c2                	cmp    %al,%dl
+  801151:	74 cd                	je     801120 <strncmp+0x16>
+	if (n == 0)
+  801153:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801158:	75 07                	jne    801161 <strncmp+0x57>
+		return 0;
+  80115a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80115f:	eb 16                	jmp    801177 <strncmp+0x6d>
+	else
+		return (int)((unsigned char)*p - (unsigned char)*q);
+  801161:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801165:	0f b6 00             	movzbl (%rax),%eax
+  801168:	0f b6 d0             	movzbl %al,%edx
+  80116b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80116f:	0f b6 00             	movzbl (%rax),%eax
+  801172:	0f b6 c0             	movzbl %al,%eax
+  801175:	29 c2                	sub    %eax,%edx
+}
+  801177:	89 d0                	mov    %edx,%eax
+  801179:	c9                   	leave
+  80117a:	c3                   	ret
+
+000000000080117b <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80117b:	55                   	push   %rbp
+  80117c:	48 89 e5             	mov    %rsp,%rbp
+  80117f:	48 83 ec 10          	sub    $0x10,%rsp
+  801183:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801187:	89 f0                	mov    %esi,%eax
+  801189:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80118c:	eb 17                	jmp    8011a5 <strchr+0x2a>
+		if (*s == c)
+  80118e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801192:	0f b6 00             	movzbl (%rax),%eax
+  801195:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801198:	75 06                	jne    8011a0 <strchr+0x25>
+			return (char *)s;
+  80119a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80119e:	eb 15                	jmp    8011b5 <strchr+0x3a>
+	for (; *s; s++)
+  8011a0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8011a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011a9:	0f b6 00             	movzbl (%rax),%eax
+  8011ac:	84 c0                	test   %al,%al
+  8011ae:	75 de                	jne    80118e <strchr+0x13>
+	return 0;
+  8011b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011b5:	c9                   	leave
+  8011b6:	c3                   	ret
+
+00000000008011b7 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8011b7:	55                   	push   %rbp
+  8011b8:	48 89 e5             	mov    %rsp,%rbp
+  8011bb:	48 83 ec 10          	sub    $0x10,%rsp
+  8011bf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8011c3:	89 f0                	mov    %esi,%eax
+  8011c5:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8011c8:	eb 11                	jmp    8011db <strfind+0x24>
+		if (*s == c)
+  8011ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011ce:	0f b6 00             	movzbl (%rax),%eax
+  8011d1:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8011d4:	74 12                	je     8011e8 <strfind+0x31>
+	for (; *s; s++)
+  8011d6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8011db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011df:	0f b6 00             	movzbl (%rax),%eax
+  8011e2:	84 c0                	test   %al,%al
+  8011e4:	75 e4                	jne    8011ca <strfind+0x13>
+  8011e6:	eb 01                	jmp    8011e9 <strfind+0x32>
+			break;
+  8011e8:	90                   	nop
+	return (char *)s;
+  8011e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8011ed:	c9                   	leave
+  8011ee:	c3                   	ret
+
+00000000008011ef <mem_init>:
+};
+
+static int mem_features;
+
+void mem_init(void)
+{
+  8011ef:	55                   	push   %rbp
+  8011f0:	48 89 e5             	mov    %rsp,%rbp
+  8011f3:	48 83 ec 10          	sub    $0x10,%rsp
+	uint32_t max, ebx, edx;
+
+	mem_features = 0;
+  8011f7:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  8011fe:	00 00 00 
+  801201:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	cpuid(0, &max, NULL, NULL, NULL);
+  801207:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+  80120b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801211:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801216:	ba 00 00 00 00       	mov    $0x0,%edx
+  80121b:	48 89 c6             	mov    %rax,%rsi
+  80121e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801223:	48 b8 fb 0d 80 00 00 	movabs $0x800dfb,%rax
+  80122a:	00 00 00 
+  80122d:	ff d0                	call   *%rax
+	cpuid(1, NULL, NULL, NULL, &edx);
+  80122f:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  801233:	49 89 c0             	mov    %rax,%r8
+  801236:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80123b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801240:	be 00 00 00 00       	mov    $0x0,%esi
+  801245:	bf 01 00 00 00       	mov    $0x1,%edi
+  80124a:	48 b8 fb 0d 80 00 00 	movabs $0x800dfb,%rax
+  801251:	00 00 00 
+  801254:	ff d0                	call   *%rax
+	if (edx & (1 << 26))
+  801256:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801259:	25 00 00 00 04       	and    $0x4000000,%eax
+  80125e:	85 c0                	test   %eax,%eax
+  801260:	74 1d                	je     80127f <mem_init+0x90>
+		mem_features |= MEM_F_NT;
+  801262:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801269:	00 00 00 
+  80126c:	8b 00                	mov    (%rax),%eax
+  80126e:	83 c8 02             	or     $0x2,%eax
+  801271:	89 c2                	mov    %eax,%edx
+  801273:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80127a:	00 00 00 
+  80127d:	89 10                	mov    %edx,(%rax)
+	if (max >= 7)
+  80127f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801282:	83 f8 06             	cmp    $0x6,%eax
+  801285:	76 57                	jbe    8012de <mem_init+0xef>
+	{
+		cpuid_count(7, 0, NULL, &ebx, NULL, NULL);
+  801287:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  80128b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801291:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801297:	48 89 c1             	mov    %rax,%rcx
+  80129a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80129f:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a4:	bf 07 00 00 00       	mov    $0x7,%edi
+  8012a9:	48 b8 71 0e 80 00 00 	movabs $0x800e71,%rax
+  8012b0:	00 00 00 
+  8012b3:	ff d0                	call   *%rax
+		if (ebx & (1 << 9))
+  8012b5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8012b8:	25 00 02 00 00       	and    $0x200,%eax
+  8012bd:	85 c0                	test   %eax,%eax
+  8012bf:	74 1d                	je     8012de <mem_init+0xef>
+			mem_features |= MEM_F_ERMS;
+  8012c1:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  8012c8:	00 00 00 
+  8012cb:	8b 00                	mov    (%rax),%eax
+  8012cd:	83 c8 01             	or     $0x1,%eax
+  8012d0:	89 c2                	mov    %eax,%edx
+  8012d2:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  8012d9:	00 00 00 
+  8012dc:	89 10                	mov    %edx,(%rax)
+	}
+}
+  8012de:	90                   	nop
+  8012df:	c9                   	leave
+  8012e0:	c3                   	ret
+
+00000000008012e1 <memset_nt>:
+
+// 非临时存储填充 n 字节(v 8 字节对齐，n 为 32 的倍数)
+static void
+memset_nt(void *v, uint64_t pattern, size_t n)
+{
+  8012e1:	55                   	push   %rbp
+  8012e2:	48 89 e5             	mov    %rsp,%rbp
+  8012e5:	48 83 ec 28          	sub    $0x28,%rsp
+  8012e9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012ed:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8012f1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t *p = (uint64_t *)v;
+  8012f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012f9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint64_t *end = p + n / 8;
+  8012fd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801301:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  801305:	48 89 c2             	mov    %rax,%rdx
+  801308:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80130c:	48 01 d0             	add    %rdx,%rax
+  80130f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	for (; p < end; p += 4)
+  801313:	eb 20                	jmp    801335 <memset_nt+0x54>
+		asm volatile("movnti %1, 0(%0)\n\t"
+  801315:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801319:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80131d:	48 0f c3 10          	movnti %rdx,(%rax)
+  801321:	48 0f c3 50 08       	movnti %rdx,0x8(%rax)
+  801326:	48 0f c3 50 10       	movnti %rdx,0x10(%rax)
+  80132b:	48 0f c3 50 18       	movnti %rdx,0x18(%rax)
+	for (; p < end; p += 4)
+  801330:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  801335:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801339:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80133d:	72 d6                	jb     801315 <memset_nt+0x34>
+					 "movnti %1, 16(%0)\n\t"
+					 "movnti %1, 24(%0)"
+					 :
+					 : "r"(p), "r"(pattern)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  80133f:	0f ae f8             	sfence
+}
+  801342:	90                   	nop
+  801343:	c9                   	leave
+  801344:	c3                   	ret
+
+0000000000801345 <memcpy_nt>:
+
+// 非临时存储复制 n 字节(dst/src 8 字节对齐且不重叠，n 为 32 的倍数)
+static void
+memcpy_nt(void *dst, const void *src, size_t n)
+{
+  801345:	55                   	push   %rbp
+  801346:	48 89 e5             	mov    %rsp,%rbp
+  801349:	48 83 ec 58          	sub    $0x58,%rsp
+  80134d:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801351:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801355:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	uint64_t *d = (uint64_t *)dst;
+  801359:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80135d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint64_t *s = (const uint64_t *)src;
+  801361:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801365:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	uint64_t *end = d + n / 8;
+  801369:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80136d:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  801371:	48 89 c2             	mov    %rax,%rdx
+  801374:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801378:	48 01 d0             	add    %rdx,%rax
+  80137b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint64_t t0, t1, t2, t3;
+
+	for (; d < end; d += 4, s += 4)
+  80137f:	eb 44                	jmp    8013c5 <memcpy_nt+0x80>
+		asm volatile("movq 0(%4), %0\n\t"
+  801381:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801385:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801389:	4c 8b 00             	mov    (%rax),%r8
+  80138c:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  801390:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  801394:	48 8b 48 18          	mov    0x18(%rax),%rcx
+  801398:	4c 0f c3 02          	movnti %r8,(%rdx)
+  80139c:	48 0f c3 7a 08       	movnti %rdi,0x8(%rdx)
+  8013a1:	48 0f c3 72 10       	movnti %rsi,0x10(%rdx)
+  8013a6:	48 0f c3 4a 18       	movnti %rcx,0x18(%rdx)
+  8013ab:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8013af:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8013b3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8013b7:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+	for (; d < end; d += 4, s += 4)
+  8013bb:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  8013c0:	48 83 45 f0 20       	addq   $0x20,-0x10(%rbp)
+  8013c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013c9:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  8013cd:	72 b2                	jb     801381 <memcpy_nt+0x3c>
+					 "movnti %2, 16(%5)\n\t"
+					 "movnti %3, 24(%5)"
+					 : "=&r"(t0), "=&r"(t1), "=&r"(t2), "=&r"(t3)
+					 : "r"(s), "r"(d)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  8013cf:	0f ae f8             	sfence
+}
+  8013d2:	90                   	nop
+  8013d3:	c9                   	leave
+  8013d4:	c3                   	ret
+
+00000000008013d5 <memcpy_fwd>:
+
+// 正向复制(dst 在 src 之前或两者不重叠)
+static void
+memcpy_fwd(void *dst, const void *src, size_t n)
+{
+  8013d5:	55                   	push   %rbp
+  8013d6:	48 89 e5             	mov    %rsp,%rbp
+  8013d9:	48 83 ec 18          	sub    $0x18,%rsp
+  8013dd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8013e1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8013e5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  8013e9:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  8013f0:	00 00 00 
+  8013f3:	8b 00                	mov    (%rax),%eax
+  8013f5:	83 e0 02             	and    $0x2,%eax
+  8013f8:	85 c0                	test   %eax,%eax
+  8013fa:	74 66                	je     801462 <memcpy_fwd+0x8d>
+  8013fc:	48 81 7d e8 ff 0f 00 	cmpq   $0xfff,-0x18(%rbp)
+  801403:	00 
+  801404:	76 5c                	jbe    801462 <memcpy_fwd+0x8d>
+  801406:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80140a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80140e:	48 09 d0             	or     %rdx,%rax
+  801411:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  801415:	83 e0 1f             	and    $0x1f,%eax
+  801418:	48 85 c0             	test   %rax,%rax
+  80141b:	75 45                	jne    801462 <memcpy_fwd+0x8d>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  80141d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801421:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801425:	48 01 d0             	add    %rdx,%rax
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  801428:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80142c:	73 11                	jae    80143f <memcpy_fwd+0x6a>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  80142e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801432:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801436:	48 01 d0             	add    %rdx,%rax
+  801439:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80143d:	72 23                	jb     801462 <memcpy_fwd+0x8d>
+		memcpy_nt(dst, src, n);
+  80143f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801443:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801447:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80144b:	48 89 ce             	mov    %rcx,%rsi
+  80144e:	48 89 c7             	mov    %rax,%rdi
+  801451:	48 b8 45 13 80 00 00 	movabs $0x801345,%rax
+  801458:	00 00 00 
+  80145b:	ff d0                	call   *%rax
+  80145d:	e9 81 00 00 00       	jmp    8014e3 <memcpy_fwd+0x10e>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  801462:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801469:	00 00 00 
+  80146c:	8b 00                	mov    (%rax),%eax
+  80146e:	83 e0 01             	and    $0x1,%eax
+  801471:	85 c0                	test   %eax,%eax
+  801473:	74 21                	je     801496 <memcpy_fwd+0xc1>
+  801475:	48 81 7d e8 ff 00 00 	cmpq   $0xff,-0x18(%rbp)
+  80147c:	00 
+  80147d:	76 17                	jbe    801496 <memcpy_fwd+0xc1>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  80147f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801483:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801487:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80148b:	48 89 c7             	mov    %rax,%rdi
+  80148e:	48 89 d6             	mov    %rdx,%rsi
+  801491:	fc                   	cld
+  801492:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801494:	eb 4d                	jmp    8014e3 <memcpy_fwd+0x10e>
+					 : "cc", "memory");
+	else if ((((uint64_t)dst | (uint64_t)src | n) & 7) == 0)
+  801496:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80149a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80149e:	48 09 d0             	or     %rdx,%rax
+  8014a1:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  8014a5:	83 e0 07             	and    $0x7,%eax
+  8014a8:	48 85 c0             	test   %rax,%rax
+  8014ab:	75 1f                	jne    8014cc <memcpy_fwd+0xf7>
+		asm volatile("cld; rep movsq\n" ::"D"(dst), "S"(src), "c"(n / 8)
+  8014ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014b1:	48 c1 e8 03          	shr    $0x3,%rax
+  8014b5:	48 89 c1             	mov    %rax,%rcx
+  8014b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014bc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8014c0:	48 89 c7             	mov    %rax,%rdi
+  8014c3:	48 89 d6             	mov    %rdx,%rsi
+  8014c6:	fc                   	cld
+  8014c7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+					 : "cc", "memory");
+}
+  8014ca:	eb 17                	jmp    8014e3 <memcpy_fwd+0x10e>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  8014cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014d0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8014d4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8014d8:	48 89 c7             	mov    %rax,%rdi
+  8014db:	48 89 d6             	mov    %rdx,%rsi
+  8014de:	fc                   	cld
+  8014df:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+  8014e1:	eb 00                	jmp    8014e3 <memcpy_fwd+0x10e>
+  8014e3:	90                   	nop
+  8014e4:	c9                   	leave
+  8014e5:	c3                   	ret
+
+00000000008014e6 <memset>:
+
+void *
+memset(void *v, int c, size_t n)
+{
+  8014e6:	55                   	push   %rbp
+  8014e7:	48 89 e5             	mov    %rsp,%rbp
+  8014ea:	48 83 ec 28          	sub    $0x28,%rsp
+  8014ee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014f2:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8014f5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t pattern;
+
+	if (n == 0)
+  8014f9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8014fe:	75 09                	jne    801509 <memset+0x23>
+		return v;
+  801500:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801504:	e9 dc 00 00 00       	jmp    8015e5 <memset+0xff>
+	c &= 0xFF;
+  801509:	81 65 e4 ff 00 00 00 	andl   $0xff,-0x1c(%rbp)
+	pattern = (uint64_t)c * 0x0101010101010101UL;
+  801510:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801513:	48 98                	cltq
+  801515:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  80151c:	01 01 01 
+  80151f:	48 0f af c2          	imul   %rdx,%rax
+  801523:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)v | n) & 31) == 0)
+  801527:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80152e:	00 00 00 
+  801531:	8b 00                	mov    (%rax),%eax
+  801533:	83 e0 02             	and    $0x2,%eax
+  801536:	85 c0                	test   %eax,%eax
+  801538:	74 3a                	je     801574 <memset+0x8e>
+  80153a:	48 81 7d d8 ff 0f 00 	cmpq   $0xfff,-0x28(%rbp)
+  801541:	00 
+  801542:	76 30                	jbe    801574 <memset+0x8e>
+  801544:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801548:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  80154c:	83 e0 1f             	and    $0x1f,%eax
+  80154f:	48 85 c0             	test   %rax,%rax
+  801552:	75 20                	jne    801574 <memset+0x8e>
+		memset_nt(v, pattern, n);
+  801554:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801558:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80155c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801560:	48 89 ce             	mov    %rcx,%rsi
+  801563:	48 89 c7             	mov    %rax,%rdi
+  801566:	48 b8 e1 12 80 00 00 	movabs $0x8012e1,%rax
+  80156d:	00 00 00 
+  801570:	ff d0                	call   *%rax
+  801572:	eb 6d                	jmp    8015e1 <memset+0xfb>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  801574:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80157b:	00 00 00 
+  80157e:	8b 00                	mov    (%rax),%eax
+  801580:	83 e0 01             	and    $0x1,%eax
+  801583:	85 c0                	test   %eax,%eax
+  801585:	74 1d                	je     8015a4 <memset+0xbe>
+  801587:	48 81 7d d8 ff 00 00 	cmpq   $0xff,-0x28(%rbp)
+  80158e:	00 
+  80158f:	76 13                	jbe    8015a4 <memset+0xbe>
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  801591:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801595:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801598:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80159c:	48 89 d7             	mov    %rdx,%rdi
+  80159f:	fc                   	cld
+  8015a0:	f3 aa                	rep stos %al,%es:(%rdi)
+  8015a2:	eb 3d                	jmp    8015e1 <memset+0xfb>
+					 : "cc", "memory");
+	else if ((((uint64_t)v | n) & 7) == 0)
+  8015a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015a8:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  8015ac:	83 e0 07             	and    $0x7,%eax
+  8015af:	48 85 c0             	test   %rax,%rax
+  8015b2:	75 1c                	jne    8015d0 <memset+0xea>
+		asm volatile("cld; rep stosq\n" ::"D"(v), "a"(pattern), "c"(n / 8)
+  8015b4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015b8:	48 c1 e8 03          	shr    $0x3,%rax
+  8015bc:	48 89 c1             	mov    %rax,%rcx
+  8015bf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8015c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015c7:	48 89 d7             	mov    %rdx,%rdi
+  8015ca:	fc                   	cld
+  8015cb:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8015ce:	eb 11                	jmp    8015e1 <memset+0xfb>
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  8015d0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8015d4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8015d7:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8015db:	48 89 d7             	mov    %rdx,%rdi
+  8015de:	fc                   	cld
+  8015df:	f3 aa                	rep stos %al,%es:(%rdi)
+					 : "cc", "memory");
+	return v;
+  8015e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8015e5:	c9                   	leave
+  8015e6:	c3                   	ret
+
+00000000008015e7 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8015e7:	55                   	push   %rbp
+  8015e8:	48 89 e5             	mov    %rsp,%rbp
+  8015eb:	48 83 ec 28          	sub    $0x28,%rsp
+  8015ef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015f3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8015f7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  8015fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015ff:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801603:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801607:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d)
+  80160b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80160f:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801613:	73 7c                	jae    801691 <memmove+0xaa>
+  801615:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801619:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80161d:	48 01 d0             	add    %rdx,%rax
+  801620:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801624:	73 6b                	jae    801691 <memmove+0xaa>
+	{
+		// 重叠且 dst 在 src 之后，只能反向复制(ERMS 对反向 rep movsb 没有优化)
+		s += n;
+  801626:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80162a:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  80162e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801632:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((((uint64_t)s | (uint64_t)d | n) & 7) == 0)
+  801636:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80163a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80163e:	48 09 d0             	or     %rdx,%rax
+  801641:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  801645:	83 e0 07             	and    $0x7,%eax
+  801648:	48 85 c0             	test   %rax,%rax
+  80164b:	75 24                	jne    801671 <memmove+0x8a>
+			asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80164d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801651:	48 83 e8 08          	sub    $0x8,%rax
+  801655:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801659:	48 83 ea 08          	sub    $0x8,%rdx
+  80165d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801661:	48 c1 e9 03          	shr    $0x3,%rcx
+  801665:	48 89 c7             	mov    %rax,%rdi
+  801668:	48 89 d6             	mov    %rdx,%rsi
+  80166b:	fd                   	std
+  80166c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80166f:	eb 1d                	jmp    80168e <memmove+0xa7>
+						 : "cc", "memory");
+		else
+			asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801671:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801675:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801679:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80167d:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+  801681:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801685:	48 89 d7             	mov    %rdx,%rdi
+  801688:	48 89 c1             	mov    %rax,%rcx
+  80168b:	fd                   	std
+  80168c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+						 : "cc", "memory");
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::
+  80168e:	fc                   	cld
+  80168f:	eb 25                	jmp    8016b6 <memmove+0xcf>
+						 : "cc");
+	}
+	else if (n)
+  801691:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801696:	74 1e                	je     8016b6 <memmove+0xcf>
+		memcpy_fwd(d, s, n);
+  801698:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80169c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8016a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016a4:	48 89 ce             	mov    %rcx,%rsi
+  8016a7:	48 89 c7             	mov    %rax,%rdi
+  8016aa:	48 b8 d5 13 80 00 00 	movabs $0x8013d5,%rax
+  8016b1:	00 00 00 
+  8016b4:	ff d0                	call   *%rax
+	return dst;
+  8016b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8016ba:	c9                   	leave
+  8016bb:	c3                   	ret
+
+00000000008016bc <memcpy>:
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8016bc:	55                   	push   %rbp
+  8016bd:	48 89 e5             	mov    %rsp,%rbp
+  8016c0:	48 83 ec 18          	sub    $0x18,%rsp
+  8016c4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016c8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8016cc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (n)
+  8016d0:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8016d5:	74 1e                	je     8016f5 <memcpy+0x39>
+		memcpy_fwd(dst, src, n);
+  8016d7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8016db:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8016df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016e3:	48 89 ce             	mov    %rcx,%rsi
+  8016e6:	48 89 c7             	mov    %rax,%rdi
+  8016e9:	48 b8 d5 13 80 00 00 	movabs $0x8013d5,%rax
+  8016f0:	00 00 00 
+  8016f3:	ff d0                	call   *%rax
+	return dst;
+  8016f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8016f9:	c9                   	leave
+  8016fa:	c3                   	ret
+
+00000000008016fb <memcmp>:
+{
+}
+#endif
+
+int memcmp(const void *v1, const void *v2, size_t n)
+{
+  8016fb:	55                   	push   %rbp
+  8016fc:	48 89 e5             	mov    %rsp,%rbp
+  8016ff:	48 83 ec 28          	sub    $0x28,%rsp
+  801703:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801707:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80170b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *)v1;
+  80170f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801713:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *)v2;
+  801717:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80171b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0)
+  80171f:	eb 34                	jmp    801755 <memcmp+0x5a>
+	{
+		if (*s1 != *s2)
+  801721:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801725:	0f b6 10             	movzbl (%rax),%edx
+  801728:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80172c:	0f b6 00             	movzbl (%rax),%eax
+  80172f:	38 c2                	cmp    %al,%dl
+  801731:	74 18                	je     80174b <memcmp+0x50>
+			return (int)*s1 - (int)*s2;
+  801733:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801737:	0f b6 00             	movzbl (%rax),%eax
+  80173a:	0f b6 d0             	movzbl %al,%edx
+  80173d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801741:	0f b6 00             	movzbl (%rax),%eax
+  801744:	0f b6 c0             	movzbl %al,%eax
+  801747:	29 c2                	sub    %eax,%edx
+  801749:	eb 20                	jmp    80176b <memcmp+0x70>
+		s1++, s2++;
+  80174b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801750:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0)
+  801755:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801759:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80175d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801761:	48 85 c0             	test   %rax,%rax
+  801764:	75 bb                	jne    801721 <memcmp+0x26>
+	}
+
+	return 0;
+  801766:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  80176b:	89 d0                	mov    %edx,%eax
+  80176d:	c9                   	leave
+  80176e:	c3                   	ret
+
+000000000080176f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80176f:	55                   	push   %rbp
+  801770:	48 89 e5             	mov    %rsp,%rbp
+  801773:	48 83 ec 28          	sub    $0x28,%rsp
+  801777:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80177b:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  80177e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *)s + n;
+  801782:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801786:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80178a:	48 01 d0             	add    %rdx,%rax
+  80178d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801791:	eb 13                	jmp    8017a6 <memfind+0x37>
+		if (*(const unsigned char *)s == (unsigned char)c)
+  801793:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801797:	0f b6 00             	movzbl (%rax),%eax
+  80179a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80179d:	38 d0                	cmp    %dl,%al
+  80179f:	74 11                	je     8017b2 <memfind+0x43>
+	for (; s < ends; s++)
+  8017a1:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8017a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017aa:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8017ae:	72 e3                	jb     801793 <memfind+0x24>
+  8017b0:	eb 01                	jmp    8017b3 <memfind+0x44>
+			break;
+  8017b2:	90                   	nop
+	return (void *)s;
+  8017b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8017b7:	c9                   	leave
+  8017b8:	c3                   	ret
+
+00000000008017b9 <strtol>:
+
+long strtol(const char *s, char **endptr, int base)
+{
+  8017b9:	55                   	push   %rbp
+  8017ba:	48 89 e5             	mov    %rsp,%rbp
+  8017bd:	48 83 ec 38          	sub    $0x38,%rsp
+  8017c1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8017c5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8017c9:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  8017cc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  8017d3:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8017da:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8017db:	eb 05                	jmp    8017e2 <strtol+0x29>
+		s++;
+  8017dd:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  8017e2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017e6:	0f b6 00             	movzbl (%rax),%eax
+  8017e9:	3c 20                	cmp    $0x20,%al
+  8017eb:	74 f0                	je     8017dd <strtol+0x24>
+  8017ed:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017f1:	0f b6 00             	movzbl (%rax),%eax
+  8017f4:	3c 09                	cmp    $0x9,%al
+  8017f6:	74 e5                	je     8017dd <strtol+0x24>
+
+	// plus/minus sign
+	if (*s == '+')
+  8017f8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017fc:	0f b6 00             	movzbl (%rax),%eax
+  8017ff:	3c 2b                	cmp    $0x2b,%al
+  801801:	75 07                	jne    80180a <strtol+0x51>
+		s++;
+  801803:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801808:	eb 17                	jmp    801821 <strtol+0x68>
+	else if (*s == '-')
+  80180a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80180e:	0f b6 00             	movzbl (%rax),%eax
+  801811:	3c 2d                	cmp    $0x2d,%al
+  801813:	75 0c                	jne    801821 <strtol+0x68>
+		s++, neg = 1;
+  801815:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80181a:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801821:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801825:	74 06                	je     80182d <strtol+0x74>
+  801827:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  80182b:	75 28                	jne    801855 <strtol+0x9c>
+  80182d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801831:	0f b6 00             	movzbl (%rax),%eax
+  801834:	3c 30                	cmp    $0x30,%al
+  801836:	75 1d                	jne    801855 <strtol+0x9c>
+  801838:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80183c:	48 83 c0 01          	add    $0x1,%rax
+  801840:	0f b6 00             	movzbl (%rax),%eax
+  801843:	3c 78                	cmp    $0x78,%al
+  801845:	75 0e                	jne    801855 <strtol+0x9c>
+		s += 2, base = 16;
+  801847:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  80184c:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801853:	eb 2c                	jmp    801881 <strtol+0xc8>
+	else if (base == 0 && s[0] == '0')
+  801855:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801859:	75 19                	jne    801874 <strtol+0xbb>
+  80185b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80185f:	0f b6 00             	movzbl (%rax),%eax
+  801862:	3c 30                	cmp    $0x30,%al
+  801864:	75 0e                	jne    801874 <strtol+0xbb>
+		s++, base = 8;
+  801866:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80186b:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801872:	eb 0d                	jmp    801881 <strtol+0xc8>
+	else if (base == 0)
+  801874:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801878:	75 07                	jne    801881 <strtol+0xc8>
+		base = 10;
+  80187a:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+	// digits
+	while (1)
+	{
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801881:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801885:	0f b6 00             	movzbl (%rax),%eax
+  801888:	3c 2f                	cmp    $0x2f,%al
+  80188a:	7e 1d                	jle    8018a9 <strtol+0xf0>
+  80188c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801890:	0f b6 00             	movzbl (%rax),%eax
+  801893:	3c 39                	cmp    $0x39,%al
+  801895:	7f 12                	jg     8018a9 <strtol+0xf0>
+			dig = *s - '0';
+  801897:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80189b:	0f b6 00             	movzbl (%rax),%eax
+  80189e:	0f be c0             	movsbl %al,%eax
+  8018a1:	83 e8 30             	sub    $0x30,%eax
+  8018a4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8018a7:	eb 4e                	jmp    8018f7 <strtol+0x13e>
+		else if (*s >= 'a' && *s <= 'z')
+  8018a9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018ad:	0f b6 00             	movzbl (%rax),%eax
+  8018b0:	3c 60                	cmp    $0x60,%al
+  8018b2:	7e 1d                	jle    8018d1 <strtol+0x118>
+  8018b4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018b8:	0f b6 00             	movzbl (%rax),%eax
+  8018bb:	3c 7a                	cmp    $0x7a,%al
+  8018bd:	7f 12                	jg     8018d1 <strtol+0x118>
+			dig = *s - 'a' + 10;
+  8018bf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018c3:	0f b6 00             	movzbl (%rax),%eax
+  8018c6:	0f be c0             	movsbl %al,%eax
+  8018c9:	83 e8 57             	sub    $0x57,%eax
+  8018cc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8018cf:	eb 26                	jmp    8018f7 <strtol+0x13e>
+		else if (*s >= 'A' && *s <= 'Z')
+  8018d1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018d5:	0f b6 00             	movzbl (%rax),%eax
+  8018d8:	3c 40                	cmp    $0x40,%al
+  8018da:	7e 47                	jle    801923 <strtol+0x16a>
+  8018dc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018e0:	0f b6 00             	movzbl (%rax),%eax
+  8018e3:	3c 5a                	cmp    $0x5a,%al
+  8018e5:	7f 3c                	jg     801923 <strtol+0x16a>
+			dig = *s - 'A' + 10;
+  8018e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018eb:	0f b6 00             	movzbl (%rax),%eax
+  8018ee:	0f be c0             	movsbl %al,%eax
+  8018f1:	83 e8 37             	sub    $0x37,%eax
+  8018f4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  8018f7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8018fa:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  8018fd:	7d 23                	jge    801922 <strtol+0x169>
+			break;
+		s++, val = (val * base) + dig;
+  8018ff:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801904:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801907:	48 98                	cltq
+  801909:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  80190e:	48 89 c2             	mov    %rax,%rdx
+  801911:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801914:	48 98                	cltq
+  801916:	48 01 d0             	add    %rdx,%rax
+  801919:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+  80191d:	e9 5f ff ff ff       	jmp    801881 <strtol+0xc8>
+			break;
+  801922:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801923:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801928:	74 0b                	je     801935 <strtol+0x17c>
+		*endptr = (char *)s;
+  80192a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80192e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801932:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801935:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801939:	74 09                	je     801944 <strtol+0x18b>
+  80193b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80193f:	48 f7 d8             	neg    %rax
+  801942:	eb 04                	jmp    801948 <strtol+0x18f>
+  801944:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801948:	c9                   	leave
+  801949:	c3                   	ret
+
+000000000080194a <strstr>:
+
+char *strstr(const char *in, const char *str)
+{
+  80194a:	55                   	push   %rbp
+  80194b:	48 89 e5             	mov    %rsp,%rbp
+  80194e:	48 83 ec 30          	sub    $0x30,%rsp
+  801952:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801956:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  80195a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80195e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801962:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801966:	0f b6 00             	movzbl (%rax),%eax
+  801969:	88 45 ff             	mov    %al,-0x1(%rbp)
+	if (!c)
+  80196c:	80 7d ff 00          	cmpb   $0x0,-0x1(%rbp)
+  801970:	75 06                	jne    801978 <strstr+0x2e>
+		return (char *)in; // Trivial empty string case
+  801972:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801976:	eb 6b                	jmp    8019e3 <strstr+0x99>
+
+	len = strlen(str);
+  801978:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80197c:	48 89 c7             	mov    %rax,%rdi
+  80197f:	48 b8 ef 0e 80 00 00 	movabs $0x800eef,%rax
+  801986:	00 00 00 
+  801989:	ff d0                	call   *%rax
+  80198b:	48 98                	cltq
+  80198d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+		char sc;
+
+		do
+		{
+			sc = *in++;
+  801991:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801995:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801999:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80199d:	0f b6 00             	movzbl (%rax),%eax
+  8019a0:	88 45 ef             	mov    %al,-0x11(%rbp)
+			if (!sc)
+  8019a3:	80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+  8019a7:	75 07                	jne    8019b0 <strstr+0x66>
+				return (char *)0;
+  8019a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ae:	eb 33                	jmp    8019e3 <strstr+0x99>
+		} while (sc != c);
+  8019b0:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+  8019b4:	3a 45 ff             	cmp    -0x1(%rbp),%al
+  8019b7:	75 d8                	jne    801991 <strstr+0x47>
+	} while (strncmp(in, str, len) != 0);
+  8019b9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8019bd:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8019c1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019c5:	48 89 ce             	mov    %rcx,%rsi
+  8019c8:	48 89 c7             	mov    %rax,%rdi
+  8019cb:	48 b8 0a 11 80 00 00 	movabs $0x80110a,%rax
+  8019d2:	00 00 00 
+  8019d5:	ff d0                	call   *%rax
+  8019d7:	85 c0                	test   %eax,%eax
+  8019d9:	75 b6                	jne    801991 <strstr+0x47>
+
+	return (char *)(in - 1);
+  8019db:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019df:	48 83 e8 01          	sub    $0x1,%rax
+}
+  8019e3:	c9                   	leave
+  8019e4:	c3                   	ret
+
+00000000008019e5 <syscall>:
+ * 用户的指令式系统调用，该函数将系统调用序号放入eax寄存器，五个参数依次放入edx, ecx, ebx, edi, esi，然后执行指令int 0x30，
+ * 发生中断后，去IDT中查找中断处理函数，最终会走到kern/trap.c的trap_dispatch()中
+ */
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  8019e5:	55                   	push   %rbp
+  8019e6:	48 89 e5             	mov    %rsp,%rbp
+  8019e9:	53                   	push   %rbx
+  8019ea:	48 83 ec 48          	sub    $0x48,%rsp
+  8019ee:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8019f1:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8019f4:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8019f8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8019fc:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801a00:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	 * volatile 告诉汇编程序不要因为不使用返回值就优化该指令
+	 * 最后一个子句告诉汇编程序，指令可能会改变条件代码cx和任意内存memory位置
+	 * 由汇编编译器做好数据保存和恢复工作(栈)
+	 */
+
+	asm volatile("int %1\n"			// code: int T_SYSCALL
+  801a04:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801a07:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801a0b:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a0f:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801a13:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801a17:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801a1b:	4c 89 c3             	mov    %r8,%rbx
+  801a1e:	cd 30                	int    $0x30
+  801a20:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+				   "D"(a4),			// edi = a4
+				   "S"(a5)			// esi = a5
+				 : "cc", "memory"); // 指令可能会改变条件代码cx和任意内存memory位置
+									// 由汇编编译器做好数据保存和恢复工作(栈)
+
+	if (check && ret > 0)
+  801a24:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801a28:	74 44                	je     801a6e <syscall+0x89>
+  801a2a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801a2f:	7e 3d                	jle    801a6e <syscall+0x89>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a31:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a35:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801a38:	49 89 d0             	mov    %rdx,%r8
+  801a3b:	89 c1                	mov    %eax,%ecx
+  801a3d:	48 b8 c8 47 80 00 00 	movabs $0x8047c8,%rax
+  801a44:	00 00 00 
+  801a47:	48 89 c2             	mov    %rax,%rdx
+  801a4a:	be 34 00 00 00       	mov    $0x34,%esi
+  801a4f:	48 b8 e5 47 80 00 00 	movabs $0x8047e5,%rax
+  801a56:	00 00 00 
+  801a59:	48 89 c7             	mov    %rax,%rdi
+  801a5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a61:	49 b9 0c 2d 80 00 00 	movabs $0x802d0c,%r9
+  801a68:	00 00 00 
+  801a6b:	41 ff d1             	call   *%r9
+
+	return ret;
+  801a6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801a72:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a76:	c9                   	leave
+  801a77:	c3                   	ret
+
+0000000000801a78 <sys_cputs>:
+
+void sys_cputs(const char *s, size_t len)
+{
+  801a78:	55                   	push   %rbp
+  801a79:	48 89 e5             	mov    %rsp,%rbp
+  801a7c:	48 83 ec 10          	sub    $0x10,%rsp
+  801a80:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a84:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 调用lib/syscall.c中的syscall()
+	// SYS_cputs: 系统调用序号(eax)，s: 需要输出的字符数组，len: 数组长度
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801a88:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a8c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a90:	48 83 ec 08          	sub    $0x8,%rsp
+  801a94:	6a 00                	push   $0x0
+  801a96:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801a9c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801aa2:	48 89 d1             	mov    %rdx,%rcx
+  801aa5:	48 89 c2             	mov    %rax,%rdx
+  801aa8:	be 00 00 00 00       	mov    $0x0,%esi
+  801aad:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ab2:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801ab9:	00 00 00 
+  801abc:	ff d0                	call   *%rax
+  801abe:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ac2:	90                   	nop
+  801ac3:	c9                   	leave
+  801ac4:	c3                   	ret
+
+0000000000801ac5 <sys_cgetc>:
+
+int sys_cgetc(void)
+{
+  801ac5:	55                   	push   %rbp
+  801ac6:	48 89 e5             	mov    %rsp,%rbp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801ac9:	48 83 ec 08          	sub    $0x8,%rsp
+  801acd:	6a 00                	push   $0x0
+  801acf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ad5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801adb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ae0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ae5:	be 00 00 00 00       	mov    $0x0,%esi
+  801aea:	bf 01 00 00 00       	mov    $0x1,%edi
+  801aef:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801af6:	00 00 00 
+  801af9:	ff d0                	call   *%rax
+  801afb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801aff:	c9                   	leave
+  801b00:	c3                   	ret
+
+0000000000801b01 <sys_env_destroy>:
+
+int sys_env_destroy(envid_t envid)
+{
+  801b01:	55                   	push   %rbp
+  801b02:	48 89 e5             	mov    %rsp,%rbp
+  801b05:	48 83 ec 10          	sub    $0x10,%rsp
+  801b09:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	// 销毁envid对应的环境
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801b0c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b0f:	48 98                	cltq
+  801b11:	48 83 ec 08          	sub    $0x8,%rsp
+  801b15:	6a 00                	push   $0x0
+  801b17:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b1d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b23:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b28:	48 89 c2             	mov    %rax,%rdx
+  801b2b:	be 01 00 00 00       	mov    $0x1,%esi
+  801b30:	bf 03 00 00 00       	mov    $0x3,%edi
+  801b35:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801b3c:	00 00 00 
+  801b3f:	ff d0                	call   *%rax
+  801b41:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801b45:	c9                   	leave
+  801b46:	c3                   	ret
+
+0000000000801b47 <sys_getprocid>:
+
+envid_t
+sys_getprocid(void)
+{
+  801b47:	55                   	push   %rbp
+  801b48:	48 89 e5             	mov    %rsp,%rbp
+	// 获取当前用户环境id
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801b4b:	48 83 ec 08          	sub    $0x8,%rsp
+  801b4f:	6a 00                	push   $0x0
+  801b51:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b57:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b5d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b62:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b67:	be 00 00 00 00       	mov    $0x0,%esi
+  801b6c:	bf 02 00 00 00       	mov    $0x2,%edi
+  801b71:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801b78:	00 00 00 
+  801b7b:	ff d0                	call   *%rax
+  801b7d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801b81:	c9                   	leave
+  801b82:	c3                   	ret
+
+0000000000801b83 <sys_yield>:
+
+void sys_yield(void)
+{
+  801b83:	55                   	push   %rbp
+  801b84:	48 89 e5             	mov    %rsp,%rbp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801b87:	48 83 ec 08          	sub    $0x8,%rsp
+  801b8b:	6a 00                	push   $0x0
+  801b8d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b93:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b99:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ba3:	be 00 00 00 00       	mov    $0x0,%esi
+  801ba8:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801bad:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801bb4:	00 00 00 
+  801bb7:	ff d0                	call   *%rax
+  801bb9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801bbd:	90                   	nop
+  801bbe:	c9                   	leave
+  801bbf:	c3                   	ret
+
+0000000000801bc0 <sys_page_alloc>:
+
+int sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801bc0:	55                   	push   %rbp
+  801bc1:	48 89 e5             	mov    %rsp,%rbp
+  801bc4:	48 83 ec 10          	sub    $0x10,%rsp
+  801bc8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801bcb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801bcf:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  801bd2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801bd5:	48 63 c8             	movslq %eax,%rcx
+  801bd8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801bdc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801bdf:	48 98                	cltq
+  801be1:	48 83 ec 08          	sub    $0x8,%rsp
+  801be5:	6a 00                	push   $0x0
+  801be7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801bed:	49 89 c8             	mov    %rcx,%r8
+  801bf0:	48 89 d1             	mov    %rdx,%rcx
+  801bf3:	48 89 c2             	mov    %rax,%rdx
+  801bf6:	be 01 00 00 00       	mov    $0x1,%esi
+  801bfb:	bf 04 00 00 00       	mov    $0x4,%edi
+  801c00:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801c07:	00 00 00 
+  801c0a:	ff d0                	call   *%rax
+  801c0c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c10:	c9                   	leave
+  801c11:	c3                   	ret
+
+0000000000801c12 <sys_page_map>:
+
+int sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801c12:	55                   	push   %rbp
+  801c13:	48 89 e5             	mov    %rsp,%rbp
+  801c16:	48 83 ec 20          	sub    $0x20,%rsp
+  801c1a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801c1d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801c21:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801c24:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801c28:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  801c2c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801c2f:	48 63 c8             	movslq %eax,%rcx
+  801c32:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  801c36:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801c39:	48 63 f0             	movslq %eax,%rsi
+  801c3c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c40:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801c43:	48 98                	cltq
+  801c45:	48 83 ec 08          	sub    $0x8,%rsp
+  801c49:	51                   	push   %rcx
+  801c4a:	49 89 f9             	mov    %rdi,%r9
+  801c4d:	49 89 f0             	mov    %rsi,%r8
+  801c50:	48 89 d1             	mov    %rdx,%rcx
+  801c53:	48 89 c2             	mov    %rax,%rdx
+  801c56:	be 01 00 00 00       	mov    $0x1,%esi
+  801c5b:	bf 05 00 00 00       	mov    $0x5,%edi
+  801c60:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801c67:	00 00 00 
+  801c6a:	ff d0                	call   *%rax
+  801c6c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c70:	c9                   	leave
+  801c71:	c3                   	ret
+
+0000000000801c72 <sys_page_unmap>:
+
+int sys_page_unmap(envid_t envid, void *va)
+{
+  801c72:	55                   	push   %rbp
+  801c73:	48 89 e5             	mov    %rsp,%rbp
+  801c76:	48 83 ec 10          	sub    $0x10,%rsp
+  801c7a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801c7d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  801c81:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c85:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801c88:	48 98                	cltq
+  801c8a:	48 83 ec 08          	sub    $0x8,%rsp
+  801c8e:	6a 00                	push   $0x0
+  801c90:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801c96:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c9c:	48 89 d1             	mov    %rdx,%rcx
+  801c9f:	48 89 c2             	mov    %rax,%rdx
+  801ca2:	be 01 00 00 00       	mov    $0x1,%esi
+  801ca7:	bf 06 00 00 00       	mov    $0x6,%edi
+  801cac:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801cb3:	00 00 00 
+  801cb6:	ff d0                	call   *%rax
+  801cb8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801cbc:	c9                   	leave
+  801cbd:	c3                   	ret
+
+0000000000801cbe <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int sys_env_set_status(envid_t envid, int status)
+{
+  801cbe:	55                   	push   %rbp
+  801cbf:	48 89 e5             	mov    %rsp,%rbp
+  801cc2:	48 83 ec 10          	sub    $0x10,%rsp
+  801cc6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801cc9:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801ccc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801ccf:	48 63 d0             	movslq %eax,%rdx
+  801cd2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801cd5:	48 98                	cltq
+  801cd7:	48 83 ec 08          	sub    $0x8,%rsp
+  801cdb:	6a 00                	push   $0x0
+  801cdd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ce3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ce9:	48 89 d1             	mov    %rdx,%rcx
+  801cec:	48 89 c2             	mov    %rax,%rdx
+  801cef:	be 01 00 00 00       	mov    $0x1,%esi
+  801cf4:	bf 08 00 00 00       	mov    $0x8,%edi
+  801cf9:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801d00:	00 00 00 
+  801d03:	ff d0                	call   *%rax
+  801d05:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d09:	c9                   	leave
+  801d0a:	c3                   	ret
+
+0000000000801d0b <sys_env_set_trapframe>:
+
+int sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801d0b:	55                   	push   %rbp
+  801d0c:	48 89 e5             	mov    %rsp,%rbp
+  801d0f:	48 83 ec 10          	sub    $0x10,%rsp
+  801d13:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801d16:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  801d1a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d1e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d21:	48 98                	cltq
+  801d23:	48 83 ec 08          	sub    $0x8,%rsp
+  801d27:	6a 00                	push   $0x0
+  801d29:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d2f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d35:	48 89 d1             	mov    %rdx,%rcx
+  801d38:	48 89 c2             	mov    %rax,%rdx
+  801d3b:	be 01 00 00 00       	mov    $0x1,%esi
+  801d40:	bf 09 00 00 00       	mov    $0x9,%edi
+  801d45:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801d4c:	00 00 00 
+  801d4f:	ff d0                	call   *%rax
+  801d51:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d55:	c9                   	leave
+  801d56:	c3                   	ret
+
+0000000000801d57 <sys_env_set_pgfault_upcall>:
+
+int sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801d57:	55                   	push   %rbp
+  801d58:	48 89 e5             	mov    %rsp,%rbp
+  801d5b:	48 83 ec 10          	sub    $0x10,%rsp
+  801d5f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801d62:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  801d66:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d6a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d6d:	48 98                	cltq
+  801d6f:	48 83 ec 08          	sub    $0x8,%rsp
+  801d73:	6a 00                	push   $0x0
+  801d75:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d7b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d81:	48 89 d1             	mov    %rdx,%rcx
+  801d84:	48 89 c2             	mov    %rax,%rdx
+  801d87:	be 01 00 00 00       	mov    $0x1,%esi
+  801d8c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801d91:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801d98:	00 00 00 
+  801d9b:	ff d0                	call   *%rax
+  801d9d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801da1:	c9                   	leave
+  801da2:	c3                   	ret
+
+0000000000801da3 <sys_ipc_try_send>:
+
+int sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  801da3:	55                   	push   %rbp
+  801da4:	48 89 e5             	mov    %rsp,%rbp
+  801da7:	48 83 ec 20          	sub    $0x20,%rsp
+  801dab:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801dae:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801db2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801db6:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  801db9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801dbc:	48 63 f0             	movslq %eax,%rsi
+  801dbf:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801dc3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801dc6:	48 98                	cltq
+  801dc8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801dcc:	48 83 ec 08          	sub    $0x8,%rsp
+  801dd0:	6a 00                	push   $0x0
+  801dd2:	49 89 f1             	mov    %rsi,%r9
+  801dd5:	49 89 c8             	mov    %rcx,%r8
+  801dd8:	48 89 d1             	mov    %rdx,%rcx
+  801ddb:	48 89 c2             	mov    %rax,%rdx
+  801dde:	be 00 00 00 00       	mov    $0x0,%esi
+  801de3:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801de8:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801def:	00 00 00 
+  801df2:	ff d0                	call   *%rax
+  801df4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801df8:	c9                   	leave
+  801df9:	c3                   	ret
+
+0000000000801dfa <sys_ipc_recv>:
+
+int sys_ipc_recv(void *dstva)
+{
+  801dfa:	55                   	push   %rbp
+  801dfb:	48 89 e5             	mov    %rsp,%rbp
+  801dfe:	48 83 ec 10          	sub    $0x10,%rsp
+  801e02:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  801e06:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e0a:	48 83 ec 08          	sub    $0x8,%rsp
+  801e0e:	6a 00                	push   $0x0
+  801e10:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e16:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e1c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e21:	48 89 c2             	mov    %rax,%rdx
+  801e24:	be 01 00 00 00       	mov    $0x1,%esi
+  801e29:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801e2e:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801e35:	00 00 00 
+  801e38:	ff d0                	call   *%rax
+  801e3a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e3e:	c9                   	leave
+  801e3f:	c3                   	ret
+
+0000000000801e40 <sys_disk_io>:
+
+int sys_disk_io(int dev, uint64_t secno, void *va, size_t nsecs, int write)
+{
+  801e40:	55                   	push   %rbp
+  801e41:	48 89 e5             	mov    %rsp,%rbp
+  801e44:	48 83 ec 20          	sub    $0x20,%rsp
+  801e48:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e4b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801e4f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801e53:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  801e57:	44 89 45 f8          	mov    %r8d,-0x8(%rbp)
+	return syscall(SYS_disk_io, 0, dev, secno, (uint64_t)va, nsecs, write);
+  801e5b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801e5e:	48 63 c8             	movslq %eax,%rcx
+  801e61:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  801e65:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e68:	48 98                	cltq
+  801e6a:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  801e6e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e72:	48 83 ec 08          	sub    $0x8,%rsp
+  801e76:	51                   	push   %rcx
+  801e77:	49 89 f9             	mov    %rdi,%r9
+  801e7a:	49 89 f0             	mov    %rsi,%r8
+  801e7d:	48 89 d1             	mov    %rdx,%rcx
+  801e80:	48 89 c2             	mov    %rax,%rdx
+  801e83:	be 00 00 00 00       	mov    $0x0,%esi
+  801e88:	bf 0e 00 00 00       	mov    $0xe,%edi
+  801e8d:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801e94:	00 00 00 
+  801e97:	ff d0                	call   *%rax
+  801e99:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e9d:	c9                   	leave
+  801e9e:	c3                   	ret
+
+0000000000801e9f <sys_vma_alloc>:
+
+int sys_vma_alloc(envid_t envid, void *va, size_t len, int perm)
+{
+  801e9f:	55                   	push   %rbp
+  801ea0:	48 89 e5             	mov    %rsp,%rbp
+  801ea3:	48 83 ec 20          	sub    $0x20,%rsp
+  801ea7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801eaa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801eae:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801eb2:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_vma_alloc, 1, envid, (uint64_t)va, len, perm, 0);
+  801eb5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801eb8:	48 63 f0             	movslq %eax,%rsi
+  801ebb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801ebf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ec2:	48 98                	cltq
+  801ec4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801ec8:	48 83 ec 08          	sub    $0x8,%rsp
+  801ecc:	6a 00                	push   $0x0
+  801ece:	49 89 f1             	mov    %rsi,%r9
+  801ed1:	49 89 c8             	mov    %rcx,%r8
+  801ed4:	48 89 d1             	mov    %rdx,%rcx
+  801ed7:	48 89 c2             	mov    %rax,%rdx
+  801eda:	be 01 00 00 00       	mov    $0x1,%esi
+  801edf:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801ee4:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801eeb:	00 00 00 
+  801eee:	ff d0                	call   *%rax
+  801ef0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ef4:	c9                   	leave
+  801ef5:	c3                   	ret
+
+0000000000801ef6 <sys_vma_clear>:
+
+int sys_vma_clear(envid_t envid)
+{
+  801ef6:	55                   	push   %rbp
+  801ef7:	48 89 e5             	mov    %rsp,%rbp
+  801efa:	48 83 ec 10          	sub    $0x10,%rsp
+  801efe:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_vma_clear, 1, envid, 0, 0, 0, 0);
+  801f01:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f04:	48 98                	cltq
+  801f06:	48 83 ec 08          	sub    $0x8,%rsp
+  801f0a:	6a 00                	push   $0x0
+  801f0c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f12:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f18:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f1d:	48 89 c2             	mov    %rax,%rdx
+  801f20:	be 01 00 00 00       	mov    $0x1,%esi
+  801f25:	bf 10 00 00 00       	mov    $0x10,%edi
+  801f2a:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801f31:	00 00 00 
+  801f34:	ff d0                	call   *%rax
+  801f36:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f3a:	c9                   	leave
+  801f3b:	c3                   	ret
+
+0000000000801f3c <sys_trace_ctl>:
+
+int sys_trace_ctl(int enable)
+{
+  801f3c:	55                   	push   %rbp
+  801f3d:	48 89 e5             	mov    %rsp,%rbp
+  801f40:	48 83 ec 10          	sub    $0x10,%rsp
+  801f44:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_trace_ctl, 0, enable, 0, 0, 0, 0);
+  801f47:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f4a:	48 98                	cltq
+  801f4c:	48 83 ec 08          	sub    $0x8,%rsp
+  801f50:	6a 00                	push   $0x0
+  801f52:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f58:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f63:	48 89 c2             	mov    %rax,%rdx
+  801f66:	be 00 00 00 00       	mov    $0x0,%esi
+  801f6b:	bf 11 00 00 00       	mov    $0x11,%edi
+  801f70:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801f77:	00 00 00 
+  801f7a:	ff d0                	call   *%rax
+  801f7c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f80:	c9                   	leave
+  801f81:	c3                   	ret
+
+0000000000801f82 <sys_trace_read>:
+
+int sys_trace_read(int cpu, uint64_t *seq, struct TraceEvent *buf, int n)
+{
+  801f82:	55                   	push   %rbp
+  801f83:	48 89 e5             	mov    %rsp,%rbp
+  801f86:	48 83 ec 20          	sub    $0x20,%rsp
+  801f8a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f8d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f91:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801f95:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_trace_read, 0, cpu, (uint64_t)seq, (uint64_t)buf, n, 0);
+  801f98:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801f9b:	48 63 f0             	movslq %eax,%rsi
+  801f9e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801fa2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801fa6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fa9:	48 98                	cltq
+  801fab:	48 83 ec 08          	sub    $0x8,%rsp
+  801faf:	6a 00                	push   $0x0
+  801fb1:	49 89 f1             	mov    %rsi,%r9
+  801fb4:	49 89 c8             	mov    %rcx,%r8
+  801fb7:	48 89 d1             	mov    %rdx,%rcx
+  801fba:	48 89 c2             	mov    %rax,%rdx
+  801fbd:	be 00 00 00 00       	mov    $0x0,%esi
+  801fc2:	bf 12 00 00 00       	mov    $0x12,%edi
+  801fc7:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801fce:	00 00 00 
+  801fd1:	ff d0                	call   *%rax
+  801fd3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fd7:	c9                   	leave
+  801fd8:	c3                   	ret
+
+0000000000801fd9 <sys_getrusage>:
+
+int sys_getrusage(envid_t envid, struct Rusage *ru)
+{
+  801fd9:	55                   	push   %rbp
+  801fda:	48 89 e5             	mov    %rsp,%rbp
+  801fdd:	48 83 ec 10          	sub    $0x10,%rsp
+  801fe1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801fe4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_getrusage, 0, envid, (uint64_t)ru, 0, 0, 0);
+  801fe8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801fec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fef:	48 98                	cltq
+  801ff1:	48 83 ec 08          	sub    $0x8,%rsp
+  801ff5:	6a 00                	push   $0x0
+  801ff7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ffd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802003:	48 89 d1             	mov    %rdx,%rcx
+  802006:	48 89 c2             	mov    %rax,%rdx
+  802009:	be 00 00 00 00       	mov    $0x0,%esi
+  80200e:	bf 13 00 00 00       	mov    $0x13,%edi
+  802013:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  80201a:	00 00 00 
+  80201d:	ff d0                	call   *%rax
+  80201f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802023:	c9                   	leave
+  802024:	c3                   	ret
+
+0000000000802025 <sys_pmu_config>:
+
+int sys_pmu_config(int idx, uint64_t event)
+{
+  802025:	55                   	push   %rbp
+  802026:	48 89 e5             	mov    %rsp,%rbp
+  802029:	48 83 ec 10          	sub    $0x10,%rsp
+  80202d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802030:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_pmu_config, 0, idx, event, 0, 0, 0);
+  802034:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802037:	48 98                	cltq
+  802039:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80203d:	48 83 ec 08          	sub    $0x8,%rsp
+  802041:	6a 00                	push   $0x0
+  802043:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802049:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80204f:	48 89 d1             	mov    %rdx,%rcx
+  802052:	48 89 c2             	mov    %rax,%rdx
+  802055:	be 00 00 00 00       	mov    $0x0,%esi
+  80205a:	bf 14 00 00 00       	mov    $0x14,%edi
+  80205f:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  802066:	00 00 00 
+  802069:	ff d0                	call   *%rax
+  80206b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80206f:	c9                   	leave
+  802070:	c3                   	ret
+
+0000000000802071 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  802071:	55                   	push   %rbp
+  802072:	48 89 e5             	mov    %rsp,%rbp
+  802075:	48 83 ec 10          	sub    $0x10,%rsp
+  802079:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+  80207c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80207f:	48 83 ec 08          	sub    $0x8,%rsp
+  802083:	6a 00                	push   $0x0
+  802085:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80208b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802091:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802096:	48 89 c2             	mov    %rax,%rdx
+  802099:	be 00 00 00 00       	mov    $0x0,%esi
+  80209e:	bf 15 00 00 00       	mov    $0x15,%edi
+  8020a3:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  8020aa:	00 00 00 
+  8020ad:	ff d0                	call   *%rax
+  8020af:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020b3:	c9                   	leave
+  8020b4:	c3                   	ret
+
+00000000008020b5 <sys_image_attach>:
+
+int sys_image_attach(envid_t envid, int dev, const uint64_t *secnos, size_t size)
+{
+  8020b5:	55                   	push   %rbp
+  8020b6:	48 89 e5             	mov    %rsp,%rbp
+  8020b9:	48 83 ec 20          	sub    $0x20,%rsp
+  8020bd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020c0:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  8020c3:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8020c7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+	return syscall(SYS_image_attach, 1, envid, dev, (uint64_t)secnos, size, 0);
+  8020cb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8020cf:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8020d2:	48 63 d0             	movslq %eax,%rdx
+  8020d5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020d8:	48 98                	cltq
+  8020da:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8020de:	48 83 ec 08          	sub    $0x8,%rsp
+  8020e2:	6a 00                	push   $0x0
+  8020e4:	49 89 f1             	mov    %rsi,%r9
+  8020e7:	49 89 c8             	mov    %rcx,%r8
+  8020ea:	48 89 d1             	mov    %rdx,%rcx
+  8020ed:	48 89 c2             	mov    %rax,%rdx
+  8020f0:	be 01 00 00 00       	mov    $0x1,%esi
+  8020f5:	bf 16 00 00 00       	mov    $0x16,%edi
+  8020fa:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  802101:	00 00 00 
+  802104:	ff d0                	call   *%rax
+  802106:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80210a:	c9                   	leave
+  80210b:	c3                   	ret
+
+000000000080210c <sys_vma_binary>:
+
+int sys_vma_binary(envid_t envid, const struct Proghdr *ph)
+{
+  80210c:	55                   	push   %rbp
+  80210d:	48 89 e5             	mov    %rsp,%rbp
+  802110:	48 83 ec 10          	sub    $0x10,%rsp
+  802114:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802117:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_vma_binary, 1, envid, (uint64_t)ph, 0, 0, 0);
+  80211b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80211f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802122:	48 98                	cltq
+  802124:	48 83 ec 08          	sub    $0x8,%rsp
+  802128:	6a 00                	push   $0x0
+  80212a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802130:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802136:	48 89 d1             	mov    %rdx,%rcx
+  802139:	48 89 c2             	mov    %rax,%rdx
+  80213c:	be 01 00 00 00       	mov    $0x1,%esi
+  802141:	bf 17 00 00 00       	mov    $0x17,%edi
+  802146:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  80214d:	00 00 00 
+  802150:	ff d0                	call   *%rax
+  802152:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802156:	c9                   	leave
+  802157:	c3                   	ret
+
+0000000000802158 <spawn>:
+ * 4.与子环境共享 PTE_SHARE 的页(打开的文件描述符)，设置寄存器并标记为 ENV_RUNNABLE
+ * 成功返回子环境的 envid，错误返回 < 0
+ */
+envid_t
+spawn(const char *prog, const char **argv)
+{
+  802158:	55                   	push   %rbp
+  802159:	48 89 e5             	mov    %rsp,%rbp
+  80215c:	53                   	push   %rbx
+  80215d:	48 81 ec 18 03 00 00 	sub    $0x318,%rsp
+  802164:	48 89 bd e8 fc ff ff 	mov    %rdi,-0x318(%rbp)
+  80216b:	48 89 b5 e0 fc ff ff 	mov    %rsi,-0x320(%rbp)
+	uint8_t elf_buf[ELFHDRSIZE];
+	struct Elf *elf = (struct Elf *)elf_buf;
+  802172:	48 8d 85 c0 fd ff ff 	lea    -0x240(%rbp),%rax
+  802179:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	struct Trapframe child_tf;
+	uintptr_t rsp;
+	envid_t child;
+	int fd, i, r;
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  80217d:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  802184:	be 00 00 00 00       	mov    $0x0,%esi
+  802189:	48 89 c7             	mov    %rax,%rdi
+  80218c:	48 b8 b4 38 80 00 00 	movabs $0x8038b4,%rax
+  802193:	00 00 00 
+  802196:	ff d0                	call   *%rax
+  802198:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  80219b:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80219f:	79 08                	jns    8021a9 <spawn+0x51>
+		return r;
+  8021a1:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8021a4:	e9 5e 04 00 00       	jmp    802607 <spawn+0x4af>
+	fd = r;
+  8021a9:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8021ac:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+
+	// 读取 ELF 头部，程序头表必须也在其中
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf) ||
+  8021af:	48 8d 8d c0 fd ff ff 	lea    -0x240(%rbp),%rcx
+  8021b6:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8021b9:	ba 00 02 00 00       	mov    $0x200,%edx
+  8021be:	48 89 ce             	mov    %rcx,%rsi
+  8021c1:	89 c7                	mov    %eax,%edi
+  8021c3:	48 b8 a8 34 80 00 00 	movabs $0x8034a8,%rax
+  8021ca:	00 00 00 
+  8021cd:	ff d0                	call   *%rax
+  8021cf:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8021d4:	75 39                	jne    80220f <spawn+0xb7>
+		elf->e_magic != ELF_MAGIC ||
+  8021d6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021da:	8b 00                	mov    (%rax),%eax
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf) ||
+  8021dc:	3d 7f 45 4c 46       	cmp    $0x464c457f,%eax
+  8021e1:	75 2c                	jne    80220f <spawn+0xb7>
+		elf->e_phoff + elf->e_phnum * sizeof(struct Proghdr) > sizeof(elf_buf))
+  8021e3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021e7:	48 8b 48 20          	mov    0x20(%rax),%rcx
+  8021eb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021ef:	0f b7 40 38          	movzwl 0x38(%rax),%eax
+  8021f3:	0f b7 d0             	movzwl %ax,%edx
+  8021f6:	48 89 d0             	mov    %rdx,%rax
+  8021f9:	48 c1 e0 03          	shl    $0x3,%rax
+  8021fd:	48 29 d0             	sub    %rdx,%rax
+  802200:	48 c1 e0 03          	shl    $0x3,%rax
+  802204:	48 01 c8             	add    %rcx,%rax
+		elf->e_magic != ELF_MAGIC ||
+  802207:	48 3d 00 02 00 00    	cmp    $0x200,%rax
+  80220d:	76 43                	jbe    802252 <spawn+0xfa>
+	{
+		close(fd);
+  80220f:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802212:	89 c7                	mov    %eax,%edi
+  802214:	48 b8 fb 30 80 00 00 	movabs $0x8030fb,%rax
+  80221b:	00 00 00 
+  80221e:	ff d0                	call   *%rax
+		cprintf("spawn: %s is not a valid ELF\n", prog);
+  802220:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  802227:	48 89 c6             	mov    %rax,%rsi
+  80222a:	48 b8 f8 47 80 00 00 	movabs $0x8047f8,%rax
+  802231:	00 00 00 
+  802234:	48 89 c7             	mov    %rax,%rdi
+  802237:	b8 00 00 00 00       	mov    $0x0,%eax
+  80223c:	48 ba d4 02 80 00 00 	movabs $0x8002d4,%rdx
+  802243:	00 00 00 
+  802246:	ff d2                	call   *%rdx
+		return -E_NOT_EXEC;
+  802248:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80224d:	e9 b5 03 00 00       	jmp    802607 <spawn+0x4af>
+// 必须内联.
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  802252:	b8 07 00 00 00       	mov    $0x7,%eax
+  802257:	cd 30                	int    $0x30
+  802259:	89 45 cc             	mov    %eax,-0x34(%rbp)
+					 : "=a"(ret)
+					 : "a"(SYS_exofork),
+					   "i"(T_SYSCALL));
+	return ret;
+  80225c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+	}
+
+	if ((r = sys_exofork()) < 0)
+  80225f:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  802262:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  802266:	79 19                	jns    802281 <spawn+0x129>
+	{
+		close(fd);
+  802268:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80226b:	89 c7                	mov    %eax,%edi
+  80226d:	48 b8 fb 30 80 00 00 	movabs $0x8030fb,%rax
+  802274:	00 00 00 
+  802277:	ff d0                	call   *%rax
+		return r;
+  802279:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80227c:	e9 86 03 00 00       	jmp    802607 <spawn+0x4af>
+	}
+	child = r;
+  802281:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  802284:	89 45 d0             	mov    %eax,-0x30(%rbp)
+
+	// 子环境继承了父环境的 VMA，装入新程序之前清空
+	if ((r = sys_vma_clear(child)) < 0 || (r = fexec(fd, child)) < 0)
+  802287:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  80228a:	89 c7                	mov    %eax,%edi
+  80228c:	48 b8 f6 1e 80 00 00 	movabs $0x801ef6,%rax
+  802293:	00 00 00 
+  802296:	ff d0                	call   *%rax
+  802298:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  80229b:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80229f:	0f 88 30 03 00 00    	js     8025d5 <spawn+0x47d>
+  8022a5:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  8022a8:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8022ab:	89 d6                	mov    %edx,%esi
+  8022ad:	89 c7                	mov    %eax,%edi
+  8022af:	48 b8 91 39 80 00 00 	movabs $0x803991,%rax
+  8022b6:	00 00 00 
+  8022b9:	ff d0                	call   *%rax
+  8022bb:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  8022be:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8022c2:	0f 88 0d 03 00 00    	js     8025d5 <spawn+0x47d>
+		goto error;
+
+	child_tf = procs[ENVX(child)].env_tf;
+  8022c8:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  8022cb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8022d0:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  8022d7:	00 00 00 
+  8022da:	48 98                	cltq
+  8022dc:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  8022e3:	48 01 d0             	add    %rdx,%rax
+  8022e6:	48 8b 08             	mov    (%rax),%rcx
+  8022e9:	48 8b 58 08          	mov    0x8(%rax),%rbx
+  8022ed:	48 89 8d 00 fd ff ff 	mov    %rcx,-0x300(%rbp)
+  8022f4:	48 89 9d 08 fd ff ff 	mov    %rbx,-0x2f8(%rbp)
+  8022fb:	48 8b 48 10          	mov    0x10(%rax),%rcx
+  8022ff:	48 8b 58 18          	mov    0x18(%rax),%rbx
+  802303:	48 89 8d 10 fd ff ff 	mov    %rcx,-0x2f0(%rbp)
+  80230a:	48 89 9d 18 fd ff ff 	mov    %rbx,-0x2e8(%rbp)
+  802311:	48 8b 48 20          	mov    0x20(%rax),%rcx
+  802315:	48 8b 58 28          	mov    0x28(%rax),%rbx
+  802319:	48 89 8d 20 fd ff ff 	mov    %rcx,-0x2e0(%rbp)
+  802320:	48 89 9d 28 fd ff ff 	mov    %rbx,-0x2d8(%rbp)
+  802327:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  80232b:	48 8b 58 38          	mov    0x38(%rax),%rbx
+  80232f:	48 89 8d 30 fd ff ff 	mov    %rcx,-0x2d0(%rbp)
+  802336:	48 89 9d 38 fd ff ff 	mov    %rbx,-0x2c8(%rbp)
+  80233d:	48 8b 48 40          	mov    0x40(%rax),%rcx
+  802341:	48 8b 58 48          	mov    0x48(%rax),%rbx
+  802345:	48 89 8d 40 fd ff ff 	mov    %rcx,-0x2c0(%rbp)
+  80234c:	48 89 9d 48 fd ff ff 	mov    %rbx,-0x2b8(%rbp)
+  802353:	48 8b 48 50          	mov    0x50(%rax),%rcx
+  802357:	48 8b 58 58          	mov    0x58(%rax),%rbx
+  80235b:	48 89 8d 50 fd ff ff 	mov    %rcx,-0x2b0(%rbp)
+  802362:	48 89 9d 58 fd ff ff 	mov    %rbx,-0x2a8(%rbp)
+  802369:	48 8b 48 60          	mov    0x60(%rax),%rcx
+  80236d:	48 8b 58 68          	mov    0x68(%rax),%rbx
+  802371:	48 89 8d 60 fd ff ff 	mov    %rcx,-0x2a0(%rbp)
+  802378:	48 89 9d 68 fd ff ff 	mov    %rbx,-0x298(%rbp)
+  80237f:	48 8b 48 70          	mov    0x70(%rax),%rcx
+  802383:	48 8b 58 78          	mov    0x78(%rax),%rbx
+  802387:	48 89 8d 70 fd ff ff 	mov    %rcx,-0x290(%rbp)
+  80238e:	48 89 9d 78 fd ff ff 	mov    %rbx,-0x288(%rbp)
+  802395:	48 8b 88 80 00 00 00 	mov    0x80(%rax),%rcx
+  80239c:	48 8b 98 88 00 00 00 	mov    0x88(%rax),%rbx
+  8023a3:	48 89 8d 80 fd ff ff 	mov    %rcx,-0x280(%rbp)
+  8023aa:	48 89 9d 88 fd ff ff 	mov    %rbx,-0x278(%rbp)
+  8023b1:	48 8b 88 90 00 00 00 	mov    0x90(%rax),%rcx
+  8023b8:	48 8b 98 98 00 00 00 	mov    0x98(%rax),%rbx
+  8023bf:	48 89 8d 90 fd ff ff 	mov    %rcx,-0x270(%rbp)
+  8023c6:	48 89 9d 98 fd ff ff 	mov    %rbx,-0x268(%rbp)
+  8023cd:	48 8b 88 a0 00 00 00 	mov    0xa0(%rax),%rcx
+  8023d4:	48 8b 98 a8 00 00 00 	mov    0xa8(%rax),%rbx
+  8023db:	48 89 8d a0 fd ff ff 	mov    %rcx,-0x260(%rbp)
+  8023e2:	48 89 9d a8 fd ff ff 	mov    %rbx,-0x258(%rbp)
+  8023e9:	48 8b 90 b8 00 00 00 	mov    0xb8(%rax),%rdx
+  8023f0:	48 8b 80 b0 00 00 00 	mov    0xb0(%rax),%rax
+  8023f7:	48 89 85 b0 fd ff ff 	mov    %rax,-0x250(%rbp)
+  8023fe:	48 89 95 b8 fd ff ff 	mov    %rdx,-0x248(%rbp)
+	child_tf.tf_rip = elf->e_entry;
+  802405:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802409:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80240d:	48 89 85 98 fd ff ff 	mov    %rax,-0x268(%rbp)
+	if ((r = init_stack(child, argv, &rsp)) < 0)
+  802414:	48 8d 95 f8 fc ff ff 	lea    -0x308(%rbp),%rdx
+  80241b:	48 8b 8d e0 fc ff ff 	mov    -0x320(%rbp),%rcx
+  802422:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  802425:	48 89 ce             	mov    %rcx,%rsi
+  802428:	89 c7                	mov    %eax,%edi
+  80242a:	48 b8 6f 28 80 00 00 	movabs $0x80286f,%rax
+  802431:	00 00 00 
+  802434:	ff d0                	call   *%rax
+  802436:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  802439:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80243d:	0f 88 95 01 00 00    	js     8025d8 <spawn+0x480>
+		goto error;
+	child_tf.tf_rsp = rsp;
+  802443:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  80244a:	48 89 85 b0 fd ff ff 	mov    %rax,-0x250(%rbp)
+
+	ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  802451:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802455:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802459:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  802460:	48 01 d0             	add    %rdx,%rax
+  802463:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	for (i = 0; i < elf->e_phnum; i++, ph++)
+  802467:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+  80246e:	eb 39                	jmp    8024a9 <spawn+0x351>
+		if (ph->p_type == ELF_PROG_LOAD && (r = map_segment(child, ph)) < 0)
+  802470:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802474:	8b 00                	mov    (%rax),%eax
+  802476:	83 f8 01             	cmp    $0x1,%eax
+  802479:	75 25                	jne    8024a0 <spawn+0x348>
+  80247b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80247f:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  802482:	48 89 d6             	mov    %rdx,%rsi
+  802485:	89 c7                	mov    %eax,%edi
+  802487:	48 b8 2a 2b 80 00 00 	movabs $0x802b2a,%rax
+  80248e:	00 00 00 
+  802491:	ff d0                	call   *%rax
+  802493:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  802496:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80249a:	0f 88 3b 01 00 00    	js     8025db <spawn+0x483>
+	for (i = 0; i < elf->e_phnum; i++, ph++)
+  8024a0:	83 45 e4 01          	addl   $0x1,-0x1c(%rbp)
+  8024a4:	48 83 45 e8 38       	addq   $0x38,-0x18(%rbp)
+  8024a9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024ad:	0f b7 40 38          	movzwl 0x38(%rax),%eax
+  8024b1:	0f b7 c0             	movzwl %ax,%eax
+  8024b4:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+  8024b7:	7c b7                	jl     802470 <spawn+0x318>
+			goto error;
+	// 内核持有程序映像，之后改写程序文件时内核先为子环境保留旧的内容，不再需要 fd
+	close(fd);
+  8024b9:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8024bc:	89 c7                	mov    %eax,%edi
+  8024be:	48 b8 fb 30 80 00 00 	movabs $0x8030fb,%rax
+  8024c5:	00 00 00 
+  8024c8:	ff d0                	call   *%rax
+	fd = -1;
+  8024ca:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%rbp)
+
+	if ((r = copy_shared_pages(child)) < 0)
+  8024d1:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  8024d4:	89 c7                	mov    %eax,%edi
+  8024d6:	48 b8 8c 2b 80 00 00 	movabs $0x802b8c,%rax
+  8024dd:	00 00 00 
+  8024e0:	ff d0                	call   *%rax
+  8024e2:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  8024e5:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8024e9:	79 36                	jns    802521 <spawn+0x3c9>
+		panic("copy_shared_pages: %e", r);
+  8024eb:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8024ee:	89 c1                	mov    %eax,%ecx
+  8024f0:	48 b8 16 48 80 00 00 	movabs $0x804816,%rax
+  8024f7:	00 00 00 
+  8024fa:	48 89 c2             	mov    %rax,%rdx
+  8024fd:	be 4e 00 00 00       	mov    $0x4e,%esi
+  802502:	48 b8 2c 48 80 00 00 	movabs $0x80482c,%rax
+  802509:	00 00 00 
+  80250c:	48 89 c7             	mov    %rax,%rdi
+  80250f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802514:	49 b8 0c 2d 80 00 00 	movabs $0x802d0c,%r8
+  80251b:	00 00 00 
+  80251e:	41 ff d0             	call   *%r8
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802521:	48 8d 95 00 fd ff ff 	lea    -0x300(%rbp),%rdx
+  802528:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  80252b:	48 89 d6             	mov    %rdx,%rsi
+  80252e:	89 c7                	mov    %eax,%edi
+  802530:	48 b8 0b 1d 80 00 00 	movabs $0x801d0b,%rax
+  802537:	00 00 00 
+  80253a:	ff d0                	call   *%rax
+  80253c:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  80253f:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  802543:	79 36                	jns    80257b <spawn+0x423>
+		panic("sys_env_set_trapframe: %e", r);
+  802545:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  802548:	89 c1                	mov    %eax,%ecx
+  80254a:	48 b8 38 48 80 00 00 	movabs $0x804838,%rax
+  802551:	00 00 00 
+  802554:	48 89 c2             	mov    %rax,%rdx
+  802557:	be 50 00 00 00       	mov    $0x50,%esi
+  80255c:	48 b8 2c 48 80 00 00 	movabs $0x80482c,%rax
+  802563:	00 00 00 
+  802566:	48 89 c7             	mov    %rax,%rdi
+  802569:	b8 00 00 00 00       	mov    $0x0,%eax
+  80256e:	49 b8 0c 2d 80 00 00 	movabs $0x802d0c,%r8
+  802575:	00 00 00 
+  802578:	41 ff d0             	call   *%r8
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  80257b:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  80257e:	be 02 00 00 00       	mov    $0x2,%esi
+  802583:	89 c7                	mov    %eax,%edi
+  802585:	48 b8 be 1c 80 00 00 	movabs $0x801cbe,%rax
+  80258c:	00 00 00 
+  80258f:	ff d0                	call   *%rax
+  802591:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  802594:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  802598:	79 36                	jns    8025d0 <spawn+0x478>
+		panic("sys_env_set_status: %e", r);
+  80259a:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80259d:	89 c1                	mov    %eax,%ecx
+  80259f:	48 b8 52 48 80 00 00 	movabs $0x804852,%rax
+  8025a6:	00 00 00 
+  8025a9:	48 89 c2             	mov    %rax,%rdx
+  8025ac:	be 52 00 00 00       	mov    $0x52,%esi
+  8025b1:	48 b8 2c 48 80 00 00 	movabs $0x80482c,%rax
+  8025b8:	00 00 00 
+  8025bb:	48 89 c7             	mov    %rax,%rdi
+  8025be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025c3:	49 b8 0c 2d 80 00 00 	movabs $0x802d0c,%r8
+  8025ca:	00 00 00 
+  8025cd:	41 ff d0             	call   *%r8
+
+	return child;
+  8025d0:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  8025d3:	eb 32                	jmp    802607 <spawn+0x4af>
+		goto error;
+  8025d5:	90                   	nop
+  8025d6:	eb 04                	jmp    8025dc <spawn+0x484>
+		goto error;
+  8025d8:	90                   	nop
+  8025d9:	eb 01                	jmp    8025dc <spawn+0x484>
+			goto error;
+  8025db:	90                   	nop
+
+error:
+	sys_env_destroy(child);
+  8025dc:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  8025df:	89 c7                	mov    %eax,%edi
+  8025e1:	48 b8 01 1b 80 00 00 	movabs $0x801b01,%rax
+  8025e8:	00 00 00 
+  8025eb:	ff d0                	call   *%rax
+	if (fd >= 0)
+  8025ed:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8025f1:	78 11                	js     802604 <spawn+0x4ac>
+		close(fd);
+  8025f3:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8025f6:	89 c7                	mov    %eax,%edi
+  8025f8:	48 b8 fb 30 80 00 00 	movabs $0x8030fb,%rax
+  8025ff:	00 00 00 
+  802602:	ff d0                	call   *%rax
+	return r;
+  802604:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  802607:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80260b:	c9                   	leave
+  80260c:	c3                   	ret
+
+000000000080260d <spawnl>:
+/**
+ * 以可变参数调用 spawn，参数列表以 NULL 结尾
+ */
+envid_t
+spawnl(const char *prog, const char *arg0, ...)
+{
+  80260d:	55                   	push   %rbp
+  80260e:	48 89 e5             	mov    %rsp,%rbp
+  802611:	41 55                	push   %r13
+  802613:	41 54                	push   %r12
+  802615:	53                   	push   %rbx
+  802616:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80261d:	48 89 bd f8 fe ff ff 	mov    %rdi,-0x108(%rbp)
+  802624:	48 89 b5 f0 fe ff ff 	mov    %rsi,-0x110(%rbp)
+  80262b:	48 89 95 40 ff ff ff 	mov    %rdx,-0xc0(%rbp)
+  802632:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  802639:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  802640:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  802647:	84 c0                	test   %al,%al
+  802649:	74 26                	je     802671 <spawnl+0x64>
+  80264b:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  802652:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  802659:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  80265d:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  802661:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  802665:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  802669:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  80266d:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+  802671:	48 89 e0             	mov    %rsp,%rax
+  802674:	48 89 c3             	mov    %rax,%rbx
+	int argc = 0;
+  802677:	c7 85 2c ff ff ff 00 	movl   $0x0,-0xd4(%rbp)
+  80267e:	00 00 00 
+	va_list vl;
+
+	// 统计参数个数，然后在栈上构造 argv 数组
+	va_start(vl, arg0);
+  802681:	c7 85 00 ff ff ff 10 	movl   $0x10,-0x100(%rbp)
+  802688:	00 00 00 
+  80268b:	c7 85 04 ff ff ff 30 	movl   $0x30,-0xfc(%rbp)
+  802692:	00 00 00 
+  802695:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802699:	48 89 85 08 ff ff ff 	mov    %rax,-0xf8(%rbp)
+  8026a0:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8026a7:	48 89 85 10 ff ff ff 	mov    %rax,-0xf0(%rbp)
+	while (va_arg(vl, void *) != NULL)
+  8026ae:	eb 07                	jmp    8026b7 <spawnl+0xaa>
+		argc++;
+  8026b0:	83 85 2c ff ff ff 01 	addl   $0x1,-0xd4(%rbp)
+	while (va_arg(vl, void *) != NULL)
+  8026b7:	8b 85 00 ff ff ff    	mov    -0x100(%rbp),%eax
+  8026bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8026c0:	77 23                	ja     8026e5 <spawnl+0xd8>
+  8026c2:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+  8026c9:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  8026cf:	89 d2                	mov    %edx,%edx
+  8026d1:	48 01 d0             	add    %rdx,%rax
+  8026d4:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  8026da:	83 c2 08             	add    $0x8,%edx
+  8026dd:	89 95 00 ff ff ff    	mov    %edx,-0x100(%rbp)
+  8026e3:	eb 12                	jmp    8026f7 <spawnl+0xea>
+  8026e5:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8026ec:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8026f0:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  8026f7:	48 8b 00             	mov    (%rax),%rax
+  8026fa:	48 85 c0             	test   %rax,%rax
+  8026fd:	75 b1                	jne    8026b0 <spawnl+0xa3>
+	va_end(vl);
+
+	const char *argv[argc + 2];
+  8026ff:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  802705:	83 c0 02             	add    $0x2,%eax
+  802708:	48 63 d0             	movslq %eax,%rdx
+  80270b:	48 83 ea 01          	sub    $0x1,%rdx
+  80270f:	48 89 95 20 ff ff ff 	mov    %rdx,-0xe0(%rbp)
+  802716:	48 63 d0             	movslq %eax,%rdx
+  802719:	49 89 d4             	mov    %rdx,%r12
+  80271c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802722:	48 63 d0             	movslq %eax,%rdx
+  802725:	49 89 d2             	mov    %rdx,%r10
+  802728:	41 bb 00 00 00 00    	mov    $0x0,%r11d
+  80272e:	48 98                	cltq
+  802730:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802737:	00 
+  802738:	b8 10 00 00 00       	mov    $0x10,%eax
+  80273d:	48 83 e8 01          	sub    $0x1,%rax
+  802741:	48 01 d0             	add    %rdx,%rax
+  802744:	be 10 00 00 00       	mov    $0x10,%esi
+  802749:	ba 00 00 00 00       	mov    $0x0,%edx
+  80274e:	48 f7 f6             	div    %rsi
+  802751:	48 6b c0 10          	imul   $0x10,%rax,%rax
+  802755:	48 29 c4             	sub    %rax,%rsp
+  802758:	48 89 e0             	mov    %rsp,%rax
+  80275b:	48 83 c0 07          	add    $0x7,%rax
+  80275f:	48 c1 e8 03          	shr    $0x3,%rax
+  802763:	48 c1 e0 03          	shl    $0x3,%rax
+  802767:	48 89 85 18 ff ff ff 	mov    %rax,-0xe8(%rbp)
+	unsigned i;
+
+	argv[0] = arg0;
+  80276e:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  802775:	48 8b 95 f0 fe ff ff 	mov    -0x110(%rbp),%rdx
+  80277c:	48 89 10             	mov    %rdx,(%rax)
+	argv[argc + 1] = NULL;
+  80277f:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  802785:	8d 50 01             	lea    0x1(%rax),%edx
+  802788:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80278f:	48 63 d2             	movslq %edx,%rdx
+  802792:	48 c7 04 d0 00 00 00 	movq   $0x0,(%rax,%rdx,8)
+  802799:	00 
+	va_start(vl, arg0);
+  80279a:	c7 85 00 ff ff ff 10 	movl   $0x10,-0x100(%rbp)
+  8027a1:	00 00 00 
+  8027a4:	c7 85 04 ff ff ff 30 	movl   $0x30,-0xfc(%rbp)
+  8027ab:	00 00 00 
+  8027ae:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8027b2:	48 89 85 08 ff ff ff 	mov    %rax,-0xf8(%rbp)
+  8027b9:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8027c0:	48 89 85 10 ff ff ff 	mov    %rax,-0xf0(%rbp)
+	for (i = 0; i < argc; i++)
+  8027c7:	c7 85 28 ff ff ff 00 	movl   $0x0,-0xd8(%rbp)
+  8027ce:	00 00 00 
+  8027d1:	eb 60                	jmp    802833 <spawnl+0x226>
+		argv[i + 1] = va_arg(vl, const char *);
+  8027d3:	8b 85 28 ff ff ff    	mov    -0xd8(%rbp),%eax
+  8027d9:	8d 48 01             	lea    0x1(%rax),%ecx
+  8027dc:	8b 85 00 ff ff ff    	mov    -0x100(%rbp),%eax
+  8027e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8027e5:	77 23                	ja     80280a <spawnl+0x1fd>
+  8027e7:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+  8027ee:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  8027f4:	89 d2                	mov    %edx,%edx
+  8027f6:	48 01 d0             	add    %rdx,%rax
+  8027f9:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  8027ff:	83 c2 08             	add    $0x8,%edx
+  802802:	89 95 00 ff ff ff    	mov    %edx,-0x100(%rbp)
+  802808:	eb 12                	jmp    80281c <spawnl+0x20f>
+  80280a:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  802811:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  802815:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  80281c:	48 8b 10             	mov    (%rax),%rdx
+  80281f:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  802826:	89 c9                	mov    %ecx,%ecx
+  802828:	48 89 14 c8          	mov    %rdx,(%rax,%rcx,8)
+	for (i = 0; i < argc; i++)
+  80282c:	83 85 28 ff ff ff 01 	addl   $0x1,-0xd8(%rbp)
+  802833:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  802839:	39 85 28 ff ff ff    	cmp    %eax,-0xd8(%rbp)
+  80283f:	72 92                	jb     8027d3 <spawnl+0x1c6>
+	va_end(vl);
+	return spawn(prog, argv);
+  802841:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  802848:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  80284f:	48 89 d6             	mov    %rdx,%rsi
+  802852:	48 89 c7             	mov    %rax,%rdi
+  802855:	48 b8 58 21 80 00 00 	movabs $0x802158,%rax
+  80285c:	00 00 00 
+  80285f:	ff d0                	call   *%rax
+  802861:	48 89 dc             	mov    %rbx,%rsp
+}
+  802864:	48 8d 65 e8          	lea    -0x18(%rbp),%rsp
+  802868:	5b                   	pop    %rbx
+  802869:	41 5c                	pop    %r12
+  80286b:	41 5d                	pop    %r13
+  80286d:	5d                   	pop    %rbp
+  80286e:	c3                   	ret
+
+000000000080286f <init_stack>:
+ * 栈页之下再登记一页匿名区域，与内核创建的环境一样共有两页初始栈
+ * 成功时 *init_rsp 为子环境的初始 %rsp
+ */
+static int
+init_stack(envid_t child, const char **argv, uintptr_t *init_rsp)
+{
+  80286f:	55                   	push   %rbp
+  802870:	48 89 e5             	mov    %rsp,%rbp
+  802873:	48 83 ec 60          	sub    $0x60,%rsp
+  802877:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80287a:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  80287e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	size_t string_size;
+	int argc, i, r;
+	char *string_store;
+	uintptr_t *argv_store, *sp;
+
+	string_size = 0;
+  802882:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802889:	00 
+	for (argc = 0; argv[argc] != 0; argc++)
+  80288a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  802891:	eb 33                	jmp    8028c6 <init_stack+0x57>
+		string_size += strlen(argv[argc]) + 1;
+  802893:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802896:	48 98                	cltq
+  802898:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80289f:	00 
+  8028a0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8028a4:	48 01 d0             	add    %rdx,%rax
+  8028a7:	48 8b 00             	mov    (%rax),%rax
+  8028aa:	48 89 c7             	mov    %rax,%rdi
+  8028ad:	48 b8 ef 0e 80 00 00 	movabs $0x800eef,%rax
+  8028b4:	00 00 00 
+  8028b7:	ff d0                	call   *%rax
+  8028b9:	83 c0 01             	add    $0x1,%eax
+  8028bc:	48 98                	cltq
+  8028be:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+	for (argc = 0; argv[argc] != 0; argc++)
+  8028c2:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8028c6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8028c9:	48 98                	cltq
+  8028cb:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8028d2:	00 
+  8028d3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8028d7:	48 01 d0             	add    %rdx,%rax
+  8028da:	48 8b 00             	mov    (%rax),%rax
+  8028dd:	48 85 c0             	test   %rax,%rax
+  8028e0:	75 b1                	jne    802893 <init_stack+0x24>
+
+	string_store = (char *)UTEMP + PGSIZE - string_size;
+  8028e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028e6:	48 f7 d8             	neg    %rax
+  8028e9:	48 05 00 10 40 00    	add    $0x401000,%rax
+  8028ef:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	// call libmain 之前 %rsp 按16字节对齐
+	sp = (uintptr_t *)ROUNDDOWN((uintptr_t)string_store - sizeof(uintptr_t) * (argc + 3), 16);
+  8028f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8028f7:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8028fa:	83 c2 03             	add    $0x3,%edx
+  8028fd:	48 63 d2             	movslq %edx,%rdx
+  802900:	48 c1 e2 03          	shl    $0x3,%rdx
+  802904:	48 29 d0             	sub    %rdx,%rax
+  802907:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  80290b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80290f:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  802913:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	argv_store = sp + 2;
+  802917:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80291b:	48 83 c0 10          	add    $0x10,%rax
+  80291f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	if ((void *)sp < UTEMP)
+  802923:	48 81 7d d0 ff ff 3f 	cmpq   $0x3fffff,-0x30(%rbp)
+  80292a:	00 
+  80292b:	77 0a                	ja     802937 <init_stack+0xc8>
+		return -E_NO_MEM;
+  80292d:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802932:	e9 f1 01 00 00       	jmp    802b28 <init_stack+0x2b9>
+
+	if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  802937:	ba 07 00 00 00       	mov    $0x7,%edx
+  80293c:	be 00 00 40 00       	mov    $0x400000,%esi
+  802941:	bf 00 00 00 00       	mov    $0x0,%edi
+  802946:	48 b8 c0 1b 80 00 00 	movabs $0x801bc0,%rax
+  80294d:	00 00 00 
+  802950:	ff d0                	call   *%rax
+  802952:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802955:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802959:	79 08                	jns    802963 <init_stack+0xf4>
+		return r;
+  80295b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80295e:	e9 c5 01 00 00       	jmp    802b28 <init_stack+0x2b9>
+
+	for (i = 0; i < argc; i++)
+  802963:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  80296a:	e9 83 00 00 00       	jmp    8029f2 <init_stack+0x183>
+	{
+		argv_store[i] = UTEMP2USTACK(string_store);
+  80296f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802973:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802976:	48 98                	cltq
+  802978:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+  80297f:	00 
+  802980:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802984:	48 01 c8             	add    %rcx,%rax
+  802987:	b9 00 d0 3f ef       	mov    $0xef3fd000,%ecx
+  80298c:	48 01 ca             	add    %rcx,%rdx
+  80298f:	48 89 10             	mov    %rdx,(%rax)
+		strcpy(string_store, argv[i]);
+  802992:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802995:	48 98                	cltq
+  802997:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80299e:	00 
+  80299f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029a3:	48 01 d0             	add    %rdx,%rax
+  8029a6:	48 8b 10             	mov    (%rax),%rdx
+  8029a9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029ad:	48 89 d6             	mov    %rdx,%rsi
+  8029b0:	48 89 c7             	mov    %rax,%rdi
+  8029b3:	48 b8 5b 0f 80 00 00 	movabs $0x800f5b,%rax
+  8029ba:	00 00 00 
+  8029bd:	ff d0                	call   *%rax
+		string_store += strlen(argv[i]) + 1;
+  8029bf:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8029c2:	48 98                	cltq
+  8029c4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8029cb:	00 
+  8029cc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029d0:	48 01 d0             	add    %rdx,%rax
+  8029d3:	48 8b 00             	mov    (%rax),%rax
+  8029d6:	48 89 c7             	mov    %rax,%rdi
+  8029d9:	48 b8 ef 0e 80 00 00 	movabs $0x800eef,%rax
+  8029e0:	00 00 00 
+  8029e3:	ff d0                	call   *%rax
+  8029e5:	83 c0 01             	add    $0x1,%eax
+  8029e8:	48 98                	cltq
+  8029ea:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+	for (i = 0; i < argc; i++)
+  8029ee:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+  8029f2:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8029f5:	3b 45 f4             	cmp    -0xc(%rbp),%eax
+  8029f8:	0f 8c 71 ff ff ff    	jl     80296f <init_stack+0x100>
+	}
+	argv_store[argc] = 0;
+  8029fe:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802a01:	48 98                	cltq
+  802a03:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802a0a:	00 
+  802a0b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a0f:	48 01 d0             	add    %rdx,%rax
+  802a12:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	assert(string_store == (char *)UTEMP + PGSIZE);
+  802a19:	48 81 7d e0 00 10 40 	cmpq   $0x401000,-0x20(%rbp)
+  802a20:	00 
+  802a21:	74 3e                	je     802a61 <init_stack+0x1f2>
+  802a23:	48 b8 70 48 80 00 00 	movabs $0x804870,%rax
+  802a2a:	00 00 00 
+  802a2d:	48 89 c1             	mov    %rax,%rcx
+  802a30:	48 b8 97 48 80 00 00 	movabs $0x804897,%rax
+  802a37:	00 00 00 
+  802a3a:	48 89 c2             	mov    %rax,%rdx
+  802a3d:	be 9c 00 00 00       	mov    $0x9c,%esi
+  802a42:	48 b8 2c 48 80 00 00 	movabs $0x80482c,%rax
+  802a49:	00 00 00 
+  802a4c:	48 89 c7             	mov    %rax,%rdi
+  802a4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a54:	49 b8 0c 2d 80 00 00 	movabs $0x802d0c,%r8
+  802a5b:	00 00 00 
+  802a5e:	41 ff d0             	call   *%r8
+
+	sp[1] = UTEMP2USTACK(argv_store);
+  802a61:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802a65:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a69:	48 83 c0 08          	add    $0x8,%rax
+  802a6d:	b9 00 d0 3f ef       	mov    $0xef3fd000,%ecx
+  802a72:	48 01 ca             	add    %rcx,%rdx
+  802a75:	48 89 10             	mov    %rdx,(%rax)
+	sp[0] = argc;
+  802a78:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802a7b:	48 63 d0             	movslq %eax,%rdx
+  802a7e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a82:	48 89 10             	mov    %rdx,(%rax)
+	*init_rsp = UTEMP2USTACK(sp);
+  802a85:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a89:	ba 00 d0 3f ef       	mov    $0xef3fd000,%edx
+  802a8e:	48 01 c2             	add    %rax,%rdx
+  802a91:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802a95:	48 89 10             	mov    %rdx,(%rax)
+
+	if ((r = sys_page_map(0, UTEMP, child, (void *)(USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  802a98:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802a9b:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802aa1:	ba 00 d0 7f ef       	mov    $0xef7fd000,%edx
+  802aa6:	48 89 d1             	mov    %rdx,%rcx
+  802aa9:	89 c2                	mov    %eax,%edx
+  802aab:	be 00 00 40 00       	mov    $0x400000,%esi
+  802ab0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ab5:	48 b8 12 1c 80 00 00 	movabs $0x801c12,%rax
+  802abc:	00 00 00 
+  802abf:	ff d0                	call   *%rax
+  802ac1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ac4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ac8:	78 41                	js     802b0b <init_stack+0x29c>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  802aca:	be 00 00 40 00       	mov    $0x400000,%esi
+  802acf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ad4:	48 b8 72 1c 80 00 00 	movabs $0x801c72,%rax
+  802adb:	00 00 00 
+  802ade:	ff d0                	call   *%rax
+  802ae0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ae3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ae7:	78 25                	js     802b0e <init_stack+0x29f>
+		goto error;
+	return sys_vma_alloc(child, (void *)(USTACKTOP - 2 * PGSIZE), PGSIZE, PTE_P | PTE_U | PTE_W);
+  802ae9:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802aec:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802af1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802af6:	be 00 c0 7f ef       	mov    $0xef7fc000,%esi
+  802afb:	89 c7                	mov    %eax,%edi
+  802afd:	48 b8 9f 1e 80 00 00 	movabs $0x801e9f,%rax
+  802b04:	00 00 00 
+  802b07:	ff d0                	call   *%rax
+  802b09:	eb 1d                	jmp    802b28 <init_stack+0x2b9>
+		goto error;
+  802b0b:	90                   	nop
+  802b0c:	eb 01                	jmp    802b0f <init_stack+0x2a0>
+		goto error;
+  802b0e:	90                   	nop
+
+error:
+	sys_page_unmap(0, UTEMP);
+  802b0f:	be 00 00 40 00       	mov    $0x400000,%esi
+  802b14:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b19:	48 b8 72 1c 80 00 00 	movabs $0x801c72,%rax
+  802b20:	00 00 00 
+  802b23:	ff d0                	call   *%rax
+	return r;
+  802b25:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802b28:	c9                   	leave
+  802b29:	c3                   	ret
+
+0000000000802b2a <map_segment>:
+ * 为子环境 child 登记程序段 ph(sys_vma_binary)，内容由内核从 fexec() 设置的程序映像按需填充
+ * 文件偏移与虚拟地址必须在页内对齐，内核才能把整页的文件内容映射到程序段中
+ */
+static int
+map_segment(envid_t child, struct Proghdr *ph)
+{
+  802b2a:	55                   	push   %rbp
+  802b2b:	48 89 e5             	mov    %rsp,%rbp
+  802b2e:	48 83 ec 10          	sub    $0x10,%rsp
+  802b32:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802b35:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	if (PGOFF(ph->p_offset) != PGOFF(ph->p_va) || ph->p_filesz > ph->p_memsz)
+  802b39:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b3d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802b41:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b45:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802b49:	48 31 d0             	xor    %rdx,%rax
+  802b4c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802b51:	48 85 c0             	test   %rax,%rax
+  802b54:	75 15                	jne    802b6b <map_segment+0x41>
+  802b56:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b5a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802b5e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b62:	48 8b 52 28          	mov    0x28(%rdx),%rdx
+  802b66:	48 39 c2             	cmp    %rax,%rdx
+  802b69:	73 07                	jae    802b72 <map_segment+0x48>
+		return -E_NOT_EXEC;
+  802b6b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802b70:	eb 18                	jmp    802b8a <map_segment+0x60>
+	return sys_vma_binary(child, ph);
+  802b72:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b76:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b79:	48 89 d6             	mov    %rdx,%rsi
+  802b7c:	89 c7                	mov    %eax,%edi
+  802b7e:	48 b8 0c 21 80 00 00 	movabs $0x80210c,%rax
+  802b85:	00 00 00 
+  802b88:	ff d0                	call   *%rax
+}
+  802b8a:	c9                   	leave
+  802b8b:	c3                   	ret
+
+0000000000802b8c <copy_shared_pages>:
+ * 把父环境中所有 PTE_SHARE 的页以相同的权限映射到子环境(文件描述符表和文件数据窗口)
+ * 按页表层次跳过不存在的页表，避免逐页扫描整个用户地址空间
+ */
+static int
+copy_shared_pages(envid_t child)
+{
+  802b8c:	55                   	push   %rbp
+  802b8d:	48 89 e5             	mov    %rsp,%rbp
+  802b90:	48 83 ec 40          	sub    $0x40,%rsp
+  802b94:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	uintptr_t va;
+	int r;
+
+	for (va = 0; va < UTOP; va += PGSIZE)
+  802b97:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802b9e:	00 
+  802b9f:	e9 4d 01 00 00       	jmp    802cf1 <copy_shared_pages+0x165>
+	{
+		if (!(uvpml4e[VPML4E(va)] & PTE_P))
+  802ba4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ba8:	48 c1 e8 27          	shr    $0x27,%rax
+  802bac:	48 89 c2             	mov    %rax,%rdx
+  802baf:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802bb6:	01 00 00 
+  802bb9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bbd:	83 e0 01             	and    $0x1,%eax
+  802bc0:	48 85 c0             	test   %rax,%rax
+  802bc3:	75 2c                	jne    802bf1 <copy_shared_pages+0x65>
+		{
+			va = ROUNDDOWN(va, 1UL << PML4SHIFT) + (1UL << PML4SHIFT) - PGSIZE;
+  802bc5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bc9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802bcd:	48 b8 00 00 00 00 80 	movabs $0xffffff8000000000,%rax
+  802bd4:	ff ff ff 
+  802bd7:	48 23 45 d8          	and    -0x28(%rbp),%rax
+  802bdb:	48 ba 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rdx
+  802be2:	00 00 00 
+  802be5:	48 01 d0             	add    %rdx,%rax
+  802be8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+			continue;
+  802bec:	e9 f8 00 00 00       	jmp    802ce9 <copy_shared_pages+0x15d>
+		}
+		if (!(uvpde[VPDPE(va)] & PTE_P))
+  802bf1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bf5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802bf9:	48 89 c2             	mov    %rax,%rdx
+  802bfc:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802c03:	01 00 00 
+  802c06:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c0a:	83 e0 01             	and    $0x1,%eax
+  802c0d:	48 85 c0             	test   %rax,%rax
+  802c10:	75 21                	jne    802c33 <copy_shared_pages+0xa7>
+		{
+			va = ROUNDDOWN(va, 1UL << PDPESHIFT) + (1UL << PDPESHIFT) - PGSIZE;
+  802c12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c16:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802c1a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c1e:	48 25 00 00 00 c0    	and    $0xffffffffc0000000,%rax
+  802c24:	48 05 00 f0 ff 3f    	add    $0x3ffff000,%rax
+  802c2a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+			continue;
+  802c2e:	e9 b6 00 00 00       	jmp    802ce9 <copy_shared_pages+0x15d>
+		}
+		if (!(uvpd[VPD(va)] & PTE_P))
+  802c33:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c37:	48 c1 e8 15          	shr    $0x15,%rax
+  802c3b:	48 89 c2             	mov    %rax,%rdx
+  802c3e:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802c45:	01 00 00 
+  802c48:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c4c:	83 e0 01             	and    $0x1,%eax
+  802c4f:	48 85 c0             	test   %rax,%rax
+  802c52:	75 1e                	jne    802c72 <copy_shared_pages+0xe6>
+		{
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE - PGSIZE;
+  802c54:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c58:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  802c5c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c60:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  802c66:	48 05 00 f0 1f 00    	add    $0x1ff000,%rax
+  802c6c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+			continue;
+  802c70:	eb 77                	jmp    802ce9 <copy_shared_pages+0x15d>
+		}
+		if ((uvpt[VPN(va)] & (PTE_P | PTE_SHARE)) != (PTE_P | PTE_SHARE))
+  802c72:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c76:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c7a:	48 89 c2             	mov    %rax,%rdx
+  802c7d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c84:	01 00 00 
+  802c87:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c8b:	25 01 04 00 00       	and    $0x401,%eax
+  802c90:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802c96:	75 50                	jne    802ce8 <copy_shared_pages+0x15c>
+			continue;
+		if ((r = sys_page_map(0, (void *)va, child, (void *)va, uvpt[VPN(va)] & PTE_SYSCALL)) < 0)
+  802c98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c9c:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ca0:	48 89 c2             	mov    %rax,%rdx
+  802ca3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802caa:	01 00 00 
+  802cad:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802cb1:	25 07 0e 00 00       	and    $0xe07,%eax
+  802cb6:	89 c6                	mov    %eax,%esi
+  802cb8:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802cbc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802cc0:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  802cc3:	41 89 f0             	mov    %esi,%r8d
+  802cc6:	48 89 c6             	mov    %rax,%rsi
+  802cc9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cce:	48 b8 12 1c 80 00 00 	movabs $0x801c12,%rax
+  802cd5:	00 00 00 
+  802cd8:	ff d0                	call   *%rax
+  802cda:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  802cdd:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  802ce1:	79 06                	jns    802ce9 <copy_shared_pages+0x15d>
+			return r;
+  802ce3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802ce6:	eb 22                	jmp    802d0a <copy_shared_pages+0x17e>
+			continue;
+  802ce8:	90                   	nop
+	for (va = 0; va < UTOP; va += PGSIZE)
+  802ce9:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  802cf0:	00 
+  802cf1:	48 b8 ff ff 7f 00 80 	movabs $0x80007fffff,%rax
+  802cf8:	00 00 00 
+  802cfb:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  802cff:	0f 83 9f fe ff ff    	jae    802ba4 <copy_shared_pages+0x18>
+	}
+	return 0;
+  802d05:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d0a:	c9                   	leave
+  802d0b:	c3                   	ret
+
+0000000000802d0c <_panic>:
+/*
+ * 无法解决的致命错误会导致死机
+ * 打印"死机:<消息>”，然后导致处理器休眠进入HLT状态
+ */
+void _panic(const char *file, int line, const char *fmt, ...)
+{
+  802d0c:	55                   	push   %rbp
+  802d0d:	48 89 e5             	mov    %rsp,%rbp
+  802d10:	53                   	push   %rbx
+  802d11:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  802d18:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  802d1f:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  802d25:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  802d2c:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  802d33:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  802d3a:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  802d41:	84 c0                	test   %al,%al
+  802d43:	74 23                	je     802d68 <_panic+0x5c>
+  802d45:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  802d4c:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  802d50:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  802d54:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  802d58:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  802d5c:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  802d60:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  802d64:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  802d68:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  802d6f:	00 00 00 
+  802d72:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  802d79:	00 00 00 
+  802d7c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802d80:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  802d87:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  802d8e:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+	// 输出死机的信息
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802d95:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  802d9c:	00 00 00 
+  802d9f:	48 8b 18             	mov    (%rax),%rbx
+  802da2:	48 b8 47 1b 80 00 00 	movabs $0x801b47,%rax
+  802da9:	00 00 00 
+  802dac:	ff d0                	call   *%rax
+  802dae:	89 c6                	mov    %eax,%esi
+  802db0:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  802db6:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  802dbd:	41 89 d0             	mov    %edx,%r8d
+  802dc0:	48 89 c1             	mov    %rax,%rcx
+  802dc3:	48 89 da             	mov    %rbx,%rdx
+  802dc6:	48 b8 b0 48 80 00 00 	movabs $0x8048b0,%rax
+  802dcd:	00 00 00 
+  802dd0:	48 89 c7             	mov    %rax,%rdi
+  802dd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dd8:	49 b9 d4 02 80 00 00 	movabs $0x8002d4,%r9
+  802ddf:	00 00 00 
+  802de2:	41 ff d1             	call   *%r9
+			sys_getprocid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802de5:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  802dec:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  802df3:	48 89 d6             	mov    %rdx,%rsi
+  802df6:	48 89 c7             	mov    %rax,%rdi
+  802df9:	48 b8 25 02 80 00 00 	movabs $0x800225,%rax
+  802e00:	00 00 00 
+  802e03:	ff d0                	call   *%rax
+	cprintf("\n");
+  802e05:	48 b8 d3 48 80 00 00 	movabs $0x8048d3,%rax
+  802e0c:	00 00 00 
+  802e0f:	48 89 c7             	mov    %rax,%rdi
+  802e12:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e17:	48 ba d4 02 80 00 00 	movabs $0x8002d4,%rdx
+  802e1e:	00 00 00 
+  802e21:	ff d2                	call   *%rdx
+
+	// 触发断点中断
+	while (1)
+		asm volatile("int3");
+  802e23:	cc                   	int3
+  802e24:	eb fd                	jmp    802e23 <_panic+0x117>
+
+0000000000802e26 <fd2num>:
+/* ------------------------------- 文件描述符 ------------------------------- */
+
+// 返回 fd 的文件描述符号
+uint64_t
+fd2num(struct Fd *fd)
+{
+  802e26:	55                   	push   %rbp
+  802e27:	48 89 e5             	mov    %rsp,%rbp
+  802e2a:	48 83 ec 08          	sub    $0x8,%rsp
+  802e2e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802e32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e36:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802e3d:	ff ff ff 
+  802e40:	48 01 d0             	add    %rdx,%rax
+  802e43:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802e47:	c9                   	leave
+  802e48:	c3                   	ret
+
+0000000000802e49 <fd2data>:
+
+// 返回 fd 的数据窗口
+char *
+fd2data(struct Fd *fd)
+{
+  802e49:	55                   	push   %rbp
+  802e4a:	48 89 e5             	mov    %rsp,%rbp
+  802e4d:	48 83 ec 18          	sub    $0x18,%rsp
+  802e51:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  802e55:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e59:	48 89 c7             	mov    %rax,%rdi
+  802e5c:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  802e63:	00 00 00 
+  802e66:	ff d0                	call   *%rax
+  802e68:	48 89 c1             	mov    %rax,%rcx
+  802e6b:	48 c7 45 f8 00 00 20 	movq   $0x200000,-0x8(%rbp)
+  802e72:	00 
+  802e73:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e77:	48 05 ff 9f 40 00    	add    $0x409fff,%rax
+  802e7d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802e81:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e85:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e8a:	48 f7 75 f8          	divq   -0x8(%rbp)
+  802e8e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e92:	48 29 d0             	sub    %rdx,%rax
+  802e95:	48 98                	cltq
+  802e97:	48 0f af c1          	imul   %rcx,%rax
+  802e9b:	ba 00 00 02 d0       	mov    $0xd0020000,%edx
+  802ea0:	48 01 d0             	add    %rdx,%rax
+}
+  802ea3:	c9                   	leave
+  802ea4:	c3                   	ret
+
+0000000000802ea5 <fd_alloc>:
+ * 找到编号最小的未使用的文件描述符(其 Fd 页未映射)，存入 *fd_store，但不分配 Fd 页
+ * 调用者需要在其上分配一个页面，否则该文件描述符不会被使用
+ * 所有文件描述符都已使用时返回 -E_MAX_OPEN，*fd_store 为 0
+ */
+int fd_alloc(struct Fd **fd_store)
+{
+  802ea5:	55                   	push   %rbp
+  802ea6:	48 89 e5             	mov    %rsp,%rbp
+  802ea9:	48 83 ec 20          	sub    $0x20,%rsp
+  802ead:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++)
+  802eb1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802eb8:	eb 41                	jmp    802efb <fd_alloc+0x56>
+	{
+		fd = INDEX2FD(i);
+  802eba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ebd:	c1 e0 0c             	shl    $0xc,%eax
+  802ec0:	48 98                	cltq
+  802ec2:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802ec7:	48 01 d0             	add    %rdx,%rax
+  802eca:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+		if (pageref(fd) == 0)
+  802ece:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ed2:	48 89 c7             	mov    %rax,%rdi
+  802ed5:	48 b8 79 40 80 00 00 	movabs $0x804079,%rax
+  802edc:	00 00 00 
+  802edf:	ff d0                	call   *%rax
+  802ee1:	85 c0                	test   %eax,%eax
+  802ee3:	75 12                	jne    802ef7 <fd_alloc+0x52>
+		{
+			*fd_store = fd;
+  802ee5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ee9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802eed:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802ef0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef5:	eb 1a                	jmp    802f11 <fd_alloc+0x6c>
+	for (i = 0; i < MAXFD; i++)
+  802ef7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802efb:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802eff:	7e b9                	jle    802eba <fd_alloc+0x15>
+		}
+	}
+	*fd_store = 0;
+  802f01:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f05:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  802f0c:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  802f11:	c9                   	leave
+  802f12:	c3                   	ret
+
+0000000000802f13 <fd_lookup>:
+/**
+ * 检查 fdnum 是否在范围内且已映射，是则 *fd_store 为对应的 Fd 页
+ * 否则返回 -E_INVAL
+ */
+int fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802f13:	55                   	push   %rbp
+  802f14:	48 89 e5             	mov    %rsp,%rbp
+  802f17:	48 83 ec 20          	sub    $0x20,%rsp
+  802f1b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802f1e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD)
+  802f22:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f26:	78 06                	js     802f2e <fd_lookup+0x1b>
+  802f28:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802f2c:	7e 07                	jle    802f35 <fd_lookup+0x22>
+	{
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisproc->proc_id, fdnum);
+		return -E_INVAL;
+  802f2e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f33:	eb 42                	jmp    802f77 <fd_lookup+0x64>
+	}
+	fd = INDEX2FD(fdnum);
+  802f35:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f38:	c1 e0 0c             	shl    $0xc,%eax
+  802f3b:	48 98                	cltq
+  802f3d:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802f42:	48 01 d0             	add    %rdx,%rax
+  802f45:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (pageref(fd) == 0)
+  802f49:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f4d:	48 89 c7             	mov    %rax,%rdi
+  802f50:	48 b8 79 40 80 00 00 	movabs $0x804079,%rax
+  802f57:	00 00 00 
+  802f5a:	ff d0                	call   *%rax
+  802f5c:	85 c0                	test   %eax,%eax
+  802f5e:	75 07                	jne    802f67 <fd_lookup+0x54>
+	{
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisproc->proc_id, fdnum);
+		return -E_INVAL;
+  802f60:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f65:	eb 10                	jmp    802f77 <fd_lookup+0x64>
+	}
+	*fd_store = fd;
+  802f67:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f6b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f6f:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  802f72:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f77:	c9                   	leave
+  802f78:	c3                   	ret
+
+0000000000802f79 <fd_close>:
+/**
+ * 关闭文件描述符 fd 并释放其 Fd 页
+ * must_exist 为 0 时，fd 不是有效的打开文件描述符则直接返回 0；否则返回 fd_lookup 的错误
+ */
+int fd_close(struct Fd *fd, bool must_exist)
+{
+  802f79:	55                   	push   %rbp
+  802f7a:	48 89 e5             	mov    %rsp,%rbp
+  802f7d:	48 83 ec 30          	sub    $0x30,%rsp
+  802f81:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802f85:	89 f0                	mov    %esi,%eax
+  802f87:	88 45 d4             	mov    %al,-0x2c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  802f8a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f8e:	48 89 c7             	mov    %rax,%rdi
+  802f91:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  802f98:	00 00 00 
+  802f9b:	ff d0                	call   *%rax
+  802f9d:	89 c2                	mov    %eax,%edx
+  802f9f:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802fa3:	48 89 c6             	mov    %rax,%rsi
+  802fa6:	89 d7                	mov    %edx,%edi
+  802fa8:	48 b8 13 2f 80 00 00 	movabs $0x802f13,%rax
+  802faf:	00 00 00 
+  802fb2:	ff d0                	call   *%rax
+  802fb4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802fb7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802fbb:	78 0a                	js     802fc7 <fd_close+0x4e>
+  802fbd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fc1:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  802fc5:	74 12                	je     802fd9 <fd_close+0x60>
+		return (must_exist ? r : 0);
+  802fc7:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  802fcb:	74 05                	je     802fd2 <fd_close+0x59>
+  802fcd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fd0:	eb 70                	jmp    803042 <fd_close+0xc9>
+  802fd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd7:	eb 69                	jmp    803042 <fd_close+0xc9>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0)
+  802fd9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802fdd:	8b 00                	mov    (%rax),%eax
+  802fdf:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802fe3:	48 89 d6             	mov    %rdx,%rsi
+  802fe6:	89 c7                	mov    %eax,%edi
+  802fe8:	48 b8 44 30 80 00 00 	movabs $0x803044,%rax
+  802fef:	00 00 00 
+  802ff2:	ff d0                	call   *%rax
+  802ff4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ff7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ffb:	78 2a                	js     803027 <fd_close+0xae>
+	{
+		if (dev->dev_close)
+  802ffd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803001:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803005:	48 85 c0             	test   %rax,%rax
+  803008:	74 16                	je     803020 <fd_close+0xa7>
+			r = (*dev->dev_close)(fd);
+  80300a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80300e:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803012:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803016:	48 89 c7             	mov    %rax,%rdi
+  803019:	ff d2                	call   *%rdx
+  80301b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80301e:	eb 07                	jmp    803027 <fd_close+0xae>
+		else
+			r = 0;
+  803020:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	}
+	// 此时 fd 可能已被设备释放，再次释放是安全的
+	(void)sys_page_unmap(0, fd);
+  803027:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80302b:	48 89 c6             	mov    %rax,%rsi
+  80302e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803033:	48 b8 72 1c 80 00 00 	movabs $0x801c72,%rax
+  80303a:	00 00 00 
+  80303d:	ff d0                	call   *%rax
+	return r;
+  80303f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803042:	c9                   	leave
+  803043:	c3                   	ret
+
+0000000000803044 <dev_lookup>:
+	{
+		&devfile,
+		0};
+
+int dev_lookup(int dev_id, struct Dev **dev)
+{
+  803044:	55                   	push   %rbp
+  803045:	48 89 e5             	mov    %rsp,%rbp
+  803048:	48 83 ec 20          	sub    $0x20,%rsp
+  80304c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80304f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int i;
+
+	for (i = 0; devtab[i]; i++)
+  803053:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80305a:	eb 3f                	jmp    80309b <dev_lookup+0x57>
+		if (devtab[i]->dev_id == dev_id)
+  80305c:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803063:	00 00 00 
+  803066:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803069:	48 98                	cltq
+  80306b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80306f:	8b 00                	mov    (%rax),%eax
+  803071:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  803074:	75 21                	jne    803097 <dev_lookup+0x53>
+		{
+			*dev = devtab[i];
+  803076:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80307d:	00 00 00 
+  803080:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803083:	48 98                	cltq
+  803085:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803089:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80308d:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803090:	b8 00 00 00 00       	mov    $0x0,%eax
+  803095:	eb 62                	jmp    8030f9 <dev_lookup+0xb5>
+	for (i = 0; devtab[i]; i++)
+  803097:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80309b:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8030a2:	00 00 00 
+  8030a5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030a8:	48 98                	cltq
+  8030aa:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8030ae:	48 85 c0             	test   %rax,%rax
+  8030b1:	75 a9                	jne    80305c <dev_lookup+0x18>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisproc->proc_id, dev_id);
+  8030b3:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8030ba:	00 00 00 
+  8030bd:	48 8b 00             	mov    (%rax),%rax
+  8030c0:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8030c6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8030c9:	89 c6                	mov    %eax,%esi
+  8030cb:	48 b8 d8 48 80 00 00 	movabs $0x8048d8,%rax
+  8030d2:	00 00 00 
+  8030d5:	48 89 c7             	mov    %rax,%rdi
+  8030d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030dd:	48 b9 d4 02 80 00 00 	movabs $0x8002d4,%rcx
+  8030e4:	00 00 00 
+  8030e7:	ff d1                	call   *%rcx
+	*dev = 0;
+  8030e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030ed:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  8030f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8030f9:	c9                   	leave
+  8030fa:	c3                   	ret
+
+00000000008030fb <close>:
+
+int close(int fdnum)
+{
+  8030fb:	55                   	push   %rbp
+  8030fc:	48 89 e5             	mov    %rsp,%rbp
+  8030ff:	48 83 ec 20          	sub    $0x20,%rsp
+  803103:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803106:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80310a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80310d:	48 89 d6             	mov    %rdx,%rsi
+  803110:	89 c7                	mov    %eax,%edi
+  803112:	48 b8 13 2f 80 00 00 	movabs $0x802f13,%rax
+  803119:	00 00 00 
+  80311c:	ff d0                	call   *%rax
+  80311e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803121:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803125:	79 05                	jns    80312c <close+0x31>
+		return r;
+  803127:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80312a:	eb 18                	jmp    803144 <close+0x49>
+	else
+		return fd_close(fd, 1);
+  80312c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803130:	be 01 00 00 00       	mov    $0x1,%esi
+  803135:	48 89 c7             	mov    %rax,%rdi
+  803138:	48 b8 79 2f 80 00 00 	movabs $0x802f79,%rax
+  80313f:	00 00 00 
+  803142:	ff d0                	call   *%rax
+}
+  803144:	c9                   	leave
+  803145:	c3                   	ret
+
+0000000000803146 <close_all>:
+
+void close_all(void)
+{
+  803146:	55                   	push   %rbp
+  803147:	48 89 e5             	mov    %rsp,%rbp
+  80314a:	48 83 ec 10          	sub    $0x10,%rsp
+	int i;
+
+	for (i = 0; i < MAXFD; i++)
+  80314e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803155:	eb 15                	jmp    80316c <close_all+0x26>
+		close(i);
+  803157:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80315a:	89 c7                	mov    %eax,%edi
+  80315c:	48 b8 fb 30 80 00 00 	movabs $0x8030fb,%rax
+  803163:	00 00 00 
+  803166:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  803168:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80316c:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803170:	7e e5                	jle    803157 <close_all+0x11>
+}
+  803172:	90                   	nop
+  803173:	90                   	nop
+  803174:	c9                   	leave
+  803175:	c3                   	ret
+
+0000000000803176 <dup>:
+/**
+ * 将 oldfdnum 复制为 newfdnum(先关闭 newfdnum)
+ * 复制的两个文件描述符共享 Fd 页和数据窗口
+ */
+int dup(int oldfdnum, int newfdnum)
+{
+  803176:	55                   	push   %rbp
+  803177:	48 89 e5             	mov    %rsp,%rbp
+  80317a:	48 83 ec 60          	sub    $0x60,%rsp
+  80317e:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  803181:	89 75 a8             	mov    %esi,-0x58(%rbp)
+	int r;
+	char *ova, *nva;
+	uintptr_t off;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  803184:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+  803188:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80318b:	48 89 d6             	mov    %rdx,%rsi
+  80318e:	89 c7                	mov    %eax,%edi
+  803190:	48 b8 13 2f 80 00 00 	movabs $0x802f13,%rax
+  803197:	00 00 00 
+  80319a:	ff d0                	call   *%rax
+  80319c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80319f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031a3:	79 08                	jns    8031ad <dup+0x37>
+		return r;
+  8031a5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031a8:	e9 1d 02 00 00       	jmp    8033ca <dup+0x254>
+	close(newfdnum);
+  8031ad:	8b 45 a8             	mov    -0x58(%rbp),%eax
+  8031b0:	89 c7                	mov    %eax,%edi
+  8031b2:	48 b8 fb 30 80 00 00 	movabs $0x8030fb,%rax
+  8031b9:	00 00 00 
+  8031bc:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  8031be:	8b 45 a8             	mov    -0x58(%rbp),%eax
+  8031c1:	c1 e0 0c             	shl    $0xc,%eax
+  8031c4:	48 98                	cltq
+  8031c6:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8031cb:	48 01 d0             	add    %rdx,%rax
+  8031ce:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	ova = fd2data(oldfd);
+  8031d2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8031d6:	48 89 c7             	mov    %rax,%rdi
+  8031d9:	48 b8 49 2e 80 00 00 	movabs $0x802e49,%rax
+  8031e0:	00 00 00 
+  8031e3:	ff d0                	call   *%rax
+  8031e5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	nva = fd2data(newfd);
+  8031e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031ed:	48 89 c7             	mov    %rax,%rdi
+  8031f0:	48 b8 49 2e 80 00 00 	movabs $0x802e49,%rax
+  8031f7:	00 00 00 
+  8031fa:	ff d0                	call   *%rax
+  8031fc:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+	for (off = 0; off < FILEWINDOW; off += PGSIZE)
+  803200:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803207:	00 
+  803208:	e9 8f 00 00 00       	jmp    80329c <dup+0x126>
+		if (va_is_mapped(ova + off))
+  80320d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803211:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803215:	48 01 d0             	add    %rdx,%rax
+  803218:	48 89 c7             	mov    %rax,%rdi
+  80321b:	48 b8 d8 3f 80 00 00 	movabs $0x803fd8,%rax
+  803222:	00 00 00 
+  803225:	ff d0                	call   *%rax
+  803227:	84 c0                	test   %al,%al
+  803229:	74 69                	je     803294 <dup+0x11e>
+			if ((r = sys_page_map(0, ova + off, 0, nva + off,
+								  uvpt[VPN(ova + off)] & PTE_SYSCALL)) < 0)
+  80322b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80322f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803233:	48 01 d0             	add    %rdx,%rax
+  803236:	48 c1 e8 0c          	shr    $0xc,%rax
+  80323a:	48 89 c2             	mov    %rax,%rdx
+  80323d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803244:	01 00 00 
+  803247:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+			if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  80324b:	25 07 0e 00 00       	and    $0xe07,%eax
+  803250:	89 c6                	mov    %eax,%esi
+  803252:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803256:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80325a:	48 01 c2             	add    %rax,%rdx
+  80325d:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803261:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803265:	48 01 c8             	add    %rcx,%rax
+  803268:	41 89 f0             	mov    %esi,%r8d
+  80326b:	48 89 d1             	mov    %rdx,%rcx
+  80326e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803273:	48 89 c6             	mov    %rax,%rsi
+  803276:	bf 00 00 00 00       	mov    $0x0,%edi
+  80327b:	48 b8 12 1c 80 00 00 	movabs $0x801c12,%rax
+  803282:	00 00 00 
+  803285:	ff d0                	call   *%rax
+  803287:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80328a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80328e:	0f 88 96 00 00 00    	js     80332a <dup+0x1b4>
+	for (off = 0; off < FILEWINDOW; off += PGSIZE)
+  803294:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  80329b:	00 
+  80329c:	48 c7 45 d0 00 00 20 	movq   $0x200000,-0x30(%rbp)
+  8032a3:	00 
+  8032a4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032a8:	48 05 ff 9f 40 00    	add    $0x409fff,%rax
+  8032ae:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8032b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032bb:	48 f7 75 d0          	divq   -0x30(%rbp)
+  8032bf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032c3:	48 29 d0             	sub    %rdx,%rax
+  8032c6:	48 98                	cltq
+  8032c8:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8032cc:	0f 82 3b ff ff ff    	jb     80320d <dup+0x97>
+				goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[VPN(oldfd)] & PTE_SYSCALL)) < 0)
+  8032d2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8032d6:	48 c1 e8 0c          	shr    $0xc,%rax
+  8032da:	48 89 c2             	mov    %rax,%rdx
+  8032dd:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8032e4:	01 00 00 
+  8032e7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8032eb:	25 07 0e 00 00       	and    $0xe07,%eax
+  8032f0:	89 c1                	mov    %eax,%ecx
+  8032f2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8032f6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8032fa:	41 89 c8             	mov    %ecx,%r8d
+  8032fd:	48 89 d1             	mov    %rdx,%rcx
+  803300:	ba 00 00 00 00       	mov    $0x0,%edx
+  803305:	48 89 c6             	mov    %rax,%rsi
+  803308:	bf 00 00 00 00       	mov    $0x0,%edi
+  80330d:	48 b8 12 1c 80 00 00 	movabs $0x801c12,%rax
+  803314:	00 00 00 
+  803317:	ff d0                	call   *%rax
+  803319:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80331c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803320:	78 0b                	js     80332d <dup+0x1b7>
+		goto err;
+
+	return newfdnum;
+  803322:	8b 45 a8             	mov    -0x58(%rbp),%eax
+  803325:	e9 a0 00 00 00       	jmp    8033ca <dup+0x254>
+				goto err;
+  80332a:	90                   	nop
+  80332b:	eb 01                	jmp    80332e <dup+0x1b8>
+		goto err;
+  80332d:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  80332e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803332:	48 89 c6             	mov    %rax,%rsi
+  803335:	bf 00 00 00 00       	mov    $0x0,%edi
+  80333a:	48 b8 72 1c 80 00 00 	movabs $0x801c72,%rax
+  803341:	00 00 00 
+  803344:	ff d0                	call   *%rax
+	for (off = 0; off < FILEWINDOW; off += PGSIZE)
+  803346:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80334d:	00 
+  80334e:	eb 45                	jmp    803395 <dup+0x21f>
+		if (va_is_mapped(nva + off))
+  803350:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803354:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803358:	48 01 d0             	add    %rdx,%rax
+  80335b:	48 89 c7             	mov    %rax,%rdi
+  80335e:	48 b8 d8 3f 80 00 00 	movabs $0x803fd8,%rax
+  803365:	00 00 00 
+  803368:	ff d0                	call   *%rax
+  80336a:	84 c0                	test   %al,%al
+  80336c:	74 1f                	je     80338d <dup+0x217>
+			sys_page_unmap(0, nva + off);
+  80336e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803372:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803376:	48 01 d0             	add    %rdx,%rax
+  803379:	48 89 c6             	mov    %rax,%rsi
+  80337c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803381:	48 b8 72 1c 80 00 00 	movabs $0x801c72,%rax
+  803388:	00 00 00 
+  80338b:	ff d0                	call   *%rax
+	for (off = 0; off < FILEWINDOW; off += PGSIZE)
+  80338d:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  803394:	00 
+  803395:	48 c7 45 c0 00 00 20 	movq   $0x200000,-0x40(%rbp)
+  80339c:	00 
+  80339d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8033a1:	48 05 ff 9f 40 00    	add    $0x409fff,%rax
+  8033a7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8033ab:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8033af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033b4:	48 f7 75 c0          	divq   -0x40(%rbp)
+  8033b8:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8033bc:	48 29 d0             	sub    %rdx,%rax
+  8033bf:	48 98                	cltq
+  8033c1:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8033c5:	72 89                	jb     803350 <dup+0x1da>
+	return r;
+  8033c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8033ca:	c9                   	leave
+  8033cb:	c3                   	ret
+
+00000000008033cc <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8033cc:	55                   	push   %rbp
+  8033cd:	48 89 e5             	mov    %rsp,%rbp
+  8033d0:	48 83 ec 40          	sub    $0x40,%rsp
+  8033d4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8033d7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8033db:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8033df:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8033e3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8033e6:	48 89 d6             	mov    %rdx,%rsi
+  8033e9:	89 c7                	mov    %eax,%edi
+  8033eb:	48 b8 13 2f 80 00 00 	movabs $0x802f13,%rax
+  8033f2:	00 00 00 
+  8033f5:	ff d0                	call   *%rax
+  8033f7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8033fa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8033fe:	78 24                	js     803424 <read+0x58>
+  803400:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803404:	8b 00                	mov    (%rax),%eax
+  803406:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80340a:	48 89 d6             	mov    %rdx,%rsi
+  80340d:	89 c7                	mov    %eax,%edi
+  80340f:	48 b8 44 30 80 00 00 	movabs $0x803044,%rax
+  803416:	00 00 00 
+  803419:	ff d0                	call   *%rax
+  80341b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80341e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803422:	79 05                	jns    803429 <read+0x5d>
+		return r;
+  803424:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803427:	eb 7d                	jmp    8034a6 <read+0xda>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  803429:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80342d:	8b 40 08             	mov    0x8(%rax),%eax
+  803430:	83 e0 03             	and    $0x3,%eax
+  803433:	83 f8 01             	cmp    $0x1,%eax
+  803436:	75 3d                	jne    803475 <read+0xa9>
+	{
+		cprintf("[%08x] read %d -- bad mode\n", thisproc->proc_id, fdnum);
+  803438:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80343f:	00 00 00 
+  803442:	48 8b 00             	mov    (%rax),%rax
+  803445:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  80344b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80344e:	89 c6                	mov    %eax,%esi
+  803450:	48 b8 f7 48 80 00 00 	movabs $0x8048f7,%rax
+  803457:	00 00 00 
+  80345a:	48 89 c7             	mov    %rax,%rdi
+  80345d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803462:	48 b9 d4 02 80 00 00 	movabs $0x8002d4,%rcx
+  803469:	00 00 00 
+  80346c:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80346e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803473:	eb 31                	jmp    8034a6 <read+0xda>
+	}
+	if (!dev->dev_read)
+  803475:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803479:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80347d:	48 85 c0             	test   %rax,%rax
+  803480:	75 07                	jne    803489 <read+0xbd>
+		return -E_NOT_SUPP;
+  803482:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803487:	eb 1d                	jmp    8034a6 <read+0xda>
+	return (*dev->dev_read)(fd, buf, n);
+  803489:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80348d:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803491:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803495:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803499:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80349d:	48 89 ce             	mov    %rcx,%rsi
+  8034a0:	48 89 c7             	mov    %rax,%rdi
+  8034a3:	41 ff d0             	call   *%r8
+}
+  8034a6:	c9                   	leave
+  8034a7:	c3                   	ret
+
+00000000008034a8 <readn>:
+
+// 读满 n 字节，或遇到文件末尾/错误为止
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8034a8:	55                   	push   %rbp
+  8034a9:	48 89 e5             	mov    %rsp,%rbp
+  8034ac:	48 83 ec 30          	sub    $0x30,%rsp
+  8034b0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8034b3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8034b7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m)
+  8034bb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8034c2:	eb 47                	jmp    80350b <readn+0x63>
+	{
+		m = read(fdnum, (char *)buf + tot, n - tot);
+  8034c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8034c7:	48 98                	cltq
+  8034c9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8034cd:	48 29 c2             	sub    %rax,%rdx
+  8034d0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8034d3:	48 63 c8             	movslq %eax,%rcx
+  8034d6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034da:	48 01 c1             	add    %rax,%rcx
+  8034dd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034e0:	48 89 ce             	mov    %rcx,%rsi
+  8034e3:	89 c7                	mov    %eax,%edi
+  8034e5:	48 b8 cc 33 80 00 00 	movabs $0x8033cc,%rax
+  8034ec:	00 00 00 
+  8034ef:	ff d0                	call   *%rax
+  8034f1:	89 45 f8             	mov    %eax,-0x8(%rbp)
+		if (m < 0)
+  8034f4:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8034f8:	79 05                	jns    8034ff <readn+0x57>
+			return m;
+  8034fa:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8034fd:	eb 1d                	jmp    80351c <readn+0x74>
+		if (m == 0)
+  8034ff:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803503:	74 13                	je     803518 <readn+0x70>
+	for (tot = 0; tot < n; tot += m)
+  803505:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803508:	01 45 fc             	add    %eax,-0x4(%rbp)
+  80350b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80350e:	48 98                	cltq
+  803510:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803514:	72 ae                	jb     8034c4 <readn+0x1c>
+  803516:	eb 01                	jmp    803519 <readn+0x71>
+			break;
+  803518:	90                   	nop
+	}
+	return tot;
+  803519:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80351c:	c9                   	leave
+  80351d:	c3                   	ret
+
+000000000080351e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80351e:	55                   	push   %rbp
+  80351f:	48 89 e5             	mov    %rsp,%rbp
+  803522:	48 83 ec 40          	sub    $0x40,%rsp
+  803526:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803529:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80352d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803531:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803535:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803538:	48 89 d6             	mov    %rdx,%rsi
+  80353b:	89 c7                	mov    %eax,%edi
+  80353d:	48 b8 13 2f 80 00 00 	movabs $0x802f13,%rax
+  803544:	00 00 00 
+  803547:	ff d0                	call   *%rax
+  803549:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80354c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803550:	78 24                	js     803576 <write+0x58>
+  803552:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803556:	8b 00                	mov    (%rax),%eax
+  803558:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80355c:	48 89 d6             	mov    %rdx,%rsi
+  80355f:	89 c7                	mov    %eax,%edi
+  803561:	48 b8 44 30 80 00 00 	movabs $0x803044,%rax
+  803568:	00 00 00 
+  80356b:	ff d0                	call   *%rax
+  80356d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803570:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803574:	79 05                	jns    80357b <write+0x5d>
+		return r;
+  803576:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803579:	eb 7c                	jmp    8035f7 <write+0xd9>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  80357b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80357f:	8b 40 08             	mov    0x8(%rax),%eax
+  803582:	83 e0 03             	and    $0x3,%eax
+  803585:	85 c0                	test   %eax,%eax
+  803587:	75 3d                	jne    8035c6 <write+0xa8>
+	{
+		cprintf("[%08x] write %d -- bad mode\n", thisproc->proc_id, fdnum);
+  803589:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803590:	00 00 00 
+  803593:	48 8b 00             	mov    (%rax),%rax
+  803596:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  80359c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80359f:	89 c6                	mov    %eax,%esi
+  8035a1:	48 b8 13 49 80 00 00 	movabs $0x804913,%rax
+  8035a8:	00 00 00 
+  8035ab:	48 89 c7             	mov    %rax,%rdi
+  8035ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035b3:	48 b9 d4 02 80 00 00 	movabs $0x8002d4,%rcx
+  8035ba:	00 00 00 
+  8035bd:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8035bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035c4:	eb 31                	jmp    8035f7 <write+0xd9>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+				fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8035c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035ca:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8035ce:	48 85 c0             	test   %rax,%rax
+  8035d1:	75 07                	jne    8035da <write+0xbc>
+		return -E_NOT_SUPP;
+  8035d3:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8035d8:	eb 1d                	jmp    8035f7 <write+0xd9>
+	return (*dev->dev_write)(fd, buf, n);
+  8035da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035de:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8035e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035e6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8035ea:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8035ee:	48 89 ce             	mov    %rcx,%rsi
+  8035f1:	48 89 c7             	mov    %rax,%rdi
+  8035f4:	41 ff d0             	call   *%r8
+}
+  8035f7:	c9                   	leave
+  8035f8:	c3                   	ret
+
+00000000008035f9 <seek>:
+
+int seek(int fdnum, off_t offset)
+{
+  8035f9:	55                   	push   %rbp
+  8035fa:	48 89 e5             	mov    %rsp,%rbp
+  8035fd:	48 83 ec 20          	sub    $0x20,%rsp
+  803601:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803604:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803607:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80360b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80360e:	48 89 d6             	mov    %rdx,%rsi
+  803611:	89 c7                	mov    %eax,%edi
+  803613:	48 b8 13 2f 80 00 00 	movabs $0x802f13,%rax
+  80361a:	00 00 00 
+  80361d:	ff d0                	call   *%rax
+  80361f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803622:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803626:	79 05                	jns    80362d <seek+0x34>
+		return r;
+  803628:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80362b:	eb 0f                	jmp    80363c <seek+0x43>
+	fd->fd_offset = offset;
+  80362d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803631:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803634:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  803637:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80363c:	c9                   	leave
+  80363d:	c3                   	ret
+
+000000000080363e <ftruncate>:
+
+int ftruncate(int fdnum, off_t newsize)
+{
+  80363e:	55                   	push   %rbp
+  80363f:	48 89 e5             	mov    %rsp,%rbp
+  803642:	48 83 ec 30          	sub    $0x30,%rsp
+  803646:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803649:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80364c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803650:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803653:	48 89 d6             	mov    %rdx,%rsi
+  803656:	89 c7                	mov    %eax,%edi
+  803658:	48 b8 13 2f 80 00 00 	movabs $0x802f13,%rax
+  80365f:	00 00 00 
+  803662:	ff d0                	call   *%rax
+  803664:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803667:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80366b:	78 24                	js     803691 <ftruncate+0x53>
+  80366d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803671:	8b 00                	mov    (%rax),%eax
+  803673:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803677:	48 89 d6             	mov    %rdx,%rsi
+  80367a:	89 c7                	mov    %eax,%edi
+  80367c:	48 b8 44 30 80 00 00 	movabs $0x803044,%rax
+  803683:	00 00 00 
+  803686:	ff d0                	call   *%rax
+  803688:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80368b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80368f:	79 05                	jns    803696 <ftruncate+0x58>
+		return r;
+  803691:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803694:	eb 75                	jmp    80370b <ftruncate+0xcd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  803696:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80369a:	8b 40 08             	mov    0x8(%rax),%eax
+  80369d:	83 e0 03             	and    $0x3,%eax
+  8036a0:	85 c0                	test   %eax,%eax
+  8036a2:	75 3d                	jne    8036e1 <ftruncate+0xa3>
+	{
+		cprintf("[%08x] ftruncate %d -- bad mode\n", thisproc->proc_id, fdnum);
+  8036a4:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8036ab:	00 00 00 
+  8036ae:	48 8b 00             	mov    (%rax),%rax
+  8036b1:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8036b7:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8036ba:	89 c6                	mov    %eax,%esi
+  8036bc:	48 b8 30 49 80 00 00 	movabs $0x804930,%rax
+  8036c3:	00 00 00 
+  8036c6:	48 89 c7             	mov    %rax,%rdi
+  8036c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ce:	48 b9 d4 02 80 00 00 	movabs $0x8002d4,%rcx
+  8036d5:	00 00 00 
+  8036d8:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8036da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036df:	eb 2a                	jmp    80370b <ftruncate+0xcd>
+	}
+	if (!dev->dev_trunc)
+  8036e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036e5:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8036e9:	48 85 c0             	test   %rax,%rax
+  8036ec:	75 07                	jne    8036f5 <ftruncate+0xb7>
+		return -E_NOT_SUPP;
+  8036ee:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8036f3:	eb 16                	jmp    80370b <ftruncate+0xcd>
+	return (*dev->dev_trunc)(fd, newsize);
+  8036f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036f9:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8036fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803701:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803704:	89 d6                	mov    %edx,%esi
+  803706:	48 89 c7             	mov    %rax,%rdi
+  803709:	ff d1                	call   *%rcx
+}
+  80370b:	c9                   	leave
+  80370c:	c3                   	ret
+
+000000000080370d <fstat>:
+
+int fstat(int fdnum, struct Stat *stat)
+{
+  80370d:	55                   	push   %rbp
+  80370e:	48 89 e5             	mov    %rsp,%rbp
+  803711:	48 83 ec 30          	sub    $0x30,%rsp
+  803715:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803718:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80371c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803720:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803723:	48 89 d6             	mov    %rdx,%rsi
+  803726:	89 c7                	mov    %eax,%edi
+  803728:	48 b8 13 2f 80 00 00 	movabs $0x802f13,%rax
+  80372f:	00 00 00 
+  803732:	ff d0                	call   *%rax
+  803734:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803737:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80373b:	78 24                	js     803761 <fstat+0x54>
+  80373d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803741:	8b 00                	mov    (%rax),%eax
+  803743:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803747:	48 89 d6             	mov    %rdx,%rsi
+  80374a:	89 c7                	mov    %eax,%edi
+  80374c:	48 b8 44 30 80 00 00 	movabs $0x803044,%rax
+  803753:	00 00 00 
+  803756:	ff d0                	call   *%rax
+  803758:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80375b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80375f:	79 05                	jns    803766 <fstat+0x59>
+		return r;
+  803761:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803764:	eb 5e                	jmp    8037c4 <fstat+0xb7>
+	if (!dev->dev_stat)
+  803766:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80376a:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80376e:	48 85 c0             	test   %rax,%rax
+  803771:	75 07                	jne    80377a <fstat+0x6d>
+		return -E_NOT_SUPP;
+  803773:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803778:	eb 4a                	jmp    8037c4 <fstat+0xb7>
+	stat->st_name[0] = 0;
+  80377a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80377e:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  803781:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803785:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80378c:	00 00 00 
+	stat->st_isdir = 0;
+  80378f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803793:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80379a:	00 00 00 
+	stat->st_dev = dev;
+  80379d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8037a1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8037a5:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  8037ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037b0:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8037b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037b8:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8037bc:	48 89 d6             	mov    %rdx,%rsi
+  8037bf:	48 89 c7             	mov    %rax,%rdi
+  8037c2:	ff d1                	call   *%rcx
+}
+  8037c4:	c9                   	leave
+  8037c5:	c3                   	ret
+
+00000000008037c6 <stat>:
+
+int stat(const char *path, struct Stat *stat)
+{
+  8037c6:	55                   	push   %rbp
+  8037c7:	48 89 e5             	mov    %rsp,%rbp
+  8037ca:	48 83 ec 20          	sub    $0x20,%rsp
+  8037ce:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8037d2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8037d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037da:	be 00 00 00 00       	mov    $0x0,%esi
+  8037df:	48 89 c7             	mov    %rax,%rdi
+  8037e2:	48 b8 b4 38 80 00 00 	movabs $0x8038b4,%rax
+  8037e9:	00 00 00 
+  8037ec:	ff d0                	call   *%rax
+  8037ee:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8037f1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8037f5:	79 05                	jns    8037fc <stat+0x36>
+		return fd;
+  8037f7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8037fa:	eb 2f                	jmp    80382b <stat+0x65>
+	r = fstat(fd, stat);
+  8037fc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803800:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803803:	48 89 d6             	mov    %rdx,%rsi
+  803806:	89 c7                	mov    %eax,%edi
+  803808:	48 b8 0d 37 80 00 00 	movabs $0x80370d,%rax
+  80380f:	00 00 00 
+  803812:	ff d0                	call   *%rax
+  803814:	89 45 f8             	mov    %eax,-0x8(%rbp)
+	close(fd);
+  803817:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80381a:	89 c7                	mov    %eax,%edi
+  80381c:	48 b8 fb 30 80 00 00 	movabs $0x8030fb,%rax
+  803823:	00 00 00 
+  803826:	ff d0                	call   *%rax
+	return r;
+  803828:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80382b:	c9                   	leave
+  80382c:	c3                   	ret
+
+000000000080382d <fsipc>:
+ * dstva 非空时，服务器返回的页映射到 dstva
+ * 返回服务器的结果
+ */
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80382d:	55                   	push   %rbp
+  80382e:	48 89 e5             	mov    %rsp,%rbp
+  803831:	48 83 ec 10          	sub    $0x10,%rsp
+  803835:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803838:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	static envid_t fsenv;
+
+	if (fsenv == 0)
+  80383c:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  803843:	00 00 00 
+  803846:	8b 00                	mov    (%rax),%eax
+  803848:	85 c0                	test   %eax,%eax
+  80384a:	75 1d                	jne    803869 <fsipc+0x3c>
+		fsenv = ipc_find_env(PROC_TYPE_FS);
+  80384c:	bf 01 00 00 00       	mov    $0x1,%edi
+  803851:	48 b8 90 42 80 00 00 	movabs $0x804290,%rax
+  803858:	00 00 00 
+  80385b:	ff d0                	call   *%rax
+  80385d:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803864:	00 00 00 
+  803867:	89 02                	mov    %eax,(%rdx)
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisproc->proc_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803869:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  803870:	00 00 00 
+  803873:	8b 00                	mov    (%rax),%eax
+  803875:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  803878:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80387d:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803884:	00 00 00 
+  803887:	89 c7                	mov    %eax,%edi
+  803889:	48 b8 da 41 80 00 00 	movabs $0x8041da,%rax
+  803890:	00 00 00 
+  803893:	ff d0                	call   *%rax
+	return ipc_recv(NULL, dstva, NULL);
+  803895:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803899:	ba 00 00 00 00       	mov    $0x0,%edx
+  80389e:	48 89 c6             	mov    %rax,%rsi
+  8038a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038a6:	48 b8 f0 40 80 00 00 	movabs $0x8040f0,%rax
+  8038ad:	00 00 00 
+  8038b0:	ff d0                	call   *%rax
+}
+  8038b2:	c9                   	leave
+  8038b3:	c3                   	ret
+
+00000000008038b4 <open>:
+ *   -E_BAD_PATH: 路径太长
+ *   -E_MAX_OPEN: 文件描述符已用完
+ *   以及服务器返回的错误
+ */
+int open(const char *path, int mode)
+{
+  8038b4:	55                   	push   %rbp
+  8038b5:	48 89 e5             	mov    %rsp,%rbp
+  8038b8:	48 83 ec 20          	sub    $0x20,%rsp
+  8038bc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8038c0:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8038c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038c7:	48 89 c7             	mov    %rax,%rdi
+  8038ca:	48 b8 ef 0e 80 00 00 	movabs $0x800eef,%rax
+  8038d1:	00 00 00 
+  8038d4:	ff d0                	call   *%rax
+  8038d6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8038db:	7e 0a                	jle    8038e7 <open+0x33>
+		return -E_BAD_PATH;
+  8038dd:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8038e2:	e9 a8 00 00 00       	jmp    80398f <open+0xdb>
+
+	if ((r = fd_alloc(&fd)) < 0)
+  8038e7:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8038eb:	48 89 c7             	mov    %rax,%rdi
+  8038ee:	48 b8 a5 2e 80 00 00 	movabs $0x802ea5,%rax
+  8038f5:	00 00 00 
+  8038f8:	ff d0                	call   *%rax
+  8038fa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8038fd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803901:	79 08                	jns    80390b <open+0x57>
+		return r;
+  803903:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803906:	e9 84 00 00 00       	jmp    80398f <open+0xdb>
+
+	strcpy(fsipcbuf.open.req_path, path);
+  80390b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80390f:	48 89 c6             	mov    %rax,%rsi
+  803912:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803919:	00 00 00 
+  80391c:	48 89 c7             	mov    %rax,%rdi
+  80391f:	48 b8 5b 0f 80 00 00 	movabs $0x800f5b,%rax
+  803926:	00 00 00 
+  803929:	ff d0                	call   *%rax
+	fsipcbuf.open.req_omode = mode;
+  80392b:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803932:	00 00 00 
+  803935:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803938:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+	// 服务器返回的 Fd 页映射到 fd
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0)
+  80393e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803942:	48 89 c6             	mov    %rax,%rsi
+  803945:	bf 01 00 00 00       	mov    $0x1,%edi
+  80394a:	48 b8 2d 38 80 00 00 	movabs $0x80382d,%rax
+  803951:	00 00 00 
+  803954:	ff d0                	call   *%rax
+  803956:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803959:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80395d:	79 1d                	jns    80397c <open+0xc8>
+	{
+		fd_close(fd, 0);
+  80395f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803963:	be 00 00 00 00       	mov    $0x0,%esi
+  803968:	48 89 c7             	mov    %rax,%rdi
+  80396b:	48 b8 79 2f 80 00 00 	movabs $0x802f79,%rax
+  803972:	00 00 00 
+  803975:	ff d0                	call   *%rax
+		return r;
+  803977:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80397a:	eb 13                	jmp    80398f <open+0xdb>
+	}
+
+	return fd2num(fd);
+  80397c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803980:	48 89 c7             	mov    %rax,%rdi
+  803983:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  80398a:	00 00 00 
+  80398d:	ff d0                	call   *%rax
+}
+  80398f:	c9                   	leave
+  803990:	c3                   	ret
+
+0000000000803991 <fexec>:
+ * 把打开的程序文件 fdnum 设为子环境 child 的程序映像，供 spawn 使用
+ * 之后用 sys_vma_binary() 登记的程序段由内核按需从该文件填充
+ * 错误时返回 < 0: fdnum 不是打开的普通文件，或服务器返回的错误
+ */
+int fexec(int fdnum, envid_t child)
+{
+  803991:	55                   	push   %rbp
+  803992:	48 89 e5             	mov    %rsp,%rbp
+  803995:	48 83 ec 20          	sub    $0x20,%rsp
+  803999:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80399c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80399f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8039a3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039a6:	48 89 d6             	mov    %rdx,%rsi
+  8039a9:	89 c7                	mov    %eax,%edi
+  8039ab:	48 b8 13 2f 80 00 00 	movabs $0x802f13,%rax
+  8039b2:	00 00 00 
+  8039b5:	ff d0                	call   *%rax
+  8039b7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8039ba:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039be:	79 05                	jns    8039c5 <fexec+0x34>
+		return r;
+  8039c0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039c3:	eb 56                	jmp    803a1b <fexec+0x8a>
+	if (fd->fd_dev_id != devfile.dev_id)
+  8039c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039c9:	8b 10                	mov    (%rax),%edx
+  8039cb:	48 b8 40 60 80 00 00 	movabs $0x806040,%rax
+  8039d2:	00 00 00 
+  8039d5:	8b 00                	mov    (%rax),%eax
+  8039d7:	39 c2                	cmp    %eax,%edx
+  8039d9:	74 07                	je     8039e2 <fexec+0x51>
+		return -E_INVAL;
+  8039db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8039e0:	eb 39                	jmp    803a1b <fexec+0x8a>
+	fsipcbuf.exec.req_fileid = fd->fd_file.id;
+  8039e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039e6:	8b 40 0c             	mov    0xc(%rax),%eax
+  8039e9:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8039f0:	00 00 00 
+  8039f3:	89 02                	mov    %eax,(%rdx)
+	fsipcbuf.exec.req_envid = child;
+  8039f5:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8039fc:	00 00 00 
+  8039ff:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803a02:	89 42 04             	mov    %eax,0x4(%rdx)
+	return fsipc(FSREQ_EXEC, NULL);
+  803a05:	be 00 00 00 00       	mov    $0x0,%esi
+  803a0a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803a0f:	48 b8 2d 38 80 00 00 	movabs $0x80382d,%rax
+  803a16:	00 00 00 
+  803a19:	ff d0                	call   *%rax
+}
+  803a1b:	c9                   	leave
+  803a1c:	c3                   	ret
+
+0000000000803a1d <devfile_unmap>:
+
+// 解除 fd 的数据窗口中 [from, FILEWINDOW) 的块缓存页映射
+static void
+devfile_unmap(struct Fd *fd, off_t from)
+{
+  803a1d:	55                   	push   %rbp
+  803a1e:	48 89 e5             	mov    %rsp,%rbp
+  803a21:	48 83 ec 40          	sub    $0x40,%rsp
+  803a25:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803a29:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+	char *va = fd2data(fd);
+  803a2c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a30:	48 89 c7             	mov    %rax,%rdi
+  803a33:	48 b8 49 2e 80 00 00 	movabs $0x802e49,%rax
+  803a3a:	00 00 00 
+  803a3d:	ff d0                	call   *%rax
+  803a3f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	uintptr_t off;
+
+	for (off = ROUNDUP(from, PGSIZE); off < FILEWINDOW; off += PGSIZE)
+  803a43:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  803a4a:	00 
+  803a4b:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803a4e:	48 63 d0             	movslq %eax,%rdx
+  803a51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a55:	48 01 d0             	add    %rdx,%rax
+  803a58:	48 83 e8 01          	sub    $0x1,%rax
+  803a5c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803a60:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a64:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a69:	48 f7 75 e8          	divq   -0x18(%rbp)
+  803a6d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a71:	48 29 d0             	sub    %rdx,%rax
+  803a74:	48 98                	cltq
+  803a76:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  803a7a:	eb 45                	jmp    803ac1 <devfile_unmap+0xa4>
+		if (va_is_mapped(va + off))
+  803a7c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803a80:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a84:	48 01 d0             	add    %rdx,%rax
+  803a87:	48 89 c7             	mov    %rax,%rdi
+  803a8a:	48 b8 d8 3f 80 00 00 	movabs $0x803fd8,%rax
+  803a91:	00 00 00 
+  803a94:	ff d0                	call   *%rax
+  803a96:	84 c0                	test   %al,%al
+  803a98:	74 1f                	je     803ab9 <devfile_unmap+0x9c>
+			sys_page_unmap(0, va + off);
+  803a9a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803a9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803aa2:	48 01 d0             	add    %rdx,%rax
+  803aa5:	48 89 c6             	mov    %rax,%rsi
+  803aa8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803aad:	48 b8 72 1c 80 00 00 	movabs $0x801c72,%rax
+  803ab4:	00 00 00 
+  803ab7:	ff d0                	call   *%rax
+	for (off = ROUNDUP(from, PGSIZE); off < FILEWINDOW; off += PGSIZE)
+  803ab9:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  803ac0:	00 
+  803ac1:	48 c7 45 d8 00 00 20 	movq   $0x200000,-0x28(%rbp)
+  803ac8:	00 
+  803ac9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803acd:	48 05 ff 9f 40 00    	add    $0x409fff,%rax
+  803ad3:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  803ad7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803adb:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ae0:	48 f7 75 d8          	divq   -0x28(%rbp)
+  803ae4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ae8:	48 29 d0             	sub    %rdx,%rax
+  803aeb:	48 98                	cltq
+  803aed:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  803af1:	72 89                	jb     803a7c <devfile_unmap+0x5f>
+}
+  803af3:	90                   	nop
+  803af4:	90                   	nop
+  803af5:	c9                   	leave
+  803af6:	c3                   	ret
+
+0000000000803af7 <devfile_flush>:
+ * 关闭文件时由 fd_close 调用：解除数据窗口的映射，并请求服务器将文件写回磁盘
+ * 服务器在 Fd 页的引用计数降为 1 时回收 OpenFile
+ */
+static int
+devfile_flush(struct Fd *fd)
+{
+  803af7:	55                   	push   %rbp
+  803af8:	48 89 e5             	mov    %rsp,%rbp
+  803afb:	48 83 ec 10          	sub    $0x10,%rsp
+  803aff:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	devfile_unmap(fd, 0);
+  803b03:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b07:	be 00 00 00 00       	mov    $0x0,%esi
+  803b0c:	48 89 c7             	mov    %rax,%rdi
+  803b0f:	48 b8 1d 3a 80 00 00 	movabs $0x803a1d,%rax
+  803b16:	00 00 00 
+  803b19:	ff d0                	call   *%rax
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803b1b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b1f:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b22:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803b29:	00 00 00 
+  803b2c:	89 02                	mov    %eax,(%rdx)
+	return fsipc(FSREQ_FLUSH, NULL);
+  803b2e:	be 00 00 00 00       	mov    $0x0,%esi
+  803b33:	bf 06 00 00 00       	mov    $0x6,%edi
+  803b38:	48 b8 2d 38 80 00 00 	movabs $0x80382d,%rax
+  803b3f:	00 00 00 
+  803b42:	ff d0                	call   *%rax
+}
+  803b44:	c9                   	leave
+  803b45:	c3                   	ret
+
+0000000000803b46 <devfile_map>:
+ * 确保文件 offset(BLKSIZE 对齐)处的块已映射在 fd 的数据窗口中
+ * 未映射时请求服务器把块缓存页共享过来(FSREQ_MAP)
+ */
+static int
+devfile_map(struct Fd *fd, off_t offset)
+{
+  803b46:	55                   	push   %rbp
+  803b47:	48 89 e5             	mov    %rsp,%rbp
+  803b4a:	48 83 ec 20          	sub    $0x20,%rsp
+  803b4e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803b52:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	char *va = fd2data(fd) + offset;
+  803b55:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b59:	48 89 c7             	mov    %rax,%rdi
+  803b5c:	48 b8 49 2e 80 00 00 	movabs $0x802e49,%rax
+  803b63:	00 00 00 
+  803b66:	ff d0                	call   *%rax
+  803b68:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803b6b:	48 63 d2             	movslq %edx,%rdx
+  803b6e:	48 01 d0             	add    %rdx,%rax
+  803b71:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+	if (va_is_mapped(va))
+  803b75:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b79:	48 89 c7             	mov    %rax,%rdi
+  803b7c:	48 b8 d8 3f 80 00 00 	movabs $0x803fd8,%rax
+  803b83:	00 00 00 
+  803b86:	ff d0                	call   *%rax
+  803b88:	84 c0                	test   %al,%al
+  803b8a:	74 07                	je     803b93 <devfile_map+0x4d>
+		return 0;
+  803b8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b91:	eb 3b                	jmp    803bce <devfile_map+0x88>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803b93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b97:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b9a:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803ba1:	00 00 00 
+  803ba4:	89 02                	mov    %eax,(%rdx)
+	fsipcbuf.map.req_offset = offset;
+  803ba6:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803bad:	00 00 00 
+  803bb0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803bb3:	89 42 04             	mov    %eax,0x4(%rdx)
+	return fsipc(FSREQ_MAP, va);
+  803bb6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803bba:	48 89 c6             	mov    %rax,%rsi
+  803bbd:	bf 09 00 00 00       	mov    $0x9,%edi
+  803bc2:	48 b8 2d 38 80 00 00 	movabs $0x80382d,%rax
+  803bc9:	00 00 00 
+  803bcc:	ff d0                	call   *%rax
+}
+  803bce:	c9                   	leave
+  803bcf:	c3                   	ret
+
+0000000000803bd0 <devfile_read>:
+ * 数据不经过 IPC 请求页复制
+ * 返回读取的字节数
+ */
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  803bd0:	55                   	push   %rbp
+  803bd1:	48 89 e5             	mov    %rsp,%rbp
+  803bd4:	48 83 ec 60          	sub    $0x60,%rsp
+  803bd8:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803bdc:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  803be0:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	char *va = fd2data(fd);
+  803be4:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803be8:	48 89 c7             	mov    %rax,%rdi
+  803beb:	48 b8 49 2e 80 00 00 	movabs $0x802e49,%rax
+  803bf2:	00 00 00 
+  803bf5:	ff d0                	call   *%rax
+  803bf7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	off_t pos = fd->fd_offset, end;
+  803bfb:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803bff:	8b 40 04             	mov    0x4(%rax),%eax
+  803c02:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	size_t m;
+	int r;
+
+	if (pos >= fd->fd_file.size)
+  803c05:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803c09:	8b 40 10             	mov    0x10(%rax),%eax
+  803c0c:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  803c0f:	7c 0a                	jl     803c1b <devfile_read+0x4b>
+		return 0;
+  803c11:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c16:	e9 02 01 00 00       	jmp    803d1d <devfile_read+0x14d>
+	end = MIN(pos + (off_t)n, fd->fd_file.size);
+  803c1b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803c1f:	89 c2                	mov    %eax,%edx
+  803c21:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c24:	01 d0                	add    %edx,%eax
+  803c26:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803c29:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803c2d:	8b 40 10             	mov    0x10(%rax),%eax
+  803c30:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  803c33:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803c36:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803c39:	39 c2                	cmp    %eax,%edx
+  803c3b:	0f 4e c2             	cmovle %edx,%eax
+  803c3e:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	n = end - pos;
+  803c41:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803c44:	2b 45 fc             	sub    -0x4(%rbp),%eax
+  803c47:	48 98                	cltq
+  803c49:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+	while (pos < end)
+  803c4d:	e9 b1 00 00 00       	jmp    803d03 <devfile_read+0x133>
+	{
+		if ((r = devfile_map(fd, ROUNDDOWN(pos, BLKSIZE))) < 0)
+  803c52:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c55:	48 98                	cltq
+  803c57:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  803c5b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c5f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803c64:	89 c2                	mov    %eax,%edx
+  803c66:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803c6a:	89 d6                	mov    %edx,%esi
+  803c6c:	48 89 c7             	mov    %rax,%rdi
+  803c6f:	48 b8 46 3b 80 00 00 	movabs $0x803b46,%rax
+  803c76:	00 00 00 
+  803c79:	ff d0                	call   *%rax
+  803c7b:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803c7e:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  803c82:	79 08                	jns    803c8c <devfile_read+0xbc>
+			return r;
+  803c84:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803c87:	e9 91 00 00 00       	jmp    803d1d <devfile_read+0x14d>
+		m = MIN(end - pos, BLKSIZE - pos % BLKSIZE);
+  803c8c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803c8f:	2b 45 fc             	sub    -0x4(%rbp),%eax
+  803c92:	89 45 d0             	mov    %eax,-0x30(%rbp)
+  803c95:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803c98:	89 d0                	mov    %edx,%eax
+  803c9a:	c1 f8 1f             	sar    $0x1f,%eax
+  803c9d:	c1 e8 14             	shr    $0x14,%eax
+  803ca0:	01 c2                	add    %eax,%edx
+  803ca2:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803ca8:	29 c2                	sub    %eax,%edx
+  803caa:	b8 00 10 00 00       	mov    $0x1000,%eax
+  803caf:	29 d0                	sub    %edx,%eax
+  803cb1:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  803cb4:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  803cb7:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803cba:	39 c2                	cmp    %eax,%edx
+  803cbc:	0f 4e c2             	cmovle %edx,%eax
+  803cbf:	48 98                	cltq
+  803cc1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+		memmove(buf, va + pos, m);
+  803cc5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803cc8:	48 63 d0             	movslq %eax,%rdx
+  803ccb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ccf:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  803cd3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cd7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803cdb:	48 89 ce             	mov    %rcx,%rsi
+  803cde:	48 89 c7             	mov    %rax,%rdi
+  803ce1:	48 b8 e7 15 80 00 00 	movabs $0x8015e7,%rax
+  803ce8:	00 00 00 
+  803ceb:	ff d0                	call   *%rax
+		buf += m;
+  803ced:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803cf1:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+		pos += m;
+  803cf5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803cf9:	89 c2                	mov    %eax,%edx
+  803cfb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803cfe:	01 d0                	add    %edx,%eax
+  803d00:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	while (pos < end)
+  803d03:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d06:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  803d09:	0f 8c 43 ff ff ff    	jl     803c52 <devfile_read+0x82>
+	}
+	fd->fd_offset = pos;
+  803d0f:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803d13:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803d16:	89 50 04             	mov    %edx,0x4(%rax)
+	return n;
+  803d19:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  803d1d:	c9                   	leave
+  803d1e:	c3                   	ret
+
+0000000000803d1f <devfile_write>:
+ * 服务器写入的就是客户端映射的块缓存页，因此已映射的块无需重新映射
+ * 返回写入的字节数
+ */
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  803d1f:	55                   	push   %rbp
+  803d20:	48 89 e5             	mov    %rsp,%rbp
+  803d23:	48 83 ec 50          	sub    $0x50,%rsp
+  803d27:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803d2b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803d2f:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	size_t m, tot = 0;
+  803d33:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803d3a:	00 
+	int r;
+
+	while (tot < n)
+  803d3b:	e9 fc 00 00 00       	jmp    803e3c <devfile_write+0x11d>
+	{
+		m = MIN(n - tot, sizeof(fsipcbuf.write.req_buf));
+  803d40:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803d44:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  803d48:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803d4c:	48 c7 45 e8 f4 0f 00 	movq   $0xff4,-0x18(%rbp)
+  803d53:	00 
+  803d54:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803d58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d5c:	48 39 c2             	cmp    %rax,%rdx
+  803d5f:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803d63:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803d67:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d6b:	8b 40 0c             	mov    0xc(%rax),%eax
+  803d6e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803d75:	00 00 00 
+  803d78:	89 42 08             	mov    %eax,0x8(%rdx)
+		fsipcbuf.write.req_n = m;
+  803d7b:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803d82:	00 00 00 
+  803d85:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d89:	48 89 02             	mov    %rax,(%rdx)
+		memmove(fsipcbuf.write.req_buf, buf + tot, m);
+  803d8c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803d90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d94:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  803d98:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d9c:	48 89 c2             	mov    %rax,%rdx
+  803d9f:	48 89 ce             	mov    %rcx,%rsi
+  803da2:	48 b8 0c 80 80 00 00 	movabs $0x80800c,%rax
+  803da9:	00 00 00 
+  803dac:	48 89 c7             	mov    %rax,%rdi
+  803daf:	48 b8 e7 15 80 00 00 	movabs $0x8015e7,%rax
+  803db6:	00 00 00 
+  803db9:	ff d0                	call   *%rax
+		if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  803dbb:	be 00 00 00 00       	mov    $0x0,%esi
+  803dc0:	bf 04 00 00 00       	mov    $0x4,%edi
+  803dc5:	48 b8 2d 38 80 00 00 	movabs $0x80382d,%rax
+  803dcc:	00 00 00 
+  803dcf:	ff d0                	call   *%rax
+  803dd1:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803dd4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803dd8:	79 05                	jns    803ddf <devfile_write+0xc0>
+			return r;
+  803dda:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ddd:	eb 72                	jmp    803e51 <devfile_write+0x132>
+		assert(r <= m);
+  803ddf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803de2:	48 98                	cltq
+  803de4:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  803de8:	73 3e                	jae    803e28 <devfile_write+0x109>
+  803dea:	48 b8 56 49 80 00 00 	movabs $0x804956,%rax
+  803df1:	00 00 00 
+  803df4:	48 89 c1             	mov    %rax,%rcx
+  803df7:	48 b8 5d 49 80 00 00 	movabs $0x80495d,%rax
+  803dfe:	00 00 00 
+  803e01:	48 89 c2             	mov    %rax,%rdx
+  803e04:	be bf 00 00 00       	mov    $0xbf,%esi
+  803e09:	48 b8 72 49 80 00 00 	movabs $0x804972,%rax
+  803e10:	00 00 00 
+  803e13:	48 89 c7             	mov    %rax,%rdi
+  803e16:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e1b:	49 b8 0c 2d 80 00 00 	movabs $0x802d0c,%r8
+  803e22:	00 00 00 
+  803e25:	41 ff d0             	call   *%r8
+		tot += r;
+  803e28:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e2b:	48 98                	cltq
+  803e2d:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		if (r < m)
+  803e31:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e34:	48 98                	cltq
+  803e36:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  803e3a:	72 10                	jb     803e4c <devfile_write+0x12d>
+	while (tot < n)
+  803e3c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e40:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  803e44:	0f 82 f6 fe ff ff    	jb     803d40 <devfile_write+0x21>
+  803e4a:	eb 01                	jmp    803e4d <devfile_write+0x12e>
+			break;
+  803e4c:	90                   	nop
+	}
+	return tot;
+  803e4d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  803e51:	c9                   	leave
+  803e52:	c3                   	ret
+
+0000000000803e53 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  803e53:	55                   	push   %rbp
+  803e54:	48 89 e5             	mov    %rsp,%rbp
+  803e57:	48 83 ec 20          	sub    $0x20,%rsp
+  803e5b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803e5f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803e63:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e67:	8b 40 0c             	mov    0xc(%rax),%eax
+  803e6a:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803e71:	00 00 00 
+  803e74:	89 02                	mov    %eax,(%rdx)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803e76:	be 00 00 00 00       	mov    $0x0,%esi
+  803e7b:	bf 05 00 00 00       	mov    $0x5,%edi
+  803e80:	48 b8 2d 38 80 00 00 	movabs $0x80382d,%rax
+  803e87:	00 00 00 
+  803e8a:	ff d0                	call   *%rax
+  803e8c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e8f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e93:	79 05                	jns    803e9a <devfile_stat+0x47>
+		return r;
+  803e95:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e98:	eb 59                	jmp    803ef3 <devfile_stat+0xa0>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803e9a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e9e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803ea5:	00 00 00 
+  803ea8:	48 89 d6             	mov    %rdx,%rsi
+  803eab:	48 89 c7             	mov    %rax,%rdi
+  803eae:	48 b8 5b 0f 80 00 00 	movabs $0x800f5b,%rax
+  803eb5:	00 00 00 
+  803eb8:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  803eba:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803ec1:	00 00 00 
+  803ec4:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  803eca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ece:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803ed4:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803edb:	00 00 00 
+  803ede:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  803ee4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ee8:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  803eee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ef3:	c9                   	leave
+  803ef4:	c3                   	ret
+
+0000000000803ef5 <devfile_trunc>:
+
+// 截断或扩展文件，截断时解除新大小之外的块的映射(这些块可能被服务器释放并重新分配)
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  803ef5:	55                   	push   %rbp
+  803ef6:	48 89 e5             	mov    %rsp,%rbp
+  803ef9:	48 83 ec 10          	sub    $0x10,%rsp
+  803efd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803f01:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803f04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f08:	8b 40 0c             	mov    0xc(%rax),%eax
+  803f0b:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803f12:	00 00 00 
+  803f15:	89 02                	mov    %eax,(%rdx)
+	fsipcbuf.set_size.req_size = newsize;
+  803f17:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803f1e:	00 00 00 
+  803f21:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f24:	89 42 04             	mov    %eax,0x4(%rdx)
+	devfile_unmap(fd, newsize);
+  803f27:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803f2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f2e:	89 d6                	mov    %edx,%esi
+  803f30:	48 89 c7             	mov    %rax,%rdi
+  803f33:	48 b8 1d 3a 80 00 00 	movabs $0x803a1d,%rax
+  803f3a:	00 00 00 
+  803f3d:	ff d0                	call   *%rax
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  803f3f:	be 00 00 00 00       	mov    $0x0,%esi
+  803f44:	bf 02 00 00 00       	mov    $0x2,%edi
+  803f49:	48 b8 2d 38 80 00 00 	movabs $0x80382d,%rax
+  803f50:	00 00 00 
+  803f53:	ff d0                	call   *%rax
+}
+  803f55:	c9                   	leave
+  803f56:	c3                   	ret
+
+0000000000803f57 <remove>:
+
+// 删除文件
+int remove(const char *path)
+{
+  803f57:	55                   	push   %rbp
+  803f58:	48 89 e5             	mov    %rsp,%rbp
+  803f5b:	48 83 ec 10          	sub    $0x10,%rsp
+  803f5f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  803f63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f67:	48 89 c7             	mov    %rax,%rdi
+  803f6a:	48 b8 ef 0e 80 00 00 	movabs $0x800eef,%rax
+  803f71:	00 00 00 
+  803f74:	ff d0                	call   *%rax
+  803f76:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803f7b:	7e 07                	jle    803f84 <remove+0x2d>
+		return -E_BAD_PATH;
+  803f7d:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803f82:	eb 36                	jmp    803fba <remove+0x63>
+	strcpy(fsipcbuf.remove.req_path, path);
+  803f84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f88:	48 89 c6             	mov    %rax,%rsi
+  803f8b:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803f92:	00 00 00 
+  803f95:	48 89 c7             	mov    %rax,%rdi
+  803f98:	48 b8 5b 0f 80 00 00 	movabs $0x800f5b,%rax
+  803f9f:	00 00 00 
+  803fa2:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  803fa4:	be 00 00 00 00       	mov    $0x0,%esi
+  803fa9:	bf 07 00 00 00       	mov    $0x7,%edi
+  803fae:	48 b8 2d 38 80 00 00 	movabs $0x80382d,%rax
+  803fb5:	00 00 00 
+  803fb8:	ff d0                	call   *%rax
+}
+  803fba:	c9                   	leave
+  803fbb:	c3                   	ret
+
+0000000000803fbc <sync>:
+
+// 将文件系统的所有修改写回磁盘
+int sync(void)
+{
+  803fbc:	55                   	push   %rbp
+  803fbd:	48 89 e5             	mov    %rsp,%rbp
+	return fsipc(FSREQ_SYNC, NULL);
+  803fc0:	be 00 00 00 00       	mov    $0x0,%esi
+  803fc5:	bf 08 00 00 00       	mov    $0x8,%edi
+  803fca:	48 b8 2d 38 80 00 00 	movabs $0x80382d,%rax
+  803fd1:	00 00 00 
+  803fd4:	ff d0                	call   *%rax
+}
+  803fd6:	5d                   	pop    %rbp
+  803fd7:	c3                   	ret
+
+0000000000803fd8 <va_is_mapped>:
+/**
+ * 虚拟地址 va 是否已映射
+ * 逐级检查页表，避免访问不存在的页表页
+ */
+bool va_is_mapped(void *va)
+{
+  803fd8:	55                   	push   %rbp
+  803fd9:	48 89 e5             	mov    %rsp,%rbp
+  803fdc:	48 83 ec 08          	sub    $0x8,%rsp
+  803fe0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return (uvpml4e[VPML4E(va)] & PTE_P) && (uvpde[VPDPE(va)] & PTE_P) &&
+  803fe4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803fe8:	48 c1 e8 27          	shr    $0x27,%rax
+  803fec:	48 89 c2             	mov    %rax,%rdx
+  803fef:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803ff6:	01 00 00 
+  803ff9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803ffd:	83 e0 01             	and    $0x1,%eax
+		   (uvpd[VPD(va)] & PTE_P) && (uvpt[VPN(va)] & PTE_P);
+  804000:	48 85 c0             	test   %rax,%rax
+  804003:	74 6a                	je     80406f <va_is_mapped+0x97>
+	return (uvpml4e[VPML4E(va)] & PTE_P) && (uvpde[VPDPE(va)] & PTE_P) &&
+  804005:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804009:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80400d:	48 89 c2             	mov    %rax,%rdx
+  804010:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804017:	01 00 00 
+  80401a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80401e:	83 e0 01             	and    $0x1,%eax
+  804021:	48 85 c0             	test   %rax,%rax
+  804024:	74 49                	je     80406f <va_is_mapped+0x97>
+		   (uvpd[VPD(va)] & PTE_P) && (uvpt[VPN(va)] & PTE_P);
+  804026:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80402a:	48 c1 e8 15          	shr    $0x15,%rax
+  80402e:	48 89 c2             	mov    %rax,%rdx
+  804031:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804038:	01 00 00 
+  80403b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80403f:	83 e0 01             	and    $0x1,%eax
+	return (uvpml4e[VPML4E(va)] & PTE_P) && (uvpde[VPDPE(va)] & PTE_P) &&
+  804042:	48 85 c0             	test   %rax,%rax
+  804045:	74 28                	je     80406f <va_is_mapped+0x97>
+		   (uvpd[VPD(va)] & PTE_P) && (uvpt[VPN(va)] & PTE_P);
+  804047:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80404b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80404f:	48 89 c2             	mov    %rax,%rdx
+  804052:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804059:	01 00 00 
+  80405c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804060:	83 e0 01             	and    $0x1,%eax
+  804063:	48 85 c0             	test   %rax,%rax
+  804066:	74 07                	je     80406f <va_is_mapped+0x97>
+  804068:	b8 01 00 00 00       	mov    $0x1,%eax
+  80406d:	eb 05                	jmp    804074 <va_is_mapped+0x9c>
+  80406f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804074:	83 e0 01             	and    $0x1,%eax
+}
+  804077:	c9                   	leave
+  804078:	c3                   	ret
+
+0000000000804079 <pageref>:
+
+// 返回虚拟地址 v 所在物理页的引用计数，v 未映射时返回 0
+int pageref(void *v)
+{
+  804079:	55                   	push   %rbp
+  80407a:	48 89 e5             	mov    %rsp,%rbp
+  80407d:	48 83 ec 08          	sub    $0x8,%rsp
+  804081:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	if (!va_is_mapped(v))
+  804085:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804089:	48 89 c7             	mov    %rax,%rdi
+  80408c:	48 b8 d8 3f 80 00 00 	movabs $0x803fd8,%rax
+  804093:	00 00 00 
+  804096:	ff d0                	call   *%rax
+  804098:	83 f0 01             	xor    $0x1,%eax
+  80409b:	84 c0                	test   %al,%al
+  80409d:	74 07                	je     8040a6 <pageref+0x2d>
+		return 0;
+  80409f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040a4:	eb 48                	jmp    8040ee <pageref+0x75>
+	return pages[PPN(PTE_ADDR(uvpt[VPN(v)]))].pp_ref;
+  8040a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040aa:	48 c1 e8 0c          	shr    $0xc,%rax
+  8040ae:	48 89 c2             	mov    %rax,%rdx
+  8040b1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8040b8:	01 00 00 
+  8040bb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8040bf:	48 c1 e8 0c          	shr    $0xc,%rax
+  8040c3:	48 89 c2             	mov    %rax,%rdx
+  8040c6:	48 b8 ff ff ff ff ff 	movabs $0xfffffffffffff,%rax
+  8040cd:	ff 0f 00 
+  8040d0:	48 21 d0             	and    %rdx,%rax
+  8040d3:	48 ba 00 00 a0 00 80 	movabs $0x8000a00000,%rdx
+  8040da:	00 00 00 
+  8040dd:	48 c1 e0 04          	shl    $0x4,%rax
+  8040e1:	48 01 d0             	add    %rdx,%rax
+  8040e4:	48 83 c0 08          	add    $0x8,%rax
+  8040e8:	0f b7 00             	movzwl (%rax),%eax
+  8040eb:	0f b7 c0             	movzwl %ax,%eax
+}
+  8040ee:	c9                   	leave
+  8040ef:	c3                   	ret
+
+00000000008040f0 <ipc_recv>:
+ * 如果 pg 为空，则传递 sys_ipc_recv 一个值，它将理解为“no page”的意思
+ * (Zero 不是正确的值，因为这是映射页面的完美有效位置)
+ */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8040f0:	55                   	push   %rbp
+  8040f1:	48 89 e5             	mov    %rsp,%rbp
+  8040f4:	48 83 ec 30          	sub    $0x30,%rsp
+  8040f8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8040fc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804100:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	int r = 0;
+  804104:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	if(pg) {
+  80410b:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804110:	74 18                	je     80412a <ipc_recv+0x3a>
+		r = sys_ipc_recv(pg);
+  804112:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804116:	48 89 c7             	mov    %rax,%rdi
+  804119:	48 b8 fa 1d 80 00 00 	movabs $0x801dfa,%rax
+  804120:	00 00 00 
+  804123:	ff d0                	call   *%rax
+  804125:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804128:	eb 1c                	jmp    804146 <ipc_recv+0x56>
+	}
+	// pg == 0, pg > UTOP
+	else {
+		r = sys_ipc_recv((void*)KERNBASE);
+  80412a:	48 b8 00 00 00 04 80 	movabs $0x8004000000,%rax
+  804131:	00 00 00 
+  804134:	48 89 c7             	mov    %rax,%rdi
+  804137:	48 b8 fa 1d 80 00 00 	movabs $0x801dfa,%rax
+  80413e:	00 00 00 
+  804141:	ff d0                	call   *%rax
+  804143:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	}
+	if (r < 0) {
+  804146:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80414a:	79 39                	jns    804185 <ipc_recv+0x95>
+		*from_env_store =  (from_env_store != NULL) ? (envid_t)0 : *from_env_store;
+  80414c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804151:	75 08                	jne    80415b <ipc_recv+0x6b>
+  804153:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804157:	8b 00                	mov    (%rax),%eax
+  804159:	eb 05                	jmp    804160 <ipc_recv+0x70>
+  80415b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804160:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804164:	89 02                	mov    %eax,(%rdx)
+		*perm_store = (perm_store != NULL) ? (int)0 : *perm_store;
+  804166:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80416b:	75 08                	jne    804175 <ipc_recv+0x85>
+  80416d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804171:	8b 00                	mov    (%rax),%eax
+  804173:	eb 05                	jmp    80417a <ipc_recv+0x8a>
+  804175:	b8 00 00 00 00       	mov    $0x0,%eax
+  80417a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80417e:	89 02                	mov    %eax,(%rdx)
+		return r;
+  804180:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804183:	eb 53                	jmp    8041d8 <ipc_recv+0xe8>
+	}
+	// 设置from_env_store为发送进程的进程ID
+	if(from_env_store) {
+  804185:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80418a:	74 19                	je     8041a5 <ipc_recv+0xb5>
+		*from_env_store = thisproc->env_ipc_from;
+  80418c:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  804193:	00 00 00 
+  804196:	48 8b 00             	mov    (%rax),%rax
+  804199:	8b 90 6c 01 00 00    	mov    0x16c(%rax),%edx
+  80419f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041a3:	89 10                	mov    %edx,(%rax)
+	}
+	// 如果传递物理页，该位不为0，设置perm_store为物理页的权限
+	if(perm_store) {
+  8041a5:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8041aa:	74 19                	je     8041c5 <ipc_recv+0xd5>
+		*perm_store = thisproc->env_ipc_perm;
+  8041ac:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8041b3:	00 00 00 
+  8041b6:	48 8b 00             	mov    (%rax),%rax
+  8041b9:	8b 90 70 01 00 00    	mov    0x170(%rax),%edx
+  8041bf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8041c3:	89 10                	mov    %edx,(%rax)
+	}
+	// 返回发送进程发送的值
+	return thisproc->env_ipc_value;
+  8041c5:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8041cc:	00 00 00 
+  8041cf:	48 8b 00             	mov    (%rax),%rax
+  8041d2:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8041d8:	c9                   	leave
+  8041d9:	c3                   	ret
+
+00000000008041da <ipc_send>:
+ * 使用sys_yield()使cpu友好
+ * 如果'pg'为null，则给sys_ipc_recv传递一个它会理解为“无页面”的值(0不是正确的值)
+ */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8041da:	55                   	push   %rbp
+  8041db:	48 89 e5             	mov    %rsp,%rbp
+  8041de:	48 83 ec 30          	sub    $0x30,%rsp
+  8041e2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8041e5:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8041e8:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8041ec:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	int r = -E_IPC_NOT_RECV;
+  8041ef:	c7 45 fc f8 ff ff ff 	movl   $0xfffffff8,-0x4(%rbp)
+	// 子进程不是接收状态
+	while(r == -E_IPC_NOT_RECV) {
+  8041f6:	eb 59                	jmp    804251 <ipc_send+0x77>
+		if(pg) {
+  8041f8:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8041fd:	74 20                	je     80421f <ipc_send+0x45>
+			// 传递物理页
+			r = sys_ipc_try_send(to_env, val, pg, perm);
+  8041ff:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804202:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804205:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804209:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80420c:	89 c7                	mov    %eax,%edi
+  80420e:	48 b8 a3 1d 80 00 00 	movabs $0x801da3,%rax
+  804215:	00 00 00 
+  804218:	ff d0                	call   *%rax
+  80421a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80421d:	eb 26                	jmp    804245 <ipc_send+0x6b>
+		}
+		// pg == 0, pg > UTOP
+		else {
+			// (void*)KERNBASE > UTOP
+			r = sys_ipc_try_send(to_env, val, (void*)KERNBASE, perm);
+  80421f:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804222:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804225:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804228:	89 d1                	mov    %edx,%ecx
+  80422a:	48 ba 00 00 00 04 80 	movabs $0x8004000000,%rdx
+  804231:	00 00 00 
+  804234:	89 c7                	mov    %eax,%edi
+  804236:	48 b8 a3 1d 80 00 00 	movabs $0x801da3,%rax
+  80423d:	00 00 00 
+  804240:	ff d0                	call   *%rax
+  804242:	89 45 fc             	mov    %eax,-0x4(%rbp)
+		}
+		// 让出CPU
+		sys_yield();
+  804245:	48 b8 83 1b 80 00 00 	movabs $0x801b83,%rax
+  80424c:	00 00 00 
+  80424f:	ff d0                	call   *%rax
+	while(r == -E_IPC_NOT_RECV) {
+  804251:	83 7d fc f8          	cmpl   $0xfffffff8,-0x4(%rbp)
+  804255:	74 a1                	je     8041f8 <ipc_send+0x1e>
+	}
+	if (r != 0) {
+  804257:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80425b:	74 30                	je     80428d <ipc_send+0xb3>
+		panic("something went wrong with sending the page");
+  80425d:	48 b8 80 49 80 00 00 	movabs $0x804980,%rax
+  804264:	00 00 00 
+  804267:	48 89 c2             	mov    %rax,%rdx
+  80426a:	be 48 00 00 00       	mov    $0x48,%esi
+  80426f:	48 b8 ab 49 80 00 00 	movabs $0x8049ab,%rax
+  804276:	00 00 00 
+  804279:	48 89 c7             	mov    %rax,%rdi
+  80427c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804281:	48 b9 0c 2d 80 00 00 	movabs $0x802d0c,%rcx
+  804288:	00 00 00 
+  80428b:	ff d1                	call   *%rcx
+	}
+}
+  80428d:	90                   	nop
+  80428e:	c9                   	leave
+  80428f:	c3                   	ret
+
+0000000000804290 <ipc_find_env>:
+// find special environments.
+// Returns 0 if no such environment exists.
+// 内核只遍历已分配的环境(env_live)，不扫描整个 procs[]
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804290:	55                   	push   %rbp
+  804291:	48 89 e5             	mov    %rsp,%rbp
+  804294:	48 83 ec 20          	sub    $0x20,%rsp
+  804298:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	envid_t r = sys_env_find(type);
+  80429b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80429e:	89 c7                	mov    %eax,%edi
+  8042a0:	48 b8 71 20 80 00 00 	movabs $0x802071,%rax
+  8042a7:	00 00 00 
+  8042aa:	ff d0                	call   *%rax
+  8042ac:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+	return r < 0 ? 0 : r;
+  8042af:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8042b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042b7:	85 c0                	test   %eax,%eax
+  8042b9:	0f 48 c2             	cmovs  %edx,%eax
+}
+  8042bc:	c9                   	leave
+  8042bd:	c3                   	ret
@@ -0,0 +1,3574 @@
+
+obj/user/loadDS.debug:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// entrypoint - 当最初被加载到一个新的环境中时，内核(或者父环境)在这里开始运行.
+.text
+.globl _start
+_start:
+	// 判断是否从栈上的参数开始初始化
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	// $USTACKTOP != %rsp 说明有参数，跳转到 args_exist
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// 如果不是(新环境被内核加载的时候)，则 push 伪造的 argc, argv 参数
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 1a 00 00 00       	call   80005b <libmain>
+
+// 不应该返回
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+// 触发通用保护性异常的用户程序
+
+#include "inc/lib.h"
+
+void umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	48 83 ec 10          	sub    $0x10,%rsp
+  80004b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80004e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 尝试加载内核的数据段选择子到DS寄存器
+	asm volatile("movw $0x10, %ax; movw %ax, %ds");
+  800052:	66 b8 10 00          	mov    $0x10,%ax
+  800056:	8e d8                	mov    %eax,%ds
+}
+  800058:	90                   	nop
+  800059:	c9                   	leave
+  80005a:	c3                   	ret
+
+000000000080005b <libmain>:
+
+/**
+ *  用户环境从lib/libmain.c中的函数libmain开始执行，这个函数进而调用umain，用户写的程序入口只能是umain
+ */
+void libmain(int argc, char **argv)
+{
+  80005b:	55                   	push   %rbp
+  80005c:	48 89 e5             	mov    %rsp,%rbp
+  80005f:	48 83 ec 10          	sub    $0x10,%rsp
+  800063:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800066:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 设置常量 thisproc 指向 procs[] 中当前环境的 Env 结构，ENVX 确保环境 id 未超过了 NENV
+	// thisproc 指向当前环境的 Env 结构
+	thisproc = &procs[ENVX(sys_getprocid())];
+  80006a:	48 b8 3c 0e 80 00 00 	movabs $0x800e3c,%rax
+  800071:	00 00 00 
+  800074:	ff d0                	call   *%rax
+  800076:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80007b:	48 98                	cltq
+  80007d:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  800084:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  80008b:	00 00 00 
+  80008e:	48 01 c2             	add    %rax,%rdx
+  800091:	48 b8 08 30 80 00 00 	movabs $0x803008,%rax
+  800098:	00 00 00 
+  80009b:	48 89 10             	mov    %rdx,(%rax)
+
+	// 通过 CPUID 选择 memset/memmove/memcpy 的实现
+	mem_init();
+  80009e:	48 b8 e4 04 80 00 00 	movabs $0x8004e4,%rax
+  8000a5:	00 00 00 
+  8000a8:	ff d0                	call   *%rax
+
+	// 为了能让panic()提示用户错误，存储程序的名称
+	if (argc > 0)
+  8000aa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8000ae:	7e 14                	jle    8000c4 <libmain+0x69>
+		binaryname = argv[0];
+  8000b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8000b4:	48 8b 00             	mov    (%rax),%rax
+  8000b7:	48 ba 00 30 80 00 00 	movabs $0x803000,%rdx
+  8000be:	00 00 00 
+  8000c1:	48 89 02             	mov    %rax,(%rdx)
+
+	// 调用用户的主程序
+	umain(argc, argv);
+  8000c4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8000c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000cb:	48 89 d6             	mov    %rdx,%rsi
+  8000ce:	89 c7                	mov    %eax,%edi
+  8000d0:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  8000d7:	00 00 00 
+  8000da:	ff d0                	call   *%rax
+
+	// 退出当前环境，env_destroy
+	sys_env_destroy(0);
+  8000dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000e1:	48 b8 f6 0d 80 00 00 	movabs $0x800df6,%rax
+  8000e8:	00 00 00 
+  8000eb:	ff d0                	call   *%rax
+}
+  8000ed:	90                   	nop
+  8000ee:	c9                   	leave
+  8000ef:	c3                   	ret
+
+00000000008000f0 <cpuid>:
+#define read_rip(var) __asm __volatile("leaq (%%rip), %0" : "=r" (var)::"cc","memory")
+
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  8000f0:	55                   	push   %rbp
+  8000f1:	48 89 e5             	mov    %rsp,%rbp
+  8000f4:	53                   	push   %rbx
+  8000f5:	48 83 ec 38          	sub    $0x38,%rsp
+  8000f9:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  8000fc:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800100:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800104:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800108:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid" 
+  80010c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80010f:	0f a2                	cpuid
+  800111:	89 de                	mov    %ebx,%esi
+  800113:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800116:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800119:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  80011c:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info));
+	if (eaxp)
+  80011f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800124:	74 09                	je     80012f <cpuid+0x3f>
+		*eaxp = eax;
+  800126:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80012a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80012d:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  80012f:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800134:	74 09                	je     80013f <cpuid+0x4f>
+		*ebxp = ebx;
+  800136:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80013a:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  80013d:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  80013f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800144:	74 09                	je     80014f <cpuid+0x5f>
+		*ecxp = ecx;
+  800146:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80014a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80014d:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  80014f:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800154:	74 09                	je     80015f <cpuid+0x6f>
+		*edxp = edx;
+  800156:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80015a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80015d:	89 10                	mov    %edx,(%rax)
+}
+  80015f:	90                   	nop
+  800160:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800164:	c9                   	leave
+  800165:	c3                   	ret
+
+0000000000800166 <cpuid_count>:
+
+// 带子功能号(%ecx = count)的 cpuid，用于 leaf 4/7/0xB/0xD 等
+static __inline void
+cpuid_count(uint32_t info, uint32_t count, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800166:	55                   	push   %rbp
+  800167:	48 89 e5             	mov    %rsp,%rbp
+  80016a:	53                   	push   %rbx
+  80016b:	48 83 ec 38          	sub    $0x38,%rsp
+  80016f:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800172:	89 75 e0             	mov    %esi,-0x20(%rbp)
+  800175:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800179:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  80017d:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+  800181:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800185:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800188:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80018b:	89 d1                	mov    %edx,%ecx
+  80018d:	0f a2                	cpuid
+  80018f:	89 de                	mov    %ebx,%esi
+  800191:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800194:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800197:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  80019a:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info), "c" (count));
+	if (eaxp)
+  80019d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8001a2:	74 09                	je     8001ad <cpuid_count+0x47>
+		*eaxp = eax;
+  8001a4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8001a8:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8001ab:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  8001ad:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8001b2:	74 09                	je     8001bd <cpuid_count+0x57>
+		*ebxp = ebx;
+  8001b4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8001b8:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8001bb:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  8001bd:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8001c2:	74 09                	je     8001cd <cpuid_count+0x67>
+		*ecxp = ecx;
+  8001c4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8001c8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8001cb:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  8001cd:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8001d2:	74 09                	je     8001dd <cpuid_count+0x77>
+		*edxp = edx;
+  8001d4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8001d8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8001db:	89 10                	mov    %edx,(%rax)
+}
+  8001dd:	90                   	nop
+  8001de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001e2:	c9                   	leave
+  8001e3:	c3                   	ret
+
+00000000008001e4 <strlen>:
+// 在真正的硬件上会有一定程度的优化, 但在 Bochs 上会有更大的优化效果
+// 用这种方法, Primespipe 的运行速度快了3倍
+#define ASM 1
+
+int strlen(const char *s)
+{
+  8001e4:	55                   	push   %rbp
+  8001e5:	48 89 e5             	mov    %rsp,%rbp
+  8001e8:	48 83 ec 18          	sub    $0x18,%rsp
+  8001ec:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8001f0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8001f7:	eb 09                	jmp    800202 <strlen+0x1e>
+		n++;
+  8001f9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8001fd:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800202:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800206:	0f b6 00             	movzbl (%rax),%eax
+  800209:	84 c0                	test   %al,%al
+  80020b:	75 ec                	jne    8001f9 <strlen+0x15>
+	return n;
+  80020d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800210:	c9                   	leave
+  800211:	c3                   	ret
+
+0000000000800212 <strnlen>:
+
+int strnlen(const char *s, size_t size)
+{
+  800212:	55                   	push   %rbp
+  800213:	48 89 e5             	mov    %rsp,%rbp
+  800216:	48 83 ec 20          	sub    $0x20,%rsp
+  80021a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80021e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800222:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800229:	eb 0e                	jmp    800239 <strnlen+0x27>
+		n++;
+  80022b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80022f:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800234:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  800239:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80023e:	74 0b                	je     80024b <strnlen+0x39>
+  800240:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800244:	0f b6 00             	movzbl (%rax),%eax
+  800247:	84 c0                	test   %al,%al
+  800249:	75 e0                	jne    80022b <strnlen+0x19>
+	return n;
+  80024b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80024e:	c9                   	leave
+  80024f:	c3                   	ret
+
+0000000000800250 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800250:	55                   	push   %rbp
+  800251:	48 89 e5             	mov    %rsp,%rbp
+  800254:	48 83 ec 20          	sub    $0x20,%rsp
+  800258:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80025c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  800260:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800264:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  800268:	90                   	nop
+  800269:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80026d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  800271:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800275:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800279:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80027d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800281:	0f b6 12             	movzbl (%rdx),%edx
+  800284:	88 10                	mov    %dl,(%rax)
+  800286:	0f b6 00             	movzbl (%rax),%eax
+  800289:	84 c0                	test   %al,%al
+  80028b:	75 dc                	jne    800269 <strcpy+0x19>
+		/* do nothing */;
+	return ret;
+  80028d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800291:	c9                   	leave
+  800292:	c3                   	ret
+
+0000000000800293 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800293:	55                   	push   %rbp
+  800294:	48 89 e5             	mov    %rsp,%rbp
+  800297:	48 83 ec 20          	sub    $0x20,%rsp
+  80029b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80029f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int len = strlen(dst);
+  8002a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8002a7:	48 89 c7             	mov    %rax,%rdi
+  8002aa:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	strcpy(dst + len, src);
+  8002b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8002bc:	48 63 d0             	movslq %eax,%rdx
+  8002bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8002c3:	48 01 c2             	add    %rax,%rdx
+  8002c6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8002ca:	48 89 c6             	mov    %rax,%rsi
+  8002cd:	48 89 d7             	mov    %rdx,%rdi
+  8002d0:	48 b8 50 02 80 00 00 	movabs $0x800250,%rax
+  8002d7:	00 00 00 
+  8002da:	ff d0                	call   *%rax
+	return dst;
+  8002dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8002e0:	c9                   	leave
+  8002e1:	c3                   	ret
+
+00000000008002e2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8002e2:	55                   	push   %rbp
+  8002e3:	48 89 e5             	mov    %rsp,%rbp
+  8002e6:	48 83 ec 28          	sub    $0x28,%rsp
+  8002ea:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8002ee:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8002f2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  8002f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8002fa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++)
+  8002fe:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  800305:	00 
+  800306:	eb 2a                	jmp    800332 <strncpy+0x50>
+	{
+		*dst++ = *src;
+  800308:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80030c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800310:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800314:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800318:	0f b6 12             	movzbl (%rdx),%edx
+  80031b:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  80031d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800321:	0f b6 00             	movzbl (%rax),%eax
+  800324:	84 c0                	test   %al,%al
+  800326:	74 05                	je     80032d <strncpy+0x4b>
+			src++;
+  800328:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++)
+  80032d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800332:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800336:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80033a:	72 cc                	jb     800308 <strncpy+0x26>
+	}
+	return ret;
+  80033c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  800340:	c9                   	leave
+  800341:	c3                   	ret
+
+0000000000800342 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800342:	55                   	push   %rbp
+  800343:	48 89 e5             	mov    %rsp,%rbp
+  800346:	48 83 ec 28          	sub    $0x28,%rsp
+  80034a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80034e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800352:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  800356:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80035a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0)
+  80035e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800363:	74 3d                	je     8003a2 <strlcpy+0x60>
+	{
+		while (--size > 0 && *src != '\0')
+  800365:	eb 1d                	jmp    800384 <strlcpy+0x42>
+			*dst++ = *src++;
+  800367:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80036b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80036f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800373:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800377:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80037b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80037f:	0f b6 12             	movzbl (%rdx),%edx
+  800382:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  800384:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  800389:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80038e:	74 0b                	je     80039b <strlcpy+0x59>
+  800390:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800394:	0f b6 00             	movzbl (%rax),%eax
+  800397:	84 c0                	test   %al,%al
+  800399:	75 cc                	jne    800367 <strlcpy+0x25>
+		*dst = '\0';
+  80039b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80039f:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8003a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8003a6:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8003aa:	c9                   	leave
+  8003ab:	c3                   	ret
+
+00000000008003ac <strcmp>:
+
+int strcmp(const char *p, const char *q)
+{
+  8003ac:	55                   	push   %rbp
+  8003ad:	48 89 e5             	mov    %rsp,%rbp
+  8003b0:	48 83 ec 10          	sub    $0x10,%rsp
+  8003b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8003b8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8003bc:	eb 0a                	jmp    8003c8 <strcmp+0x1c>
+		p++, q++;
+  8003be:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8003c3:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8003c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003cc:	0f b6 00             	movzbl (%rax),%eax
+  8003cf:	84 c0                	test   %al,%al
+  8003d1:	74 12                	je     8003e5 <strcmp+0x39>
+  8003d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003d7:	0f b6 10             	movzbl (%rax),%edx
+  8003da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003de:	0f b6 00             	movzbl (%rax),%eax
+  8003e1:	38 c2                	cmp    %al,%dl
+  8003e3:	74 d9                	je     8003be <strcmp+0x12>
+	return (int)((unsigned char)*p - (unsigned char)*q);
+  8003e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003e9:	0f b6 00             	movzbl (%rax),%eax
+  8003ec:	0f b6 d0             	movzbl %al,%edx
+  8003ef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003f3:	0f b6 00             	movzbl (%rax),%eax
+  8003f6:	0f b6 c0             	movzbl %al,%eax
+  8003f9:	29 c2                	sub    %eax,%edx
+  8003fb:	89 d0                	mov    %edx,%eax
+}
+  8003fd:	c9                   	leave
+  8003fe:	c3                   	ret
+
+00000000008003ff <strncmp>:
+
+int strncmp(const char *p, const char *q, size_t n)
+{
+  8003ff:	55                   	push   %rbp
+  800400:	48 89 e5             	mov    %rsp,%rbp
+  800403:	48 83 ec 18          	sub    $0x18,%rsp
+  800407:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80040b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80040f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  800413:	eb 0f                	jmp    800424 <strncmp+0x25>
+		n--, p++, q++;
+  800415:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80041a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80041f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  800424:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  800429:	74 1d                	je     800448 <strncmp+0x49>
+  80042b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80042f:	0f b6 00             	movzbl (%rax),%eax
+  800432:	84 c0                	test   %al,%al
+  800434:	74 12                	je     800448 <strncmp+0x49>
+  800436:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80043a:	0f b6 10             	movzbl (%rax),%edx
+  80043d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800441:	0f b6 00             	movzbl (%rax),%eax
+  800444:	38 c2                	cmp    %al,%dl
+  800446:	74 cd                	je     800415 <strncmp+0x16>
+	if (n == 0)
+  800448:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80044d:	75 07                	jne    800456 <strncmp+0x57>
+		return 0;
+  80044f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800454:	eb 16                	jmp    80046c <strncmp+0x6d>
+	else
+		return (int)((unsigned char)*p - (unsigned char)*q);
+  800456:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80045a:	0f b6 00             	movzbl (%rax),%eax
+  80045d:	0f b6 d0             	movzbl %al,%edx
+  800460:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800464:	0f b6 00             	movzbl (%rax),%eax
+  800467:	0f b6 c0             	movzbl %al,%eax
+  80046a:	29 c2                	sub    %eax,%edx
+}
+  80046c:	89 d0                	mov    %edx,%eax
+  80046e:	c9                   	leave
+  80046f:	c3                   	ret
+
+0000000000800470 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800470:	55                   	push   %rbp
+  800471:	48 89 e5             	mov    %rsp,%rbp
+  800474:	48 83 ec 10          	sub    $0x10,%rsp
+  800478:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80047c:	89 f0                	mov    %esi,%eax
+  80047e:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  800481:	eb 17                	jmp    80049a <strchr+0x2a>
+		if (*s == c)
+  800483:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800487:	0f b6 00             	movzbl (%rax),%eax
+  80048a:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80048d:	75 06                	jne    800495 <strchr+0x25>
+			return (char *)s;
+  80048f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800493:	eb 15                	jmp    8004aa <strchr+0x3a>
+	for (; *s; s++)
+  800495:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80049a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80049e:	0f b6 00             	movzbl (%rax),%eax
+  8004a1:	84 c0                	test   %al,%al
+  8004a3:	75 de                	jne    800483 <strchr+0x13>
+	return 0;
+  8004a5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8004aa:	c9                   	leave
+  8004ab:	c3                   	ret
+
+00000000008004ac <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8004ac:	55                   	push   %rbp
+  8004ad:	48 89 e5             	mov    %rsp,%rbp
+  8004b0:	48 83 ec 10          	sub    $0x10,%rsp
+  8004b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8004b8:	89 f0                	mov    %esi,%eax
+  8004ba:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8004bd:	eb 11                	jmp    8004d0 <strfind+0x24>
+		if (*s == c)
+  8004bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004c3:	0f b6 00             	movzbl (%rax),%eax
+  8004c6:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8004c9:	74 12                	je     8004dd <strfind+0x31>
+	for (; *s; s++)
+  8004cb:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8004d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004d4:	0f b6 00             	movzbl (%rax),%eax
+  8004d7:	84 c0                	test   %al,%al
+  8004d9:	75 e4                	jne    8004bf <strfind+0x13>
+  8004db:	eb 01                	jmp    8004de <strfind+0x32>
+			break;
+  8004dd:	90                   	nop
+	return (char *)s;
+  8004de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8004e2:	c9                   	leave
+  8004e3:	c3                   	ret
+
+00000000008004e4 <mem_init>:
+};
+
+static int mem_features;
+
+void mem_init(void)
+{
+  8004e4:	55                   	push   %rbp
+  8004e5:	48 89 e5             	mov    %rsp,%rbp
+  8004e8:	48 83 ec 10          	sub    $0x10,%rsp
+	uint32_t max, ebx, edx;
+
+	mem_features = 0;
+  8004ec:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  8004f3:	00 00 00 
+  8004f6:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	cpuid(0, &max, NULL, NULL, NULL);
+  8004fc:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+  800500:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800506:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80050b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800510:	48 89 c6             	mov    %rax,%rsi
+  800513:	bf 00 00 00 00       	mov    $0x0,%edi
+  800518:	48 b8 f0 00 80 00 00 	movabs $0x8000f0,%rax
+  80051f:	00 00 00 
+  800522:	ff d0                	call   *%rax
+	cpuid(1, NULL, NULL, NULL, &edx);
+  800524:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  800528:	49 89 c0             	mov    %rax,%r8
+  80052b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800530:	ba 00 00 00 00       	mov    $0x0,%edx
+  800535:	be 00 00 00 00       	mov    $0x0,%esi
+  80053a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80053f:	48 b8 f0 00 80 00 00 	movabs $0x8000f0,%rax
+  800546:	00 00 00 
+  800549:	ff d0                	call   *%rax
+	if (edx & (1 << 26))
+  80054b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80054e:	25 00 00 00 04       	and    $0x4000000,%eax
+  800553:	85 c0                	test   %eax,%eax
+  800555:	74 1d                	je     800574 <mem_init+0x90>
+		mem_features |= MEM_F_NT;
+  800557:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  80055e:	00 00 00 
+  800561:	8b 00                	mov    (%rax),%eax
+  800563:	83 c8 02             	or     $0x2,%eax
+  800566:	89 c2                	mov    %eax,%edx
+  800568:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  80056f:	00 00 00 
+  800572:	89 10                	mov    %edx,(%rax)
+	if (max >= 7)
+  800574:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800577:	83 f8 06             	cmp    $0x6,%eax
+  80057a:	76 57                	jbe    8005d3 <mem_init+0xef>
+	{
+		cpuid_count(7, 0, NULL, &ebx, NULL, NULL);
+  80057c:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  800580:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800586:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80058c:	48 89 c1             	mov    %rax,%rcx
+  80058f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800594:	be 00 00 00 00       	mov    $0x0,%esi
+  800599:	bf 07 00 00 00       	mov    $0x7,%edi
+  80059e:	48 b8 66 01 80 00 00 	movabs $0x800166,%rax
+  8005a5:	00 00 00 
+  8005a8:	ff d0                	call   *%rax
+		if (ebx & (1 << 9))
+  8005aa:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8005ad:	25 00 02 00 00       	and    $0x200,%eax
+  8005b2:	85 c0                	test   %eax,%eax
+  8005b4:	74 1d                	je     8005d3 <mem_init+0xef>
+			mem_features |= MEM_F_ERMS;
+  8005b6:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  8005bd:	00 00 00 
+  8005c0:	8b 00                	mov    (%rax),%eax
+  8005c2:	83 c8 01             	or     $0x1,%eax
+  8005c5:	89 c2                	mov    %eax,%edx
+  8005c7:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  8005ce:	00 00 00 
+  8005d1:	89 10                	mov    %edx,(%rax)
+	}
+}
+  8005d3:	90                   	nop
+  8005d4:	c9                   	leave
+  8005d5:	c3                   	ret
+
+00000000008005d6 <memset_nt>:
+
+// 非临时存储填充 n 字节(v 8 字节对齐，n 为 32 的倍数)
+static void
+memset_nt(void *v, uint64_t pattern, size_t n)
+{
+  8005d6:	55                   	push   %rbp
+  8005d7:	48 89 e5             	mov    %rsp,%rbp
+  8005da:	48 83 ec 28          	sub    $0x28,%rsp
+  8005de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8005e2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8005e6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t *p = (uint64_t *)v;
+  8005ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005ee:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint64_t *end = p + n / 8;
+  8005f2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8005f6:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  8005fa:	48 89 c2             	mov    %rax,%rdx
+  8005fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800601:	48 01 d0             	add    %rdx,%rax
+  800604:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	for (; p < end; p += 4)
+  800608:	eb 20                	jmp    80062a <memset_nt+0x54>
+		asm volatile("movnti %1, 0(%0)\n\t"
+  80060a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80060e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800612:	48 0f c3 10          	movnti %rdx,(%rax)
+  800616:	48 0f c3 50 08       	movnti %rdx,0x8(%rax)
+  80061b:	48 0f c3 50 10       	movnti %rdx,0x10(%rax)
+  800620:	48 0f c3 50 18       	movnti %rdx,0x18(%rax)
+	for (; p < end; p += 4)
+  800625:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  80062a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80062e:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  800632:	72 d6                	jb     80060a <memset_nt+0x34>
+					 "movnti %1, 16(%0)\n\t"
+					 "movnti %1, 24(%0)"
+					 :
+					 : "r"(p), "r"(pattern)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  800634:	0f ae f8             	sfence
+}
+  800637:	90                   	nop
+  800638:	c9                   	leave
+  800639:	c3                   	ret
+
+000000000080063a <memcpy_nt>:
+
+// 非临时存储复制 n 字节(dst/src 8 字节对齐且不重叠，n 为 32 的倍数)
+static void
+memcpy_nt(void *dst, const void *src, size_t n)
+{
+  80063a:	55                   	push   %rbp
+  80063b:	48 89 e5             	mov    %rsp,%rbp
+  80063e:	48 83 ec 58          	sub    $0x58,%rsp
+  800642:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  800646:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  80064a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	uint64_t *d = (uint64_t *)dst;
+  80064e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  800652:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint64_t *s = (const uint64_t *)src;
+  800656:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80065a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	uint64_t *end = d + n / 8;
+  80065e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800662:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  800666:	48 89 c2             	mov    %rax,%rdx
+  800669:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80066d:	48 01 d0             	add    %rdx,%rax
+  800670:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint64_t t0, t1, t2, t3;
+
+	for (; d < end; d += 4, s += 4)
+  800674:	eb 44                	jmp    8006ba <memcpy_nt+0x80>
+		asm volatile("movq 0(%4), %0\n\t"
+  800676:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80067a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80067e:	4c 8b 00             	mov    (%rax),%r8
+  800681:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  800685:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  800689:	48 8b 48 18          	mov    0x18(%rax),%rcx
+  80068d:	4c 0f c3 02          	movnti %r8,(%rdx)
+  800691:	48 0f c3 7a 08       	movnti %rdi,0x8(%rdx)
+  800696:	48 0f c3 72 10       	movnti %rsi,0x10(%rdx)
+  80069b:	48 0f c3 4a 18       	movnti %rcx,0x18(%rdx)
+  8006a0:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8006a4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8006a8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8006ac:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+	for (; d < end; d += 4, s += 4)
+  8006b0:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  8006b5:	48 83 45 f0 20       	addq   $0x20,-0x10(%rbp)
+  8006ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006be:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  8006c2:	72 b2                	jb     800676 <memcpy_nt+0x3c>
+					 "movnti %2, 16(%5)\n\t"
+					 "movnti %3, 24(%5)"
+					 : "=&r"(t0), "=&r"(t1), "=&r"(t2), "=&r"(t3)
+					 : "r"(s), "r"(d)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  8006c4:	0f ae f8             	sfence
+}
+  8006c7:	90                   	nop
+  8006c8:	c9                   	leave
+  8006c9:	c3                   	ret
+
+00000000008006ca <memcpy_fwd>:
+
+// 正向复制(dst 在 src 之前或两者不重叠)
+static void
+memcpy_fwd(void *dst, const void *src, size_t n)
+{
+  8006ca:	55                   	push   %rbp
+  8006cb:	48 89 e5             	mov    %rsp,%rbp
+  8006ce:	48 83 ec 18          	sub    $0x18,%rsp
+  8006d2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006d6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8006da:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  8006de:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  8006e5:	00 00 00 
+  8006e8:	8b 00                	mov    (%rax),%eax
+  8006ea:	83 e0 02             	and    $0x2,%eax
+  8006ed:	85 c0                	test   %eax,%eax
+  8006ef:	74 66                	je     800757 <memcpy_fwd+0x8d>
+  8006f1:	48 81 7d e8 ff 0f 00 	cmpq   $0xfff,-0x18(%rbp)
+  8006f8:	00 
+  8006f9:	76 5c                	jbe    800757 <memcpy_fwd+0x8d>
+  8006fb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800703:	48 09 d0             	or     %rdx,%rax
+  800706:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  80070a:	83 e0 1f             	and    $0x1f,%eax
+  80070d:	48 85 c0             	test   %rax,%rax
+  800710:	75 45                	jne    800757 <memcpy_fwd+0x8d>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  800712:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800716:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80071a:	48 01 d0             	add    %rdx,%rax
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  80071d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800721:	73 11                	jae    800734 <memcpy_fwd+0x6a>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  800723:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800727:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80072b:	48 01 d0             	add    %rdx,%rax
+  80072e:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  800732:	72 23                	jb     800757 <memcpy_fwd+0x8d>
+		memcpy_nt(dst, src, n);
+  800734:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800738:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80073c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800740:	48 89 ce             	mov    %rcx,%rsi
+  800743:	48 89 c7             	mov    %rax,%rdi
+  800746:	48 b8 3a 06 80 00 00 	movabs $0x80063a,%rax
+  80074d:	00 00 00 
+  800750:	ff d0                	call   *%rax
+  800752:	e9 81 00 00 00       	jmp    8007d8 <memcpy_fwd+0x10e>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  800757:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  80075e:	00 00 00 
+  800761:	8b 00                	mov    (%rax),%eax
+  800763:	83 e0 01             	and    $0x1,%eax
+  800766:	85 c0                	test   %eax,%eax
+  800768:	74 21                	je     80078b <memcpy_fwd+0xc1>
+  80076a:	48 81 7d e8 ff 00 00 	cmpq   $0xff,-0x18(%rbp)
+  800771:	00 
+  800772:	76 17                	jbe    80078b <memcpy_fwd+0xc1>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  800774:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800778:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80077c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800780:	48 89 c7             	mov    %rax,%rdi
+  800783:	48 89 d6             	mov    %rdx,%rsi
+  800786:	fc                   	cld
+  800787:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800789:	eb 4d                	jmp    8007d8 <memcpy_fwd+0x10e>
+					 : "cc", "memory");
+	else if ((((uint64_t)dst | (uint64_t)src | n) & 7) == 0)
+  80078b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80078f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800793:	48 09 d0             	or     %rdx,%rax
+  800796:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  80079a:	83 e0 07             	and    $0x7,%eax
+  80079d:	48 85 c0             	test   %rax,%rax
+  8007a0:	75 1f                	jne    8007c1 <memcpy_fwd+0xf7>
+		asm volatile("cld; rep movsq\n" ::"D"(dst), "S"(src), "c"(n / 8)
+  8007a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007a6:	48 c1 e8 03          	shr    $0x3,%rax
+  8007aa:	48 89 c1             	mov    %rax,%rcx
+  8007ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007b1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8007b5:	48 89 c7             	mov    %rax,%rdi
+  8007b8:	48 89 d6             	mov    %rdx,%rsi
+  8007bb:	fc                   	cld
+  8007bc:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+					 : "cc", "memory");
+}
+  8007bf:	eb 17                	jmp    8007d8 <memcpy_fwd+0x10e>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  8007c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007c5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8007c9:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8007cd:	48 89 c7             	mov    %rax,%rdi
+  8007d0:	48 89 d6             	mov    %rdx,%rsi
+  8007d3:	fc                   	cld
+  8007d4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+  8007d6:	eb 00                	jmp    8007d8 <memcpy_fwd+0x10e>
+  8007d8:	90                   	nop
+  8007d9:	c9                   	leave
+  8007da:	c3                   	ret
+
+00000000008007db <memset>:
+
+void *
+memset(void *v, int c, size_t n)
+{
+  8007db:	55                   	push   %rbp
+  8007dc:	48 89 e5             	mov    %rsp,%rbp
+  8007df:	48 83 ec 28          	sub    $0x28,%rsp
+  8007e3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8007e7:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8007ea:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t pattern;
+
+	if (n == 0)
+  8007ee:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8007f3:	75 09                	jne    8007fe <memset+0x23>
+		return v;
+  8007f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007f9:	e9 dc 00 00 00       	jmp    8008da <memset+0xff>
+	c &= 0xFF;
+  8007fe:	81 65 e4 ff 00 00 00 	andl   $0xff,-0x1c(%rbp)
+	pattern = (uint64_t)c * 0x0101010101010101UL;
+  800805:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800808:	48 98                	cltq
+  80080a:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  800811:	01 01 01 
+  800814:	48 0f af c2          	imul   %rdx,%rax
+  800818:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)v | n) & 31) == 0)
+  80081c:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  800823:	00 00 00 
+  800826:	8b 00                	mov    (%rax),%eax
+  800828:	83 e0 02             	and    $0x2,%eax
+  80082b:	85 c0                	test   %eax,%eax
+  80082d:	74 3a                	je     800869 <memset+0x8e>
+  80082f:	48 81 7d d8 ff 0f 00 	cmpq   $0xfff,-0x28(%rbp)
+  800836:	00 
+  800837:	76 30                	jbe    800869 <memset+0x8e>
+  800839:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80083d:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  800841:	83 e0 1f             	and    $0x1f,%eax
+  800844:	48 85 c0             	test   %rax,%rax
+  800847:	75 20                	jne    800869 <memset+0x8e>
+		memset_nt(v, pattern, n);
+  800849:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80084d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800851:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800855:	48 89 ce             	mov    %rcx,%rsi
+  800858:	48 89 c7             	mov    %rax,%rdi
+  80085b:	48 b8 d6 05 80 00 00 	movabs $0x8005d6,%rax
+  800862:	00 00 00 
+  800865:	ff d0                	call   *%rax
+  800867:	eb 6d                	jmp    8008d6 <memset+0xfb>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  800869:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  800870:	00 00 00 
+  800873:	8b 00                	mov    (%rax),%eax
+  800875:	83 e0 01             	and    $0x1,%eax
+  800878:	85 c0                	test   %eax,%eax
+  80087a:	74 1d                	je     800899 <memset+0xbe>
+  80087c:	48 81 7d d8 ff 00 00 	cmpq   $0xff,-0x28(%rbp)
+  800883:	00 
+  800884:	76 13                	jbe    800899 <memset+0xbe>
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  800886:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80088a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80088d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  800891:	48 89 d7             	mov    %rdx,%rdi
+  800894:	fc                   	cld
+  800895:	f3 aa                	rep stos %al,%es:(%rdi)
+  800897:	eb 3d                	jmp    8008d6 <memset+0xfb>
+					 : "cc", "memory");
+	else if ((((uint64_t)v | n) & 7) == 0)
+  800899:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80089d:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  8008a1:	83 e0 07             	and    $0x7,%eax
+  8008a4:	48 85 c0             	test   %rax,%rax
+  8008a7:	75 1c                	jne    8008c5 <memset+0xea>
+		asm volatile("cld; rep stosq\n" ::"D"(v), "a"(pattern), "c"(n / 8)
+  8008a9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8008ad:	48 c1 e8 03          	shr    $0x3,%rax
+  8008b1:	48 89 c1             	mov    %rax,%rcx
+  8008b4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008bc:	48 89 d7             	mov    %rdx,%rdi
+  8008bf:	fc                   	cld
+  8008c0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8008c3:	eb 11                	jmp    8008d6 <memset+0xfb>
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  8008c5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008c9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8008cc:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8008d0:	48 89 d7             	mov    %rdx,%rdi
+  8008d3:	fc                   	cld
+  8008d4:	f3 aa                	rep stos %al,%es:(%rdi)
+					 : "cc", "memory");
+	return v;
+  8008d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8008da:	c9                   	leave
+  8008db:	c3                   	ret
+
+00000000008008dc <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008dc:	55                   	push   %rbp
+  8008dd:	48 89 e5             	mov    %rsp,%rbp
+  8008e0:	48 83 ec 28          	sub    $0x28,%rsp
+  8008e4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8008e8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8008ec:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  8008f0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8008f4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8008f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008fc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d)
+  800900:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800904:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  800908:	73 7c                	jae    800986 <memmove+0xaa>
+  80090a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80090e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800912:	48 01 d0             	add    %rdx,%rax
+  800915:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  800919:	73 6b                	jae    800986 <memmove+0xaa>
+	{
+		// 重叠且 dst 在 src 之后，只能反向复制(ERMS 对反向 rep movsb 没有优化)
+		s += n;
+  80091b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80091f:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  800923:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800927:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((((uint64_t)s | (uint64_t)d | n) & 7) == 0)
+  80092b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80092f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800933:	48 09 d0             	or     %rdx,%rax
+  800936:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  80093a:	83 e0 07             	and    $0x7,%eax
+  80093d:	48 85 c0             	test   %rax,%rax
+  800940:	75 24                	jne    800966 <memmove+0x8a>
+			asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800942:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800946:	48 83 e8 08          	sub    $0x8,%rax
+  80094a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80094e:	48 83 ea 08          	sub    $0x8,%rdx
+  800952:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  800956:	48 c1 e9 03          	shr    $0x3,%rcx
+  80095a:	48 89 c7             	mov    %rax,%rdi
+  80095d:	48 89 d6             	mov    %rdx,%rsi
+  800960:	fd                   	std
+  800961:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800964:	eb 1d                	jmp    800983 <memmove+0xa7>
+						 : "cc", "memory");
+		else
+			asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800966:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80096a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80096e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800972:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+  800976:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80097a:	48 89 d7             	mov    %rdx,%rdi
+  80097d:	48 89 c1             	mov    %rax,%rcx
+  800980:	fd                   	std
+  800981:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+						 : "cc", "memory");
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::
+  800983:	fc                   	cld
+  800984:	eb 25                	jmp    8009ab <memmove+0xcf>
+						 : "cc");
+	}
+	else if (n)
+  800986:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80098b:	74 1e                	je     8009ab <memmove+0xcf>
+		memcpy_fwd(d, s, n);
+  80098d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800991:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800995:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800999:	48 89 ce             	mov    %rcx,%rsi
+  80099c:	48 89 c7             	mov    %rax,%rdi
+  80099f:	48 b8 ca 06 80 00 00 	movabs $0x8006ca,%rax
+  8009a6:	00 00 00 
+  8009a9:	ff d0                	call   *%rax
+	return dst;
+  8009ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8009af:	c9                   	leave
+  8009b0:	c3                   	ret
+
+00000000008009b1 <memcpy>:
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009b1:	55                   	push   %rbp
+  8009b2:	48 89 e5             	mov    %rsp,%rbp
+  8009b5:	48 83 ec 18          	sub    $0x18,%rsp
+  8009b9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8009bd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8009c1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (n)
+  8009c5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8009ca:	74 1e                	je     8009ea <memcpy+0x39>
+		memcpy_fwd(dst, src, n);
+  8009cc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009d0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8009d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009d8:	48 89 ce             	mov    %rcx,%rsi
+  8009db:	48 89 c7             	mov    %rax,%rdi
+  8009de:	48 b8 ca 06 80 00 00 	movabs $0x8006ca,%rax
+  8009e5:	00 00 00 
+  8009e8:	ff d0                	call   *%rax
+	return dst;
+  8009ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8009ee:	c9                   	leave
+  8009ef:	c3                   	ret
+
+00000000008009f0 <memcmp>:
+{
+}
+#endif
+
+int memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009f0:	55                   	push   %rbp
+  8009f1:	48 89 e5             	mov    %rsp,%rbp
+  8009f4:	48 83 ec 28          	sub    $0x28,%rsp
+  8009f8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8009fc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800a00:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *)v1;
+  800a04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a08:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *)v2;
+  800a0c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800a10:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0)
+  800a14:	eb 34                	jmp    800a4a <memcmp+0x5a>
+	{
+		if (*s1 != *s2)
+  800a16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a1a:	0f b6 10             	movzbl (%rax),%edx
+  800a1d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800a21:	0f b6 00             	movzbl (%rax),%eax
+  800a24:	38 c2                	cmp    %al,%dl
+  800a26:	74 18                	je     800a40 <memcmp+0x50>
+			return (int)*s1 - (int)*s2;
+  800a28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a2c:	0f b6 00             	movzbl (%rax),%eax
+  800a2f:	0f b6 d0             	movzbl %al,%edx
+  800a32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800a36:	0f b6 00             	movzbl (%rax),%eax
+  800a39:	0f b6 c0             	movzbl %al,%eax
+  800a3c:	29 c2                	sub    %eax,%edx
+  800a3e:	eb 20                	jmp    800a60 <memcmp+0x70>
+		s1++, s2++;
+  800a40:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800a45:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0)
+  800a4a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a4e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800a52:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800a56:	48 85 c0             	test   %rax,%rax
+  800a59:	75 bb                	jne    800a16 <memcmp+0x26>
+	}
+
+	return 0;
+  800a5b:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  800a60:	89 d0                	mov    %edx,%eax
+  800a62:	c9                   	leave
+  800a63:	c3                   	ret
+
+0000000000800a64 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a64:	55                   	push   %rbp
+  800a65:	48 89 e5             	mov    %rsp,%rbp
+  800a68:	48 83 ec 28          	sub    $0x28,%rsp
+  800a6c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a70:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  800a73:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *)s + n;
+  800a77:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a7b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a7f:	48 01 d0             	add    %rdx,%rax
+  800a82:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  800a86:	eb 13                	jmp    800a9b <memfind+0x37>
+		if (*(const unsigned char *)s == (unsigned char)c)
+  800a88:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a8c:	0f b6 00             	movzbl (%rax),%eax
+  800a8f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800a92:	38 d0                	cmp    %dl,%al
+  800a94:	74 11                	je     800aa7 <memfind+0x43>
+	for (; s < ends; s++)
+  800a96:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800a9b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a9f:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  800aa3:	72 e3                	jb     800a88 <memfind+0x24>
+  800aa5:	eb 01                	jmp    800aa8 <memfind+0x44>
+			break;
+  800aa7:	90                   	nop
+	return (void *)s;
+  800aa8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  800aac:	c9                   	leave
+  800aad:	c3                   	ret
+
+0000000000800aae <strtol>:
+
+long strtol(const char *s, char **endptr, int base)
+{
+  800aae:	55                   	push   %rbp
+  800aaf:	48 89 e5             	mov    %rsp,%rbp
+  800ab2:	48 83 ec 38          	sub    $0x38,%rsp
+  800ab6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800aba:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  800abe:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  800ac1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  800ac8:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  800acf:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ad0:	eb 05                	jmp    800ad7 <strtol+0x29>
+		s++;
+  800ad2:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  800ad7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800adb:	0f b6 00             	movzbl (%rax),%eax
+  800ade:	3c 20                	cmp    $0x20,%al
+  800ae0:	74 f0                	je     800ad2 <strtol+0x24>
+  800ae2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ae6:	0f b6 00             	movzbl (%rax),%eax
+  800ae9:	3c 09                	cmp    $0x9,%al
+  800aeb:	74 e5                	je     800ad2 <strtol+0x24>
+
+	// plus/minus sign
+	if (*s == '+')
+  800aed:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800af1:	0f b6 00             	movzbl (%rax),%eax
+  800af4:	3c 2b                	cmp    $0x2b,%al
+  800af6:	75 07                	jne    800aff <strtol+0x51>
+		s++;
+  800af8:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  800afd:	eb 17                	jmp    800b16 <strtol+0x68>
+	else if (*s == '-')
+  800aff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b03:	0f b6 00             	movzbl (%rax),%eax
+  800b06:	3c 2d                	cmp    $0x2d,%al
+  800b08:	75 0c                	jne    800b16 <strtol+0x68>
+		s++, neg = 1;
+  800b0a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  800b0f:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b16:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800b1a:	74 06                	je     800b22 <strtol+0x74>
+  800b1c:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  800b20:	75 28                	jne    800b4a <strtol+0x9c>
+  800b22:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b26:	0f b6 00             	movzbl (%rax),%eax
+  800b29:	3c 30                	cmp    $0x30,%al
+  800b2b:	75 1d                	jne    800b4a <strtol+0x9c>
+  800b2d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b31:	48 83 c0 01          	add    $0x1,%rax
+  800b35:	0f b6 00             	movzbl (%rax),%eax
+  800b38:	3c 78                	cmp    $0x78,%al
+  800b3a:	75 0e                	jne    800b4a <strtol+0x9c>
+		s += 2, base = 16;
+  800b3c:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  800b41:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  800b48:	eb 2c                	jmp    800b76 <strtol+0xc8>
+	else if (base == 0 && s[0] == '0')
+  800b4a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800b4e:	75 19                	jne    800b69 <strtol+0xbb>
+  800b50:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b54:	0f b6 00             	movzbl (%rax),%eax
+  800b57:	3c 30                	cmp    $0x30,%al
+  800b59:	75 0e                	jne    800b69 <strtol+0xbb>
+		s++, base = 8;
+  800b5b:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  800b60:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  800b67:	eb 0d                	jmp    800b76 <strtol+0xc8>
+	else if (base == 0)
+  800b69:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800b6d:	75 07                	jne    800b76 <strtol+0xc8>
+		base = 10;
+  800b6f:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+	// digits
+	while (1)
+	{
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  800b76:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b7a:	0f b6 00             	movzbl (%rax),%eax
+  800b7d:	3c 2f                	cmp    $0x2f,%al
+  800b7f:	7e 1d                	jle    800b9e <strtol+0xf0>
+  800b81:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b85:	0f b6 00             	movzbl (%rax),%eax
+  800b88:	3c 39                	cmp    $0x39,%al
+  800b8a:	7f 12                	jg     800b9e <strtol+0xf0>
+			dig = *s - '0';
+  800b8c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b90:	0f b6 00             	movzbl (%rax),%eax
+  800b93:	0f be c0             	movsbl %al,%eax
+  800b96:	83 e8 30             	sub    $0x30,%eax
+  800b99:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800b9c:	eb 4e                	jmp    800bec <strtol+0x13e>
+		else if (*s >= 'a' && *s <= 'z')
+  800b9e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ba2:	0f b6 00             	movzbl (%rax),%eax
+  800ba5:	3c 60                	cmp    $0x60,%al
+  800ba7:	7e 1d                	jle    800bc6 <strtol+0x118>
+  800ba9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bad:	0f b6 00             	movzbl (%rax),%eax
+  800bb0:	3c 7a                	cmp    $0x7a,%al
+  800bb2:	7f 12                	jg     800bc6 <strtol+0x118>
+			dig = *s - 'a' + 10;
+  800bb4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bb8:	0f b6 00             	movzbl (%rax),%eax
+  800bbb:	0f be c0             	movsbl %al,%eax
+  800bbe:	83 e8 57             	sub    $0x57,%eax
+  800bc1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800bc4:	eb 26                	jmp    800bec <strtol+0x13e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bc6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bca:	0f b6 00             	movzbl (%rax),%eax
+  800bcd:	3c 40                	cmp    $0x40,%al
+  800bcf:	7e 47                	jle    800c18 <strtol+0x16a>
+  800bd1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bd5:	0f b6 00             	movzbl (%rax),%eax
+  800bd8:	3c 5a                	cmp    $0x5a,%al
+  800bda:	7f 3c                	jg     800c18 <strtol+0x16a>
+			dig = *s - 'A' + 10;
+  800bdc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800be0:	0f b6 00             	movzbl (%rax),%eax
+  800be3:	0f be c0             	movsbl %al,%eax
+  800be6:	83 e8 37             	sub    $0x37,%eax
+  800be9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  800bec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800bef:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  800bf2:	7d 23                	jge    800c17 <strtol+0x169>
+			break;
+		s++, val = (val * base) + dig;
+  800bf4:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  800bf9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800bfc:	48 98                	cltq
+  800bfe:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  800c03:	48 89 c2             	mov    %rax,%rdx
+  800c06:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800c09:	48 98                	cltq
+  800c0b:	48 01 d0             	add    %rdx,%rax
+  800c0e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+  800c12:	e9 5f ff ff ff       	jmp    800b76 <strtol+0xc8>
+			break;
+  800c17:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c18:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800c1d:	74 0b                	je     800c2a <strtol+0x17c>
+		*endptr = (char *)s;
+  800c1f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c23:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800c27:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  800c2a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800c2e:	74 09                	je     800c39 <strtol+0x18b>
+  800c30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c34:	48 f7 d8             	neg    %rax
+  800c37:	eb 04                	jmp    800c3d <strtol+0x18f>
+  800c39:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  800c3d:	c9                   	leave
+  800c3e:	c3                   	ret
+
+0000000000800c3f <strstr>:
+
+char *strstr(const char *in, const char *str)
+{
+  800c3f:	55                   	push   %rbp
+  800c40:	48 89 e5             	mov    %rsp,%rbp
+  800c43:	48 83 ec 30          	sub    $0x30,%rsp
+  800c47:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800c4b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  800c4f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c53:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c57:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800c5b:	0f b6 00             	movzbl (%rax),%eax
+  800c5e:	88 45 ff             	mov    %al,-0x1(%rbp)
+	if (!c)
+  800c61:	80 7d ff 00          	cmpb   $0x0,-0x1(%rbp)
+  800c65:	75 06                	jne    800c6d <strstr+0x2e>
+		return (char *)in; // Trivial empty string case
+  800c67:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c6b:	eb 6b                	jmp    800cd8 <strstr+0x99>
+
+	len = strlen(str);
+  800c6d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c71:	48 89 c7             	mov    %rax,%rdi
+  800c74:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  800c7b:	00 00 00 
+  800c7e:	ff d0                	call   *%rax
+  800c80:	48 98                	cltq
+  800c82:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+		char sc;
+
+		do
+		{
+			sc = *in++;
+  800c86:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c8a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c8e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800c92:	0f b6 00             	movzbl (%rax),%eax
+  800c95:	88 45 ef             	mov    %al,-0x11(%rbp)
+			if (!sc)
+  800c98:	80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+  800c9c:	75 07                	jne    800ca5 <strstr+0x66>
+				return (char *)0;
+  800c9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca3:	eb 33                	jmp    800cd8 <strstr+0x99>
+		} while (sc != c);
+  800ca5:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+  800ca9:	3a 45 ff             	cmp    -0x1(%rbp),%al
+  800cac:	75 d8                	jne    800c86 <strstr+0x47>
+	} while (strncmp(in, str, len) != 0);
+  800cae:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800cb2:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  800cb6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800cba:	48 89 ce             	mov    %rcx,%rsi
+  800cbd:	48 89 c7             	mov    %rax,%rdi
+  800cc0:	48 b8 ff 03 80 00 00 	movabs $0x8003ff,%rax
+  800cc7:	00 00 00 
+  800cca:	ff d0                	call   *%rax
+  800ccc:	85 c0                	test   %eax,%eax
+  800cce:	75 b6                	jne    800c86 <strstr+0x47>
+
+	return (char *)(in - 1);
+  800cd0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800cd4:	48 83 e8 01          	sub    $0x1,%rax
+}
+  800cd8:	c9                   	leave
+  800cd9:	c3                   	ret
+
+0000000000800cda <syscall>:
+ * 用户的指令式系统调用，该函数将系统调用序号放入eax寄存器，五个参数依次放入edx, ecx, ebx, edi, esi，然后执行指令int 0x30，
+ * 发生中断后，去IDT中查找中断处理函数，最终会走到kern/trap.c的trap_dispatch()中
+ */
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  800cda:	55                   	push   %rbp
+  800cdb:	48 89 e5             	mov    %rsp,%rbp
+  800cde:	53                   	push   %rbx
+  800cdf:	48 83 ec 48          	sub    $0x48,%rsp
+  800ce3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800ce6:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  800ce9:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800ced:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800cf1:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  800cf5:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	 * volatile 告诉汇编程序不要因为不使用返回值就优化该指令
+	 * 最后一个子句告诉汇编程序，指令可能会改变条件代码cx和任意内存memory位置
+	 * 由汇编编译器做好数据保存和恢复工作(栈)
+	 */
+
+	asm volatile("int %1\n"			// code: int T_SYSCALL
+  800cf9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800cfc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800d00:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  800d04:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  800d08:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  800d0c:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  800d10:	4c 89 c3             	mov    %r8,%rbx
+  800d13:	cd 30                	int    $0x30
+  800d15:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+				   "D"(a4),			// edi = a4
+				   "S"(a5)			// esi = a5
+				 : "cc", "memory"); // 指令可能会改变条件代码cx和任意内存memory位置
+									// 由汇编编译器做好数据保存和恢复工作(栈)
+
+	if (check && ret > 0)
+  800d19:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800d1d:	74 44                	je     800d63 <syscall+0x89>
+  800d1f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  800d24:	7e 3d                	jle    800d63 <syscall+0x89>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d26:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d2a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800d2d:	49 89 d0             	mov    %rdx,%r8
+  800d30:	89 c1                	mov    %eax,%ecx
+  800d32:	48 b8 ca 21 80 00 00 	movabs $0x8021ca,%rax
+  800d39:	00 00 00 
+  800d3c:	48 89 c2             	mov    %rax,%rdx
+  800d3f:	be 34 00 00 00       	mov    $0x34,%esi
+  800d44:	48 b8 e7 21 80 00 00 	movabs $0x8021e7,%rax
+  800d4b:	00 00 00 
+  800d4e:	48 89 c7             	mov    %rax,%rdi
+  800d51:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d56:	49 b9 4d 14 80 00 00 	movabs $0x80144d,%r9
+  800d5d:	00 00 00 
+  800d60:	41 ff d1             	call   *%r9
+
+	return ret;
+  800d63:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  800d67:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800d6b:	c9                   	leave
+  800d6c:	c3                   	ret
+
+0000000000800d6d <sys_cputs>:
+
+void sys_cputs(const char *s, size_t len)
+{
+  800d6d:	55                   	push   %rbp
+  800d6e:	48 89 e5             	mov    %rsp,%rbp
+  800d71:	48 83 ec 10          	sub    $0x10,%rsp
+  800d75:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800d79:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 调用lib/syscall.c中的syscall()
+	// SYS_cputs: 系统调用序号(eax)，s: 需要输出的字符数组，len: 数组长度
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  800d7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d81:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800d85:	48 83 ec 08          	sub    $0x8,%rsp
+  800d89:	6a 00                	push   $0x0
+  800d8b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800d91:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800d97:	48 89 d1             	mov    %rdx,%rcx
+  800d9a:	48 89 c2             	mov    %rax,%rdx
+  800d9d:	be 00 00 00 00       	mov    $0x0,%esi
+  800da2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800da7:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  800dae:	00 00 00 
+  800db1:	ff d0                	call   *%rax
+  800db3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800db7:	90                   	nop
+  800db8:	c9                   	leave
+  800db9:	c3                   	ret
+
+0000000000800dba <sys_cgetc>:
+
+int sys_cgetc(void)
+{
+  800dba:	55                   	push   %rbp
+  800dbb:	48 89 e5             	mov    %rsp,%rbp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800dbe:	48 83 ec 08          	sub    $0x8,%rsp
+  800dc2:	6a 00                	push   $0x0
+  800dc4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800dca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800dd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dd5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dda:	be 00 00 00 00       	mov    $0x0,%esi
+  800ddf:	bf 01 00 00 00       	mov    $0x1,%edi
+  800de4:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  800deb:	00 00 00 
+  800dee:	ff d0                	call   *%rax
+  800df0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800df4:	c9                   	leave
+  800df5:	c3                   	ret
+
+0000000000800df6 <sys_env_destroy>:
+
+int sys_env_destroy(envid_t envid)
+{
+  800df6:	55                   	push   %rbp
+  800df7:	48 89 e5             	mov    %rsp,%rbp
+  800dfa:	48 83 ec 10          	sub    $0x10,%rsp
+  800dfe:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	// 销毁envid对应的环境
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800e01:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e04:	48 98                	cltq
+  800e06:	48 83 ec 08          	sub    $0x8,%rsp
+  800e0a:	6a 00                	push   $0x0
+  800e0c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800e12:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e18:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e1d:	48 89 c2             	mov    %rax,%rdx
+  800e20:	be 01 00 00 00       	mov    $0x1,%esi
+  800e25:	bf 03 00 00 00       	mov    $0x3,%edi
+  800e2a:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  800e31:	00 00 00 
+  800e34:	ff d0                	call   *%rax
+  800e36:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800e3a:	c9                   	leave
+  800e3b:	c3                   	ret
+
+0000000000800e3c <sys_getprocid>:
+
+envid_t
+sys_getprocid(void)
+{
+  800e3c:	55                   	push   %rbp
+  800e3d:	48 89 e5             	mov    %rsp,%rbp
+	// 获取当前用户环境id
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800e40:	48 83 ec 08          	sub    $0x8,%rsp
+  800e44:	6a 00                	push   $0x0
+  800e46:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800e4c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e52:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e57:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e5c:	be 00 00 00 00       	mov    $0x0,%esi
+  800e61:	bf 02 00 00 00       	mov    $0x2,%edi
+  800e66:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  800e6d:	00 00 00 
+  800e70:	ff d0                	call   *%rax
+  800e72:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800e76:	c9                   	leave
+  800e77:	c3                   	ret
+
+0000000000800e78 <sys_yield>:
+
+void sys_yield(void)
+{
+  800e78:	55                   	push   %rbp
+  800e79:	48 89 e5             	mov    %rsp,%rbp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  800e7c:	48 83 ec 08          	sub    $0x8,%rsp
+  800e80:	6a 00                	push   $0x0
+  800e82:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800e88:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e93:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e98:	be 00 00 00 00       	mov    $0x0,%esi
+  800e9d:	bf 0b 00 00 00       	mov    $0xb,%edi
+  800ea2:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  800ea9:	00 00 00 
+  800eac:	ff d0                	call   *%rax
+  800eae:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800eb2:	90                   	nop
+  800eb3:	c9                   	leave
+  800eb4:	c3                   	ret
+
+0000000000800eb5 <sys_page_alloc>:
+
+int sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800eb5:	55                   	push   %rbp
+  800eb6:	48 89 e5             	mov    %rsp,%rbp
+  800eb9:	48 83 ec 10          	sub    $0x10,%rsp
+  800ebd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800ec0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800ec4:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  800ec7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800eca:	48 63 c8             	movslq %eax,%rcx
+  800ecd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800ed1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ed4:	48 98                	cltq
+  800ed6:	48 83 ec 08          	sub    $0x8,%rsp
+  800eda:	6a 00                	push   $0x0
+  800edc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800ee2:	49 89 c8             	mov    %rcx,%r8
+  800ee5:	48 89 d1             	mov    %rdx,%rcx
+  800ee8:	48 89 c2             	mov    %rax,%rdx
+  800eeb:	be 01 00 00 00       	mov    $0x1,%esi
+  800ef0:	bf 04 00 00 00       	mov    $0x4,%edi
+  800ef5:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  800efc:	00 00 00 
+  800eff:	ff d0                	call   *%rax
+  800f01:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800f05:	c9                   	leave
+  800f06:	c3                   	ret
+
+0000000000800f07 <sys_page_map>:
+
+int sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f07:	55                   	push   %rbp
+  800f08:	48 89 e5             	mov    %rsp,%rbp
+  800f0b:	48 83 ec 20          	sub    $0x20,%rsp
+  800f0f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800f12:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800f16:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  800f19:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f1d:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  800f21:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800f24:	48 63 c8             	movslq %eax,%rcx
+  800f27:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  800f2b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800f2e:	48 63 f0             	movslq %eax,%rsi
+  800f31:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800f35:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800f38:	48 98                	cltq
+  800f3a:	48 83 ec 08          	sub    $0x8,%rsp
+  800f3e:	51                   	push   %rcx
+  800f3f:	49 89 f9             	mov    %rdi,%r9
+  800f42:	49 89 f0             	mov    %rsi,%r8
+  800f45:	48 89 d1             	mov    %rdx,%rcx
+  800f48:	48 89 c2             	mov    %rax,%rdx
+  800f4b:	be 01 00 00 00       	mov    $0x1,%esi
+  800f50:	bf 05 00 00 00       	mov    $0x5,%edi
+  800f55:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  800f5c:	00 00 00 
+  800f5f:	ff d0                	call   *%rax
+  800f61:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800f65:	c9                   	leave
+  800f66:	c3                   	ret
+
+0000000000800f67 <sys_page_unmap>:
+
+int sys_page_unmap(envid_t envid, void *va)
+{
+  800f67:	55                   	push   %rbp
+  800f68:	48 89 e5             	mov    %rsp,%rbp
+  800f6b:	48 83 ec 10          	sub    $0x10,%rsp
+  800f6f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800f72:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  800f76:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800f7a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800f7d:	48 98                	cltq
+  800f7f:	48 83 ec 08          	sub    $0x8,%rsp
+  800f83:	6a 00                	push   $0x0
+  800f85:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800f8b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f91:	48 89 d1             	mov    %rdx,%rcx
+  800f94:	48 89 c2             	mov    %rax,%rdx
+  800f97:	be 01 00 00 00       	mov    $0x1,%esi
+  800f9c:	bf 06 00 00 00       	mov    $0x6,%edi
+  800fa1:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  800fa8:	00 00 00 
+  800fab:	ff d0                	call   *%rax
+  800fad:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800fb1:	c9                   	leave
+  800fb2:	c3                   	ret
+
+0000000000800fb3 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int sys_env_set_status(envid_t envid, int status)
+{
+  800fb3:	55                   	push   %rbp
+  800fb4:	48 89 e5             	mov    %rsp,%rbp
+  800fb7:	48 83 ec 10          	sub    $0x10,%rsp
+  800fbb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800fbe:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  800fc1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800fc4:	48 63 d0             	movslq %eax,%rdx
+  800fc7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800fca:	48 98                	cltq
+  800fcc:	48 83 ec 08          	sub    $0x8,%rsp
+  800fd0:	6a 00                	push   $0x0
+  800fd2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800fd8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fde:	48 89 d1             	mov    %rdx,%rcx
+  800fe1:	48 89 c2             	mov    %rax,%rdx
+  800fe4:	be 01 00 00 00       	mov    $0x1,%esi
+  800fe9:	bf 08 00 00 00       	mov    $0x8,%edi
+  800fee:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  800ff5:	00 00 00 
+  800ff8:	ff d0                	call   *%rax
+  800ffa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800ffe:	c9                   	leave
+  800fff:	c3                   	ret
+
+0000000000801000 <sys_env_set_trapframe>:
+
+int sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801000:	55                   	push   %rbp
+  801001:	48 89 e5             	mov    %rsp,%rbp
+  801004:	48 83 ec 10          	sub    $0x10,%rsp
+  801008:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80100b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  80100f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801013:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801016:	48 98                	cltq
+  801018:	48 83 ec 08          	sub    $0x8,%rsp
+  80101c:	6a 00                	push   $0x0
+  80101e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801024:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80102a:	48 89 d1             	mov    %rdx,%rcx
+  80102d:	48 89 c2             	mov    %rax,%rdx
+  801030:	be 01 00 00 00       	mov    $0x1,%esi
+  801035:	bf 09 00 00 00       	mov    $0x9,%edi
+  80103a:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  801041:	00 00 00 
+  801044:	ff d0                	call   *%rax
+  801046:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80104a:	c9                   	leave
+  80104b:	c3                   	ret
+
+000000000080104c <sys_env_set_pgfault_upcall>:
+
+int sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80104c:	55                   	push   %rbp
+  80104d:	48 89 e5             	mov    %rsp,%rbp
+  801050:	48 83 ec 10          	sub    $0x10,%rsp
+  801054:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801057:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  80105b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80105f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801062:	48 98                	cltq
+  801064:	48 83 ec 08          	sub    $0x8,%rsp
+  801068:	6a 00                	push   $0x0
+  80106a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801070:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801076:	48 89 d1             	mov    %rdx,%rcx
+  801079:	48 89 c2             	mov    %rax,%rdx
+  80107c:	be 01 00 00 00       	mov    $0x1,%esi
+  801081:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801086:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  80108d:	00 00 00 
+  801090:	ff d0                	call   *%rax
+  801092:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801096:	c9                   	leave
+  801097:	c3                   	ret
+
+0000000000801098 <sys_ipc_try_send>:
+
+int sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  801098:	55                   	push   %rbp
+  801099:	48 89 e5             	mov    %rsp,%rbp
+  80109c:	48 83 ec 20          	sub    $0x20,%rsp
+  8010a0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8010a3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8010a7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8010ab:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8010ae:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8010b1:	48 63 f0             	movslq %eax,%rsi
+  8010b4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8010b8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8010bb:	48 98                	cltq
+  8010bd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8010c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8010c5:	6a 00                	push   $0x0
+  8010c7:	49 89 f1             	mov    %rsi,%r9
+  8010ca:	49 89 c8             	mov    %rcx,%r8
+  8010cd:	48 89 d1             	mov    %rdx,%rcx
+  8010d0:	48 89 c2             	mov    %rax,%rdx
+  8010d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d8:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8010dd:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  8010e4:	00 00 00 
+  8010e7:	ff d0                	call   *%rax
+  8010e9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8010ed:	c9                   	leave
+  8010ee:	c3                   	ret
+
+00000000008010ef <sys_ipc_recv>:
+
+int sys_ipc_recv(void *dstva)
+{
+  8010ef:	55                   	push   %rbp
+  8010f0:	48 89 e5             	mov    %rsp,%rbp
+  8010f3:	48 83 ec 10          	sub    $0x10,%rsp
+  8010f7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8010fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010ff:	48 83 ec 08          	sub    $0x8,%rsp
+  801103:	6a 00                	push   $0x0
+  801105:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80110b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801111:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801116:	48 89 c2             	mov    %rax,%rdx
+  801119:	be 01 00 00 00       	mov    $0x1,%esi
+  80111e:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801123:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  80112a:	00 00 00 
+  80112d:	ff d0                	call   *%rax
+  80112f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801133:	c9                   	leave
+  801134:	c3                   	ret
+
+0000000000801135 <sys_disk_io>:
+
+int sys_disk_io(int dev, uint64_t secno, void *va, size_t nsecs, int write)
+{
+  801135:	55                   	push   %rbp
+  801136:	48 89 e5             	mov    %rsp,%rbp
+  801139:	48 83 ec 20          	sub    $0x20,%rsp
+  80113d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801140:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801144:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801148:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  80114c:	44 89 45 f8          	mov    %r8d,-0x8(%rbp)
+	return syscall(SYS_disk_io, 0, dev, secno, (uint64_t)va, nsecs, write);
+  801150:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801153:	48 63 c8             	movslq %eax,%rcx
+  801156:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80115a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80115d:	48 98                	cltq
+  80115f:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  801163:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801167:	48 83 ec 08          	sub    $0x8,%rsp
+  80116b:	51                   	push   %rcx
+  80116c:	49 89 f9             	mov    %rdi,%r9
+  80116f:	49 89 f0             	mov    %rsi,%r8
+  801172:	48 89 d1             	mov    %rdx,%rcx
+  801175:	48 89 c2             	mov    %rax,%rdx
+  801178:	be 00 00 00 00       	mov    $0x0,%esi
+  80117d:	bf 0e 00 00 00       	mov    $0xe,%edi
+  801182:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  801189:	00 00 00 
+  80118c:	ff d0                	call   *%rax
+  80118e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801192:	c9                   	leave
+  801193:	c3                   	ret
+
+0000000000801194 <sys_vma_alloc>:
+
+int sys_vma_alloc(envid_t envid, void *va, size_t len, int perm)
+{
+  801194:	55                   	push   %rbp
+  801195:	48 89 e5             	mov    %rsp,%rbp
+  801198:	48 83 ec 20          	sub    $0x20,%rsp
+  80119c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80119f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8011a3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8011a7:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_vma_alloc, 1, envid, (uint64_t)va, len, perm, 0);
+  8011aa:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8011ad:	48 63 f0             	movslq %eax,%rsi
+  8011b0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8011b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8011b7:	48 98                	cltq
+  8011b9:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8011bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8011c1:	6a 00                	push   $0x0
+  8011c3:	49 89 f1             	mov    %rsi,%r9
+  8011c6:	49 89 c8             	mov    %rcx,%r8
+  8011c9:	48 89 d1             	mov    %rdx,%rcx
+  8011cc:	48 89 c2             	mov    %rax,%rdx
+  8011cf:	be 01 00 00 00       	mov    $0x1,%esi
+  8011d4:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8011d9:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  8011e0:	00 00 00 
+  8011e3:	ff d0                	call   *%rax
+  8011e5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8011e9:	c9                   	leave
+  8011ea:	c3                   	ret
+
+00000000008011eb <sys_vma_clear>:
+
+int sys_vma_clear(envid_t envid)
+{
+  8011eb:	55                   	push   %rbp
+  8011ec:	48 89 e5             	mov    %rsp,%rbp
+  8011ef:	48 83 ec 10          	sub    $0x10,%rsp
+  8011f3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_vma_clear, 1, envid, 0, 0, 0, 0);
+  8011f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8011f9:	48 98                	cltq
+  8011fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8011ff:	6a 00                	push   $0x0
+  801201:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801207:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80120d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801212:	48 89 c2             	mov    %rax,%rdx
+  801215:	be 01 00 00 00       	mov    $0x1,%esi
+  80121a:	bf 10 00 00 00       	mov    $0x10,%edi
+  80121f:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  801226:	00 00 00 
+  801229:	ff d0                	call   *%rax
+  80122b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80122f:	c9                   	leave
+  801230:	c3                   	ret
+
+0000000000801231 <sys_trace_ctl>:
+
+int sys_trace_ctl(int enable)
+{
+  801231:	55                   	push   %rbp
+  801232:	48 89 e5             	mov    %rsp,%rbp
+  801235:	48 83 ec 10          	sub    $0x10,%rsp
+  801239:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_trace_ctl, 0, enable, 0, 0, 0, 0);
+  80123c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80123f:	48 98                	cltq
+  801241:	48 83 ec 08          	sub    $0x8,%rsp
+  801245:	6a 00                	push   $0x0
+  801247:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80124d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801253:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801258:	48 89 c2             	mov    %rax,%rdx
+  80125b:	be 00 00 00 00       	mov    $0x0,%esi
+  801260:	bf 11 00 00 00       	mov    $0x11,%edi
+  801265:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  80126c:	00 00 00 
+  80126f:	ff d0                	call   *%rax
+  801271:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801275:	c9                   	leave
+  801276:	c3                   	ret
+
+0000000000801277 <sys_trace_read>:
+
+int sys_trace_read(int cpu, uint64_t *seq, struct TraceEvent *buf, int n)
+{
+  801277:	55                   	push   %rbp
+  801278:	48 89 e5             	mov    %rsp,%rbp
+  80127b:	48 83 ec 20          	sub    $0x20,%rsp
+  80127f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801282:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801286:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80128a:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_trace_read, 0, cpu, (uint64_t)seq, (uint64_t)buf, n, 0);
+  80128d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801290:	48 63 f0             	movslq %eax,%rsi
+  801293:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801297:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80129b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80129e:	48 98                	cltq
+  8012a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8012a4:	6a 00                	push   $0x0
+  8012a6:	49 89 f1             	mov    %rsi,%r9
+  8012a9:	49 89 c8             	mov    %rcx,%r8
+  8012ac:	48 89 d1             	mov    %rdx,%rcx
+  8012af:	48 89 c2             	mov    %rax,%rdx
+  8012b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b7:	bf 12 00 00 00       	mov    $0x12,%edi
+  8012bc:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  8012c3:	00 00 00 
+  8012c6:	ff d0                	call   *%rax
+  8012c8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8012cc:	c9                   	leave
+  8012cd:	c3                   	ret
+
+00000000008012ce <sys_getrusage>:
+
+int sys_getrusage(envid_t envid, struct Rusage *ru)
+{
+  8012ce:	55                   	push   %rbp
+  8012cf:	48 89 e5             	mov    %rsp,%rbp
+  8012d2:	48 83 ec 10          	sub    $0x10,%rsp
+  8012d6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8012d9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_getrusage, 0, envid, (uint64_t)ru, 0, 0, 0);
+  8012dd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8012e1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012e4:	48 98                	cltq
+  8012e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8012ea:	6a 00                	push   $0x0
+  8012ec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8012f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012f8:	48 89 d1             	mov    %rdx,%rcx
+  8012fb:	48 89 c2             	mov    %rax,%rdx
+  8012fe:	be 00 00 00 00       	mov    $0x0,%esi
+  801303:	bf 13 00 00 00       	mov    $0x13,%edi
+  801308:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  80130f:	00 00 00 
+  801312:	ff d0                	call   *%rax
+  801314:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801318:	c9                   	leave
+  801319:	c3                   	ret
+
+000000000080131a <sys_pmu_config>:
+
+int sys_pmu_config(int idx, uint64_t event)
+{
+  80131a:	55                   	push   %rbp
+  80131b:	48 89 e5             	mov    %rsp,%rbp
+  80131e:	48 83 ec 10          	sub    $0x10,%rsp
+  801322:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801325:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_pmu_config, 0, idx, event, 0, 0, 0);
+  801329:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80132c:	48 98                	cltq
+  80132e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801332:	48 83 ec 08          	sub    $0x8,%rsp
+  801336:	6a 00                	push   $0x0
+  801338:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80133e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801344:	48 89 d1             	mov    %rdx,%rcx
+  801347:	48 89 c2             	mov    %rax,%rdx
+  80134a:	be 00 00 00 00       	mov    $0x0,%esi
+  80134f:	bf 14 00 00 00       	mov    $0x14,%edi
+  801354:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  80135b:	00 00 00 
+  80135e:	ff d0                	call   *%rax
+  801360:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801364:	c9                   	leave
+  801365:	c3                   	ret
+
+0000000000801366 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  801366:	55                   	push   %rbp
+  801367:	48 89 e5             	mov    %rsp,%rbp
+  80136a:	48 83 ec 10          	sub    $0x10,%rsp
+  80136e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+  801371:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801374:	48 83 ec 08          	sub    $0x8,%rsp
+  801378:	6a 00                	push   $0x0
+  80137a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801380:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801386:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80138b:	48 89 c2             	mov    %rax,%rdx
+  80138e:	be 00 00 00 00       	mov    $0x0,%esi
+  801393:	bf 15 00 00 00       	mov    $0x15,%edi
+  801398:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  80139f:	00 00 00 
+  8013a2:	ff d0                	call   *%rax
+  8013a4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8013a8:	c9                   	leave
+  8013a9:	c3                   	ret
+
+00000000008013aa <sys_image_attach>:
+
+int sys_image_attach(envid_t envid, int dev, const uint64_t *secnos, size_t size)
+{
+  8013aa:	55                   	push   %rbp
+  8013ab:	48 89 e5             	mov    %rsp,%rbp
+  8013ae:	48 83 ec 20          	sub    $0x20,%rsp
+  8013b2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8013b5:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  8013b8:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8013bc:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+	return syscall(SYS_image_attach, 1, envid, dev, (uint64_t)secnos, size, 0);
+  8013c0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8013c4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8013c7:	48 63 d0             	movslq %eax,%rdx
+  8013ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8013cd:	48 98                	cltq
+  8013cf:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8013d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8013d7:	6a 00                	push   $0x0
+  8013d9:	49 89 f1             	mov    %rsi,%r9
+  8013dc:	49 89 c8             	mov    %rcx,%r8
+  8013df:	48 89 d1             	mov    %rdx,%rcx
+  8013e2:	48 89 c2             	mov    %rax,%rdx
+  8013e5:	be 01 00 00 00       	mov    $0x1,%esi
+  8013ea:	bf 16 00 00 00       	mov    $0x16,%edi
+  8013ef:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  8013f6:	00 00 00 
+  8013f9:	ff d0                	call   *%rax
+  8013fb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8013ff:	c9                   	leave
+  801400:	c3                   	ret
+
+0000000000801401 <sys_vma_binary>:
+
+int sys_vma_binary(envid_t envid, const struct Proghdr *ph)
+{
+  801401:	55                   	push   %rbp
+  801402:	48 89 e5             	mov    %rsp,%rbp
+  801405:	48 83 ec 10          	sub    $0x10,%rsp
+  801409:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80140c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_vma_binary, 1, envid, (uint64_t)ph, 0, 0, 0);
+  801410:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801414:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801417:	48 98                	cltq
+  801419:	48 83 ec 08          	sub    $0x8,%rsp
+  80141d:	6a 00                	push   $0x0
+  80141f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801425:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80142b:	48 89 d1             	mov    %rdx,%rcx
+  80142e:	48 89 c2             	mov    %rax,%rdx
+  801431:	be 01 00 00 00       	mov    $0x1,%esi
+  801436:	bf 17 00 00 00       	mov    $0x17,%edi
+  80143b:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  801442:	00 00 00 
+  801445:	ff d0                	call   *%rax
+  801447:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80144b:	c9                   	leave
+  80144c:	c3                   	ret
+
+000000000080144d <_panic>:
+/*
+ * 无法解决的致命错误会导致死机
+ * 打印"死机:<消息>”，然后导致处理器休眠进入HLT状态
+ */
+void _panic(const char *file, int line, const char *fmt, ...)
+{
+  80144d:	55                   	push   %rbp
+  80144e:	48 89 e5             	mov    %rsp,%rbp
+  801451:	53                   	push   %rbx
+  801452:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  801459:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  801460:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  801466:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  80146d:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  801474:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  80147b:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  801482:	84 c0                	test   %al,%al
+  801484:	74 23                	je     8014a9 <_panic+0x5c>
+  801486:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  80148d:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  801491:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  801495:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  801499:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  80149d:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  8014a1:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  8014a5:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8014a9:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  8014b0:	00 00 00 
+  8014b3:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  8014ba:	00 00 00 
+  8014bd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014c1:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  8014c8:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  8014cf:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+	// 输出死机的信息
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8014d6:	48 b8 00 30 80 00 00 	movabs $0x803000,%rax
+  8014dd:	00 00 00 
+  8014e0:	48 8b 18             	mov    (%rax),%rbx
+  8014e3:	48 b8 3c 0e 80 00 00 	movabs $0x800e3c,%rax
+  8014ea:	00 00 00 
+  8014ed:	ff d0                	call   *%rax
+  8014ef:	89 c6                	mov    %eax,%esi
+  8014f1:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  8014f7:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8014fe:	41 89 d0             	mov    %edx,%r8d
+  801501:	48 89 c1             	mov    %rax,%rcx
+  801504:	48 89 da             	mov    %rbx,%rdx
+  801507:	48 b8 f8 21 80 00 00 	movabs $0x8021f8,%rax
+  80150e:	00 00 00 
+  801511:	48 89 c7             	mov    %rax,%rdi
+  801514:	b8 00 00 00 00       	mov    $0x0,%eax
+  801519:	49 b9 90 16 80 00 00 	movabs $0x801690,%r9
+  801520:	00 00 00 
+  801523:	41 ff d1             	call   *%r9
+			sys_getprocid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801526:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  80152d:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801534:	48 89 d6             	mov    %rdx,%rsi
+  801537:	48 89 c7             	mov    %rax,%rdi
+  80153a:	48 b8 e1 15 80 00 00 	movabs $0x8015e1,%rax
+  801541:	00 00 00 
+  801544:	ff d0                	call   *%rax
+	cprintf("\n");
+  801546:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  80154d:	00 00 00 
+  801550:	48 89 c7             	mov    %rax,%rdi
+  801553:	b8 00 00 00 00       	mov    $0x0,%eax
+  801558:	48 ba 90 16 80 00 00 	movabs $0x801690,%rdx
+  80155f:	00 00 00 
+  801562:	ff d2                	call   *%rdx
+
+	// 触发断点中断
+	while (1)
+		asm volatile("int3");
+  801564:	cc                   	int3
+  801565:	eb fd                	jmp    801564 <_panic+0x117>
+
+0000000000801567 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801567:	55                   	push   %rbp
+  801568:	48 89 e5             	mov    %rsp,%rbp
+  80156b:	48 83 ec 10          	sub    $0x10,%rsp
+  80156f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801572:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->buf[b->idx++] = ch;
+  801576:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80157a:	8b 00                	mov    (%rax),%eax
+  80157c:	8d 48 01             	lea    0x1(%rax),%ecx
+  80157f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801583:	89 0a                	mov    %ecx,(%rdx)
+  801585:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801588:	89 d1                	mov    %edx,%ecx
+  80158a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80158e:	48 98                	cltq
+  801590:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+	if (b->idx == 256-1) {
+  801594:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801598:	8b 00                	mov    (%rax),%eax
+  80159a:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80159f:	75 2c                	jne    8015cd <putch+0x66>
+		sys_cputs(b->buf, b->idx);
+  8015a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015a5:	8b 00                	mov    (%rax),%eax
+  8015a7:	48 98                	cltq
+  8015a9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8015ad:	48 83 c2 08          	add    $0x8,%rdx
+  8015b1:	48 89 c6             	mov    %rax,%rsi
+  8015b4:	48 89 d7             	mov    %rdx,%rdi
+  8015b7:	48 b8 6d 0d 80 00 00 	movabs $0x800d6d,%rax
+  8015be:	00 00 00 
+  8015c1:	ff d0                	call   *%rax
+		b->idx = 0;
+  8015c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015c7:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	}
+	b->cnt++;
+  8015cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015d1:	8b 40 04             	mov    0x4(%rax),%eax
+  8015d4:	8d 50 01             	lea    0x1(%rax),%edx
+  8015d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015db:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8015de:	90                   	nop
+  8015df:	c9                   	leave
+  8015e0:	c3                   	ret
+
+00000000008015e1 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8015e1:	55                   	push   %rbp
+  8015e2:	48 89 e5             	mov    %rsp,%rbp
+  8015e5:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8015ec:	48 89 bd c8 fe ff ff 	mov    %rdi,-0x138(%rbp)
+  8015f3:	48 89 b5 c0 fe ff ff 	mov    %rsi,-0x140(%rbp)
+	struct printbuf b;
+	va_list aq;
+	va_copy(aq,ap);
+  8015fa:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  801601:	48 8b b5 c0 fe ff ff 	mov    -0x140(%rbp),%rsi
+  801608:	48 8b 06             	mov    (%rsi),%rax
+  80160b:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80160f:	48 89 01             	mov    %rax,(%rcx)
+  801612:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801616:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80161a:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	b.idx = 0;
+  80161e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  801625:	00 00 00 
+	b.cnt = 0;
+  801628:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80162f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, aq);
+  801632:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  801639:	48 8b 95 c8 fe ff ff 	mov    -0x138(%rbp),%rdx
+  801640:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  801647:	48 89 c6             	mov    %rax,%rsi
+  80164a:	48 b8 67 15 80 00 00 	movabs $0x801567,%rax
+  801651:	00 00 00 
+  801654:	48 89 c7             	mov    %rax,%rdi
+  801657:	48 b8 2e 1a 80 00 00 	movabs $0x801a2e,%rax
+  80165e:	00 00 00 
+  801661:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  801663:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  801669:	48 98                	cltq
+  80166b:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  801672:	48 83 c2 08          	add    $0x8,%rdx
+  801676:	48 89 c6             	mov    %rax,%rsi
+  801679:	48 89 d7             	mov    %rdx,%rdi
+  80167c:	48 b8 6d 0d 80 00 00 	movabs $0x800d6d,%rax
+  801683:	00 00 00 
+  801686:	ff d0                	call   *%rax
+	va_end(aq);
+
+	return b.cnt;
+  801688:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80168e:	c9                   	leave
+  80168f:	c3                   	ret
+
+0000000000801690 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  801690:	55                   	push   %rbp
+  801691:	48 89 e5             	mov    %rsp,%rbp
+  801694:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  80169b:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8016a2:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8016a9:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8016b0:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8016b7:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8016be:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8016c5:	84 c0                	test   %al,%al
+  8016c7:	74 20                	je     8016e9 <cprintf+0x59>
+  8016c9:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8016cd:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8016d1:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8016d5:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8016d9:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8016dd:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8016e1:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8016e5:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+	va_list aq;
+	va_start(ap, fmt);
+  8016e9:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8016f0:	00 00 00 
+  8016f3:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8016fa:	00 00 00 
+  8016fd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801701:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801708:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80170f:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  801716:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80171d:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801724:	48 8b 06             	mov    (%rsi),%rax
+  801727:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80172b:	48 89 01             	mov    %rax,(%rcx)
+  80172e:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801732:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801736:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	cnt = vcprintf(fmt, aq);
+  80173a:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  801741:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801748:	48 89 d6             	mov    %rdx,%rsi
+  80174b:	48 89 c7             	mov    %rax,%rdi
+  80174e:	48 b8 e1 15 80 00 00 	movabs $0x8015e1,%rax
+  801755:	00 00 00 
+  801758:	ff d0                	call   *%rax
+  80175a:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return cnt;
+  801760:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801766:	c9                   	leave
+  801767:	c3                   	ret
+
+0000000000801768 <printnum>:
+ * num: 需要打印出来的整型数，base: 整型数的进制，其他参数同 vprintfmt
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+		 unsigned long long num, unsigned base, int width, int padc)
+{
+  801768:	55                   	push   %rbp
+  801769:	48 89 e5             	mov    %rsp,%rbp
+  80176c:	48 83 ec 30          	sub    $0x30,%rsp
+  801770:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801774:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801778:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80177c:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  80177f:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  801783:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+	// 当 num 超过一位数，首先递归函数自身打印所有高位的(更重要的)数字
+	if (num >= base)
+  801787:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80178a:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  80178e:	72 54                	jb     8017e4 <printnum+0x7c>
+	{
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801790:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  801793:	8d 78 ff             	lea    -0x1(%rax),%edi
+  801796:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  801799:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80179d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017a2:	48 f7 f6             	div    %rsi
+  8017a5:	49 89 c2             	mov    %rax,%r10
+  8017a8:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8017ab:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8017ae:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8017b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017b6:	41 89 c9             	mov    %ecx,%r9d
+  8017b9:	41 89 f8             	mov    %edi,%r8d
+  8017bc:	89 d1                	mov    %edx,%ecx
+  8017be:	4c 89 d2             	mov    %r10,%rdx
+  8017c1:	48 89 c7             	mov    %rax,%rdi
+  8017c4:	48 b8 68 17 80 00 00 	movabs $0x801768,%rax
+  8017cb:	00 00 00 
+  8017ce:	ff d0                	call   *%rax
+  8017d0:	eb 1c                	jmp    8017ee <printnum+0x86>
+	}
+	else
+	{
+		// 按照右对齐的格式在左侧补齐填充字符 padc
+		while (--width > 0)
+			putch(padc, putdat);
+  8017d2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8017d6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8017d9:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8017dd:	48 89 d6             	mov    %rdx,%rsi
+  8017e0:	89 c7                	mov    %eax,%edi
+  8017e2:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8017e4:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  8017e8:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8017ec:	7f e4                	jg     8017d2 <printnum+0x6a>
+	}
+
+	// 然后打印个位数字
+	putch("0123456789abcdef"[num % base], putdat);
+  8017ee:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8017f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017fa:	48 f7 f1             	div    %rcx
+  8017fd:	48 b8 10 24 80 00 00 	movabs $0x802410,%rax
+  801804:	00 00 00 
+  801807:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  80180b:	0f be c0             	movsbl %al,%eax
+  80180e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801812:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801816:	48 89 d6             	mov    %rdx,%rsi
+  801819:	89 c7                	mov    %eax,%edi
+  80181b:	ff d1                	call   *%rcx
+}
+  80181d:	90                   	nop
+  80181e:	c9                   	leave
+  80181f:	c3                   	ret
+
+0000000000801820 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  801820:	55                   	push   %rbp
+  801821:	48 89 e5             	mov    %rsp,%rbp
+  801824:	48 83 ec 20          	sub    $0x20,%rsp
+  801828:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80182c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;
+	if (lflag >= 2)
+  80182f:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  801833:	7e 4f                	jle    801884 <getuint+0x64>
+		x = va_arg(*ap, unsigned long long);
+  801835:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801839:	8b 00                	mov    (%rax),%eax
+  80183b:	83 f8 2f             	cmp    $0x2f,%eax
+  80183e:	77 24                	ja     801864 <getuint+0x44>
+  801840:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801844:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801848:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80184c:	8b 00                	mov    (%rax),%eax
+  80184e:	89 c0                	mov    %eax,%eax
+  801850:	48 01 d0             	add    %rdx,%rax
+  801853:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801857:	8b 12                	mov    (%rdx),%edx
+  801859:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80185c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801860:	89 0a                	mov    %ecx,(%rdx)
+  801862:	eb 14                	jmp    801878 <getuint+0x58>
+  801864:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801868:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80186c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801870:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801874:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801878:	48 8b 00             	mov    (%rax),%rax
+  80187b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80187f:	e9 9d 00 00 00       	jmp    801921 <getuint+0x101>
+	else if (lflag)
+  801884:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  801888:	74 4c                	je     8018d6 <getuint+0xb6>
+		x = va_arg(*ap, unsigned long);
+  80188a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80188e:	8b 00                	mov    (%rax),%eax
+  801890:	83 f8 2f             	cmp    $0x2f,%eax
+  801893:	77 24                	ja     8018b9 <getuint+0x99>
+  801895:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801899:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80189d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018a1:	8b 00                	mov    (%rax),%eax
+  8018a3:	89 c0                	mov    %eax,%eax
+  8018a5:	48 01 d0             	add    %rdx,%rax
+  8018a8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018ac:	8b 12                	mov    (%rdx),%edx
+  8018ae:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8018b1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018b5:	89 0a                	mov    %ecx,(%rdx)
+  8018b7:	eb 14                	jmp    8018cd <getuint+0xad>
+  8018b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018bd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8018c1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8018c5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018c9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8018cd:	48 8b 00             	mov    (%rax),%rax
+  8018d0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8018d4:	eb 4b                	jmp    801921 <getuint+0x101>
+	else
+		x = va_arg(*ap, unsigned int);
+  8018d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018da:	8b 00                	mov    (%rax),%eax
+  8018dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8018df:	77 24                	ja     801905 <getuint+0xe5>
+  8018e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018e5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8018e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018ed:	8b 00                	mov    (%rax),%eax
+  8018ef:	89 c0                	mov    %eax,%eax
+  8018f1:	48 01 d0             	add    %rdx,%rax
+  8018f4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018f8:	8b 12                	mov    (%rdx),%edx
+  8018fa:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8018fd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801901:	89 0a                	mov    %ecx,(%rdx)
+  801903:	eb 14                	jmp    801919 <getuint+0xf9>
+  801905:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801909:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80190d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801911:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801915:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801919:	8b 00                	mov    (%rax),%eax
+  80191b:	89 c0                	mov    %eax,%eax
+  80191d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  801921:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801925:	c9                   	leave
+  801926:	c3                   	ret
+
+0000000000801927 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  801927:	55                   	push   %rbp
+  801928:	48 89 e5             	mov    %rsp,%rbp
+  80192b:	48 83 ec 20          	sub    $0x20,%rsp
+  80192f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801933:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  801936:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  80193a:	7e 4f                	jle    80198b <getint+0x64>
+		x = va_arg(*ap, long long);
+  80193c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801940:	8b 00                	mov    (%rax),%eax
+  801942:	83 f8 2f             	cmp    $0x2f,%eax
+  801945:	77 24                	ja     80196b <getint+0x44>
+  801947:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80194b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80194f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801953:	8b 00                	mov    (%rax),%eax
+  801955:	89 c0                	mov    %eax,%eax
+  801957:	48 01 d0             	add    %rdx,%rax
+  80195a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80195e:	8b 12                	mov    (%rdx),%edx
+  801960:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801963:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801967:	89 0a                	mov    %ecx,(%rdx)
+  801969:	eb 14                	jmp    80197f <getint+0x58>
+  80196b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80196f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801973:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801977:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80197b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80197f:	48 8b 00             	mov    (%rax),%rax
+  801982:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801986:	e9 9d 00 00 00       	jmp    801a28 <getint+0x101>
+	else if (lflag)
+  80198b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80198f:	74 4c                	je     8019dd <getint+0xb6>
+		x = va_arg(*ap, long);
+  801991:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801995:	8b 00                	mov    (%rax),%eax
+  801997:	83 f8 2f             	cmp    $0x2f,%eax
+  80199a:	77 24                	ja     8019c0 <getint+0x99>
+  80199c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019a0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8019a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019a8:	8b 00                	mov    (%rax),%eax
+  8019aa:	89 c0                	mov    %eax,%eax
+  8019ac:	48 01 d0             	add    %rdx,%rax
+  8019af:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8019b3:	8b 12                	mov    (%rdx),%edx
+  8019b5:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8019b8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8019bc:	89 0a                	mov    %ecx,(%rdx)
+  8019be:	eb 14                	jmp    8019d4 <getint+0xad>
+  8019c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019c4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8019c8:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8019cc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8019d0:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8019d4:	48 8b 00             	mov    (%rax),%rax
+  8019d7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8019db:	eb 4b                	jmp    801a28 <getint+0x101>
+	else
+		x = va_arg(*ap, int);
+  8019dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019e1:	8b 00                	mov    (%rax),%eax
+  8019e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8019e6:	77 24                	ja     801a0c <getint+0xe5>
+  8019e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019ec:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8019f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019f4:	8b 00                	mov    (%rax),%eax
+  8019f6:	89 c0                	mov    %eax,%eax
+  8019f8:	48 01 d0             	add    %rdx,%rax
+  8019fb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8019ff:	8b 12                	mov    (%rdx),%edx
+  801a01:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801a04:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a08:	89 0a                	mov    %ecx,(%rdx)
+  801a0a:	eb 14                	jmp    801a20 <getint+0xf9>
+  801a0c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a10:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801a14:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801a18:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a1c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801a20:	8b 00                	mov    (%rax),%eax
+  801a22:	48 98                	cltq
+  801a24:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  801a28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801a2c:	c9                   	leave
+  801a2d:	c3                   	ret
+
+0000000000801a2e <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap)
+{
+  801a2e:	55                   	push   %rbp
+  801a2f:	48 89 e5             	mov    %rsp,%rbp
+  801a32:	41 54                	push   %r12
+  801a34:	53                   	push   %rbx
+  801a35:	48 83 ec 60          	sub    $0x60,%rsp
+  801a39:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801a3d:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  801a41:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  801a45:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+	int base, lflag, width, precision, altflag;
+
+	// 填充字符，在显示字符串的'%'后读到'-'或'0'时，赋值到 padc
+	char padc;
+	va_list aq;
+	va_copy(aq, ap);
+  801a49:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801a4d:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801a51:	48 8b 06             	mov    (%rsi),%rax
+  801a54:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801a58:	48 89 01             	mov    %rax,(%rcx)
+  801a5b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801a5f:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801a63:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1)
+	{
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  801a67:	eb 17                	jmp    801a80 <vprintfmt+0x52>
+		{
+			if (ch == '\0')
+  801a69:	85 db                	test   %ebx,%ebx
+  801a6b:	0f 84 b9 04 00 00    	je     801f2a <vprintfmt+0x4fc>
+				return;
+			putch(ch, putdat);
+  801a71:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a75:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801a79:	48 89 c6             	mov    %rax,%rsi
+  801a7c:	89 df                	mov    %ebx,%edi
+  801a7e:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  801a80:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801a84:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a88:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  801a8c:	0f b6 00             	movzbl (%rax),%eax
+  801a8f:	0f b6 d8             	movzbl %al,%ebx
+  801a92:	83 fb 25             	cmp    $0x25,%ebx
+  801a95:	75 d2                	jne    801a69 <vprintfmt+0x3b>
+		}
+
+		// 处理 % 转义序列
+		// padc 初始化为空格符，padc='-'代表字符串左对齐，右边补空格，padc=' '代表右对齐，左边补空格，padc='0'右对齐，左边补0
+		padc = ' ';
+  801a97:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+		width = -1;
+  801a9b:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+		// 默认-1代表显示长度为字符串本来的长度
+		precision = -1;
+  801aa2:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+		lflag = 0;
+  801aa9:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+		altflag = 0;
+  801ab0:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *)fmt++)
+  801ab7:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801abb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801abf:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  801ac3:	0f b6 00             	movzbl (%rax),%eax
+  801ac6:	0f b6 d8             	movzbl %al,%ebx
+  801ac9:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  801acc:	83 f8 55             	cmp    $0x55,%eax
+  801acf:	0f 87 22 04 00 00    	ja     801ef7 <vprintfmt+0x4c9>
+  801ad5:	89 c0                	mov    %eax,%eax
+  801ad7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801ade:	00 
+  801adf:	48 b8 38 24 80 00 00 	movabs $0x802438,%rax
+  801ae6:	00 00 00 
+  801ae9:	48 01 d0             	add    %rdx,%rax
+  801aec:	48 8b 00             	mov    (%rax),%rax
+  801aef:	ff e0                	jmp    *%rax
+		{
+
+		// flag to pad on the right
+		case '-':
+			padc = '-';
+  801af1:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+			goto reswitch;
+  801af5:	eb c0                	jmp    801ab7 <vprintfmt+0x89>
+
+		// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  801af7:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+			goto reswitch;
+  801afb:	eb ba                	jmp    801ab7 <vprintfmt+0x89>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0;; ++fmt)
+  801afd:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+			{
+				precision = precision * 10 + ch - '0';
+  801b04:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  801b07:	89 d0                	mov    %edx,%eax
+  801b09:	c1 e0 02             	shl    $0x2,%eax
+  801b0c:	01 d0                	add    %edx,%eax
+  801b0e:	01 c0                	add    %eax,%eax
+  801b10:	01 d8                	add    %ebx,%eax
+  801b12:	83 e8 30             	sub    $0x30,%eax
+  801b15:	89 45 d8             	mov    %eax,-0x28(%rbp)
+				ch = *fmt;
+  801b18:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801b1c:	0f b6 00             	movzbl (%rax),%eax
+  801b1f:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  801b22:	83 fb 2f             	cmp    $0x2f,%ebx
+  801b25:	7e 60                	jle    801b87 <vprintfmt+0x159>
+  801b27:	83 fb 39             	cmp    $0x39,%ebx
+  801b2a:	7f 5b                	jg     801b87 <vprintfmt+0x159>
+			for (precision = 0;; ++fmt)
+  801b2c:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+				precision = precision * 10 + ch - '0';
+  801b31:	eb d1                	jmp    801b04 <vprintfmt+0xd6>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  801b33:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b36:	83 f8 2f             	cmp    $0x2f,%eax
+  801b39:	77 17                	ja     801b52 <vprintfmt+0x124>
+  801b3b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b3f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801b42:	89 d2                	mov    %edx,%edx
+  801b44:	48 01 d0             	add    %rdx,%rax
+  801b47:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801b4a:	83 c2 08             	add    $0x8,%edx
+  801b4d:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801b50:	eb 0c                	jmp    801b5e <vprintfmt+0x130>
+  801b52:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801b56:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801b5a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801b5e:	8b 00                	mov    (%rax),%eax
+  801b60:	89 45 d8             	mov    %eax,-0x28(%rbp)
+			goto process_precision;
+  801b63:	eb 23                	jmp    801b88 <vprintfmt+0x15a>
+
+		case '.':
+			if (width < 0)
+  801b65:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801b69:	0f 89 48 ff ff ff    	jns    801ab7 <vprintfmt+0x89>
+				width = 0;
+  801b6f:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+			goto reswitch;
+  801b76:	e9 3c ff ff ff       	jmp    801ab7 <vprintfmt+0x89>
+
+		case '#':
+			altflag = 1;
+  801b7b:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+			goto reswitch;
+  801b82:	e9 30 ff ff ff       	jmp    801ab7 <vprintfmt+0x89>
+			goto process_precision;
+  801b87:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  801b88:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801b8c:	0f 89 25 ff ff ff    	jns    801ab7 <vprintfmt+0x89>
+				width = precision, precision = -1;
+  801b92:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  801b95:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801b98:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+			goto reswitch;
+  801b9f:	e9 13 ff ff ff       	jmp    801ab7 <vprintfmt+0x89>
+
+		// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  801ba4:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+			goto reswitch;
+  801ba8:	e9 0a ff ff ff       	jmp    801ab7 <vprintfmt+0x89>
+
+		// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  801bad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bb0:	83 f8 2f             	cmp    $0x2f,%eax
+  801bb3:	77 17                	ja     801bcc <vprintfmt+0x19e>
+  801bb5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bb9:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801bbc:	89 d2                	mov    %edx,%edx
+  801bbe:	48 01 d0             	add    %rdx,%rax
+  801bc1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801bc4:	83 c2 08             	add    $0x8,%edx
+  801bc7:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801bca:	eb 0c                	jmp    801bd8 <vprintfmt+0x1aa>
+  801bcc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801bd0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801bd4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801bd8:	8b 00                	mov    (%rax),%eax
+  801bda:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  801bde:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801be2:	48 89 d6             	mov    %rdx,%rsi
+  801be5:	89 c7                	mov    %eax,%edi
+  801be7:	ff d1                	call   *%rcx
+			break;
+  801be9:	e9 37 03 00 00       	jmp    801f25 <vprintfmt+0x4f7>
+
+		// error message
+		case 'e':
+			err = va_arg(aq, int);
+  801bee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bf1:	83 f8 2f             	cmp    $0x2f,%eax
+  801bf4:	77 17                	ja     801c0d <vprintfmt+0x1df>
+  801bf6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bfa:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801bfd:	89 d2                	mov    %edx,%edx
+  801bff:	48 01 d0             	add    %rdx,%rax
+  801c02:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801c05:	83 c2 08             	add    $0x8,%edx
+  801c08:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801c0b:	eb 0c                	jmp    801c19 <vprintfmt+0x1eb>
+  801c0d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801c11:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801c15:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801c19:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  801c1b:	85 db                	test   %ebx,%ebx
+  801c1d:	79 02                	jns    801c21 <vprintfmt+0x1f3>
+				err = -err;
+  801c1f:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801c21:	83 fb 11             	cmp    $0x11,%ebx
+  801c24:	7f 16                	jg     801c3c <vprintfmt+0x20e>
+  801c26:	48 ba 80 23 80 00 00 	movabs $0x802380,%rdx
+  801c2d:	00 00 00 
+  801c30:	48 63 c3             	movslq %ebx,%rax
+  801c33:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  801c37:	4d 85 e4             	test   %r12,%r12
+  801c3a:	75 2e                	jne    801c6a <vprintfmt+0x23c>
+				printfmt(putch, putdat, "error %d", err);
+  801c3c:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801c40:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801c44:	89 d9                	mov    %ebx,%ecx
+  801c46:	48 ba 21 24 80 00 00 	movabs $0x802421,%rdx
+  801c4d:	00 00 00 
+  801c50:	48 89 c7             	mov    %rax,%rdi
+  801c53:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c58:	49 b8 34 1f 80 00 00 	movabs $0x801f34,%r8
+  801c5f:	00 00 00 
+  801c62:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  801c65:	e9 bb 02 00 00       	jmp    801f25 <vprintfmt+0x4f7>
+				printfmt(putch, putdat, "%s", p);
+  801c6a:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801c6e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801c72:	4c 89 e1             	mov    %r12,%rcx
+  801c75:	48 ba 2a 24 80 00 00 	movabs $0x80242a,%rdx
+  801c7c:	00 00 00 
+  801c7f:	48 89 c7             	mov    %rax,%rdi
+  801c82:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c87:	49 b8 34 1f 80 00 00 	movabs $0x801f34,%r8
+  801c8e:	00 00 00 
+  801c91:	41 ff d0             	call   *%r8
+			break;
+  801c94:	e9 8c 02 00 00       	jmp    801f25 <vprintfmt+0x4f7>
+
+		// string
+		case 's':
+			// 从可变参数中读入字符串指针
+			if ((p = va_arg(aq, char *)) == NULL)
+  801c99:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c9c:	83 f8 2f             	cmp    $0x2f,%eax
+  801c9f:	77 17                	ja     801cb8 <vprintfmt+0x28a>
+  801ca1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ca5:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801ca8:	89 d2                	mov    %edx,%edx
+  801caa:	48 01 d0             	add    %rdx,%rax
+  801cad:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801cb0:	83 c2 08             	add    $0x8,%edx
+  801cb3:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801cb6:	eb 0c                	jmp    801cc4 <vprintfmt+0x296>
+  801cb8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801cbc:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801cc0:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801cc4:	4c 8b 20             	mov    (%rax),%r12
+  801cc7:	4d 85 e4             	test   %r12,%r12
+  801cca:	75 0a                	jne    801cd6 <vprintfmt+0x2a8>
+				p = "(null)"; // 当字符串为空时，将它指向"(null)"字符串
+  801ccc:	49 bc 2d 24 80 00 00 	movabs $0x80242d,%r12
+  801cd3:	00 00 00 
+			// 判断左对齐还是右对齐，pad='-'左对齐，否则右对齐
+			if (width > 0 && padc != '-')
+  801cd6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801cda:	7e 78                	jle    801d54 <vprintfmt+0x326>
+  801cdc:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  801ce0:	74 72                	je     801d54 <vprintfmt+0x326>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ce2:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  801ce5:	48 98                	cltq
+  801ce7:	48 89 c6             	mov    %rax,%rsi
+  801cea:	4c 89 e7             	mov    %r12,%rdi
+  801ced:	48 b8 12 02 80 00 00 	movabs $0x800212,%rax
+  801cf4:	00 00 00 
+  801cf7:	ff d0                	call   *%rax
+  801cf9:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  801cfc:	eb 17                	jmp    801d15 <vprintfmt+0x2e7>
+					putch(padc, putdat); // 字符串右对齐，左边补相应数量(width-实际长度)的空格或者 0
+  801cfe:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  801d02:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  801d06:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801d0a:	48 89 d6             	mov    %rdx,%rsi
+  801d0d:	89 c7                	mov    %eax,%edi
+  801d0f:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801d11:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  801d15:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801d19:	7f e3                	jg     801cfe <vprintfmt+0x2d0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801d1b:	eb 37                	jmp    801d54 <vprintfmt+0x326>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801d1d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  801d21:	74 1e                	je     801d41 <vprintfmt+0x313>
+  801d23:	83 fb 1f             	cmp    $0x1f,%ebx
+  801d26:	7e 05                	jle    801d2d <vprintfmt+0x2ff>
+  801d28:	83 fb 7e             	cmp    $0x7e,%ebx
+  801d2b:	7e 14                	jle    801d41 <vprintfmt+0x313>
+					putch('?', putdat);
+  801d2d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801d31:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801d35:	48 89 c6             	mov    %rax,%rsi
+  801d38:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801d3d:	ff d2                	call   *%rdx
+  801d3f:	eb 0f                	jmp    801d50 <vprintfmt+0x322>
+				else
+					putch(ch, putdat); // 打印相应长度的字符串
+  801d41:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801d45:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801d49:	48 89 c6             	mov    %rax,%rsi
+  801d4c:	89 df                	mov    %ebx,%edi
+  801d4e:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801d50:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  801d54:	4c 89 e0             	mov    %r12,%rax
+  801d57:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801d5b:	0f b6 00             	movzbl (%rax),%eax
+  801d5e:	0f be d8             	movsbl %al,%ebx
+  801d61:	85 db                	test   %ebx,%ebx
+  801d63:	74 28                	je     801d8d <vprintfmt+0x35f>
+  801d65:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801d69:	78 b2                	js     801d1d <vprintfmt+0x2ef>
+  801d6b:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  801d6f:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801d73:	79 a8                	jns    801d1d <vprintfmt+0x2ef>
+			for (; width > 0; width--)
+  801d75:	eb 16                	jmp    801d8d <vprintfmt+0x35f>
+				putch(' ', putdat); // 当字符串是左对齐的时候打印相应数量的空格
+  801d77:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801d7b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801d7f:	48 89 c6             	mov    %rax,%rsi
+  801d82:	bf 20 00 00 00       	mov    $0x20,%edi
+  801d87:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  801d89:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  801d8d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801d91:	7f e4                	jg     801d77 <vprintfmt+0x349>
+			break;
+  801d93:	e9 8d 01 00 00       	jmp    801f25 <vprintfmt+0x4f7>
+
+		// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  801d98:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801d9c:	be 03 00 00 00       	mov    $0x3,%esi
+  801da1:	48 89 c7             	mov    %rax,%rdi
+  801da4:	48 b8 27 19 80 00 00 	movabs $0x801927,%rax
+  801dab:	00 00 00 
+  801dae:	ff d0                	call   *%rax
+  801db0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((long long)num < 0)
+  801db4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801db8:	48 85 c0             	test   %rax,%rax
+  801dbb:	79 1d                	jns    801dda <vprintfmt+0x3ac>
+			{
+				putch('-', putdat);
+  801dbd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801dc1:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801dc5:	48 89 c6             	mov    %rax,%rsi
+  801dc8:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801dcd:	ff d2                	call   *%rdx
+				num = -(long long)num;
+  801dcf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801dd3:	48 f7 d8             	neg    %rax
+  801dd6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			}
+			base = 10;
+  801dda:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  801de1:	e9 d2 00 00 00       	jmp    801eb8 <vprintfmt+0x48a>
+
+		// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  801de6:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801dea:	be 03 00 00 00       	mov    $0x3,%esi
+  801def:	48 89 c7             	mov    %rax,%rdi
+  801df2:	48 b8 20 18 80 00 00 	movabs $0x801820,%rax
+  801df9:	00 00 00 
+  801dfc:	ff d0                	call   *%rax
+  801dfe:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 10;
+  801e02:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  801e09:	e9 aa 00 00 00       	jmp    801eb8 <vprintfmt+0x48a>
+		// (unsigned) octal
+		case 'o':
+			// Gets the variable argument with type integer from the point which was processed last by va_arg
+			// calls getuint which returns a long long value, which then calls printnum which prints based on
+			// base value.
+			num = getuint(&aq, 3);
+  801e0e:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801e12:	be 03 00 00 00       	mov    $0x3,%esi
+  801e17:	48 89 c7             	mov    %rax,%rdi
+  801e1a:	48 b8 20 18 80 00 00 	movabs $0x801820,%rax
+  801e21:	00 00 00 
+  801e24:	ff d0                	call   *%rax
+  801e26:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 8;
+  801e2a:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+			goto number;
+  801e31:	e9 82 00 00 00       	jmp    801eb8 <vprintfmt+0x48a>
+
+		// pointer
+		case 'p':
+			putch('0', putdat);
+  801e36:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801e3a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801e3e:	48 89 c6             	mov    %rax,%rsi
+  801e41:	bf 30 00 00 00       	mov    $0x30,%edi
+  801e46:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  801e48:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801e4c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801e50:	48 89 c6             	mov    %rax,%rsi
+  801e53:	bf 78 00 00 00       	mov    $0x78,%edi
+  801e58:	ff d2                	call   *%rdx
+			num = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  801e5a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e5d:	83 f8 2f             	cmp    $0x2f,%eax
+  801e60:	77 17                	ja     801e79 <vprintfmt+0x44b>
+  801e62:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e66:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801e69:	89 d2                	mov    %edx,%edx
+  801e6b:	48 01 d0             	add    %rdx,%rax
+  801e6e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801e71:	83 c2 08             	add    $0x8,%edx
+  801e74:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801e77:	eb 0c                	jmp    801e85 <vprintfmt+0x457>
+  801e79:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801e7d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801e81:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801e85:	48 8b 00             	mov    (%rax),%rax
+  801e88:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  801e8c:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+			goto number;
+  801e93:	eb 23                	jmp    801eb8 <vprintfmt+0x48a>
+
+		// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  801e95:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801e99:	be 03 00 00 00       	mov    $0x3,%esi
+  801e9e:	48 89 c7             	mov    %rax,%rdi
+  801ea1:	48 b8 20 18 80 00 00 	movabs $0x801820,%rax
+  801ea8:	00 00 00 
+  801eab:	ff d0                	call   *%rax
+  801ead:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  801eb1:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  801eb8:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  801ebd:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  801ec0:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  801ec3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801ec7:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801ecb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801ecf:	45 89 c1             	mov    %r8d,%r9d
+  801ed2:	41 89 f8             	mov    %edi,%r8d
+  801ed5:	48 89 c7             	mov    %rax,%rdi
+  801ed8:	48 b8 68 17 80 00 00 	movabs $0x801768,%rax
+  801edf:	00 00 00 
+  801ee2:	ff d0                	call   *%rax
+			break;
+  801ee4:	eb 3f                	jmp    801f25 <vprintfmt+0x4f7>
+
+		// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  801ee6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801eea:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801eee:	48 89 c6             	mov    %rax,%rsi
+  801ef1:	89 df                	mov    %ebx,%edi
+  801ef3:	ff d2                	call   *%rdx
+			break;
+  801ef5:	eb 2e                	jmp    801f25 <vprintfmt+0x4f7>
+
+		// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  801ef7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801efb:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801eff:	48 89 c6             	mov    %rax,%rsi
+  801f02:	bf 25 00 00 00       	mov    $0x25,%edi
+  801f07:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801f09:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  801f0e:	eb 05                	jmp    801f15 <vprintfmt+0x4e7>
+  801f10:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  801f15:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801f19:	48 83 e8 01          	sub    $0x1,%rax
+  801f1d:	0f b6 00             	movzbl (%rax),%eax
+  801f20:	3c 25                	cmp    $0x25,%al
+  801f22:	75 ec                	jne    801f10 <vprintfmt+0x4e2>
+				/* do nothing */;
+			break;
+  801f24:	90                   	nop
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  801f25:	e9 56 fb ff ff       	jmp    801a80 <vprintfmt+0x52>
+				return;
+  801f2a:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  801f2b:	48 83 c4 60          	add    $0x60,%rsp
+  801f2f:	5b                   	pop    %rbx
+  801f30:	41 5c                	pop    %r12
+  801f32:	5d                   	pop    %rbp
+  801f33:	c3                   	ret
+
+0000000000801f34 <printfmt>:
+
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...)
+{
+  801f34:	55                   	push   %rbp
+  801f35:	48 89 e5             	mov    %rsp,%rbp
+  801f38:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801f3f:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801f46:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  801f4d:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801f54:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801f5b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801f62:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801f69:	84 c0                	test   %al,%al
+  801f6b:	74 20                	je     801f8d <printfmt+0x59>
+  801f6d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801f71:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801f75:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801f79:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801f7d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801f81:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801f85:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801f89:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801f8d:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801f94:	00 00 00 
+  801f97:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801f9e:	00 00 00 
+  801fa1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801fa5:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801fac:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801fb3:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  801fba:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801fc1:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801fc8:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801fcf:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801fd6:	48 89 c7             	mov    %rax,%rdi
+  801fd9:	48 b8 2e 1a 80 00 00 	movabs $0x801a2e,%rax
+  801fe0:	00 00 00 
+  801fe3:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801fe5:	90                   	nop
+  801fe6:	c9                   	leave
+  801fe7:	c3                   	ret
+
+0000000000801fe8 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801fe8:	55                   	push   %rbp
+  801fe9:	48 89 e5             	mov    %rsp,%rbp
+  801fec:	48 83 ec 10          	sub    $0x10,%rsp
+  801ff0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801ff3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  801ff7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ffb:	8b 40 10             	mov    0x10(%rax),%eax
+  801ffe:	8d 50 01             	lea    0x1(%rax),%edx
+  802001:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802005:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  802008:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80200c:	48 8b 10             	mov    (%rax),%rdx
+  80200f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802013:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802017:	48 39 c2             	cmp    %rax,%rdx
+  80201a:	73 17                	jae    802033 <sprintputch+0x4b>
+		*b->buf++ = ch;
+  80201c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802020:	48 8b 00             	mov    (%rax),%rax
+  802023:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  802027:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80202b:	48 89 0a             	mov    %rcx,(%rdx)
+  80202e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802031:	88 10                	mov    %dl,(%rax)
+}
+  802033:	90                   	nop
+  802034:	c9                   	leave
+  802035:	c3                   	ret
+
+0000000000802036 <vsnprintf>:
+
+int vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  802036:	55                   	push   %rbp
+  802037:	48 89 e5             	mov    %rsp,%rbp
+  80203a:	48 83 ec 50          	sub    $0x50,%rsp
+  80203e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802042:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  802045:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  802049:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+	va_list aq;
+	va_copy(aq, ap);
+  80204d:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  802051:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802055:	48 8b 06             	mov    (%rsi),%rax
+  802058:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80205c:	48 89 01             	mov    %rax,(%rcx)
+  80205f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  802063:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  802067:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	struct sprintbuf b = {buf, buf + n - 1, 0};
+  80206b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80206f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802073:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802076:	48 98                	cltq
+  802078:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80207c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802080:	48 01 d0             	add    %rdx,%rax
+  802083:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802087:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+
+	if (buf == NULL || n < 1)
+  80208e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802093:	74 06                	je     80209b <vsnprintf+0x65>
+  802095:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  802099:	7f 07                	jg     8020a2 <vsnprintf+0x6c>
+		return -E_INVAL;
+  80209b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020a0:	eb 32                	jmp    8020d4 <vsnprintf+0x9e>
+
+	// print the string to the buffer
+	vprintfmt((void *)sprintputch, &b, fmt, aq);
+  8020a2:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  8020a6:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8020aa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8020ae:	48 89 c6             	mov    %rax,%rsi
+  8020b1:	48 b8 e8 1f 80 00 00 	movabs $0x801fe8,%rax
+  8020b8:	00 00 00 
+  8020bb:	48 89 c7             	mov    %rax,%rdi
+  8020be:	48 b8 2e 1a 80 00 00 	movabs $0x801a2e,%rax
+  8020c5:	00 00 00 
+  8020c8:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  8020ca:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020ce:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  8020d1:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  8020d4:	c9                   	leave
+  8020d5:	c3                   	ret
+
+00000000008020d6 <snprintf>:
+
+int snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8020d6:	55                   	push   %rbp
+  8020d7:	48 89 e5             	mov    %rsp,%rbp
+  8020da:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8020e1:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8020e8:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8020ee:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8020f5:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8020fc:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  802103:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80210a:	84 c0                	test   %al,%al
+  80210c:	74 20                	je     80212e <snprintf+0x58>
+  80210e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  802112:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  802116:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80211a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80211e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  802122:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  802126:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80212a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  80212e:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  802135:	00 00 00 
+  802138:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80213f:	00 00 00 
+  802142:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802146:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80214d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  802154:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq, ap);
+  80215b:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  802162:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  802169:	48 8b 06             	mov    (%rsi),%rax
+  80216c:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  802170:	48 89 01             	mov    %rax,(%rcx)
+  802173:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  802177:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80217b:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  80217f:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  802186:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  80218d:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  802193:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80219a:	48 89 c7             	mov    %rax,%rdi
+  80219d:	48 b8 36 20 80 00 00 	movabs $0x802036,%rax
+  8021a4:	00 00 00 
+  8021a7:	ff d0                	call   *%rax
+  8021a9:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  8021af:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8021b5:	c9                   	leave
+  8021b6:	c3                   	ret
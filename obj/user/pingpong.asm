@@ -0,0 +1,4684 @@
+
+obj/user/pingpong.debug:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// entrypoint - 当最初被加载到一个新的环境中时，内核(或者父环境)在这里开始运行.
+.text
+.globl _start
+_start:
+	// 判断是否从栈上的参数开始初始化
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	// $USTACKTOP != %rsp 说明有参数，跳转到 args_exist
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// 如果不是(新环境被内核加载的时候)，则 push 伪造的 argc, argv 参数
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 0d 01 00 00       	call   80014e <libmain>
+
+// 不应该返回
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+
+#include "inc/lib.h"
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	53                   	push   %rbx
+  800048:	48 83 ec 28          	sub    $0x28,%rsp
+  80004c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80004f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	envid_t who;
+
+	if ((who = fork()) != 0) {
+  800053:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  80005a:	00 00 00 
+  80005d:	ff d0                	call   *%rax
+  80005f:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  800062:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800065:	85 c0                	test   %eax,%eax
+  800067:	74 51                	je     8000ba <umain+0x77>
+		// Parent 让球滚起来
+		// "send 0 from 父进程ID to 子进程ID"
+		cprintf("send 0 from %x to %x\n", sys_getprocid(), who);
+  800069:	8b 5d e8             	mov    -0x18(%rbp),%ebx
+  80006c:	48 b8 7f 1b 80 00 00 	movabs $0x801b7f,%rax
+  800073:	00 00 00 
+  800076:	ff d0                	call   *%rax
+  800078:	89 da                	mov    %ebx,%edx
+  80007a:	89 c6                	mov    %eax,%esi
+  80007c:	48 b8 00 2d 80 00 00 	movabs $0x802d00,%rax
+  800083:	00 00 00 
+  800086:	48 89 c7             	mov    %rax,%rdi
+  800089:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008e:	48 b9 0c 03 80 00 00 	movabs $0x80030c,%rcx
+  800095:	00 00 00 
+  800098:	ff d1                	call   *%rcx
+		// 仅发送值0到子进程，发现子进程尚未准备接收信息，让出CPU
+		ipc_send(who, 0, 0, 0);
+  80009a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80009d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8000ac:	89 c7                	mov    %eax,%edi
+  8000ae:	48 b8 cf 29 80 00 00 	movabs $0x8029cf,%rax
+  8000b5:	00 00 00 
+  8000b8:	ff d0                	call   *%rax
+
+	while (1) {
+		// Child & Parent
+		// 置接收状态、目标线性地址、阻塞态、RAX返回值(成功)、让出CPU
+		// 调度、设置from发送进程ID(、设置perm_store)、返回发送进程发送的值
+		uint32_t i = ipc_recv(&who, 0, 0);
+  8000ba:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  8000be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8000c8:	48 89 c7             	mov    %rax,%rdi
+  8000cb:	48 b8 e5 28 80 00 00 	movabs $0x8028e5,%rax
+  8000d2:	00 00 00 
+  8000d5:	ff d0                	call   *%rax
+  8000d7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		cprintf("%x got %d from %x\n", sys_getprocid(), i, who);
+  8000da:	8b 5d e8             	mov    -0x18(%rbp),%ebx
+  8000dd:	48 b8 7f 1b 80 00 00 	movabs $0x801b7f,%rax
+  8000e4:	00 00 00 
+  8000e7:	ff d0                	call   *%rax
+  8000e9:	89 c6                	mov    %eax,%esi
+  8000eb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000ee:	89 d9                	mov    %ebx,%ecx
+  8000f0:	89 c2                	mov    %eax,%edx
+  8000f2:	48 b8 16 2d 80 00 00 	movabs $0x802d16,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 c7             	mov    %rax,%rdi
+  8000ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800104:	49 b8 0c 03 80 00 00 	movabs $0x80030c,%r8
+  80010b:	00 00 00 
+  80010e:	41 ff d0             	call   *%r8
+		if (i == 20)
+  800111:	83 7d ec 14          	cmpl   $0x14,-0x14(%rbp)
+  800115:	74 2d                	je     800144 <umain+0x101>
+			return;
+		i++;
+  800117:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+		// 仅发送值i到父进程，发现父进程尚未准备接收信息，让出CPU
+		ipc_send(who, i, 0, 0);
+  80011b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80011e:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  800121:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800126:	ba 00 00 00 00       	mov    $0x0,%edx
+  80012b:	89 c7                	mov    %eax,%edi
+  80012d:	48 b8 cf 29 80 00 00 	movabs $0x8029cf,%rax
+  800134:	00 00 00 
+  800137:	ff d0                	call   *%rax
+		if (i == 20)
+  800139:	83 7d ec 14          	cmpl   $0x14,-0x14(%rbp)
+  80013d:	74 08                	je     800147 <umain+0x104>
+	while (1) {
+  80013f:	e9 76 ff ff ff       	jmp    8000ba <umain+0x77>
+			return;
+  800144:	90                   	nop
+  800145:	eb 01                	jmp    800148 <umain+0x105>
+			return;
+  800147:	90                   	nop
+	}
+
+}
+  800148:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80014c:	c9                   	leave
+  80014d:	c3                   	ret
+
+000000000080014e <libmain>:
+
+/**
+ *  用户环境从lib/libmain.c中的函数libmain开始执行，这个函数进而调用umain，用户写的程序入口只能是umain
+ */
+void libmain(int argc, char **argv)
+{
+  80014e:	55                   	push   %rbp
+  80014f:	48 89 e5             	mov    %rsp,%rbp
+  800152:	48 83 ec 10          	sub    $0x10,%rsp
+  800156:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800159:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 设置常量 thisproc 指向 procs[] 中当前环境的 Env 结构，ENVX 确保环境 id 未超过了 NENV
+	// thisproc 指向当前环境的 Env 结构
+	thisproc = &procs[ENVX(sys_getprocid())];
+  80015d:	48 b8 7f 1b 80 00 00 	movabs $0x801b7f,%rax
+  800164:	00 00 00 
+  800167:	ff d0                	call   *%rax
+  800169:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80016e:	48 98                	cltq
+  800170:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  800177:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  80017e:	00 00 00 
+  800181:	48 01 c2             	add    %rax,%rdx
+  800184:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  80018b:	00 00 00 
+  80018e:	48 89 10             	mov    %rdx,(%rax)
+
+	// 通过 CPUID 选择 memset/memmove/memcpy 的实现
+	mem_init();
+  800191:	48 b8 27 12 80 00 00 	movabs $0x801227,%rax
+  800198:	00 00 00 
+  80019b:	ff d0                	call   *%rax
+
+	// 为了能让panic()提示用户错误，存储程序的名称
+	if (argc > 0)
+  80019d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8001a1:	7e 14                	jle    8001b7 <libmain+0x69>
+		binaryname = argv[0];
+  8001a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001a7:	48 8b 00             	mov    (%rax),%rax
+  8001aa:	48 ba 00 40 80 00 00 	movabs $0x804000,%rdx
+  8001b1:	00 00 00 
+  8001b4:	48 89 02             	mov    %rax,(%rdx)
+
+	// 调用用户的主程序
+	umain(argc, argv);
+  8001b7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8001be:	48 89 d6             	mov    %rdx,%rsi
+  8001c1:	89 c7                	mov    %eax,%edi
+  8001c3:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  8001ca:	00 00 00 
+  8001cd:	ff d0                	call   *%rax
+
+	// 退出当前环境，env_destroy
+	sys_env_destroy(0);
+  8001cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001d4:	48 b8 39 1b 80 00 00 	movabs $0x801b39,%rax
+  8001db:	00 00 00 
+  8001de:	ff d0                	call   *%rax
+}
+  8001e0:	90                   	nop
+  8001e1:	c9                   	leave
+  8001e2:	c3                   	ret
+
+00000000008001e3 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001e3:	55                   	push   %rbp
+  8001e4:	48 89 e5             	mov    %rsp,%rbp
+  8001e7:	48 83 ec 10          	sub    $0x10,%rsp
+  8001eb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8001ee:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->buf[b->idx++] = ch;
+  8001f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001f6:	8b 00                	mov    (%rax),%eax
+  8001f8:	8d 48 01             	lea    0x1(%rax),%ecx
+  8001fb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001ff:	89 0a                	mov    %ecx,(%rdx)
+  800201:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800204:	89 d1                	mov    %edx,%ecx
+  800206:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80020a:	48 98                	cltq
+  80020c:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+	if (b->idx == 256-1) {
+  800210:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800214:	8b 00                	mov    (%rax),%eax
+  800216:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80021b:	75 2c                	jne    800249 <putch+0x66>
+		sys_cputs(b->buf, b->idx);
+  80021d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800221:	8b 00                	mov    (%rax),%eax
+  800223:	48 98                	cltq
+  800225:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800229:	48 83 c2 08          	add    $0x8,%rdx
+  80022d:	48 89 c6             	mov    %rax,%rsi
+  800230:	48 89 d7             	mov    %rdx,%rdi
+  800233:	48 b8 b0 1a 80 00 00 	movabs $0x801ab0,%rax
+  80023a:	00 00 00 
+  80023d:	ff d0                	call   *%rax
+		b->idx = 0;
+  80023f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800243:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	}
+	b->cnt++;
+  800249:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80024d:	8b 40 04             	mov    0x4(%rax),%eax
+  800250:	8d 50 01             	lea    0x1(%rax),%edx
+  800253:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800257:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80025a:	90                   	nop
+  80025b:	c9                   	leave
+  80025c:	c3                   	ret
+
+000000000080025d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80025d:	55                   	push   %rbp
+  80025e:	48 89 e5             	mov    %rsp,%rbp
+  800261:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  800268:	48 89 bd c8 fe ff ff 	mov    %rdi,-0x138(%rbp)
+  80026f:	48 89 b5 c0 fe ff ff 	mov    %rsi,-0x140(%rbp)
+	struct printbuf b;
+	va_list aq;
+	va_copy(aq,ap);
+  800276:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  80027d:	48 8b b5 c0 fe ff ff 	mov    -0x140(%rbp),%rsi
+  800284:	48 8b 06             	mov    (%rsi),%rax
+  800287:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80028b:	48 89 01             	mov    %rax,(%rcx)
+  80028e:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800292:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800296:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	b.idx = 0;
+  80029a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8002a1:	00 00 00 
+	b.cnt = 0;
+  8002a4:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8002ab:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, aq);
+  8002ae:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  8002b5:	48 8b 95 c8 fe ff ff 	mov    -0x138(%rbp),%rdx
+  8002bc:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8002c3:	48 89 c6             	mov    %rax,%rsi
+  8002c6:	48 b8 e3 01 80 00 00 	movabs $0x8001e3,%rax
+  8002cd:	00 00 00 
+  8002d0:	48 89 c7             	mov    %rax,%rdi
+  8002d3:	48 b8 aa 06 80 00 00 	movabs $0x8006aa,%rax
+  8002da:	00 00 00 
+  8002dd:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  8002df:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8002e5:	48 98                	cltq
+  8002e7:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8002ee:	48 83 c2 08          	add    $0x8,%rdx
+  8002f2:	48 89 c6             	mov    %rax,%rsi
+  8002f5:	48 89 d7             	mov    %rdx,%rdi
+  8002f8:	48 b8 b0 1a 80 00 00 	movabs $0x801ab0,%rax
+  8002ff:	00 00 00 
+  800302:	ff d0                	call   *%rax
+	va_end(aq);
+
+	return b.cnt;
+  800304:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80030a:	c9                   	leave
+  80030b:	c3                   	ret
+
+000000000080030c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80030c:	55                   	push   %rbp
+  80030d:	48 89 e5             	mov    %rsp,%rbp
+  800310:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800317:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80031e:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800325:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80032c:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800333:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80033a:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800341:	84 c0                	test   %al,%al
+  800343:	74 20                	je     800365 <cprintf+0x59>
+  800345:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800349:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80034d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800351:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800355:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800359:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80035d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800361:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+	va_list aq;
+	va_start(ap, fmt);
+  800365:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80036c:	00 00 00 
+  80036f:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800376:	00 00 00 
+  800379:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80037d:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800384:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80038b:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  800392:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800399:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8003a0:	48 8b 06             	mov    (%rsi),%rax
+  8003a3:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8003a7:	48 89 01             	mov    %rax,(%rcx)
+  8003aa:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8003ae:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8003b2:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	cnt = vcprintf(fmt, aq);
+  8003b6:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8003bd:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8003c4:	48 89 d6             	mov    %rdx,%rsi
+  8003c7:	48 89 c7             	mov    %rax,%rdi
+  8003ca:	48 b8 5d 02 80 00 00 	movabs $0x80025d,%rax
+  8003d1:	00 00 00 
+  8003d4:	ff d0                	call   *%rax
+  8003d6:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return cnt;
+  8003dc:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8003e2:	c9                   	leave
+  8003e3:	c3                   	ret
+
+00000000008003e4 <printnum>:
+ * num: 需要打印出来的整型数，base: 整型数的进制，其他参数同 vprintfmt
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+		 unsigned long long num, unsigned base, int width, int padc)
+{
+  8003e4:	55                   	push   %rbp
+  8003e5:	48 89 e5             	mov    %rsp,%rbp
+  8003e8:	48 83 ec 30          	sub    $0x30,%rsp
+  8003ec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8003f0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8003f4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8003f8:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8003fb:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8003ff:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+	// 当 num 超过一位数，首先递归函数自身打印所有高位的(更重要的)数字
+	if (num >= base)
+  800403:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800406:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  80040a:	72 54                	jb     800460 <printnum+0x7c>
+	{
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80040c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80040f:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800412:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800415:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800419:	ba 00 00 00 00       	mov    $0x0,%edx
+  80041e:	48 f7 f6             	div    %rsi
+  800421:	49 89 c2             	mov    %rax,%r10
+  800424:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800427:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80042a:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80042e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800432:	41 89 c9             	mov    %ecx,%r9d
+  800435:	41 89 f8             	mov    %edi,%r8d
+  800438:	89 d1                	mov    %edx,%ecx
+  80043a:	4c 89 d2             	mov    %r10,%rdx
+  80043d:	48 89 c7             	mov    %rax,%rdi
+  800440:	48 b8 e4 03 80 00 00 	movabs $0x8003e4,%rax
+  800447:	00 00 00 
+  80044a:	ff d0                	call   *%rax
+  80044c:	eb 1c                	jmp    80046a <printnum+0x86>
+	}
+	else
+	{
+		// 按照右对齐的格式在左侧补齐填充字符 padc
+		while (--width > 0)
+			putch(padc, putdat);
+  80044e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800452:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800455:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800459:	48 89 d6             	mov    %rdx,%rsi
+  80045c:	89 c7                	mov    %eax,%edi
+  80045e:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800460:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800464:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800468:	7f e4                	jg     80044e <printnum+0x6a>
+	}
+
+	// 然后打印个位数字
+	putch("0123456789abcdef"[num % base], putdat);
+  80046a:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80046d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800471:	ba 00 00 00 00       	mov    $0x0,%edx
+  800476:	48 f7 f1             	div    %rcx
+  800479:	48 b8 30 2f 80 00 00 	movabs $0x802f30,%rax
+  800480:	00 00 00 
+  800483:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800487:	0f be c0             	movsbl %al,%eax
+  80048a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80048e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800492:	48 89 d6             	mov    %rdx,%rsi
+  800495:	89 c7                	mov    %eax,%edi
+  800497:	ff d1                	call   *%rcx
+}
+  800499:	90                   	nop
+  80049a:	c9                   	leave
+  80049b:	c3                   	ret
+
+000000000080049c <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  80049c:	55                   	push   %rbp
+  80049d:	48 89 e5             	mov    %rsp,%rbp
+  8004a0:	48 83 ec 20          	sub    $0x20,%rsp
+  8004a4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8004a8:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;
+	if (lflag >= 2)
+  8004ab:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8004af:	7e 4f                	jle    800500 <getuint+0x64>
+		x = va_arg(*ap, unsigned long long);
+  8004b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004b5:	8b 00                	mov    (%rax),%eax
+  8004b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8004ba:	77 24                	ja     8004e0 <getuint+0x44>
+  8004bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004c0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004c8:	8b 00                	mov    (%rax),%eax
+  8004ca:	89 c0                	mov    %eax,%eax
+  8004cc:	48 01 d0             	add    %rdx,%rax
+  8004cf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8004d3:	8b 12                	mov    (%rdx),%edx
+  8004d5:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8004d8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8004dc:	89 0a                	mov    %ecx,(%rdx)
+  8004de:	eb 14                	jmp    8004f4 <getuint+0x58>
+  8004e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004e4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8004e8:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8004ec:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8004f0:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8004f4:	48 8b 00             	mov    (%rax),%rax
+  8004f7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8004fb:	e9 9d 00 00 00       	jmp    80059d <getuint+0x101>
+	else if (lflag)
+  800500:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800504:	74 4c                	je     800552 <getuint+0xb6>
+		x = va_arg(*ap, unsigned long);
+  800506:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80050a:	8b 00                	mov    (%rax),%eax
+  80050c:	83 f8 2f             	cmp    $0x2f,%eax
+  80050f:	77 24                	ja     800535 <getuint+0x99>
+  800511:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800515:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800519:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80051d:	8b 00                	mov    (%rax),%eax
+  80051f:	89 c0                	mov    %eax,%eax
+  800521:	48 01 d0             	add    %rdx,%rax
+  800524:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800528:	8b 12                	mov    (%rdx),%edx
+  80052a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80052d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800531:	89 0a                	mov    %ecx,(%rdx)
+  800533:	eb 14                	jmp    800549 <getuint+0xad>
+  800535:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800539:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80053d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800541:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800545:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800549:	48 8b 00             	mov    (%rax),%rax
+  80054c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800550:	eb 4b                	jmp    80059d <getuint+0x101>
+	else
+		x = va_arg(*ap, unsigned int);
+  800552:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800556:	8b 00                	mov    (%rax),%eax
+  800558:	83 f8 2f             	cmp    $0x2f,%eax
+  80055b:	77 24                	ja     800581 <getuint+0xe5>
+  80055d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800561:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800565:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800569:	8b 00                	mov    (%rax),%eax
+  80056b:	89 c0                	mov    %eax,%eax
+  80056d:	48 01 d0             	add    %rdx,%rax
+  800570:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800574:	8b 12                	mov    (%rdx),%edx
+  800576:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800579:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80057d:	89 0a                	mov    %ecx,(%rdx)
+  80057f:	eb 14                	jmp    800595 <getuint+0xf9>
+  800581:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800585:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800589:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80058d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800591:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800595:	8b 00                	mov    (%rax),%eax
+  800597:	89 c0                	mov    %eax,%eax
+  800599:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80059d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8005a1:	c9                   	leave
+  8005a2:	c3                   	ret
+
+00000000008005a3 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  8005a3:	55                   	push   %rbp
+  8005a4:	48 89 e5             	mov    %rsp,%rbp
+  8005a7:	48 83 ec 20          	sub    $0x20,%rsp
+  8005ab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8005af:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  8005b2:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8005b6:	7e 4f                	jle    800607 <getint+0x64>
+		x = va_arg(*ap, long long);
+  8005b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005bc:	8b 00                	mov    (%rax),%eax
+  8005be:	83 f8 2f             	cmp    $0x2f,%eax
+  8005c1:	77 24                	ja     8005e7 <getint+0x44>
+  8005c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005c7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005cf:	8b 00                	mov    (%rax),%eax
+  8005d1:	89 c0                	mov    %eax,%eax
+  8005d3:	48 01 d0             	add    %rdx,%rax
+  8005d6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005da:	8b 12                	mov    (%rdx),%edx
+  8005dc:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005df:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005e3:	89 0a                	mov    %ecx,(%rdx)
+  8005e5:	eb 14                	jmp    8005fb <getint+0x58>
+  8005e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005eb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005ef:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005f3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005f7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005fb:	48 8b 00             	mov    (%rax),%rax
+  8005fe:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800602:	e9 9d 00 00 00       	jmp    8006a4 <getint+0x101>
+	else if (lflag)
+  800607:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80060b:	74 4c                	je     800659 <getint+0xb6>
+		x = va_arg(*ap, long);
+  80060d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800611:	8b 00                	mov    (%rax),%eax
+  800613:	83 f8 2f             	cmp    $0x2f,%eax
+  800616:	77 24                	ja     80063c <getint+0x99>
+  800618:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80061c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800620:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800624:	8b 00                	mov    (%rax),%eax
+  800626:	89 c0                	mov    %eax,%eax
+  800628:	48 01 d0             	add    %rdx,%rax
+  80062b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80062f:	8b 12                	mov    (%rdx),%edx
+  800631:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800634:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800638:	89 0a                	mov    %ecx,(%rdx)
+  80063a:	eb 14                	jmp    800650 <getint+0xad>
+  80063c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800640:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800644:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800648:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80064c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800650:	48 8b 00             	mov    (%rax),%rax
+  800653:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800657:	eb 4b                	jmp    8006a4 <getint+0x101>
+	else
+		x = va_arg(*ap, int);
+  800659:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80065d:	8b 00                	mov    (%rax),%eax
+  80065f:	83 f8 2f             	cmp    $0x2f,%eax
+  800662:	77 24                	ja     800688 <getint+0xe5>
+  800664:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800668:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80066c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800670:	8b 00                	mov    (%rax),%eax
+  800672:	89 c0                	mov    %eax,%eax
+  800674:	48 01 d0             	add    %rdx,%rax
+  800677:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80067b:	8b 12                	mov    (%rdx),%edx
+  80067d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800680:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800684:	89 0a                	mov    %ecx,(%rdx)
+  800686:	eb 14                	jmp    80069c <getint+0xf9>
+  800688:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80068c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800690:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800694:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800698:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80069c:	8b 00                	mov    (%rax),%eax
+  80069e:	48 98                	cltq
+  8006a0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8006a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8006a8:	c9                   	leave
+  8006a9:	c3                   	ret
+
+00000000008006aa <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap)
+{
+  8006aa:	55                   	push   %rbp
+  8006ab:	48 89 e5             	mov    %rsp,%rbp
+  8006ae:	41 54                	push   %r12
+  8006b0:	53                   	push   %rbx
+  8006b1:	48 83 ec 60          	sub    $0x60,%rsp
+  8006b5:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8006b9:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8006bd:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8006c1:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+	int base, lflag, width, precision, altflag;
+
+	// 填充字符，在显示字符串的'%'后读到'-'或'0'时，赋值到 padc
+	char padc;
+	va_list aq;
+	va_copy(aq, ap);
+  8006c5:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006c9:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8006cd:	48 8b 06             	mov    (%rsi),%rax
+  8006d0:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8006d4:	48 89 01             	mov    %rax,(%rcx)
+  8006d7:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8006db:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8006df:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1)
+	{
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  8006e3:	eb 17                	jmp    8006fc <vprintfmt+0x52>
+		{
+			if (ch == '\0')
+  8006e5:	85 db                	test   %ebx,%ebx
+  8006e7:	0f 84 b9 04 00 00    	je     800ba6 <vprintfmt+0x4fc>
+				return;
+			putch(ch, putdat);
+  8006ed:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006f1:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8006f5:	48 89 c6             	mov    %rax,%rsi
+  8006f8:	89 df                	mov    %ebx,%edi
+  8006fa:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  8006fc:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800700:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800704:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800708:	0f b6 00             	movzbl (%rax),%eax
+  80070b:	0f b6 d8             	movzbl %al,%ebx
+  80070e:	83 fb 25             	cmp    $0x25,%ebx
+  800711:	75 d2                	jne    8006e5 <vprintfmt+0x3b>
+		}
+
+		// 处理 % 转义序列
+		// padc 初始化为空格符，padc='-'代表字符串左对齐，右边补空格，padc=' '代表右对齐，左边补空格，padc='0'右对齐，左边补0
+		padc = ' ';
+  800713:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+		width = -1;
+  800717:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+		// 默认-1代表显示长度为字符串本来的长度
+		precision = -1;
+  80071e:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+		lflag = 0;
+  800725:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+		altflag = 0;
+  80072c:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *)fmt++)
+  800733:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800737:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80073b:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80073f:	0f b6 00             	movzbl (%rax),%eax
+  800742:	0f b6 d8             	movzbl %al,%ebx
+  800745:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800748:	83 f8 55             	cmp    $0x55,%eax
+  80074b:	0f 87 22 04 00 00    	ja     800b73 <vprintfmt+0x4c9>
+  800751:	89 c0                	mov    %eax,%eax
+  800753:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80075a:	00 
+  80075b:	48 b8 58 2f 80 00 00 	movabs $0x802f58,%rax
+  800762:	00 00 00 
+  800765:	48 01 d0             	add    %rdx,%rax
+  800768:	48 8b 00             	mov    (%rax),%rax
+  80076b:	ff e0                	jmp    *%rax
+		{
+
+		// flag to pad on the right
+		case '-':
+			padc = '-';
+  80076d:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+			goto reswitch;
+  800771:	eb c0                	jmp    800733 <vprintfmt+0x89>
+
+		// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800773:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+			goto reswitch;
+  800777:	eb ba                	jmp    800733 <vprintfmt+0x89>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0;; ++fmt)
+  800779:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+			{
+				precision = precision * 10 + ch - '0';
+  800780:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800783:	89 d0                	mov    %edx,%eax
+  800785:	c1 e0 02             	shl    $0x2,%eax
+  800788:	01 d0                	add    %edx,%eax
+  80078a:	01 c0                	add    %eax,%eax
+  80078c:	01 d8                	add    %ebx,%eax
+  80078e:	83 e8 30             	sub    $0x30,%eax
+  800791:	89 45 d8             	mov    %eax,-0x28(%rbp)
+				ch = *fmt;
+  800794:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800798:	0f b6 00             	movzbl (%rax),%eax
+  80079b:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  80079e:	83 fb 2f             	cmp    $0x2f,%ebx
+  8007a1:	7e 60                	jle    800803 <vprintfmt+0x159>
+  8007a3:	83 fb 39             	cmp    $0x39,%ebx
+  8007a6:	7f 5b                	jg     800803 <vprintfmt+0x159>
+			for (precision = 0;; ++fmt)
+  8007a8:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+				precision = precision * 10 + ch - '0';
+  8007ad:	eb d1                	jmp    800780 <vprintfmt+0xd6>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  8007af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b5:	77 17                	ja     8007ce <vprintfmt+0x124>
+  8007b7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007bb:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007be:	89 d2                	mov    %edx,%edx
+  8007c0:	48 01 d0             	add    %rdx,%rax
+  8007c3:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007c6:	83 c2 08             	add    $0x8,%edx
+  8007c9:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8007cc:	eb 0c                	jmp    8007da <vprintfmt+0x130>
+  8007ce:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8007d2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8007d6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8007da:	8b 00                	mov    (%rax),%eax
+  8007dc:	89 45 d8             	mov    %eax,-0x28(%rbp)
+			goto process_precision;
+  8007df:	eb 23                	jmp    800804 <vprintfmt+0x15a>
+
+		case '.':
+			if (width < 0)
+  8007e1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8007e5:	0f 89 48 ff ff ff    	jns    800733 <vprintfmt+0x89>
+				width = 0;
+  8007eb:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+			goto reswitch;
+  8007f2:	e9 3c ff ff ff       	jmp    800733 <vprintfmt+0x89>
+
+		case '#':
+			altflag = 1;
+  8007f7:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+			goto reswitch;
+  8007fe:	e9 30 ff ff ff       	jmp    800733 <vprintfmt+0x89>
+			goto process_precision;
+  800803:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800804:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800808:	0f 89 25 ff ff ff    	jns    800733 <vprintfmt+0x89>
+				width = precision, precision = -1;
+  80080e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800811:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800814:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+			goto reswitch;
+  80081b:	e9 13 ff ff ff       	jmp    800733 <vprintfmt+0x89>
+
+		// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800820:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+			goto reswitch;
+  800824:	e9 0a ff ff ff       	jmp    800733 <vprintfmt+0x89>
+
+		// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800829:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082c:	83 f8 2f             	cmp    $0x2f,%eax
+  80082f:	77 17                	ja     800848 <vprintfmt+0x19e>
+  800831:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800835:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800838:	89 d2                	mov    %edx,%edx
+  80083a:	48 01 d0             	add    %rdx,%rax
+  80083d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800840:	83 c2 08             	add    $0x8,%edx
+  800843:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800846:	eb 0c                	jmp    800854 <vprintfmt+0x1aa>
+  800848:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80084c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800850:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800854:	8b 00                	mov    (%rax),%eax
+  800856:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80085a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80085e:	48 89 d6             	mov    %rdx,%rsi
+  800861:	89 c7                	mov    %eax,%edi
+  800863:	ff d1                	call   *%rcx
+			break;
+  800865:	e9 37 03 00 00       	jmp    800ba1 <vprintfmt+0x4f7>
+
+		// error message
+		case 'e':
+			err = va_arg(aq, int);
+  80086a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086d:	83 f8 2f             	cmp    $0x2f,%eax
+  800870:	77 17                	ja     800889 <vprintfmt+0x1df>
+  800872:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800876:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800879:	89 d2                	mov    %edx,%edx
+  80087b:	48 01 d0             	add    %rdx,%rax
+  80087e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800881:	83 c2 08             	add    $0x8,%edx
+  800884:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800887:	eb 0c                	jmp    800895 <vprintfmt+0x1eb>
+  800889:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80088d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800891:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800895:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800897:	85 db                	test   %ebx,%ebx
+  800899:	79 02                	jns    80089d <vprintfmt+0x1f3>
+				err = -err;
+  80089b:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80089d:	83 fb 11             	cmp    $0x11,%ebx
+  8008a0:	7f 16                	jg     8008b8 <vprintfmt+0x20e>
+  8008a2:	48 ba a0 2e 80 00 00 	movabs $0x802ea0,%rdx
+  8008a9:	00 00 00 
+  8008ac:	48 63 c3             	movslq %ebx,%rax
+  8008af:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  8008b3:	4d 85 e4             	test   %r12,%r12
+  8008b6:	75 2e                	jne    8008e6 <vprintfmt+0x23c>
+				printfmt(putch, putdat, "error %d", err);
+  8008b8:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8008bc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8008c0:	89 d9                	mov    %ebx,%ecx
+  8008c2:	48 ba 41 2f 80 00 00 	movabs $0x802f41,%rdx
+  8008c9:	00 00 00 
+  8008cc:	48 89 c7             	mov    %rax,%rdi
+  8008cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d4:	49 b8 b0 0b 80 00 00 	movabs $0x800bb0,%r8
+  8008db:	00 00 00 
+  8008de:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  8008e1:	e9 bb 02 00 00       	jmp    800ba1 <vprintfmt+0x4f7>
+				printfmt(putch, putdat, "%s", p);
+  8008e6:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8008ea:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8008ee:	4c 89 e1             	mov    %r12,%rcx
+  8008f1:	48 ba 4a 2f 80 00 00 	movabs $0x802f4a,%rdx
+  8008f8:	00 00 00 
+  8008fb:	48 89 c7             	mov    %rax,%rdi
+  8008fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800903:	49 b8 b0 0b 80 00 00 	movabs $0x800bb0,%r8
+  80090a:	00 00 00 
+  80090d:	41 ff d0             	call   *%r8
+			break;
+  800910:	e9 8c 02 00 00       	jmp    800ba1 <vprintfmt+0x4f7>
+
+		// string
+		case 's':
+			// 从可变参数中读入字符串指针
+			if ((p = va_arg(aq, char *)) == NULL)
+  800915:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800918:	83 f8 2f             	cmp    $0x2f,%eax
+  80091b:	77 17                	ja     800934 <vprintfmt+0x28a>
+  80091d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800921:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800924:	89 d2                	mov    %edx,%edx
+  800926:	48 01 d0             	add    %rdx,%rax
+  800929:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80092c:	83 c2 08             	add    $0x8,%edx
+  80092f:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800932:	eb 0c                	jmp    800940 <vprintfmt+0x296>
+  800934:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800938:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80093c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800940:	4c 8b 20             	mov    (%rax),%r12
+  800943:	4d 85 e4             	test   %r12,%r12
+  800946:	75 0a                	jne    800952 <vprintfmt+0x2a8>
+				p = "(null)"; // 当字符串为空时，将它指向"(null)"字符串
+  800948:	49 bc 4d 2f 80 00 00 	movabs $0x802f4d,%r12
+  80094f:	00 00 00 
+			// 判断左对齐还是右对齐，pad='-'左对齐，否则右对齐
+			if (width > 0 && padc != '-')
+  800952:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800956:	7e 78                	jle    8009d0 <vprintfmt+0x326>
+  800958:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  80095c:	74 72                	je     8009d0 <vprintfmt+0x326>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80095e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800961:	48 98                	cltq
+  800963:	48 89 c6             	mov    %rax,%rsi
+  800966:	4c 89 e7             	mov    %r12,%rdi
+  800969:	48 b8 55 0f 80 00 00 	movabs $0x800f55,%rax
+  800970:	00 00 00 
+  800973:	ff d0                	call   *%rax
+  800975:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800978:	eb 17                	jmp    800991 <vprintfmt+0x2e7>
+					putch(padc, putdat); // 字符串右对齐，左边补相应数量(width-实际长度)的空格或者 0
+  80097a:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  80097e:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800982:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800986:	48 89 d6             	mov    %rdx,%rsi
+  800989:	89 c7                	mov    %eax,%edi
+  80098b:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80098d:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800991:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800995:	7f e3                	jg     80097a <vprintfmt+0x2d0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800997:	eb 37                	jmp    8009d0 <vprintfmt+0x326>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800999:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  80099d:	74 1e                	je     8009bd <vprintfmt+0x313>
+  80099f:	83 fb 1f             	cmp    $0x1f,%ebx
+  8009a2:	7e 05                	jle    8009a9 <vprintfmt+0x2ff>
+  8009a4:	83 fb 7e             	cmp    $0x7e,%ebx
+  8009a7:	7e 14                	jle    8009bd <vprintfmt+0x313>
+					putch('?', putdat);
+  8009a9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009ad:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009b1:	48 89 c6             	mov    %rax,%rsi
+  8009b4:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8009b9:	ff d2                	call   *%rdx
+  8009bb:	eb 0f                	jmp    8009cc <vprintfmt+0x322>
+				else
+					putch(ch, putdat); // 打印相应长度的字符串
+  8009bd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009c1:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009c5:	48 89 c6             	mov    %rax,%rsi
+  8009c8:	89 df                	mov    %ebx,%edi
+  8009ca:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8009cc:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8009d0:	4c 89 e0             	mov    %r12,%rax
+  8009d3:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d7:	0f b6 00             	movzbl (%rax),%eax
+  8009da:	0f be d8             	movsbl %al,%ebx
+  8009dd:	85 db                	test   %ebx,%ebx
+  8009df:	74 28                	je     800a09 <vprintfmt+0x35f>
+  8009e1:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8009e5:	78 b2                	js     800999 <vprintfmt+0x2ef>
+  8009e7:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8009eb:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8009ef:	79 a8                	jns    800999 <vprintfmt+0x2ef>
+			for (; width > 0; width--)
+  8009f1:	eb 16                	jmp    800a09 <vprintfmt+0x35f>
+				putch(' ', putdat); // 当字符串是左对齐的时候打印相应数量的空格
+  8009f3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009f7:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009fb:	48 89 c6             	mov    %rax,%rsi
+  8009fe:	bf 20 00 00 00       	mov    $0x20,%edi
+  800a03:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800a05:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800a09:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a0d:	7f e4                	jg     8009f3 <vprintfmt+0x349>
+			break;
+  800a0f:	e9 8d 01 00 00       	jmp    800ba1 <vprintfmt+0x4f7>
+
+		// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800a14:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a18:	be 03 00 00 00       	mov    $0x3,%esi
+  800a1d:	48 89 c7             	mov    %rax,%rdi
+  800a20:	48 b8 a3 05 80 00 00 	movabs $0x8005a3,%rax
+  800a27:	00 00 00 
+  800a2a:	ff d0                	call   *%rax
+  800a2c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((long long)num < 0)
+  800a30:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a34:	48 85 c0             	test   %rax,%rax
+  800a37:	79 1d                	jns    800a56 <vprintfmt+0x3ac>
+			{
+				putch('-', putdat);
+  800a39:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a3d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a41:	48 89 c6             	mov    %rax,%rsi
+  800a44:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a49:	ff d2                	call   *%rdx
+				num = -(long long)num;
+  800a4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a4f:	48 f7 d8             	neg    %rax
+  800a52:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			}
+			base = 10;
+  800a56:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800a5d:	e9 d2 00 00 00       	jmp    800b34 <vprintfmt+0x48a>
+
+		// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800a62:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a66:	be 03 00 00 00       	mov    $0x3,%esi
+  800a6b:	48 89 c7             	mov    %rax,%rdi
+  800a6e:	48 b8 9c 04 80 00 00 	movabs $0x80049c,%rax
+  800a75:	00 00 00 
+  800a78:	ff d0                	call   *%rax
+  800a7a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 10;
+  800a7e:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800a85:	e9 aa 00 00 00       	jmp    800b34 <vprintfmt+0x48a>
+		// (unsigned) octal
+		case 'o':
+			// Gets the variable argument with type integer from the point which was processed last by va_arg
+			// calls getuint which returns a long long value, which then calls printnum which prints based on
+			// base value.
+			num = getuint(&aq, 3);
+  800a8a:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a8e:	be 03 00 00 00       	mov    $0x3,%esi
+  800a93:	48 89 c7             	mov    %rax,%rdi
+  800a96:	48 b8 9c 04 80 00 00 	movabs $0x80049c,%rax
+  800a9d:	00 00 00 
+  800aa0:	ff d0                	call   *%rax
+  800aa2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 8;
+  800aa6:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+			goto number;
+  800aad:	e9 82 00 00 00       	jmp    800b34 <vprintfmt+0x48a>
+
+		// pointer
+		case 'p':
+			putch('0', putdat);
+  800ab2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ab6:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800aba:	48 89 c6             	mov    %rax,%rsi
+  800abd:	bf 30 00 00 00       	mov    $0x30,%edi
+  800ac2:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800ac4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ac8:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800acc:	48 89 c6             	mov    %rax,%rsi
+  800acf:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ad4:	ff d2                	call   *%rdx
+			num = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800ad6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad9:	83 f8 2f             	cmp    $0x2f,%eax
+  800adc:	77 17                	ja     800af5 <vprintfmt+0x44b>
+  800ade:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ae2:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ae5:	89 d2                	mov    %edx,%edx
+  800ae7:	48 01 d0             	add    %rdx,%rax
+  800aea:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800aed:	83 c2 08             	add    $0x8,%edx
+  800af0:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800af3:	eb 0c                	jmp    800b01 <vprintfmt+0x457>
+  800af5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800af9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800afd:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b01:	48 8b 00             	mov    (%rax),%rax
+  800b04:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800b08:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+			goto number;
+  800b0f:	eb 23                	jmp    800b34 <vprintfmt+0x48a>
+
+		// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800b11:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b15:	be 03 00 00 00       	mov    $0x3,%esi
+  800b1a:	48 89 c7             	mov    %rax,%rdi
+  800b1d:	48 b8 9c 04 80 00 00 	movabs $0x80049c,%rax
+  800b24:	00 00 00 
+  800b27:	ff d0                	call   *%rax
+  800b29:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800b2d:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800b34:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800b39:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800b3c:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800b3f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b43:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800b47:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b4b:	45 89 c1             	mov    %r8d,%r9d
+  800b4e:	41 89 f8             	mov    %edi,%r8d
+  800b51:	48 89 c7             	mov    %rax,%rdi
+  800b54:	48 b8 e4 03 80 00 00 	movabs $0x8003e4,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+			break;
+  800b60:	eb 3f                	jmp    800ba1 <vprintfmt+0x4f7>
+
+		// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800b62:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b66:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b6a:	48 89 c6             	mov    %rax,%rsi
+  800b6d:	89 df                	mov    %ebx,%edi
+  800b6f:	ff d2                	call   *%rdx
+			break;
+  800b71:	eb 2e                	jmp    800ba1 <vprintfmt+0x4f7>
+
+		// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800b73:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b77:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b7b:	48 89 c6             	mov    %rax,%rsi
+  800b7e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b83:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b85:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800b8a:	eb 05                	jmp    800b91 <vprintfmt+0x4e7>
+  800b8c:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800b91:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800b95:	48 83 e8 01          	sub    $0x1,%rax
+  800b99:	0f b6 00             	movzbl (%rax),%eax
+  800b9c:	3c 25                	cmp    $0x25,%al
+  800b9e:	75 ec                	jne    800b8c <vprintfmt+0x4e2>
+				/* do nothing */;
+			break;
+  800ba0:	90                   	nop
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800ba1:	e9 56 fb ff ff       	jmp    8006fc <vprintfmt+0x52>
+				return;
+  800ba6:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800ba7:	48 83 c4 60          	add    $0x60,%rsp
+  800bab:	5b                   	pop    %rbx
+  800bac:	41 5c                	pop    %r12
+  800bae:	5d                   	pop    %rbp
+  800baf:	c3                   	ret
+
+0000000000800bb0 <printfmt>:
+
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...)
+{
+  800bb0:	55                   	push   %rbp
+  800bb1:	48 89 e5             	mov    %rsp,%rbp
+  800bb4:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800bbb:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800bc2:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800bc9:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800bd0:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800bd7:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800bde:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800be5:	84 c0                	test   %al,%al
+  800be7:	74 20                	je     800c09 <printfmt+0x59>
+  800be9:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800bed:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800bf1:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800bf5:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800bf9:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800bfd:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800c01:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800c05:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800c09:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800c10:	00 00 00 
+  800c13:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800c1a:	00 00 00 
+  800c1d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c21:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800c28:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800c2f:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800c36:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800c3d:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800c44:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800c4b:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800c52:	48 89 c7             	mov    %rax,%rdi
+  800c55:	48 b8 aa 06 80 00 00 	movabs $0x8006aa,%rax
+  800c5c:	00 00 00 
+  800c5f:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  800c61:	90                   	nop
+  800c62:	c9                   	leave
+  800c63:	c3                   	ret
+
+0000000000800c64 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800c64:	55                   	push   %rbp
+  800c65:	48 89 e5             	mov    %rsp,%rbp
+  800c68:	48 83 ec 10          	sub    $0x10,%rsp
+  800c6c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800c6f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  800c73:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c77:	8b 40 10             	mov    0x10(%rax),%eax
+  800c7a:	8d 50 01             	lea    0x1(%rax),%edx
+  800c7d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c81:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  800c84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c88:	48 8b 10             	mov    (%rax),%rdx
+  800c8b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c8f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c93:	48 39 c2             	cmp    %rax,%rdx
+  800c96:	73 17                	jae    800caf <sprintputch+0x4b>
+		*b->buf++ = ch;
+  800c98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c9c:	48 8b 00             	mov    (%rax),%rax
+  800c9f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800ca3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800ca7:	48 89 0a             	mov    %rcx,(%rdx)
+  800caa:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800cad:	88 10                	mov    %dl,(%rax)
+}
+  800caf:	90                   	nop
+  800cb0:	c9                   	leave
+  800cb1:	c3                   	ret
+
+0000000000800cb2 <vsnprintf>:
+
+int vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800cb2:	55                   	push   %rbp
+  800cb3:	48 89 e5             	mov    %rsp,%rbp
+  800cb6:	48 83 ec 50          	sub    $0x50,%rsp
+  800cba:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  800cbe:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  800cc1:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  800cc5:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+	va_list aq;
+	va_copy(aq, ap);
+  800cc9:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800ccd:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800cd1:	48 8b 06             	mov    (%rsi),%rax
+  800cd4:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800cd8:	48 89 01             	mov    %rax,(%rcx)
+  800cdb:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cdf:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800ce3:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	struct sprintbuf b = {buf, buf + n - 1, 0};
+  800ce7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ceb:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800cef:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  800cf2:	48 98                	cltq
+  800cf4:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800cf8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800cfc:	48 01 d0             	add    %rdx,%rax
+  800cff:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  800d03:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+
+	if (buf == NULL || n < 1)
+  800d0a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800d0f:	74 06                	je     800d17 <vsnprintf+0x65>
+  800d11:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800d15:	7f 07                	jg     800d1e <vsnprintf+0x6c>
+		return -E_INVAL;
+  800d17:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d1c:	eb 32                	jmp    800d50 <vsnprintf+0x9e>
+
+	// print the string to the buffer
+	vprintfmt((void *)sprintputch, &b, fmt, aq);
+  800d1e:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800d22:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  800d26:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d2a:	48 89 c6             	mov    %rax,%rsi
+  800d2d:	48 b8 64 0c 80 00 00 	movabs $0x800c64,%rax
+  800d34:	00 00 00 
+  800d37:	48 89 c7             	mov    %rax,%rdi
+  800d3a:	48 b8 aa 06 80 00 00 	movabs $0x8006aa,%rax
+  800d41:	00 00 00 
+  800d44:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  800d46:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d4a:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800d4d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  800d50:	c9                   	leave
+  800d51:	c3                   	ret
+
+0000000000800d52 <snprintf>:
+
+int snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800d52:	55                   	push   %rbp
+  800d53:	48 89 e5             	mov    %rsp,%rbp
+  800d56:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800d5d:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800d64:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800d6a:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800d71:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800d78:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800d7f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800d86:	84 c0                	test   %al,%al
+  800d88:	74 20                	je     800daa <snprintf+0x58>
+  800d8a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800d8e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800d92:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800d96:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800d9a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800d9e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800da2:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800da6:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  800daa:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800db1:	00 00 00 
+  800db4:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800dbb:	00 00 00 
+  800dbe:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800dc2:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800dc9:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800dd0:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq, ap);
+  800dd7:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800dde:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800de5:	48 8b 06             	mov    (%rsi),%rax
+  800de8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800dec:	48 89 01             	mov    %rax,(%rcx)
+  800def:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800df3:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800df7:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  800dfb:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800e02:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  800e09:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  800e0f:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800e16:	48 89 c7             	mov    %rax,%rdi
+  800e19:	48 b8 b2 0c 80 00 00 	movabs $0x800cb2,%rax
+  800e20:	00 00 00 
+  800e23:	ff d0                	call   *%rax
+  800e25:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  800e2b:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800e31:	c9                   	leave
+  800e32:	c3                   	ret
+
+0000000000800e33 <cpuid>:
+#define read_rip(var) __asm __volatile("leaq (%%rip), %0" : "=r" (var)::"cc","memory")
+
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800e33:	55                   	push   %rbp
+  800e34:	48 89 e5             	mov    %rsp,%rbp
+  800e37:	53                   	push   %rbx
+  800e38:	48 83 ec 38          	sub    $0x38,%rsp
+  800e3c:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800e3f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800e43:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800e47:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800e4b:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid" 
+  800e4f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800e52:	0f a2                	cpuid
+  800e54:	89 de                	mov    %ebx,%esi
+  800e56:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800e59:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800e5c:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800e5f:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info));
+	if (eaxp)
+  800e62:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800e67:	74 09                	je     800e72 <cpuid+0x3f>
+		*eaxp = eax;
+  800e69:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800e6d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800e70:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  800e72:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800e77:	74 09                	je     800e82 <cpuid+0x4f>
+		*ebxp = ebx;
+  800e79:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e7d:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800e80:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  800e82:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800e87:	74 09                	je     800e92 <cpuid+0x5f>
+		*ecxp = ecx;
+  800e89:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e8d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800e90:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  800e92:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800e97:	74 09                	je     800ea2 <cpuid+0x6f>
+		*edxp = edx;
+  800e99:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800e9d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800ea0:	89 10                	mov    %edx,(%rax)
+}
+  800ea2:	90                   	nop
+  800ea3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ea7:	c9                   	leave
+  800ea8:	c3                   	ret
+
+0000000000800ea9 <cpuid_count>:
+
+// 带子功能号(%ecx = count)的 cpuid，用于 leaf 4/7/0xB/0xD 等
+static __inline void
+cpuid_count(uint32_t info, uint32_t count, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800ea9:	55                   	push   %rbp
+  800eaa:	48 89 e5             	mov    %rsp,%rbp
+  800ead:	53                   	push   %rbx
+  800eae:	48 83 ec 38          	sub    $0x38,%rsp
+  800eb2:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800eb5:	89 75 e0             	mov    %esi,-0x20(%rbp)
+  800eb8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800ebc:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  800ec0:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+  800ec4:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800ec8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800ecb:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800ece:	89 d1                	mov    %edx,%ecx
+  800ed0:	0f a2                	cpuid
+  800ed2:	89 de                	mov    %ebx,%esi
+  800ed4:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800ed7:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800eda:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800edd:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info), "c" (count));
+	if (eaxp)
+  800ee0:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800ee5:	74 09                	je     800ef0 <cpuid_count+0x47>
+		*eaxp = eax;
+  800ee7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800eeb:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800eee:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  800ef0:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800ef5:	74 09                	je     800f00 <cpuid_count+0x57>
+		*ebxp = ebx;
+  800ef7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800efb:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800efe:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  800f00:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800f05:	74 09                	je     800f10 <cpuid_count+0x67>
+		*ecxp = ecx;
+  800f07:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f0b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800f0e:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  800f10:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800f15:	74 09                	je     800f20 <cpuid_count+0x77>
+		*edxp = edx;
+  800f17:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800f1b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800f1e:	89 10                	mov    %edx,(%rax)
+}
+  800f20:	90                   	nop
+  800f21:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f25:	c9                   	leave
+  800f26:	c3                   	ret
+
+0000000000800f27 <strlen>:
+// 在真正的硬件上会有一定程度的优化, 但在 Bochs 上会有更大的优化效果
+// 用这种方法, Primespipe 的运行速度快了3倍
+#define ASM 1
+
+int strlen(const char *s)
+{
+  800f27:	55                   	push   %rbp
+  800f28:	48 89 e5             	mov    %rsp,%rbp
+  800f2b:	48 83 ec 18          	sub    $0x18,%rsp
+  800f2f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800f33:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800f3a:	eb 09                	jmp    800f45 <strlen+0x1e>
+		n++;
+  800f3c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  800f40:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800f45:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f49:	0f b6 00             	movzbl (%rax),%eax
+  800f4c:	84 c0                	test   %al,%al
+  800f4e:	75 ec                	jne    800f3c <strlen+0x15>
+	return n;
+  800f50:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800f53:	c9                   	leave
+  800f54:	c3                   	ret
+
+0000000000800f55 <strnlen>:
+
+int strnlen(const char *s, size_t size)
+{
+  800f55:	55                   	push   %rbp
+  800f56:	48 89 e5             	mov    %rsp,%rbp
+  800f59:	48 83 ec 20          	sub    $0x20,%rsp
+  800f5d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800f61:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f65:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800f6c:	eb 0e                	jmp    800f7c <strnlen+0x27>
+		n++;
+  800f6e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f72:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800f77:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  800f7c:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800f81:	74 0b                	je     800f8e <strnlen+0x39>
+  800f83:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f87:	0f b6 00             	movzbl (%rax),%eax
+  800f8a:	84 c0                	test   %al,%al
+  800f8c:	75 e0                	jne    800f6e <strnlen+0x19>
+	return n;
+  800f8e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800f91:	c9                   	leave
+  800f92:	c3                   	ret
+
+0000000000800f93 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800f93:	55                   	push   %rbp
+  800f94:	48 89 e5             	mov    %rsp,%rbp
+  800f97:	48 83 ec 20          	sub    $0x20,%rsp
+  800f9b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800f9f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  800fa3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fa7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  800fab:	90                   	nop
+  800fac:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fb0:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  800fb4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800fb8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fbc:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800fc0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800fc4:	0f b6 12             	movzbl (%rdx),%edx
+  800fc7:	88 10                	mov    %dl,(%rax)
+  800fc9:	0f b6 00             	movzbl (%rax),%eax
+  800fcc:	84 c0                	test   %al,%al
+  800fce:	75 dc                	jne    800fac <strcpy+0x19>
+		/* do nothing */;
+	return ret;
+  800fd0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800fd4:	c9                   	leave
+  800fd5:	c3                   	ret
+
+0000000000800fd6 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800fd6:	55                   	push   %rbp
+  800fd7:	48 89 e5             	mov    %rsp,%rbp
+  800fda:	48 83 ec 20          	sub    $0x20,%rsp
+  800fde:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800fe2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int len = strlen(dst);
+  800fe6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fea:	48 89 c7             	mov    %rax,%rdi
+  800fed:	48 b8 27 0f 80 00 00 	movabs $0x800f27,%rax
+  800ff4:	00 00 00 
+  800ff7:	ff d0                	call   *%rax
+  800ff9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	strcpy(dst + len, src);
+  800ffc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800fff:	48 63 d0             	movslq %eax,%rdx
+  801002:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801006:	48 01 c2             	add    %rax,%rdx
+  801009:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80100d:	48 89 c6             	mov    %rax,%rsi
+  801010:	48 89 d7             	mov    %rdx,%rdi
+  801013:	48 b8 93 0f 80 00 00 	movabs $0x800f93,%rax
+  80101a:	00 00 00 
+  80101d:	ff d0                	call   *%rax
+	return dst;
+  80101f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801023:	c9                   	leave
+  801024:	c3                   	ret
+
+0000000000801025 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  801025:	55                   	push   %rbp
+  801026:	48 89 e5             	mov    %rsp,%rbp
+  801029:	48 83 ec 28          	sub    $0x28,%rsp
+  80102d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801031:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801035:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801039:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80103d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++)
+  801041:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801048:	00 
+  801049:	eb 2a                	jmp    801075 <strncpy+0x50>
+	{
+		*dst++ = *src;
+  80104b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80104f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801053:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801057:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80105b:	0f b6 12             	movzbl (%rdx),%edx
+  80105e:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801060:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801064:	0f b6 00             	movzbl (%rax),%eax
+  801067:	84 c0                	test   %al,%al
+  801069:	74 05                	je     801070 <strncpy+0x4b>
+			src++;
+  80106b:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++)
+  801070:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801075:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801079:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80107d:	72 cc                	jb     80104b <strncpy+0x26>
+	}
+	return ret;
+  80107f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801083:	c9                   	leave
+  801084:	c3                   	ret
+
+0000000000801085 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801085:	55                   	push   %rbp
+  801086:	48 89 e5             	mov    %rsp,%rbp
+  801089:	48 83 ec 28          	sub    $0x28,%rsp
+  80108d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801091:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801095:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801099:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80109d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0)
+  8010a1:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8010a6:	74 3d                	je     8010e5 <strlcpy+0x60>
+	{
+		while (--size > 0 && *src != '\0')
+  8010a8:	eb 1d                	jmp    8010c7 <strlcpy+0x42>
+			*dst++ = *src++;
+  8010aa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8010ae:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8010b2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8010b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010ba:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8010be:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8010c2:	0f b6 12             	movzbl (%rdx),%edx
+  8010c5:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  8010c7:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8010cc:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8010d1:	74 0b                	je     8010de <strlcpy+0x59>
+  8010d3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8010d7:	0f b6 00             	movzbl (%rax),%eax
+  8010da:	84 c0                	test   %al,%al
+  8010dc:	75 cc                	jne    8010aa <strlcpy+0x25>
+		*dst = '\0';
+  8010de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010e2:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8010e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010e9:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8010ed:	c9                   	leave
+  8010ee:	c3                   	ret
+
+00000000008010ef <strcmp>:
+
+int strcmp(const char *p, const char *q)
+{
+  8010ef:	55                   	push   %rbp
+  8010f0:	48 89 e5             	mov    %rsp,%rbp
+  8010f3:	48 83 ec 10          	sub    $0x10,%rsp
+  8010f7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8010fb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8010ff:	eb 0a                	jmp    80110b <strcmp+0x1c>
+		p++, q++;
+  801101:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801106:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  80110b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80110f:	0f b6 00             	movzbl (%rax),%eax
+  801112:	84 c0                	test   %al,%al
+  801114:	74 12                	je     801128 <strcmp+0x39>
+  801116:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80111a:	0f b6 10             	movzbl (%rax),%edx
+  80111d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801121:	0f b6 00             	movzbl (%rax),%eax
+  801124:	38 c2                	cmp    %al,%dl
+  801126:	74 d9                	je     801101 <strcmp+0x12>
+	return (int)((unsigned char)*p - (unsigned char)*q);
+  801128:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80112c:	0f b6 00             	movzbl (%rax),%eax
+  80112f:	0f b6 d0             	movzbl %al,%edx
+  801132:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801136:	0f b6 00             	movzbl (%rax),%eax
+  801139:	0f b6 c0             	movzbl %al,%eax
+  80113c:	29 c2                	sub    %eax,%edx
+  80113e:	89 d0                	mov    %edx,%eax
+}
+  801140:	c9                   	leave
+  801141:	c3                   	ret
+
+0000000000801142 <strncmp>:
+
+int strncmp(const char *p, const char *q, size_t n)
+{
+  801142:	55                   	push   %rbp
+  801143:	48 89 e5             	mov    %rsp,%rbp
+  801146:	48 83 ec 18          	sub    $0x18,%rsp
+  80114a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80114e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801152:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801156:	eb 0f                	jmp    801167 <strncmp+0x25>
+		n--, p++, q++;
+  801158:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80115d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801162:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801167:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80116c:	74 1d                	je     80118b <strncmp+0x49>
+  80116e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801172:	0f b6 00             	movzbl (%rax),%eax
+  801175:	84 c0                	test   %al,%al
+  801177:	74 12                	je     80118b <strncmp+0x49>
+  801179:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80117d:	0f b6 10             	movzbl (%rax),%edx
+  801180:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801184:	0f b6 00             	movzbl (%rax),%eax
+  801187:	38 c2                	cmp    %al,%dl
+  801189:	74 cd                	je     801158 <strncmp+0x16>
+	if (n == 0)
+  80118b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801190:	75 07                	jne    801199 <strncmp+0x57>
+		return 0;
+  801192:	ba 00 00 00 00       	mov    $0x0,%edx
+  801197:	eb 16                	jmp    8011af <strncmp+0x6d>
+	else
+		return (int)((unsigned char)*p - (unsigned char)*q);
+  801199:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80119d:	0f b6 00             	movzbl (%rax),%eax
+  8011a0:	0f b6 d0             	movzbl %al,%edx
+  8011a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011a7:	0f b6 00             	movzbl (%rax),%eax
+  8011aa:	0f b6 c0             	movzbl %al,%eax
+  8011ad:	29 c2                	sub    %eax,%edx
+}
+  8011af:	89 d0                	mov    %edx,%eax
+  8011b1:	c9                   	leave
+  8011b2:	c3                   	ret
+
+00000000008011b3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8011b3:	55                   	push   %rbp
+  8011b4:	48 89 e5             	mov    %rsp,%rbp
+  8011b7:	48 83 ec 10          	sub    $0x10,%rsp
+  8011bb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8011bf:	89 f0                	mov    %esi,%eax
+  8011c1:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8011c4:	eb 17                	jmp    8011dd <strchr+0x2a>
+		if (*s == c)
+  8011c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011ca:	0f b6 00             	movzbl (%rax),%eax
+  8011cd:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8011d0:	75 06                	jne    8011d8 <strchr+0x25>
+			return (char *)s;
+  8011d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011d6:	eb 15                	jmp    8011ed <strchr+0x3a>
+	for (; *s; s++)
+  8011d8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8011dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011e1:	0f b6 00             	movzbl (%rax),%eax
+  8011e4:	84 c0                	test   %al,%al
+  8011e6:	75 de                	jne    8011c6 <strchr+0x13>
+	return 0;
+  8011e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011ed:	c9                   	leave
+  8011ee:	c3                   	ret
+
+00000000008011ef <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8011ef:	55                   	push   %rbp
+  8011f0:	48 89 e5             	mov    %rsp,%rbp
+  8011f3:	48 83 ec 10          	sub    $0x10,%rsp
+  8011f7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8011fb:	89 f0                	mov    %esi,%eax
+  8011fd:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801200:	eb 11                	jmp    801213 <strfind+0x24>
+		if (*s == c)
+  801202:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801206:	0f b6 00             	movzbl (%rax),%eax
+  801209:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80120c:	74 12                	je     801220 <strfind+0x31>
+	for (; *s; s++)
+  80120e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801213:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801217:	0f b6 00             	movzbl (%rax),%eax
+  80121a:	84 c0                	test   %al,%al
+  80121c:	75 e4                	jne    801202 <strfind+0x13>
+  80121e:	eb 01                	jmp    801221 <strfind+0x32>
+			break;
+  801220:	90                   	nop
+	return (char *)s;
+  801221:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801225:	c9                   	leave
+  801226:	c3                   	ret
+
+0000000000801227 <mem_init>:
+};
+
+static int mem_features;
+
+void mem_init(void)
+{
+  801227:	55                   	push   %rbp
+  801228:	48 89 e5             	mov    %rsp,%rbp
+  80122b:	48 83 ec 10          	sub    $0x10,%rsp
+	uint32_t max, ebx, edx;
+
+	mem_features = 0;
+  80122f:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  801236:	00 00 00 
+  801239:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	cpuid(0, &max, NULL, NULL, NULL);
+  80123f:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+  801243:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801249:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80124e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801253:	48 89 c6             	mov    %rax,%rsi
+  801256:	bf 00 00 00 00       	mov    $0x0,%edi
+  80125b:	48 b8 33 0e 80 00 00 	movabs $0x800e33,%rax
+  801262:	00 00 00 
+  801265:	ff d0                	call   *%rax
+	cpuid(1, NULL, NULL, NULL, &edx);
+  801267:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  80126b:	49 89 c0             	mov    %rax,%r8
+  80126e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801273:	ba 00 00 00 00       	mov    $0x0,%edx
+  801278:	be 00 00 00 00       	mov    $0x0,%esi
+  80127d:	bf 01 00 00 00       	mov    $0x1,%edi
+  801282:	48 b8 33 0e 80 00 00 	movabs $0x800e33,%rax
+  801289:	00 00 00 
+  80128c:	ff d0                	call   *%rax
+	if (edx & (1 << 26))
+  80128e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801291:	25 00 00 00 04       	and    $0x4000000,%eax
+  801296:	85 c0                	test   %eax,%eax
+  801298:	74 1d                	je     8012b7 <mem_init+0x90>
+		mem_features |= MEM_F_NT;
+  80129a:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8012a1:	00 00 00 
+  8012a4:	8b 00                	mov    (%rax),%eax
+  8012a6:	83 c8 02             	or     $0x2,%eax
+  8012a9:	89 c2                	mov    %eax,%edx
+  8012ab:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8012b2:	00 00 00 
+  8012b5:	89 10                	mov    %edx,(%rax)
+	if (max >= 7)
+  8012b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012ba:	83 f8 06             	cmp    $0x6,%eax
+  8012bd:	76 57                	jbe    801316 <mem_init+0xef>
+	{
+		cpuid_count(7, 0, NULL, &ebx, NULL, NULL);
+  8012bf:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  8012c3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8012c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012cf:	48 89 c1             	mov    %rax,%rcx
+  8012d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8012dc:	bf 07 00 00 00       	mov    $0x7,%edi
+  8012e1:	48 b8 a9 0e 80 00 00 	movabs $0x800ea9,%rax
+  8012e8:	00 00 00 
+  8012eb:	ff d0                	call   *%rax
+		if (ebx & (1 << 9))
+  8012ed:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8012f0:	25 00 02 00 00       	and    $0x200,%eax
+  8012f5:	85 c0                	test   %eax,%eax
+  8012f7:	74 1d                	je     801316 <mem_init+0xef>
+			mem_features |= MEM_F_ERMS;
+  8012f9:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  801300:	00 00 00 
+  801303:	8b 00                	mov    (%rax),%eax
+  801305:	83 c8 01             	or     $0x1,%eax
+  801308:	89 c2                	mov    %eax,%edx
+  80130a:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  801311:	00 00 00 
+  801314:	89 10                	mov    %edx,(%rax)
+	}
+}
+  801316:	90                   	nop
+  801317:	c9                   	leave
+  801318:	c3                   	ret
+
+0000000000801319 <memset_nt>:
+
+// 非临时存储填充 n 字节(v 8 字节对齐，n 为 32 的倍数)
+static void
+memset_nt(void *v, uint64_t pattern, size_t n)
+{
+  801319:	55                   	push   %rbp
+  80131a:	48 89 e5             	mov    %rsp,%rbp
+  80131d:	48 83 ec 28          	sub    $0x28,%rsp
+  801321:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801325:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801329:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t *p = (uint64_t *)v;
+  80132d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801331:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint64_t *end = p + n / 8;
+  801335:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801339:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  80133d:	48 89 c2             	mov    %rax,%rdx
+  801340:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801344:	48 01 d0             	add    %rdx,%rax
+  801347:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	for (; p < end; p += 4)
+  80134b:	eb 20                	jmp    80136d <memset_nt+0x54>
+		asm volatile("movnti %1, 0(%0)\n\t"
+  80134d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801351:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801355:	48 0f c3 10          	movnti %rdx,(%rax)
+  801359:	48 0f c3 50 08       	movnti %rdx,0x8(%rax)
+  80135e:	48 0f c3 50 10       	movnti %rdx,0x10(%rax)
+  801363:	48 0f c3 50 18       	movnti %rdx,0x18(%rax)
+	for (; p < end; p += 4)
+  801368:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  80136d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801371:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801375:	72 d6                	jb     80134d <memset_nt+0x34>
+					 "movnti %1, 16(%0)\n\t"
+					 "movnti %1, 24(%0)"
+					 :
+					 : "r"(p), "r"(pattern)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  801377:	0f ae f8             	sfence
+}
+  80137a:	90                   	nop
+  80137b:	c9                   	leave
+  80137c:	c3                   	ret
+
+000000000080137d <memcpy_nt>:
+
+// 非临时存储复制 n 字节(dst/src 8 字节对齐且不重叠，n 为 32 的倍数)
+static void
+memcpy_nt(void *dst, const void *src, size_t n)
+{
+  80137d:	55                   	push   %rbp
+  80137e:	48 89 e5             	mov    %rsp,%rbp
+  801381:	48 83 ec 58          	sub    $0x58,%rsp
+  801385:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801389:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  80138d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	uint64_t *d = (uint64_t *)dst;
+  801391:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801395:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint64_t *s = (const uint64_t *)src;
+  801399:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80139d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	uint64_t *end = d + n / 8;
+  8013a1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8013a5:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  8013a9:	48 89 c2             	mov    %rax,%rdx
+  8013ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013b0:	48 01 d0             	add    %rdx,%rax
+  8013b3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint64_t t0, t1, t2, t3;
+
+	for (; d < end; d += 4, s += 4)
+  8013b7:	eb 44                	jmp    8013fd <memcpy_nt+0x80>
+		asm volatile("movq 0(%4), %0\n\t"
+  8013b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013bd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8013c1:	4c 8b 00             	mov    (%rax),%r8
+  8013c4:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  8013c8:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  8013cc:	48 8b 48 18          	mov    0x18(%rax),%rcx
+  8013d0:	4c 0f c3 02          	movnti %r8,(%rdx)
+  8013d4:	48 0f c3 7a 08       	movnti %rdi,0x8(%rdx)
+  8013d9:	48 0f c3 72 10       	movnti %rsi,0x10(%rdx)
+  8013de:	48 0f c3 4a 18       	movnti %rcx,0x18(%rdx)
+  8013e3:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8013e7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8013eb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8013ef:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+	for (; d < end; d += 4, s += 4)
+  8013f3:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  8013f8:	48 83 45 f0 20       	addq   $0x20,-0x10(%rbp)
+  8013fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801401:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  801405:	72 b2                	jb     8013b9 <memcpy_nt+0x3c>
+					 "movnti %2, 16(%5)\n\t"
+					 "movnti %3, 24(%5)"
+					 : "=&r"(t0), "=&r"(t1), "=&r"(t2), "=&r"(t3)
+					 : "r"(s), "r"(d)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  801407:	0f ae f8             	sfence
+}
+  80140a:	90                   	nop
+  80140b:	c9                   	leave
+  80140c:	c3                   	ret
+
+000000000080140d <memcpy_fwd>:
+
+// 正向复制(dst 在 src 之前或两者不重叠)
+static void
+memcpy_fwd(void *dst, const void *src, size_t n)
+{
+  80140d:	55                   	push   %rbp
+  80140e:	48 89 e5             	mov    %rsp,%rbp
+  801411:	48 83 ec 18          	sub    $0x18,%rsp
+  801415:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801419:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80141d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  801421:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  801428:	00 00 00 
+  80142b:	8b 00                	mov    (%rax),%eax
+  80142d:	83 e0 02             	and    $0x2,%eax
+  801430:	85 c0                	test   %eax,%eax
+  801432:	74 66                	je     80149a <memcpy_fwd+0x8d>
+  801434:	48 81 7d e8 ff 0f 00 	cmpq   $0xfff,-0x18(%rbp)
+  80143b:	00 
+  80143c:	76 5c                	jbe    80149a <memcpy_fwd+0x8d>
+  80143e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801442:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801446:	48 09 d0             	or     %rdx,%rax
+  801449:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  80144d:	83 e0 1f             	and    $0x1f,%eax
+  801450:	48 85 c0             	test   %rax,%rax
+  801453:	75 45                	jne    80149a <memcpy_fwd+0x8d>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  801455:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801459:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80145d:	48 01 d0             	add    %rdx,%rax
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  801460:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801464:	73 11                	jae    801477 <memcpy_fwd+0x6a>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  801466:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80146a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80146e:	48 01 d0             	add    %rdx,%rax
+  801471:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801475:	72 23                	jb     80149a <memcpy_fwd+0x8d>
+		memcpy_nt(dst, src, n);
+  801477:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80147b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80147f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801483:	48 89 ce             	mov    %rcx,%rsi
+  801486:	48 89 c7             	mov    %rax,%rdi
+  801489:	48 b8 7d 13 80 00 00 	movabs $0x80137d,%rax
+  801490:	00 00 00 
+  801493:	ff d0                	call   *%rax
+  801495:	e9 81 00 00 00       	jmp    80151b <memcpy_fwd+0x10e>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  80149a:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8014a1:	00 00 00 
+  8014a4:	8b 00                	mov    (%rax),%eax
+  8014a6:	83 e0 01             	and    $0x1,%eax
+  8014a9:	85 c0                	test   %eax,%eax
+  8014ab:	74 21                	je     8014ce <memcpy_fwd+0xc1>
+  8014ad:	48 81 7d e8 ff 00 00 	cmpq   $0xff,-0x18(%rbp)
+  8014b4:	00 
+  8014b5:	76 17                	jbe    8014ce <memcpy_fwd+0xc1>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  8014b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014bb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8014bf:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8014c3:	48 89 c7             	mov    %rax,%rdi
+  8014c6:	48 89 d6             	mov    %rdx,%rsi
+  8014c9:	fc                   	cld
+  8014ca:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8014cc:	eb 4d                	jmp    80151b <memcpy_fwd+0x10e>
+					 : "cc", "memory");
+	else if ((((uint64_t)dst | (uint64_t)src | n) & 7) == 0)
+  8014ce:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8014d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014d6:	48 09 d0             	or     %rdx,%rax
+  8014d9:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  8014dd:	83 e0 07             	and    $0x7,%eax
+  8014e0:	48 85 c0             	test   %rax,%rax
+  8014e3:	75 1f                	jne    801504 <memcpy_fwd+0xf7>
+		asm volatile("cld; rep movsq\n" ::"D"(dst), "S"(src), "c"(n / 8)
+  8014e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014e9:	48 c1 e8 03          	shr    $0x3,%rax
+  8014ed:	48 89 c1             	mov    %rax,%rcx
+  8014f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014f4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8014f8:	48 89 c7             	mov    %rax,%rdi
+  8014fb:	48 89 d6             	mov    %rdx,%rsi
+  8014fe:	fc                   	cld
+  8014ff:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+					 : "cc", "memory");
+}
+  801502:	eb 17                	jmp    80151b <memcpy_fwd+0x10e>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  801504:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801508:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80150c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801510:	48 89 c7             	mov    %rax,%rdi
+  801513:	48 89 d6             	mov    %rdx,%rsi
+  801516:	fc                   	cld
+  801517:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+  801519:	eb 00                	jmp    80151b <memcpy_fwd+0x10e>
+  80151b:	90                   	nop
+  80151c:	c9                   	leave
+  80151d:	c3                   	ret
+
+000000000080151e <memset>:
+
+void *
+memset(void *v, int c, size_t n)
+{
+  80151e:	55                   	push   %rbp
+  80151f:	48 89 e5             	mov    %rsp,%rbp
+  801522:	48 83 ec 28          	sub    $0x28,%rsp
+  801526:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80152a:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  80152d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t pattern;
+
+	if (n == 0)
+  801531:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801536:	75 09                	jne    801541 <memset+0x23>
+		return v;
+  801538:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80153c:	e9 dc 00 00 00       	jmp    80161d <memset+0xff>
+	c &= 0xFF;
+  801541:	81 65 e4 ff 00 00 00 	andl   $0xff,-0x1c(%rbp)
+	pattern = (uint64_t)c * 0x0101010101010101UL;
+  801548:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80154b:	48 98                	cltq
+  80154d:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801554:	01 01 01 
+  801557:	48 0f af c2          	imul   %rdx,%rax
+  80155b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)v | n) & 31) == 0)
+  80155f:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  801566:	00 00 00 
+  801569:	8b 00                	mov    (%rax),%eax
+  80156b:	83 e0 02             	and    $0x2,%eax
+  80156e:	85 c0                	test   %eax,%eax
+  801570:	74 3a                	je     8015ac <memset+0x8e>
+  801572:	48 81 7d d8 ff 0f 00 	cmpq   $0xfff,-0x28(%rbp)
+  801579:	00 
+  80157a:	76 30                	jbe    8015ac <memset+0x8e>
+  80157c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801580:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  801584:	83 e0 1f             	and    $0x1f,%eax
+  801587:	48 85 c0             	test   %rax,%rax
+  80158a:	75 20                	jne    8015ac <memset+0x8e>
+		memset_nt(v, pattern, n);
+  80158c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801590:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801594:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801598:	48 89 ce             	mov    %rcx,%rsi
+  80159b:	48 89 c7             	mov    %rax,%rdi
+  80159e:	48 b8 19 13 80 00 00 	movabs $0x801319,%rax
+  8015a5:	00 00 00 
+  8015a8:	ff d0                	call   *%rax
+  8015aa:	eb 6d                	jmp    801619 <memset+0xfb>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  8015ac:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8015b3:	00 00 00 
+  8015b6:	8b 00                	mov    (%rax),%eax
+  8015b8:	83 e0 01             	and    $0x1,%eax
+  8015bb:	85 c0                	test   %eax,%eax
+  8015bd:	74 1d                	je     8015dc <memset+0xbe>
+  8015bf:	48 81 7d d8 ff 00 00 	cmpq   $0xff,-0x28(%rbp)
+  8015c6:	00 
+  8015c7:	76 13                	jbe    8015dc <memset+0xbe>
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  8015c9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8015cd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8015d0:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8015d4:	48 89 d7             	mov    %rdx,%rdi
+  8015d7:	fc                   	cld
+  8015d8:	f3 aa                	rep stos %al,%es:(%rdi)
+  8015da:	eb 3d                	jmp    801619 <memset+0xfb>
+					 : "cc", "memory");
+	else if ((((uint64_t)v | n) & 7) == 0)
+  8015dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015e0:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  8015e4:	83 e0 07             	and    $0x7,%eax
+  8015e7:	48 85 c0             	test   %rax,%rax
+  8015ea:	75 1c                	jne    801608 <memset+0xea>
+		asm volatile("cld; rep stosq\n" ::"D"(v), "a"(pattern), "c"(n / 8)
+  8015ec:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015f0:	48 c1 e8 03          	shr    $0x3,%rax
+  8015f4:	48 89 c1             	mov    %rax,%rcx
+  8015f7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8015fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015ff:	48 89 d7             	mov    %rdx,%rdi
+  801602:	fc                   	cld
+  801603:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801606:	eb 11                	jmp    801619 <memset+0xfb>
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  801608:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80160c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80160f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801613:	48 89 d7             	mov    %rdx,%rdi
+  801616:	fc                   	cld
+  801617:	f3 aa                	rep stos %al,%es:(%rdi)
+					 : "cc", "memory");
+	return v;
+  801619:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80161d:	c9                   	leave
+  80161e:	c3                   	ret
+
+000000000080161f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80161f:	55                   	push   %rbp
+  801620:	48 89 e5             	mov    %rsp,%rbp
+  801623:	48 83 ec 28          	sub    $0x28,%rsp
+  801627:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80162b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80162f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801633:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801637:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  80163b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80163f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d)
+  801643:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801647:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80164b:	73 7c                	jae    8016c9 <memmove+0xaa>
+  80164d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801651:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801655:	48 01 d0             	add    %rdx,%rax
+  801658:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80165c:	73 6b                	jae    8016c9 <memmove+0xaa>
+	{
+		// 重叠且 dst 在 src 之后，只能反向复制(ERMS 对反向 rep movsb 没有优化)
+		s += n;
+  80165e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801662:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801666:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80166a:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((((uint64_t)s | (uint64_t)d | n) & 7) == 0)
+  80166e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801672:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801676:	48 09 d0             	or     %rdx,%rax
+  801679:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  80167d:	83 e0 07             	and    $0x7,%eax
+  801680:	48 85 c0             	test   %rax,%rax
+  801683:	75 24                	jne    8016a9 <memmove+0x8a>
+			asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801685:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801689:	48 83 e8 08          	sub    $0x8,%rax
+  80168d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801691:	48 83 ea 08          	sub    $0x8,%rdx
+  801695:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801699:	48 c1 e9 03          	shr    $0x3,%rcx
+  80169d:	48 89 c7             	mov    %rax,%rdi
+  8016a0:	48 89 d6             	mov    %rdx,%rsi
+  8016a3:	fd                   	std
+  8016a4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8016a7:	eb 1d                	jmp    8016c6 <memmove+0xa7>
+						 : "cc", "memory");
+		else
+			asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8016a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016ad:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8016b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016b5:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+  8016b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016bd:	48 89 d7             	mov    %rdx,%rdi
+  8016c0:	48 89 c1             	mov    %rax,%rcx
+  8016c3:	fd                   	std
+  8016c4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+						 : "cc", "memory");
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::
+  8016c6:	fc                   	cld
+  8016c7:	eb 25                	jmp    8016ee <memmove+0xcf>
+						 : "cc");
+	}
+	else if (n)
+  8016c9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016ce:	74 1e                	je     8016ee <memmove+0xcf>
+		memcpy_fwd(d, s, n);
+  8016d0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8016d4:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8016d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016dc:	48 89 ce             	mov    %rcx,%rsi
+  8016df:	48 89 c7             	mov    %rax,%rdi
+  8016e2:	48 b8 0d 14 80 00 00 	movabs $0x80140d,%rax
+  8016e9:	00 00 00 
+  8016ec:	ff d0                	call   *%rax
+	return dst;
+  8016ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8016f2:	c9                   	leave
+  8016f3:	c3                   	ret
+
+00000000008016f4 <memcpy>:
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8016f4:	55                   	push   %rbp
+  8016f5:	48 89 e5             	mov    %rsp,%rbp
+  8016f8:	48 83 ec 18          	sub    $0x18,%rsp
+  8016fc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801700:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801704:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (n)
+  801708:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80170d:	74 1e                	je     80172d <memcpy+0x39>
+		memcpy_fwd(dst, src, n);
+  80170f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801713:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801717:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80171b:	48 89 ce             	mov    %rcx,%rsi
+  80171e:	48 89 c7             	mov    %rax,%rdi
+  801721:	48 b8 0d 14 80 00 00 	movabs $0x80140d,%rax
+  801728:	00 00 00 
+  80172b:	ff d0                	call   *%rax
+	return dst;
+  80172d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801731:	c9                   	leave
+  801732:	c3                   	ret
+
+0000000000801733 <memcmp>:
+{
+}
+#endif
+
+int memcmp(const void *v1, const void *v2, size_t n)
+{
+  801733:	55                   	push   %rbp
+  801734:	48 89 e5             	mov    %rsp,%rbp
+  801737:	48 83 ec 28          	sub    $0x28,%rsp
+  80173b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80173f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801743:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *)v1;
+  801747:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80174b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *)v2;
+  80174f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801753:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0)
+  801757:	eb 34                	jmp    80178d <memcmp+0x5a>
+	{
+		if (*s1 != *s2)
+  801759:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80175d:	0f b6 10             	movzbl (%rax),%edx
+  801760:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801764:	0f b6 00             	movzbl (%rax),%eax
+  801767:	38 c2                	cmp    %al,%dl
+  801769:	74 18                	je     801783 <memcmp+0x50>
+			return (int)*s1 - (int)*s2;
+  80176b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80176f:	0f b6 00             	movzbl (%rax),%eax
+  801772:	0f b6 d0             	movzbl %al,%edx
+  801775:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801779:	0f b6 00             	movzbl (%rax),%eax
+  80177c:	0f b6 c0             	movzbl %al,%eax
+  80177f:	29 c2                	sub    %eax,%edx
+  801781:	eb 20                	jmp    8017a3 <memcmp+0x70>
+		s1++, s2++;
+  801783:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801788:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0)
+  80178d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801791:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801795:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801799:	48 85 c0             	test   %rax,%rax
+  80179c:	75 bb                	jne    801759 <memcmp+0x26>
+	}
+
+	return 0;
+  80179e:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  8017a3:	89 d0                	mov    %edx,%eax
+  8017a5:	c9                   	leave
+  8017a6:	c3                   	ret
+
+00000000008017a7 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8017a7:	55                   	push   %rbp
+  8017a8:	48 89 e5             	mov    %rsp,%rbp
+  8017ab:	48 83 ec 28          	sub    $0x28,%rsp
+  8017af:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017b3:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8017b6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *)s + n;
+  8017ba:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8017be:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017c2:	48 01 d0             	add    %rdx,%rax
+  8017c5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  8017c9:	eb 13                	jmp    8017de <memfind+0x37>
+		if (*(const unsigned char *)s == (unsigned char)c)
+  8017cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017cf:	0f b6 00             	movzbl (%rax),%eax
+  8017d2:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8017d5:	38 d0                	cmp    %dl,%al
+  8017d7:	74 11                	je     8017ea <memfind+0x43>
+	for (; s < ends; s++)
+  8017d9:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8017de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017e2:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8017e6:	72 e3                	jb     8017cb <memfind+0x24>
+  8017e8:	eb 01                	jmp    8017eb <memfind+0x44>
+			break;
+  8017ea:	90                   	nop
+	return (void *)s;
+  8017eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8017ef:	c9                   	leave
+  8017f0:	c3                   	ret
+
+00000000008017f1 <strtol>:
+
+long strtol(const char *s, char **endptr, int base)
+{
+  8017f1:	55                   	push   %rbp
+  8017f2:	48 89 e5             	mov    %rsp,%rbp
+  8017f5:	48 83 ec 38          	sub    $0x38,%rsp
+  8017f9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8017fd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801801:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801804:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  80180b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801812:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801813:	eb 05                	jmp    80181a <strtol+0x29>
+		s++;
+  801815:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  80181a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80181e:	0f b6 00             	movzbl (%rax),%eax
+  801821:	3c 20                	cmp    $0x20,%al
+  801823:	74 f0                	je     801815 <strtol+0x24>
+  801825:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801829:	0f b6 00             	movzbl (%rax),%eax
+  80182c:	3c 09                	cmp    $0x9,%al
+  80182e:	74 e5                	je     801815 <strtol+0x24>
+
+	// plus/minus sign
+	if (*s == '+')
+  801830:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801834:	0f b6 00             	movzbl (%rax),%eax
+  801837:	3c 2b                	cmp    $0x2b,%al
+  801839:	75 07                	jne    801842 <strtol+0x51>
+		s++;
+  80183b:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801840:	eb 17                	jmp    801859 <strtol+0x68>
+	else if (*s == '-')
+  801842:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801846:	0f b6 00             	movzbl (%rax),%eax
+  801849:	3c 2d                	cmp    $0x2d,%al
+  80184b:	75 0c                	jne    801859 <strtol+0x68>
+		s++, neg = 1;
+  80184d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801852:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801859:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80185d:	74 06                	je     801865 <strtol+0x74>
+  80185f:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801863:	75 28                	jne    80188d <strtol+0x9c>
+  801865:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801869:	0f b6 00             	movzbl (%rax),%eax
+  80186c:	3c 30                	cmp    $0x30,%al
+  80186e:	75 1d                	jne    80188d <strtol+0x9c>
+  801870:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801874:	48 83 c0 01          	add    $0x1,%rax
+  801878:	0f b6 00             	movzbl (%rax),%eax
+  80187b:	3c 78                	cmp    $0x78,%al
+  80187d:	75 0e                	jne    80188d <strtol+0x9c>
+		s += 2, base = 16;
+  80187f:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801884:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  80188b:	eb 2c                	jmp    8018b9 <strtol+0xc8>
+	else if (base == 0 && s[0] == '0')
+  80188d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801891:	75 19                	jne    8018ac <strtol+0xbb>
+  801893:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801897:	0f b6 00             	movzbl (%rax),%eax
+  80189a:	3c 30                	cmp    $0x30,%al
+  80189c:	75 0e                	jne    8018ac <strtol+0xbb>
+		s++, base = 8;
+  80189e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8018a3:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  8018aa:	eb 0d                	jmp    8018b9 <strtol+0xc8>
+	else if (base == 0)
+  8018ac:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8018b0:	75 07                	jne    8018b9 <strtol+0xc8>
+		base = 10;
+  8018b2:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+	// digits
+	while (1)
+	{
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  8018b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018bd:	0f b6 00             	movzbl (%rax),%eax
+  8018c0:	3c 2f                	cmp    $0x2f,%al
+  8018c2:	7e 1d                	jle    8018e1 <strtol+0xf0>
+  8018c4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018c8:	0f b6 00             	movzbl (%rax),%eax
+  8018cb:	3c 39                	cmp    $0x39,%al
+  8018cd:	7f 12                	jg     8018e1 <strtol+0xf0>
+			dig = *s - '0';
+  8018cf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018d3:	0f b6 00             	movzbl (%rax),%eax
+  8018d6:	0f be c0             	movsbl %al,%eax
+  8018d9:	83 e8 30             	sub    $0x30,%eax
+  8018dc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8018df:	eb 4e                	jmp    80192f <strtol+0x13e>
+		else if (*s >= 'a' && *s <= 'z')
+  8018e1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018e5:	0f b6 00             	movzbl (%rax),%eax
+  8018e8:	3c 60                	cmp    $0x60,%al
+  8018ea:	7e 1d                	jle    801909 <strtol+0x118>
+  8018ec:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018f0:	0f b6 00             	movzbl (%rax),%eax
+  8018f3:	3c 7a                	cmp    $0x7a,%al
+  8018f5:	7f 12                	jg     801909 <strtol+0x118>
+			dig = *s - 'a' + 10;
+  8018f7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018fb:	0f b6 00             	movzbl (%rax),%eax
+  8018fe:	0f be c0             	movsbl %al,%eax
+  801901:	83 e8 57             	sub    $0x57,%eax
+  801904:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801907:	eb 26                	jmp    80192f <strtol+0x13e>
+		else if (*s >= 'A' && *s <= 'Z')
+  801909:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80190d:	0f b6 00             	movzbl (%rax),%eax
+  801910:	3c 40                	cmp    $0x40,%al
+  801912:	7e 47                	jle    80195b <strtol+0x16a>
+  801914:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801918:	0f b6 00             	movzbl (%rax),%eax
+  80191b:	3c 5a                	cmp    $0x5a,%al
+  80191d:	7f 3c                	jg     80195b <strtol+0x16a>
+			dig = *s - 'A' + 10;
+  80191f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801923:	0f b6 00             	movzbl (%rax),%eax
+  801926:	0f be c0             	movsbl %al,%eax
+  801929:	83 e8 37             	sub    $0x37,%eax
+  80192c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  80192f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801932:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801935:	7d 23                	jge    80195a <strtol+0x169>
+			break;
+		s++, val = (val * base) + dig;
+  801937:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80193c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80193f:	48 98                	cltq
+  801941:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801946:	48 89 c2             	mov    %rax,%rdx
+  801949:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80194c:	48 98                	cltq
+  80194e:	48 01 d0             	add    %rdx,%rax
+  801951:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+  801955:	e9 5f ff ff ff       	jmp    8018b9 <strtol+0xc8>
+			break;
+  80195a:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80195b:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801960:	74 0b                	je     80196d <strtol+0x17c>
+		*endptr = (char *)s;
+  801962:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801966:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80196a:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  80196d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801971:	74 09                	je     80197c <strtol+0x18b>
+  801973:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801977:	48 f7 d8             	neg    %rax
+  80197a:	eb 04                	jmp    801980 <strtol+0x18f>
+  80197c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801980:	c9                   	leave
+  801981:	c3                   	ret
+
+0000000000801982 <strstr>:
+
+char *strstr(const char *in, const char *str)
+{
+  801982:	55                   	push   %rbp
+  801983:	48 89 e5             	mov    %rsp,%rbp
+  801986:	48 83 ec 30          	sub    $0x30,%rsp
+  80198a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80198e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801992:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801996:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80199a:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80199e:	0f b6 00             	movzbl (%rax),%eax
+  8019a1:	88 45 ff             	mov    %al,-0x1(%rbp)
+	if (!c)
+  8019a4:	80 7d ff 00          	cmpb   $0x0,-0x1(%rbp)
+  8019a8:	75 06                	jne    8019b0 <strstr+0x2e>
+		return (char *)in; // Trivial empty string case
+  8019aa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019ae:	eb 6b                	jmp    801a1b <strstr+0x99>
+
+	len = strlen(str);
+  8019b0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019b4:	48 89 c7             	mov    %rax,%rdi
+  8019b7:	48 b8 27 0f 80 00 00 	movabs $0x800f27,%rax
+  8019be:	00 00 00 
+  8019c1:	ff d0                	call   *%rax
+  8019c3:	48 98                	cltq
+  8019c5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+		char sc;
+
+		do
+		{
+			sc = *in++;
+  8019c9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019cd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8019d1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8019d5:	0f b6 00             	movzbl (%rax),%eax
+  8019d8:	88 45 ef             	mov    %al,-0x11(%rbp)
+			if (!sc)
+  8019db:	80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+  8019df:	75 07                	jne    8019e8 <strstr+0x66>
+				return (char *)0;
+  8019e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e6:	eb 33                	jmp    801a1b <strstr+0x99>
+		} while (sc != c);
+  8019e8:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+  8019ec:	3a 45 ff             	cmp    -0x1(%rbp),%al
+  8019ef:	75 d8                	jne    8019c9 <strstr+0x47>
+	} while (strncmp(in, str, len) != 0);
+  8019f1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8019f5:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8019f9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019fd:	48 89 ce             	mov    %rcx,%rsi
+  801a00:	48 89 c7             	mov    %rax,%rdi
+  801a03:	48 b8 42 11 80 00 00 	movabs $0x801142,%rax
+  801a0a:	00 00 00 
+  801a0d:	ff d0                	call   *%rax
+  801a0f:	85 c0                	test   %eax,%eax
+  801a11:	75 b6                	jne    8019c9 <strstr+0x47>
+
+	return (char *)(in - 1);
+  801a13:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a17:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801a1b:	c9                   	leave
+  801a1c:	c3                   	ret
+
+0000000000801a1d <syscall>:
+ * 用户的指令式系统调用，该函数将系统调用序号放入eax寄存器，五个参数依次放入edx, ecx, ebx, edi, esi，然后执行指令int 0x30，
+ * 发生中断后，去IDT中查找中断处理函数，最终会走到kern/trap.c的trap_dispatch()中
+ */
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801a1d:	55                   	push   %rbp
+  801a1e:	48 89 e5             	mov    %rsp,%rbp
+  801a21:	53                   	push   %rbx
+  801a22:	48 83 ec 48          	sub    $0x48,%rsp
+  801a26:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801a29:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801a2c:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801a30:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801a34:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801a38:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	 * volatile 告诉汇编程序不要因为不使用返回值就优化该指令
+	 * 最后一个子句告诉汇编程序，指令可能会改变条件代码cx和任意内存memory位置
+	 * 由汇编编译器做好数据保存和恢复工作(栈)
+	 */
+
+	asm volatile("int %1\n"			// code: int T_SYSCALL
+  801a3c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801a3f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801a43:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a47:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801a4b:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801a4f:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801a53:	4c 89 c3             	mov    %r8,%rbx
+  801a56:	cd 30                	int    $0x30
+  801a58:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+				   "D"(a4),			// edi = a4
+				   "S"(a5)			// esi = a5
+				 : "cc", "memory"); // 指令可能会改变条件代码cx和任意内存memory位置
+									// 由汇编编译器做好数据保存和恢复工作(栈)
+
+	if (check && ret > 0)
+  801a5c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801a60:	74 44                	je     801aa6 <syscall+0x89>
+  801a62:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801a67:	7e 3d                	jle    801aa6 <syscall+0x89>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a69:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a6d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801a70:	49 89 d0             	mov    %rdx,%r8
+  801a73:	89 c1                	mov    %eax,%ecx
+  801a75:	48 b8 08 32 80 00 00 	movabs $0x803208,%rax
+  801a7c:	00 00 00 
+  801a7f:	48 89 c2             	mov    %rax,%rdx
+  801a82:	be 34 00 00 00       	mov    $0x34,%esi
+  801a87:	48 b8 25 32 80 00 00 	movabs $0x803225,%rax
+  801a8e:	00 00 00 
+  801a91:	48 89 c7             	mov    %rax,%rdi
+  801a94:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a99:	49 b9 b3 2a 80 00 00 	movabs $0x802ab3,%r9
+  801aa0:	00 00 00 
+  801aa3:	41 ff d1             	call   *%r9
+
+	return ret;
+  801aa6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801aaa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aae:	c9                   	leave
+  801aaf:	c3                   	ret
+
+0000000000801ab0 <sys_cputs>:
+
+void sys_cputs(const char *s, size_t len)
+{
+  801ab0:	55                   	push   %rbp
+  801ab1:	48 89 e5             	mov    %rsp,%rbp
+  801ab4:	48 83 ec 10          	sub    $0x10,%rsp
+  801ab8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801abc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 调用lib/syscall.c中的syscall()
+	// SYS_cputs: 系统调用序号(eax)，s: 需要输出的字符数组，len: 数组长度
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801ac0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ac4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801ac8:	48 83 ec 08          	sub    $0x8,%rsp
+  801acc:	6a 00                	push   $0x0
+  801ace:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ad4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ada:	48 89 d1             	mov    %rdx,%rcx
+  801add:	48 89 c2             	mov    %rax,%rdx
+  801ae0:	be 00 00 00 00       	mov    $0x0,%esi
+  801ae5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801aea:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  801af1:	00 00 00 
+  801af4:	ff d0                	call   *%rax
+  801af6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801afa:	90                   	nop
+  801afb:	c9                   	leave
+  801afc:	c3                   	ret
+
+0000000000801afd <sys_cgetc>:
+
+int sys_cgetc(void)
+{
+  801afd:	55                   	push   %rbp
+  801afe:	48 89 e5             	mov    %rsp,%rbp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801b01:	48 83 ec 08          	sub    $0x8,%rsp
+  801b05:	6a 00                	push   $0x0
+  801b07:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b0d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b13:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b18:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b1d:	be 00 00 00 00       	mov    $0x0,%esi
+  801b22:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b27:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  801b2e:	00 00 00 
+  801b31:	ff d0                	call   *%rax
+  801b33:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801b37:	c9                   	leave
+  801b38:	c3                   	ret
+
+0000000000801b39 <sys_env_destroy>:
+
+int sys_env_destroy(envid_t envid)
+{
+  801b39:	55                   	push   %rbp
+  801b3a:	48 89 e5             	mov    %rsp,%rbp
+  801b3d:	48 83 ec 10          	sub    $0x10,%rsp
+  801b41:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	// 销毁envid对应的环境
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801b44:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b47:	48 98                	cltq
+  801b49:	48 83 ec 08          	sub    $0x8,%rsp
+  801b4d:	6a 00                	push   $0x0
+  801b4f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b55:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b5b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b60:	48 89 c2             	mov    %rax,%rdx
+  801b63:	be 01 00 00 00       	mov    $0x1,%esi
+  801b68:	bf 03 00 00 00       	mov    $0x3,%edi
+  801b6d:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  801b74:	00 00 00 
+  801b77:	ff d0                	call   *%rax
+  801b79:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801b7d:	c9                   	leave
+  801b7e:	c3                   	ret
+
+0000000000801b7f <sys_getprocid>:
+
+envid_t
+sys_getprocid(void)
+{
+  801b7f:	55                   	push   %rbp
+  801b80:	48 89 e5             	mov    %rsp,%rbp
+	// 获取当前用户环境id
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801b83:	48 83 ec 08          	sub    $0x8,%rsp
+  801b87:	6a 00                	push   $0x0
+  801b89:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b8f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b95:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b9f:	be 00 00 00 00       	mov    $0x0,%esi
+  801ba4:	bf 02 00 00 00       	mov    $0x2,%edi
+  801ba9:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  801bb0:	00 00 00 
+  801bb3:	ff d0                	call   *%rax
+  801bb5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801bb9:	c9                   	leave
+  801bba:	c3                   	ret
+
+0000000000801bbb <sys_yield>:
+
+void sys_yield(void)
+{
+  801bbb:	55                   	push   %rbp
+  801bbc:	48 89 e5             	mov    %rsp,%rbp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801bbf:	48 83 ec 08          	sub    $0x8,%rsp
+  801bc3:	6a 00                	push   $0x0
+  801bc5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801bcb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801bd1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bd6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bdb:	be 00 00 00 00       	mov    $0x0,%esi
+  801be0:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801be5:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  801bec:	00 00 00 
+  801bef:	ff d0                	call   *%rax
+  801bf1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801bf5:	90                   	nop
+  801bf6:	c9                   	leave
+  801bf7:	c3                   	ret
+
+0000000000801bf8 <sys_page_alloc>:
+
+int sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801bf8:	55                   	push   %rbp
+  801bf9:	48 89 e5             	mov    %rsp,%rbp
+  801bfc:	48 83 ec 10          	sub    $0x10,%rsp
+  801c00:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801c03:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801c07:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  801c0a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801c0d:	48 63 c8             	movslq %eax,%rcx
+  801c10:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c14:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801c17:	48 98                	cltq
+  801c19:	48 83 ec 08          	sub    $0x8,%rsp
+  801c1d:	6a 00                	push   $0x0
+  801c1f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801c25:	49 89 c8             	mov    %rcx,%r8
+  801c28:	48 89 d1             	mov    %rdx,%rcx
+  801c2b:	48 89 c2             	mov    %rax,%rdx
+  801c2e:	be 01 00 00 00       	mov    $0x1,%esi
+  801c33:	bf 04 00 00 00       	mov    $0x4,%edi
+  801c38:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  801c3f:	00 00 00 
+  801c42:	ff d0                	call   *%rax
+  801c44:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c48:	c9                   	leave
+  801c49:	c3                   	ret
+
+0000000000801c4a <sys_page_map>:
+
+int sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801c4a:	55                   	push   %rbp
+  801c4b:	48 89 e5             	mov    %rsp,%rbp
+  801c4e:	48 83 ec 20          	sub    $0x20,%rsp
+  801c52:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801c55:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801c59:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801c5c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801c60:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  801c64:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801c67:	48 63 c8             	movslq %eax,%rcx
+  801c6a:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  801c6e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801c71:	48 63 f0             	movslq %eax,%rsi
+  801c74:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c78:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801c7b:	48 98                	cltq
+  801c7d:	48 83 ec 08          	sub    $0x8,%rsp
+  801c81:	51                   	push   %rcx
+  801c82:	49 89 f9             	mov    %rdi,%r9
+  801c85:	49 89 f0             	mov    %rsi,%r8
+  801c88:	48 89 d1             	mov    %rdx,%rcx
+  801c8b:	48 89 c2             	mov    %rax,%rdx
+  801c8e:	be 01 00 00 00       	mov    $0x1,%esi
+  801c93:	bf 05 00 00 00       	mov    $0x5,%edi
+  801c98:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  801c9f:	00 00 00 
+  801ca2:	ff d0                	call   *%rax
+  801ca4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ca8:	c9                   	leave
+  801ca9:	c3                   	ret
+
+0000000000801caa <sys_page_unmap>:
+
+int sys_page_unmap(envid_t envid, void *va)
+{
+  801caa:	55                   	push   %rbp
+  801cab:	48 89 e5             	mov    %rsp,%rbp
+  801cae:	48 83 ec 10          	sub    $0x10,%rsp
+  801cb2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801cb5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  801cb9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801cbd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801cc0:	48 98                	cltq
+  801cc2:	48 83 ec 08          	sub    $0x8,%rsp
+  801cc6:	6a 00                	push   $0x0
+  801cc8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801cce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801cd4:	48 89 d1             	mov    %rdx,%rcx
+  801cd7:	48 89 c2             	mov    %rax,%rdx
+  801cda:	be 01 00 00 00       	mov    $0x1,%esi
+  801cdf:	bf 06 00 00 00       	mov    $0x6,%edi
+  801ce4:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  801ceb:	00 00 00 
+  801cee:	ff d0                	call   *%rax
+  801cf0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801cf4:	c9                   	leave
+  801cf5:	c3                   	ret
+
+0000000000801cf6 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int sys_env_set_status(envid_t envid, int status)
+{
+  801cf6:	55                   	push   %rbp
+  801cf7:	48 89 e5             	mov    %rsp,%rbp
+  801cfa:	48 83 ec 10          	sub    $0x10,%rsp
+  801cfe:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801d01:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801d04:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801d07:	48 63 d0             	movslq %eax,%rdx
+  801d0a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d0d:	48 98                	cltq
+  801d0f:	48 83 ec 08          	sub    $0x8,%rsp
+  801d13:	6a 00                	push   $0x0
+  801d15:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d1b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d21:	48 89 d1             	mov    %rdx,%rcx
+  801d24:	48 89 c2             	mov    %rax,%rdx
+  801d27:	be 01 00 00 00       	mov    $0x1,%esi
+  801d2c:	bf 08 00 00 00       	mov    $0x8,%edi
+  801d31:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  801d38:	00 00 00 
+  801d3b:	ff d0                	call   *%rax
+  801d3d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d41:	c9                   	leave
+  801d42:	c3                   	ret
+
+0000000000801d43 <sys_env_set_trapframe>:
+
+int sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801d43:	55                   	push   %rbp
+  801d44:	48 89 e5             	mov    %rsp,%rbp
+  801d47:	48 83 ec 10          	sub    $0x10,%rsp
+  801d4b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801d4e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  801d52:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d56:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d59:	48 98                	cltq
+  801d5b:	48 83 ec 08          	sub    $0x8,%rsp
+  801d5f:	6a 00                	push   $0x0
+  801d61:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d67:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d6d:	48 89 d1             	mov    %rdx,%rcx
+  801d70:	48 89 c2             	mov    %rax,%rdx
+  801d73:	be 01 00 00 00       	mov    $0x1,%esi
+  801d78:	bf 09 00 00 00       	mov    $0x9,%edi
+  801d7d:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  801d84:	00 00 00 
+  801d87:	ff d0                	call   *%rax
+  801d89:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d8d:	c9                   	leave
+  801d8e:	c3                   	ret
+
+0000000000801d8f <sys_env_set_pgfault_upcall>:
+
+int sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801d8f:	55                   	push   %rbp
+  801d90:	48 89 e5             	mov    %rsp,%rbp
+  801d93:	48 83 ec 10          	sub    $0x10,%rsp
+  801d97:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801d9a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  801d9e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801da2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801da5:	48 98                	cltq
+  801da7:	48 83 ec 08          	sub    $0x8,%rsp
+  801dab:	6a 00                	push   $0x0
+  801dad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801db3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801db9:	48 89 d1             	mov    %rdx,%rcx
+  801dbc:	48 89 c2             	mov    %rax,%rdx
+  801dbf:	be 01 00 00 00       	mov    $0x1,%esi
+  801dc4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801dc9:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  801dd0:	00 00 00 
+  801dd3:	ff d0                	call   *%rax
+  801dd5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801dd9:	c9                   	leave
+  801dda:	c3                   	ret
+
+0000000000801ddb <sys_ipc_try_send>:
+
+int sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  801ddb:	55                   	push   %rbp
+  801ddc:	48 89 e5             	mov    %rsp,%rbp
+  801ddf:	48 83 ec 20          	sub    $0x20,%rsp
+  801de3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801de6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801dea:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801dee:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  801df1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801df4:	48 63 f0             	movslq %eax,%rsi
+  801df7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801dfb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801dfe:	48 98                	cltq
+  801e00:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e04:	48 83 ec 08          	sub    $0x8,%rsp
+  801e08:	6a 00                	push   $0x0
+  801e0a:	49 89 f1             	mov    %rsi,%r9
+  801e0d:	49 89 c8             	mov    %rcx,%r8
+  801e10:	48 89 d1             	mov    %rdx,%rcx
+  801e13:	48 89 c2             	mov    %rax,%rdx
+  801e16:	be 00 00 00 00       	mov    $0x0,%esi
+  801e1b:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801e20:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  801e27:	00 00 00 
+  801e2a:	ff d0                	call   *%rax
+  801e2c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e30:	c9                   	leave
+  801e31:	c3                   	ret
+
+0000000000801e32 <sys_ipc_recv>:
+
+int sys_ipc_recv(void *dstva)
+{
+  801e32:	55                   	push   %rbp
+  801e33:	48 89 e5             	mov    %rsp,%rbp
+  801e36:	48 83 ec 10          	sub    $0x10,%rsp
+  801e3a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  801e3e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e42:	48 83 ec 08          	sub    $0x8,%rsp
+  801e46:	6a 00                	push   $0x0
+  801e48:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e4e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e54:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e59:	48 89 c2             	mov    %rax,%rdx
+  801e5c:	be 01 00 00 00       	mov    $0x1,%esi
+  801e61:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801e66:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  801e6d:	00 00 00 
+  801e70:	ff d0                	call   *%rax
+  801e72:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e76:	c9                   	leave
+  801e77:	c3                   	ret
+
+0000000000801e78 <sys_disk_io>:
+
+int sys_disk_io(int dev, uint64_t secno, void *va, size_t nsecs, int write)
+{
+  801e78:	55                   	push   %rbp
+  801e79:	48 89 e5             	mov    %rsp,%rbp
+  801e7c:	48 83 ec 20          	sub    $0x20,%rsp
+  801e80:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e83:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801e87:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801e8b:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  801e8f:	44 89 45 f8          	mov    %r8d,-0x8(%rbp)
+	return syscall(SYS_disk_io, 0, dev, secno, (uint64_t)va, nsecs, write);
+  801e93:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801e96:	48 63 c8             	movslq %eax,%rcx
+  801e99:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  801e9d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ea0:	48 98                	cltq
+  801ea2:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  801ea6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801eaa:	48 83 ec 08          	sub    $0x8,%rsp
+  801eae:	51                   	push   %rcx
+  801eaf:	49 89 f9             	mov    %rdi,%r9
+  801eb2:	49 89 f0             	mov    %rsi,%r8
+  801eb5:	48 89 d1             	mov    %rdx,%rcx
+  801eb8:	48 89 c2             	mov    %rax,%rdx
+  801ebb:	be 00 00 00 00       	mov    $0x0,%esi
+  801ec0:	bf 0e 00 00 00       	mov    $0xe,%edi
+  801ec5:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  801ecc:	00 00 00 
+  801ecf:	ff d0                	call   *%rax
+  801ed1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ed5:	c9                   	leave
+  801ed6:	c3                   	ret
+
+0000000000801ed7 <sys_vma_alloc>:
+
+int sys_vma_alloc(envid_t envid, void *va, size_t len, int perm)
+{
+  801ed7:	55                   	push   %rbp
+  801ed8:	48 89 e5             	mov    %rsp,%rbp
+  801edb:	48 83 ec 20          	sub    $0x20,%rsp
+  801edf:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801ee2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801ee6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801eea:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_vma_alloc, 1, envid, (uint64_t)va, len, perm, 0);
+  801eed:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801ef0:	48 63 f0             	movslq %eax,%rsi
+  801ef3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801ef7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801efa:	48 98                	cltq
+  801efc:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801f00:	48 83 ec 08          	sub    $0x8,%rsp
+  801f04:	6a 00                	push   $0x0
+  801f06:	49 89 f1             	mov    %rsi,%r9
+  801f09:	49 89 c8             	mov    %rcx,%r8
+  801f0c:	48 89 d1             	mov    %rdx,%rcx
+  801f0f:	48 89 c2             	mov    %rax,%rdx
+  801f12:	be 01 00 00 00       	mov    $0x1,%esi
+  801f17:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801f1c:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  801f23:	00 00 00 
+  801f26:	ff d0                	call   *%rax
+  801f28:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f2c:	c9                   	leave
+  801f2d:	c3                   	ret
+
+0000000000801f2e <sys_vma_clear>:
+
+int sys_vma_clear(envid_t envid)
+{
+  801f2e:	55                   	push   %rbp
+  801f2f:	48 89 e5             	mov    %rsp,%rbp
+  801f32:	48 83 ec 10          	sub    $0x10,%rsp
+  801f36:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_vma_clear, 1, envid, 0, 0, 0, 0);
+  801f39:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f3c:	48 98                	cltq
+  801f3e:	48 83 ec 08          	sub    $0x8,%rsp
+  801f42:	6a 00                	push   $0x0
+  801f44:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f4a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f55:	48 89 c2             	mov    %rax,%rdx
+  801f58:	be 01 00 00 00       	mov    $0x1,%esi
+  801f5d:	bf 10 00 00 00       	mov    $0x10,%edi
+  801f62:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  801f69:	00 00 00 
+  801f6c:	ff d0                	call   *%rax
+  801f6e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f72:	c9                   	leave
+  801f73:	c3                   	ret
+
+0000000000801f74 <sys_trace_ctl>:
+
+int sys_trace_ctl(int enable)
+{
+  801f74:	55                   	push   %rbp
+  801f75:	48 89 e5             	mov    %rsp,%rbp
+  801f78:	48 83 ec 10          	sub    $0x10,%rsp
+  801f7c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_trace_ctl, 0, enable, 0, 0, 0, 0);
+  801f7f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f82:	48 98                	cltq
+  801f84:	48 83 ec 08          	sub    $0x8,%rsp
+  801f88:	6a 00                	push   $0x0
+  801f8a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f90:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f96:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f9b:	48 89 c2             	mov    %rax,%rdx
+  801f9e:	be 00 00 00 00       	mov    $0x0,%esi
+  801fa3:	bf 11 00 00 00       	mov    $0x11,%edi
+  801fa8:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  801faf:	00 00 00 
+  801fb2:	ff d0                	call   *%rax
+  801fb4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fb8:	c9                   	leave
+  801fb9:	c3                   	ret
+
+0000000000801fba <sys_trace_read>:
+
+int sys_trace_read(int cpu, uint64_t *seq, struct TraceEvent *buf, int n)
+{
+  801fba:	55                   	push   %rbp
+  801fbb:	48 89 e5             	mov    %rsp,%rbp
+  801fbe:	48 83 ec 20          	sub    $0x20,%rsp
+  801fc2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801fc5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801fc9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801fcd:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_trace_read, 0, cpu, (uint64_t)seq, (uint64_t)buf, n, 0);
+  801fd0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801fd3:	48 63 f0             	movslq %eax,%rsi
+  801fd6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801fda:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801fde:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fe1:	48 98                	cltq
+  801fe3:	48 83 ec 08          	sub    $0x8,%rsp
+  801fe7:	6a 00                	push   $0x0
+  801fe9:	49 89 f1             	mov    %rsi,%r9
+  801fec:	49 89 c8             	mov    %rcx,%r8
+  801fef:	48 89 d1             	mov    %rdx,%rcx
+  801ff2:	48 89 c2             	mov    %rax,%rdx
+  801ff5:	be 00 00 00 00       	mov    $0x0,%esi
+  801ffa:	bf 12 00 00 00       	mov    $0x12,%edi
+  801fff:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  802006:	00 00 00 
+  802009:	ff d0                	call   *%rax
+  80200b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80200f:	c9                   	leave
+  802010:	c3                   	ret
+
+0000000000802011 <sys_getrusage>:
+
+int sys_getrusage(envid_t envid, struct Rusage *ru)
+{
+  802011:	55                   	push   %rbp
+  802012:	48 89 e5             	mov    %rsp,%rbp
+  802015:	48 83 ec 10          	sub    $0x10,%rsp
+  802019:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80201c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_getrusage, 0, envid, (uint64_t)ru, 0, 0, 0);
+  802020:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802024:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802027:	48 98                	cltq
+  802029:	48 83 ec 08          	sub    $0x8,%rsp
+  80202d:	6a 00                	push   $0x0
+  80202f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802035:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80203b:	48 89 d1             	mov    %rdx,%rcx
+  80203e:	48 89 c2             	mov    %rax,%rdx
+  802041:	be 00 00 00 00       	mov    $0x0,%esi
+  802046:	bf 13 00 00 00       	mov    $0x13,%edi
+  80204b:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  802052:	00 00 00 
+  802055:	ff d0                	call   *%rax
+  802057:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80205b:	c9                   	leave
+  80205c:	c3                   	ret
+
+000000000080205d <sys_pmu_config>:
+
+int sys_pmu_config(int idx, uint64_t event)
+{
+  80205d:	55                   	push   %rbp
+  80205e:	48 89 e5             	mov    %rsp,%rbp
+  802061:	48 83 ec 10          	sub    $0x10,%rsp
+  802065:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802068:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_pmu_config, 0, idx, event, 0, 0, 0);
+  80206c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80206f:	48 98                	cltq
+  802071:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802075:	48 83 ec 08          	sub    $0x8,%rsp
+  802079:	6a 00                	push   $0x0
+  80207b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802081:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802087:	48 89 d1             	mov    %rdx,%rcx
+  80208a:	48 89 c2             	mov    %rax,%rdx
+  80208d:	be 00 00 00 00       	mov    $0x0,%esi
+  802092:	bf 14 00 00 00       	mov    $0x14,%edi
+  802097:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  80209e:	00 00 00 
+  8020a1:	ff d0                	call   *%rax
+  8020a3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020a7:	c9                   	leave
+  8020a8:	c3                   	ret
+
+00000000008020a9 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  8020a9:	55                   	push   %rbp
+  8020aa:	48 89 e5             	mov    %rsp,%rbp
+  8020ad:	48 83 ec 10          	sub    $0x10,%rsp
+  8020b1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+  8020b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8020bb:	6a 00                	push   $0x0
+  8020bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020ce:	48 89 c2             	mov    %rax,%rdx
+  8020d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8020d6:	bf 15 00 00 00       	mov    $0x15,%edi
+  8020db:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  8020e2:	00 00 00 
+  8020e5:	ff d0                	call   *%rax
+  8020e7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020eb:	c9                   	leave
+  8020ec:	c3                   	ret
+
+00000000008020ed <sys_image_attach>:
+
+int sys_image_attach(envid_t envid, int dev, const uint64_t *secnos, size_t size)
+{
+  8020ed:	55                   	push   %rbp
+  8020ee:	48 89 e5             	mov    %rsp,%rbp
+  8020f1:	48 83 ec 20          	sub    $0x20,%rsp
+  8020f5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020f8:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  8020fb:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8020ff:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+	return syscall(SYS_image_attach, 1, envid, dev, (uint64_t)secnos, size, 0);
+  802103:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802107:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80210a:	48 63 d0             	movslq %eax,%rdx
+  80210d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802110:	48 98                	cltq
+  802112:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802116:	48 83 ec 08          	sub    $0x8,%rsp
+  80211a:	6a 00                	push   $0x0
+  80211c:	49 89 f1             	mov    %rsi,%r9
+  80211f:	49 89 c8             	mov    %rcx,%r8
+  802122:	48 89 d1             	mov    %rdx,%rcx
+  802125:	48 89 c2             	mov    %rax,%rdx
+  802128:	be 01 00 00 00       	mov    $0x1,%esi
+  80212d:	bf 16 00 00 00       	mov    $0x16,%edi
+  802132:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  802139:	00 00 00 
+  80213c:	ff d0                	call   *%rax
+  80213e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802142:	c9                   	leave
+  802143:	c3                   	ret
+
+0000000000802144 <sys_vma_binary>:
+
+int sys_vma_binary(envid_t envid, const struct Proghdr *ph)
+{
+  802144:	55                   	push   %rbp
+  802145:	48 89 e5             	mov    %rsp,%rbp
+  802148:	48 83 ec 10          	sub    $0x10,%rsp
+  80214c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80214f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_vma_binary, 1, envid, (uint64_t)ph, 0, 0, 0);
+  802153:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802157:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80215a:	48 98                	cltq
+  80215c:	48 83 ec 08          	sub    $0x8,%rsp
+  802160:	6a 00                	push   $0x0
+  802162:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802168:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80216e:	48 89 d1             	mov    %rdx,%rcx
+  802171:	48 89 c2             	mov    %rax,%rdx
+  802174:	be 01 00 00 00       	mov    $0x1,%esi
+  802179:	bf 17 00 00 00       	mov    $0x17,%edi
+  80217e:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  802185:	00 00 00 
+  802188:	ff d0                	call   *%rax
+  80218a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80218e:	c9                   	leave
+  80218f:	c3                   	ret
+
+0000000000802190 <pgfault>:
+ * 自定义页错误处理函数.
+ * 当出现页错误，主要是对标志为可写的或者COW的物理页分配新页，复制旧页的数据到新页并映射到旧页的地址空间
+ */
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802190:	55                   	push   %rbp
+  802191:	48 89 e5             	mov    %rsp,%rbp
+  802194:	48 83 ec 40          	sub    $0x40,%rsp
+  802198:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	void *addr = (void *)utf->utf_fault_va;
+  80219c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021a0:	48 8b 00             	mov    (%rax),%rax
+  8021a3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint32_t err = utf->utf_err;
+  8021a7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021ab:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8021af:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	int r;
+
+	// 检查出错的访问(1)写，(2)COW页.  若不是，调用panic().
+	// pte_t entry = uvpt[VPN(addr)];
+	// 分配一个新页，将其映射到临时位置(PFTEMP)，将旧页数据复制到新页，然后将新页移动到旧页的地址.
+	if ((err & FEC_WR) && (uvpt[VPN(addr)] & PTE_COW))
+  8021b2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8021b5:	83 e0 02             	and    $0x2,%eax
+  8021b8:	85 c0                	test   %eax,%eax
+  8021ba:	0f 84 61 01 00 00    	je     802321 <pgfault+0x191>
+  8021c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021c4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8021c8:	48 89 c2             	mov    %rax,%rdx
+  8021cb:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8021d2:	01 00 00 
+  8021d5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8021d9:	25 00 08 00 00       	and    $0x800,%eax
+  8021de:	48 85 c0             	test   %rax,%rax
+  8021e1:	0f 84 3a 01 00 00    	je     802321 <pgfault+0x191>
+	{
+		if (sys_page_alloc(0, (void *)PFTEMP, PTE_U | PTE_P | PTE_W) == 0)
+  8021e7:	ba 07 00 00 00       	mov    $0x7,%edx
+  8021ec:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8021f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021f6:	48 b8 f8 1b 80 00 00 	movabs $0x801bf8,%rax
+  8021fd:	00 00 00 
+  802200:	ff d0                	call   *%rax
+  802202:	85 c0                	test   %eax,%eax
+  802204:	0f 85 e7 00 00 00    	jne    8022f1 <pgfault+0x161>
+		{
+			// 分配了新的物理页以后准备从原页面开始拷贝数据时，记得将地址和物理页大小对齐
+			void *pg_addr = ROUNDDOWN(addr, PGSIZE);
+  80220a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80220e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  802212:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802216:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80221c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+			memmove(PFTEMP, pg_addr, PGSIZE);
+  802220:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802224:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802229:	48 89 c6             	mov    %rax,%rsi
+  80222c:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  802231:	48 b8 1f 16 80 00 00 	movabs $0x80161f,%rax
+  802238:	00 00 00 
+  80223b:	ff d0                	call   *%rax
+			r = sys_page_map(0, (void *)PFTEMP, 0, pg_addr, PTE_U | PTE_W | PTE_P);
+  80223d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802241:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802247:	48 89 c1             	mov    %rax,%rcx
+  80224a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80224f:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802254:	bf 00 00 00 00       	mov    $0x0,%edi
+  802259:	48 b8 4a 1c 80 00 00 	movabs $0x801c4a,%rax
+  802260:	00 00 00 
+  802263:	ff d0                	call   *%rax
+  802265:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			if (r < 0)
+  802268:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80226c:	79 30                	jns    80229e <pgfault+0x10e>
+			{
+				panic("pgfault...something wrong with page_map");
+  80226e:	48 b8 38 32 80 00 00 	movabs $0x803238,%rax
+  802275:	00 00 00 
+  802278:	48 89 c2             	mov    %rax,%rdx
+  80227b:	be 22 00 00 00       	mov    $0x22,%esi
+  802280:	48 b8 60 32 80 00 00 	movabs $0x803260,%rax
+  802287:	00 00 00 
+  80228a:	48 89 c7             	mov    %rax,%rdi
+  80228d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802292:	48 b9 b3 2a 80 00 00 	movabs $0x802ab3,%rcx
+  802299:	00 00 00 
+  80229c:	ff d1                	call   *%rcx
+			}
+			r = sys_page_unmap(0, PFTEMP);
+  80229e:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8022a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022a8:	48 b8 aa 1c 80 00 00 	movabs $0x801caa,%rax
+  8022af:	00 00 00 
+  8022b2:	ff d0                	call   *%rax
+  8022b4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			if (r < 0)
+  8022b7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8022bb:	0f 89 96 00 00 00    	jns    802357 <pgfault+0x1c7>
+			{
+				panic("pgfault...something wrong with page_unmap");
+  8022c1:	48 b8 70 32 80 00 00 	movabs $0x803270,%rax
+  8022c8:	00 00 00 
+  8022cb:	48 89 c2             	mov    %rax,%rdx
+  8022ce:	be 27 00 00 00       	mov    $0x27,%esi
+  8022d3:	48 b8 60 32 80 00 00 	movabs $0x803260,%rax
+  8022da:	00 00 00 
+  8022dd:	48 89 c7             	mov    %rax,%rdi
+  8022e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e5:	48 b9 b3 2a 80 00 00 	movabs $0x802ab3,%rcx
+  8022ec:	00 00 00 
+  8022ef:	ff d1                	call   *%rcx
+			}
+			return;
+		}
+		else
+		{
+			panic("pgfault...something wrong with page_alloc");
+  8022f1:	48 b8 a0 32 80 00 00 	movabs $0x8032a0,%rax
+  8022f8:	00 00 00 
+  8022fb:	48 89 c2             	mov    %rax,%rdx
+  8022fe:	be 2d 00 00 00       	mov    $0x2d,%esi
+  802303:	48 b8 60 32 80 00 00 	movabs $0x803260,%rax
+  80230a:	00 00 00 
+  80230d:	48 89 c7             	mov    %rax,%rdi
+  802310:	b8 00 00 00 00       	mov    $0x0,%eax
+  802315:	48 b9 b3 2a 80 00 00 	movabs $0x802ab3,%rcx
+  80231c:	00 00 00 
+  80231f:	ff d1                	call   *%rcx
+		}
+	}
+	else
+	{
+		panic("pgfault...wrong error %e", err);
+  802321:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802324:	89 c1                	mov    %eax,%ecx
+  802326:	48 b8 ca 32 80 00 00 	movabs $0x8032ca,%rax
+  80232d:	00 00 00 
+  802330:	48 89 c2             	mov    %rax,%rdx
+  802333:	be 32 00 00 00       	mov    $0x32,%esi
+  802338:	48 b8 60 32 80 00 00 	movabs $0x803260,%rax
+  80233f:	00 00 00 
+  802342:	48 89 c7             	mov    %rax,%rdi
+  802345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80234a:	49 b8 b3 2a 80 00 00 	movabs $0x802ab3,%r8
+  802351:	00 00 00 
+  802354:	41 ff d0             	call   *%r8
+			return;
+  802357:	90                   	nop
+	}
+}
+  802358:	c9                   	leave
+  802359:	c3                   	ret
+
+000000000080235a <duppage>:
+ * 映射: 将的虚拟页pn(地址: pn*PGSIZE)映射到相同虚拟地址的 envid 中.
+ * 成功: 返回0，失败调用 panic()
+ */
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  80235a:	55                   	push   %rbp
+  80235b:	48 89 e5             	mov    %rsp,%rbp
+  80235e:	48 83 ec 30          	sub    $0x30,%rsp
+  802362:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802365:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	pte_t entry = uvpt[pn];
+  802368:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  80236f:	01 00 00 
+  802372:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802375:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802379:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	void *addr = (void *)((uintptr_t)pn * PGSIZE);
+  80237d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802380:	48 c1 e0 0c          	shl    $0xc,%rax
+  802384:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	int perm = entry & PTE_SYSCALL;
+  802388:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80238c:	25 07 0e 00 00       	and    $0xe07,%eax
+  802391:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm & PTE_SHARE)
+  802394:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802397:	25 00 04 00 00       	and    $0x400,%eax
+  80239c:	85 c0                	test   %eax,%eax
+  80239e:	74 68                	je     802408 <duppage+0xae>
+	{
+		r = sys_page_map(0, addr, envid, addr, perm);
+  8023a0:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8023a3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023a7:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8023aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8023ae:	41 89 f0             	mov    %esi,%r8d
+  8023b1:	48 89 c6             	mov    %rax,%rsi
+  8023b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023b9:	48 b8 4a 1c 80 00 00 	movabs $0x801c4a,%rax
+  8023c0:	00 00 00 
+  8023c3:	ff d0                	call   *%rax
+  8023c5:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  8023c8:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8023cc:	0f 89 90 01 00 00    	jns    802562 <duppage+0x208>
+		{
+			panic("Something went wrong on duppage %e", r);
+  8023d2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8023d5:	89 c1                	mov    %eax,%ecx
+  8023d7:	48 b8 e8 32 80 00 00 	movabs $0x8032e8,%rax
+  8023de:	00 00 00 
+  8023e1:	48 89 c2             	mov    %rax,%rdx
+  8023e4:	be 48 00 00 00       	mov    $0x48,%esi
+  8023e9:	48 b8 60 32 80 00 00 	movabs $0x803260,%rax
+  8023f0:	00 00 00 
+  8023f3:	48 89 c7             	mov    %rax,%rdi
+  8023f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023fb:	49 b8 b3 2a 80 00 00 	movabs $0x802ab3,%r8
+  802402:	00 00 00 
+  802405:	41 ff d0             	call   *%r8
+		}
+	}
+	else if ((perm & PTE_COW) || (perm & PTE_W))
+  802408:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80240b:	25 00 08 00 00       	and    $0x800,%eax
+  802410:	85 c0                	test   %eax,%eax
+  802412:	75 0e                	jne    802422 <duppage+0xc8>
+  802414:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802417:	83 e0 02             	and    $0x2,%eax
+  80241a:	85 c0                	test   %eax,%eax
+  80241c:	0f 84 dc 00 00 00    	je     8024fe <duppage+0x1a4>
+	{
+		perm &= ~PTE_W;
+  802422:	83 65 ec fd          	andl   $0xfffffffd,-0x14(%rbp)
+		perm |= PTE_COW;
+  802426:	81 4d ec 00 08 00 00 	orl    $0x800,-0x14(%rbp)
+		r = sys_page_map(0, addr, envid, addr, perm);
+  80242d:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  802430:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802434:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802437:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80243b:	41 89 f0             	mov    %esi,%r8d
+  80243e:	48 89 c6             	mov    %rax,%rsi
+  802441:	bf 00 00 00 00       	mov    $0x0,%edi
+  802446:	48 b8 4a 1c 80 00 00 	movabs $0x801c4a,%rax
+  80244d:	00 00 00 
+  802450:	ff d0                	call   *%rax
+  802452:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  802455:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802459:	79 36                	jns    802491 <duppage+0x137>
+		{
+			panic("Something went wrong on duppage %e", r);
+  80245b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80245e:	89 c1                	mov    %eax,%ecx
+  802460:	48 b8 e8 32 80 00 00 	movabs $0x8032e8,%rax
+  802467:	00 00 00 
+  80246a:	48 89 c2             	mov    %rax,%rdx
+  80246d:	be 52 00 00 00       	mov    $0x52,%esi
+  802472:	48 b8 60 32 80 00 00 	movabs $0x803260,%rax
+  802479:	00 00 00 
+  80247c:	48 89 c7             	mov    %rax,%rdi
+  80247f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802484:	49 b8 b3 2a 80 00 00 	movabs $0x802ab3,%r8
+  80248b:	00 00 00 
+  80248e:	41 ff d0             	call   *%r8
+		}
+		r = sys_page_map(0, addr, 0, addr, perm);
+  802491:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  802494:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802498:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80249c:	41 89 c8             	mov    %ecx,%r8d
+  80249f:	48 89 d1             	mov    %rdx,%rcx
+  8024a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024a7:	48 89 c6             	mov    %rax,%rsi
+  8024aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024af:	48 b8 4a 1c 80 00 00 	movabs $0x801c4a,%rax
+  8024b6:	00 00 00 
+  8024b9:	ff d0                	call   *%rax
+  8024bb:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  8024be:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8024c2:	0f 89 9a 00 00 00    	jns    802562 <duppage+0x208>
+		{
+			panic("Something went wrong on duppage %e", r);
+  8024c8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8024cb:	89 c1                	mov    %eax,%ecx
+  8024cd:	48 b8 e8 32 80 00 00 	movabs $0x8032e8,%rax
+  8024d4:	00 00 00 
+  8024d7:	48 89 c2             	mov    %rax,%rdx
+  8024da:	be 57 00 00 00       	mov    $0x57,%esi
+  8024df:	48 b8 60 32 80 00 00 	movabs $0x803260,%rax
+  8024e6:	00 00 00 
+  8024e9:	48 89 c7             	mov    %rax,%rdi
+  8024ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024f1:	49 b8 b3 2a 80 00 00 	movabs $0x802ab3,%r8
+  8024f8:	00 00 00 
+  8024fb:	41 ff d0             	call   *%r8
+		}
+	}
+	else
+	{
+		r = sys_page_map(0, addr, envid, addr, perm);
+  8024fe:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  802501:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802505:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802508:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80250c:	41 89 f0             	mov    %esi,%r8d
+  80250f:	48 89 c6             	mov    %rax,%rsi
+  802512:	bf 00 00 00 00       	mov    $0x0,%edi
+  802517:	48 b8 4a 1c 80 00 00 	movabs $0x801c4a,%rax
+  80251e:	00 00 00 
+  802521:	ff d0                	call   *%rax
+  802523:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  802526:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80252a:	79 36                	jns    802562 <duppage+0x208>
+		{
+			panic("Something went wrong on duppage %e", r);
+  80252c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80252f:	89 c1                	mov    %eax,%ecx
+  802531:	48 b8 e8 32 80 00 00 	movabs $0x8032e8,%rax
+  802538:	00 00 00 
+  80253b:	48 89 c2             	mov    %rax,%rdx
+  80253e:	be 5f 00 00 00       	mov    $0x5f,%esi
+  802543:	48 b8 60 32 80 00 00 	movabs $0x803260,%rax
+  80254a:	00 00 00 
+  80254d:	48 89 c7             	mov    %rax,%rdi
+  802550:	b8 00 00 00 00       	mov    $0x0,%eax
+  802555:	49 b8 b3 2a 80 00 00 	movabs $0x802ab3,%r8
+  80255c:	00 00 00 
+  80255f:	41 ff d0             	call   *%r8
+		}
+	}
+	return 0;
+  802562:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802567:	c9                   	leave
+  802568:	c3                   	ret
+
+0000000000802569 <fork>:
+ * 
+ * 两个用户异常栈都不应该被标记为COW，所以必须为子环境的异常栈分配一个新页
+ */
+envid_t
+fork(void)
+{
+  802569:	55                   	push   %rbp
+  80256a:	48 89 e5             	mov    %rsp,%rbp
+  80256d:	48 83 ec 50          	sub    $0x50,%rsp
+	int r = 0;
+  802571:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	set_pgfault_handler(pgfault);
+  802578:	48 b8 90 21 80 00 00 	movabs $0x802190,%rax
+  80257f:	00 00 00 
+  802582:	48 89 c7             	mov    %rax,%rdi
+  802585:	48 b8 cd 2b 80 00 00 	movabs $0x802bcd,%rax
+  80258c:	00 00 00 
+  80258f:	ff d0                	call   *%rax
+// 必须内联.
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  802591:	b8 07 00 00 00       	mov    $0x7,%eax
+  802596:	cd 30                	int    $0x30
+  802598:	89 45 bc             	mov    %eax,-0x44(%rbp)
+					 : "=a"(ret)
+					 : "a"(SYS_exofork),
+					   "i"(T_SYSCALL));
+	return ret;
+  80259b:	8b 45 bc             	mov    -0x44(%rbp),%eax
+	envid_t childid = sys_exofork();
+  80259e:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	if (childid < 0)
+  8025a1:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  8025a5:	79 36                	jns    8025dd <fork+0x74>
+	{
+		panic("\n couldn't call fork %e\n", childid);
+  8025a7:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8025aa:	89 c1                	mov    %eax,%ecx
+  8025ac:	48 b8 0b 33 80 00 00 	movabs $0x80330b,%rax
+  8025b3:	00 00 00 
+  8025b6:	48 89 c2             	mov    %rax,%rdx
+  8025b9:	be 7a 00 00 00       	mov    $0x7a,%esi
+  8025be:	48 b8 60 32 80 00 00 	movabs $0x803260,%rax
+  8025c5:	00 00 00 
+  8025c8:	48 89 c7             	mov    %rax,%rdi
+  8025cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025d0:	49 b8 b3 2a 80 00 00 	movabs $0x802ab3,%r8
+  8025d7:	00 00 00 
+  8025da:	41 ff d0             	call   *%r8
+	}
+	if (childid == 0)
+  8025dd:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  8025e1:	75 3e                	jne    802621 <fork+0xb8>
+	{
+		// thisproc 父进程
+		thisproc = &procs[ENVX(sys_getprocid())];
+  8025e3:	48 b8 7f 1b 80 00 00 	movabs $0x801b7f,%rax
+  8025ea:	00 00 00 
+  8025ed:	ff d0                	call   *%rax
+  8025ef:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8025f4:	48 98                	cltq
+  8025f6:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  8025fd:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  802604:	00 00 00 
+  802607:	48 01 c2             	add    %rax,%rdx
+  80260a:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  802611:	00 00 00 
+  802614:	48 89 10             	mov    %rdx,(%rax)
+		// 子环境的返回值
+		return 0;
+  802617:	b8 00 00 00 00       	mov    $0x0,%eax
+  80261c:	e9 c2 02 00 00       	jmp    8028e3 <fork+0x37a>
+	}
+	r = sys_page_alloc(childid, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_W | PTE_U);
+  802621:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802624:	ba 07 00 00 00       	mov    $0x7,%edx
+  802629:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  80262e:	48 89 ce             	mov    %rcx,%rsi
+  802631:	89 c7                	mov    %eax,%edi
+  802633:	48 b8 f8 1b 80 00 00 	movabs $0x801bf8,%rax
+  80263a:	00 00 00 
+  80263d:	ff d0                	call   *%rax
+  80263f:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if (r < 0)
+  802642:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  802646:	79 36                	jns    80267e <fork+0x115>
+		panic("\n couldn't call fork %e\n", r);
+  802648:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80264b:	89 c1                	mov    %eax,%ecx
+  80264d:	48 b8 0b 33 80 00 00 	movabs $0x80330b,%rax
+  802654:	00 00 00 
+  802657:	48 89 c2             	mov    %rax,%rdx
+  80265a:	be 85 00 00 00       	mov    $0x85,%esi
+  80265f:	48 b8 60 32 80 00 00 	movabs $0x803260,%rax
+  802666:	00 00 00 
+  802669:	48 89 c7             	mov    %rax,%rdi
+  80266c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802671:	49 b8 b3 2a 80 00 00 	movabs $0x802ab3,%r8
+  802678:	00 00 00 
+  80267b:	41 ff d0             	call   *%r8
+
+	uint64_t pml;
+	uint64_t pdpe;
+	uint64_t pde;
+	uint64_t pte;
+	uint64_t each_pde = 0;
+  80267e:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802685:	00 
+	uint64_t each_pte = 0;
+  802686:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80268d:	00 
+	uint64_t each_pdpe = 0;
+  80268e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802695:	00 
+
+	// 拷贝[0, UXSTACKTOP)的所有用户页，接下来为用户异常栈创建物理页
+	// 因为在创建用户环境时，已经在 env_setup_vm() 中映射了内核所有页
+	for (pml = 0; pml < VPML4E(UTOP); pml++)
+  802696:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80269d:	00 
+  80269e:	e9 80 01 00 00       	jmp    802823 <fork+0x2ba>
+	{
+		if (uvpml4e[pml] & PTE_P)
+  8026a3:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8026aa:	01 00 00 
+  8026ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026b1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8026b5:	83 e0 01             	and    $0x1,%eax
+  8026b8:	48 85 c0             	test   %rax,%rax
+  8026bb:	0f 84 4d 01 00 00    	je     80280e <fork+0x2a5>
+		{
+
+			for (pdpe = 0; pdpe < NPDPENTRIES; pdpe++, each_pdpe++)
+  8026c1:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8026c8:	00 
+  8026c9:	e9 30 01 00 00       	jmp    8027fe <fork+0x295>
+			{
+				if (uvpde[each_pdpe] & PTE_P)
+  8026ce:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8026d5:	01 00 00 
+  8026d8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026dc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8026e0:	83 e0 01             	and    $0x1,%eax
+  8026e3:	48 85 c0             	test   %rax,%rax
+  8026e6:	0f 84 f8 00 00 00    	je     8027e4 <fork+0x27b>
+				{
+
+					for (pde = 0; pde < NPDENTRIES; pde++, each_pde++)
+  8026ec:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8026f3:	00 
+  8026f4:	e9 db 00 00 00       	jmp    8027d4 <fork+0x26b>
+					{
+						if (uvpd[each_pde] & PTE_P)
+  8026f9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802700:	01 00 00 
+  802703:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802707:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80270b:	83 e0 01             	and    $0x1,%eax
+  80270e:	48 85 c0             	test   %rax,%rax
+  802711:	0f 84 a3 00 00 00    	je     8027ba <fork+0x251>
+						{
+
+							for (pte = 0; pte < NPTENTRIES; pte++, each_pte++)
+  802717:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80271e:	00 
+  80271f:	e9 86 00 00 00       	jmp    8027aa <fork+0x241>
+							{
+								if (uvpt[each_pte] & PTE_P)
+  802724:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  80272b:	01 00 00 
+  80272e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802732:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802736:	83 e0 01             	and    $0x1,%eax
+  802739:	48 85 c0             	test   %rax,%rax
+  80273c:	74 62                	je     8027a0 <fork+0x237>
+								{
+
+									if (each_pte != VPN(UXSTACKTOP - PGSIZE))
+  80273e:	48 81 7d d0 ff f7 0e 	cmpq   $0xef7ff,-0x30(%rbp)
+  802745:	00 
+  802746:	74 58                	je     8027a0 <fork+0x237>
+									{
+										r = duppage(childid, (unsigned)each_pte);
+  802748:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80274c:	89 c2                	mov    %eax,%edx
+  80274e:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802751:	89 d6                	mov    %edx,%esi
+  802753:	89 c7                	mov    %eax,%edi
+  802755:	48 b8 5a 23 80 00 00 	movabs $0x80235a,%rax
+  80275c:	00 00 00 
+  80275f:	ff d0                	call   *%rax
+  802761:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+										if (r < 0)
+  802764:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  802768:	79 36                	jns    8027a0 <fork+0x237>
+											panic("\n couldn't call fork %e\n", r);
+  80276a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80276d:	89 c1                	mov    %eax,%ecx
+  80276f:	48 b8 0b 33 80 00 00 	movabs $0x80330b,%rax
+  802776:	00 00 00 
+  802779:	48 89 c2             	mov    %rax,%rdx
+  80277c:	be a9 00 00 00       	mov    $0xa9,%esi
+  802781:	48 b8 60 32 80 00 00 	movabs $0x803260,%rax
+  802788:	00 00 00 
+  80278b:	48 89 c7             	mov    %rax,%rdi
+  80278e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802793:	49 b8 b3 2a 80 00 00 	movabs $0x802ab3,%r8
+  80279a:	00 00 00 
+  80279d:	41 ff d0             	call   *%r8
+							for (pte = 0; pte < NPTENTRIES; pte++, each_pte++)
+  8027a0:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  8027a5:	48 83 45 d0 01       	addq   $0x1,-0x30(%rbp)
+  8027aa:	48 81 7d e0 ff 01 00 	cmpq   $0x1ff,-0x20(%rbp)
+  8027b1:	00 
+  8027b2:	0f 86 6c ff ff ff    	jbe    802724 <fork+0x1bb>
+  8027b8:	eb 10                	jmp    8027ca <fork+0x261>
+								}
+							}
+						}
+						else
+						{
+							each_pte = (each_pde + 1) * NPTENTRIES;
+  8027ba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8027be:	48 83 c0 01          	add    $0x1,%rax
+  8027c2:	48 c1 e0 09          	shl    $0x9,%rax
+  8027c6:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+					for (pde = 0; pde < NPDENTRIES; pde++, each_pde++)
+  8027ca:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8027cf:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8027d4:	48 81 7d e8 ff 01 00 	cmpq   $0x1ff,-0x18(%rbp)
+  8027db:	00 
+  8027dc:	0f 86 17 ff ff ff    	jbe    8026f9 <fork+0x190>
+  8027e2:	eb 10                	jmp    8027f4 <fork+0x28b>
+						}
+					}
+				}
+				else
+				{
+					each_pde = (each_pdpe + 1) * NPDENTRIES;
+  8027e4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027e8:	48 83 c0 01          	add    $0x1,%rax
+  8027ec:	48 c1 e0 09          	shl    $0x9,%rax
+  8027f0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			for (pdpe = 0; pdpe < NPDPENTRIES; pdpe++, each_pdpe++)
+  8027f4:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8027f9:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  8027fe:	48 81 7d f0 ff 01 00 	cmpq   $0x1ff,-0x10(%rbp)
+  802805:	00 
+  802806:	0f 86 c2 fe ff ff    	jbe    8026ce <fork+0x165>
+  80280c:	eb 10                	jmp    80281e <fork+0x2b5>
+				}
+			}
+		}
+		else
+		{
+			each_pdpe = (pml + 1) * NPDPENTRIES;
+  80280e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802812:	48 83 c0 01          	add    $0x1,%rax
+  802816:	48 c1 e0 09          	shl    $0x9,%rax
+  80281a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	for (pml = 0; pml < VPML4E(UTOP); pml++)
+  80281e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802823:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802828:	0f 84 75 fe ff ff    	je     8026a3 <fork+0x13a>
+
+	extern void _pgfault_upcall(void);
+	// 为子环境设置页错误处理函数.
+	// 因为使用env_alloc()创建的env的处理函数指针都为空，但是这时已经明确的为其错误栈分配了物理页面
+	// 所以可以直接使用系统调用指定错误处理的入口，_pgfault_upcall()为所有用户页错误处理函数的总入口
+	r = sys_env_set_pgfault_upcall(childid, _pgfault_upcall);
+  80282e:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802831:	48 ba 71 2c 80 00 00 	movabs $0x802c71,%rdx
+  802838:	00 00 00 
+  80283b:	48 89 d6             	mov    %rdx,%rsi
+  80283e:	89 c7                	mov    %eax,%edi
+  802840:	48 b8 8f 1d 80 00 00 	movabs $0x801d8f,%rax
+  802847:	00 00 00 
+  80284a:	ff d0                	call   *%rax
+  80284c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if (r < 0)
+  80284f:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  802853:	79 36                	jns    80288b <fork+0x322>
+		panic("\n couldn't call fork %e\n", r);
+  802855:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802858:	89 c1                	mov    %eax,%ecx
+  80285a:	48 b8 0b 33 80 00 00 	movabs $0x80330b,%rax
+  802861:	00 00 00 
+  802864:	48 89 c2             	mov    %rax,%rdx
+  802867:	be c6 00 00 00       	mov    $0xc6,%esi
+  80286c:	48 b8 60 32 80 00 00 	movabs $0x803260,%rax
+  802873:	00 00 00 
+  802876:	48 89 c7             	mov    %rax,%rdi
+  802879:	b8 00 00 00 00       	mov    $0x0,%eax
+  80287e:	49 b8 b3 2a 80 00 00 	movabs $0x802ab3,%r8
+  802885:	00 00 00 
+  802888:	41 ff d0             	call   *%r8
+
+	r = sys_env_set_status(childid, ENV_RUNNABLE);
+  80288b:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80288e:	be 02 00 00 00       	mov    $0x2,%esi
+  802893:	89 c7                	mov    %eax,%edi
+  802895:	48 b8 f6 1c 80 00 00 	movabs $0x801cf6,%rax
+  80289c:	00 00 00 
+  80289f:	ff d0                	call   *%rax
+  8028a1:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if (r < 0)
+  8028a4:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  8028a8:	79 36                	jns    8028e0 <fork+0x377>
+		panic("\n couldn't call fork %e\n", r);
+  8028aa:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8028ad:	89 c1                	mov    %eax,%ecx
+  8028af:	48 b8 0b 33 80 00 00 	movabs $0x80330b,%rax
+  8028b6:	00 00 00 
+  8028b9:	48 89 c2             	mov    %rax,%rdx
+  8028bc:	be ca 00 00 00       	mov    $0xca,%esi
+  8028c1:	48 b8 60 32 80 00 00 	movabs $0x803260,%rax
+  8028c8:	00 00 00 
+  8028cb:	48 89 c7             	mov    %rax,%rdi
+  8028ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d3:	49 b8 b3 2a 80 00 00 	movabs $0x802ab3,%r8
+  8028da:	00 00 00 
+  8028dd:	41 ff d0             	call   *%r8
+
+	return childid;
+  8028e0:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  8028e3:	c9                   	leave
+  8028e4:	c3                   	ret
+
+00000000008028e5 <ipc_recv>:
+ * 如果 pg 为空，则传递 sys_ipc_recv 一个值，它将理解为“no page”的意思
+ * (Zero 不是正确的值，因为这是映射页面的完美有效位置)
+ */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8028e5:	55                   	push   %rbp
+  8028e6:	48 89 e5             	mov    %rsp,%rbp
+  8028e9:	48 83 ec 30          	sub    $0x30,%rsp
+  8028ed:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8028f1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8028f5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	int r = 0;
+  8028f9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	if(pg) {
+  802900:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802905:	74 18                	je     80291f <ipc_recv+0x3a>
+		r = sys_ipc_recv(pg);
+  802907:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80290b:	48 89 c7             	mov    %rax,%rdi
+  80290e:	48 b8 32 1e 80 00 00 	movabs $0x801e32,%rax
+  802915:	00 00 00 
+  802918:	ff d0                	call   *%rax
+  80291a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80291d:	eb 1c                	jmp    80293b <ipc_recv+0x56>
+	}
+	// pg == 0, pg > UTOP
+	else {
+		r = sys_ipc_recv((void*)KERNBASE);
+  80291f:	48 b8 00 00 00 04 80 	movabs $0x8004000000,%rax
+  802926:	00 00 00 
+  802929:	48 89 c7             	mov    %rax,%rdi
+  80292c:	48 b8 32 1e 80 00 00 	movabs $0x801e32,%rax
+  802933:	00 00 00 
+  802936:	ff d0                	call   *%rax
+  802938:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	}
+	if (r < 0) {
+  80293b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80293f:	79 39                	jns    80297a <ipc_recv+0x95>
+		*from_env_store =  (from_env_store != NULL) ? (envid_t)0 : *from_env_store;
+  802941:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802946:	75 08                	jne    802950 <ipc_recv+0x6b>
+  802948:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80294c:	8b 00                	mov    (%rax),%eax
+  80294e:	eb 05                	jmp    802955 <ipc_recv+0x70>
+  802950:	b8 00 00 00 00       	mov    $0x0,%eax
+  802955:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802959:	89 02                	mov    %eax,(%rdx)
+		*perm_store = (perm_store != NULL) ? (int)0 : *perm_store;
+  80295b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  802960:	75 08                	jne    80296a <ipc_recv+0x85>
+  802962:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802966:	8b 00                	mov    (%rax),%eax
+  802968:	eb 05                	jmp    80296f <ipc_recv+0x8a>
+  80296a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80296f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802973:	89 02                	mov    %eax,(%rdx)
+		return r;
+  802975:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802978:	eb 53                	jmp    8029cd <ipc_recv+0xe8>
+	}
+	// 设置from_env_store为发送进程的进程ID
+	if(from_env_store) {
+  80297a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80297f:	74 19                	je     80299a <ipc_recv+0xb5>
+		*from_env_store = thisproc->env_ipc_from;
+  802981:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  802988:	00 00 00 
+  80298b:	48 8b 00             	mov    (%rax),%rax
+  80298e:	8b 90 6c 01 00 00    	mov    0x16c(%rax),%edx
+  802994:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802998:	89 10                	mov    %edx,(%rax)
+	}
+	// 如果传递物理页，该位不为0，设置perm_store为物理页的权限
+	if(perm_store) {
+  80299a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80299f:	74 19                	je     8029ba <ipc_recv+0xd5>
+		*perm_store = thisproc->env_ipc_perm;
+  8029a1:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  8029a8:	00 00 00 
+  8029ab:	48 8b 00             	mov    (%rax),%rax
+  8029ae:	8b 90 70 01 00 00    	mov    0x170(%rax),%edx
+  8029b4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8029b8:	89 10                	mov    %edx,(%rax)
+	}
+	// 返回发送进程发送的值
+	return thisproc->env_ipc_value;
+  8029ba:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  8029c1:	00 00 00 
+  8029c4:	48 8b 00             	mov    (%rax),%rax
+  8029c7:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  8029cd:	c9                   	leave
+  8029ce:	c3                   	ret
+
+00000000008029cf <ipc_send>:
+ * 使用sys_yield()使cpu友好
+ * 如果'pg'为null，则给sys_ipc_recv传递一个它会理解为“无页面”的值(0不是正确的值)
+ */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8029cf:	55                   	push   %rbp
+  8029d0:	48 89 e5             	mov    %rsp,%rbp
+  8029d3:	48 83 ec 30          	sub    $0x30,%rsp
+  8029d7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8029da:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8029dd:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8029e1:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	int r = -E_IPC_NOT_RECV;
+  8029e4:	c7 45 fc f8 ff ff ff 	movl   $0xfffffff8,-0x4(%rbp)
+	// 子进程不是接收状态
+	while(r == -E_IPC_NOT_RECV) {
+  8029eb:	eb 59                	jmp    802a46 <ipc_send+0x77>
+		if(pg) {
+  8029ed:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8029f2:	74 20                	je     802a14 <ipc_send+0x45>
+			// 传递物理页
+			r = sys_ipc_try_send(to_env, val, pg, perm);
+  8029f4:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8029f7:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8029fa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8029fe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a01:	89 c7                	mov    %eax,%edi
+  802a03:	48 b8 db 1d 80 00 00 	movabs $0x801ddb,%rax
+  802a0a:	00 00 00 
+  802a0d:	ff d0                	call   *%rax
+  802a0f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802a12:	eb 26                	jmp    802a3a <ipc_send+0x6b>
+		}
+		// pg == 0, pg > UTOP
+		else {
+			// (void*)KERNBASE > UTOP
+			r = sys_ipc_try_send(to_env, val, (void*)KERNBASE, perm);
+  802a14:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  802a17:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802a1a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a1d:	89 d1                	mov    %edx,%ecx
+  802a1f:	48 ba 00 00 00 04 80 	movabs $0x8004000000,%rdx
+  802a26:	00 00 00 
+  802a29:	89 c7                	mov    %eax,%edi
+  802a2b:	48 b8 db 1d 80 00 00 	movabs $0x801ddb,%rax
+  802a32:	00 00 00 
+  802a35:	ff d0                	call   *%rax
+  802a37:	89 45 fc             	mov    %eax,-0x4(%rbp)
+		}
+		// 让出CPU
+		sys_yield();
+  802a3a:	48 b8 bb 1b 80 00 00 	movabs $0x801bbb,%rax
+  802a41:	00 00 00 
+  802a44:	ff d0                	call   *%rax
+	while(r == -E_IPC_NOT_RECV) {
+  802a46:	83 7d fc f8          	cmpl   $0xfffffff8,-0x4(%rbp)
+  802a4a:	74 a1                	je     8029ed <ipc_send+0x1e>
+	}
+	if (r != 0) {
+  802a4c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802a50:	74 30                	je     802a82 <ipc_send+0xb3>
+		panic("something went wrong with sending the page");
+  802a52:	48 b8 28 33 80 00 00 	movabs $0x803328,%rax
+  802a59:	00 00 00 
+  802a5c:	48 89 c2             	mov    %rax,%rdx
+  802a5f:	be 48 00 00 00       	mov    $0x48,%esi
+  802a64:	48 b8 53 33 80 00 00 	movabs $0x803353,%rax
+  802a6b:	00 00 00 
+  802a6e:	48 89 c7             	mov    %rax,%rdi
+  802a71:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a76:	48 b9 b3 2a 80 00 00 	movabs $0x802ab3,%rcx
+  802a7d:	00 00 00 
+  802a80:	ff d1                	call   *%rcx
+	}
+}
+  802a82:	90                   	nop
+  802a83:	c9                   	leave
+  802a84:	c3                   	ret
+
+0000000000802a85 <ipc_find_env>:
+// find special environments.
+// Returns 0 if no such environment exists.
+// 内核只遍历已分配的环境(env_live)，不扫描整个 procs[]
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802a85:	55                   	push   %rbp
+  802a86:	48 89 e5             	mov    %rsp,%rbp
+  802a89:	48 83 ec 20          	sub    $0x20,%rsp
+  802a8d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	envid_t r = sys_env_find(type);
+  802a90:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a93:	89 c7                	mov    %eax,%edi
+  802a95:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  802a9c:	00 00 00 
+  802a9f:	ff d0                	call   *%rax
+  802aa1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+	return r < 0 ? 0 : r;
+  802aa4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802aa7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aac:	85 c0                	test   %eax,%eax
+  802aae:	0f 48 c2             	cmovs  %edx,%eax
+}
+  802ab1:	c9                   	leave
+  802ab2:	c3                   	ret
+
+0000000000802ab3 <_panic>:
+/*
+ * 无法解决的致命错误会导致死机
+ * 打印"死机:<消息>”，然后导致处理器休眠进入HLT状态
+ */
+void _panic(const char *file, int line, const char *fmt, ...)
+{
+  802ab3:	55                   	push   %rbp
+  802ab4:	48 89 e5             	mov    %rsp,%rbp
+  802ab7:	53                   	push   %rbx
+  802ab8:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  802abf:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  802ac6:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  802acc:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  802ad3:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  802ada:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  802ae1:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  802ae8:	84 c0                	test   %al,%al
+  802aea:	74 23                	je     802b0f <_panic+0x5c>
+  802aec:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  802af3:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  802af7:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  802afb:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  802aff:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  802b03:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  802b07:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  802b0b:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  802b0f:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  802b16:	00 00 00 
+  802b19:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  802b20:	00 00 00 
+  802b23:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802b27:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  802b2e:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  802b35:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+	// 输出死机的信息
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802b3c:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802b43:	00 00 00 
+  802b46:	48 8b 18             	mov    (%rax),%rbx
+  802b49:	48 b8 7f 1b 80 00 00 	movabs $0x801b7f,%rax
+  802b50:	00 00 00 
+  802b53:	ff d0                	call   *%rax
+  802b55:	89 c6                	mov    %eax,%esi
+  802b57:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  802b5d:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  802b64:	41 89 d0             	mov    %edx,%r8d
+  802b67:	48 89 c1             	mov    %rax,%rcx
+  802b6a:	48 89 da             	mov    %rbx,%rdx
+  802b6d:	48 b8 60 33 80 00 00 	movabs $0x803360,%rax
+  802b74:	00 00 00 
+  802b77:	48 89 c7             	mov    %rax,%rdi
+  802b7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b7f:	49 b9 0c 03 80 00 00 	movabs $0x80030c,%r9
+  802b86:	00 00 00 
+  802b89:	41 ff d1             	call   *%r9
+			sys_getprocid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802b8c:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  802b93:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  802b9a:	48 89 d6             	mov    %rdx,%rsi
+  802b9d:	48 89 c7             	mov    %rax,%rdi
+  802ba0:	48 b8 5d 02 80 00 00 	movabs $0x80025d,%rax
+  802ba7:	00 00 00 
+  802baa:	ff d0                	call   *%rax
+	cprintf("\n");
+  802bac:	48 b8 83 33 80 00 00 	movabs $0x803383,%rax
+  802bb3:	00 00 00 
+  802bb6:	48 89 c7             	mov    %rax,%rdi
+  802bb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bbe:	48 ba 0c 03 80 00 00 	movabs $0x80030c,%rdx
+  802bc5:	00 00 00 
+  802bc8:	ff d2                	call   *%rdx
+
+	// 触发断点中断
+	while (1)
+		asm volatile("int3");
+  802bca:	cc                   	int3
+  802bcb:	eb fd                	jmp    802bca <_panic+0x117>
+
+0000000000802bcd <set_pgfault_handler>:
+ * 包含用户异常栈的初始化和页错误处理函数的设置，利用 kern/syscall.c sys_env_set_pgfault_upcall() 注册(utf字段)用户页错误处理函数
+ * 第一次注册处理程序时，需要分配一个异常堆栈(顶部位于UXSTACKTOP的一页内存)
+ * 并告诉内核在页错误发生时调用汇编语言 _pgfault_upcall 例程
+ */
+void set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802bcd:	55                   	push   %rbp
+  802bce:	48 89 e5             	mov    %rsp,%rbp
+  802bd1:	48 83 ec 10          	sub    $0x10,%rsp
+  802bd5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	if (_pgfault_handler == 0)
+  802bd9:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  802be0:	00 00 00 
+  802be3:	48 8b 00             	mov    (%rax),%rax
+  802be6:	48 85 c0             	test   %rax,%rax
+  802be9:	75 72                	jne    802c5d <set_pgfault_handler+0x90>
+	{
+		// 第一次出错，创建用户异常栈
+		if (sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_W | PTE_U | PTE_P) == 0)
+  802beb:	ba 07 00 00 00       	mov    $0x7,%edx
+  802bf0:	b8 00 f0 7f ef       	mov    $0xef7ff000,%eax
+  802bf5:	48 89 c6             	mov    %rax,%rsi
+  802bf8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bfd:	48 b8 f8 1b 80 00 00 	movabs $0x801bf8,%rax
+  802c04:	00 00 00 
+  802c07:	ff d0                	call   *%rax
+  802c09:	85 c0                	test   %eax,%eax
+  802c0b:	75 20                	jne    802c2d <set_pgfault_handler+0x60>
+			sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  802c0d:	48 b8 71 2c 80 00 00 	movabs $0x802c71,%rax
+  802c14:	00 00 00 
+  802c17:	48 89 c6             	mov    %rax,%rsi
+  802c1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c1f:	48 b8 8f 1d 80 00 00 	movabs $0x801d8f,%rax
+  802c26:	00 00 00 
+  802c29:	ff d0                	call   *%rax
+  802c2b:	eb 30                	jmp    802c5d <set_pgfault_handler+0x90>
+		else
+			panic("set_pgfault_handler(): no memory");
+  802c2d:	48 b8 88 33 80 00 00 	movabs $0x803388,%rax
+  802c34:	00 00 00 
+  802c37:	48 89 c2             	mov    %rax,%rdx
+  802c3a:	be 1b 00 00 00       	mov    $0x1b,%esi
+  802c3f:	48 b8 a9 33 80 00 00 	movabs $0x8033a9,%rax
+  802c46:	00 00 00 
+  802c49:	48 89 c7             	mov    %rax,%rdi
+  802c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c51:	48 b9 b3 2a 80 00 00 	movabs $0x802ab3,%rcx
+  802c58:	00 00 00 
+  802c5b:	ff d1                	call   *%rcx
+	}
+
+	// 存储汇编语言调用的处理函数指针.
+	_pgfault_handler = handler;
+  802c5d:	48 ba 18 40 80 00 00 	movabs $0x804018,%rdx
+  802c64:	00 00 00 
+  802c67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c6b:	48 89 02             	mov    %rax,(%rdx)
+}
+  802c6e:	90                   	nop
+  802c6f:	c9                   	leave
+  802c70:	c3                   	ret
+
+0000000000802c71 <_pgfault_upcall>:
+
+	// 调用C代码中的页错误处理函数.
+	// 函数参数: 指向 UTrapframe 的指针
+
+	// 通过 %rdi 传递函数参数
+	movq  %rsp, %rdi
+  802c71:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  802c74:	48 a1 18 40 80 00 00 	movabs 0x804018,%rax
+  802c7b:	00 00 00 
+	call *%rax
+  802c7e:	ff d0                	call   *%rax
+			regs: 15*8 = 120-Byte,
+			eflags: 8-Byte,
+			rip: 8-Byte
+	*/
+
+	addq $16, %rsp	/* 跳过用户异常栈中的 utf_fault_va 和 utf_err(不需要) */
+  802c80:	48 83 c4 10          	add    $0x10,%rsp
+	
+	/* 用户异常栈: %rsp 指向 end of struct PushRegs */
+	
+	movq 120(%rsp), %r10	/* %r10 = %rip */
+  802c84:	4c 8b 54 24 78       	mov    0x78(%rsp),%r10
+	movq 136(%rsp), %r11	/* %r11 = %rsp */
+  802c89:	4c 8b 9c 24 88 00 00 	mov    0x88(%rsp),%r11
+  802c90:	00 
+
+	subq $8, %r11			/* %r11(trap-time %rsp) - 8 */
+  802c91:	49 83 eb 08          	sub    $0x8,%r11
+	movq %r10, (%r11)		/* %r11(trap-time %rsp) 指向的值为 %rip */
+  802c95:	4d 89 13             	mov    %r10,(%r11)
+	movq %r11, 136(%rsp)	/* 更新 trap-time %rsp 的值 */
+  802c98:	4c 89 9c 24 88 00 00 	mov    %r11,0x88(%rsp)
+  802c9f:	00 
+		trap-time eflags
+		trap-time rip
+	*/
+
+	// 恢复 trap-time 寄存器集.  接下来不能再修改任何通用寄存器集 PushRegs.
+	POPA_	/* 之前已经通过增加 16-Byte 跳过了 fault_va 和 utf_err，所以只需使用 POPA_ 恢复 */
+  802ca0:	4c 8b 3c 24          	mov    (%rsp),%r15
+  802ca4:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  802ca9:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  802cae:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  802cb3:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  802cb8:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  802cbd:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  802cc2:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  802cc7:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  802ccc:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  802cd1:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  802cd6:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  802cdb:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  802ce0:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  802ce5:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  802cea:	48 83 c4 78          	add    $0x78,%rsp
+
+	// 从栈中恢复 %eflags.  接下来不能再使用修改 %eflags 的指令，比如算术指令sub, cmp等.
+	addq $8, %rsp	/* 跳过 %rip，指向 %eflags */
+  802cee:	48 83 c4 08          	add    $0x8,%rsp
+	popfq			/* 从栈中恢复 %eflags */
+  802cf2:	9d                   	popf
+		(blank 8-Byte)
+		trap-time rip
+	*/
+
+	// 切换回调整后的 trap-time 栈.
+	popq %rsp		/* 已经指向 %rsp，直接 pop 恢复 */
+  802cf3:	5c                   	pop    %rsp
+
+	// 返回重新执行引起页错误的环境指令.
+	ret				/* popq %rip */
+  802cf4:	c3                   	ret
@@ -0,0 +1,4727 @@
+
+obj/user/pingpongs.debug:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// entrypoint - 当最初被加载到一个新的环境中时，内核(或者父环境)在这里开始运行.
+.text
+.globl _start
+_start:
+	// 判断是否从栈上的参数开始初始化
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	// $USTACKTOP != %rsp 说明有参数，跳转到 args_exist
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// 如果不是(新环境被内核加载的时候)，则 push 伪造的 argc, argv 参数
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 bf 01 00 00       	call   800200 <libmain>
+
+// 不应该返回
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+
+uint32_t val;
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 56                	push   %r14
+  800049:	41 55                	push   %r13
+  80004b:	41 54                	push   %r12
+  80004d:	53                   	push   %rbx
+  80004e:	48 83 ec 20          	sub    $0x20,%rsp
+  800052:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  800055:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int32_t who;
+	uint32_t i;
+
+	i = 0;
+  800059:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+	if ((who = fork()) != 0) {
+  800060:	48 b8 1b 26 80 00 00 	movabs $0x80261b,%rax
+  800067:	00 00 00 
+  80006a:	ff d0                	call   *%rax
+  80006c:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  80006f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800072:	85 c0                	test   %eax,%eax
+  800074:	0f 84 8d 00 00 00    	je     800107 <umain+0xc4>
+		cprintf("i am %08x; thisproc is %p\n", sys_getprocid(), thisproc);
+  80007a:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  800081:	00 00 00 
+  800084:	48 8b 18             	mov    (%rax),%rbx
+  800087:	48 b8 31 1c 80 00 00 	movabs $0x801c31,%rax
+  80008e:	00 00 00 
+  800091:	ff d0                	call   *%rax
+  800093:	48 89 da             	mov    %rbx,%rdx
+  800096:	89 c6                	mov    %eax,%esi
+  800098:	48 b8 c0 2d 80 00 00 	movabs $0x802dc0,%rax
+  80009f:	00 00 00 
+  8000a2:	48 89 c7             	mov    %rax,%rdi
+  8000a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000aa:	48 b9 be 03 80 00 00 	movabs $0x8003be,%rcx
+  8000b1:	00 00 00 
+  8000b4:	ff d1                	call   *%rcx
+		// 开始
+		cprintf("send 0 from %x to %x\n", sys_getprocid(), who);
+  8000b6:	8b 5d d8             	mov    -0x28(%rbp),%ebx
+  8000b9:	48 b8 31 1c 80 00 00 	movabs $0x801c31,%rax
+  8000c0:	00 00 00 
+  8000c3:	ff d0                	call   *%rax
+  8000c5:	89 da                	mov    %ebx,%edx
+  8000c7:	89 c6                	mov    %eax,%esi
+  8000c9:	48 b8 db 2d 80 00 00 	movabs $0x802ddb,%rax
+  8000d0:	00 00 00 
+  8000d3:	48 89 c7             	mov    %rax,%rdi
+  8000d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000db:	48 b9 be 03 80 00 00 	movabs $0x8003be,%rcx
+  8000e2:	00 00 00 
+  8000e5:	ff d1                	call   *%rcx
+		ipc_send(who, 0, 0, 0);
+  8000e7:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8000ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8000f9:	89 c7                	mov    %eax,%edi
+  8000fb:	48 b8 81 2a 80 00 00 	movabs $0x802a81,%rax
+  800102:	00 00 00 
+  800105:	ff d0                	call   *%rax
+	}
+
+	while (1) {
+		ipc_recv(&who, 0, 0);
+  800107:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  80010b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800110:	be 00 00 00 00       	mov    $0x0,%esi
+  800115:	48 89 c7             	mov    %rax,%rdi
+  800118:	48 b8 97 29 80 00 00 	movabs $0x802997,%rax
+  80011f:	00 00 00 
+  800122:	ff d0                	call   *%rax
+		cprintf("%x got %d from %x (thisproc is %p %x)\n", sys_getprocid(), val, who, thisproc, thisproc->proc_id);
+  800124:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  80012b:	00 00 00 
+  80012e:	48 8b 00             	mov    (%rax),%rax
+  800131:	44 8b b0 d8 00 00 00 	mov    0xd8(%rax),%r14d
+  800138:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  80013f:	00 00 00 
+  800142:	4c 8b 28             	mov    (%rax),%r13
+  800145:	44 8b 65 d8          	mov    -0x28(%rbp),%r12d
+  800149:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  800150:	00 00 00 
+  800153:	8b 18                	mov    (%rax),%ebx
+  800155:	48 b8 31 1c 80 00 00 	movabs $0x801c31,%rax
+  80015c:	00 00 00 
+  80015f:	ff d0                	call   *%rax
+  800161:	45 89 f1             	mov    %r14d,%r9d
+  800164:	4d 89 e8             	mov    %r13,%r8
+  800167:	44 89 e1             	mov    %r12d,%ecx
+  80016a:	89 da                	mov    %ebx,%edx
+  80016c:	89 c6                	mov    %eax,%esi
+  80016e:	48 b8 f8 2d 80 00 00 	movabs $0x802df8,%rax
+  800175:	00 00 00 
+  800178:	48 89 c7             	mov    %rax,%rdi
+  80017b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800180:	49 ba be 03 80 00 00 	movabs $0x8003be,%r10
+  800187:	00 00 00 
+  80018a:	41 ff d2             	call   *%r10
+		if (val == 10)
+  80018d:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  800194:	00 00 00 
+  800197:	8b 00                	mov    (%rax),%eax
+  800199:	83 f8 0a             	cmp    $0xa,%eax
+  80019c:	74 51                	je     8001ef <umain+0x1ac>
+			return;
+		++val;
+  80019e:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  8001a5:	00 00 00 
+  8001a8:	8b 00                	mov    (%rax),%eax
+  8001aa:	8d 50 01             	lea    0x1(%rax),%edx
+  8001ad:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  8001b4:	00 00 00 
+  8001b7:	89 10                	mov    %edx,(%rax)
+		ipc_send(who, 0, 0, 0);
+  8001b9:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8001bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8001cb:	89 c7                	mov    %eax,%edi
+  8001cd:	48 b8 81 2a 80 00 00 	movabs $0x802a81,%rax
+  8001d4:	00 00 00 
+  8001d7:	ff d0                	call   *%rax
+		if (val == 10)
+  8001d9:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  8001e0:	00 00 00 
+  8001e3:	8b 00                	mov    (%rax),%eax
+  8001e5:	83 f8 0a             	cmp    $0xa,%eax
+  8001e8:	74 08                	je     8001f2 <umain+0x1af>
+		ipc_recv(&who, 0, 0);
+  8001ea:	e9 18 ff ff ff       	jmp    800107 <umain+0xc4>
+			return;
+  8001ef:	90                   	nop
+  8001f0:	eb 01                	jmp    8001f3 <umain+0x1b0>
+			return;
+  8001f2:	90                   	nop
+	}
+
+}
+  8001f3:	48 83 c4 20          	add    $0x20,%rsp
+  8001f7:	5b                   	pop    %rbx
+  8001f8:	41 5c                	pop    %r12
+  8001fa:	41 5d                	pop    %r13
+  8001fc:	41 5e                	pop    %r14
+  8001fe:	5d                   	pop    %rbp
+  8001ff:	c3                   	ret
+
+0000000000800200 <libmain>:
+
+/**
+ *  用户环境从lib/libmain.c中的函数libmain开始执行，这个函数进而调用umain，用户写的程序入口只能是umain
+ */
+void libmain(int argc, char **argv)
+{
+  800200:	55                   	push   %rbp
+  800201:	48 89 e5             	mov    %rsp,%rbp
+  800204:	48 83 ec 10          	sub    $0x10,%rsp
+  800208:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80020b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 设置常量 thisproc 指向 procs[] 中当前环境的 Env 结构，ENVX 确保环境 id 未超过了 NENV
+	// thisproc 指向当前环境的 Env 结构
+	thisproc = &procs[ENVX(sys_getprocid())];
+  80020f:	48 b8 31 1c 80 00 00 	movabs $0x801c31,%rax
+  800216:	00 00 00 
+  800219:	ff d0                	call   *%rax
+  80021b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800220:	48 98                	cltq
+  800222:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  800229:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  800230:	00 00 00 
+  800233:	48 01 c2             	add    %rax,%rdx
+  800236:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  80023d:	00 00 00 
+  800240:	48 89 10             	mov    %rdx,(%rax)
+
+	// 通过 CPUID 选择 memset/memmove/memcpy 的实现
+	mem_init();
+  800243:	48 b8 d9 12 80 00 00 	movabs $0x8012d9,%rax
+  80024a:	00 00 00 
+  80024d:	ff d0                	call   *%rax
+
+	// 为了能让panic()提示用户错误，存储程序的名称
+	if (argc > 0)
+  80024f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800253:	7e 14                	jle    800269 <libmain+0x69>
+		binaryname = argv[0];
+  800255:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800259:	48 8b 00             	mov    (%rax),%rax
+  80025c:	48 ba 00 40 80 00 00 	movabs $0x804000,%rdx
+  800263:	00 00 00 
+  800266:	48 89 02             	mov    %rax,(%rdx)
+
+	// 调用用户的主程序
+	umain(argc, argv);
+  800269:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80026d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800270:	48 89 d6             	mov    %rdx,%rsi
+  800273:	89 c7                	mov    %eax,%edi
+  800275:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  80027c:	00 00 00 
+  80027f:	ff d0                	call   *%rax
+
+	// 退出当前环境，env_destroy
+	sys_env_destroy(0);
+  800281:	bf 00 00 00 00       	mov    $0x0,%edi
+  800286:	48 b8 eb 1b 80 00 00 	movabs $0x801beb,%rax
+  80028d:	00 00 00 
+  800290:	ff d0                	call   *%rax
+}
+  800292:	90                   	nop
+  800293:	c9                   	leave
+  800294:	c3                   	ret
+
+0000000000800295 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800295:	55                   	push   %rbp
+  800296:	48 89 e5             	mov    %rsp,%rbp
+  800299:	48 83 ec 10          	sub    $0x10,%rsp
+  80029d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8002a0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->buf[b->idx++] = ch;
+  8002a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002a8:	8b 00                	mov    (%rax),%eax
+  8002aa:	8d 48 01             	lea    0x1(%rax),%ecx
+  8002ad:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8002b1:	89 0a                	mov    %ecx,(%rdx)
+  8002b3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8002b6:	89 d1                	mov    %edx,%ecx
+  8002b8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8002bc:	48 98                	cltq
+  8002be:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+	if (b->idx == 256-1) {
+  8002c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002c6:	8b 00                	mov    (%rax),%eax
+  8002c8:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002cd:	75 2c                	jne    8002fb <putch+0x66>
+		sys_cputs(b->buf, b->idx);
+  8002cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002d3:	8b 00                	mov    (%rax),%eax
+  8002d5:	48 98                	cltq
+  8002d7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8002db:	48 83 c2 08          	add    $0x8,%rdx
+  8002df:	48 89 c6             	mov    %rax,%rsi
+  8002e2:	48 89 d7             	mov    %rdx,%rdi
+  8002e5:	48 b8 62 1b 80 00 00 	movabs $0x801b62,%rax
+  8002ec:	00 00 00 
+  8002ef:	ff d0                	call   *%rax
+		b->idx = 0;
+  8002f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002f5:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	}
+	b->cnt++;
+  8002fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002ff:	8b 40 04             	mov    0x4(%rax),%eax
+  800302:	8d 50 01             	lea    0x1(%rax),%edx
+  800305:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800309:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80030c:	90                   	nop
+  80030d:	c9                   	leave
+  80030e:	c3                   	ret
+
+000000000080030f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80030f:	55                   	push   %rbp
+  800310:	48 89 e5             	mov    %rsp,%rbp
+  800313:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80031a:	48 89 bd c8 fe ff ff 	mov    %rdi,-0x138(%rbp)
+  800321:	48 89 b5 c0 fe ff ff 	mov    %rsi,-0x140(%rbp)
+	struct printbuf b;
+	va_list aq;
+	va_copy(aq,ap);
+  800328:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  80032f:	48 8b b5 c0 fe ff ff 	mov    -0x140(%rbp),%rsi
+  800336:	48 8b 06             	mov    (%rsi),%rax
+  800339:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80033d:	48 89 01             	mov    %rax,(%rcx)
+  800340:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800344:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800348:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	b.idx = 0;
+  80034c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800353:	00 00 00 
+	b.cnt = 0;
+  800356:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80035d:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, aq);
+  800360:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  800367:	48 8b 95 c8 fe ff ff 	mov    -0x138(%rbp),%rdx
+  80036e:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800375:	48 89 c6             	mov    %rax,%rsi
+  800378:	48 b8 95 02 80 00 00 	movabs $0x800295,%rax
+  80037f:	00 00 00 
+  800382:	48 89 c7             	mov    %rax,%rdi
+  800385:	48 b8 5c 07 80 00 00 	movabs $0x80075c,%rax
+  80038c:	00 00 00 
+  80038f:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  800391:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  800397:	48 98                	cltq
+  800399:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8003a0:	48 83 c2 08          	add    $0x8,%rdx
+  8003a4:	48 89 c6             	mov    %rax,%rsi
+  8003a7:	48 89 d7             	mov    %rdx,%rdi
+  8003aa:	48 b8 62 1b 80 00 00 	movabs $0x801b62,%rax
+  8003b1:	00 00 00 
+  8003b4:	ff d0                	call   *%rax
+	va_end(aq);
+
+	return b.cnt;
+  8003b6:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8003bc:	c9                   	leave
+  8003bd:	c3                   	ret
+
+00000000008003be <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8003be:	55                   	push   %rbp
+  8003bf:	48 89 e5             	mov    %rsp,%rbp
+  8003c2:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  8003c9:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8003d0:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8003d7:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8003de:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8003e5:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8003ec:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8003f3:	84 c0                	test   %al,%al
+  8003f5:	74 20                	je     800417 <cprintf+0x59>
+  8003f7:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8003fb:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8003ff:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800403:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800407:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80040b:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80040f:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800413:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+	va_list aq;
+	va_start(ap, fmt);
+  800417:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80041e:	00 00 00 
+  800421:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800428:	00 00 00 
+  80042b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80042f:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800436:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80043d:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  800444:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80044b:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800452:	48 8b 06             	mov    (%rsi),%rax
+  800455:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800459:	48 89 01             	mov    %rax,(%rcx)
+  80045c:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800460:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800464:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	cnt = vcprintf(fmt, aq);
+  800468:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80046f:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800476:	48 89 d6             	mov    %rdx,%rsi
+  800479:	48 89 c7             	mov    %rax,%rdi
+  80047c:	48 b8 0f 03 80 00 00 	movabs $0x80030f,%rax
+  800483:	00 00 00 
+  800486:	ff d0                	call   *%rax
+  800488:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return cnt;
+  80048e:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800494:	c9                   	leave
+  800495:	c3                   	ret
+
+0000000000800496 <printnum>:
+ * num: 需要打印出来的整型数，base: 整型数的进制，其他参数同 vprintfmt
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+		 unsigned long long num, unsigned base, int width, int padc)
+{
+  800496:	55                   	push   %rbp
+  800497:	48 89 e5             	mov    %rsp,%rbp
+  80049a:	48 83 ec 30          	sub    $0x30,%rsp
+  80049e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8004a2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8004a6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8004aa:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8004ad:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8004b1:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+	// 当 num 超过一位数，首先递归函数自身打印所有高位的(更重要的)数字
+	if (num >= base)
+  8004b5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8004b8:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8004bc:	72 54                	jb     800512 <printnum+0x7c>
+	{
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004be:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8004c1:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8004c4:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8004c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004d0:	48 f7 f6             	div    %rsi
+  8004d3:	49 89 c2             	mov    %rax,%r10
+  8004d6:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8004d9:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8004dc:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8004e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004e4:	41 89 c9             	mov    %ecx,%r9d
+  8004e7:	41 89 f8             	mov    %edi,%r8d
+  8004ea:	89 d1                	mov    %edx,%ecx
+  8004ec:	4c 89 d2             	mov    %r10,%rdx
+  8004ef:	48 89 c7             	mov    %rax,%rdi
+  8004f2:	48 b8 96 04 80 00 00 	movabs $0x800496,%rax
+  8004f9:	00 00 00 
+  8004fc:	ff d0                	call   *%rax
+  8004fe:	eb 1c                	jmp    80051c <printnum+0x86>
+	}
+	else
+	{
+		// 按照右对齐的格式在左侧补齐填充字符 padc
+		while (--width > 0)
+			putch(padc, putdat);
+  800500:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800504:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800507:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80050b:	48 89 d6             	mov    %rdx,%rsi
+  80050e:	89 c7                	mov    %eax,%edi
+  800510:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800512:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800516:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80051a:	7f e4                	jg     800500 <printnum+0x6a>
+	}
+
+	// 然后打印个位数字
+	putch("0123456789abcdef"[num % base], putdat);
+  80051c:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80051f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800523:	ba 00 00 00 00       	mov    $0x0,%edx
+  800528:	48 f7 f1             	div    %rcx
+  80052b:	48 b8 30 30 80 00 00 	movabs $0x803030,%rax
+  800532:	00 00 00 
+  800535:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800539:	0f be c0             	movsbl %al,%eax
+  80053c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800540:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800544:	48 89 d6             	mov    %rdx,%rsi
+  800547:	89 c7                	mov    %eax,%edi
+  800549:	ff d1                	call   *%rcx
+}
+  80054b:	90                   	nop
+  80054c:	c9                   	leave
+  80054d:	c3                   	ret
+
+000000000080054e <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  80054e:	55                   	push   %rbp
+  80054f:	48 89 e5             	mov    %rsp,%rbp
+  800552:	48 83 ec 20          	sub    $0x20,%rsp
+  800556:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80055a:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;
+	if (lflag >= 2)
+  80055d:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800561:	7e 4f                	jle    8005b2 <getuint+0x64>
+		x = va_arg(*ap, unsigned long long);
+  800563:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800567:	8b 00                	mov    (%rax),%eax
+  800569:	83 f8 2f             	cmp    $0x2f,%eax
+  80056c:	77 24                	ja     800592 <getuint+0x44>
+  80056e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800572:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800576:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80057a:	8b 00                	mov    (%rax),%eax
+  80057c:	89 c0                	mov    %eax,%eax
+  80057e:	48 01 d0             	add    %rdx,%rax
+  800581:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800585:	8b 12                	mov    (%rdx),%edx
+  800587:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80058a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80058e:	89 0a                	mov    %ecx,(%rdx)
+  800590:	eb 14                	jmp    8005a6 <getuint+0x58>
+  800592:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800596:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80059a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80059e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005a2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005a6:	48 8b 00             	mov    (%rax),%rax
+  8005a9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8005ad:	e9 9d 00 00 00       	jmp    80064f <getuint+0x101>
+	else if (lflag)
+  8005b2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8005b6:	74 4c                	je     800604 <getuint+0xb6>
+		x = va_arg(*ap, unsigned long);
+  8005b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005bc:	8b 00                	mov    (%rax),%eax
+  8005be:	83 f8 2f             	cmp    $0x2f,%eax
+  8005c1:	77 24                	ja     8005e7 <getuint+0x99>
+  8005c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005c7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005cf:	8b 00                	mov    (%rax),%eax
+  8005d1:	89 c0                	mov    %eax,%eax
+  8005d3:	48 01 d0             	add    %rdx,%rax
+  8005d6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005da:	8b 12                	mov    (%rdx),%edx
+  8005dc:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005df:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005e3:	89 0a                	mov    %ecx,(%rdx)
+  8005e5:	eb 14                	jmp    8005fb <getuint+0xad>
+  8005e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005eb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005ef:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005f3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005f7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005fb:	48 8b 00             	mov    (%rax),%rax
+  8005fe:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800602:	eb 4b                	jmp    80064f <getuint+0x101>
+	else
+		x = va_arg(*ap, unsigned int);
+  800604:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800608:	8b 00                	mov    (%rax),%eax
+  80060a:	83 f8 2f             	cmp    $0x2f,%eax
+  80060d:	77 24                	ja     800633 <getuint+0xe5>
+  80060f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800613:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800617:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80061b:	8b 00                	mov    (%rax),%eax
+  80061d:	89 c0                	mov    %eax,%eax
+  80061f:	48 01 d0             	add    %rdx,%rax
+  800622:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800626:	8b 12                	mov    (%rdx),%edx
+  800628:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80062b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80062f:	89 0a                	mov    %ecx,(%rdx)
+  800631:	eb 14                	jmp    800647 <getuint+0xf9>
+  800633:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800637:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80063b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80063f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800643:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800647:	8b 00                	mov    (%rax),%eax
+  800649:	89 c0                	mov    %eax,%eax
+  80064b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80064f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800653:	c9                   	leave
+  800654:	c3                   	ret
+
+0000000000800655 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800655:	55                   	push   %rbp
+  800656:	48 89 e5             	mov    %rsp,%rbp
+  800659:	48 83 ec 20          	sub    $0x20,%rsp
+  80065d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800661:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800664:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800668:	7e 4f                	jle    8006b9 <getint+0x64>
+		x = va_arg(*ap, long long);
+  80066a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80066e:	8b 00                	mov    (%rax),%eax
+  800670:	83 f8 2f             	cmp    $0x2f,%eax
+  800673:	77 24                	ja     800699 <getint+0x44>
+  800675:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800679:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80067d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800681:	8b 00                	mov    (%rax),%eax
+  800683:	89 c0                	mov    %eax,%eax
+  800685:	48 01 d0             	add    %rdx,%rax
+  800688:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80068c:	8b 12                	mov    (%rdx),%edx
+  80068e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800691:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800695:	89 0a                	mov    %ecx,(%rdx)
+  800697:	eb 14                	jmp    8006ad <getint+0x58>
+  800699:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80069d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006a1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006a5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006a9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006ad:	48 8b 00             	mov    (%rax),%rax
+  8006b0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8006b4:	e9 9d 00 00 00       	jmp    800756 <getint+0x101>
+	else if (lflag)
+  8006b9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8006bd:	74 4c                	je     80070b <getint+0xb6>
+		x = va_arg(*ap, long);
+  8006bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006c3:	8b 00                	mov    (%rax),%eax
+  8006c5:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c8:	77 24                	ja     8006ee <getint+0x99>
+  8006ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006ce:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006d6:	8b 00                	mov    (%rax),%eax
+  8006d8:	89 c0                	mov    %eax,%eax
+  8006da:	48 01 d0             	add    %rdx,%rax
+  8006dd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006e1:	8b 12                	mov    (%rdx),%edx
+  8006e3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006e6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006ea:	89 0a                	mov    %ecx,(%rdx)
+  8006ec:	eb 14                	jmp    800702 <getint+0xad>
+  8006ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006f2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006f6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006fa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006fe:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800702:	48 8b 00             	mov    (%rax),%rax
+  800705:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800709:	eb 4b                	jmp    800756 <getint+0x101>
+	else
+		x = va_arg(*ap, int);
+  80070b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80070f:	8b 00                	mov    (%rax),%eax
+  800711:	83 f8 2f             	cmp    $0x2f,%eax
+  800714:	77 24                	ja     80073a <getint+0xe5>
+  800716:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80071a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80071e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800722:	8b 00                	mov    (%rax),%eax
+  800724:	89 c0                	mov    %eax,%eax
+  800726:	48 01 d0             	add    %rdx,%rax
+  800729:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80072d:	8b 12                	mov    (%rdx),%edx
+  80072f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800732:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800736:	89 0a                	mov    %ecx,(%rdx)
+  800738:	eb 14                	jmp    80074e <getint+0xf9>
+  80073a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80073e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800742:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800746:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80074a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80074e:	8b 00                	mov    (%rax),%eax
+  800750:	48 98                	cltq
+  800752:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800756:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80075a:	c9                   	leave
+  80075b:	c3                   	ret
+
+000000000080075c <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap)
+{
+  80075c:	55                   	push   %rbp
+  80075d:	48 89 e5             	mov    %rsp,%rbp
+  800760:	41 54                	push   %r12
+  800762:	53                   	push   %rbx
+  800763:	48 83 ec 60          	sub    $0x60,%rsp
+  800767:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80076b:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80076f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800773:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+	int base, lflag, width, precision, altflag;
+
+	// 填充字符，在显示字符串的'%'后读到'-'或'0'时，赋值到 padc
+	char padc;
+	va_list aq;
+	va_copy(aq, ap);
+  800777:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80077b:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80077f:	48 8b 06             	mov    (%rsi),%rax
+  800782:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800786:	48 89 01             	mov    %rax,(%rcx)
+  800789:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80078d:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800791:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1)
+	{
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800795:	eb 17                	jmp    8007ae <vprintfmt+0x52>
+		{
+			if (ch == '\0')
+  800797:	85 db                	test   %ebx,%ebx
+  800799:	0f 84 b9 04 00 00    	je     800c58 <vprintfmt+0x4fc>
+				return;
+			putch(ch, putdat);
+  80079f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8007a3:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8007a7:	48 89 c6             	mov    %rax,%rsi
+  8007aa:	89 df                	mov    %ebx,%edi
+  8007ac:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  8007ae:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8007b2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8007b6:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8007ba:	0f b6 00             	movzbl (%rax),%eax
+  8007bd:	0f b6 d8             	movzbl %al,%ebx
+  8007c0:	83 fb 25             	cmp    $0x25,%ebx
+  8007c3:	75 d2                	jne    800797 <vprintfmt+0x3b>
+		}
+
+		// 处理 % 转义序列
+		// padc 初始化为空格符，padc='-'代表字符串左对齐，右边补空格，padc=' '代表右对齐，左边补空格，padc='0'右对齐，左边补0
+		padc = ' ';
+  8007c5:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+		width = -1;
+  8007c9:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+		// 默认-1代表显示长度为字符串本来的长度
+		precision = -1;
+  8007d0:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+		lflag = 0;
+  8007d7:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+		altflag = 0;
+  8007de:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *)fmt++)
+  8007e5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8007e9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8007ed:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8007f1:	0f b6 00             	movzbl (%rax),%eax
+  8007f4:	0f b6 d8             	movzbl %al,%ebx
+  8007f7:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8007fa:	83 f8 55             	cmp    $0x55,%eax
+  8007fd:	0f 87 22 04 00 00    	ja     800c25 <vprintfmt+0x4c9>
+  800803:	89 c0                	mov    %eax,%eax
+  800805:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80080c:	00 
+  80080d:	48 b8 58 30 80 00 00 	movabs $0x803058,%rax
+  800814:	00 00 00 
+  800817:	48 01 d0             	add    %rdx,%rax
+  80081a:	48 8b 00             	mov    (%rax),%rax
+  80081d:	ff e0                	jmp    *%rax
+		{
+
+		// flag to pad on the right
+		case '-':
+			padc = '-';
+  80081f:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+			goto reswitch;
+  800823:	eb c0                	jmp    8007e5 <vprintfmt+0x89>
+
+		// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800825:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+			goto reswitch;
+  800829:	eb ba                	jmp    8007e5 <vprintfmt+0x89>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0;; ++fmt)
+  80082b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+			{
+				precision = precision * 10 + ch - '0';
+  800832:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800835:	89 d0                	mov    %edx,%eax
+  800837:	c1 e0 02             	shl    $0x2,%eax
+  80083a:	01 d0                	add    %edx,%eax
+  80083c:	01 c0                	add    %eax,%eax
+  80083e:	01 d8                	add    %ebx,%eax
+  800840:	83 e8 30             	sub    $0x30,%eax
+  800843:	89 45 d8             	mov    %eax,-0x28(%rbp)
+				ch = *fmt;
+  800846:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80084a:	0f b6 00             	movzbl (%rax),%eax
+  80084d:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800850:	83 fb 2f             	cmp    $0x2f,%ebx
+  800853:	7e 60                	jle    8008b5 <vprintfmt+0x159>
+  800855:	83 fb 39             	cmp    $0x39,%ebx
+  800858:	7f 5b                	jg     8008b5 <vprintfmt+0x159>
+			for (precision = 0;; ++fmt)
+  80085a:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+				precision = precision * 10 + ch - '0';
+  80085f:	eb d1                	jmp    800832 <vprintfmt+0xd6>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800861:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800864:	83 f8 2f             	cmp    $0x2f,%eax
+  800867:	77 17                	ja     800880 <vprintfmt+0x124>
+  800869:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80086d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800870:	89 d2                	mov    %edx,%edx
+  800872:	48 01 d0             	add    %rdx,%rax
+  800875:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800878:	83 c2 08             	add    $0x8,%edx
+  80087b:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80087e:	eb 0c                	jmp    80088c <vprintfmt+0x130>
+  800880:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800884:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800888:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80088c:	8b 00                	mov    (%rax),%eax
+  80088e:	89 45 d8             	mov    %eax,-0x28(%rbp)
+			goto process_precision;
+  800891:	eb 23                	jmp    8008b6 <vprintfmt+0x15a>
+
+		case '.':
+			if (width < 0)
+  800893:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800897:	0f 89 48 ff ff ff    	jns    8007e5 <vprintfmt+0x89>
+				width = 0;
+  80089d:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+			goto reswitch;
+  8008a4:	e9 3c ff ff ff       	jmp    8007e5 <vprintfmt+0x89>
+
+		case '#':
+			altflag = 1;
+  8008a9:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+			goto reswitch;
+  8008b0:	e9 30 ff ff ff       	jmp    8007e5 <vprintfmt+0x89>
+			goto process_precision;
+  8008b5:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  8008b6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8008ba:	0f 89 25 ff ff ff    	jns    8007e5 <vprintfmt+0x89>
+				width = precision, precision = -1;
+  8008c0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8008c3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8008c6:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+			goto reswitch;
+  8008cd:	e9 13 ff ff ff       	jmp    8007e5 <vprintfmt+0x89>
+
+		// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  8008d2:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+			goto reswitch;
+  8008d6:	e9 0a ff ff ff       	jmp    8007e5 <vprintfmt+0x89>
+
+		// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  8008db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008de:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e1:	77 17                	ja     8008fa <vprintfmt+0x19e>
+  8008e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8008e7:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008ea:	89 d2                	mov    %edx,%edx
+  8008ec:	48 01 d0             	add    %rdx,%rax
+  8008ef:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008f2:	83 c2 08             	add    $0x8,%edx
+  8008f5:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8008f8:	eb 0c                	jmp    800906 <vprintfmt+0x1aa>
+  8008fa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8008fe:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800902:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800906:	8b 00                	mov    (%rax),%eax
+  800908:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80090c:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800910:	48 89 d6             	mov    %rdx,%rsi
+  800913:	89 c7                	mov    %eax,%edi
+  800915:	ff d1                	call   *%rcx
+			break;
+  800917:	e9 37 03 00 00       	jmp    800c53 <vprintfmt+0x4f7>
+
+		// error message
+		case 'e':
+			err = va_arg(aq, int);
+  80091c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80091f:	83 f8 2f             	cmp    $0x2f,%eax
+  800922:	77 17                	ja     80093b <vprintfmt+0x1df>
+  800924:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800928:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80092b:	89 d2                	mov    %edx,%edx
+  80092d:	48 01 d0             	add    %rdx,%rax
+  800930:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800933:	83 c2 08             	add    $0x8,%edx
+  800936:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800939:	eb 0c                	jmp    800947 <vprintfmt+0x1eb>
+  80093b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80093f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800943:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800947:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800949:	85 db                	test   %ebx,%ebx
+  80094b:	79 02                	jns    80094f <vprintfmt+0x1f3>
+				err = -err;
+  80094d:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80094f:	83 fb 11             	cmp    $0x11,%ebx
+  800952:	7f 16                	jg     80096a <vprintfmt+0x20e>
+  800954:	48 ba a0 2f 80 00 00 	movabs $0x802fa0,%rdx
+  80095b:	00 00 00 
+  80095e:	48 63 c3             	movslq %ebx,%rax
+  800961:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800965:	4d 85 e4             	test   %r12,%r12
+  800968:	75 2e                	jne    800998 <vprintfmt+0x23c>
+				printfmt(putch, putdat, "error %d", err);
+  80096a:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80096e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800972:	89 d9                	mov    %ebx,%ecx
+  800974:	48 ba 41 30 80 00 00 	movabs $0x803041,%rdx
+  80097b:	00 00 00 
+  80097e:	48 89 c7             	mov    %rax,%rdi
+  800981:	b8 00 00 00 00       	mov    $0x0,%eax
+  800986:	49 b8 62 0c 80 00 00 	movabs $0x800c62,%r8
+  80098d:	00 00 00 
+  800990:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800993:	e9 bb 02 00 00       	jmp    800c53 <vprintfmt+0x4f7>
+				printfmt(putch, putdat, "%s", p);
+  800998:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80099c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8009a0:	4c 89 e1             	mov    %r12,%rcx
+  8009a3:	48 ba 4a 30 80 00 00 	movabs $0x80304a,%rdx
+  8009aa:	00 00 00 
+  8009ad:	48 89 c7             	mov    %rax,%rdi
+  8009b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b5:	49 b8 62 0c 80 00 00 	movabs $0x800c62,%r8
+  8009bc:	00 00 00 
+  8009bf:	41 ff d0             	call   *%r8
+			break;
+  8009c2:	e9 8c 02 00 00       	jmp    800c53 <vprintfmt+0x4f7>
+
+		// string
+		case 's':
+			// 从可变参数中读入字符串指针
+			if ((p = va_arg(aq, char *)) == NULL)
+  8009c7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8009cd:	77 17                	ja     8009e6 <vprintfmt+0x28a>
+  8009cf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009d3:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009d6:	89 d2                	mov    %edx,%edx
+  8009d8:	48 01 d0             	add    %rdx,%rax
+  8009db:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009de:	83 c2 08             	add    $0x8,%edx
+  8009e1:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8009e4:	eb 0c                	jmp    8009f2 <vprintfmt+0x296>
+  8009e6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8009ea:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8009ee:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8009f2:	4c 8b 20             	mov    (%rax),%r12
+  8009f5:	4d 85 e4             	test   %r12,%r12
+  8009f8:	75 0a                	jne    800a04 <vprintfmt+0x2a8>
+				p = "(null)"; // 当字符串为空时，将它指向"(null)"字符串
+  8009fa:	49 bc 4d 30 80 00 00 	movabs $0x80304d,%r12
+  800a01:	00 00 00 
+			// 判断左对齐还是右对齐，pad='-'左对齐，否则右对齐
+			if (width > 0 && padc != '-')
+  800a04:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a08:	7e 78                	jle    800a82 <vprintfmt+0x326>
+  800a0a:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800a0e:	74 72                	je     800a82 <vprintfmt+0x326>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a10:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800a13:	48 98                	cltq
+  800a15:	48 89 c6             	mov    %rax,%rsi
+  800a18:	4c 89 e7             	mov    %r12,%rdi
+  800a1b:	48 b8 07 10 80 00 00 	movabs $0x801007,%rax
+  800a22:	00 00 00 
+  800a25:	ff d0                	call   *%rax
+  800a27:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800a2a:	eb 17                	jmp    800a43 <vprintfmt+0x2e7>
+					putch(padc, putdat); // 字符串右对齐，左边补相应数量(width-实际长度)的空格或者 0
+  800a2c:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800a30:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800a34:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800a38:	48 89 d6             	mov    %rdx,%rsi
+  800a3b:	89 c7                	mov    %eax,%edi
+  800a3d:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a3f:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800a43:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a47:	7f e3                	jg     800a2c <vprintfmt+0x2d0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a49:	eb 37                	jmp    800a82 <vprintfmt+0x326>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800a4b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800a4f:	74 1e                	je     800a6f <vprintfmt+0x313>
+  800a51:	83 fb 1f             	cmp    $0x1f,%ebx
+  800a54:	7e 05                	jle    800a5b <vprintfmt+0x2ff>
+  800a56:	83 fb 7e             	cmp    $0x7e,%ebx
+  800a59:	7e 14                	jle    800a6f <vprintfmt+0x313>
+					putch('?', putdat);
+  800a5b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a5f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a63:	48 89 c6             	mov    %rax,%rsi
+  800a66:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a6b:	ff d2                	call   *%rdx
+  800a6d:	eb 0f                	jmp    800a7e <vprintfmt+0x322>
+				else
+					putch(ch, putdat); // 打印相应长度的字符串
+  800a6f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a73:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a77:	48 89 c6             	mov    %rax,%rsi
+  800a7a:	89 df                	mov    %ebx,%edi
+  800a7c:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a7e:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800a82:	4c 89 e0             	mov    %r12,%rax
+  800a85:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800a89:	0f b6 00             	movzbl (%rax),%eax
+  800a8c:	0f be d8             	movsbl %al,%ebx
+  800a8f:	85 db                	test   %ebx,%ebx
+  800a91:	74 28                	je     800abb <vprintfmt+0x35f>
+  800a93:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800a97:	78 b2                	js     800a4b <vprintfmt+0x2ef>
+  800a99:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800a9d:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800aa1:	79 a8                	jns    800a4b <vprintfmt+0x2ef>
+			for (; width > 0; width--)
+  800aa3:	eb 16                	jmp    800abb <vprintfmt+0x35f>
+				putch(' ', putdat); // 当字符串是左对齐的时候打印相应数量的空格
+  800aa5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800aa9:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800aad:	48 89 c6             	mov    %rax,%rsi
+  800ab0:	bf 20 00 00 00       	mov    $0x20,%edi
+  800ab5:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800ab7:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800abb:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800abf:	7f e4                	jg     800aa5 <vprintfmt+0x349>
+			break;
+  800ac1:	e9 8d 01 00 00       	jmp    800c53 <vprintfmt+0x4f7>
+
+		// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800ac6:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800aca:	be 03 00 00 00       	mov    $0x3,%esi
+  800acf:	48 89 c7             	mov    %rax,%rdi
+  800ad2:	48 b8 55 06 80 00 00 	movabs $0x800655,%rax
+  800ad9:	00 00 00 
+  800adc:	ff d0                	call   *%rax
+  800ade:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((long long)num < 0)
+  800ae2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ae6:	48 85 c0             	test   %rax,%rax
+  800ae9:	79 1d                	jns    800b08 <vprintfmt+0x3ac>
+			{
+				putch('-', putdat);
+  800aeb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800aef:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800af3:	48 89 c6             	mov    %rax,%rsi
+  800af6:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800afb:	ff d2                	call   *%rdx
+				num = -(long long)num;
+  800afd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b01:	48 f7 d8             	neg    %rax
+  800b04:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			}
+			base = 10;
+  800b08:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800b0f:	e9 d2 00 00 00       	jmp    800be6 <vprintfmt+0x48a>
+
+		// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800b14:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b18:	be 03 00 00 00       	mov    $0x3,%esi
+  800b1d:	48 89 c7             	mov    %rax,%rdi
+  800b20:	48 b8 4e 05 80 00 00 	movabs $0x80054e,%rax
+  800b27:	00 00 00 
+  800b2a:	ff d0                	call   *%rax
+  800b2c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 10;
+  800b30:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800b37:	e9 aa 00 00 00       	jmp    800be6 <vprintfmt+0x48a>
+		// (unsigned) octal
+		case 'o':
+			// Gets the variable argument with type integer from the point which was processed last by va_arg
+			// calls getuint which returns a long long value, which then calls printnum which prints based on
+			// base value.
+			num = getuint(&aq, 3);
+  800b3c:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b40:	be 03 00 00 00       	mov    $0x3,%esi
+  800b45:	48 89 c7             	mov    %rax,%rdi
+  800b48:	48 b8 4e 05 80 00 00 	movabs $0x80054e,%rax
+  800b4f:	00 00 00 
+  800b52:	ff d0                	call   *%rax
+  800b54:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 8;
+  800b58:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+			goto number;
+  800b5f:	e9 82 00 00 00       	jmp    800be6 <vprintfmt+0x48a>
+
+		// pointer
+		case 'p':
+			putch('0', putdat);
+  800b64:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b68:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b6c:	48 89 c6             	mov    %rax,%rsi
+  800b6f:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b74:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800b76:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b7a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b7e:	48 89 c6             	mov    %rax,%rsi
+  800b81:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b86:	ff d2                	call   *%rdx
+			num = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800b88:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b8b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b8e:	77 17                	ja     800ba7 <vprintfmt+0x44b>
+  800b90:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b94:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b97:	89 d2                	mov    %edx,%edx
+  800b99:	48 01 d0             	add    %rdx,%rax
+  800b9c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b9f:	83 c2 08             	add    $0x8,%edx
+  800ba2:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800ba5:	eb 0c                	jmp    800bb3 <vprintfmt+0x457>
+  800ba7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800bab:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800baf:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800bb3:	48 8b 00             	mov    (%rax),%rax
+  800bb6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800bba:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+			goto number;
+  800bc1:	eb 23                	jmp    800be6 <vprintfmt+0x48a>
+
+		// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800bc3:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800bc7:	be 03 00 00 00       	mov    $0x3,%esi
+  800bcc:	48 89 c7             	mov    %rax,%rdi
+  800bcf:	48 b8 4e 05 80 00 00 	movabs $0x80054e,%rax
+  800bd6:	00 00 00 
+  800bd9:	ff d0                	call   *%rax
+  800bdb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800bdf:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800be6:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800beb:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800bee:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800bf1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bf5:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800bf9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800bfd:	45 89 c1             	mov    %r8d,%r9d
+  800c00:	41 89 f8             	mov    %edi,%r8d
+  800c03:	48 89 c7             	mov    %rax,%rdi
+  800c06:	48 b8 96 04 80 00 00 	movabs $0x800496,%rax
+  800c0d:	00 00 00 
+  800c10:	ff d0                	call   *%rax
+			break;
+  800c12:	eb 3f                	jmp    800c53 <vprintfmt+0x4f7>
+
+		// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800c14:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c18:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c1c:	48 89 c6             	mov    %rax,%rsi
+  800c1f:	89 df                	mov    %ebx,%edi
+  800c21:	ff d2                	call   *%rdx
+			break;
+  800c23:	eb 2e                	jmp    800c53 <vprintfmt+0x4f7>
+
+		// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800c25:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c29:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c2d:	48 89 c6             	mov    %rax,%rsi
+  800c30:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c35:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800c37:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800c3c:	eb 05                	jmp    800c43 <vprintfmt+0x4e7>
+  800c3e:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800c43:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800c47:	48 83 e8 01          	sub    $0x1,%rax
+  800c4b:	0f b6 00             	movzbl (%rax),%eax
+  800c4e:	3c 25                	cmp    $0x25,%al
+  800c50:	75 ec                	jne    800c3e <vprintfmt+0x4e2>
+				/* do nothing */;
+			break;
+  800c52:	90                   	nop
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800c53:	e9 56 fb ff ff       	jmp    8007ae <vprintfmt+0x52>
+				return;
+  800c58:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800c59:	48 83 c4 60          	add    $0x60,%rsp
+  800c5d:	5b                   	pop    %rbx
+  800c5e:	41 5c                	pop    %r12
+  800c60:	5d                   	pop    %rbp
+  800c61:	c3                   	ret
+
+0000000000800c62 <printfmt>:
+
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...)
+{
+  800c62:	55                   	push   %rbp
+  800c63:	48 89 e5             	mov    %rsp,%rbp
+  800c66:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800c6d:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800c74:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800c7b:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800c82:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800c89:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800c90:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800c97:	84 c0                	test   %al,%al
+  800c99:	74 20                	je     800cbb <printfmt+0x59>
+  800c9b:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800c9f:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800ca3:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800ca7:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800cab:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800caf:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800cb3:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800cb7:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800cbb:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800cc2:	00 00 00 
+  800cc5:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800ccc:	00 00 00 
+  800ccf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cd3:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800cda:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800ce1:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800ce8:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800cef:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800cf6:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800cfd:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800d04:	48 89 c7             	mov    %rax,%rdi
+  800d07:	48 b8 5c 07 80 00 00 	movabs $0x80075c,%rax
+  800d0e:	00 00 00 
+  800d11:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  800d13:	90                   	nop
+  800d14:	c9                   	leave
+  800d15:	c3                   	ret
+
+0000000000800d16 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800d16:	55                   	push   %rbp
+  800d17:	48 89 e5             	mov    %rsp,%rbp
+  800d1a:	48 83 ec 10          	sub    $0x10,%rsp
+  800d1e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800d21:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  800d25:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d29:	8b 40 10             	mov    0x10(%rax),%eax
+  800d2c:	8d 50 01             	lea    0x1(%rax),%edx
+  800d2f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d33:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  800d36:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d3a:	48 8b 10             	mov    (%rax),%rdx
+  800d3d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d41:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800d45:	48 39 c2             	cmp    %rax,%rdx
+  800d48:	73 17                	jae    800d61 <sprintputch+0x4b>
+		*b->buf++ = ch;
+  800d4a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d4e:	48 8b 00             	mov    (%rax),%rax
+  800d51:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800d55:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800d59:	48 89 0a             	mov    %rcx,(%rdx)
+  800d5c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800d5f:	88 10                	mov    %dl,(%rax)
+}
+  800d61:	90                   	nop
+  800d62:	c9                   	leave
+  800d63:	c3                   	ret
+
+0000000000800d64 <vsnprintf>:
+
+int vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800d64:	55                   	push   %rbp
+  800d65:	48 89 e5             	mov    %rsp,%rbp
+  800d68:	48 83 ec 50          	sub    $0x50,%rsp
+  800d6c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  800d70:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  800d73:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  800d77:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+	va_list aq;
+	va_copy(aq, ap);
+  800d7b:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800d7f:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800d83:	48 8b 06             	mov    (%rsi),%rax
+  800d86:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800d8a:	48 89 01             	mov    %rax,(%rcx)
+  800d8d:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d91:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800d95:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	struct sprintbuf b = {buf, buf + n - 1, 0};
+  800d99:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d9d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800da1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  800da4:	48 98                	cltq
+  800da6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800daa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800dae:	48 01 d0             	add    %rdx,%rax
+  800db1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  800db5:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+
+	if (buf == NULL || n < 1)
+  800dbc:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800dc1:	74 06                	je     800dc9 <vsnprintf+0x65>
+  800dc3:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800dc7:	7f 07                	jg     800dd0 <vsnprintf+0x6c>
+		return -E_INVAL;
+  800dc9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800dce:	eb 32                	jmp    800e02 <vsnprintf+0x9e>
+
+	// print the string to the buffer
+	vprintfmt((void *)sprintputch, &b, fmt, aq);
+  800dd0:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800dd4:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  800dd8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ddc:	48 89 c6             	mov    %rax,%rsi
+  800ddf:	48 b8 16 0d 80 00 00 	movabs $0x800d16,%rax
+  800de6:	00 00 00 
+  800de9:	48 89 c7             	mov    %rax,%rdi
+  800dec:	48 b8 5c 07 80 00 00 	movabs $0x80075c,%rax
+  800df3:	00 00 00 
+  800df6:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  800df8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800dfc:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800dff:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  800e02:	c9                   	leave
+  800e03:	c3                   	ret
+
+0000000000800e04 <snprintf>:
+
+int snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800e04:	55                   	push   %rbp
+  800e05:	48 89 e5             	mov    %rsp,%rbp
+  800e08:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800e0f:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800e16:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800e1c:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800e23:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800e2a:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800e31:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800e38:	84 c0                	test   %al,%al
+  800e3a:	74 20                	je     800e5c <snprintf+0x58>
+  800e3c:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800e40:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800e44:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800e48:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800e4c:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800e50:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800e54:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800e58:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  800e5c:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800e63:	00 00 00 
+  800e66:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800e6d:	00 00 00 
+  800e70:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e74:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800e7b:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800e82:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq, ap);
+  800e89:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800e90:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800e97:	48 8b 06             	mov    (%rsi),%rax
+  800e9a:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800e9e:	48 89 01             	mov    %rax,(%rcx)
+  800ea1:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800ea5:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800ea9:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  800ead:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800eb4:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  800ebb:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  800ec1:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800ec8:	48 89 c7             	mov    %rax,%rdi
+  800ecb:	48 b8 64 0d 80 00 00 	movabs $0x800d64,%rax
+  800ed2:	00 00 00 
+  800ed5:	ff d0                	call   *%rax
+  800ed7:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  800edd:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800ee3:	c9                   	leave
+  800ee4:	c3                   	ret
+
+0000000000800ee5 <cpuid>:
+#define read_rip(var) __asm __volatile("leaq (%%rip), %0" : "=r" (var)::"cc","memory")
+
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800ee5:	55                   	push   %rbp
+  800ee6:	48 89 e5             	mov    %rsp,%rbp
+  800ee9:	53                   	push   %rbx
+  800eea:	48 83 ec 38          	sub    $0x38,%rsp
+  800eee:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800ef1:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800ef5:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800ef9:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800efd:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid" 
+  800f01:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800f04:	0f a2                	cpuid
+  800f06:	89 de                	mov    %ebx,%esi
+  800f08:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800f0b:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800f0e:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800f11:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info));
+	if (eaxp)
+  800f14:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800f19:	74 09                	je     800f24 <cpuid+0x3f>
+		*eaxp = eax;
+  800f1b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f1f:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800f22:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  800f24:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800f29:	74 09                	je     800f34 <cpuid+0x4f>
+		*ebxp = ebx;
+  800f2b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f2f:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800f32:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  800f34:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800f39:	74 09                	je     800f44 <cpuid+0x5f>
+		*ecxp = ecx;
+  800f3b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f3f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800f42:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  800f44:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800f49:	74 09                	je     800f54 <cpuid+0x6f>
+		*edxp = edx;
+  800f4b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800f4f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800f52:	89 10                	mov    %edx,(%rax)
+}
+  800f54:	90                   	nop
+  800f55:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f59:	c9                   	leave
+  800f5a:	c3                   	ret
+
+0000000000800f5b <cpuid_count>:
+
+// 带子功能号(%ecx = count)的 cpuid，用于 leaf 4/7/0xB/0xD 等
+static __inline void
+cpuid_count(uint32_t info, uint32_t count, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800f5b:	55                   	push   %rbp
+  800f5c:	48 89 e5             	mov    %rsp,%rbp
+  800f5f:	53                   	push   %rbx
+  800f60:	48 83 ec 38          	sub    $0x38,%rsp
+  800f64:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800f67:	89 75 e0             	mov    %esi,-0x20(%rbp)
+  800f6a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800f6e:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  800f72:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+  800f76:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800f7a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800f7d:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800f80:	89 d1                	mov    %edx,%ecx
+  800f82:	0f a2                	cpuid
+  800f84:	89 de                	mov    %ebx,%esi
+  800f86:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800f89:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800f8c:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800f8f:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info), "c" (count));
+	if (eaxp)
+  800f92:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800f97:	74 09                	je     800fa2 <cpuid_count+0x47>
+		*eaxp = eax;
+  800f99:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f9d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800fa0:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  800fa2:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800fa7:	74 09                	je     800fb2 <cpuid_count+0x57>
+		*ebxp = ebx;
+  800fa9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800fad:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800fb0:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  800fb2:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800fb7:	74 09                	je     800fc2 <cpuid_count+0x67>
+		*ecxp = ecx;
+  800fb9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800fbd:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800fc0:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  800fc2:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800fc7:	74 09                	je     800fd2 <cpuid_count+0x77>
+		*edxp = edx;
+  800fc9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800fcd:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800fd0:	89 10                	mov    %edx,(%rax)
+}
+  800fd2:	90                   	nop
+  800fd3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fd7:	c9                   	leave
+  800fd8:	c3                   	ret
+
+0000000000800fd9 <strlen>:
+// 在真正的硬件上会有一定程度的优化, 但在 Bochs 上会有更大的优化效果
+// 用这种方法, Primespipe 的运行速度快了3倍
+#define ASM 1
+
+int strlen(const char *s)
+{
+  800fd9:	55                   	push   %rbp
+  800fda:	48 89 e5             	mov    %rsp,%rbp
+  800fdd:	48 83 ec 18          	sub    $0x18,%rsp
+  800fe1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800fe5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800fec:	eb 09                	jmp    800ff7 <strlen+0x1e>
+		n++;
+  800fee:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  800ff2:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800ff7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ffb:	0f b6 00             	movzbl (%rax),%eax
+  800ffe:	84 c0                	test   %al,%al
+  801000:	75 ec                	jne    800fee <strlen+0x15>
+	return n;
+  801002:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801005:	c9                   	leave
+  801006:	c3                   	ret
+
+0000000000801007 <strnlen>:
+
+int strnlen(const char *s, size_t size)
+{
+  801007:	55                   	push   %rbp
+  801008:	48 89 e5             	mov    %rsp,%rbp
+  80100b:	48 83 ec 20          	sub    $0x20,%rsp
+  80100f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801013:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801017:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80101e:	eb 0e                	jmp    80102e <strnlen+0x27>
+		n++;
+  801020:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801024:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801029:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  80102e:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801033:	74 0b                	je     801040 <strnlen+0x39>
+  801035:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801039:	0f b6 00             	movzbl (%rax),%eax
+  80103c:	84 c0                	test   %al,%al
+  80103e:	75 e0                	jne    801020 <strnlen+0x19>
+	return n;
+  801040:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801043:	c9                   	leave
+  801044:	c3                   	ret
+
+0000000000801045 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801045:	55                   	push   %rbp
+  801046:	48 89 e5             	mov    %rsp,%rbp
+  801049:	48 83 ec 20          	sub    $0x20,%rsp
+  80104d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801051:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801055:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801059:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  80105d:	90                   	nop
+  80105e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801062:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801066:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80106a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80106e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801072:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801076:	0f b6 12             	movzbl (%rdx),%edx
+  801079:	88 10                	mov    %dl,(%rax)
+  80107b:	0f b6 00             	movzbl (%rax),%eax
+  80107e:	84 c0                	test   %al,%al
+  801080:	75 dc                	jne    80105e <strcpy+0x19>
+		/* do nothing */;
+	return ret;
+  801082:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801086:	c9                   	leave
+  801087:	c3                   	ret
+
+0000000000801088 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801088:	55                   	push   %rbp
+  801089:	48 89 e5             	mov    %rsp,%rbp
+  80108c:	48 83 ec 20          	sub    $0x20,%rsp
+  801090:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801094:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int len = strlen(dst);
+  801098:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80109c:	48 89 c7             	mov    %rax,%rdi
+  80109f:	48 b8 d9 0f 80 00 00 	movabs $0x800fd9,%rax
+  8010a6:	00 00 00 
+  8010a9:	ff d0                	call   *%rax
+  8010ab:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	strcpy(dst + len, src);
+  8010ae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8010b1:	48 63 d0             	movslq %eax,%rdx
+  8010b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010b8:	48 01 c2             	add    %rax,%rdx
+  8010bb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8010bf:	48 89 c6             	mov    %rax,%rsi
+  8010c2:	48 89 d7             	mov    %rdx,%rdi
+  8010c5:	48 b8 45 10 80 00 00 	movabs $0x801045,%rax
+  8010cc:	00 00 00 
+  8010cf:	ff d0                	call   *%rax
+	return dst;
+  8010d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8010d5:	c9                   	leave
+  8010d6:	c3                   	ret
+
+00000000008010d7 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8010d7:	55                   	push   %rbp
+  8010d8:	48 89 e5             	mov    %rsp,%rbp
+  8010db:	48 83 ec 28          	sub    $0x28,%rsp
+  8010df:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8010e3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8010e7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  8010eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010ef:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++)
+  8010f3:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8010fa:	00 
+  8010fb:	eb 2a                	jmp    801127 <strncpy+0x50>
+	{
+		*dst++ = *src;
+  8010fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801101:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801105:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801109:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80110d:	0f b6 12             	movzbl (%rdx),%edx
+  801110:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801112:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801116:	0f b6 00             	movzbl (%rax),%eax
+  801119:	84 c0                	test   %al,%al
+  80111b:	74 05                	je     801122 <strncpy+0x4b>
+			src++;
+  80111d:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++)
+  801122:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801127:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80112b:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80112f:	72 cc                	jb     8010fd <strncpy+0x26>
+	}
+	return ret;
+  801131:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801135:	c9                   	leave
+  801136:	c3                   	ret
+
+0000000000801137 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801137:	55                   	push   %rbp
+  801138:	48 89 e5             	mov    %rsp,%rbp
+  80113b:	48 83 ec 28          	sub    $0x28,%rsp
+  80113f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801143:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801147:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  80114b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80114f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0)
+  801153:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801158:	74 3d                	je     801197 <strlcpy+0x60>
+	{
+		while (--size > 0 && *src != '\0')
+  80115a:	eb 1d                	jmp    801179 <strlcpy+0x42>
+			*dst++ = *src++;
+  80115c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801160:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801164:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801168:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80116c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801170:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801174:	0f b6 12             	movzbl (%rdx),%edx
+  801177:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801179:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80117e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801183:	74 0b                	je     801190 <strlcpy+0x59>
+  801185:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801189:	0f b6 00             	movzbl (%rax),%eax
+  80118c:	84 c0                	test   %al,%al
+  80118e:	75 cc                	jne    80115c <strlcpy+0x25>
+		*dst = '\0';
+  801190:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801194:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801197:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80119b:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80119f:	c9                   	leave
+  8011a0:	c3                   	ret
+
+00000000008011a1 <strcmp>:
+
+int strcmp(const char *p, const char *q)
+{
+  8011a1:	55                   	push   %rbp
+  8011a2:	48 89 e5             	mov    %rsp,%rbp
+  8011a5:	48 83 ec 10          	sub    $0x10,%rsp
+  8011a9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8011ad:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8011b1:	eb 0a                	jmp    8011bd <strcmp+0x1c>
+		p++, q++;
+  8011b3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8011b8:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8011bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011c1:	0f b6 00             	movzbl (%rax),%eax
+  8011c4:	84 c0                	test   %al,%al
+  8011c6:	74 12                	je     8011da <strcmp+0x39>
+  8011c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011cc:	0f b6 10             	movzbl (%rax),%edx
+  8011cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011d3:	0f b6 00             	movzbl (%rax),%eax
+  8011d6:	38 c2                	cmp    %al,%dl
+  8011d8:	74 d9                	je     8011b3 <strcmp+0x12>
+	return (int)((unsigned char)*p - (unsigned char)*q);
+  8011da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011de:	0f b6 00             	movzbl (%rax),%eax
+  8011e1:	0f b6 d0             	movzbl %al,%edx
+  8011e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011e8:	0f b6 00             	movzbl (%rax),%eax
+  8011eb:	0f b6 c0             	movzbl %al,%eax
+  8011ee:	29 c2                	sub    %eax,%edx
+  8011f0:	89 d0                	mov    %edx,%eax
+}
+  8011f2:	c9                   	leave
+  8011f3:	c3                   	ret
+
+00000000008011f4 <strncmp>:
+
+int strncmp(const char *p, const char *q, size_t n)
+{
+  8011f4:	55                   	push   %rbp
+  8011f5:	48 89 e5             	mov    %rsp,%rbp
+  8011f8:	48 83 ec 18          	sub    $0x18,%rsp
+  8011fc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801200:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801204:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801208:	eb 0f                	jmp    801219 <strncmp+0x25>
+		n--, p++, q++;
+  80120a:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80120f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801214:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801219:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80121e:	74 1d                	je     80123d <strncmp+0x49>
+  801220:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801224:	0f b6 00             	movzbl (%rax),%eax
+  801227:	84 c0                	test   %al,%al
+  801229:	74 12                	je     80123d <strncmp+0x49>
+  80122b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80122f:	0f b6 10             	movzbl (%rax),%edx
+  801232:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801236:	0f b6 00             	movzbl (%rax),%eax
+  801239:	38 c2                	cmp    %al,%dl
+  80123b:	74 cd                	je     80120a <strncmp+0x16>
+	if (n == 0)
+  80123d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801242:	75 07                	jne    80124b <strncmp+0x57>
+		return 0;
+  801244:	ba 00 00 00 00       	mov    $0x0,%edx
+  801249:	eb 16                	jmp    801261 <strncmp+0x6d>
+	else
+		return (int)((unsigned char)*p - (unsigned char)*q);
+  80124b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80124f:	0f b6 00             	movzbl (%rax),%eax
+  801252:	0f b6 d0             	movzbl %al,%edx
+  801255:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801259:	0f b6 00             	movzbl (%rax),%eax
+  80125c:	0f b6 c0             	movzbl %al,%eax
+  80125f:	29 c2                	sub    %eax,%edx
+}
+  801261:	89 d0                	mov    %edx,%eax
+  801263:	c9                   	leave
+  801264:	c3                   	ret
+
+0000000000801265 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801265:	55                   	push   %rbp
+  801266:	48 89 e5             	mov    %rsp,%rbp
+  801269:	48 83 ec 10          	sub    $0x10,%rsp
+  80126d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801271:	89 f0                	mov    %esi,%eax
+  801273:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801276:	eb 17                	jmp    80128f <strchr+0x2a>
+		if (*s == c)
+  801278:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80127c:	0f b6 00             	movzbl (%rax),%eax
+  80127f:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801282:	75 06                	jne    80128a <strchr+0x25>
+			return (char *)s;
+  801284:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801288:	eb 15                	jmp    80129f <strchr+0x3a>
+	for (; *s; s++)
+  80128a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80128f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801293:	0f b6 00             	movzbl (%rax),%eax
+  801296:	84 c0                	test   %al,%al
+  801298:	75 de                	jne    801278 <strchr+0x13>
+	return 0;
+  80129a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80129f:	c9                   	leave
+  8012a0:	c3                   	ret
+
+00000000008012a1 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8012a1:	55                   	push   %rbp
+  8012a2:	48 89 e5             	mov    %rsp,%rbp
+  8012a5:	48 83 ec 10          	sub    $0x10,%rsp
+  8012a9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8012ad:	89 f0                	mov    %esi,%eax
+  8012af:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8012b2:	eb 11                	jmp    8012c5 <strfind+0x24>
+		if (*s == c)
+  8012b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012b8:	0f b6 00             	movzbl (%rax),%eax
+  8012bb:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8012be:	74 12                	je     8012d2 <strfind+0x31>
+	for (; *s; s++)
+  8012c0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8012c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012c9:	0f b6 00             	movzbl (%rax),%eax
+  8012cc:	84 c0                	test   %al,%al
+  8012ce:	75 e4                	jne    8012b4 <strfind+0x13>
+  8012d0:	eb 01                	jmp    8012d3 <strfind+0x32>
+			break;
+  8012d2:	90                   	nop
+	return (char *)s;
+  8012d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8012d7:	c9                   	leave
+  8012d8:	c3                   	ret
+
+00000000008012d9 <mem_init>:
+};
+
+static int mem_features;
+
+void mem_init(void)
+{
+  8012d9:	55                   	push   %rbp
+  8012da:	48 89 e5             	mov    %rsp,%rbp
+  8012dd:	48 83 ec 10          	sub    $0x10,%rsp
+	uint32_t max, ebx, edx;
+
+	mem_features = 0;
+  8012e1:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  8012e8:	00 00 00 
+  8012eb:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	cpuid(0, &max, NULL, NULL, NULL);
+  8012f1:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+  8012f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801300:	ba 00 00 00 00       	mov    $0x0,%edx
+  801305:	48 89 c6             	mov    %rax,%rsi
+  801308:	bf 00 00 00 00       	mov    $0x0,%edi
+  80130d:	48 b8 e5 0e 80 00 00 	movabs $0x800ee5,%rax
+  801314:	00 00 00 
+  801317:	ff d0                	call   *%rax
+	cpuid(1, NULL, NULL, NULL, &edx);
+  801319:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  80131d:	49 89 c0             	mov    %rax,%r8
+  801320:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801325:	ba 00 00 00 00       	mov    $0x0,%edx
+  80132a:	be 00 00 00 00       	mov    $0x0,%esi
+  80132f:	bf 01 00 00 00       	mov    $0x1,%edi
+  801334:	48 b8 e5 0e 80 00 00 	movabs $0x800ee5,%rax
+  80133b:	00 00 00 
+  80133e:	ff d0                	call   *%rax
+	if (edx & (1 << 26))
+  801340:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801343:	25 00 00 00 04       	and    $0x4000000,%eax
+  801348:	85 c0                	test   %eax,%eax
+  80134a:	74 1d                	je     801369 <mem_init+0x90>
+		mem_features |= MEM_F_NT;
+  80134c:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  801353:	00 00 00 
+  801356:	8b 00                	mov    (%rax),%eax
+  801358:	83 c8 02             	or     $0x2,%eax
+  80135b:	89 c2                	mov    %eax,%edx
+  80135d:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  801364:	00 00 00 
+  801367:	89 10                	mov    %edx,(%rax)
+	if (max >= 7)
+  801369:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80136c:	83 f8 06             	cmp    $0x6,%eax
+  80136f:	76 57                	jbe    8013c8 <mem_init+0xef>
+	{
+		cpuid_count(7, 0, NULL, &ebx, NULL, NULL);
+  801371:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801375:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80137b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801381:	48 89 c1             	mov    %rax,%rcx
+  801384:	ba 00 00 00 00       	mov    $0x0,%edx
+  801389:	be 00 00 00 00       	mov    $0x0,%esi
+  80138e:	bf 07 00 00 00       	mov    $0x7,%edi
+  801393:	48 b8 5b 0f 80 00 00 	movabs $0x800f5b,%rax
+  80139a:	00 00 00 
+  80139d:	ff d0                	call   *%rax
+		if (ebx & (1 << 9))
+  80139f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8013a2:	25 00 02 00 00       	and    $0x200,%eax
+  8013a7:	85 c0                	test   %eax,%eax
+  8013a9:	74 1d                	je     8013c8 <mem_init+0xef>
+			mem_features |= MEM_F_ERMS;
+  8013ab:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  8013b2:	00 00 00 
+  8013b5:	8b 00                	mov    (%rax),%eax
+  8013b7:	83 c8 01             	or     $0x1,%eax
+  8013ba:	89 c2                	mov    %eax,%edx
+  8013bc:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  8013c3:	00 00 00 
+  8013c6:	89 10                	mov    %edx,(%rax)
+	}
+}
+  8013c8:	90                   	nop
+  8013c9:	c9                   	leave
+  8013ca:	c3                   	ret
+
+00000000008013cb <memset_nt>:
+
+// 非临时存储填充 n 字节(v 8 字节对齐，n 为 32 的倍数)
+static void
+memset_nt(void *v, uint64_t pattern, size_t n)
+{
+  8013cb:	55                   	push   %rbp
+  8013cc:	48 89 e5             	mov    %rsp,%rbp
+  8013cf:	48 83 ec 28          	sub    $0x28,%rsp
+  8013d3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013d7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8013db:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t *p = (uint64_t *)v;
+  8013df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013e3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint64_t *end = p + n / 8;
+  8013e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8013eb:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  8013ef:	48 89 c2             	mov    %rax,%rdx
+  8013f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013f6:	48 01 d0             	add    %rdx,%rax
+  8013f9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	for (; p < end; p += 4)
+  8013fd:	eb 20                	jmp    80141f <memset_nt+0x54>
+		asm volatile("movnti %1, 0(%0)\n\t"
+  8013ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801403:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801407:	48 0f c3 10          	movnti %rdx,(%rax)
+  80140b:	48 0f c3 50 08       	movnti %rdx,0x8(%rax)
+  801410:	48 0f c3 50 10       	movnti %rdx,0x10(%rax)
+  801415:	48 0f c3 50 18       	movnti %rdx,0x18(%rax)
+	for (; p < end; p += 4)
+  80141a:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  80141f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801423:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801427:	72 d6                	jb     8013ff <memset_nt+0x34>
+					 "movnti %1, 16(%0)\n\t"
+					 "movnti %1, 24(%0)"
+					 :
+					 : "r"(p), "r"(pattern)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  801429:	0f ae f8             	sfence
+}
+  80142c:	90                   	nop
+  80142d:	c9                   	leave
+  80142e:	c3                   	ret
+
+000000000080142f <memcpy_nt>:
+
+// 非临时存储复制 n 字节(dst/src 8 字节对齐且不重叠，n 为 32 的倍数)
+static void
+memcpy_nt(void *dst, const void *src, size_t n)
+{
+  80142f:	55                   	push   %rbp
+  801430:	48 89 e5             	mov    %rsp,%rbp
+  801433:	48 83 ec 58          	sub    $0x58,%rsp
+  801437:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80143b:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  80143f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	uint64_t *d = (uint64_t *)dst;
+  801443:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801447:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint64_t *s = (const uint64_t *)src;
+  80144b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80144f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	uint64_t *end = d + n / 8;
+  801453:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801457:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  80145b:	48 89 c2             	mov    %rax,%rdx
+  80145e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801462:	48 01 d0             	add    %rdx,%rax
+  801465:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint64_t t0, t1, t2, t3;
+
+	for (; d < end; d += 4, s += 4)
+  801469:	eb 44                	jmp    8014af <memcpy_nt+0x80>
+		asm volatile("movq 0(%4), %0\n\t"
+  80146b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80146f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801473:	4c 8b 00             	mov    (%rax),%r8
+  801476:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  80147a:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  80147e:	48 8b 48 18          	mov    0x18(%rax),%rcx
+  801482:	4c 0f c3 02          	movnti %r8,(%rdx)
+  801486:	48 0f c3 7a 08       	movnti %rdi,0x8(%rdx)
+  80148b:	48 0f c3 72 10       	movnti %rsi,0x10(%rdx)
+  801490:	48 0f c3 4a 18       	movnti %rcx,0x18(%rdx)
+  801495:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  801499:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80149d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8014a1:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+	for (; d < end; d += 4, s += 4)
+  8014a5:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  8014aa:	48 83 45 f0 20       	addq   $0x20,-0x10(%rbp)
+  8014af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014b3:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  8014b7:	72 b2                	jb     80146b <memcpy_nt+0x3c>
+					 "movnti %2, 16(%5)\n\t"
+					 "movnti %3, 24(%5)"
+					 : "=&r"(t0), "=&r"(t1), "=&r"(t2), "=&r"(t3)
+					 : "r"(s), "r"(d)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  8014b9:	0f ae f8             	sfence
+}
+  8014bc:	90                   	nop
+  8014bd:	c9                   	leave
+  8014be:	c3                   	ret
+
+00000000008014bf <memcpy_fwd>:
+
+// 正向复制(dst 在 src 之前或两者不重叠)
+static void
+memcpy_fwd(void *dst, const void *src, size_t n)
+{
+  8014bf:	55                   	push   %rbp
+  8014c0:	48 89 e5             	mov    %rsp,%rbp
+  8014c3:	48 83 ec 18          	sub    $0x18,%rsp
+  8014c7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8014cb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8014cf:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  8014d3:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  8014da:	00 00 00 
+  8014dd:	8b 00                	mov    (%rax),%eax
+  8014df:	83 e0 02             	and    $0x2,%eax
+  8014e2:	85 c0                	test   %eax,%eax
+  8014e4:	74 66                	je     80154c <memcpy_fwd+0x8d>
+  8014e6:	48 81 7d e8 ff 0f 00 	cmpq   $0xfff,-0x18(%rbp)
+  8014ed:	00 
+  8014ee:	76 5c                	jbe    80154c <memcpy_fwd+0x8d>
+  8014f0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8014f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014f8:	48 09 d0             	or     %rdx,%rax
+  8014fb:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  8014ff:	83 e0 1f             	and    $0x1f,%eax
+  801502:	48 85 c0             	test   %rax,%rax
+  801505:	75 45                	jne    80154c <memcpy_fwd+0x8d>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  801507:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80150b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80150f:	48 01 d0             	add    %rdx,%rax
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  801512:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801516:	73 11                	jae    801529 <memcpy_fwd+0x6a>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  801518:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80151c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801520:	48 01 d0             	add    %rdx,%rax
+  801523:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801527:	72 23                	jb     80154c <memcpy_fwd+0x8d>
+		memcpy_nt(dst, src, n);
+  801529:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80152d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801531:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801535:	48 89 ce             	mov    %rcx,%rsi
+  801538:	48 89 c7             	mov    %rax,%rdi
+  80153b:	48 b8 2f 14 80 00 00 	movabs $0x80142f,%rax
+  801542:	00 00 00 
+  801545:	ff d0                	call   *%rax
+  801547:	e9 81 00 00 00       	jmp    8015cd <memcpy_fwd+0x10e>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  80154c:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  801553:	00 00 00 
+  801556:	8b 00                	mov    (%rax),%eax
+  801558:	83 e0 01             	and    $0x1,%eax
+  80155b:	85 c0                	test   %eax,%eax
+  80155d:	74 21                	je     801580 <memcpy_fwd+0xc1>
+  80155f:	48 81 7d e8 ff 00 00 	cmpq   $0xff,-0x18(%rbp)
+  801566:	00 
+  801567:	76 17                	jbe    801580 <memcpy_fwd+0xc1>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  801569:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80156d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801571:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801575:	48 89 c7             	mov    %rax,%rdi
+  801578:	48 89 d6             	mov    %rdx,%rsi
+  80157b:	fc                   	cld
+  80157c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80157e:	eb 4d                	jmp    8015cd <memcpy_fwd+0x10e>
+					 : "cc", "memory");
+	else if ((((uint64_t)dst | (uint64_t)src | n) & 7) == 0)
+  801580:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801584:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801588:	48 09 d0             	or     %rdx,%rax
+  80158b:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  80158f:	83 e0 07             	and    $0x7,%eax
+  801592:	48 85 c0             	test   %rax,%rax
+  801595:	75 1f                	jne    8015b6 <memcpy_fwd+0xf7>
+		asm volatile("cld; rep movsq\n" ::"D"(dst), "S"(src), "c"(n / 8)
+  801597:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80159b:	48 c1 e8 03          	shr    $0x3,%rax
+  80159f:	48 89 c1             	mov    %rax,%rcx
+  8015a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015a6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8015aa:	48 89 c7             	mov    %rax,%rdi
+  8015ad:	48 89 d6             	mov    %rdx,%rsi
+  8015b0:	fc                   	cld
+  8015b1:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+					 : "cc", "memory");
+}
+  8015b4:	eb 17                	jmp    8015cd <memcpy_fwd+0x10e>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  8015b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015ba:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8015be:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8015c2:	48 89 c7             	mov    %rax,%rdi
+  8015c5:	48 89 d6             	mov    %rdx,%rsi
+  8015c8:	fc                   	cld
+  8015c9:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+  8015cb:	eb 00                	jmp    8015cd <memcpy_fwd+0x10e>
+  8015cd:	90                   	nop
+  8015ce:	c9                   	leave
+  8015cf:	c3                   	ret
+
+00000000008015d0 <memset>:
+
+void *
+memset(void *v, int c, size_t n)
+{
+  8015d0:	55                   	push   %rbp
+  8015d1:	48 89 e5             	mov    %rsp,%rbp
+  8015d4:	48 83 ec 28          	sub    $0x28,%rsp
+  8015d8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015dc:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8015df:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t pattern;
+
+	if (n == 0)
+  8015e3:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8015e8:	75 09                	jne    8015f3 <memset+0x23>
+		return v;
+  8015ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015ee:	e9 dc 00 00 00       	jmp    8016cf <memset+0xff>
+	c &= 0xFF;
+  8015f3:	81 65 e4 ff 00 00 00 	andl   $0xff,-0x1c(%rbp)
+	pattern = (uint64_t)c * 0x0101010101010101UL;
+  8015fa:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8015fd:	48 98                	cltq
+  8015ff:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801606:	01 01 01 
+  801609:	48 0f af c2          	imul   %rdx,%rax
+  80160d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)v | n) & 31) == 0)
+  801611:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  801618:	00 00 00 
+  80161b:	8b 00                	mov    (%rax),%eax
+  80161d:	83 e0 02             	and    $0x2,%eax
+  801620:	85 c0                	test   %eax,%eax
+  801622:	74 3a                	je     80165e <memset+0x8e>
+  801624:	48 81 7d d8 ff 0f 00 	cmpq   $0xfff,-0x28(%rbp)
+  80162b:	00 
+  80162c:	76 30                	jbe    80165e <memset+0x8e>
+  80162e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801632:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  801636:	83 e0 1f             	and    $0x1f,%eax
+  801639:	48 85 c0             	test   %rax,%rax
+  80163c:	75 20                	jne    80165e <memset+0x8e>
+		memset_nt(v, pattern, n);
+  80163e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801642:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801646:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80164a:	48 89 ce             	mov    %rcx,%rsi
+  80164d:	48 89 c7             	mov    %rax,%rdi
+  801650:	48 b8 cb 13 80 00 00 	movabs $0x8013cb,%rax
+  801657:	00 00 00 
+  80165a:	ff d0                	call   *%rax
+  80165c:	eb 6d                	jmp    8016cb <memset+0xfb>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  80165e:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  801665:	00 00 00 
+  801668:	8b 00                	mov    (%rax),%eax
+  80166a:	83 e0 01             	and    $0x1,%eax
+  80166d:	85 c0                	test   %eax,%eax
+  80166f:	74 1d                	je     80168e <memset+0xbe>
+  801671:	48 81 7d d8 ff 00 00 	cmpq   $0xff,-0x28(%rbp)
+  801678:	00 
+  801679:	76 13                	jbe    80168e <memset+0xbe>
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  80167b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80167f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801682:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801686:	48 89 d7             	mov    %rdx,%rdi
+  801689:	fc                   	cld
+  80168a:	f3 aa                	rep stos %al,%es:(%rdi)
+  80168c:	eb 3d                	jmp    8016cb <memset+0xfb>
+					 : "cc", "memory");
+	else if ((((uint64_t)v | n) & 7) == 0)
+  80168e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801692:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  801696:	83 e0 07             	and    $0x7,%eax
+  801699:	48 85 c0             	test   %rax,%rax
+  80169c:	75 1c                	jne    8016ba <memset+0xea>
+		asm volatile("cld; rep stosq\n" ::"D"(v), "a"(pattern), "c"(n / 8)
+  80169e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016a2:	48 c1 e8 03          	shr    $0x3,%rax
+  8016a6:	48 89 c1             	mov    %rax,%rcx
+  8016a9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8016ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016b1:	48 89 d7             	mov    %rdx,%rdi
+  8016b4:	fc                   	cld
+  8016b5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8016b8:	eb 11                	jmp    8016cb <memset+0xfb>
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  8016ba:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8016be:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8016c1:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8016c5:	48 89 d7             	mov    %rdx,%rdi
+  8016c8:	fc                   	cld
+  8016c9:	f3 aa                	rep stos %al,%es:(%rdi)
+					 : "cc", "memory");
+	return v;
+  8016cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8016cf:	c9                   	leave
+  8016d0:	c3                   	ret
+
+00000000008016d1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8016d1:	55                   	push   %rbp
+  8016d2:	48 89 e5             	mov    %rsp,%rbp
+  8016d5:	48 83 ec 28          	sub    $0x28,%rsp
+  8016d9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016dd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8016e1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  8016e5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016e9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8016ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016f1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d)
+  8016f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016f9:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8016fd:	73 7c                	jae    80177b <memmove+0xaa>
+  8016ff:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801703:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801707:	48 01 d0             	add    %rdx,%rax
+  80170a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80170e:	73 6b                	jae    80177b <memmove+0xaa>
+	{
+		// 重叠且 dst 在 src 之后，只能反向复制(ERMS 对反向 rep movsb 没有优化)
+		s += n;
+  801710:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801714:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801718:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80171c:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((((uint64_t)s | (uint64_t)d | n) & 7) == 0)
+  801720:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801724:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801728:	48 09 d0             	or     %rdx,%rax
+  80172b:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  80172f:	83 e0 07             	and    $0x7,%eax
+  801732:	48 85 c0             	test   %rax,%rax
+  801735:	75 24                	jne    80175b <memmove+0x8a>
+			asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801737:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80173b:	48 83 e8 08          	sub    $0x8,%rax
+  80173f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801743:	48 83 ea 08          	sub    $0x8,%rdx
+  801747:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80174b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80174f:	48 89 c7             	mov    %rax,%rdi
+  801752:	48 89 d6             	mov    %rdx,%rsi
+  801755:	fd                   	std
+  801756:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801759:	eb 1d                	jmp    801778 <memmove+0xa7>
+						 : "cc", "memory");
+		else
+			asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80175b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80175f:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801763:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801767:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+  80176b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80176f:	48 89 d7             	mov    %rdx,%rdi
+  801772:	48 89 c1             	mov    %rax,%rcx
+  801775:	fd                   	std
+  801776:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+						 : "cc", "memory");
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::
+  801778:	fc                   	cld
+  801779:	eb 25                	jmp    8017a0 <memmove+0xcf>
+						 : "cc");
+	}
+	else if (n)
+  80177b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801780:	74 1e                	je     8017a0 <memmove+0xcf>
+		memcpy_fwd(d, s, n);
+  801782:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801786:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80178a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80178e:	48 89 ce             	mov    %rcx,%rsi
+  801791:	48 89 c7             	mov    %rax,%rdi
+  801794:	48 b8 bf 14 80 00 00 	movabs $0x8014bf,%rax
+  80179b:	00 00 00 
+  80179e:	ff d0                	call   *%rax
+	return dst;
+  8017a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8017a4:	c9                   	leave
+  8017a5:	c3                   	ret
+
+00000000008017a6 <memcpy>:
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8017a6:	55                   	push   %rbp
+  8017a7:	48 89 e5             	mov    %rsp,%rbp
+  8017aa:	48 83 ec 18          	sub    $0x18,%rsp
+  8017ae:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017b2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8017b6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (n)
+  8017ba:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8017bf:	74 1e                	je     8017df <memcpy+0x39>
+		memcpy_fwd(dst, src, n);
+  8017c1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8017c5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8017c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017cd:	48 89 ce             	mov    %rcx,%rsi
+  8017d0:	48 89 c7             	mov    %rax,%rdi
+  8017d3:	48 b8 bf 14 80 00 00 	movabs $0x8014bf,%rax
+  8017da:	00 00 00 
+  8017dd:	ff d0                	call   *%rax
+	return dst;
+  8017df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8017e3:	c9                   	leave
+  8017e4:	c3                   	ret
+
+00000000008017e5 <memcmp>:
+{
+}
+#endif
+
+int memcmp(const void *v1, const void *v2, size_t n)
+{
+  8017e5:	55                   	push   %rbp
+  8017e6:	48 89 e5             	mov    %rsp,%rbp
+  8017e9:	48 83 ec 28          	sub    $0x28,%rsp
+  8017ed:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017f1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8017f5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *)v1;
+  8017f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017fd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *)v2;
+  801801:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801805:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0)
+  801809:	eb 34                	jmp    80183f <memcmp+0x5a>
+	{
+		if (*s1 != *s2)
+  80180b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80180f:	0f b6 10             	movzbl (%rax),%edx
+  801812:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801816:	0f b6 00             	movzbl (%rax),%eax
+  801819:	38 c2                	cmp    %al,%dl
+  80181b:	74 18                	je     801835 <memcmp+0x50>
+			return (int)*s1 - (int)*s2;
+  80181d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801821:	0f b6 00             	movzbl (%rax),%eax
+  801824:	0f b6 d0             	movzbl %al,%edx
+  801827:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80182b:	0f b6 00             	movzbl (%rax),%eax
+  80182e:	0f b6 c0             	movzbl %al,%eax
+  801831:	29 c2                	sub    %eax,%edx
+  801833:	eb 20                	jmp    801855 <memcmp+0x70>
+		s1++, s2++;
+  801835:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80183a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0)
+  80183f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801843:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801847:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80184b:	48 85 c0             	test   %rax,%rax
+  80184e:	75 bb                	jne    80180b <memcmp+0x26>
+	}
+
+	return 0;
+  801850:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801855:	89 d0                	mov    %edx,%eax
+  801857:	c9                   	leave
+  801858:	c3                   	ret
+
+0000000000801859 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801859:	55                   	push   %rbp
+  80185a:	48 89 e5             	mov    %rsp,%rbp
+  80185d:	48 83 ec 28          	sub    $0x28,%rsp
+  801861:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801865:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801868:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *)s + n;
+  80186c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801870:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801874:	48 01 d0             	add    %rdx,%rax
+  801877:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  80187b:	eb 13                	jmp    801890 <memfind+0x37>
+		if (*(const unsigned char *)s == (unsigned char)c)
+  80187d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801881:	0f b6 00             	movzbl (%rax),%eax
+  801884:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801887:	38 d0                	cmp    %dl,%al
+  801889:	74 11                	je     80189c <memfind+0x43>
+	for (; s < ends; s++)
+  80188b:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801890:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801894:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801898:	72 e3                	jb     80187d <memfind+0x24>
+  80189a:	eb 01                	jmp    80189d <memfind+0x44>
+			break;
+  80189c:	90                   	nop
+	return (void *)s;
+  80189d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8018a1:	c9                   	leave
+  8018a2:	c3                   	ret
+
+00000000008018a3 <strtol>:
+
+long strtol(const char *s, char **endptr, int base)
+{
+  8018a3:	55                   	push   %rbp
+  8018a4:	48 89 e5             	mov    %rsp,%rbp
+  8018a7:	48 83 ec 38          	sub    $0x38,%rsp
+  8018ab:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8018af:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8018b3:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  8018b6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  8018bd:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8018c4:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8018c5:	eb 05                	jmp    8018cc <strtol+0x29>
+		s++;
+  8018c7:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  8018cc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018d0:	0f b6 00             	movzbl (%rax),%eax
+  8018d3:	3c 20                	cmp    $0x20,%al
+  8018d5:	74 f0                	je     8018c7 <strtol+0x24>
+  8018d7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018db:	0f b6 00             	movzbl (%rax),%eax
+  8018de:	3c 09                	cmp    $0x9,%al
+  8018e0:	74 e5                	je     8018c7 <strtol+0x24>
+
+	// plus/minus sign
+	if (*s == '+')
+  8018e2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018e6:	0f b6 00             	movzbl (%rax),%eax
+  8018e9:	3c 2b                	cmp    $0x2b,%al
+  8018eb:	75 07                	jne    8018f4 <strtol+0x51>
+		s++;
+  8018ed:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8018f2:	eb 17                	jmp    80190b <strtol+0x68>
+	else if (*s == '-')
+  8018f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018f8:	0f b6 00             	movzbl (%rax),%eax
+  8018fb:	3c 2d                	cmp    $0x2d,%al
+  8018fd:	75 0c                	jne    80190b <strtol+0x68>
+		s++, neg = 1;
+  8018ff:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801904:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80190b:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80190f:	74 06                	je     801917 <strtol+0x74>
+  801911:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801915:	75 28                	jne    80193f <strtol+0x9c>
+  801917:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80191b:	0f b6 00             	movzbl (%rax),%eax
+  80191e:	3c 30                	cmp    $0x30,%al
+  801920:	75 1d                	jne    80193f <strtol+0x9c>
+  801922:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801926:	48 83 c0 01          	add    $0x1,%rax
+  80192a:	0f b6 00             	movzbl (%rax),%eax
+  80192d:	3c 78                	cmp    $0x78,%al
+  80192f:	75 0e                	jne    80193f <strtol+0x9c>
+		s += 2, base = 16;
+  801931:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801936:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  80193d:	eb 2c                	jmp    80196b <strtol+0xc8>
+	else if (base == 0 && s[0] == '0')
+  80193f:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801943:	75 19                	jne    80195e <strtol+0xbb>
+  801945:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801949:	0f b6 00             	movzbl (%rax),%eax
+  80194c:	3c 30                	cmp    $0x30,%al
+  80194e:	75 0e                	jne    80195e <strtol+0xbb>
+		s++, base = 8;
+  801950:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801955:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  80195c:	eb 0d                	jmp    80196b <strtol+0xc8>
+	else if (base == 0)
+  80195e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801962:	75 07                	jne    80196b <strtol+0xc8>
+		base = 10;
+  801964:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+	// digits
+	while (1)
+	{
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  80196b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80196f:	0f b6 00             	movzbl (%rax),%eax
+  801972:	3c 2f                	cmp    $0x2f,%al
+  801974:	7e 1d                	jle    801993 <strtol+0xf0>
+  801976:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80197a:	0f b6 00             	movzbl (%rax),%eax
+  80197d:	3c 39                	cmp    $0x39,%al
+  80197f:	7f 12                	jg     801993 <strtol+0xf0>
+			dig = *s - '0';
+  801981:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801985:	0f b6 00             	movzbl (%rax),%eax
+  801988:	0f be c0             	movsbl %al,%eax
+  80198b:	83 e8 30             	sub    $0x30,%eax
+  80198e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801991:	eb 4e                	jmp    8019e1 <strtol+0x13e>
+		else if (*s >= 'a' && *s <= 'z')
+  801993:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801997:	0f b6 00             	movzbl (%rax),%eax
+  80199a:	3c 60                	cmp    $0x60,%al
+  80199c:	7e 1d                	jle    8019bb <strtol+0x118>
+  80199e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019a2:	0f b6 00             	movzbl (%rax),%eax
+  8019a5:	3c 7a                	cmp    $0x7a,%al
+  8019a7:	7f 12                	jg     8019bb <strtol+0x118>
+			dig = *s - 'a' + 10;
+  8019a9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019ad:	0f b6 00             	movzbl (%rax),%eax
+  8019b0:	0f be c0             	movsbl %al,%eax
+  8019b3:	83 e8 57             	sub    $0x57,%eax
+  8019b6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8019b9:	eb 26                	jmp    8019e1 <strtol+0x13e>
+		else if (*s >= 'A' && *s <= 'Z')
+  8019bb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019bf:	0f b6 00             	movzbl (%rax),%eax
+  8019c2:	3c 40                	cmp    $0x40,%al
+  8019c4:	7e 47                	jle    801a0d <strtol+0x16a>
+  8019c6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019ca:	0f b6 00             	movzbl (%rax),%eax
+  8019cd:	3c 5a                	cmp    $0x5a,%al
+  8019cf:	7f 3c                	jg     801a0d <strtol+0x16a>
+			dig = *s - 'A' + 10;
+  8019d1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019d5:	0f b6 00             	movzbl (%rax),%eax
+  8019d8:	0f be c0             	movsbl %al,%eax
+  8019db:	83 e8 37             	sub    $0x37,%eax
+  8019de:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  8019e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8019e4:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  8019e7:	7d 23                	jge    801a0c <strtol+0x169>
+			break;
+		s++, val = (val * base) + dig;
+  8019e9:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8019ee:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8019f1:	48 98                	cltq
+  8019f3:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  8019f8:	48 89 c2             	mov    %rax,%rdx
+  8019fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8019fe:	48 98                	cltq
+  801a00:	48 01 d0             	add    %rdx,%rax
+  801a03:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+  801a07:	e9 5f ff ff ff       	jmp    80196b <strtol+0xc8>
+			break;
+  801a0c:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801a0d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801a12:	74 0b                	je     801a1f <strtol+0x17c>
+		*endptr = (char *)s;
+  801a14:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a18:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801a1c:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801a1f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801a23:	74 09                	je     801a2e <strtol+0x18b>
+  801a25:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a29:	48 f7 d8             	neg    %rax
+  801a2c:	eb 04                	jmp    801a32 <strtol+0x18f>
+  801a2e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801a32:	c9                   	leave
+  801a33:	c3                   	ret
+
+0000000000801a34 <strstr>:
+
+char *strstr(const char *in, const char *str)
+{
+  801a34:	55                   	push   %rbp
+  801a35:	48 89 e5             	mov    %rsp,%rbp
+  801a38:	48 83 ec 30          	sub    $0x30,%rsp
+  801a3c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801a40:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801a44:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a48:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a4c:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801a50:	0f b6 00             	movzbl (%rax),%eax
+  801a53:	88 45 ff             	mov    %al,-0x1(%rbp)
+	if (!c)
+  801a56:	80 7d ff 00          	cmpb   $0x0,-0x1(%rbp)
+  801a5a:	75 06                	jne    801a62 <strstr+0x2e>
+		return (char *)in; // Trivial empty string case
+  801a5c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a60:	eb 6b                	jmp    801acd <strstr+0x99>
+
+	len = strlen(str);
+  801a62:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a66:	48 89 c7             	mov    %rax,%rdi
+  801a69:	48 b8 d9 0f 80 00 00 	movabs $0x800fd9,%rax
+  801a70:	00 00 00 
+  801a73:	ff d0                	call   *%rax
+  801a75:	48 98                	cltq
+  801a77:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+		char sc;
+
+		do
+		{
+			sc = *in++;
+  801a7b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a7f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a83:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801a87:	0f b6 00             	movzbl (%rax),%eax
+  801a8a:	88 45 ef             	mov    %al,-0x11(%rbp)
+			if (!sc)
+  801a8d:	80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+  801a91:	75 07                	jne    801a9a <strstr+0x66>
+				return (char *)0;
+  801a93:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a98:	eb 33                	jmp    801acd <strstr+0x99>
+		} while (sc != c);
+  801a9a:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+  801a9e:	3a 45 ff             	cmp    -0x1(%rbp),%al
+  801aa1:	75 d8                	jne    801a7b <strstr+0x47>
+	} while (strncmp(in, str, len) != 0);
+  801aa3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801aa7:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801aab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aaf:	48 89 ce             	mov    %rcx,%rsi
+  801ab2:	48 89 c7             	mov    %rax,%rdi
+  801ab5:	48 b8 f4 11 80 00 00 	movabs $0x8011f4,%rax
+  801abc:	00 00 00 
+  801abf:	ff d0                	call   *%rax
+  801ac1:	85 c0                	test   %eax,%eax
+  801ac3:	75 b6                	jne    801a7b <strstr+0x47>
+
+	return (char *)(in - 1);
+  801ac5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ac9:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801acd:	c9                   	leave
+  801ace:	c3                   	ret
+
+0000000000801acf <syscall>:
+ * 用户的指令式系统调用，该函数将系统调用序号放入eax寄存器，五个参数依次放入edx, ecx, ebx, edi, esi，然后执行指令int 0x30，
+ * 发生中断后，去IDT中查找中断处理函数，最终会走到kern/trap.c的trap_dispatch()中
+ */
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801acf:	55                   	push   %rbp
+  801ad0:	48 89 e5             	mov    %rsp,%rbp
+  801ad3:	53                   	push   %rbx
+  801ad4:	48 83 ec 48          	sub    $0x48,%rsp
+  801ad8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801adb:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801ade:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801ae2:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801ae6:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801aea:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	 * volatile 告诉汇编程序不要因为不使用返回值就优化该指令
+	 * 最后一个子句告诉汇编程序，指令可能会改变条件代码cx和任意内存memory位置
+	 * 由汇编编译器做好数据保存和恢复工作(栈)
+	 */
+
+	asm volatile("int %1\n"			// code: int T_SYSCALL
+  801aee:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801af1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801af5:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801af9:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801afd:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801b01:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801b05:	4c 89 c3             	mov    %r8,%rbx
+  801b08:	cd 30                	int    $0x30
+  801b0a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+				   "D"(a4),			// edi = a4
+				   "S"(a5)			// esi = a5
+				 : "cc", "memory"); // 指令可能会改变条件代码cx和任意内存memory位置
+									// 由汇编编译器做好数据保存和恢复工作(栈)
+
+	if (check && ret > 0)
+  801b0e:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801b12:	74 44                	je     801b58 <syscall+0x89>
+  801b14:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801b19:	7e 3d                	jle    801b58 <syscall+0x89>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b1b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b1f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801b22:	49 89 d0             	mov    %rdx,%r8
+  801b25:	89 c1                	mov    %eax,%ecx
+  801b27:	48 b8 08 33 80 00 00 	movabs $0x803308,%rax
+  801b2e:	00 00 00 
+  801b31:	48 89 c2             	mov    %rax,%rdx
+  801b34:	be 34 00 00 00       	mov    $0x34,%esi
+  801b39:	48 b8 25 33 80 00 00 	movabs $0x803325,%rax
+  801b40:	00 00 00 
+  801b43:	48 89 c7             	mov    %rax,%rdi
+  801b46:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b4b:	49 b9 65 2b 80 00 00 	movabs $0x802b65,%r9
+  801b52:	00 00 00 
+  801b55:	41 ff d1             	call   *%r9
+
+	return ret;
+  801b58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801b5c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b60:	c9                   	leave
+  801b61:	c3                   	ret
+
+0000000000801b62 <sys_cputs>:
+
+void sys_cputs(const char *s, size_t len)
+{
+  801b62:	55                   	push   %rbp
+  801b63:	48 89 e5             	mov    %rsp,%rbp
+  801b66:	48 83 ec 10          	sub    $0x10,%rsp
+  801b6a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801b6e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 调用lib/syscall.c中的syscall()
+	// SYS_cputs: 系统调用序号(eax)，s: 需要输出的字符数组，len: 数组长度
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801b72:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b76:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801b7a:	48 83 ec 08          	sub    $0x8,%rsp
+  801b7e:	6a 00                	push   $0x0
+  801b80:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b86:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b8c:	48 89 d1             	mov    %rdx,%rcx
+  801b8f:	48 89 c2             	mov    %rax,%rdx
+  801b92:	be 00 00 00 00       	mov    $0x0,%esi
+  801b97:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b9c:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  801ba3:	00 00 00 
+  801ba6:	ff d0                	call   *%rax
+  801ba8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801bac:	90                   	nop
+  801bad:	c9                   	leave
+  801bae:	c3                   	ret
+
+0000000000801baf <sys_cgetc>:
+
+int sys_cgetc(void)
+{
+  801baf:	55                   	push   %rbp
+  801bb0:	48 89 e5             	mov    %rsp,%rbp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801bb3:	48 83 ec 08          	sub    $0x8,%rsp
+  801bb7:	6a 00                	push   $0x0
+  801bb9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801bbf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801bc5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bca:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bcf:	be 00 00 00 00       	mov    $0x0,%esi
+  801bd4:	bf 01 00 00 00       	mov    $0x1,%edi
+  801bd9:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  801be0:	00 00 00 
+  801be3:	ff d0                	call   *%rax
+  801be5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801be9:	c9                   	leave
+  801bea:	c3                   	ret
+
+0000000000801beb <sys_env_destroy>:
+
+int sys_env_destroy(envid_t envid)
+{
+  801beb:	55                   	push   %rbp
+  801bec:	48 89 e5             	mov    %rsp,%rbp
+  801bef:	48 83 ec 10          	sub    $0x10,%rsp
+  801bf3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	// 销毁envid对应的环境
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801bf6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801bf9:	48 98                	cltq
+  801bfb:	48 83 ec 08          	sub    $0x8,%rsp
+  801bff:	6a 00                	push   $0x0
+  801c01:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801c07:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c12:	48 89 c2             	mov    %rax,%rdx
+  801c15:	be 01 00 00 00       	mov    $0x1,%esi
+  801c1a:	bf 03 00 00 00       	mov    $0x3,%edi
+  801c1f:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  801c26:	00 00 00 
+  801c29:	ff d0                	call   *%rax
+  801c2b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c2f:	c9                   	leave
+  801c30:	c3                   	ret
+
+0000000000801c31 <sys_getprocid>:
+
+envid_t
+sys_getprocid(void)
+{
+  801c31:	55                   	push   %rbp
+  801c32:	48 89 e5             	mov    %rsp,%rbp
+	// 获取当前用户环境id
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801c35:	48 83 ec 08          	sub    $0x8,%rsp
+  801c39:	6a 00                	push   $0x0
+  801c3b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801c41:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c47:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c51:	be 00 00 00 00       	mov    $0x0,%esi
+  801c56:	bf 02 00 00 00       	mov    $0x2,%edi
+  801c5b:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  801c62:	00 00 00 
+  801c65:	ff d0                	call   *%rax
+  801c67:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c6b:	c9                   	leave
+  801c6c:	c3                   	ret
+
+0000000000801c6d <sys_yield>:
+
+void sys_yield(void)
+{
+  801c6d:	55                   	push   %rbp
+  801c6e:	48 89 e5             	mov    %rsp,%rbp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801c71:	48 83 ec 08          	sub    $0x8,%rsp
+  801c75:	6a 00                	push   $0x0
+  801c77:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801c7d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c83:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c88:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c8d:	be 00 00 00 00       	mov    $0x0,%esi
+  801c92:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801c97:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  801c9e:	00 00 00 
+  801ca1:	ff d0                	call   *%rax
+  801ca3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ca7:	90                   	nop
+  801ca8:	c9                   	leave
+  801ca9:	c3                   	ret
+
+0000000000801caa <sys_page_alloc>:
+
+int sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801caa:	55                   	push   %rbp
+  801cab:	48 89 e5             	mov    %rsp,%rbp
+  801cae:	48 83 ec 10          	sub    $0x10,%rsp
+  801cb2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801cb5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801cb9:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  801cbc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801cbf:	48 63 c8             	movslq %eax,%rcx
+  801cc2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801cc6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801cc9:	48 98                	cltq
+  801ccb:	48 83 ec 08          	sub    $0x8,%rsp
+  801ccf:	6a 00                	push   $0x0
+  801cd1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801cd7:	49 89 c8             	mov    %rcx,%r8
+  801cda:	48 89 d1             	mov    %rdx,%rcx
+  801cdd:	48 89 c2             	mov    %rax,%rdx
+  801ce0:	be 01 00 00 00       	mov    $0x1,%esi
+  801ce5:	bf 04 00 00 00       	mov    $0x4,%edi
+  801cea:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  801cf1:	00 00 00 
+  801cf4:	ff d0                	call   *%rax
+  801cf6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801cfa:	c9                   	leave
+  801cfb:	c3                   	ret
+
+0000000000801cfc <sys_page_map>:
+
+int sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801cfc:	55                   	push   %rbp
+  801cfd:	48 89 e5             	mov    %rsp,%rbp
+  801d00:	48 83 ec 20          	sub    $0x20,%rsp
+  801d04:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801d07:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801d0b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801d0e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d12:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  801d16:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801d19:	48 63 c8             	movslq %eax,%rcx
+  801d1c:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  801d20:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801d23:	48 63 f0             	movslq %eax,%rsi
+  801d26:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d2a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d2d:	48 98                	cltq
+  801d2f:	48 83 ec 08          	sub    $0x8,%rsp
+  801d33:	51                   	push   %rcx
+  801d34:	49 89 f9             	mov    %rdi,%r9
+  801d37:	49 89 f0             	mov    %rsi,%r8
+  801d3a:	48 89 d1             	mov    %rdx,%rcx
+  801d3d:	48 89 c2             	mov    %rax,%rdx
+  801d40:	be 01 00 00 00       	mov    $0x1,%esi
+  801d45:	bf 05 00 00 00       	mov    $0x5,%edi
+  801d4a:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  801d51:	00 00 00 
+  801d54:	ff d0                	call   *%rax
+  801d56:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d5a:	c9                   	leave
+  801d5b:	c3                   	ret
+
+0000000000801d5c <sys_page_unmap>:
+
+int sys_page_unmap(envid_t envid, void *va)
+{
+  801d5c:	55                   	push   %rbp
+  801d5d:	48 89 e5             	mov    %rsp,%rbp
+  801d60:	48 83 ec 10          	sub    $0x10,%rsp
+  801d64:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801d67:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  801d6b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d6f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d72:	48 98                	cltq
+  801d74:	48 83 ec 08          	sub    $0x8,%rsp
+  801d78:	6a 00                	push   $0x0
+  801d7a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d80:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d86:	48 89 d1             	mov    %rdx,%rcx
+  801d89:	48 89 c2             	mov    %rax,%rdx
+  801d8c:	be 01 00 00 00       	mov    $0x1,%esi
+  801d91:	bf 06 00 00 00       	mov    $0x6,%edi
+  801d96:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  801d9d:	00 00 00 
+  801da0:	ff d0                	call   *%rax
+  801da2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801da6:	c9                   	leave
+  801da7:	c3                   	ret
+
+0000000000801da8 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int sys_env_set_status(envid_t envid, int status)
+{
+  801da8:	55                   	push   %rbp
+  801da9:	48 89 e5             	mov    %rsp,%rbp
+  801dac:	48 83 ec 10          	sub    $0x10,%rsp
+  801db0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801db3:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801db6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801db9:	48 63 d0             	movslq %eax,%rdx
+  801dbc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801dbf:	48 98                	cltq
+  801dc1:	48 83 ec 08          	sub    $0x8,%rsp
+  801dc5:	6a 00                	push   $0x0
+  801dc7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801dcd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801dd3:	48 89 d1             	mov    %rdx,%rcx
+  801dd6:	48 89 c2             	mov    %rax,%rdx
+  801dd9:	be 01 00 00 00       	mov    $0x1,%esi
+  801dde:	bf 08 00 00 00       	mov    $0x8,%edi
+  801de3:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  801dea:	00 00 00 
+  801ded:	ff d0                	call   *%rax
+  801def:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801df3:	c9                   	leave
+  801df4:	c3                   	ret
+
+0000000000801df5 <sys_env_set_trapframe>:
+
+int sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801df5:	55                   	push   %rbp
+  801df6:	48 89 e5             	mov    %rsp,%rbp
+  801df9:	48 83 ec 10          	sub    $0x10,%rsp
+  801dfd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e00:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  801e04:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e08:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e0b:	48 98                	cltq
+  801e0d:	48 83 ec 08          	sub    $0x8,%rsp
+  801e11:	6a 00                	push   $0x0
+  801e13:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e19:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e1f:	48 89 d1             	mov    %rdx,%rcx
+  801e22:	48 89 c2             	mov    %rax,%rdx
+  801e25:	be 01 00 00 00       	mov    $0x1,%esi
+  801e2a:	bf 09 00 00 00       	mov    $0x9,%edi
+  801e2f:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  801e36:	00 00 00 
+  801e39:	ff d0                	call   *%rax
+  801e3b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e3f:	c9                   	leave
+  801e40:	c3                   	ret
+
+0000000000801e41 <sys_env_set_pgfault_upcall>:
+
+int sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801e41:	55                   	push   %rbp
+  801e42:	48 89 e5             	mov    %rsp,%rbp
+  801e45:	48 83 ec 10          	sub    $0x10,%rsp
+  801e49:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e4c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  801e50:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e54:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e57:	48 98                	cltq
+  801e59:	48 83 ec 08          	sub    $0x8,%rsp
+  801e5d:	6a 00                	push   $0x0
+  801e5f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e65:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e6b:	48 89 d1             	mov    %rdx,%rcx
+  801e6e:	48 89 c2             	mov    %rax,%rdx
+  801e71:	be 01 00 00 00       	mov    $0x1,%esi
+  801e76:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801e7b:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  801e82:	00 00 00 
+  801e85:	ff d0                	call   *%rax
+  801e87:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e8b:	c9                   	leave
+  801e8c:	c3                   	ret
+
+0000000000801e8d <sys_ipc_try_send>:
+
+int sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  801e8d:	55                   	push   %rbp
+  801e8e:	48 89 e5             	mov    %rsp,%rbp
+  801e91:	48 83 ec 20          	sub    $0x20,%rsp
+  801e95:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e98:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801e9c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801ea0:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  801ea3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801ea6:	48 63 f0             	movslq %eax,%rsi
+  801ea9:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801ead:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801eb0:	48 98                	cltq
+  801eb2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801eb6:	48 83 ec 08          	sub    $0x8,%rsp
+  801eba:	6a 00                	push   $0x0
+  801ebc:	49 89 f1             	mov    %rsi,%r9
+  801ebf:	49 89 c8             	mov    %rcx,%r8
+  801ec2:	48 89 d1             	mov    %rdx,%rcx
+  801ec5:	48 89 c2             	mov    %rax,%rdx
+  801ec8:	be 00 00 00 00       	mov    $0x0,%esi
+  801ecd:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801ed2:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  801ed9:	00 00 00 
+  801edc:	ff d0                	call   *%rax
+  801ede:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ee2:	c9                   	leave
+  801ee3:	c3                   	ret
+
+0000000000801ee4 <sys_ipc_recv>:
+
+int sys_ipc_recv(void *dstva)
+{
+  801ee4:	55                   	push   %rbp
+  801ee5:	48 89 e5             	mov    %rsp,%rbp
+  801ee8:	48 83 ec 10          	sub    $0x10,%rsp
+  801eec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  801ef0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ef4:	48 83 ec 08          	sub    $0x8,%rsp
+  801ef8:	6a 00                	push   $0x0
+  801efa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f00:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f06:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f0b:	48 89 c2             	mov    %rax,%rdx
+  801f0e:	be 01 00 00 00       	mov    $0x1,%esi
+  801f13:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801f18:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  801f1f:	00 00 00 
+  801f22:	ff d0                	call   *%rax
+  801f24:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f28:	c9                   	leave
+  801f29:	c3                   	ret
+
+0000000000801f2a <sys_disk_io>:
+
+int sys_disk_io(int dev, uint64_t secno, void *va, size_t nsecs, int write)
+{
+  801f2a:	55                   	push   %rbp
+  801f2b:	48 89 e5             	mov    %rsp,%rbp
+  801f2e:	48 83 ec 20          	sub    $0x20,%rsp
+  801f32:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f35:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f39:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801f3d:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  801f41:	44 89 45 f8          	mov    %r8d,-0x8(%rbp)
+	return syscall(SYS_disk_io, 0, dev, secno, (uint64_t)va, nsecs, write);
+  801f45:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801f48:	48 63 c8             	movslq %eax,%rcx
+  801f4b:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  801f4f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f52:	48 98                	cltq
+  801f54:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  801f58:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801f5c:	48 83 ec 08          	sub    $0x8,%rsp
+  801f60:	51                   	push   %rcx
+  801f61:	49 89 f9             	mov    %rdi,%r9
+  801f64:	49 89 f0             	mov    %rsi,%r8
+  801f67:	48 89 d1             	mov    %rdx,%rcx
+  801f6a:	48 89 c2             	mov    %rax,%rdx
+  801f6d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f72:	bf 0e 00 00 00       	mov    $0xe,%edi
+  801f77:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  801f7e:	00 00 00 
+  801f81:	ff d0                	call   *%rax
+  801f83:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f87:	c9                   	leave
+  801f88:	c3                   	ret
+
+0000000000801f89 <sys_vma_alloc>:
+
+int sys_vma_alloc(envid_t envid, void *va, size_t len, int perm)
+{
+  801f89:	55                   	push   %rbp
+  801f8a:	48 89 e5             	mov    %rsp,%rbp
+  801f8d:	48 83 ec 20          	sub    $0x20,%rsp
+  801f91:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f94:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f98:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801f9c:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_vma_alloc, 1, envid, (uint64_t)va, len, perm, 0);
+  801f9f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801fa2:	48 63 f0             	movslq %eax,%rsi
+  801fa5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801fa9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fac:	48 98                	cltq
+  801fae:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801fb2:	48 83 ec 08          	sub    $0x8,%rsp
+  801fb6:	6a 00                	push   $0x0
+  801fb8:	49 89 f1             	mov    %rsi,%r9
+  801fbb:	49 89 c8             	mov    %rcx,%r8
+  801fbe:	48 89 d1             	mov    %rdx,%rcx
+  801fc1:	48 89 c2             	mov    %rax,%rdx
+  801fc4:	be 01 00 00 00       	mov    $0x1,%esi
+  801fc9:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801fce:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  801fd5:	00 00 00 
+  801fd8:	ff d0                	call   *%rax
+  801fda:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fde:	c9                   	leave
+  801fdf:	c3                   	ret
+
+0000000000801fe0 <sys_vma_clear>:
+
+int sys_vma_clear(envid_t envid)
+{
+  801fe0:	55                   	push   %rbp
+  801fe1:	48 89 e5             	mov    %rsp,%rbp
+  801fe4:	48 83 ec 10          	sub    $0x10,%rsp
+  801fe8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_vma_clear, 1, envid, 0, 0, 0, 0);
+  801feb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fee:	48 98                	cltq
+  801ff0:	48 83 ec 08          	sub    $0x8,%rsp
+  801ff4:	6a 00                	push   $0x0
+  801ff6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ffc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802002:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802007:	48 89 c2             	mov    %rax,%rdx
+  80200a:	be 01 00 00 00       	mov    $0x1,%esi
+  80200f:	bf 10 00 00 00       	mov    $0x10,%edi
+  802014:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  80201b:	00 00 00 
+  80201e:	ff d0                	call   *%rax
+  802020:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802024:	c9                   	leave
+  802025:	c3                   	ret
+
+0000000000802026 <sys_trace_ctl>:
+
+int sys_trace_ctl(int enable)
+{
+  802026:	55                   	push   %rbp
+  802027:	48 89 e5             	mov    %rsp,%rbp
+  80202a:	48 83 ec 10          	sub    $0x10,%rsp
+  80202e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_trace_ctl, 0, enable, 0, 0, 0, 0);
+  802031:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802034:	48 98                	cltq
+  802036:	48 83 ec 08          	sub    $0x8,%rsp
+  80203a:	6a 00                	push   $0x0
+  80203c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802042:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802048:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80204d:	48 89 c2             	mov    %rax,%rdx
+  802050:	be 00 00 00 00       	mov    $0x0,%esi
+  802055:	bf 11 00 00 00       	mov    $0x11,%edi
+  80205a:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  802061:	00 00 00 
+  802064:	ff d0                	call   *%rax
+  802066:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80206a:	c9                   	leave
+  80206b:	c3                   	ret
+
+000000000080206c <sys_trace_read>:
+
+int sys_trace_read(int cpu, uint64_t *seq, struct TraceEvent *buf, int n)
+{
+  80206c:	55                   	push   %rbp
+  80206d:	48 89 e5             	mov    %rsp,%rbp
+  802070:	48 83 ec 20          	sub    $0x20,%rsp
+  802074:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802077:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80207b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80207f:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_trace_read, 0, cpu, (uint64_t)seq, (uint64_t)buf, n, 0);
+  802082:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802085:	48 63 f0             	movslq %eax,%rsi
+  802088:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80208c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802090:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802093:	48 98                	cltq
+  802095:	48 83 ec 08          	sub    $0x8,%rsp
+  802099:	6a 00                	push   $0x0
+  80209b:	49 89 f1             	mov    %rsi,%r9
+  80209e:	49 89 c8             	mov    %rcx,%r8
+  8020a1:	48 89 d1             	mov    %rdx,%rcx
+  8020a4:	48 89 c2             	mov    %rax,%rdx
+  8020a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8020ac:	bf 12 00 00 00       	mov    $0x12,%edi
+  8020b1:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  8020b8:	00 00 00 
+  8020bb:	ff d0                	call   *%rax
+  8020bd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020c1:	c9                   	leave
+  8020c2:	c3                   	ret
+
+00000000008020c3 <sys_getrusage>:
+
+int sys_getrusage(envid_t envid, struct Rusage *ru)
+{
+  8020c3:	55                   	push   %rbp
+  8020c4:	48 89 e5             	mov    %rsp,%rbp
+  8020c7:	48 83 ec 10          	sub    $0x10,%rsp
+  8020cb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020ce:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_getrusage, 0, envid, (uint64_t)ru, 0, 0, 0);
+  8020d2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8020d6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020d9:	48 98                	cltq
+  8020db:	48 83 ec 08          	sub    $0x8,%rsp
+  8020df:	6a 00                	push   $0x0
+  8020e1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020ed:	48 89 d1             	mov    %rdx,%rcx
+  8020f0:	48 89 c2             	mov    %rax,%rdx
+  8020f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8020f8:	bf 13 00 00 00       	mov    $0x13,%edi
+  8020fd:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  802104:	00 00 00 
+  802107:	ff d0                	call   *%rax
+  802109:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80210d:	c9                   	leave
+  80210e:	c3                   	ret
+
+000000000080210f <sys_pmu_config>:
+
+int sys_pmu_config(int idx, uint64_t event)
+{
+  80210f:	55                   	push   %rbp
+  802110:	48 89 e5             	mov    %rsp,%rbp
+  802113:	48 83 ec 10          	sub    $0x10,%rsp
+  802117:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80211a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_pmu_config, 0, idx, event, 0, 0, 0);
+  80211e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802121:	48 98                	cltq
+  802123:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802127:	48 83 ec 08          	sub    $0x8,%rsp
+  80212b:	6a 00                	push   $0x0
+  80212d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802133:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802139:	48 89 d1             	mov    %rdx,%rcx
+  80213c:	48 89 c2             	mov    %rax,%rdx
+  80213f:	be 00 00 00 00       	mov    $0x0,%esi
+  802144:	bf 14 00 00 00       	mov    $0x14,%edi
+  802149:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  802150:	00 00 00 
+  802153:	ff d0                	call   *%rax
+  802155:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802159:	c9                   	leave
+  80215a:	c3                   	ret
+
+000000000080215b <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  80215b:	55                   	push   %rbp
+  80215c:	48 89 e5             	mov    %rsp,%rbp
+  80215f:	48 83 ec 10          	sub    $0x10,%rsp
+  802163:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+  802166:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802169:	48 83 ec 08          	sub    $0x8,%rsp
+  80216d:	6a 00                	push   $0x0
+  80216f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802175:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80217b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802180:	48 89 c2             	mov    %rax,%rdx
+  802183:	be 00 00 00 00       	mov    $0x0,%esi
+  802188:	bf 15 00 00 00       	mov    $0x15,%edi
+  80218d:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  802194:	00 00 00 
+  802197:	ff d0                	call   *%rax
+  802199:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80219d:	c9                   	leave
+  80219e:	c3                   	ret
+
+000000000080219f <sys_image_attach>:
+
+int sys_image_attach(envid_t envid, int dev, const uint64_t *secnos, size_t size)
+{
+  80219f:	55                   	push   %rbp
+  8021a0:	48 89 e5             	mov    %rsp,%rbp
+  8021a3:	48 83 ec 20          	sub    $0x20,%rsp
+  8021a7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021aa:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  8021ad:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8021b1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+	return syscall(SYS_image_attach, 1, envid, dev, (uint64_t)secnos, size, 0);
+  8021b5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8021b9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8021bc:	48 63 d0             	movslq %eax,%rdx
+  8021bf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021c2:	48 98                	cltq
+  8021c4:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8021c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8021cc:	6a 00                	push   $0x0
+  8021ce:	49 89 f1             	mov    %rsi,%r9
+  8021d1:	49 89 c8             	mov    %rcx,%r8
+  8021d4:	48 89 d1             	mov    %rdx,%rcx
+  8021d7:	48 89 c2             	mov    %rax,%rdx
+  8021da:	be 01 00 00 00       	mov    $0x1,%esi
+  8021df:	bf 16 00 00 00       	mov    $0x16,%edi
+  8021e4:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  8021eb:	00 00 00 
+  8021ee:	ff d0                	call   *%rax
+  8021f0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021f4:	c9                   	leave
+  8021f5:	c3                   	ret
+
+00000000008021f6 <sys_vma_binary>:
+
+int sys_vma_binary(envid_t envid, const struct Proghdr *ph)
+{
+  8021f6:	55                   	push   %rbp
+  8021f7:	48 89 e5             	mov    %rsp,%rbp
+  8021fa:	48 83 ec 10          	sub    $0x10,%rsp
+  8021fe:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802201:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_vma_binary, 1, envid, (uint64_t)ph, 0, 0, 0);
+  802205:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802209:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80220c:	48 98                	cltq
+  80220e:	48 83 ec 08          	sub    $0x8,%rsp
+  802212:	6a 00                	push   $0x0
+  802214:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80221a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802220:	48 89 d1             	mov    %rdx,%rcx
+  802223:	48 89 c2             	mov    %rax,%rdx
+  802226:	be 01 00 00 00       	mov    $0x1,%esi
+  80222b:	bf 17 00 00 00       	mov    $0x17,%edi
+  802230:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  802237:	00 00 00 
+  80223a:	ff d0                	call   *%rax
+  80223c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802240:	c9                   	leave
+  802241:	c3                   	ret
+
+0000000000802242 <pgfault>:
+ * 自定义页错误处理函数.
+ * 当出现页错误，主要是对标志为可写的或者COW的物理页分配新页，复制旧页的数据到新页并映射到旧页的地址空间
+ */
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802242:	55                   	push   %rbp
+  802243:	48 89 e5             	mov    %rsp,%rbp
+  802246:	48 83 ec 40          	sub    $0x40,%rsp
+  80224a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	void *addr = (void *)utf->utf_fault_va;
+  80224e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802252:	48 8b 00             	mov    (%rax),%rax
+  802255:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint32_t err = utf->utf_err;
+  802259:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80225d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802261:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	int r;
+
+	// 检查出错的访问(1)写，(2)COW页.  若不是，调用panic().
+	// pte_t entry = uvpt[VPN(addr)];
+	// 分配一个新页，将其映射到临时位置(PFTEMP)，将旧页数据复制到新页，然后将新页移动到旧页的地址.
+	if ((err & FEC_WR) && (uvpt[VPN(addr)] & PTE_COW))
+  802264:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802267:	83 e0 02             	and    $0x2,%eax
+  80226a:	85 c0                	test   %eax,%eax
+  80226c:	0f 84 61 01 00 00    	je     8023d3 <pgfault+0x191>
+  802272:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802276:	48 c1 e8 0c          	shr    $0xc,%rax
+  80227a:	48 89 c2             	mov    %rax,%rdx
+  80227d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802284:	01 00 00 
+  802287:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80228b:	25 00 08 00 00       	and    $0x800,%eax
+  802290:	48 85 c0             	test   %rax,%rax
+  802293:	0f 84 3a 01 00 00    	je     8023d3 <pgfault+0x191>
+	{
+		if (sys_page_alloc(0, (void *)PFTEMP, PTE_U | PTE_P | PTE_W) == 0)
+  802299:	ba 07 00 00 00       	mov    $0x7,%edx
+  80229e:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8022a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022a8:	48 b8 aa 1c 80 00 00 	movabs $0x801caa,%rax
+  8022af:	00 00 00 
+  8022b2:	ff d0                	call   *%rax
+  8022b4:	85 c0                	test   %eax,%eax
+  8022b6:	0f 85 e7 00 00 00    	jne    8023a3 <pgfault+0x161>
+		{
+			// 分配了新的物理页以后准备从原页面开始拷贝数据时，记得将地址和物理页大小对齐
+			void *pg_addr = ROUNDDOWN(addr, PGSIZE);
+  8022bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022c0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  8022c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022c8:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8022ce:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+			memmove(PFTEMP, pg_addr, PGSIZE);
+  8022d2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8022d6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022db:	48 89 c6             	mov    %rax,%rsi
+  8022de:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  8022e3:	48 b8 d1 16 80 00 00 	movabs $0x8016d1,%rax
+  8022ea:	00 00 00 
+  8022ed:	ff d0                	call   *%rax
+			r = sys_page_map(0, (void *)PFTEMP, 0, pg_addr, PTE_U | PTE_W | PTE_P);
+  8022ef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8022f3:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  8022f9:	48 89 c1             	mov    %rax,%rcx
+  8022fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802301:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802306:	bf 00 00 00 00       	mov    $0x0,%edi
+  80230b:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  802312:	00 00 00 
+  802315:	ff d0                	call   *%rax
+  802317:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			if (r < 0)
+  80231a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80231e:	79 30                	jns    802350 <pgfault+0x10e>
+			{
+				panic("pgfault...something wrong with page_map");
+  802320:	48 b8 38 33 80 00 00 	movabs $0x803338,%rax
+  802327:	00 00 00 
+  80232a:	48 89 c2             	mov    %rax,%rdx
+  80232d:	be 22 00 00 00       	mov    $0x22,%esi
+  802332:	48 b8 60 33 80 00 00 	movabs $0x803360,%rax
+  802339:	00 00 00 
+  80233c:	48 89 c7             	mov    %rax,%rdi
+  80233f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802344:	48 b9 65 2b 80 00 00 	movabs $0x802b65,%rcx
+  80234b:	00 00 00 
+  80234e:	ff d1                	call   *%rcx
+			}
+			r = sys_page_unmap(0, PFTEMP);
+  802350:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802355:	bf 00 00 00 00       	mov    $0x0,%edi
+  80235a:	48 b8 5c 1d 80 00 00 	movabs $0x801d5c,%rax
+  802361:	00 00 00 
+  802364:	ff d0                	call   *%rax
+  802366:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			if (r < 0)
+  802369:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80236d:	0f 89 96 00 00 00    	jns    802409 <pgfault+0x1c7>
+			{
+				panic("pgfault...something wrong with page_unmap");
+  802373:	48 b8 70 33 80 00 00 	movabs $0x803370,%rax
+  80237a:	00 00 00 
+  80237d:	48 89 c2             	mov    %rax,%rdx
+  802380:	be 27 00 00 00       	mov    $0x27,%esi
+  802385:	48 b8 60 33 80 00 00 	movabs $0x803360,%rax
+  80238c:	00 00 00 
+  80238f:	48 89 c7             	mov    %rax,%rdi
+  802392:	b8 00 00 00 00       	mov    $0x0,%eax
+  802397:	48 b9 65 2b 80 00 00 	movabs $0x802b65,%rcx
+  80239e:	00 00 00 
+  8023a1:	ff d1                	call   *%rcx
+			}
+			return;
+		}
+		else
+		{
+			panic("pgfault...something wrong with page_alloc");
+  8023a3:	48 b8 a0 33 80 00 00 	movabs $0x8033a0,%rax
+  8023aa:	00 00 00 
+  8023ad:	48 89 c2             	mov    %rax,%rdx
+  8023b0:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8023b5:	48 b8 60 33 80 00 00 	movabs $0x803360,%rax
+  8023bc:	00 00 00 
+  8023bf:	48 89 c7             	mov    %rax,%rdi
+  8023c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023c7:	48 b9 65 2b 80 00 00 	movabs $0x802b65,%rcx
+  8023ce:	00 00 00 
+  8023d1:	ff d1                	call   *%rcx
+		}
+	}
+	else
+	{
+		panic("pgfault...wrong error %e", err);
+  8023d3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8023d6:	89 c1                	mov    %eax,%ecx
+  8023d8:	48 b8 ca 33 80 00 00 	movabs $0x8033ca,%rax
+  8023df:	00 00 00 
+  8023e2:	48 89 c2             	mov    %rax,%rdx
+  8023e5:	be 32 00 00 00       	mov    $0x32,%esi
+  8023ea:	48 b8 60 33 80 00 00 	movabs $0x803360,%rax
+  8023f1:	00 00 00 
+  8023f4:	48 89 c7             	mov    %rax,%rdi
+  8023f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023fc:	49 b8 65 2b 80 00 00 	movabs $0x802b65,%r8
+  802403:	00 00 00 
+  802406:	41 ff d0             	call   *%r8
+			return;
+  802409:	90                   	nop
+	}
+}
+  80240a:	c9                   	leave
+  80240b:	c3                   	ret
+
+000000000080240c <duppage>:
+ * 映射: 将的虚拟页pn(地址: pn*PGSIZE)映射到相同虚拟地址的 envid 中.
+ * 成功: 返回0，失败调用 panic()
+ */
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  80240c:	55                   	push   %rbp
+  80240d:	48 89 e5             	mov    %rsp,%rbp
+  802410:	48 83 ec 30          	sub    $0x30,%rsp
+  802414:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802417:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	pte_t entry = uvpt[pn];
+  80241a:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802421:	01 00 00 
+  802424:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802427:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80242b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	void *addr = (void *)((uintptr_t)pn * PGSIZE);
+  80242f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802432:	48 c1 e0 0c          	shl    $0xc,%rax
+  802436:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	int perm = entry & PTE_SYSCALL;
+  80243a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80243e:	25 07 0e 00 00       	and    $0xe07,%eax
+  802443:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm & PTE_SHARE)
+  802446:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802449:	25 00 04 00 00       	and    $0x400,%eax
+  80244e:	85 c0                	test   %eax,%eax
+  802450:	74 68                	je     8024ba <duppage+0xae>
+	{
+		r = sys_page_map(0, addr, envid, addr, perm);
+  802452:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  802455:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802459:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80245c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802460:	41 89 f0             	mov    %esi,%r8d
+  802463:	48 89 c6             	mov    %rax,%rsi
+  802466:	bf 00 00 00 00       	mov    $0x0,%edi
+  80246b:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  802472:	00 00 00 
+  802475:	ff d0                	call   *%rax
+  802477:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  80247a:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80247e:	0f 89 90 01 00 00    	jns    802614 <duppage+0x208>
+		{
+			panic("Something went wrong on duppage %e", r);
+  802484:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802487:	89 c1                	mov    %eax,%ecx
+  802489:	48 b8 e8 33 80 00 00 	movabs $0x8033e8,%rax
+  802490:	00 00 00 
+  802493:	48 89 c2             	mov    %rax,%rdx
+  802496:	be 48 00 00 00       	mov    $0x48,%esi
+  80249b:	48 b8 60 33 80 00 00 	movabs $0x803360,%rax
+  8024a2:	00 00 00 
+  8024a5:	48 89 c7             	mov    %rax,%rdi
+  8024a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ad:	49 b8 65 2b 80 00 00 	movabs $0x802b65,%r8
+  8024b4:	00 00 00 
+  8024b7:	41 ff d0             	call   *%r8
+		}
+	}
+	else if ((perm & PTE_COW) || (perm & PTE_W))
+  8024ba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8024bd:	25 00 08 00 00       	and    $0x800,%eax
+  8024c2:	85 c0                	test   %eax,%eax
+  8024c4:	75 0e                	jne    8024d4 <duppage+0xc8>
+  8024c6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8024c9:	83 e0 02             	and    $0x2,%eax
+  8024cc:	85 c0                	test   %eax,%eax
+  8024ce:	0f 84 dc 00 00 00    	je     8025b0 <duppage+0x1a4>
+	{
+		perm &= ~PTE_W;
+  8024d4:	83 65 ec fd          	andl   $0xfffffffd,-0x14(%rbp)
+		perm |= PTE_COW;
+  8024d8:	81 4d ec 00 08 00 00 	orl    $0x800,-0x14(%rbp)
+		r = sys_page_map(0, addr, envid, addr, perm);
+  8024df:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8024e2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024e6:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8024e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8024ed:	41 89 f0             	mov    %esi,%r8d
+  8024f0:	48 89 c6             	mov    %rax,%rsi
+  8024f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024f8:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  8024ff:	00 00 00 
+  802502:	ff d0                	call   *%rax
+  802504:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  802507:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80250b:	79 36                	jns    802543 <duppage+0x137>
+		{
+			panic("Something went wrong on duppage %e", r);
+  80250d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802510:	89 c1                	mov    %eax,%ecx
+  802512:	48 b8 e8 33 80 00 00 	movabs $0x8033e8,%rax
+  802519:	00 00 00 
+  80251c:	48 89 c2             	mov    %rax,%rdx
+  80251f:	be 52 00 00 00       	mov    $0x52,%esi
+  802524:	48 b8 60 33 80 00 00 	movabs $0x803360,%rax
+  80252b:	00 00 00 
+  80252e:	48 89 c7             	mov    %rax,%rdi
+  802531:	b8 00 00 00 00       	mov    $0x0,%eax
+  802536:	49 b8 65 2b 80 00 00 	movabs $0x802b65,%r8
+  80253d:	00 00 00 
+  802540:	41 ff d0             	call   *%r8
+		}
+		r = sys_page_map(0, addr, 0, addr, perm);
+  802543:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  802546:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80254a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80254e:	41 89 c8             	mov    %ecx,%r8d
+  802551:	48 89 d1             	mov    %rdx,%rcx
+  802554:	ba 00 00 00 00       	mov    $0x0,%edx
+  802559:	48 89 c6             	mov    %rax,%rsi
+  80255c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802561:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  802568:	00 00 00 
+  80256b:	ff d0                	call   *%rax
+  80256d:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  802570:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802574:	0f 89 9a 00 00 00    	jns    802614 <duppage+0x208>
+		{
+			panic("Something went wrong on duppage %e", r);
+  80257a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80257d:	89 c1                	mov    %eax,%ecx
+  80257f:	48 b8 e8 33 80 00 00 	movabs $0x8033e8,%rax
+  802586:	00 00 00 
+  802589:	48 89 c2             	mov    %rax,%rdx
+  80258c:	be 57 00 00 00       	mov    $0x57,%esi
+  802591:	48 b8 60 33 80 00 00 	movabs $0x803360,%rax
+  802598:	00 00 00 
+  80259b:	48 89 c7             	mov    %rax,%rdi
+  80259e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025a3:	49 b8 65 2b 80 00 00 	movabs $0x802b65,%r8
+  8025aa:	00 00 00 
+  8025ad:	41 ff d0             	call   *%r8
+		}
+	}
+	else
+	{
+		r = sys_page_map(0, addr, envid, addr, perm);
+  8025b0:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8025b3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025b7:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8025ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8025be:	41 89 f0             	mov    %esi,%r8d
+  8025c1:	48 89 c6             	mov    %rax,%rsi
+  8025c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025c9:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  8025d0:	00 00 00 
+  8025d3:	ff d0                	call   *%rax
+  8025d5:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  8025d8:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8025dc:	79 36                	jns    802614 <duppage+0x208>
+		{
+			panic("Something went wrong on duppage %e", r);
+  8025de:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8025e1:	89 c1                	mov    %eax,%ecx
+  8025e3:	48 b8 e8 33 80 00 00 	movabs $0x8033e8,%rax
+  8025ea:	00 00 00 
+  8025ed:	48 89 c2             	mov    %rax,%rdx
+  8025f0:	be 5f 00 00 00       	mov    $0x5f,%esi
+  8025f5:	48 b8 60 33 80 00 00 	movabs $0x803360,%rax
+  8025fc:	00 00 00 
+  8025ff:	48 89 c7             	mov    %rax,%rdi
+  802602:	b8 00 00 00 00       	mov    $0x0,%eax
+  802607:	49 b8 65 2b 80 00 00 	movabs $0x802b65,%r8
+  80260e:	00 00 00 
+  802611:	41 ff d0             	call   *%r8
+		}
+	}
+	return 0;
+  802614:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802619:	c9                   	leave
+  80261a:	c3                   	ret
+
+000000000080261b <fork>:
+ * 
+ * 两个用户异常栈都不应该被标记为COW，所以必须为子环境的异常栈分配一个新页
+ */
+envid_t
+fork(void)
+{
+  80261b:	55                   	push   %rbp
+  80261c:	48 89 e5             	mov    %rsp,%rbp
+  80261f:	48 83 ec 50          	sub    $0x50,%rsp
+	int r = 0;
+  802623:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	set_pgfault_handler(pgfault);
+  80262a:	48 b8 42 22 80 00 00 	movabs $0x802242,%rax
+  802631:	00 00 00 
+  802634:	48 89 c7             	mov    %rax,%rdi
+  802637:	48 b8 7f 2c 80 00 00 	movabs $0x802c7f,%rax
+  80263e:	00 00 00 
+  802641:	ff d0                	call   *%rax
+// 必须内联.
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  802643:	b8 07 00 00 00       	mov    $0x7,%eax
+  802648:	cd 30                	int    $0x30
+  80264a:	89 45 bc             	mov    %eax,-0x44(%rbp)
+					 : "=a"(ret)
+					 : "a"(SYS_exofork),
+					   "i"(T_SYSCALL));
+	return ret;
+  80264d:	8b 45 bc             	mov    -0x44(%rbp),%eax
+	envid_t childid = sys_exofork();
+  802650:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	if (childid < 0)
+  802653:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  802657:	79 36                	jns    80268f <fork+0x74>
+	{
+		panic("\n couldn't call fork %e\n", childid);
+  802659:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80265c:	89 c1                	mov    %eax,%ecx
+  80265e:	48 b8 0b 34 80 00 00 	movabs $0x80340b,%rax
+  802665:	00 00 00 
+  802668:	48 89 c2             	mov    %rax,%rdx
+  80266b:	be 7a 00 00 00       	mov    $0x7a,%esi
+  802670:	48 b8 60 33 80 00 00 	movabs $0x803360,%rax
+  802677:	00 00 00 
+  80267a:	48 89 c7             	mov    %rax,%rdi
+  80267d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802682:	49 b8 65 2b 80 00 00 	movabs $0x802b65,%r8
+  802689:	00 00 00 
+  80268c:	41 ff d0             	call   *%r8
+	}
+	if (childid == 0)
+  80268f:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  802693:	75 3e                	jne    8026d3 <fork+0xb8>
+	{
+		// thisproc 父进程
+		thisproc = &procs[ENVX(sys_getprocid())];
+  802695:	48 b8 31 1c 80 00 00 	movabs $0x801c31,%rax
+  80269c:	00 00 00 
+  80269f:	ff d0                	call   *%rax
+  8026a1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8026a6:	48 98                	cltq
+  8026a8:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  8026af:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  8026b6:	00 00 00 
+  8026b9:	48 01 c2             	add    %rax,%rdx
+  8026bc:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8026c3:	00 00 00 
+  8026c6:	48 89 10             	mov    %rdx,(%rax)
+		// 子环境的返回值
+		return 0;
+  8026c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026ce:	e9 c2 02 00 00       	jmp    802995 <fork+0x37a>
+	}
+	r = sys_page_alloc(childid, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_W | PTE_U);
+  8026d3:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8026d6:	ba 07 00 00 00       	mov    $0x7,%edx
+  8026db:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  8026e0:	48 89 ce             	mov    %rcx,%rsi
+  8026e3:	89 c7                	mov    %eax,%edi
+  8026e5:	48 b8 aa 1c 80 00 00 	movabs $0x801caa,%rax
+  8026ec:	00 00 00 
+  8026ef:	ff d0                	call   *%rax
+  8026f1:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if (r < 0)
+  8026f4:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  8026f8:	79 36                	jns    802730 <fork+0x115>
+		panic("\n couldn't call fork %e\n", r);
+  8026fa:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8026fd:	89 c1                	mov    %eax,%ecx
+  8026ff:	48 b8 0b 34 80 00 00 	movabs $0x80340b,%rax
+  802706:	00 00 00 
+  802709:	48 89 c2             	mov    %rax,%rdx
+  80270c:	be 85 00 00 00       	mov    $0x85,%esi
+  802711:	48 b8 60 33 80 00 00 	movabs $0x803360,%rax
+  802718:	00 00 00 
+  80271b:	48 89 c7             	mov    %rax,%rdi
+  80271e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802723:	49 b8 65 2b 80 00 00 	movabs $0x802b65,%r8
+  80272a:	00 00 00 
+  80272d:	41 ff d0             	call   *%r8
+
+	uint64_t pml;
+	uint64_t pdpe;
+	uint64_t pde;
+	uint64_t pte;
+	uint64_t each_pde = 0;
+  802730:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802737:	00 
+	uint64_t each_pte = 0;
+  802738:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80273f:	00 
+	uint64_t each_pdpe = 0;
+  802740:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802747:	00 
+
+	// 拷贝[0, UXSTACKTOP)的所有用户页，接下来为用户异常栈创建物理页
+	// 因为在创建用户环境时，已经在 env_setup_vm() 中映射了内核所有页
+	for (pml = 0; pml < VPML4E(UTOP); pml++)
+  802748:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80274f:	00 
+  802750:	e9 80 01 00 00       	jmp    8028d5 <fork+0x2ba>
+	{
+		if (uvpml4e[pml] & PTE_P)
+  802755:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80275c:	01 00 00 
+  80275f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802763:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802767:	83 e0 01             	and    $0x1,%eax
+  80276a:	48 85 c0             	test   %rax,%rax
+  80276d:	0f 84 4d 01 00 00    	je     8028c0 <fork+0x2a5>
+		{
+
+			for (pdpe = 0; pdpe < NPDPENTRIES; pdpe++, each_pdpe++)
+  802773:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80277a:	00 
+  80277b:	e9 30 01 00 00       	jmp    8028b0 <fork+0x295>
+			{
+				if (uvpde[each_pdpe] & PTE_P)
+  802780:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802787:	01 00 00 
+  80278a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80278e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802792:	83 e0 01             	and    $0x1,%eax
+  802795:	48 85 c0             	test   %rax,%rax
+  802798:	0f 84 f8 00 00 00    	je     802896 <fork+0x27b>
+				{
+
+					for (pde = 0; pde < NPDENTRIES; pde++, each_pde++)
+  80279e:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8027a5:	00 
+  8027a6:	e9 db 00 00 00       	jmp    802886 <fork+0x26b>
+					{
+						if (uvpd[each_pde] & PTE_P)
+  8027ab:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8027b2:	01 00 00 
+  8027b5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8027b9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8027bd:	83 e0 01             	and    $0x1,%eax
+  8027c0:	48 85 c0             	test   %rax,%rax
+  8027c3:	0f 84 a3 00 00 00    	je     80286c <fork+0x251>
+						{
+
+							for (pte = 0; pte < NPTENTRIES; pte++, each_pte++)
+  8027c9:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8027d0:	00 
+  8027d1:	e9 86 00 00 00       	jmp    80285c <fork+0x241>
+							{
+								if (uvpt[each_pte] & PTE_P)
+  8027d6:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  8027dd:	01 00 00 
+  8027e0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027e4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8027e8:	83 e0 01             	and    $0x1,%eax
+  8027eb:	48 85 c0             	test   %rax,%rax
+  8027ee:	74 62                	je     802852 <fork+0x237>
+								{
+
+									if (each_pte != VPN(UXSTACKTOP - PGSIZE))
+  8027f0:	48 81 7d d0 ff f7 0e 	cmpq   $0xef7ff,-0x30(%rbp)
+  8027f7:	00 
+  8027f8:	74 58                	je     802852 <fork+0x237>
+									{
+										r = duppage(childid, (unsigned)each_pte);
+  8027fa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027fe:	89 c2                	mov    %eax,%edx
+  802800:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802803:	89 d6                	mov    %edx,%esi
+  802805:	89 c7                	mov    %eax,%edi
+  802807:	48 b8 0c 24 80 00 00 	movabs $0x80240c,%rax
+  80280e:	00 00 00 
+  802811:	ff d0                	call   *%rax
+  802813:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+										if (r < 0)
+  802816:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  80281a:	79 36                	jns    802852 <fork+0x237>
+											panic("\n couldn't call fork %e\n", r);
+  80281c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80281f:	89 c1                	mov    %eax,%ecx
+  802821:	48 b8 0b 34 80 00 00 	movabs $0x80340b,%rax
+  802828:	00 00 00 
+  80282b:	48 89 c2             	mov    %rax,%rdx
+  80282e:	be a9 00 00 00       	mov    $0xa9,%esi
+  802833:	48 b8 60 33 80 00 00 	movabs $0x803360,%rax
+  80283a:	00 00 00 
+  80283d:	48 89 c7             	mov    %rax,%rdi
+  802840:	b8 00 00 00 00       	mov    $0x0,%eax
+  802845:	49 b8 65 2b 80 00 00 	movabs $0x802b65,%r8
+  80284c:	00 00 00 
+  80284f:	41 ff d0             	call   *%r8
+							for (pte = 0; pte < NPTENTRIES; pte++, each_pte++)
+  802852:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  802857:	48 83 45 d0 01       	addq   $0x1,-0x30(%rbp)
+  80285c:	48 81 7d e0 ff 01 00 	cmpq   $0x1ff,-0x20(%rbp)
+  802863:	00 
+  802864:	0f 86 6c ff ff ff    	jbe    8027d6 <fork+0x1bb>
+  80286a:	eb 10                	jmp    80287c <fork+0x261>
+								}
+							}
+						}
+						else
+						{
+							each_pte = (each_pde + 1) * NPTENTRIES;
+  80286c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802870:	48 83 c0 01          	add    $0x1,%rax
+  802874:	48 c1 e0 09          	shl    $0x9,%rax
+  802878:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+					for (pde = 0; pde < NPDENTRIES; pde++, each_pde++)
+  80287c:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  802881:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802886:	48 81 7d e8 ff 01 00 	cmpq   $0x1ff,-0x18(%rbp)
+  80288d:	00 
+  80288e:	0f 86 17 ff ff ff    	jbe    8027ab <fork+0x190>
+  802894:	eb 10                	jmp    8028a6 <fork+0x28b>
+						}
+					}
+				}
+				else
+				{
+					each_pde = (each_pdpe + 1) * NPDENTRIES;
+  802896:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80289a:	48 83 c0 01          	add    $0x1,%rax
+  80289e:	48 c1 e0 09          	shl    $0x9,%rax
+  8028a2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			for (pdpe = 0; pdpe < NPDPENTRIES; pdpe++, each_pdpe++)
+  8028a6:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8028ab:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  8028b0:	48 81 7d f0 ff 01 00 	cmpq   $0x1ff,-0x10(%rbp)
+  8028b7:	00 
+  8028b8:	0f 86 c2 fe ff ff    	jbe    802780 <fork+0x165>
+  8028be:	eb 10                	jmp    8028d0 <fork+0x2b5>
+				}
+			}
+		}
+		else
+		{
+			each_pdpe = (pml + 1) * NPDPENTRIES;
+  8028c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028c4:	48 83 c0 01          	add    $0x1,%rax
+  8028c8:	48 c1 e0 09          	shl    $0x9,%rax
+  8028cc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	for (pml = 0; pml < VPML4E(UTOP); pml++)
+  8028d0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8028d5:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8028da:	0f 84 75 fe ff ff    	je     802755 <fork+0x13a>
+
+	extern void _pgfault_upcall(void);
+	// 为子环境设置页错误处理函数.
+	// 因为使用env_alloc()创建的env的处理函数指针都为空，但是这时已经明确的为其错误栈分配了物理页面
+	// 所以可以直接使用系统调用指定错误处理的入口，_pgfault_upcall()为所有用户页错误处理函数的总入口
+	r = sys_env_set_pgfault_upcall(childid, _pgfault_upcall);
+  8028e0:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8028e3:	48 ba 23 2d 80 00 00 	movabs $0x802d23,%rdx
+  8028ea:	00 00 00 
+  8028ed:	48 89 d6             	mov    %rdx,%rsi
+  8028f0:	89 c7                	mov    %eax,%edi
+  8028f2:	48 b8 41 1e 80 00 00 	movabs $0x801e41,%rax
+  8028f9:	00 00 00 
+  8028fc:	ff d0                	call   *%rax
+  8028fe:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if (r < 0)
+  802901:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  802905:	79 36                	jns    80293d <fork+0x322>
+		panic("\n couldn't call fork %e\n", r);
+  802907:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80290a:	89 c1                	mov    %eax,%ecx
+  80290c:	48 b8 0b 34 80 00 00 	movabs $0x80340b,%rax
+  802913:	00 00 00 
+  802916:	48 89 c2             	mov    %rax,%rdx
+  802919:	be c6 00 00 00       	mov    $0xc6,%esi
+  80291e:	48 b8 60 33 80 00 00 	movabs $0x803360,%rax
+  802925:	00 00 00 
+  802928:	48 89 c7             	mov    %rax,%rdi
+  80292b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802930:	49 b8 65 2b 80 00 00 	movabs $0x802b65,%r8
+  802937:	00 00 00 
+  80293a:	41 ff d0             	call   *%r8
+
+	r = sys_env_set_status(childid, ENV_RUNNABLE);
+  80293d:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802940:	be 02 00 00 00       	mov    $0x2,%esi
+  802945:	89 c7                	mov    %eax,%edi
+  802947:	48 b8 a8 1d 80 00 00 	movabs $0x801da8,%rax
+  80294e:	00 00 00 
+  802951:	ff d0                	call   *%rax
+  802953:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if (r < 0)
+  802956:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  80295a:	79 36                	jns    802992 <fork+0x377>
+		panic("\n couldn't call fork %e\n", r);
+  80295c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80295f:	89 c1                	mov    %eax,%ecx
+  802961:	48 b8 0b 34 80 00 00 	movabs $0x80340b,%rax
+  802968:	00 00 00 
+  80296b:	48 89 c2             	mov    %rax,%rdx
+  80296e:	be ca 00 00 00       	mov    $0xca,%esi
+  802973:	48 b8 60 33 80 00 00 	movabs $0x803360,%rax
+  80297a:	00 00 00 
+  80297d:	48 89 c7             	mov    %rax,%rdi
+  802980:	b8 00 00 00 00       	mov    $0x0,%eax
+  802985:	49 b8 65 2b 80 00 00 	movabs $0x802b65,%r8
+  80298c:	00 00 00 
+  80298f:	41 ff d0             	call   *%r8
+
+	return childid;
+  802992:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  802995:	c9                   	leave
+  802996:	c3                   	ret
+
+0000000000802997 <ipc_recv>:
+ * 如果 pg 为空，则传递 sys_ipc_recv 一个值，它将理解为“no page”的意思
+ * (Zero 不是正确的值，因为这是映射页面的完美有效位置)
+ */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802997:	55                   	push   %rbp
+  802998:	48 89 e5             	mov    %rsp,%rbp
+  80299b:	48 83 ec 30          	sub    $0x30,%rsp
+  80299f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8029a3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8029a7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	int r = 0;
+  8029ab:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	if(pg) {
+  8029b2:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8029b7:	74 18                	je     8029d1 <ipc_recv+0x3a>
+		r = sys_ipc_recv(pg);
+  8029b9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029bd:	48 89 c7             	mov    %rax,%rdi
+  8029c0:	48 b8 e4 1e 80 00 00 	movabs $0x801ee4,%rax
+  8029c7:	00 00 00 
+  8029ca:	ff d0                	call   *%rax
+  8029cc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8029cf:	eb 1c                	jmp    8029ed <ipc_recv+0x56>
+	}
+	// pg == 0, pg > UTOP
+	else {
+		r = sys_ipc_recv((void*)KERNBASE);
+  8029d1:	48 b8 00 00 00 04 80 	movabs $0x8004000000,%rax
+  8029d8:	00 00 00 
+  8029db:	48 89 c7             	mov    %rax,%rdi
+  8029de:	48 b8 e4 1e 80 00 00 	movabs $0x801ee4,%rax
+  8029e5:	00 00 00 
+  8029e8:	ff d0                	call   *%rax
+  8029ea:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	}
+	if (r < 0) {
+  8029ed:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8029f1:	79 39                	jns    802a2c <ipc_recv+0x95>
+		*from_env_store =  (from_env_store != NULL) ? (envid_t)0 : *from_env_store;
+  8029f3:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8029f8:	75 08                	jne    802a02 <ipc_recv+0x6b>
+  8029fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029fe:	8b 00                	mov    (%rax),%eax
+  802a00:	eb 05                	jmp    802a07 <ipc_recv+0x70>
+  802a02:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a07:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802a0b:	89 02                	mov    %eax,(%rdx)
+		*perm_store = (perm_store != NULL) ? (int)0 : *perm_store;
+  802a0d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  802a12:	75 08                	jne    802a1c <ipc_recv+0x85>
+  802a14:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a18:	8b 00                	mov    (%rax),%eax
+  802a1a:	eb 05                	jmp    802a21 <ipc_recv+0x8a>
+  802a1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a21:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802a25:	89 02                	mov    %eax,(%rdx)
+		return r;
+  802a27:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a2a:	eb 53                	jmp    802a7f <ipc_recv+0xe8>
+	}
+	// 设置from_env_store为发送进程的进程ID
+	if(from_env_store) {
+  802a2c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802a31:	74 19                	je     802a4c <ipc_recv+0xb5>
+		*from_env_store = thisproc->env_ipc_from;
+  802a33:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  802a3a:	00 00 00 
+  802a3d:	48 8b 00             	mov    (%rax),%rax
+  802a40:	8b 90 6c 01 00 00    	mov    0x16c(%rax),%edx
+  802a46:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a4a:	89 10                	mov    %edx,(%rax)
+	}
+	// 如果传递物理页，该位不为0，设置perm_store为物理页的权限
+	if(perm_store) {
+  802a4c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  802a51:	74 19                	je     802a6c <ipc_recv+0xd5>
+		*perm_store = thisproc->env_ipc_perm;
+  802a53:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  802a5a:	00 00 00 
+  802a5d:	48 8b 00             	mov    (%rax),%rax
+  802a60:	8b 90 70 01 00 00    	mov    0x170(%rax),%edx
+  802a66:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a6a:	89 10                	mov    %edx,(%rax)
+	}
+	// 返回发送进程发送的值
+	return thisproc->env_ipc_value;
+  802a6c:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  802a73:	00 00 00 
+  802a76:	48 8b 00             	mov    (%rax),%rax
+  802a79:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  802a7f:	c9                   	leave
+  802a80:	c3                   	ret
+
+0000000000802a81 <ipc_send>:
+ * 使用sys_yield()使cpu友好
+ * 如果'pg'为null，则给sys_ipc_recv传递一个它会理解为“无页面”的值(0不是正确的值)
+ */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802a81:	55                   	push   %rbp
+  802a82:	48 89 e5             	mov    %rsp,%rbp
+  802a85:	48 83 ec 30          	sub    $0x30,%rsp
+  802a89:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802a8c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  802a8f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802a93:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	int r = -E_IPC_NOT_RECV;
+  802a96:	c7 45 fc f8 ff ff ff 	movl   $0xfffffff8,-0x4(%rbp)
+	// 子进程不是接收状态
+	while(r == -E_IPC_NOT_RECV) {
+  802a9d:	eb 59                	jmp    802af8 <ipc_send+0x77>
+		if(pg) {
+  802a9f:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802aa4:	74 20                	je     802ac6 <ipc_send+0x45>
+			// 传递物理页
+			r = sys_ipc_try_send(to_env, val, pg, perm);
+  802aa6:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  802aa9:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  802aac:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802ab0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ab3:	89 c7                	mov    %eax,%edi
+  802ab5:	48 b8 8d 1e 80 00 00 	movabs $0x801e8d,%rax
+  802abc:	00 00 00 
+  802abf:	ff d0                	call   *%rax
+  802ac1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ac4:	eb 26                	jmp    802aec <ipc_send+0x6b>
+		}
+		// pg == 0, pg > UTOP
+		else {
+			// (void*)KERNBASE > UTOP
+			r = sys_ipc_try_send(to_env, val, (void*)KERNBASE, perm);
+  802ac6:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  802ac9:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802acc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802acf:	89 d1                	mov    %edx,%ecx
+  802ad1:	48 ba 00 00 00 04 80 	movabs $0x8004000000,%rdx
+  802ad8:	00 00 00 
+  802adb:	89 c7                	mov    %eax,%edi
+  802add:	48 b8 8d 1e 80 00 00 	movabs $0x801e8d,%rax
+  802ae4:	00 00 00 
+  802ae7:	ff d0                	call   *%rax
+  802ae9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+		}
+		// 让出CPU
+		sys_yield();
+  802aec:	48 b8 6d 1c 80 00 00 	movabs $0x801c6d,%rax
+  802af3:	00 00 00 
+  802af6:	ff d0                	call   *%rax
+	while(r == -E_IPC_NOT_RECV) {
+  802af8:	83 7d fc f8          	cmpl   $0xfffffff8,-0x4(%rbp)
+  802afc:	74 a1                	je     802a9f <ipc_send+0x1e>
+	}
+	if (r != 0) {
+  802afe:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b02:	74 30                	je     802b34 <ipc_send+0xb3>
+		panic("something went wrong with sending the page");
+  802b04:	48 b8 28 34 80 00 00 	movabs $0x803428,%rax
+  802b0b:	00 00 00 
+  802b0e:	48 89 c2             	mov    %rax,%rdx
+  802b11:	be 48 00 00 00       	mov    $0x48,%esi
+  802b16:	48 b8 53 34 80 00 00 	movabs $0x803453,%rax
+  802b1d:	00 00 00 
+  802b20:	48 89 c7             	mov    %rax,%rdi
+  802b23:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b28:	48 b9 65 2b 80 00 00 	movabs $0x802b65,%rcx
+  802b2f:	00 00 00 
+  802b32:	ff d1                	call   *%rcx
+	}
+}
+  802b34:	90                   	nop
+  802b35:	c9                   	leave
+  802b36:	c3                   	ret
+
+0000000000802b37 <ipc_find_env>:
+// find special environments.
+// Returns 0 if no such environment exists.
+// 内核只遍历已分配的环境(env_live)，不扫描整个 procs[]
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802b37:	55                   	push   %rbp
+  802b38:	48 89 e5             	mov    %rsp,%rbp
+  802b3b:	48 83 ec 20          	sub    $0x20,%rsp
+  802b3f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	envid_t r = sys_env_find(type);
+  802b42:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b45:	89 c7                	mov    %eax,%edi
+  802b47:	48 b8 5b 21 80 00 00 	movabs $0x80215b,%rax
+  802b4e:	00 00 00 
+  802b51:	ff d0                	call   *%rax
+  802b53:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+	return r < 0 ? 0 : r;
+  802b56:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b59:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b5e:	85 c0                	test   %eax,%eax
+  802b60:	0f 48 c2             	cmovs  %edx,%eax
+}
+  802b63:	c9                   	leave
+  802b64:	c3                   	ret
+
+0000000000802b65 <_panic>:
+/*
+ * 无法解决的致命错误会导致死机
+ * 打印"死机:<消息>”，然后导致处理器休眠进入HLT状态
+ */
+void _panic(const char *file, int line, const char *fmt, ...)
+{
+  802b65:	55                   	push   %rbp
+  802b66:	48 89 e5             	mov    %rsp,%rbp
+  802b69:	53                   	push   %rbx
+  802b6a:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  802b71:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  802b78:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  802b7e:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  802b85:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  802b8c:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  802b93:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  802b9a:	84 c0                	test   %al,%al
+  802b9c:	74 23                	je     802bc1 <_panic+0x5c>
+  802b9e:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  802ba5:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  802ba9:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  802bad:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  802bb1:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  802bb5:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  802bb9:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  802bbd:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  802bc1:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  802bc8:	00 00 00 
+  802bcb:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  802bd2:	00 00 00 
+  802bd5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802bd9:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  802be0:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  802be7:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+	// 输出死机的信息
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802bee:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802bf5:	00 00 00 
+  802bf8:	48 8b 18             	mov    (%rax),%rbx
+  802bfb:	48 b8 31 1c 80 00 00 	movabs $0x801c31,%rax
+  802c02:	00 00 00 
+  802c05:	ff d0                	call   *%rax
+  802c07:	89 c6                	mov    %eax,%esi
+  802c09:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  802c0f:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  802c16:	41 89 d0             	mov    %edx,%r8d
+  802c19:	48 89 c1             	mov    %rax,%rcx
+  802c1c:	48 89 da             	mov    %rbx,%rdx
+  802c1f:	48 b8 60 34 80 00 00 	movabs $0x803460,%rax
+  802c26:	00 00 00 
+  802c29:	48 89 c7             	mov    %rax,%rdi
+  802c2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c31:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  802c38:	00 00 00 
+  802c3b:	41 ff d1             	call   *%r9
+			sys_getprocid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802c3e:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  802c45:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  802c4c:	48 89 d6             	mov    %rdx,%rsi
+  802c4f:	48 89 c7             	mov    %rax,%rdi
+  802c52:	48 b8 0f 03 80 00 00 	movabs $0x80030f,%rax
+  802c59:	00 00 00 
+  802c5c:	ff d0                	call   *%rax
+	cprintf("\n");
+  802c5e:	48 b8 83 34 80 00 00 	movabs $0x803483,%rax
+  802c65:	00 00 00 
+  802c68:	48 89 c7             	mov    %rax,%rdi
+  802c6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c70:	48 ba be 03 80 00 00 	movabs $0x8003be,%rdx
+  802c77:	00 00 00 
+  802c7a:	ff d2                	call   *%rdx
+
+	// 触发断点中断
+	while (1)
+		asm volatile("int3");
+  802c7c:	cc                   	int3
+  802c7d:	eb fd                	jmp    802c7c <_panic+0x117>
+
+0000000000802c7f <set_pgfault_handler>:
+ * 包含用户异常栈的初始化和页错误处理函数的设置，利用 kern/syscall.c sys_env_set_pgfault_upcall() 注册(utf字段)用户页错误处理函数
+ * 第一次注册处理程序时，需要分配一个异常堆栈(顶部位于UXSTACKTOP的一页内存)
+ * 并告诉内核在页错误发生时调用汇编语言 _pgfault_upcall 例程
+ */
+void set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802c7f:	55                   	push   %rbp
+  802c80:	48 89 e5             	mov    %rsp,%rbp
+  802c83:	48 83 ec 10          	sub    $0x10,%rsp
+  802c87:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	if (_pgfault_handler == 0)
+  802c8b:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  802c92:	00 00 00 
+  802c95:	48 8b 00             	mov    (%rax),%rax
+  802c98:	48 85 c0             	test   %rax,%rax
+  802c9b:	75 72                	jne    802d0f <set_pgfault_handler+0x90>
+	{
+		// 第一次出错，创建用户异常栈
+		if (sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_W | PTE_U | PTE_P) == 0)
+  802c9d:	ba 07 00 00 00       	mov    $0x7,%edx
+  802ca2:	b8 00 f0 7f ef       	mov    $0xef7ff000,%eax
+  802ca7:	48 89 c6             	mov    %rax,%rsi
+  802caa:	bf 00 00 00 00       	mov    $0x0,%edi
+  802caf:	48 b8 aa 1c 80 00 00 	movabs $0x801caa,%rax
+  802cb6:	00 00 00 
+  802cb9:	ff d0                	call   *%rax
+  802cbb:	85 c0                	test   %eax,%eax
+  802cbd:	75 20                	jne    802cdf <set_pgfault_handler+0x60>
+			sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  802cbf:	48 b8 23 2d 80 00 00 	movabs $0x802d23,%rax
+  802cc6:	00 00 00 
+  802cc9:	48 89 c6             	mov    %rax,%rsi
+  802ccc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cd1:	48 b8 41 1e 80 00 00 	movabs $0x801e41,%rax
+  802cd8:	00 00 00 
+  802cdb:	ff d0                	call   *%rax
+  802cdd:	eb 30                	jmp    802d0f <set_pgfault_handler+0x90>
+		else
+			panic("set_pgfault_handler(): no memory");
+  802cdf:	48 b8 88 34 80 00 00 	movabs $0x803488,%rax
+  802ce6:	00 00 00 
+  802ce9:	48 89 c2             	mov    %rax,%rdx
+  802cec:	be 1b 00 00 00       	mov    $0x1b,%esi
+  802cf1:	48 b8 a9 34 80 00 00 	movabs $0x8034a9,%rax
+  802cf8:	00 00 00 
+  802cfb:	48 89 c7             	mov    %rax,%rdi
+  802cfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d03:	48 b9 65 2b 80 00 00 	movabs $0x802b65,%rcx
+  802d0a:	00 00 00 
+  802d0d:	ff d1                	call   *%rcx
+	}
+
+	// 存储汇编语言调用的处理函数指针.
+	_pgfault_handler = handler;
+  802d0f:	48 ba 20 40 80 00 00 	movabs $0x804020,%rdx
+  802d16:	00 00 00 
+  802d19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d1d:	48 89 02             	mov    %rax,(%rdx)
+}
+  802d20:	90                   	nop
+  802d21:	c9                   	leave
+  802d22:	c3                   	ret
+
+0000000000802d23 <_pgfault_upcall>:
+
+	// 调用C代码中的页错误处理函数.
+	// 函数参数: 指向 UTrapframe 的指针
+
+	// 通过 %rdi 传递函数参数
+	movq  %rsp, %rdi
+  802d23:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  802d26:	48 a1 20 40 80 00 00 	movabs 0x804020,%rax
+  802d2d:	00 00 00 
+	call *%rax
+  802d30:	ff d0                	call   *%rax
+			regs: 15*8 = 120-Byte,
+			eflags: 8-Byte,
+			rip: 8-Byte
+	*/
+
+	addq $16, %rsp	/* 跳过用户异常栈中的 utf_fault_va 和 utf_err(不需要) */
+  802d32:	48 83 c4 10          	add    $0x10,%rsp
+	
+	/* 用户异常栈: %rsp 指向 end of struct PushRegs */
+	
+	movq 120(%rsp), %r10	/* %r10 = %rip */
+  802d36:	4c 8b 54 24 78       	mov    0x78(%rsp),%r10
+	movq 136(%rsp), %r11	/* %r11 = %rsp */
+  802d3b:	4c 8b 9c 24 88 00 00 	mov    0x88(%rsp),%r11
+  802d42:	00 
+
+	subq $8, %r11			/* %r11(trap-time %rsp) - 8 */
+  802d43:	49 83 eb 08          	sub    $0x8,%r11
+	movq %r10, (%r11)		/* %r11(trap-time %rsp) 指向的值为 %rip */
+  802d47:	4d 89 13             	mov    %r10,(%r11)
+	movq %r11, 136(%rsp)	/* 更新 trap-time %rsp 的值 */
+  802d4a:	4c 89 9c 24 88 00 00 	mov    %r11,0x88(%rsp)
+  802d51:	00 
+		trap-time eflags
+		trap-time rip
+	*/
+
+	// 恢复 trap-time 寄存器集.  接下来不能再修改任何通用寄存器集 PushRegs.
+	POPA_	/* 之前已经通过增加 16-Byte 跳过了 fault_va 和 utf_err，所以只需使用 POPA_ 恢复 */
+  802d52:	4c 8b 3c 24          	mov    (%rsp),%r15
+  802d56:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  802d5b:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  802d60:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  802d65:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  802d6a:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  802d6f:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  802d74:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  802d79:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  802d7e:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  802d83:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  802d88:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  802d8d:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  802d92:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  802d97:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  802d9c:	48 83 c4 78          	add    $0x78,%rsp
+
+	// 从栈中恢复 %eflags.  接下来不能再使用修改 %eflags 的指令，比如算术指令sub, cmp等.
+	addq $8, %rsp	/* 跳过 %rip，指向 %eflags */
+  802da0:	48 83 c4 08          	add    $0x8,%rsp
+	popfq			/* 从栈中恢复 %eflags */
+  802da4:	9d                   	popf
+		(blank 8-Byte)
+		trap-time rip
+	*/
+
+	// 切换回调整后的 trap-time 栈.
+	popq %rsp		/* 已经指向 %rsp，直接 pop 恢复 */
+  802da5:	5c                   	pop    %rsp
+
+	// 返回重新执行引起页错误的环境指令.
+	ret				/* popq %rip */
+  802da6:	c3                   	ret
@@ -0,0 +1,4736 @@
+
+obj/user/primes.debug:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// entrypoint - 当最初被加载到一个新的环境中时，内核(或者父环境)在这里开始运行.
+.text
+.globl _start
+_start:
+	// 判断是否从栈上的参数开始初始化
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	// $USTACKTOP != %rsp 说明有参数，跳转到 args_exist
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// 如果不是(新环境被内核加载的时候)，则 push 伪造的 argc, argv 参数
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 a7 01 00 00       	call   8001e8 <libmain>
+
+// 不应该返回
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <primeproc>:
+// 父进程发送 除所有以第一个数为因子的和数 到子进程
+
+#include "inc/lib.h"
+
+unsigned primeproc(void)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	48 83 ec 10          	sub    $0x10,%rsp
+	int i, id, p;
+	int32_t procid;
+
+	// 从左边的邻居那里取一个质数
+top:
+	p = ipc_recv(&procid, 0, 0);
+  80004b:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80004f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800054:	be 00 00 00 00       	mov    $0x0,%esi
+  800059:	48 89 c7             	mov    %rax,%rdi
+  80005c:	48 b8 99 2a 80 00 00 	movabs $0x802a99,%rax
+  800063:	00 00 00 
+  800066:	ff d0                	call   *%rax
+  800068:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	cprintf("CPU %d: %d ", thisproc->env_cpunum, p);
+  80006b:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  800072:	00 00 00 
+  800075:	48 8b 00             	mov    (%rax),%rax
+  800078:	8b 80 38 01 00 00    	mov    0x138(%rax),%eax
+  80007e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800081:	89 c6                	mov    %eax,%esi
+  800083:	48 b8 a0 2d 80 00 00 	movabs $0x802da0,%rax
+  80008a:	00 00 00 
+  80008d:	48 89 c7             	mov    %rax,%rdi
+  800090:	b8 00 00 00 00       	mov    $0x0,%eax
+  800095:	48 b9 c0 04 80 00 00 	movabs $0x8004c0,%rcx
+  80009c:	00 00 00 
+  80009f:	ff d1                	call   *%rcx
+
+	// fork 一个右边的邻居来延续链条
+	if ((id = fork()) < 0)
+  8000a1:	48 b8 1d 27 80 00 00 	movabs $0x80271d,%rax
+  8000a8:	00 00 00 
+  8000ab:	ff d0                	call   *%rax
+  8000ad:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8000b0:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8000b4:	79 36                	jns    8000ec <primeproc+0xa9>
+		panic("fork: %e", id);
+  8000b6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8000b9:	89 c1                	mov    %eax,%ecx
+  8000bb:	48 b8 ac 2d 80 00 00 	movabs $0x802dac,%rax
+  8000c2:	00 00 00 
+  8000c5:	48 89 c2             	mov    %rax,%rdx
+  8000c8:	be 18 00 00 00       	mov    $0x18,%esi
+  8000cd:	48 b8 b5 2d 80 00 00 	movabs $0x802db5,%rax
+  8000d4:	00 00 00 
+  8000d7:	48 89 c7             	mov    %rax,%rdi
+  8000da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000df:	49 b8 7d 02 80 00 00 	movabs $0x80027d,%r8
+  8000e6:	00 00 00 
+  8000e9:	41 ff d0             	call   *%r8
+	if (id == 0)
+  8000ec:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8000f0:	75 05                	jne    8000f7 <primeproc+0xb4>
+		goto top;
+  8000f2:	e9 54 ff ff ff       	jmp    80004b <primeproc+0x8>
+
+	// 过滤掉质数的倍数
+	while (1)
+	{
+		i = ipc_recv(&procid, 0, 0);
+  8000f7:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8000fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800100:	be 00 00 00 00       	mov    $0x0,%esi
+  800105:	48 89 c7             	mov    %rax,%rdi
+  800108:	48 b8 99 2a 80 00 00 	movabs $0x802a99,%rax
+  80010f:	00 00 00 
+  800112:	ff d0                	call   *%rax
+  800114:	89 45 f4             	mov    %eax,-0xc(%rbp)
+		if (i % p)
+  800117:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80011a:	99                   	cltd
+  80011b:	f7 7d fc             	idivl  -0x4(%rbp)
+  80011e:	89 d0                	mov    %edx,%eax
+  800120:	85 c0                	test   %eax,%eax
+  800122:	74 d3                	je     8000f7 <primeproc+0xb4>
+			ipc_send(id, i, 0, 0);
+  800124:	8b 75 f4             	mov    -0xc(%rbp),%esi
+  800127:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80012a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80012f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800134:	89 c7                	mov    %eax,%edi
+  800136:	48 b8 83 2b 80 00 00 	movabs $0x802b83,%rax
+  80013d:	00 00 00 
+  800140:	ff d0                	call   *%rax
+		i = ipc_recv(&procid, 0, 0);
+  800142:	eb b3                	jmp    8000f7 <primeproc+0xb4>
+
+0000000000800144 <umain>:
+	}
+}
+
+void umain(int argc, char **argv)
+{
+  800144:	55                   	push   %rbp
+  800145:	48 89 e5             	mov    %rsp,%rbp
+  800148:	48 83 ec 20          	sub    $0x20,%rsp
+  80014c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80014f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int i, id;
+
+	// fork 链中的第一个主要过程
+	if ((id = fork()) < 0)
+  800153:	48 b8 1d 27 80 00 00 	movabs $0x80271d,%rax
+  80015a:	00 00 00 
+  80015d:	ff d0                	call   *%rax
+  80015f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  800162:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  800166:	79 36                	jns    80019e <umain+0x5a>
+		panic("fork: %e", id);
+  800168:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80016b:	89 c1                	mov    %eax,%ecx
+  80016d:	48 b8 ac 2d 80 00 00 	movabs $0x802dac,%rax
+  800174:	00 00 00 
+  800177:	48 89 c2             	mov    %rax,%rdx
+  80017a:	be 2b 00 00 00       	mov    $0x2b,%esi
+  80017f:	48 b8 b5 2d 80 00 00 	movabs $0x802db5,%rax
+  800186:	00 00 00 
+  800189:	48 89 c7             	mov    %rax,%rdi
+  80018c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800191:	49 b8 7d 02 80 00 00 	movabs $0x80027d,%r8
+  800198:	00 00 00 
+  80019b:	41 ff d0             	call   *%r8
+	if (id == 0) // 子进程
+  80019e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8001a2:	75 0c                	jne    8001b0 <umain+0x6c>
+		primeproc();
+  8001a4:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  8001ab:	00 00 00 
+  8001ae:	ff d0                	call   *%rax
+
+	// 输入所有的整数
+	for (i = 2; i <= 1000; i++)
+  8001b0:	c7 45 fc 02 00 00 00 	movl   $0x2,-0x4(%rbp)
+  8001b7:	eb 22                	jmp    8001db <umain+0x97>
+		ipc_send(id, i, 0, 0);
+  8001b9:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  8001bc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8001bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001c9:	89 c7                	mov    %eax,%edi
+  8001cb:	48 b8 83 2b 80 00 00 	movabs $0x802b83,%rax
+  8001d2:	00 00 00 
+  8001d5:	ff d0                	call   *%rax
+	for (i = 2; i <= 1000; i++)
+  8001d7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8001db:	81 7d fc e8 03 00 00 	cmpl   $0x3e8,-0x4(%rbp)
+  8001e2:	7e d5                	jle    8001b9 <umain+0x75>
+}
+  8001e4:	90                   	nop
+  8001e5:	90                   	nop
+  8001e6:	c9                   	leave
+  8001e7:	c3                   	ret
+
+00000000008001e8 <libmain>:
+
+/**
+ *  用户环境从lib/libmain.c中的函数libmain开始执行，这个函数进而调用umain，用户写的程序入口只能是umain
+ */
+void libmain(int argc, char **argv)
+{
+  8001e8:	55                   	push   %rbp
+  8001e9:	48 89 e5             	mov    %rsp,%rbp
+  8001ec:	48 83 ec 10          	sub    $0x10,%rsp
+  8001f0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8001f3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 设置常量 thisproc 指向 procs[] 中当前环境的 Env 结构，ENVX 确保环境 id 未超过了 NENV
+	// thisproc 指向当前环境的 Env 结构
+	thisproc = &procs[ENVX(sys_getprocid())];
+  8001f7:	48 b8 33 1d 80 00 00 	movabs $0x801d33,%rax
+  8001fe:	00 00 00 
+  800201:	ff d0                	call   *%rax
+  800203:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800208:	48 98                	cltq
+  80020a:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  800211:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  800218:	00 00 00 
+  80021b:	48 01 c2             	add    %rax,%rdx
+  80021e:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  800225:	00 00 00 
+  800228:	48 89 10             	mov    %rdx,(%rax)
+
+	// 通过 CPUID 选择 memset/memmove/memcpy 的实现
+	mem_init();
+  80022b:	48 b8 db 13 80 00 00 	movabs $0x8013db,%rax
+  800232:	00 00 00 
+  800235:	ff d0                	call   *%rax
+
+	// 为了能让panic()提示用户错误，存储程序的名称
+	if (argc > 0)
+  800237:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80023b:	7e 14                	jle    800251 <libmain+0x69>
+		binaryname = argv[0];
+  80023d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800241:	48 8b 00             	mov    (%rax),%rax
+  800244:	48 ba 00 40 80 00 00 	movabs $0x804000,%rdx
+  80024b:	00 00 00 
+  80024e:	48 89 02             	mov    %rax,(%rdx)
+
+	// 调用用户的主程序
+	umain(argc, argv);
+  800251:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800255:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800258:	48 89 d6             	mov    %rdx,%rsi
+  80025b:	89 c7                	mov    %eax,%edi
+  80025d:	48 b8 44 01 80 00 00 	movabs $0x800144,%rax
+  800264:	00 00 00 
+  800267:	ff d0                	call   *%rax
+
+	// 退出当前环境，env_destroy
+	sys_env_destroy(0);
+  800269:	bf 00 00 00 00       	mov    $0x0,%edi
+  80026e:	48 b8 ed 1c 80 00 00 	movabs $0x801ced,%rax
+  800275:	00 00 00 
+  800278:	ff d0                	call   *%rax
+}
+  80027a:	90                   	nop
+  80027b:	c9                   	leave
+  80027c:	c3                   	ret
+
+000000000080027d <_panic>:
+/*
+ * 无法解决的致命错误会导致死机
+ * 打印"死机:<消息>”，然后导致处理器休眠进入HLT状态
+ */
+void _panic(const char *file, int line, const char *fmt, ...)
+{
+  80027d:	55                   	push   %rbp
+  80027e:	48 89 e5             	mov    %rsp,%rbp
+  800281:	53                   	push   %rbx
+  800282:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800289:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  800290:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  800296:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  80029d:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  8002a4:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  8002ab:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  8002b2:	84 c0                	test   %al,%al
+  8002b4:	74 23                	je     8002d9 <_panic+0x5c>
+  8002b6:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  8002bd:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  8002c1:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  8002c5:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  8002c9:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  8002cd:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  8002d1:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  8002d5:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002d9:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  8002e0:	00 00 00 
+  8002e3:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  8002ea:	00 00 00 
+  8002ed:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002f1:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  8002f8:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  8002ff:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+	// 输出死机的信息
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800306:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80030d:	00 00 00 
+  800310:	48 8b 18             	mov    (%rax),%rbx
+  800313:	48 b8 33 1d 80 00 00 	movabs $0x801d33,%rax
+  80031a:	00 00 00 
+  80031d:	ff d0                	call   *%rax
+  80031f:	89 c6                	mov    %eax,%esi
+  800321:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  800327:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80032e:	41 89 d0             	mov    %edx,%r8d
+  800331:	48 89 c1             	mov    %rax,%rcx
+  800334:	48 89 da             	mov    %rbx,%rdx
+  800337:	48 b8 d0 2d 80 00 00 	movabs $0x802dd0,%rax
+  80033e:	00 00 00 
+  800341:	48 89 c7             	mov    %rax,%rdi
+  800344:	b8 00 00 00 00       	mov    $0x0,%eax
+  800349:	49 b9 c0 04 80 00 00 	movabs $0x8004c0,%r9
+  800350:	00 00 00 
+  800353:	41 ff d1             	call   *%r9
+			sys_getprocid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800356:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  80035d:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800364:	48 89 d6             	mov    %rdx,%rsi
+  800367:	48 89 c7             	mov    %rax,%rdi
+  80036a:	48 b8 11 04 80 00 00 	movabs $0x800411,%rax
+  800371:	00 00 00 
+  800374:	ff d0                	call   *%rax
+	cprintf("\n");
+  800376:	48 b8 f3 2d 80 00 00 	movabs $0x802df3,%rax
+  80037d:	00 00 00 
+  800380:	48 89 c7             	mov    %rax,%rdi
+  800383:	b8 00 00 00 00       	mov    $0x0,%eax
+  800388:	48 ba c0 04 80 00 00 	movabs $0x8004c0,%rdx
+  80038f:	00 00 00 
+  800392:	ff d2                	call   *%rdx
+
+	// 触发断点中断
+	while (1)
+		asm volatile("int3");
+  800394:	cc                   	int3
+  800395:	eb fd                	jmp    800394 <_panic+0x117>
+
+0000000000800397 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800397:	55                   	push   %rbp
+  800398:	48 89 e5             	mov    %rsp,%rbp
+  80039b:	48 83 ec 10          	sub    $0x10,%rsp
+  80039f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8003a2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->buf[b->idx++] = ch;
+  8003a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003aa:	8b 00                	mov    (%rax),%eax
+  8003ac:	8d 48 01             	lea    0x1(%rax),%ecx
+  8003af:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8003b3:	89 0a                	mov    %ecx,(%rdx)
+  8003b5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8003b8:	89 d1                	mov    %edx,%ecx
+  8003ba:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8003be:	48 98                	cltq
+  8003c0:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+	if (b->idx == 256-1) {
+  8003c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003c8:	8b 00                	mov    (%rax),%eax
+  8003ca:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003cf:	75 2c                	jne    8003fd <putch+0x66>
+		sys_cputs(b->buf, b->idx);
+  8003d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003d5:	8b 00                	mov    (%rax),%eax
+  8003d7:	48 98                	cltq
+  8003d9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8003dd:	48 83 c2 08          	add    $0x8,%rdx
+  8003e1:	48 89 c6             	mov    %rax,%rsi
+  8003e4:	48 89 d7             	mov    %rdx,%rdi
+  8003e7:	48 b8 64 1c 80 00 00 	movabs $0x801c64,%rax
+  8003ee:	00 00 00 
+  8003f1:	ff d0                	call   *%rax
+		b->idx = 0;
+  8003f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003f7:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	}
+	b->cnt++;
+  8003fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800401:	8b 40 04             	mov    0x4(%rax),%eax
+  800404:	8d 50 01             	lea    0x1(%rax),%edx
+  800407:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80040b:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80040e:	90                   	nop
+  80040f:	c9                   	leave
+  800410:	c3                   	ret
+
+0000000000800411 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800411:	55                   	push   %rbp
+  800412:	48 89 e5             	mov    %rsp,%rbp
+  800415:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80041c:	48 89 bd c8 fe ff ff 	mov    %rdi,-0x138(%rbp)
+  800423:	48 89 b5 c0 fe ff ff 	mov    %rsi,-0x140(%rbp)
+	struct printbuf b;
+	va_list aq;
+	va_copy(aq,ap);
+  80042a:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  800431:	48 8b b5 c0 fe ff ff 	mov    -0x140(%rbp),%rsi
+  800438:	48 8b 06             	mov    (%rsi),%rax
+  80043b:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80043f:	48 89 01             	mov    %rax,(%rcx)
+  800442:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800446:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80044a:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	b.idx = 0;
+  80044e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800455:	00 00 00 
+	b.cnt = 0;
+  800458:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80045f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, aq);
+  800462:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  800469:	48 8b 95 c8 fe ff ff 	mov    -0x138(%rbp),%rdx
+  800470:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800477:	48 89 c6             	mov    %rax,%rsi
+  80047a:	48 b8 97 03 80 00 00 	movabs $0x800397,%rax
+  800481:	00 00 00 
+  800484:	48 89 c7             	mov    %rax,%rdi
+  800487:	48 b8 5e 08 80 00 00 	movabs $0x80085e,%rax
+  80048e:	00 00 00 
+  800491:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  800493:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  800499:	48 98                	cltq
+  80049b:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8004a2:	48 83 c2 08          	add    $0x8,%rdx
+  8004a6:	48 89 c6             	mov    %rax,%rsi
+  8004a9:	48 89 d7             	mov    %rdx,%rdi
+  8004ac:	48 b8 64 1c 80 00 00 	movabs $0x801c64,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+	va_end(aq);
+
+	return b.cnt;
+  8004b8:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8004be:	c9                   	leave
+  8004bf:	c3                   	ret
+
+00000000008004c0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004c0:	55                   	push   %rbp
+  8004c1:	48 89 e5             	mov    %rsp,%rbp
+  8004c4:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  8004cb:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8004d2:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8004d9:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8004e0:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8004e7:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8004ee:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8004f5:	84 c0                	test   %al,%al
+  8004f7:	74 20                	je     800519 <cprintf+0x59>
+  8004f9:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8004fd:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800501:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800505:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800509:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80050d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800511:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800515:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+	va_list aq;
+	va_start(ap, fmt);
+  800519:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800520:	00 00 00 
+  800523:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80052a:	00 00 00 
+  80052d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800531:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800538:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80053f:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  800546:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80054d:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800554:	48 8b 06             	mov    (%rsi),%rax
+  800557:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80055b:	48 89 01             	mov    %rax,(%rcx)
+  80055e:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800562:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800566:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	cnt = vcprintf(fmt, aq);
+  80056a:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800571:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800578:	48 89 d6             	mov    %rdx,%rsi
+  80057b:	48 89 c7             	mov    %rax,%rdi
+  80057e:	48 b8 11 04 80 00 00 	movabs $0x800411,%rax
+  800585:	00 00 00 
+  800588:	ff d0                	call   *%rax
+  80058a:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return cnt;
+  800590:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800596:	c9                   	leave
+  800597:	c3                   	ret
+
+0000000000800598 <printnum>:
+ * num: 需要打印出来的整型数，base: 整型数的进制，其他参数同 vprintfmt
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+		 unsigned long long num, unsigned base, int width, int padc)
+{
+  800598:	55                   	push   %rbp
+  800599:	48 89 e5             	mov    %rsp,%rbp
+  80059c:	48 83 ec 30          	sub    $0x30,%rsp
+  8005a0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8005a4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8005a8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8005ac:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8005af:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8005b3:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+	// 当 num 超过一位数，首先递归函数自身打印所有高位的(更重要的)数字
+	if (num >= base)
+  8005b7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8005ba:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8005be:	72 54                	jb     800614 <printnum+0x7c>
+	{
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8005c0:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8005c3:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8005c6:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8005c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005d2:	48 f7 f6             	div    %rsi
+  8005d5:	49 89 c2             	mov    %rax,%r10
+  8005d8:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8005db:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8005de:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8005e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005e6:	41 89 c9             	mov    %ecx,%r9d
+  8005e9:	41 89 f8             	mov    %edi,%r8d
+  8005ec:	89 d1                	mov    %edx,%ecx
+  8005ee:	4c 89 d2             	mov    %r10,%rdx
+  8005f1:	48 89 c7             	mov    %rax,%rdi
+  8005f4:	48 b8 98 05 80 00 00 	movabs $0x800598,%rax
+  8005fb:	00 00 00 
+  8005fe:	ff d0                	call   *%rax
+  800600:	eb 1c                	jmp    80061e <printnum+0x86>
+	}
+	else
+	{
+		// 按照右对齐的格式在左侧补齐填充字符 padc
+		while (--width > 0)
+			putch(padc, putdat);
+  800602:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800606:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800609:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80060d:	48 89 d6             	mov    %rdx,%rsi
+  800610:	89 c7                	mov    %eax,%edi
+  800612:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800614:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800618:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80061c:	7f e4                	jg     800602 <printnum+0x6a>
+	}
+
+	// 然后打印个位数字
+	putch("0123456789abcdef"[num % base], putdat);
+  80061e:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800621:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800625:	ba 00 00 00 00       	mov    $0x0,%edx
+  80062a:	48 f7 f1             	div    %rcx
+  80062d:	48 b8 f0 2f 80 00 00 	movabs $0x802ff0,%rax
+  800634:	00 00 00 
+  800637:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  80063b:	0f be c0             	movsbl %al,%eax
+  80063e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800642:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800646:	48 89 d6             	mov    %rdx,%rsi
+  800649:	89 c7                	mov    %eax,%edi
+  80064b:	ff d1                	call   *%rcx
+}
+  80064d:	90                   	nop
+  80064e:	c9                   	leave
+  80064f:	c3                   	ret
+
+0000000000800650 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800650:	55                   	push   %rbp
+  800651:	48 89 e5             	mov    %rsp,%rbp
+  800654:	48 83 ec 20          	sub    $0x20,%rsp
+  800658:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80065c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;
+	if (lflag >= 2)
+  80065f:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800663:	7e 4f                	jle    8006b4 <getuint+0x64>
+		x = va_arg(*ap, unsigned long long);
+  800665:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800669:	8b 00                	mov    (%rax),%eax
+  80066b:	83 f8 2f             	cmp    $0x2f,%eax
+  80066e:	77 24                	ja     800694 <getuint+0x44>
+  800670:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800674:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800678:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80067c:	8b 00                	mov    (%rax),%eax
+  80067e:	89 c0                	mov    %eax,%eax
+  800680:	48 01 d0             	add    %rdx,%rax
+  800683:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800687:	8b 12                	mov    (%rdx),%edx
+  800689:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80068c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800690:	89 0a                	mov    %ecx,(%rdx)
+  800692:	eb 14                	jmp    8006a8 <getuint+0x58>
+  800694:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800698:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80069c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006a0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006a4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006a8:	48 8b 00             	mov    (%rax),%rax
+  8006ab:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8006af:	e9 9d 00 00 00       	jmp    800751 <getuint+0x101>
+	else if (lflag)
+  8006b4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8006b8:	74 4c                	je     800706 <getuint+0xb6>
+		x = va_arg(*ap, unsigned long);
+  8006ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006be:	8b 00                	mov    (%rax),%eax
+  8006c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c3:	77 24                	ja     8006e9 <getuint+0x99>
+  8006c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006c9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006d1:	8b 00                	mov    (%rax),%eax
+  8006d3:	89 c0                	mov    %eax,%eax
+  8006d5:	48 01 d0             	add    %rdx,%rax
+  8006d8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006dc:	8b 12                	mov    (%rdx),%edx
+  8006de:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006e1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006e5:	89 0a                	mov    %ecx,(%rdx)
+  8006e7:	eb 14                	jmp    8006fd <getuint+0xad>
+  8006e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006ed:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006f1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006f5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006f9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006fd:	48 8b 00             	mov    (%rax),%rax
+  800700:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800704:	eb 4b                	jmp    800751 <getuint+0x101>
+	else
+		x = va_arg(*ap, unsigned int);
+  800706:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80070a:	8b 00                	mov    (%rax),%eax
+  80070c:	83 f8 2f             	cmp    $0x2f,%eax
+  80070f:	77 24                	ja     800735 <getuint+0xe5>
+  800711:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800715:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800719:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80071d:	8b 00                	mov    (%rax),%eax
+  80071f:	89 c0                	mov    %eax,%eax
+  800721:	48 01 d0             	add    %rdx,%rax
+  800724:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800728:	8b 12                	mov    (%rdx),%edx
+  80072a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80072d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800731:	89 0a                	mov    %ecx,(%rdx)
+  800733:	eb 14                	jmp    800749 <getuint+0xf9>
+  800735:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800739:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80073d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800741:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800745:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800749:	8b 00                	mov    (%rax),%eax
+  80074b:	89 c0                	mov    %eax,%eax
+  80074d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800751:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800755:	c9                   	leave
+  800756:	c3                   	ret
+
+0000000000800757 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800757:	55                   	push   %rbp
+  800758:	48 89 e5             	mov    %rsp,%rbp
+  80075b:	48 83 ec 20          	sub    $0x20,%rsp
+  80075f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800763:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800766:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  80076a:	7e 4f                	jle    8007bb <getint+0x64>
+		x = va_arg(*ap, long long);
+  80076c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800770:	8b 00                	mov    (%rax),%eax
+  800772:	83 f8 2f             	cmp    $0x2f,%eax
+  800775:	77 24                	ja     80079b <getint+0x44>
+  800777:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80077b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80077f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800783:	8b 00                	mov    (%rax),%eax
+  800785:	89 c0                	mov    %eax,%eax
+  800787:	48 01 d0             	add    %rdx,%rax
+  80078a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80078e:	8b 12                	mov    (%rdx),%edx
+  800790:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800793:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800797:	89 0a                	mov    %ecx,(%rdx)
+  800799:	eb 14                	jmp    8007af <getint+0x58>
+  80079b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80079f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007a3:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007a7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007ab:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007af:	48 8b 00             	mov    (%rax),%rax
+  8007b2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8007b6:	e9 9d 00 00 00       	jmp    800858 <getint+0x101>
+	else if (lflag)
+  8007bb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8007bf:	74 4c                	je     80080d <getint+0xb6>
+		x = va_arg(*ap, long);
+  8007c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007c5:	8b 00                	mov    (%rax),%eax
+  8007c7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ca:	77 24                	ja     8007f0 <getint+0x99>
+  8007cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007d0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007d8:	8b 00                	mov    (%rax),%eax
+  8007da:	89 c0                	mov    %eax,%eax
+  8007dc:	48 01 d0             	add    %rdx,%rax
+  8007df:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007e3:	8b 12                	mov    (%rdx),%edx
+  8007e5:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007e8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007ec:	89 0a                	mov    %ecx,(%rdx)
+  8007ee:	eb 14                	jmp    800804 <getint+0xad>
+  8007f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007f4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007f8:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007fc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800800:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800804:	48 8b 00             	mov    (%rax),%rax
+  800807:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80080b:	eb 4b                	jmp    800858 <getint+0x101>
+	else
+		x = va_arg(*ap, int);
+  80080d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800811:	8b 00                	mov    (%rax),%eax
+  800813:	83 f8 2f             	cmp    $0x2f,%eax
+  800816:	77 24                	ja     80083c <getint+0xe5>
+  800818:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80081c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800820:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800824:	8b 00                	mov    (%rax),%eax
+  800826:	89 c0                	mov    %eax,%eax
+  800828:	48 01 d0             	add    %rdx,%rax
+  80082b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80082f:	8b 12                	mov    (%rdx),%edx
+  800831:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800834:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800838:	89 0a                	mov    %ecx,(%rdx)
+  80083a:	eb 14                	jmp    800850 <getint+0xf9>
+  80083c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800840:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800844:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800848:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80084c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800850:	8b 00                	mov    (%rax),%eax
+  800852:	48 98                	cltq
+  800854:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800858:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80085c:	c9                   	leave
+  80085d:	c3                   	ret
+
+000000000080085e <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap)
+{
+  80085e:	55                   	push   %rbp
+  80085f:	48 89 e5             	mov    %rsp,%rbp
+  800862:	41 54                	push   %r12
+  800864:	53                   	push   %rbx
+  800865:	48 83 ec 60          	sub    $0x60,%rsp
+  800869:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80086d:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800871:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800875:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+	int base, lflag, width, precision, altflag;
+
+	// 填充字符，在显示字符串的'%'后读到'-'或'0'时，赋值到 padc
+	char padc;
+	va_list aq;
+	va_copy(aq, ap);
+  800879:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80087d:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800881:	48 8b 06             	mov    (%rsi),%rax
+  800884:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800888:	48 89 01             	mov    %rax,(%rcx)
+  80088b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80088f:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800893:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1)
+	{
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800897:	eb 17                	jmp    8008b0 <vprintfmt+0x52>
+		{
+			if (ch == '\0')
+  800899:	85 db                	test   %ebx,%ebx
+  80089b:	0f 84 b9 04 00 00    	je     800d5a <vprintfmt+0x4fc>
+				return;
+			putch(ch, putdat);
+  8008a1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008a5:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8008a9:	48 89 c6             	mov    %rax,%rsi
+  8008ac:	89 df                	mov    %ebx,%edi
+  8008ae:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  8008b0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8008b4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8008b8:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8008bc:	0f b6 00             	movzbl (%rax),%eax
+  8008bf:	0f b6 d8             	movzbl %al,%ebx
+  8008c2:	83 fb 25             	cmp    $0x25,%ebx
+  8008c5:	75 d2                	jne    800899 <vprintfmt+0x3b>
+		}
+
+		// 处理 % 转义序列
+		// padc 初始化为空格符，padc='-'代表字符串左对齐，右边补空格，padc=' '代表右对齐，左边补空格，padc='0'右对齐，左边补0
+		padc = ' ';
+  8008c7:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+		width = -1;
+  8008cb:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+		// 默认-1代表显示长度为字符串本来的长度
+		precision = -1;
+  8008d2:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+		lflag = 0;
+  8008d9:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+		altflag = 0;
+  8008e0:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *)fmt++)
+  8008e7:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8008eb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8008ef:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8008f3:	0f b6 00             	movzbl (%rax),%eax
+  8008f6:	0f b6 d8             	movzbl %al,%ebx
+  8008f9:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8008fc:	83 f8 55             	cmp    $0x55,%eax
+  8008ff:	0f 87 22 04 00 00    	ja     800d27 <vprintfmt+0x4c9>
+  800905:	89 c0                	mov    %eax,%eax
+  800907:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80090e:	00 
+  80090f:	48 b8 18 30 80 00 00 	movabs $0x803018,%rax
+  800916:	00 00 00 
+  800919:	48 01 d0             	add    %rdx,%rax
+  80091c:	48 8b 00             	mov    (%rax),%rax
+  80091f:	ff e0                	jmp    *%rax
+		{
+
+		// flag to pad on the right
+		case '-':
+			padc = '-';
+  800921:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+			goto reswitch;
+  800925:	eb c0                	jmp    8008e7 <vprintfmt+0x89>
+
+		// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800927:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+			goto reswitch;
+  80092b:	eb ba                	jmp    8008e7 <vprintfmt+0x89>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0;; ++fmt)
+  80092d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+			{
+				precision = precision * 10 + ch - '0';
+  800934:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800937:	89 d0                	mov    %edx,%eax
+  800939:	c1 e0 02             	shl    $0x2,%eax
+  80093c:	01 d0                	add    %edx,%eax
+  80093e:	01 c0                	add    %eax,%eax
+  800940:	01 d8                	add    %ebx,%eax
+  800942:	83 e8 30             	sub    $0x30,%eax
+  800945:	89 45 d8             	mov    %eax,-0x28(%rbp)
+				ch = *fmt;
+  800948:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80094c:	0f b6 00             	movzbl (%rax),%eax
+  80094f:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800952:	83 fb 2f             	cmp    $0x2f,%ebx
+  800955:	7e 60                	jle    8009b7 <vprintfmt+0x159>
+  800957:	83 fb 39             	cmp    $0x39,%ebx
+  80095a:	7f 5b                	jg     8009b7 <vprintfmt+0x159>
+			for (precision = 0;; ++fmt)
+  80095c:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+				precision = precision * 10 + ch - '0';
+  800961:	eb d1                	jmp    800934 <vprintfmt+0xd6>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800963:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800966:	83 f8 2f             	cmp    $0x2f,%eax
+  800969:	77 17                	ja     800982 <vprintfmt+0x124>
+  80096b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80096f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800972:	89 d2                	mov    %edx,%edx
+  800974:	48 01 d0             	add    %rdx,%rax
+  800977:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80097a:	83 c2 08             	add    $0x8,%edx
+  80097d:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800980:	eb 0c                	jmp    80098e <vprintfmt+0x130>
+  800982:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800986:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80098a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80098e:	8b 00                	mov    (%rax),%eax
+  800990:	89 45 d8             	mov    %eax,-0x28(%rbp)
+			goto process_precision;
+  800993:	eb 23                	jmp    8009b8 <vprintfmt+0x15a>
+
+		case '.':
+			if (width < 0)
+  800995:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800999:	0f 89 48 ff ff ff    	jns    8008e7 <vprintfmt+0x89>
+				width = 0;
+  80099f:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+			goto reswitch;
+  8009a6:	e9 3c ff ff ff       	jmp    8008e7 <vprintfmt+0x89>
+
+		case '#':
+			altflag = 1;
+  8009ab:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+			goto reswitch;
+  8009b2:	e9 30 ff ff ff       	jmp    8008e7 <vprintfmt+0x89>
+			goto process_precision;
+  8009b7:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  8009b8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8009bc:	0f 89 25 ff ff ff    	jns    8008e7 <vprintfmt+0x89>
+				width = precision, precision = -1;
+  8009c2:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8009c5:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8009c8:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+			goto reswitch;
+  8009cf:	e9 13 ff ff ff       	jmp    8008e7 <vprintfmt+0x89>
+
+		// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  8009d4:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+			goto reswitch;
+  8009d8:	e9 0a ff ff ff       	jmp    8008e7 <vprintfmt+0x89>
+
+		// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  8009dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e3:	77 17                	ja     8009fc <vprintfmt+0x19e>
+  8009e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009e9:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009ec:	89 d2                	mov    %edx,%edx
+  8009ee:	48 01 d0             	add    %rdx,%rax
+  8009f1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009f4:	83 c2 08             	add    $0x8,%edx
+  8009f7:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8009fa:	eb 0c                	jmp    800a08 <vprintfmt+0x1aa>
+  8009fc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a00:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a04:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a08:	8b 00                	mov    (%rax),%eax
+  800a0a:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800a0e:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800a12:	48 89 d6             	mov    %rdx,%rsi
+  800a15:	89 c7                	mov    %eax,%edi
+  800a17:	ff d1                	call   *%rcx
+			break;
+  800a19:	e9 37 03 00 00       	jmp    800d55 <vprintfmt+0x4f7>
+
+		// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800a1e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a21:	83 f8 2f             	cmp    $0x2f,%eax
+  800a24:	77 17                	ja     800a3d <vprintfmt+0x1df>
+  800a26:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a2a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a2d:	89 d2                	mov    %edx,%edx
+  800a2f:	48 01 d0             	add    %rdx,%rax
+  800a32:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a35:	83 c2 08             	add    $0x8,%edx
+  800a38:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a3b:	eb 0c                	jmp    800a49 <vprintfmt+0x1eb>
+  800a3d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a41:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a45:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a49:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800a4b:	85 db                	test   %ebx,%ebx
+  800a4d:	79 02                	jns    800a51 <vprintfmt+0x1f3>
+				err = -err;
+  800a4f:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a51:	83 fb 11             	cmp    $0x11,%ebx
+  800a54:	7f 16                	jg     800a6c <vprintfmt+0x20e>
+  800a56:	48 ba 60 2f 80 00 00 	movabs $0x802f60,%rdx
+  800a5d:	00 00 00 
+  800a60:	48 63 c3             	movslq %ebx,%rax
+  800a63:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800a67:	4d 85 e4             	test   %r12,%r12
+  800a6a:	75 2e                	jne    800a9a <vprintfmt+0x23c>
+				printfmt(putch, putdat, "error %d", err);
+  800a6c:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800a70:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a74:	89 d9                	mov    %ebx,%ecx
+  800a76:	48 ba 01 30 80 00 00 	movabs $0x803001,%rdx
+  800a7d:	00 00 00 
+  800a80:	48 89 c7             	mov    %rax,%rdi
+  800a83:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a88:	49 b8 64 0d 80 00 00 	movabs $0x800d64,%r8
+  800a8f:	00 00 00 
+  800a92:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800a95:	e9 bb 02 00 00       	jmp    800d55 <vprintfmt+0x4f7>
+				printfmt(putch, putdat, "%s", p);
+  800a9a:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800a9e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800aa2:	4c 89 e1             	mov    %r12,%rcx
+  800aa5:	48 ba 0a 30 80 00 00 	movabs $0x80300a,%rdx
+  800aac:	00 00 00 
+  800aaf:	48 89 c7             	mov    %rax,%rdi
+  800ab2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab7:	49 b8 64 0d 80 00 00 	movabs $0x800d64,%r8
+  800abe:	00 00 00 
+  800ac1:	41 ff d0             	call   *%r8
+			break;
+  800ac4:	e9 8c 02 00 00       	jmp    800d55 <vprintfmt+0x4f7>
+
+		// string
+		case 's':
+			// 从可变参数中读入字符串指针
+			if ((p = va_arg(aq, char *)) == NULL)
+  800ac9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acc:	83 f8 2f             	cmp    $0x2f,%eax
+  800acf:	77 17                	ja     800ae8 <vprintfmt+0x28a>
+  800ad1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ad5:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ad8:	89 d2                	mov    %edx,%edx
+  800ada:	48 01 d0             	add    %rdx,%rax
+  800add:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ae0:	83 c2 08             	add    $0x8,%edx
+  800ae3:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800ae6:	eb 0c                	jmp    800af4 <vprintfmt+0x296>
+  800ae8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800aec:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800af0:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800af4:	4c 8b 20             	mov    (%rax),%r12
+  800af7:	4d 85 e4             	test   %r12,%r12
+  800afa:	75 0a                	jne    800b06 <vprintfmt+0x2a8>
+				p = "(null)"; // 当字符串为空时，将它指向"(null)"字符串
+  800afc:	49 bc 0d 30 80 00 00 	movabs $0x80300d,%r12
+  800b03:	00 00 00 
+			// 判断左对齐还是右对齐，pad='-'左对齐，否则右对齐
+			if (width > 0 && padc != '-')
+  800b06:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b0a:	7e 78                	jle    800b84 <vprintfmt+0x326>
+  800b0c:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800b10:	74 72                	je     800b84 <vprintfmt+0x326>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b12:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800b15:	48 98                	cltq
+  800b17:	48 89 c6             	mov    %rax,%rsi
+  800b1a:	4c 89 e7             	mov    %r12,%rdi
+  800b1d:	48 b8 09 11 80 00 00 	movabs $0x801109,%rax
+  800b24:	00 00 00 
+  800b27:	ff d0                	call   *%rax
+  800b29:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800b2c:	eb 17                	jmp    800b45 <vprintfmt+0x2e7>
+					putch(padc, putdat); // 字符串右对齐，左边补相应数量(width-实际长度)的空格或者 0
+  800b2e:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800b32:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800b36:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800b3a:	48 89 d6             	mov    %rdx,%rsi
+  800b3d:	89 c7                	mov    %eax,%edi
+  800b3f:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b41:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800b45:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b49:	7f e3                	jg     800b2e <vprintfmt+0x2d0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b4b:	eb 37                	jmp    800b84 <vprintfmt+0x326>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800b4d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800b51:	74 1e                	je     800b71 <vprintfmt+0x313>
+  800b53:	83 fb 1f             	cmp    $0x1f,%ebx
+  800b56:	7e 05                	jle    800b5d <vprintfmt+0x2ff>
+  800b58:	83 fb 7e             	cmp    $0x7e,%ebx
+  800b5b:	7e 14                	jle    800b71 <vprintfmt+0x313>
+					putch('?', putdat);
+  800b5d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b61:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b65:	48 89 c6             	mov    %rax,%rsi
+  800b68:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800b6d:	ff d2                	call   *%rdx
+  800b6f:	eb 0f                	jmp    800b80 <vprintfmt+0x322>
+				else
+					putch(ch, putdat); // 打印相应长度的字符串
+  800b71:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b75:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b79:	48 89 c6             	mov    %rax,%rsi
+  800b7c:	89 df                	mov    %ebx,%edi
+  800b7e:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b80:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800b84:	4c 89 e0             	mov    %r12,%rax
+  800b87:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800b8b:	0f b6 00             	movzbl (%rax),%eax
+  800b8e:	0f be d8             	movsbl %al,%ebx
+  800b91:	85 db                	test   %ebx,%ebx
+  800b93:	74 28                	je     800bbd <vprintfmt+0x35f>
+  800b95:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800b99:	78 b2                	js     800b4d <vprintfmt+0x2ef>
+  800b9b:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800b9f:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800ba3:	79 a8                	jns    800b4d <vprintfmt+0x2ef>
+			for (; width > 0; width--)
+  800ba5:	eb 16                	jmp    800bbd <vprintfmt+0x35f>
+				putch(' ', putdat); // 当字符串是左对齐的时候打印相应数量的空格
+  800ba7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bab:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800baf:	48 89 c6             	mov    %rax,%rsi
+  800bb2:	bf 20 00 00 00       	mov    $0x20,%edi
+  800bb7:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800bb9:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800bbd:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800bc1:	7f e4                	jg     800ba7 <vprintfmt+0x349>
+			break;
+  800bc3:	e9 8d 01 00 00       	jmp    800d55 <vprintfmt+0x4f7>
+
+		// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800bc8:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800bcc:	be 03 00 00 00       	mov    $0x3,%esi
+  800bd1:	48 89 c7             	mov    %rax,%rdi
+  800bd4:	48 b8 57 07 80 00 00 	movabs $0x800757,%rax
+  800bdb:	00 00 00 
+  800bde:	ff d0                	call   *%rax
+  800be0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((long long)num < 0)
+  800be4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800be8:	48 85 c0             	test   %rax,%rax
+  800beb:	79 1d                	jns    800c0a <vprintfmt+0x3ac>
+			{
+				putch('-', putdat);
+  800bed:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bf1:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800bf5:	48 89 c6             	mov    %rax,%rsi
+  800bf8:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800bfd:	ff d2                	call   *%rdx
+				num = -(long long)num;
+  800bff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c03:	48 f7 d8             	neg    %rax
+  800c06:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			}
+			base = 10;
+  800c0a:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800c11:	e9 d2 00 00 00       	jmp    800ce8 <vprintfmt+0x48a>
+
+		// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800c16:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800c1a:	be 03 00 00 00       	mov    $0x3,%esi
+  800c1f:	48 89 c7             	mov    %rax,%rdi
+  800c22:	48 b8 50 06 80 00 00 	movabs $0x800650,%rax
+  800c29:	00 00 00 
+  800c2c:	ff d0                	call   *%rax
+  800c2e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 10;
+  800c32:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800c39:	e9 aa 00 00 00       	jmp    800ce8 <vprintfmt+0x48a>
+		// (unsigned) octal
+		case 'o':
+			// Gets the variable argument with type integer from the point which was processed last by va_arg
+			// calls getuint which returns a long long value, which then calls printnum which prints based on
+			// base value.
+			num = getuint(&aq, 3);
+  800c3e:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800c42:	be 03 00 00 00       	mov    $0x3,%esi
+  800c47:	48 89 c7             	mov    %rax,%rdi
+  800c4a:	48 b8 50 06 80 00 00 	movabs $0x800650,%rax
+  800c51:	00 00 00 
+  800c54:	ff d0                	call   *%rax
+  800c56:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 8;
+  800c5a:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+			goto number;
+  800c61:	e9 82 00 00 00       	jmp    800ce8 <vprintfmt+0x48a>
+
+		// pointer
+		case 'p':
+			putch('0', putdat);
+  800c66:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c6a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c6e:	48 89 c6             	mov    %rax,%rsi
+  800c71:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c76:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800c78:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c7c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c80:	48 89 c6             	mov    %rax,%rsi
+  800c83:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c88:	ff d2                	call   *%rdx
+			num = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800c8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c8d:	83 f8 2f             	cmp    $0x2f,%eax
+  800c90:	77 17                	ja     800ca9 <vprintfmt+0x44b>
+  800c92:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c96:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c99:	89 d2                	mov    %edx,%edx
+  800c9b:	48 01 d0             	add    %rdx,%rax
+  800c9e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ca1:	83 c2 08             	add    $0x8,%edx
+  800ca4:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800ca7:	eb 0c                	jmp    800cb5 <vprintfmt+0x457>
+  800ca9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800cad:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cb1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800cb5:	48 8b 00             	mov    (%rax),%rax
+  800cb8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800cbc:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+			goto number;
+  800cc3:	eb 23                	jmp    800ce8 <vprintfmt+0x48a>
+
+		// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800cc5:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800cc9:	be 03 00 00 00       	mov    $0x3,%esi
+  800cce:	48 89 c7             	mov    %rax,%rdi
+  800cd1:	48 b8 50 06 80 00 00 	movabs $0x800650,%rax
+  800cd8:	00 00 00 
+  800cdb:	ff d0                	call   *%rax
+  800cdd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800ce1:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800ce8:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800ced:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800cf0:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800cf3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800cf7:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800cfb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800cff:	45 89 c1             	mov    %r8d,%r9d
+  800d02:	41 89 f8             	mov    %edi,%r8d
+  800d05:	48 89 c7             	mov    %rax,%rdi
+  800d08:	48 b8 98 05 80 00 00 	movabs $0x800598,%rax
+  800d0f:	00 00 00 
+  800d12:	ff d0                	call   *%rax
+			break;
+  800d14:	eb 3f                	jmp    800d55 <vprintfmt+0x4f7>
+
+		// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800d16:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d1a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d1e:	48 89 c6             	mov    %rax,%rsi
+  800d21:	89 df                	mov    %ebx,%edi
+  800d23:	ff d2                	call   *%rdx
+			break;
+  800d25:	eb 2e                	jmp    800d55 <vprintfmt+0x4f7>
+
+		// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800d27:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d2b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d2f:	48 89 c6             	mov    %rax,%rsi
+  800d32:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d37:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800d39:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800d3e:	eb 05                	jmp    800d45 <vprintfmt+0x4e7>
+  800d40:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800d45:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800d49:	48 83 e8 01          	sub    $0x1,%rax
+  800d4d:	0f b6 00             	movzbl (%rax),%eax
+  800d50:	3c 25                	cmp    $0x25,%al
+  800d52:	75 ec                	jne    800d40 <vprintfmt+0x4e2>
+				/* do nothing */;
+			break;
+  800d54:	90                   	nop
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800d55:	e9 56 fb ff ff       	jmp    8008b0 <vprintfmt+0x52>
+				return;
+  800d5a:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800d5b:	48 83 c4 60          	add    $0x60,%rsp
+  800d5f:	5b                   	pop    %rbx
+  800d60:	41 5c                	pop    %r12
+  800d62:	5d                   	pop    %rbp
+  800d63:	c3                   	ret
+
+0000000000800d64 <printfmt>:
+
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...)
+{
+  800d64:	55                   	push   %rbp
+  800d65:	48 89 e5             	mov    %rsp,%rbp
+  800d68:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800d6f:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800d76:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800d7d:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800d84:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800d8b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800d92:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800d99:	84 c0                	test   %al,%al
+  800d9b:	74 20                	je     800dbd <printfmt+0x59>
+  800d9d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800da1:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800da5:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800da9:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800dad:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800db1:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800db5:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800db9:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800dbd:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800dc4:	00 00 00 
+  800dc7:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800dce:	00 00 00 
+  800dd1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800dd5:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800ddc:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800de3:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800dea:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800df1:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800df8:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800dff:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800e06:	48 89 c7             	mov    %rax,%rdi
+  800e09:	48 b8 5e 08 80 00 00 	movabs $0x80085e,%rax
+  800e10:	00 00 00 
+  800e13:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  800e15:	90                   	nop
+  800e16:	c9                   	leave
+  800e17:	c3                   	ret
+
+0000000000800e18 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800e18:	55                   	push   %rbp
+  800e19:	48 89 e5             	mov    %rsp,%rbp
+  800e1c:	48 83 ec 10          	sub    $0x10,%rsp
+  800e20:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800e23:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  800e27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e2b:	8b 40 10             	mov    0x10(%rax),%eax
+  800e2e:	8d 50 01             	lea    0x1(%rax),%edx
+  800e31:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e35:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  800e38:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e3c:	48 8b 10             	mov    (%rax),%rdx
+  800e3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e43:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e47:	48 39 c2             	cmp    %rax,%rdx
+  800e4a:	73 17                	jae    800e63 <sprintputch+0x4b>
+		*b->buf++ = ch;
+  800e4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e50:	48 8b 00             	mov    (%rax),%rax
+  800e53:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800e57:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800e5b:	48 89 0a             	mov    %rcx,(%rdx)
+  800e5e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800e61:	88 10                	mov    %dl,(%rax)
+}
+  800e63:	90                   	nop
+  800e64:	c9                   	leave
+  800e65:	c3                   	ret
+
+0000000000800e66 <vsnprintf>:
+
+int vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800e66:	55                   	push   %rbp
+  800e67:	48 89 e5             	mov    %rsp,%rbp
+  800e6a:	48 83 ec 50          	sub    $0x50,%rsp
+  800e6e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  800e72:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  800e75:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  800e79:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+	va_list aq;
+	va_copy(aq, ap);
+  800e7d:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800e81:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800e85:	48 8b 06             	mov    (%rsi),%rax
+  800e88:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800e8c:	48 89 01             	mov    %rax,(%rcx)
+  800e8f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800e93:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800e97:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	struct sprintbuf b = {buf, buf + n - 1, 0};
+  800e9b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e9f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800ea3:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  800ea6:	48 98                	cltq
+  800ea8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800eac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800eb0:	48 01 d0             	add    %rdx,%rax
+  800eb3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  800eb7:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+
+	if (buf == NULL || n < 1)
+  800ebe:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800ec3:	74 06                	je     800ecb <vsnprintf+0x65>
+  800ec5:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800ec9:	7f 07                	jg     800ed2 <vsnprintf+0x6c>
+		return -E_INVAL;
+  800ecb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ed0:	eb 32                	jmp    800f04 <vsnprintf+0x9e>
+
+	// print the string to the buffer
+	vprintfmt((void *)sprintputch, &b, fmt, aq);
+  800ed2:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800ed6:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  800eda:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ede:	48 89 c6             	mov    %rax,%rsi
+  800ee1:	48 b8 18 0e 80 00 00 	movabs $0x800e18,%rax
+  800ee8:	00 00 00 
+  800eeb:	48 89 c7             	mov    %rax,%rdi
+  800eee:	48 b8 5e 08 80 00 00 	movabs $0x80085e,%rax
+  800ef5:	00 00 00 
+  800ef8:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  800efa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800efe:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800f01:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  800f04:	c9                   	leave
+  800f05:	c3                   	ret
+
+0000000000800f06 <snprintf>:
+
+int snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800f06:	55                   	push   %rbp
+  800f07:	48 89 e5             	mov    %rsp,%rbp
+  800f0a:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800f11:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800f18:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800f1e:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800f25:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f2c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f33:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f3a:	84 c0                	test   %al,%al
+  800f3c:	74 20                	je     800f5e <snprintf+0x58>
+  800f3e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f42:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f46:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f4a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f4e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f52:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f56:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f5a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  800f5e:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800f65:	00 00 00 
+  800f68:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800f6f:	00 00 00 
+  800f72:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f76:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800f7d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f84:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq, ap);
+  800f8b:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800f92:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800f99:	48 8b 06             	mov    (%rsi),%rax
+  800f9c:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800fa0:	48 89 01             	mov    %rax,(%rcx)
+  800fa3:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800fa7:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800fab:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  800faf:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800fb6:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  800fbd:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  800fc3:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800fca:	48 89 c7             	mov    %rax,%rdi
+  800fcd:	48 b8 66 0e 80 00 00 	movabs $0x800e66,%rax
+  800fd4:	00 00 00 
+  800fd7:	ff d0                	call   *%rax
+  800fd9:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  800fdf:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800fe5:	c9                   	leave
+  800fe6:	c3                   	ret
+
+0000000000800fe7 <cpuid>:
+#define read_rip(var) __asm __volatile("leaq (%%rip), %0" : "=r" (var)::"cc","memory")
+
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800fe7:	55                   	push   %rbp
+  800fe8:	48 89 e5             	mov    %rsp,%rbp
+  800feb:	53                   	push   %rbx
+  800fec:	48 83 ec 38          	sub    $0x38,%rsp
+  800ff0:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800ff3:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800ff7:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800ffb:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800fff:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid" 
+  801003:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801006:	0f a2                	cpuid
+  801008:	89 de                	mov    %ebx,%esi
+  80100a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  80100d:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  801010:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  801013:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info));
+	if (eaxp)
+  801016:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80101b:	74 09                	je     801026 <cpuid+0x3f>
+		*eaxp = eax;
+  80101d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801021:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  801024:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  801026:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80102b:	74 09                	je     801036 <cpuid+0x4f>
+		*ebxp = ebx;
+  80102d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801031:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  801034:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  801036:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80103b:	74 09                	je     801046 <cpuid+0x5f>
+		*ecxp = ecx;
+  80103d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801041:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801044:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  801046:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80104b:	74 09                	je     801056 <cpuid+0x6f>
+		*edxp = edx;
+  80104d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801051:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801054:	89 10                	mov    %edx,(%rax)
+}
+  801056:	90                   	nop
+  801057:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80105b:	c9                   	leave
+  80105c:	c3                   	ret
+
+000000000080105d <cpuid_count>:
+
+// 带子功能号(%ecx = count)的 cpuid，用于 leaf 4/7/0xB/0xD 等
+static __inline void
+cpuid_count(uint32_t info, uint32_t count, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  80105d:	55                   	push   %rbp
+  80105e:	48 89 e5             	mov    %rsp,%rbp
+  801061:	53                   	push   %rbx
+  801062:	48 83 ec 38          	sub    $0x38,%rsp
+  801066:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  801069:	89 75 e0             	mov    %esi,-0x20(%rbp)
+  80106c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801070:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  801074:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+  801078:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  80107c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80107f:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  801082:	89 d1                	mov    %edx,%ecx
+  801084:	0f a2                	cpuid
+  801086:	89 de                	mov    %ebx,%esi
+  801088:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  80108b:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  80108e:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  801091:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info), "c" (count));
+	if (eaxp)
+  801094:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801099:	74 09                	je     8010a4 <cpuid_count+0x47>
+		*eaxp = eax;
+  80109b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80109f:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8010a2:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  8010a4:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8010a9:	74 09                	je     8010b4 <cpuid_count+0x57>
+		*ebxp = ebx;
+  8010ab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8010af:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8010b2:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  8010b4:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8010b9:	74 09                	je     8010c4 <cpuid_count+0x67>
+		*ecxp = ecx;
+  8010bb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010bf:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8010c2:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  8010c4:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8010c9:	74 09                	je     8010d4 <cpuid_count+0x77>
+		*edxp = edx;
+  8010cb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8010cf:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8010d2:	89 10                	mov    %edx,(%rax)
+}
+  8010d4:	90                   	nop
+  8010d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010d9:	c9                   	leave
+  8010da:	c3                   	ret
+
+00000000008010db <strlen>:
+// 在真正的硬件上会有一定程度的优化, 但在 Bochs 上会有更大的优化效果
+// 用这种方法, Primespipe 的运行速度快了3倍
+#define ASM 1
+
+int strlen(const char *s)
+{
+  8010db:	55                   	push   %rbp
+  8010dc:	48 89 e5             	mov    %rsp,%rbp
+  8010df:	48 83 ec 18          	sub    $0x18,%rsp
+  8010e3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8010e7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8010ee:	eb 09                	jmp    8010f9 <strlen+0x1e>
+		n++;
+  8010f0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8010f4:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8010f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010fd:	0f b6 00             	movzbl (%rax),%eax
+  801100:	84 c0                	test   %al,%al
+  801102:	75 ec                	jne    8010f0 <strlen+0x15>
+	return n;
+  801104:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801107:	c9                   	leave
+  801108:	c3                   	ret
+
+0000000000801109 <strnlen>:
+
+int strnlen(const char *s, size_t size)
+{
+  801109:	55                   	push   %rbp
+  80110a:	48 89 e5             	mov    %rsp,%rbp
+  80110d:	48 83 ec 20          	sub    $0x20,%rsp
+  801111:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801115:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801119:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801120:	eb 0e                	jmp    801130 <strnlen+0x27>
+		n++;
+  801122:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801126:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80112b:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801130:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801135:	74 0b                	je     801142 <strnlen+0x39>
+  801137:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80113b:	0f b6 00             	movzbl (%rax),%eax
+  80113e:	84 c0                	test   %al,%al
+  801140:	75 e0                	jne    801122 <strnlen+0x19>
+	return n;
+  801142:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801145:	c9                   	leave
+  801146:	c3                   	ret
+
+0000000000801147 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801147:	55                   	push   %rbp
+  801148:	48 89 e5             	mov    %rsp,%rbp
+  80114b:	48 83 ec 20          	sub    $0x20,%rsp
+  80114f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801153:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801157:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80115b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  80115f:	90                   	nop
+  801160:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801164:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801168:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80116c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801170:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801174:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801178:	0f b6 12             	movzbl (%rdx),%edx
+  80117b:	88 10                	mov    %dl,(%rax)
+  80117d:	0f b6 00             	movzbl (%rax),%eax
+  801180:	84 c0                	test   %al,%al
+  801182:	75 dc                	jne    801160 <strcpy+0x19>
+		/* do nothing */;
+	return ret;
+  801184:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801188:	c9                   	leave
+  801189:	c3                   	ret
+
+000000000080118a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80118a:	55                   	push   %rbp
+  80118b:	48 89 e5             	mov    %rsp,%rbp
+  80118e:	48 83 ec 20          	sub    $0x20,%rsp
+  801192:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801196:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int len = strlen(dst);
+  80119a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80119e:	48 89 c7             	mov    %rax,%rdi
+  8011a1:	48 b8 db 10 80 00 00 	movabs $0x8010db,%rax
+  8011a8:	00 00 00 
+  8011ab:	ff d0                	call   *%rax
+  8011ad:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	strcpy(dst + len, src);
+  8011b0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8011b3:	48 63 d0             	movslq %eax,%rdx
+  8011b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011ba:	48 01 c2             	add    %rax,%rdx
+  8011bd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8011c1:	48 89 c6             	mov    %rax,%rsi
+  8011c4:	48 89 d7             	mov    %rdx,%rdi
+  8011c7:	48 b8 47 11 80 00 00 	movabs $0x801147,%rax
+  8011ce:	00 00 00 
+  8011d1:	ff d0                	call   *%rax
+	return dst;
+  8011d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8011d7:	c9                   	leave
+  8011d8:	c3                   	ret
+
+00000000008011d9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8011d9:	55                   	push   %rbp
+  8011da:	48 89 e5             	mov    %rsp,%rbp
+  8011dd:	48 83 ec 28          	sub    $0x28,%rsp
+  8011e1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8011e5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8011e9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  8011ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011f1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++)
+  8011f5:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8011fc:	00 
+  8011fd:	eb 2a                	jmp    801229 <strncpy+0x50>
+	{
+		*dst++ = *src;
+  8011ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801203:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801207:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80120b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80120f:	0f b6 12             	movzbl (%rdx),%edx
+  801212:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801214:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801218:	0f b6 00             	movzbl (%rax),%eax
+  80121b:	84 c0                	test   %al,%al
+  80121d:	74 05                	je     801224 <strncpy+0x4b>
+			src++;
+  80121f:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++)
+  801224:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801229:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80122d:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801231:	72 cc                	jb     8011ff <strncpy+0x26>
+	}
+	return ret;
+  801233:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801237:	c9                   	leave
+  801238:	c3                   	ret
+
+0000000000801239 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801239:	55                   	push   %rbp
+  80123a:	48 89 e5             	mov    %rsp,%rbp
+  80123d:	48 83 ec 28          	sub    $0x28,%rsp
+  801241:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801245:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801249:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  80124d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801251:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0)
+  801255:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80125a:	74 3d                	je     801299 <strlcpy+0x60>
+	{
+		while (--size > 0 && *src != '\0')
+  80125c:	eb 1d                	jmp    80127b <strlcpy+0x42>
+			*dst++ = *src++;
+  80125e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801262:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801266:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80126a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80126e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801272:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801276:	0f b6 12             	movzbl (%rdx),%edx
+  801279:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  80127b:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801280:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801285:	74 0b                	je     801292 <strlcpy+0x59>
+  801287:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80128b:	0f b6 00             	movzbl (%rax),%eax
+  80128e:	84 c0                	test   %al,%al
+  801290:	75 cc                	jne    80125e <strlcpy+0x25>
+		*dst = '\0';
+  801292:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801296:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801299:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80129d:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8012a1:	c9                   	leave
+  8012a2:	c3                   	ret
+
+00000000008012a3 <strcmp>:
+
+int strcmp(const char *p, const char *q)
+{
+  8012a3:	55                   	push   %rbp
+  8012a4:	48 89 e5             	mov    %rsp,%rbp
+  8012a7:	48 83 ec 10          	sub    $0x10,%rsp
+  8012ab:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8012af:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8012b3:	eb 0a                	jmp    8012bf <strcmp+0x1c>
+		p++, q++;
+  8012b5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8012ba:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8012bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012c3:	0f b6 00             	movzbl (%rax),%eax
+  8012c6:	84 c0                	test   %al,%al
+  8012c8:	74 12                	je     8012dc <strcmp+0x39>
+  8012ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012ce:	0f b6 10             	movzbl (%rax),%edx
+  8012d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012d5:	0f b6 00             	movzbl (%rax),%eax
+  8012d8:	38 c2                	cmp    %al,%dl
+  8012da:	74 d9                	je     8012b5 <strcmp+0x12>
+	return (int)((unsigned char)*p - (unsigned char)*q);
+  8012dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012e0:	0f b6 00             	movzbl (%rax),%eax
+  8012e3:	0f b6 d0             	movzbl %al,%edx
+  8012e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012ea:	0f b6 00             	movzbl (%rax),%eax
+  8012ed:	0f b6 c0             	movzbl %al,%eax
+  8012f0:	29 c2                	sub    %eax,%edx
+  8012f2:	89 d0                	mov    %edx,%eax
+}
+  8012f4:	c9                   	leave
+  8012f5:	c3                   	ret
+
+00000000008012f6 <strncmp>:
+
+int strncmp(const char *p, const char *q, size_t n)
+{
+  8012f6:	55                   	push   %rbp
+  8012f7:	48 89 e5             	mov    %rsp,%rbp
+  8012fa:	48 83 ec 18          	sub    $0x18,%rsp
+  8012fe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801302:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801306:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80130a:	eb 0f                	jmp    80131b <strncmp+0x25>
+		n--, p++, q++;
+  80130c:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801311:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801316:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80131b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801320:	74 1d                	je     80133f <strncmp+0x49>
+  801322:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801326:	0f b6 00             	movzbl (%rax),%eax
+  801329:	84 c0                	test   %al,%al
+  80132b:	74 12                	je     80133f <strncmp+0x49>
+  80132d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801331:	0f b6 10             	movzbl (%rax),%edx
+  801334:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801338:	0f b6 00             	movzbl (%rax),%eax
+  80133b:	38 c2                	cmp    %al,%dl
+  80133d:	74 cd                	je     80130c <strncmp+0x16>
+	if (n == 0)
+  80133f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801344:	75 07                	jne    80134d <strncmp+0x57>
+		return 0;
+  801346:	ba 00 00 00 00       	mov    $0x0,%edx
+  80134b:	eb 16                	jmp    801363 <strncmp+0x6d>
+	else
+		return (int)((unsigned char)*p - (unsigned char)*q);
+  80134d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801351:	0f b6 00             	movzbl (%rax),%eax
+  801354:	0f b6 d0             	movzbl %al,%edx
+  801357:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80135b:	0f b6 00             	movzbl (%rax),%eax
+  80135e:	0f b6 c0             	movzbl %al,%eax
+  801361:	29 c2                	sub    %eax,%edx
+}
+  801363:	89 d0                	mov    %edx,%eax
+  801365:	c9                   	leave
+  801366:	c3                   	ret
+
+0000000000801367 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801367:	55                   	push   %rbp
+  801368:	48 89 e5             	mov    %rsp,%rbp
+  80136b:	48 83 ec 10          	sub    $0x10,%rsp
+  80136f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801373:	89 f0                	mov    %esi,%eax
+  801375:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801378:	eb 17                	jmp    801391 <strchr+0x2a>
+		if (*s == c)
+  80137a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80137e:	0f b6 00             	movzbl (%rax),%eax
+  801381:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801384:	75 06                	jne    80138c <strchr+0x25>
+			return (char *)s;
+  801386:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80138a:	eb 15                	jmp    8013a1 <strchr+0x3a>
+	for (; *s; s++)
+  80138c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801391:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801395:	0f b6 00             	movzbl (%rax),%eax
+  801398:	84 c0                	test   %al,%al
+  80139a:	75 de                	jne    80137a <strchr+0x13>
+	return 0;
+  80139c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013a1:	c9                   	leave
+  8013a2:	c3                   	ret
+
+00000000008013a3 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8013a3:	55                   	push   %rbp
+  8013a4:	48 89 e5             	mov    %rsp,%rbp
+  8013a7:	48 83 ec 10          	sub    $0x10,%rsp
+  8013ab:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8013af:	89 f0                	mov    %esi,%eax
+  8013b1:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8013b4:	eb 11                	jmp    8013c7 <strfind+0x24>
+		if (*s == c)
+  8013b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013ba:	0f b6 00             	movzbl (%rax),%eax
+  8013bd:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8013c0:	74 12                	je     8013d4 <strfind+0x31>
+	for (; *s; s++)
+  8013c2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8013c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013cb:	0f b6 00             	movzbl (%rax),%eax
+  8013ce:	84 c0                	test   %al,%al
+  8013d0:	75 e4                	jne    8013b6 <strfind+0x13>
+  8013d2:	eb 01                	jmp    8013d5 <strfind+0x32>
+			break;
+  8013d4:	90                   	nop
+	return (char *)s;
+  8013d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8013d9:	c9                   	leave
+  8013da:	c3                   	ret
+
+00000000008013db <mem_init>:
+};
+
+static int mem_features;
+
+void mem_init(void)
+{
+  8013db:	55                   	push   %rbp
+  8013dc:	48 89 e5             	mov    %rsp,%rbp
+  8013df:	48 83 ec 10          	sub    $0x10,%rsp
+	uint32_t max, ebx, edx;
+
+	mem_features = 0;
+  8013e3:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8013ea:	00 00 00 
+  8013ed:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	cpuid(0, &max, NULL, NULL, NULL);
+  8013f3:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+  8013f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801402:	ba 00 00 00 00       	mov    $0x0,%edx
+  801407:	48 89 c6             	mov    %rax,%rsi
+  80140a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80140f:	48 b8 e7 0f 80 00 00 	movabs $0x800fe7,%rax
+  801416:	00 00 00 
+  801419:	ff d0                	call   *%rax
+	cpuid(1, NULL, NULL, NULL, &edx);
+  80141b:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  80141f:	49 89 c0             	mov    %rax,%r8
+  801422:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801427:	ba 00 00 00 00       	mov    $0x0,%edx
+  80142c:	be 00 00 00 00       	mov    $0x0,%esi
+  801431:	bf 01 00 00 00       	mov    $0x1,%edi
+  801436:	48 b8 e7 0f 80 00 00 	movabs $0x800fe7,%rax
+  80143d:	00 00 00 
+  801440:	ff d0                	call   *%rax
+	if (edx & (1 << 26))
+  801442:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801445:	25 00 00 00 04       	and    $0x4000000,%eax
+  80144a:	85 c0                	test   %eax,%eax
+  80144c:	74 1d                	je     80146b <mem_init+0x90>
+		mem_features |= MEM_F_NT;
+  80144e:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  801455:	00 00 00 
+  801458:	8b 00                	mov    (%rax),%eax
+  80145a:	83 c8 02             	or     $0x2,%eax
+  80145d:	89 c2                	mov    %eax,%edx
+  80145f:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  801466:	00 00 00 
+  801469:	89 10                	mov    %edx,(%rax)
+	if (max >= 7)
+  80146b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80146e:	83 f8 06             	cmp    $0x6,%eax
+  801471:	76 57                	jbe    8014ca <mem_init+0xef>
+	{
+		cpuid_count(7, 0, NULL, &ebx, NULL, NULL);
+  801473:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801477:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80147d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801483:	48 89 c1             	mov    %rax,%rcx
+  801486:	ba 00 00 00 00       	mov    $0x0,%edx
+  80148b:	be 00 00 00 00       	mov    $0x0,%esi
+  801490:	bf 07 00 00 00       	mov    $0x7,%edi
+  801495:	48 b8 5d 10 80 00 00 	movabs $0x80105d,%rax
+  80149c:	00 00 00 
+  80149f:	ff d0                	call   *%rax
+		if (ebx & (1 << 9))
+  8014a1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8014a4:	25 00 02 00 00       	and    $0x200,%eax
+  8014a9:	85 c0                	test   %eax,%eax
+  8014ab:	74 1d                	je     8014ca <mem_init+0xef>
+			mem_features |= MEM_F_ERMS;
+  8014ad:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8014b4:	00 00 00 
+  8014b7:	8b 00                	mov    (%rax),%eax
+  8014b9:	83 c8 01             	or     $0x1,%eax
+  8014bc:	89 c2                	mov    %eax,%edx
+  8014be:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8014c5:	00 00 00 
+  8014c8:	89 10                	mov    %edx,(%rax)
+	}
+}
+  8014ca:	90                   	nop
+  8014cb:	c9                   	leave
+  8014cc:	c3                   	ret
+
+00000000008014cd <memset_nt>:
+
+// 非临时存储填充 n 字节(v 8 字节对齐，n 为 32 的倍数)
+static void
+memset_nt(void *v, uint64_t pattern, size_t n)
+{
+  8014cd:	55                   	push   %rbp
+  8014ce:	48 89 e5             	mov    %rsp,%rbp
+  8014d1:	48 83 ec 28          	sub    $0x28,%rsp
+  8014d5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014d9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8014dd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t *p = (uint64_t *)v;
+  8014e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014e5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint64_t *end = p + n / 8;
+  8014e9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8014ed:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  8014f1:	48 89 c2             	mov    %rax,%rdx
+  8014f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014f8:	48 01 d0             	add    %rdx,%rax
+  8014fb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	for (; p < end; p += 4)
+  8014ff:	eb 20                	jmp    801521 <memset_nt+0x54>
+		asm volatile("movnti %1, 0(%0)\n\t"
+  801501:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801505:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801509:	48 0f c3 10          	movnti %rdx,(%rax)
+  80150d:	48 0f c3 50 08       	movnti %rdx,0x8(%rax)
+  801512:	48 0f c3 50 10       	movnti %rdx,0x10(%rax)
+  801517:	48 0f c3 50 18       	movnti %rdx,0x18(%rax)
+	for (; p < end; p += 4)
+  80151c:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  801521:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801525:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801529:	72 d6                	jb     801501 <memset_nt+0x34>
+					 "movnti %1, 16(%0)\n\t"
+					 "movnti %1, 24(%0)"
+					 :
+					 : "r"(p), "r"(pattern)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  80152b:	0f ae f8             	sfence
+}
+  80152e:	90                   	nop
+  80152f:	c9                   	leave
+  801530:	c3                   	ret
+
+0000000000801531 <memcpy_nt>:
+
+// 非临时存储复制 n 字节(dst/src 8 字节对齐且不重叠，n 为 32 的倍数)
+static void
+memcpy_nt(void *dst, const void *src, size_t n)
+{
+  801531:	55                   	push   %rbp
+  801532:	48 89 e5             	mov    %rsp,%rbp
+  801535:	48 83 ec 58          	sub    $0x58,%rsp
+  801539:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80153d:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801541:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	uint64_t *d = (uint64_t *)dst;
+  801545:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801549:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint64_t *s = (const uint64_t *)src;
+  80154d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801551:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	uint64_t *end = d + n / 8;
+  801555:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801559:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  80155d:	48 89 c2             	mov    %rax,%rdx
+  801560:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801564:	48 01 d0             	add    %rdx,%rax
+  801567:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint64_t t0, t1, t2, t3;
+
+	for (; d < end; d += 4, s += 4)
+  80156b:	eb 44                	jmp    8015b1 <memcpy_nt+0x80>
+		asm volatile("movq 0(%4), %0\n\t"
+  80156d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801571:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801575:	4c 8b 00             	mov    (%rax),%r8
+  801578:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  80157c:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  801580:	48 8b 48 18          	mov    0x18(%rax),%rcx
+  801584:	4c 0f c3 02          	movnti %r8,(%rdx)
+  801588:	48 0f c3 7a 08       	movnti %rdi,0x8(%rdx)
+  80158d:	48 0f c3 72 10       	movnti %rsi,0x10(%rdx)
+  801592:	48 0f c3 4a 18       	movnti %rcx,0x18(%rdx)
+  801597:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80159b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80159f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8015a3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+	for (; d < end; d += 4, s += 4)
+  8015a7:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  8015ac:	48 83 45 f0 20       	addq   $0x20,-0x10(%rbp)
+  8015b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015b5:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  8015b9:	72 b2                	jb     80156d <memcpy_nt+0x3c>
+					 "movnti %2, 16(%5)\n\t"
+					 "movnti %3, 24(%5)"
+					 : "=&r"(t0), "=&r"(t1), "=&r"(t2), "=&r"(t3)
+					 : "r"(s), "r"(d)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  8015bb:	0f ae f8             	sfence
+}
+  8015be:	90                   	nop
+  8015bf:	c9                   	leave
+  8015c0:	c3                   	ret
+
+00000000008015c1 <memcpy_fwd>:
+
+// 正向复制(dst 在 src 之前或两者不重叠)
+static void
+memcpy_fwd(void *dst, const void *src, size_t n)
+{
+  8015c1:	55                   	push   %rbp
+  8015c2:	48 89 e5             	mov    %rsp,%rbp
+  8015c5:	48 83 ec 18          	sub    $0x18,%rsp
+  8015c9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015cd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8015d1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  8015d5:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8015dc:	00 00 00 
+  8015df:	8b 00                	mov    (%rax),%eax
+  8015e1:	83 e0 02             	and    $0x2,%eax
+  8015e4:	85 c0                	test   %eax,%eax
+  8015e6:	74 66                	je     80164e <memcpy_fwd+0x8d>
+  8015e8:	48 81 7d e8 ff 0f 00 	cmpq   $0xfff,-0x18(%rbp)
+  8015ef:	00 
+  8015f0:	76 5c                	jbe    80164e <memcpy_fwd+0x8d>
+  8015f2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8015f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015fa:	48 09 d0             	or     %rdx,%rax
+  8015fd:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  801601:	83 e0 1f             	and    $0x1f,%eax
+  801604:	48 85 c0             	test   %rax,%rax
+  801607:	75 45                	jne    80164e <memcpy_fwd+0x8d>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  801609:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80160d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801611:	48 01 d0             	add    %rdx,%rax
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  801614:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801618:	73 11                	jae    80162b <memcpy_fwd+0x6a>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  80161a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80161e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801622:	48 01 d0             	add    %rdx,%rax
+  801625:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801629:	72 23                	jb     80164e <memcpy_fwd+0x8d>
+		memcpy_nt(dst, src, n);
+  80162b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80162f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801633:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801637:	48 89 ce             	mov    %rcx,%rsi
+  80163a:	48 89 c7             	mov    %rax,%rdi
+  80163d:	48 b8 31 15 80 00 00 	movabs $0x801531,%rax
+  801644:	00 00 00 
+  801647:	ff d0                	call   *%rax
+  801649:	e9 81 00 00 00       	jmp    8016cf <memcpy_fwd+0x10e>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  80164e:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  801655:	00 00 00 
+  801658:	8b 00                	mov    (%rax),%eax
+  80165a:	83 e0 01             	and    $0x1,%eax
+  80165d:	85 c0                	test   %eax,%eax
+  80165f:	74 21                	je     801682 <memcpy_fwd+0xc1>
+  801661:	48 81 7d e8 ff 00 00 	cmpq   $0xff,-0x18(%rbp)
+  801668:	00 
+  801669:	76 17                	jbe    801682 <memcpy_fwd+0xc1>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  80166b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80166f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801673:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801677:	48 89 c7             	mov    %rax,%rdi
+  80167a:	48 89 d6             	mov    %rdx,%rsi
+  80167d:	fc                   	cld
+  80167e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801680:	eb 4d                	jmp    8016cf <memcpy_fwd+0x10e>
+					 : "cc", "memory");
+	else if ((((uint64_t)dst | (uint64_t)src | n) & 7) == 0)
+  801682:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801686:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80168a:	48 09 d0             	or     %rdx,%rax
+  80168d:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  801691:	83 e0 07             	and    $0x7,%eax
+  801694:	48 85 c0             	test   %rax,%rax
+  801697:	75 1f                	jne    8016b8 <memcpy_fwd+0xf7>
+		asm volatile("cld; rep movsq\n" ::"D"(dst), "S"(src), "c"(n / 8)
+  801699:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80169d:	48 c1 e8 03          	shr    $0x3,%rax
+  8016a1:	48 89 c1             	mov    %rax,%rcx
+  8016a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016a8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8016ac:	48 89 c7             	mov    %rax,%rdi
+  8016af:	48 89 d6             	mov    %rdx,%rsi
+  8016b2:	fc                   	cld
+  8016b3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+					 : "cc", "memory");
+}
+  8016b6:	eb 17                	jmp    8016cf <memcpy_fwd+0x10e>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  8016b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016bc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8016c0:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8016c4:	48 89 c7             	mov    %rax,%rdi
+  8016c7:	48 89 d6             	mov    %rdx,%rsi
+  8016ca:	fc                   	cld
+  8016cb:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+  8016cd:	eb 00                	jmp    8016cf <memcpy_fwd+0x10e>
+  8016cf:	90                   	nop
+  8016d0:	c9                   	leave
+  8016d1:	c3                   	ret
+
+00000000008016d2 <memset>:
+
+void *
+memset(void *v, int c, size_t n)
+{
+  8016d2:	55                   	push   %rbp
+  8016d3:	48 89 e5             	mov    %rsp,%rbp
+  8016d6:	48 83 ec 28          	sub    $0x28,%rsp
+  8016da:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016de:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8016e1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t pattern;
+
+	if (n == 0)
+  8016e5:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016ea:	75 09                	jne    8016f5 <memset+0x23>
+		return v;
+  8016ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016f0:	e9 dc 00 00 00       	jmp    8017d1 <memset+0xff>
+	c &= 0xFF;
+  8016f5:	81 65 e4 ff 00 00 00 	andl   $0xff,-0x1c(%rbp)
+	pattern = (uint64_t)c * 0x0101010101010101UL;
+  8016fc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8016ff:	48 98                	cltq
+  801701:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801708:	01 01 01 
+  80170b:	48 0f af c2          	imul   %rdx,%rax
+  80170f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)v | n) & 31) == 0)
+  801713:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  80171a:	00 00 00 
+  80171d:	8b 00                	mov    (%rax),%eax
+  80171f:	83 e0 02             	and    $0x2,%eax
+  801722:	85 c0                	test   %eax,%eax
+  801724:	74 3a                	je     801760 <memset+0x8e>
+  801726:	48 81 7d d8 ff 0f 00 	cmpq   $0xfff,-0x28(%rbp)
+  80172d:	00 
+  80172e:	76 30                	jbe    801760 <memset+0x8e>
+  801730:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801734:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  801738:	83 e0 1f             	and    $0x1f,%eax
+  80173b:	48 85 c0             	test   %rax,%rax
+  80173e:	75 20                	jne    801760 <memset+0x8e>
+		memset_nt(v, pattern, n);
+  801740:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801744:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801748:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80174c:	48 89 ce             	mov    %rcx,%rsi
+  80174f:	48 89 c7             	mov    %rax,%rdi
+  801752:	48 b8 cd 14 80 00 00 	movabs $0x8014cd,%rax
+  801759:	00 00 00 
+  80175c:	ff d0                	call   *%rax
+  80175e:	eb 6d                	jmp    8017cd <memset+0xfb>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  801760:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  801767:	00 00 00 
+  80176a:	8b 00                	mov    (%rax),%eax
+  80176c:	83 e0 01             	and    $0x1,%eax
+  80176f:	85 c0                	test   %eax,%eax
+  801771:	74 1d                	je     801790 <memset+0xbe>
+  801773:	48 81 7d d8 ff 00 00 	cmpq   $0xff,-0x28(%rbp)
+  80177a:	00 
+  80177b:	76 13                	jbe    801790 <memset+0xbe>
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  80177d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801781:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801784:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801788:	48 89 d7             	mov    %rdx,%rdi
+  80178b:	fc                   	cld
+  80178c:	f3 aa                	rep stos %al,%es:(%rdi)
+  80178e:	eb 3d                	jmp    8017cd <memset+0xfb>
+					 : "cc", "memory");
+	else if ((((uint64_t)v | n) & 7) == 0)
+  801790:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801794:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  801798:	83 e0 07             	and    $0x7,%eax
+  80179b:	48 85 c0             	test   %rax,%rax
+  80179e:	75 1c                	jne    8017bc <memset+0xea>
+		asm volatile("cld; rep stosq\n" ::"D"(v), "a"(pattern), "c"(n / 8)
+  8017a0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017a4:	48 c1 e8 03          	shr    $0x3,%rax
+  8017a8:	48 89 c1             	mov    %rax,%rcx
+  8017ab:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8017af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017b3:	48 89 d7             	mov    %rdx,%rdi
+  8017b6:	fc                   	cld
+  8017b7:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8017ba:	eb 11                	jmp    8017cd <memset+0xfb>
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  8017bc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8017c0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8017c3:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8017c7:	48 89 d7             	mov    %rdx,%rdi
+  8017ca:	fc                   	cld
+  8017cb:	f3 aa                	rep stos %al,%es:(%rdi)
+					 : "cc", "memory");
+	return v;
+  8017cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8017d1:	c9                   	leave
+  8017d2:	c3                   	ret
+
+00000000008017d3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8017d3:	55                   	push   %rbp
+  8017d4:	48 89 e5             	mov    %rsp,%rbp
+  8017d7:	48 83 ec 28          	sub    $0x28,%rsp
+  8017db:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017df:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8017e3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  8017e7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017eb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8017ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017f3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d)
+  8017f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017fb:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8017ff:	73 7c                	jae    80187d <memmove+0xaa>
+  801801:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801805:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801809:	48 01 d0             	add    %rdx,%rax
+  80180c:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801810:	73 6b                	jae    80187d <memmove+0xaa>
+	{
+		// 重叠且 dst 在 src 之后，只能反向复制(ERMS 对反向 rep movsb 没有优化)
+		s += n;
+  801812:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801816:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  80181a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80181e:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((((uint64_t)s | (uint64_t)d | n) & 7) == 0)
+  801822:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801826:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80182a:	48 09 d0             	or     %rdx,%rax
+  80182d:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  801831:	83 e0 07             	and    $0x7,%eax
+  801834:	48 85 c0             	test   %rax,%rax
+  801837:	75 24                	jne    80185d <memmove+0x8a>
+			asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801839:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80183d:	48 83 e8 08          	sub    $0x8,%rax
+  801841:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801845:	48 83 ea 08          	sub    $0x8,%rdx
+  801849:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80184d:	48 c1 e9 03          	shr    $0x3,%rcx
+  801851:	48 89 c7             	mov    %rax,%rdi
+  801854:	48 89 d6             	mov    %rdx,%rsi
+  801857:	fd                   	std
+  801858:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80185b:	eb 1d                	jmp    80187a <memmove+0xa7>
+						 : "cc", "memory");
+		else
+			asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80185d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801861:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801865:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801869:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+  80186d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801871:	48 89 d7             	mov    %rdx,%rdi
+  801874:	48 89 c1             	mov    %rax,%rcx
+  801877:	fd                   	std
+  801878:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+						 : "cc", "memory");
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::
+  80187a:	fc                   	cld
+  80187b:	eb 25                	jmp    8018a2 <memmove+0xcf>
+						 : "cc");
+	}
+	else if (n)
+  80187d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801882:	74 1e                	je     8018a2 <memmove+0xcf>
+		memcpy_fwd(d, s, n);
+  801884:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801888:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80188c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801890:	48 89 ce             	mov    %rcx,%rsi
+  801893:	48 89 c7             	mov    %rax,%rdi
+  801896:	48 b8 c1 15 80 00 00 	movabs $0x8015c1,%rax
+  80189d:	00 00 00 
+  8018a0:	ff d0                	call   *%rax
+	return dst;
+  8018a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8018a6:	c9                   	leave
+  8018a7:	c3                   	ret
+
+00000000008018a8 <memcpy>:
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8018a8:	55                   	push   %rbp
+  8018a9:	48 89 e5             	mov    %rsp,%rbp
+  8018ac:	48 83 ec 18          	sub    $0x18,%rsp
+  8018b0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8018b4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8018b8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (n)
+  8018bc:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8018c1:	74 1e                	je     8018e1 <memcpy+0x39>
+		memcpy_fwd(dst, src, n);
+  8018c3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018c7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8018cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018cf:	48 89 ce             	mov    %rcx,%rsi
+  8018d2:	48 89 c7             	mov    %rax,%rdi
+  8018d5:	48 b8 c1 15 80 00 00 	movabs $0x8015c1,%rax
+  8018dc:	00 00 00 
+  8018df:	ff d0                	call   *%rax
+	return dst;
+  8018e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8018e5:	c9                   	leave
+  8018e6:	c3                   	ret
+
+00000000008018e7 <memcmp>:
+{
+}
+#endif
+
+int memcmp(const void *v1, const void *v2, size_t n)
+{
+  8018e7:	55                   	push   %rbp
+  8018e8:	48 89 e5             	mov    %rsp,%rbp
+  8018eb:	48 83 ec 28          	sub    $0x28,%rsp
+  8018ef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8018f3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8018f7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *)v1;
+  8018fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018ff:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *)v2;
+  801903:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801907:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0)
+  80190b:	eb 34                	jmp    801941 <memcmp+0x5a>
+	{
+		if (*s1 != *s2)
+  80190d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801911:	0f b6 10             	movzbl (%rax),%edx
+  801914:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801918:	0f b6 00             	movzbl (%rax),%eax
+  80191b:	38 c2                	cmp    %al,%dl
+  80191d:	74 18                	je     801937 <memcmp+0x50>
+			return (int)*s1 - (int)*s2;
+  80191f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801923:	0f b6 00             	movzbl (%rax),%eax
+  801926:	0f b6 d0             	movzbl %al,%edx
+  801929:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80192d:	0f b6 00             	movzbl (%rax),%eax
+  801930:	0f b6 c0             	movzbl %al,%eax
+  801933:	29 c2                	sub    %eax,%edx
+  801935:	eb 20                	jmp    801957 <memcmp+0x70>
+		s1++, s2++;
+  801937:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80193c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0)
+  801941:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801945:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801949:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80194d:	48 85 c0             	test   %rax,%rax
+  801950:	75 bb                	jne    80190d <memcmp+0x26>
+	}
+
+	return 0;
+  801952:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801957:	89 d0                	mov    %edx,%eax
+  801959:	c9                   	leave
+  80195a:	c3                   	ret
+
+000000000080195b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80195b:	55                   	push   %rbp
+  80195c:	48 89 e5             	mov    %rsp,%rbp
+  80195f:	48 83 ec 28          	sub    $0x28,%rsp
+  801963:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801967:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  80196a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *)s + n;
+  80196e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801972:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801976:	48 01 d0             	add    %rdx,%rax
+  801979:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  80197d:	eb 13                	jmp    801992 <memfind+0x37>
+		if (*(const unsigned char *)s == (unsigned char)c)
+  80197f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801983:	0f b6 00             	movzbl (%rax),%eax
+  801986:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801989:	38 d0                	cmp    %dl,%al
+  80198b:	74 11                	je     80199e <memfind+0x43>
+	for (; s < ends; s++)
+  80198d:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801992:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801996:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80199a:	72 e3                	jb     80197f <memfind+0x24>
+  80199c:	eb 01                	jmp    80199f <memfind+0x44>
+			break;
+  80199e:	90                   	nop
+	return (void *)s;
+  80199f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8019a3:	c9                   	leave
+  8019a4:	c3                   	ret
+
+00000000008019a5 <strtol>:
+
+long strtol(const char *s, char **endptr, int base)
+{
+  8019a5:	55                   	push   %rbp
+  8019a6:	48 89 e5             	mov    %rsp,%rbp
+  8019a9:	48 83 ec 38          	sub    $0x38,%rsp
+  8019ad:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8019b1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8019b5:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  8019b8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  8019bf:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8019c6:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8019c7:	eb 05                	jmp    8019ce <strtol+0x29>
+		s++;
+  8019c9:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  8019ce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019d2:	0f b6 00             	movzbl (%rax),%eax
+  8019d5:	3c 20                	cmp    $0x20,%al
+  8019d7:	74 f0                	je     8019c9 <strtol+0x24>
+  8019d9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019dd:	0f b6 00             	movzbl (%rax),%eax
+  8019e0:	3c 09                	cmp    $0x9,%al
+  8019e2:	74 e5                	je     8019c9 <strtol+0x24>
+
+	// plus/minus sign
+	if (*s == '+')
+  8019e4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019e8:	0f b6 00             	movzbl (%rax),%eax
+  8019eb:	3c 2b                	cmp    $0x2b,%al
+  8019ed:	75 07                	jne    8019f6 <strtol+0x51>
+		s++;
+  8019ef:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8019f4:	eb 17                	jmp    801a0d <strtol+0x68>
+	else if (*s == '-')
+  8019f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019fa:	0f b6 00             	movzbl (%rax),%eax
+  8019fd:	3c 2d                	cmp    $0x2d,%al
+  8019ff:	75 0c                	jne    801a0d <strtol+0x68>
+		s++, neg = 1;
+  801a01:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a06:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801a0d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801a11:	74 06                	je     801a19 <strtol+0x74>
+  801a13:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801a17:	75 28                	jne    801a41 <strtol+0x9c>
+  801a19:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a1d:	0f b6 00             	movzbl (%rax),%eax
+  801a20:	3c 30                	cmp    $0x30,%al
+  801a22:	75 1d                	jne    801a41 <strtol+0x9c>
+  801a24:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a28:	48 83 c0 01          	add    $0x1,%rax
+  801a2c:	0f b6 00             	movzbl (%rax),%eax
+  801a2f:	3c 78                	cmp    $0x78,%al
+  801a31:	75 0e                	jne    801a41 <strtol+0x9c>
+		s += 2, base = 16;
+  801a33:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801a38:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801a3f:	eb 2c                	jmp    801a6d <strtol+0xc8>
+	else if (base == 0 && s[0] == '0')
+  801a41:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801a45:	75 19                	jne    801a60 <strtol+0xbb>
+  801a47:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a4b:	0f b6 00             	movzbl (%rax),%eax
+  801a4e:	3c 30                	cmp    $0x30,%al
+  801a50:	75 0e                	jne    801a60 <strtol+0xbb>
+		s++, base = 8;
+  801a52:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a57:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801a5e:	eb 0d                	jmp    801a6d <strtol+0xc8>
+	else if (base == 0)
+  801a60:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801a64:	75 07                	jne    801a6d <strtol+0xc8>
+		base = 10;
+  801a66:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+	// digits
+	while (1)
+	{
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801a6d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a71:	0f b6 00             	movzbl (%rax),%eax
+  801a74:	3c 2f                	cmp    $0x2f,%al
+  801a76:	7e 1d                	jle    801a95 <strtol+0xf0>
+  801a78:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a7c:	0f b6 00             	movzbl (%rax),%eax
+  801a7f:	3c 39                	cmp    $0x39,%al
+  801a81:	7f 12                	jg     801a95 <strtol+0xf0>
+			dig = *s - '0';
+  801a83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a87:	0f b6 00             	movzbl (%rax),%eax
+  801a8a:	0f be c0             	movsbl %al,%eax
+  801a8d:	83 e8 30             	sub    $0x30,%eax
+  801a90:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801a93:	eb 4e                	jmp    801ae3 <strtol+0x13e>
+		else if (*s >= 'a' && *s <= 'z')
+  801a95:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a99:	0f b6 00             	movzbl (%rax),%eax
+  801a9c:	3c 60                	cmp    $0x60,%al
+  801a9e:	7e 1d                	jle    801abd <strtol+0x118>
+  801aa0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aa4:	0f b6 00             	movzbl (%rax),%eax
+  801aa7:	3c 7a                	cmp    $0x7a,%al
+  801aa9:	7f 12                	jg     801abd <strtol+0x118>
+			dig = *s - 'a' + 10;
+  801aab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aaf:	0f b6 00             	movzbl (%rax),%eax
+  801ab2:	0f be c0             	movsbl %al,%eax
+  801ab5:	83 e8 57             	sub    $0x57,%eax
+  801ab8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801abb:	eb 26                	jmp    801ae3 <strtol+0x13e>
+		else if (*s >= 'A' && *s <= 'Z')
+  801abd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ac1:	0f b6 00             	movzbl (%rax),%eax
+  801ac4:	3c 40                	cmp    $0x40,%al
+  801ac6:	7e 47                	jle    801b0f <strtol+0x16a>
+  801ac8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801acc:	0f b6 00             	movzbl (%rax),%eax
+  801acf:	3c 5a                	cmp    $0x5a,%al
+  801ad1:	7f 3c                	jg     801b0f <strtol+0x16a>
+			dig = *s - 'A' + 10;
+  801ad3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ad7:	0f b6 00             	movzbl (%rax),%eax
+  801ada:	0f be c0             	movsbl %al,%eax
+  801add:	83 e8 37             	sub    $0x37,%eax
+  801ae0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801ae3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ae6:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801ae9:	7d 23                	jge    801b0e <strtol+0x169>
+			break;
+		s++, val = (val * base) + dig;
+  801aeb:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801af0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801af3:	48 98                	cltq
+  801af5:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801afa:	48 89 c2             	mov    %rax,%rdx
+  801afd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801b00:	48 98                	cltq
+  801b02:	48 01 d0             	add    %rdx,%rax
+  801b05:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+  801b09:	e9 5f ff ff ff       	jmp    801a6d <strtol+0xc8>
+			break;
+  801b0e:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801b0f:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801b14:	74 0b                	je     801b21 <strtol+0x17c>
+		*endptr = (char *)s;
+  801b16:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b1a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801b1e:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801b21:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b25:	74 09                	je     801b30 <strtol+0x18b>
+  801b27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b2b:	48 f7 d8             	neg    %rax
+  801b2e:	eb 04                	jmp    801b34 <strtol+0x18f>
+  801b30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801b34:	c9                   	leave
+  801b35:	c3                   	ret
+
+0000000000801b36 <strstr>:
+
+char *strstr(const char *in, const char *str)
+{
+  801b36:	55                   	push   %rbp
+  801b37:	48 89 e5             	mov    %rsp,%rbp
+  801b3a:	48 83 ec 30          	sub    $0x30,%rsp
+  801b3e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b42:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801b46:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b4a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b4e:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801b52:	0f b6 00             	movzbl (%rax),%eax
+  801b55:	88 45 ff             	mov    %al,-0x1(%rbp)
+	if (!c)
+  801b58:	80 7d ff 00          	cmpb   $0x0,-0x1(%rbp)
+  801b5c:	75 06                	jne    801b64 <strstr+0x2e>
+		return (char *)in; // Trivial empty string case
+  801b5e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b62:	eb 6b                	jmp    801bcf <strstr+0x99>
+
+	len = strlen(str);
+  801b64:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b68:	48 89 c7             	mov    %rax,%rdi
+  801b6b:	48 b8 db 10 80 00 00 	movabs $0x8010db,%rax
+  801b72:	00 00 00 
+  801b75:	ff d0                	call   *%rax
+  801b77:	48 98                	cltq
+  801b79:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+		char sc;
+
+		do
+		{
+			sc = *in++;
+  801b7d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b81:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b85:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801b89:	0f b6 00             	movzbl (%rax),%eax
+  801b8c:	88 45 ef             	mov    %al,-0x11(%rbp)
+			if (!sc)
+  801b8f:	80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+  801b93:	75 07                	jne    801b9c <strstr+0x66>
+				return (char *)0;
+  801b95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b9a:	eb 33                	jmp    801bcf <strstr+0x99>
+		} while (sc != c);
+  801b9c:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+  801ba0:	3a 45 ff             	cmp    -0x1(%rbp),%al
+  801ba3:	75 d8                	jne    801b7d <strstr+0x47>
+	} while (strncmp(in, str, len) != 0);
+  801ba5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801ba9:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801bad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bb1:	48 89 ce             	mov    %rcx,%rsi
+  801bb4:	48 89 c7             	mov    %rax,%rdi
+  801bb7:	48 b8 f6 12 80 00 00 	movabs $0x8012f6,%rax
+  801bbe:	00 00 00 
+  801bc1:	ff d0                	call   *%rax
+  801bc3:	85 c0                	test   %eax,%eax
+  801bc5:	75 b6                	jne    801b7d <strstr+0x47>
+
+	return (char *)(in - 1);
+  801bc7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bcb:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801bcf:	c9                   	leave
+  801bd0:	c3                   	ret
+
+0000000000801bd1 <syscall>:
+ * 用户的指令式系统调用，该函数将系统调用序号放入eax寄存器，五个参数依次放入edx, ecx, ebx, edi, esi，然后执行指令int 0x30，
+ * 发生中断后，去IDT中查找中断处理函数，最终会走到kern/trap.c的trap_dispatch()中
+ */
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801bd1:	55                   	push   %rbp
+  801bd2:	48 89 e5             	mov    %rsp,%rbp
+  801bd5:	53                   	push   %rbx
+  801bd6:	48 83 ec 48          	sub    $0x48,%rsp
+  801bda:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801bdd:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801be0:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801be4:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801be8:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801bec:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	 * volatile 告诉汇编程序不要因为不使用返回值就优化该指令
+	 * 最后一个子句告诉汇编程序，指令可能会改变条件代码cx和任意内存memory位置
+	 * 由汇编编译器做好数据保存和恢复工作(栈)
+	 */
+
+	asm volatile("int %1\n"			// code: int T_SYSCALL
+  801bf0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801bf3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801bf7:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801bfb:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801bff:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801c03:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801c07:	4c 89 c3             	mov    %r8,%rbx
+  801c0a:	cd 30                	int    $0x30
+  801c0c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+				   "D"(a4),			// edi = a4
+				   "S"(a5)			// esi = a5
+				 : "cc", "memory"); // 指令可能会改变条件代码cx和任意内存memory位置
+									// 由汇编编译器做好数据保存和恢复工作(栈)
+
+	if (check && ret > 0)
+  801c10:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801c14:	74 44                	je     801c5a <syscall+0x89>
+  801c16:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801c1b:	7e 3d                	jle    801c5a <syscall+0x89>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c1d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801c21:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801c24:	49 89 d0             	mov    %rdx,%r8
+  801c27:	89 c1                	mov    %eax,%ecx
+  801c29:	48 b8 c8 32 80 00 00 	movabs $0x8032c8,%rax
+  801c30:	00 00 00 
+  801c33:	48 89 c2             	mov    %rax,%rdx
+  801c36:	be 34 00 00 00       	mov    $0x34,%esi
+  801c3b:	48 b8 e5 32 80 00 00 	movabs $0x8032e5,%rax
+  801c42:	00 00 00 
+  801c45:	48 89 c7             	mov    %rax,%rdi
+  801c48:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c4d:	49 b9 7d 02 80 00 00 	movabs $0x80027d,%r9
+  801c54:	00 00 00 
+  801c57:	41 ff d1             	call   *%r9
+
+	return ret;
+  801c5a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801c5e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c62:	c9                   	leave
+  801c63:	c3                   	ret
+
+0000000000801c64 <sys_cputs>:
+
+void sys_cputs(const char *s, size_t len)
+{
+  801c64:	55                   	push   %rbp
+  801c65:	48 89 e5             	mov    %rsp,%rbp
+  801c68:	48 83 ec 10          	sub    $0x10,%rsp
+  801c6c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801c70:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 调用lib/syscall.c中的syscall()
+	// SYS_cputs: 系统调用序号(eax)，s: 需要输出的字符数组，len: 数组长度
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801c74:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c78:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c7c:	48 83 ec 08          	sub    $0x8,%rsp
+  801c80:	6a 00                	push   $0x0
+  801c82:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801c88:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c8e:	48 89 d1             	mov    %rdx,%rcx
+  801c91:	48 89 c2             	mov    %rax,%rdx
+  801c94:	be 00 00 00 00       	mov    $0x0,%esi
+  801c99:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c9e:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  801ca5:	00 00 00 
+  801ca8:	ff d0                	call   *%rax
+  801caa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801cae:	90                   	nop
+  801caf:	c9                   	leave
+  801cb0:	c3                   	ret
+
+0000000000801cb1 <sys_cgetc>:
+
+int sys_cgetc(void)
+{
+  801cb1:	55                   	push   %rbp
+  801cb2:	48 89 e5             	mov    %rsp,%rbp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801cb5:	48 83 ec 08          	sub    $0x8,%rsp
+  801cb9:	6a 00                	push   $0x0
+  801cbb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801cc1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801cc7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ccc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cd1:	be 00 00 00 00       	mov    $0x0,%esi
+  801cd6:	bf 01 00 00 00       	mov    $0x1,%edi
+  801cdb:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  801ce2:	00 00 00 
+  801ce5:	ff d0                	call   *%rax
+  801ce7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ceb:	c9                   	leave
+  801cec:	c3                   	ret
+
+0000000000801ced <sys_env_destroy>:
+
+int sys_env_destroy(envid_t envid)
+{
+  801ced:	55                   	push   %rbp
+  801cee:	48 89 e5             	mov    %rsp,%rbp
+  801cf1:	48 83 ec 10          	sub    $0x10,%rsp
+  801cf5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	// 销毁envid对应的环境
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801cf8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801cfb:	48 98                	cltq
+  801cfd:	48 83 ec 08          	sub    $0x8,%rsp
+  801d01:	6a 00                	push   $0x0
+  801d03:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d09:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d0f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d14:	48 89 c2             	mov    %rax,%rdx
+  801d17:	be 01 00 00 00       	mov    $0x1,%esi
+  801d1c:	bf 03 00 00 00       	mov    $0x3,%edi
+  801d21:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  801d28:	00 00 00 
+  801d2b:	ff d0                	call   *%rax
+  801d2d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d31:	c9                   	leave
+  801d32:	c3                   	ret
+
+0000000000801d33 <sys_getprocid>:
+
+envid_t
+sys_getprocid(void)
+{
+  801d33:	55                   	push   %rbp
+  801d34:	48 89 e5             	mov    %rsp,%rbp
+	// 获取当前用户环境id
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801d37:	48 83 ec 08          	sub    $0x8,%rsp
+  801d3b:	6a 00                	push   $0x0
+  801d3d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d43:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d49:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d53:	be 00 00 00 00       	mov    $0x0,%esi
+  801d58:	bf 02 00 00 00       	mov    $0x2,%edi
+  801d5d:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  801d64:	00 00 00 
+  801d67:	ff d0                	call   *%rax
+  801d69:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d6d:	c9                   	leave
+  801d6e:	c3                   	ret
+
+0000000000801d6f <sys_yield>:
+
+void sys_yield(void)
+{
+  801d6f:	55                   	push   %rbp
+  801d70:	48 89 e5             	mov    %rsp,%rbp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801d73:	48 83 ec 08          	sub    $0x8,%rsp
+  801d77:	6a 00                	push   $0x0
+  801d79:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d7f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d85:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d8f:	be 00 00 00 00       	mov    $0x0,%esi
+  801d94:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801d99:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  801da0:	00 00 00 
+  801da3:	ff d0                	call   *%rax
+  801da5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801da9:	90                   	nop
+  801daa:	c9                   	leave
+  801dab:	c3                   	ret
+
+0000000000801dac <sys_page_alloc>:
+
+int sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801dac:	55                   	push   %rbp
+  801dad:	48 89 e5             	mov    %rsp,%rbp
+  801db0:	48 83 ec 10          	sub    $0x10,%rsp
+  801db4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801db7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801dbb:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  801dbe:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801dc1:	48 63 c8             	movslq %eax,%rcx
+  801dc4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801dc8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801dcb:	48 98                	cltq
+  801dcd:	48 83 ec 08          	sub    $0x8,%rsp
+  801dd1:	6a 00                	push   $0x0
+  801dd3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801dd9:	49 89 c8             	mov    %rcx,%r8
+  801ddc:	48 89 d1             	mov    %rdx,%rcx
+  801ddf:	48 89 c2             	mov    %rax,%rdx
+  801de2:	be 01 00 00 00       	mov    $0x1,%esi
+  801de7:	bf 04 00 00 00       	mov    $0x4,%edi
+  801dec:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  801df3:	00 00 00 
+  801df6:	ff d0                	call   *%rax
+  801df8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801dfc:	c9                   	leave
+  801dfd:	c3                   	ret
+
+0000000000801dfe <sys_page_map>:
+
+int sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801dfe:	55                   	push   %rbp
+  801dff:	48 89 e5             	mov    %rsp,%rbp
+  801e02:	48 83 ec 20          	sub    $0x20,%rsp
+  801e06:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e09:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801e0d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801e10:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801e14:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  801e18:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801e1b:	48 63 c8             	movslq %eax,%rcx
+  801e1e:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  801e22:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801e25:	48 63 f0             	movslq %eax,%rsi
+  801e28:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e2c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e2f:	48 98                	cltq
+  801e31:	48 83 ec 08          	sub    $0x8,%rsp
+  801e35:	51                   	push   %rcx
+  801e36:	49 89 f9             	mov    %rdi,%r9
+  801e39:	49 89 f0             	mov    %rsi,%r8
+  801e3c:	48 89 d1             	mov    %rdx,%rcx
+  801e3f:	48 89 c2             	mov    %rax,%rdx
+  801e42:	be 01 00 00 00       	mov    $0x1,%esi
+  801e47:	bf 05 00 00 00       	mov    $0x5,%edi
+  801e4c:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  801e53:	00 00 00 
+  801e56:	ff d0                	call   *%rax
+  801e58:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e5c:	c9                   	leave
+  801e5d:	c3                   	ret
+
+0000000000801e5e <sys_page_unmap>:
+
+int sys_page_unmap(envid_t envid, void *va)
+{
+  801e5e:	55                   	push   %rbp
+  801e5f:	48 89 e5             	mov    %rsp,%rbp
+  801e62:	48 83 ec 10          	sub    $0x10,%rsp
+  801e66:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e69:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  801e6d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e71:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e74:	48 98                	cltq
+  801e76:	48 83 ec 08          	sub    $0x8,%rsp
+  801e7a:	6a 00                	push   $0x0
+  801e7c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e82:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e88:	48 89 d1             	mov    %rdx,%rcx
+  801e8b:	48 89 c2             	mov    %rax,%rdx
+  801e8e:	be 01 00 00 00       	mov    $0x1,%esi
+  801e93:	bf 06 00 00 00       	mov    $0x6,%edi
+  801e98:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  801e9f:	00 00 00 
+  801ea2:	ff d0                	call   *%rax
+  801ea4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ea8:	c9                   	leave
+  801ea9:	c3                   	ret
+
+0000000000801eaa <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int sys_env_set_status(envid_t envid, int status)
+{
+  801eaa:	55                   	push   %rbp
+  801eab:	48 89 e5             	mov    %rsp,%rbp
+  801eae:	48 83 ec 10          	sub    $0x10,%rsp
+  801eb2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801eb5:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801eb8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801ebb:	48 63 d0             	movslq %eax,%rdx
+  801ebe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ec1:	48 98                	cltq
+  801ec3:	48 83 ec 08          	sub    $0x8,%rsp
+  801ec7:	6a 00                	push   $0x0
+  801ec9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ecf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ed5:	48 89 d1             	mov    %rdx,%rcx
+  801ed8:	48 89 c2             	mov    %rax,%rdx
+  801edb:	be 01 00 00 00       	mov    $0x1,%esi
+  801ee0:	bf 08 00 00 00       	mov    $0x8,%edi
+  801ee5:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  801eec:	00 00 00 
+  801eef:	ff d0                	call   *%rax
+  801ef1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ef5:	c9                   	leave
+  801ef6:	c3                   	ret
+
+0000000000801ef7 <sys_env_set_trapframe>:
+
+int sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801ef7:	55                   	push   %rbp
+  801ef8:	48 89 e5             	mov    %rsp,%rbp
+  801efb:	48 83 ec 10          	sub    $0x10,%rsp
+  801eff:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f02:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  801f06:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801f0a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f0d:	48 98                	cltq
+  801f0f:	48 83 ec 08          	sub    $0x8,%rsp
+  801f13:	6a 00                	push   $0x0
+  801f15:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f1b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f21:	48 89 d1             	mov    %rdx,%rcx
+  801f24:	48 89 c2             	mov    %rax,%rdx
+  801f27:	be 01 00 00 00       	mov    $0x1,%esi
+  801f2c:	bf 09 00 00 00       	mov    $0x9,%edi
+  801f31:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  801f38:	00 00 00 
+  801f3b:	ff d0                	call   *%rax
+  801f3d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f41:	c9                   	leave
+  801f42:	c3                   	ret
+
+0000000000801f43 <sys_env_set_pgfault_upcall>:
+
+int sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801f43:	55                   	push   %rbp
+  801f44:	48 89 e5             	mov    %rsp,%rbp
+  801f47:	48 83 ec 10          	sub    $0x10,%rsp
+  801f4b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f4e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  801f52:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801f56:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f59:	48 98                	cltq
+  801f5b:	48 83 ec 08          	sub    $0x8,%rsp
+  801f5f:	6a 00                	push   $0x0
+  801f61:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f67:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f6d:	48 89 d1             	mov    %rdx,%rcx
+  801f70:	48 89 c2             	mov    %rax,%rdx
+  801f73:	be 01 00 00 00       	mov    $0x1,%esi
+  801f78:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801f7d:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  801f84:	00 00 00 
+  801f87:	ff d0                	call   *%rax
+  801f89:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f8d:	c9                   	leave
+  801f8e:	c3                   	ret
+
+0000000000801f8f <sys_ipc_try_send>:
+
+int sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  801f8f:	55                   	push   %rbp
+  801f90:	48 89 e5             	mov    %rsp,%rbp
+  801f93:	48 83 ec 20          	sub    $0x20,%rsp
+  801f97:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f9a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f9e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801fa2:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  801fa5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801fa8:	48 63 f0             	movslq %eax,%rsi
+  801fab:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801faf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fb2:	48 98                	cltq
+  801fb4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801fb8:	48 83 ec 08          	sub    $0x8,%rsp
+  801fbc:	6a 00                	push   $0x0
+  801fbe:	49 89 f1             	mov    %rsi,%r9
+  801fc1:	49 89 c8             	mov    %rcx,%r8
+  801fc4:	48 89 d1             	mov    %rdx,%rcx
+  801fc7:	48 89 c2             	mov    %rax,%rdx
+  801fca:	be 00 00 00 00       	mov    $0x0,%esi
+  801fcf:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801fd4:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  801fdb:	00 00 00 
+  801fde:	ff d0                	call   *%rax
+  801fe0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fe4:	c9                   	leave
+  801fe5:	c3                   	ret
+
+0000000000801fe6 <sys_ipc_recv>:
+
+int sys_ipc_recv(void *dstva)
+{
+  801fe6:	55                   	push   %rbp
+  801fe7:	48 89 e5             	mov    %rsp,%rbp
+  801fea:	48 83 ec 10          	sub    $0x10,%rsp
+  801fee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  801ff2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ff6:	48 83 ec 08          	sub    $0x8,%rsp
+  801ffa:	6a 00                	push   $0x0
+  801ffc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802002:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802008:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80200d:	48 89 c2             	mov    %rax,%rdx
+  802010:	be 01 00 00 00       	mov    $0x1,%esi
+  802015:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80201a:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  802021:	00 00 00 
+  802024:	ff d0                	call   *%rax
+  802026:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80202a:	c9                   	leave
+  80202b:	c3                   	ret
+
+000000000080202c <sys_disk_io>:
+
+int sys_disk_io(int dev, uint64_t secno, void *va, size_t nsecs, int write)
+{
+  80202c:	55                   	push   %rbp
+  80202d:	48 89 e5             	mov    %rsp,%rbp
+  802030:	48 83 ec 20          	sub    $0x20,%rsp
+  802034:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802037:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80203b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80203f:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802043:	44 89 45 f8          	mov    %r8d,-0x8(%rbp)
+	return syscall(SYS_disk_io, 0, dev, secno, (uint64_t)va, nsecs, write);
+  802047:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80204a:	48 63 c8             	movslq %eax,%rcx
+  80204d:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802051:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802054:	48 98                	cltq
+  802056:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80205a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80205e:	48 83 ec 08          	sub    $0x8,%rsp
+  802062:	51                   	push   %rcx
+  802063:	49 89 f9             	mov    %rdi,%r9
+  802066:	49 89 f0             	mov    %rsi,%r8
+  802069:	48 89 d1             	mov    %rdx,%rcx
+  80206c:	48 89 c2             	mov    %rax,%rdx
+  80206f:	be 00 00 00 00       	mov    $0x0,%esi
+  802074:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802079:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  802080:	00 00 00 
+  802083:	ff d0                	call   *%rax
+  802085:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802089:	c9                   	leave
+  80208a:	c3                   	ret
+
+000000000080208b <sys_vma_alloc>:
+
+int sys_vma_alloc(envid_t envid, void *va, size_t len, int perm)
+{
+  80208b:	55                   	push   %rbp
+  80208c:	48 89 e5             	mov    %rsp,%rbp
+  80208f:	48 83 ec 20          	sub    $0x20,%rsp
+  802093:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802096:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80209a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80209e:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_vma_alloc, 1, envid, (uint64_t)va, len, perm, 0);
+  8020a1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8020a4:	48 63 f0             	movslq %eax,%rsi
+  8020a7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8020ab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020ae:	48 98                	cltq
+  8020b0:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8020b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8020b8:	6a 00                	push   $0x0
+  8020ba:	49 89 f1             	mov    %rsi,%r9
+  8020bd:	49 89 c8             	mov    %rcx,%r8
+  8020c0:	48 89 d1             	mov    %rdx,%rcx
+  8020c3:	48 89 c2             	mov    %rax,%rdx
+  8020c6:	be 01 00 00 00       	mov    $0x1,%esi
+  8020cb:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8020d0:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  8020d7:	00 00 00 
+  8020da:	ff d0                	call   *%rax
+  8020dc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020e0:	c9                   	leave
+  8020e1:	c3                   	ret
+
+00000000008020e2 <sys_vma_clear>:
+
+int sys_vma_clear(envid_t envid)
+{
+  8020e2:	55                   	push   %rbp
+  8020e3:	48 89 e5             	mov    %rsp,%rbp
+  8020e6:	48 83 ec 10          	sub    $0x10,%rsp
+  8020ea:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_vma_clear, 1, envid, 0, 0, 0, 0);
+  8020ed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020f0:	48 98                	cltq
+  8020f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8020f6:	6a 00                	push   $0x0
+  8020f8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802104:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802109:	48 89 c2             	mov    %rax,%rdx
+  80210c:	be 01 00 00 00       	mov    $0x1,%esi
+  802111:	bf 10 00 00 00       	mov    $0x10,%edi
+  802116:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  80211d:	00 00 00 
+  802120:	ff d0                	call   *%rax
+  802122:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802126:	c9                   	leave
+  802127:	c3                   	ret
+
+0000000000802128 <sys_trace_ctl>:
+
+int sys_trace_ctl(int enable)
+{
+  802128:	55                   	push   %rbp
+  802129:	48 89 e5             	mov    %rsp,%rbp
+  80212c:	48 83 ec 10          	sub    $0x10,%rsp
+  802130:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_trace_ctl, 0, enable, 0, 0, 0, 0);
+  802133:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802136:	48 98                	cltq
+  802138:	48 83 ec 08          	sub    $0x8,%rsp
+  80213c:	6a 00                	push   $0x0
+  80213e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802144:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80214a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80214f:	48 89 c2             	mov    %rax,%rdx
+  802152:	be 00 00 00 00       	mov    $0x0,%esi
+  802157:	bf 11 00 00 00       	mov    $0x11,%edi
+  80215c:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  802163:	00 00 00 
+  802166:	ff d0                	call   *%rax
+  802168:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80216c:	c9                   	leave
+  80216d:	c3                   	ret
+
+000000000080216e <sys_trace_read>:
+
+int sys_trace_read(int cpu, uint64_t *seq, struct TraceEvent *buf, int n)
+{
+  80216e:	55                   	push   %rbp
+  80216f:	48 89 e5             	mov    %rsp,%rbp
+  802172:	48 83 ec 20          	sub    $0x20,%rsp
+  802176:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802179:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80217d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802181:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_trace_read, 0, cpu, (uint64_t)seq, (uint64_t)buf, n, 0);
+  802184:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802187:	48 63 f0             	movslq %eax,%rsi
+  80218a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80218e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802192:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802195:	48 98                	cltq
+  802197:	48 83 ec 08          	sub    $0x8,%rsp
+  80219b:	6a 00                	push   $0x0
+  80219d:	49 89 f1             	mov    %rsi,%r9
+  8021a0:	49 89 c8             	mov    %rcx,%r8
+  8021a3:	48 89 d1             	mov    %rdx,%rcx
+  8021a6:	48 89 c2             	mov    %rax,%rdx
+  8021a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ae:	bf 12 00 00 00       	mov    $0x12,%edi
+  8021b3:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  8021ba:	00 00 00 
+  8021bd:	ff d0                	call   *%rax
+  8021bf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021c3:	c9                   	leave
+  8021c4:	c3                   	ret
+
+00000000008021c5 <sys_getrusage>:
+
+int sys_getrusage(envid_t envid, struct Rusage *ru)
+{
+  8021c5:	55                   	push   %rbp
+  8021c6:	48 89 e5             	mov    %rsp,%rbp
+  8021c9:	48 83 ec 10          	sub    $0x10,%rsp
+  8021cd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021d0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_getrusage, 0, envid, (uint64_t)ru, 0, 0, 0);
+  8021d4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021d8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021db:	48 98                	cltq
+  8021dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8021e1:	6a 00                	push   $0x0
+  8021e3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021ef:	48 89 d1             	mov    %rdx,%rcx
+  8021f2:	48 89 c2             	mov    %rax,%rdx
+  8021f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8021fa:	bf 13 00 00 00       	mov    $0x13,%edi
+  8021ff:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  802206:	00 00 00 
+  802209:	ff d0                	call   *%rax
+  80220b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80220f:	c9                   	leave
+  802210:	c3                   	ret
+
+0000000000802211 <sys_pmu_config>:
+
+int sys_pmu_config(int idx, uint64_t event)
+{
+  802211:	55                   	push   %rbp
+  802212:	48 89 e5             	mov    %rsp,%rbp
+  802215:	48 83 ec 10          	sub    $0x10,%rsp
+  802219:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80221c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_pmu_config, 0, idx, event, 0, 0, 0);
+  802220:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802223:	48 98                	cltq
+  802225:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802229:	48 83 ec 08          	sub    $0x8,%rsp
+  80222d:	6a 00                	push   $0x0
+  80222f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802235:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80223b:	48 89 d1             	mov    %rdx,%rcx
+  80223e:	48 89 c2             	mov    %rax,%rdx
+  802241:	be 00 00 00 00       	mov    $0x0,%esi
+  802246:	bf 14 00 00 00       	mov    $0x14,%edi
+  80224b:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  802252:	00 00 00 
+  802255:	ff d0                	call   *%rax
+  802257:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80225b:	c9                   	leave
+  80225c:	c3                   	ret
+
+000000000080225d <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  80225d:	55                   	push   %rbp
+  80225e:	48 89 e5             	mov    %rsp,%rbp
+  802261:	48 83 ec 10          	sub    $0x10,%rsp
+  802265:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+  802268:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80226b:	48 83 ec 08          	sub    $0x8,%rsp
+  80226f:	6a 00                	push   $0x0
+  802271:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802277:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80227d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802282:	48 89 c2             	mov    %rax,%rdx
+  802285:	be 00 00 00 00       	mov    $0x0,%esi
+  80228a:	bf 15 00 00 00       	mov    $0x15,%edi
+  80228f:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  802296:	00 00 00 
+  802299:	ff d0                	call   *%rax
+  80229b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80229f:	c9                   	leave
+  8022a0:	c3                   	ret
+
+00000000008022a1 <sys_image_attach>:
+
+int sys_image_attach(envid_t envid, int dev, const uint64_t *secnos, size_t size)
+{
+  8022a1:	55                   	push   %rbp
+  8022a2:	48 89 e5             	mov    %rsp,%rbp
+  8022a5:	48 83 ec 20          	sub    $0x20,%rsp
+  8022a9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022ac:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  8022af:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8022b3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+	return syscall(SYS_image_attach, 1, envid, dev, (uint64_t)secnos, size, 0);
+  8022b7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8022bb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8022be:	48 63 d0             	movslq %eax,%rdx
+  8022c1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8022c4:	48 98                	cltq
+  8022c6:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8022ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8022ce:	6a 00                	push   $0x0
+  8022d0:	49 89 f1             	mov    %rsi,%r9
+  8022d3:	49 89 c8             	mov    %rcx,%r8
+  8022d6:	48 89 d1             	mov    %rdx,%rcx
+  8022d9:	48 89 c2             	mov    %rax,%rdx
+  8022dc:	be 01 00 00 00       	mov    $0x1,%esi
+  8022e1:	bf 16 00 00 00       	mov    $0x16,%edi
+  8022e6:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  8022ed:	00 00 00 
+  8022f0:	ff d0                	call   *%rax
+  8022f2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022f6:	c9                   	leave
+  8022f7:	c3                   	ret
+
+00000000008022f8 <sys_vma_binary>:
+
+int sys_vma_binary(envid_t envid, const struct Proghdr *ph)
+{
+  8022f8:	55                   	push   %rbp
+  8022f9:	48 89 e5             	mov    %rsp,%rbp
+  8022fc:	48 83 ec 10          	sub    $0x10,%rsp
+  802300:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802303:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_vma_binary, 1, envid, (uint64_t)ph, 0, 0, 0);
+  802307:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80230b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80230e:	48 98                	cltq
+  802310:	48 83 ec 08          	sub    $0x8,%rsp
+  802314:	6a 00                	push   $0x0
+  802316:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80231c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802322:	48 89 d1             	mov    %rdx,%rcx
+  802325:	48 89 c2             	mov    %rax,%rdx
+  802328:	be 01 00 00 00       	mov    $0x1,%esi
+  80232d:	bf 17 00 00 00       	mov    $0x17,%edi
+  802332:	48 b8 d1 1b 80 00 00 	movabs $0x801bd1,%rax
+  802339:	00 00 00 
+  80233c:	ff d0                	call   *%rax
+  80233e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802342:	c9                   	leave
+  802343:	c3                   	ret
+
+0000000000802344 <pgfault>:
+ * 自定义页错误处理函数.
+ * 当出现页错误，主要是对标志为可写的或者COW的物理页分配新页，复制旧页的数据到新页并映射到旧页的地址空间
+ */
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802344:	55                   	push   %rbp
+  802345:	48 89 e5             	mov    %rsp,%rbp
+  802348:	48 83 ec 40          	sub    $0x40,%rsp
+  80234c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	void *addr = (void *)utf->utf_fault_va;
+  802350:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802354:	48 8b 00             	mov    (%rax),%rax
+  802357:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint32_t err = utf->utf_err;
+  80235b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80235f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802363:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	int r;
+
+	// 检查出错的访问(1)写，(2)COW页.  若不是，调用panic().
+	// pte_t entry = uvpt[VPN(addr)];
+	// 分配一个新页，将其映射到临时位置(PFTEMP)，将旧页数据复制到新页，然后将新页移动到旧页的地址.
+	if ((err & FEC_WR) && (uvpt[VPN(addr)] & PTE_COW))
+  802366:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802369:	83 e0 02             	and    $0x2,%eax
+  80236c:	85 c0                	test   %eax,%eax
+  80236e:	0f 84 61 01 00 00    	je     8024d5 <pgfault+0x191>
+  802374:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802378:	48 c1 e8 0c          	shr    $0xc,%rax
+  80237c:	48 89 c2             	mov    %rax,%rdx
+  80237f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802386:	01 00 00 
+  802389:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80238d:	25 00 08 00 00       	and    $0x800,%eax
+  802392:	48 85 c0             	test   %rax,%rax
+  802395:	0f 84 3a 01 00 00    	je     8024d5 <pgfault+0x191>
+	{
+		if (sys_page_alloc(0, (void *)PFTEMP, PTE_U | PTE_P | PTE_W) == 0)
+  80239b:	ba 07 00 00 00       	mov    $0x7,%edx
+  8023a0:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8023a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023aa:	48 b8 ac 1d 80 00 00 	movabs $0x801dac,%rax
+  8023b1:	00 00 00 
+  8023b4:	ff d0                	call   *%rax
+  8023b6:	85 c0                	test   %eax,%eax
+  8023b8:	0f 85 e7 00 00 00    	jne    8024a5 <pgfault+0x161>
+		{
+			// 分配了新的物理页以后准备从原页面开始拷贝数据时，记得将地址和物理页大小对齐
+			void *pg_addr = ROUNDDOWN(addr, PGSIZE);
+  8023be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023c2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  8023c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023ca:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8023d0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+			memmove(PFTEMP, pg_addr, PGSIZE);
+  8023d4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8023d8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023dd:	48 89 c6             	mov    %rax,%rsi
+  8023e0:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  8023e5:	48 b8 d3 17 80 00 00 	movabs $0x8017d3,%rax
+  8023ec:	00 00 00 
+  8023ef:	ff d0                	call   *%rax
+			r = sys_page_map(0, (void *)PFTEMP, 0, pg_addr, PTE_U | PTE_W | PTE_P);
+  8023f1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8023f5:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  8023fb:	48 89 c1             	mov    %rax,%rcx
+  8023fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  802403:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802408:	bf 00 00 00 00       	mov    $0x0,%edi
+  80240d:	48 b8 fe 1d 80 00 00 	movabs $0x801dfe,%rax
+  802414:	00 00 00 
+  802417:	ff d0                	call   *%rax
+  802419:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			if (r < 0)
+  80241c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  802420:	79 30                	jns    802452 <pgfault+0x10e>
+			{
+				panic("pgfault...something wrong with page_map");
+  802422:	48 b8 f8 32 80 00 00 	movabs $0x8032f8,%rax
+  802429:	00 00 00 
+  80242c:	48 89 c2             	mov    %rax,%rdx
+  80242f:	be 22 00 00 00       	mov    $0x22,%esi
+  802434:	48 b8 20 33 80 00 00 	movabs $0x803320,%rax
+  80243b:	00 00 00 
+  80243e:	48 89 c7             	mov    %rax,%rdi
+  802441:	b8 00 00 00 00       	mov    $0x0,%eax
+  802446:	48 b9 7d 02 80 00 00 	movabs $0x80027d,%rcx
+  80244d:	00 00 00 
+  802450:	ff d1                	call   *%rcx
+			}
+			r = sys_page_unmap(0, PFTEMP);
+  802452:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802457:	bf 00 00 00 00       	mov    $0x0,%edi
+  80245c:	48 b8 5e 1e 80 00 00 	movabs $0x801e5e,%rax
+  802463:	00 00 00 
+  802466:	ff d0                	call   *%rax
+  802468:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			if (r < 0)
+  80246b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80246f:	0f 89 96 00 00 00    	jns    80250b <pgfault+0x1c7>
+			{
+				panic("pgfault...something wrong with page_unmap");
+  802475:	48 b8 30 33 80 00 00 	movabs $0x803330,%rax
+  80247c:	00 00 00 
+  80247f:	48 89 c2             	mov    %rax,%rdx
+  802482:	be 27 00 00 00       	mov    $0x27,%esi
+  802487:	48 b8 20 33 80 00 00 	movabs $0x803320,%rax
+  80248e:	00 00 00 
+  802491:	48 89 c7             	mov    %rax,%rdi
+  802494:	b8 00 00 00 00       	mov    $0x0,%eax
+  802499:	48 b9 7d 02 80 00 00 	movabs $0x80027d,%rcx
+  8024a0:	00 00 00 
+  8024a3:	ff d1                	call   *%rcx
+			}
+			return;
+		}
+		else
+		{
+			panic("pgfault...something wrong with page_alloc");
+  8024a5:	48 b8 60 33 80 00 00 	movabs $0x803360,%rax
+  8024ac:	00 00 00 
+  8024af:	48 89 c2             	mov    %rax,%rdx
+  8024b2:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8024b7:	48 b8 20 33 80 00 00 	movabs $0x803320,%rax
+  8024be:	00 00 00 
+  8024c1:	48 89 c7             	mov    %rax,%rdi
+  8024c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024c9:	48 b9 7d 02 80 00 00 	movabs $0x80027d,%rcx
+  8024d0:	00 00 00 
+  8024d3:	ff d1                	call   *%rcx
+		}
+	}
+	else
+	{
+		panic("pgfault...wrong error %e", err);
+  8024d5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8024d8:	89 c1                	mov    %eax,%ecx
+  8024da:	48 b8 8a 33 80 00 00 	movabs $0x80338a,%rax
+  8024e1:	00 00 00 
+  8024e4:	48 89 c2             	mov    %rax,%rdx
+  8024e7:	be 32 00 00 00       	mov    $0x32,%esi
+  8024ec:	48 b8 20 33 80 00 00 	movabs $0x803320,%rax
+  8024f3:	00 00 00 
+  8024f6:	48 89 c7             	mov    %rax,%rdi
+  8024f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024fe:	49 b8 7d 02 80 00 00 	movabs $0x80027d,%r8
+  802505:	00 00 00 
+  802508:	41 ff d0             	call   *%r8
+			return;
+  80250b:	90                   	nop
+	}
+}
+  80250c:	c9                   	leave
+  80250d:	c3                   	ret
+
+000000000080250e <duppage>:
+ * 映射: 将的虚拟页pn(地址: pn*PGSIZE)映射到相同虚拟地址的 envid 中.
+ * 成功: 返回0，失败调用 panic()
+ */
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  80250e:	55                   	push   %rbp
+  80250f:	48 89 e5             	mov    %rsp,%rbp
+  802512:	48 83 ec 30          	sub    $0x30,%rsp
+  802516:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802519:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	pte_t entry = uvpt[pn];
+  80251c:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802523:	01 00 00 
+  802526:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802529:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80252d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	void *addr = (void *)((uintptr_t)pn * PGSIZE);
+  802531:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802534:	48 c1 e0 0c          	shl    $0xc,%rax
+  802538:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	int perm = entry & PTE_SYSCALL;
+  80253c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802540:	25 07 0e 00 00       	and    $0xe07,%eax
+  802545:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm & PTE_SHARE)
+  802548:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80254b:	25 00 04 00 00       	and    $0x400,%eax
+  802550:	85 c0                	test   %eax,%eax
+  802552:	74 68                	je     8025bc <duppage+0xae>
+	{
+		r = sys_page_map(0, addr, envid, addr, perm);
+  802554:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  802557:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80255b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80255e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802562:	41 89 f0             	mov    %esi,%r8d
+  802565:	48 89 c6             	mov    %rax,%rsi
+  802568:	bf 00 00 00 00       	mov    $0x0,%edi
+  80256d:	48 b8 fe 1d 80 00 00 	movabs $0x801dfe,%rax
+  802574:	00 00 00 
+  802577:	ff d0                	call   *%rax
+  802579:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  80257c:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802580:	0f 89 90 01 00 00    	jns    802716 <duppage+0x208>
+		{
+			panic("Something went wrong on duppage %e", r);
+  802586:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802589:	89 c1                	mov    %eax,%ecx
+  80258b:	48 b8 a8 33 80 00 00 	movabs $0x8033a8,%rax
+  802592:	00 00 00 
+  802595:	48 89 c2             	mov    %rax,%rdx
+  802598:	be 48 00 00 00       	mov    $0x48,%esi
+  80259d:	48 b8 20 33 80 00 00 	movabs $0x803320,%rax
+  8025a4:	00 00 00 
+  8025a7:	48 89 c7             	mov    %rax,%rdi
+  8025aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025af:	49 b8 7d 02 80 00 00 	movabs $0x80027d,%r8
+  8025b6:	00 00 00 
+  8025b9:	41 ff d0             	call   *%r8
+		}
+	}
+	else if ((perm & PTE_COW) || (perm & PTE_W))
+  8025bc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8025bf:	25 00 08 00 00       	and    $0x800,%eax
+  8025c4:	85 c0                	test   %eax,%eax
+  8025c6:	75 0e                	jne    8025d6 <duppage+0xc8>
+  8025c8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8025cb:	83 e0 02             	and    $0x2,%eax
+  8025ce:	85 c0                	test   %eax,%eax
+  8025d0:	0f 84 dc 00 00 00    	je     8026b2 <duppage+0x1a4>
+	{
+		perm &= ~PTE_W;
+  8025d6:	83 65 ec fd          	andl   $0xfffffffd,-0x14(%rbp)
+		perm |= PTE_COW;
+  8025da:	81 4d ec 00 08 00 00 	orl    $0x800,-0x14(%rbp)
+		r = sys_page_map(0, addr, envid, addr, perm);
+  8025e1:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8025e4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025e8:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8025eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8025ef:	41 89 f0             	mov    %esi,%r8d
+  8025f2:	48 89 c6             	mov    %rax,%rsi
+  8025f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025fa:	48 b8 fe 1d 80 00 00 	movabs $0x801dfe,%rax
+  802601:	00 00 00 
+  802604:	ff d0                	call   *%rax
+  802606:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  802609:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80260d:	79 36                	jns    802645 <duppage+0x137>
+		{
+			panic("Something went wrong on duppage %e", r);
+  80260f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802612:	89 c1                	mov    %eax,%ecx
+  802614:	48 b8 a8 33 80 00 00 	movabs $0x8033a8,%rax
+  80261b:	00 00 00 
+  80261e:	48 89 c2             	mov    %rax,%rdx
+  802621:	be 52 00 00 00       	mov    $0x52,%esi
+  802626:	48 b8 20 33 80 00 00 	movabs $0x803320,%rax
+  80262d:	00 00 00 
+  802630:	48 89 c7             	mov    %rax,%rdi
+  802633:	b8 00 00 00 00       	mov    $0x0,%eax
+  802638:	49 b8 7d 02 80 00 00 	movabs $0x80027d,%r8
+  80263f:	00 00 00 
+  802642:	41 ff d0             	call   *%r8
+		}
+		r = sys_page_map(0, addr, 0, addr, perm);
+  802645:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  802648:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80264c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802650:	41 89 c8             	mov    %ecx,%r8d
+  802653:	48 89 d1             	mov    %rdx,%rcx
+  802656:	ba 00 00 00 00       	mov    $0x0,%edx
+  80265b:	48 89 c6             	mov    %rax,%rsi
+  80265e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802663:	48 b8 fe 1d 80 00 00 	movabs $0x801dfe,%rax
+  80266a:	00 00 00 
+  80266d:	ff d0                	call   *%rax
+  80266f:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  802672:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802676:	0f 89 9a 00 00 00    	jns    802716 <duppage+0x208>
+		{
+			panic("Something went wrong on duppage %e", r);
+  80267c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80267f:	89 c1                	mov    %eax,%ecx
+  802681:	48 b8 a8 33 80 00 00 	movabs $0x8033a8,%rax
+  802688:	00 00 00 
+  80268b:	48 89 c2             	mov    %rax,%rdx
+  80268e:	be 57 00 00 00       	mov    $0x57,%esi
+  802693:	48 b8 20 33 80 00 00 	movabs $0x803320,%rax
+  80269a:	00 00 00 
+  80269d:	48 89 c7             	mov    %rax,%rdi
+  8026a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a5:	49 b8 7d 02 80 00 00 	movabs $0x80027d,%r8
+  8026ac:	00 00 00 
+  8026af:	41 ff d0             	call   *%r8
+		}
+	}
+	else
+	{
+		r = sys_page_map(0, addr, envid, addr, perm);
+  8026b2:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8026b5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8026b9:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8026bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8026c0:	41 89 f0             	mov    %esi,%r8d
+  8026c3:	48 89 c6             	mov    %rax,%rsi
+  8026c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026cb:	48 b8 fe 1d 80 00 00 	movabs $0x801dfe,%rax
+  8026d2:	00 00 00 
+  8026d5:	ff d0                	call   *%rax
+  8026d7:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  8026da:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8026de:	79 36                	jns    802716 <duppage+0x208>
+		{
+			panic("Something went wrong on duppage %e", r);
+  8026e0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8026e3:	89 c1                	mov    %eax,%ecx
+  8026e5:	48 b8 a8 33 80 00 00 	movabs $0x8033a8,%rax
+  8026ec:	00 00 00 
+  8026ef:	48 89 c2             	mov    %rax,%rdx
+  8026f2:	be 5f 00 00 00       	mov    $0x5f,%esi
+  8026f7:	48 b8 20 33 80 00 00 	movabs $0x803320,%rax
+  8026fe:	00 00 00 
+  802701:	48 89 c7             	mov    %rax,%rdi
+  802704:	b8 00 00 00 00       	mov    $0x0,%eax
+  802709:	49 b8 7d 02 80 00 00 	movabs $0x80027d,%r8
+  802710:	00 00 00 
+  802713:	41 ff d0             	call   *%r8
+		}
+	}
+	return 0;
+  802716:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80271b:	c9                   	leave
+  80271c:	c3                   	ret
+
+000000000080271d <fork>:
+ * 
+ * 两个用户异常栈都不应该被标记为COW，所以必须为子环境的异常栈分配一个新页
+ */
+envid_t
+fork(void)
+{
+  80271d:	55                   	push   %rbp
+  80271e:	48 89 e5             	mov    %rsp,%rbp
+  802721:	48 83 ec 50          	sub    $0x50,%rsp
+	int r = 0;
+  802725:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	set_pgfault_handler(pgfault);
+  80272c:	48 b8 44 23 80 00 00 	movabs $0x802344,%rax
+  802733:	00 00 00 
+  802736:	48 89 c7             	mov    %rax,%rdi
+  802739:	48 b8 67 2c 80 00 00 	movabs $0x802c67,%rax
+  802740:	00 00 00 
+  802743:	ff d0                	call   *%rax
+// 必须内联.
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  802745:	b8 07 00 00 00       	mov    $0x7,%eax
+  80274a:	cd 30                	int    $0x30
+  80274c:	89 45 bc             	mov    %eax,-0x44(%rbp)
+					 : "=a"(ret)
+					 : "a"(SYS_exofork),
+					   "i"(T_SYSCALL));
+	return ret;
+  80274f:	8b 45 bc             	mov    -0x44(%rbp),%eax
+	envid_t childid = sys_exofork();
+  802752:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	if (childid < 0)
+  802755:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  802759:	79 36                	jns    802791 <fork+0x74>
+	{
+		panic("\n couldn't call fork %e\n", childid);
+  80275b:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80275e:	89 c1                	mov    %eax,%ecx
+  802760:	48 b8 cb 33 80 00 00 	movabs $0x8033cb,%rax
+  802767:	00 00 00 
+  80276a:	48 89 c2             	mov    %rax,%rdx
+  80276d:	be 7a 00 00 00       	mov    $0x7a,%esi
+  802772:	48 b8 20 33 80 00 00 	movabs $0x803320,%rax
+  802779:	00 00 00 
+  80277c:	48 89 c7             	mov    %rax,%rdi
+  80277f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802784:	49 b8 7d 02 80 00 00 	movabs $0x80027d,%r8
+  80278b:	00 00 00 
+  80278e:	41 ff d0             	call   *%r8
+	}
+	if (childid == 0)
+  802791:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  802795:	75 3e                	jne    8027d5 <fork+0xb8>
+	{
+		// thisproc 父进程
+		thisproc = &procs[ENVX(sys_getprocid())];
+  802797:	48 b8 33 1d 80 00 00 	movabs $0x801d33,%rax
+  80279e:	00 00 00 
+  8027a1:	ff d0                	call   *%rax
+  8027a3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8027a8:	48 98                	cltq
+  8027aa:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  8027b1:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  8027b8:	00 00 00 
+  8027bb:	48 01 c2             	add    %rax,%rdx
+  8027be:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  8027c5:	00 00 00 
+  8027c8:	48 89 10             	mov    %rdx,(%rax)
+		// 子环境的返回值
+		return 0;
+  8027cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027d0:	e9 c2 02 00 00       	jmp    802a97 <fork+0x37a>
+	}
+	r = sys_page_alloc(childid, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_W | PTE_U);
+  8027d5:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8027d8:	ba 07 00 00 00       	mov    $0x7,%edx
+  8027dd:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  8027e2:	48 89 ce             	mov    %rcx,%rsi
+  8027e5:	89 c7                	mov    %eax,%edi
+  8027e7:	48 b8 ac 1d 80 00 00 	movabs $0x801dac,%rax
+  8027ee:	00 00 00 
+  8027f1:	ff d0                	call   *%rax
+  8027f3:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if (r < 0)
+  8027f6:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  8027fa:	79 36                	jns    802832 <fork+0x115>
+		panic("\n couldn't call fork %e\n", r);
+  8027fc:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8027ff:	89 c1                	mov    %eax,%ecx
+  802801:	48 b8 cb 33 80 00 00 	movabs $0x8033cb,%rax
+  802808:	00 00 00 
+  80280b:	48 89 c2             	mov    %rax,%rdx
+  80280e:	be 85 00 00 00       	mov    $0x85,%esi
+  802813:	48 b8 20 33 80 00 00 	movabs $0x803320,%rax
+  80281a:	00 00 00 
+  80281d:	48 89 c7             	mov    %rax,%rdi
+  802820:	b8 00 00 00 00       	mov    $0x0,%eax
+  802825:	49 b8 7d 02 80 00 00 	movabs $0x80027d,%r8
+  80282c:	00 00 00 
+  80282f:	41 ff d0             	call   *%r8
+
+	uint64_t pml;
+	uint64_t pdpe;
+	uint64_t pde;
+	uint64_t pte;
+	uint64_t each_pde = 0;
+  802832:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802839:	00 
+	uint64_t each_pte = 0;
+  80283a:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  802841:	00 
+	uint64_t each_pdpe = 0;
+  802842:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802849:	00 
+
+	// 拷贝[0, UXSTACKTOP)的所有用户页，接下来为用户异常栈创建物理页
+	// 因为在创建用户环境时，已经在 env_setup_vm() 中映射了内核所有页
+	for (pml = 0; pml < VPML4E(UTOP); pml++)
+  80284a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802851:	00 
+  802852:	e9 80 01 00 00       	jmp    8029d7 <fork+0x2ba>
+	{
+		if (uvpml4e[pml] & PTE_P)
+  802857:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80285e:	01 00 00 
+  802861:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802865:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802869:	83 e0 01             	and    $0x1,%eax
+  80286c:	48 85 c0             	test   %rax,%rax
+  80286f:	0f 84 4d 01 00 00    	je     8029c2 <fork+0x2a5>
+		{
+
+			for (pdpe = 0; pdpe < NPDPENTRIES; pdpe++, each_pdpe++)
+  802875:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80287c:	00 
+  80287d:	e9 30 01 00 00       	jmp    8029b2 <fork+0x295>
+			{
+				if (uvpde[each_pdpe] & PTE_P)
+  802882:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802889:	01 00 00 
+  80288c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802890:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802894:	83 e0 01             	and    $0x1,%eax
+  802897:	48 85 c0             	test   %rax,%rax
+  80289a:	0f 84 f8 00 00 00    	je     802998 <fork+0x27b>
+				{
+
+					for (pde = 0; pde < NPDENTRIES; pde++, each_pde++)
+  8028a0:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8028a7:	00 
+  8028a8:	e9 db 00 00 00       	jmp    802988 <fork+0x26b>
+					{
+						if (uvpd[each_pde] & PTE_P)
+  8028ad:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8028b4:	01 00 00 
+  8028b7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028bb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8028bf:	83 e0 01             	and    $0x1,%eax
+  8028c2:	48 85 c0             	test   %rax,%rax
+  8028c5:	0f 84 a3 00 00 00    	je     80296e <fork+0x251>
+						{
+
+							for (pte = 0; pte < NPTENTRIES; pte++, each_pte++)
+  8028cb:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8028d2:	00 
+  8028d3:	e9 86 00 00 00       	jmp    80295e <fork+0x241>
+							{
+								if (uvpt[each_pte] & PTE_P)
+  8028d8:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  8028df:	01 00 00 
+  8028e2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028e6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8028ea:	83 e0 01             	and    $0x1,%eax
+  8028ed:	48 85 c0             	test   %rax,%rax
+  8028f0:	74 62                	je     802954 <fork+0x237>
+								{
+
+									if (each_pte != VPN(UXSTACKTOP - PGSIZE))
+  8028f2:	48 81 7d d0 ff f7 0e 	cmpq   $0xef7ff,-0x30(%rbp)
+  8028f9:	00 
+  8028fa:	74 58                	je     802954 <fork+0x237>
+									{
+										r = duppage(childid, (unsigned)each_pte);
+  8028fc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802900:	89 c2                	mov    %eax,%edx
+  802902:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802905:	89 d6                	mov    %edx,%esi
+  802907:	89 c7                	mov    %eax,%edi
+  802909:	48 b8 0e 25 80 00 00 	movabs $0x80250e,%rax
+  802910:	00 00 00 
+  802913:	ff d0                	call   *%rax
+  802915:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+										if (r < 0)
+  802918:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  80291c:	79 36                	jns    802954 <fork+0x237>
+											panic("\n couldn't call fork %e\n", r);
+  80291e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802921:	89 c1                	mov    %eax,%ecx
+  802923:	48 b8 cb 33 80 00 00 	movabs $0x8033cb,%rax
+  80292a:	00 00 00 
+  80292d:	48 89 c2             	mov    %rax,%rdx
+  802930:	be a9 00 00 00       	mov    $0xa9,%esi
+  802935:	48 b8 20 33 80 00 00 	movabs $0x803320,%rax
+  80293c:	00 00 00 
+  80293f:	48 89 c7             	mov    %rax,%rdi
+  802942:	b8 00 00 00 00       	mov    $0x0,%eax
+  802947:	49 b8 7d 02 80 00 00 	movabs $0x80027d,%r8
+  80294e:	00 00 00 
+  802951:	41 ff d0             	call   *%r8
+							for (pte = 0; pte < NPTENTRIES; pte++, each_pte++)
+  802954:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  802959:	48 83 45 d0 01       	addq   $0x1,-0x30(%rbp)
+  80295e:	48 81 7d e0 ff 01 00 	cmpq   $0x1ff,-0x20(%rbp)
+  802965:	00 
+  802966:	0f 86 6c ff ff ff    	jbe    8028d8 <fork+0x1bb>
+  80296c:	eb 10                	jmp    80297e <fork+0x261>
+								}
+							}
+						}
+						else
+						{
+							each_pte = (each_pde + 1) * NPTENTRIES;
+  80296e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802972:	48 83 c0 01          	add    $0x1,%rax
+  802976:	48 c1 e0 09          	shl    $0x9,%rax
+  80297a:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+					for (pde = 0; pde < NPDENTRIES; pde++, each_pde++)
+  80297e:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  802983:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802988:	48 81 7d e8 ff 01 00 	cmpq   $0x1ff,-0x18(%rbp)
+  80298f:	00 
+  802990:	0f 86 17 ff ff ff    	jbe    8028ad <fork+0x190>
+  802996:	eb 10                	jmp    8029a8 <fork+0x28b>
+						}
+					}
+				}
+				else
+				{
+					each_pde = (each_pdpe + 1) * NPDENTRIES;
+  802998:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80299c:	48 83 c0 01          	add    $0x1,%rax
+  8029a0:	48 c1 e0 09          	shl    $0x9,%rax
+  8029a4:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			for (pdpe = 0; pdpe < NPDPENTRIES; pdpe++, each_pdpe++)
+  8029a8:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8029ad:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  8029b2:	48 81 7d f0 ff 01 00 	cmpq   $0x1ff,-0x10(%rbp)
+  8029b9:	00 
+  8029ba:	0f 86 c2 fe ff ff    	jbe    802882 <fork+0x165>
+  8029c0:	eb 10                	jmp    8029d2 <fork+0x2b5>
+				}
+			}
+		}
+		else
+		{
+			each_pdpe = (pml + 1) * NPDPENTRIES;
+  8029c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029c6:	48 83 c0 01          	add    $0x1,%rax
+  8029ca:	48 c1 e0 09          	shl    $0x9,%rax
+  8029ce:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	for (pml = 0; pml < VPML4E(UTOP); pml++)
+  8029d2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8029d7:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8029dc:	0f 84 75 fe ff ff    	je     802857 <fork+0x13a>
+
+	extern void _pgfault_upcall(void);
+	// 为子环境设置页错误处理函数.
+	// 因为使用env_alloc()创建的env的处理函数指针都为空，但是这时已经明确的为其错误栈分配了物理页面
+	// 所以可以直接使用系统调用指定错误处理的入口，_pgfault_upcall()为所有用户页错误处理函数的总入口
+	r = sys_env_set_pgfault_upcall(childid, _pgfault_upcall);
+  8029e2:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8029e5:	48 ba 0b 2d 80 00 00 	movabs $0x802d0b,%rdx
+  8029ec:	00 00 00 
+  8029ef:	48 89 d6             	mov    %rdx,%rsi
+  8029f2:	89 c7                	mov    %eax,%edi
+  8029f4:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  8029fb:	00 00 00 
+  8029fe:	ff d0                	call   *%rax
+  802a00:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if (r < 0)
+  802a03:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  802a07:	79 36                	jns    802a3f <fork+0x322>
+		panic("\n couldn't call fork %e\n", r);
+  802a09:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802a0c:	89 c1                	mov    %eax,%ecx
+  802a0e:	48 b8 cb 33 80 00 00 	movabs $0x8033cb,%rax
+  802a15:	00 00 00 
+  802a18:	48 89 c2             	mov    %rax,%rdx
+  802a1b:	be c6 00 00 00       	mov    $0xc6,%esi
+  802a20:	48 b8 20 33 80 00 00 	movabs $0x803320,%rax
+  802a27:	00 00 00 
+  802a2a:	48 89 c7             	mov    %rax,%rdi
+  802a2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a32:	49 b8 7d 02 80 00 00 	movabs $0x80027d,%r8
+  802a39:	00 00 00 
+  802a3c:	41 ff d0             	call   *%r8
+
+	r = sys_env_set_status(childid, ENV_RUNNABLE);
+  802a3f:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802a42:	be 02 00 00 00       	mov    $0x2,%esi
+  802a47:	89 c7                	mov    %eax,%edi
+  802a49:	48 b8 aa 1e 80 00 00 	movabs $0x801eaa,%rax
+  802a50:	00 00 00 
+  802a53:	ff d0                	call   *%rax
+  802a55:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if (r < 0)
+  802a58:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  802a5c:	79 36                	jns    802a94 <fork+0x377>
+		panic("\n couldn't call fork %e\n", r);
+  802a5e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802a61:	89 c1                	mov    %eax,%ecx
+  802a63:	48 b8 cb 33 80 00 00 	movabs $0x8033cb,%rax
+  802a6a:	00 00 00 
+  802a6d:	48 89 c2             	mov    %rax,%rdx
+  802a70:	be ca 00 00 00       	mov    $0xca,%esi
+  802a75:	48 b8 20 33 80 00 00 	movabs $0x803320,%rax
+  802a7c:	00 00 00 
+  802a7f:	48 89 c7             	mov    %rax,%rdi
+  802a82:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a87:	49 b8 7d 02 80 00 00 	movabs $0x80027d,%r8
+  802a8e:	00 00 00 
+  802a91:	41 ff d0             	call   *%r8
+
+	return childid;
+  802a94:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  802a97:	c9                   	leave
+  802a98:	c3                   	ret
+
+0000000000802a99 <ipc_recv>:
+ * 如果 pg 为空，则传递 sys_ipc_recv 一个值，它将理解为“no page”的意思
+ * (Zero 不是正确的值，因为这是映射页面的完美有效位置)
+ */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802a99:	55                   	push   %rbp
+  802a9a:	48 89 e5             	mov    %rsp,%rbp
+  802a9d:	48 83 ec 30          	sub    $0x30,%rsp
+  802aa1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802aa5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802aa9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	int r = 0;
+  802aad:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	if(pg) {
+  802ab4:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802ab9:	74 18                	je     802ad3 <ipc_recv+0x3a>
+		r = sys_ipc_recv(pg);
+  802abb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802abf:	48 89 c7             	mov    %rax,%rdi
+  802ac2:	48 b8 e6 1f 80 00 00 	movabs $0x801fe6,%rax
+  802ac9:	00 00 00 
+  802acc:	ff d0                	call   *%rax
+  802ace:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ad1:	eb 1c                	jmp    802aef <ipc_recv+0x56>
+	}
+	// pg == 0, pg > UTOP
+	else {
+		r = sys_ipc_recv((void*)KERNBASE);
+  802ad3:	48 b8 00 00 00 04 80 	movabs $0x8004000000,%rax
+  802ada:	00 00 00 
+  802add:	48 89 c7             	mov    %rax,%rdi
+  802ae0:	48 b8 e6 1f 80 00 00 	movabs $0x801fe6,%rax
+  802ae7:	00 00 00 
+  802aea:	ff d0                	call   *%rax
+  802aec:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	}
+	if (r < 0) {
+  802aef:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802af3:	79 39                	jns    802b2e <ipc_recv+0x95>
+		*from_env_store =  (from_env_store != NULL) ? (envid_t)0 : *from_env_store;
+  802af5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802afa:	75 08                	jne    802b04 <ipc_recv+0x6b>
+  802afc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b00:	8b 00                	mov    (%rax),%eax
+  802b02:	eb 05                	jmp    802b09 <ipc_recv+0x70>
+  802b04:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b09:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802b0d:	89 02                	mov    %eax,(%rdx)
+		*perm_store = (perm_store != NULL) ? (int)0 : *perm_store;
+  802b0f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  802b14:	75 08                	jne    802b1e <ipc_recv+0x85>
+  802b16:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b1a:	8b 00                	mov    (%rax),%eax
+  802b1c:	eb 05                	jmp    802b23 <ipc_recv+0x8a>
+  802b1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b23:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802b27:	89 02                	mov    %eax,(%rdx)
+		return r;
+  802b29:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b2c:	eb 53                	jmp    802b81 <ipc_recv+0xe8>
+	}
+	// 设置from_env_store为发送进程的进程ID
+	if(from_env_store) {
+  802b2e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802b33:	74 19                	je     802b4e <ipc_recv+0xb5>
+		*from_env_store = thisproc->env_ipc_from;
+  802b35:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  802b3c:	00 00 00 
+  802b3f:	48 8b 00             	mov    (%rax),%rax
+  802b42:	8b 90 6c 01 00 00    	mov    0x16c(%rax),%edx
+  802b48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b4c:	89 10                	mov    %edx,(%rax)
+	}
+	// 如果传递物理页，该位不为0，设置perm_store为物理页的权限
+	if(perm_store) {
+  802b4e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  802b53:	74 19                	je     802b6e <ipc_recv+0xd5>
+		*perm_store = thisproc->env_ipc_perm;
+  802b55:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  802b5c:	00 00 00 
+  802b5f:	48 8b 00             	mov    (%rax),%rax
+  802b62:	8b 90 70 01 00 00    	mov    0x170(%rax),%edx
+  802b68:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b6c:	89 10                	mov    %edx,(%rax)
+	}
+	// 返回发送进程发送的值
+	return thisproc->env_ipc_value;
+  802b6e:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  802b75:	00 00 00 
+  802b78:	48 8b 00             	mov    (%rax),%rax
+  802b7b:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  802b81:	c9                   	leave
+  802b82:	c3                   	ret
+
+0000000000802b83 <ipc_send>:
+ * 使用sys_yield()使cpu友好
+ * 如果'pg'为null，则给sys_ipc_recv传递一个它会理解为“无页面”的值(0不是正确的值)
+ */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802b83:	55                   	push   %rbp
+  802b84:	48 89 e5             	mov    %rsp,%rbp
+  802b87:	48 83 ec 30          	sub    $0x30,%rsp
+  802b8b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802b8e:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  802b91:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802b95:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	int r = -E_IPC_NOT_RECV;
+  802b98:	c7 45 fc f8 ff ff ff 	movl   $0xfffffff8,-0x4(%rbp)
+	// 子进程不是接收状态
+	while(r == -E_IPC_NOT_RECV) {
+  802b9f:	eb 59                	jmp    802bfa <ipc_send+0x77>
+		if(pg) {
+  802ba1:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802ba6:	74 20                	je     802bc8 <ipc_send+0x45>
+			// 传递物理页
+			r = sys_ipc_try_send(to_env, val, pg, perm);
+  802ba8:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  802bab:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  802bae:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802bb2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bb5:	89 c7                	mov    %eax,%edi
+  802bb7:	48 b8 8f 1f 80 00 00 	movabs $0x801f8f,%rax
+  802bbe:	00 00 00 
+  802bc1:	ff d0                	call   *%rax
+  802bc3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802bc6:	eb 26                	jmp    802bee <ipc_send+0x6b>
+		}
+		// pg == 0, pg > UTOP
+		else {
+			// (void*)KERNBASE > UTOP
+			r = sys_ipc_try_send(to_env, val, (void*)KERNBASE, perm);
+  802bc8:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  802bcb:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802bce:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bd1:	89 d1                	mov    %edx,%ecx
+  802bd3:	48 ba 00 00 00 04 80 	movabs $0x8004000000,%rdx
+  802bda:	00 00 00 
+  802bdd:	89 c7                	mov    %eax,%edi
+  802bdf:	48 b8 8f 1f 80 00 00 	movabs $0x801f8f,%rax
+  802be6:	00 00 00 
+  802be9:	ff d0                	call   *%rax
+  802beb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+		}
+		// 让出CPU
+		sys_yield();
+  802bee:	48 b8 6f 1d 80 00 00 	movabs $0x801d6f,%rax
+  802bf5:	00 00 00 
+  802bf8:	ff d0                	call   *%rax
+	while(r == -E_IPC_NOT_RECV) {
+  802bfa:	83 7d fc f8          	cmpl   $0xfffffff8,-0x4(%rbp)
+  802bfe:	74 a1                	je     802ba1 <ipc_send+0x1e>
+	}
+	if (r != 0) {
+  802c00:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c04:	74 30                	je     802c36 <ipc_send+0xb3>
+		panic("something went wrong with sending the page");
+  802c06:	48 b8 e8 33 80 00 00 	movabs $0x8033e8,%rax
+  802c0d:	00 00 00 
+  802c10:	48 89 c2             	mov    %rax,%rdx
+  802c13:	be 48 00 00 00       	mov    $0x48,%esi
+  802c18:	48 b8 13 34 80 00 00 	movabs $0x803413,%rax
+  802c1f:	00 00 00 
+  802c22:	48 89 c7             	mov    %rax,%rdi
+  802c25:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c2a:	48 b9 7d 02 80 00 00 	movabs $0x80027d,%rcx
+  802c31:	00 00 00 
+  802c34:	ff d1                	call   *%rcx
+	}
+}
+  802c36:	90                   	nop
+  802c37:	c9                   	leave
+  802c38:	c3                   	ret
+
+0000000000802c39 <ipc_find_env>:
+// find special environments.
+// Returns 0 if no such environment exists.
+// 内核只遍历已分配的环境(env_live)，不扫描整个 procs[]
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802c39:	55                   	push   %rbp
+  802c3a:	48 89 e5             	mov    %rsp,%rbp
+  802c3d:	48 83 ec 20          	sub    $0x20,%rsp
+  802c41:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	envid_t r = sys_env_find(type);
+  802c44:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c47:	89 c7                	mov    %eax,%edi
+  802c49:	48 b8 5d 22 80 00 00 	movabs $0x80225d,%rax
+  802c50:	00 00 00 
+  802c53:	ff d0                	call   *%rax
+  802c55:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+	return r < 0 ? 0 : r;
+  802c58:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c60:	85 c0                	test   %eax,%eax
+  802c62:	0f 48 c2             	cmovs  %edx,%eax
+}
+  802c65:	c9                   	leave
+  802c66:	c3                   	ret
+
+0000000000802c67 <set_pgfault_handler>:
+ * 包含用户异常栈的初始化和页错误处理函数的设置，利用 kern/syscall.c sys_env_set_pgfault_upcall() 注册(utf字段)用户页错误处理函数
+ * 第一次注册处理程序时，需要分配一个异常堆栈(顶部位于UXSTACKTOP的一页内存)
+ * 并告诉内核在页错误发生时调用汇编语言 _pgfault_upcall 例程
+ */
+void set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802c67:	55                   	push   %rbp
+  802c68:	48 89 e5             	mov    %rsp,%rbp
+  802c6b:	48 83 ec 10          	sub    $0x10,%rsp
+  802c6f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	if (_pgfault_handler == 0)
+  802c73:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  802c7a:	00 00 00 
+  802c7d:	48 8b 00             	mov    (%rax),%rax
+  802c80:	48 85 c0             	test   %rax,%rax
+  802c83:	75 72                	jne    802cf7 <set_pgfault_handler+0x90>
+	{
+		// 第一次出错，创建用户异常栈
+		if (sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_W | PTE_U | PTE_P) == 0)
+  802c85:	ba 07 00 00 00       	mov    $0x7,%edx
+  802c8a:	b8 00 f0 7f ef       	mov    $0xef7ff000,%eax
+  802c8f:	48 89 c6             	mov    %rax,%rsi
+  802c92:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c97:	48 b8 ac 1d 80 00 00 	movabs $0x801dac,%rax
+  802c9e:	00 00 00 
+  802ca1:	ff d0                	call   *%rax
+  802ca3:	85 c0                	test   %eax,%eax
+  802ca5:	75 20                	jne    802cc7 <set_pgfault_handler+0x60>
+			sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  802ca7:	48 b8 0b 2d 80 00 00 	movabs $0x802d0b,%rax
+  802cae:	00 00 00 
+  802cb1:	48 89 c6             	mov    %rax,%rsi
+  802cb4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cb9:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  802cc0:	00 00 00 
+  802cc3:	ff d0                	call   *%rax
+  802cc5:	eb 30                	jmp    802cf7 <set_pgfault_handler+0x90>
+		else
+			panic("set_pgfault_handler(): no memory");
+  802cc7:	48 b8 20 34 80 00 00 	movabs $0x803420,%rax
+  802cce:	00 00 00 
+  802cd1:	48 89 c2             	mov    %rax,%rdx
+  802cd4:	be 1b 00 00 00       	mov    $0x1b,%esi
+  802cd9:	48 b8 41 34 80 00 00 	movabs $0x803441,%rax
+  802ce0:	00 00 00 
+  802ce3:	48 89 c7             	mov    %rax,%rdi
+  802ce6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ceb:	48 b9 7d 02 80 00 00 	movabs $0x80027d,%rcx
+  802cf2:	00 00 00 
+  802cf5:	ff d1                	call   *%rcx
+	}
+
+	// 存储汇编语言调用的处理函数指针.
+	_pgfault_handler = handler;
+  802cf7:	48 ba 18 40 80 00 00 	movabs $0x804018,%rdx
+  802cfe:	00 00 00 
+  802d01:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d05:	48 89 02             	mov    %rax,(%rdx)
+}
+  802d08:	90                   	nop
+  802d09:	c9                   	leave
+  802d0a:	c3                   	ret
+
+0000000000802d0b <_pgfault_upcall>:
+
+	// 调用C代码中的页错误处理函数.
+	// 函数参数: 指向 UTrapframe 的指针
+
+	// 通过 %rdi 传递函数参数
+	movq  %rsp, %rdi
+  802d0b:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  802d0e:	48 a1 18 40 80 00 00 	movabs 0x804018,%rax
+  802d15:	00 00 00 
+	call *%rax
+  802d18:	ff d0                	call   *%rax
+			regs: 15*8 = 120-Byte,
+			eflags: 8-Byte,
+			rip: 8-Byte
+	*/
+
+	addq $16, %rsp	/* 跳过用户异常栈中的 utf_fault_va 和 utf_err(不需要) */
+  802d1a:	48 83 c4 10          	add    $0x10,%rsp
+	
+	/* 用户异常栈: %rsp 指向 end of struct PushRegs */
+	
+	movq 120(%rsp), %r10	/* %r10 = %rip */
+  802d1e:	4c 8b 54 24 78       	mov    0x78(%rsp),%r10
+	movq 136(%rsp), %r11	/* %r11 = %rsp */
+  802d23:	4c 8b 9c 24 88 00 00 	mov    0x88(%rsp),%r11
+  802d2a:	00 
+
+	subq $8, %r11			/* %r11(trap-time %rsp) - 8 */
+  802d2b:	49 83 eb 08          	sub    $0x8,%r11
+	movq %r10, (%r11)		/* %r11(trap-time %rsp) 指向的值为 %rip */
+  802d2f:	4d 89 13             	mov    %r10,(%r11)
+	movq %r11, 136(%rsp)	/* 更新 trap-time %rsp 的值 */
+  802d32:	4c 89 9c 24 88 00 00 	mov    %r11,0x88(%rsp)
+  802d39:	00 
+		trap-time eflags
+		trap-time rip
+	*/
+
+	// 恢复 trap-time 寄存器集.  接下来不能再修改任何通用寄存器集 PushRegs.
+	POPA_	/* 之前已经通过增加 16-Byte 跳过了 fault_va 和 utf_err，所以只需使用 POPA_ 恢复 */
+  802d3a:	4c 8b 3c 24          	mov    (%rsp),%r15
+  802d3e:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  802d43:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  802d48:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  802d4d:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  802d52:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  802d57:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  802d5c:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  802d61:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  802d66:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  802d6b:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  802d70:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  802d75:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  802d7a:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  802d7f:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  802d84:	48 83 c4 78          	add    $0x78,%rsp
+
+	// 从栈中恢复 %eflags.  接下来不能再使用修改 %eflags 的指令，比如算术指令sub, cmp等.
+	addq $8, %rsp	/* 跳过 %rip，指向 %eflags */
+  802d88:	48 83 c4 08          	add    $0x8,%rsp
+	popfq			/* 从栈中恢复 %eflags */
+  802d8c:	9d                   	popf
+		(blank 8-Byte)
+		trap-time rip
+	*/
+
+	// 切换回调整后的 trap-time 栈.
+	popq %rsp		/* 已经指向 %rsp，直接 pop 恢复 */
+  802d8d:	5c                   	pop    %rsp
+
+	// 返回重新执行引起页错误的环境指令.
+	ret				/* popq %rip */
+  802d8e:	c3                   	ret
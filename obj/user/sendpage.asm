@@ -0,0 +1,4776 @@
+
+obj/user/sendpage.debug:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// entrypoint - 当最初被加载到一个新的环境中时，内核(或者父环境)在这里开始运行.
+.text
+.globl _start
+_start:
+	// 判断是否从栈上的参数开始初始化
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	// $USTACKTOP != %rsp 说明有参数，跳转到 args_exist
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// 如果不是(新环境被内核加载的时候)，则 push 伪造的 argc, argv 参数
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 72 02 00 00       	call   8002b3 <libmain>
+
+// 不应该返回
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+
+#define TEMP_PAGE ((char *)0xa00000)
+#define TEMP_PAGE_CHILD ((char *)0xb00000)
+
+void umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	48 83 ec 20          	sub    $0x20,%rsp
+  80004b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80004e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int32_t who;
+
+	if ((who = fork()) == 0)
+  800052:	48 b8 ce 26 80 00 00 	movabs $0x8026ce,%rax
+  800059:	00 00 00 
+  80005c:	ff d0                	call   *%rax
+  80005e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800061:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800064:	85 c0                	test   %eax,%eax
+  800066:	0f 85 0f 01 00 00    	jne    80017b <umain+0x138>
+	{
+		// Child
+		// 子进程设置接收状态，并进入阻塞态让出CPU
+		ipc_recv(&who, TEMP_PAGE_CHILD, 0);
+  80006c:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+  800070:	ba 00 00 00 00       	mov    $0x0,%edx
+  800075:	be 00 00 b0 00       	mov    $0xb00000,%esi
+  80007a:	48 89 c7             	mov    %rax,%rdi
+  80007d:	48 b8 4a 2a 80 00 00 	movabs $0x802a4a,%rax
+  800084:	00 00 00 
+  800087:	ff d0                	call   *%rax
+		// 由父进程将物理页 TEMP_PAGE 映射到 TEMP_PAGE_CHILD
+		cprintf("%x got message : %s\n", who, TEMP_PAGE_CHILD);
+  800089:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80008c:	ba 00 00 b0 00       	mov    $0xb00000,%edx
+  800091:	89 c6                	mov    %eax,%esi
+  800093:	48 b8 c0 2e 80 00 00 	movabs $0x802ec0,%rax
+  80009a:	00 00 00 
+  80009d:	48 89 c7             	mov    %rax,%rdi
+  8000a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a5:	48 b9 71 04 80 00 00 	movabs $0x800471,%rcx
+  8000ac:	00 00 00 
+  8000af:	ff d1                	call   *%rcx
+		// 对比字符串
+		if (strncmp(TEMP_PAGE_CHILD, str1, strlen(str1)) == 0)
+  8000b1:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8000b8:	00 00 00 
+  8000bb:	48 8b 00             	mov    (%rax),%rax
+  8000be:	48 89 c7             	mov    %rax,%rdi
+  8000c1:	48 b8 8c 10 80 00 00 	movabs $0x80108c,%rax
+  8000c8:	00 00 00 
+  8000cb:	ff d0                	call   *%rax
+  8000cd:	48 63 d0             	movslq %eax,%rdx
+  8000d0:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8000d7:	00 00 00 
+  8000da:	48 8b 00             	mov    (%rax),%rax
+  8000dd:	48 89 c6             	mov    %rax,%rsi
+  8000e0:	bf 00 00 b0 00       	mov    $0xb00000,%edi
+  8000e5:	48 b8 a7 12 80 00 00 	movabs $0x8012a7,%rax
+  8000ec:	00 00 00 
+  8000ef:	ff d0                	call   *%rax
+  8000f1:	85 c0                	test   %eax,%eax
+  8000f3:	75 1e                	jne    800113 <umain+0xd0>
+			cprintf("child received correct message\n");
+  8000f5:	48 b8 d8 2e 80 00 00 	movabs $0x802ed8,%rax
+  8000fc:	00 00 00 
+  8000ff:	48 89 c7             	mov    %rax,%rdi
+  800102:	b8 00 00 00 00       	mov    $0x0,%eax
+  800107:	48 ba 71 04 80 00 00 	movabs $0x800471,%rdx
+  80010e:	00 00 00 
+  800111:	ff d2                	call   *%rdx
+
+		// 复制 str2 到 TEMP_PAGE_CHILD
+		memcpy(TEMP_PAGE_CHILD, str2, strlen(str1) + 1);
+  800113:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80011a:	00 00 00 
+  80011d:	48 8b 00             	mov    (%rax),%rax
+  800120:	48 89 c7             	mov    %rax,%rdi
+  800123:	48 b8 8c 10 80 00 00 	movabs $0x80108c,%rax
+  80012a:	00 00 00 
+  80012d:	ff d0                	call   *%rax
+  80012f:	83 c0 01             	add    $0x1,%eax
+  800132:	48 63 d0             	movslq %eax,%rdx
+  800135:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  80013c:	00 00 00 
+  80013f:	48 8b 00             	mov    (%rax),%rax
+  800142:	48 89 c6             	mov    %rax,%rsi
+  800145:	bf 00 00 b0 00       	mov    $0xb00000,%edi
+  80014a:	48 b8 59 18 80 00 00 	movabs $0x801859,%rax
+  800151:	00 00 00 
+  800154:	ff d0                	call   *%rax
+		// who: 父进程ID，以用户可读写的权限传递 TEMP_PAGE_CHILD 一页物理页到父进程
+		ipc_send(who, 0, TEMP_PAGE_CHILD, PTE_P | PTE_W | PTE_U);
+  800156:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800159:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80015e:	ba 00 00 b0 00       	mov    $0xb00000,%edx
+  800163:	be 00 00 00 00       	mov    $0x0,%esi
+  800168:	89 c7                	mov    %eax,%edi
+  80016a:	48 b8 34 2b 80 00 00 	movabs $0x802b34,%rax
+  800171:	00 00 00 
+  800174:	ff d0                	call   *%rax
+		return;
+  800176:	e9 36 01 00 00       	jmp    8002b1 <umain+0x26e>
+	}
+
+	// Parent
+	// 为自己分配一页物理内存，并将其以用户可读写的权限映射到当前进程虚拟地址空间的TEMP_PAGE
+	sys_page_alloc(thisproc->proc_id, TEMP_PAGE, PTE_P | PTE_W | PTE_U);
+  80017b:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  800182:	00 00 00 
+  800185:	48 8b 00             	mov    (%rax),%rax
+  800188:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  80018e:	ba 07 00 00 00       	mov    $0x7,%edx
+  800193:	be 00 00 a0 00       	mov    $0xa00000,%esi
+  800198:	89 c7                	mov    %eax,%edi
+  80019a:	48 b8 5d 1d 80 00 00 	movabs $0x801d5d,%rax
+  8001a1:	00 00 00 
+  8001a4:	ff d0                	call   *%rax
+	// 复制 str1 到 TEMP_PAGE
+	memcpy(TEMP_PAGE, str1, strlen(str1) + 1);
+  8001a6:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8001ad:	00 00 00 
+  8001b0:	48 8b 00             	mov    (%rax),%rax
+  8001b3:	48 89 c7             	mov    %rax,%rdi
+  8001b6:	48 b8 8c 10 80 00 00 	movabs $0x80108c,%rax
+  8001bd:	00 00 00 
+  8001c0:	ff d0                	call   *%rax
+  8001c2:	83 c0 01             	add    $0x1,%eax
+  8001c5:	48 63 d0             	movslq %eax,%rdx
+  8001c8:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8001cf:	00 00 00 
+  8001d2:	48 8b 00             	mov    (%rax),%rax
+  8001d5:	48 89 c6             	mov    %rax,%rsi
+  8001d8:	bf 00 00 a0 00       	mov    $0xa00000,%edi
+  8001dd:	48 b8 59 18 80 00 00 	movabs $0x801859,%rax
+  8001e4:	00 00 00 
+  8001e7:	ff d0                	call   *%rax
+	// who: 子进程ID，以用户可读写的权限传递 TEMP_PAGE 一页物理页到子进程
+	ipc_send(who, 0, TEMP_PAGE, PTE_P | PTE_W | PTE_U);
+  8001e9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8001ec:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8001f1:	ba 00 00 a0 00       	mov    $0xa00000,%edx
+  8001f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8001fb:	89 c7                	mov    %eax,%edi
+  8001fd:	48 b8 34 2b 80 00 00 	movabs $0x802b34,%rax
+  800204:	00 00 00 
+  800207:	ff d0                	call   *%rax
+
+	// 父进程设置接收状态，并进入阻塞态让出CPU
+	ipc_recv(&who, TEMP_PAGE, 0);
+  800209:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+  80020d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800212:	be 00 00 a0 00       	mov    $0xa00000,%esi
+  800217:	48 89 c7             	mov    %rax,%rdi
+  80021a:	48 b8 4a 2a 80 00 00 	movabs $0x802a4a,%rax
+  800221:	00 00 00 
+  800224:	ff d0                	call   *%rax
+	cprintf("%x got message : %s\n", who, TEMP_PAGE);
+  800226:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800229:	ba 00 00 a0 00       	mov    $0xa00000,%edx
+  80022e:	89 c6                	mov    %eax,%esi
+  800230:	48 b8 c0 2e 80 00 00 	movabs $0x802ec0,%rax
+  800237:	00 00 00 
+  80023a:	48 89 c7             	mov    %rax,%rdi
+  80023d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800242:	48 b9 71 04 80 00 00 	movabs $0x800471,%rcx
+  800249:	00 00 00 
+  80024c:	ff d1                	call   *%rcx
+	// 对比字符串
+	if (strncmp(TEMP_PAGE, str2, strlen(str2)) == 0)
+  80024e:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  800255:	00 00 00 
+  800258:	48 8b 00             	mov    (%rax),%rax
+  80025b:	48 89 c7             	mov    %rax,%rdi
+  80025e:	48 b8 8c 10 80 00 00 	movabs $0x80108c,%rax
+  800265:	00 00 00 
+  800268:	ff d0                	call   *%rax
+  80026a:	48 63 d0             	movslq %eax,%rdx
+  80026d:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  800274:	00 00 00 
+  800277:	48 8b 00             	mov    (%rax),%rax
+  80027a:	48 89 c6             	mov    %rax,%rsi
+  80027d:	bf 00 00 a0 00       	mov    $0xa00000,%edi
+  800282:	48 b8 a7 12 80 00 00 	movabs $0x8012a7,%rax
+  800289:	00 00 00 
+  80028c:	ff d0                	call   *%rax
+  80028e:	85 c0                	test   %eax,%eax
+  800290:	75 1e                	jne    8002b0 <umain+0x26d>
+		cprintf("parent received correct message\n");
+  800292:	48 b8 f8 2e 80 00 00 	movabs $0x802ef8,%rax
+  800299:	00 00 00 
+  80029c:	48 89 c7             	mov    %rax,%rdi
+  80029f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a4:	48 ba 71 04 80 00 00 	movabs $0x800471,%rdx
+  8002ab:	00 00 00 
+  8002ae:	ff d2                	call   *%rdx
+	return;
+  8002b0:	90                   	nop
+}
+  8002b1:	c9                   	leave
+  8002b2:	c3                   	ret
+
+00000000008002b3 <libmain>:
+
+/**
+ *  用户环境从lib/libmain.c中的函数libmain开始执行，这个函数进而调用umain，用户写的程序入口只能是umain
+ */
+void libmain(int argc, char **argv)
+{
+  8002b3:	55                   	push   %rbp
+  8002b4:	48 89 e5             	mov    %rsp,%rbp
+  8002b7:	48 83 ec 10          	sub    $0x10,%rsp
+  8002bb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8002be:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 设置常量 thisproc 指向 procs[] 中当前环境的 Env 结构，ENVX 确保环境 id 未超过了 NENV
+	// thisproc 指向当前环境的 Env 结构
+	thisproc = &procs[ENVX(sys_getprocid())];
+  8002c2:	48 b8 e4 1c 80 00 00 	movabs $0x801ce4,%rax
+  8002c9:	00 00 00 
+  8002cc:	ff d0                	call   *%rax
+  8002ce:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002d3:	48 98                	cltq
+  8002d5:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  8002dc:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  8002e3:	00 00 00 
+  8002e6:	48 01 c2             	add    %rax,%rdx
+  8002e9:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  8002f0:	00 00 00 
+  8002f3:	48 89 10             	mov    %rdx,(%rax)
+
+	// 通过 CPUID 选择 memset/memmove/memcpy 的实现
+	mem_init();
+  8002f6:	48 b8 8c 13 80 00 00 	movabs $0x80138c,%rax
+  8002fd:	00 00 00 
+  800300:	ff d0                	call   *%rax
+
+	// 为了能让panic()提示用户错误，存储程序的名称
+	if (argc > 0)
+  800302:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800306:	7e 14                	jle    80031c <libmain+0x69>
+		binaryname = argv[0];
+  800308:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80030c:	48 8b 00             	mov    (%rax),%rax
+  80030f:	48 ba 10 40 80 00 00 	movabs $0x804010,%rdx
+  800316:	00 00 00 
+  800319:	48 89 02             	mov    %rax,(%rdx)
+
+	// 调用用户的主程序
+	umain(argc, argv);
+  80031c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800320:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800323:	48 89 d6             	mov    %rdx,%rsi
+  800326:	89 c7                	mov    %eax,%edi
+  800328:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  80032f:	00 00 00 
+  800332:	ff d0                	call   *%rax
+
+	// 退出当前环境，env_destroy
+	sys_env_destroy(0);
+  800334:	bf 00 00 00 00       	mov    $0x0,%edi
+  800339:	48 b8 9e 1c 80 00 00 	movabs $0x801c9e,%rax
+  800340:	00 00 00 
+  800343:	ff d0                	call   *%rax
+}
+  800345:	90                   	nop
+  800346:	c9                   	leave
+  800347:	c3                   	ret
+
+0000000000800348 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800348:	55                   	push   %rbp
+  800349:	48 89 e5             	mov    %rsp,%rbp
+  80034c:	48 83 ec 10          	sub    $0x10,%rsp
+  800350:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800353:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->buf[b->idx++] = ch;
+  800357:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80035b:	8b 00                	mov    (%rax),%eax
+  80035d:	8d 48 01             	lea    0x1(%rax),%ecx
+  800360:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800364:	89 0a                	mov    %ecx,(%rdx)
+  800366:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800369:	89 d1                	mov    %edx,%ecx
+  80036b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80036f:	48 98                	cltq
+  800371:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+	if (b->idx == 256-1) {
+  800375:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800379:	8b 00                	mov    (%rax),%eax
+  80037b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800380:	75 2c                	jne    8003ae <putch+0x66>
+		sys_cputs(b->buf, b->idx);
+  800382:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800386:	8b 00                	mov    (%rax),%eax
+  800388:	48 98                	cltq
+  80038a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80038e:	48 83 c2 08          	add    $0x8,%rdx
+  800392:	48 89 c6             	mov    %rax,%rsi
+  800395:	48 89 d7             	mov    %rdx,%rdi
+  800398:	48 b8 15 1c 80 00 00 	movabs $0x801c15,%rax
+  80039f:	00 00 00 
+  8003a2:	ff d0                	call   *%rax
+		b->idx = 0;
+  8003a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003a8:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	}
+	b->cnt++;
+  8003ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003b2:	8b 40 04             	mov    0x4(%rax),%eax
+  8003b5:	8d 50 01             	lea    0x1(%rax),%edx
+  8003b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003bc:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8003bf:	90                   	nop
+  8003c0:	c9                   	leave
+  8003c1:	c3                   	ret
+
+00000000008003c2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003c2:	55                   	push   %rbp
+  8003c3:	48 89 e5             	mov    %rsp,%rbp
+  8003c6:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8003cd:	48 89 bd c8 fe ff ff 	mov    %rdi,-0x138(%rbp)
+  8003d4:	48 89 b5 c0 fe ff ff 	mov    %rsi,-0x140(%rbp)
+	struct printbuf b;
+	va_list aq;
+	va_copy(aq,ap);
+  8003db:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  8003e2:	48 8b b5 c0 fe ff ff 	mov    -0x140(%rbp),%rsi
+  8003e9:	48 8b 06             	mov    (%rsi),%rax
+  8003ec:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8003f0:	48 89 01             	mov    %rax,(%rcx)
+  8003f3:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8003f7:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8003fb:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	b.idx = 0;
+  8003ff:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800406:	00 00 00 
+	b.cnt = 0;
+  800409:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800410:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, aq);
+  800413:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  80041a:	48 8b 95 c8 fe ff ff 	mov    -0x138(%rbp),%rdx
+  800421:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800428:	48 89 c6             	mov    %rax,%rsi
+  80042b:	48 b8 48 03 80 00 00 	movabs $0x800348,%rax
+  800432:	00 00 00 
+  800435:	48 89 c7             	mov    %rax,%rdi
+  800438:	48 b8 0f 08 80 00 00 	movabs $0x80080f,%rax
+  80043f:	00 00 00 
+  800442:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  800444:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  80044a:	48 98                	cltq
+  80044c:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800453:	48 83 c2 08          	add    $0x8,%rdx
+  800457:	48 89 c6             	mov    %rax,%rsi
+  80045a:	48 89 d7             	mov    %rdx,%rdi
+  80045d:	48 b8 15 1c 80 00 00 	movabs $0x801c15,%rax
+  800464:	00 00 00 
+  800467:	ff d0                	call   *%rax
+	va_end(aq);
+
+	return b.cnt;
+  800469:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80046f:	c9                   	leave
+  800470:	c3                   	ret
+
+0000000000800471 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800471:	55                   	push   %rbp
+  800472:	48 89 e5             	mov    %rsp,%rbp
+  800475:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  80047c:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800483:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80048a:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800491:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800498:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80049f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8004a6:	84 c0                	test   %al,%al
+  8004a8:	74 20                	je     8004ca <cprintf+0x59>
+  8004aa:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8004ae:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8004b2:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8004b6:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8004ba:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8004be:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8004c2:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8004c6:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+	va_list aq;
+	va_start(ap, fmt);
+  8004ca:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8004d1:	00 00 00 
+  8004d4:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8004db:	00 00 00 
+  8004de:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004e2:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8004e9:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8004f0:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  8004f7:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8004fe:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800505:	48 8b 06             	mov    (%rsi),%rax
+  800508:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80050c:	48 89 01             	mov    %rax,(%rcx)
+  80050f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800513:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800517:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	cnt = vcprintf(fmt, aq);
+  80051b:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800522:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800529:	48 89 d6             	mov    %rdx,%rsi
+  80052c:	48 89 c7             	mov    %rax,%rdi
+  80052f:	48 b8 c2 03 80 00 00 	movabs $0x8003c2,%rax
+  800536:	00 00 00 
+  800539:	ff d0                	call   *%rax
+  80053b:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return cnt;
+  800541:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800547:	c9                   	leave
+  800548:	c3                   	ret
+
+0000000000800549 <printnum>:
+ * num: 需要打印出来的整型数，base: 整型数的进制，其他参数同 vprintfmt
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+		 unsigned long long num, unsigned base, int width, int padc)
+{
+  800549:	55                   	push   %rbp
+  80054a:	48 89 e5             	mov    %rsp,%rbp
+  80054d:	48 83 ec 30          	sub    $0x30,%rsp
+  800551:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800555:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800559:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80055d:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  800560:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  800564:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+	// 当 num 超过一位数，首先递归函数自身打印所有高位的(更重要的)数字
+	if (num >= base)
+  800568:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80056b:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  80056f:	72 54                	jb     8005c5 <printnum+0x7c>
+	{
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800571:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800574:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800577:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  80057a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80057e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800583:	48 f7 f6             	div    %rsi
+  800586:	49 89 c2             	mov    %rax,%r10
+  800589:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80058c:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80058f:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800593:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800597:	41 89 c9             	mov    %ecx,%r9d
+  80059a:	41 89 f8             	mov    %edi,%r8d
+  80059d:	89 d1                	mov    %edx,%ecx
+  80059f:	4c 89 d2             	mov    %r10,%rdx
+  8005a2:	48 89 c7             	mov    %rax,%rdi
+  8005a5:	48 b8 49 05 80 00 00 	movabs $0x800549,%rax
+  8005ac:	00 00 00 
+  8005af:	ff d0                	call   *%rax
+  8005b1:	eb 1c                	jmp    8005cf <printnum+0x86>
+	}
+	else
+	{
+		// 按照右对齐的格式在左侧补齐填充字符 padc
+		while (--width > 0)
+			putch(padc, putdat);
+  8005b3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005b7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8005ba:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8005be:	48 89 d6             	mov    %rdx,%rsi
+  8005c1:	89 c7                	mov    %eax,%edi
+  8005c3:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8005c5:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  8005c9:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8005cd:	7f e4                	jg     8005b3 <printnum+0x6a>
+	}
+
+	// 然后打印个位数字
+	putch("0123456789abcdef"[num % base], putdat);
+  8005cf:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8005d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005db:	48 f7 f1             	div    %rcx
+  8005de:	48 b8 30 31 80 00 00 	movabs $0x803130,%rax
+  8005e5:	00 00 00 
+  8005e8:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8005ec:	0f be c0             	movsbl %al,%eax
+  8005ef:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005f3:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8005f7:	48 89 d6             	mov    %rdx,%rsi
+  8005fa:	89 c7                	mov    %eax,%edi
+  8005fc:	ff d1                	call   *%rcx
+}
+  8005fe:	90                   	nop
+  8005ff:	c9                   	leave
+  800600:	c3                   	ret
+
+0000000000800601 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800601:	55                   	push   %rbp
+  800602:	48 89 e5             	mov    %rsp,%rbp
+  800605:	48 83 ec 20          	sub    $0x20,%rsp
+  800609:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80060d:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;
+	if (lflag >= 2)
+  800610:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800614:	7e 4f                	jle    800665 <getuint+0x64>
+		x = va_arg(*ap, unsigned long long);
+  800616:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80061a:	8b 00                	mov    (%rax),%eax
+  80061c:	83 f8 2f             	cmp    $0x2f,%eax
+  80061f:	77 24                	ja     800645 <getuint+0x44>
+  800621:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800625:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800629:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80062d:	8b 00                	mov    (%rax),%eax
+  80062f:	89 c0                	mov    %eax,%eax
+  800631:	48 01 d0             	add    %rdx,%rax
+  800634:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800638:	8b 12                	mov    (%rdx),%edx
+  80063a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80063d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800641:	89 0a                	mov    %ecx,(%rdx)
+  800643:	eb 14                	jmp    800659 <getuint+0x58>
+  800645:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800649:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80064d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800651:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800655:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800659:	48 8b 00             	mov    (%rax),%rax
+  80065c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800660:	e9 9d 00 00 00       	jmp    800702 <getuint+0x101>
+	else if (lflag)
+  800665:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800669:	74 4c                	je     8006b7 <getuint+0xb6>
+		x = va_arg(*ap, unsigned long);
+  80066b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80066f:	8b 00                	mov    (%rax),%eax
+  800671:	83 f8 2f             	cmp    $0x2f,%eax
+  800674:	77 24                	ja     80069a <getuint+0x99>
+  800676:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80067a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80067e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800682:	8b 00                	mov    (%rax),%eax
+  800684:	89 c0                	mov    %eax,%eax
+  800686:	48 01 d0             	add    %rdx,%rax
+  800689:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80068d:	8b 12                	mov    (%rdx),%edx
+  80068f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800692:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800696:	89 0a                	mov    %ecx,(%rdx)
+  800698:	eb 14                	jmp    8006ae <getuint+0xad>
+  80069a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80069e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006a2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006a6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006aa:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006ae:	48 8b 00             	mov    (%rax),%rax
+  8006b1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8006b5:	eb 4b                	jmp    800702 <getuint+0x101>
+	else
+		x = va_arg(*ap, unsigned int);
+  8006b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006bb:	8b 00                	mov    (%rax),%eax
+  8006bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c0:	77 24                	ja     8006e6 <getuint+0xe5>
+  8006c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006c6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006ce:	8b 00                	mov    (%rax),%eax
+  8006d0:	89 c0                	mov    %eax,%eax
+  8006d2:	48 01 d0             	add    %rdx,%rax
+  8006d5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006d9:	8b 12                	mov    (%rdx),%edx
+  8006db:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006de:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006e2:	89 0a                	mov    %ecx,(%rdx)
+  8006e4:	eb 14                	jmp    8006fa <getuint+0xf9>
+  8006e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006ea:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006ee:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006f2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006f6:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006fa:	8b 00                	mov    (%rax),%eax
+  8006fc:	89 c0                	mov    %eax,%eax
+  8006fe:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800702:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800706:	c9                   	leave
+  800707:	c3                   	ret
+
+0000000000800708 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800708:	55                   	push   %rbp
+  800709:	48 89 e5             	mov    %rsp,%rbp
+  80070c:	48 83 ec 20          	sub    $0x20,%rsp
+  800710:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800714:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800717:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  80071b:	7e 4f                	jle    80076c <getint+0x64>
+		x = va_arg(*ap, long long);
+  80071d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800721:	8b 00                	mov    (%rax),%eax
+  800723:	83 f8 2f             	cmp    $0x2f,%eax
+  800726:	77 24                	ja     80074c <getint+0x44>
+  800728:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80072c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800730:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800734:	8b 00                	mov    (%rax),%eax
+  800736:	89 c0                	mov    %eax,%eax
+  800738:	48 01 d0             	add    %rdx,%rax
+  80073b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80073f:	8b 12                	mov    (%rdx),%edx
+  800741:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800744:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800748:	89 0a                	mov    %ecx,(%rdx)
+  80074a:	eb 14                	jmp    800760 <getint+0x58>
+  80074c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800750:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800754:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800758:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80075c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800760:	48 8b 00             	mov    (%rax),%rax
+  800763:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800767:	e9 9d 00 00 00       	jmp    800809 <getint+0x101>
+	else if (lflag)
+  80076c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800770:	74 4c                	je     8007be <getint+0xb6>
+		x = va_arg(*ap, long);
+  800772:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800776:	8b 00                	mov    (%rax),%eax
+  800778:	83 f8 2f             	cmp    $0x2f,%eax
+  80077b:	77 24                	ja     8007a1 <getint+0x99>
+  80077d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800781:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800785:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800789:	8b 00                	mov    (%rax),%eax
+  80078b:	89 c0                	mov    %eax,%eax
+  80078d:	48 01 d0             	add    %rdx,%rax
+  800790:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800794:	8b 12                	mov    (%rdx),%edx
+  800796:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800799:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80079d:	89 0a                	mov    %ecx,(%rdx)
+  80079f:	eb 14                	jmp    8007b5 <getint+0xad>
+  8007a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007a5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007a9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007ad:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007b1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007b5:	48 8b 00             	mov    (%rax),%rax
+  8007b8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8007bc:	eb 4b                	jmp    800809 <getint+0x101>
+	else
+		x = va_arg(*ap, int);
+  8007be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007c2:	8b 00                	mov    (%rax),%eax
+  8007c4:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c7:	77 24                	ja     8007ed <getint+0xe5>
+  8007c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007cd:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007d5:	8b 00                	mov    (%rax),%eax
+  8007d7:	89 c0                	mov    %eax,%eax
+  8007d9:	48 01 d0             	add    %rdx,%rax
+  8007dc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007e0:	8b 12                	mov    (%rdx),%edx
+  8007e2:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007e5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007e9:	89 0a                	mov    %ecx,(%rdx)
+  8007eb:	eb 14                	jmp    800801 <getint+0xf9>
+  8007ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007f1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007f5:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007f9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007fd:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800801:	8b 00                	mov    (%rax),%eax
+  800803:	48 98                	cltq
+  800805:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800809:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80080d:	c9                   	leave
+  80080e:	c3                   	ret
+
+000000000080080f <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap)
+{
+  80080f:	55                   	push   %rbp
+  800810:	48 89 e5             	mov    %rsp,%rbp
+  800813:	41 54                	push   %r12
+  800815:	53                   	push   %rbx
+  800816:	48 83 ec 60          	sub    $0x60,%rsp
+  80081a:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80081e:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800822:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800826:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+	int base, lflag, width, precision, altflag;
+
+	// 填充字符，在显示字符串的'%'后读到'-'或'0'时，赋值到 padc
+	char padc;
+	va_list aq;
+	va_copy(aq, ap);
+  80082a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80082e:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800832:	48 8b 06             	mov    (%rsi),%rax
+  800835:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800839:	48 89 01             	mov    %rax,(%rcx)
+  80083c:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800840:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800844:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1)
+	{
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800848:	eb 17                	jmp    800861 <vprintfmt+0x52>
+		{
+			if (ch == '\0')
+  80084a:	85 db                	test   %ebx,%ebx
+  80084c:	0f 84 b9 04 00 00    	je     800d0b <vprintfmt+0x4fc>
+				return;
+			putch(ch, putdat);
+  800852:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800856:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80085a:	48 89 c6             	mov    %rax,%rsi
+  80085d:	89 df                	mov    %ebx,%edi
+  80085f:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800861:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800865:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800869:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80086d:	0f b6 00             	movzbl (%rax),%eax
+  800870:	0f b6 d8             	movzbl %al,%ebx
+  800873:	83 fb 25             	cmp    $0x25,%ebx
+  800876:	75 d2                	jne    80084a <vprintfmt+0x3b>
+		}
+
+		// 处理 % 转义序列
+		// padc 初始化为空格符，padc='-'代表字符串左对齐，右边补空格，padc=' '代表右对齐，左边补空格，padc='0'右对齐，左边补0
+		padc = ' ';
+  800878:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+		width = -1;
+  80087c:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+		// 默认-1代表显示长度为字符串本来的长度
+		precision = -1;
+  800883:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+		lflag = 0;
+  80088a:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+		altflag = 0;
+  800891:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *)fmt++)
+  800898:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80089c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8008a0:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8008a4:	0f b6 00             	movzbl (%rax),%eax
+  8008a7:	0f b6 d8             	movzbl %al,%ebx
+  8008aa:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8008ad:	83 f8 55             	cmp    $0x55,%eax
+  8008b0:	0f 87 22 04 00 00    	ja     800cd8 <vprintfmt+0x4c9>
+  8008b6:	89 c0                	mov    %eax,%eax
+  8008b8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8008bf:	00 
+  8008c0:	48 b8 58 31 80 00 00 	movabs $0x803158,%rax
+  8008c7:	00 00 00 
+  8008ca:	48 01 d0             	add    %rdx,%rax
+  8008cd:	48 8b 00             	mov    (%rax),%rax
+  8008d0:	ff e0                	jmp    *%rax
+		{
+
+		// flag to pad on the right
+		case '-':
+			padc = '-';
+  8008d2:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+			goto reswitch;
+  8008d6:	eb c0                	jmp    800898 <vprintfmt+0x89>
+
+		// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  8008d8:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+			goto reswitch;
+  8008dc:	eb ba                	jmp    800898 <vprintfmt+0x89>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0;; ++fmt)
+  8008de:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+			{
+				precision = precision * 10 + ch - '0';
+  8008e5:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8008e8:	89 d0                	mov    %edx,%eax
+  8008ea:	c1 e0 02             	shl    $0x2,%eax
+  8008ed:	01 d0                	add    %edx,%eax
+  8008ef:	01 c0                	add    %eax,%eax
+  8008f1:	01 d8                	add    %ebx,%eax
+  8008f3:	83 e8 30             	sub    $0x30,%eax
+  8008f6:	89 45 d8             	mov    %eax,-0x28(%rbp)
+				ch = *fmt;
+  8008f9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8008fd:	0f b6 00             	movzbl (%rax),%eax
+  800900:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800903:	83 fb 2f             	cmp    $0x2f,%ebx
+  800906:	7e 60                	jle    800968 <vprintfmt+0x159>
+  800908:	83 fb 39             	cmp    $0x39,%ebx
+  80090b:	7f 5b                	jg     800968 <vprintfmt+0x159>
+			for (precision = 0;; ++fmt)
+  80090d:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+				precision = precision * 10 + ch - '0';
+  800912:	eb d1                	jmp    8008e5 <vprintfmt+0xd6>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800914:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800917:	83 f8 2f             	cmp    $0x2f,%eax
+  80091a:	77 17                	ja     800933 <vprintfmt+0x124>
+  80091c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800920:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800923:	89 d2                	mov    %edx,%edx
+  800925:	48 01 d0             	add    %rdx,%rax
+  800928:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80092b:	83 c2 08             	add    $0x8,%edx
+  80092e:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800931:	eb 0c                	jmp    80093f <vprintfmt+0x130>
+  800933:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800937:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80093b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80093f:	8b 00                	mov    (%rax),%eax
+  800941:	89 45 d8             	mov    %eax,-0x28(%rbp)
+			goto process_precision;
+  800944:	eb 23                	jmp    800969 <vprintfmt+0x15a>
+
+		case '.':
+			if (width < 0)
+  800946:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80094a:	0f 89 48 ff ff ff    	jns    800898 <vprintfmt+0x89>
+				width = 0;
+  800950:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+			goto reswitch;
+  800957:	e9 3c ff ff ff       	jmp    800898 <vprintfmt+0x89>
+
+		case '#':
+			altflag = 1;
+  80095c:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+			goto reswitch;
+  800963:	e9 30 ff ff ff       	jmp    800898 <vprintfmt+0x89>
+			goto process_precision;
+  800968:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800969:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80096d:	0f 89 25 ff ff ff    	jns    800898 <vprintfmt+0x89>
+				width = precision, precision = -1;
+  800973:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800976:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800979:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+			goto reswitch;
+  800980:	e9 13 ff ff ff       	jmp    800898 <vprintfmt+0x89>
+
+		// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800985:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+			goto reswitch;
+  800989:	e9 0a ff ff ff       	jmp    800898 <vprintfmt+0x89>
+
+		// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  80098e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800991:	83 f8 2f             	cmp    $0x2f,%eax
+  800994:	77 17                	ja     8009ad <vprintfmt+0x19e>
+  800996:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80099a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80099d:	89 d2                	mov    %edx,%edx
+  80099f:	48 01 d0             	add    %rdx,%rax
+  8009a2:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009a5:	83 c2 08             	add    $0x8,%edx
+  8009a8:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8009ab:	eb 0c                	jmp    8009b9 <vprintfmt+0x1aa>
+  8009ad:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8009b1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8009b5:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8009b9:	8b 00                	mov    (%rax),%eax
+  8009bb:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8009bf:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8009c3:	48 89 d6             	mov    %rdx,%rsi
+  8009c6:	89 c7                	mov    %eax,%edi
+  8009c8:	ff d1                	call   *%rcx
+			break;
+  8009ca:	e9 37 03 00 00       	jmp    800d06 <vprintfmt+0x4f7>
+
+		// error message
+		case 'e':
+			err = va_arg(aq, int);
+  8009cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d5:	77 17                	ja     8009ee <vprintfmt+0x1df>
+  8009d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009db:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009de:	89 d2                	mov    %edx,%edx
+  8009e0:	48 01 d0             	add    %rdx,%rax
+  8009e3:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009e6:	83 c2 08             	add    $0x8,%edx
+  8009e9:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8009ec:	eb 0c                	jmp    8009fa <vprintfmt+0x1eb>
+  8009ee:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8009f2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8009f6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8009fa:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  8009fc:	85 db                	test   %ebx,%ebx
+  8009fe:	79 02                	jns    800a02 <vprintfmt+0x1f3>
+				err = -err;
+  800a00:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a02:	83 fb 11             	cmp    $0x11,%ebx
+  800a05:	7f 16                	jg     800a1d <vprintfmt+0x20e>
+  800a07:	48 ba a0 30 80 00 00 	movabs $0x8030a0,%rdx
+  800a0e:	00 00 00 
+  800a11:	48 63 c3             	movslq %ebx,%rax
+  800a14:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800a18:	4d 85 e4             	test   %r12,%r12
+  800a1b:	75 2e                	jne    800a4b <vprintfmt+0x23c>
+				printfmt(putch, putdat, "error %d", err);
+  800a1d:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800a21:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a25:	89 d9                	mov    %ebx,%ecx
+  800a27:	48 ba 41 31 80 00 00 	movabs $0x803141,%rdx
+  800a2e:	00 00 00 
+  800a31:	48 89 c7             	mov    %rax,%rdi
+  800a34:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a39:	49 b8 15 0d 80 00 00 	movabs $0x800d15,%r8
+  800a40:	00 00 00 
+  800a43:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800a46:	e9 bb 02 00 00       	jmp    800d06 <vprintfmt+0x4f7>
+				printfmt(putch, putdat, "%s", p);
+  800a4b:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800a4f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a53:	4c 89 e1             	mov    %r12,%rcx
+  800a56:	48 ba 4a 31 80 00 00 	movabs $0x80314a,%rdx
+  800a5d:	00 00 00 
+  800a60:	48 89 c7             	mov    %rax,%rdi
+  800a63:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a68:	49 b8 15 0d 80 00 00 	movabs $0x800d15,%r8
+  800a6f:	00 00 00 
+  800a72:	41 ff d0             	call   *%r8
+			break;
+  800a75:	e9 8c 02 00 00       	jmp    800d06 <vprintfmt+0x4f7>
+
+		// string
+		case 's':
+			// 从可变参数中读入字符串指针
+			if ((p = va_arg(aq, char *)) == NULL)
+  800a7a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a7d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a80:	77 17                	ja     800a99 <vprintfmt+0x28a>
+  800a82:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a86:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a89:	89 d2                	mov    %edx,%edx
+  800a8b:	48 01 d0             	add    %rdx,%rax
+  800a8e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a91:	83 c2 08             	add    $0x8,%edx
+  800a94:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a97:	eb 0c                	jmp    800aa5 <vprintfmt+0x296>
+  800a99:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a9d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800aa1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800aa5:	4c 8b 20             	mov    (%rax),%r12
+  800aa8:	4d 85 e4             	test   %r12,%r12
+  800aab:	75 0a                	jne    800ab7 <vprintfmt+0x2a8>
+				p = "(null)"; // 当字符串为空时，将它指向"(null)"字符串
+  800aad:	49 bc 4d 31 80 00 00 	movabs $0x80314d,%r12
+  800ab4:	00 00 00 
+			// 判断左对齐还是右对齐，pad='-'左对齐，否则右对齐
+			if (width > 0 && padc != '-')
+  800ab7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800abb:	7e 78                	jle    800b35 <vprintfmt+0x326>
+  800abd:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800ac1:	74 72                	je     800b35 <vprintfmt+0x326>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ac3:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800ac6:	48 98                	cltq
+  800ac8:	48 89 c6             	mov    %rax,%rsi
+  800acb:	4c 89 e7             	mov    %r12,%rdi
+  800ace:	48 b8 ba 10 80 00 00 	movabs $0x8010ba,%rax
+  800ad5:	00 00 00 
+  800ad8:	ff d0                	call   *%rax
+  800ada:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800add:	eb 17                	jmp    800af6 <vprintfmt+0x2e7>
+					putch(padc, putdat); // 字符串右对齐，左边补相应数量(width-实际长度)的空格或者 0
+  800adf:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800ae3:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800ae7:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800aeb:	48 89 d6             	mov    %rdx,%rsi
+  800aee:	89 c7                	mov    %eax,%edi
+  800af0:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800af2:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800af6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800afa:	7f e3                	jg     800adf <vprintfmt+0x2d0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800afc:	eb 37                	jmp    800b35 <vprintfmt+0x326>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800afe:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800b02:	74 1e                	je     800b22 <vprintfmt+0x313>
+  800b04:	83 fb 1f             	cmp    $0x1f,%ebx
+  800b07:	7e 05                	jle    800b0e <vprintfmt+0x2ff>
+  800b09:	83 fb 7e             	cmp    $0x7e,%ebx
+  800b0c:	7e 14                	jle    800b22 <vprintfmt+0x313>
+					putch('?', putdat);
+  800b0e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b12:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b16:	48 89 c6             	mov    %rax,%rsi
+  800b19:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800b1e:	ff d2                	call   *%rdx
+  800b20:	eb 0f                	jmp    800b31 <vprintfmt+0x322>
+				else
+					putch(ch, putdat); // 打印相应长度的字符串
+  800b22:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b26:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b2a:	48 89 c6             	mov    %rax,%rsi
+  800b2d:	89 df                	mov    %ebx,%edi
+  800b2f:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b31:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800b35:	4c 89 e0             	mov    %r12,%rax
+  800b38:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800b3c:	0f b6 00             	movzbl (%rax),%eax
+  800b3f:	0f be d8             	movsbl %al,%ebx
+  800b42:	85 db                	test   %ebx,%ebx
+  800b44:	74 28                	je     800b6e <vprintfmt+0x35f>
+  800b46:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800b4a:	78 b2                	js     800afe <vprintfmt+0x2ef>
+  800b4c:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800b50:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800b54:	79 a8                	jns    800afe <vprintfmt+0x2ef>
+			for (; width > 0; width--)
+  800b56:	eb 16                	jmp    800b6e <vprintfmt+0x35f>
+				putch(' ', putdat); // 当字符串是左对齐的时候打印相应数量的空格
+  800b58:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b5c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b60:	48 89 c6             	mov    %rax,%rsi
+  800b63:	bf 20 00 00 00       	mov    $0x20,%edi
+  800b68:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800b6a:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800b6e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b72:	7f e4                	jg     800b58 <vprintfmt+0x349>
+			break;
+  800b74:	e9 8d 01 00 00       	jmp    800d06 <vprintfmt+0x4f7>
+
+		// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800b79:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b7d:	be 03 00 00 00       	mov    $0x3,%esi
+  800b82:	48 89 c7             	mov    %rax,%rdi
+  800b85:	48 b8 08 07 80 00 00 	movabs $0x800708,%rax
+  800b8c:	00 00 00 
+  800b8f:	ff d0                	call   *%rax
+  800b91:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((long long)num < 0)
+  800b95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b99:	48 85 c0             	test   %rax,%rax
+  800b9c:	79 1d                	jns    800bbb <vprintfmt+0x3ac>
+			{
+				putch('-', putdat);
+  800b9e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ba2:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ba6:	48 89 c6             	mov    %rax,%rsi
+  800ba9:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800bae:	ff d2                	call   *%rdx
+				num = -(long long)num;
+  800bb0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bb4:	48 f7 d8             	neg    %rax
+  800bb7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			}
+			base = 10;
+  800bbb:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800bc2:	e9 d2 00 00 00       	jmp    800c99 <vprintfmt+0x48a>
+
+		// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800bc7:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800bcb:	be 03 00 00 00       	mov    $0x3,%esi
+  800bd0:	48 89 c7             	mov    %rax,%rdi
+  800bd3:	48 b8 01 06 80 00 00 	movabs $0x800601,%rax
+  800bda:	00 00 00 
+  800bdd:	ff d0                	call   *%rax
+  800bdf:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 10;
+  800be3:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800bea:	e9 aa 00 00 00       	jmp    800c99 <vprintfmt+0x48a>
+		// (unsigned) octal
+		case 'o':
+			// Gets the variable argument with type integer from the point which was processed last by va_arg
+			// calls getuint which returns a long long value, which then calls printnum which prints based on
+			// base value.
+			num = getuint(&aq, 3);
+  800bef:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800bf3:	be 03 00 00 00       	mov    $0x3,%esi
+  800bf8:	48 89 c7             	mov    %rax,%rdi
+  800bfb:	48 b8 01 06 80 00 00 	movabs $0x800601,%rax
+  800c02:	00 00 00 
+  800c05:	ff d0                	call   *%rax
+  800c07:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 8;
+  800c0b:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+			goto number;
+  800c12:	e9 82 00 00 00       	jmp    800c99 <vprintfmt+0x48a>
+
+		// pointer
+		case 'p':
+			putch('0', putdat);
+  800c17:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c1b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c1f:	48 89 c6             	mov    %rax,%rsi
+  800c22:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c27:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800c29:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c2d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c31:	48 89 c6             	mov    %rax,%rsi
+  800c34:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c39:	ff d2                	call   *%rdx
+			num = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800c3b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c3e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c41:	77 17                	ja     800c5a <vprintfmt+0x44b>
+  800c43:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c47:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c4a:	89 d2                	mov    %edx,%edx
+  800c4c:	48 01 d0             	add    %rdx,%rax
+  800c4f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c52:	83 c2 08             	add    $0x8,%edx
+  800c55:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800c58:	eb 0c                	jmp    800c66 <vprintfmt+0x457>
+  800c5a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800c5e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c62:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800c66:	48 8b 00             	mov    (%rax),%rax
+  800c69:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800c6d:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+			goto number;
+  800c74:	eb 23                	jmp    800c99 <vprintfmt+0x48a>
+
+		// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800c76:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800c7a:	be 03 00 00 00       	mov    $0x3,%esi
+  800c7f:	48 89 c7             	mov    %rax,%rdi
+  800c82:	48 b8 01 06 80 00 00 	movabs $0x800601,%rax
+  800c89:	00 00 00 
+  800c8c:	ff d0                	call   *%rax
+  800c8e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800c92:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800c99:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800c9e:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800ca1:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800ca4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ca8:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800cac:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800cb0:	45 89 c1             	mov    %r8d,%r9d
+  800cb3:	41 89 f8             	mov    %edi,%r8d
+  800cb6:	48 89 c7             	mov    %rax,%rdi
+  800cb9:	48 b8 49 05 80 00 00 	movabs $0x800549,%rax
+  800cc0:	00 00 00 
+  800cc3:	ff d0                	call   *%rax
+			break;
+  800cc5:	eb 3f                	jmp    800d06 <vprintfmt+0x4f7>
+
+		// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800cc7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ccb:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ccf:	48 89 c6             	mov    %rax,%rsi
+  800cd2:	89 df                	mov    %ebx,%edi
+  800cd4:	ff d2                	call   *%rdx
+			break;
+  800cd6:	eb 2e                	jmp    800d06 <vprintfmt+0x4f7>
+
+		// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800cd8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800cdc:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ce0:	48 89 c6             	mov    %rax,%rsi
+  800ce3:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ce8:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800cea:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800cef:	eb 05                	jmp    800cf6 <vprintfmt+0x4e7>
+  800cf1:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800cf6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800cfa:	48 83 e8 01          	sub    $0x1,%rax
+  800cfe:	0f b6 00             	movzbl (%rax),%eax
+  800d01:	3c 25                	cmp    $0x25,%al
+  800d03:	75 ec                	jne    800cf1 <vprintfmt+0x4e2>
+				/* do nothing */;
+			break;
+  800d05:	90                   	nop
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800d06:	e9 56 fb ff ff       	jmp    800861 <vprintfmt+0x52>
+				return;
+  800d0b:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800d0c:	48 83 c4 60          	add    $0x60,%rsp
+  800d10:	5b                   	pop    %rbx
+  800d11:	41 5c                	pop    %r12
+  800d13:	5d                   	pop    %rbp
+  800d14:	c3                   	ret
+
+0000000000800d15 <printfmt>:
+
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...)
+{
+  800d15:	55                   	push   %rbp
+  800d16:	48 89 e5             	mov    %rsp,%rbp
+  800d19:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800d20:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800d27:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800d2e:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800d35:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800d3c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800d43:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800d4a:	84 c0                	test   %al,%al
+  800d4c:	74 20                	je     800d6e <printfmt+0x59>
+  800d4e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800d52:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800d56:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800d5a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800d5e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800d62:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800d66:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800d6a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800d6e:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800d75:	00 00 00 
+  800d78:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800d7f:	00 00 00 
+  800d82:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d86:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800d8d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800d94:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800d9b:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800da2:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800da9:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800db0:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800db7:	48 89 c7             	mov    %rax,%rdi
+  800dba:	48 b8 0f 08 80 00 00 	movabs $0x80080f,%rax
+  800dc1:	00 00 00 
+  800dc4:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  800dc6:	90                   	nop
+  800dc7:	c9                   	leave
+  800dc8:	c3                   	ret
+
+0000000000800dc9 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800dc9:	55                   	push   %rbp
+  800dca:	48 89 e5             	mov    %rsp,%rbp
+  800dcd:	48 83 ec 10          	sub    $0x10,%rsp
+  800dd1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800dd4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  800dd8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ddc:	8b 40 10             	mov    0x10(%rax),%eax
+  800ddf:	8d 50 01             	lea    0x1(%rax),%edx
+  800de2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800de6:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  800de9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ded:	48 8b 10             	mov    (%rax),%rdx
+  800df0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800df4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800df8:	48 39 c2             	cmp    %rax,%rdx
+  800dfb:	73 17                	jae    800e14 <sprintputch+0x4b>
+		*b->buf++ = ch;
+  800dfd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e01:	48 8b 00             	mov    (%rax),%rax
+  800e04:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800e08:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800e0c:	48 89 0a             	mov    %rcx,(%rdx)
+  800e0f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800e12:	88 10                	mov    %dl,(%rax)
+}
+  800e14:	90                   	nop
+  800e15:	c9                   	leave
+  800e16:	c3                   	ret
+
+0000000000800e17 <vsnprintf>:
+
+int vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800e17:	55                   	push   %rbp
+  800e18:	48 89 e5             	mov    %rsp,%rbp
+  800e1b:	48 83 ec 50          	sub    $0x50,%rsp
+  800e1f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  800e23:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  800e26:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  800e2a:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+	va_list aq;
+	va_copy(aq, ap);
+  800e2e:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800e32:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800e36:	48 8b 06             	mov    (%rsi),%rax
+  800e39:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800e3d:	48 89 01             	mov    %rax,(%rcx)
+  800e40:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800e44:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800e48:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	struct sprintbuf b = {buf, buf + n - 1, 0};
+  800e4c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e50:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800e54:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  800e57:	48 98                	cltq
+  800e59:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800e5d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e61:	48 01 d0             	add    %rdx,%rax
+  800e64:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  800e68:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+
+	if (buf == NULL || n < 1)
+  800e6f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800e74:	74 06                	je     800e7c <vsnprintf+0x65>
+  800e76:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800e7a:	7f 07                	jg     800e83 <vsnprintf+0x6c>
+		return -E_INVAL;
+  800e7c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e81:	eb 32                	jmp    800eb5 <vsnprintf+0x9e>
+
+	// print the string to the buffer
+	vprintfmt((void *)sprintputch, &b, fmt, aq);
+  800e83:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800e87:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  800e8b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e8f:	48 89 c6             	mov    %rax,%rsi
+  800e92:	48 b8 c9 0d 80 00 00 	movabs $0x800dc9,%rax
+  800e99:	00 00 00 
+  800e9c:	48 89 c7             	mov    %rax,%rdi
+  800e9f:	48 b8 0f 08 80 00 00 	movabs $0x80080f,%rax
+  800ea6:	00 00 00 
+  800ea9:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  800eab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800eaf:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800eb2:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  800eb5:	c9                   	leave
+  800eb6:	c3                   	ret
+
+0000000000800eb7 <snprintf>:
+
+int snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800eb7:	55                   	push   %rbp
+  800eb8:	48 89 e5             	mov    %rsp,%rbp
+  800ebb:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800ec2:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800ec9:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800ecf:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800ed6:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800edd:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800ee4:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800eeb:	84 c0                	test   %al,%al
+  800eed:	74 20                	je     800f0f <snprintf+0x58>
+  800eef:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800ef3:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800ef7:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800efb:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800eff:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f03:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f07:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f0b:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  800f0f:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800f16:	00 00 00 
+  800f19:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800f20:	00 00 00 
+  800f23:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f27:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800f2e:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f35:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq, ap);
+  800f3c:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800f43:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800f4a:	48 8b 06             	mov    (%rsi),%rax
+  800f4d:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800f51:	48 89 01             	mov    %rax,(%rcx)
+  800f54:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800f58:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800f5c:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  800f60:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800f67:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  800f6e:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  800f74:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800f7b:	48 89 c7             	mov    %rax,%rdi
+  800f7e:	48 b8 17 0e 80 00 00 	movabs $0x800e17,%rax
+  800f85:	00 00 00 
+  800f88:	ff d0                	call   *%rax
+  800f8a:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  800f90:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800f96:	c9                   	leave
+  800f97:	c3                   	ret
+
+0000000000800f98 <cpuid>:
+#define read_rip(var) __asm __volatile("leaq (%%rip), %0" : "=r" (var)::"cc","memory")
+
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800f98:	55                   	push   %rbp
+  800f99:	48 89 e5             	mov    %rsp,%rbp
+  800f9c:	53                   	push   %rbx
+  800f9d:	48 83 ec 38          	sub    $0x38,%rsp
+  800fa1:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800fa4:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800fa8:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800fac:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800fb0:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid" 
+  800fb4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800fb7:	0f a2                	cpuid
+  800fb9:	89 de                	mov    %ebx,%esi
+  800fbb:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800fbe:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800fc1:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800fc4:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info));
+	if (eaxp)
+  800fc7:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800fcc:	74 09                	je     800fd7 <cpuid+0x3f>
+		*eaxp = eax;
+  800fce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fd2:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800fd5:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  800fd7:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800fdc:	74 09                	je     800fe7 <cpuid+0x4f>
+		*ebxp = ebx;
+  800fde:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800fe2:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800fe5:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  800fe7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800fec:	74 09                	je     800ff7 <cpuid+0x5f>
+		*ecxp = ecx;
+  800fee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ff2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800ff5:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  800ff7:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800ffc:	74 09                	je     801007 <cpuid+0x6f>
+		*edxp = edx;
+  800ffe:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801002:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801005:	89 10                	mov    %edx,(%rax)
+}
+  801007:	90                   	nop
+  801008:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80100c:	c9                   	leave
+  80100d:	c3                   	ret
+
+000000000080100e <cpuid_count>:
+
+// 带子功能号(%ecx = count)的 cpuid，用于 leaf 4/7/0xB/0xD 等
+static __inline void
+cpuid_count(uint32_t info, uint32_t count, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  80100e:	55                   	push   %rbp
+  80100f:	48 89 e5             	mov    %rsp,%rbp
+  801012:	53                   	push   %rbx
+  801013:	48 83 ec 38          	sub    $0x38,%rsp
+  801017:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  80101a:	89 75 e0             	mov    %esi,-0x20(%rbp)
+  80101d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801021:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  801025:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+  801029:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  80102d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801030:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  801033:	89 d1                	mov    %edx,%ecx
+  801035:	0f a2                	cpuid
+  801037:	89 de                	mov    %ebx,%esi
+  801039:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  80103c:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  80103f:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  801042:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info), "c" (count));
+	if (eaxp)
+  801045:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80104a:	74 09                	je     801055 <cpuid_count+0x47>
+		*eaxp = eax;
+  80104c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801050:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  801053:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  801055:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80105a:	74 09                	je     801065 <cpuid_count+0x57>
+		*ebxp = ebx;
+  80105c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801060:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  801063:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  801065:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80106a:	74 09                	je     801075 <cpuid_count+0x67>
+		*ecxp = ecx;
+  80106c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801070:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801073:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  801075:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80107a:	74 09                	je     801085 <cpuid_count+0x77>
+		*edxp = edx;
+  80107c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801080:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801083:	89 10                	mov    %edx,(%rax)
+}
+  801085:	90                   	nop
+  801086:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80108a:	c9                   	leave
+  80108b:	c3                   	ret
+
+000000000080108c <strlen>:
+// 在真正的硬件上会有一定程度的优化, 但在 Bochs 上会有更大的优化效果
+// 用这种方法, Primespipe 的运行速度快了3倍
+#define ASM 1
+
+int strlen(const char *s)
+{
+  80108c:	55                   	push   %rbp
+  80108d:	48 89 e5             	mov    %rsp,%rbp
+  801090:	48 83 ec 18          	sub    $0x18,%rsp
+  801094:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801098:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80109f:	eb 09                	jmp    8010aa <strlen+0x1e>
+		n++;
+  8010a1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8010a5:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8010aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010ae:	0f b6 00             	movzbl (%rax),%eax
+  8010b1:	84 c0                	test   %al,%al
+  8010b3:	75 ec                	jne    8010a1 <strlen+0x15>
+	return n;
+  8010b5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8010b8:	c9                   	leave
+  8010b9:	c3                   	ret
+
+00000000008010ba <strnlen>:
+
+int strnlen(const char *s, size_t size)
+{
+  8010ba:	55                   	push   %rbp
+  8010bb:	48 89 e5             	mov    %rsp,%rbp
+  8010be:	48 83 ec 20          	sub    $0x20,%rsp
+  8010c2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8010c6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8010ca:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8010d1:	eb 0e                	jmp    8010e1 <strnlen+0x27>
+		n++;
+  8010d3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8010d7:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8010dc:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8010e1:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8010e6:	74 0b                	je     8010f3 <strnlen+0x39>
+  8010e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010ec:	0f b6 00             	movzbl (%rax),%eax
+  8010ef:	84 c0                	test   %al,%al
+  8010f1:	75 e0                	jne    8010d3 <strnlen+0x19>
+	return n;
+  8010f3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8010f6:	c9                   	leave
+  8010f7:	c3                   	ret
+
+00000000008010f8 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8010f8:	55                   	push   %rbp
+  8010f9:	48 89 e5             	mov    %rsp,%rbp
+  8010fc:	48 83 ec 20          	sub    $0x20,%rsp
+  801100:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801104:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801108:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80110c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  801110:	90                   	nop
+  801111:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801115:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801119:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80111d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801121:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801125:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801129:	0f b6 12             	movzbl (%rdx),%edx
+  80112c:	88 10                	mov    %dl,(%rax)
+  80112e:	0f b6 00             	movzbl (%rax),%eax
+  801131:	84 c0                	test   %al,%al
+  801133:	75 dc                	jne    801111 <strcpy+0x19>
+		/* do nothing */;
+	return ret;
+  801135:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801139:	c9                   	leave
+  80113a:	c3                   	ret
+
+000000000080113b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80113b:	55                   	push   %rbp
+  80113c:	48 89 e5             	mov    %rsp,%rbp
+  80113f:	48 83 ec 20          	sub    $0x20,%rsp
+  801143:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801147:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int len = strlen(dst);
+  80114b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80114f:	48 89 c7             	mov    %rax,%rdi
+  801152:	48 b8 8c 10 80 00 00 	movabs $0x80108c,%rax
+  801159:	00 00 00 
+  80115c:	ff d0                	call   *%rax
+  80115e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	strcpy(dst + len, src);
+  801161:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801164:	48 63 d0             	movslq %eax,%rdx
+  801167:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80116b:	48 01 c2             	add    %rax,%rdx
+  80116e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801172:	48 89 c6             	mov    %rax,%rsi
+  801175:	48 89 d7             	mov    %rdx,%rdi
+  801178:	48 b8 f8 10 80 00 00 	movabs $0x8010f8,%rax
+  80117f:	00 00 00 
+  801182:	ff d0                	call   *%rax
+	return dst;
+  801184:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801188:	c9                   	leave
+  801189:	c3                   	ret
+
+000000000080118a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  80118a:	55                   	push   %rbp
+  80118b:	48 89 e5             	mov    %rsp,%rbp
+  80118e:	48 83 ec 28          	sub    $0x28,%rsp
+  801192:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801196:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80119a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  80119e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011a2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++)
+  8011a6:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8011ad:	00 
+  8011ae:	eb 2a                	jmp    8011da <strncpy+0x50>
+	{
+		*dst++ = *src;
+  8011b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011b4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8011b8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8011bc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8011c0:	0f b6 12             	movzbl (%rdx),%edx
+  8011c3:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  8011c5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8011c9:	0f b6 00             	movzbl (%rax),%eax
+  8011cc:	84 c0                	test   %al,%al
+  8011ce:	74 05                	je     8011d5 <strncpy+0x4b>
+			src++;
+  8011d0:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++)
+  8011d5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8011da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011de:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8011e2:	72 cc                	jb     8011b0 <strncpy+0x26>
+	}
+	return ret;
+  8011e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8011e8:	c9                   	leave
+  8011e9:	c3                   	ret
+
+00000000008011ea <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8011ea:	55                   	push   %rbp
+  8011eb:	48 89 e5             	mov    %rsp,%rbp
+  8011ee:	48 83 ec 28          	sub    $0x28,%rsp
+  8011f2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8011f6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8011fa:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  8011fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801202:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0)
+  801206:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80120b:	74 3d                	je     80124a <strlcpy+0x60>
+	{
+		while (--size > 0 && *src != '\0')
+  80120d:	eb 1d                	jmp    80122c <strlcpy+0x42>
+			*dst++ = *src++;
+  80120f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801213:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801217:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80121b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80121f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801223:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801227:	0f b6 12             	movzbl (%rdx),%edx
+  80122a:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  80122c:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801231:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801236:	74 0b                	je     801243 <strlcpy+0x59>
+  801238:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80123c:	0f b6 00             	movzbl (%rax),%eax
+  80123f:	84 c0                	test   %al,%al
+  801241:	75 cc                	jne    80120f <strlcpy+0x25>
+		*dst = '\0';
+  801243:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801247:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  80124a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80124e:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801252:	c9                   	leave
+  801253:	c3                   	ret
+
+0000000000801254 <strcmp>:
+
+int strcmp(const char *p, const char *q)
+{
+  801254:	55                   	push   %rbp
+  801255:	48 89 e5             	mov    %rsp,%rbp
+  801258:	48 83 ec 10          	sub    $0x10,%rsp
+  80125c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801260:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801264:	eb 0a                	jmp    801270 <strcmp+0x1c>
+		p++, q++;
+  801266:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80126b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801270:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801274:	0f b6 00             	movzbl (%rax),%eax
+  801277:	84 c0                	test   %al,%al
+  801279:	74 12                	je     80128d <strcmp+0x39>
+  80127b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80127f:	0f b6 10             	movzbl (%rax),%edx
+  801282:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801286:	0f b6 00             	movzbl (%rax),%eax
+  801289:	38 c2                	cmp    %al,%dl
+  80128b:	74 d9                	je     801266 <strcmp+0x12>
+	return (int)((unsigned char)*p - (unsigned char)*q);
+  80128d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801291:	0f b6 00             	movzbl (%rax),%eax
+  801294:	0f b6 d0             	movzbl %al,%edx
+  801297:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80129b:	0f b6 00             	movzbl (%rax),%eax
+  80129e:	0f b6 c0             	movzbl %al,%eax
+  8012a1:	29 c2                	sub    %eax,%edx
+  8012a3:	89 d0                	mov    %edx,%eax
+}
+  8012a5:	c9                   	leave
+  8012a6:	c3                   	ret
+
+00000000008012a7 <strncmp>:
+
+int strncmp(const char *p, const char *q, size_t n)
+{
+  8012a7:	55                   	push   %rbp
+  8012a8:	48 89 e5             	mov    %rsp,%rbp
+  8012ab:	48 83 ec 18          	sub    $0x18,%rsp
+  8012af:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8012b3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8012b7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8012bb:	eb 0f                	jmp    8012cc <strncmp+0x25>
+		n--, p++, q++;
+  8012bd:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8012c2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8012c7:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8012cc:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8012d1:	74 1d                	je     8012f0 <strncmp+0x49>
+  8012d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012d7:	0f b6 00             	movzbl (%rax),%eax
+  8012da:	84 c0                	test   %al,%al
+  8012dc:	74 12                	je     8012f0 <strncmp+0x49>
+  8012de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012e2:	0f b6 10             	movzbl (%rax),%edx
+  8012e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012e9:	0f b6 00             	movzbl (%rax),%eax
+  8012ec:	38 c2                	cmp    %al,%dl
+  8012ee:	74 cd                	je     8012bd <strncmp+0x16>
+	if (n == 0)
+  8012f0:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8012f5:	75 07                	jne    8012fe <strncmp+0x57>
+		return 0;
+  8012f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012fc:	eb 16                	jmp    801314 <strncmp+0x6d>
+	else
+		return (int)((unsigned char)*p - (unsigned char)*q);
+  8012fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801302:	0f b6 00             	movzbl (%rax),%eax
+  801305:	0f b6 d0             	movzbl %al,%edx
+  801308:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80130c:	0f b6 00             	movzbl (%rax),%eax
+  80130f:	0f b6 c0             	movzbl %al,%eax
+  801312:	29 c2                	sub    %eax,%edx
+}
+  801314:	89 d0                	mov    %edx,%eax
+  801316:	c9                   	leave
+  801317:	c3                   	ret
+
+0000000000801318 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801318:	55                   	push   %rbp
+  801319:	48 89 e5             	mov    %rsp,%rbp
+  80131c:	48 83 ec 10          	sub    $0x10,%rsp
+  801320:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801324:	89 f0                	mov    %esi,%eax
+  801326:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801329:	eb 17                	jmp    801342 <strchr+0x2a>
+		if (*s == c)
+  80132b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80132f:	0f b6 00             	movzbl (%rax),%eax
+  801332:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801335:	75 06                	jne    80133d <strchr+0x25>
+			return (char *)s;
+  801337:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80133b:	eb 15                	jmp    801352 <strchr+0x3a>
+	for (; *s; s++)
+  80133d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801342:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801346:	0f b6 00             	movzbl (%rax),%eax
+  801349:	84 c0                	test   %al,%al
+  80134b:	75 de                	jne    80132b <strchr+0x13>
+	return 0;
+  80134d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801352:	c9                   	leave
+  801353:	c3                   	ret
+
+0000000000801354 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801354:	55                   	push   %rbp
+  801355:	48 89 e5             	mov    %rsp,%rbp
+  801358:	48 83 ec 10          	sub    $0x10,%rsp
+  80135c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801360:	89 f0                	mov    %esi,%eax
+  801362:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801365:	eb 11                	jmp    801378 <strfind+0x24>
+		if (*s == c)
+  801367:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80136b:	0f b6 00             	movzbl (%rax),%eax
+  80136e:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801371:	74 12                	je     801385 <strfind+0x31>
+	for (; *s; s++)
+  801373:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801378:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80137c:	0f b6 00             	movzbl (%rax),%eax
+  80137f:	84 c0                	test   %al,%al
+  801381:	75 e4                	jne    801367 <strfind+0x13>
+  801383:	eb 01                	jmp    801386 <strfind+0x32>
+			break;
+  801385:	90                   	nop
+	return (char *)s;
+  801386:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80138a:	c9                   	leave
+  80138b:	c3                   	ret
+
+000000000080138c <mem_init>:
+};
+
+static int mem_features;
+
+void mem_init(void)
+{
+  80138c:	55                   	push   %rbp
+  80138d:	48 89 e5             	mov    %rsp,%rbp
+  801390:	48 83 ec 10          	sub    $0x10,%rsp
+	uint32_t max, ebx, edx;
+
+	mem_features = 0;
+  801394:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  80139b:	00 00 00 
+  80139e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	cpuid(0, &max, NULL, NULL, NULL);
+  8013a4:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+  8013a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013b8:	48 89 c6             	mov    %rax,%rsi
+  8013bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013c0:	48 b8 98 0f 80 00 00 	movabs $0x800f98,%rax
+  8013c7:	00 00 00 
+  8013ca:	ff d0                	call   *%rax
+	cpuid(1, NULL, NULL, NULL, &edx);
+  8013cc:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  8013d0:	49 89 c0             	mov    %rax,%r8
+  8013d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8013e7:	48 b8 98 0f 80 00 00 	movabs $0x800f98,%rax
+  8013ee:	00 00 00 
+  8013f1:	ff d0                	call   *%rax
+	if (edx & (1 << 26))
+  8013f3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8013f6:	25 00 00 00 04       	and    $0x4000000,%eax
+  8013fb:	85 c0                	test   %eax,%eax
+  8013fd:	74 1d                	je     80141c <mem_init+0x90>
+		mem_features |= MEM_F_NT;
+  8013ff:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  801406:	00 00 00 
+  801409:	8b 00                	mov    (%rax),%eax
+  80140b:	83 c8 02             	or     $0x2,%eax
+  80140e:	89 c2                	mov    %eax,%edx
+  801410:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  801417:	00 00 00 
+  80141a:	89 10                	mov    %edx,(%rax)
+	if (max >= 7)
+  80141c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80141f:	83 f8 06             	cmp    $0x6,%eax
+  801422:	76 57                	jbe    80147b <mem_init+0xef>
+	{
+		cpuid_count(7, 0, NULL, &ebx, NULL, NULL);
+  801424:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801428:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80142e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801434:	48 89 c1             	mov    %rax,%rcx
+  801437:	ba 00 00 00 00       	mov    $0x0,%edx
+  80143c:	be 00 00 00 00       	mov    $0x0,%esi
+  801441:	bf 07 00 00 00       	mov    $0x7,%edi
+  801446:	48 b8 0e 10 80 00 00 	movabs $0x80100e,%rax
+  80144d:	00 00 00 
+  801450:	ff d0                	call   *%rax
+		if (ebx & (1 << 9))
+  801452:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801455:	25 00 02 00 00       	and    $0x200,%eax
+  80145a:	85 c0                	test   %eax,%eax
+  80145c:	74 1d                	je     80147b <mem_init+0xef>
+			mem_features |= MEM_F_ERMS;
+  80145e:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  801465:	00 00 00 
+  801468:	8b 00                	mov    (%rax),%eax
+  80146a:	83 c8 01             	or     $0x1,%eax
+  80146d:	89 c2                	mov    %eax,%edx
+  80146f:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  801476:	00 00 00 
+  801479:	89 10                	mov    %edx,(%rax)
+	}
+}
+  80147b:	90                   	nop
+  80147c:	c9                   	leave
+  80147d:	c3                   	ret
+
+000000000080147e <memset_nt>:
+
+// 非临时存储填充 n 字节(v 8 字节对齐，n 为 32 的倍数)
+static void
+memset_nt(void *v, uint64_t pattern, size_t n)
+{
+  80147e:	55                   	push   %rbp
+  80147f:	48 89 e5             	mov    %rsp,%rbp
+  801482:	48 83 ec 28          	sub    $0x28,%rsp
+  801486:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80148a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80148e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t *p = (uint64_t *)v;
+  801492:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801496:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint64_t *end = p + n / 8;
+  80149a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80149e:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  8014a2:	48 89 c2             	mov    %rax,%rdx
+  8014a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014a9:	48 01 d0             	add    %rdx,%rax
+  8014ac:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	for (; p < end; p += 4)
+  8014b0:	eb 20                	jmp    8014d2 <memset_nt+0x54>
+		asm volatile("movnti %1, 0(%0)\n\t"
+  8014b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014b6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8014ba:	48 0f c3 10          	movnti %rdx,(%rax)
+  8014be:	48 0f c3 50 08       	movnti %rdx,0x8(%rax)
+  8014c3:	48 0f c3 50 10       	movnti %rdx,0x10(%rax)
+  8014c8:	48 0f c3 50 18       	movnti %rdx,0x18(%rax)
+	for (; p < end; p += 4)
+  8014cd:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  8014d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014d6:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8014da:	72 d6                	jb     8014b2 <memset_nt+0x34>
+					 "movnti %1, 16(%0)\n\t"
+					 "movnti %1, 24(%0)"
+					 :
+					 : "r"(p), "r"(pattern)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  8014dc:	0f ae f8             	sfence
+}
+  8014df:	90                   	nop
+  8014e0:	c9                   	leave
+  8014e1:	c3                   	ret
+
+00000000008014e2 <memcpy_nt>:
+
+// 非临时存储复制 n 字节(dst/src 8 字节对齐且不重叠，n 为 32 的倍数)
+static void
+memcpy_nt(void *dst, const void *src, size_t n)
+{
+  8014e2:	55                   	push   %rbp
+  8014e3:	48 89 e5             	mov    %rsp,%rbp
+  8014e6:	48 83 ec 58          	sub    $0x58,%rsp
+  8014ea:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8014ee:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8014f2:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	uint64_t *d = (uint64_t *)dst;
+  8014f6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8014fa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint64_t *s = (const uint64_t *)src;
+  8014fe:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801502:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	uint64_t *end = d + n / 8;
+  801506:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80150a:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  80150e:	48 89 c2             	mov    %rax,%rdx
+  801511:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801515:	48 01 d0             	add    %rdx,%rax
+  801518:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint64_t t0, t1, t2, t3;
+
+	for (; d < end; d += 4, s += 4)
+  80151c:	eb 44                	jmp    801562 <memcpy_nt+0x80>
+		asm volatile("movq 0(%4), %0\n\t"
+  80151e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801522:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801526:	4c 8b 00             	mov    (%rax),%r8
+  801529:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  80152d:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  801531:	48 8b 48 18          	mov    0x18(%rax),%rcx
+  801535:	4c 0f c3 02          	movnti %r8,(%rdx)
+  801539:	48 0f c3 7a 08       	movnti %rdi,0x8(%rdx)
+  80153e:	48 0f c3 72 10       	movnti %rsi,0x10(%rdx)
+  801543:	48 0f c3 4a 18       	movnti %rcx,0x18(%rdx)
+  801548:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80154c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801550:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801554:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+	for (; d < end; d += 4, s += 4)
+  801558:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  80155d:	48 83 45 f0 20       	addq   $0x20,-0x10(%rbp)
+  801562:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801566:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  80156a:	72 b2                	jb     80151e <memcpy_nt+0x3c>
+					 "movnti %2, 16(%5)\n\t"
+					 "movnti %3, 24(%5)"
+					 : "=&r"(t0), "=&r"(t1), "=&r"(t2), "=&r"(t3)
+					 : "r"(s), "r"(d)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  80156c:	0f ae f8             	sfence
+}
+  80156f:	90                   	nop
+  801570:	c9                   	leave
+  801571:	c3                   	ret
+
+0000000000801572 <memcpy_fwd>:
+
+// 正向复制(dst 在 src 之前或两者不重叠)
+static void
+memcpy_fwd(void *dst, const void *src, size_t n)
+{
+  801572:	55                   	push   %rbp
+  801573:	48 89 e5             	mov    %rsp,%rbp
+  801576:	48 83 ec 18          	sub    $0x18,%rsp
+  80157a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80157e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801582:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  801586:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  80158d:	00 00 00 
+  801590:	8b 00                	mov    (%rax),%eax
+  801592:	83 e0 02             	and    $0x2,%eax
+  801595:	85 c0                	test   %eax,%eax
+  801597:	74 66                	je     8015ff <memcpy_fwd+0x8d>
+  801599:	48 81 7d e8 ff 0f 00 	cmpq   $0xfff,-0x18(%rbp)
+  8015a0:	00 
+  8015a1:	76 5c                	jbe    8015ff <memcpy_fwd+0x8d>
+  8015a3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8015a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015ab:	48 09 d0             	or     %rdx,%rax
+  8015ae:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  8015b2:	83 e0 1f             	and    $0x1f,%eax
+  8015b5:	48 85 c0             	test   %rax,%rax
+  8015b8:	75 45                	jne    8015ff <memcpy_fwd+0x8d>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  8015ba:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8015be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015c2:	48 01 d0             	add    %rdx,%rax
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  8015c5:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8015c9:	73 11                	jae    8015dc <memcpy_fwd+0x6a>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  8015cb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8015cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015d3:	48 01 d0             	add    %rdx,%rax
+  8015d6:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8015da:	72 23                	jb     8015ff <memcpy_fwd+0x8d>
+		memcpy_nt(dst, src, n);
+  8015dc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8015e0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8015e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015e8:	48 89 ce             	mov    %rcx,%rsi
+  8015eb:	48 89 c7             	mov    %rax,%rdi
+  8015ee:	48 b8 e2 14 80 00 00 	movabs $0x8014e2,%rax
+  8015f5:	00 00 00 
+  8015f8:	ff d0                	call   *%rax
+  8015fa:	e9 81 00 00 00       	jmp    801680 <memcpy_fwd+0x10e>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  8015ff:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  801606:	00 00 00 
+  801609:	8b 00                	mov    (%rax),%eax
+  80160b:	83 e0 01             	and    $0x1,%eax
+  80160e:	85 c0                	test   %eax,%eax
+  801610:	74 21                	je     801633 <memcpy_fwd+0xc1>
+  801612:	48 81 7d e8 ff 00 00 	cmpq   $0xff,-0x18(%rbp)
+  801619:	00 
+  80161a:	76 17                	jbe    801633 <memcpy_fwd+0xc1>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  80161c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801620:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801624:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801628:	48 89 c7             	mov    %rax,%rdi
+  80162b:	48 89 d6             	mov    %rdx,%rsi
+  80162e:	fc                   	cld
+  80162f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801631:	eb 4d                	jmp    801680 <memcpy_fwd+0x10e>
+					 : "cc", "memory");
+	else if ((((uint64_t)dst | (uint64_t)src | n) & 7) == 0)
+  801633:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801637:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80163b:	48 09 d0             	or     %rdx,%rax
+  80163e:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  801642:	83 e0 07             	and    $0x7,%eax
+  801645:	48 85 c0             	test   %rax,%rax
+  801648:	75 1f                	jne    801669 <memcpy_fwd+0xf7>
+		asm volatile("cld; rep movsq\n" ::"D"(dst), "S"(src), "c"(n / 8)
+  80164a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80164e:	48 c1 e8 03          	shr    $0x3,%rax
+  801652:	48 89 c1             	mov    %rax,%rcx
+  801655:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801659:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80165d:	48 89 c7             	mov    %rax,%rdi
+  801660:	48 89 d6             	mov    %rdx,%rsi
+  801663:	fc                   	cld
+  801664:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+					 : "cc", "memory");
+}
+  801667:	eb 17                	jmp    801680 <memcpy_fwd+0x10e>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  801669:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80166d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801671:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801675:	48 89 c7             	mov    %rax,%rdi
+  801678:	48 89 d6             	mov    %rdx,%rsi
+  80167b:	fc                   	cld
+  80167c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+  80167e:	eb 00                	jmp    801680 <memcpy_fwd+0x10e>
+  801680:	90                   	nop
+  801681:	c9                   	leave
+  801682:	c3                   	ret
+
+0000000000801683 <memset>:
+
+void *
+memset(void *v, int c, size_t n)
+{
+  801683:	55                   	push   %rbp
+  801684:	48 89 e5             	mov    %rsp,%rbp
+  801687:	48 83 ec 28          	sub    $0x28,%rsp
+  80168b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80168f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801692:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t pattern;
+
+	if (n == 0)
+  801696:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80169b:	75 09                	jne    8016a6 <memset+0x23>
+		return v;
+  80169d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016a1:	e9 dc 00 00 00       	jmp    801782 <memset+0xff>
+	c &= 0xFF;
+  8016a6:	81 65 e4 ff 00 00 00 	andl   $0xff,-0x1c(%rbp)
+	pattern = (uint64_t)c * 0x0101010101010101UL;
+  8016ad:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8016b0:	48 98                	cltq
+  8016b2:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8016b9:	01 01 01 
+  8016bc:	48 0f af c2          	imul   %rdx,%rax
+  8016c0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)v | n) & 31) == 0)
+  8016c4:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  8016cb:	00 00 00 
+  8016ce:	8b 00                	mov    (%rax),%eax
+  8016d0:	83 e0 02             	and    $0x2,%eax
+  8016d3:	85 c0                	test   %eax,%eax
+  8016d5:	74 3a                	je     801711 <memset+0x8e>
+  8016d7:	48 81 7d d8 ff 0f 00 	cmpq   $0xfff,-0x28(%rbp)
+  8016de:	00 
+  8016df:	76 30                	jbe    801711 <memset+0x8e>
+  8016e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016e5:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  8016e9:	83 e0 1f             	and    $0x1f,%eax
+  8016ec:	48 85 c0             	test   %rax,%rax
+  8016ef:	75 20                	jne    801711 <memset+0x8e>
+		memset_nt(v, pattern, n);
+  8016f1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8016f5:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8016f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016fd:	48 89 ce             	mov    %rcx,%rsi
+  801700:	48 89 c7             	mov    %rax,%rdi
+  801703:	48 b8 7e 14 80 00 00 	movabs $0x80147e,%rax
+  80170a:	00 00 00 
+  80170d:	ff d0                	call   *%rax
+  80170f:	eb 6d                	jmp    80177e <memset+0xfb>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  801711:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  801718:	00 00 00 
+  80171b:	8b 00                	mov    (%rax),%eax
+  80171d:	83 e0 01             	and    $0x1,%eax
+  801720:	85 c0                	test   %eax,%eax
+  801722:	74 1d                	je     801741 <memset+0xbe>
+  801724:	48 81 7d d8 ff 00 00 	cmpq   $0xff,-0x28(%rbp)
+  80172b:	00 
+  80172c:	76 13                	jbe    801741 <memset+0xbe>
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  80172e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801732:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801735:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801739:	48 89 d7             	mov    %rdx,%rdi
+  80173c:	fc                   	cld
+  80173d:	f3 aa                	rep stos %al,%es:(%rdi)
+  80173f:	eb 3d                	jmp    80177e <memset+0xfb>
+					 : "cc", "memory");
+	else if ((((uint64_t)v | n) & 7) == 0)
+  801741:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801745:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  801749:	83 e0 07             	and    $0x7,%eax
+  80174c:	48 85 c0             	test   %rax,%rax
+  80174f:	75 1c                	jne    80176d <memset+0xea>
+		asm volatile("cld; rep stosq\n" ::"D"(v), "a"(pattern), "c"(n / 8)
+  801751:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801755:	48 c1 e8 03          	shr    $0x3,%rax
+  801759:	48 89 c1             	mov    %rax,%rcx
+  80175c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801760:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801764:	48 89 d7             	mov    %rdx,%rdi
+  801767:	fc                   	cld
+  801768:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  80176b:	eb 11                	jmp    80177e <memset+0xfb>
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  80176d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801771:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801774:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801778:	48 89 d7             	mov    %rdx,%rdi
+  80177b:	fc                   	cld
+  80177c:	f3 aa                	rep stos %al,%es:(%rdi)
+					 : "cc", "memory");
+	return v;
+  80177e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801782:	c9                   	leave
+  801783:	c3                   	ret
+
+0000000000801784 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801784:	55                   	push   %rbp
+  801785:	48 89 e5             	mov    %rsp,%rbp
+  801788:	48 83 ec 28          	sub    $0x28,%rsp
+  80178c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801790:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801794:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801798:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80179c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8017a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017a4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d)
+  8017a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017ac:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8017b0:	73 7c                	jae    80182e <memmove+0xaa>
+  8017b2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017ba:	48 01 d0             	add    %rdx,%rax
+  8017bd:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8017c1:	73 6b                	jae    80182e <memmove+0xaa>
+	{
+		// 重叠且 dst 在 src 之后，只能反向复制(ERMS 对反向 rep movsb 没有优化)
+		s += n;
+  8017c3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017c7:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  8017cb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017cf:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((((uint64_t)s | (uint64_t)d | n) & 7) == 0)
+  8017d3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017db:	48 09 d0             	or     %rdx,%rax
+  8017de:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  8017e2:	83 e0 07             	and    $0x7,%eax
+  8017e5:	48 85 c0             	test   %rax,%rax
+  8017e8:	75 24                	jne    80180e <memmove+0x8a>
+			asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8017ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017ee:	48 83 e8 08          	sub    $0x8,%rax
+  8017f2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017f6:	48 83 ea 08          	sub    $0x8,%rdx
+  8017fa:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8017fe:	48 c1 e9 03          	shr    $0x3,%rcx
+  801802:	48 89 c7             	mov    %rax,%rdi
+  801805:	48 89 d6             	mov    %rdx,%rsi
+  801808:	fd                   	std
+  801809:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80180c:	eb 1d                	jmp    80182b <memmove+0xa7>
+						 : "cc", "memory");
+		else
+			asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80180e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801812:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801816:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80181a:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+  80181e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801822:	48 89 d7             	mov    %rdx,%rdi
+  801825:	48 89 c1             	mov    %rax,%rcx
+  801828:	fd                   	std
+  801829:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+						 : "cc", "memory");
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::
+  80182b:	fc                   	cld
+  80182c:	eb 25                	jmp    801853 <memmove+0xcf>
+						 : "cc");
+	}
+	else if (n)
+  80182e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801833:	74 1e                	je     801853 <memmove+0xcf>
+		memcpy_fwd(d, s, n);
+  801835:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801839:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80183d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801841:	48 89 ce             	mov    %rcx,%rsi
+  801844:	48 89 c7             	mov    %rax,%rdi
+  801847:	48 b8 72 15 80 00 00 	movabs $0x801572,%rax
+  80184e:	00 00 00 
+  801851:	ff d0                	call   *%rax
+	return dst;
+  801853:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801857:	c9                   	leave
+  801858:	c3                   	ret
+
+0000000000801859 <memcpy>:
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801859:	55                   	push   %rbp
+  80185a:	48 89 e5             	mov    %rsp,%rbp
+  80185d:	48 83 ec 18          	sub    $0x18,%rsp
+  801861:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801865:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801869:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (n)
+  80186d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801872:	74 1e                	je     801892 <memcpy+0x39>
+		memcpy_fwd(dst, src, n);
+  801874:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801878:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80187c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801880:	48 89 ce             	mov    %rcx,%rsi
+  801883:	48 89 c7             	mov    %rax,%rdi
+  801886:	48 b8 72 15 80 00 00 	movabs $0x801572,%rax
+  80188d:	00 00 00 
+  801890:	ff d0                	call   *%rax
+	return dst;
+  801892:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801896:	c9                   	leave
+  801897:	c3                   	ret
+
+0000000000801898 <memcmp>:
+{
+}
+#endif
+
+int memcmp(const void *v1, const void *v2, size_t n)
+{
+  801898:	55                   	push   %rbp
+  801899:	48 89 e5             	mov    %rsp,%rbp
+  80189c:	48 83 ec 28          	sub    $0x28,%rsp
+  8018a0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8018a4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8018a8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *)v1;
+  8018ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018b0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *)v2;
+  8018b4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8018b8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0)
+  8018bc:	eb 34                	jmp    8018f2 <memcmp+0x5a>
+	{
+		if (*s1 != *s2)
+  8018be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018c2:	0f b6 10             	movzbl (%rax),%edx
+  8018c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018c9:	0f b6 00             	movzbl (%rax),%eax
+  8018cc:	38 c2                	cmp    %al,%dl
+  8018ce:	74 18                	je     8018e8 <memcmp+0x50>
+			return (int)*s1 - (int)*s2;
+  8018d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018d4:	0f b6 00             	movzbl (%rax),%eax
+  8018d7:	0f b6 d0             	movzbl %al,%edx
+  8018da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018de:	0f b6 00             	movzbl (%rax),%eax
+  8018e1:	0f b6 c0             	movzbl %al,%eax
+  8018e4:	29 c2                	sub    %eax,%edx
+  8018e6:	eb 20                	jmp    801908 <memcmp+0x70>
+		s1++, s2++;
+  8018e8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8018ed:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0)
+  8018f2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018f6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8018fa:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8018fe:	48 85 c0             	test   %rax,%rax
+  801901:	75 bb                	jne    8018be <memcmp+0x26>
+	}
+
+	return 0;
+  801903:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801908:	89 d0                	mov    %edx,%eax
+  80190a:	c9                   	leave
+  80190b:	c3                   	ret
+
+000000000080190c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80190c:	55                   	push   %rbp
+  80190d:	48 89 e5             	mov    %rsp,%rbp
+  801910:	48 83 ec 28          	sub    $0x28,%rsp
+  801914:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801918:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  80191b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *)s + n;
+  80191f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801923:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801927:	48 01 d0             	add    %rdx,%rax
+  80192a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  80192e:	eb 13                	jmp    801943 <memfind+0x37>
+		if (*(const unsigned char *)s == (unsigned char)c)
+  801930:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801934:	0f b6 00             	movzbl (%rax),%eax
+  801937:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80193a:	38 d0                	cmp    %dl,%al
+  80193c:	74 11                	je     80194f <memfind+0x43>
+	for (; s < ends; s++)
+  80193e:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801943:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801947:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80194b:	72 e3                	jb     801930 <memfind+0x24>
+  80194d:	eb 01                	jmp    801950 <memfind+0x44>
+			break;
+  80194f:	90                   	nop
+	return (void *)s;
+  801950:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801954:	c9                   	leave
+  801955:	c3                   	ret
+
+0000000000801956 <strtol>:
+
+long strtol(const char *s, char **endptr, int base)
+{
+  801956:	55                   	push   %rbp
+  801957:	48 89 e5             	mov    %rsp,%rbp
+  80195a:	48 83 ec 38          	sub    $0x38,%rsp
+  80195e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801962:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801966:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801969:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801970:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801977:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801978:	eb 05                	jmp    80197f <strtol+0x29>
+		s++;
+  80197a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  80197f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801983:	0f b6 00             	movzbl (%rax),%eax
+  801986:	3c 20                	cmp    $0x20,%al
+  801988:	74 f0                	je     80197a <strtol+0x24>
+  80198a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80198e:	0f b6 00             	movzbl (%rax),%eax
+  801991:	3c 09                	cmp    $0x9,%al
+  801993:	74 e5                	je     80197a <strtol+0x24>
+
+	// plus/minus sign
+	if (*s == '+')
+  801995:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801999:	0f b6 00             	movzbl (%rax),%eax
+  80199c:	3c 2b                	cmp    $0x2b,%al
+  80199e:	75 07                	jne    8019a7 <strtol+0x51>
+		s++;
+  8019a0:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8019a5:	eb 17                	jmp    8019be <strtol+0x68>
+	else if (*s == '-')
+  8019a7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019ab:	0f b6 00             	movzbl (%rax),%eax
+  8019ae:	3c 2d                	cmp    $0x2d,%al
+  8019b0:	75 0c                	jne    8019be <strtol+0x68>
+		s++, neg = 1;
+  8019b2:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8019b7:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8019be:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8019c2:	74 06                	je     8019ca <strtol+0x74>
+  8019c4:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  8019c8:	75 28                	jne    8019f2 <strtol+0x9c>
+  8019ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019ce:	0f b6 00             	movzbl (%rax),%eax
+  8019d1:	3c 30                	cmp    $0x30,%al
+  8019d3:	75 1d                	jne    8019f2 <strtol+0x9c>
+  8019d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019d9:	48 83 c0 01          	add    $0x1,%rax
+  8019dd:	0f b6 00             	movzbl (%rax),%eax
+  8019e0:	3c 78                	cmp    $0x78,%al
+  8019e2:	75 0e                	jne    8019f2 <strtol+0x9c>
+		s += 2, base = 16;
+  8019e4:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8019e9:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8019f0:	eb 2c                	jmp    801a1e <strtol+0xc8>
+	else if (base == 0 && s[0] == '0')
+  8019f2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8019f6:	75 19                	jne    801a11 <strtol+0xbb>
+  8019f8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019fc:	0f b6 00             	movzbl (%rax),%eax
+  8019ff:	3c 30                	cmp    $0x30,%al
+  801a01:	75 0e                	jne    801a11 <strtol+0xbb>
+		s++, base = 8;
+  801a03:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a08:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801a0f:	eb 0d                	jmp    801a1e <strtol+0xc8>
+	else if (base == 0)
+  801a11:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801a15:	75 07                	jne    801a1e <strtol+0xc8>
+		base = 10;
+  801a17:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+	// digits
+	while (1)
+	{
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801a1e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a22:	0f b6 00             	movzbl (%rax),%eax
+  801a25:	3c 2f                	cmp    $0x2f,%al
+  801a27:	7e 1d                	jle    801a46 <strtol+0xf0>
+  801a29:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a2d:	0f b6 00             	movzbl (%rax),%eax
+  801a30:	3c 39                	cmp    $0x39,%al
+  801a32:	7f 12                	jg     801a46 <strtol+0xf0>
+			dig = *s - '0';
+  801a34:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a38:	0f b6 00             	movzbl (%rax),%eax
+  801a3b:	0f be c0             	movsbl %al,%eax
+  801a3e:	83 e8 30             	sub    $0x30,%eax
+  801a41:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801a44:	eb 4e                	jmp    801a94 <strtol+0x13e>
+		else if (*s >= 'a' && *s <= 'z')
+  801a46:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a4a:	0f b6 00             	movzbl (%rax),%eax
+  801a4d:	3c 60                	cmp    $0x60,%al
+  801a4f:	7e 1d                	jle    801a6e <strtol+0x118>
+  801a51:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a55:	0f b6 00             	movzbl (%rax),%eax
+  801a58:	3c 7a                	cmp    $0x7a,%al
+  801a5a:	7f 12                	jg     801a6e <strtol+0x118>
+			dig = *s - 'a' + 10;
+  801a5c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a60:	0f b6 00             	movzbl (%rax),%eax
+  801a63:	0f be c0             	movsbl %al,%eax
+  801a66:	83 e8 57             	sub    $0x57,%eax
+  801a69:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801a6c:	eb 26                	jmp    801a94 <strtol+0x13e>
+		else if (*s >= 'A' && *s <= 'Z')
+  801a6e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a72:	0f b6 00             	movzbl (%rax),%eax
+  801a75:	3c 40                	cmp    $0x40,%al
+  801a77:	7e 47                	jle    801ac0 <strtol+0x16a>
+  801a79:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a7d:	0f b6 00             	movzbl (%rax),%eax
+  801a80:	3c 5a                	cmp    $0x5a,%al
+  801a82:	7f 3c                	jg     801ac0 <strtol+0x16a>
+			dig = *s - 'A' + 10;
+  801a84:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a88:	0f b6 00             	movzbl (%rax),%eax
+  801a8b:	0f be c0             	movsbl %al,%eax
+  801a8e:	83 e8 37             	sub    $0x37,%eax
+  801a91:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801a94:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801a97:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801a9a:	7d 23                	jge    801abf <strtol+0x169>
+			break;
+		s++, val = (val * base) + dig;
+  801a9c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801aa1:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801aa4:	48 98                	cltq
+  801aa6:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801aab:	48 89 c2             	mov    %rax,%rdx
+  801aae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ab1:	48 98                	cltq
+  801ab3:	48 01 d0             	add    %rdx,%rax
+  801ab6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+  801aba:	e9 5f ff ff ff       	jmp    801a1e <strtol+0xc8>
+			break;
+  801abf:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801ac0:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801ac5:	74 0b                	je     801ad2 <strtol+0x17c>
+		*endptr = (char *)s;
+  801ac7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801acb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801acf:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801ad2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ad6:	74 09                	je     801ae1 <strtol+0x18b>
+  801ad8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801adc:	48 f7 d8             	neg    %rax
+  801adf:	eb 04                	jmp    801ae5 <strtol+0x18f>
+  801ae1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801ae5:	c9                   	leave
+  801ae6:	c3                   	ret
+
+0000000000801ae7 <strstr>:
+
+char *strstr(const char *in, const char *str)
+{
+  801ae7:	55                   	push   %rbp
+  801ae8:	48 89 e5             	mov    %rsp,%rbp
+  801aeb:	48 83 ec 30          	sub    $0x30,%rsp
+  801aef:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801af3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801af7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801afb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801aff:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801b03:	0f b6 00             	movzbl (%rax),%eax
+  801b06:	88 45 ff             	mov    %al,-0x1(%rbp)
+	if (!c)
+  801b09:	80 7d ff 00          	cmpb   $0x0,-0x1(%rbp)
+  801b0d:	75 06                	jne    801b15 <strstr+0x2e>
+		return (char *)in; // Trivial empty string case
+  801b0f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b13:	eb 6b                	jmp    801b80 <strstr+0x99>
+
+	len = strlen(str);
+  801b15:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b19:	48 89 c7             	mov    %rax,%rdi
+  801b1c:	48 b8 8c 10 80 00 00 	movabs $0x80108c,%rax
+  801b23:	00 00 00 
+  801b26:	ff d0                	call   *%rax
+  801b28:	48 98                	cltq
+  801b2a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+		char sc;
+
+		do
+		{
+			sc = *in++;
+  801b2e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b32:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b36:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801b3a:	0f b6 00             	movzbl (%rax),%eax
+  801b3d:	88 45 ef             	mov    %al,-0x11(%rbp)
+			if (!sc)
+  801b40:	80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+  801b44:	75 07                	jne    801b4d <strstr+0x66>
+				return (char *)0;
+  801b46:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b4b:	eb 33                	jmp    801b80 <strstr+0x99>
+		} while (sc != c);
+  801b4d:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+  801b51:	3a 45 ff             	cmp    -0x1(%rbp),%al
+  801b54:	75 d8                	jne    801b2e <strstr+0x47>
+	} while (strncmp(in, str, len) != 0);
+  801b56:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801b5a:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801b5e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b62:	48 89 ce             	mov    %rcx,%rsi
+  801b65:	48 89 c7             	mov    %rax,%rdi
+  801b68:	48 b8 a7 12 80 00 00 	movabs $0x8012a7,%rax
+  801b6f:	00 00 00 
+  801b72:	ff d0                	call   *%rax
+  801b74:	85 c0                	test   %eax,%eax
+  801b76:	75 b6                	jne    801b2e <strstr+0x47>
+
+	return (char *)(in - 1);
+  801b78:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b7c:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801b80:	c9                   	leave
+  801b81:	c3                   	ret
+
+0000000000801b82 <syscall>:
+ * 用户的指令式系统调用，该函数将系统调用序号放入eax寄存器，五个参数依次放入edx, ecx, ebx, edi, esi，然后执行指令int 0x30，
+ * 发生中断后，去IDT中查找中断处理函数，最终会走到kern/trap.c的trap_dispatch()中
+ */
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801b82:	55                   	push   %rbp
+  801b83:	48 89 e5             	mov    %rsp,%rbp
+  801b86:	53                   	push   %rbx
+  801b87:	48 83 ec 48          	sub    $0x48,%rsp
+  801b8b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801b8e:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801b91:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801b95:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801b99:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801b9d:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	 * volatile 告诉汇编程序不要因为不使用返回值就优化该指令
+	 * 最后一个子句告诉汇编程序，指令可能会改变条件代码cx和任意内存memory位置
+	 * 由汇编编译器做好数据保存和恢复工作(栈)
+	 */
+
+	asm volatile("int %1\n"			// code: int T_SYSCALL
+  801ba1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801ba4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801ba8:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801bac:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801bb0:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801bb4:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801bb8:	4c 89 c3             	mov    %r8,%rbx
+  801bbb:	cd 30                	int    $0x30
+  801bbd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+				   "D"(a4),			// edi = a4
+				   "S"(a5)			// esi = a5
+				 : "cc", "memory"); // 指令可能会改变条件代码cx和任意内存memory位置
+									// 由汇编编译器做好数据保存和恢复工作(栈)
+
+	if (check && ret > 0)
+  801bc1:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801bc5:	74 44                	je     801c0b <syscall+0x89>
+  801bc7:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801bcc:	7e 3d                	jle    801c0b <syscall+0x89>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801bce:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801bd2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801bd5:	49 89 d0             	mov    %rdx,%r8
+  801bd8:	89 c1                	mov    %eax,%ecx
+  801bda:	48 b8 08 34 80 00 00 	movabs $0x803408,%rax
+  801be1:	00 00 00 
+  801be4:	48 89 c2             	mov    %rax,%rdx
+  801be7:	be 34 00 00 00       	mov    $0x34,%esi
+  801bec:	48 b8 25 34 80 00 00 	movabs $0x803425,%rax
+  801bf3:	00 00 00 
+  801bf6:	48 89 c7             	mov    %rax,%rdi
+  801bf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bfe:	49 b9 18 2c 80 00 00 	movabs $0x802c18,%r9
+  801c05:	00 00 00 
+  801c08:	41 ff d1             	call   *%r9
+
+	return ret;
+  801c0b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801c0f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c13:	c9                   	leave
+  801c14:	c3                   	ret
+
+0000000000801c15 <sys_cputs>:
+
+void sys_cputs(const char *s, size_t len)
+{
+  801c15:	55                   	push   %rbp
+  801c16:	48 89 e5             	mov    %rsp,%rbp
+  801c19:	48 83 ec 10          	sub    $0x10,%rsp
+  801c1d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801c21:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 调用lib/syscall.c中的syscall()
+	// SYS_cputs: 系统调用序号(eax)，s: 需要输出的字符数组，len: 数组长度
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801c25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c29:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c2d:	48 83 ec 08          	sub    $0x8,%rsp
+  801c31:	6a 00                	push   $0x0
+  801c33:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801c39:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c3f:	48 89 d1             	mov    %rdx,%rcx
+  801c42:	48 89 c2             	mov    %rax,%rdx
+  801c45:	be 00 00 00 00       	mov    $0x0,%esi
+  801c4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c4f:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  801c56:	00 00 00 
+  801c59:	ff d0                	call   *%rax
+  801c5b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c5f:	90                   	nop
+  801c60:	c9                   	leave
+  801c61:	c3                   	ret
+
+0000000000801c62 <sys_cgetc>:
+
+int sys_cgetc(void)
+{
+  801c62:	55                   	push   %rbp
+  801c63:	48 89 e5             	mov    %rsp,%rbp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801c66:	48 83 ec 08          	sub    $0x8,%rsp
+  801c6a:	6a 00                	push   $0x0
+  801c6c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801c72:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c78:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c82:	be 00 00 00 00       	mov    $0x0,%esi
+  801c87:	bf 01 00 00 00       	mov    $0x1,%edi
+  801c8c:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  801c93:	00 00 00 
+  801c96:	ff d0                	call   *%rax
+  801c98:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c9c:	c9                   	leave
+  801c9d:	c3                   	ret
+
+0000000000801c9e <sys_env_destroy>:
+
+int sys_env_destroy(envid_t envid)
+{
+  801c9e:	55                   	push   %rbp
+  801c9f:	48 89 e5             	mov    %rsp,%rbp
+  801ca2:	48 83 ec 10          	sub    $0x10,%rsp
+  801ca6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	// 销毁envid对应的环境
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801ca9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801cac:	48 98                	cltq
+  801cae:	48 83 ec 08          	sub    $0x8,%rsp
+  801cb2:	6a 00                	push   $0x0
+  801cb4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801cba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801cc0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cc5:	48 89 c2             	mov    %rax,%rdx
+  801cc8:	be 01 00 00 00       	mov    $0x1,%esi
+  801ccd:	bf 03 00 00 00       	mov    $0x3,%edi
+  801cd2:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  801cd9:	00 00 00 
+  801cdc:	ff d0                	call   *%rax
+  801cde:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ce2:	c9                   	leave
+  801ce3:	c3                   	ret
+
+0000000000801ce4 <sys_getprocid>:
+
+envid_t
+sys_getprocid(void)
+{
+  801ce4:	55                   	push   %rbp
+  801ce5:	48 89 e5             	mov    %rsp,%rbp
+	// 获取当前用户环境id
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801ce8:	48 83 ec 08          	sub    $0x8,%rsp
+  801cec:	6a 00                	push   $0x0
+  801cee:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801cf4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801cfa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d04:	be 00 00 00 00       	mov    $0x0,%esi
+  801d09:	bf 02 00 00 00       	mov    $0x2,%edi
+  801d0e:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  801d15:	00 00 00 
+  801d18:	ff d0                	call   *%rax
+  801d1a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d1e:	c9                   	leave
+  801d1f:	c3                   	ret
+
+0000000000801d20 <sys_yield>:
+
+void sys_yield(void)
+{
+  801d20:	55                   	push   %rbp
+  801d21:	48 89 e5             	mov    %rsp,%rbp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801d24:	48 83 ec 08          	sub    $0x8,%rsp
+  801d28:	6a 00                	push   $0x0
+  801d2a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d30:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d36:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d40:	be 00 00 00 00       	mov    $0x0,%esi
+  801d45:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801d4a:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  801d51:	00 00 00 
+  801d54:	ff d0                	call   *%rax
+  801d56:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d5a:	90                   	nop
+  801d5b:	c9                   	leave
+  801d5c:	c3                   	ret
+
+0000000000801d5d <sys_page_alloc>:
+
+int sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801d5d:	55                   	push   %rbp
+  801d5e:	48 89 e5             	mov    %rsp,%rbp
+  801d61:	48 83 ec 10          	sub    $0x10,%rsp
+  801d65:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801d68:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801d6c:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  801d6f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801d72:	48 63 c8             	movslq %eax,%rcx
+  801d75:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d79:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d7c:	48 98                	cltq
+  801d7e:	48 83 ec 08          	sub    $0x8,%rsp
+  801d82:	6a 00                	push   $0x0
+  801d84:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d8a:	49 89 c8             	mov    %rcx,%r8
+  801d8d:	48 89 d1             	mov    %rdx,%rcx
+  801d90:	48 89 c2             	mov    %rax,%rdx
+  801d93:	be 01 00 00 00       	mov    $0x1,%esi
+  801d98:	bf 04 00 00 00       	mov    $0x4,%edi
+  801d9d:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  801da4:	00 00 00 
+  801da7:	ff d0                	call   *%rax
+  801da9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801dad:	c9                   	leave
+  801dae:	c3                   	ret
+
+0000000000801daf <sys_page_map>:
+
+int sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801daf:	55                   	push   %rbp
+  801db0:	48 89 e5             	mov    %rsp,%rbp
+  801db3:	48 83 ec 20          	sub    $0x20,%rsp
+  801db7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801dba:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801dbe:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801dc1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801dc5:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  801dc9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801dcc:	48 63 c8             	movslq %eax,%rcx
+  801dcf:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  801dd3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801dd6:	48 63 f0             	movslq %eax,%rsi
+  801dd9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801ddd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801de0:	48 98                	cltq
+  801de2:	48 83 ec 08          	sub    $0x8,%rsp
+  801de6:	51                   	push   %rcx
+  801de7:	49 89 f9             	mov    %rdi,%r9
+  801dea:	49 89 f0             	mov    %rsi,%r8
+  801ded:	48 89 d1             	mov    %rdx,%rcx
+  801df0:	48 89 c2             	mov    %rax,%rdx
+  801df3:	be 01 00 00 00       	mov    $0x1,%esi
+  801df8:	bf 05 00 00 00       	mov    $0x5,%edi
+  801dfd:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  801e04:	00 00 00 
+  801e07:	ff d0                	call   *%rax
+  801e09:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e0d:	c9                   	leave
+  801e0e:	c3                   	ret
+
+0000000000801e0f <sys_page_unmap>:
+
+int sys_page_unmap(envid_t envid, void *va)
+{
+  801e0f:	55                   	push   %rbp
+  801e10:	48 89 e5             	mov    %rsp,%rbp
+  801e13:	48 83 ec 10          	sub    $0x10,%rsp
+  801e17:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e1a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  801e1e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e22:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e25:	48 98                	cltq
+  801e27:	48 83 ec 08          	sub    $0x8,%rsp
+  801e2b:	6a 00                	push   $0x0
+  801e2d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e33:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e39:	48 89 d1             	mov    %rdx,%rcx
+  801e3c:	48 89 c2             	mov    %rax,%rdx
+  801e3f:	be 01 00 00 00       	mov    $0x1,%esi
+  801e44:	bf 06 00 00 00       	mov    $0x6,%edi
+  801e49:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  801e50:	00 00 00 
+  801e53:	ff d0                	call   *%rax
+  801e55:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e59:	c9                   	leave
+  801e5a:	c3                   	ret
+
+0000000000801e5b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int sys_env_set_status(envid_t envid, int status)
+{
+  801e5b:	55                   	push   %rbp
+  801e5c:	48 89 e5             	mov    %rsp,%rbp
+  801e5f:	48 83 ec 10          	sub    $0x10,%rsp
+  801e63:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e66:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801e69:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801e6c:	48 63 d0             	movslq %eax,%rdx
+  801e6f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e72:	48 98                	cltq
+  801e74:	48 83 ec 08          	sub    $0x8,%rsp
+  801e78:	6a 00                	push   $0x0
+  801e7a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e80:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e86:	48 89 d1             	mov    %rdx,%rcx
+  801e89:	48 89 c2             	mov    %rax,%rdx
+  801e8c:	be 01 00 00 00       	mov    $0x1,%esi
+  801e91:	bf 08 00 00 00       	mov    $0x8,%edi
+  801e96:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  801e9d:	00 00 00 
+  801ea0:	ff d0                	call   *%rax
+  801ea2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ea6:	c9                   	leave
+  801ea7:	c3                   	ret
+
+0000000000801ea8 <sys_env_set_trapframe>:
+
+int sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801ea8:	55                   	push   %rbp
+  801ea9:	48 89 e5             	mov    %rsp,%rbp
+  801eac:	48 83 ec 10          	sub    $0x10,%rsp
+  801eb0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801eb3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  801eb7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801ebb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ebe:	48 98                	cltq
+  801ec0:	48 83 ec 08          	sub    $0x8,%rsp
+  801ec4:	6a 00                	push   $0x0
+  801ec6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ecc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ed2:	48 89 d1             	mov    %rdx,%rcx
+  801ed5:	48 89 c2             	mov    %rax,%rdx
+  801ed8:	be 01 00 00 00       	mov    $0x1,%esi
+  801edd:	bf 09 00 00 00       	mov    $0x9,%edi
+  801ee2:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  801ee9:	00 00 00 
+  801eec:	ff d0                	call   *%rax
+  801eee:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ef2:	c9                   	leave
+  801ef3:	c3                   	ret
+
+0000000000801ef4 <sys_env_set_pgfault_upcall>:
+
+int sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801ef4:	55                   	push   %rbp
+  801ef5:	48 89 e5             	mov    %rsp,%rbp
+  801ef8:	48 83 ec 10          	sub    $0x10,%rsp
+  801efc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801eff:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  801f03:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801f07:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f0a:	48 98                	cltq
+  801f0c:	48 83 ec 08          	sub    $0x8,%rsp
+  801f10:	6a 00                	push   $0x0
+  801f12:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f18:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f1e:	48 89 d1             	mov    %rdx,%rcx
+  801f21:	48 89 c2             	mov    %rax,%rdx
+  801f24:	be 01 00 00 00       	mov    $0x1,%esi
+  801f29:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801f2e:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  801f35:	00 00 00 
+  801f38:	ff d0                	call   *%rax
+  801f3a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f3e:	c9                   	leave
+  801f3f:	c3                   	ret
+
+0000000000801f40 <sys_ipc_try_send>:
+
+int sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  801f40:	55                   	push   %rbp
+  801f41:	48 89 e5             	mov    %rsp,%rbp
+  801f44:	48 83 ec 20          	sub    $0x20,%rsp
+  801f48:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f4b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f4f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801f53:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  801f56:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801f59:	48 63 f0             	movslq %eax,%rsi
+  801f5c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801f60:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f63:	48 98                	cltq
+  801f65:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801f69:	48 83 ec 08          	sub    $0x8,%rsp
+  801f6d:	6a 00                	push   $0x0
+  801f6f:	49 89 f1             	mov    %rsi,%r9
+  801f72:	49 89 c8             	mov    %rcx,%r8
+  801f75:	48 89 d1             	mov    %rdx,%rcx
+  801f78:	48 89 c2             	mov    %rax,%rdx
+  801f7b:	be 00 00 00 00       	mov    $0x0,%esi
+  801f80:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801f85:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  801f8c:	00 00 00 
+  801f8f:	ff d0                	call   *%rax
+  801f91:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f95:	c9                   	leave
+  801f96:	c3                   	ret
+
+0000000000801f97 <sys_ipc_recv>:
+
+int sys_ipc_recv(void *dstva)
+{
+  801f97:	55                   	push   %rbp
+  801f98:	48 89 e5             	mov    %rsp,%rbp
+  801f9b:	48 83 ec 10          	sub    $0x10,%rsp
+  801f9f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  801fa3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fa7:	48 83 ec 08          	sub    $0x8,%rsp
+  801fab:	6a 00                	push   $0x0
+  801fad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fb3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fb9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fbe:	48 89 c2             	mov    %rax,%rdx
+  801fc1:	be 01 00 00 00       	mov    $0x1,%esi
+  801fc6:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801fcb:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  801fd2:	00 00 00 
+  801fd5:	ff d0                	call   *%rax
+  801fd7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fdb:	c9                   	leave
+  801fdc:	c3                   	ret
+
+0000000000801fdd <sys_disk_io>:
+
+int sys_disk_io(int dev, uint64_t secno, void *va, size_t nsecs, int write)
+{
+  801fdd:	55                   	push   %rbp
+  801fde:	48 89 e5             	mov    %rsp,%rbp
+  801fe1:	48 83 ec 20          	sub    $0x20,%rsp
+  801fe5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801fe8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801fec:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801ff0:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  801ff4:	44 89 45 f8          	mov    %r8d,-0x8(%rbp)
+	return syscall(SYS_disk_io, 0, dev, secno, (uint64_t)va, nsecs, write);
+  801ff8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801ffb:	48 63 c8             	movslq %eax,%rcx
+  801ffe:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802002:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802005:	48 98                	cltq
+  802007:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80200b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80200f:	48 83 ec 08          	sub    $0x8,%rsp
+  802013:	51                   	push   %rcx
+  802014:	49 89 f9             	mov    %rdi,%r9
+  802017:	49 89 f0             	mov    %rsi,%r8
+  80201a:	48 89 d1             	mov    %rdx,%rcx
+  80201d:	48 89 c2             	mov    %rax,%rdx
+  802020:	be 00 00 00 00       	mov    $0x0,%esi
+  802025:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80202a:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  802031:	00 00 00 
+  802034:	ff d0                	call   *%rax
+  802036:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80203a:	c9                   	leave
+  80203b:	c3                   	ret
+
+000000000080203c <sys_vma_alloc>:
+
+int sys_vma_alloc(envid_t envid, void *va, size_t len, int perm)
+{
+  80203c:	55                   	push   %rbp
+  80203d:	48 89 e5             	mov    %rsp,%rbp
+  802040:	48 83 ec 20          	sub    $0x20,%rsp
+  802044:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802047:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80204b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80204f:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_vma_alloc, 1, envid, (uint64_t)va, len, perm, 0);
+  802052:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802055:	48 63 f0             	movslq %eax,%rsi
+  802058:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80205c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80205f:	48 98                	cltq
+  802061:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802065:	48 83 ec 08          	sub    $0x8,%rsp
+  802069:	6a 00                	push   $0x0
+  80206b:	49 89 f1             	mov    %rsi,%r9
+  80206e:	49 89 c8             	mov    %rcx,%r8
+  802071:	48 89 d1             	mov    %rdx,%rcx
+  802074:	48 89 c2             	mov    %rax,%rdx
+  802077:	be 01 00 00 00       	mov    $0x1,%esi
+  80207c:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802081:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  802088:	00 00 00 
+  80208b:	ff d0                	call   *%rax
+  80208d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802091:	c9                   	leave
+  802092:	c3                   	ret
+
+0000000000802093 <sys_vma_clear>:
+
+int sys_vma_clear(envid_t envid)
+{
+  802093:	55                   	push   %rbp
+  802094:	48 89 e5             	mov    %rsp,%rbp
+  802097:	48 83 ec 10          	sub    $0x10,%rsp
+  80209b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_vma_clear, 1, envid, 0, 0, 0, 0);
+  80209e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020a1:	48 98                	cltq
+  8020a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8020a7:	6a 00                	push   $0x0
+  8020a9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020ba:	48 89 c2             	mov    %rax,%rdx
+  8020bd:	be 01 00 00 00       	mov    $0x1,%esi
+  8020c2:	bf 10 00 00 00       	mov    $0x10,%edi
+  8020c7:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  8020ce:	00 00 00 
+  8020d1:	ff d0                	call   *%rax
+  8020d3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020d7:	c9                   	leave
+  8020d8:	c3                   	ret
+
+00000000008020d9 <sys_trace_ctl>:
+
+int sys_trace_ctl(int enable)
+{
+  8020d9:	55                   	push   %rbp
+  8020da:	48 89 e5             	mov    %rsp,%rbp
+  8020dd:	48 83 ec 10          	sub    $0x10,%rsp
+  8020e1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_trace_ctl, 0, enable, 0, 0, 0, 0);
+  8020e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020e7:	48 98                	cltq
+  8020e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8020ed:	6a 00                	push   $0x0
+  8020ef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802100:	48 89 c2             	mov    %rax,%rdx
+  802103:	be 00 00 00 00       	mov    $0x0,%esi
+  802108:	bf 11 00 00 00       	mov    $0x11,%edi
+  80210d:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  802114:	00 00 00 
+  802117:	ff d0                	call   *%rax
+  802119:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80211d:	c9                   	leave
+  80211e:	c3                   	ret
+
+000000000080211f <sys_trace_read>:
+
+int sys_trace_read(int cpu, uint64_t *seq, struct TraceEvent *buf, int n)
+{
+  80211f:	55                   	push   %rbp
+  802120:	48 89 e5             	mov    %rsp,%rbp
+  802123:	48 83 ec 20          	sub    $0x20,%rsp
+  802127:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80212a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80212e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802132:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_trace_read, 0, cpu, (uint64_t)seq, (uint64_t)buf, n, 0);
+  802135:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802138:	48 63 f0             	movslq %eax,%rsi
+  80213b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80213f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802143:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802146:	48 98                	cltq
+  802148:	48 83 ec 08          	sub    $0x8,%rsp
+  80214c:	6a 00                	push   $0x0
+  80214e:	49 89 f1             	mov    %rsi,%r9
+  802151:	49 89 c8             	mov    %rcx,%r8
+  802154:	48 89 d1             	mov    %rdx,%rcx
+  802157:	48 89 c2             	mov    %rax,%rdx
+  80215a:	be 00 00 00 00       	mov    $0x0,%esi
+  80215f:	bf 12 00 00 00       	mov    $0x12,%edi
+  802164:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  80216b:	00 00 00 
+  80216e:	ff d0                	call   *%rax
+  802170:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802174:	c9                   	leave
+  802175:	c3                   	ret
+
+0000000000802176 <sys_getrusage>:
+
+int sys_getrusage(envid_t envid, struct Rusage *ru)
+{
+  802176:	55                   	push   %rbp
+  802177:	48 89 e5             	mov    %rsp,%rbp
+  80217a:	48 83 ec 10          	sub    $0x10,%rsp
+  80217e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802181:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_getrusage, 0, envid, (uint64_t)ru, 0, 0, 0);
+  802185:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802189:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80218c:	48 98                	cltq
+  80218e:	48 83 ec 08          	sub    $0x8,%rsp
+  802192:	6a 00                	push   $0x0
+  802194:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80219a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021a0:	48 89 d1             	mov    %rdx,%rcx
+  8021a3:	48 89 c2             	mov    %rax,%rdx
+  8021a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ab:	bf 13 00 00 00       	mov    $0x13,%edi
+  8021b0:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  8021b7:	00 00 00 
+  8021ba:	ff d0                	call   *%rax
+  8021bc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021c0:	c9                   	leave
+  8021c1:	c3                   	ret
+
+00000000008021c2 <sys_pmu_config>:
+
+int sys_pmu_config(int idx, uint64_t event)
+{
+  8021c2:	55                   	push   %rbp
+  8021c3:	48 89 e5             	mov    %rsp,%rbp
+  8021c6:	48 83 ec 10          	sub    $0x10,%rsp
+  8021ca:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021cd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_pmu_config, 0, idx, event, 0, 0, 0);
+  8021d1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021d4:	48 98                	cltq
+  8021d6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021da:	48 83 ec 08          	sub    $0x8,%rsp
+  8021de:	6a 00                	push   $0x0
+  8021e0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021ec:	48 89 d1             	mov    %rdx,%rcx
+  8021ef:	48 89 c2             	mov    %rax,%rdx
+  8021f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8021f7:	bf 14 00 00 00       	mov    $0x14,%edi
+  8021fc:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  802203:	00 00 00 
+  802206:	ff d0                	call   *%rax
+  802208:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80220c:	c9                   	leave
+  80220d:	c3                   	ret
+
+000000000080220e <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  80220e:	55                   	push   %rbp
+  80220f:	48 89 e5             	mov    %rsp,%rbp
+  802212:	48 83 ec 10          	sub    $0x10,%rsp
+  802216:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+  802219:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80221c:	48 83 ec 08          	sub    $0x8,%rsp
+  802220:	6a 00                	push   $0x0
+  802222:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802228:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80222e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802233:	48 89 c2             	mov    %rax,%rdx
+  802236:	be 00 00 00 00       	mov    $0x0,%esi
+  80223b:	bf 15 00 00 00       	mov    $0x15,%edi
+  802240:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  802247:	00 00 00 
+  80224a:	ff d0                	call   *%rax
+  80224c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802250:	c9                   	leave
+  802251:	c3                   	ret
+
+0000000000802252 <sys_image_attach>:
+
+int sys_image_attach(envid_t envid, int dev, const uint64_t *secnos, size_t size)
+{
+  802252:	55                   	push   %rbp
+  802253:	48 89 e5             	mov    %rsp,%rbp
+  802256:	48 83 ec 20          	sub    $0x20,%rsp
+  80225a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80225d:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  802260:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  802264:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+	return syscall(SYS_image_attach, 1, envid, dev, (uint64_t)secnos, size, 0);
+  802268:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80226c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80226f:	48 63 d0             	movslq %eax,%rdx
+  802272:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802275:	48 98                	cltq
+  802277:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80227b:	48 83 ec 08          	sub    $0x8,%rsp
+  80227f:	6a 00                	push   $0x0
+  802281:	49 89 f1             	mov    %rsi,%r9
+  802284:	49 89 c8             	mov    %rcx,%r8
+  802287:	48 89 d1             	mov    %rdx,%rcx
+  80228a:	48 89 c2             	mov    %rax,%rdx
+  80228d:	be 01 00 00 00       	mov    $0x1,%esi
+  802292:	bf 16 00 00 00       	mov    $0x16,%edi
+  802297:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  80229e:	00 00 00 
+  8022a1:	ff d0                	call   *%rax
+  8022a3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022a7:	c9                   	leave
+  8022a8:	c3                   	ret
+
+00000000008022a9 <sys_vma_binary>:
+
+int sys_vma_binary(envid_t envid, const struct Proghdr *ph)
+{
+  8022a9:	55                   	push   %rbp
+  8022aa:	48 89 e5             	mov    %rsp,%rbp
+  8022ad:	48 83 ec 10          	sub    $0x10,%rsp
+  8022b1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022b4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_vma_binary, 1, envid, (uint64_t)ph, 0, 0, 0);
+  8022b8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8022bf:	48 98                	cltq
+  8022c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8022c5:	6a 00                	push   $0x0
+  8022c7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022d3:	48 89 d1             	mov    %rdx,%rcx
+  8022d6:	48 89 c2             	mov    %rax,%rdx
+  8022d9:	be 01 00 00 00       	mov    $0x1,%esi
+  8022de:	bf 17 00 00 00       	mov    $0x17,%edi
+  8022e3:	48 b8 82 1b 80 00 00 	movabs $0x801b82,%rax
+  8022ea:	00 00 00 
+  8022ed:	ff d0                	call   *%rax
+  8022ef:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022f3:	c9                   	leave
+  8022f4:	c3                   	ret
+
+00000000008022f5 <pgfault>:
+ * 自定义页错误处理函数.
+ * 当出现页错误，主要是对标志为可写的或者COW的物理页分配新页，复制旧页的数据到新页并映射到旧页的地址空间
+ */
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8022f5:	55                   	push   %rbp
+  8022f6:	48 89 e5             	mov    %rsp,%rbp
+  8022f9:	48 83 ec 40          	sub    $0x40,%rsp
+  8022fd:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	void *addr = (void *)utf->utf_fault_va;
+  802301:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802305:	48 8b 00             	mov    (%rax),%rax
+  802308:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint32_t err = utf->utf_err;
+  80230c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802310:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802314:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	int r;
+
+	// 检查出错的访问(1)写，(2)COW页.  若不是，调用panic().
+	// pte_t entry = uvpt[VPN(addr)];
+	// 分配一个新页，将其映射到临时位置(PFTEMP)，将旧页数据复制到新页，然后将新页移动到旧页的地址.
+	if ((err & FEC_WR) && (uvpt[VPN(addr)] & PTE_COW))
+  802317:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80231a:	83 e0 02             	and    $0x2,%eax
+  80231d:	85 c0                	test   %eax,%eax
+  80231f:	0f 84 61 01 00 00    	je     802486 <pgfault+0x191>
+  802325:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802329:	48 c1 e8 0c          	shr    $0xc,%rax
+  80232d:	48 89 c2             	mov    %rax,%rdx
+  802330:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802337:	01 00 00 
+  80233a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80233e:	25 00 08 00 00       	and    $0x800,%eax
+  802343:	48 85 c0             	test   %rax,%rax
+  802346:	0f 84 3a 01 00 00    	je     802486 <pgfault+0x191>
+	{
+		if (sys_page_alloc(0, (void *)PFTEMP, PTE_U | PTE_P | PTE_W) == 0)
+  80234c:	ba 07 00 00 00       	mov    $0x7,%edx
+  802351:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802356:	bf 00 00 00 00       	mov    $0x0,%edi
+  80235b:	48 b8 5d 1d 80 00 00 	movabs $0x801d5d,%rax
+  802362:	00 00 00 
+  802365:	ff d0                	call   *%rax
+  802367:	85 c0                	test   %eax,%eax
+  802369:	0f 85 e7 00 00 00    	jne    802456 <pgfault+0x161>
+		{
+			// 分配了新的物理页以后准备从原页面开始拷贝数据时，记得将地址和物理页大小对齐
+			void *pg_addr = ROUNDDOWN(addr, PGSIZE);
+  80236f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802373:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  802377:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80237b:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802381:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+			memmove(PFTEMP, pg_addr, PGSIZE);
+  802385:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802389:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80238e:	48 89 c6             	mov    %rax,%rsi
+  802391:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  802396:	48 b8 84 17 80 00 00 	movabs $0x801784,%rax
+  80239d:	00 00 00 
+  8023a0:	ff d0                	call   *%rax
+			r = sys_page_map(0, (void *)PFTEMP, 0, pg_addr, PTE_U | PTE_W | PTE_P);
+  8023a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8023a6:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  8023ac:	48 89 c1             	mov    %rax,%rcx
+  8023af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023b4:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8023b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023be:	48 b8 af 1d 80 00 00 	movabs $0x801daf,%rax
+  8023c5:	00 00 00 
+  8023c8:	ff d0                	call   *%rax
+  8023ca:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			if (r < 0)
+  8023cd:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8023d1:	79 30                	jns    802403 <pgfault+0x10e>
+			{
+				panic("pgfault...something wrong with page_map");
+  8023d3:	48 b8 38 34 80 00 00 	movabs $0x803438,%rax
+  8023da:	00 00 00 
+  8023dd:	48 89 c2             	mov    %rax,%rdx
+  8023e0:	be 22 00 00 00       	mov    $0x22,%esi
+  8023e5:	48 b8 60 34 80 00 00 	movabs $0x803460,%rax
+  8023ec:	00 00 00 
+  8023ef:	48 89 c7             	mov    %rax,%rdi
+  8023f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023f7:	48 b9 18 2c 80 00 00 	movabs $0x802c18,%rcx
+  8023fe:	00 00 00 
+  802401:	ff d1                	call   *%rcx
+			}
+			r = sys_page_unmap(0, PFTEMP);
+  802403:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802408:	bf 00 00 00 00       	mov    $0x0,%edi
+  80240d:	48 b8 0f 1e 80 00 00 	movabs $0x801e0f,%rax
+  802414:	00 00 00 
+  802417:	ff d0                	call   *%rax
+  802419:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			if (r < 0)
+  80241c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  802420:	0f 89 96 00 00 00    	jns    8024bc <pgfault+0x1c7>
+			{
+				panic("pgfault...something wrong with page_unmap");
+  802426:	48 b8 70 34 80 00 00 	movabs $0x803470,%rax
+  80242d:	00 00 00 
+  802430:	48 89 c2             	mov    %rax,%rdx
+  802433:	be 27 00 00 00       	mov    $0x27,%esi
+  802438:	48 b8 60 34 80 00 00 	movabs $0x803460,%rax
+  80243f:	00 00 00 
+  802442:	48 89 c7             	mov    %rax,%rdi
+  802445:	b8 00 00 00 00       	mov    $0x0,%eax
+  80244a:	48 b9 18 2c 80 00 00 	movabs $0x802c18,%rcx
+  802451:	00 00 00 
+  802454:	ff d1                	call   *%rcx
+			}
+			return;
+		}
+		else
+		{
+			panic("pgfault...something wrong with page_alloc");
+  802456:	48 b8 a0 34 80 00 00 	movabs $0x8034a0,%rax
+  80245d:	00 00 00 
+  802460:	48 89 c2             	mov    %rax,%rdx
+  802463:	be 2d 00 00 00       	mov    $0x2d,%esi
+  802468:	48 b8 60 34 80 00 00 	movabs $0x803460,%rax
+  80246f:	00 00 00 
+  802472:	48 89 c7             	mov    %rax,%rdi
+  802475:	b8 00 00 00 00       	mov    $0x0,%eax
+  80247a:	48 b9 18 2c 80 00 00 	movabs $0x802c18,%rcx
+  802481:	00 00 00 
+  802484:	ff d1                	call   *%rcx
+		}
+	}
+	else
+	{
+		panic("pgfault...wrong error %e", err);
+  802486:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802489:	89 c1                	mov    %eax,%ecx
+  80248b:	48 b8 ca 34 80 00 00 	movabs $0x8034ca,%rax
+  802492:	00 00 00 
+  802495:	48 89 c2             	mov    %rax,%rdx
+  802498:	be 32 00 00 00       	mov    $0x32,%esi
+  80249d:	48 b8 60 34 80 00 00 	movabs $0x803460,%rax
+  8024a4:	00 00 00 
+  8024a7:	48 89 c7             	mov    %rax,%rdi
+  8024aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024af:	49 b8 18 2c 80 00 00 	movabs $0x802c18,%r8
+  8024b6:	00 00 00 
+  8024b9:	41 ff d0             	call   *%r8
+			return;
+  8024bc:	90                   	nop
+	}
+}
+  8024bd:	c9                   	leave
+  8024be:	c3                   	ret
+
+00000000008024bf <duppage>:
+ * 映射: 将的虚拟页pn(地址: pn*PGSIZE)映射到相同虚拟地址的 envid 中.
+ * 成功: 返回0，失败调用 panic()
+ */
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  8024bf:	55                   	push   %rbp
+  8024c0:	48 89 e5             	mov    %rsp,%rbp
+  8024c3:	48 83 ec 30          	sub    $0x30,%rsp
+  8024c7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8024ca:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	pte_t entry = uvpt[pn];
+  8024cd:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  8024d4:	01 00 00 
+  8024d7:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8024da:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8024de:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	void *addr = (void *)((uintptr_t)pn * PGSIZE);
+  8024e2:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8024e5:	48 c1 e0 0c          	shl    $0xc,%rax
+  8024e9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	int perm = entry & PTE_SYSCALL;
+  8024ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024f1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8024f6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm & PTE_SHARE)
+  8024f9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8024fc:	25 00 04 00 00       	and    $0x400,%eax
+  802501:	85 c0                	test   %eax,%eax
+  802503:	74 68                	je     80256d <duppage+0xae>
+	{
+		r = sys_page_map(0, addr, envid, addr, perm);
+  802505:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  802508:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80250c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80250f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802513:	41 89 f0             	mov    %esi,%r8d
+  802516:	48 89 c6             	mov    %rax,%rsi
+  802519:	bf 00 00 00 00       	mov    $0x0,%edi
+  80251e:	48 b8 af 1d 80 00 00 	movabs $0x801daf,%rax
+  802525:	00 00 00 
+  802528:	ff d0                	call   *%rax
+  80252a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  80252d:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802531:	0f 89 90 01 00 00    	jns    8026c7 <duppage+0x208>
+		{
+			panic("Something went wrong on duppage %e", r);
+  802537:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80253a:	89 c1                	mov    %eax,%ecx
+  80253c:	48 b8 e8 34 80 00 00 	movabs $0x8034e8,%rax
+  802543:	00 00 00 
+  802546:	48 89 c2             	mov    %rax,%rdx
+  802549:	be 48 00 00 00       	mov    $0x48,%esi
+  80254e:	48 b8 60 34 80 00 00 	movabs $0x803460,%rax
+  802555:	00 00 00 
+  802558:	48 89 c7             	mov    %rax,%rdi
+  80255b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802560:	49 b8 18 2c 80 00 00 	movabs $0x802c18,%r8
+  802567:	00 00 00 
+  80256a:	41 ff d0             	call   *%r8
+		}
+	}
+	else if ((perm & PTE_COW) || (perm & PTE_W))
+  80256d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802570:	25 00 08 00 00       	and    $0x800,%eax
+  802575:	85 c0                	test   %eax,%eax
+  802577:	75 0e                	jne    802587 <duppage+0xc8>
+  802579:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80257c:	83 e0 02             	and    $0x2,%eax
+  80257f:	85 c0                	test   %eax,%eax
+  802581:	0f 84 dc 00 00 00    	je     802663 <duppage+0x1a4>
+	{
+		perm &= ~PTE_W;
+  802587:	83 65 ec fd          	andl   $0xfffffffd,-0x14(%rbp)
+		perm |= PTE_COW;
+  80258b:	81 4d ec 00 08 00 00 	orl    $0x800,-0x14(%rbp)
+		r = sys_page_map(0, addr, envid, addr, perm);
+  802592:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  802595:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802599:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80259c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8025a0:	41 89 f0             	mov    %esi,%r8d
+  8025a3:	48 89 c6             	mov    %rax,%rsi
+  8025a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025ab:	48 b8 af 1d 80 00 00 	movabs $0x801daf,%rax
+  8025b2:	00 00 00 
+  8025b5:	ff d0                	call   *%rax
+  8025b7:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  8025ba:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8025be:	79 36                	jns    8025f6 <duppage+0x137>
+		{
+			panic("Something went wrong on duppage %e", r);
+  8025c0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8025c3:	89 c1                	mov    %eax,%ecx
+  8025c5:	48 b8 e8 34 80 00 00 	movabs $0x8034e8,%rax
+  8025cc:	00 00 00 
+  8025cf:	48 89 c2             	mov    %rax,%rdx
+  8025d2:	be 52 00 00 00       	mov    $0x52,%esi
+  8025d7:	48 b8 60 34 80 00 00 	movabs $0x803460,%rax
+  8025de:	00 00 00 
+  8025e1:	48 89 c7             	mov    %rax,%rdi
+  8025e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025e9:	49 b8 18 2c 80 00 00 	movabs $0x802c18,%r8
+  8025f0:	00 00 00 
+  8025f3:	41 ff d0             	call   *%r8
+		}
+		r = sys_page_map(0, addr, 0, addr, perm);
+  8025f6:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  8025f9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802601:	41 89 c8             	mov    %ecx,%r8d
+  802604:	48 89 d1             	mov    %rdx,%rcx
+  802607:	ba 00 00 00 00       	mov    $0x0,%edx
+  80260c:	48 89 c6             	mov    %rax,%rsi
+  80260f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802614:	48 b8 af 1d 80 00 00 	movabs $0x801daf,%rax
+  80261b:	00 00 00 
+  80261e:	ff d0                	call   *%rax
+  802620:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  802623:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802627:	0f 89 9a 00 00 00    	jns    8026c7 <duppage+0x208>
+		{
+			panic("Something went wrong on duppage %e", r);
+  80262d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802630:	89 c1                	mov    %eax,%ecx
+  802632:	48 b8 e8 34 80 00 00 	movabs $0x8034e8,%rax
+  802639:	00 00 00 
+  80263c:	48 89 c2             	mov    %rax,%rdx
+  80263f:	be 57 00 00 00       	mov    $0x57,%esi
+  802644:	48 b8 60 34 80 00 00 	movabs $0x803460,%rax
+  80264b:	00 00 00 
+  80264e:	48 89 c7             	mov    %rax,%rdi
+  802651:	b8 00 00 00 00       	mov    $0x0,%eax
+  802656:	49 b8 18 2c 80 00 00 	movabs $0x802c18,%r8
+  80265d:	00 00 00 
+  802660:	41 ff d0             	call   *%r8
+		}
+	}
+	else
+	{
+		r = sys_page_map(0, addr, envid, addr, perm);
+  802663:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  802666:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80266a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80266d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802671:	41 89 f0             	mov    %esi,%r8d
+  802674:	48 89 c6             	mov    %rax,%rsi
+  802677:	bf 00 00 00 00       	mov    $0x0,%edi
+  80267c:	48 b8 af 1d 80 00 00 	movabs $0x801daf,%rax
+  802683:	00 00 00 
+  802686:	ff d0                	call   *%rax
+  802688:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  80268b:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80268f:	79 36                	jns    8026c7 <duppage+0x208>
+		{
+			panic("Something went wrong on duppage %e", r);
+  802691:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802694:	89 c1                	mov    %eax,%ecx
+  802696:	48 b8 e8 34 80 00 00 	movabs $0x8034e8,%rax
+  80269d:	00 00 00 
+  8026a0:	48 89 c2             	mov    %rax,%rdx
+  8026a3:	be 5f 00 00 00       	mov    $0x5f,%esi
+  8026a8:	48 b8 60 34 80 00 00 	movabs $0x803460,%rax
+  8026af:	00 00 00 
+  8026b2:	48 89 c7             	mov    %rax,%rdi
+  8026b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026ba:	49 b8 18 2c 80 00 00 	movabs $0x802c18,%r8
+  8026c1:	00 00 00 
+  8026c4:	41 ff d0             	call   *%r8
+		}
+	}
+	return 0;
+  8026c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026cc:	c9                   	leave
+  8026cd:	c3                   	ret
+
+00000000008026ce <fork>:
+ * 
+ * 两个用户异常栈都不应该被标记为COW，所以必须为子环境的异常栈分配一个新页
+ */
+envid_t
+fork(void)
+{
+  8026ce:	55                   	push   %rbp
+  8026cf:	48 89 e5             	mov    %rsp,%rbp
+  8026d2:	48 83 ec 50          	sub    $0x50,%rsp
+	int r = 0;
+  8026d6:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	set_pgfault_handler(pgfault);
+  8026dd:	48 b8 f5 22 80 00 00 	movabs $0x8022f5,%rax
+  8026e4:	00 00 00 
+  8026e7:	48 89 c7             	mov    %rax,%rdi
+  8026ea:	48 b8 32 2d 80 00 00 	movabs $0x802d32,%rax
+  8026f1:	00 00 00 
+  8026f4:	ff d0                	call   *%rax
+// 必须内联.
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8026f6:	b8 07 00 00 00       	mov    $0x7,%eax
+  8026fb:	cd 30                	int    $0x30
+  8026fd:	89 45 bc             	mov    %eax,-0x44(%rbp)
+					 : "=a"(ret)
+					 : "a"(SYS_exofork),
+					   "i"(T_SYSCALL));
+	return ret;
+  802700:	8b 45 bc             	mov    -0x44(%rbp),%eax
+	envid_t childid = sys_exofork();
+  802703:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	if (childid < 0)
+  802706:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  80270a:	79 36                	jns    802742 <fork+0x74>
+	{
+		panic("\n couldn't call fork %e\n", childid);
+  80270c:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80270f:	89 c1                	mov    %eax,%ecx
+  802711:	48 b8 0b 35 80 00 00 	movabs $0x80350b,%rax
+  802718:	00 00 00 
+  80271b:	48 89 c2             	mov    %rax,%rdx
+  80271e:	be 7a 00 00 00       	mov    $0x7a,%esi
+  802723:	48 b8 60 34 80 00 00 	movabs $0x803460,%rax
+  80272a:	00 00 00 
+  80272d:	48 89 c7             	mov    %rax,%rdi
+  802730:	b8 00 00 00 00       	mov    $0x0,%eax
+  802735:	49 b8 18 2c 80 00 00 	movabs $0x802c18,%r8
+  80273c:	00 00 00 
+  80273f:	41 ff d0             	call   *%r8
+	}
+	if (childid == 0)
+  802742:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  802746:	75 3e                	jne    802786 <fork+0xb8>
+	{
+		// thisproc 父进程
+		thisproc = &procs[ENVX(sys_getprocid())];
+  802748:	48 b8 e4 1c 80 00 00 	movabs $0x801ce4,%rax
+  80274f:	00 00 00 
+  802752:	ff d0                	call   *%rax
+  802754:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802759:	48 98                	cltq
+  80275b:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  802762:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  802769:	00 00 00 
+  80276c:	48 01 c2             	add    %rax,%rdx
+  80276f:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  802776:	00 00 00 
+  802779:	48 89 10             	mov    %rdx,(%rax)
+		// 子环境的返回值
+		return 0;
+  80277c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802781:	e9 c2 02 00 00       	jmp    802a48 <fork+0x37a>
+	}
+	r = sys_page_alloc(childid, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_W | PTE_U);
+  802786:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802789:	ba 07 00 00 00       	mov    $0x7,%edx
+  80278e:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  802793:	48 89 ce             	mov    %rcx,%rsi
+  802796:	89 c7                	mov    %eax,%edi
+  802798:	48 b8 5d 1d 80 00 00 	movabs $0x801d5d,%rax
+  80279f:	00 00 00 
+  8027a2:	ff d0                	call   *%rax
+  8027a4:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if (r < 0)
+  8027a7:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  8027ab:	79 36                	jns    8027e3 <fork+0x115>
+		panic("\n couldn't call fork %e\n", r);
+  8027ad:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8027b0:	89 c1                	mov    %eax,%ecx
+  8027b2:	48 b8 0b 35 80 00 00 	movabs $0x80350b,%rax
+  8027b9:	00 00 00 
+  8027bc:	48 89 c2             	mov    %rax,%rdx
+  8027bf:	be 85 00 00 00       	mov    $0x85,%esi
+  8027c4:	48 b8 60 34 80 00 00 	movabs $0x803460,%rax
+  8027cb:	00 00 00 
+  8027ce:	48 89 c7             	mov    %rax,%rdi
+  8027d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027d6:	49 b8 18 2c 80 00 00 	movabs $0x802c18,%r8
+  8027dd:	00 00 00 
+  8027e0:	41 ff d0             	call   *%r8
+
+	uint64_t pml;
+	uint64_t pdpe;
+	uint64_t pde;
+	uint64_t pte;
+	uint64_t each_pde = 0;
+  8027e3:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8027ea:	00 
+	uint64_t each_pte = 0;
+  8027eb:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8027f2:	00 
+	uint64_t each_pdpe = 0;
+  8027f3:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8027fa:	00 
+
+	// 拷贝[0, UXSTACKTOP)的所有用户页，接下来为用户异常栈创建物理页
+	// 因为在创建用户环境时，已经在 env_setup_vm() 中映射了内核所有页
+	for (pml = 0; pml < VPML4E(UTOP); pml++)
+  8027fb:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802802:	00 
+  802803:	e9 80 01 00 00       	jmp    802988 <fork+0x2ba>
+	{
+		if (uvpml4e[pml] & PTE_P)
+  802808:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80280f:	01 00 00 
+  802812:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802816:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80281a:	83 e0 01             	and    $0x1,%eax
+  80281d:	48 85 c0             	test   %rax,%rax
+  802820:	0f 84 4d 01 00 00    	je     802973 <fork+0x2a5>
+		{
+
+			for (pdpe = 0; pdpe < NPDPENTRIES; pdpe++, each_pdpe++)
+  802826:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80282d:	00 
+  80282e:	e9 30 01 00 00       	jmp    802963 <fork+0x295>
+			{
+				if (uvpde[each_pdpe] & PTE_P)
+  802833:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80283a:	01 00 00 
+  80283d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802841:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802845:	83 e0 01             	and    $0x1,%eax
+  802848:	48 85 c0             	test   %rax,%rax
+  80284b:	0f 84 f8 00 00 00    	je     802949 <fork+0x27b>
+				{
+
+					for (pde = 0; pde < NPDENTRIES; pde++, each_pde++)
+  802851:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802858:	00 
+  802859:	e9 db 00 00 00       	jmp    802939 <fork+0x26b>
+					{
+						if (uvpd[each_pde] & PTE_P)
+  80285e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802865:	01 00 00 
+  802868:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80286c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802870:	83 e0 01             	and    $0x1,%eax
+  802873:	48 85 c0             	test   %rax,%rax
+  802876:	0f 84 a3 00 00 00    	je     80291f <fork+0x251>
+						{
+
+							for (pte = 0; pte < NPTENTRIES; pte++, each_pte++)
+  80287c:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802883:	00 
+  802884:	e9 86 00 00 00       	jmp    80290f <fork+0x241>
+							{
+								if (uvpt[each_pte] & PTE_P)
+  802889:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802890:	01 00 00 
+  802893:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802897:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80289b:	83 e0 01             	and    $0x1,%eax
+  80289e:	48 85 c0             	test   %rax,%rax
+  8028a1:	74 62                	je     802905 <fork+0x237>
+								{
+
+									if (each_pte != VPN(UXSTACKTOP - PGSIZE))
+  8028a3:	48 81 7d d0 ff f7 0e 	cmpq   $0xef7ff,-0x30(%rbp)
+  8028aa:	00 
+  8028ab:	74 58                	je     802905 <fork+0x237>
+									{
+										r = duppage(childid, (unsigned)each_pte);
+  8028ad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028b1:	89 c2                	mov    %eax,%edx
+  8028b3:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8028b6:	89 d6                	mov    %edx,%esi
+  8028b8:	89 c7                	mov    %eax,%edi
+  8028ba:	48 b8 bf 24 80 00 00 	movabs $0x8024bf,%rax
+  8028c1:	00 00 00 
+  8028c4:	ff d0                	call   *%rax
+  8028c6:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+										if (r < 0)
+  8028c9:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  8028cd:	79 36                	jns    802905 <fork+0x237>
+											panic("\n couldn't call fork %e\n", r);
+  8028cf:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8028d2:	89 c1                	mov    %eax,%ecx
+  8028d4:	48 b8 0b 35 80 00 00 	movabs $0x80350b,%rax
+  8028db:	00 00 00 
+  8028de:	48 89 c2             	mov    %rax,%rdx
+  8028e1:	be a9 00 00 00       	mov    $0xa9,%esi
+  8028e6:	48 b8 60 34 80 00 00 	movabs $0x803460,%rax
+  8028ed:	00 00 00 
+  8028f0:	48 89 c7             	mov    %rax,%rdi
+  8028f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028f8:	49 b8 18 2c 80 00 00 	movabs $0x802c18,%r8
+  8028ff:	00 00 00 
+  802902:	41 ff d0             	call   *%r8
+							for (pte = 0; pte < NPTENTRIES; pte++, each_pte++)
+  802905:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  80290a:	48 83 45 d0 01       	addq   $0x1,-0x30(%rbp)
+  80290f:	48 81 7d e0 ff 01 00 	cmpq   $0x1ff,-0x20(%rbp)
+  802916:	00 
+  802917:	0f 86 6c ff ff ff    	jbe    802889 <fork+0x1bb>
+  80291d:	eb 10                	jmp    80292f <fork+0x261>
+								}
+							}
+						}
+						else
+						{
+							each_pte = (each_pde + 1) * NPTENTRIES;
+  80291f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802923:	48 83 c0 01          	add    $0x1,%rax
+  802927:	48 c1 e0 09          	shl    $0x9,%rax
+  80292b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+					for (pde = 0; pde < NPDENTRIES; pde++, each_pde++)
+  80292f:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  802934:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802939:	48 81 7d e8 ff 01 00 	cmpq   $0x1ff,-0x18(%rbp)
+  802940:	00 
+  802941:	0f 86 17 ff ff ff    	jbe    80285e <fork+0x190>
+  802947:	eb 10                	jmp    802959 <fork+0x28b>
+						}
+					}
+				}
+				else
+				{
+					each_pde = (each_pdpe + 1) * NPDENTRIES;
+  802949:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80294d:	48 83 c0 01          	add    $0x1,%rax
+  802951:	48 c1 e0 09          	shl    $0x9,%rax
+  802955:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			for (pdpe = 0; pdpe < NPDPENTRIES; pdpe++, each_pdpe++)
+  802959:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  80295e:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  802963:	48 81 7d f0 ff 01 00 	cmpq   $0x1ff,-0x10(%rbp)
+  80296a:	00 
+  80296b:	0f 86 c2 fe ff ff    	jbe    802833 <fork+0x165>
+  802971:	eb 10                	jmp    802983 <fork+0x2b5>
+				}
+			}
+		}
+		else
+		{
+			each_pdpe = (pml + 1) * NPDPENTRIES;
+  802973:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802977:	48 83 c0 01          	add    $0x1,%rax
+  80297b:	48 c1 e0 09          	shl    $0x9,%rax
+  80297f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	for (pml = 0; pml < VPML4E(UTOP); pml++)
+  802983:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802988:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80298d:	0f 84 75 fe ff ff    	je     802808 <fork+0x13a>
+
+	extern void _pgfault_upcall(void);
+	// 为子环境设置页错误处理函数.
+	// 因为使用env_alloc()创建的env的处理函数指针都为空，但是这时已经明确的为其错误栈分配了物理页面
+	// 所以可以直接使用系统调用指定错误处理的入口，_pgfault_upcall()为所有用户页错误处理函数的总入口
+	r = sys_env_set_pgfault_upcall(childid, _pgfault_upcall);
+  802993:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802996:	48 ba d6 2d 80 00 00 	movabs $0x802dd6,%rdx
+  80299d:	00 00 00 
+  8029a0:	48 89 d6             	mov    %rdx,%rsi
+  8029a3:	89 c7                	mov    %eax,%edi
+  8029a5:	48 b8 f4 1e 80 00 00 	movabs $0x801ef4,%rax
+  8029ac:	00 00 00 
+  8029af:	ff d0                	call   *%rax
+  8029b1:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if (r < 0)
+  8029b4:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  8029b8:	79 36                	jns    8029f0 <fork+0x322>
+		panic("\n couldn't call fork %e\n", r);
+  8029ba:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8029bd:	89 c1                	mov    %eax,%ecx
+  8029bf:	48 b8 0b 35 80 00 00 	movabs $0x80350b,%rax
+  8029c6:	00 00 00 
+  8029c9:	48 89 c2             	mov    %rax,%rdx
+  8029cc:	be c6 00 00 00       	mov    $0xc6,%esi
+  8029d1:	48 b8 60 34 80 00 00 	movabs $0x803460,%rax
+  8029d8:	00 00 00 
+  8029db:	48 89 c7             	mov    %rax,%rdi
+  8029de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e3:	49 b8 18 2c 80 00 00 	movabs $0x802c18,%r8
+  8029ea:	00 00 00 
+  8029ed:	41 ff d0             	call   *%r8
+
+	r = sys_env_set_status(childid, ENV_RUNNABLE);
+  8029f0:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8029f3:	be 02 00 00 00       	mov    $0x2,%esi
+  8029f8:	89 c7                	mov    %eax,%edi
+  8029fa:	48 b8 5b 1e 80 00 00 	movabs $0x801e5b,%rax
+  802a01:	00 00 00 
+  802a04:	ff d0                	call   *%rax
+  802a06:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if (r < 0)
+  802a09:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  802a0d:	79 36                	jns    802a45 <fork+0x377>
+		panic("\n couldn't call fork %e\n", r);
+  802a0f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802a12:	89 c1                	mov    %eax,%ecx
+  802a14:	48 b8 0b 35 80 00 00 	movabs $0x80350b,%rax
+  802a1b:	00 00 00 
+  802a1e:	48 89 c2             	mov    %rax,%rdx
+  802a21:	be ca 00 00 00       	mov    $0xca,%esi
+  802a26:	48 b8 60 34 80 00 00 	movabs $0x803460,%rax
+  802a2d:	00 00 00 
+  802a30:	48 89 c7             	mov    %rax,%rdi
+  802a33:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a38:	49 b8 18 2c 80 00 00 	movabs $0x802c18,%r8
+  802a3f:	00 00 00 
+  802a42:	41 ff d0             	call   *%r8
+
+	return childid;
+  802a45:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  802a48:	c9                   	leave
+  802a49:	c3                   	ret
+
+0000000000802a4a <ipc_recv>:
+ * 如果 pg 为空，则传递 sys_ipc_recv 一个值，它将理解为“no page”的意思
+ * (Zero 不是正确的值，因为这是映射页面的完美有效位置)
+ */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802a4a:	55                   	push   %rbp
+  802a4b:	48 89 e5             	mov    %rsp,%rbp
+  802a4e:	48 83 ec 30          	sub    $0x30,%rsp
+  802a52:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802a56:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802a5a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	int r = 0;
+  802a5e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	if(pg) {
+  802a65:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802a6a:	74 18                	je     802a84 <ipc_recv+0x3a>
+		r = sys_ipc_recv(pg);
+  802a6c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a70:	48 89 c7             	mov    %rax,%rdi
+  802a73:	48 b8 97 1f 80 00 00 	movabs $0x801f97,%rax
+  802a7a:	00 00 00 
+  802a7d:	ff d0                	call   *%rax
+  802a7f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802a82:	eb 1c                	jmp    802aa0 <ipc_recv+0x56>
+	}
+	// pg == 0, pg > UTOP
+	else {
+		r = sys_ipc_recv((void*)KERNBASE);
+  802a84:	48 b8 00 00 00 04 80 	movabs $0x8004000000,%rax
+  802a8b:	00 00 00 
+  802a8e:	48 89 c7             	mov    %rax,%rdi
+  802a91:	48 b8 97 1f 80 00 00 	movabs $0x801f97,%rax
+  802a98:	00 00 00 
+  802a9b:	ff d0                	call   *%rax
+  802a9d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	}
+	if (r < 0) {
+  802aa0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802aa4:	79 39                	jns    802adf <ipc_recv+0x95>
+		*from_env_store =  (from_env_store != NULL) ? (envid_t)0 : *from_env_store;
+  802aa6:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802aab:	75 08                	jne    802ab5 <ipc_recv+0x6b>
+  802aad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ab1:	8b 00                	mov    (%rax),%eax
+  802ab3:	eb 05                	jmp    802aba <ipc_recv+0x70>
+  802ab5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aba:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802abe:	89 02                	mov    %eax,(%rdx)
+		*perm_store = (perm_store != NULL) ? (int)0 : *perm_store;
+  802ac0:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  802ac5:	75 08                	jne    802acf <ipc_recv+0x85>
+  802ac7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802acb:	8b 00                	mov    (%rax),%eax
+  802acd:	eb 05                	jmp    802ad4 <ipc_recv+0x8a>
+  802acf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ad4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802ad8:	89 02                	mov    %eax,(%rdx)
+		return r;
+  802ada:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802add:	eb 53                	jmp    802b32 <ipc_recv+0xe8>
+	}
+	// 设置from_env_store为发送进程的进程ID
+	if(from_env_store) {
+  802adf:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802ae4:	74 19                	je     802aff <ipc_recv+0xb5>
+		*from_env_store = thisproc->env_ipc_from;
+  802ae6:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  802aed:	00 00 00 
+  802af0:	48 8b 00             	mov    (%rax),%rax
+  802af3:	8b 90 6c 01 00 00    	mov    0x16c(%rax),%edx
+  802af9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802afd:	89 10                	mov    %edx,(%rax)
+	}
+	// 如果传递物理页，该位不为0，设置perm_store为物理页的权限
+	if(perm_store) {
+  802aff:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  802b04:	74 19                	je     802b1f <ipc_recv+0xd5>
+		*perm_store = thisproc->env_ipc_perm;
+  802b06:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  802b0d:	00 00 00 
+  802b10:	48 8b 00             	mov    (%rax),%rax
+  802b13:	8b 90 70 01 00 00    	mov    0x170(%rax),%edx
+  802b19:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b1d:	89 10                	mov    %edx,(%rax)
+	}
+	// 返回发送进程发送的值
+	return thisproc->env_ipc_value;
+  802b1f:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  802b26:	00 00 00 
+  802b29:	48 8b 00             	mov    (%rax),%rax
+  802b2c:	8b 80 68 01 00 00    	mov    0x168(%rax),%eax
+}
+  802b32:	c9                   	leave
+  802b33:	c3                   	ret
+
+0000000000802b34 <ipc_send>:
+ * 使用sys_yield()使cpu友好
+ * 如果'pg'为null，则给sys_ipc_recv传递一个它会理解为“无页面”的值(0不是正确的值)
+ */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802b34:	55                   	push   %rbp
+  802b35:	48 89 e5             	mov    %rsp,%rbp
+  802b38:	48 83 ec 30          	sub    $0x30,%rsp
+  802b3c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802b3f:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  802b42:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802b46:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	int r = -E_IPC_NOT_RECV;
+  802b49:	c7 45 fc f8 ff ff ff 	movl   $0xfffffff8,-0x4(%rbp)
+	// 子进程不是接收状态
+	while(r == -E_IPC_NOT_RECV) {
+  802b50:	eb 59                	jmp    802bab <ipc_send+0x77>
+		if(pg) {
+  802b52:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802b57:	74 20                	je     802b79 <ipc_send+0x45>
+			// 传递物理页
+			r = sys_ipc_try_send(to_env, val, pg, perm);
+  802b59:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  802b5c:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  802b5f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b63:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b66:	89 c7                	mov    %eax,%edi
+  802b68:	48 b8 40 1f 80 00 00 	movabs $0x801f40,%rax
+  802b6f:	00 00 00 
+  802b72:	ff d0                	call   *%rax
+  802b74:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802b77:	eb 26                	jmp    802b9f <ipc_send+0x6b>
+		}
+		// pg == 0, pg > UTOP
+		else {
+			// (void*)KERNBASE > UTOP
+			r = sys_ipc_try_send(to_env, val, (void*)KERNBASE, perm);
+  802b79:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  802b7c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802b7f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b82:	89 d1                	mov    %edx,%ecx
+  802b84:	48 ba 00 00 00 04 80 	movabs $0x8004000000,%rdx
+  802b8b:	00 00 00 
+  802b8e:	89 c7                	mov    %eax,%edi
+  802b90:	48 b8 40 1f 80 00 00 	movabs $0x801f40,%rax
+  802b97:	00 00 00 
+  802b9a:	ff d0                	call   *%rax
+  802b9c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+		}
+		// 让出CPU
+		sys_yield();
+  802b9f:	48 b8 20 1d 80 00 00 	movabs $0x801d20,%rax
+  802ba6:	00 00 00 
+  802ba9:	ff d0                	call   *%rax
+	while(r == -E_IPC_NOT_RECV) {
+  802bab:	83 7d fc f8          	cmpl   $0xfffffff8,-0x4(%rbp)
+  802baf:	74 a1                	je     802b52 <ipc_send+0x1e>
+	}
+	if (r != 0) {
+  802bb1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802bb5:	74 30                	je     802be7 <ipc_send+0xb3>
+		panic("something went wrong with sending the page");
+  802bb7:	48 b8 28 35 80 00 00 	movabs $0x803528,%rax
+  802bbe:	00 00 00 
+  802bc1:	48 89 c2             	mov    %rax,%rdx
+  802bc4:	be 48 00 00 00       	mov    $0x48,%esi
+  802bc9:	48 b8 53 35 80 00 00 	movabs $0x803553,%rax
+  802bd0:	00 00 00 
+  802bd3:	48 89 c7             	mov    %rax,%rdi
+  802bd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bdb:	48 b9 18 2c 80 00 00 	movabs $0x802c18,%rcx
+  802be2:	00 00 00 
+  802be5:	ff d1                	call   *%rcx
+	}
+}
+  802be7:	90                   	nop
+  802be8:	c9                   	leave
+  802be9:	c3                   	ret
+
+0000000000802bea <ipc_find_env>:
+// find special environments.
+// Returns 0 if no such environment exists.
+// 内核只遍历已分配的环境(env_live)，不扫描整个 procs[]
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802bea:	55                   	push   %rbp
+  802beb:	48 89 e5             	mov    %rsp,%rbp
+  802bee:	48 83 ec 20          	sub    $0x20,%rsp
+  802bf2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	envid_t r = sys_env_find(type);
+  802bf5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bf8:	89 c7                	mov    %eax,%edi
+  802bfa:	48 b8 0e 22 80 00 00 	movabs $0x80220e,%rax
+  802c01:	00 00 00 
+  802c04:	ff d0                	call   *%rax
+  802c06:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+	return r < 0 ? 0 : r;
+  802c09:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c11:	85 c0                	test   %eax,%eax
+  802c13:	0f 48 c2             	cmovs  %edx,%eax
+}
+  802c16:	c9                   	leave
+  802c17:	c3                   	ret
+
+0000000000802c18 <_panic>:
+/*
+ * 无法解决的致命错误会导致死机
+ * 打印"死机:<消息>”，然后导致处理器休眠进入HLT状态
+ */
+void _panic(const char *file, int line, const char *fmt, ...)
+{
+  802c18:	55                   	push   %rbp
+  802c19:	48 89 e5             	mov    %rsp,%rbp
+  802c1c:	53                   	push   %rbx
+  802c1d:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  802c24:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  802c2b:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  802c31:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  802c38:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  802c3f:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  802c46:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  802c4d:	84 c0                	test   %al,%al
+  802c4f:	74 23                	je     802c74 <_panic+0x5c>
+  802c51:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  802c58:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  802c5c:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  802c60:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  802c64:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  802c68:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  802c6c:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  802c70:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  802c74:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  802c7b:	00 00 00 
+  802c7e:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  802c85:	00 00 00 
+  802c88:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802c8c:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  802c93:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  802c9a:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+	// 输出死机的信息
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802ca1:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  802ca8:	00 00 00 
+  802cab:	48 8b 18             	mov    (%rax),%rbx
+  802cae:	48 b8 e4 1c 80 00 00 	movabs $0x801ce4,%rax
+  802cb5:	00 00 00 
+  802cb8:	ff d0                	call   *%rax
+  802cba:	89 c6                	mov    %eax,%esi
+  802cbc:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  802cc2:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  802cc9:	41 89 d0             	mov    %edx,%r8d
+  802ccc:	48 89 c1             	mov    %rax,%rcx
+  802ccf:	48 89 da             	mov    %rbx,%rdx
+  802cd2:	48 b8 60 35 80 00 00 	movabs $0x803560,%rax
+  802cd9:	00 00 00 
+  802cdc:	48 89 c7             	mov    %rax,%rdi
+  802cdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce4:	49 b9 71 04 80 00 00 	movabs $0x800471,%r9
+  802ceb:	00 00 00 
+  802cee:	41 ff d1             	call   *%r9
+			sys_getprocid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802cf1:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  802cf8:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  802cff:	48 89 d6             	mov    %rdx,%rsi
+  802d02:	48 89 c7             	mov    %rax,%rdi
+  802d05:	48 b8 c2 03 80 00 00 	movabs $0x8003c2,%rax
+  802d0c:	00 00 00 
+  802d0f:	ff d0                	call   *%rax
+	cprintf("\n");
+  802d11:	48 b8 83 35 80 00 00 	movabs $0x803583,%rax
+  802d18:	00 00 00 
+  802d1b:	48 89 c7             	mov    %rax,%rdi
+  802d1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d23:	48 ba 71 04 80 00 00 	movabs $0x800471,%rdx
+  802d2a:	00 00 00 
+  802d2d:	ff d2                	call   *%rdx
+
+	// 触发断点中断
+	while (1)
+		asm volatile("int3");
+  802d2f:	cc                   	int3
+  802d30:	eb fd                	jmp    802d2f <_panic+0x117>
+
+0000000000802d32 <set_pgfault_handler>:
+ * 包含用户异常栈的初始化和页错误处理函数的设置，利用 kern/syscall.c sys_env_set_pgfault_upcall() 注册(utf字段)用户页错误处理函数
+ * 第一次注册处理程序时，需要分配一个异常堆栈(顶部位于UXSTACKTOP的一页内存)
+ * 并告诉内核在页错误发生时调用汇编语言 _pgfault_upcall 例程
+ */
+void set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802d32:	55                   	push   %rbp
+  802d33:	48 89 e5             	mov    %rsp,%rbp
+  802d36:	48 83 ec 10          	sub    $0x10,%rsp
+  802d3a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	if (_pgfault_handler == 0)
+  802d3e:	48 b8 28 40 80 00 00 	movabs $0x804028,%rax
+  802d45:	00 00 00 
+  802d48:	48 8b 00             	mov    (%rax),%rax
+  802d4b:	48 85 c0             	test   %rax,%rax
+  802d4e:	75 72                	jne    802dc2 <set_pgfault_handler+0x90>
+	{
+		// 第一次出错，创建用户异常栈
+		if (sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_W | PTE_U | PTE_P) == 0)
+  802d50:	ba 07 00 00 00       	mov    $0x7,%edx
+  802d55:	b8 00 f0 7f ef       	mov    $0xef7ff000,%eax
+  802d5a:	48 89 c6             	mov    %rax,%rsi
+  802d5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d62:	48 b8 5d 1d 80 00 00 	movabs $0x801d5d,%rax
+  802d69:	00 00 00 
+  802d6c:	ff d0                	call   *%rax
+  802d6e:	85 c0                	test   %eax,%eax
+  802d70:	75 20                	jne    802d92 <set_pgfault_handler+0x60>
+			sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  802d72:	48 b8 d6 2d 80 00 00 	movabs $0x802dd6,%rax
+  802d79:	00 00 00 
+  802d7c:	48 89 c6             	mov    %rax,%rsi
+  802d7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d84:	48 b8 f4 1e 80 00 00 	movabs $0x801ef4,%rax
+  802d8b:	00 00 00 
+  802d8e:	ff d0                	call   *%rax
+  802d90:	eb 30                	jmp    802dc2 <set_pgfault_handler+0x90>
+		else
+			panic("set_pgfault_handler(): no memory");
+  802d92:	48 b8 88 35 80 00 00 	movabs $0x803588,%rax
+  802d99:	00 00 00 
+  802d9c:	48 89 c2             	mov    %rax,%rdx
+  802d9f:	be 1b 00 00 00       	mov    $0x1b,%esi
+  802da4:	48 b8 a9 35 80 00 00 	movabs $0x8035a9,%rax
+  802dab:	00 00 00 
+  802dae:	48 89 c7             	mov    %rax,%rdi
+  802db1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db6:	48 b9 18 2c 80 00 00 	movabs $0x802c18,%rcx
+  802dbd:	00 00 00 
+  802dc0:	ff d1                	call   *%rcx
+	}
+
+	// 存储汇编语言调用的处理函数指针.
+	_pgfault_handler = handler;
+  802dc2:	48 ba 28 40 80 00 00 	movabs $0x804028,%rdx
+  802dc9:	00 00 00 
+  802dcc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802dd0:	48 89 02             	mov    %rax,(%rdx)
+}
+  802dd3:	90                   	nop
+  802dd4:	c9                   	leave
+  802dd5:	c3                   	ret
+
+0000000000802dd6 <_pgfault_upcall>:
+
+	// 调用C代码中的页错误处理函数.
+	// 函数参数: 指向 UTrapframe 的指针
+
+	// 通过 %rdi 传递函数参数
+	movq  %rsp, %rdi
+  802dd6:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  802dd9:	48 a1 28 40 80 00 00 	movabs 0x804028,%rax
+  802de0:	00 00 00 
+	call *%rax
+  802de3:	ff d0                	call   *%rax
+			regs: 15*8 = 120-Byte,
+			eflags: 8-Byte,
+			rip: 8-Byte
+	*/
+
+	addq $16, %rsp	/* 跳过用户异常栈中的 utf_fault_va 和 utf_err(不需要) */
+  802de5:	48 83 c4 10          	add    $0x10,%rsp
+	
+	/* 用户异常栈: %rsp 指向 end of struct PushRegs */
+	
+	movq 120(%rsp), %r10	/* %r10 = %rip */
+  802de9:	4c 8b 54 24 78       	mov    0x78(%rsp),%r10
+	movq 136(%rsp), %r11	/* %r11 = %rsp */
+  802dee:	4c 8b 9c 24 88 00 00 	mov    0x88(%rsp),%r11
+  802df5:	00 
+
+	subq $8, %r11			/* %r11(trap-time %rsp) - 8 */
+  802df6:	49 83 eb 08          	sub    $0x8,%r11
+	movq %r10, (%r11)		/* %r11(trap-time %rsp) 指向的值为 %rip */
+  802dfa:	4d 89 13             	mov    %r10,(%r11)
+	movq %r11, 136(%rsp)	/* 更新 trap-time %rsp 的值 */
+  802dfd:	4c 89 9c 24 88 00 00 	mov    %r11,0x88(%rsp)
+  802e04:	00 
+		trap-time eflags
+		trap-time rip
+	*/
+
+	// 恢复 trap-time 寄存器集.  接下来不能再修改任何通用寄存器集 PushRegs.
+	POPA_	/* 之前已经通过增加 16-Byte 跳过了 fault_va 和 utf_err，所以只需使用 POPA_ 恢复 */
+  802e05:	4c 8b 3c 24          	mov    (%rsp),%r15
+  802e09:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  802e0e:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  802e13:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  802e18:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  802e1d:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  802e22:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  802e27:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  802e2c:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  802e31:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  802e36:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  802e3b:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  802e40:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  802e45:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  802e4a:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  802e4f:	48 83 c4 78          	add    $0x78,%rsp
+
+	// 从栈中恢复 %eflags.  接下来不能再使用修改 %eflags 的指令，比如算术指令sub, cmp等.
+	addq $8, %rsp	/* 跳过 %rip，指向 %eflags */
+  802e53:	48 83 c4 08          	add    $0x8,%rsp
+	popfq			/* 从栈中恢复 %eflags */
+  802e57:	9d                   	popf
+		(blank 8-Byte)
+		trap-time rip
+	*/
+
+	// 切换回调整后的 trap-time 栈.
+	popq %rsp		/* 已经指向 %rsp，直接 pop 恢复 */
+  802e58:	5c                   	pop    %rsp
+
+	// 返回重新执行引起页错误的环境指令.
+	ret				/* popq %rip */
+  802e59:	c3                   	ret
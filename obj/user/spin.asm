@@ -0,0 +1,4469 @@
+
+obj/user/spin.debug:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// entrypoint - 当最初被加载到一个新的环境中时，内核(或者父环境)在这里开始运行.
+.text
+.globl _start
+_start:
+	// 判断是否从栈上的参数开始初始化
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	// $USTACKTOP != %rsp 说明有参数，跳转到 args_exist
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// 如果不是(新环境被内核加载的时候)，则 push 伪造的 argc, argv 参数
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 14 01 00 00       	call   800155 <libmain>
+
+// 不应该返回
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+// 让它运行几个时间片后销毁它
+
+#include "inc/lib.h"
+
+void umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	48 83 ec 20          	sub    $0x20,%rsp
+  80004b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80004e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int32_t proc;
+
+	cprintf("I am the parent.  Forking the child...\n");
+  800052:	48 b8 40 2b 80 00 00 	movabs $0x802b40,%rax
+  800059:	00 00 00 
+  80005c:	48 89 c7             	mov    %rax,%rdi
+  80005f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800064:	48 ba 13 03 80 00 00 	movabs $0x800313,%rdx
+  80006b:	00 00 00 
+  80006e:	ff d2                	call   *%rdx
+	if ((proc = fork()) == 0)
+  800070:	48 b8 70 25 80 00 00 	movabs $0x802570,%rax
+  800077:	00 00 00 
+  80007a:	ff d0                	call   *%rax
+  80007c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80007f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800083:	75 20                	jne    8000a5 <umain+0x62>
+	{
+		cprintf("I am the child.  Spinning...\n");
+  800085:	48 b8 68 2b 80 00 00 	movabs $0x802b68,%rax
+  80008c:	00 00 00 
+  80008f:	48 89 c7             	mov    %rax,%rdi
+  800092:	b8 00 00 00 00       	mov    $0x0,%eax
+  800097:	48 ba 13 03 80 00 00 	movabs $0x800313,%rdx
+  80009e:	00 00 00 
+  8000a1:	ff d2                	call   *%rdx
+		while (1)
+  8000a3:	eb fe                	jmp    8000a3 <umain+0x60>
+			/* do nothing */;
+	}
+
+	cprintf("I am the parent.  Running the child...\n");
+  8000a5:	48 b8 88 2b 80 00 00 	movabs $0x802b88,%rax
+  8000ac:	00 00 00 
+  8000af:	48 89 c7             	mov    %rax,%rdi
+  8000b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b7:	48 ba 13 03 80 00 00 	movabs $0x800313,%rdx
+  8000be:	00 00 00 
+  8000c1:	ff d2                	call   *%rdx
+	sys_yield();
+  8000c3:	48 b8 c2 1b 80 00 00 	movabs $0x801bc2,%rax
+  8000ca:	00 00 00 
+  8000cd:	ff d0                	call   *%rax
+	sys_yield();
+  8000cf:	48 b8 c2 1b 80 00 00 	movabs $0x801bc2,%rax
+  8000d6:	00 00 00 
+  8000d9:	ff d0                	call   *%rax
+	sys_yield();
+  8000db:	48 b8 c2 1b 80 00 00 	movabs $0x801bc2,%rax
+  8000e2:	00 00 00 
+  8000e5:	ff d0                	call   *%rax
+	sys_yield();
+  8000e7:	48 b8 c2 1b 80 00 00 	movabs $0x801bc2,%rax
+  8000ee:	00 00 00 
+  8000f1:	ff d0                	call   *%rax
+	sys_yield();
+  8000f3:	48 b8 c2 1b 80 00 00 	movabs $0x801bc2,%rax
+  8000fa:	00 00 00 
+  8000fd:	ff d0                	call   *%rax
+	sys_yield();
+  8000ff:	48 b8 c2 1b 80 00 00 	movabs $0x801bc2,%rax
+  800106:	00 00 00 
+  800109:	ff d0                	call   *%rax
+	sys_yield();
+  80010b:	48 b8 c2 1b 80 00 00 	movabs $0x801bc2,%rax
+  800112:	00 00 00 
+  800115:	ff d0                	call   *%rax
+	sys_yield();
+  800117:	48 b8 c2 1b 80 00 00 	movabs $0x801bc2,%rax
+  80011e:	00 00 00 
+  800121:	ff d0                	call   *%rax
+
+	cprintf("I am the parent.  Killing the child...\n");
+  800123:	48 b8 b0 2b 80 00 00 	movabs $0x802bb0,%rax
+  80012a:	00 00 00 
+  80012d:	48 89 c7             	mov    %rax,%rdi
+  800130:	b8 00 00 00 00       	mov    $0x0,%eax
+  800135:	48 ba 13 03 80 00 00 	movabs $0x800313,%rdx
+  80013c:	00 00 00 
+  80013f:	ff d2                	call   *%rdx
+	sys_env_destroy(proc);
+  800141:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800144:	89 c7                	mov    %eax,%edi
+  800146:	48 b8 40 1b 80 00 00 	movabs $0x801b40,%rax
+  80014d:	00 00 00 
+  800150:	ff d0                	call   *%rax
+}
+  800152:	90                   	nop
+  800153:	c9                   	leave
+  800154:	c3                   	ret
+
+0000000000800155 <libmain>:
+
+/**
+ *  用户环境从lib/libmain.c中的函数libmain开始执行，这个函数进而调用umain，用户写的程序入口只能是umain
+ */
+void libmain(int argc, char **argv)
+{
+  800155:	55                   	push   %rbp
+  800156:	48 89 e5             	mov    %rsp,%rbp
+  800159:	48 83 ec 10          	sub    $0x10,%rsp
+  80015d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800160:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 设置常量 thisproc 指向 procs[] 中当前环境的 Env 结构，ENVX 确保环境 id 未超过了 NENV
+	// thisproc 指向当前环境的 Env 结构
+	thisproc = &procs[ENVX(sys_getprocid())];
+  800164:	48 b8 86 1b 80 00 00 	movabs $0x801b86,%rax
+  80016b:	00 00 00 
+  80016e:	ff d0                	call   *%rax
+  800170:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800175:	48 98                	cltq
+  800177:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  80017e:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  800185:	00 00 00 
+  800188:	48 01 c2             	add    %rax,%rdx
+  80018b:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  800192:	00 00 00 
+  800195:	48 89 10             	mov    %rdx,(%rax)
+
+	// 通过 CPUID 选择 memset/memmove/memcpy 的实现
+	mem_init();
+  800198:	48 b8 2e 12 80 00 00 	movabs $0x80122e,%rax
+  80019f:	00 00 00 
+  8001a2:	ff d0                	call   *%rax
+
+	// 为了能让panic()提示用户错误，存储程序的名称
+	if (argc > 0)
+  8001a4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8001a8:	7e 14                	jle    8001be <libmain+0x69>
+		binaryname = argv[0];
+  8001aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001ae:	48 8b 00             	mov    (%rax),%rax
+  8001b1:	48 ba 00 40 80 00 00 	movabs $0x804000,%rdx
+  8001b8:	00 00 00 
+  8001bb:	48 89 02             	mov    %rax,(%rdx)
+
+	// 调用用户的主程序
+	umain(argc, argv);
+  8001be:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001c2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8001c5:	48 89 d6             	mov    %rdx,%rsi
+  8001c8:	89 c7                	mov    %eax,%edi
+  8001ca:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  8001d1:	00 00 00 
+  8001d4:	ff d0                	call   *%rax
+
+	// 退出当前环境，env_destroy
+	sys_env_destroy(0);
+  8001d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001db:	48 b8 40 1b 80 00 00 	movabs $0x801b40,%rax
+  8001e2:	00 00 00 
+  8001e5:	ff d0                	call   *%rax
+}
+  8001e7:	90                   	nop
+  8001e8:	c9                   	leave
+  8001e9:	c3                   	ret
+
+00000000008001ea <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001ea:	55                   	push   %rbp
+  8001eb:	48 89 e5             	mov    %rsp,%rbp
+  8001ee:	48 83 ec 10          	sub    $0x10,%rsp
+  8001f2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8001f5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->buf[b->idx++] = ch;
+  8001f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001fd:	8b 00                	mov    (%rax),%eax
+  8001ff:	8d 48 01             	lea    0x1(%rax),%ecx
+  800202:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800206:	89 0a                	mov    %ecx,(%rdx)
+  800208:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80020b:	89 d1                	mov    %edx,%ecx
+  80020d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800211:	48 98                	cltq
+  800213:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+	if (b->idx == 256-1) {
+  800217:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80021b:	8b 00                	mov    (%rax),%eax
+  80021d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800222:	75 2c                	jne    800250 <putch+0x66>
+		sys_cputs(b->buf, b->idx);
+  800224:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800228:	8b 00                	mov    (%rax),%eax
+  80022a:	48 98                	cltq
+  80022c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800230:	48 83 c2 08          	add    $0x8,%rdx
+  800234:	48 89 c6             	mov    %rax,%rsi
+  800237:	48 89 d7             	mov    %rdx,%rdi
+  80023a:	48 b8 b7 1a 80 00 00 	movabs $0x801ab7,%rax
+  800241:	00 00 00 
+  800244:	ff d0                	call   *%rax
+		b->idx = 0;
+  800246:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80024a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	}
+	b->cnt++;
+  800250:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800254:	8b 40 04             	mov    0x4(%rax),%eax
+  800257:	8d 50 01             	lea    0x1(%rax),%edx
+  80025a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80025e:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800261:	90                   	nop
+  800262:	c9                   	leave
+  800263:	c3                   	ret
+
+0000000000800264 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800264:	55                   	push   %rbp
+  800265:	48 89 e5             	mov    %rsp,%rbp
+  800268:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80026f:	48 89 bd c8 fe ff ff 	mov    %rdi,-0x138(%rbp)
+  800276:	48 89 b5 c0 fe ff ff 	mov    %rsi,-0x140(%rbp)
+	struct printbuf b;
+	va_list aq;
+	va_copy(aq,ap);
+  80027d:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  800284:	48 8b b5 c0 fe ff ff 	mov    -0x140(%rbp),%rsi
+  80028b:	48 8b 06             	mov    (%rsi),%rax
+  80028e:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800292:	48 89 01             	mov    %rax,(%rcx)
+  800295:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800299:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80029d:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	b.idx = 0;
+  8002a1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8002a8:	00 00 00 
+	b.cnt = 0;
+  8002ab:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8002b2:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, aq);
+  8002b5:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  8002bc:	48 8b 95 c8 fe ff ff 	mov    -0x138(%rbp),%rdx
+  8002c3:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8002ca:	48 89 c6             	mov    %rax,%rsi
+  8002cd:	48 b8 ea 01 80 00 00 	movabs $0x8001ea,%rax
+  8002d4:	00 00 00 
+  8002d7:	48 89 c7             	mov    %rax,%rdi
+  8002da:	48 b8 b1 06 80 00 00 	movabs $0x8006b1,%rax
+  8002e1:	00 00 00 
+  8002e4:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  8002e6:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8002ec:	48 98                	cltq
+  8002ee:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8002f5:	48 83 c2 08          	add    $0x8,%rdx
+  8002f9:	48 89 c6             	mov    %rax,%rsi
+  8002fc:	48 89 d7             	mov    %rdx,%rdi
+  8002ff:	48 b8 b7 1a 80 00 00 	movabs $0x801ab7,%rax
+  800306:	00 00 00 
+  800309:	ff d0                	call   *%rax
+	va_end(aq);
+
+	return b.cnt;
+  80030b:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  800311:	c9                   	leave
+  800312:	c3                   	ret
+
+0000000000800313 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800313:	55                   	push   %rbp
+  800314:	48 89 e5             	mov    %rsp,%rbp
+  800317:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  80031e:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800325:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80032c:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800333:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80033a:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800341:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800348:	84 c0                	test   %al,%al
+  80034a:	74 20                	je     80036c <cprintf+0x59>
+  80034c:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800350:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800354:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800358:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80035c:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800360:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800364:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800368:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+	va_list aq;
+	va_start(ap, fmt);
+  80036c:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800373:	00 00 00 
+  800376:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80037d:	00 00 00 
+  800380:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800384:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80038b:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800392:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  800399:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8003a0:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8003a7:	48 8b 06             	mov    (%rsi),%rax
+  8003aa:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8003ae:	48 89 01             	mov    %rax,(%rcx)
+  8003b1:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8003b5:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8003b9:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	cnt = vcprintf(fmt, aq);
+  8003bd:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8003c4:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8003cb:	48 89 d6             	mov    %rdx,%rsi
+  8003ce:	48 89 c7             	mov    %rax,%rdi
+  8003d1:	48 b8 64 02 80 00 00 	movabs $0x800264,%rax
+  8003d8:	00 00 00 
+  8003db:	ff d0                	call   *%rax
+  8003dd:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return cnt;
+  8003e3:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8003e9:	c9                   	leave
+  8003ea:	c3                   	ret
+
+00000000008003eb <printnum>:
+ * num: 需要打印出来的整型数，base: 整型数的进制，其他参数同 vprintfmt
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+		 unsigned long long num, unsigned base, int width, int padc)
+{
+  8003eb:	55                   	push   %rbp
+  8003ec:	48 89 e5             	mov    %rsp,%rbp
+  8003ef:	48 83 ec 30          	sub    $0x30,%rsp
+  8003f3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8003f7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8003fb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8003ff:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  800402:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  800406:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+	// 当 num 超过一位数，首先递归函数自身打印所有高位的(更重要的)数字
+	if (num >= base)
+  80040a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80040d:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  800411:	72 54                	jb     800467 <printnum+0x7c>
+	{
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800413:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800416:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800419:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  80041c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800420:	ba 00 00 00 00       	mov    $0x0,%edx
+  800425:	48 f7 f6             	div    %rsi
+  800428:	49 89 c2             	mov    %rax,%r10
+  80042b:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80042e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800431:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800435:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800439:	41 89 c9             	mov    %ecx,%r9d
+  80043c:	41 89 f8             	mov    %edi,%r8d
+  80043f:	89 d1                	mov    %edx,%ecx
+  800441:	4c 89 d2             	mov    %r10,%rdx
+  800444:	48 89 c7             	mov    %rax,%rdi
+  800447:	48 b8 eb 03 80 00 00 	movabs $0x8003eb,%rax
+  80044e:	00 00 00 
+  800451:	ff d0                	call   *%rax
+  800453:	eb 1c                	jmp    800471 <printnum+0x86>
+	}
+	else
+	{
+		// 按照右对齐的格式在左侧补齐填充字符 padc
+		while (--width > 0)
+			putch(padc, putdat);
+  800455:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800459:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80045c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800460:	48 89 d6             	mov    %rdx,%rsi
+  800463:	89 c7                	mov    %eax,%edi
+  800465:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800467:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  80046b:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80046f:	7f e4                	jg     800455 <printnum+0x6a>
+	}
+
+	// 然后打印个位数字
+	putch("0123456789abcdef"[num % base], putdat);
+  800471:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800474:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800478:	ba 00 00 00 00       	mov    $0x0,%edx
+  80047d:	48 f7 f1             	div    %rcx
+  800480:	48 b8 f0 2d 80 00 00 	movabs $0x802df0,%rax
+  800487:	00 00 00 
+  80048a:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  80048e:	0f be c0             	movsbl %al,%eax
+  800491:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800495:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800499:	48 89 d6             	mov    %rdx,%rsi
+  80049c:	89 c7                	mov    %eax,%edi
+  80049e:	ff d1                	call   *%rcx
+}
+  8004a0:	90                   	nop
+  8004a1:	c9                   	leave
+  8004a2:	c3                   	ret
+
+00000000008004a3 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  8004a3:	55                   	push   %rbp
+  8004a4:	48 89 e5             	mov    %rsp,%rbp
+  8004a7:	48 83 ec 20          	sub    $0x20,%rsp
+  8004ab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8004af:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;
+	if (lflag >= 2)
+  8004b2:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8004b6:	7e 4f                	jle    800507 <getuint+0x64>
+		x = va_arg(*ap, unsigned long long);
+  8004b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004bc:	8b 00                	mov    (%rax),%eax
+  8004be:	83 f8 2f             	cmp    $0x2f,%eax
+  8004c1:	77 24                	ja     8004e7 <getuint+0x44>
+  8004c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004c7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004cf:	8b 00                	mov    (%rax),%eax
+  8004d1:	89 c0                	mov    %eax,%eax
+  8004d3:	48 01 d0             	add    %rdx,%rax
+  8004d6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8004da:	8b 12                	mov    (%rdx),%edx
+  8004dc:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8004df:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8004e3:	89 0a                	mov    %ecx,(%rdx)
+  8004e5:	eb 14                	jmp    8004fb <getuint+0x58>
+  8004e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004eb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8004ef:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8004f3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8004f7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8004fb:	48 8b 00             	mov    (%rax),%rax
+  8004fe:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800502:	e9 9d 00 00 00       	jmp    8005a4 <getuint+0x101>
+	else if (lflag)
+  800507:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80050b:	74 4c                	je     800559 <getuint+0xb6>
+		x = va_arg(*ap, unsigned long);
+  80050d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800511:	8b 00                	mov    (%rax),%eax
+  800513:	83 f8 2f             	cmp    $0x2f,%eax
+  800516:	77 24                	ja     80053c <getuint+0x99>
+  800518:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80051c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800520:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800524:	8b 00                	mov    (%rax),%eax
+  800526:	89 c0                	mov    %eax,%eax
+  800528:	48 01 d0             	add    %rdx,%rax
+  80052b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80052f:	8b 12                	mov    (%rdx),%edx
+  800531:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800534:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800538:	89 0a                	mov    %ecx,(%rdx)
+  80053a:	eb 14                	jmp    800550 <getuint+0xad>
+  80053c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800540:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800544:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800548:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80054c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800550:	48 8b 00             	mov    (%rax),%rax
+  800553:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800557:	eb 4b                	jmp    8005a4 <getuint+0x101>
+	else
+		x = va_arg(*ap, unsigned int);
+  800559:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80055d:	8b 00                	mov    (%rax),%eax
+  80055f:	83 f8 2f             	cmp    $0x2f,%eax
+  800562:	77 24                	ja     800588 <getuint+0xe5>
+  800564:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800568:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80056c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800570:	8b 00                	mov    (%rax),%eax
+  800572:	89 c0                	mov    %eax,%eax
+  800574:	48 01 d0             	add    %rdx,%rax
+  800577:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80057b:	8b 12                	mov    (%rdx),%edx
+  80057d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800580:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800584:	89 0a                	mov    %ecx,(%rdx)
+  800586:	eb 14                	jmp    80059c <getuint+0xf9>
+  800588:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80058c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800590:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800594:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800598:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80059c:	8b 00                	mov    (%rax),%eax
+  80059e:	89 c0                	mov    %eax,%eax
+  8005a0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8005a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+  8005ae:	48 83 ec 20          	sub    $0x20,%rsp
+  8005b2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8005b6:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  8005b9:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8005bd:	7e 4f                	jle    80060e <getint+0x64>
+		x = va_arg(*ap, long long);
+  8005bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005c3:	8b 00                	mov    (%rax),%eax
+  8005c5:	83 f8 2f             	cmp    $0x2f,%eax
+  8005c8:	77 24                	ja     8005ee <getint+0x44>
+  8005ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005ce:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005d6:	8b 00                	mov    (%rax),%eax
+  8005d8:	89 c0                	mov    %eax,%eax
+  8005da:	48 01 d0             	add    %rdx,%rax
+  8005dd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005e1:	8b 12                	mov    (%rdx),%edx
+  8005e3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005e6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005ea:	89 0a                	mov    %ecx,(%rdx)
+  8005ec:	eb 14                	jmp    800602 <getint+0x58>
+  8005ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005f2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005f6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005fa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005fe:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800602:	48 8b 00             	mov    (%rax),%rax
+  800605:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800609:	e9 9d 00 00 00       	jmp    8006ab <getint+0x101>
+	else if (lflag)
+  80060e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800612:	74 4c                	je     800660 <getint+0xb6>
+		x = va_arg(*ap, long);
+  800614:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800618:	8b 00                	mov    (%rax),%eax
+  80061a:	83 f8 2f             	cmp    $0x2f,%eax
+  80061d:	77 24                	ja     800643 <getint+0x99>
+  80061f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800623:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800627:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80062b:	8b 00                	mov    (%rax),%eax
+  80062d:	89 c0                	mov    %eax,%eax
+  80062f:	48 01 d0             	add    %rdx,%rax
+  800632:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800636:	8b 12                	mov    (%rdx),%edx
+  800638:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80063b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80063f:	89 0a                	mov    %ecx,(%rdx)
+  800641:	eb 14                	jmp    800657 <getint+0xad>
+  800643:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800647:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80064b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80064f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800653:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800657:	48 8b 00             	mov    (%rax),%rax
+  80065a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80065e:	eb 4b                	jmp    8006ab <getint+0x101>
+	else
+		x = va_arg(*ap, int);
+  800660:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800664:	8b 00                	mov    (%rax),%eax
+  800666:	83 f8 2f             	cmp    $0x2f,%eax
+  800669:	77 24                	ja     80068f <getint+0xe5>
+  80066b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80066f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800673:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800677:	8b 00                	mov    (%rax),%eax
+  800679:	89 c0                	mov    %eax,%eax
+  80067b:	48 01 d0             	add    %rdx,%rax
+  80067e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800682:	8b 12                	mov    (%rdx),%edx
+  800684:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800687:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80068b:	89 0a                	mov    %ecx,(%rdx)
+  80068d:	eb 14                	jmp    8006a3 <getint+0xf9>
+  80068f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800693:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800697:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80069b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80069f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006a3:	8b 00                	mov    (%rax),%eax
+  8006a5:	48 98                	cltq
+  8006a7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8006ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8006af:	c9                   	leave
+  8006b0:	c3                   	ret
+
+00000000008006b1 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap)
+{
+  8006b1:	55                   	push   %rbp
+  8006b2:	48 89 e5             	mov    %rsp,%rbp
+  8006b5:	41 54                	push   %r12
+  8006b7:	53                   	push   %rbx
+  8006b8:	48 83 ec 60          	sub    $0x60,%rsp
+  8006bc:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8006c0:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8006c4:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8006c8:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+	int base, lflag, width, precision, altflag;
+
+	// 填充字符，在显示字符串的'%'后读到'-'或'0'时，赋值到 padc
+	char padc;
+	va_list aq;
+	va_copy(aq, ap);
+  8006cc:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006d0:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8006d4:	48 8b 06             	mov    (%rsi),%rax
+  8006d7:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8006db:	48 89 01             	mov    %rax,(%rcx)
+  8006de:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8006e2:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8006e6:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1)
+	{
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  8006ea:	eb 17                	jmp    800703 <vprintfmt+0x52>
+		{
+			if (ch == '\0')
+  8006ec:	85 db                	test   %ebx,%ebx
+  8006ee:	0f 84 b9 04 00 00    	je     800bad <vprintfmt+0x4fc>
+				return;
+			putch(ch, putdat);
+  8006f4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006f8:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8006fc:	48 89 c6             	mov    %rax,%rsi
+  8006ff:	89 df                	mov    %ebx,%edi
+  800701:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800703:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800707:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80070b:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80070f:	0f b6 00             	movzbl (%rax),%eax
+  800712:	0f b6 d8             	movzbl %al,%ebx
+  800715:	83 fb 25             	cmp    $0x25,%ebx
+  800718:	75 d2                	jne    8006ec <vprintfmt+0x3b>
+		}
+
+		// 处理 % 转义序列
+		// padc 初始化为空格符，padc='-'代表字符串左对齐，右边补空格，padc=' '代表右对齐，左边补空格，padc='0'右对齐，左边补0
+		padc = ' ';
+  80071a:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+		width = -1;
+  80071e:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+		// 默认-1代表显示长度为字符串本来的长度
+		precision = -1;
+  800725:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+		lflag = 0;
+  80072c:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+		altflag = 0;
+  800733:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *)fmt++)
+  80073a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80073e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800742:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800746:	0f b6 00             	movzbl (%rax),%eax
+  800749:	0f b6 d8             	movzbl %al,%ebx
+  80074c:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  80074f:	83 f8 55             	cmp    $0x55,%eax
+  800752:	0f 87 22 04 00 00    	ja     800b7a <vprintfmt+0x4c9>
+  800758:	89 c0                	mov    %eax,%eax
+  80075a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800761:	00 
+  800762:	48 b8 18 2e 80 00 00 	movabs $0x802e18,%rax
+  800769:	00 00 00 
+  80076c:	48 01 d0             	add    %rdx,%rax
+  80076f:	48 8b 00             	mov    (%rax),%rax
+  800772:	ff e0                	jmp    *%rax
+		{
+
+		// flag to pad on the right
+		case '-':
+			padc = '-';
+  800774:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+			goto reswitch;
+  800778:	eb c0                	jmp    80073a <vprintfmt+0x89>
+
+		// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  80077a:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+			goto reswitch;
+  80077e:	eb ba                	jmp    80073a <vprintfmt+0x89>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0;; ++fmt)
+  800780:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+			{
+				precision = precision * 10 + ch - '0';
+  800787:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80078a:	89 d0                	mov    %edx,%eax
+  80078c:	c1 e0 02             	shl    $0x2,%eax
+  80078f:	01 d0                	add    %edx,%eax
+  800791:	01 c0                	add    %eax,%eax
+  800793:	01 d8                	add    %ebx,%eax
+  800795:	83 e8 30             	sub    $0x30,%eax
+  800798:	89 45 d8             	mov    %eax,-0x28(%rbp)
+				ch = *fmt;
+  80079b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80079f:	0f b6 00             	movzbl (%rax),%eax
+  8007a2:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  8007a5:	83 fb 2f             	cmp    $0x2f,%ebx
+  8007a8:	7e 60                	jle    80080a <vprintfmt+0x159>
+  8007aa:	83 fb 39             	cmp    $0x39,%ebx
+  8007ad:	7f 5b                	jg     80080a <vprintfmt+0x159>
+			for (precision = 0;; ++fmt)
+  8007af:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+				precision = precision * 10 + ch - '0';
+  8007b4:	eb d1                	jmp    800787 <vprintfmt+0xd6>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  8007b6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b9:	83 f8 2f             	cmp    $0x2f,%eax
+  8007bc:	77 17                	ja     8007d5 <vprintfmt+0x124>
+  8007be:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007c2:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007c5:	89 d2                	mov    %edx,%edx
+  8007c7:	48 01 d0             	add    %rdx,%rax
+  8007ca:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007cd:	83 c2 08             	add    $0x8,%edx
+  8007d0:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8007d3:	eb 0c                	jmp    8007e1 <vprintfmt+0x130>
+  8007d5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8007d9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8007dd:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8007e1:	8b 00                	mov    (%rax),%eax
+  8007e3:	89 45 d8             	mov    %eax,-0x28(%rbp)
+			goto process_precision;
+  8007e6:	eb 23                	jmp    80080b <vprintfmt+0x15a>
+
+		case '.':
+			if (width < 0)
+  8007e8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8007ec:	0f 89 48 ff ff ff    	jns    80073a <vprintfmt+0x89>
+				width = 0;
+  8007f2:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+			goto reswitch;
+  8007f9:	e9 3c ff ff ff       	jmp    80073a <vprintfmt+0x89>
+
+		case '#':
+			altflag = 1;
+  8007fe:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+			goto reswitch;
+  800805:	e9 30 ff ff ff       	jmp    80073a <vprintfmt+0x89>
+			goto process_precision;
+  80080a:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  80080b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80080f:	0f 89 25 ff ff ff    	jns    80073a <vprintfmt+0x89>
+				width = precision, precision = -1;
+  800815:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800818:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80081b:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+			goto reswitch;
+  800822:	e9 13 ff ff ff       	jmp    80073a <vprintfmt+0x89>
+
+		// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800827:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+			goto reswitch;
+  80082b:	e9 0a ff ff ff       	jmp    80073a <vprintfmt+0x89>
+
+		// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800830:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800833:	83 f8 2f             	cmp    $0x2f,%eax
+  800836:	77 17                	ja     80084f <vprintfmt+0x19e>
+  800838:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80083c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80083f:	89 d2                	mov    %edx,%edx
+  800841:	48 01 d0             	add    %rdx,%rax
+  800844:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800847:	83 c2 08             	add    $0x8,%edx
+  80084a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80084d:	eb 0c                	jmp    80085b <vprintfmt+0x1aa>
+  80084f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800853:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800857:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80085b:	8b 00                	mov    (%rax),%eax
+  80085d:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800861:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800865:	48 89 d6             	mov    %rdx,%rsi
+  800868:	89 c7                	mov    %eax,%edi
+  80086a:	ff d1                	call   *%rcx
+			break;
+  80086c:	e9 37 03 00 00       	jmp    800ba8 <vprintfmt+0x4f7>
+
+		// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800871:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800874:	83 f8 2f             	cmp    $0x2f,%eax
+  800877:	77 17                	ja     800890 <vprintfmt+0x1df>
+  800879:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80087d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800880:	89 d2                	mov    %edx,%edx
+  800882:	48 01 d0             	add    %rdx,%rax
+  800885:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800888:	83 c2 08             	add    $0x8,%edx
+  80088b:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80088e:	eb 0c                	jmp    80089c <vprintfmt+0x1eb>
+  800890:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800894:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800898:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80089c:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  80089e:	85 db                	test   %ebx,%ebx
+  8008a0:	79 02                	jns    8008a4 <vprintfmt+0x1f3>
+				err = -err;
+  8008a2:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8008a4:	83 fb 11             	cmp    $0x11,%ebx
+  8008a7:	7f 16                	jg     8008bf <vprintfmt+0x20e>
+  8008a9:	48 ba 60 2d 80 00 00 	movabs $0x802d60,%rdx
+  8008b0:	00 00 00 
+  8008b3:	48 63 c3             	movslq %ebx,%rax
+  8008b6:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  8008ba:	4d 85 e4             	test   %r12,%r12
+  8008bd:	75 2e                	jne    8008ed <vprintfmt+0x23c>
+				printfmt(putch, putdat, "error %d", err);
+  8008bf:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8008c3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8008c7:	89 d9                	mov    %ebx,%ecx
+  8008c9:	48 ba 01 2e 80 00 00 	movabs $0x802e01,%rdx
+  8008d0:	00 00 00 
+  8008d3:	48 89 c7             	mov    %rax,%rdi
+  8008d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008db:	49 b8 b7 0b 80 00 00 	movabs $0x800bb7,%r8
+  8008e2:	00 00 00 
+  8008e5:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  8008e8:	e9 bb 02 00 00       	jmp    800ba8 <vprintfmt+0x4f7>
+				printfmt(putch, putdat, "%s", p);
+  8008ed:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8008f1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8008f5:	4c 89 e1             	mov    %r12,%rcx
+  8008f8:	48 ba 0a 2e 80 00 00 	movabs $0x802e0a,%rdx
+  8008ff:	00 00 00 
+  800902:	48 89 c7             	mov    %rax,%rdi
+  800905:	b8 00 00 00 00       	mov    $0x0,%eax
+  80090a:	49 b8 b7 0b 80 00 00 	movabs $0x800bb7,%r8
+  800911:	00 00 00 
+  800914:	41 ff d0             	call   *%r8
+			break;
+  800917:	e9 8c 02 00 00       	jmp    800ba8 <vprintfmt+0x4f7>
+
+		// string
+		case 's':
+			// 从可变参数中读入字符串指针
+			if ((p = va_arg(aq, char *)) == NULL)
+  80091c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80091f:	83 f8 2f             	cmp    $0x2f,%eax
+  800922:	77 17                	ja     80093b <vprintfmt+0x28a>
+  800924:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800928:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80092b:	89 d2                	mov    %edx,%edx
+  80092d:	48 01 d0             	add    %rdx,%rax
+  800930:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800933:	83 c2 08             	add    $0x8,%edx
+  800936:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800939:	eb 0c                	jmp    800947 <vprintfmt+0x296>
+  80093b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80093f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800943:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800947:	4c 8b 20             	mov    (%rax),%r12
+  80094a:	4d 85 e4             	test   %r12,%r12
+  80094d:	75 0a                	jne    800959 <vprintfmt+0x2a8>
+				p = "(null)"; // 当字符串为空时，将它指向"(null)"字符串
+  80094f:	49 bc 0d 2e 80 00 00 	movabs $0x802e0d,%r12
+  800956:	00 00 00 
+			// 判断左对齐还是右对齐，pad='-'左对齐，否则右对齐
+			if (width > 0 && padc != '-')
+  800959:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80095d:	7e 78                	jle    8009d7 <vprintfmt+0x326>
+  80095f:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800963:	74 72                	je     8009d7 <vprintfmt+0x326>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800965:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800968:	48 98                	cltq
+  80096a:	48 89 c6             	mov    %rax,%rsi
+  80096d:	4c 89 e7             	mov    %r12,%rdi
+  800970:	48 b8 5c 0f 80 00 00 	movabs $0x800f5c,%rax
+  800977:	00 00 00 
+  80097a:	ff d0                	call   *%rax
+  80097c:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  80097f:	eb 17                	jmp    800998 <vprintfmt+0x2e7>
+					putch(padc, putdat); // 字符串右对齐，左边补相应数量(width-实际长度)的空格或者 0
+  800981:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800985:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800989:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80098d:	48 89 d6             	mov    %rdx,%rsi
+  800990:	89 c7                	mov    %eax,%edi
+  800992:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800994:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800998:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80099c:	7f e3                	jg     800981 <vprintfmt+0x2d0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80099e:	eb 37                	jmp    8009d7 <vprintfmt+0x326>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8009a0:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8009a4:	74 1e                	je     8009c4 <vprintfmt+0x313>
+  8009a6:	83 fb 1f             	cmp    $0x1f,%ebx
+  8009a9:	7e 05                	jle    8009b0 <vprintfmt+0x2ff>
+  8009ab:	83 fb 7e             	cmp    $0x7e,%ebx
+  8009ae:	7e 14                	jle    8009c4 <vprintfmt+0x313>
+					putch('?', putdat);
+  8009b0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009b4:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009b8:	48 89 c6             	mov    %rax,%rsi
+  8009bb:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8009c0:	ff d2                	call   *%rdx
+  8009c2:	eb 0f                	jmp    8009d3 <vprintfmt+0x322>
+				else
+					putch(ch, putdat); // 打印相应长度的字符串
+  8009c4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009c8:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009cc:	48 89 c6             	mov    %rax,%rsi
+  8009cf:	89 df                	mov    %ebx,%edi
+  8009d1:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8009d3:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8009d7:	4c 89 e0             	mov    %r12,%rax
+  8009da:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009de:	0f b6 00             	movzbl (%rax),%eax
+  8009e1:	0f be d8             	movsbl %al,%ebx
+  8009e4:	85 db                	test   %ebx,%ebx
+  8009e6:	74 28                	je     800a10 <vprintfmt+0x35f>
+  8009e8:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8009ec:	78 b2                	js     8009a0 <vprintfmt+0x2ef>
+  8009ee:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8009f2:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8009f6:	79 a8                	jns    8009a0 <vprintfmt+0x2ef>
+			for (; width > 0; width--)
+  8009f8:	eb 16                	jmp    800a10 <vprintfmt+0x35f>
+				putch(' ', putdat); // 当字符串是左对齐的时候打印相应数量的空格
+  8009fa:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009fe:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a02:	48 89 c6             	mov    %rax,%rsi
+  800a05:	bf 20 00 00 00       	mov    $0x20,%edi
+  800a0a:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800a0c:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800a10:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a14:	7f e4                	jg     8009fa <vprintfmt+0x349>
+			break;
+  800a16:	e9 8d 01 00 00       	jmp    800ba8 <vprintfmt+0x4f7>
+
+		// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800a1b:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a1f:	be 03 00 00 00       	mov    $0x3,%esi
+  800a24:	48 89 c7             	mov    %rax,%rdi
+  800a27:	48 b8 aa 05 80 00 00 	movabs $0x8005aa,%rax
+  800a2e:	00 00 00 
+  800a31:	ff d0                	call   *%rax
+  800a33:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((long long)num < 0)
+  800a37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a3b:	48 85 c0             	test   %rax,%rax
+  800a3e:	79 1d                	jns    800a5d <vprintfmt+0x3ac>
+			{
+				putch('-', putdat);
+  800a40:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a44:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a48:	48 89 c6             	mov    %rax,%rsi
+  800a4b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a50:	ff d2                	call   *%rdx
+				num = -(long long)num;
+  800a52:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a56:	48 f7 d8             	neg    %rax
+  800a59:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			}
+			base = 10;
+  800a5d:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800a64:	e9 d2 00 00 00       	jmp    800b3b <vprintfmt+0x48a>
+
+		// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800a69:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a6d:	be 03 00 00 00       	mov    $0x3,%esi
+  800a72:	48 89 c7             	mov    %rax,%rdi
+  800a75:	48 b8 a3 04 80 00 00 	movabs $0x8004a3,%rax
+  800a7c:	00 00 00 
+  800a7f:	ff d0                	call   *%rax
+  800a81:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 10;
+  800a85:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800a8c:	e9 aa 00 00 00       	jmp    800b3b <vprintfmt+0x48a>
+		// (unsigned) octal
+		case 'o':
+			// Gets the variable argument with type integer from the point which was processed last by va_arg
+			// calls getuint which returns a long long value, which then calls printnum which prints based on
+			// base value.
+			num = getuint(&aq, 3);
+  800a91:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a95:	be 03 00 00 00       	mov    $0x3,%esi
+  800a9a:	48 89 c7             	mov    %rax,%rdi
+  800a9d:	48 b8 a3 04 80 00 00 	movabs $0x8004a3,%rax
+  800aa4:	00 00 00 
+  800aa7:	ff d0                	call   *%rax
+  800aa9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 8;
+  800aad:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+			goto number;
+  800ab4:	e9 82 00 00 00       	jmp    800b3b <vprintfmt+0x48a>
+
+		// pointer
+		case 'p':
+			putch('0', putdat);
+  800ab9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800abd:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ac1:	48 89 c6             	mov    %rax,%rsi
+  800ac4:	bf 30 00 00 00       	mov    $0x30,%edi
+  800ac9:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800acb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800acf:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ad3:	48 89 c6             	mov    %rax,%rsi
+  800ad6:	bf 78 00 00 00       	mov    $0x78,%edi
+  800adb:	ff d2                	call   *%rdx
+			num = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800add:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae3:	77 17                	ja     800afc <vprintfmt+0x44b>
+  800ae5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ae9:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800aec:	89 d2                	mov    %edx,%edx
+  800aee:	48 01 d0             	add    %rdx,%rax
+  800af1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800af4:	83 c2 08             	add    $0x8,%edx
+  800af7:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800afa:	eb 0c                	jmp    800b08 <vprintfmt+0x457>
+  800afc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b00:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b04:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b08:	48 8b 00             	mov    (%rax),%rax
+  800b0b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800b0f:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+			goto number;
+  800b16:	eb 23                	jmp    800b3b <vprintfmt+0x48a>
+
+		// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800b18:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b1c:	be 03 00 00 00       	mov    $0x3,%esi
+  800b21:	48 89 c7             	mov    %rax,%rdi
+  800b24:	48 b8 a3 04 80 00 00 	movabs $0x8004a3,%rax
+  800b2b:	00 00 00 
+  800b2e:	ff d0                	call   *%rax
+  800b30:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800b34:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800b3b:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800b40:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800b43:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800b46:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b4a:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800b4e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b52:	45 89 c1             	mov    %r8d,%r9d
+  800b55:	41 89 f8             	mov    %edi,%r8d
+  800b58:	48 89 c7             	mov    %rax,%rdi
+  800b5b:	48 b8 eb 03 80 00 00 	movabs $0x8003eb,%rax
+  800b62:	00 00 00 
+  800b65:	ff d0                	call   *%rax
+			break;
+  800b67:	eb 3f                	jmp    800ba8 <vprintfmt+0x4f7>
+
+		// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800b69:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b6d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b71:	48 89 c6             	mov    %rax,%rsi
+  800b74:	89 df                	mov    %ebx,%edi
+  800b76:	ff d2                	call   *%rdx
+			break;
+  800b78:	eb 2e                	jmp    800ba8 <vprintfmt+0x4f7>
+
+		// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800b7a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b7e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b82:	48 89 c6             	mov    %rax,%rsi
+  800b85:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b8a:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b8c:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800b91:	eb 05                	jmp    800b98 <vprintfmt+0x4e7>
+  800b93:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800b98:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800b9c:	48 83 e8 01          	sub    $0x1,%rax
+  800ba0:	0f b6 00             	movzbl (%rax),%eax
+  800ba3:	3c 25                	cmp    $0x25,%al
+  800ba5:	75 ec                	jne    800b93 <vprintfmt+0x4e2>
+				/* do nothing */;
+			break;
+  800ba7:	90                   	nop
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800ba8:	e9 56 fb ff ff       	jmp    800703 <vprintfmt+0x52>
+				return;
+  800bad:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800bae:	48 83 c4 60          	add    $0x60,%rsp
+  800bb2:	5b                   	pop    %rbx
+  800bb3:	41 5c                	pop    %r12
+  800bb5:	5d                   	pop    %rbp
+  800bb6:	c3                   	ret
+
+0000000000800bb7 <printfmt>:
+
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...)
+{
+  800bb7:	55                   	push   %rbp
+  800bb8:	48 89 e5             	mov    %rsp,%rbp
+  800bbb:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800bc2:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800bc9:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800bd0:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800bd7:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800bde:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800be5:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800bec:	84 c0                	test   %al,%al
+  800bee:	74 20                	je     800c10 <printfmt+0x59>
+  800bf0:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800bf4:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800bf8:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800bfc:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800c00:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800c04:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800c08:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800c0c:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800c10:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800c17:	00 00 00 
+  800c1a:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800c21:	00 00 00 
+  800c24:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c28:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800c2f:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800c36:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800c3d:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800c44:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800c4b:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800c52:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800c59:	48 89 c7             	mov    %rax,%rdi
+  800c5c:	48 b8 b1 06 80 00 00 	movabs $0x8006b1,%rax
+  800c63:	00 00 00 
+  800c66:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  800c68:	90                   	nop
+  800c69:	c9                   	leave
+  800c6a:	c3                   	ret
+
+0000000000800c6b <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800c6b:	55                   	push   %rbp
+  800c6c:	48 89 e5             	mov    %rsp,%rbp
+  800c6f:	48 83 ec 10          	sub    $0x10,%rsp
+  800c73:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800c76:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  800c7a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c7e:	8b 40 10             	mov    0x10(%rax),%eax
+  800c81:	8d 50 01             	lea    0x1(%rax),%edx
+  800c84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c88:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  800c8b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c8f:	48 8b 10             	mov    (%rax),%rdx
+  800c92:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c96:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c9a:	48 39 c2             	cmp    %rax,%rdx
+  800c9d:	73 17                	jae    800cb6 <sprintputch+0x4b>
+		*b->buf++ = ch;
+  800c9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ca3:	48 8b 00             	mov    (%rax),%rax
+  800ca6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800caa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800cae:	48 89 0a             	mov    %rcx,(%rdx)
+  800cb1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800cb4:	88 10                	mov    %dl,(%rax)
+}
+  800cb6:	90                   	nop
+  800cb7:	c9                   	leave
+  800cb8:	c3                   	ret
+
+0000000000800cb9 <vsnprintf>:
+
+int vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800cb9:	55                   	push   %rbp
+  800cba:	48 89 e5             	mov    %rsp,%rbp
+  800cbd:	48 83 ec 50          	sub    $0x50,%rsp
+  800cc1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  800cc5:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  800cc8:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  800ccc:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+	va_list aq;
+	va_copy(aq, ap);
+  800cd0:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800cd4:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800cd8:	48 8b 06             	mov    (%rsi),%rax
+  800cdb:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800cdf:	48 89 01             	mov    %rax,(%rcx)
+  800ce2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800ce6:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800cea:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	struct sprintbuf b = {buf, buf + n - 1, 0};
+  800cee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800cf2:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800cf6:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  800cf9:	48 98                	cltq
+  800cfb:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800cff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d03:	48 01 d0             	add    %rdx,%rax
+  800d06:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  800d0a:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+
+	if (buf == NULL || n < 1)
+  800d11:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800d16:	74 06                	je     800d1e <vsnprintf+0x65>
+  800d18:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800d1c:	7f 07                	jg     800d25 <vsnprintf+0x6c>
+		return -E_INVAL;
+  800d1e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d23:	eb 32                	jmp    800d57 <vsnprintf+0x9e>
+
+	// print the string to the buffer
+	vprintfmt((void *)sprintputch, &b, fmt, aq);
+  800d25:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800d29:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  800d2d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d31:	48 89 c6             	mov    %rax,%rsi
+  800d34:	48 b8 6b 0c 80 00 00 	movabs $0x800c6b,%rax
+  800d3b:	00 00 00 
+  800d3e:	48 89 c7             	mov    %rax,%rdi
+  800d41:	48 b8 b1 06 80 00 00 	movabs $0x8006b1,%rax
+  800d48:	00 00 00 
+  800d4b:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  800d4d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d51:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800d54:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  800d57:	c9                   	leave
+  800d58:	c3                   	ret
+
+0000000000800d59 <snprintf>:
+
+int snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800d59:	55                   	push   %rbp
+  800d5a:	48 89 e5             	mov    %rsp,%rbp
+  800d5d:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800d64:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800d6b:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800d71:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800d78:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800d7f:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800d86:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800d8d:	84 c0                	test   %al,%al
+  800d8f:	74 20                	je     800db1 <snprintf+0x58>
+  800d91:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800d95:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800d99:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800d9d:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800da1:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800da5:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800da9:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800dad:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  800db1:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800db8:	00 00 00 
+  800dbb:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800dc2:	00 00 00 
+  800dc5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800dc9:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800dd0:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800dd7:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq, ap);
+  800dde:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800de5:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800dec:	48 8b 06             	mov    (%rsi),%rax
+  800def:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800df3:	48 89 01             	mov    %rax,(%rcx)
+  800df6:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dfa:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800dfe:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  800e02:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800e09:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  800e10:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  800e16:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800e1d:	48 89 c7             	mov    %rax,%rdi
+  800e20:	48 b8 b9 0c 80 00 00 	movabs $0x800cb9,%rax
+  800e27:	00 00 00 
+  800e2a:	ff d0                	call   *%rax
+  800e2c:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  800e32:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800e38:	c9                   	leave
+  800e39:	c3                   	ret
+
+0000000000800e3a <cpuid>:
+#define read_rip(var) __asm __volatile("leaq (%%rip), %0" : "=r" (var)::"cc","memory")
+
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800e3a:	55                   	push   %rbp
+  800e3b:	48 89 e5             	mov    %rsp,%rbp
+  800e3e:	53                   	push   %rbx
+  800e3f:	48 83 ec 38          	sub    $0x38,%rsp
+  800e43:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800e46:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800e4a:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800e4e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800e52:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid" 
+  800e56:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800e59:	0f a2                	cpuid
+  800e5b:	89 de                	mov    %ebx,%esi
+  800e5d:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800e60:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800e63:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800e66:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info));
+	if (eaxp)
+  800e69:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800e6e:	74 09                	je     800e79 <cpuid+0x3f>
+		*eaxp = eax;
+  800e70:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800e74:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800e77:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  800e79:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800e7e:	74 09                	je     800e89 <cpuid+0x4f>
+		*ebxp = ebx;
+  800e80:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e84:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800e87:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  800e89:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800e8e:	74 09                	je     800e99 <cpuid+0x5f>
+		*ecxp = ecx;
+  800e90:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e94:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800e97:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  800e99:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800e9e:	74 09                	je     800ea9 <cpuid+0x6f>
+		*edxp = edx;
+  800ea0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800ea4:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800ea7:	89 10                	mov    %edx,(%rax)
+}
+  800ea9:	90                   	nop
+  800eaa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800eae:	c9                   	leave
+  800eaf:	c3                   	ret
+
+0000000000800eb0 <cpuid_count>:
+
+// 带子功能号(%ecx = count)的 cpuid，用于 leaf 4/7/0xB/0xD 等
+static __inline void
+cpuid_count(uint32_t info, uint32_t count, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800eb0:	55                   	push   %rbp
+  800eb1:	48 89 e5             	mov    %rsp,%rbp
+  800eb4:	53                   	push   %rbx
+  800eb5:	48 83 ec 38          	sub    $0x38,%rsp
+  800eb9:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800ebc:	89 75 e0             	mov    %esi,-0x20(%rbp)
+  800ebf:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800ec3:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  800ec7:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+  800ecb:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800ecf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800ed2:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800ed5:	89 d1                	mov    %edx,%ecx
+  800ed7:	0f a2                	cpuid
+  800ed9:	89 de                	mov    %ebx,%esi
+  800edb:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800ede:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800ee1:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800ee4:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info), "c" (count));
+	if (eaxp)
+  800ee7:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800eec:	74 09                	je     800ef7 <cpuid_count+0x47>
+		*eaxp = eax;
+  800eee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ef2:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800ef5:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  800ef7:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800efc:	74 09                	je     800f07 <cpuid_count+0x57>
+		*ebxp = ebx;
+  800efe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f02:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800f05:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  800f07:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800f0c:	74 09                	je     800f17 <cpuid_count+0x67>
+		*ecxp = ecx;
+  800f0e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f12:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800f15:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  800f17:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800f1c:	74 09                	je     800f27 <cpuid_count+0x77>
+		*edxp = edx;
+  800f1e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800f22:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800f25:	89 10                	mov    %edx,(%rax)
+}
+  800f27:	90                   	nop
+  800f28:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f2c:	c9                   	leave
+  800f2d:	c3                   	ret
+
+0000000000800f2e <strlen>:
+// 在真正的硬件上会有一定程度的优化, 但在 Bochs 上会有更大的优化效果
+// 用这种方法, Primespipe 的运行速度快了3倍
+#define ASM 1
+
+int strlen(const char *s)
+{
+  800f2e:	55                   	push   %rbp
+  800f2f:	48 89 e5             	mov    %rsp,%rbp
+  800f32:	48 83 ec 18          	sub    $0x18,%rsp
+  800f36:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800f3a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800f41:	eb 09                	jmp    800f4c <strlen+0x1e>
+		n++;
+  800f43:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  800f47:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800f4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f50:	0f b6 00             	movzbl (%rax),%eax
+  800f53:	84 c0                	test   %al,%al
+  800f55:	75 ec                	jne    800f43 <strlen+0x15>
+	return n;
+  800f57:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800f5a:	c9                   	leave
+  800f5b:	c3                   	ret
+
+0000000000800f5c <strnlen>:
+
+int strnlen(const char *s, size_t size)
+{
+  800f5c:	55                   	push   %rbp
+  800f5d:	48 89 e5             	mov    %rsp,%rbp
+  800f60:	48 83 ec 20          	sub    $0x20,%rsp
+  800f64:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800f68:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f6c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800f73:	eb 0e                	jmp    800f83 <strnlen+0x27>
+		n++;
+  800f75:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f79:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800f7e:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  800f83:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800f88:	74 0b                	je     800f95 <strnlen+0x39>
+  800f8a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f8e:	0f b6 00             	movzbl (%rax),%eax
+  800f91:	84 c0                	test   %al,%al
+  800f93:	75 e0                	jne    800f75 <strnlen+0x19>
+	return n;
+  800f95:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800f98:	c9                   	leave
+  800f99:	c3                   	ret
+
+0000000000800f9a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800f9a:	55                   	push   %rbp
+  800f9b:	48 89 e5             	mov    %rsp,%rbp
+  800f9e:	48 83 ec 20          	sub    $0x20,%rsp
+  800fa2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800fa6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  800faa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fae:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  800fb2:	90                   	nop
+  800fb3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fb7:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  800fbb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800fbf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fc3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800fc7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800fcb:	0f b6 12             	movzbl (%rdx),%edx
+  800fce:	88 10                	mov    %dl,(%rax)
+  800fd0:	0f b6 00             	movzbl (%rax),%eax
+  800fd3:	84 c0                	test   %al,%al
+  800fd5:	75 dc                	jne    800fb3 <strcpy+0x19>
+		/* do nothing */;
+	return ret;
+  800fd7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800fdb:	c9                   	leave
+  800fdc:	c3                   	ret
+
+0000000000800fdd <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800fdd:	55                   	push   %rbp
+  800fde:	48 89 e5             	mov    %rsp,%rbp
+  800fe1:	48 83 ec 20          	sub    $0x20,%rsp
+  800fe5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800fe9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int len = strlen(dst);
+  800fed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ff1:	48 89 c7             	mov    %rax,%rdi
+  800ff4:	48 b8 2e 0f 80 00 00 	movabs $0x800f2e,%rax
+  800ffb:	00 00 00 
+  800ffe:	ff d0                	call   *%rax
+  801000:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	strcpy(dst + len, src);
+  801003:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801006:	48 63 d0             	movslq %eax,%rdx
+  801009:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80100d:	48 01 c2             	add    %rax,%rdx
+  801010:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801014:	48 89 c6             	mov    %rax,%rsi
+  801017:	48 89 d7             	mov    %rdx,%rdi
+  80101a:	48 b8 9a 0f 80 00 00 	movabs $0x800f9a,%rax
+  801021:	00 00 00 
+  801024:	ff d0                	call   *%rax
+	return dst;
+  801026:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80102a:	c9                   	leave
+  80102b:	c3                   	ret
+
+000000000080102c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  80102c:	55                   	push   %rbp
+  80102d:	48 89 e5             	mov    %rsp,%rbp
+  801030:	48 83 ec 28          	sub    $0x28,%rsp
+  801034:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801038:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80103c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801040:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801044:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++)
+  801048:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80104f:	00 
+  801050:	eb 2a                	jmp    80107c <strncpy+0x50>
+	{
+		*dst++ = *src;
+  801052:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801056:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80105a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80105e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801062:	0f b6 12             	movzbl (%rdx),%edx
+  801065:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801067:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80106b:	0f b6 00             	movzbl (%rax),%eax
+  80106e:	84 c0                	test   %al,%al
+  801070:	74 05                	je     801077 <strncpy+0x4b>
+			src++;
+  801072:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++)
+  801077:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80107c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801080:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801084:	72 cc                	jb     801052 <strncpy+0x26>
+	}
+	return ret;
+  801086:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80108a:	c9                   	leave
+  80108b:	c3                   	ret
+
+000000000080108c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80108c:	55                   	push   %rbp
+  80108d:	48 89 e5             	mov    %rsp,%rbp
+  801090:	48 83 ec 28          	sub    $0x28,%rsp
+  801094:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801098:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80109c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  8010a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010a4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0)
+  8010a8:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8010ad:	74 3d                	je     8010ec <strlcpy+0x60>
+	{
+		while (--size > 0 && *src != '\0')
+  8010af:	eb 1d                	jmp    8010ce <strlcpy+0x42>
+			*dst++ = *src++;
+  8010b1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8010b5:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8010b9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8010bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010c1:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8010c5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8010c9:	0f b6 12             	movzbl (%rdx),%edx
+  8010cc:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  8010ce:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8010d3:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8010d8:	74 0b                	je     8010e5 <strlcpy+0x59>
+  8010da:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8010de:	0f b6 00             	movzbl (%rax),%eax
+  8010e1:	84 c0                	test   %al,%al
+  8010e3:	75 cc                	jne    8010b1 <strlcpy+0x25>
+		*dst = '\0';
+  8010e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010e9:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8010ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010f0:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8010f4:	c9                   	leave
+  8010f5:	c3                   	ret
+
+00000000008010f6 <strcmp>:
+
+int strcmp(const char *p, const char *q)
+{
+  8010f6:	55                   	push   %rbp
+  8010f7:	48 89 e5             	mov    %rsp,%rbp
+  8010fa:	48 83 ec 10          	sub    $0x10,%rsp
+  8010fe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801102:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801106:	eb 0a                	jmp    801112 <strcmp+0x1c>
+		p++, q++;
+  801108:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80110d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801112:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801116:	0f b6 00             	movzbl (%rax),%eax
+  801119:	84 c0                	test   %al,%al
+  80111b:	74 12                	je     80112f <strcmp+0x39>
+  80111d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801121:	0f b6 10             	movzbl (%rax),%edx
+  801124:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801128:	0f b6 00             	movzbl (%rax),%eax
+  80112b:	38 c2                	cmp    %al,%dl
+  80112d:	74 d9                	je     801108 <strcmp+0x12>
+	return (int)((unsigned char)*p - (unsigned char)*q);
+  80112f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801133:	0f b6 00             	movzbl (%rax),%eax
+  801136:	0f b6 d0             	movzbl %al,%edx
+  801139:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80113d:	0f b6 00             	movzbl (%rax),%eax
+  801140:	0f b6 c0             	movzbl %al,%eax
+  801143:	29 c2                	sub    %eax,%edx
+  801145:	89 d0                	mov    %edx,%eax
+}
+  801147:	c9                   	leave
+  801148:	c3                   	ret
+
+0000000000801149 <strncmp>:
+
+int strncmp(const char *p, const char *q, size_t n)
+{
+  801149:	55                   	push   %rbp
+  80114a:	48 89 e5             	mov    %rsp,%rbp
+  80114d:	48 83 ec 18          	sub    $0x18,%rsp
+  801151:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801155:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801159:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80115d:	eb 0f                	jmp    80116e <strncmp+0x25>
+		n--, p++, q++;
+  80115f:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801164:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801169:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80116e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801173:	74 1d                	je     801192 <strncmp+0x49>
+  801175:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801179:	0f b6 00             	movzbl (%rax),%eax
+  80117c:	84 c0                	test   %al,%al
+  80117e:	74 12                	je     801192 <strncmp+0x49>
+  801180:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801184:	0f b6 10             	movzbl (%rax),%edx
+  801187:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80118b:	0f b6 00             	movzbl (%rax),%eax
+  80118e:	38 c2                	cmp    %al,%dl
+  801190:	74 cd                	je     80115f <strncmp+0x16>
+	if (n == 0)
+  801192:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801197:	75 07                	jne    8011a0 <strncmp+0x57>
+		return 0;
+  801199:	ba 00 00 00 00       	mov    $0x0,%edx
+  80119e:	eb 16                	jmp    8011b6 <strncmp+0x6d>
+	else
+		return (int)((unsigned char)*p - (unsigned char)*q);
+  8011a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011a4:	0f b6 00             	movzbl (%rax),%eax
+  8011a7:	0f b6 d0             	movzbl %al,%edx
+  8011aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011ae:	0f b6 00             	movzbl (%rax),%eax
+  8011b1:	0f b6 c0             	movzbl %al,%eax
+  8011b4:	29 c2                	sub    %eax,%edx
+}
+  8011b6:	89 d0                	mov    %edx,%eax
+  8011b8:	c9                   	leave
+  8011b9:	c3                   	ret
+
+00000000008011ba <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8011ba:	55                   	push   %rbp
+  8011bb:	48 89 e5             	mov    %rsp,%rbp
+  8011be:	48 83 ec 10          	sub    $0x10,%rsp
+  8011c2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8011c6:	89 f0                	mov    %esi,%eax
+  8011c8:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8011cb:	eb 17                	jmp    8011e4 <strchr+0x2a>
+		if (*s == c)
+  8011cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011d1:	0f b6 00             	movzbl (%rax),%eax
+  8011d4:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8011d7:	75 06                	jne    8011df <strchr+0x25>
+			return (char *)s;
+  8011d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011dd:	eb 15                	jmp    8011f4 <strchr+0x3a>
+	for (; *s; s++)
+  8011df:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8011e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011e8:	0f b6 00             	movzbl (%rax),%eax
+  8011eb:	84 c0                	test   %al,%al
+  8011ed:	75 de                	jne    8011cd <strchr+0x13>
+	return 0;
+  8011ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011f4:	c9                   	leave
+  8011f5:	c3                   	ret
+
+00000000008011f6 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8011f6:	55                   	push   %rbp
+  8011f7:	48 89 e5             	mov    %rsp,%rbp
+  8011fa:	48 83 ec 10          	sub    $0x10,%rsp
+  8011fe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801202:	89 f0                	mov    %esi,%eax
+  801204:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801207:	eb 11                	jmp    80121a <strfind+0x24>
+		if (*s == c)
+  801209:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80120d:	0f b6 00             	movzbl (%rax),%eax
+  801210:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801213:	74 12                	je     801227 <strfind+0x31>
+	for (; *s; s++)
+  801215:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80121a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80121e:	0f b6 00             	movzbl (%rax),%eax
+  801221:	84 c0                	test   %al,%al
+  801223:	75 e4                	jne    801209 <strfind+0x13>
+  801225:	eb 01                	jmp    801228 <strfind+0x32>
+			break;
+  801227:	90                   	nop
+	return (char *)s;
+  801228:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80122c:	c9                   	leave
+  80122d:	c3                   	ret
+
+000000000080122e <mem_init>:
+};
+
+static int mem_features;
+
+void mem_init(void)
+{
+  80122e:	55                   	push   %rbp
+  80122f:	48 89 e5             	mov    %rsp,%rbp
+  801232:	48 83 ec 10          	sub    $0x10,%rsp
+	uint32_t max, ebx, edx;
+
+	mem_features = 0;
+  801236:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  80123d:	00 00 00 
+  801240:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	cpuid(0, &max, NULL, NULL, NULL);
+  801246:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+  80124a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801250:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801255:	ba 00 00 00 00       	mov    $0x0,%edx
+  80125a:	48 89 c6             	mov    %rax,%rsi
+  80125d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801262:	48 b8 3a 0e 80 00 00 	movabs $0x800e3a,%rax
+  801269:	00 00 00 
+  80126c:	ff d0                	call   *%rax
+	cpuid(1, NULL, NULL, NULL, &edx);
+  80126e:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  801272:	49 89 c0             	mov    %rax,%r8
+  801275:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80127a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80127f:	be 00 00 00 00       	mov    $0x0,%esi
+  801284:	bf 01 00 00 00       	mov    $0x1,%edi
+  801289:	48 b8 3a 0e 80 00 00 	movabs $0x800e3a,%rax
+  801290:	00 00 00 
+  801293:	ff d0                	call   *%rax
+	if (edx & (1 << 26))
+  801295:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801298:	25 00 00 00 04       	and    $0x4000000,%eax
+  80129d:	85 c0                	test   %eax,%eax
+  80129f:	74 1d                	je     8012be <mem_init+0x90>
+		mem_features |= MEM_F_NT;
+  8012a1:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8012a8:	00 00 00 
+  8012ab:	8b 00                	mov    (%rax),%eax
+  8012ad:	83 c8 02             	or     $0x2,%eax
+  8012b0:	89 c2                	mov    %eax,%edx
+  8012b2:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8012b9:	00 00 00 
+  8012bc:	89 10                	mov    %edx,(%rax)
+	if (max >= 7)
+  8012be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012c1:	83 f8 06             	cmp    $0x6,%eax
+  8012c4:	76 57                	jbe    80131d <mem_init+0xef>
+	{
+		cpuid_count(7, 0, NULL, &ebx, NULL, NULL);
+  8012c6:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  8012ca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8012d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012d6:	48 89 c1             	mov    %rax,%rcx
+  8012d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012de:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e3:	bf 07 00 00 00       	mov    $0x7,%edi
+  8012e8:	48 b8 b0 0e 80 00 00 	movabs $0x800eb0,%rax
+  8012ef:	00 00 00 
+  8012f2:	ff d0                	call   *%rax
+		if (ebx & (1 << 9))
+  8012f4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8012f7:	25 00 02 00 00       	and    $0x200,%eax
+  8012fc:	85 c0                	test   %eax,%eax
+  8012fe:	74 1d                	je     80131d <mem_init+0xef>
+			mem_features |= MEM_F_ERMS;
+  801300:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  801307:	00 00 00 
+  80130a:	8b 00                	mov    (%rax),%eax
+  80130c:	83 c8 01             	or     $0x1,%eax
+  80130f:	89 c2                	mov    %eax,%edx
+  801311:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  801318:	00 00 00 
+  80131b:	89 10                	mov    %edx,(%rax)
+	}
+}
+  80131d:	90                   	nop
+  80131e:	c9                   	leave
+  80131f:	c3                   	ret
+
+0000000000801320 <memset_nt>:
+
+// 非临时存储填充 n 字节(v 8 字节对齐，n 为 32 的倍数)
+static void
+memset_nt(void *v, uint64_t pattern, size_t n)
+{
+  801320:	55                   	push   %rbp
+  801321:	48 89 e5             	mov    %rsp,%rbp
+  801324:	48 83 ec 28          	sub    $0x28,%rsp
+  801328:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80132c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801330:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t *p = (uint64_t *)v;
+  801334:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801338:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint64_t *end = p + n / 8;
+  80133c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801340:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  801344:	48 89 c2             	mov    %rax,%rdx
+  801347:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80134b:	48 01 d0             	add    %rdx,%rax
+  80134e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	for (; p < end; p += 4)
+  801352:	eb 20                	jmp    801374 <memset_nt+0x54>
+		asm volatile("movnti %1, 0(%0)\n\t"
+  801354:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801358:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80135c:	48 0f c3 10          	movnti %rdx,(%rax)
+  801360:	48 0f c3 50 08       	movnti %rdx,0x8(%rax)
+  801365:	48 0f c3 50 10       	movnti %rdx,0x10(%rax)
+  80136a:	48 0f c3 50 18       	movnti %rdx,0x18(%rax)
+	for (; p < end; p += 4)
+  80136f:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  801374:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801378:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80137c:	72 d6                	jb     801354 <memset_nt+0x34>
+					 "movnti %1, 16(%0)\n\t"
+					 "movnti %1, 24(%0)"
+					 :
+					 : "r"(p), "r"(pattern)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  80137e:	0f ae f8             	sfence
+}
+  801381:	90                   	nop
+  801382:	c9                   	leave
+  801383:	c3                   	ret
+
+0000000000801384 <memcpy_nt>:
+
+// 非临时存储复制 n 字节(dst/src 8 字节对齐且不重叠，n 为 32 的倍数)
+static void
+memcpy_nt(void *dst, const void *src, size_t n)
+{
+  801384:	55                   	push   %rbp
+  801385:	48 89 e5             	mov    %rsp,%rbp
+  801388:	48 83 ec 58          	sub    $0x58,%rsp
+  80138c:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801390:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801394:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	uint64_t *d = (uint64_t *)dst;
+  801398:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80139c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint64_t *s = (const uint64_t *)src;
+  8013a0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8013a4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	uint64_t *end = d + n / 8;
+  8013a8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8013ac:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  8013b0:	48 89 c2             	mov    %rax,%rdx
+  8013b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013b7:	48 01 d0             	add    %rdx,%rax
+  8013ba:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint64_t t0, t1, t2, t3;
+
+	for (; d < end; d += 4, s += 4)
+  8013be:	eb 44                	jmp    801404 <memcpy_nt+0x80>
+		asm volatile("movq 0(%4), %0\n\t"
+  8013c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013c4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8013c8:	4c 8b 00             	mov    (%rax),%r8
+  8013cb:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  8013cf:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  8013d3:	48 8b 48 18          	mov    0x18(%rax),%rcx
+  8013d7:	4c 0f c3 02          	movnti %r8,(%rdx)
+  8013db:	48 0f c3 7a 08       	movnti %rdi,0x8(%rdx)
+  8013e0:	48 0f c3 72 10       	movnti %rsi,0x10(%rdx)
+  8013e5:	48 0f c3 4a 18       	movnti %rcx,0x18(%rdx)
+  8013ea:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8013ee:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8013f2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8013f6:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+	for (; d < end; d += 4, s += 4)
+  8013fa:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  8013ff:	48 83 45 f0 20       	addq   $0x20,-0x10(%rbp)
+  801404:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801408:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  80140c:	72 b2                	jb     8013c0 <memcpy_nt+0x3c>
+					 "movnti %2, 16(%5)\n\t"
+					 "movnti %3, 24(%5)"
+					 : "=&r"(t0), "=&r"(t1), "=&r"(t2), "=&r"(t3)
+					 : "r"(s), "r"(d)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  80140e:	0f ae f8             	sfence
+}
+  801411:	90                   	nop
+  801412:	c9                   	leave
+  801413:	c3                   	ret
+
+0000000000801414 <memcpy_fwd>:
+
+// 正向复制(dst 在 src 之前或两者不重叠)
+static void
+memcpy_fwd(void *dst, const void *src, size_t n)
+{
+  801414:	55                   	push   %rbp
+  801415:	48 89 e5             	mov    %rsp,%rbp
+  801418:	48 83 ec 18          	sub    $0x18,%rsp
+  80141c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801420:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801424:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  801428:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  80142f:	00 00 00 
+  801432:	8b 00                	mov    (%rax),%eax
+  801434:	83 e0 02             	and    $0x2,%eax
+  801437:	85 c0                	test   %eax,%eax
+  801439:	74 66                	je     8014a1 <memcpy_fwd+0x8d>
+  80143b:	48 81 7d e8 ff 0f 00 	cmpq   $0xfff,-0x18(%rbp)
+  801442:	00 
+  801443:	76 5c                	jbe    8014a1 <memcpy_fwd+0x8d>
+  801445:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801449:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80144d:	48 09 d0             	or     %rdx,%rax
+  801450:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  801454:	83 e0 1f             	and    $0x1f,%eax
+  801457:	48 85 c0             	test   %rax,%rax
+  80145a:	75 45                	jne    8014a1 <memcpy_fwd+0x8d>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  80145c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801460:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801464:	48 01 d0             	add    %rdx,%rax
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  801467:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80146b:	73 11                	jae    80147e <memcpy_fwd+0x6a>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  80146d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801471:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801475:	48 01 d0             	add    %rdx,%rax
+  801478:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80147c:	72 23                	jb     8014a1 <memcpy_fwd+0x8d>
+		memcpy_nt(dst, src, n);
+  80147e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801482:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801486:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80148a:	48 89 ce             	mov    %rcx,%rsi
+  80148d:	48 89 c7             	mov    %rax,%rdi
+  801490:	48 b8 84 13 80 00 00 	movabs $0x801384,%rax
+  801497:	00 00 00 
+  80149a:	ff d0                	call   *%rax
+  80149c:	e9 81 00 00 00       	jmp    801522 <memcpy_fwd+0x10e>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  8014a1:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8014a8:	00 00 00 
+  8014ab:	8b 00                	mov    (%rax),%eax
+  8014ad:	83 e0 01             	and    $0x1,%eax
+  8014b0:	85 c0                	test   %eax,%eax
+  8014b2:	74 21                	je     8014d5 <memcpy_fwd+0xc1>
+  8014b4:	48 81 7d e8 ff 00 00 	cmpq   $0xff,-0x18(%rbp)
+  8014bb:	00 
+  8014bc:	76 17                	jbe    8014d5 <memcpy_fwd+0xc1>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  8014be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014c2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8014c6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8014ca:	48 89 c7             	mov    %rax,%rdi
+  8014cd:	48 89 d6             	mov    %rdx,%rsi
+  8014d0:	fc                   	cld
+  8014d1:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8014d3:	eb 4d                	jmp    801522 <memcpy_fwd+0x10e>
+					 : "cc", "memory");
+	else if ((((uint64_t)dst | (uint64_t)src | n) & 7) == 0)
+  8014d5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8014d9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014dd:	48 09 d0             	or     %rdx,%rax
+  8014e0:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  8014e4:	83 e0 07             	and    $0x7,%eax
+  8014e7:	48 85 c0             	test   %rax,%rax
+  8014ea:	75 1f                	jne    80150b <memcpy_fwd+0xf7>
+		asm volatile("cld; rep movsq\n" ::"D"(dst), "S"(src), "c"(n / 8)
+  8014ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014f0:	48 c1 e8 03          	shr    $0x3,%rax
+  8014f4:	48 89 c1             	mov    %rax,%rcx
+  8014f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014fb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8014ff:	48 89 c7             	mov    %rax,%rdi
+  801502:	48 89 d6             	mov    %rdx,%rsi
+  801505:	fc                   	cld
+  801506:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+					 : "cc", "memory");
+}
+  801509:	eb 17                	jmp    801522 <memcpy_fwd+0x10e>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  80150b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80150f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801513:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801517:	48 89 c7             	mov    %rax,%rdi
+  80151a:	48 89 d6             	mov    %rdx,%rsi
+  80151d:	fc                   	cld
+  80151e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+  801520:	eb 00                	jmp    801522 <memcpy_fwd+0x10e>
+  801522:	90                   	nop
+  801523:	c9                   	leave
+  801524:	c3                   	ret
+
+0000000000801525 <memset>:
+
+void *
+memset(void *v, int c, size_t n)
+{
+  801525:	55                   	push   %rbp
+  801526:	48 89 e5             	mov    %rsp,%rbp
+  801529:	48 83 ec 28          	sub    $0x28,%rsp
+  80152d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801531:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801534:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t pattern;
+
+	if (n == 0)
+  801538:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80153d:	75 09                	jne    801548 <memset+0x23>
+		return v;
+  80153f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801543:	e9 dc 00 00 00       	jmp    801624 <memset+0xff>
+	c &= 0xFF;
+  801548:	81 65 e4 ff 00 00 00 	andl   $0xff,-0x1c(%rbp)
+	pattern = (uint64_t)c * 0x0101010101010101UL;
+  80154f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801552:	48 98                	cltq
+  801554:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  80155b:	01 01 01 
+  80155e:	48 0f af c2          	imul   %rdx,%rax
+  801562:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)v | n) & 31) == 0)
+  801566:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  80156d:	00 00 00 
+  801570:	8b 00                	mov    (%rax),%eax
+  801572:	83 e0 02             	and    $0x2,%eax
+  801575:	85 c0                	test   %eax,%eax
+  801577:	74 3a                	je     8015b3 <memset+0x8e>
+  801579:	48 81 7d d8 ff 0f 00 	cmpq   $0xfff,-0x28(%rbp)
+  801580:	00 
+  801581:	76 30                	jbe    8015b3 <memset+0x8e>
+  801583:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801587:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  80158b:	83 e0 1f             	and    $0x1f,%eax
+  80158e:	48 85 c0             	test   %rax,%rax
+  801591:	75 20                	jne    8015b3 <memset+0x8e>
+		memset_nt(v, pattern, n);
+  801593:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801597:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80159b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80159f:	48 89 ce             	mov    %rcx,%rsi
+  8015a2:	48 89 c7             	mov    %rax,%rdi
+  8015a5:	48 b8 20 13 80 00 00 	movabs $0x801320,%rax
+  8015ac:	00 00 00 
+  8015af:	ff d0                	call   *%rax
+  8015b1:	eb 6d                	jmp    801620 <memset+0xfb>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  8015b3:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8015ba:	00 00 00 
+  8015bd:	8b 00                	mov    (%rax),%eax
+  8015bf:	83 e0 01             	and    $0x1,%eax
+  8015c2:	85 c0                	test   %eax,%eax
+  8015c4:	74 1d                	je     8015e3 <memset+0xbe>
+  8015c6:	48 81 7d d8 ff 00 00 	cmpq   $0xff,-0x28(%rbp)
+  8015cd:	00 
+  8015ce:	76 13                	jbe    8015e3 <memset+0xbe>
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  8015d0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8015d4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8015d7:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8015db:	48 89 d7             	mov    %rdx,%rdi
+  8015de:	fc                   	cld
+  8015df:	f3 aa                	rep stos %al,%es:(%rdi)
+  8015e1:	eb 3d                	jmp    801620 <memset+0xfb>
+					 : "cc", "memory");
+	else if ((((uint64_t)v | n) & 7) == 0)
+  8015e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015e7:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  8015eb:	83 e0 07             	and    $0x7,%eax
+  8015ee:	48 85 c0             	test   %rax,%rax
+  8015f1:	75 1c                	jne    80160f <memset+0xea>
+		asm volatile("cld; rep stosq\n" ::"D"(v), "a"(pattern), "c"(n / 8)
+  8015f3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015f7:	48 c1 e8 03          	shr    $0x3,%rax
+  8015fb:	48 89 c1             	mov    %rax,%rcx
+  8015fe:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801602:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801606:	48 89 d7             	mov    %rdx,%rdi
+  801609:	fc                   	cld
+  80160a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  80160d:	eb 11                	jmp    801620 <memset+0xfb>
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  80160f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801613:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801616:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80161a:	48 89 d7             	mov    %rdx,%rdi
+  80161d:	fc                   	cld
+  80161e:	f3 aa                	rep stos %al,%es:(%rdi)
+					 : "cc", "memory");
+	return v;
+  801620:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801624:	c9                   	leave
+  801625:	c3                   	ret
+
+0000000000801626 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801626:	55                   	push   %rbp
+  801627:	48 89 e5             	mov    %rsp,%rbp
+  80162a:	48 83 ec 28          	sub    $0x28,%rsp
+  80162e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801632:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801636:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  80163a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80163e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801642:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801646:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d)
+  80164a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80164e:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801652:	73 7c                	jae    8016d0 <memmove+0xaa>
+  801654:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801658:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80165c:	48 01 d0             	add    %rdx,%rax
+  80165f:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801663:	73 6b                	jae    8016d0 <memmove+0xaa>
+	{
+		// 重叠且 dst 在 src 之后，只能反向复制(ERMS 对反向 rep movsb 没有优化)
+		s += n;
+  801665:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801669:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  80166d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801671:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((((uint64_t)s | (uint64_t)d | n) & 7) == 0)
+  801675:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801679:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80167d:	48 09 d0             	or     %rdx,%rax
+  801680:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  801684:	83 e0 07             	and    $0x7,%eax
+  801687:	48 85 c0             	test   %rax,%rax
+  80168a:	75 24                	jne    8016b0 <memmove+0x8a>
+			asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80168c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801690:	48 83 e8 08          	sub    $0x8,%rax
+  801694:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801698:	48 83 ea 08          	sub    $0x8,%rdx
+  80169c:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8016a0:	48 c1 e9 03          	shr    $0x3,%rcx
+  8016a4:	48 89 c7             	mov    %rax,%rdi
+  8016a7:	48 89 d6             	mov    %rdx,%rsi
+  8016aa:	fd                   	std
+  8016ab:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8016ae:	eb 1d                	jmp    8016cd <memmove+0xa7>
+						 : "cc", "memory");
+		else
+			asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8016b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016b4:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8016b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016bc:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+  8016c0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016c4:	48 89 d7             	mov    %rdx,%rdi
+  8016c7:	48 89 c1             	mov    %rax,%rcx
+  8016ca:	fd                   	std
+  8016cb:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+						 : "cc", "memory");
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::
+  8016cd:	fc                   	cld
+  8016ce:	eb 25                	jmp    8016f5 <memmove+0xcf>
+						 : "cc");
+	}
+	else if (n)
+  8016d0:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016d5:	74 1e                	je     8016f5 <memmove+0xcf>
+		memcpy_fwd(d, s, n);
+  8016d7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8016db:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8016df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016e3:	48 89 ce             	mov    %rcx,%rsi
+  8016e6:	48 89 c7             	mov    %rax,%rdi
+  8016e9:	48 b8 14 14 80 00 00 	movabs $0x801414,%rax
+  8016f0:	00 00 00 
+  8016f3:	ff d0                	call   *%rax
+	return dst;
+  8016f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8016f9:	c9                   	leave
+  8016fa:	c3                   	ret
+
+00000000008016fb <memcpy>:
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8016fb:	55                   	push   %rbp
+  8016fc:	48 89 e5             	mov    %rsp,%rbp
+  8016ff:	48 83 ec 18          	sub    $0x18,%rsp
+  801703:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801707:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80170b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (n)
+  80170f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801714:	74 1e                	je     801734 <memcpy+0x39>
+		memcpy_fwd(dst, src, n);
+  801716:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80171a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80171e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801722:	48 89 ce             	mov    %rcx,%rsi
+  801725:	48 89 c7             	mov    %rax,%rdi
+  801728:	48 b8 14 14 80 00 00 	movabs $0x801414,%rax
+  80172f:	00 00 00 
+  801732:	ff d0                	call   *%rax
+	return dst;
+  801734:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801738:	c9                   	leave
+  801739:	c3                   	ret
+
+000000000080173a <memcmp>:
+{
+}
+#endif
+
+int memcmp(const void *v1, const void *v2, size_t n)
+{
+  80173a:	55                   	push   %rbp
+  80173b:	48 89 e5             	mov    %rsp,%rbp
+  80173e:	48 83 ec 28          	sub    $0x28,%rsp
+  801742:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801746:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80174a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *)v1;
+  80174e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801752:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *)v2;
+  801756:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80175a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0)
+  80175e:	eb 34                	jmp    801794 <memcmp+0x5a>
+	{
+		if (*s1 != *s2)
+  801760:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801764:	0f b6 10             	movzbl (%rax),%edx
+  801767:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80176b:	0f b6 00             	movzbl (%rax),%eax
+  80176e:	38 c2                	cmp    %al,%dl
+  801770:	74 18                	je     80178a <memcmp+0x50>
+			return (int)*s1 - (int)*s2;
+  801772:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801776:	0f b6 00             	movzbl (%rax),%eax
+  801779:	0f b6 d0             	movzbl %al,%edx
+  80177c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801780:	0f b6 00             	movzbl (%rax),%eax
+  801783:	0f b6 c0             	movzbl %al,%eax
+  801786:	29 c2                	sub    %eax,%edx
+  801788:	eb 20                	jmp    8017aa <memcmp+0x70>
+		s1++, s2++;
+  80178a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80178f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0)
+  801794:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801798:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80179c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8017a0:	48 85 c0             	test   %rax,%rax
+  8017a3:	75 bb                	jne    801760 <memcmp+0x26>
+	}
+
+	return 0;
+  8017a5:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  8017aa:	89 d0                	mov    %edx,%eax
+  8017ac:	c9                   	leave
+  8017ad:	c3                   	ret
+
+00000000008017ae <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8017ae:	55                   	push   %rbp
+  8017af:	48 89 e5             	mov    %rsp,%rbp
+  8017b2:	48 83 ec 28          	sub    $0x28,%rsp
+  8017b6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017ba:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8017bd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *)s + n;
+  8017c1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8017c5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017c9:	48 01 d0             	add    %rdx,%rax
+  8017cc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  8017d0:	eb 13                	jmp    8017e5 <memfind+0x37>
+		if (*(const unsigned char *)s == (unsigned char)c)
+  8017d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017d6:	0f b6 00             	movzbl (%rax),%eax
+  8017d9:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8017dc:	38 d0                	cmp    %dl,%al
+  8017de:	74 11                	je     8017f1 <memfind+0x43>
+	for (; s < ends; s++)
+  8017e0:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8017e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017e9:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8017ed:	72 e3                	jb     8017d2 <memfind+0x24>
+  8017ef:	eb 01                	jmp    8017f2 <memfind+0x44>
+			break;
+  8017f1:	90                   	nop
+	return (void *)s;
+  8017f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8017f6:	c9                   	leave
+  8017f7:	c3                   	ret
+
+00000000008017f8 <strtol>:
+
+long strtol(const char *s, char **endptr, int base)
+{
+  8017f8:	55                   	push   %rbp
+  8017f9:	48 89 e5             	mov    %rsp,%rbp
+  8017fc:	48 83 ec 38          	sub    $0x38,%rsp
+  801800:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801804:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801808:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  80180b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801812:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801819:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80181a:	eb 05                	jmp    801821 <strtol+0x29>
+		s++;
+  80181c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801821:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801825:	0f b6 00             	movzbl (%rax),%eax
+  801828:	3c 20                	cmp    $0x20,%al
+  80182a:	74 f0                	je     80181c <strtol+0x24>
+  80182c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801830:	0f b6 00             	movzbl (%rax),%eax
+  801833:	3c 09                	cmp    $0x9,%al
+  801835:	74 e5                	je     80181c <strtol+0x24>
+
+	// plus/minus sign
+	if (*s == '+')
+  801837:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80183b:	0f b6 00             	movzbl (%rax),%eax
+  80183e:	3c 2b                	cmp    $0x2b,%al
+  801840:	75 07                	jne    801849 <strtol+0x51>
+		s++;
+  801842:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801847:	eb 17                	jmp    801860 <strtol+0x68>
+	else if (*s == '-')
+  801849:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80184d:	0f b6 00             	movzbl (%rax),%eax
+  801850:	3c 2d                	cmp    $0x2d,%al
+  801852:	75 0c                	jne    801860 <strtol+0x68>
+		s++, neg = 1;
+  801854:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801859:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801860:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801864:	74 06                	je     80186c <strtol+0x74>
+  801866:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  80186a:	75 28                	jne    801894 <strtol+0x9c>
+  80186c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801870:	0f b6 00             	movzbl (%rax),%eax
+  801873:	3c 30                	cmp    $0x30,%al
+  801875:	75 1d                	jne    801894 <strtol+0x9c>
+  801877:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80187b:	48 83 c0 01          	add    $0x1,%rax
+  80187f:	0f b6 00             	movzbl (%rax),%eax
+  801882:	3c 78                	cmp    $0x78,%al
+  801884:	75 0e                	jne    801894 <strtol+0x9c>
+		s += 2, base = 16;
+  801886:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  80188b:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801892:	eb 2c                	jmp    8018c0 <strtol+0xc8>
+	else if (base == 0 && s[0] == '0')
+  801894:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801898:	75 19                	jne    8018b3 <strtol+0xbb>
+  80189a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80189e:	0f b6 00             	movzbl (%rax),%eax
+  8018a1:	3c 30                	cmp    $0x30,%al
+  8018a3:	75 0e                	jne    8018b3 <strtol+0xbb>
+		s++, base = 8;
+  8018a5:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8018aa:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  8018b1:	eb 0d                	jmp    8018c0 <strtol+0xc8>
+	else if (base == 0)
+  8018b3:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8018b7:	75 07                	jne    8018c0 <strtol+0xc8>
+		base = 10;
+  8018b9:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+	// digits
+	while (1)
+	{
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  8018c0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018c4:	0f b6 00             	movzbl (%rax),%eax
+  8018c7:	3c 2f                	cmp    $0x2f,%al
+  8018c9:	7e 1d                	jle    8018e8 <strtol+0xf0>
+  8018cb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018cf:	0f b6 00             	movzbl (%rax),%eax
+  8018d2:	3c 39                	cmp    $0x39,%al
+  8018d4:	7f 12                	jg     8018e8 <strtol+0xf0>
+			dig = *s - '0';
+  8018d6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018da:	0f b6 00             	movzbl (%rax),%eax
+  8018dd:	0f be c0             	movsbl %al,%eax
+  8018e0:	83 e8 30             	sub    $0x30,%eax
+  8018e3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8018e6:	eb 4e                	jmp    801936 <strtol+0x13e>
+		else if (*s >= 'a' && *s <= 'z')
+  8018e8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018ec:	0f b6 00             	movzbl (%rax),%eax
+  8018ef:	3c 60                	cmp    $0x60,%al
+  8018f1:	7e 1d                	jle    801910 <strtol+0x118>
+  8018f3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018f7:	0f b6 00             	movzbl (%rax),%eax
+  8018fa:	3c 7a                	cmp    $0x7a,%al
+  8018fc:	7f 12                	jg     801910 <strtol+0x118>
+			dig = *s - 'a' + 10;
+  8018fe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801902:	0f b6 00             	movzbl (%rax),%eax
+  801905:	0f be c0             	movsbl %al,%eax
+  801908:	83 e8 57             	sub    $0x57,%eax
+  80190b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80190e:	eb 26                	jmp    801936 <strtol+0x13e>
+		else if (*s >= 'A' && *s <= 'Z')
+  801910:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801914:	0f b6 00             	movzbl (%rax),%eax
+  801917:	3c 40                	cmp    $0x40,%al
+  801919:	7e 47                	jle    801962 <strtol+0x16a>
+  80191b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80191f:	0f b6 00             	movzbl (%rax),%eax
+  801922:	3c 5a                	cmp    $0x5a,%al
+  801924:	7f 3c                	jg     801962 <strtol+0x16a>
+			dig = *s - 'A' + 10;
+  801926:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80192a:	0f b6 00             	movzbl (%rax),%eax
+  80192d:	0f be c0             	movsbl %al,%eax
+  801930:	83 e8 37             	sub    $0x37,%eax
+  801933:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801936:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801939:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  80193c:	7d 23                	jge    801961 <strtol+0x169>
+			break;
+		s++, val = (val * base) + dig;
+  80193e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801943:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801946:	48 98                	cltq
+  801948:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  80194d:	48 89 c2             	mov    %rax,%rdx
+  801950:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801953:	48 98                	cltq
+  801955:	48 01 d0             	add    %rdx,%rax
+  801958:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+  80195c:	e9 5f ff ff ff       	jmp    8018c0 <strtol+0xc8>
+			break;
+  801961:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801962:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801967:	74 0b                	je     801974 <strtol+0x17c>
+		*endptr = (char *)s;
+  801969:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80196d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801971:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801974:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801978:	74 09                	je     801983 <strtol+0x18b>
+  80197a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80197e:	48 f7 d8             	neg    %rax
+  801981:	eb 04                	jmp    801987 <strtol+0x18f>
+  801983:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801987:	c9                   	leave
+  801988:	c3                   	ret
+
+0000000000801989 <strstr>:
+
+char *strstr(const char *in, const char *str)
+{
+  801989:	55                   	push   %rbp
+  80198a:	48 89 e5             	mov    %rsp,%rbp
+  80198d:	48 83 ec 30          	sub    $0x30,%rsp
+  801991:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801995:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801999:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80199d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8019a1:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8019a5:	0f b6 00             	movzbl (%rax),%eax
+  8019a8:	88 45 ff             	mov    %al,-0x1(%rbp)
+	if (!c)
+  8019ab:	80 7d ff 00          	cmpb   $0x0,-0x1(%rbp)
+  8019af:	75 06                	jne    8019b7 <strstr+0x2e>
+		return (char *)in; // Trivial empty string case
+  8019b1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019b5:	eb 6b                	jmp    801a22 <strstr+0x99>
+
+	len = strlen(str);
+  8019b7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019bb:	48 89 c7             	mov    %rax,%rdi
+  8019be:	48 b8 2e 0f 80 00 00 	movabs $0x800f2e,%rax
+  8019c5:	00 00 00 
+  8019c8:	ff d0                	call   *%rax
+  8019ca:	48 98                	cltq
+  8019cc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+		char sc;
+
+		do
+		{
+			sc = *in++;
+  8019d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019d4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8019d8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8019dc:	0f b6 00             	movzbl (%rax),%eax
+  8019df:	88 45 ef             	mov    %al,-0x11(%rbp)
+			if (!sc)
+  8019e2:	80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+  8019e6:	75 07                	jne    8019ef <strstr+0x66>
+				return (char *)0;
+  8019e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ed:	eb 33                	jmp    801a22 <strstr+0x99>
+		} while (sc != c);
+  8019ef:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+  8019f3:	3a 45 ff             	cmp    -0x1(%rbp),%al
+  8019f6:	75 d8                	jne    8019d0 <strstr+0x47>
+	} while (strncmp(in, str, len) != 0);
+  8019f8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8019fc:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801a00:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a04:	48 89 ce             	mov    %rcx,%rsi
+  801a07:	48 89 c7             	mov    %rax,%rdi
+  801a0a:	48 b8 49 11 80 00 00 	movabs $0x801149,%rax
+  801a11:	00 00 00 
+  801a14:	ff d0                	call   *%rax
+  801a16:	85 c0                	test   %eax,%eax
+  801a18:	75 b6                	jne    8019d0 <strstr+0x47>
+
+	return (char *)(in - 1);
+  801a1a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a1e:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801a22:	c9                   	leave
+  801a23:	c3                   	ret
+
+0000000000801a24 <syscall>:
+ * 用户的指令式系统调用，该函数将系统调用序号放入eax寄存器，五个参数依次放入edx, ecx, ebx, edi, esi，然后执行指令int 0x30，
+ * 发生中断后，去IDT中查找中断处理函数，最终会走到kern/trap.c的trap_dispatch()中
+ */
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801a24:	55                   	push   %rbp
+  801a25:	48 89 e5             	mov    %rsp,%rbp
+  801a28:	53                   	push   %rbx
+  801a29:	48 83 ec 48          	sub    $0x48,%rsp
+  801a2d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801a30:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801a33:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801a37:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801a3b:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801a3f:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	 * volatile 告诉汇编程序不要因为不使用返回值就优化该指令
+	 * 最后一个子句告诉汇编程序，指令可能会改变条件代码cx和任意内存memory位置
+	 * 由汇编编译器做好数据保存和恢复工作(栈)
+	 */
+
+	asm volatile("int %1\n"			// code: int T_SYSCALL
+  801a43:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801a46:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801a4a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a4e:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801a52:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801a56:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801a5a:	4c 89 c3             	mov    %r8,%rbx
+  801a5d:	cd 30                	int    $0x30
+  801a5f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+				   "D"(a4),			// edi = a4
+				   "S"(a5)			// esi = a5
+				 : "cc", "memory"); // 指令可能会改变条件代码cx和任意内存memory位置
+									// 由汇编编译器做好数据保存和恢复工作(栈)
+
+	if (check && ret > 0)
+  801a63:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801a67:	74 44                	je     801aad <syscall+0x89>
+  801a69:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801a6e:	7e 3d                	jle    801aad <syscall+0x89>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a70:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a74:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801a77:	49 89 d0             	mov    %rdx,%r8
+  801a7a:	89 c1                	mov    %eax,%ecx
+  801a7c:	48 b8 c8 30 80 00 00 	movabs $0x8030c8,%rax
+  801a83:	00 00 00 
+  801a86:	48 89 c2             	mov    %rax,%rdx
+  801a89:	be 34 00 00 00       	mov    $0x34,%esi
+  801a8e:	48 b8 e5 30 80 00 00 	movabs $0x8030e5,%rax
+  801a95:	00 00 00 
+  801a98:	48 89 c7             	mov    %rax,%rdi
+  801a9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa0:	49 b9 ec 28 80 00 00 	movabs $0x8028ec,%r9
+  801aa7:	00 00 00 
+  801aaa:	41 ff d1             	call   *%r9
+
+	return ret;
+  801aad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801ab1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ab5:	c9                   	leave
+  801ab6:	c3                   	ret
+
+0000000000801ab7 <sys_cputs>:
+
+void sys_cputs(const char *s, size_t len)
+{
+  801ab7:	55                   	push   %rbp
+  801ab8:	48 89 e5             	mov    %rsp,%rbp
+  801abb:	48 83 ec 10          	sub    $0x10,%rsp
+  801abf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ac3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 调用lib/syscall.c中的syscall()
+	// SYS_cputs: 系统调用序号(eax)，s: 需要输出的字符数组，len: 数组长度
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801ac7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801acb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801acf:	48 83 ec 08          	sub    $0x8,%rsp
+  801ad3:	6a 00                	push   $0x0
+  801ad5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801adb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ae1:	48 89 d1             	mov    %rdx,%rcx
+  801ae4:	48 89 c2             	mov    %rax,%rdx
+  801ae7:	be 00 00 00 00       	mov    $0x0,%esi
+  801aec:	bf 00 00 00 00       	mov    $0x0,%edi
+  801af1:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801af8:	00 00 00 
+  801afb:	ff d0                	call   *%rax
+  801afd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801b01:	90                   	nop
+  801b02:	c9                   	leave
+  801b03:	c3                   	ret
+
+0000000000801b04 <sys_cgetc>:
+
+int sys_cgetc(void)
+{
+  801b04:	55                   	push   %rbp
+  801b05:	48 89 e5             	mov    %rsp,%rbp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801b08:	48 83 ec 08          	sub    $0x8,%rsp
+  801b0c:	6a 00                	push   $0x0
+  801b0e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b14:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b1a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b24:	be 00 00 00 00       	mov    $0x0,%esi
+  801b29:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b2e:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801b35:	00 00 00 
+  801b38:	ff d0                	call   *%rax
+  801b3a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801b3e:	c9                   	leave
+  801b3f:	c3                   	ret
+
+0000000000801b40 <sys_env_destroy>:
+
+int sys_env_destroy(envid_t envid)
+{
+  801b40:	55                   	push   %rbp
+  801b41:	48 89 e5             	mov    %rsp,%rbp
+  801b44:	48 83 ec 10          	sub    $0x10,%rsp
+  801b48:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	// 销毁envid对应的环境
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801b4b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b4e:	48 98                	cltq
+  801b50:	48 83 ec 08          	sub    $0x8,%rsp
+  801b54:	6a 00                	push   $0x0
+  801b56:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b5c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b62:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b67:	48 89 c2             	mov    %rax,%rdx
+  801b6a:	be 01 00 00 00       	mov    $0x1,%esi
+  801b6f:	bf 03 00 00 00       	mov    $0x3,%edi
+  801b74:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801b7b:	00 00 00 
+  801b7e:	ff d0                	call   *%rax
+  801b80:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801b84:	c9                   	leave
+  801b85:	c3                   	ret
+
+0000000000801b86 <sys_getprocid>:
+
+envid_t
+sys_getprocid(void)
+{
+  801b86:	55                   	push   %rbp
+  801b87:	48 89 e5             	mov    %rsp,%rbp
+	// 获取当前用户环境id
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801b8a:	48 83 ec 08          	sub    $0x8,%rsp
+  801b8e:	6a 00                	push   $0x0
+  801b90:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b96:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ba1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ba6:	be 00 00 00 00       	mov    $0x0,%esi
+  801bab:	bf 02 00 00 00       	mov    $0x2,%edi
+  801bb0:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801bb7:	00 00 00 
+  801bba:	ff d0                	call   *%rax
+  801bbc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801bc0:	c9                   	leave
+  801bc1:	c3                   	ret
+
+0000000000801bc2 <sys_yield>:
+
+void sys_yield(void)
+{
+  801bc2:	55                   	push   %rbp
+  801bc3:	48 89 e5             	mov    %rsp,%rbp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801bc6:	48 83 ec 08          	sub    $0x8,%rsp
+  801bca:	6a 00                	push   $0x0
+  801bcc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801bd2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801bd8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bdd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801be2:	be 00 00 00 00       	mov    $0x0,%esi
+  801be7:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801bec:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801bf3:	00 00 00 
+  801bf6:	ff d0                	call   *%rax
+  801bf8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801bfc:	90                   	nop
+  801bfd:	c9                   	leave
+  801bfe:	c3                   	ret
+
+0000000000801bff <sys_page_alloc>:
+
+int sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801bff:	55                   	push   %rbp
+  801c00:	48 89 e5             	mov    %rsp,%rbp
+  801c03:	48 83 ec 10          	sub    $0x10,%rsp
+  801c07:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801c0a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801c0e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  801c11:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801c14:	48 63 c8             	movslq %eax,%rcx
+  801c17:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c1b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801c1e:	48 98                	cltq
+  801c20:	48 83 ec 08          	sub    $0x8,%rsp
+  801c24:	6a 00                	push   $0x0
+  801c26:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801c2c:	49 89 c8             	mov    %rcx,%r8
+  801c2f:	48 89 d1             	mov    %rdx,%rcx
+  801c32:	48 89 c2             	mov    %rax,%rdx
+  801c35:	be 01 00 00 00       	mov    $0x1,%esi
+  801c3a:	bf 04 00 00 00       	mov    $0x4,%edi
+  801c3f:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801c46:	00 00 00 
+  801c49:	ff d0                	call   *%rax
+  801c4b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c4f:	c9                   	leave
+  801c50:	c3                   	ret
+
+0000000000801c51 <sys_page_map>:
+
+int sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801c51:	55                   	push   %rbp
+  801c52:	48 89 e5             	mov    %rsp,%rbp
+  801c55:	48 83 ec 20          	sub    $0x20,%rsp
+  801c59:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801c5c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801c60:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801c63:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801c67:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  801c6b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801c6e:	48 63 c8             	movslq %eax,%rcx
+  801c71:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  801c75:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801c78:	48 63 f0             	movslq %eax,%rsi
+  801c7b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c7f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801c82:	48 98                	cltq
+  801c84:	48 83 ec 08          	sub    $0x8,%rsp
+  801c88:	51                   	push   %rcx
+  801c89:	49 89 f9             	mov    %rdi,%r9
+  801c8c:	49 89 f0             	mov    %rsi,%r8
+  801c8f:	48 89 d1             	mov    %rdx,%rcx
+  801c92:	48 89 c2             	mov    %rax,%rdx
+  801c95:	be 01 00 00 00       	mov    $0x1,%esi
+  801c9a:	bf 05 00 00 00       	mov    $0x5,%edi
+  801c9f:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801ca6:	00 00 00 
+  801ca9:	ff d0                	call   *%rax
+  801cab:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801caf:	c9                   	leave
+  801cb0:	c3                   	ret
+
+0000000000801cb1 <sys_page_unmap>:
+
+int sys_page_unmap(envid_t envid, void *va)
+{
+  801cb1:	55                   	push   %rbp
+  801cb2:	48 89 e5             	mov    %rsp,%rbp
+  801cb5:	48 83 ec 10          	sub    $0x10,%rsp
+  801cb9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801cbc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  801cc0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801cc4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801cc7:	48 98                	cltq
+  801cc9:	48 83 ec 08          	sub    $0x8,%rsp
+  801ccd:	6a 00                	push   $0x0
+  801ccf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801cd5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801cdb:	48 89 d1             	mov    %rdx,%rcx
+  801cde:	48 89 c2             	mov    %rax,%rdx
+  801ce1:	be 01 00 00 00       	mov    $0x1,%esi
+  801ce6:	bf 06 00 00 00       	mov    $0x6,%edi
+  801ceb:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801cf2:	00 00 00 
+  801cf5:	ff d0                	call   *%rax
+  801cf7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801cfb:	c9                   	leave
+  801cfc:	c3                   	ret
+
+0000000000801cfd <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int sys_env_set_status(envid_t envid, int status)
+{
+  801cfd:	55                   	push   %rbp
+  801cfe:	48 89 e5             	mov    %rsp,%rbp
+  801d01:	48 83 ec 10          	sub    $0x10,%rsp
+  801d05:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801d08:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801d0b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801d0e:	48 63 d0             	movslq %eax,%rdx
+  801d11:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d14:	48 98                	cltq
+  801d16:	48 83 ec 08          	sub    $0x8,%rsp
+  801d1a:	6a 00                	push   $0x0
+  801d1c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d22:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d28:	48 89 d1             	mov    %rdx,%rcx
+  801d2b:	48 89 c2             	mov    %rax,%rdx
+  801d2e:	be 01 00 00 00       	mov    $0x1,%esi
+  801d33:	bf 08 00 00 00       	mov    $0x8,%edi
+  801d38:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801d3f:	00 00 00 
+  801d42:	ff d0                	call   *%rax
+  801d44:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d48:	c9                   	leave
+  801d49:	c3                   	ret
+
+0000000000801d4a <sys_env_set_trapframe>:
+
+int sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801d4a:	55                   	push   %rbp
+  801d4b:	48 89 e5             	mov    %rsp,%rbp
+  801d4e:	48 83 ec 10          	sub    $0x10,%rsp
+  801d52:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801d55:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  801d59:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d5d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d60:	48 98                	cltq
+  801d62:	48 83 ec 08          	sub    $0x8,%rsp
+  801d66:	6a 00                	push   $0x0
+  801d68:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d6e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d74:	48 89 d1             	mov    %rdx,%rcx
+  801d77:	48 89 c2             	mov    %rax,%rdx
+  801d7a:	be 01 00 00 00       	mov    $0x1,%esi
+  801d7f:	bf 09 00 00 00       	mov    $0x9,%edi
+  801d84:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801d8b:	00 00 00 
+  801d8e:	ff d0                	call   *%rax
+  801d90:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d94:	c9                   	leave
+  801d95:	c3                   	ret
+
+0000000000801d96 <sys_env_set_pgfault_upcall>:
+
+int sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801d96:	55                   	push   %rbp
+  801d97:	48 89 e5             	mov    %rsp,%rbp
+  801d9a:	48 83 ec 10          	sub    $0x10,%rsp
+  801d9e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801da1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  801da5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801da9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801dac:	48 98                	cltq
+  801dae:	48 83 ec 08          	sub    $0x8,%rsp
+  801db2:	6a 00                	push   $0x0
+  801db4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801dba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801dc0:	48 89 d1             	mov    %rdx,%rcx
+  801dc3:	48 89 c2             	mov    %rax,%rdx
+  801dc6:	be 01 00 00 00       	mov    $0x1,%esi
+  801dcb:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801dd0:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801dd7:	00 00 00 
+  801dda:	ff d0                	call   *%rax
+  801ddc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801de0:	c9                   	leave
+  801de1:	c3                   	ret
+
+0000000000801de2 <sys_ipc_try_send>:
+
+int sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  801de2:	55                   	push   %rbp
+  801de3:	48 89 e5             	mov    %rsp,%rbp
+  801de6:	48 83 ec 20          	sub    $0x20,%rsp
+  801dea:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801ded:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801df1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801df5:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  801df8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801dfb:	48 63 f0             	movslq %eax,%rsi
+  801dfe:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801e02:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e05:	48 98                	cltq
+  801e07:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e0b:	48 83 ec 08          	sub    $0x8,%rsp
+  801e0f:	6a 00                	push   $0x0
+  801e11:	49 89 f1             	mov    %rsi,%r9
+  801e14:	49 89 c8             	mov    %rcx,%r8
+  801e17:	48 89 d1             	mov    %rdx,%rcx
+  801e1a:	48 89 c2             	mov    %rax,%rdx
+  801e1d:	be 00 00 00 00       	mov    $0x0,%esi
+  801e22:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801e27:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801e2e:	00 00 00 
+  801e31:	ff d0                	call   *%rax
+  801e33:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e37:	c9                   	leave
+  801e38:	c3                   	ret
+
+0000000000801e39 <sys_ipc_recv>:
+
+int sys_ipc_recv(void *dstva)
+{
+  801e39:	55                   	push   %rbp
+  801e3a:	48 89 e5             	mov    %rsp,%rbp
+  801e3d:	48 83 ec 10          	sub    $0x10,%rsp
+  801e41:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  801e45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e49:	48 83 ec 08          	sub    $0x8,%rsp
+  801e4d:	6a 00                	push   $0x0
+  801e4f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e55:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e5b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e60:	48 89 c2             	mov    %rax,%rdx
+  801e63:	be 01 00 00 00       	mov    $0x1,%esi
+  801e68:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801e6d:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801e74:	00 00 00 
+  801e77:	ff d0                	call   *%rax
+  801e79:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e7d:	c9                   	leave
+  801e7e:	c3                   	ret
+
+0000000000801e7f <sys_disk_io>:
+
+int sys_disk_io(int dev, uint64_t secno, void *va, size_t nsecs, int write)
+{
+  801e7f:	55                   	push   %rbp
+  801e80:	48 89 e5             	mov    %rsp,%rbp
+  801e83:	48 83 ec 20          	sub    $0x20,%rsp
+  801e87:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e8a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801e8e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801e92:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  801e96:	44 89 45 f8          	mov    %r8d,-0x8(%rbp)
+	return syscall(SYS_disk_io, 0, dev, secno, (uint64_t)va, nsecs, write);
+  801e9a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801e9d:	48 63 c8             	movslq %eax,%rcx
+  801ea0:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  801ea4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ea7:	48 98                	cltq
+  801ea9:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  801ead:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801eb1:	48 83 ec 08          	sub    $0x8,%rsp
+  801eb5:	51                   	push   %rcx
+  801eb6:	49 89 f9             	mov    %rdi,%r9
+  801eb9:	49 89 f0             	mov    %rsi,%r8
+  801ebc:	48 89 d1             	mov    %rdx,%rcx
+  801ebf:	48 89 c2             	mov    %rax,%rdx
+  801ec2:	be 00 00 00 00       	mov    $0x0,%esi
+  801ec7:	bf 0e 00 00 00       	mov    $0xe,%edi
+  801ecc:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801ed3:	00 00 00 
+  801ed6:	ff d0                	call   *%rax
+  801ed8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801edc:	c9                   	leave
+  801edd:	c3                   	ret
+
+0000000000801ede <sys_vma_alloc>:
+
+int sys_vma_alloc(envid_t envid, void *va, size_t len, int perm)
+{
+  801ede:	55                   	push   %rbp
+  801edf:	48 89 e5             	mov    %rsp,%rbp
+  801ee2:	48 83 ec 20          	sub    $0x20,%rsp
+  801ee6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801ee9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801eed:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801ef1:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_vma_alloc, 1, envid, (uint64_t)va, len, perm, 0);
+  801ef4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801ef7:	48 63 f0             	movslq %eax,%rsi
+  801efa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801efe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f01:	48 98                	cltq
+  801f03:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801f07:	48 83 ec 08          	sub    $0x8,%rsp
+  801f0b:	6a 00                	push   $0x0
+  801f0d:	49 89 f1             	mov    %rsi,%r9
+  801f10:	49 89 c8             	mov    %rcx,%r8
+  801f13:	48 89 d1             	mov    %rdx,%rcx
+  801f16:	48 89 c2             	mov    %rax,%rdx
+  801f19:	be 01 00 00 00       	mov    $0x1,%esi
+  801f1e:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801f23:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801f2a:	00 00 00 
+  801f2d:	ff d0                	call   *%rax
+  801f2f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f33:	c9                   	leave
+  801f34:	c3                   	ret
+
+0000000000801f35 <sys_vma_clear>:
+
+int sys_vma_clear(envid_t envid)
+{
+  801f35:	55                   	push   %rbp
+  801f36:	48 89 e5             	mov    %rsp,%rbp
+  801f39:	48 83 ec 10          	sub    $0x10,%rsp
+  801f3d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_vma_clear, 1, envid, 0, 0, 0, 0);
+  801f40:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f43:	48 98                	cltq
+  801f45:	48 83 ec 08          	sub    $0x8,%rsp
+  801f49:	6a 00                	push   $0x0
+  801f4b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f51:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f57:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f5c:	48 89 c2             	mov    %rax,%rdx
+  801f5f:	be 01 00 00 00       	mov    $0x1,%esi
+  801f64:	bf 10 00 00 00       	mov    $0x10,%edi
+  801f69:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801f70:	00 00 00 
+  801f73:	ff d0                	call   *%rax
+  801f75:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f79:	c9                   	leave
+  801f7a:	c3                   	ret
+
+0000000000801f7b <sys_trace_ctl>:
+
+int sys_trace_ctl(int enable)
+{
+  801f7b:	55                   	push   %rbp
+  801f7c:	48 89 e5             	mov    %rsp,%rbp
+  801f7f:	48 83 ec 10          	sub    $0x10,%rsp
+  801f83:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_trace_ctl, 0, enable, 0, 0, 0, 0);
+  801f86:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f89:	48 98                	cltq
+  801f8b:	48 83 ec 08          	sub    $0x8,%rsp
+  801f8f:	6a 00                	push   $0x0
+  801f91:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f97:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fa2:	48 89 c2             	mov    %rax,%rdx
+  801fa5:	be 00 00 00 00       	mov    $0x0,%esi
+  801faa:	bf 11 00 00 00       	mov    $0x11,%edi
+  801faf:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801fb6:	00 00 00 
+  801fb9:	ff d0                	call   *%rax
+  801fbb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fbf:	c9                   	leave
+  801fc0:	c3                   	ret
+
+0000000000801fc1 <sys_trace_read>:
+
+int sys_trace_read(int cpu, uint64_t *seq, struct TraceEvent *buf, int n)
+{
+  801fc1:	55                   	push   %rbp
+  801fc2:	48 89 e5             	mov    %rsp,%rbp
+  801fc5:	48 83 ec 20          	sub    $0x20,%rsp
+  801fc9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801fcc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801fd0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801fd4:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_trace_read, 0, cpu, (uint64_t)seq, (uint64_t)buf, n, 0);
+  801fd7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801fda:	48 63 f0             	movslq %eax,%rsi
+  801fdd:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801fe1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801fe5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fe8:	48 98                	cltq
+  801fea:	48 83 ec 08          	sub    $0x8,%rsp
+  801fee:	6a 00                	push   $0x0
+  801ff0:	49 89 f1             	mov    %rsi,%r9
+  801ff3:	49 89 c8             	mov    %rcx,%r8
+  801ff6:	48 89 d1             	mov    %rdx,%rcx
+  801ff9:	48 89 c2             	mov    %rax,%rdx
+  801ffc:	be 00 00 00 00       	mov    $0x0,%esi
+  802001:	bf 12 00 00 00       	mov    $0x12,%edi
+  802006:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  80200d:	00 00 00 
+  802010:	ff d0                	call   *%rax
+  802012:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802016:	c9                   	leave
+  802017:	c3                   	ret
+
+0000000000802018 <sys_getrusage>:
+
+int sys_getrusage(envid_t envid, struct Rusage *ru)
+{
+  802018:	55                   	push   %rbp
+  802019:	48 89 e5             	mov    %rsp,%rbp
+  80201c:	48 83 ec 10          	sub    $0x10,%rsp
+  802020:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802023:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_getrusage, 0, envid, (uint64_t)ru, 0, 0, 0);
+  802027:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80202b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80202e:	48 98                	cltq
+  802030:	48 83 ec 08          	sub    $0x8,%rsp
+  802034:	6a 00                	push   $0x0
+  802036:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80203c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802042:	48 89 d1             	mov    %rdx,%rcx
+  802045:	48 89 c2             	mov    %rax,%rdx
+  802048:	be 00 00 00 00       	mov    $0x0,%esi
+  80204d:	bf 13 00 00 00       	mov    $0x13,%edi
+  802052:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  802059:	00 00 00 
+  80205c:	ff d0                	call   *%rax
+  80205e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802062:	c9                   	leave
+  802063:	c3                   	ret
+
+0000000000802064 <sys_pmu_config>:
+
+int sys_pmu_config(int idx, uint64_t event)
+{
+  802064:	55                   	push   %rbp
+  802065:	48 89 e5             	mov    %rsp,%rbp
+  802068:	48 83 ec 10          	sub    $0x10,%rsp
+  80206c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80206f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_pmu_config, 0, idx, event, 0, 0, 0);
+  802073:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802076:	48 98                	cltq
+  802078:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80207c:	48 83 ec 08          	sub    $0x8,%rsp
+  802080:	6a 00                	push   $0x0
+  802082:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802088:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80208e:	48 89 d1             	mov    %rdx,%rcx
+  802091:	48 89 c2             	mov    %rax,%rdx
+  802094:	be 00 00 00 00       	mov    $0x0,%esi
+  802099:	bf 14 00 00 00       	mov    $0x14,%edi
+  80209e:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  8020a5:	00 00 00 
+  8020a8:	ff d0                	call   *%rax
+  8020aa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020ae:	c9                   	leave
+  8020af:	c3                   	ret
+
+00000000008020b0 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  8020b0:	55                   	push   %rbp
+  8020b1:	48 89 e5             	mov    %rsp,%rbp
+  8020b4:	48 83 ec 10          	sub    $0x10,%rsp
+  8020b8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+  8020bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020be:	48 83 ec 08          	sub    $0x8,%rsp
+  8020c2:	6a 00                	push   $0x0
+  8020c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020d5:	48 89 c2             	mov    %rax,%rdx
+  8020d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8020dd:	bf 15 00 00 00       	mov    $0x15,%edi
+  8020e2:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  8020e9:	00 00 00 
+  8020ec:	ff d0                	call   *%rax
+  8020ee:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020f2:	c9                   	leave
+  8020f3:	c3                   	ret
+
+00000000008020f4 <sys_image_attach>:
+
+int sys_image_attach(envid_t envid, int dev, const uint64_t *secnos, size_t size)
+{
+  8020f4:	55                   	push   %rbp
+  8020f5:	48 89 e5             	mov    %rsp,%rbp
+  8020f8:	48 83 ec 20          	sub    $0x20,%rsp
+  8020fc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020ff:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  802102:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  802106:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+	return syscall(SYS_image_attach, 1, envid, dev, (uint64_t)secnos, size, 0);
+  80210a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80210e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802111:	48 63 d0             	movslq %eax,%rdx
+  802114:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802117:	48 98                	cltq
+  802119:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80211d:	48 83 ec 08          	sub    $0x8,%rsp
+  802121:	6a 00                	push   $0x0
+  802123:	49 89 f1             	mov    %rsi,%r9
+  802126:	49 89 c8             	mov    %rcx,%r8
+  802129:	48 89 d1             	mov    %rdx,%rcx
+  80212c:	48 89 c2             	mov    %rax,%rdx
+  80212f:	be 01 00 00 00       	mov    $0x1,%esi
+  802134:	bf 16 00 00 00       	mov    $0x16,%edi
+  802139:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  802140:	00 00 00 
+  802143:	ff d0                	call   *%rax
+  802145:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802149:	c9                   	leave
+  80214a:	c3                   	ret
+
+000000000080214b <sys_vma_binary>:
+
+int sys_vma_binary(envid_t envid, const struct Proghdr *ph)
+{
+  80214b:	55                   	push   %rbp
+  80214c:	48 89 e5             	mov    %rsp,%rbp
+  80214f:	48 83 ec 10          	sub    $0x10,%rsp
+  802153:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802156:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_vma_binary, 1, envid, (uint64_t)ph, 0, 0, 0);
+  80215a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80215e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802161:	48 98                	cltq
+  802163:	48 83 ec 08          	sub    $0x8,%rsp
+  802167:	6a 00                	push   $0x0
+  802169:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80216f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802175:	48 89 d1             	mov    %rdx,%rcx
+  802178:	48 89 c2             	mov    %rax,%rdx
+  80217b:	be 01 00 00 00       	mov    $0x1,%esi
+  802180:	bf 17 00 00 00       	mov    $0x17,%edi
+  802185:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  80218c:	00 00 00 
+  80218f:	ff d0                	call   *%rax
+  802191:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802195:	c9                   	leave
+  802196:	c3                   	ret
+
+0000000000802197 <pgfault>:
+ * 自定义页错误处理函数.
+ * 当出现页错误，主要是对标志为可写的或者COW的物理页分配新页，复制旧页的数据到新页并映射到旧页的地址空间
+ */
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802197:	55                   	push   %rbp
+  802198:	48 89 e5             	mov    %rsp,%rbp
+  80219b:	48 83 ec 40          	sub    $0x40,%rsp
+  80219f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	void *addr = (void *)utf->utf_fault_va;
+  8021a3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021a7:	48 8b 00             	mov    (%rax),%rax
+  8021aa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint32_t err = utf->utf_err;
+  8021ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021b2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8021b6:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	int r;
+
+	// 检查出错的访问(1)写，(2)COW页.  若不是，调用panic().
+	// pte_t entry = uvpt[VPN(addr)];
+	// 分配一个新页，将其映射到临时位置(PFTEMP)，将旧页数据复制到新页，然后将新页移动到旧页的地址.
+	if ((err & FEC_WR) && (uvpt[VPN(addr)] & PTE_COW))
+  8021b9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8021bc:	83 e0 02             	and    $0x2,%eax
+  8021bf:	85 c0                	test   %eax,%eax
+  8021c1:	0f 84 61 01 00 00    	je     802328 <pgfault+0x191>
+  8021c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021cb:	48 c1 e8 0c          	shr    $0xc,%rax
+  8021cf:	48 89 c2             	mov    %rax,%rdx
+  8021d2:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8021d9:	01 00 00 
+  8021dc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8021e0:	25 00 08 00 00       	and    $0x800,%eax
+  8021e5:	48 85 c0             	test   %rax,%rax
+  8021e8:	0f 84 3a 01 00 00    	je     802328 <pgfault+0x191>
+	{
+		if (sys_page_alloc(0, (void *)PFTEMP, PTE_U | PTE_P | PTE_W) == 0)
+  8021ee:	ba 07 00 00 00       	mov    $0x7,%edx
+  8021f3:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8021f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021fd:	48 b8 ff 1b 80 00 00 	movabs $0x801bff,%rax
+  802204:	00 00 00 
+  802207:	ff d0                	call   *%rax
+  802209:	85 c0                	test   %eax,%eax
+  80220b:	0f 85 e7 00 00 00    	jne    8022f8 <pgfault+0x161>
+		{
+			// 分配了新的物理页以后准备从原页面开始拷贝数据时，记得将地址和物理页大小对齐
+			void *pg_addr = ROUNDDOWN(addr, PGSIZE);
+  802211:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802215:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  802219:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80221d:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802223:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+			memmove(PFTEMP, pg_addr, PGSIZE);
+  802227:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80222b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802230:	48 89 c6             	mov    %rax,%rsi
+  802233:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  802238:	48 b8 26 16 80 00 00 	movabs $0x801626,%rax
+  80223f:	00 00 00 
+  802242:	ff d0                	call   *%rax
+			r = sys_page_map(0, (void *)PFTEMP, 0, pg_addr, PTE_U | PTE_W | PTE_P);
+  802244:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802248:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  80224e:	48 89 c1             	mov    %rax,%rcx
+  802251:	ba 00 00 00 00       	mov    $0x0,%edx
+  802256:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  80225b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802260:	48 b8 51 1c 80 00 00 	movabs $0x801c51,%rax
+  802267:	00 00 00 
+  80226a:	ff d0                	call   *%rax
+  80226c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			if (r < 0)
+  80226f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  802273:	79 30                	jns    8022a5 <pgfault+0x10e>
+			{
+				panic("pgfault...something wrong with page_map");
+  802275:	48 b8 f8 30 80 00 00 	movabs $0x8030f8,%rax
+  80227c:	00 00 00 
+  80227f:	48 89 c2             	mov    %rax,%rdx
+  802282:	be 22 00 00 00       	mov    $0x22,%esi
+  802287:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  80228e:	00 00 00 
+  802291:	48 89 c7             	mov    %rax,%rdi
+  802294:	b8 00 00 00 00       	mov    $0x0,%eax
+  802299:	48 b9 ec 28 80 00 00 	movabs $0x8028ec,%rcx
+  8022a0:	00 00 00 
+  8022a3:	ff d1                	call   *%rcx
+			}
+			r = sys_page_unmap(0, PFTEMP);
+  8022a5:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8022aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022af:	48 b8 b1 1c 80 00 00 	movabs $0x801cb1,%rax
+  8022b6:	00 00 00 
+  8022b9:	ff d0                	call   *%rax
+  8022bb:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			if (r < 0)
+  8022be:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8022c2:	0f 89 96 00 00 00    	jns    80235e <pgfault+0x1c7>
+			{
+				panic("pgfault...something wrong with page_unmap");
+  8022c8:	48 b8 30 31 80 00 00 	movabs $0x803130,%rax
+  8022cf:	00 00 00 
+  8022d2:	48 89 c2             	mov    %rax,%rdx
+  8022d5:	be 27 00 00 00       	mov    $0x27,%esi
+  8022da:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  8022e1:	00 00 00 
+  8022e4:	48 89 c7             	mov    %rax,%rdi
+  8022e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ec:	48 b9 ec 28 80 00 00 	movabs $0x8028ec,%rcx
+  8022f3:	00 00 00 
+  8022f6:	ff d1                	call   *%rcx
+			}
+			return;
+		}
+		else
+		{
+			panic("pgfault...something wrong with page_alloc");
+  8022f8:	48 b8 60 31 80 00 00 	movabs $0x803160,%rax
+  8022ff:	00 00 00 
+  802302:	48 89 c2             	mov    %rax,%rdx
+  802305:	be 2d 00 00 00       	mov    $0x2d,%esi
+  80230a:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  802311:	00 00 00 
+  802314:	48 89 c7             	mov    %rax,%rdi
+  802317:	b8 00 00 00 00       	mov    $0x0,%eax
+  80231c:	48 b9 ec 28 80 00 00 	movabs $0x8028ec,%rcx
+  802323:	00 00 00 
+  802326:	ff d1                	call   *%rcx
+		}
+	}
+	else
+	{
+		panic("pgfault...wrong error %e", err);
+  802328:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80232b:	89 c1                	mov    %eax,%ecx
+  80232d:	48 b8 8a 31 80 00 00 	movabs $0x80318a,%rax
+  802334:	00 00 00 
+  802337:	48 89 c2             	mov    %rax,%rdx
+  80233a:	be 32 00 00 00       	mov    $0x32,%esi
+  80233f:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  802346:	00 00 00 
+  802349:	48 89 c7             	mov    %rax,%rdi
+  80234c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802351:	49 b8 ec 28 80 00 00 	movabs $0x8028ec,%r8
+  802358:	00 00 00 
+  80235b:	41 ff d0             	call   *%r8
+			return;
+  80235e:	90                   	nop
+	}
+}
+  80235f:	c9                   	leave
+  802360:	c3                   	ret
+
+0000000000802361 <duppage>:
+ * 映射: 将的虚拟页pn(地址: pn*PGSIZE)映射到相同虚拟地址的 envid 中.
+ * 成功: 返回0，失败调用 panic()
+ */
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  802361:	55                   	push   %rbp
+  802362:	48 89 e5             	mov    %rsp,%rbp
+  802365:	48 83 ec 30          	sub    $0x30,%rsp
+  802369:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80236c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	pte_t entry = uvpt[pn];
+  80236f:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802376:	01 00 00 
+  802379:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80237c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802380:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	void *addr = (void *)((uintptr_t)pn * PGSIZE);
+  802384:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802387:	48 c1 e0 0c          	shl    $0xc,%rax
+  80238b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	int perm = entry & PTE_SYSCALL;
+  80238f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802393:	25 07 0e 00 00       	and    $0xe07,%eax
+  802398:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm & PTE_SHARE)
+  80239b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80239e:	25 00 04 00 00       	and    $0x400,%eax
+  8023a3:	85 c0                	test   %eax,%eax
+  8023a5:	74 68                	je     80240f <duppage+0xae>
+	{
+		r = sys_page_map(0, addr, envid, addr, perm);
+  8023a7:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8023aa:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023ae:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8023b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8023b5:	41 89 f0             	mov    %esi,%r8d
+  8023b8:	48 89 c6             	mov    %rax,%rsi
+  8023bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023c0:	48 b8 51 1c 80 00 00 	movabs $0x801c51,%rax
+  8023c7:	00 00 00 
+  8023ca:	ff d0                	call   *%rax
+  8023cc:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  8023cf:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8023d3:	0f 89 90 01 00 00    	jns    802569 <duppage+0x208>
+		{
+			panic("Something went wrong on duppage %e", r);
+  8023d9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8023dc:	89 c1                	mov    %eax,%ecx
+  8023de:	48 b8 a8 31 80 00 00 	movabs $0x8031a8,%rax
+  8023e5:	00 00 00 
+  8023e8:	48 89 c2             	mov    %rax,%rdx
+  8023eb:	be 48 00 00 00       	mov    $0x48,%esi
+  8023f0:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  8023f7:	00 00 00 
+  8023fa:	48 89 c7             	mov    %rax,%rdi
+  8023fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802402:	49 b8 ec 28 80 00 00 	movabs $0x8028ec,%r8
+  802409:	00 00 00 
+  80240c:	41 ff d0             	call   *%r8
+		}
+	}
+	else if ((perm & PTE_COW) || (perm & PTE_W))
+  80240f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802412:	25 00 08 00 00       	and    $0x800,%eax
+  802417:	85 c0                	test   %eax,%eax
+  802419:	75 0e                	jne    802429 <duppage+0xc8>
+  80241b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80241e:	83 e0 02             	and    $0x2,%eax
+  802421:	85 c0                	test   %eax,%eax
+  802423:	0f 84 dc 00 00 00    	je     802505 <duppage+0x1a4>
+	{
+		perm &= ~PTE_W;
+  802429:	83 65 ec fd          	andl   $0xfffffffd,-0x14(%rbp)
+		perm |= PTE_COW;
+  80242d:	81 4d ec 00 08 00 00 	orl    $0x800,-0x14(%rbp)
+		r = sys_page_map(0, addr, envid, addr, perm);
+  802434:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  802437:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80243b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80243e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802442:	41 89 f0             	mov    %esi,%r8d
+  802445:	48 89 c6             	mov    %rax,%rsi
+  802448:	bf 00 00 00 00       	mov    $0x0,%edi
+  80244d:	48 b8 51 1c 80 00 00 	movabs $0x801c51,%rax
+  802454:	00 00 00 
+  802457:	ff d0                	call   *%rax
+  802459:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  80245c:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802460:	79 36                	jns    802498 <duppage+0x137>
+		{
+			panic("Something went wrong on duppage %e", r);
+  802462:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802465:	89 c1                	mov    %eax,%ecx
+  802467:	48 b8 a8 31 80 00 00 	movabs $0x8031a8,%rax
+  80246e:	00 00 00 
+  802471:	48 89 c2             	mov    %rax,%rdx
+  802474:	be 52 00 00 00       	mov    $0x52,%esi
+  802479:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  802480:	00 00 00 
+  802483:	48 89 c7             	mov    %rax,%rdi
+  802486:	b8 00 00 00 00       	mov    $0x0,%eax
+  80248b:	49 b8 ec 28 80 00 00 	movabs $0x8028ec,%r8
+  802492:	00 00 00 
+  802495:	41 ff d0             	call   *%r8
+		}
+		r = sys_page_map(0, addr, 0, addr, perm);
+  802498:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  80249b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80249f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8024a3:	41 89 c8             	mov    %ecx,%r8d
+  8024a6:	48 89 d1             	mov    %rdx,%rcx
+  8024a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ae:	48 89 c6             	mov    %rax,%rsi
+  8024b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024b6:	48 b8 51 1c 80 00 00 	movabs $0x801c51,%rax
+  8024bd:	00 00 00 
+  8024c0:	ff d0                	call   *%rax
+  8024c2:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  8024c5:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8024c9:	0f 89 9a 00 00 00    	jns    802569 <duppage+0x208>
+		{
+			panic("Something went wrong on duppage %e", r);
+  8024cf:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8024d2:	89 c1                	mov    %eax,%ecx
+  8024d4:	48 b8 a8 31 80 00 00 	movabs $0x8031a8,%rax
+  8024db:	00 00 00 
+  8024de:	48 89 c2             	mov    %rax,%rdx
+  8024e1:	be 57 00 00 00       	mov    $0x57,%esi
+  8024e6:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  8024ed:	00 00 00 
+  8024f0:	48 89 c7             	mov    %rax,%rdi
+  8024f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024f8:	49 b8 ec 28 80 00 00 	movabs $0x8028ec,%r8
+  8024ff:	00 00 00 
+  802502:	41 ff d0             	call   *%r8
+		}
+	}
+	else
+	{
+		r = sys_page_map(0, addr, envid, addr, perm);
+  802505:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  802508:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80250c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80250f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802513:	41 89 f0             	mov    %esi,%r8d
+  802516:	48 89 c6             	mov    %rax,%rsi
+  802519:	bf 00 00 00 00       	mov    $0x0,%edi
+  80251e:	48 b8 51 1c 80 00 00 	movabs $0x801c51,%rax
+  802525:	00 00 00 
+  802528:	ff d0                	call   *%rax
+  80252a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  80252d:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802531:	79 36                	jns    802569 <duppage+0x208>
+		{
+			panic("Something went wrong on duppage %e", r);
+  802533:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802536:	89 c1                	mov    %eax,%ecx
+  802538:	48 b8 a8 31 80 00 00 	movabs $0x8031a8,%rax
+  80253f:	00 00 00 
+  802542:	48 89 c2             	mov    %rax,%rdx
+  802545:	be 5f 00 00 00       	mov    $0x5f,%esi
+  80254a:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  802551:	00 00 00 
+  802554:	48 89 c7             	mov    %rax,%rdi
+  802557:	b8 00 00 00 00       	mov    $0x0,%eax
+  80255c:	49 b8 ec 28 80 00 00 	movabs $0x8028ec,%r8
+  802563:	00 00 00 
+  802566:	41 ff d0             	call   *%r8
+		}
+	}
+	return 0;
+  802569:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80256e:	c9                   	leave
+  80256f:	c3                   	ret
+
+0000000000802570 <fork>:
+ * 
+ * 两个用户异常栈都不应该被标记为COW，所以必须为子环境的异常栈分配一个新页
+ */
+envid_t
+fork(void)
+{
+  802570:	55                   	push   %rbp
+  802571:	48 89 e5             	mov    %rsp,%rbp
+  802574:	48 83 ec 50          	sub    $0x50,%rsp
+	int r = 0;
+  802578:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	set_pgfault_handler(pgfault);
+  80257f:	48 b8 97 21 80 00 00 	movabs $0x802197,%rax
+  802586:	00 00 00 
+  802589:	48 89 c7             	mov    %rax,%rdi
+  80258c:	48 b8 06 2a 80 00 00 	movabs $0x802a06,%rax
+  802593:	00 00 00 
+  802596:	ff d0                	call   *%rax
+// 必须内联.
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  802598:	b8 07 00 00 00       	mov    $0x7,%eax
+  80259d:	cd 30                	int    $0x30
+  80259f:	89 45 bc             	mov    %eax,-0x44(%rbp)
+					 : "=a"(ret)
+					 : "a"(SYS_exofork),
+					   "i"(T_SYSCALL));
+	return ret;
+  8025a2:	8b 45 bc             	mov    -0x44(%rbp),%eax
+	envid_t childid = sys_exofork();
+  8025a5:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	if (childid < 0)
+  8025a8:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  8025ac:	79 36                	jns    8025e4 <fork+0x74>
+	{
+		panic("\n couldn't call fork %e\n", childid);
+  8025ae:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8025b1:	89 c1                	mov    %eax,%ecx
+  8025b3:	48 b8 cb 31 80 00 00 	movabs $0x8031cb,%rax
+  8025ba:	00 00 00 
+  8025bd:	48 89 c2             	mov    %rax,%rdx
+  8025c0:	be 7a 00 00 00       	mov    $0x7a,%esi
+  8025c5:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  8025cc:	00 00 00 
+  8025cf:	48 89 c7             	mov    %rax,%rdi
+  8025d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025d7:	49 b8 ec 28 80 00 00 	movabs $0x8028ec,%r8
+  8025de:	00 00 00 
+  8025e1:	41 ff d0             	call   *%r8
+	}
+	if (childid == 0)
+  8025e4:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  8025e8:	75 3e                	jne    802628 <fork+0xb8>
+	{
+		// thisproc 父进程
+		thisproc = &procs[ENVX(sys_getprocid())];
+  8025ea:	48 b8 86 1b 80 00 00 	movabs $0x801b86,%rax
+  8025f1:	00 00 00 
+  8025f4:	ff d0                	call   *%rax
+  8025f6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8025fb:	48 98                	cltq
+  8025fd:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  802604:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  80260b:	00 00 00 
+  80260e:	48 01 c2             	add    %rax,%rdx
+  802611:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  802618:	00 00 00 
+  80261b:	48 89 10             	mov    %rdx,(%rax)
+		// 子环境的返回值
+		return 0;
+  80261e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802623:	e9 c2 02 00 00       	jmp    8028ea <fork+0x37a>
+	}
+	r = sys_page_alloc(childid, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_W | PTE_U);
+  802628:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80262b:	ba 07 00 00 00       	mov    $0x7,%edx
+  802630:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  802635:	48 89 ce             	mov    %rcx,%rsi
+  802638:	89 c7                	mov    %eax,%edi
+  80263a:	48 b8 ff 1b 80 00 00 	movabs $0x801bff,%rax
+  802641:	00 00 00 
+  802644:	ff d0                	call   *%rax
+  802646:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if (r < 0)
+  802649:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  80264d:	79 36                	jns    802685 <fork+0x115>
+		panic("\n couldn't call fork %e\n", r);
+  80264f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802652:	89 c1                	mov    %eax,%ecx
+  802654:	48 b8 cb 31 80 00 00 	movabs $0x8031cb,%rax
+  80265b:	00 00 00 
+  80265e:	48 89 c2             	mov    %rax,%rdx
+  802661:	be 85 00 00 00       	mov    $0x85,%esi
+  802666:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  80266d:	00 00 00 
+  802670:	48 89 c7             	mov    %rax,%rdi
+  802673:	b8 00 00 00 00       	mov    $0x0,%eax
+  802678:	49 b8 ec 28 80 00 00 	movabs $0x8028ec,%r8
+  80267f:	00 00 00 
+  802682:	41 ff d0             	call   *%r8
+
+	uint64_t pml;
+	uint64_t pdpe;
+	uint64_t pde;
+	uint64_t pte;
+	uint64_t each_pde = 0;
+  802685:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80268c:	00 
+	uint64_t each_pte = 0;
+  80268d:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  802694:	00 
+	uint64_t each_pdpe = 0;
+  802695:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80269c:	00 
+
+	// 拷贝[0, UXSTACKTOP)的所有用户页，接下来为用户异常栈创建物理页
+	// 因为在创建用户环境时，已经在 env_setup_vm() 中映射了内核所有页
+	for (pml = 0; pml < VPML4E(UTOP); pml++)
+  80269d:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8026a4:	00 
+  8026a5:	e9 80 01 00 00       	jmp    80282a <fork+0x2ba>
+	{
+		if (uvpml4e[pml] & PTE_P)
+  8026aa:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8026b1:	01 00 00 
+  8026b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026b8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8026bc:	83 e0 01             	and    $0x1,%eax
+  8026bf:	48 85 c0             	test   %rax,%rax
+  8026c2:	0f 84 4d 01 00 00    	je     802815 <fork+0x2a5>
+		{
+
+			for (pdpe = 0; pdpe < NPDPENTRIES; pdpe++, each_pdpe++)
+  8026c8:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8026cf:	00 
+  8026d0:	e9 30 01 00 00       	jmp    802805 <fork+0x295>
+			{
+				if (uvpde[each_pdpe] & PTE_P)
+  8026d5:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8026dc:	01 00 00 
+  8026df:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026e3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8026e7:	83 e0 01             	and    $0x1,%eax
+  8026ea:	48 85 c0             	test   %rax,%rax
+  8026ed:	0f 84 f8 00 00 00    	je     8027eb <fork+0x27b>
+				{
+
+					for (pde = 0; pde < NPDENTRIES; pde++, each_pde++)
+  8026f3:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8026fa:	00 
+  8026fb:	e9 db 00 00 00       	jmp    8027db <fork+0x26b>
+					{
+						if (uvpd[each_pde] & PTE_P)
+  802700:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802707:	01 00 00 
+  80270a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80270e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802712:	83 e0 01             	and    $0x1,%eax
+  802715:	48 85 c0             	test   %rax,%rax
+  802718:	0f 84 a3 00 00 00    	je     8027c1 <fork+0x251>
+						{
+
+							for (pte = 0; pte < NPTENTRIES; pte++, each_pte++)
+  80271e:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  802725:	00 
+  802726:	e9 86 00 00 00       	jmp    8027b1 <fork+0x241>
+							{
+								if (uvpt[each_pte] & PTE_P)
+  80272b:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802732:	01 00 00 
+  802735:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802739:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80273d:	83 e0 01             	and    $0x1,%eax
+  802740:	48 85 c0             	test   %rax,%rax
+  802743:	74 62                	je     8027a7 <fork+0x237>
+								{
+
+									if (each_pte != VPN(UXSTACKTOP - PGSIZE))
+  802745:	48 81 7d d0 ff f7 0e 	cmpq   $0xef7ff,-0x30(%rbp)
+  80274c:	00 
+  80274d:	74 58                	je     8027a7 <fork+0x237>
+									{
+										r = duppage(childid, (unsigned)each_pte);
+  80274f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802753:	89 c2                	mov    %eax,%edx
+  802755:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802758:	89 d6                	mov    %edx,%esi
+  80275a:	89 c7                	mov    %eax,%edi
+  80275c:	48 b8 61 23 80 00 00 	movabs $0x802361,%rax
+  802763:	00 00 00 
+  802766:	ff d0                	call   *%rax
+  802768:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+										if (r < 0)
+  80276b:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  80276f:	79 36                	jns    8027a7 <fork+0x237>
+											panic("\n couldn't call fork %e\n", r);
+  802771:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802774:	89 c1                	mov    %eax,%ecx
+  802776:	48 b8 cb 31 80 00 00 	movabs $0x8031cb,%rax
+  80277d:	00 00 00 
+  802780:	48 89 c2             	mov    %rax,%rdx
+  802783:	be a9 00 00 00       	mov    $0xa9,%esi
+  802788:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  80278f:	00 00 00 
+  802792:	48 89 c7             	mov    %rax,%rdi
+  802795:	b8 00 00 00 00       	mov    $0x0,%eax
+  80279a:	49 b8 ec 28 80 00 00 	movabs $0x8028ec,%r8
+  8027a1:	00 00 00 
+  8027a4:	41 ff d0             	call   *%r8
+							for (pte = 0; pte < NPTENTRIES; pte++, each_pte++)
+  8027a7:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  8027ac:	48 83 45 d0 01       	addq   $0x1,-0x30(%rbp)
+  8027b1:	48 81 7d e0 ff 01 00 	cmpq   $0x1ff,-0x20(%rbp)
+  8027b8:	00 
+  8027b9:	0f 86 6c ff ff ff    	jbe    80272b <fork+0x1bb>
+  8027bf:	eb 10                	jmp    8027d1 <fork+0x261>
+								}
+							}
+						}
+						else
+						{
+							each_pte = (each_pde + 1) * NPTENTRIES;
+  8027c1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8027c5:	48 83 c0 01          	add    $0x1,%rax
+  8027c9:	48 c1 e0 09          	shl    $0x9,%rax
+  8027cd:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+					for (pde = 0; pde < NPDENTRIES; pde++, each_pde++)
+  8027d1:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8027d6:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8027db:	48 81 7d e8 ff 01 00 	cmpq   $0x1ff,-0x18(%rbp)
+  8027e2:	00 
+  8027e3:	0f 86 17 ff ff ff    	jbe    802700 <fork+0x190>
+  8027e9:	eb 10                	jmp    8027fb <fork+0x28b>
+						}
+					}
+				}
+				else
+				{
+					each_pde = (each_pdpe + 1) * NPDENTRIES;
+  8027eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027ef:	48 83 c0 01          	add    $0x1,%rax
+  8027f3:	48 c1 e0 09          	shl    $0x9,%rax
+  8027f7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			for (pdpe = 0; pdpe < NPDPENTRIES; pdpe++, each_pdpe++)
+  8027fb:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  802800:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  802805:	48 81 7d f0 ff 01 00 	cmpq   $0x1ff,-0x10(%rbp)
+  80280c:	00 
+  80280d:	0f 86 c2 fe ff ff    	jbe    8026d5 <fork+0x165>
+  802813:	eb 10                	jmp    802825 <fork+0x2b5>
+				}
+			}
+		}
+		else
+		{
+			each_pdpe = (pml + 1) * NPDPENTRIES;
+  802815:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802819:	48 83 c0 01          	add    $0x1,%rax
+  80281d:	48 c1 e0 09          	shl    $0x9,%rax
+  802821:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	for (pml = 0; pml < VPML4E(UTOP); pml++)
+  802825:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80282a:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80282f:	0f 84 75 fe ff ff    	je     8026aa <fork+0x13a>
+
+	extern void _pgfault_upcall(void);
+	// 为子环境设置页错误处理函数.
+	// 因为使用env_alloc()创建的env的处理函数指针都为空，但是这时已经明确的为其错误栈分配了物理页面
+	// 所以可以直接使用系统调用指定错误处理的入口，_pgfault_upcall()为所有用户页错误处理函数的总入口
+	r = sys_env_set_pgfault_upcall(childid, _pgfault_upcall);
+  802835:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802838:	48 ba aa 2a 80 00 00 	movabs $0x802aaa,%rdx
+  80283f:	00 00 00 
+  802842:	48 89 d6             	mov    %rdx,%rsi
+  802845:	89 c7                	mov    %eax,%edi
+  802847:	48 b8 96 1d 80 00 00 	movabs $0x801d96,%rax
+  80284e:	00 00 00 
+  802851:	ff d0                	call   *%rax
+  802853:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if (r < 0)
+  802856:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  80285a:	79 36                	jns    802892 <fork+0x322>
+		panic("\n couldn't call fork %e\n", r);
+  80285c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80285f:	89 c1                	mov    %eax,%ecx
+  802861:	48 b8 cb 31 80 00 00 	movabs $0x8031cb,%rax
+  802868:	00 00 00 
+  80286b:	48 89 c2             	mov    %rax,%rdx
+  80286e:	be c6 00 00 00       	mov    $0xc6,%esi
+  802873:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  80287a:	00 00 00 
+  80287d:	48 89 c7             	mov    %rax,%rdi
+  802880:	b8 00 00 00 00       	mov    $0x0,%eax
+  802885:	49 b8 ec 28 80 00 00 	movabs $0x8028ec,%r8
+  80288c:	00 00 00 
+  80288f:	41 ff d0             	call   *%r8
+
+	r = sys_env_set_status(childid, ENV_RUNNABLE);
+  802892:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802895:	be 02 00 00 00       	mov    $0x2,%esi
+  80289a:	89 c7                	mov    %eax,%edi
+  80289c:	48 b8 fd 1c 80 00 00 	movabs $0x801cfd,%rax
+  8028a3:	00 00 00 
+  8028a6:	ff d0                	call   *%rax
+  8028a8:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if (r < 0)
+  8028ab:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  8028af:	79 36                	jns    8028e7 <fork+0x377>
+		panic("\n couldn't call fork %e\n", r);
+  8028b1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8028b4:	89 c1                	mov    %eax,%ecx
+  8028b6:	48 b8 cb 31 80 00 00 	movabs $0x8031cb,%rax
+  8028bd:	00 00 00 
+  8028c0:	48 89 c2             	mov    %rax,%rdx
+  8028c3:	be ca 00 00 00       	mov    $0xca,%esi
+  8028c8:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  8028cf:	00 00 00 
+  8028d2:	48 89 c7             	mov    %rax,%rdi
+  8028d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028da:	49 b8 ec 28 80 00 00 	movabs $0x8028ec,%r8
+  8028e1:	00 00 00 
+  8028e4:	41 ff d0             	call   *%r8
+
+	return childid;
+  8028e7:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  8028ea:	c9                   	leave
+  8028eb:	c3                   	ret
+
+00000000008028ec <_panic>:
+/*
+ * 无法解决的致命错误会导致死机
+ * 打印"死机:<消息>”，然后导致处理器休眠进入HLT状态
+ */
+void _panic(const char *file, int line, const char *fmt, ...)
+{
+  8028ec:	55                   	push   %rbp
+  8028ed:	48 89 e5             	mov    %rsp,%rbp
+  8028f0:	53                   	push   %rbx
+  8028f1:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8028f8:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  8028ff:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  802905:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  80290c:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  802913:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  80291a:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  802921:	84 c0                	test   %al,%al
+  802923:	74 23                	je     802948 <_panic+0x5c>
+  802925:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  80292c:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  802930:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  802934:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  802938:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  80293c:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  802940:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  802944:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  802948:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  80294f:	00 00 00 
+  802952:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  802959:	00 00 00 
+  80295c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802960:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  802967:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  80296e:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+	// 输出死机的信息
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802975:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80297c:	00 00 00 
+  80297f:	48 8b 18             	mov    (%rax),%rbx
+  802982:	48 b8 86 1b 80 00 00 	movabs $0x801b86,%rax
+  802989:	00 00 00 
+  80298c:	ff d0                	call   *%rax
+  80298e:	89 c6                	mov    %eax,%esi
+  802990:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  802996:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80299d:	41 89 d0             	mov    %edx,%r8d
+  8029a0:	48 89 c1             	mov    %rax,%rcx
+  8029a3:	48 89 da             	mov    %rbx,%rdx
+  8029a6:	48 b8 e8 31 80 00 00 	movabs $0x8031e8,%rax
+  8029ad:	00 00 00 
+  8029b0:	48 89 c7             	mov    %rax,%rdi
+  8029b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b8:	49 b9 13 03 80 00 00 	movabs $0x800313,%r9
+  8029bf:	00 00 00 
+  8029c2:	41 ff d1             	call   *%r9
+			sys_getprocid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8029c5:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  8029cc:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8029d3:	48 89 d6             	mov    %rdx,%rsi
+  8029d6:	48 89 c7             	mov    %rax,%rdi
+  8029d9:	48 b8 64 02 80 00 00 	movabs $0x800264,%rax
+  8029e0:	00 00 00 
+  8029e3:	ff d0                	call   *%rax
+	cprintf("\n");
+  8029e5:	48 b8 0b 32 80 00 00 	movabs $0x80320b,%rax
+  8029ec:	00 00 00 
+  8029ef:	48 89 c7             	mov    %rax,%rdi
+  8029f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029f7:	48 ba 13 03 80 00 00 	movabs $0x800313,%rdx
+  8029fe:	00 00 00 
+  802a01:	ff d2                	call   *%rdx
+
+	// 触发断点中断
+	while (1)
+		asm volatile("int3");
+  802a03:	cc                   	int3
+  802a04:	eb fd                	jmp    802a03 <_panic+0x117>
+
+0000000000802a06 <set_pgfault_handler>:
+ * 包含用户异常栈的初始化和页错误处理函数的设置，利用 kern/syscall.c sys_env_set_pgfault_upcall() 注册(utf字段)用户页错误处理函数
+ * 第一次注册处理程序时，需要分配一个异常堆栈(顶部位于UXSTACKTOP的一页内存)
+ * 并告诉内核在页错误发生时调用汇编语言 _pgfault_upcall 例程
+ */
+void set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802a06:	55                   	push   %rbp
+  802a07:	48 89 e5             	mov    %rsp,%rbp
+  802a0a:	48 83 ec 10          	sub    $0x10,%rsp
+  802a0e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	if (_pgfault_handler == 0)
+  802a12:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  802a19:	00 00 00 
+  802a1c:	48 8b 00             	mov    (%rax),%rax
+  802a1f:	48 85 c0             	test   %rax,%rax
+  802a22:	75 72                	jne    802a96 <set_pgfault_handler+0x90>
+	{
+		// 第一次出错，创建用户异常栈
+		if (sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_W | PTE_U | PTE_P) == 0)
+  802a24:	ba 07 00 00 00       	mov    $0x7,%edx
+  802a29:	b8 00 f0 7f ef       	mov    $0xef7ff000,%eax
+  802a2e:	48 89 c6             	mov    %rax,%rsi
+  802a31:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a36:	48 b8 ff 1b 80 00 00 	movabs $0x801bff,%rax
+  802a3d:	00 00 00 
+  802a40:	ff d0                	call   *%rax
+  802a42:	85 c0                	test   %eax,%eax
+  802a44:	75 20                	jne    802a66 <set_pgfault_handler+0x60>
+			sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  802a46:	48 b8 aa 2a 80 00 00 	movabs $0x802aaa,%rax
+  802a4d:	00 00 00 
+  802a50:	48 89 c6             	mov    %rax,%rsi
+  802a53:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a58:	48 b8 96 1d 80 00 00 	movabs $0x801d96,%rax
+  802a5f:	00 00 00 
+  802a62:	ff d0                	call   *%rax
+  802a64:	eb 30                	jmp    802a96 <set_pgfault_handler+0x90>
+		else
+			panic("set_pgfault_handler(): no memory");
+  802a66:	48 b8 10 32 80 00 00 	movabs $0x803210,%rax
+  802a6d:	00 00 00 
+  802a70:	48 89 c2             	mov    %rax,%rdx
+  802a73:	be 1b 00 00 00       	mov    $0x1b,%esi
+  802a78:	48 b8 31 32 80 00 00 	movabs $0x803231,%rax
+  802a7f:	00 00 00 
+  802a82:	48 89 c7             	mov    %rax,%rdi
+  802a85:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a8a:	48 b9 ec 28 80 00 00 	movabs $0x8028ec,%rcx
+  802a91:	00 00 00 
+  802a94:	ff d1                	call   *%rcx
+	}
+
+	// 存储汇编语言调用的处理函数指针.
+	_pgfault_handler = handler;
+  802a96:	48 ba 18 40 80 00 00 	movabs $0x804018,%rdx
+  802a9d:	00 00 00 
+  802aa0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802aa4:	48 89 02             	mov    %rax,(%rdx)
+}
+  802aa7:	90                   	nop
+  802aa8:	c9                   	leave
+  802aa9:	c3                   	ret
+
+0000000000802aaa <_pgfault_upcall>:
+
+	// 调用C代码中的页错误处理函数.
+	// 函数参数: 指向 UTrapframe 的指针
+
+	// 通过 %rdi 传递函数参数
+	movq  %rsp, %rdi
+  802aaa:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  802aad:	48 a1 18 40 80 00 00 	movabs 0x804018,%rax
+  802ab4:	00 00 00 
+	call *%rax
+  802ab7:	ff d0                	call   *%rax
+			regs: 15*8 = 120-Byte,
+			eflags: 8-Byte,
+			rip: 8-Byte
+	*/
+
+	addq $16, %rsp	/* 跳过用户异常栈中的 utf_fault_va 和 utf_err(不需要) */
+  802ab9:	48 83 c4 10          	add    $0x10,%rsp
+	
+	/* 用户异常栈: %rsp 指向 end of struct PushRegs */
+	
+	movq 120(%rsp), %r10	/* %r10 = %rip */
+  802abd:	4c 8b 54 24 78       	mov    0x78(%rsp),%r10
+	movq 136(%rsp), %r11	/* %r11 = %rsp */
+  802ac2:	4c 8b 9c 24 88 00 00 	mov    0x88(%rsp),%r11
+  802ac9:	00 
+
+	subq $8, %r11			/* %r11(trap-time %rsp) - 8 */
+  802aca:	49 83 eb 08          	sub    $0x8,%r11
+	movq %r10, (%r11)		/* %r11(trap-time %rsp) 指向的值为 %rip */
+  802ace:	4d 89 13             	mov    %r10,(%r11)
+	movq %r11, 136(%rsp)	/* 更新 trap-time %rsp 的值 */
+  802ad1:	4c 89 9c 24 88 00 00 	mov    %r11,0x88(%rsp)
+  802ad8:	00 
+		trap-time eflags
+		trap-time rip
+	*/
+
+	// 恢复 trap-time 寄存器集.  接下来不能再修改任何通用寄存器集 PushRegs.
+	POPA_	/* 之前已经通过增加 16-Byte 跳过了 fault_va 和 utf_err，所以只需使用 POPA_ 恢复 */
+  802ad9:	4c 8b 3c 24          	mov    (%rsp),%r15
+  802add:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  802ae2:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  802ae7:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  802aec:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  802af1:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  802af6:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  802afb:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  802b00:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  802b05:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  802b0a:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  802b0f:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  802b14:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  802b19:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  802b1e:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  802b23:	48 83 c4 78          	add    $0x78,%rsp
+
+	// 从栈中恢复 %eflags.  接下来不能再使用修改 %eflags 的指令，比如算术指令sub, cmp等.
+	addq $8, %rsp	/* 跳过 %rip，指向 %eflags */
+  802b27:	48 83 c4 08          	add    $0x8,%rsp
+	popfq			/* 从栈中恢复 %eflags */
+  802b2b:	9d                   	popf
+		(blank 8-Byte)
+		trap-time rip
+	*/
+
+	// 切换回调整后的 trap-time 栈.
+	popq %rsp		/* 已经指向 %rsp，直接 pop 恢复 */
+  802b2c:	5c                   	pop    %rsp
+
+	// 返回重新执行引起页错误的环境指令.
+	ret				/* popq %rip */
+  802b2d:	c3                   	ret
@@ -0,0 +1,4526 @@
+
+obj/user/stresssched.debug:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// entrypoint - 当最初被加载到一个新的环境中时，内核(或者父环境)在这里开始运行.
+.text
+.globl _start
+_start:
+	// 判断是否从栈上的参数开始初始化
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	// $USTACKTOP != %rsp 说明有参数，跳转到 args_exist
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// 如果不是(新环境被内核加载的时候)，则 push 伪造的 argc, argv 参数
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 b2 01 00 00       	call   8001f3 <libmain>
+
+// 不应该返回
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+#include "inc/lib.h"  // 包含用户库
+
+volatile int counter;
+
+void umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	48 83 ec 20          	sub    $0x20,%rsp
+  80004b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80004e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int i, j;
+	int seen;
+	int32_t parent = sys_getprocid();
+  800052:	48 b8 3e 1d 80 00 00 	movabs $0x801d3e,%rax
+  800059:	00 00 00 
+  80005c:	ff d0                	call   *%rax
+  80005e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+
+	// Fork 20个子进程
+	for (i = 0; i < 20; i++)
+  800061:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800068:	eb 14                	jmp    80007e <umain+0x3b>
+		if (fork() == 0)
+  80006a:	48 b8 28 27 80 00 00 	movabs $0x802728,%rax
+  800071:	00 00 00 
+  800074:	ff d0                	call   *%rax
+  800076:	85 c0                	test   %eax,%eax
+  800078:	74 0c                	je     800086 <umain+0x43>
+	for (i = 0; i < 20; i++)
+  80007a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80007e:	83 7d fc 13          	cmpl   $0x13,-0x4(%rbp)
+  800082:	7e e6                	jle    80006a <umain+0x27>
+  800084:	eb 01                	jmp    800087 <umain+0x44>
+			break;
+  800086:	90                   	nop
+	if (i == 20)
+  800087:	83 7d fc 14          	cmpl   $0x14,-0x4(%rbp)
+  80008b:	75 13                	jne    8000a0 <umain+0x5d>
+	{
+		// 父进程 fork 完成后放弃调度
+		sys_yield();
+  80008d:	48 b8 7a 1d 80 00 00 	movabs $0x801d7a,%rax
+  800094:	00 00 00 
+  800097:	ff d0                	call   *%rax
+		return;
+  800099:	e9 53 01 00 00       	jmp    8001f1 <umain+0x1ae>
+	}
+
+	// 子进程等待父进程完成所有fork
+	while (procs[ENVX(parent)].env_status != ENV_FREE)
+		asm volatile("pause");
+  80009e:	f3 90                	pause
+	while (procs[ENVX(parent)].env_status != ENV_FREE)
+  8000a0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8000a3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000a8:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  8000af:	00 00 00 
+  8000b2:	48 98                	cltq
+  8000b4:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  8000bb:	48 01 d0             	add    %rdx,%rax
+  8000be:	48 05 e4 00 00 00    	add    $0xe4,%rax
+  8000c4:	8b 00                	mov    (%rax),%eax
+  8000c6:	85 c0                	test   %eax,%eax
+  8000c8:	75 d4                	jne    80009e <umain+0x5b>
+
+	// 检查一个进程不能同时运行在两个处理器
+	for (i = 0; i < 10; i++)
+  8000ca:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8000d1:	eb 41                	jmp    800114 <umain+0xd1>
+	{
+		sys_yield();
+  8000d3:	48 b8 7a 1d 80 00 00 	movabs $0x801d7a,%rax
+  8000da:	00 00 00 
+  8000dd:	ff d0                	call   *%rax
+		for (j = 0; j < 10000; j++)
+  8000df:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  8000e6:	eb 1f                	jmp    800107 <umain+0xc4>
+			counter++;
+  8000e8:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  8000ef:	00 00 00 
+  8000f2:	8b 00                	mov    (%rax),%eax
+  8000f4:	8d 50 01             	lea    0x1(%rax),%edx
+  8000f7:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  8000fe:	00 00 00 
+  800101:	89 10                	mov    %edx,(%rax)
+		for (j = 0; j < 10000; j++)
+  800103:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+  800107:	81 7d f8 0f 27 00 00 	cmpl   $0x270f,-0x8(%rbp)
+  80010e:	7e d8                	jle    8000e8 <umain+0xa5>
+	for (i = 0; i < 10; i++)
+  800110:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800114:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+  800118:	7e b9                	jle    8000d3 <umain+0x90>
+	}
+
+	// 内核锁(互斥地系统调用): 如果进程运算的结果不等于循环自增的次数则说明进程同时运行在两个处理器
+	if (counter != 10 * 10000)
+  80011a:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  800121:	00 00 00 
+  800124:	8b 00                	mov    (%rax),%eax
+  800126:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+  80012b:	74 3f                	je     80016c <umain+0x129>
+		panic("ran on two CPUs at once (counter is %d)", counter);
+  80012d:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  800134:	00 00 00 
+  800137:	8b 00                	mov    (%rax),%eax
+  800139:	89 c1                	mov    %eax,%ecx
+  80013b:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  800142:	00 00 00 
+  800145:	48 89 c2             	mov    %rax,%rdx
+  800148:	be 26 00 00 00       	mov    $0x26,%esi
+  80014d:	48 b8 08 2c 80 00 00 	movabs $0x802c08,%rax
+  800154:	00 00 00 
+  800157:	48 89 c7             	mov    %rax,%rdi
+  80015a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80015f:	49 b8 88 02 80 00 00 	movabs $0x800288,%r8
+  800166:	00 00 00 
+  800169:	41 ff d0             	call   *%r8
+
+	// 检查进程运算结果
+	cprintf("[%08x] counter: %d\n", thisproc->proc_id, counter);
+  80016c:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  800173:	00 00 00 
+  800176:	8b 10                	mov    (%rax),%edx
+  800178:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  80017f:	00 00 00 
+  800182:	48 8b 00             	mov    (%rax),%rax
+  800185:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  80018b:	89 c6                	mov    %eax,%esi
+  80018d:	48 b8 1b 2c 80 00 00 	movabs $0x802c1b,%rax
+  800194:	00 00 00 
+  800197:	48 89 c7             	mov    %rax,%rdi
+  80019a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019f:	48 b9 cb 04 80 00 00 	movabs $0x8004cb,%rcx
+  8001a6:	00 00 00 
+  8001a9:	ff d1                	call   *%rcx
+	// 检查进程是否运行在不同处理器上
+	cprintf("[%08x] stress sched on CPU %d\n", thisproc->proc_id, thisproc->env_cpunum);
+  8001ab:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8001b2:	00 00 00 
+  8001b5:	48 8b 00             	mov    (%rax),%rax
+  8001b8:	8b 90 38 01 00 00    	mov    0x138(%rax),%edx
+  8001be:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8001c5:	00 00 00 
+  8001c8:	48 8b 00             	mov    (%rax),%rax
+  8001cb:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8001d1:	89 c6                	mov    %eax,%esi
+  8001d3:	48 b8 30 2c 80 00 00 	movabs $0x802c30,%rax
+  8001da:	00 00 00 
+  8001dd:	48 89 c7             	mov    %rax,%rdi
+  8001e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e5:	48 b9 cb 04 80 00 00 	movabs $0x8004cb,%rcx
+  8001ec:	00 00 00 
+  8001ef:	ff d1                	call   *%rcx
+}
+  8001f1:	c9                   	leave
+  8001f2:	c3                   	ret
+
+00000000008001f3 <libmain>:
+
+/**
+ *  用户环境从lib/libmain.c中的函数libmain开始执行，这个函数进而调用umain，用户写的程序入口只能是umain
+ */
+void libmain(int argc, char **argv)
+{
+  8001f3:	55                   	push   %rbp
+  8001f4:	48 89 e5             	mov    %rsp,%rbp
+  8001f7:	48 83 ec 10          	sub    $0x10,%rsp
+  8001fb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8001fe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 设置常量 thisproc 指向 procs[] 中当前环境的 Env 结构，ENVX 确保环境 id 未超过了 NENV
+	// thisproc 指向当前环境的 Env 结构
+	thisproc = &procs[ENVX(sys_getprocid())];
+  800202:	48 b8 3e 1d 80 00 00 	movabs $0x801d3e,%rax
+  800209:	00 00 00 
+  80020c:	ff d0                	call   *%rax
+  80020e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800213:	48 98                	cltq
+  800215:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  80021c:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  800223:	00 00 00 
+  800226:	48 01 c2             	add    %rax,%rdx
+  800229:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  800230:	00 00 00 
+  800233:	48 89 10             	mov    %rdx,(%rax)
+
+	// 通过 CPUID 选择 memset/memmove/memcpy 的实现
+	mem_init();
+  800236:	48 b8 e6 13 80 00 00 	movabs $0x8013e6,%rax
+  80023d:	00 00 00 
+  800240:	ff d0                	call   *%rax
+
+	// 为了能让panic()提示用户错误，存储程序的名称
+	if (argc > 0)
+  800242:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800246:	7e 14                	jle    80025c <libmain+0x69>
+		binaryname = argv[0];
+  800248:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80024c:	48 8b 00             	mov    (%rax),%rax
+  80024f:	48 ba 00 40 80 00 00 	movabs $0x804000,%rdx
+  800256:	00 00 00 
+  800259:	48 89 02             	mov    %rax,(%rdx)
+
+	// 调用用户的主程序
+	umain(argc, argv);
+  80025c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800260:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800263:	48 89 d6             	mov    %rdx,%rsi
+  800266:	89 c7                	mov    %eax,%edi
+  800268:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  80026f:	00 00 00 
+  800272:	ff d0                	call   *%rax
+
+	// 退出当前环境，env_destroy
+	sys_env_destroy(0);
+  800274:	bf 00 00 00 00       	mov    $0x0,%edi
+  800279:	48 b8 f8 1c 80 00 00 	movabs $0x801cf8,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	90                   	nop
+  800286:	c9                   	leave
+  800287:	c3                   	ret
+
+0000000000800288 <_panic>:
+/*
+ * 无法解决的致命错误会导致死机
+ * 打印"死机:<消息>”，然后导致处理器休眠进入HLT状态
+ */
+void _panic(const char *file, int line, const char *fmt, ...)
+{
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+  80028c:	53                   	push   %rbx
+  80028d:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800294:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  80029b:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  8002a1:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  8002a8:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  8002af:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  8002b6:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  8002bd:	84 c0                	test   %al,%al
+  8002bf:	74 23                	je     8002e4 <_panic+0x5c>
+  8002c1:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  8002c8:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  8002cc:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  8002d0:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  8002d4:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  8002d8:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  8002dc:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  8002e0:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002e4:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  8002eb:	00 00 00 
+  8002ee:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  8002f5:	00 00 00 
+  8002f8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002fc:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  800303:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  80030a:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+	// 输出死机的信息
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800311:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800318:	00 00 00 
+  80031b:	48 8b 18             	mov    (%rax),%rbx
+  80031e:	48 b8 3e 1d 80 00 00 	movabs $0x801d3e,%rax
+  800325:	00 00 00 
+  800328:	ff d0                	call   *%rax
+  80032a:	89 c6                	mov    %eax,%esi
+  80032c:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  800332:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  800339:	41 89 d0             	mov    %edx,%r8d
+  80033c:	48 89 c1             	mov    %rax,%rcx
+  80033f:	48 89 da             	mov    %rbx,%rdx
+  800342:	48 b8 60 2c 80 00 00 	movabs $0x802c60,%rax
+  800349:	00 00 00 
+  80034c:	48 89 c7             	mov    %rax,%rdi
+  80034f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800354:	49 b9 cb 04 80 00 00 	movabs $0x8004cb,%r9
+  80035b:	00 00 00 
+  80035e:	41 ff d1             	call   *%r9
+			sys_getprocid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800361:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  800368:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80036f:	48 89 d6             	mov    %rdx,%rsi
+  800372:	48 89 c7             	mov    %rax,%rdi
+  800375:	48 b8 1c 04 80 00 00 	movabs $0x80041c,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+	cprintf("\n");
+  800381:	48 b8 83 2c 80 00 00 	movabs $0x802c83,%rax
+  800388:	00 00 00 
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800393:	48 ba cb 04 80 00 00 	movabs $0x8004cb,%rdx
+  80039a:	00 00 00 
+  80039d:	ff d2                	call   *%rdx
+
+	// 触发断点中断
+	while (1)
+		asm volatile("int3");
+  80039f:	cc                   	int3
+  8003a0:	eb fd                	jmp    80039f <_panic+0x117>
+
+00000000008003a2 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003a2:	55                   	push   %rbp
+  8003a3:	48 89 e5             	mov    %rsp,%rbp
+  8003a6:	48 83 ec 10          	sub    $0x10,%rsp
+  8003aa:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8003ad:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->buf[b->idx++] = ch;
+  8003b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003b5:	8b 00                	mov    (%rax),%eax
+  8003b7:	8d 48 01             	lea    0x1(%rax),%ecx
+  8003ba:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8003be:	89 0a                	mov    %ecx,(%rdx)
+  8003c0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8003c3:	89 d1                	mov    %edx,%ecx
+  8003c5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8003c9:	48 98                	cltq
+  8003cb:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+	if (b->idx == 256-1) {
+  8003cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003d3:	8b 00                	mov    (%rax),%eax
+  8003d5:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003da:	75 2c                	jne    800408 <putch+0x66>
+		sys_cputs(b->buf, b->idx);
+  8003dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003e0:	8b 00                	mov    (%rax),%eax
+  8003e2:	48 98                	cltq
+  8003e4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8003e8:	48 83 c2 08          	add    $0x8,%rdx
+  8003ec:	48 89 c6             	mov    %rax,%rsi
+  8003ef:	48 89 d7             	mov    %rdx,%rdi
+  8003f2:	48 b8 6f 1c 80 00 00 	movabs $0x801c6f,%rax
+  8003f9:	00 00 00 
+  8003fc:	ff d0                	call   *%rax
+		b->idx = 0;
+  8003fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800402:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	}
+	b->cnt++;
+  800408:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80040c:	8b 40 04             	mov    0x4(%rax),%eax
+  80040f:	8d 50 01             	lea    0x1(%rax),%edx
+  800412:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800416:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800419:	90                   	nop
+  80041a:	c9                   	leave
+  80041b:	c3                   	ret
+
+000000000080041c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80041c:	55                   	push   %rbp
+  80041d:	48 89 e5             	mov    %rsp,%rbp
+  800420:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  800427:	48 89 bd c8 fe ff ff 	mov    %rdi,-0x138(%rbp)
+  80042e:	48 89 b5 c0 fe ff ff 	mov    %rsi,-0x140(%rbp)
+	struct printbuf b;
+	va_list aq;
+	va_copy(aq,ap);
+  800435:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  80043c:	48 8b b5 c0 fe ff ff 	mov    -0x140(%rbp),%rsi
+  800443:	48 8b 06             	mov    (%rsi),%rax
+  800446:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80044a:	48 89 01             	mov    %rax,(%rcx)
+  80044d:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800451:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800455:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	b.idx = 0;
+  800459:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800460:	00 00 00 
+	b.cnt = 0;
+  800463:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80046a:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, aq);
+  80046d:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  800474:	48 8b 95 c8 fe ff ff 	mov    -0x138(%rbp),%rdx
+  80047b:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800482:	48 89 c6             	mov    %rax,%rsi
+  800485:	48 b8 a2 03 80 00 00 	movabs $0x8003a2,%rax
+  80048c:	00 00 00 
+  80048f:	48 89 c7             	mov    %rax,%rdi
+  800492:	48 b8 69 08 80 00 00 	movabs $0x800869,%rax
+  800499:	00 00 00 
+  80049c:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  80049e:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8004a4:	48 98                	cltq
+  8004a6:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8004ad:	48 83 c2 08          	add    $0x8,%rdx
+  8004b1:	48 89 c6             	mov    %rax,%rsi
+  8004b4:	48 89 d7             	mov    %rdx,%rdi
+  8004b7:	48 b8 6f 1c 80 00 00 	movabs $0x801c6f,%rax
+  8004be:	00 00 00 
+  8004c1:	ff d0                	call   *%rax
+	va_end(aq);
+
+	return b.cnt;
+  8004c3:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8004c9:	c9                   	leave
+  8004ca:	c3                   	ret
+
+00000000008004cb <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004cb:	55                   	push   %rbp
+  8004cc:	48 89 e5             	mov    %rsp,%rbp
+  8004cf:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  8004d6:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8004dd:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8004e4:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8004eb:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8004f2:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8004f9:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800500:	84 c0                	test   %al,%al
+  800502:	74 20                	je     800524 <cprintf+0x59>
+  800504:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800508:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80050c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800510:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800514:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800518:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80051c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800520:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+	va_list aq;
+	va_start(ap, fmt);
+  800524:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80052b:	00 00 00 
+  80052e:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800535:	00 00 00 
+  800538:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80053c:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800543:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80054a:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  800551:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800558:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  80055f:	48 8b 06             	mov    (%rsi),%rax
+  800562:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800566:	48 89 01             	mov    %rax,(%rcx)
+  800569:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80056d:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800571:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	cnt = vcprintf(fmt, aq);
+  800575:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80057c:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800583:	48 89 d6             	mov    %rdx,%rsi
+  800586:	48 89 c7             	mov    %rax,%rdi
+  800589:	48 b8 1c 04 80 00 00 	movabs $0x80041c,%rax
+  800590:	00 00 00 
+  800593:	ff d0                	call   *%rax
+  800595:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return cnt;
+  80059b:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8005a1:	c9                   	leave
+  8005a2:	c3                   	ret
+
+00000000008005a3 <printnum>:
+ * num: 需要打印出来的整型数，base: 整型数的进制，其他参数同 vprintfmt
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+		 unsigned long long num, unsigned base, int width, int padc)
+{
+  8005a3:	55                   	push   %rbp
+  8005a4:	48 89 e5             	mov    %rsp,%rbp
+  8005a7:	48 83 ec 30          	sub    $0x30,%rsp
+  8005ab:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8005af:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8005b3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8005b7:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8005ba:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8005be:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+	// 当 num 超过一位数，首先递归函数自身打印所有高位的(更重要的)数字
+	if (num >= base)
+  8005c2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8005c5:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8005c9:	72 54                	jb     80061f <printnum+0x7c>
+	{
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8005cb:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8005ce:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8005d1:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8005d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005dd:	48 f7 f6             	div    %rsi
+  8005e0:	49 89 c2             	mov    %rax,%r10
+  8005e3:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8005e6:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8005e9:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8005ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005f1:	41 89 c9             	mov    %ecx,%r9d
+  8005f4:	41 89 f8             	mov    %edi,%r8d
+  8005f7:	89 d1                	mov    %edx,%ecx
+  8005f9:	4c 89 d2             	mov    %r10,%rdx
+  8005fc:	48 89 c7             	mov    %rax,%rdi
+  8005ff:	48 b8 a3 05 80 00 00 	movabs $0x8005a3,%rax
+  800606:	00 00 00 
+  800609:	ff d0                	call   *%rax
+  80060b:	eb 1c                	jmp    800629 <printnum+0x86>
+	}
+	else
+	{
+		// 按照右对齐的格式在左侧补齐填充字符 padc
+		while (--width > 0)
+			putch(padc, putdat);
+  80060d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800611:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800614:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800618:	48 89 d6             	mov    %rdx,%rsi
+  80061b:	89 c7                	mov    %eax,%edi
+  80061d:	ff d1                	call   *%rcx
+		while (--width > 0)
+  80061f:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800623:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800627:	7f e4                	jg     80060d <printnum+0x6a>
+	}
+
+	// 然后打印个位数字
+	putch("0123456789abcdef"[num % base], putdat);
+  800629:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80062c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800630:	ba 00 00 00 00       	mov    $0x0,%edx
+  800635:	48 f7 f1             	div    %rcx
+  800638:	48 b8 90 2e 80 00 00 	movabs $0x802e90,%rax
+  80063f:	00 00 00 
+  800642:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800646:	0f be c0             	movsbl %al,%eax
+  800649:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80064d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800651:	48 89 d6             	mov    %rdx,%rsi
+  800654:	89 c7                	mov    %eax,%edi
+  800656:	ff d1                	call   *%rcx
+}
+  800658:	90                   	nop
+  800659:	c9                   	leave
+  80065a:	c3                   	ret
+
+000000000080065b <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  80065b:	55                   	push   %rbp
+  80065c:	48 89 e5             	mov    %rsp,%rbp
+  80065f:	48 83 ec 20          	sub    $0x20,%rsp
+  800663:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800667:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;
+	if (lflag >= 2)
+  80066a:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  80066e:	7e 4f                	jle    8006bf <getuint+0x64>
+		x = va_arg(*ap, unsigned long long);
+  800670:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800674:	8b 00                	mov    (%rax),%eax
+  800676:	83 f8 2f             	cmp    $0x2f,%eax
+  800679:	77 24                	ja     80069f <getuint+0x44>
+  80067b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80067f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800683:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800687:	8b 00                	mov    (%rax),%eax
+  800689:	89 c0                	mov    %eax,%eax
+  80068b:	48 01 d0             	add    %rdx,%rax
+  80068e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800692:	8b 12                	mov    (%rdx),%edx
+  800694:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800697:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80069b:	89 0a                	mov    %ecx,(%rdx)
+  80069d:	eb 14                	jmp    8006b3 <getuint+0x58>
+  80069f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006a3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006a7:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006ab:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006af:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006b3:	48 8b 00             	mov    (%rax),%rax
+  8006b6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8006ba:	e9 9d 00 00 00       	jmp    80075c <getuint+0x101>
+	else if (lflag)
+  8006bf:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8006c3:	74 4c                	je     800711 <getuint+0xb6>
+		x = va_arg(*ap, unsigned long);
+  8006c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006c9:	8b 00                	mov    (%rax),%eax
+  8006cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ce:	77 24                	ja     8006f4 <getuint+0x99>
+  8006d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006d4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006dc:	8b 00                	mov    (%rax),%eax
+  8006de:	89 c0                	mov    %eax,%eax
+  8006e0:	48 01 d0             	add    %rdx,%rax
+  8006e3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006e7:	8b 12                	mov    (%rdx),%edx
+  8006e9:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006ec:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006f0:	89 0a                	mov    %ecx,(%rdx)
+  8006f2:	eb 14                	jmp    800708 <getuint+0xad>
+  8006f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006f8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006fc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800700:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800704:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800708:	48 8b 00             	mov    (%rax),%rax
+  80070b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80070f:	eb 4b                	jmp    80075c <getuint+0x101>
+	else
+		x = va_arg(*ap, unsigned int);
+  800711:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800715:	8b 00                	mov    (%rax),%eax
+  800717:	83 f8 2f             	cmp    $0x2f,%eax
+  80071a:	77 24                	ja     800740 <getuint+0xe5>
+  80071c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800720:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800724:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800728:	8b 00                	mov    (%rax),%eax
+  80072a:	89 c0                	mov    %eax,%eax
+  80072c:	48 01 d0             	add    %rdx,%rax
+  80072f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800733:	8b 12                	mov    (%rdx),%edx
+  800735:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800738:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80073c:	89 0a                	mov    %ecx,(%rdx)
+  80073e:	eb 14                	jmp    800754 <getuint+0xf9>
+  800740:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800744:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800748:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80074c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800750:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800754:	8b 00                	mov    (%rax),%eax
+  800756:	89 c0                	mov    %eax,%eax
+  800758:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80075c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800760:	c9                   	leave
+  800761:	c3                   	ret
+
+0000000000800762 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800762:	55                   	push   %rbp
+  800763:	48 89 e5             	mov    %rsp,%rbp
+  800766:	48 83 ec 20          	sub    $0x20,%rsp
+  80076a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80076e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800771:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800775:	7e 4f                	jle    8007c6 <getint+0x64>
+		x = va_arg(*ap, long long);
+  800777:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80077b:	8b 00                	mov    (%rax),%eax
+  80077d:	83 f8 2f             	cmp    $0x2f,%eax
+  800780:	77 24                	ja     8007a6 <getint+0x44>
+  800782:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800786:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80078a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80078e:	8b 00                	mov    (%rax),%eax
+  800790:	89 c0                	mov    %eax,%eax
+  800792:	48 01 d0             	add    %rdx,%rax
+  800795:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800799:	8b 12                	mov    (%rdx),%edx
+  80079b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80079e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007a2:	89 0a                	mov    %ecx,(%rdx)
+  8007a4:	eb 14                	jmp    8007ba <getint+0x58>
+  8007a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007aa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007ae:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007b2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007b6:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007ba:	48 8b 00             	mov    (%rax),%rax
+  8007bd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8007c1:	e9 9d 00 00 00       	jmp    800863 <getint+0x101>
+	else if (lflag)
+  8007c6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8007ca:	74 4c                	je     800818 <getint+0xb6>
+		x = va_arg(*ap, long);
+  8007cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007d0:	8b 00                	mov    (%rax),%eax
+  8007d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d5:	77 24                	ja     8007fb <getint+0x99>
+  8007d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007db:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007e3:	8b 00                	mov    (%rax),%eax
+  8007e5:	89 c0                	mov    %eax,%eax
+  8007e7:	48 01 d0             	add    %rdx,%rax
+  8007ea:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007ee:	8b 12                	mov    (%rdx),%edx
+  8007f0:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007f3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007f7:	89 0a                	mov    %ecx,(%rdx)
+  8007f9:	eb 14                	jmp    80080f <getint+0xad>
+  8007fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007ff:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800803:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800807:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80080b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80080f:	48 8b 00             	mov    (%rax),%rax
+  800812:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800816:	eb 4b                	jmp    800863 <getint+0x101>
+	else
+		x = va_arg(*ap, int);
+  800818:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80081c:	8b 00                	mov    (%rax),%eax
+  80081e:	83 f8 2f             	cmp    $0x2f,%eax
+  800821:	77 24                	ja     800847 <getint+0xe5>
+  800823:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800827:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80082b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80082f:	8b 00                	mov    (%rax),%eax
+  800831:	89 c0                	mov    %eax,%eax
+  800833:	48 01 d0             	add    %rdx,%rax
+  800836:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80083a:	8b 12                	mov    (%rdx),%edx
+  80083c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80083f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800843:	89 0a                	mov    %ecx,(%rdx)
+  800845:	eb 14                	jmp    80085b <getint+0xf9>
+  800847:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80084b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80084f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800853:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800857:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80085b:	8b 00                	mov    (%rax),%eax
+  80085d:	48 98                	cltq
+  80085f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800863:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800867:	c9                   	leave
+  800868:	c3                   	ret
+
+0000000000800869 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap)
+{
+  800869:	55                   	push   %rbp
+  80086a:	48 89 e5             	mov    %rsp,%rbp
+  80086d:	41 54                	push   %r12
+  80086f:	53                   	push   %rbx
+  800870:	48 83 ec 60          	sub    $0x60,%rsp
+  800874:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800878:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80087c:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800880:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+	int base, lflag, width, precision, altflag;
+
+	// 填充字符，在显示字符串的'%'后读到'-'或'0'时，赋值到 padc
+	char padc;
+	va_list aq;
+	va_copy(aq, ap);
+  800884:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800888:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80088c:	48 8b 06             	mov    (%rsi),%rax
+  80088f:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800893:	48 89 01             	mov    %rax,(%rcx)
+  800896:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80089a:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80089e:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1)
+	{
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  8008a2:	eb 17                	jmp    8008bb <vprintfmt+0x52>
+		{
+			if (ch == '\0')
+  8008a4:	85 db                	test   %ebx,%ebx
+  8008a6:	0f 84 b9 04 00 00    	je     800d65 <vprintfmt+0x4fc>
+				return;
+			putch(ch, putdat);
+  8008ac:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008b0:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8008b4:	48 89 c6             	mov    %rax,%rsi
+  8008b7:	89 df                	mov    %ebx,%edi
+  8008b9:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  8008bb:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8008bf:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8008c3:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8008c7:	0f b6 00             	movzbl (%rax),%eax
+  8008ca:	0f b6 d8             	movzbl %al,%ebx
+  8008cd:	83 fb 25             	cmp    $0x25,%ebx
+  8008d0:	75 d2                	jne    8008a4 <vprintfmt+0x3b>
+		}
+
+		// 处理 % 转义序列
+		// padc 初始化为空格符，padc='-'代表字符串左对齐，右边补空格，padc=' '代表右对齐，左边补空格，padc='0'右对齐，左边补0
+		padc = ' ';
+  8008d2:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+		width = -1;
+  8008d6:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+		// 默认-1代表显示长度为字符串本来的长度
+		precision = -1;
+  8008dd:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+		lflag = 0;
+  8008e4:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+		altflag = 0;
+  8008eb:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *)fmt++)
+  8008f2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8008f6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8008fa:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8008fe:	0f b6 00             	movzbl (%rax),%eax
+  800901:	0f b6 d8             	movzbl %al,%ebx
+  800904:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800907:	83 f8 55             	cmp    $0x55,%eax
+  80090a:	0f 87 22 04 00 00    	ja     800d32 <vprintfmt+0x4c9>
+  800910:	89 c0                	mov    %eax,%eax
+  800912:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800919:	00 
+  80091a:	48 b8 b8 2e 80 00 00 	movabs $0x802eb8,%rax
+  800921:	00 00 00 
+  800924:	48 01 d0             	add    %rdx,%rax
+  800927:	48 8b 00             	mov    (%rax),%rax
+  80092a:	ff e0                	jmp    *%rax
+		{
+
+		// flag to pad on the right
+		case '-':
+			padc = '-';
+  80092c:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+			goto reswitch;
+  800930:	eb c0                	jmp    8008f2 <vprintfmt+0x89>
+
+		// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800932:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+			goto reswitch;
+  800936:	eb ba                	jmp    8008f2 <vprintfmt+0x89>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0;; ++fmt)
+  800938:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+			{
+				precision = precision * 10 + ch - '0';
+  80093f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800942:	89 d0                	mov    %edx,%eax
+  800944:	c1 e0 02             	shl    $0x2,%eax
+  800947:	01 d0                	add    %edx,%eax
+  800949:	01 c0                	add    %eax,%eax
+  80094b:	01 d8                	add    %ebx,%eax
+  80094d:	83 e8 30             	sub    $0x30,%eax
+  800950:	89 45 d8             	mov    %eax,-0x28(%rbp)
+				ch = *fmt;
+  800953:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800957:	0f b6 00             	movzbl (%rax),%eax
+  80095a:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  80095d:	83 fb 2f             	cmp    $0x2f,%ebx
+  800960:	7e 60                	jle    8009c2 <vprintfmt+0x159>
+  800962:	83 fb 39             	cmp    $0x39,%ebx
+  800965:	7f 5b                	jg     8009c2 <vprintfmt+0x159>
+			for (precision = 0;; ++fmt)
+  800967:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+				precision = precision * 10 + ch - '0';
+  80096c:	eb d1                	jmp    80093f <vprintfmt+0xd6>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  80096e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800971:	83 f8 2f             	cmp    $0x2f,%eax
+  800974:	77 17                	ja     80098d <vprintfmt+0x124>
+  800976:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80097a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80097d:	89 d2                	mov    %edx,%edx
+  80097f:	48 01 d0             	add    %rdx,%rax
+  800982:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800985:	83 c2 08             	add    $0x8,%edx
+  800988:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80098b:	eb 0c                	jmp    800999 <vprintfmt+0x130>
+  80098d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800991:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800995:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800999:	8b 00                	mov    (%rax),%eax
+  80099b:	89 45 d8             	mov    %eax,-0x28(%rbp)
+			goto process_precision;
+  80099e:	eb 23                	jmp    8009c3 <vprintfmt+0x15a>
+
+		case '.':
+			if (width < 0)
+  8009a0:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8009a4:	0f 89 48 ff ff ff    	jns    8008f2 <vprintfmt+0x89>
+				width = 0;
+  8009aa:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+			goto reswitch;
+  8009b1:	e9 3c ff ff ff       	jmp    8008f2 <vprintfmt+0x89>
+
+		case '#':
+			altflag = 1;
+  8009b6:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+			goto reswitch;
+  8009bd:	e9 30 ff ff ff       	jmp    8008f2 <vprintfmt+0x89>
+			goto process_precision;
+  8009c2:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  8009c3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8009c7:	0f 89 25 ff ff ff    	jns    8008f2 <vprintfmt+0x89>
+				width = precision, precision = -1;
+  8009cd:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8009d0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8009d3:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+			goto reswitch;
+  8009da:	e9 13 ff ff ff       	jmp    8008f2 <vprintfmt+0x89>
+
+		// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  8009df:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+			goto reswitch;
+  8009e3:	e9 0a ff ff ff       	jmp    8008f2 <vprintfmt+0x89>
+
+		// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  8009e8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ee:	77 17                	ja     800a07 <vprintfmt+0x19e>
+  8009f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009f4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009f7:	89 d2                	mov    %edx,%edx
+  8009f9:	48 01 d0             	add    %rdx,%rax
+  8009fc:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009ff:	83 c2 08             	add    $0x8,%edx
+  800a02:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a05:	eb 0c                	jmp    800a13 <vprintfmt+0x1aa>
+  800a07:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a0b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a0f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a13:	8b 00                	mov    (%rax),%eax
+  800a15:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800a19:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800a1d:	48 89 d6             	mov    %rdx,%rsi
+  800a20:	89 c7                	mov    %eax,%edi
+  800a22:	ff d1                	call   *%rcx
+			break;
+  800a24:	e9 37 03 00 00       	jmp    800d60 <vprintfmt+0x4f7>
+
+		// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800a29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2f:	77 17                	ja     800a48 <vprintfmt+0x1df>
+  800a31:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a35:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a38:	89 d2                	mov    %edx,%edx
+  800a3a:	48 01 d0             	add    %rdx,%rax
+  800a3d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a40:	83 c2 08             	add    $0x8,%edx
+  800a43:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a46:	eb 0c                	jmp    800a54 <vprintfmt+0x1eb>
+  800a48:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a4c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a50:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a54:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800a56:	85 db                	test   %ebx,%ebx
+  800a58:	79 02                	jns    800a5c <vprintfmt+0x1f3>
+				err = -err;
+  800a5a:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a5c:	83 fb 11             	cmp    $0x11,%ebx
+  800a5f:	7f 16                	jg     800a77 <vprintfmt+0x20e>
+  800a61:	48 ba 00 2e 80 00 00 	movabs $0x802e00,%rdx
+  800a68:	00 00 00 
+  800a6b:	48 63 c3             	movslq %ebx,%rax
+  800a6e:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800a72:	4d 85 e4             	test   %r12,%r12
+  800a75:	75 2e                	jne    800aa5 <vprintfmt+0x23c>
+				printfmt(putch, putdat, "error %d", err);
+  800a77:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800a7b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a7f:	89 d9                	mov    %ebx,%ecx
+  800a81:	48 ba a1 2e 80 00 00 	movabs $0x802ea1,%rdx
+  800a88:	00 00 00 
+  800a8b:	48 89 c7             	mov    %rax,%rdi
+  800a8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a93:	49 b8 6f 0d 80 00 00 	movabs $0x800d6f,%r8
+  800a9a:	00 00 00 
+  800a9d:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800aa0:	e9 bb 02 00 00       	jmp    800d60 <vprintfmt+0x4f7>
+				printfmt(putch, putdat, "%s", p);
+  800aa5:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800aa9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800aad:	4c 89 e1             	mov    %r12,%rcx
+  800ab0:	48 ba aa 2e 80 00 00 	movabs $0x802eaa,%rdx
+  800ab7:	00 00 00 
+  800aba:	48 89 c7             	mov    %rax,%rdi
+  800abd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac2:	49 b8 6f 0d 80 00 00 	movabs $0x800d6f,%r8
+  800ac9:	00 00 00 
+  800acc:	41 ff d0             	call   *%r8
+			break;
+  800acf:	e9 8c 02 00 00       	jmp    800d60 <vprintfmt+0x4f7>
+
+		// string
+		case 's':
+			// 从可变参数中读入字符串指针
+			if ((p = va_arg(aq, char *)) == NULL)
+  800ad4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad7:	83 f8 2f             	cmp    $0x2f,%eax
+  800ada:	77 17                	ja     800af3 <vprintfmt+0x28a>
+  800adc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ae0:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ae3:	89 d2                	mov    %edx,%edx
+  800ae5:	48 01 d0             	add    %rdx,%rax
+  800ae8:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800aeb:	83 c2 08             	add    $0x8,%edx
+  800aee:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800af1:	eb 0c                	jmp    800aff <vprintfmt+0x296>
+  800af3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800af7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800afb:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800aff:	4c 8b 20             	mov    (%rax),%r12
+  800b02:	4d 85 e4             	test   %r12,%r12
+  800b05:	75 0a                	jne    800b11 <vprintfmt+0x2a8>
+				p = "(null)"; // 当字符串为空时，将它指向"(null)"字符串
+  800b07:	49 bc ad 2e 80 00 00 	movabs $0x802ead,%r12
+  800b0e:	00 00 00 
+			// 判断左对齐还是右对齐，pad='-'左对齐，否则右对齐
+			if (width > 0 && padc != '-')
+  800b11:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b15:	7e 78                	jle    800b8f <vprintfmt+0x326>
+  800b17:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800b1b:	74 72                	je     800b8f <vprintfmt+0x326>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b1d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800b20:	48 98                	cltq
+  800b22:	48 89 c6             	mov    %rax,%rsi
+  800b25:	4c 89 e7             	mov    %r12,%rdi
+  800b28:	48 b8 14 11 80 00 00 	movabs $0x801114,%rax
+  800b2f:	00 00 00 
+  800b32:	ff d0                	call   *%rax
+  800b34:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800b37:	eb 17                	jmp    800b50 <vprintfmt+0x2e7>
+					putch(padc, putdat); // 字符串右对齐，左边补相应数量(width-实际长度)的空格或者 0
+  800b39:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800b3d:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800b41:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800b45:	48 89 d6             	mov    %rdx,%rsi
+  800b48:	89 c7                	mov    %eax,%edi
+  800b4a:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b4c:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800b50:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b54:	7f e3                	jg     800b39 <vprintfmt+0x2d0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b56:	eb 37                	jmp    800b8f <vprintfmt+0x326>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800b58:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800b5c:	74 1e                	je     800b7c <vprintfmt+0x313>
+  800b5e:	83 fb 1f             	cmp    $0x1f,%ebx
+  800b61:	7e 05                	jle    800b68 <vprintfmt+0x2ff>
+  800b63:	83 fb 7e             	cmp    $0x7e,%ebx
+  800b66:	7e 14                	jle    800b7c <vprintfmt+0x313>
+					putch('?', putdat);
+  800b68:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b6c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b70:	48 89 c6             	mov    %rax,%rsi
+  800b73:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800b78:	ff d2                	call   *%rdx
+  800b7a:	eb 0f                	jmp    800b8b <vprintfmt+0x322>
+				else
+					putch(ch, putdat); // 打印相应长度的字符串
+  800b7c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b80:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b84:	48 89 c6             	mov    %rax,%rsi
+  800b87:	89 df                	mov    %ebx,%edi
+  800b89:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b8b:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800b8f:	4c 89 e0             	mov    %r12,%rax
+  800b92:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800b96:	0f b6 00             	movzbl (%rax),%eax
+  800b99:	0f be d8             	movsbl %al,%ebx
+  800b9c:	85 db                	test   %ebx,%ebx
+  800b9e:	74 28                	je     800bc8 <vprintfmt+0x35f>
+  800ba0:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800ba4:	78 b2                	js     800b58 <vprintfmt+0x2ef>
+  800ba6:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800baa:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800bae:	79 a8                	jns    800b58 <vprintfmt+0x2ef>
+			for (; width > 0; width--)
+  800bb0:	eb 16                	jmp    800bc8 <vprintfmt+0x35f>
+				putch(' ', putdat); // 当字符串是左对齐的时候打印相应数量的空格
+  800bb2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bb6:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800bba:	48 89 c6             	mov    %rax,%rsi
+  800bbd:	bf 20 00 00 00       	mov    $0x20,%edi
+  800bc2:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800bc4:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800bc8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800bcc:	7f e4                	jg     800bb2 <vprintfmt+0x349>
+			break;
+  800bce:	e9 8d 01 00 00       	jmp    800d60 <vprintfmt+0x4f7>
+
+		// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800bd3:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800bd7:	be 03 00 00 00       	mov    $0x3,%esi
+  800bdc:	48 89 c7             	mov    %rax,%rdi
+  800bdf:	48 b8 62 07 80 00 00 	movabs $0x800762,%rax
+  800be6:	00 00 00 
+  800be9:	ff d0                	call   *%rax
+  800beb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((long long)num < 0)
+  800bef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bf3:	48 85 c0             	test   %rax,%rax
+  800bf6:	79 1d                	jns    800c15 <vprintfmt+0x3ac>
+			{
+				putch('-', putdat);
+  800bf8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bfc:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c00:	48 89 c6             	mov    %rax,%rsi
+  800c03:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800c08:	ff d2                	call   *%rdx
+				num = -(long long)num;
+  800c0a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c0e:	48 f7 d8             	neg    %rax
+  800c11:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			}
+			base = 10;
+  800c15:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800c1c:	e9 d2 00 00 00       	jmp    800cf3 <vprintfmt+0x48a>
+
+		// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800c21:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800c25:	be 03 00 00 00       	mov    $0x3,%esi
+  800c2a:	48 89 c7             	mov    %rax,%rdi
+  800c2d:	48 b8 5b 06 80 00 00 	movabs $0x80065b,%rax
+  800c34:	00 00 00 
+  800c37:	ff d0                	call   *%rax
+  800c39:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 10;
+  800c3d:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800c44:	e9 aa 00 00 00       	jmp    800cf3 <vprintfmt+0x48a>
+		// (unsigned) octal
+		case 'o':
+			// Gets the variable argument with type integer from the point which was processed last by va_arg
+			// calls getuint which returns a long long value, which then calls printnum which prints based on
+			// base value.
+			num = getuint(&aq, 3);
+  800c49:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800c4d:	be 03 00 00 00       	mov    $0x3,%esi
+  800c52:	48 89 c7             	mov    %rax,%rdi
+  800c55:	48 b8 5b 06 80 00 00 	movabs $0x80065b,%rax
+  800c5c:	00 00 00 
+  800c5f:	ff d0                	call   *%rax
+  800c61:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 8;
+  800c65:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+			goto number;
+  800c6c:	e9 82 00 00 00       	jmp    800cf3 <vprintfmt+0x48a>
+
+		// pointer
+		case 'p':
+			putch('0', putdat);
+  800c71:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c75:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c79:	48 89 c6             	mov    %rax,%rsi
+  800c7c:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c81:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800c83:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c87:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c8b:	48 89 c6             	mov    %rax,%rsi
+  800c8e:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c93:	ff d2                	call   *%rdx
+			num = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800c95:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c98:	83 f8 2f             	cmp    $0x2f,%eax
+  800c9b:	77 17                	ja     800cb4 <vprintfmt+0x44b>
+  800c9d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ca1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ca4:	89 d2                	mov    %edx,%edx
+  800ca6:	48 01 d0             	add    %rdx,%rax
+  800ca9:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800cac:	83 c2 08             	add    $0x8,%edx
+  800caf:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800cb2:	eb 0c                	jmp    800cc0 <vprintfmt+0x457>
+  800cb4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800cb8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cbc:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800cc0:	48 8b 00             	mov    (%rax),%rax
+  800cc3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800cc7:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+			goto number;
+  800cce:	eb 23                	jmp    800cf3 <vprintfmt+0x48a>
+
+		// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800cd0:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800cd4:	be 03 00 00 00       	mov    $0x3,%esi
+  800cd9:	48 89 c7             	mov    %rax,%rdi
+  800cdc:	48 b8 5b 06 80 00 00 	movabs $0x80065b,%rax
+  800ce3:	00 00 00 
+  800ce6:	ff d0                	call   *%rax
+  800ce8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800cec:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800cf3:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800cf8:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800cfb:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800cfe:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d02:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800d06:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d0a:	45 89 c1             	mov    %r8d,%r9d
+  800d0d:	41 89 f8             	mov    %edi,%r8d
+  800d10:	48 89 c7             	mov    %rax,%rdi
+  800d13:	48 b8 a3 05 80 00 00 	movabs $0x8005a3,%rax
+  800d1a:	00 00 00 
+  800d1d:	ff d0                	call   *%rax
+			break;
+  800d1f:	eb 3f                	jmp    800d60 <vprintfmt+0x4f7>
+
+		// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800d21:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d25:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d29:	48 89 c6             	mov    %rax,%rsi
+  800d2c:	89 df                	mov    %ebx,%edi
+  800d2e:	ff d2                	call   *%rdx
+			break;
+  800d30:	eb 2e                	jmp    800d60 <vprintfmt+0x4f7>
+
+		// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800d32:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d36:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d3a:	48 89 c6             	mov    %rax,%rsi
+  800d3d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d42:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800d44:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800d49:	eb 05                	jmp    800d50 <vprintfmt+0x4e7>
+  800d4b:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800d50:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800d54:	48 83 e8 01          	sub    $0x1,%rax
+  800d58:	0f b6 00             	movzbl (%rax),%eax
+  800d5b:	3c 25                	cmp    $0x25,%al
+  800d5d:	75 ec                	jne    800d4b <vprintfmt+0x4e2>
+				/* do nothing */;
+			break;
+  800d5f:	90                   	nop
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800d60:	e9 56 fb ff ff       	jmp    8008bb <vprintfmt+0x52>
+				return;
+  800d65:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800d66:	48 83 c4 60          	add    $0x60,%rsp
+  800d6a:	5b                   	pop    %rbx
+  800d6b:	41 5c                	pop    %r12
+  800d6d:	5d                   	pop    %rbp
+  800d6e:	c3                   	ret
+
+0000000000800d6f <printfmt>:
+
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...)
+{
+  800d6f:	55                   	push   %rbp
+  800d70:	48 89 e5             	mov    %rsp,%rbp
+  800d73:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800d7a:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800d81:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800d88:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800d8f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800d96:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800d9d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800da4:	84 c0                	test   %al,%al
+  800da6:	74 20                	je     800dc8 <printfmt+0x59>
+  800da8:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800dac:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800db0:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800db4:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800db8:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800dbc:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800dc0:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800dc4:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800dc8:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800dcf:	00 00 00 
+  800dd2:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800de0:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800de7:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800dee:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800df5:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800dfc:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800e03:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800e0a:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800e11:	48 89 c7             	mov    %rax,%rdi
+  800e14:	48 b8 69 08 80 00 00 	movabs $0x800869,%rax
+  800e1b:	00 00 00 
+  800e1e:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  800e20:	90                   	nop
+  800e21:	c9                   	leave
+  800e22:	c3                   	ret
+
+0000000000800e23 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800e23:	55                   	push   %rbp
+  800e24:	48 89 e5             	mov    %rsp,%rbp
+  800e27:	48 83 ec 10          	sub    $0x10,%rsp
+  800e2b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800e2e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  800e32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e36:	8b 40 10             	mov    0x10(%rax),%eax
+  800e39:	8d 50 01             	lea    0x1(%rax),%edx
+  800e3c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e40:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  800e43:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e47:	48 8b 10             	mov    (%rax),%rdx
+  800e4a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e4e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e52:	48 39 c2             	cmp    %rax,%rdx
+  800e55:	73 17                	jae    800e6e <sprintputch+0x4b>
+		*b->buf++ = ch;
+  800e57:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e5b:	48 8b 00             	mov    (%rax),%rax
+  800e5e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800e62:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800e66:	48 89 0a             	mov    %rcx,(%rdx)
+  800e69:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800e6c:	88 10                	mov    %dl,(%rax)
+}
+  800e6e:	90                   	nop
+  800e6f:	c9                   	leave
+  800e70:	c3                   	ret
+
+0000000000800e71 <vsnprintf>:
+
+int vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800e71:	55                   	push   %rbp
+  800e72:	48 89 e5             	mov    %rsp,%rbp
+  800e75:	48 83 ec 50          	sub    $0x50,%rsp
+  800e79:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  800e7d:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  800e80:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  800e84:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+	va_list aq;
+	va_copy(aq, ap);
+  800e88:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800e8c:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800e90:	48 8b 06             	mov    (%rsi),%rax
+  800e93:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800e97:	48 89 01             	mov    %rax,(%rcx)
+  800e9a:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800e9e:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800ea2:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	struct sprintbuf b = {buf, buf + n - 1, 0};
+  800ea6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800eaa:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800eae:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  800eb1:	48 98                	cltq
+  800eb3:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800eb7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ebb:	48 01 d0             	add    %rdx,%rax
+  800ebe:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  800ec2:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+
+	if (buf == NULL || n < 1)
+  800ec9:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800ece:	74 06                	je     800ed6 <vsnprintf+0x65>
+  800ed0:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800ed4:	7f 07                	jg     800edd <vsnprintf+0x6c>
+		return -E_INVAL;
+  800ed6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800edb:	eb 32                	jmp    800f0f <vsnprintf+0x9e>
+
+	// print the string to the buffer
+	vprintfmt((void *)sprintputch, &b, fmt, aq);
+  800edd:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800ee1:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  800ee5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ee9:	48 89 c6             	mov    %rax,%rsi
+  800eec:	48 b8 23 0e 80 00 00 	movabs $0x800e23,%rax
+  800ef3:	00 00 00 
+  800ef6:	48 89 c7             	mov    %rax,%rdi
+  800ef9:	48 b8 69 08 80 00 00 	movabs $0x800869,%rax
+  800f00:	00 00 00 
+  800f03:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  800f05:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f09:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800f0c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  800f0f:	c9                   	leave
+  800f10:	c3                   	ret
+
+0000000000800f11 <snprintf>:
+
+int snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800f11:	55                   	push   %rbp
+  800f12:	48 89 e5             	mov    %rsp,%rbp
+  800f15:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800f1c:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800f23:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800f29:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800f30:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f37:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f3e:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f45:	84 c0                	test   %al,%al
+  800f47:	74 20                	je     800f69 <snprintf+0x58>
+  800f49:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f4d:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f51:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f55:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f59:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f5d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f61:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f65:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  800f69:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800f70:	00 00 00 
+  800f73:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800f7a:	00 00 00 
+  800f7d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f81:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800f88:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f8f:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq, ap);
+  800f96:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800f9d:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800fa4:	48 8b 06             	mov    (%rsi),%rax
+  800fa7:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800fab:	48 89 01             	mov    %rax,(%rcx)
+  800fae:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800fb2:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800fb6:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  800fba:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800fc1:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  800fc8:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  800fce:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800fd5:	48 89 c7             	mov    %rax,%rdi
+  800fd8:	48 b8 71 0e 80 00 00 	movabs $0x800e71,%rax
+  800fdf:	00 00 00 
+  800fe2:	ff d0                	call   *%rax
+  800fe4:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  800fea:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800ff0:	c9                   	leave
+  800ff1:	c3                   	ret
+
+0000000000800ff2 <cpuid>:
+#define read_rip(var) __asm __volatile("leaq (%%rip), %0" : "=r" (var)::"cc","memory")
+
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800ff2:	55                   	push   %rbp
+  800ff3:	48 89 e5             	mov    %rsp,%rbp
+  800ff6:	53                   	push   %rbx
+  800ff7:	48 83 ec 38          	sub    $0x38,%rsp
+  800ffb:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800ffe:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801002:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801006:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80100a:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid" 
+  80100e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801011:	0f a2                	cpuid
+  801013:	89 de                	mov    %ebx,%esi
+  801015:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  801018:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  80101b:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  80101e:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info));
+	if (eaxp)
+  801021:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801026:	74 09                	je     801031 <cpuid+0x3f>
+		*eaxp = eax;
+  801028:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80102c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80102f:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  801031:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801036:	74 09                	je     801041 <cpuid+0x4f>
+		*ebxp = ebx;
+  801038:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80103c:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  80103f:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  801041:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801046:	74 09                	je     801051 <cpuid+0x5f>
+		*ecxp = ecx;
+  801048:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80104c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80104f:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  801051:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801056:	74 09                	je     801061 <cpuid+0x6f>
+		*edxp = edx;
+  801058:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80105c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80105f:	89 10                	mov    %edx,(%rax)
+}
+  801061:	90                   	nop
+  801062:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801066:	c9                   	leave
+  801067:	c3                   	ret
+
+0000000000801068 <cpuid_count>:
+
+// 带子功能号(%ecx = count)的 cpuid，用于 leaf 4/7/0xB/0xD 等
+static __inline void
+cpuid_count(uint32_t info, uint32_t count, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  801068:	55                   	push   %rbp
+  801069:	48 89 e5             	mov    %rsp,%rbp
+  80106c:	53                   	push   %rbx
+  80106d:	48 83 ec 38          	sub    $0x38,%rsp
+  801071:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  801074:	89 75 e0             	mov    %esi,-0x20(%rbp)
+  801077:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80107b:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  80107f:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+  801083:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  801087:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80108a:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80108d:	89 d1                	mov    %edx,%ecx
+  80108f:	0f a2                	cpuid
+  801091:	89 de                	mov    %ebx,%esi
+  801093:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  801096:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  801099:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  80109c:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info), "c" (count));
+	if (eaxp)
+  80109f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8010a4:	74 09                	je     8010af <cpuid_count+0x47>
+		*eaxp = eax;
+  8010a6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8010aa:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8010ad:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  8010af:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8010b4:	74 09                	je     8010bf <cpuid_count+0x57>
+		*ebxp = ebx;
+  8010b6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8010ba:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8010bd:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  8010bf:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8010c4:	74 09                	je     8010cf <cpuid_count+0x67>
+		*ecxp = ecx;
+  8010c6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010ca:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8010cd:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  8010cf:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8010d4:	74 09                	je     8010df <cpuid_count+0x77>
+		*edxp = edx;
+  8010d6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8010da:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8010dd:	89 10                	mov    %edx,(%rax)
+}
+  8010df:	90                   	nop
+  8010e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010e4:	c9                   	leave
+  8010e5:	c3                   	ret
+
+00000000008010e6 <strlen>:
+// 在真正的硬件上会有一定程度的优化, 但在 Bochs 上会有更大的优化效果
+// 用这种方法, Primespipe 的运行速度快了3倍
+#define ASM 1
+
+int strlen(const char *s)
+{
+  8010e6:	55                   	push   %rbp
+  8010e7:	48 89 e5             	mov    %rsp,%rbp
+  8010ea:	48 83 ec 18          	sub    $0x18,%rsp
+  8010ee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8010f2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8010f9:	eb 09                	jmp    801104 <strlen+0x1e>
+		n++;
+  8010fb:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8010ff:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801104:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801108:	0f b6 00             	movzbl (%rax),%eax
+  80110b:	84 c0                	test   %al,%al
+  80110d:	75 ec                	jne    8010fb <strlen+0x15>
+	return n;
+  80110f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801112:	c9                   	leave
+  801113:	c3                   	ret
+
+0000000000801114 <strnlen>:
+
+int strnlen(const char *s, size_t size)
+{
+  801114:	55                   	push   %rbp
+  801115:	48 89 e5             	mov    %rsp,%rbp
+  801118:	48 83 ec 20          	sub    $0x20,%rsp
+  80111c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801120:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801124:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80112b:	eb 0e                	jmp    80113b <strnlen+0x27>
+		n++;
+  80112d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801131:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801136:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  80113b:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801140:	74 0b                	je     80114d <strnlen+0x39>
+  801142:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801146:	0f b6 00             	movzbl (%rax),%eax
+  801149:	84 c0                	test   %al,%al
+  80114b:	75 e0                	jne    80112d <strnlen+0x19>
+	return n;
+  80114d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801150:	c9                   	leave
+  801151:	c3                   	ret
+
+0000000000801152 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801152:	55                   	push   %rbp
+  801153:	48 89 e5             	mov    %rsp,%rbp
+  801156:	48 83 ec 20          	sub    $0x20,%rsp
+  80115a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80115e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801162:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801166:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  80116a:	90                   	nop
+  80116b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80116f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801173:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801177:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80117b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80117f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801183:	0f b6 12             	movzbl (%rdx),%edx
+  801186:	88 10                	mov    %dl,(%rax)
+  801188:	0f b6 00             	movzbl (%rax),%eax
+  80118b:	84 c0                	test   %al,%al
+  80118d:	75 dc                	jne    80116b <strcpy+0x19>
+		/* do nothing */;
+	return ret;
+  80118f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801193:	c9                   	leave
+  801194:	c3                   	ret
+
+0000000000801195 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801195:	55                   	push   %rbp
+  801196:	48 89 e5             	mov    %rsp,%rbp
+  801199:	48 83 ec 20          	sub    $0x20,%rsp
+  80119d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8011a1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int len = strlen(dst);
+  8011a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011a9:	48 89 c7             	mov    %rax,%rdi
+  8011ac:	48 b8 e6 10 80 00 00 	movabs $0x8010e6,%rax
+  8011b3:	00 00 00 
+  8011b6:	ff d0                	call   *%rax
+  8011b8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	strcpy(dst + len, src);
+  8011bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8011be:	48 63 d0             	movslq %eax,%rdx
+  8011c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011c5:	48 01 c2             	add    %rax,%rdx
+  8011c8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8011cc:	48 89 c6             	mov    %rax,%rsi
+  8011cf:	48 89 d7             	mov    %rdx,%rdi
+  8011d2:	48 b8 52 11 80 00 00 	movabs $0x801152,%rax
+  8011d9:	00 00 00 
+  8011dc:	ff d0                	call   *%rax
+	return dst;
+  8011de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8011e2:	c9                   	leave
+  8011e3:	c3                   	ret
+
+00000000008011e4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8011e4:	55                   	push   %rbp
+  8011e5:	48 89 e5             	mov    %rsp,%rbp
+  8011e8:	48 83 ec 28          	sub    $0x28,%rsp
+  8011ec:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8011f0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8011f4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  8011f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011fc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++)
+  801200:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801207:	00 
+  801208:	eb 2a                	jmp    801234 <strncpy+0x50>
+	{
+		*dst++ = *src;
+  80120a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80120e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801212:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801216:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80121a:	0f b6 12             	movzbl (%rdx),%edx
+  80121d:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  80121f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801223:	0f b6 00             	movzbl (%rax),%eax
+  801226:	84 c0                	test   %al,%al
+  801228:	74 05                	je     80122f <strncpy+0x4b>
+			src++;
+  80122a:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++)
+  80122f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801234:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801238:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80123c:	72 cc                	jb     80120a <strncpy+0x26>
+	}
+	return ret;
+  80123e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801242:	c9                   	leave
+  801243:	c3                   	ret
+
+0000000000801244 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801244:	55                   	push   %rbp
+  801245:	48 89 e5             	mov    %rsp,%rbp
+  801248:	48 83 ec 28          	sub    $0x28,%rsp
+  80124c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801250:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801254:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801258:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80125c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0)
+  801260:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801265:	74 3d                	je     8012a4 <strlcpy+0x60>
+	{
+		while (--size > 0 && *src != '\0')
+  801267:	eb 1d                	jmp    801286 <strlcpy+0x42>
+			*dst++ = *src++;
+  801269:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80126d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801271:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801275:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801279:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80127d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801281:	0f b6 12             	movzbl (%rdx),%edx
+  801284:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801286:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80128b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801290:	74 0b                	je     80129d <strlcpy+0x59>
+  801292:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801296:	0f b6 00             	movzbl (%rax),%eax
+  801299:	84 c0                	test   %al,%al
+  80129b:	75 cc                	jne    801269 <strlcpy+0x25>
+		*dst = '\0';
+  80129d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012a1:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8012a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012a8:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8012ac:	c9                   	leave
+  8012ad:	c3                   	ret
+
+00000000008012ae <strcmp>:
+
+int strcmp(const char *p, const char *q)
+{
+  8012ae:	55                   	push   %rbp
+  8012af:	48 89 e5             	mov    %rsp,%rbp
+  8012b2:	48 83 ec 10          	sub    $0x10,%rsp
+  8012b6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8012ba:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8012be:	eb 0a                	jmp    8012ca <strcmp+0x1c>
+		p++, q++;
+  8012c0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8012c5:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8012ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012ce:	0f b6 00             	movzbl (%rax),%eax
+  8012d1:	84 c0                	test   %al,%al
+  8012d3:	74 12                	je     8012e7 <strcmp+0x39>
+  8012d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012d9:	0f b6 10             	movzbl (%rax),%edx
+  8012dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012e0:	0f b6 00             	movzbl (%rax),%eax
+  8012e3:	38 c2                	cmp    %al,%dl
+  8012e5:	74 d9                	je     8012c0 <strcmp+0x12>
+	return (int)((unsigned char)*p - (unsigned char)*q);
+  8012e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012eb:	0f b6 00             	movzbl (%rax),%eax
+  8012ee:	0f b6 d0             	movzbl %al,%edx
+  8012f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012f5:	0f b6 00             	movzbl (%rax),%eax
+  8012f8:	0f b6 c0             	movzbl %al,%eax
+  8012fb:	29 c2                	sub    %eax,%edx
+  8012fd:	89 d0                	mov    %edx,%eax
+}
+  8012ff:	c9                   	leave
+  801300:	c3                   	ret
+
+0000000000801301 <strncmp>:
+
+int strncmp(const char *p, const char *q, size_t n)
+{
+  801301:	55                   	push   %rbp
+  801302:	48 89 e5             	mov    %rsp,%rbp
+  801305:	48 83 ec 18          	sub    $0x18,%rsp
+  801309:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80130d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801311:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801315:	eb 0f                	jmp    801326 <strncmp+0x25>
+		n--, p++, q++;
+  801317:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80131c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801321:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801326:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80132b:	74 1d                	je     80134a <strncmp+0x49>
+  80132d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801331:	0f b6 00             	movzbl (%rax),%eax
+  801334:	84 c0                	test   %al,%al
+  801336:	74 12                	je     80134a <strncmp+0x49>
+  801338:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80133c:	0f b6 10             	movzbl (%rax),%edx
+  80133f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801343:	0f b6 00             	movzbl (%rax),%eax
+  801346:	38 c2                	cmp    %al,%dl
+  801348:	74 cd                	je     801317 <strncmp+0x16>
+	if (n == 0)
+  80134a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80134f:	75 07                	jne    801358 <strncmp+0x57>
+		return 0;
+  801351:	ba 00 00 00 00       	mov    $0x0,%edx
+  801356:	eb 16                	jmp    80136e <strncmp+0x6d>
+	else
+		return (int)((unsigned char)*p - (unsigned char)*q);
+  801358:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80135c:	0f b6 00             	movzbl (%rax),%eax
+  80135f:	0f b6 d0             	movzbl %al,%edx
+  801362:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801366:	0f b6 00             	movzbl (%rax),%eax
+  801369:	0f b6 c0             	movzbl %al,%eax
+  80136c:	29 c2                	sub    %eax,%edx
+}
+  80136e:	89 d0                	mov    %edx,%eax
+  801370:	c9                   	leave
+  801371:	c3                   	ret
+
+0000000000801372 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801372:	55                   	push   %rbp
+  801373:	48 89 e5             	mov    %rsp,%rbp
+  801376:	48 83 ec 10          	sub    $0x10,%rsp
+  80137a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80137e:	89 f0                	mov    %esi,%eax
+  801380:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801383:	eb 17                	jmp    80139c <strchr+0x2a>
+		if (*s == c)
+  801385:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801389:	0f b6 00             	movzbl (%rax),%eax
+  80138c:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80138f:	75 06                	jne    801397 <strchr+0x25>
+			return (char *)s;
+  801391:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801395:	eb 15                	jmp    8013ac <strchr+0x3a>
+	for (; *s; s++)
+  801397:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80139c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013a0:	0f b6 00             	movzbl (%rax),%eax
+  8013a3:	84 c0                	test   %al,%al
+  8013a5:	75 de                	jne    801385 <strchr+0x13>
+	return 0;
+  8013a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013ac:	c9                   	leave
+  8013ad:	c3                   	ret
+
+00000000008013ae <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8013ae:	55                   	push   %rbp
+  8013af:	48 89 e5             	mov    %rsp,%rbp
+  8013b2:	48 83 ec 10          	sub    $0x10,%rsp
+  8013b6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8013ba:	89 f0                	mov    %esi,%eax
+  8013bc:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8013bf:	eb 11                	jmp    8013d2 <strfind+0x24>
+		if (*s == c)
+  8013c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013c5:	0f b6 00             	movzbl (%rax),%eax
+  8013c8:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8013cb:	74 12                	je     8013df <strfind+0x31>
+	for (; *s; s++)
+  8013cd:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8013d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013d6:	0f b6 00             	movzbl (%rax),%eax
+  8013d9:	84 c0                	test   %al,%al
+  8013db:	75 e4                	jne    8013c1 <strfind+0x13>
+  8013dd:	eb 01                	jmp    8013e0 <strfind+0x32>
+			break;
+  8013df:	90                   	nop
+	return (char *)s;
+  8013e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8013e4:	c9                   	leave
+  8013e5:	c3                   	ret
+
+00000000008013e6 <mem_init>:
+};
+
+static int mem_features;
+
+void mem_init(void)
+{
+  8013e6:	55                   	push   %rbp
+  8013e7:	48 89 e5             	mov    %rsp,%rbp
+  8013ea:	48 83 ec 10          	sub    $0x10,%rsp
+	uint32_t max, ebx, edx;
+
+	mem_features = 0;
+  8013ee:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  8013f5:	00 00 00 
+  8013f8:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	cpuid(0, &max, NULL, NULL, NULL);
+  8013fe:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+  801402:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801408:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80140d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801412:	48 89 c6             	mov    %rax,%rsi
+  801415:	bf 00 00 00 00       	mov    $0x0,%edi
+  80141a:	48 b8 f2 0f 80 00 00 	movabs $0x800ff2,%rax
+  801421:	00 00 00 
+  801424:	ff d0                	call   *%rax
+	cpuid(1, NULL, NULL, NULL, &edx);
+  801426:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  80142a:	49 89 c0             	mov    %rax,%r8
+  80142d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801432:	ba 00 00 00 00       	mov    $0x0,%edx
+  801437:	be 00 00 00 00       	mov    $0x0,%esi
+  80143c:	bf 01 00 00 00       	mov    $0x1,%edi
+  801441:	48 b8 f2 0f 80 00 00 	movabs $0x800ff2,%rax
+  801448:	00 00 00 
+  80144b:	ff d0                	call   *%rax
+	if (edx & (1 << 26))
+  80144d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801450:	25 00 00 00 04       	and    $0x4000000,%eax
+  801455:	85 c0                	test   %eax,%eax
+  801457:	74 1d                	je     801476 <mem_init+0x90>
+		mem_features |= MEM_F_NT;
+  801459:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  801460:	00 00 00 
+  801463:	8b 00                	mov    (%rax),%eax
+  801465:	83 c8 02             	or     $0x2,%eax
+  801468:	89 c2                	mov    %eax,%edx
+  80146a:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  801471:	00 00 00 
+  801474:	89 10                	mov    %edx,(%rax)
+	if (max >= 7)
+  801476:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801479:	83 f8 06             	cmp    $0x6,%eax
+  80147c:	76 57                	jbe    8014d5 <mem_init+0xef>
+	{
+		cpuid_count(7, 0, NULL, &ebx, NULL, NULL);
+  80147e:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801482:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801488:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80148e:	48 89 c1             	mov    %rax,%rcx
+  801491:	ba 00 00 00 00       	mov    $0x0,%edx
+  801496:	be 00 00 00 00       	mov    $0x0,%esi
+  80149b:	bf 07 00 00 00       	mov    $0x7,%edi
+  8014a0:	48 b8 68 10 80 00 00 	movabs $0x801068,%rax
+  8014a7:	00 00 00 
+  8014aa:	ff d0                	call   *%rax
+		if (ebx & (1 << 9))
+  8014ac:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8014af:	25 00 02 00 00       	and    $0x200,%eax
+  8014b4:	85 c0                	test   %eax,%eax
+  8014b6:	74 1d                	je     8014d5 <mem_init+0xef>
+			mem_features |= MEM_F_ERMS;
+  8014b8:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  8014bf:	00 00 00 
+  8014c2:	8b 00                	mov    (%rax),%eax
+  8014c4:	83 c8 01             	or     $0x1,%eax
+  8014c7:	89 c2                	mov    %eax,%edx
+  8014c9:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  8014d0:	00 00 00 
+  8014d3:	89 10                	mov    %edx,(%rax)
+	}
+}
+  8014d5:	90                   	nop
+  8014d6:	c9                   	leave
+  8014d7:	c3                   	ret
+
+00000000008014d8 <memset_nt>:
+
+// 非临时存储填充 n 字节(v 8 字节对齐，n 为 32 的倍数)
+static void
+memset_nt(void *v, uint64_t pattern, size_t n)
+{
+  8014d8:	55                   	push   %rbp
+  8014d9:	48 89 e5             	mov    %rsp,%rbp
+  8014dc:	48 83 ec 28          	sub    $0x28,%rsp
+  8014e0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014e4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8014e8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t *p = (uint64_t *)v;
+  8014ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014f0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint64_t *end = p + n / 8;
+  8014f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8014f8:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  8014fc:	48 89 c2             	mov    %rax,%rdx
+  8014ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801503:	48 01 d0             	add    %rdx,%rax
+  801506:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	for (; p < end; p += 4)
+  80150a:	eb 20                	jmp    80152c <memset_nt+0x54>
+		asm volatile("movnti %1, 0(%0)\n\t"
+  80150c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801510:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801514:	48 0f c3 10          	movnti %rdx,(%rax)
+  801518:	48 0f c3 50 08       	movnti %rdx,0x8(%rax)
+  80151d:	48 0f c3 50 10       	movnti %rdx,0x10(%rax)
+  801522:	48 0f c3 50 18       	movnti %rdx,0x18(%rax)
+	for (; p < end; p += 4)
+  801527:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  80152c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801530:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801534:	72 d6                	jb     80150c <memset_nt+0x34>
+					 "movnti %1, 16(%0)\n\t"
+					 "movnti %1, 24(%0)"
+					 :
+					 : "r"(p), "r"(pattern)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  801536:	0f ae f8             	sfence
+}
+  801539:	90                   	nop
+  80153a:	c9                   	leave
+  80153b:	c3                   	ret
+
+000000000080153c <memcpy_nt>:
+
+// 非临时存储复制 n 字节(dst/src 8 字节对齐且不重叠，n 为 32 的倍数)
+static void
+memcpy_nt(void *dst, const void *src, size_t n)
+{
+  80153c:	55                   	push   %rbp
+  80153d:	48 89 e5             	mov    %rsp,%rbp
+  801540:	48 83 ec 58          	sub    $0x58,%rsp
+  801544:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801548:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  80154c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	uint64_t *d = (uint64_t *)dst;
+  801550:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801554:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint64_t *s = (const uint64_t *)src;
+  801558:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80155c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	uint64_t *end = d + n / 8;
+  801560:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801564:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  801568:	48 89 c2             	mov    %rax,%rdx
+  80156b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80156f:	48 01 d0             	add    %rdx,%rax
+  801572:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint64_t t0, t1, t2, t3;
+
+	for (; d < end; d += 4, s += 4)
+  801576:	eb 44                	jmp    8015bc <memcpy_nt+0x80>
+		asm volatile("movq 0(%4), %0\n\t"
+  801578:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80157c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801580:	4c 8b 00             	mov    (%rax),%r8
+  801583:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  801587:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  80158b:	48 8b 48 18          	mov    0x18(%rax),%rcx
+  80158f:	4c 0f c3 02          	movnti %r8,(%rdx)
+  801593:	48 0f c3 7a 08       	movnti %rdi,0x8(%rdx)
+  801598:	48 0f c3 72 10       	movnti %rsi,0x10(%rdx)
+  80159d:	48 0f c3 4a 18       	movnti %rcx,0x18(%rdx)
+  8015a2:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8015a6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8015aa:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8015ae:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+	for (; d < end; d += 4, s += 4)
+  8015b2:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  8015b7:	48 83 45 f0 20       	addq   $0x20,-0x10(%rbp)
+  8015bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015c0:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  8015c4:	72 b2                	jb     801578 <memcpy_nt+0x3c>
+					 "movnti %2, 16(%5)\n\t"
+					 "movnti %3, 24(%5)"
+					 : "=&r"(t0), "=&r"(t1), "=&r"(t2), "=&r"(t3)
+					 : "r"(s), "r"(d)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  8015c6:	0f ae f8             	sfence
+}
+  8015c9:	90                   	nop
+  8015ca:	c9                   	leave
+  8015cb:	c3                   	ret
+
+00000000008015cc <memcpy_fwd>:
+
+// 正向复制(dst 在 src 之前或两者不重叠)
+static void
+memcpy_fwd(void *dst, const void *src, size_t n)
+{
+  8015cc:	55                   	push   %rbp
+  8015cd:	48 89 e5             	mov    %rsp,%rbp
+  8015d0:	48 83 ec 18          	sub    $0x18,%rsp
+  8015d4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015d8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8015dc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  8015e0:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  8015e7:	00 00 00 
+  8015ea:	8b 00                	mov    (%rax),%eax
+  8015ec:	83 e0 02             	and    $0x2,%eax
+  8015ef:	85 c0                	test   %eax,%eax
+  8015f1:	74 66                	je     801659 <memcpy_fwd+0x8d>
+  8015f3:	48 81 7d e8 ff 0f 00 	cmpq   $0xfff,-0x18(%rbp)
+  8015fa:	00 
+  8015fb:	76 5c                	jbe    801659 <memcpy_fwd+0x8d>
+  8015fd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801601:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801605:	48 09 d0             	or     %rdx,%rax
+  801608:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  80160c:	83 e0 1f             	and    $0x1f,%eax
+  80160f:	48 85 c0             	test   %rax,%rax
+  801612:	75 45                	jne    801659 <memcpy_fwd+0x8d>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  801614:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801618:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80161c:	48 01 d0             	add    %rdx,%rax
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  80161f:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801623:	73 11                	jae    801636 <memcpy_fwd+0x6a>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  801625:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801629:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80162d:	48 01 d0             	add    %rdx,%rax
+  801630:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801634:	72 23                	jb     801659 <memcpy_fwd+0x8d>
+		memcpy_nt(dst, src, n);
+  801636:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80163a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80163e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801642:	48 89 ce             	mov    %rcx,%rsi
+  801645:	48 89 c7             	mov    %rax,%rdi
+  801648:	48 b8 3c 15 80 00 00 	movabs $0x80153c,%rax
+  80164f:	00 00 00 
+  801652:	ff d0                	call   *%rax
+  801654:	e9 81 00 00 00       	jmp    8016da <memcpy_fwd+0x10e>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  801659:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  801660:	00 00 00 
+  801663:	8b 00                	mov    (%rax),%eax
+  801665:	83 e0 01             	and    $0x1,%eax
+  801668:	85 c0                	test   %eax,%eax
+  80166a:	74 21                	je     80168d <memcpy_fwd+0xc1>
+  80166c:	48 81 7d e8 ff 00 00 	cmpq   $0xff,-0x18(%rbp)
+  801673:	00 
+  801674:	76 17                	jbe    80168d <memcpy_fwd+0xc1>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  801676:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80167a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80167e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801682:	48 89 c7             	mov    %rax,%rdi
+  801685:	48 89 d6             	mov    %rdx,%rsi
+  801688:	fc                   	cld
+  801689:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80168b:	eb 4d                	jmp    8016da <memcpy_fwd+0x10e>
+					 : "cc", "memory");
+	else if ((((uint64_t)dst | (uint64_t)src | n) & 7) == 0)
+  80168d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801691:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801695:	48 09 d0             	or     %rdx,%rax
+  801698:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  80169c:	83 e0 07             	and    $0x7,%eax
+  80169f:	48 85 c0             	test   %rax,%rax
+  8016a2:	75 1f                	jne    8016c3 <memcpy_fwd+0xf7>
+		asm volatile("cld; rep movsq\n" ::"D"(dst), "S"(src), "c"(n / 8)
+  8016a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016a8:	48 c1 e8 03          	shr    $0x3,%rax
+  8016ac:	48 89 c1             	mov    %rax,%rcx
+  8016af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016b3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8016b7:	48 89 c7             	mov    %rax,%rdi
+  8016ba:	48 89 d6             	mov    %rdx,%rsi
+  8016bd:	fc                   	cld
+  8016be:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+					 : "cc", "memory");
+}
+  8016c1:	eb 17                	jmp    8016da <memcpy_fwd+0x10e>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  8016c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016c7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8016cb:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8016cf:	48 89 c7             	mov    %rax,%rdi
+  8016d2:	48 89 d6             	mov    %rdx,%rsi
+  8016d5:	fc                   	cld
+  8016d6:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+  8016d8:	eb 00                	jmp    8016da <memcpy_fwd+0x10e>
+  8016da:	90                   	nop
+  8016db:	c9                   	leave
+  8016dc:	c3                   	ret
+
+00000000008016dd <memset>:
+
+void *
+memset(void *v, int c, size_t n)
+{
+  8016dd:	55                   	push   %rbp
+  8016de:	48 89 e5             	mov    %rsp,%rbp
+  8016e1:	48 83 ec 28          	sub    $0x28,%rsp
+  8016e5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016e9:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8016ec:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t pattern;
+
+	if (n == 0)
+  8016f0:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016f5:	75 09                	jne    801700 <memset+0x23>
+		return v;
+  8016f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016fb:	e9 dc 00 00 00       	jmp    8017dc <memset+0xff>
+	c &= 0xFF;
+  801700:	81 65 e4 ff 00 00 00 	andl   $0xff,-0x1c(%rbp)
+	pattern = (uint64_t)c * 0x0101010101010101UL;
+  801707:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80170a:	48 98                	cltq
+  80170c:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801713:	01 01 01 
+  801716:	48 0f af c2          	imul   %rdx,%rax
+  80171a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)v | n) & 31) == 0)
+  80171e:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  801725:	00 00 00 
+  801728:	8b 00                	mov    (%rax),%eax
+  80172a:	83 e0 02             	and    $0x2,%eax
+  80172d:	85 c0                	test   %eax,%eax
+  80172f:	74 3a                	je     80176b <memset+0x8e>
+  801731:	48 81 7d d8 ff 0f 00 	cmpq   $0xfff,-0x28(%rbp)
+  801738:	00 
+  801739:	76 30                	jbe    80176b <memset+0x8e>
+  80173b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80173f:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  801743:	83 e0 1f             	and    $0x1f,%eax
+  801746:	48 85 c0             	test   %rax,%rax
+  801749:	75 20                	jne    80176b <memset+0x8e>
+		memset_nt(v, pattern, n);
+  80174b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80174f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801753:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801757:	48 89 ce             	mov    %rcx,%rsi
+  80175a:	48 89 c7             	mov    %rax,%rdi
+  80175d:	48 b8 d8 14 80 00 00 	movabs $0x8014d8,%rax
+  801764:	00 00 00 
+  801767:	ff d0                	call   *%rax
+  801769:	eb 6d                	jmp    8017d8 <memset+0xfb>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  80176b:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  801772:	00 00 00 
+  801775:	8b 00                	mov    (%rax),%eax
+  801777:	83 e0 01             	and    $0x1,%eax
+  80177a:	85 c0                	test   %eax,%eax
+  80177c:	74 1d                	je     80179b <memset+0xbe>
+  80177e:	48 81 7d d8 ff 00 00 	cmpq   $0xff,-0x28(%rbp)
+  801785:	00 
+  801786:	76 13                	jbe    80179b <memset+0xbe>
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  801788:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80178c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80178f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801793:	48 89 d7             	mov    %rdx,%rdi
+  801796:	fc                   	cld
+  801797:	f3 aa                	rep stos %al,%es:(%rdi)
+  801799:	eb 3d                	jmp    8017d8 <memset+0xfb>
+					 : "cc", "memory");
+	else if ((((uint64_t)v | n) & 7) == 0)
+  80179b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80179f:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  8017a3:	83 e0 07             	and    $0x7,%eax
+  8017a6:	48 85 c0             	test   %rax,%rax
+  8017a9:	75 1c                	jne    8017c7 <memset+0xea>
+		asm volatile("cld; rep stosq\n" ::"D"(v), "a"(pattern), "c"(n / 8)
+  8017ab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017af:	48 c1 e8 03          	shr    $0x3,%rax
+  8017b3:	48 89 c1             	mov    %rax,%rcx
+  8017b6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8017ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017be:	48 89 d7             	mov    %rdx,%rdi
+  8017c1:	fc                   	cld
+  8017c2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8017c5:	eb 11                	jmp    8017d8 <memset+0xfb>
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  8017c7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8017cb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8017ce:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8017d2:	48 89 d7             	mov    %rdx,%rdi
+  8017d5:	fc                   	cld
+  8017d6:	f3 aa                	rep stos %al,%es:(%rdi)
+					 : "cc", "memory");
+	return v;
+  8017d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8017dc:	c9                   	leave
+  8017dd:	c3                   	ret
+
+00000000008017de <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8017de:	55                   	push   %rbp
+  8017df:	48 89 e5             	mov    %rsp,%rbp
+  8017e2:	48 83 ec 28          	sub    $0x28,%rsp
+  8017e6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017ea:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8017ee:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  8017f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017f6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8017fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017fe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d)
+  801802:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801806:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80180a:	73 7c                	jae    801888 <memmove+0xaa>
+  80180c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801810:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801814:	48 01 d0             	add    %rdx,%rax
+  801817:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80181b:	73 6b                	jae    801888 <memmove+0xaa>
+	{
+		// 重叠且 dst 在 src 之后，只能反向复制(ERMS 对反向 rep movsb 没有优化)
+		s += n;
+  80181d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801821:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801825:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801829:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((((uint64_t)s | (uint64_t)d | n) & 7) == 0)
+  80182d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801831:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801835:	48 09 d0             	or     %rdx,%rax
+  801838:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  80183c:	83 e0 07             	and    $0x7,%eax
+  80183f:	48 85 c0             	test   %rax,%rax
+  801842:	75 24                	jne    801868 <memmove+0x8a>
+			asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801844:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801848:	48 83 e8 08          	sub    $0x8,%rax
+  80184c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801850:	48 83 ea 08          	sub    $0x8,%rdx
+  801854:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801858:	48 c1 e9 03          	shr    $0x3,%rcx
+  80185c:	48 89 c7             	mov    %rax,%rdi
+  80185f:	48 89 d6             	mov    %rdx,%rsi
+  801862:	fd                   	std
+  801863:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801866:	eb 1d                	jmp    801885 <memmove+0xa7>
+						 : "cc", "memory");
+		else
+			asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801868:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80186c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801870:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801874:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+  801878:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80187c:	48 89 d7             	mov    %rdx,%rdi
+  80187f:	48 89 c1             	mov    %rax,%rcx
+  801882:	fd                   	std
+  801883:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+						 : "cc", "memory");
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::
+  801885:	fc                   	cld
+  801886:	eb 25                	jmp    8018ad <memmove+0xcf>
+						 : "cc");
+	}
+	else if (n)
+  801888:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80188d:	74 1e                	je     8018ad <memmove+0xcf>
+		memcpy_fwd(d, s, n);
+  80188f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801893:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801897:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80189b:	48 89 ce             	mov    %rcx,%rsi
+  80189e:	48 89 c7             	mov    %rax,%rdi
+  8018a1:	48 b8 cc 15 80 00 00 	movabs $0x8015cc,%rax
+  8018a8:	00 00 00 
+  8018ab:	ff d0                	call   *%rax
+	return dst;
+  8018ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8018b1:	c9                   	leave
+  8018b2:	c3                   	ret
+
+00000000008018b3 <memcpy>:
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8018b3:	55                   	push   %rbp
+  8018b4:	48 89 e5             	mov    %rsp,%rbp
+  8018b7:	48 83 ec 18          	sub    $0x18,%rsp
+  8018bb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8018bf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8018c3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (n)
+  8018c7:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8018cc:	74 1e                	je     8018ec <memcpy+0x39>
+		memcpy_fwd(dst, src, n);
+  8018ce:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018d2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8018d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018da:	48 89 ce             	mov    %rcx,%rsi
+  8018dd:	48 89 c7             	mov    %rax,%rdi
+  8018e0:	48 b8 cc 15 80 00 00 	movabs $0x8015cc,%rax
+  8018e7:	00 00 00 
+  8018ea:	ff d0                	call   *%rax
+	return dst;
+  8018ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8018f0:	c9                   	leave
+  8018f1:	c3                   	ret
+
+00000000008018f2 <memcmp>:
+{
+}
+#endif
+
+int memcmp(const void *v1, const void *v2, size_t n)
+{
+  8018f2:	55                   	push   %rbp
+  8018f3:	48 89 e5             	mov    %rsp,%rbp
+  8018f6:	48 83 ec 28          	sub    $0x28,%rsp
+  8018fa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8018fe:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801902:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *)v1;
+  801906:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80190a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *)v2;
+  80190e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801912:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0)
+  801916:	eb 34                	jmp    80194c <memcmp+0x5a>
+	{
+		if (*s1 != *s2)
+  801918:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80191c:	0f b6 10             	movzbl (%rax),%edx
+  80191f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801923:	0f b6 00             	movzbl (%rax),%eax
+  801926:	38 c2                	cmp    %al,%dl
+  801928:	74 18                	je     801942 <memcmp+0x50>
+			return (int)*s1 - (int)*s2;
+  80192a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80192e:	0f b6 00             	movzbl (%rax),%eax
+  801931:	0f b6 d0             	movzbl %al,%edx
+  801934:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801938:	0f b6 00             	movzbl (%rax),%eax
+  80193b:	0f b6 c0             	movzbl %al,%eax
+  80193e:	29 c2                	sub    %eax,%edx
+  801940:	eb 20                	jmp    801962 <memcmp+0x70>
+		s1++, s2++;
+  801942:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801947:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0)
+  80194c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801950:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801954:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801958:	48 85 c0             	test   %rax,%rax
+  80195b:	75 bb                	jne    801918 <memcmp+0x26>
+	}
+
+	return 0;
+  80195d:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801962:	89 d0                	mov    %edx,%eax
+  801964:	c9                   	leave
+  801965:	c3                   	ret
+
+0000000000801966 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801966:	55                   	push   %rbp
+  801967:	48 89 e5             	mov    %rsp,%rbp
+  80196a:	48 83 ec 28          	sub    $0x28,%rsp
+  80196e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801972:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801975:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *)s + n;
+  801979:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80197d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801981:	48 01 d0             	add    %rdx,%rax
+  801984:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801988:	eb 13                	jmp    80199d <memfind+0x37>
+		if (*(const unsigned char *)s == (unsigned char)c)
+  80198a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80198e:	0f b6 00             	movzbl (%rax),%eax
+  801991:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801994:	38 d0                	cmp    %dl,%al
+  801996:	74 11                	je     8019a9 <memfind+0x43>
+	for (; s < ends; s++)
+  801998:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80199d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019a1:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8019a5:	72 e3                	jb     80198a <memfind+0x24>
+  8019a7:	eb 01                	jmp    8019aa <memfind+0x44>
+			break;
+  8019a9:	90                   	nop
+	return (void *)s;
+  8019aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8019ae:	c9                   	leave
+  8019af:	c3                   	ret
+
+00000000008019b0 <strtol>:
+
+long strtol(const char *s, char **endptr, int base)
+{
+  8019b0:	55                   	push   %rbp
+  8019b1:	48 89 e5             	mov    %rsp,%rbp
+  8019b4:	48 83 ec 38          	sub    $0x38,%rsp
+  8019b8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8019bc:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8019c0:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  8019c3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  8019ca:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8019d1:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8019d2:	eb 05                	jmp    8019d9 <strtol+0x29>
+		s++;
+  8019d4:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  8019d9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019dd:	0f b6 00             	movzbl (%rax),%eax
+  8019e0:	3c 20                	cmp    $0x20,%al
+  8019e2:	74 f0                	je     8019d4 <strtol+0x24>
+  8019e4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019e8:	0f b6 00             	movzbl (%rax),%eax
+  8019eb:	3c 09                	cmp    $0x9,%al
+  8019ed:	74 e5                	je     8019d4 <strtol+0x24>
+
+	// plus/minus sign
+	if (*s == '+')
+  8019ef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019f3:	0f b6 00             	movzbl (%rax),%eax
+  8019f6:	3c 2b                	cmp    $0x2b,%al
+  8019f8:	75 07                	jne    801a01 <strtol+0x51>
+		s++;
+  8019fa:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8019ff:	eb 17                	jmp    801a18 <strtol+0x68>
+	else if (*s == '-')
+  801a01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a05:	0f b6 00             	movzbl (%rax),%eax
+  801a08:	3c 2d                	cmp    $0x2d,%al
+  801a0a:	75 0c                	jne    801a18 <strtol+0x68>
+		s++, neg = 1;
+  801a0c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a11:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801a18:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801a1c:	74 06                	je     801a24 <strtol+0x74>
+  801a1e:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801a22:	75 28                	jne    801a4c <strtol+0x9c>
+  801a24:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a28:	0f b6 00             	movzbl (%rax),%eax
+  801a2b:	3c 30                	cmp    $0x30,%al
+  801a2d:	75 1d                	jne    801a4c <strtol+0x9c>
+  801a2f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a33:	48 83 c0 01          	add    $0x1,%rax
+  801a37:	0f b6 00             	movzbl (%rax),%eax
+  801a3a:	3c 78                	cmp    $0x78,%al
+  801a3c:	75 0e                	jne    801a4c <strtol+0x9c>
+		s += 2, base = 16;
+  801a3e:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801a43:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801a4a:	eb 2c                	jmp    801a78 <strtol+0xc8>
+	else if (base == 0 && s[0] == '0')
+  801a4c:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801a50:	75 19                	jne    801a6b <strtol+0xbb>
+  801a52:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a56:	0f b6 00             	movzbl (%rax),%eax
+  801a59:	3c 30                	cmp    $0x30,%al
+  801a5b:	75 0e                	jne    801a6b <strtol+0xbb>
+		s++, base = 8;
+  801a5d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a62:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801a69:	eb 0d                	jmp    801a78 <strtol+0xc8>
+	else if (base == 0)
+  801a6b:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801a6f:	75 07                	jne    801a78 <strtol+0xc8>
+		base = 10;
+  801a71:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+	// digits
+	while (1)
+	{
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801a78:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a7c:	0f b6 00             	movzbl (%rax),%eax
+  801a7f:	3c 2f                	cmp    $0x2f,%al
+  801a81:	7e 1d                	jle    801aa0 <strtol+0xf0>
+  801a83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a87:	0f b6 00             	movzbl (%rax),%eax
+  801a8a:	3c 39                	cmp    $0x39,%al
+  801a8c:	7f 12                	jg     801aa0 <strtol+0xf0>
+			dig = *s - '0';
+  801a8e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a92:	0f b6 00             	movzbl (%rax),%eax
+  801a95:	0f be c0             	movsbl %al,%eax
+  801a98:	83 e8 30             	sub    $0x30,%eax
+  801a9b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801a9e:	eb 4e                	jmp    801aee <strtol+0x13e>
+		else if (*s >= 'a' && *s <= 'z')
+  801aa0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aa4:	0f b6 00             	movzbl (%rax),%eax
+  801aa7:	3c 60                	cmp    $0x60,%al
+  801aa9:	7e 1d                	jle    801ac8 <strtol+0x118>
+  801aab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aaf:	0f b6 00             	movzbl (%rax),%eax
+  801ab2:	3c 7a                	cmp    $0x7a,%al
+  801ab4:	7f 12                	jg     801ac8 <strtol+0x118>
+			dig = *s - 'a' + 10;
+  801ab6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aba:	0f b6 00             	movzbl (%rax),%eax
+  801abd:	0f be c0             	movsbl %al,%eax
+  801ac0:	83 e8 57             	sub    $0x57,%eax
+  801ac3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801ac6:	eb 26                	jmp    801aee <strtol+0x13e>
+		else if (*s >= 'A' && *s <= 'Z')
+  801ac8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801acc:	0f b6 00             	movzbl (%rax),%eax
+  801acf:	3c 40                	cmp    $0x40,%al
+  801ad1:	7e 47                	jle    801b1a <strtol+0x16a>
+  801ad3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ad7:	0f b6 00             	movzbl (%rax),%eax
+  801ada:	3c 5a                	cmp    $0x5a,%al
+  801adc:	7f 3c                	jg     801b1a <strtol+0x16a>
+			dig = *s - 'A' + 10;
+  801ade:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ae2:	0f b6 00             	movzbl (%rax),%eax
+  801ae5:	0f be c0             	movsbl %al,%eax
+  801ae8:	83 e8 37             	sub    $0x37,%eax
+  801aeb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801aee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801af1:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801af4:	7d 23                	jge    801b19 <strtol+0x169>
+			break;
+		s++, val = (val * base) + dig;
+  801af6:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801afb:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801afe:	48 98                	cltq
+  801b00:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801b05:	48 89 c2             	mov    %rax,%rdx
+  801b08:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801b0b:	48 98                	cltq
+  801b0d:	48 01 d0             	add    %rdx,%rax
+  801b10:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+  801b14:	e9 5f ff ff ff       	jmp    801a78 <strtol+0xc8>
+			break;
+  801b19:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801b1a:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801b1f:	74 0b                	je     801b2c <strtol+0x17c>
+		*endptr = (char *)s;
+  801b21:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b25:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801b29:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801b2c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b30:	74 09                	je     801b3b <strtol+0x18b>
+  801b32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b36:	48 f7 d8             	neg    %rax
+  801b39:	eb 04                	jmp    801b3f <strtol+0x18f>
+  801b3b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801b3f:	c9                   	leave
+  801b40:	c3                   	ret
+
+0000000000801b41 <strstr>:
+
+char *strstr(const char *in, const char *str)
+{
+  801b41:	55                   	push   %rbp
+  801b42:	48 89 e5             	mov    %rsp,%rbp
+  801b45:	48 83 ec 30          	sub    $0x30,%rsp
+  801b49:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b4d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801b51:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b55:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b59:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801b5d:	0f b6 00             	movzbl (%rax),%eax
+  801b60:	88 45 ff             	mov    %al,-0x1(%rbp)
+	if (!c)
+  801b63:	80 7d ff 00          	cmpb   $0x0,-0x1(%rbp)
+  801b67:	75 06                	jne    801b6f <strstr+0x2e>
+		return (char *)in; // Trivial empty string case
+  801b69:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b6d:	eb 6b                	jmp    801bda <strstr+0x99>
+
+	len = strlen(str);
+  801b6f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b73:	48 89 c7             	mov    %rax,%rdi
+  801b76:	48 b8 e6 10 80 00 00 	movabs $0x8010e6,%rax
+  801b7d:	00 00 00 
+  801b80:	ff d0                	call   *%rax
+  801b82:	48 98                	cltq
+  801b84:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+		char sc;
+
+		do
+		{
+			sc = *in++;
+  801b88:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b8c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b90:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801b94:	0f b6 00             	movzbl (%rax),%eax
+  801b97:	88 45 ef             	mov    %al,-0x11(%rbp)
+			if (!sc)
+  801b9a:	80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+  801b9e:	75 07                	jne    801ba7 <strstr+0x66>
+				return (char *)0;
+  801ba0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba5:	eb 33                	jmp    801bda <strstr+0x99>
+		} while (sc != c);
+  801ba7:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+  801bab:	3a 45 ff             	cmp    -0x1(%rbp),%al
+  801bae:	75 d8                	jne    801b88 <strstr+0x47>
+	} while (strncmp(in, str, len) != 0);
+  801bb0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801bb4:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801bb8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bbc:	48 89 ce             	mov    %rcx,%rsi
+  801bbf:	48 89 c7             	mov    %rax,%rdi
+  801bc2:	48 b8 01 13 80 00 00 	movabs $0x801301,%rax
+  801bc9:	00 00 00 
+  801bcc:	ff d0                	call   *%rax
+  801bce:	85 c0                	test   %eax,%eax
+  801bd0:	75 b6                	jne    801b88 <strstr+0x47>
+
+	return (char *)(in - 1);
+  801bd2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bd6:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801bda:	c9                   	leave
+  801bdb:	c3                   	ret
+
+0000000000801bdc <syscall>:
+ * 用户的指令式系统调用，该函数将系统调用序号放入eax寄存器，五个参数依次放入edx, ecx, ebx, edi, esi，然后执行指令int 0x30，
+ * 发生中断后，去IDT中查找中断处理函数，最终会走到kern/trap.c的trap_dispatch()中
+ */
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801bdc:	55                   	push   %rbp
+  801bdd:	48 89 e5             	mov    %rsp,%rbp
+  801be0:	53                   	push   %rbx
+  801be1:	48 83 ec 48          	sub    $0x48,%rsp
+  801be5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801be8:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801beb:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801bef:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801bf3:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801bf7:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	 * volatile 告诉汇编程序不要因为不使用返回值就优化该指令
+	 * 最后一个子句告诉汇编程序，指令可能会改变条件代码cx和任意内存memory位置
+	 * 由汇编编译器做好数据保存和恢复工作(栈)
+	 */
+
+	asm volatile("int %1\n"			// code: int T_SYSCALL
+  801bfb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801bfe:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801c02:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801c06:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801c0a:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801c0e:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801c12:	4c 89 c3             	mov    %r8,%rbx
+  801c15:	cd 30                	int    $0x30
+  801c17:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+				   "D"(a4),			// edi = a4
+				   "S"(a5)			// esi = a5
+				 : "cc", "memory"); // 指令可能会改变条件代码cx和任意内存memory位置
+									// 由汇编编译器做好数据保存和恢复工作(栈)
+
+	if (check && ret > 0)
+  801c1b:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801c1f:	74 44                	je     801c65 <syscall+0x89>
+  801c21:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801c26:	7e 3d                	jle    801c65 <syscall+0x89>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c28:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801c2c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801c2f:	49 89 d0             	mov    %rdx,%r8
+  801c32:	89 c1                	mov    %eax,%ecx
+  801c34:	48 b8 68 31 80 00 00 	movabs $0x803168,%rax
+  801c3b:	00 00 00 
+  801c3e:	48 89 c2             	mov    %rax,%rdx
+  801c41:	be 34 00 00 00       	mov    $0x34,%esi
+  801c46:	48 b8 85 31 80 00 00 	movabs $0x803185,%rax
+  801c4d:	00 00 00 
+  801c50:	48 89 c7             	mov    %rax,%rdi
+  801c53:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c58:	49 b9 88 02 80 00 00 	movabs $0x800288,%r9
+  801c5f:	00 00 00 
+  801c62:	41 ff d1             	call   *%r9
+
+	return ret;
+  801c65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801c69:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c6d:	c9                   	leave
+  801c6e:	c3                   	ret
+
+0000000000801c6f <sys_cputs>:
+
+void sys_cputs(const char *s, size_t len)
+{
+  801c6f:	55                   	push   %rbp
+  801c70:	48 89 e5             	mov    %rsp,%rbp
+  801c73:	48 83 ec 10          	sub    $0x10,%rsp
+  801c77:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801c7b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 调用lib/syscall.c中的syscall()
+	// SYS_cputs: 系统调用序号(eax)，s: 需要输出的字符数组，len: 数组长度
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801c7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c83:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c87:	48 83 ec 08          	sub    $0x8,%rsp
+  801c8b:	6a 00                	push   $0x0
+  801c8d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801c93:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c99:	48 89 d1             	mov    %rdx,%rcx
+  801c9c:	48 89 c2             	mov    %rax,%rdx
+  801c9f:	be 00 00 00 00       	mov    $0x0,%esi
+  801ca4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ca9:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  801cb0:	00 00 00 
+  801cb3:	ff d0                	call   *%rax
+  801cb5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801cb9:	90                   	nop
+  801cba:	c9                   	leave
+  801cbb:	c3                   	ret
+
+0000000000801cbc <sys_cgetc>:
+
+int sys_cgetc(void)
+{
+  801cbc:	55                   	push   %rbp
+  801cbd:	48 89 e5             	mov    %rsp,%rbp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801cc0:	48 83 ec 08          	sub    $0x8,%rsp
+  801cc4:	6a 00                	push   $0x0
+  801cc6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ccc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801cd2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cd7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cdc:	be 00 00 00 00       	mov    $0x0,%esi
+  801ce1:	bf 01 00 00 00       	mov    $0x1,%edi
+  801ce6:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  801ced:	00 00 00 
+  801cf0:	ff d0                	call   *%rax
+  801cf2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801cf6:	c9                   	leave
+  801cf7:	c3                   	ret
+
+0000000000801cf8 <sys_env_destroy>:
+
+int sys_env_destroy(envid_t envid)
+{
+  801cf8:	55                   	push   %rbp
+  801cf9:	48 89 e5             	mov    %rsp,%rbp
+  801cfc:	48 83 ec 10          	sub    $0x10,%rsp
+  801d00:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	// 销毁envid对应的环境
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801d03:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d06:	48 98                	cltq
+  801d08:	48 83 ec 08          	sub    $0x8,%rsp
+  801d0c:	6a 00                	push   $0x0
+  801d0e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d14:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d1a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d1f:	48 89 c2             	mov    %rax,%rdx
+  801d22:	be 01 00 00 00       	mov    $0x1,%esi
+  801d27:	bf 03 00 00 00       	mov    $0x3,%edi
+  801d2c:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  801d33:	00 00 00 
+  801d36:	ff d0                	call   *%rax
+  801d38:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d3c:	c9                   	leave
+  801d3d:	c3                   	ret
+
+0000000000801d3e <sys_getprocid>:
+
+envid_t
+sys_getprocid(void)
+{
+  801d3e:	55                   	push   %rbp
+  801d3f:	48 89 e5             	mov    %rsp,%rbp
+	// 获取当前用户环境id
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801d42:	48 83 ec 08          	sub    $0x8,%rsp
+  801d46:	6a 00                	push   $0x0
+  801d48:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d4e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d54:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d59:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d5e:	be 00 00 00 00       	mov    $0x0,%esi
+  801d63:	bf 02 00 00 00       	mov    $0x2,%edi
+  801d68:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  801d6f:	00 00 00 
+  801d72:	ff d0                	call   *%rax
+  801d74:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d78:	c9                   	leave
+  801d79:	c3                   	ret
+
+0000000000801d7a <sys_yield>:
+
+void sys_yield(void)
+{
+  801d7a:	55                   	push   %rbp
+  801d7b:	48 89 e5             	mov    %rsp,%rbp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801d7e:	48 83 ec 08          	sub    $0x8,%rsp
+  801d82:	6a 00                	push   $0x0
+  801d84:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d8a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d90:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d95:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d9a:	be 00 00 00 00       	mov    $0x0,%esi
+  801d9f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801da4:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  801dab:	00 00 00 
+  801dae:	ff d0                	call   *%rax
+  801db0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801db4:	90                   	nop
+  801db5:	c9                   	leave
+  801db6:	c3                   	ret
+
+0000000000801db7 <sys_page_alloc>:
+
+int sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801db7:	55                   	push   %rbp
+  801db8:	48 89 e5             	mov    %rsp,%rbp
+  801dbb:	48 83 ec 10          	sub    $0x10,%rsp
+  801dbf:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801dc2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801dc6:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  801dc9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801dcc:	48 63 c8             	movslq %eax,%rcx
+  801dcf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801dd3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801dd6:	48 98                	cltq
+  801dd8:	48 83 ec 08          	sub    $0x8,%rsp
+  801ddc:	6a 00                	push   $0x0
+  801dde:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801de4:	49 89 c8             	mov    %rcx,%r8
+  801de7:	48 89 d1             	mov    %rdx,%rcx
+  801dea:	48 89 c2             	mov    %rax,%rdx
+  801ded:	be 01 00 00 00       	mov    $0x1,%esi
+  801df2:	bf 04 00 00 00       	mov    $0x4,%edi
+  801df7:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  801dfe:	00 00 00 
+  801e01:	ff d0                	call   *%rax
+  801e03:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e07:	c9                   	leave
+  801e08:	c3                   	ret
+
+0000000000801e09 <sys_page_map>:
+
+int sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801e09:	55                   	push   %rbp
+  801e0a:	48 89 e5             	mov    %rsp,%rbp
+  801e0d:	48 83 ec 20          	sub    $0x20,%rsp
+  801e11:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e14:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801e18:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801e1b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801e1f:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  801e23:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801e26:	48 63 c8             	movslq %eax,%rcx
+  801e29:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  801e2d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801e30:	48 63 f0             	movslq %eax,%rsi
+  801e33:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e37:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e3a:	48 98                	cltq
+  801e3c:	48 83 ec 08          	sub    $0x8,%rsp
+  801e40:	51                   	push   %rcx
+  801e41:	49 89 f9             	mov    %rdi,%r9
+  801e44:	49 89 f0             	mov    %rsi,%r8
+  801e47:	48 89 d1             	mov    %rdx,%rcx
+  801e4a:	48 89 c2             	mov    %rax,%rdx
+  801e4d:	be 01 00 00 00       	mov    $0x1,%esi
+  801e52:	bf 05 00 00 00       	mov    $0x5,%edi
+  801e57:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  801e5e:	00 00 00 
+  801e61:	ff d0                	call   *%rax
+  801e63:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e67:	c9                   	leave
+  801e68:	c3                   	ret
+
+0000000000801e69 <sys_page_unmap>:
+
+int sys_page_unmap(envid_t envid, void *va)
+{
+  801e69:	55                   	push   %rbp
+  801e6a:	48 89 e5             	mov    %rsp,%rbp
+  801e6d:	48 83 ec 10          	sub    $0x10,%rsp
+  801e71:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e74:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  801e78:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e7c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e7f:	48 98                	cltq
+  801e81:	48 83 ec 08          	sub    $0x8,%rsp
+  801e85:	6a 00                	push   $0x0
+  801e87:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e8d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e93:	48 89 d1             	mov    %rdx,%rcx
+  801e96:	48 89 c2             	mov    %rax,%rdx
+  801e99:	be 01 00 00 00       	mov    $0x1,%esi
+  801e9e:	bf 06 00 00 00       	mov    $0x6,%edi
+  801ea3:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  801eaa:	00 00 00 
+  801ead:	ff d0                	call   *%rax
+  801eaf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801eb3:	c9                   	leave
+  801eb4:	c3                   	ret
+
+0000000000801eb5 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int sys_env_set_status(envid_t envid, int status)
+{
+  801eb5:	55                   	push   %rbp
+  801eb6:	48 89 e5             	mov    %rsp,%rbp
+  801eb9:	48 83 ec 10          	sub    $0x10,%rsp
+  801ebd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801ec0:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801ec3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801ec6:	48 63 d0             	movslq %eax,%rdx
+  801ec9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ecc:	48 98                	cltq
+  801ece:	48 83 ec 08          	sub    $0x8,%rsp
+  801ed2:	6a 00                	push   $0x0
+  801ed4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801eda:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ee0:	48 89 d1             	mov    %rdx,%rcx
+  801ee3:	48 89 c2             	mov    %rax,%rdx
+  801ee6:	be 01 00 00 00       	mov    $0x1,%esi
+  801eeb:	bf 08 00 00 00       	mov    $0x8,%edi
+  801ef0:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  801ef7:	00 00 00 
+  801efa:	ff d0                	call   *%rax
+  801efc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f00:	c9                   	leave
+  801f01:	c3                   	ret
+
+0000000000801f02 <sys_env_set_trapframe>:
+
+int sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801f02:	55                   	push   %rbp
+  801f03:	48 89 e5             	mov    %rsp,%rbp
+  801f06:	48 83 ec 10          	sub    $0x10,%rsp
+  801f0a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f0d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  801f11:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801f15:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f18:	48 98                	cltq
+  801f1a:	48 83 ec 08          	sub    $0x8,%rsp
+  801f1e:	6a 00                	push   $0x0
+  801f20:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f26:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f2c:	48 89 d1             	mov    %rdx,%rcx
+  801f2f:	48 89 c2             	mov    %rax,%rdx
+  801f32:	be 01 00 00 00       	mov    $0x1,%esi
+  801f37:	bf 09 00 00 00       	mov    $0x9,%edi
+  801f3c:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  801f43:	00 00 00 
+  801f46:	ff d0                	call   *%rax
+  801f48:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f4c:	c9                   	leave
+  801f4d:	c3                   	ret
+
+0000000000801f4e <sys_env_set_pgfault_upcall>:
+
+int sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801f4e:	55                   	push   %rbp
+  801f4f:	48 89 e5             	mov    %rsp,%rbp
+  801f52:	48 83 ec 10          	sub    $0x10,%rsp
+  801f56:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f59:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  801f5d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801f61:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f64:	48 98                	cltq
+  801f66:	48 83 ec 08          	sub    $0x8,%rsp
+  801f6a:	6a 00                	push   $0x0
+  801f6c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f72:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f78:	48 89 d1             	mov    %rdx,%rcx
+  801f7b:	48 89 c2             	mov    %rax,%rdx
+  801f7e:	be 01 00 00 00       	mov    $0x1,%esi
+  801f83:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801f88:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  801f8f:	00 00 00 
+  801f92:	ff d0                	call   *%rax
+  801f94:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f98:	c9                   	leave
+  801f99:	c3                   	ret
+
+0000000000801f9a <sys_ipc_try_send>:
+
+int sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  801f9a:	55                   	push   %rbp
+  801f9b:	48 89 e5             	mov    %rsp,%rbp
+  801f9e:	48 83 ec 20          	sub    $0x20,%rsp
+  801fa2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801fa5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801fa9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801fad:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  801fb0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801fb3:	48 63 f0             	movslq %eax,%rsi
+  801fb6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801fba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fbd:	48 98                	cltq
+  801fbf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801fc3:	48 83 ec 08          	sub    $0x8,%rsp
+  801fc7:	6a 00                	push   $0x0
+  801fc9:	49 89 f1             	mov    %rsi,%r9
+  801fcc:	49 89 c8             	mov    %rcx,%r8
+  801fcf:	48 89 d1             	mov    %rdx,%rcx
+  801fd2:	48 89 c2             	mov    %rax,%rdx
+  801fd5:	be 00 00 00 00       	mov    $0x0,%esi
+  801fda:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801fdf:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  801fe6:	00 00 00 
+  801fe9:	ff d0                	call   *%rax
+  801feb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fef:	c9                   	leave
+  801ff0:	c3                   	ret
+
+0000000000801ff1 <sys_ipc_recv>:
+
+int sys_ipc_recv(void *dstva)
+{
+  801ff1:	55                   	push   %rbp
+  801ff2:	48 89 e5             	mov    %rsp,%rbp
+  801ff5:	48 83 ec 10          	sub    $0x10,%rsp
+  801ff9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  801ffd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802001:	48 83 ec 08          	sub    $0x8,%rsp
+  802005:	6a 00                	push   $0x0
+  802007:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80200d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802013:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802018:	48 89 c2             	mov    %rax,%rdx
+  80201b:	be 01 00 00 00       	mov    $0x1,%esi
+  802020:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802025:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  80202c:	00 00 00 
+  80202f:	ff d0                	call   *%rax
+  802031:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802035:	c9                   	leave
+  802036:	c3                   	ret
+
+0000000000802037 <sys_disk_io>:
+
+int sys_disk_io(int dev, uint64_t secno, void *va, size_t nsecs, int write)
+{
+  802037:	55                   	push   %rbp
+  802038:	48 89 e5             	mov    %rsp,%rbp
+  80203b:	48 83 ec 20          	sub    $0x20,%rsp
+  80203f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802042:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802046:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80204a:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  80204e:	44 89 45 f8          	mov    %r8d,-0x8(%rbp)
+	return syscall(SYS_disk_io, 0, dev, secno, (uint64_t)va, nsecs, write);
+  802052:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802055:	48 63 c8             	movslq %eax,%rcx
+  802058:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80205c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80205f:	48 98                	cltq
+  802061:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802065:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802069:	48 83 ec 08          	sub    $0x8,%rsp
+  80206d:	51                   	push   %rcx
+  80206e:	49 89 f9             	mov    %rdi,%r9
+  802071:	49 89 f0             	mov    %rsi,%r8
+  802074:	48 89 d1             	mov    %rdx,%rcx
+  802077:	48 89 c2             	mov    %rax,%rdx
+  80207a:	be 00 00 00 00       	mov    $0x0,%esi
+  80207f:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802084:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  80208b:	00 00 00 
+  80208e:	ff d0                	call   *%rax
+  802090:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802094:	c9                   	leave
+  802095:	c3                   	ret
+
+0000000000802096 <sys_vma_alloc>:
+
+int sys_vma_alloc(envid_t envid, void *va, size_t len, int perm)
+{
+  802096:	55                   	push   %rbp
+  802097:	48 89 e5             	mov    %rsp,%rbp
+  80209a:	48 83 ec 20          	sub    $0x20,%rsp
+  80209e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020a1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8020a5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8020a9:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_vma_alloc, 1, envid, (uint64_t)va, len, perm, 0);
+  8020ac:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8020af:	48 63 f0             	movslq %eax,%rsi
+  8020b2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8020b6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020b9:	48 98                	cltq
+  8020bb:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8020bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8020c3:	6a 00                	push   $0x0
+  8020c5:	49 89 f1             	mov    %rsi,%r9
+  8020c8:	49 89 c8             	mov    %rcx,%r8
+  8020cb:	48 89 d1             	mov    %rdx,%rcx
+  8020ce:	48 89 c2             	mov    %rax,%rdx
+  8020d1:	be 01 00 00 00       	mov    $0x1,%esi
+  8020d6:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8020db:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  8020e2:	00 00 00 
+  8020e5:	ff d0                	call   *%rax
+  8020e7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020eb:	c9                   	leave
+  8020ec:	c3                   	ret
+
+00000000008020ed <sys_vma_clear>:
+
+int sys_vma_clear(envid_t envid)
+{
+  8020ed:	55                   	push   %rbp
+  8020ee:	48 89 e5             	mov    %rsp,%rbp
+  8020f1:	48 83 ec 10          	sub    $0x10,%rsp
+  8020f5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_vma_clear, 1, envid, 0, 0, 0, 0);
+  8020f8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020fb:	48 98                	cltq
+  8020fd:	48 83 ec 08          	sub    $0x8,%rsp
+  802101:	6a 00                	push   $0x0
+  802103:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802109:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80210f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802114:	48 89 c2             	mov    %rax,%rdx
+  802117:	be 01 00 00 00       	mov    $0x1,%esi
+  80211c:	bf 10 00 00 00       	mov    $0x10,%edi
+  802121:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  802128:	00 00 00 
+  80212b:	ff d0                	call   *%rax
+  80212d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802131:	c9                   	leave
+  802132:	c3                   	ret
+
+0000000000802133 <sys_trace_ctl>:
+
+int sys_trace_ctl(int enable)
+{
+  802133:	55                   	push   %rbp
+  802134:	48 89 e5             	mov    %rsp,%rbp
+  802137:	48 83 ec 10          	sub    $0x10,%rsp
+  80213b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_trace_ctl, 0, enable, 0, 0, 0, 0);
+  80213e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802141:	48 98                	cltq
+  802143:	48 83 ec 08          	sub    $0x8,%rsp
+  802147:	6a 00                	push   $0x0
+  802149:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80214f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802155:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80215a:	48 89 c2             	mov    %rax,%rdx
+  80215d:	be 00 00 00 00       	mov    $0x0,%esi
+  802162:	bf 11 00 00 00       	mov    $0x11,%edi
+  802167:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  80216e:	00 00 00 
+  802171:	ff d0                	call   *%rax
+  802173:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802177:	c9                   	leave
+  802178:	c3                   	ret
+
+0000000000802179 <sys_trace_read>:
+
+int sys_trace_read(int cpu, uint64_t *seq, struct TraceEvent *buf, int n)
+{
+  802179:	55                   	push   %rbp
+  80217a:	48 89 e5             	mov    %rsp,%rbp
+  80217d:	48 83 ec 20          	sub    $0x20,%rsp
+  802181:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802184:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802188:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80218c:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_trace_read, 0, cpu, (uint64_t)seq, (uint64_t)buf, n, 0);
+  80218f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802192:	48 63 f0             	movslq %eax,%rsi
+  802195:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802199:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80219d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021a0:	48 98                	cltq
+  8021a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8021a6:	6a 00                	push   $0x0
+  8021a8:	49 89 f1             	mov    %rsi,%r9
+  8021ab:	49 89 c8             	mov    %rcx,%r8
+  8021ae:	48 89 d1             	mov    %rdx,%rcx
+  8021b1:	48 89 c2             	mov    %rax,%rdx
+  8021b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b9:	bf 12 00 00 00       	mov    $0x12,%edi
+  8021be:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  8021c5:	00 00 00 
+  8021c8:	ff d0                	call   *%rax
+  8021ca:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021ce:	c9                   	leave
+  8021cf:	c3                   	ret
+
+00000000008021d0 <sys_getrusage>:
+
+int sys_getrusage(envid_t envid, struct Rusage *ru)
+{
+  8021d0:	55                   	push   %rbp
+  8021d1:	48 89 e5             	mov    %rsp,%rbp
+  8021d4:	48 83 ec 10          	sub    $0x10,%rsp
+  8021d8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021db:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_getrusage, 0, envid, (uint64_t)ru, 0, 0, 0);
+  8021df:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021e3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021e6:	48 98                	cltq
+  8021e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8021ec:	6a 00                	push   $0x0
+  8021ee:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021fa:	48 89 d1             	mov    %rdx,%rcx
+  8021fd:	48 89 c2             	mov    %rax,%rdx
+  802200:	be 00 00 00 00       	mov    $0x0,%esi
+  802205:	bf 13 00 00 00       	mov    $0x13,%edi
+  80220a:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  802211:	00 00 00 
+  802214:	ff d0                	call   *%rax
+  802216:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80221a:	c9                   	leave
+  80221b:	c3                   	ret
+
+000000000080221c <sys_pmu_config>:
+
+int sys_pmu_config(int idx, uint64_t event)
+{
+  80221c:	55                   	push   %rbp
+  80221d:	48 89 e5             	mov    %rsp,%rbp
+  802220:	48 83 ec 10          	sub    $0x10,%rsp
+  802224:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802227:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_pmu_config, 0, idx, event, 0, 0, 0);
+  80222b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80222e:	48 98                	cltq
+  802230:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802234:	48 83 ec 08          	sub    $0x8,%rsp
+  802238:	6a 00                	push   $0x0
+  80223a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802240:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802246:	48 89 d1             	mov    %rdx,%rcx
+  802249:	48 89 c2             	mov    %rax,%rdx
+  80224c:	be 00 00 00 00       	mov    $0x0,%esi
+  802251:	bf 14 00 00 00       	mov    $0x14,%edi
+  802256:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  80225d:	00 00 00 
+  802260:	ff d0                	call   *%rax
+  802262:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802266:	c9                   	leave
+  802267:	c3                   	ret
+
+0000000000802268 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  802268:	55                   	push   %rbp
+  802269:	48 89 e5             	mov    %rsp,%rbp
+  80226c:	48 83 ec 10          	sub    $0x10,%rsp
+  802270:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+  802273:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802276:	48 83 ec 08          	sub    $0x8,%rsp
+  80227a:	6a 00                	push   $0x0
+  80227c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802282:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802288:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80228d:	48 89 c2             	mov    %rax,%rdx
+  802290:	be 00 00 00 00       	mov    $0x0,%esi
+  802295:	bf 15 00 00 00       	mov    $0x15,%edi
+  80229a:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  8022a1:	00 00 00 
+  8022a4:	ff d0                	call   *%rax
+  8022a6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022aa:	c9                   	leave
+  8022ab:	c3                   	ret
+
+00000000008022ac <sys_image_attach>:
+
+int sys_image_attach(envid_t envid, int dev, const uint64_t *secnos, size_t size)
+{
+  8022ac:	55                   	push   %rbp
+  8022ad:	48 89 e5             	mov    %rsp,%rbp
+  8022b0:	48 83 ec 20          	sub    $0x20,%rsp
+  8022b4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022b7:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  8022ba:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8022be:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+	return syscall(SYS_image_attach, 1, envid, dev, (uint64_t)secnos, size, 0);
+  8022c2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8022c6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8022c9:	48 63 d0             	movslq %eax,%rdx
+  8022cc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8022cf:	48 98                	cltq
+  8022d1:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8022d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8022d9:	6a 00                	push   $0x0
+  8022db:	49 89 f1             	mov    %rsi,%r9
+  8022de:	49 89 c8             	mov    %rcx,%r8
+  8022e1:	48 89 d1             	mov    %rdx,%rcx
+  8022e4:	48 89 c2             	mov    %rax,%rdx
+  8022e7:	be 01 00 00 00       	mov    $0x1,%esi
+  8022ec:	bf 16 00 00 00       	mov    $0x16,%edi
+  8022f1:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  8022f8:	00 00 00 
+  8022fb:	ff d0                	call   *%rax
+  8022fd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802301:	c9                   	leave
+  802302:	c3                   	ret
+
+0000000000802303 <sys_vma_binary>:
+
+int sys_vma_binary(envid_t envid, const struct Proghdr *ph)
+{
+  802303:	55                   	push   %rbp
+  802304:	48 89 e5             	mov    %rsp,%rbp
+  802307:	48 83 ec 10          	sub    $0x10,%rsp
+  80230b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80230e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_vma_binary, 1, envid, (uint64_t)ph, 0, 0, 0);
+  802312:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802316:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802319:	48 98                	cltq
+  80231b:	48 83 ec 08          	sub    $0x8,%rsp
+  80231f:	6a 00                	push   $0x0
+  802321:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802327:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80232d:	48 89 d1             	mov    %rdx,%rcx
+  802330:	48 89 c2             	mov    %rax,%rdx
+  802333:	be 01 00 00 00       	mov    $0x1,%esi
+  802338:	bf 17 00 00 00       	mov    $0x17,%edi
+  80233d:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  802344:	00 00 00 
+  802347:	ff d0                	call   *%rax
+  802349:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80234d:	c9                   	leave
+  80234e:	c3                   	ret
+
+000000000080234f <pgfault>:
+ * 自定义页错误处理函数.
+ * 当出现页错误，主要是对标志为可写的或者COW的物理页分配新页，复制旧页的数据到新页并映射到旧页的地址空间
+ */
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80234f:	55                   	push   %rbp
+  802350:	48 89 e5             	mov    %rsp,%rbp
+  802353:	48 83 ec 40          	sub    $0x40,%rsp
+  802357:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	void *addr = (void *)utf->utf_fault_va;
+  80235b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80235f:	48 8b 00             	mov    (%rax),%rax
+  802362:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint32_t err = utf->utf_err;
+  802366:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80236a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80236e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	int r;
+
+	// 检查出错的访问(1)写，(2)COW页.  若不是，调用panic().
+	// pte_t entry = uvpt[VPN(addr)];
+	// 分配一个新页，将其映射到临时位置(PFTEMP)，将旧页数据复制到新页，然后将新页移动到旧页的地址.
+	if ((err & FEC_WR) && (uvpt[VPN(addr)] & PTE_COW))
+  802371:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802374:	83 e0 02             	and    $0x2,%eax
+  802377:	85 c0                	test   %eax,%eax
+  802379:	0f 84 61 01 00 00    	je     8024e0 <pgfault+0x191>
+  80237f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802383:	48 c1 e8 0c          	shr    $0xc,%rax
+  802387:	48 89 c2             	mov    %rax,%rdx
+  80238a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802391:	01 00 00 
+  802394:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802398:	25 00 08 00 00       	and    $0x800,%eax
+  80239d:	48 85 c0             	test   %rax,%rax
+  8023a0:	0f 84 3a 01 00 00    	je     8024e0 <pgfault+0x191>
+	{
+		if (sys_page_alloc(0, (void *)PFTEMP, PTE_U | PTE_P | PTE_W) == 0)
+  8023a6:	ba 07 00 00 00       	mov    $0x7,%edx
+  8023ab:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8023b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023b5:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  8023bc:	00 00 00 
+  8023bf:	ff d0                	call   *%rax
+  8023c1:	85 c0                	test   %eax,%eax
+  8023c3:	0f 85 e7 00 00 00    	jne    8024b0 <pgfault+0x161>
+		{
+			// 分配了新的物理页以后准备从原页面开始拷贝数据时，记得将地址和物理页大小对齐
+			void *pg_addr = ROUNDDOWN(addr, PGSIZE);
+  8023c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023cd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  8023d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023d5:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8023db:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+			memmove(PFTEMP, pg_addr, PGSIZE);
+  8023df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8023e3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023e8:	48 89 c6             	mov    %rax,%rsi
+  8023eb:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  8023f0:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  8023f7:	00 00 00 
+  8023fa:	ff d0                	call   *%rax
+			r = sys_page_map(0, (void *)PFTEMP, 0, pg_addr, PTE_U | PTE_W | PTE_P);
+  8023fc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802400:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802406:	48 89 c1             	mov    %rax,%rcx
+  802409:	ba 00 00 00 00       	mov    $0x0,%edx
+  80240e:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802413:	bf 00 00 00 00       	mov    $0x0,%edi
+  802418:	48 b8 09 1e 80 00 00 	movabs $0x801e09,%rax
+  80241f:	00 00 00 
+  802422:	ff d0                	call   *%rax
+  802424:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			if (r < 0)
+  802427:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80242b:	79 30                	jns    80245d <pgfault+0x10e>
+			{
+				panic("pgfault...something wrong with page_map");
+  80242d:	48 b8 98 31 80 00 00 	movabs $0x803198,%rax
+  802434:	00 00 00 
+  802437:	48 89 c2             	mov    %rax,%rdx
+  80243a:	be 22 00 00 00       	mov    $0x22,%esi
+  80243f:	48 b8 c0 31 80 00 00 	movabs $0x8031c0,%rax
+  802446:	00 00 00 
+  802449:	48 89 c7             	mov    %rax,%rdi
+  80244c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802451:	48 b9 88 02 80 00 00 	movabs $0x800288,%rcx
+  802458:	00 00 00 
+  80245b:	ff d1                	call   *%rcx
+			}
+			r = sys_page_unmap(0, PFTEMP);
+  80245d:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802462:	bf 00 00 00 00       	mov    $0x0,%edi
+  802467:	48 b8 69 1e 80 00 00 	movabs $0x801e69,%rax
+  80246e:	00 00 00 
+  802471:	ff d0                	call   *%rax
+  802473:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			if (r < 0)
+  802476:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80247a:	0f 89 96 00 00 00    	jns    802516 <pgfault+0x1c7>
+			{
+				panic("pgfault...something wrong with page_unmap");
+  802480:	48 b8 d0 31 80 00 00 	movabs $0x8031d0,%rax
+  802487:	00 00 00 
+  80248a:	48 89 c2             	mov    %rax,%rdx
+  80248d:	be 27 00 00 00       	mov    $0x27,%esi
+  802492:	48 b8 c0 31 80 00 00 	movabs $0x8031c0,%rax
+  802499:	00 00 00 
+  80249c:	48 89 c7             	mov    %rax,%rdi
+  80249f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a4:	48 b9 88 02 80 00 00 	movabs $0x800288,%rcx
+  8024ab:	00 00 00 
+  8024ae:	ff d1                	call   *%rcx
+			}
+			return;
+		}
+		else
+		{
+			panic("pgfault...something wrong with page_alloc");
+  8024b0:	48 b8 00 32 80 00 00 	movabs $0x803200,%rax
+  8024b7:	00 00 00 
+  8024ba:	48 89 c2             	mov    %rax,%rdx
+  8024bd:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8024c2:	48 b8 c0 31 80 00 00 	movabs $0x8031c0,%rax
+  8024c9:	00 00 00 
+  8024cc:	48 89 c7             	mov    %rax,%rdi
+  8024cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d4:	48 b9 88 02 80 00 00 	movabs $0x800288,%rcx
+  8024db:	00 00 00 
+  8024de:	ff d1                	call   *%rcx
+		}
+	}
+	else
+	{
+		panic("pgfault...wrong error %e", err);
+  8024e0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8024e3:	89 c1                	mov    %eax,%ecx
+  8024e5:	48 b8 2a 32 80 00 00 	movabs $0x80322a,%rax
+  8024ec:	00 00 00 
+  8024ef:	48 89 c2             	mov    %rax,%rdx
+  8024f2:	be 32 00 00 00       	mov    $0x32,%esi
+  8024f7:	48 b8 c0 31 80 00 00 	movabs $0x8031c0,%rax
+  8024fe:	00 00 00 
+  802501:	48 89 c7             	mov    %rax,%rdi
+  802504:	b8 00 00 00 00       	mov    $0x0,%eax
+  802509:	49 b8 88 02 80 00 00 	movabs $0x800288,%r8
+  802510:	00 00 00 
+  802513:	41 ff d0             	call   *%r8
+			return;
+  802516:	90                   	nop
+	}
+}
+  802517:	c9                   	leave
+  802518:	c3                   	ret
+
+0000000000802519 <duppage>:
+ * 映射: 将的虚拟页pn(地址: pn*PGSIZE)映射到相同虚拟地址的 envid 中.
+ * 成功: 返回0，失败调用 panic()
+ */
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  802519:	55                   	push   %rbp
+  80251a:	48 89 e5             	mov    %rsp,%rbp
+  80251d:	48 83 ec 30          	sub    $0x30,%rsp
+  802521:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802524:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	pte_t entry = uvpt[pn];
+  802527:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  80252e:	01 00 00 
+  802531:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802534:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802538:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	void *addr = (void *)((uintptr_t)pn * PGSIZE);
+  80253c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80253f:	48 c1 e0 0c          	shl    $0xc,%rax
+  802543:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	int perm = entry & PTE_SYSCALL;
+  802547:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80254b:	25 07 0e 00 00       	and    $0xe07,%eax
+  802550:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm & PTE_SHARE)
+  802553:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802556:	25 00 04 00 00       	and    $0x400,%eax
+  80255b:	85 c0                	test   %eax,%eax
+  80255d:	74 68                	je     8025c7 <duppage+0xae>
+	{
+		r = sys_page_map(0, addr, envid, addr, perm);
+  80255f:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  802562:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802566:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802569:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80256d:	41 89 f0             	mov    %esi,%r8d
+  802570:	48 89 c6             	mov    %rax,%rsi
+  802573:	bf 00 00 00 00       	mov    $0x0,%edi
+  802578:	48 b8 09 1e 80 00 00 	movabs $0x801e09,%rax
+  80257f:	00 00 00 
+  802582:	ff d0                	call   *%rax
+  802584:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  802587:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80258b:	0f 89 90 01 00 00    	jns    802721 <duppage+0x208>
+		{
+			panic("Something went wrong on duppage %e", r);
+  802591:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802594:	89 c1                	mov    %eax,%ecx
+  802596:	48 b8 48 32 80 00 00 	movabs $0x803248,%rax
+  80259d:	00 00 00 
+  8025a0:	48 89 c2             	mov    %rax,%rdx
+  8025a3:	be 48 00 00 00       	mov    $0x48,%esi
+  8025a8:	48 b8 c0 31 80 00 00 	movabs $0x8031c0,%rax
+  8025af:	00 00 00 
+  8025b2:	48 89 c7             	mov    %rax,%rdi
+  8025b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025ba:	49 b8 88 02 80 00 00 	movabs $0x800288,%r8
+  8025c1:	00 00 00 
+  8025c4:	41 ff d0             	call   *%r8
+		}
+	}
+	else if ((perm & PTE_COW) || (perm & PTE_W))
+  8025c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8025ca:	25 00 08 00 00       	and    $0x800,%eax
+  8025cf:	85 c0                	test   %eax,%eax
+  8025d1:	75 0e                	jne    8025e1 <duppage+0xc8>
+  8025d3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8025d6:	83 e0 02             	and    $0x2,%eax
+  8025d9:	85 c0                	test   %eax,%eax
+  8025db:	0f 84 dc 00 00 00    	je     8026bd <duppage+0x1a4>
+	{
+		perm &= ~PTE_W;
+  8025e1:	83 65 ec fd          	andl   $0xfffffffd,-0x14(%rbp)
+		perm |= PTE_COW;
+  8025e5:	81 4d ec 00 08 00 00 	orl    $0x800,-0x14(%rbp)
+		r = sys_page_map(0, addr, envid, addr, perm);
+  8025ec:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8025ef:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025f3:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8025f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8025fa:	41 89 f0             	mov    %esi,%r8d
+  8025fd:	48 89 c6             	mov    %rax,%rsi
+  802600:	bf 00 00 00 00       	mov    $0x0,%edi
+  802605:	48 b8 09 1e 80 00 00 	movabs $0x801e09,%rax
+  80260c:	00 00 00 
+  80260f:	ff d0                	call   *%rax
+  802611:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  802614:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802618:	79 36                	jns    802650 <duppage+0x137>
+		{
+			panic("Something went wrong on duppage %e", r);
+  80261a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80261d:	89 c1                	mov    %eax,%ecx
+  80261f:	48 b8 48 32 80 00 00 	movabs $0x803248,%rax
+  802626:	00 00 00 
+  802629:	48 89 c2             	mov    %rax,%rdx
+  80262c:	be 52 00 00 00       	mov    $0x52,%esi
+  802631:	48 b8 c0 31 80 00 00 	movabs $0x8031c0,%rax
+  802638:	00 00 00 
+  80263b:	48 89 c7             	mov    %rax,%rdi
+  80263e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802643:	49 b8 88 02 80 00 00 	movabs $0x800288,%r8
+  80264a:	00 00 00 
+  80264d:	41 ff d0             	call   *%r8
+		}
+		r = sys_page_map(0, addr, 0, addr, perm);
+  802650:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  802653:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802657:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80265b:	41 89 c8             	mov    %ecx,%r8d
+  80265e:	48 89 d1             	mov    %rdx,%rcx
+  802661:	ba 00 00 00 00       	mov    $0x0,%edx
+  802666:	48 89 c6             	mov    %rax,%rsi
+  802669:	bf 00 00 00 00       	mov    $0x0,%edi
+  80266e:	48 b8 09 1e 80 00 00 	movabs $0x801e09,%rax
+  802675:	00 00 00 
+  802678:	ff d0                	call   *%rax
+  80267a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  80267d:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802681:	0f 89 9a 00 00 00    	jns    802721 <duppage+0x208>
+		{
+			panic("Something went wrong on duppage %e", r);
+  802687:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80268a:	89 c1                	mov    %eax,%ecx
+  80268c:	48 b8 48 32 80 00 00 	movabs $0x803248,%rax
+  802693:	00 00 00 
+  802696:	48 89 c2             	mov    %rax,%rdx
+  802699:	be 57 00 00 00       	mov    $0x57,%esi
+  80269e:	48 b8 c0 31 80 00 00 	movabs $0x8031c0,%rax
+  8026a5:	00 00 00 
+  8026a8:	48 89 c7             	mov    %rax,%rdi
+  8026ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b0:	49 b8 88 02 80 00 00 	movabs $0x800288,%r8
+  8026b7:	00 00 00 
+  8026ba:	41 ff d0             	call   *%r8
+		}
+	}
+	else
+	{
+		r = sys_page_map(0, addr, envid, addr, perm);
+  8026bd:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8026c0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8026c4:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8026c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8026cb:	41 89 f0             	mov    %esi,%r8d
+  8026ce:	48 89 c6             	mov    %rax,%rsi
+  8026d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026d6:	48 b8 09 1e 80 00 00 	movabs $0x801e09,%rax
+  8026dd:	00 00 00 
+  8026e0:	ff d0                	call   *%rax
+  8026e2:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (r < 0)
+  8026e5:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8026e9:	79 36                	jns    802721 <duppage+0x208>
+		{
+			panic("Something went wrong on duppage %e", r);
+  8026eb:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8026ee:	89 c1                	mov    %eax,%ecx
+  8026f0:	48 b8 48 32 80 00 00 	movabs $0x803248,%rax
+  8026f7:	00 00 00 
+  8026fa:	48 89 c2             	mov    %rax,%rdx
+  8026fd:	be 5f 00 00 00       	mov    $0x5f,%esi
+  802702:	48 b8 c0 31 80 00 00 	movabs $0x8031c0,%rax
+  802709:	00 00 00 
+  80270c:	48 89 c7             	mov    %rax,%rdi
+  80270f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802714:	49 b8 88 02 80 00 00 	movabs $0x800288,%r8
+  80271b:	00 00 00 
+  80271e:	41 ff d0             	call   *%r8
+		}
+	}
+	return 0;
+  802721:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802726:	c9                   	leave
+  802727:	c3                   	ret
+
+0000000000802728 <fork>:
+ * 
+ * 两个用户异常栈都不应该被标记为COW，所以必须为子环境的异常栈分配一个新页
+ */
+envid_t
+fork(void)
+{
+  802728:	55                   	push   %rbp
+  802729:	48 89 e5             	mov    %rsp,%rbp
+  80272c:	48 83 ec 50          	sub    $0x50,%rsp
+	int r = 0;
+  802730:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	set_pgfault_handler(pgfault);
+  802737:	48 b8 4f 23 80 00 00 	movabs $0x80234f,%rax
+  80273e:	00 00 00 
+  802741:	48 89 c7             	mov    %rax,%rdi
+  802744:	48 b8 a4 2a 80 00 00 	movabs $0x802aa4,%rax
+  80274b:	00 00 00 
+  80274e:	ff d0                	call   *%rax
+// 必须内联.
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  802750:	b8 07 00 00 00       	mov    $0x7,%eax
+  802755:	cd 30                	int    $0x30
+  802757:	89 45 bc             	mov    %eax,-0x44(%rbp)
+					 : "=a"(ret)
+					 : "a"(SYS_exofork),
+					   "i"(T_SYSCALL));
+	return ret;
+  80275a:	8b 45 bc             	mov    -0x44(%rbp),%eax
+	envid_t childid = sys_exofork();
+  80275d:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	if (childid < 0)
+  802760:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  802764:	79 36                	jns    80279c <fork+0x74>
+	{
+		panic("\n couldn't call fork %e\n", childid);
+  802766:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802769:	89 c1                	mov    %eax,%ecx
+  80276b:	48 b8 6b 32 80 00 00 	movabs $0x80326b,%rax
+  802772:	00 00 00 
+  802775:	48 89 c2             	mov    %rax,%rdx
+  802778:	be 7a 00 00 00       	mov    $0x7a,%esi
+  80277d:	48 b8 c0 31 80 00 00 	movabs $0x8031c0,%rax
+  802784:	00 00 00 
+  802787:	48 89 c7             	mov    %rax,%rdi
+  80278a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80278f:	49 b8 88 02 80 00 00 	movabs $0x800288,%r8
+  802796:	00 00 00 
+  802799:	41 ff d0             	call   *%r8
+	}
+	if (childid == 0)
+  80279c:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  8027a0:	75 3e                	jne    8027e0 <fork+0xb8>
+	{
+		// thisproc 父进程
+		thisproc = &procs[ENVX(sys_getprocid())];
+  8027a2:	48 b8 3e 1d 80 00 00 	movabs $0x801d3e,%rax
+  8027a9:	00 00 00 
+  8027ac:	ff d0                	call   *%rax
+  8027ae:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8027b3:	48 98                	cltq
+  8027b5:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  8027bc:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  8027c3:	00 00 00 
+  8027c6:	48 01 c2             	add    %rax,%rdx
+  8027c9:	48 b8 10 40 80 00 00 	movabs $0x804010,%rax
+  8027d0:	00 00 00 
+  8027d3:	48 89 10             	mov    %rdx,(%rax)
+		// 子环境的返回值
+		return 0;
+  8027d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027db:	e9 c2 02 00 00       	jmp    802aa2 <fork+0x37a>
+	}
+	r = sys_page_alloc(childid, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_W | PTE_U);
+  8027e0:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8027e3:	ba 07 00 00 00       	mov    $0x7,%edx
+  8027e8:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  8027ed:	48 89 ce             	mov    %rcx,%rsi
+  8027f0:	89 c7                	mov    %eax,%edi
+  8027f2:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  8027f9:	00 00 00 
+  8027fc:	ff d0                	call   *%rax
+  8027fe:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if (r < 0)
+  802801:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  802805:	79 36                	jns    80283d <fork+0x115>
+		panic("\n couldn't call fork %e\n", r);
+  802807:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80280a:	89 c1                	mov    %eax,%ecx
+  80280c:	48 b8 6b 32 80 00 00 	movabs $0x80326b,%rax
+  802813:	00 00 00 
+  802816:	48 89 c2             	mov    %rax,%rdx
+  802819:	be 85 00 00 00       	mov    $0x85,%esi
+  80281e:	48 b8 c0 31 80 00 00 	movabs $0x8031c0,%rax
+  802825:	00 00 00 
+  802828:	48 89 c7             	mov    %rax,%rdi
+  80282b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802830:	49 b8 88 02 80 00 00 	movabs $0x800288,%r8
+  802837:	00 00 00 
+  80283a:	41 ff d0             	call   *%r8
+
+	uint64_t pml;
+	uint64_t pdpe;
+	uint64_t pde;
+	uint64_t pte;
+	uint64_t each_pde = 0;
+  80283d:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  802844:	00 
+	uint64_t each_pte = 0;
+  802845:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80284c:	00 
+	uint64_t each_pdpe = 0;
+  80284d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802854:	00 
+
+	// 拷贝[0, UXSTACKTOP)的所有用户页，接下来为用户异常栈创建物理页
+	// 因为在创建用户环境时，已经在 env_setup_vm() 中映射了内核所有页
+	for (pml = 0; pml < VPML4E(UTOP); pml++)
+  802855:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80285c:	00 
+  80285d:	e9 80 01 00 00       	jmp    8029e2 <fork+0x2ba>
+	{
+		if (uvpml4e[pml] & PTE_P)
+  802862:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802869:	01 00 00 
+  80286c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802870:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802874:	83 e0 01             	and    $0x1,%eax
+  802877:	48 85 c0             	test   %rax,%rax
+  80287a:	0f 84 4d 01 00 00    	je     8029cd <fork+0x2a5>
+		{
+
+			for (pdpe = 0; pdpe < NPDPENTRIES; pdpe++, each_pdpe++)
+  802880:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802887:	00 
+  802888:	e9 30 01 00 00       	jmp    8029bd <fork+0x295>
+			{
+				if (uvpde[each_pdpe] & PTE_P)
+  80288d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802894:	01 00 00 
+  802897:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80289b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80289f:	83 e0 01             	and    $0x1,%eax
+  8028a2:	48 85 c0             	test   %rax,%rax
+  8028a5:	0f 84 f8 00 00 00    	je     8029a3 <fork+0x27b>
+				{
+
+					for (pde = 0; pde < NPDENTRIES; pde++, each_pde++)
+  8028ab:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8028b2:	00 
+  8028b3:	e9 db 00 00 00       	jmp    802993 <fork+0x26b>
+					{
+						if (uvpd[each_pde] & PTE_P)
+  8028b8:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8028bf:	01 00 00 
+  8028c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028c6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8028ca:	83 e0 01             	and    $0x1,%eax
+  8028cd:	48 85 c0             	test   %rax,%rax
+  8028d0:	0f 84 a3 00 00 00    	je     802979 <fork+0x251>
+						{
+
+							for (pte = 0; pte < NPTENTRIES; pte++, each_pte++)
+  8028d6:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8028dd:	00 
+  8028de:	e9 86 00 00 00       	jmp    802969 <fork+0x241>
+							{
+								if (uvpt[each_pte] & PTE_P)
+  8028e3:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  8028ea:	01 00 00 
+  8028ed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028f1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8028f5:	83 e0 01             	and    $0x1,%eax
+  8028f8:	48 85 c0             	test   %rax,%rax
+  8028fb:	74 62                	je     80295f <fork+0x237>
+								{
+
+									if (each_pte != VPN(UXSTACKTOP - PGSIZE))
+  8028fd:	48 81 7d d0 ff f7 0e 	cmpq   $0xef7ff,-0x30(%rbp)
+  802904:	00 
+  802905:	74 58                	je     80295f <fork+0x237>
+									{
+										r = duppage(childid, (unsigned)each_pte);
+  802907:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80290b:	89 c2                	mov    %eax,%edx
+  80290d:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802910:	89 d6                	mov    %edx,%esi
+  802912:	89 c7                	mov    %eax,%edi
+  802914:	48 b8 19 25 80 00 00 	movabs $0x802519,%rax
+  80291b:	00 00 00 
+  80291e:	ff d0                	call   *%rax
+  802920:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+										if (r < 0)
+  802923:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  802927:	79 36                	jns    80295f <fork+0x237>
+											panic("\n couldn't call fork %e\n", r);
+  802929:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80292c:	89 c1                	mov    %eax,%ecx
+  80292e:	48 b8 6b 32 80 00 00 	movabs $0x80326b,%rax
+  802935:	00 00 00 
+  802938:	48 89 c2             	mov    %rax,%rdx
+  80293b:	be a9 00 00 00       	mov    $0xa9,%esi
+  802940:	48 b8 c0 31 80 00 00 	movabs $0x8031c0,%rax
+  802947:	00 00 00 
+  80294a:	48 89 c7             	mov    %rax,%rdi
+  80294d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802952:	49 b8 88 02 80 00 00 	movabs $0x800288,%r8
+  802959:	00 00 00 
+  80295c:	41 ff d0             	call   *%r8
+							for (pte = 0; pte < NPTENTRIES; pte++, each_pte++)
+  80295f:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  802964:	48 83 45 d0 01       	addq   $0x1,-0x30(%rbp)
+  802969:	48 81 7d e0 ff 01 00 	cmpq   $0x1ff,-0x20(%rbp)
+  802970:	00 
+  802971:	0f 86 6c ff ff ff    	jbe    8028e3 <fork+0x1bb>
+  802977:	eb 10                	jmp    802989 <fork+0x261>
+								}
+							}
+						}
+						else
+						{
+							each_pte = (each_pde + 1) * NPTENTRIES;
+  802979:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80297d:	48 83 c0 01          	add    $0x1,%rax
+  802981:	48 c1 e0 09          	shl    $0x9,%rax
+  802985:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+					for (pde = 0; pde < NPDENTRIES; pde++, each_pde++)
+  802989:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80298e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802993:	48 81 7d e8 ff 01 00 	cmpq   $0x1ff,-0x18(%rbp)
+  80299a:	00 
+  80299b:	0f 86 17 ff ff ff    	jbe    8028b8 <fork+0x190>
+  8029a1:	eb 10                	jmp    8029b3 <fork+0x28b>
+						}
+					}
+				}
+				else
+				{
+					each_pde = (each_pdpe + 1) * NPDENTRIES;
+  8029a3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029a7:	48 83 c0 01          	add    $0x1,%rax
+  8029ab:	48 c1 e0 09          	shl    $0x9,%rax
+  8029af:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			for (pdpe = 0; pdpe < NPDPENTRIES; pdpe++, each_pdpe++)
+  8029b3:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8029b8:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  8029bd:	48 81 7d f0 ff 01 00 	cmpq   $0x1ff,-0x10(%rbp)
+  8029c4:	00 
+  8029c5:	0f 86 c2 fe ff ff    	jbe    80288d <fork+0x165>
+  8029cb:	eb 10                	jmp    8029dd <fork+0x2b5>
+				}
+			}
+		}
+		else
+		{
+			each_pdpe = (pml + 1) * NPDPENTRIES;
+  8029cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029d1:	48 83 c0 01          	add    $0x1,%rax
+  8029d5:	48 c1 e0 09          	shl    $0x9,%rax
+  8029d9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	for (pml = 0; pml < VPML4E(UTOP); pml++)
+  8029dd:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8029e2:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8029e7:	0f 84 75 fe ff ff    	je     802862 <fork+0x13a>
+
+	extern void _pgfault_upcall(void);
+	// 为子环境设置页错误处理函数.
+	// 因为使用env_alloc()创建的env的处理函数指针都为空，但是这时已经明确的为其错误栈分配了物理页面
+	// 所以可以直接使用系统调用指定错误处理的入口，_pgfault_upcall()为所有用户页错误处理函数的总入口
+	r = sys_env_set_pgfault_upcall(childid, _pgfault_upcall);
+  8029ed:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8029f0:	48 ba 48 2b 80 00 00 	movabs $0x802b48,%rdx
+  8029f7:	00 00 00 
+  8029fa:	48 89 d6             	mov    %rdx,%rsi
+  8029fd:	89 c7                	mov    %eax,%edi
+  8029ff:	48 b8 4e 1f 80 00 00 	movabs $0x801f4e,%rax
+  802a06:	00 00 00 
+  802a09:	ff d0                	call   *%rax
+  802a0b:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if (r < 0)
+  802a0e:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  802a12:	79 36                	jns    802a4a <fork+0x322>
+		panic("\n couldn't call fork %e\n", r);
+  802a14:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802a17:	89 c1                	mov    %eax,%ecx
+  802a19:	48 b8 6b 32 80 00 00 	movabs $0x80326b,%rax
+  802a20:	00 00 00 
+  802a23:	48 89 c2             	mov    %rax,%rdx
+  802a26:	be c6 00 00 00       	mov    $0xc6,%esi
+  802a2b:	48 b8 c0 31 80 00 00 	movabs $0x8031c0,%rax
+  802a32:	00 00 00 
+  802a35:	48 89 c7             	mov    %rax,%rdi
+  802a38:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a3d:	49 b8 88 02 80 00 00 	movabs $0x800288,%r8
+  802a44:	00 00 00 
+  802a47:	41 ff d0             	call   *%r8
+
+	r = sys_env_set_status(childid, ENV_RUNNABLE);
+  802a4a:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802a4d:	be 02 00 00 00       	mov    $0x2,%esi
+  802a52:	89 c7                	mov    %eax,%edi
+  802a54:	48 b8 b5 1e 80 00 00 	movabs $0x801eb5,%rax
+  802a5b:	00 00 00 
+  802a5e:	ff d0                	call   *%rax
+  802a60:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if (r < 0)
+  802a63:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  802a67:	79 36                	jns    802a9f <fork+0x377>
+		panic("\n couldn't call fork %e\n", r);
+  802a69:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802a6c:	89 c1                	mov    %eax,%ecx
+  802a6e:	48 b8 6b 32 80 00 00 	movabs $0x80326b,%rax
+  802a75:	00 00 00 
+  802a78:	48 89 c2             	mov    %rax,%rdx
+  802a7b:	be ca 00 00 00       	mov    $0xca,%esi
+  802a80:	48 b8 c0 31 80 00 00 	movabs $0x8031c0,%rax
+  802a87:	00 00 00 
+  802a8a:	48 89 c7             	mov    %rax,%rdi
+  802a8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a92:	49 b8 88 02 80 00 00 	movabs $0x800288,%r8
+  802a99:	00 00 00 
+  802a9c:	41 ff d0             	call   *%r8
+
+	return childid;
+  802a9f:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  802aa2:	c9                   	leave
+  802aa3:	c3                   	ret
+
+0000000000802aa4 <set_pgfault_handler>:
+ * 包含用户异常栈的初始化和页错误处理函数的设置，利用 kern/syscall.c sys_env_set_pgfault_upcall() 注册(utf字段)用户页错误处理函数
+ * 第一次注册处理程序时，需要分配一个异常堆栈(顶部位于UXSTACKTOP的一页内存)
+ * 并告诉内核在页错误发生时调用汇编语言 _pgfault_upcall 例程
+ */
+void set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802aa4:	55                   	push   %rbp
+  802aa5:	48 89 e5             	mov    %rsp,%rbp
+  802aa8:	48 83 ec 10          	sub    $0x10,%rsp
+  802aac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	if (_pgfault_handler == 0)
+  802ab0:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  802ab7:	00 00 00 
+  802aba:	48 8b 00             	mov    (%rax),%rax
+  802abd:	48 85 c0             	test   %rax,%rax
+  802ac0:	75 72                	jne    802b34 <set_pgfault_handler+0x90>
+	{
+		// 第一次出错，创建用户异常栈
+		if (sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_W | PTE_U | PTE_P) == 0)
+  802ac2:	ba 07 00 00 00       	mov    $0x7,%edx
+  802ac7:	b8 00 f0 7f ef       	mov    $0xef7ff000,%eax
+  802acc:	48 89 c6             	mov    %rax,%rsi
+  802acf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ad4:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  802adb:	00 00 00 
+  802ade:	ff d0                	call   *%rax
+  802ae0:	85 c0                	test   %eax,%eax
+  802ae2:	75 20                	jne    802b04 <set_pgfault_handler+0x60>
+			sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  802ae4:	48 b8 48 2b 80 00 00 	movabs $0x802b48,%rax
+  802aeb:	00 00 00 
+  802aee:	48 89 c6             	mov    %rax,%rsi
+  802af1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802af6:	48 b8 4e 1f 80 00 00 	movabs $0x801f4e,%rax
+  802afd:	00 00 00 
+  802b00:	ff d0                	call   *%rax
+  802b02:	eb 30                	jmp    802b34 <set_pgfault_handler+0x90>
+		else
+			panic("set_pgfault_handler(): no memory");
+  802b04:	48 b8 88 32 80 00 00 	movabs $0x803288,%rax
+  802b0b:	00 00 00 
+  802b0e:	48 89 c2             	mov    %rax,%rdx
+  802b11:	be 1b 00 00 00       	mov    $0x1b,%esi
+  802b16:	48 b8 a9 32 80 00 00 	movabs $0x8032a9,%rax
+  802b1d:	00 00 00 
+  802b20:	48 89 c7             	mov    %rax,%rdi
+  802b23:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b28:	48 b9 88 02 80 00 00 	movabs $0x800288,%rcx
+  802b2f:	00 00 00 
+  802b32:	ff d1                	call   *%rcx
+	}
+
+	// 存储汇编语言调用的处理函数指针.
+	_pgfault_handler = handler;
+  802b34:	48 ba 20 40 80 00 00 	movabs $0x804020,%rdx
+  802b3b:	00 00 00 
+  802b3e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b42:	48 89 02             	mov    %rax,(%rdx)
+}
+  802b45:	90                   	nop
+  802b46:	c9                   	leave
+  802b47:	c3                   	ret
+
+0000000000802b48 <_pgfault_upcall>:
+
+	// 调用C代码中的页错误处理函数.
+	// 函数参数: 指向 UTrapframe 的指针
+
+	// 通过 %rdi 传递函数参数
+	movq  %rsp, %rdi
+  802b48:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  802b4b:	48 a1 20 40 80 00 00 	movabs 0x804020,%rax
+  802b52:	00 00 00 
+	call *%rax
+  802b55:	ff d0                	call   *%rax
+			regs: 15*8 = 120-Byte,
+			eflags: 8-Byte,
+			rip: 8-Byte
+	*/
+
+	addq $16, %rsp	/* 跳过用户异常栈中的 utf_fault_va 和 utf_err(不需要) */
+  802b57:	48 83 c4 10          	add    $0x10,%rsp
+	
+	/* 用户异常栈: %rsp 指向 end of struct PushRegs */
+	
+	movq 120(%rsp), %r10	/* %r10 = %rip */
+  802b5b:	4c 8b 54 24 78       	mov    0x78(%rsp),%r10
+	movq 136(%rsp), %r11	/* %r11 = %rsp */
+  802b60:	4c 8b 9c 24 88 00 00 	mov    0x88(%rsp),%r11
+  802b67:	00 
+
+	subq $8, %r11			/* %r11(trap-time %rsp) - 8 */
+  802b68:	49 83 eb 08          	sub    $0x8,%r11
+	movq %r10, (%r11)		/* %r11(trap-time %rsp) 指向的值为 %rip */
+  802b6c:	4d 89 13             	mov    %r10,(%r11)
+	movq %r11, 136(%rsp)	/* 更新 trap-time %rsp 的值 */
+  802b6f:	4c 89 9c 24 88 00 00 	mov    %r11,0x88(%rsp)
+  802b76:	00 
+		trap-time eflags
+		trap-time rip
+	*/
+
+	// 恢复 trap-time 寄存器集.  接下来不能再修改任何通用寄存器集 PushRegs.
+	POPA_	/* 之前已经通过增加 16-Byte 跳过了 fault_va 和 utf_err，所以只需使用 POPA_ 恢复 */
+  802b77:	4c 8b 3c 24          	mov    (%rsp),%r15
+  802b7b:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  802b80:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  802b85:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  802b8a:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  802b8f:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  802b94:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  802b99:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  802b9e:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  802ba3:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  802ba8:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  802bad:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  802bb2:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  802bb7:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  802bbc:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  802bc1:	48 83 c4 78          	add    $0x78,%rsp
+
+	// 从栈中恢复 %eflags.  接下来不能再使用修改 %eflags 的指令，比如算术指令sub, cmp等.
+	addq $8, %rsp	/* 跳过 %rip，指向 %eflags */
+  802bc5:	48 83 c4 08          	add    $0x8,%rsp
+	popfq			/* 从栈中恢复 %eflags */
+  802bc9:	9d                   	popf
+		(blank 8-Byte)
+		trap-time rip
+	*/
+
+	// 切换回调整后的 trap-time 栈.
+	popq %rsp		/* 已经指向 %rsp，直接 pop 恢复 */
+  802bca:	5c                   	pop    %rsp
+
+	// 返回重新执行引起页错误的环境指令.
+	ret				/* popq %rip */
+  802bcb:	c3                   	ret
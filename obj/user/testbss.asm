@@ -0,0 +1,3676 @@
+
+obj/user/testbss.debug:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// entrypoint - 当最初被加载到一个新的环境中时，内核(或者父环境)在这里开始运行.
+.text
+.globl _start
+_start:
+	// 判断是否从栈上的参数开始初始化
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	// $USTACKTOP != %rsp 说明有参数，跳转到 args_exist
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// 如果不是(新环境被内核加载的时候)，则 push 伪造的 argc, argv 参数
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 74 01 00 00       	call   8001b5 <libmain>
+
+// 不应该返回
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+#define ARRAYSIZE (1024 * 1024)  // 1M
+
+uint32_t bigarray[ARRAYSIZE];
+
+void umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	48 83 ec 20          	sub    $0x20,%rsp
+  80004b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80004e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int i;
+
+	cprintf("Ensure AlvOS has initialized .bss section correctly...\n");
+  800052:	48 b8 20 23 80 00 00 	movabs $0x802320,%rax
+  800059:	00 00 00 
+  80005c:	48 89 c7             	mov    %rax,%rdi
+  80005f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800064:	48 ba 8d 04 80 00 00 	movabs $0x80048d,%rdx
+  80006b:	00 00 00 
+  80006e:	ff d2                	call   *%rdx
+	for (i = 0; i < ARRAYSIZE; i++)
+  800070:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800077:	eb 50                	jmp    8000c9 <umain+0x86>
+		if (bigarray[i] != 0)
+  800079:	48 ba 20 40 80 00 00 	movabs $0x804020,%rdx
+  800080:	00 00 00 
+  800083:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800086:	48 98                	cltq
+  800088:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  80008b:	85 c0                	test   %eax,%eax
+  80008d:	74 36                	je     8000c5 <umain+0x82>
+			panic("bigarray[%d] isn't cleared!\n", i);
+  80008f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800092:	89 c1                	mov    %eax,%ecx
+  800094:	48 b8 58 23 80 00 00 	movabs $0x802358,%rax
+  80009b:	00 00 00 
+  80009e:	48 89 c2             	mov    %rax,%rdx
+  8000a1:	be 10 00 00 00       	mov    $0x10,%esi
+  8000a6:	48 b8 75 23 80 00 00 	movabs $0x802375,%rax
+  8000ad:	00 00 00 
+  8000b0:	48 89 c7             	mov    %rax,%rdi
+  8000b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b8:	49 b8 4a 02 80 00 00 	movabs $0x80024a,%r8
+  8000bf:	00 00 00 
+  8000c2:	41 ff d0             	call   *%r8
+	for (i = 0; i < ARRAYSIZE; i++)
+  8000c5:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8000c9:	81 7d fc ff ff 0f 00 	cmpl   $0xfffff,-0x4(%rbp)
+  8000d0:	7e a7                	jle    800079 <umain+0x36>
+	for (i = 0; i < ARRAYSIZE; i++)
+  8000d2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8000d9:	eb 19                	jmp    8000f4 <umain+0xb1>
+		bigarray[i] = i;
+  8000db:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8000de:	48 b9 20 40 80 00 00 	movabs $0x804020,%rcx
+  8000e5:	00 00 00 
+  8000e8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000eb:	48 98                	cltq
+  8000ed:	89 14 81             	mov    %edx,(%rcx,%rax,4)
+	for (i = 0; i < ARRAYSIZE; i++)
+  8000f0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8000f4:	81 7d fc ff ff 0f 00 	cmpl   $0xfffff,-0x4(%rbp)
+  8000fb:	7e de                	jle    8000db <umain+0x98>
+	for (i = 0; i < ARRAYSIZE; i++)
+  8000fd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800104:	eb 53                	jmp    800159 <umain+0x116>
+		if (bigarray[i] != i)
+  800106:	48 ba 20 40 80 00 00 	movabs $0x804020,%rdx
+  80010d:	00 00 00 
+  800110:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800113:	48 98                	cltq
+  800115:	8b 14 82             	mov    (%rdx,%rax,4),%edx
+  800118:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80011b:	39 c2                	cmp    %eax,%edx
+  80011d:	74 36                	je     800155 <umain+0x112>
+			panic("bigarray[%d] didn't hold its value! \n", i);
+  80011f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800122:	89 c1                	mov    %eax,%ecx
+  800124:	48 b8 88 23 80 00 00 	movabs $0x802388,%rax
+  80012b:	00 00 00 
+  80012e:	48 89 c2             	mov    %rax,%rdx
+  800131:	be 15 00 00 00       	mov    $0x15,%esi
+  800136:	48 b8 75 23 80 00 00 	movabs $0x802375,%rax
+  80013d:	00 00 00 
+  800140:	48 89 c7             	mov    %rax,%rdi
+  800143:	b8 00 00 00 00       	mov    $0x0,%eax
+  800148:	49 b8 4a 02 80 00 00 	movabs $0x80024a,%r8
+  80014f:	00 00 00 
+  800152:	41 ff d0             	call   *%r8
+	for (i = 0; i < ARRAYSIZE; i++)
+  800155:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800159:	81 7d fc ff ff 0f 00 	cmpl   $0xfffff,-0x4(%rbp)
+  800160:	7e a4                	jle    800106 <umain+0xc3>
+
+	cprintf(".bss section is initialized correctly! \n");
+  800162:	48 b8 b0 23 80 00 00 	movabs $0x8023b0,%rax
+  800169:	00 00 00 
+  80016c:	48 89 c7             	mov    %rax,%rdi
+  80016f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800174:	48 ba 8d 04 80 00 00 	movabs $0x80048d,%rdx
+  80017b:	00 00 00 
+  80017e:	ff d2                	call   *%rdx
+	cprintf("Now try to assign to the space outside the array...\n");
+  800180:	48 b8 e0 23 80 00 00 	movabs $0x8023e0,%rax
+  800187:	00 00 00 
+  80018a:	48 89 c7             	mov    %rax,%rdi
+  80018d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800192:	48 ba 8d 04 80 00 00 	movabs $0x80048d,%rdx
+  800199:	00 00 00 
+  80019c:	ff d2                	call   *%rdx
+	bigarray[ARRAYSIZE + 1024] = 0;
+  80019e:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  8001a5:	00 00 00 
+  8001a8:	c7 80 00 10 40 00 00 	movl   $0x0,0x401000(%rax)
+  8001af:	00 00 00 
+	// panic("应该导致异常！");
+}
+  8001b2:	90                   	nop
+  8001b3:	c9                   	leave
+  8001b4:	c3                   	ret
+
+00000000008001b5 <libmain>:
+
+/**
+ *  用户环境从lib/libmain.c中的函数libmain开始执行，这个函数进而调用umain，用户写的程序入口只能是umain
+ */
+void libmain(int argc, char **argv)
+{
+  8001b5:	55                   	push   %rbp
+  8001b6:	48 89 e5             	mov    %rsp,%rbp
+  8001b9:	48 83 ec 10          	sub    $0x10,%rsp
+  8001bd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8001c0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 设置常量 thisproc 指向 procs[] 中当前环境的 Env 结构，ENVX 确保环境 id 未超过了 NENV
+	// thisproc 指向当前环境的 Env 结构
+	thisproc = &procs[ENVX(sys_getprocid())];
+  8001c4:	48 b8 00 1d 80 00 00 	movabs $0x801d00,%rax
+  8001cb:	00 00 00 
+  8001ce:	ff d0                	call   *%rax
+  8001d0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001d5:	48 98                	cltq
+  8001d7:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  8001de:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  8001e5:	00 00 00 
+  8001e8:	48 01 c2             	add    %rax,%rdx
+  8001eb:	48 b8 20 40 c0 00 00 	movabs $0xc04020,%rax
+  8001f2:	00 00 00 
+  8001f5:	48 89 10             	mov    %rdx,(%rax)
+
+	// 通过 CPUID 选择 memset/memmove/memcpy 的实现
+	mem_init();
+  8001f8:	48 b8 a8 13 80 00 00 	movabs $0x8013a8,%rax
+  8001ff:	00 00 00 
+  800202:	ff d0                	call   *%rax
+
+	// 为了能让panic()提示用户错误，存储程序的名称
+	if (argc > 0)
+  800204:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800208:	7e 14                	jle    80021e <libmain+0x69>
+		binaryname = argv[0];
+  80020a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80020e:	48 8b 00             	mov    (%rax),%rax
+  800211:	48 ba 00 40 80 00 00 	movabs $0x804000,%rdx
+  800218:	00 00 00 
+  80021b:	48 89 02             	mov    %rax,(%rdx)
+
+	// 调用用户的主程序
+	umain(argc, argv);
+  80021e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800222:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800225:	48 89 d6             	mov    %rdx,%rsi
+  800228:	89 c7                	mov    %eax,%edi
+  80022a:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  800231:	00 00 00 
+  800234:	ff d0                	call   *%rax
+
+	// 退出当前环境，env_destroy
+	sys_env_destroy(0);
+  800236:	bf 00 00 00 00       	mov    $0x0,%edi
+  80023b:	48 b8 ba 1c 80 00 00 	movabs $0x801cba,%rax
+  800242:	00 00 00 
+  800245:	ff d0                	call   *%rax
+}
+  800247:	90                   	nop
+  800248:	c9                   	leave
+  800249:	c3                   	ret
+
+000000000080024a <_panic>:
+/*
+ * 无法解决的致命错误会导致死机
+ * 打印"死机:<消息>”，然后导致处理器休眠进入HLT状态
+ */
+void _panic(const char *file, int line, const char *fmt, ...)
+{
+  80024a:	55                   	push   %rbp
+  80024b:	48 89 e5             	mov    %rsp,%rbp
+  80024e:	53                   	push   %rbx
+  80024f:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800256:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  80025d:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  800263:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  80026a:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  800271:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  800278:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  80027f:	84 c0                	test   %al,%al
+  800281:	74 23                	je     8002a6 <_panic+0x5c>
+  800283:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  80028a:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  80028e:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  800292:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  800296:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  80029a:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  80029e:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  8002a2:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002a6:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  8002ad:	00 00 00 
+  8002b0:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  8002b7:	00 00 00 
+  8002ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002be:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  8002c5:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  8002cc:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+	// 输出死机的信息
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002d3:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8002da:	00 00 00 
+  8002dd:	48 8b 18             	mov    (%rax),%rbx
+  8002e0:	48 b8 00 1d 80 00 00 	movabs $0x801d00,%rax
+  8002e7:	00 00 00 
+  8002ea:	ff d0                	call   *%rax
+  8002ec:	89 c6                	mov    %eax,%esi
+  8002ee:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  8002f4:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8002fb:	41 89 d0             	mov    %edx,%r8d
+  8002fe:	48 89 c1             	mov    %rax,%rcx
+  800301:	48 89 da             	mov    %rbx,%rdx
+  800304:	48 b8 20 24 80 00 00 	movabs $0x802420,%rax
+  80030b:	00 00 00 
+  80030e:	48 89 c7             	mov    %rax,%rdi
+  800311:	b8 00 00 00 00       	mov    $0x0,%eax
+  800316:	49 b9 8d 04 80 00 00 	movabs $0x80048d,%r9
+  80031d:	00 00 00 
+  800320:	41 ff d1             	call   *%r9
+			sys_getprocid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800323:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  80032a:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800331:	48 89 d6             	mov    %rdx,%rsi
+  800334:	48 89 c7             	mov    %rax,%rdi
+  800337:	48 b8 de 03 80 00 00 	movabs $0x8003de,%rax
+  80033e:	00 00 00 
+  800341:	ff d0                	call   *%rax
+	cprintf("\n");
+  800343:	48 b8 43 24 80 00 00 	movabs $0x802443,%rax
+  80034a:	00 00 00 
+  80034d:	48 89 c7             	mov    %rax,%rdi
+  800350:	b8 00 00 00 00       	mov    $0x0,%eax
+  800355:	48 ba 8d 04 80 00 00 	movabs $0x80048d,%rdx
+  80035c:	00 00 00 
+  80035f:	ff d2                	call   *%rdx
+
+	// 触发断点中断
+	while (1)
+		asm volatile("int3");
+  800361:	cc                   	int3
+  800362:	eb fd                	jmp    800361 <_panic+0x117>
+
+0000000000800364 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800364:	55                   	push   %rbp
+  800365:	48 89 e5             	mov    %rsp,%rbp
+  800368:	48 83 ec 10          	sub    $0x10,%rsp
+  80036c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80036f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->buf[b->idx++] = ch;
+  800373:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800377:	8b 00                	mov    (%rax),%eax
+  800379:	8d 48 01             	lea    0x1(%rax),%ecx
+  80037c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800380:	89 0a                	mov    %ecx,(%rdx)
+  800382:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800385:	89 d1                	mov    %edx,%ecx
+  800387:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80038b:	48 98                	cltq
+  80038d:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+	if (b->idx == 256-1) {
+  800391:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800395:	8b 00                	mov    (%rax),%eax
+  800397:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80039c:	75 2c                	jne    8003ca <putch+0x66>
+		sys_cputs(b->buf, b->idx);
+  80039e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003a2:	8b 00                	mov    (%rax),%eax
+  8003a4:	48 98                	cltq
+  8003a6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8003aa:	48 83 c2 08          	add    $0x8,%rdx
+  8003ae:	48 89 c6             	mov    %rax,%rsi
+  8003b1:	48 89 d7             	mov    %rdx,%rdi
+  8003b4:	48 b8 31 1c 80 00 00 	movabs $0x801c31,%rax
+  8003bb:	00 00 00 
+  8003be:	ff d0                	call   *%rax
+		b->idx = 0;
+  8003c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003c4:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	}
+	b->cnt++;
+  8003ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003ce:	8b 40 04             	mov    0x4(%rax),%eax
+  8003d1:	8d 50 01             	lea    0x1(%rax),%edx
+  8003d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003d8:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8003db:	90                   	nop
+  8003dc:	c9                   	leave
+  8003dd:	c3                   	ret
+
+00000000008003de <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003de:	55                   	push   %rbp
+  8003df:	48 89 e5             	mov    %rsp,%rbp
+  8003e2:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8003e9:	48 89 bd c8 fe ff ff 	mov    %rdi,-0x138(%rbp)
+  8003f0:	48 89 b5 c0 fe ff ff 	mov    %rsi,-0x140(%rbp)
+	struct printbuf b;
+	va_list aq;
+	va_copy(aq,ap);
+  8003f7:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  8003fe:	48 8b b5 c0 fe ff ff 	mov    -0x140(%rbp),%rsi
+  800405:	48 8b 06             	mov    (%rsi),%rax
+  800408:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80040c:	48 89 01             	mov    %rax,(%rcx)
+  80040f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800413:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800417:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	b.idx = 0;
+  80041b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800422:	00 00 00 
+	b.cnt = 0;
+  800425:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80042c:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, aq);
+  80042f:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  800436:	48 8b 95 c8 fe ff ff 	mov    -0x138(%rbp),%rdx
+  80043d:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800444:	48 89 c6             	mov    %rax,%rsi
+  800447:	48 b8 64 03 80 00 00 	movabs $0x800364,%rax
+  80044e:	00 00 00 
+  800451:	48 89 c7             	mov    %rax,%rdi
+  800454:	48 b8 2b 08 80 00 00 	movabs $0x80082b,%rax
+  80045b:	00 00 00 
+  80045e:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  800460:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  800466:	48 98                	cltq
+  800468:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  80046f:	48 83 c2 08          	add    $0x8,%rdx
+  800473:	48 89 c6             	mov    %rax,%rsi
+  800476:	48 89 d7             	mov    %rdx,%rdi
+  800479:	48 b8 31 1c 80 00 00 	movabs $0x801c31,%rax
+  800480:	00 00 00 
+  800483:	ff d0                	call   *%rax
+	va_end(aq);
+
+	return b.cnt;
+  800485:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80048b:	c9                   	leave
+  80048c:	c3                   	ret
+
+000000000080048d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80048d:	55                   	push   %rbp
+  80048e:	48 89 e5             	mov    %rsp,%rbp
+  800491:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800498:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80049f:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8004a6:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8004ad:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8004b4:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8004bb:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8004c2:	84 c0                	test   %al,%al
+  8004c4:	74 20                	je     8004e6 <cprintf+0x59>
+  8004c6:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8004ca:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8004ce:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8004d2:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8004d6:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8004da:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8004de:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8004e2:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+	va_list aq;
+	va_start(ap, fmt);
+  8004e6:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8004ed:	00 00 00 
+  8004f0:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8004f7:	00 00 00 
+  8004fa:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004fe:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800505:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80050c:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  800513:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80051a:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800521:	48 8b 06             	mov    (%rsi),%rax
+  800524:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800528:	48 89 01             	mov    %rax,(%rcx)
+  80052b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80052f:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800533:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	cnt = vcprintf(fmt, aq);
+  800537:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80053e:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800545:	48 89 d6             	mov    %rdx,%rsi
+  800548:	48 89 c7             	mov    %rax,%rdi
+  80054b:	48 b8 de 03 80 00 00 	movabs $0x8003de,%rax
+  800552:	00 00 00 
+  800555:	ff d0                	call   *%rax
+  800557:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return cnt;
+  80055d:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800563:	c9                   	leave
+  800564:	c3                   	ret
+
+0000000000800565 <printnum>:
+ * num: 需要打印出来的整型数，base: 整型数的进制，其他参数同 vprintfmt
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+		 unsigned long long num, unsigned base, int width, int padc)
+{
+  800565:	55                   	push   %rbp
+  800566:	48 89 e5             	mov    %rsp,%rbp
+  800569:	48 83 ec 30          	sub    $0x30,%rsp
+  80056d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800571:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800575:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800579:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  80057c:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  800580:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+	// 当 num 超过一位数，首先递归函数自身打印所有高位的(更重要的)数字
+	if (num >= base)
+  800584:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800587:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  80058b:	72 54                	jb     8005e1 <printnum+0x7c>
+	{
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80058d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800590:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800593:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800596:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80059a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80059f:	48 f7 f6             	div    %rsi
+  8005a2:	49 89 c2             	mov    %rax,%r10
+  8005a5:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8005a8:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8005ab:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8005af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005b3:	41 89 c9             	mov    %ecx,%r9d
+  8005b6:	41 89 f8             	mov    %edi,%r8d
+  8005b9:	89 d1                	mov    %edx,%ecx
+  8005bb:	4c 89 d2             	mov    %r10,%rdx
+  8005be:	48 89 c7             	mov    %rax,%rdi
+  8005c1:	48 b8 65 05 80 00 00 	movabs $0x800565,%rax
+  8005c8:	00 00 00 
+  8005cb:	ff d0                	call   *%rax
+  8005cd:	eb 1c                	jmp    8005eb <printnum+0x86>
+	}
+	else
+	{
+		// 按照右对齐的格式在左侧补齐填充字符 padc
+		while (--width > 0)
+			putch(padc, putdat);
+  8005cf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005d3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8005d6:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8005da:	48 89 d6             	mov    %rdx,%rsi
+  8005dd:	89 c7                	mov    %eax,%edi
+  8005df:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8005e1:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  8005e5:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8005e9:	7f e4                	jg     8005cf <printnum+0x6a>
+	}
+
+	// 然后打印个位数字
+	putch("0123456789abcdef"[num % base], putdat);
+  8005eb:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8005ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005f7:	48 f7 f1             	div    %rcx
+  8005fa:	48 b8 50 26 80 00 00 	movabs $0x802650,%rax
+  800601:	00 00 00 
+  800604:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800608:	0f be c0             	movsbl %al,%eax
+  80060b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80060f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800613:	48 89 d6             	mov    %rdx,%rsi
+  800616:	89 c7                	mov    %eax,%edi
+  800618:	ff d1                	call   *%rcx
+}
+  80061a:	90                   	nop
+  80061b:	c9                   	leave
+  80061c:	c3                   	ret
+
+000000000080061d <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  80061d:	55                   	push   %rbp
+  80061e:	48 89 e5             	mov    %rsp,%rbp
+  800621:	48 83 ec 20          	sub    $0x20,%rsp
+  800625:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800629:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;
+	if (lflag >= 2)
+  80062c:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800630:	7e 4f                	jle    800681 <getuint+0x64>
+		x = va_arg(*ap, unsigned long long);
+  800632:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800636:	8b 00                	mov    (%rax),%eax
+  800638:	83 f8 2f             	cmp    $0x2f,%eax
+  80063b:	77 24                	ja     800661 <getuint+0x44>
+  80063d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800641:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800645:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800649:	8b 00                	mov    (%rax),%eax
+  80064b:	89 c0                	mov    %eax,%eax
+  80064d:	48 01 d0             	add    %rdx,%rax
+  800650:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800654:	8b 12                	mov    (%rdx),%edx
+  800656:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800659:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80065d:	89 0a                	mov    %ecx,(%rdx)
+  80065f:	eb 14                	jmp    800675 <getuint+0x58>
+  800661:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800665:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800669:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80066d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800671:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800675:	48 8b 00             	mov    (%rax),%rax
+  800678:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80067c:	e9 9d 00 00 00       	jmp    80071e <getuint+0x101>
+	else if (lflag)
+  800681:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800685:	74 4c                	je     8006d3 <getuint+0xb6>
+		x = va_arg(*ap, unsigned long);
+  800687:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80068b:	8b 00                	mov    (%rax),%eax
+  80068d:	83 f8 2f             	cmp    $0x2f,%eax
+  800690:	77 24                	ja     8006b6 <getuint+0x99>
+  800692:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800696:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80069a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80069e:	8b 00                	mov    (%rax),%eax
+  8006a0:	89 c0                	mov    %eax,%eax
+  8006a2:	48 01 d0             	add    %rdx,%rax
+  8006a5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006a9:	8b 12                	mov    (%rdx),%edx
+  8006ab:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006ae:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006b2:	89 0a                	mov    %ecx,(%rdx)
+  8006b4:	eb 14                	jmp    8006ca <getuint+0xad>
+  8006b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006ba:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006be:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006c2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006c6:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006ca:	48 8b 00             	mov    (%rax),%rax
+  8006cd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8006d1:	eb 4b                	jmp    80071e <getuint+0x101>
+	else
+		x = va_arg(*ap, unsigned int);
+  8006d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006d7:	8b 00                	mov    (%rax),%eax
+  8006d9:	83 f8 2f             	cmp    $0x2f,%eax
+  8006dc:	77 24                	ja     800702 <getuint+0xe5>
+  8006de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006e2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006ea:	8b 00                	mov    (%rax),%eax
+  8006ec:	89 c0                	mov    %eax,%eax
+  8006ee:	48 01 d0             	add    %rdx,%rax
+  8006f1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006f5:	8b 12                	mov    (%rdx),%edx
+  8006f7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006fa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006fe:	89 0a                	mov    %ecx,(%rdx)
+  800700:	eb 14                	jmp    800716 <getuint+0xf9>
+  800702:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800706:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80070a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80070e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800712:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800716:	8b 00                	mov    (%rax),%eax
+  800718:	89 c0                	mov    %eax,%eax
+  80071a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80071e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800722:	c9                   	leave
+  800723:	c3                   	ret
+
+0000000000800724 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800724:	55                   	push   %rbp
+  800725:	48 89 e5             	mov    %rsp,%rbp
+  800728:	48 83 ec 20          	sub    $0x20,%rsp
+  80072c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800730:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800733:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800737:	7e 4f                	jle    800788 <getint+0x64>
+		x = va_arg(*ap, long long);
+  800739:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80073d:	8b 00                	mov    (%rax),%eax
+  80073f:	83 f8 2f             	cmp    $0x2f,%eax
+  800742:	77 24                	ja     800768 <getint+0x44>
+  800744:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800748:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80074c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800750:	8b 00                	mov    (%rax),%eax
+  800752:	89 c0                	mov    %eax,%eax
+  800754:	48 01 d0             	add    %rdx,%rax
+  800757:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80075b:	8b 12                	mov    (%rdx),%edx
+  80075d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800760:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800764:	89 0a                	mov    %ecx,(%rdx)
+  800766:	eb 14                	jmp    80077c <getint+0x58>
+  800768:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80076c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800770:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800774:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800778:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80077c:	48 8b 00             	mov    (%rax),%rax
+  80077f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800783:	e9 9d 00 00 00       	jmp    800825 <getint+0x101>
+	else if (lflag)
+  800788:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80078c:	74 4c                	je     8007da <getint+0xb6>
+		x = va_arg(*ap, long);
+  80078e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800792:	8b 00                	mov    (%rax),%eax
+  800794:	83 f8 2f             	cmp    $0x2f,%eax
+  800797:	77 24                	ja     8007bd <getint+0x99>
+  800799:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80079d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007a5:	8b 00                	mov    (%rax),%eax
+  8007a7:	89 c0                	mov    %eax,%eax
+  8007a9:	48 01 d0             	add    %rdx,%rax
+  8007ac:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007b0:	8b 12                	mov    (%rdx),%edx
+  8007b2:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007b5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007b9:	89 0a                	mov    %ecx,(%rdx)
+  8007bb:	eb 14                	jmp    8007d1 <getint+0xad>
+  8007bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007c1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007c5:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007c9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007cd:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007d1:	48 8b 00             	mov    (%rax),%rax
+  8007d4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8007d8:	eb 4b                	jmp    800825 <getint+0x101>
+	else
+		x = va_arg(*ap, int);
+  8007da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007de:	8b 00                	mov    (%rax),%eax
+  8007e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e3:	77 24                	ja     800809 <getint+0xe5>
+  8007e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007e9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007f1:	8b 00                	mov    (%rax),%eax
+  8007f3:	89 c0                	mov    %eax,%eax
+  8007f5:	48 01 d0             	add    %rdx,%rax
+  8007f8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007fc:	8b 12                	mov    (%rdx),%edx
+  8007fe:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800801:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800805:	89 0a                	mov    %ecx,(%rdx)
+  800807:	eb 14                	jmp    80081d <getint+0xf9>
+  800809:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80080d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800811:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800815:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800819:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80081d:	8b 00                	mov    (%rax),%eax
+  80081f:	48 98                	cltq
+  800821:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800825:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800829:	c9                   	leave
+  80082a:	c3                   	ret
+
+000000000080082b <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap)
+{
+  80082b:	55                   	push   %rbp
+  80082c:	48 89 e5             	mov    %rsp,%rbp
+  80082f:	41 54                	push   %r12
+  800831:	53                   	push   %rbx
+  800832:	48 83 ec 60          	sub    $0x60,%rsp
+  800836:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80083a:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80083e:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800842:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+	int base, lflag, width, precision, altflag;
+
+	// 填充字符，在显示字符串的'%'后读到'-'或'0'时，赋值到 padc
+	char padc;
+	va_list aq;
+	va_copy(aq, ap);
+  800846:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80084a:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80084e:	48 8b 06             	mov    (%rsi),%rax
+  800851:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800855:	48 89 01             	mov    %rax,(%rcx)
+  800858:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80085c:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800860:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1)
+	{
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800864:	eb 17                	jmp    80087d <vprintfmt+0x52>
+		{
+			if (ch == '\0')
+  800866:	85 db                	test   %ebx,%ebx
+  800868:	0f 84 b9 04 00 00    	je     800d27 <vprintfmt+0x4fc>
+				return;
+			putch(ch, putdat);
+  80086e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800872:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800876:	48 89 c6             	mov    %rax,%rsi
+  800879:	89 df                	mov    %ebx,%edi
+  80087b:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  80087d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800881:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800885:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800889:	0f b6 00             	movzbl (%rax),%eax
+  80088c:	0f b6 d8             	movzbl %al,%ebx
+  80088f:	83 fb 25             	cmp    $0x25,%ebx
+  800892:	75 d2                	jne    800866 <vprintfmt+0x3b>
+		}
+
+		// 处理 % 转义序列
+		// padc 初始化为空格符，padc='-'代表字符串左对齐，右边补空格，padc=' '代表右对齐，左边补空格，padc='0'右对齐，左边补0
+		padc = ' ';
+  800894:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+		width = -1;
+  800898:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+		// 默认-1代表显示长度为字符串本来的长度
+		precision = -1;
+  80089f:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+		lflag = 0;
+  8008a6:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+		altflag = 0;
+  8008ad:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *)fmt++)
+  8008b4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8008b8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8008bc:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8008c0:	0f b6 00             	movzbl (%rax),%eax
+  8008c3:	0f b6 d8             	movzbl %al,%ebx
+  8008c6:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8008c9:	83 f8 55             	cmp    $0x55,%eax
+  8008cc:	0f 87 22 04 00 00    	ja     800cf4 <vprintfmt+0x4c9>
+  8008d2:	89 c0                	mov    %eax,%eax
+  8008d4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8008db:	00 
+  8008dc:	48 b8 78 26 80 00 00 	movabs $0x802678,%rax
+  8008e3:	00 00 00 
+  8008e6:	48 01 d0             	add    %rdx,%rax
+  8008e9:	48 8b 00             	mov    (%rax),%rax
+  8008ec:	ff e0                	jmp    *%rax
+		{
+
+		// flag to pad on the right
+		case '-':
+			padc = '-';
+  8008ee:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+			goto reswitch;
+  8008f2:	eb c0                	jmp    8008b4 <vprintfmt+0x89>
+
+		// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  8008f4:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+			goto reswitch;
+  8008f8:	eb ba                	jmp    8008b4 <vprintfmt+0x89>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0;; ++fmt)
+  8008fa:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+			{
+				precision = precision * 10 + ch - '0';
+  800901:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800904:	89 d0                	mov    %edx,%eax
+  800906:	c1 e0 02             	shl    $0x2,%eax
+  800909:	01 d0                	add    %edx,%eax
+  80090b:	01 c0                	add    %eax,%eax
+  80090d:	01 d8                	add    %ebx,%eax
+  80090f:	83 e8 30             	sub    $0x30,%eax
+  800912:	89 45 d8             	mov    %eax,-0x28(%rbp)
+				ch = *fmt;
+  800915:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800919:	0f b6 00             	movzbl (%rax),%eax
+  80091c:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  80091f:	83 fb 2f             	cmp    $0x2f,%ebx
+  800922:	7e 60                	jle    800984 <vprintfmt+0x159>
+  800924:	83 fb 39             	cmp    $0x39,%ebx
+  800927:	7f 5b                	jg     800984 <vprintfmt+0x159>
+			for (precision = 0;; ++fmt)
+  800929:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+				precision = precision * 10 + ch - '0';
+  80092e:	eb d1                	jmp    800901 <vprintfmt+0xd6>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800930:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800933:	83 f8 2f             	cmp    $0x2f,%eax
+  800936:	77 17                	ja     80094f <vprintfmt+0x124>
+  800938:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80093c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80093f:	89 d2                	mov    %edx,%edx
+  800941:	48 01 d0             	add    %rdx,%rax
+  800944:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800947:	83 c2 08             	add    $0x8,%edx
+  80094a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80094d:	eb 0c                	jmp    80095b <vprintfmt+0x130>
+  80094f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800953:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800957:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80095b:	8b 00                	mov    (%rax),%eax
+  80095d:	89 45 d8             	mov    %eax,-0x28(%rbp)
+			goto process_precision;
+  800960:	eb 23                	jmp    800985 <vprintfmt+0x15a>
+
+		case '.':
+			if (width < 0)
+  800962:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800966:	0f 89 48 ff ff ff    	jns    8008b4 <vprintfmt+0x89>
+				width = 0;
+  80096c:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+			goto reswitch;
+  800973:	e9 3c ff ff ff       	jmp    8008b4 <vprintfmt+0x89>
+
+		case '#':
+			altflag = 1;
+  800978:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+			goto reswitch;
+  80097f:	e9 30 ff ff ff       	jmp    8008b4 <vprintfmt+0x89>
+			goto process_precision;
+  800984:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800985:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800989:	0f 89 25 ff ff ff    	jns    8008b4 <vprintfmt+0x89>
+				width = precision, precision = -1;
+  80098f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800992:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800995:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+			goto reswitch;
+  80099c:	e9 13 ff ff ff       	jmp    8008b4 <vprintfmt+0x89>
+
+		// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  8009a1:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+			goto reswitch;
+  8009a5:	e9 0a ff ff ff       	jmp    8008b4 <vprintfmt+0x89>
+
+		// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  8009aa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ad:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b0:	77 17                	ja     8009c9 <vprintfmt+0x19e>
+  8009b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009b6:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009b9:	89 d2                	mov    %edx,%edx
+  8009bb:	48 01 d0             	add    %rdx,%rax
+  8009be:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009c1:	83 c2 08             	add    $0x8,%edx
+  8009c4:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8009c7:	eb 0c                	jmp    8009d5 <vprintfmt+0x1aa>
+  8009c9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8009cd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8009d1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8009d5:	8b 00                	mov    (%rax),%eax
+  8009d7:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8009db:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8009df:	48 89 d6             	mov    %rdx,%rsi
+  8009e2:	89 c7                	mov    %eax,%edi
+  8009e4:	ff d1                	call   *%rcx
+			break;
+  8009e6:	e9 37 03 00 00       	jmp    800d22 <vprintfmt+0x4f7>
+
+		// error message
+		case 'e':
+			err = va_arg(aq, int);
+  8009eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ee:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f1:	77 17                	ja     800a0a <vprintfmt+0x1df>
+  8009f3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009f7:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009fa:	89 d2                	mov    %edx,%edx
+  8009fc:	48 01 d0             	add    %rdx,%rax
+  8009ff:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a02:	83 c2 08             	add    $0x8,%edx
+  800a05:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a08:	eb 0c                	jmp    800a16 <vprintfmt+0x1eb>
+  800a0a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a0e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a12:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a16:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800a18:	85 db                	test   %ebx,%ebx
+  800a1a:	79 02                	jns    800a1e <vprintfmt+0x1f3>
+				err = -err;
+  800a1c:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a1e:	83 fb 11             	cmp    $0x11,%ebx
+  800a21:	7f 16                	jg     800a39 <vprintfmt+0x20e>
+  800a23:	48 ba c0 25 80 00 00 	movabs $0x8025c0,%rdx
+  800a2a:	00 00 00 
+  800a2d:	48 63 c3             	movslq %ebx,%rax
+  800a30:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800a34:	4d 85 e4             	test   %r12,%r12
+  800a37:	75 2e                	jne    800a67 <vprintfmt+0x23c>
+				printfmt(putch, putdat, "error %d", err);
+  800a39:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800a3d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a41:	89 d9                	mov    %ebx,%ecx
+  800a43:	48 ba 61 26 80 00 00 	movabs $0x802661,%rdx
+  800a4a:	00 00 00 
+  800a4d:	48 89 c7             	mov    %rax,%rdi
+  800a50:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a55:	49 b8 31 0d 80 00 00 	movabs $0x800d31,%r8
+  800a5c:	00 00 00 
+  800a5f:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800a62:	e9 bb 02 00 00       	jmp    800d22 <vprintfmt+0x4f7>
+				printfmt(putch, putdat, "%s", p);
+  800a67:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800a6b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a6f:	4c 89 e1             	mov    %r12,%rcx
+  800a72:	48 ba 6a 26 80 00 00 	movabs $0x80266a,%rdx
+  800a79:	00 00 00 
+  800a7c:	48 89 c7             	mov    %rax,%rdi
+  800a7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a84:	49 b8 31 0d 80 00 00 	movabs $0x800d31,%r8
+  800a8b:	00 00 00 
+  800a8e:	41 ff d0             	call   *%r8
+			break;
+  800a91:	e9 8c 02 00 00       	jmp    800d22 <vprintfmt+0x4f7>
+
+		// string
+		case 's':
+			// 从可变参数中读入字符串指针
+			if ((p = va_arg(aq, char *)) == NULL)
+  800a96:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a99:	83 f8 2f             	cmp    $0x2f,%eax
+  800a9c:	77 17                	ja     800ab5 <vprintfmt+0x28a>
+  800a9e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800aa2:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800aa5:	89 d2                	mov    %edx,%edx
+  800aa7:	48 01 d0             	add    %rdx,%rax
+  800aaa:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800aad:	83 c2 08             	add    $0x8,%edx
+  800ab0:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800ab3:	eb 0c                	jmp    800ac1 <vprintfmt+0x296>
+  800ab5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800ab9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800abd:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800ac1:	4c 8b 20             	mov    (%rax),%r12
+  800ac4:	4d 85 e4             	test   %r12,%r12
+  800ac7:	75 0a                	jne    800ad3 <vprintfmt+0x2a8>
+				p = "(null)"; // 当字符串为空时，将它指向"(null)"字符串
+  800ac9:	49 bc 6d 26 80 00 00 	movabs $0x80266d,%r12
+  800ad0:	00 00 00 
+			// 判断左对齐还是右对齐，pad='-'左对齐，否则右对齐
+			if (width > 0 && padc != '-')
+  800ad3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800ad7:	7e 78                	jle    800b51 <vprintfmt+0x326>
+  800ad9:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800add:	74 72                	je     800b51 <vprintfmt+0x326>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800adf:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800ae2:	48 98                	cltq
+  800ae4:	48 89 c6             	mov    %rax,%rsi
+  800ae7:	4c 89 e7             	mov    %r12,%rdi
+  800aea:	48 b8 d6 10 80 00 00 	movabs $0x8010d6,%rax
+  800af1:	00 00 00 
+  800af4:	ff d0                	call   *%rax
+  800af6:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800af9:	eb 17                	jmp    800b12 <vprintfmt+0x2e7>
+					putch(padc, putdat); // 字符串右对齐，左边补相应数量(width-实际长度)的空格或者 0
+  800afb:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800aff:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800b03:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800b07:	48 89 d6             	mov    %rdx,%rsi
+  800b0a:	89 c7                	mov    %eax,%edi
+  800b0c:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b0e:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800b12:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b16:	7f e3                	jg     800afb <vprintfmt+0x2d0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b18:	eb 37                	jmp    800b51 <vprintfmt+0x326>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800b1a:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800b1e:	74 1e                	je     800b3e <vprintfmt+0x313>
+  800b20:	83 fb 1f             	cmp    $0x1f,%ebx
+  800b23:	7e 05                	jle    800b2a <vprintfmt+0x2ff>
+  800b25:	83 fb 7e             	cmp    $0x7e,%ebx
+  800b28:	7e 14                	jle    800b3e <vprintfmt+0x313>
+					putch('?', putdat);
+  800b2a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b2e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b32:	48 89 c6             	mov    %rax,%rsi
+  800b35:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800b3a:	ff d2                	call   *%rdx
+  800b3c:	eb 0f                	jmp    800b4d <vprintfmt+0x322>
+				else
+					putch(ch, putdat); // 打印相应长度的字符串
+  800b3e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b42:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b46:	48 89 c6             	mov    %rax,%rsi
+  800b49:	89 df                	mov    %ebx,%edi
+  800b4b:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b4d:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800b51:	4c 89 e0             	mov    %r12,%rax
+  800b54:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800b58:	0f b6 00             	movzbl (%rax),%eax
+  800b5b:	0f be d8             	movsbl %al,%ebx
+  800b5e:	85 db                	test   %ebx,%ebx
+  800b60:	74 28                	je     800b8a <vprintfmt+0x35f>
+  800b62:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800b66:	78 b2                	js     800b1a <vprintfmt+0x2ef>
+  800b68:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800b6c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800b70:	79 a8                	jns    800b1a <vprintfmt+0x2ef>
+			for (; width > 0; width--)
+  800b72:	eb 16                	jmp    800b8a <vprintfmt+0x35f>
+				putch(' ', putdat); // 当字符串是左对齐的时候打印相应数量的空格
+  800b74:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b78:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b7c:	48 89 c6             	mov    %rax,%rsi
+  800b7f:	bf 20 00 00 00       	mov    $0x20,%edi
+  800b84:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800b86:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800b8a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b8e:	7f e4                	jg     800b74 <vprintfmt+0x349>
+			break;
+  800b90:	e9 8d 01 00 00       	jmp    800d22 <vprintfmt+0x4f7>
+
+		// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800b95:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b99:	be 03 00 00 00       	mov    $0x3,%esi
+  800b9e:	48 89 c7             	mov    %rax,%rdi
+  800ba1:	48 b8 24 07 80 00 00 	movabs $0x800724,%rax
+  800ba8:	00 00 00 
+  800bab:	ff d0                	call   *%rax
+  800bad:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((long long)num < 0)
+  800bb1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bb5:	48 85 c0             	test   %rax,%rax
+  800bb8:	79 1d                	jns    800bd7 <vprintfmt+0x3ac>
+			{
+				putch('-', putdat);
+  800bba:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bbe:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800bc2:	48 89 c6             	mov    %rax,%rsi
+  800bc5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800bca:	ff d2                	call   *%rdx
+				num = -(long long)num;
+  800bcc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bd0:	48 f7 d8             	neg    %rax
+  800bd3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			}
+			base = 10;
+  800bd7:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800bde:	e9 d2 00 00 00       	jmp    800cb5 <vprintfmt+0x48a>
+
+		// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800be3:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800be7:	be 03 00 00 00       	mov    $0x3,%esi
+  800bec:	48 89 c7             	mov    %rax,%rdi
+  800bef:	48 b8 1d 06 80 00 00 	movabs $0x80061d,%rax
+  800bf6:	00 00 00 
+  800bf9:	ff d0                	call   *%rax
+  800bfb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 10;
+  800bff:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800c06:	e9 aa 00 00 00       	jmp    800cb5 <vprintfmt+0x48a>
+		// (unsigned) octal
+		case 'o':
+			// Gets the variable argument with type integer from the point which was processed last by va_arg
+			// calls getuint which returns a long long value, which then calls printnum which prints based on
+			// base value.
+			num = getuint(&aq, 3);
+  800c0b:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800c0f:	be 03 00 00 00       	mov    $0x3,%esi
+  800c14:	48 89 c7             	mov    %rax,%rdi
+  800c17:	48 b8 1d 06 80 00 00 	movabs $0x80061d,%rax
+  800c1e:	00 00 00 
+  800c21:	ff d0                	call   *%rax
+  800c23:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 8;
+  800c27:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+			goto number;
+  800c2e:	e9 82 00 00 00       	jmp    800cb5 <vprintfmt+0x48a>
+
+		// pointer
+		case 'p':
+			putch('0', putdat);
+  800c33:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c37:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c3b:	48 89 c6             	mov    %rax,%rsi
+  800c3e:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c43:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800c45:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c49:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c4d:	48 89 c6             	mov    %rax,%rsi
+  800c50:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c55:	ff d2                	call   *%rdx
+			num = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800c57:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c5a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c5d:	77 17                	ja     800c76 <vprintfmt+0x44b>
+  800c5f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c63:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c66:	89 d2                	mov    %edx,%edx
+  800c68:	48 01 d0             	add    %rdx,%rax
+  800c6b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c6e:	83 c2 08             	add    $0x8,%edx
+  800c71:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800c74:	eb 0c                	jmp    800c82 <vprintfmt+0x457>
+  800c76:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800c7a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c7e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800c82:	48 8b 00             	mov    (%rax),%rax
+  800c85:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800c89:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+			goto number;
+  800c90:	eb 23                	jmp    800cb5 <vprintfmt+0x48a>
+
+		// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800c92:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800c96:	be 03 00 00 00       	mov    $0x3,%esi
+  800c9b:	48 89 c7             	mov    %rax,%rdi
+  800c9e:	48 b8 1d 06 80 00 00 	movabs $0x80061d,%rax
+  800ca5:	00 00 00 
+  800ca8:	ff d0                	call   *%rax
+  800caa:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800cae:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800cb5:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800cba:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800cbd:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800cc0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800cc4:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800cc8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ccc:	45 89 c1             	mov    %r8d,%r9d
+  800ccf:	41 89 f8             	mov    %edi,%r8d
+  800cd2:	48 89 c7             	mov    %rax,%rdi
+  800cd5:	48 b8 65 05 80 00 00 	movabs $0x800565,%rax
+  800cdc:	00 00 00 
+  800cdf:	ff d0                	call   *%rax
+			break;
+  800ce1:	eb 3f                	jmp    800d22 <vprintfmt+0x4f7>
+
+		// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800ce3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ce7:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ceb:	48 89 c6             	mov    %rax,%rsi
+  800cee:	89 df                	mov    %ebx,%edi
+  800cf0:	ff d2                	call   *%rdx
+			break;
+  800cf2:	eb 2e                	jmp    800d22 <vprintfmt+0x4f7>
+
+		// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800cf4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800cf8:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800cfc:	48 89 c6             	mov    %rax,%rsi
+  800cff:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d04:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800d06:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800d0b:	eb 05                	jmp    800d12 <vprintfmt+0x4e7>
+  800d0d:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800d12:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800d16:	48 83 e8 01          	sub    $0x1,%rax
+  800d1a:	0f b6 00             	movzbl (%rax),%eax
+  800d1d:	3c 25                	cmp    $0x25,%al
+  800d1f:	75 ec                	jne    800d0d <vprintfmt+0x4e2>
+				/* do nothing */;
+			break;
+  800d21:	90                   	nop
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800d22:	e9 56 fb ff ff       	jmp    80087d <vprintfmt+0x52>
+				return;
+  800d27:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800d28:	48 83 c4 60          	add    $0x60,%rsp
+  800d2c:	5b                   	pop    %rbx
+  800d2d:	41 5c                	pop    %r12
+  800d2f:	5d                   	pop    %rbp
+  800d30:	c3                   	ret
+
+0000000000800d31 <printfmt>:
+
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...)
+{
+  800d31:	55                   	push   %rbp
+  800d32:	48 89 e5             	mov    %rsp,%rbp
+  800d35:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800d3c:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800d43:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800d4a:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800d51:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800d58:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800d5f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800d66:	84 c0                	test   %al,%al
+  800d68:	74 20                	je     800d8a <printfmt+0x59>
+  800d6a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800d6e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800d72:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800d76:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800d7a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800d7e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800d82:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800d86:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800d8a:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800d91:	00 00 00 
+  800d94:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800d9b:	00 00 00 
+  800d9e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800da2:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800da9:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800db0:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800db7:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800dbe:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800dc5:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800dcc:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800dd3:	48 89 c7             	mov    %rax,%rdi
+  800dd6:	48 b8 2b 08 80 00 00 	movabs $0x80082b,%rax
+  800ddd:	00 00 00 
+  800de0:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  800de2:	90                   	nop
+  800de3:	c9                   	leave
+  800de4:	c3                   	ret
+
+0000000000800de5 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800de5:	55                   	push   %rbp
+  800de6:	48 89 e5             	mov    %rsp,%rbp
+  800de9:	48 83 ec 10          	sub    $0x10,%rsp
+  800ded:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800df0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  800df4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800df8:	8b 40 10             	mov    0x10(%rax),%eax
+  800dfb:	8d 50 01             	lea    0x1(%rax),%edx
+  800dfe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e02:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  800e05:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e09:	48 8b 10             	mov    (%rax),%rdx
+  800e0c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e10:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e14:	48 39 c2             	cmp    %rax,%rdx
+  800e17:	73 17                	jae    800e30 <sprintputch+0x4b>
+		*b->buf++ = ch;
+  800e19:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e1d:	48 8b 00             	mov    (%rax),%rax
+  800e20:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800e24:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800e28:	48 89 0a             	mov    %rcx,(%rdx)
+  800e2b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800e2e:	88 10                	mov    %dl,(%rax)
+}
+  800e30:	90                   	nop
+  800e31:	c9                   	leave
+  800e32:	c3                   	ret
+
+0000000000800e33 <vsnprintf>:
+
+int vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800e33:	55                   	push   %rbp
+  800e34:	48 89 e5             	mov    %rsp,%rbp
+  800e37:	48 83 ec 50          	sub    $0x50,%rsp
+  800e3b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  800e3f:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  800e42:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  800e46:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+	va_list aq;
+	va_copy(aq, ap);
+  800e4a:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800e4e:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800e52:	48 8b 06             	mov    (%rsi),%rax
+  800e55:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800e59:	48 89 01             	mov    %rax,(%rcx)
+  800e5c:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800e60:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800e64:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	struct sprintbuf b = {buf, buf + n - 1, 0};
+  800e68:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e6c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800e70:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  800e73:	48 98                	cltq
+  800e75:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800e79:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e7d:	48 01 d0             	add    %rdx,%rax
+  800e80:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  800e84:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+
+	if (buf == NULL || n < 1)
+  800e8b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800e90:	74 06                	je     800e98 <vsnprintf+0x65>
+  800e92:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800e96:	7f 07                	jg     800e9f <vsnprintf+0x6c>
+		return -E_INVAL;
+  800e98:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e9d:	eb 32                	jmp    800ed1 <vsnprintf+0x9e>
+
+	// print the string to the buffer
+	vprintfmt((void *)sprintputch, &b, fmt, aq);
+  800e9f:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800ea3:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  800ea7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800eab:	48 89 c6             	mov    %rax,%rsi
+  800eae:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  800eb5:	00 00 00 
+  800eb8:	48 89 c7             	mov    %rax,%rdi
+  800ebb:	48 b8 2b 08 80 00 00 	movabs $0x80082b,%rax
+  800ec2:	00 00 00 
+  800ec5:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  800ec7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ecb:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800ece:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  800ed1:	c9                   	leave
+  800ed2:	c3                   	ret
+
+0000000000800ed3 <snprintf>:
+
+int snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800ed3:	55                   	push   %rbp
+  800ed4:	48 89 e5             	mov    %rsp,%rbp
+  800ed7:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800ede:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800ee5:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800eeb:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800ef2:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800ef9:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f00:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f07:	84 c0                	test   %al,%al
+  800f09:	74 20                	je     800f2b <snprintf+0x58>
+  800f0b:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f0f:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f13:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f17:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f1b:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f1f:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f23:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f27:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  800f2b:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800f32:	00 00 00 
+  800f35:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800f3c:	00 00 00 
+  800f3f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f43:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800f4a:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f51:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq, ap);
+  800f58:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800f5f:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800f66:	48 8b 06             	mov    (%rsi),%rax
+  800f69:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800f6d:	48 89 01             	mov    %rax,(%rcx)
+  800f70:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800f74:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800f78:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  800f7c:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800f83:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  800f8a:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  800f90:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800f97:	48 89 c7             	mov    %rax,%rdi
+  800f9a:	48 b8 33 0e 80 00 00 	movabs $0x800e33,%rax
+  800fa1:	00 00 00 
+  800fa4:	ff d0                	call   *%rax
+  800fa6:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  800fac:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800fb2:	c9                   	leave
+  800fb3:	c3                   	ret
+
+0000000000800fb4 <cpuid>:
+#define read_rip(var) __asm __volatile("leaq (%%rip), %0" : "=r" (var)::"cc","memory")
+
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800fb4:	55                   	push   %rbp
+  800fb5:	48 89 e5             	mov    %rsp,%rbp
+  800fb8:	53                   	push   %rbx
+  800fb9:	48 83 ec 38          	sub    $0x38,%rsp
+  800fbd:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800fc0:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800fc4:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800fc8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800fcc:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid" 
+  800fd0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800fd3:	0f a2                	cpuid
+  800fd5:	89 de                	mov    %ebx,%esi
+  800fd7:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800fda:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800fdd:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800fe0:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info));
+	if (eaxp)
+  800fe3:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800fe8:	74 09                	je     800ff3 <cpuid+0x3f>
+		*eaxp = eax;
+  800fea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fee:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800ff1:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  800ff3:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800ff8:	74 09                	je     801003 <cpuid+0x4f>
+		*ebxp = ebx;
+  800ffa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ffe:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  801001:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  801003:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801008:	74 09                	je     801013 <cpuid+0x5f>
+		*ecxp = ecx;
+  80100a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80100e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801011:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  801013:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801018:	74 09                	je     801023 <cpuid+0x6f>
+		*edxp = edx;
+  80101a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80101e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801021:	89 10                	mov    %edx,(%rax)
+}
+  801023:	90                   	nop
+  801024:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801028:	c9                   	leave
+  801029:	c3                   	ret
+
+000000000080102a <cpuid_count>:
+
+// 带子功能号(%ecx = count)的 cpuid，用于 leaf 4/7/0xB/0xD 等
+static __inline void
+cpuid_count(uint32_t info, uint32_t count, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  80102a:	55                   	push   %rbp
+  80102b:	48 89 e5             	mov    %rsp,%rbp
+  80102e:	53                   	push   %rbx
+  80102f:	48 83 ec 38          	sub    $0x38,%rsp
+  801033:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  801036:	89 75 e0             	mov    %esi,-0x20(%rbp)
+  801039:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80103d:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  801041:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+  801045:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  801049:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80104c:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80104f:	89 d1                	mov    %edx,%ecx
+  801051:	0f a2                	cpuid
+  801053:	89 de                	mov    %ebx,%esi
+  801055:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  801058:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  80105b:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  80105e:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info), "c" (count));
+	if (eaxp)
+  801061:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801066:	74 09                	je     801071 <cpuid_count+0x47>
+		*eaxp = eax;
+  801068:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80106c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80106f:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  801071:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801076:	74 09                	je     801081 <cpuid_count+0x57>
+		*ebxp = ebx;
+  801078:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80107c:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  80107f:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  801081:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801086:	74 09                	je     801091 <cpuid_count+0x67>
+		*ecxp = ecx;
+  801088:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80108c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80108f:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  801091:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801096:	74 09                	je     8010a1 <cpuid_count+0x77>
+		*edxp = edx;
+  801098:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80109c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80109f:	89 10                	mov    %edx,(%rax)
+}
+  8010a1:	90                   	nop
+  8010a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010a6:	c9                   	leave
+  8010a7:	c3                   	ret
+
+00000000008010a8 <strlen>:
+// 在真正的硬件上会有一定程度的优化, 但在 Bochs 上会有更大的优化效果
+// 用这种方法, Primespipe 的运行速度快了3倍
+#define ASM 1
+
+int strlen(const char *s)
+{
+  8010a8:	55                   	push   %rbp
+  8010a9:	48 89 e5             	mov    %rsp,%rbp
+  8010ac:	48 83 ec 18          	sub    $0x18,%rsp
+  8010b0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8010b4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8010bb:	eb 09                	jmp    8010c6 <strlen+0x1e>
+		n++;
+  8010bd:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8010c1:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8010c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010ca:	0f b6 00             	movzbl (%rax),%eax
+  8010cd:	84 c0                	test   %al,%al
+  8010cf:	75 ec                	jne    8010bd <strlen+0x15>
+	return n;
+  8010d1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8010d4:	c9                   	leave
+  8010d5:	c3                   	ret
+
+00000000008010d6 <strnlen>:
+
+int strnlen(const char *s, size_t size)
+{
+  8010d6:	55                   	push   %rbp
+  8010d7:	48 89 e5             	mov    %rsp,%rbp
+  8010da:	48 83 ec 20          	sub    $0x20,%rsp
+  8010de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8010e2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8010e6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8010ed:	eb 0e                	jmp    8010fd <strnlen+0x27>
+		n++;
+  8010ef:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8010f3:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8010f8:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8010fd:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801102:	74 0b                	je     80110f <strnlen+0x39>
+  801104:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801108:	0f b6 00             	movzbl (%rax),%eax
+  80110b:	84 c0                	test   %al,%al
+  80110d:	75 e0                	jne    8010ef <strnlen+0x19>
+	return n;
+  80110f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801112:	c9                   	leave
+  801113:	c3                   	ret
+
+0000000000801114 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801114:	55                   	push   %rbp
+  801115:	48 89 e5             	mov    %rsp,%rbp
+  801118:	48 83 ec 20          	sub    $0x20,%rsp
+  80111c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801120:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801124:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801128:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  80112c:	90                   	nop
+  80112d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801131:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801135:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801139:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80113d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801141:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801145:	0f b6 12             	movzbl (%rdx),%edx
+  801148:	88 10                	mov    %dl,(%rax)
+  80114a:	0f b6 00             	movzbl (%rax),%eax
+  80114d:	84 c0                	test   %al,%al
+  80114f:	75 dc                	jne    80112d <strcpy+0x19>
+		/* do nothing */;
+	return ret;
+  801151:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801155:	c9                   	leave
+  801156:	c3                   	ret
+
+0000000000801157 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801157:	55                   	push   %rbp
+  801158:	48 89 e5             	mov    %rsp,%rbp
+  80115b:	48 83 ec 20          	sub    $0x20,%rsp
+  80115f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801163:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int len = strlen(dst);
+  801167:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80116b:	48 89 c7             	mov    %rax,%rdi
+  80116e:	48 b8 a8 10 80 00 00 	movabs $0x8010a8,%rax
+  801175:	00 00 00 
+  801178:	ff d0                	call   *%rax
+  80117a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	strcpy(dst + len, src);
+  80117d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801180:	48 63 d0             	movslq %eax,%rdx
+  801183:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801187:	48 01 c2             	add    %rax,%rdx
+  80118a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80118e:	48 89 c6             	mov    %rax,%rsi
+  801191:	48 89 d7             	mov    %rdx,%rdi
+  801194:	48 b8 14 11 80 00 00 	movabs $0x801114,%rax
+  80119b:	00 00 00 
+  80119e:	ff d0                	call   *%rax
+	return dst;
+  8011a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8011a4:	c9                   	leave
+  8011a5:	c3                   	ret
+
+00000000008011a6 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8011a6:	55                   	push   %rbp
+  8011a7:	48 89 e5             	mov    %rsp,%rbp
+  8011aa:	48 83 ec 28          	sub    $0x28,%rsp
+  8011ae:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8011b2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8011b6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  8011ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011be:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++)
+  8011c2:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8011c9:	00 
+  8011ca:	eb 2a                	jmp    8011f6 <strncpy+0x50>
+	{
+		*dst++ = *src;
+  8011cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011d0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8011d4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8011d8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8011dc:	0f b6 12             	movzbl (%rdx),%edx
+  8011df:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  8011e1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8011e5:	0f b6 00             	movzbl (%rax),%eax
+  8011e8:	84 c0                	test   %al,%al
+  8011ea:	74 05                	je     8011f1 <strncpy+0x4b>
+			src++;
+  8011ec:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++)
+  8011f1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8011f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011fa:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8011fe:	72 cc                	jb     8011cc <strncpy+0x26>
+	}
+	return ret;
+  801200:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801204:	c9                   	leave
+  801205:	c3                   	ret
+
+0000000000801206 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801206:	55                   	push   %rbp
+  801207:	48 89 e5             	mov    %rsp,%rbp
+  80120a:	48 83 ec 28          	sub    $0x28,%rsp
+  80120e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801212:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801216:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  80121a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80121e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0)
+  801222:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801227:	74 3d                	je     801266 <strlcpy+0x60>
+	{
+		while (--size > 0 && *src != '\0')
+  801229:	eb 1d                	jmp    801248 <strlcpy+0x42>
+			*dst++ = *src++;
+  80122b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80122f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801233:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801237:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80123b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80123f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801243:	0f b6 12             	movzbl (%rdx),%edx
+  801246:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801248:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80124d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801252:	74 0b                	je     80125f <strlcpy+0x59>
+  801254:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801258:	0f b6 00             	movzbl (%rax),%eax
+  80125b:	84 c0                	test   %al,%al
+  80125d:	75 cc                	jne    80122b <strlcpy+0x25>
+		*dst = '\0';
+  80125f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801263:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801266:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80126a:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80126e:	c9                   	leave
+  80126f:	c3                   	ret
+
+0000000000801270 <strcmp>:
+
+int strcmp(const char *p, const char *q)
+{
+  801270:	55                   	push   %rbp
+  801271:	48 89 e5             	mov    %rsp,%rbp
+  801274:	48 83 ec 10          	sub    $0x10,%rsp
+  801278:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80127c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801280:	eb 0a                	jmp    80128c <strcmp+0x1c>
+		p++, q++;
+  801282:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801287:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  80128c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801290:	0f b6 00             	movzbl (%rax),%eax
+  801293:	84 c0                	test   %al,%al
+  801295:	74 12                	je     8012a9 <strcmp+0x39>
+  801297:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80129b:	0f b6 10             	movzbl (%rax),%edx
+  80129e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012a2:	0f b6 00             	movzbl (%rax),%eax
+  8012a5:	38 c2                	cmp    %al,%dl
+  8012a7:	74 d9                	je     801282 <strcmp+0x12>
+	return (int)((unsigned char)*p - (unsigned char)*q);
+  8012a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012ad:	0f b6 00             	movzbl (%rax),%eax
+  8012b0:	0f b6 d0             	movzbl %al,%edx
+  8012b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012b7:	0f b6 00             	movzbl (%rax),%eax
+  8012ba:	0f b6 c0             	movzbl %al,%eax
+  8012bd:	29 c2                	sub    %eax,%edx
+  8012bf:	89 d0                	mov    %edx,%eax
+}
+  8012c1:	c9                   	leave
+  8012c2:	c3                   	ret
+
+00000000008012c3 <strncmp>:
+
+int strncmp(const char *p, const char *q, size_t n)
+{
+  8012c3:	55                   	push   %rbp
+  8012c4:	48 89 e5             	mov    %rsp,%rbp
+  8012c7:	48 83 ec 18          	sub    $0x18,%rsp
+  8012cb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8012cf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8012d3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8012d7:	eb 0f                	jmp    8012e8 <strncmp+0x25>
+		n--, p++, q++;
+  8012d9:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8012de:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8012e3:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8012e8:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8012ed:	74 1d                	je     80130c <strncmp+0x49>
+  8012ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012f3:	0f b6 00             	movzbl (%rax),%eax
+  8012f6:	84 c0                	test   %al,%al
+  8012f8:	74 12                	je     80130c <strncmp+0x49>
+  8012fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012fe:	0f b6 10             	movzbl (%rax),%edx
+  801301:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801305:	0f b6 00             	movzbl (%rax),%eax
+  801308:	38 c2                	cmp    %al,%dl
+  80130a:	74 cd                	je     8012d9 <strncmp+0x16>
+	if (n == 0)
+  80130c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801311:	75 07                	jne    80131a <strncmp+0x57>
+		return 0;
+  801313:	ba 00 00 00 00       	mov    $0x0,%edx
+  801318:	eb 16                	jmp    801330 <strncmp+0x6d>
+	else
+		return (int)((unsigned char)*p - (unsigned char)*q);
+  80131a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80131e:	0f b6 00             	movzbl (%rax),%eax
+  801321:	0f b6 d0             	movzbl %al,%edx
+  801324:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801328:	0f b6 00             	movzbl (%rax),%eax
+  80132b:	0f b6 c0             	movzbl %al,%eax
+  80132e:	29 c2                	sub    %eax,%edx
+}
+  801330:	89 d0                	mov    %edx,%eax
+  801332:	c9                   	leave
+  801333:	c3                   	ret
+
+0000000000801334 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801334:	55                   	push   %rbp
+  801335:	48 89 e5             	mov    %rsp,%rbp
+  801338:	48 83 ec 10          	sub    $0x10,%rsp
+  80133c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801340:	89 f0                	mov    %esi,%eax
+  801342:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801345:	eb 17                	jmp    80135e <strchr+0x2a>
+		if (*s == c)
+  801347:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80134b:	0f b6 00             	movzbl (%rax),%eax
+  80134e:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801351:	75 06                	jne    801359 <strchr+0x25>
+			return (char *)s;
+  801353:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801357:	eb 15                	jmp    80136e <strchr+0x3a>
+	for (; *s; s++)
+  801359:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80135e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801362:	0f b6 00             	movzbl (%rax),%eax
+  801365:	84 c0                	test   %al,%al
+  801367:	75 de                	jne    801347 <strchr+0x13>
+	return 0;
+  801369:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80136e:	c9                   	leave
+  80136f:	c3                   	ret
+
+0000000000801370 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801370:	55                   	push   %rbp
+  801371:	48 89 e5             	mov    %rsp,%rbp
+  801374:	48 83 ec 10          	sub    $0x10,%rsp
+  801378:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80137c:	89 f0                	mov    %esi,%eax
+  80137e:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801381:	eb 11                	jmp    801394 <strfind+0x24>
+		if (*s == c)
+  801383:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801387:	0f b6 00             	movzbl (%rax),%eax
+  80138a:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80138d:	74 12                	je     8013a1 <strfind+0x31>
+	for (; *s; s++)
+  80138f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801394:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801398:	0f b6 00             	movzbl (%rax),%eax
+  80139b:	84 c0                	test   %al,%al
+  80139d:	75 e4                	jne    801383 <strfind+0x13>
+  80139f:	eb 01                	jmp    8013a2 <strfind+0x32>
+			break;
+  8013a1:	90                   	nop
+	return (char *)s;
+  8013a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8013a6:	c9                   	leave
+  8013a7:	c3                   	ret
+
+00000000008013a8 <mem_init>:
+};
+
+static int mem_features;
+
+void mem_init(void)
+{
+  8013a8:	55                   	push   %rbp
+  8013a9:	48 89 e5             	mov    %rsp,%rbp
+  8013ac:	48 83 ec 10          	sub    $0x10,%rsp
+	uint32_t max, ebx, edx;
+
+	mem_features = 0;
+  8013b0:	48 b8 28 40 c0 00 00 	movabs $0xc04028,%rax
+  8013b7:	00 00 00 
+  8013ba:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	cpuid(0, &max, NULL, NULL, NULL);
+  8013c0:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+  8013c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013d4:	48 89 c6             	mov    %rax,%rsi
+  8013d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013dc:	48 b8 b4 0f 80 00 00 	movabs $0x800fb4,%rax
+  8013e3:	00 00 00 
+  8013e6:	ff d0                	call   *%rax
+	cpuid(1, NULL, NULL, NULL, &edx);
+  8013e8:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  8013ec:	49 89 c0             	mov    %rax,%r8
+  8013ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8013fe:	bf 01 00 00 00       	mov    $0x1,%edi
+  801403:	48 b8 b4 0f 80 00 00 	movabs $0x800fb4,%rax
+  80140a:	00 00 00 
+  80140d:	ff d0                	call   *%rax
+	if (edx & (1 << 26))
+  80140f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801412:	25 00 00 00 04       	and    $0x4000000,%eax
+  801417:	85 c0                	test   %eax,%eax
+  801419:	74 1d                	je     801438 <mem_init+0x90>
+		mem_features |= MEM_F_NT;
+  80141b:	48 b8 28 40 c0 00 00 	movabs $0xc04028,%rax
+  801422:	00 00 00 
+  801425:	8b 00                	mov    (%rax),%eax
+  801427:	83 c8 02             	or     $0x2,%eax
+  80142a:	89 c2                	mov    %eax,%edx
+  80142c:	48 b8 28 40 c0 00 00 	movabs $0xc04028,%rax
+  801433:	00 00 00 
+  801436:	89 10                	mov    %edx,(%rax)
+	if (max >= 7)
+  801438:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80143b:	83 f8 06             	cmp    $0x6,%eax
+  80143e:	76 57                	jbe    801497 <mem_init+0xef>
+	{
+		cpuid_count(7, 0, NULL, &ebx, NULL, NULL);
+  801440:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801444:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80144a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801450:	48 89 c1             	mov    %rax,%rcx
+  801453:	ba 00 00 00 00       	mov    $0x0,%edx
+  801458:	be 00 00 00 00       	mov    $0x0,%esi
+  80145d:	bf 07 00 00 00       	mov    $0x7,%edi
+  801462:	48 b8 2a 10 80 00 00 	movabs $0x80102a,%rax
+  801469:	00 00 00 
+  80146c:	ff d0                	call   *%rax
+		if (ebx & (1 << 9))
+  80146e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801471:	25 00 02 00 00       	and    $0x200,%eax
+  801476:	85 c0                	test   %eax,%eax
+  801478:	74 1d                	je     801497 <mem_init+0xef>
+			mem_features |= MEM_F_ERMS;
+  80147a:	48 b8 28 40 c0 00 00 	movabs $0xc04028,%rax
+  801481:	00 00 00 
+  801484:	8b 00                	mov    (%rax),%eax
+  801486:	83 c8 01             	or     $0x1,%eax
+  801489:	89 c2                	mov    %eax,%edx
+  80148b:	48 b8 28 40 c0 00 00 	movabs $0xc04028,%rax
+  801492:	00 00 00 
+  801495:	89 10                	mov    %edx,(%rax)
+	}
+}
+  801497:	90                   	nop
+  801498:	c9                   	leave
+  801499:	c3                   	ret
+
+000000000080149a <memset_nt>:
+
+// 非临时存储填充 n 字节(v 8 字节对齐，n 为 32 的倍数)
+static void
+memset_nt(void *v, uint64_t pattern, size_t n)
+{
+  80149a:	55                   	push   %rbp
+  80149b:	48 89 e5             	mov    %rsp,%rbp
+  80149e:	48 83 ec 28          	sub    $0x28,%rsp
+  8014a2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014a6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8014aa:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t *p = (uint64_t *)v;
+  8014ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014b2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint64_t *end = p + n / 8;
+  8014b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8014ba:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  8014be:	48 89 c2             	mov    %rax,%rdx
+  8014c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014c5:	48 01 d0             	add    %rdx,%rax
+  8014c8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	for (; p < end; p += 4)
+  8014cc:	eb 20                	jmp    8014ee <memset_nt+0x54>
+		asm volatile("movnti %1, 0(%0)\n\t"
+  8014ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014d2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8014d6:	48 0f c3 10          	movnti %rdx,(%rax)
+  8014da:	48 0f c3 50 08       	movnti %rdx,0x8(%rax)
+  8014df:	48 0f c3 50 10       	movnti %rdx,0x10(%rax)
+  8014e4:	48 0f c3 50 18       	movnti %rdx,0x18(%rax)
+	for (; p < end; p += 4)
+  8014e9:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  8014ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014f2:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8014f6:	72 d6                	jb     8014ce <memset_nt+0x34>
+					 "movnti %1, 16(%0)\n\t"
+					 "movnti %1, 24(%0)"
+					 :
+					 : "r"(p), "r"(pattern)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  8014f8:	0f ae f8             	sfence
+}
+  8014fb:	90                   	nop
+  8014fc:	c9                   	leave
+  8014fd:	c3                   	ret
+
+00000000008014fe <memcpy_nt>:
+
+// 非临时存储复制 n 字节(dst/src 8 字节对齐且不重叠，n 为 32 的倍数)
+static void
+memcpy_nt(void *dst, const void *src, size_t n)
+{
+  8014fe:	55                   	push   %rbp
+  8014ff:	48 89 e5             	mov    %rsp,%rbp
+  801502:	48 83 ec 58          	sub    $0x58,%rsp
+  801506:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80150a:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  80150e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	uint64_t *d = (uint64_t *)dst;
+  801512:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801516:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint64_t *s = (const uint64_t *)src;
+  80151a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80151e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	uint64_t *end = d + n / 8;
+  801522:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801526:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  80152a:	48 89 c2             	mov    %rax,%rdx
+  80152d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801531:	48 01 d0             	add    %rdx,%rax
+  801534:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint64_t t0, t1, t2, t3;
+
+	for (; d < end; d += 4, s += 4)
+  801538:	eb 44                	jmp    80157e <memcpy_nt+0x80>
+		asm volatile("movq 0(%4), %0\n\t"
+  80153a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80153e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801542:	4c 8b 00             	mov    (%rax),%r8
+  801545:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  801549:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  80154d:	48 8b 48 18          	mov    0x18(%rax),%rcx
+  801551:	4c 0f c3 02          	movnti %r8,(%rdx)
+  801555:	48 0f c3 7a 08       	movnti %rdi,0x8(%rdx)
+  80155a:	48 0f c3 72 10       	movnti %rsi,0x10(%rdx)
+  80155f:	48 0f c3 4a 18       	movnti %rcx,0x18(%rdx)
+  801564:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  801568:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80156c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801570:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+	for (; d < end; d += 4, s += 4)
+  801574:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  801579:	48 83 45 f0 20       	addq   $0x20,-0x10(%rbp)
+  80157e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801582:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  801586:	72 b2                	jb     80153a <memcpy_nt+0x3c>
+					 "movnti %2, 16(%5)\n\t"
+					 "movnti %3, 24(%5)"
+					 : "=&r"(t0), "=&r"(t1), "=&r"(t2), "=&r"(t3)
+					 : "r"(s), "r"(d)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  801588:	0f ae f8             	sfence
+}
+  80158b:	90                   	nop
+  80158c:	c9                   	leave
+  80158d:	c3                   	ret
+
+000000000080158e <memcpy_fwd>:
+
+// 正向复制(dst 在 src 之前或两者不重叠)
+static void
+memcpy_fwd(void *dst, const void *src, size_t n)
+{
+  80158e:	55                   	push   %rbp
+  80158f:	48 89 e5             	mov    %rsp,%rbp
+  801592:	48 83 ec 18          	sub    $0x18,%rsp
+  801596:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80159a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80159e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  8015a2:	48 b8 28 40 c0 00 00 	movabs $0xc04028,%rax
+  8015a9:	00 00 00 
+  8015ac:	8b 00                	mov    (%rax),%eax
+  8015ae:	83 e0 02             	and    $0x2,%eax
+  8015b1:	85 c0                	test   %eax,%eax
+  8015b3:	74 66                	je     80161b <memcpy_fwd+0x8d>
+  8015b5:	48 81 7d e8 ff 0f 00 	cmpq   $0xfff,-0x18(%rbp)
+  8015bc:	00 
+  8015bd:	76 5c                	jbe    80161b <memcpy_fwd+0x8d>
+  8015bf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8015c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015c7:	48 09 d0             	or     %rdx,%rax
+  8015ca:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  8015ce:	83 e0 1f             	and    $0x1f,%eax
+  8015d1:	48 85 c0             	test   %rax,%rax
+  8015d4:	75 45                	jne    80161b <memcpy_fwd+0x8d>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  8015d6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8015da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015de:	48 01 d0             	add    %rdx,%rax
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  8015e1:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8015e5:	73 11                	jae    8015f8 <memcpy_fwd+0x6a>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  8015e7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8015eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015ef:	48 01 d0             	add    %rdx,%rax
+  8015f2:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8015f6:	72 23                	jb     80161b <memcpy_fwd+0x8d>
+		memcpy_nt(dst, src, n);
+  8015f8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8015fc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801600:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801604:	48 89 ce             	mov    %rcx,%rsi
+  801607:	48 89 c7             	mov    %rax,%rdi
+  80160a:	48 b8 fe 14 80 00 00 	movabs $0x8014fe,%rax
+  801611:	00 00 00 
+  801614:	ff d0                	call   *%rax
+  801616:	e9 81 00 00 00       	jmp    80169c <memcpy_fwd+0x10e>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  80161b:	48 b8 28 40 c0 00 00 	movabs $0xc04028,%rax
+  801622:	00 00 00 
+  801625:	8b 00                	mov    (%rax),%eax
+  801627:	83 e0 01             	and    $0x1,%eax
+  80162a:	85 c0                	test   %eax,%eax
+  80162c:	74 21                	je     80164f <memcpy_fwd+0xc1>
+  80162e:	48 81 7d e8 ff 00 00 	cmpq   $0xff,-0x18(%rbp)
+  801635:	00 
+  801636:	76 17                	jbe    80164f <memcpy_fwd+0xc1>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  801638:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80163c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801640:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801644:	48 89 c7             	mov    %rax,%rdi
+  801647:	48 89 d6             	mov    %rdx,%rsi
+  80164a:	fc                   	cld
+  80164b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80164d:	eb 4d                	jmp    80169c <memcpy_fwd+0x10e>
+					 : "cc", "memory");
+	else if ((((uint64_t)dst | (uint64_t)src | n) & 7) == 0)
+  80164f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801653:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801657:	48 09 d0             	or     %rdx,%rax
+  80165a:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  80165e:	83 e0 07             	and    $0x7,%eax
+  801661:	48 85 c0             	test   %rax,%rax
+  801664:	75 1f                	jne    801685 <memcpy_fwd+0xf7>
+		asm volatile("cld; rep movsq\n" ::"D"(dst), "S"(src), "c"(n / 8)
+  801666:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80166a:	48 c1 e8 03          	shr    $0x3,%rax
+  80166e:	48 89 c1             	mov    %rax,%rcx
+  801671:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801675:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801679:	48 89 c7             	mov    %rax,%rdi
+  80167c:	48 89 d6             	mov    %rdx,%rsi
+  80167f:	fc                   	cld
+  801680:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+					 : "cc", "memory");
+}
+  801683:	eb 17                	jmp    80169c <memcpy_fwd+0x10e>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  801685:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801689:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80168d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801691:	48 89 c7             	mov    %rax,%rdi
+  801694:	48 89 d6             	mov    %rdx,%rsi
+  801697:	fc                   	cld
+  801698:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+  80169a:	eb 00                	jmp    80169c <memcpy_fwd+0x10e>
+  80169c:	90                   	nop
+  80169d:	c9                   	leave
+  80169e:	c3                   	ret
+
+000000000080169f <memset>:
+
+void *
+memset(void *v, int c, size_t n)
+{
+  80169f:	55                   	push   %rbp
+  8016a0:	48 89 e5             	mov    %rsp,%rbp
+  8016a3:	48 83 ec 28          	sub    $0x28,%rsp
+  8016a7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016ab:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8016ae:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t pattern;
+
+	if (n == 0)
+  8016b2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016b7:	75 09                	jne    8016c2 <memset+0x23>
+		return v;
+  8016b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016bd:	e9 dc 00 00 00       	jmp    80179e <memset+0xff>
+	c &= 0xFF;
+  8016c2:	81 65 e4 ff 00 00 00 	andl   $0xff,-0x1c(%rbp)
+	pattern = (uint64_t)c * 0x0101010101010101UL;
+  8016c9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8016cc:	48 98                	cltq
+  8016ce:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8016d5:	01 01 01 
+  8016d8:	48 0f af c2          	imul   %rdx,%rax
+  8016dc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)v | n) & 31) == 0)
+  8016e0:	48 b8 28 40 c0 00 00 	movabs $0xc04028,%rax
+  8016e7:	00 00 00 
+  8016ea:	8b 00                	mov    (%rax),%eax
+  8016ec:	83 e0 02             	and    $0x2,%eax
+  8016ef:	85 c0                	test   %eax,%eax
+  8016f1:	74 3a                	je     80172d <memset+0x8e>
+  8016f3:	48 81 7d d8 ff 0f 00 	cmpq   $0xfff,-0x28(%rbp)
+  8016fa:	00 
+  8016fb:	76 30                	jbe    80172d <memset+0x8e>
+  8016fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801701:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  801705:	83 e0 1f             	and    $0x1f,%eax
+  801708:	48 85 c0             	test   %rax,%rax
+  80170b:	75 20                	jne    80172d <memset+0x8e>
+		memset_nt(v, pattern, n);
+  80170d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801711:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801715:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801719:	48 89 ce             	mov    %rcx,%rsi
+  80171c:	48 89 c7             	mov    %rax,%rdi
+  80171f:	48 b8 9a 14 80 00 00 	movabs $0x80149a,%rax
+  801726:	00 00 00 
+  801729:	ff d0                	call   *%rax
+  80172b:	eb 6d                	jmp    80179a <memset+0xfb>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  80172d:	48 b8 28 40 c0 00 00 	movabs $0xc04028,%rax
+  801734:	00 00 00 
+  801737:	8b 00                	mov    (%rax),%eax
+  801739:	83 e0 01             	and    $0x1,%eax
+  80173c:	85 c0                	test   %eax,%eax
+  80173e:	74 1d                	je     80175d <memset+0xbe>
+  801740:	48 81 7d d8 ff 00 00 	cmpq   $0xff,-0x28(%rbp)
+  801747:	00 
+  801748:	76 13                	jbe    80175d <memset+0xbe>
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  80174a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80174e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801751:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801755:	48 89 d7             	mov    %rdx,%rdi
+  801758:	fc                   	cld
+  801759:	f3 aa                	rep stos %al,%es:(%rdi)
+  80175b:	eb 3d                	jmp    80179a <memset+0xfb>
+					 : "cc", "memory");
+	else if ((((uint64_t)v | n) & 7) == 0)
+  80175d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801761:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  801765:	83 e0 07             	and    $0x7,%eax
+  801768:	48 85 c0             	test   %rax,%rax
+  80176b:	75 1c                	jne    801789 <memset+0xea>
+		asm volatile("cld; rep stosq\n" ::"D"(v), "a"(pattern), "c"(n / 8)
+  80176d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801771:	48 c1 e8 03          	shr    $0x3,%rax
+  801775:	48 89 c1             	mov    %rax,%rcx
+  801778:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80177c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801780:	48 89 d7             	mov    %rdx,%rdi
+  801783:	fc                   	cld
+  801784:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801787:	eb 11                	jmp    80179a <memset+0xfb>
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  801789:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80178d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801790:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801794:	48 89 d7             	mov    %rdx,%rdi
+  801797:	fc                   	cld
+  801798:	f3 aa                	rep stos %al,%es:(%rdi)
+					 : "cc", "memory");
+	return v;
+  80179a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80179e:	c9                   	leave
+  80179f:	c3                   	ret
+
+00000000008017a0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8017a0:	55                   	push   %rbp
+  8017a1:	48 89 e5             	mov    %rsp,%rbp
+  8017a4:	48 83 ec 28          	sub    $0x28,%rsp
+  8017a8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017ac:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8017b0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  8017b4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017b8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8017bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017c0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d)
+  8017c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017c8:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8017cc:	73 7c                	jae    80184a <memmove+0xaa>
+  8017ce:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017d2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017d6:	48 01 d0             	add    %rdx,%rax
+  8017d9:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8017dd:	73 6b                	jae    80184a <memmove+0xaa>
+	{
+		// 重叠且 dst 在 src 之后，只能反向复制(ERMS 对反向 rep movsb 没有优化)
+		s += n;
+  8017df:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017e3:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  8017e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017eb:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((((uint64_t)s | (uint64_t)d | n) & 7) == 0)
+  8017ef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017f7:	48 09 d0             	or     %rdx,%rax
+  8017fa:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  8017fe:	83 e0 07             	and    $0x7,%eax
+  801801:	48 85 c0             	test   %rax,%rax
+  801804:	75 24                	jne    80182a <memmove+0x8a>
+			asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801806:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80180a:	48 83 e8 08          	sub    $0x8,%rax
+  80180e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801812:	48 83 ea 08          	sub    $0x8,%rdx
+  801816:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80181a:	48 c1 e9 03          	shr    $0x3,%rcx
+  80181e:	48 89 c7             	mov    %rax,%rdi
+  801821:	48 89 d6             	mov    %rdx,%rsi
+  801824:	fd                   	std
+  801825:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801828:	eb 1d                	jmp    801847 <memmove+0xa7>
+						 : "cc", "memory");
+		else
+			asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80182a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80182e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801832:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801836:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+  80183a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80183e:	48 89 d7             	mov    %rdx,%rdi
+  801841:	48 89 c1             	mov    %rax,%rcx
+  801844:	fd                   	std
+  801845:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+						 : "cc", "memory");
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::
+  801847:	fc                   	cld
+  801848:	eb 25                	jmp    80186f <memmove+0xcf>
+						 : "cc");
+	}
+	else if (n)
+  80184a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80184f:	74 1e                	je     80186f <memmove+0xcf>
+		memcpy_fwd(d, s, n);
+  801851:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801855:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801859:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80185d:	48 89 ce             	mov    %rcx,%rsi
+  801860:	48 89 c7             	mov    %rax,%rdi
+  801863:	48 b8 8e 15 80 00 00 	movabs $0x80158e,%rax
+  80186a:	00 00 00 
+  80186d:	ff d0                	call   *%rax
+	return dst;
+  80186f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801873:	c9                   	leave
+  801874:	c3                   	ret
+
+0000000000801875 <memcpy>:
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801875:	55                   	push   %rbp
+  801876:	48 89 e5             	mov    %rsp,%rbp
+  801879:	48 83 ec 18          	sub    $0x18,%rsp
+  80187d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801881:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801885:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (n)
+  801889:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80188e:	74 1e                	je     8018ae <memcpy+0x39>
+		memcpy_fwd(dst, src, n);
+  801890:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801894:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801898:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80189c:	48 89 ce             	mov    %rcx,%rsi
+  80189f:	48 89 c7             	mov    %rax,%rdi
+  8018a2:	48 b8 8e 15 80 00 00 	movabs $0x80158e,%rax
+  8018a9:	00 00 00 
+  8018ac:	ff d0                	call   *%rax
+	return dst;
+  8018ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8018b2:	c9                   	leave
+  8018b3:	c3                   	ret
+
+00000000008018b4 <memcmp>:
+{
+}
+#endif
+
+int memcmp(const void *v1, const void *v2, size_t n)
+{
+  8018b4:	55                   	push   %rbp
+  8018b5:	48 89 e5             	mov    %rsp,%rbp
+  8018b8:	48 83 ec 28          	sub    $0x28,%rsp
+  8018bc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8018c0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8018c4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *)v1;
+  8018c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018cc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *)v2;
+  8018d0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8018d4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0)
+  8018d8:	eb 34                	jmp    80190e <memcmp+0x5a>
+	{
+		if (*s1 != *s2)
+  8018da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018de:	0f b6 10             	movzbl (%rax),%edx
+  8018e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018e5:	0f b6 00             	movzbl (%rax),%eax
+  8018e8:	38 c2                	cmp    %al,%dl
+  8018ea:	74 18                	je     801904 <memcmp+0x50>
+			return (int)*s1 - (int)*s2;
+  8018ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018f0:	0f b6 00             	movzbl (%rax),%eax
+  8018f3:	0f b6 d0             	movzbl %al,%edx
+  8018f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018fa:	0f b6 00             	movzbl (%rax),%eax
+  8018fd:	0f b6 c0             	movzbl %al,%eax
+  801900:	29 c2                	sub    %eax,%edx
+  801902:	eb 20                	jmp    801924 <memcmp+0x70>
+		s1++, s2++;
+  801904:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801909:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0)
+  80190e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801912:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801916:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80191a:	48 85 c0             	test   %rax,%rax
+  80191d:	75 bb                	jne    8018da <memcmp+0x26>
+	}
+
+	return 0;
+  80191f:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801924:	89 d0                	mov    %edx,%eax
+  801926:	c9                   	leave
+  801927:	c3                   	ret
+
+0000000000801928 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801928:	55                   	push   %rbp
+  801929:	48 89 e5             	mov    %rsp,%rbp
+  80192c:	48 83 ec 28          	sub    $0x28,%rsp
+  801930:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801934:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801937:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *)s + n;
+  80193b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80193f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801943:	48 01 d0             	add    %rdx,%rax
+  801946:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  80194a:	eb 13                	jmp    80195f <memfind+0x37>
+		if (*(const unsigned char *)s == (unsigned char)c)
+  80194c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801950:	0f b6 00             	movzbl (%rax),%eax
+  801953:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801956:	38 d0                	cmp    %dl,%al
+  801958:	74 11                	je     80196b <memfind+0x43>
+	for (; s < ends; s++)
+  80195a:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80195f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801963:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801967:	72 e3                	jb     80194c <memfind+0x24>
+  801969:	eb 01                	jmp    80196c <memfind+0x44>
+			break;
+  80196b:	90                   	nop
+	return (void *)s;
+  80196c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801970:	c9                   	leave
+  801971:	c3                   	ret
+
+0000000000801972 <strtol>:
+
+long strtol(const char *s, char **endptr, int base)
+{
+  801972:	55                   	push   %rbp
+  801973:	48 89 e5             	mov    %rsp,%rbp
+  801976:	48 83 ec 38          	sub    $0x38,%rsp
+  80197a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80197e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801982:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801985:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  80198c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801993:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801994:	eb 05                	jmp    80199b <strtol+0x29>
+		s++;
+  801996:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  80199b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80199f:	0f b6 00             	movzbl (%rax),%eax
+  8019a2:	3c 20                	cmp    $0x20,%al
+  8019a4:	74 f0                	je     801996 <strtol+0x24>
+  8019a6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019aa:	0f b6 00             	movzbl (%rax),%eax
+  8019ad:	3c 09                	cmp    $0x9,%al
+  8019af:	74 e5                	je     801996 <strtol+0x24>
+
+	// plus/minus sign
+	if (*s == '+')
+  8019b1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019b5:	0f b6 00             	movzbl (%rax),%eax
+  8019b8:	3c 2b                	cmp    $0x2b,%al
+  8019ba:	75 07                	jne    8019c3 <strtol+0x51>
+		s++;
+  8019bc:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8019c1:	eb 17                	jmp    8019da <strtol+0x68>
+	else if (*s == '-')
+  8019c3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019c7:	0f b6 00             	movzbl (%rax),%eax
+  8019ca:	3c 2d                	cmp    $0x2d,%al
+  8019cc:	75 0c                	jne    8019da <strtol+0x68>
+		s++, neg = 1;
+  8019ce:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8019d3:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8019da:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8019de:	74 06                	je     8019e6 <strtol+0x74>
+  8019e0:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  8019e4:	75 28                	jne    801a0e <strtol+0x9c>
+  8019e6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019ea:	0f b6 00             	movzbl (%rax),%eax
+  8019ed:	3c 30                	cmp    $0x30,%al
+  8019ef:	75 1d                	jne    801a0e <strtol+0x9c>
+  8019f1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019f5:	48 83 c0 01          	add    $0x1,%rax
+  8019f9:	0f b6 00             	movzbl (%rax),%eax
+  8019fc:	3c 78                	cmp    $0x78,%al
+  8019fe:	75 0e                	jne    801a0e <strtol+0x9c>
+		s += 2, base = 16;
+  801a00:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801a05:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801a0c:	eb 2c                	jmp    801a3a <strtol+0xc8>
+	else if (base == 0 && s[0] == '0')
+  801a0e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801a12:	75 19                	jne    801a2d <strtol+0xbb>
+  801a14:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a18:	0f b6 00             	movzbl (%rax),%eax
+  801a1b:	3c 30                	cmp    $0x30,%al
+  801a1d:	75 0e                	jne    801a2d <strtol+0xbb>
+		s++, base = 8;
+  801a1f:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a24:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801a2b:	eb 0d                	jmp    801a3a <strtol+0xc8>
+	else if (base == 0)
+  801a2d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801a31:	75 07                	jne    801a3a <strtol+0xc8>
+		base = 10;
+  801a33:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+	// digits
+	while (1)
+	{
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801a3a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a3e:	0f b6 00             	movzbl (%rax),%eax
+  801a41:	3c 2f                	cmp    $0x2f,%al
+  801a43:	7e 1d                	jle    801a62 <strtol+0xf0>
+  801a45:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a49:	0f b6 00             	movzbl (%rax),%eax
+  801a4c:	3c 39                	cmp    $0x39,%al
+  801a4e:	7f 12                	jg     801a62 <strtol+0xf0>
+			dig = *s - '0';
+  801a50:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a54:	0f b6 00             	movzbl (%rax),%eax
+  801a57:	0f be c0             	movsbl %al,%eax
+  801a5a:	83 e8 30             	sub    $0x30,%eax
+  801a5d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801a60:	eb 4e                	jmp    801ab0 <strtol+0x13e>
+		else if (*s >= 'a' && *s <= 'z')
+  801a62:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a66:	0f b6 00             	movzbl (%rax),%eax
+  801a69:	3c 60                	cmp    $0x60,%al
+  801a6b:	7e 1d                	jle    801a8a <strtol+0x118>
+  801a6d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a71:	0f b6 00             	movzbl (%rax),%eax
+  801a74:	3c 7a                	cmp    $0x7a,%al
+  801a76:	7f 12                	jg     801a8a <strtol+0x118>
+			dig = *s - 'a' + 10;
+  801a78:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a7c:	0f b6 00             	movzbl (%rax),%eax
+  801a7f:	0f be c0             	movsbl %al,%eax
+  801a82:	83 e8 57             	sub    $0x57,%eax
+  801a85:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801a88:	eb 26                	jmp    801ab0 <strtol+0x13e>
+		else if (*s >= 'A' && *s <= 'Z')
+  801a8a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a8e:	0f b6 00             	movzbl (%rax),%eax
+  801a91:	3c 40                	cmp    $0x40,%al
+  801a93:	7e 47                	jle    801adc <strtol+0x16a>
+  801a95:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a99:	0f b6 00             	movzbl (%rax),%eax
+  801a9c:	3c 5a                	cmp    $0x5a,%al
+  801a9e:	7f 3c                	jg     801adc <strtol+0x16a>
+			dig = *s - 'A' + 10;
+  801aa0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aa4:	0f b6 00             	movzbl (%rax),%eax
+  801aa7:	0f be c0             	movsbl %al,%eax
+  801aaa:	83 e8 37             	sub    $0x37,%eax
+  801aad:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801ab0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ab3:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801ab6:	7d 23                	jge    801adb <strtol+0x169>
+			break;
+		s++, val = (val * base) + dig;
+  801ab8:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801abd:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801ac0:	48 98                	cltq
+  801ac2:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801ac7:	48 89 c2             	mov    %rax,%rdx
+  801aca:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801acd:	48 98                	cltq
+  801acf:	48 01 d0             	add    %rdx,%rax
+  801ad2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+  801ad6:	e9 5f ff ff ff       	jmp    801a3a <strtol+0xc8>
+			break;
+  801adb:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801adc:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801ae1:	74 0b                	je     801aee <strtol+0x17c>
+		*endptr = (char *)s;
+  801ae3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ae7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801aeb:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801aee:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801af2:	74 09                	je     801afd <strtol+0x18b>
+  801af4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801af8:	48 f7 d8             	neg    %rax
+  801afb:	eb 04                	jmp    801b01 <strtol+0x18f>
+  801afd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801b01:	c9                   	leave
+  801b02:	c3                   	ret
+
+0000000000801b03 <strstr>:
+
+char *strstr(const char *in, const char *str)
+{
+  801b03:	55                   	push   %rbp
+  801b04:	48 89 e5             	mov    %rsp,%rbp
+  801b07:	48 83 ec 30          	sub    $0x30,%rsp
+  801b0b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b0f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801b13:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b17:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b1b:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801b1f:	0f b6 00             	movzbl (%rax),%eax
+  801b22:	88 45 ff             	mov    %al,-0x1(%rbp)
+	if (!c)
+  801b25:	80 7d ff 00          	cmpb   $0x0,-0x1(%rbp)
+  801b29:	75 06                	jne    801b31 <strstr+0x2e>
+		return (char *)in; // Trivial empty string case
+  801b2b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b2f:	eb 6b                	jmp    801b9c <strstr+0x99>
+
+	len = strlen(str);
+  801b31:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b35:	48 89 c7             	mov    %rax,%rdi
+  801b38:	48 b8 a8 10 80 00 00 	movabs $0x8010a8,%rax
+  801b3f:	00 00 00 
+  801b42:	ff d0                	call   *%rax
+  801b44:	48 98                	cltq
+  801b46:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+		char sc;
+
+		do
+		{
+			sc = *in++;
+  801b4a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b4e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b52:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801b56:	0f b6 00             	movzbl (%rax),%eax
+  801b59:	88 45 ef             	mov    %al,-0x11(%rbp)
+			if (!sc)
+  801b5c:	80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+  801b60:	75 07                	jne    801b69 <strstr+0x66>
+				return (char *)0;
+  801b62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b67:	eb 33                	jmp    801b9c <strstr+0x99>
+		} while (sc != c);
+  801b69:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+  801b6d:	3a 45 ff             	cmp    -0x1(%rbp),%al
+  801b70:	75 d8                	jne    801b4a <strstr+0x47>
+	} while (strncmp(in, str, len) != 0);
+  801b72:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801b76:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801b7a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b7e:	48 89 ce             	mov    %rcx,%rsi
+  801b81:	48 89 c7             	mov    %rax,%rdi
+  801b84:	48 b8 c3 12 80 00 00 	movabs $0x8012c3,%rax
+  801b8b:	00 00 00 
+  801b8e:	ff d0                	call   *%rax
+  801b90:	85 c0                	test   %eax,%eax
+  801b92:	75 b6                	jne    801b4a <strstr+0x47>
+
+	return (char *)(in - 1);
+  801b94:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b98:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801b9c:	c9                   	leave
+  801b9d:	c3                   	ret
+
+0000000000801b9e <syscall>:
+ * 用户的指令式系统调用，该函数将系统调用序号放入eax寄存器，五个参数依次放入edx, ecx, ebx, edi, esi，然后执行指令int 0x30，
+ * 发生中断后，去IDT中查找中断处理函数，最终会走到kern/trap.c的trap_dispatch()中
+ */
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801b9e:	55                   	push   %rbp
+  801b9f:	48 89 e5             	mov    %rsp,%rbp
+  801ba2:	53                   	push   %rbx
+  801ba3:	48 83 ec 48          	sub    $0x48,%rsp
+  801ba7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801baa:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801bad:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801bb1:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801bb5:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801bb9:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	 * volatile 告诉汇编程序不要因为不使用返回值就优化该指令
+	 * 最后一个子句告诉汇编程序，指令可能会改变条件代码cx和任意内存memory位置
+	 * 由汇编编译器做好数据保存和恢复工作(栈)
+	 */
+
+	asm volatile("int %1\n"			// code: int T_SYSCALL
+  801bbd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801bc0:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801bc4:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801bc8:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801bcc:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801bd0:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801bd4:	4c 89 c3             	mov    %r8,%rbx
+  801bd7:	cd 30                	int    $0x30
+  801bd9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+				   "D"(a4),			// edi = a4
+				   "S"(a5)			// esi = a5
+				 : "cc", "memory"); // 指令可能会改变条件代码cx和任意内存memory位置
+									// 由汇编编译器做好数据保存和恢复工作(栈)
+
+	if (check && ret > 0)
+  801bdd:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801be1:	74 44                	je     801c27 <syscall+0x89>
+  801be3:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801be8:	7e 3d                	jle    801c27 <syscall+0x89>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801bea:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801bee:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801bf1:	49 89 d0             	mov    %rdx,%r8
+  801bf4:	89 c1                	mov    %eax,%ecx
+  801bf6:	48 b8 28 29 80 00 00 	movabs $0x802928,%rax
+  801bfd:	00 00 00 
+  801c00:	48 89 c2             	mov    %rax,%rdx
+  801c03:	be 34 00 00 00       	mov    $0x34,%esi
+  801c08:	48 b8 45 29 80 00 00 	movabs $0x802945,%rax
+  801c0f:	00 00 00 
+  801c12:	48 89 c7             	mov    %rax,%rdi
+  801c15:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c1a:	49 b9 4a 02 80 00 00 	movabs $0x80024a,%r9
+  801c21:	00 00 00 
+  801c24:	41 ff d1             	call   *%r9
+
+	return ret;
+  801c27:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801c2b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c2f:	c9                   	leave
+  801c30:	c3                   	ret
+
+0000000000801c31 <sys_cputs>:
+
+void sys_cputs(const char *s, size_t len)
+{
+  801c31:	55                   	push   %rbp
+  801c32:	48 89 e5             	mov    %rsp,%rbp
+  801c35:	48 83 ec 10          	sub    $0x10,%rsp
+  801c39:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801c3d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 调用lib/syscall.c中的syscall()
+	// SYS_cputs: 系统调用序号(eax)，s: 需要输出的字符数组，len: 数组长度
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801c41:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c45:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c49:	48 83 ec 08          	sub    $0x8,%rsp
+  801c4d:	6a 00                	push   $0x0
+  801c4f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801c55:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c5b:	48 89 d1             	mov    %rdx,%rcx
+  801c5e:	48 89 c2             	mov    %rax,%rdx
+  801c61:	be 00 00 00 00       	mov    $0x0,%esi
+  801c66:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c6b:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  801c72:	00 00 00 
+  801c75:	ff d0                	call   *%rax
+  801c77:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c7b:	90                   	nop
+  801c7c:	c9                   	leave
+  801c7d:	c3                   	ret
+
+0000000000801c7e <sys_cgetc>:
+
+int sys_cgetc(void)
+{
+  801c7e:	55                   	push   %rbp
+  801c7f:	48 89 e5             	mov    %rsp,%rbp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801c82:	48 83 ec 08          	sub    $0x8,%rsp
+  801c86:	6a 00                	push   $0x0
+  801c88:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801c8e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c94:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c99:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c9e:	be 00 00 00 00       	mov    $0x0,%esi
+  801ca3:	bf 01 00 00 00       	mov    $0x1,%edi
+  801ca8:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  801caf:	00 00 00 
+  801cb2:	ff d0                	call   *%rax
+  801cb4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801cb8:	c9                   	leave
+  801cb9:	c3                   	ret
+
+0000000000801cba <sys_env_destroy>:
+
+int sys_env_destroy(envid_t envid)
+{
+  801cba:	55                   	push   %rbp
+  801cbb:	48 89 e5             	mov    %rsp,%rbp
+  801cbe:	48 83 ec 10          	sub    $0x10,%rsp
+  801cc2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	// 销毁envid对应的环境
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801cc5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801cc8:	48 98                	cltq
+  801cca:	48 83 ec 08          	sub    $0x8,%rsp
+  801cce:	6a 00                	push   $0x0
+  801cd0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801cd6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801cdc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ce1:	48 89 c2             	mov    %rax,%rdx
+  801ce4:	be 01 00 00 00       	mov    $0x1,%esi
+  801ce9:	bf 03 00 00 00       	mov    $0x3,%edi
+  801cee:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  801cf5:	00 00 00 
+  801cf8:	ff d0                	call   *%rax
+  801cfa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801cfe:	c9                   	leave
+  801cff:	c3                   	ret
+
+0000000000801d00 <sys_getprocid>:
+
+envid_t
+sys_getprocid(void)
+{
+  801d00:	55                   	push   %rbp
+  801d01:	48 89 e5             	mov    %rsp,%rbp
+	// 获取当前用户环境id
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801d04:	48 83 ec 08          	sub    $0x8,%rsp
+  801d08:	6a 00                	push   $0x0
+  801d0a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d10:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d16:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d20:	be 00 00 00 00       	mov    $0x0,%esi
+  801d25:	bf 02 00 00 00       	mov    $0x2,%edi
+  801d2a:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  801d31:	00 00 00 
+  801d34:	ff d0                	call   *%rax
+  801d36:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d3a:	c9                   	leave
+  801d3b:	c3                   	ret
+
+0000000000801d3c <sys_yield>:
+
+void sys_yield(void)
+{
+  801d3c:	55                   	push   %rbp
+  801d3d:	48 89 e5             	mov    %rsp,%rbp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801d40:	48 83 ec 08          	sub    $0x8,%rsp
+  801d44:	6a 00                	push   $0x0
+  801d46:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d4c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d52:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d57:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d5c:	be 00 00 00 00       	mov    $0x0,%esi
+  801d61:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801d66:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  801d6d:	00 00 00 
+  801d70:	ff d0                	call   *%rax
+  801d72:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d76:	90                   	nop
+  801d77:	c9                   	leave
+  801d78:	c3                   	ret
+
+0000000000801d79 <sys_page_alloc>:
+
+int sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801d79:	55                   	push   %rbp
+  801d7a:	48 89 e5             	mov    %rsp,%rbp
+  801d7d:	48 83 ec 10          	sub    $0x10,%rsp
+  801d81:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801d84:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801d88:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  801d8b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801d8e:	48 63 c8             	movslq %eax,%rcx
+  801d91:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d95:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d98:	48 98                	cltq
+  801d9a:	48 83 ec 08          	sub    $0x8,%rsp
+  801d9e:	6a 00                	push   $0x0
+  801da0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801da6:	49 89 c8             	mov    %rcx,%r8
+  801da9:	48 89 d1             	mov    %rdx,%rcx
+  801dac:	48 89 c2             	mov    %rax,%rdx
+  801daf:	be 01 00 00 00       	mov    $0x1,%esi
+  801db4:	bf 04 00 00 00       	mov    $0x4,%edi
+  801db9:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  801dc0:	00 00 00 
+  801dc3:	ff d0                	call   *%rax
+  801dc5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801dc9:	c9                   	leave
+  801dca:	c3                   	ret
+
+0000000000801dcb <sys_page_map>:
+
+int sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801dcb:	55                   	push   %rbp
+  801dcc:	48 89 e5             	mov    %rsp,%rbp
+  801dcf:	48 83 ec 20          	sub    $0x20,%rsp
+  801dd3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801dd6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801dda:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801ddd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801de1:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  801de5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801de8:	48 63 c8             	movslq %eax,%rcx
+  801deb:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  801def:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801df2:	48 63 f0             	movslq %eax,%rsi
+  801df5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801df9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801dfc:	48 98                	cltq
+  801dfe:	48 83 ec 08          	sub    $0x8,%rsp
+  801e02:	51                   	push   %rcx
+  801e03:	49 89 f9             	mov    %rdi,%r9
+  801e06:	49 89 f0             	mov    %rsi,%r8
+  801e09:	48 89 d1             	mov    %rdx,%rcx
+  801e0c:	48 89 c2             	mov    %rax,%rdx
+  801e0f:	be 01 00 00 00       	mov    $0x1,%esi
+  801e14:	bf 05 00 00 00       	mov    $0x5,%edi
+  801e19:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  801e20:	00 00 00 
+  801e23:	ff d0                	call   *%rax
+  801e25:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e29:	c9                   	leave
+  801e2a:	c3                   	ret
+
+0000000000801e2b <sys_page_unmap>:
+
+int sys_page_unmap(envid_t envid, void *va)
+{
+  801e2b:	55                   	push   %rbp
+  801e2c:	48 89 e5             	mov    %rsp,%rbp
+  801e2f:	48 83 ec 10          	sub    $0x10,%rsp
+  801e33:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e36:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  801e3a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e3e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e41:	48 98                	cltq
+  801e43:	48 83 ec 08          	sub    $0x8,%rsp
+  801e47:	6a 00                	push   $0x0
+  801e49:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e4f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e55:	48 89 d1             	mov    %rdx,%rcx
+  801e58:	48 89 c2             	mov    %rax,%rdx
+  801e5b:	be 01 00 00 00       	mov    $0x1,%esi
+  801e60:	bf 06 00 00 00       	mov    $0x6,%edi
+  801e65:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  801e6c:	00 00 00 
+  801e6f:	ff d0                	call   *%rax
+  801e71:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e75:	c9                   	leave
+  801e76:	c3                   	ret
+
+0000000000801e77 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int sys_env_set_status(envid_t envid, int status)
+{
+  801e77:	55                   	push   %rbp
+  801e78:	48 89 e5             	mov    %rsp,%rbp
+  801e7b:	48 83 ec 10          	sub    $0x10,%rsp
+  801e7f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e82:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801e85:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801e88:	48 63 d0             	movslq %eax,%rdx
+  801e8b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e8e:	48 98                	cltq
+  801e90:	48 83 ec 08          	sub    $0x8,%rsp
+  801e94:	6a 00                	push   $0x0
+  801e96:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e9c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ea2:	48 89 d1             	mov    %rdx,%rcx
+  801ea5:	48 89 c2             	mov    %rax,%rdx
+  801ea8:	be 01 00 00 00       	mov    $0x1,%esi
+  801ead:	bf 08 00 00 00       	mov    $0x8,%edi
+  801eb2:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  801eb9:	00 00 00 
+  801ebc:	ff d0                	call   *%rax
+  801ebe:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ec2:	c9                   	leave
+  801ec3:	c3                   	ret
+
+0000000000801ec4 <sys_env_set_trapframe>:
+
+int sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801ec4:	55                   	push   %rbp
+  801ec5:	48 89 e5             	mov    %rsp,%rbp
+  801ec8:	48 83 ec 10          	sub    $0x10,%rsp
+  801ecc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801ecf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  801ed3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801ed7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801eda:	48 98                	cltq
+  801edc:	48 83 ec 08          	sub    $0x8,%rsp
+  801ee0:	6a 00                	push   $0x0
+  801ee2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ee8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801eee:	48 89 d1             	mov    %rdx,%rcx
+  801ef1:	48 89 c2             	mov    %rax,%rdx
+  801ef4:	be 01 00 00 00       	mov    $0x1,%esi
+  801ef9:	bf 09 00 00 00       	mov    $0x9,%edi
+  801efe:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  801f05:	00 00 00 
+  801f08:	ff d0                	call   *%rax
+  801f0a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f0e:	c9                   	leave
+  801f0f:	c3                   	ret
+
+0000000000801f10 <sys_env_set_pgfault_upcall>:
+
+int sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801f10:	55                   	push   %rbp
+  801f11:	48 89 e5             	mov    %rsp,%rbp
+  801f14:	48 83 ec 10          	sub    $0x10,%rsp
+  801f18:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f1b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  801f1f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801f23:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f26:	48 98                	cltq
+  801f28:	48 83 ec 08          	sub    $0x8,%rsp
+  801f2c:	6a 00                	push   $0x0
+  801f2e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f34:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f3a:	48 89 d1             	mov    %rdx,%rcx
+  801f3d:	48 89 c2             	mov    %rax,%rdx
+  801f40:	be 01 00 00 00       	mov    $0x1,%esi
+  801f45:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801f4a:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  801f51:	00 00 00 
+  801f54:	ff d0                	call   *%rax
+  801f56:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f5a:	c9                   	leave
+  801f5b:	c3                   	ret
+
+0000000000801f5c <sys_ipc_try_send>:
+
+int sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  801f5c:	55                   	push   %rbp
+  801f5d:	48 89 e5             	mov    %rsp,%rbp
+  801f60:	48 83 ec 20          	sub    $0x20,%rsp
+  801f64:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f67:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f6b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801f6f:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  801f72:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801f75:	48 63 f0             	movslq %eax,%rsi
+  801f78:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801f7c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f7f:	48 98                	cltq
+  801f81:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801f85:	48 83 ec 08          	sub    $0x8,%rsp
+  801f89:	6a 00                	push   $0x0
+  801f8b:	49 89 f1             	mov    %rsi,%r9
+  801f8e:	49 89 c8             	mov    %rcx,%r8
+  801f91:	48 89 d1             	mov    %rdx,%rcx
+  801f94:	48 89 c2             	mov    %rax,%rdx
+  801f97:	be 00 00 00 00       	mov    $0x0,%esi
+  801f9c:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801fa1:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  801fa8:	00 00 00 
+  801fab:	ff d0                	call   *%rax
+  801fad:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fb1:	c9                   	leave
+  801fb2:	c3                   	ret
+
+0000000000801fb3 <sys_ipc_recv>:
+
+int sys_ipc_recv(void *dstva)
+{
+  801fb3:	55                   	push   %rbp
+  801fb4:	48 89 e5             	mov    %rsp,%rbp
+  801fb7:	48 83 ec 10          	sub    $0x10,%rsp
+  801fbb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  801fbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fc3:	48 83 ec 08          	sub    $0x8,%rsp
+  801fc7:	6a 00                	push   $0x0
+  801fc9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fcf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fd5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fda:	48 89 c2             	mov    %rax,%rdx
+  801fdd:	be 01 00 00 00       	mov    $0x1,%esi
+  801fe2:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801fe7:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  801fee:	00 00 00 
+  801ff1:	ff d0                	call   *%rax
+  801ff3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ff7:	c9                   	leave
+  801ff8:	c3                   	ret
+
+0000000000801ff9 <sys_disk_io>:
+
+int sys_disk_io(int dev, uint64_t secno, void *va, size_t nsecs, int write)
+{
+  801ff9:	55                   	push   %rbp
+  801ffa:	48 89 e5             	mov    %rsp,%rbp
+  801ffd:	48 83 ec 20          	sub    $0x20,%rsp
+  802001:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802004:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802008:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80200c:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802010:	44 89 45 f8          	mov    %r8d,-0x8(%rbp)
+	return syscall(SYS_disk_io, 0, dev, secno, (uint64_t)va, nsecs, write);
+  802014:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802017:	48 63 c8             	movslq %eax,%rcx
+  80201a:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80201e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802021:	48 98                	cltq
+  802023:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802027:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80202b:	48 83 ec 08          	sub    $0x8,%rsp
+  80202f:	51                   	push   %rcx
+  802030:	49 89 f9             	mov    %rdi,%r9
+  802033:	49 89 f0             	mov    %rsi,%r8
+  802036:	48 89 d1             	mov    %rdx,%rcx
+  802039:	48 89 c2             	mov    %rax,%rdx
+  80203c:	be 00 00 00 00       	mov    $0x0,%esi
+  802041:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802046:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  80204d:	00 00 00 
+  802050:	ff d0                	call   *%rax
+  802052:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802056:	c9                   	leave
+  802057:	c3                   	ret
+
+0000000000802058 <sys_vma_alloc>:
+
+int sys_vma_alloc(envid_t envid, void *va, size_t len, int perm)
+{
+  802058:	55                   	push   %rbp
+  802059:	48 89 e5             	mov    %rsp,%rbp
+  80205c:	48 83 ec 20          	sub    $0x20,%rsp
+  802060:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802063:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802067:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80206b:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_vma_alloc, 1, envid, (uint64_t)va, len, perm, 0);
+  80206e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802071:	48 63 f0             	movslq %eax,%rsi
+  802074:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802078:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80207b:	48 98                	cltq
+  80207d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802081:	48 83 ec 08          	sub    $0x8,%rsp
+  802085:	6a 00                	push   $0x0
+  802087:	49 89 f1             	mov    %rsi,%r9
+  80208a:	49 89 c8             	mov    %rcx,%r8
+  80208d:	48 89 d1             	mov    %rdx,%rcx
+  802090:	48 89 c2             	mov    %rax,%rdx
+  802093:	be 01 00 00 00       	mov    $0x1,%esi
+  802098:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80209d:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  8020a4:	00 00 00 
+  8020a7:	ff d0                	call   *%rax
+  8020a9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020ad:	c9                   	leave
+  8020ae:	c3                   	ret
+
+00000000008020af <sys_vma_clear>:
+
+int sys_vma_clear(envid_t envid)
+{
+  8020af:	55                   	push   %rbp
+  8020b0:	48 89 e5             	mov    %rsp,%rbp
+  8020b3:	48 83 ec 10          	sub    $0x10,%rsp
+  8020b7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_vma_clear, 1, envid, 0, 0, 0, 0);
+  8020ba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020bd:	48 98                	cltq
+  8020bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8020c3:	6a 00                	push   $0x0
+  8020c5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020d6:	48 89 c2             	mov    %rax,%rdx
+  8020d9:	be 01 00 00 00       	mov    $0x1,%esi
+  8020de:	bf 10 00 00 00       	mov    $0x10,%edi
+  8020e3:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  8020ea:	00 00 00 
+  8020ed:	ff d0                	call   *%rax
+  8020ef:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020f3:	c9                   	leave
+  8020f4:	c3                   	ret
+
+00000000008020f5 <sys_trace_ctl>:
+
+int sys_trace_ctl(int enable)
+{
+  8020f5:	55                   	push   %rbp
+  8020f6:	48 89 e5             	mov    %rsp,%rbp
+  8020f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8020fd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_trace_ctl, 0, enable, 0, 0, 0, 0);
+  802100:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802103:	48 98                	cltq
+  802105:	48 83 ec 08          	sub    $0x8,%rsp
+  802109:	6a 00                	push   $0x0
+  80210b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802111:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802117:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80211c:	48 89 c2             	mov    %rax,%rdx
+  80211f:	be 00 00 00 00       	mov    $0x0,%esi
+  802124:	bf 11 00 00 00       	mov    $0x11,%edi
+  802129:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  802130:	00 00 00 
+  802133:	ff d0                	call   *%rax
+  802135:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802139:	c9                   	leave
+  80213a:	c3                   	ret
+
+000000000080213b <sys_trace_read>:
+
+int sys_trace_read(int cpu, uint64_t *seq, struct TraceEvent *buf, int n)
+{
+  80213b:	55                   	push   %rbp
+  80213c:	48 89 e5             	mov    %rsp,%rbp
+  80213f:	48 83 ec 20          	sub    $0x20,%rsp
+  802143:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802146:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80214a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80214e:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_trace_read, 0, cpu, (uint64_t)seq, (uint64_t)buf, n, 0);
+  802151:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802154:	48 63 f0             	movslq %eax,%rsi
+  802157:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80215b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80215f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802162:	48 98                	cltq
+  802164:	48 83 ec 08          	sub    $0x8,%rsp
+  802168:	6a 00                	push   $0x0
+  80216a:	49 89 f1             	mov    %rsi,%r9
+  80216d:	49 89 c8             	mov    %rcx,%r8
+  802170:	48 89 d1             	mov    %rdx,%rcx
+  802173:	48 89 c2             	mov    %rax,%rdx
+  802176:	be 00 00 00 00       	mov    $0x0,%esi
+  80217b:	bf 12 00 00 00       	mov    $0x12,%edi
+  802180:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  802187:	00 00 00 
+  80218a:	ff d0                	call   *%rax
+  80218c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802190:	c9                   	leave
+  802191:	c3                   	ret
+
+0000000000802192 <sys_getrusage>:
+
+int sys_getrusage(envid_t envid, struct Rusage *ru)
+{
+  802192:	55                   	push   %rbp
+  802193:	48 89 e5             	mov    %rsp,%rbp
+  802196:	48 83 ec 10          	sub    $0x10,%rsp
+  80219a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80219d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_getrusage, 0, envid, (uint64_t)ru, 0, 0, 0);
+  8021a1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021a5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021a8:	48 98                	cltq
+  8021aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8021ae:	6a 00                	push   $0x0
+  8021b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021bc:	48 89 d1             	mov    %rdx,%rcx
+  8021bf:	48 89 c2             	mov    %rax,%rdx
+  8021c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c7:	bf 13 00 00 00       	mov    $0x13,%edi
+  8021cc:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  8021d3:	00 00 00 
+  8021d6:	ff d0                	call   *%rax
+  8021d8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021dc:	c9                   	leave
+  8021dd:	c3                   	ret
+
+00000000008021de <sys_pmu_config>:
+
+int sys_pmu_config(int idx, uint64_t event)
+{
+  8021de:	55                   	push   %rbp
+  8021df:	48 89 e5             	mov    %rsp,%rbp
+  8021e2:	48 83 ec 10          	sub    $0x10,%rsp
+  8021e6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021e9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_pmu_config, 0, idx, event, 0, 0, 0);
+  8021ed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021f0:	48 98                	cltq
+  8021f2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8021fa:	6a 00                	push   $0x0
+  8021fc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802202:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802208:	48 89 d1             	mov    %rdx,%rcx
+  80220b:	48 89 c2             	mov    %rax,%rdx
+  80220e:	be 00 00 00 00       	mov    $0x0,%esi
+  802213:	bf 14 00 00 00       	mov    $0x14,%edi
+  802218:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  80221f:	00 00 00 
+  802222:	ff d0                	call   *%rax
+  802224:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802228:	c9                   	leave
+  802229:	c3                   	ret
+
+000000000080222a <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  80222a:	55                   	push   %rbp
+  80222b:	48 89 e5             	mov    %rsp,%rbp
+  80222e:	48 83 ec 10          	sub    $0x10,%rsp
+  802232:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+  802235:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802238:	48 83 ec 08          	sub    $0x8,%rsp
+  80223c:	6a 00                	push   $0x0
+  80223e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802244:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80224a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80224f:	48 89 c2             	mov    %rax,%rdx
+  802252:	be 00 00 00 00       	mov    $0x0,%esi
+  802257:	bf 15 00 00 00       	mov    $0x15,%edi
+  80225c:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  802263:	00 00 00 
+  802266:	ff d0                	call   *%rax
+  802268:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80226c:	c9                   	leave
+  80226d:	c3                   	ret
+
+000000000080226e <sys_image_attach>:
+
+int sys_image_attach(envid_t envid, int dev, const uint64_t *secnos, size_t size)
+{
+  80226e:	55                   	push   %rbp
+  80226f:	48 89 e5             	mov    %rsp,%rbp
+  802272:	48 83 ec 20          	sub    $0x20,%rsp
+  802276:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802279:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  80227c:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  802280:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+	return syscall(SYS_image_attach, 1, envid, dev, (uint64_t)secnos, size, 0);
+  802284:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802288:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80228b:	48 63 d0             	movslq %eax,%rdx
+  80228e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802291:	48 98                	cltq
+  802293:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802297:	48 83 ec 08          	sub    $0x8,%rsp
+  80229b:	6a 00                	push   $0x0
+  80229d:	49 89 f1             	mov    %rsi,%r9
+  8022a0:	49 89 c8             	mov    %rcx,%r8
+  8022a3:	48 89 d1             	mov    %rdx,%rcx
+  8022a6:	48 89 c2             	mov    %rax,%rdx
+  8022a9:	be 01 00 00 00       	mov    $0x1,%esi
+  8022ae:	bf 16 00 00 00       	mov    $0x16,%edi
+  8022b3:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  8022ba:	00 00 00 
+  8022bd:	ff d0                	call   *%rax
+  8022bf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022c3:	c9                   	leave
+  8022c4:	c3                   	ret
+
+00000000008022c5 <sys_vma_binary>:
+
+int sys_vma_binary(envid_t envid, const struct Proghdr *ph)
+{
+  8022c5:	55                   	push   %rbp
+  8022c6:	48 89 e5             	mov    %rsp,%rbp
+  8022c9:	48 83 ec 10          	sub    $0x10,%rsp
+  8022cd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022d0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_vma_binary, 1, envid, (uint64_t)ph, 0, 0, 0);
+  8022d4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022d8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8022db:	48 98                	cltq
+  8022dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8022e1:	6a 00                	push   $0x0
+  8022e3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022ef:	48 89 d1             	mov    %rdx,%rcx
+  8022f2:	48 89 c2             	mov    %rax,%rdx
+  8022f5:	be 01 00 00 00       	mov    $0x1,%esi
+  8022fa:	bf 17 00 00 00       	mov    $0x17,%edi
+  8022ff:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  802306:	00 00 00 
+  802309:	ff d0                	call   *%rax
+  80230b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80230f:	c9                   	leave
+  802310:	c3                   	ret
@@ -0,0 +1,3755 @@
+
+obj/user/tracedump.debug:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// entrypoint - 当最初被加载到一个新的环境中时，内核(或者父环境)在这里开始运行.
+.text
+.globl _start
+_start:
+	// 判断是否从栈上的参数开始初始化
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	// $USTACKTOP != %rsp 说明有参数，跳转到 args_exist
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// 如果不是(新环境被内核加载的时候)，则 push 伪造的 argc, argv 参数
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 21 02 00 00       	call   800262 <libmain>
+
+// 不应该返回
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <trace_name>:
+};
+
+// 返回事件类型 id 的名字，内核和用户程序共用同一张表
+static inline const char *
+trace_name(int id)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	48 83 ec 08          	sub    $0x8,%rsp
+  80004b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+		[TRACE_PGFAULT] = "pgfault",
+		[TRACE_IPC_SEND] = "ipc-send",
+		[TRACE_IPC_RECV] = "ipc-recv",
+	};
+
+	if (id <= 0 || id >= NTRACEEVENTS || !names[id])
+  80004e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800052:	7e 1e                	jle    800072 <trace_name+0x2f>
+  800054:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+  800058:	7f 18                	jg     800072 <trace_name+0x2f>
+  80005a:	48 ba 40 24 80 00 00 	movabs $0x802440,%rdx
+  800061:	00 00 00 
+  800064:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800067:	48 98                	cltq
+  800069:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80006d:	48 85 c0             	test   %rax,%rax
+  800070:	75 0c                	jne    80007e <trace_name+0x3b>
+		return "?";
+  800072:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  800079:	00 00 00 
+  80007c:	eb 13                	jmp    800091 <trace_name+0x4e>
+	return names[id];
+  80007e:	48 ba 40 24 80 00 00 	movabs $0x802440,%rdx
+  800085:	00 00 00 
+  800088:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80008b:	48 98                	cltq
+  80008d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+}
+  800091:	c9                   	leave
+  800092:	c3                   	ret
+
+0000000000800093 <umain>:
+#define MAXCPU 8
+
+struct TraceEvent evs[64];
+
+void umain(int argc, char **argv)
+{
+  800093:	55                   	push   %rbp
+  800094:	48 89 e5             	mov    %rsp,%rbp
+  800097:	41 54                	push   %r12
+  800099:	53                   	push   %rbx
+  80009a:	48 83 ec 30          	sub    $0x30,%rsp
+  80009e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8000a1:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	uint64_t seq;
+	int cpu, i, n;
+
+	if ((n = sys_trace_ctl(1)) < 0)
+  8000a5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000aa:	48 b8 88 20 80 00 00 	movabs $0x802088,%rax
+  8000b1:	00 00 00 
+  8000b4:	ff d0                	call   *%rax
+  8000b6:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8000b9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8000bd:	79 28                	jns    8000e7 <umain+0x54>
+	{
+		cprintf("tracedump: %e\n", n);
+  8000bf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8000c2:	89 c6                	mov    %eax,%esi
+  8000c4:	48 b8 c2 23 80 00 00 	movabs $0x8023c2,%rax
+  8000cb:	00 00 00 
+  8000ce:	48 89 c7             	mov    %rax,%rdi
+  8000d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d6:	48 ba 20 04 80 00 00 	movabs $0x800420,%rdx
+  8000dd:	00 00 00 
+  8000e0:	ff d2                	call   *%rdx
+  8000e2:	e9 72 01 00 00       	jmp    800259 <umain+0x1c6>
+		return;
+	}
+	for (i = 0; i < 4; i++)
+  8000e7:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  8000ee:	eb 10                	jmp    800100 <umain+0x6d>
+		sys_yield();
+  8000f0:	48 b8 cf 1c 80 00 00 	movabs $0x801ccf,%rax
+  8000f7:	00 00 00 
+  8000fa:	ff d0                	call   *%rax
+	for (i = 0; i < 4; i++)
+  8000fc:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  800100:	83 7d e8 03          	cmpl   $0x3,-0x18(%rbp)
+  800104:	7e ea                	jle    8000f0 <umain+0x5d>
+	sys_trace_ctl(0);
+  800106:	bf 00 00 00 00       	mov    $0x0,%edi
+  80010b:	48 b8 88 20 80 00 00 	movabs $0x802088,%rax
+  800112:	00 00 00 
+  800115:	ff d0                	call   *%rax
+
+	for (cpu = 0; cpu < MAXCPU; cpu++)
+  800117:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80011e:	e9 2c 01 00 00       	jmp    80024f <umain+0x1bc>
+	{
+		// 流式读取: 每次从上次读到的序号继续
+		seq = 0;
+  800123:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80012a:	00 
+		while ((n = sys_trace_read(cpu, &seq, evs, sizeof(evs) / sizeof(evs[0]))) > 0)
+  80012b:	e9 ea 00 00 00       	jmp    80021a <umain+0x187>
+			for (i = 0; i < n; i++)
+  800130:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  800137:	e9 d2 00 00 00       	jmp    80020e <umain+0x17b>
+				cprintf("cpu %d [%08x] %-9s %016llx %016llx\n", evs[i].te_cpu, evs[i].te_envid,
+  80013c:	48 ba 20 40 80 00 00 	movabs $0x804020,%rdx
+  800143:	00 00 00 
+  800146:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800149:	48 98                	cltq
+  80014b:	48 c1 e0 05          	shl    $0x5,%rax
+  80014f:	48 01 d0             	add    %rdx,%rax
+  800152:	48 83 c0 18          	add    $0x18,%rax
+  800156:	4c 8b 20             	mov    (%rax),%r12
+  800159:	48 ba 20 40 80 00 00 	movabs $0x804020,%rdx
+  800160:	00 00 00 
+  800163:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800166:	48 98                	cltq
+  800168:	48 c1 e0 05          	shl    $0x5,%rax
+  80016c:	48 01 d0             	add    %rdx,%rax
+  80016f:	48 83 c0 10          	add    $0x10,%rax
+  800173:	48 8b 18             	mov    (%rax),%rbx
+						trace_name(evs[i].te_id),
+  800176:	48 ba 20 40 80 00 00 	movabs $0x804020,%rdx
+  80017d:	00 00 00 
+  800180:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800183:	48 98                	cltq
+  800185:	48 c1 e0 05          	shl    $0x5,%rax
+  800189:	48 01 d0             	add    %rdx,%rax
+  80018c:	48 83 c0 0a          	add    $0xa,%rax
+  800190:	0f b7 00             	movzwl (%rax),%eax
+				cprintf("cpu %d [%08x] %-9s %016llx %016llx\n", evs[i].te_cpu, evs[i].te_envid,
+  800193:	0f b7 c0             	movzwl %ax,%eax
+  800196:	89 c7                	mov    %eax,%edi
+  800198:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  80019f:	00 00 00 
+  8001a2:	ff d0                	call   *%rax
+  8001a4:	48 89 c1             	mov    %rax,%rcx
+  8001a7:	48 ba 20 40 80 00 00 	movabs $0x804020,%rdx
+  8001ae:	00 00 00 
+  8001b1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8001b4:	48 98                	cltq
+  8001b6:	48 c1 e0 05          	shl    $0x5,%rax
+  8001ba:	48 01 d0             	add    %rdx,%rax
+  8001bd:	48 83 c0 0c          	add    $0xc,%rax
+  8001c1:	8b 10                	mov    (%rax),%edx
+  8001c3:	48 be 20 40 80 00 00 	movabs $0x804020,%rsi
+  8001ca:	00 00 00 
+  8001cd:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8001d0:	48 98                	cltq
+  8001d2:	48 c1 e0 05          	shl    $0x5,%rax
+  8001d6:	48 01 f0             	add    %rsi,%rax
+  8001d9:	48 83 c0 08          	add    $0x8,%rax
+  8001dd:	0f b7 00             	movzwl (%rax),%eax
+  8001e0:	0f b7 c0             	movzwl %ax,%eax
+  8001e3:	4d 89 e1             	mov    %r12,%r9
+  8001e6:	49 89 d8             	mov    %rbx,%r8
+  8001e9:	89 c6                	mov    %eax,%esi
+  8001eb:	48 b8 d8 23 80 00 00 	movabs $0x8023d8,%rax
+  8001f2:	00 00 00 
+  8001f5:	48 89 c7             	mov    %rax,%rdi
+  8001f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fd:	49 ba 20 04 80 00 00 	movabs $0x800420,%r10
+  800204:	00 00 00 
+  800207:	41 ff d2             	call   *%r10
+			for (i = 0; i < n; i++)
+  80020a:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  80020e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800211:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  800214:	0f 8c 22 ff ff ff    	jl     80013c <umain+0xa9>
+		while ((n = sys_trace_read(cpu, &seq, evs, sizeof(evs) / sizeof(evs[0]))) > 0)
+  80021a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80021e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800221:	b9 40 00 00 00       	mov    $0x40,%ecx
+  800226:	48 ba 20 40 80 00 00 	movabs $0x804020,%rdx
+  80022d:	00 00 00 
+  800230:	89 c7                	mov    %eax,%edi
+  800232:	48 b8 ce 20 80 00 00 	movabs $0x8020ce,%rax
+  800239:	00 00 00 
+  80023c:	ff d0                	call   *%rax
+  80023e:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  800241:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800245:	0f 8f e5 fe ff ff    	jg     800130 <umain+0x9d>
+	for (cpu = 0; cpu < MAXCPU; cpu++)
+  80024b:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80024f:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+  800253:	0f 8e ca fe ff ff    	jle    800123 <umain+0x90>
+						evs[i].te_args[0], evs[i].te_args[1]);
+	}
+}
+  800259:	48 83 c4 30          	add    $0x30,%rsp
+  80025d:	5b                   	pop    %rbx
+  80025e:	41 5c                	pop    %r12
+  800260:	5d                   	pop    %rbp
+  800261:	c3                   	ret
+
+0000000000800262 <libmain>:
+
+/**
+ *  用户环境从lib/libmain.c中的函数libmain开始执行，这个函数进而调用umain，用户写的程序入口只能是umain
+ */
+void libmain(int argc, char **argv)
+{
+  800262:	55                   	push   %rbp
+  800263:	48 89 e5             	mov    %rsp,%rbp
+  800266:	48 83 ec 10          	sub    $0x10,%rsp
+  80026a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80026d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 设置常量 thisproc 指向 procs[] 中当前环境的 Env 结构，ENVX 确保环境 id 未超过了 NENV
+	// thisproc 指向当前环境的 Env 结构
+	thisproc = &procs[ENVX(sys_getprocid())];
+  800271:	48 b8 93 1c 80 00 00 	movabs $0x801c93,%rax
+  800278:	00 00 00 
+  80027b:	ff d0                	call   *%rax
+  80027d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800282:	48 98                	cltq
+  800284:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  80028b:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  800292:	00 00 00 
+  800295:	48 01 c2             	add    %rax,%rdx
+  800298:	48 b8 20 48 80 00 00 	movabs $0x804820,%rax
+  80029f:	00 00 00 
+  8002a2:	48 89 10             	mov    %rdx,(%rax)
+
+	// 通过 CPUID 选择 memset/memmove/memcpy 的实现
+	mem_init();
+  8002a5:	48 b8 3b 13 80 00 00 	movabs $0x80133b,%rax
+  8002ac:	00 00 00 
+  8002af:	ff d0                	call   *%rax
+
+	// 为了能让panic()提示用户错误，存储程序的名称
+	if (argc > 0)
+  8002b1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8002b5:	7e 14                	jle    8002cb <libmain+0x69>
+		binaryname = argv[0];
+  8002b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002bb:	48 8b 00             	mov    (%rax),%rax
+  8002be:	48 ba 00 40 80 00 00 	movabs $0x804000,%rdx
+  8002c5:	00 00 00 
+  8002c8:	48 89 02             	mov    %rax,(%rdx)
+
+	// 调用用户的主程序
+	umain(argc, argv);
+  8002cb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8002cf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8002d2:	48 89 d6             	mov    %rdx,%rsi
+  8002d5:	89 c7                	mov    %eax,%edi
+  8002d7:	48 b8 93 00 80 00 00 	movabs $0x800093,%rax
+  8002de:	00 00 00 
+  8002e1:	ff d0                	call   *%rax
+
+	// 退出当前环境，env_destroy
+	sys_env_destroy(0);
+  8002e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002e8:	48 b8 4d 1c 80 00 00 	movabs $0x801c4d,%rax
+  8002ef:	00 00 00 
+  8002f2:	ff d0                	call   *%rax
+}
+  8002f4:	90                   	nop
+  8002f5:	c9                   	leave
+  8002f6:	c3                   	ret
+
+00000000008002f7 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002f7:	55                   	push   %rbp
+  8002f8:	48 89 e5             	mov    %rsp,%rbp
+  8002fb:	48 83 ec 10          	sub    $0x10,%rsp
+  8002ff:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800302:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->buf[b->idx++] = ch;
+  800306:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80030a:	8b 00                	mov    (%rax),%eax
+  80030c:	8d 48 01             	lea    0x1(%rax),%ecx
+  80030f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800313:	89 0a                	mov    %ecx,(%rdx)
+  800315:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800318:	89 d1                	mov    %edx,%ecx
+  80031a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80031e:	48 98                	cltq
+  800320:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+	if (b->idx == 256-1) {
+  800324:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800328:	8b 00                	mov    (%rax),%eax
+  80032a:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80032f:	75 2c                	jne    80035d <putch+0x66>
+		sys_cputs(b->buf, b->idx);
+  800331:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800335:	8b 00                	mov    (%rax),%eax
+  800337:	48 98                	cltq
+  800339:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80033d:	48 83 c2 08          	add    $0x8,%rdx
+  800341:	48 89 c6             	mov    %rax,%rsi
+  800344:	48 89 d7             	mov    %rdx,%rdi
+  800347:	48 b8 c4 1b 80 00 00 	movabs $0x801bc4,%rax
+  80034e:	00 00 00 
+  800351:	ff d0                	call   *%rax
+		b->idx = 0;
+  800353:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800357:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	}
+	b->cnt++;
+  80035d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800361:	8b 40 04             	mov    0x4(%rax),%eax
+  800364:	8d 50 01             	lea    0x1(%rax),%edx
+  800367:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80036b:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80036e:	90                   	nop
+  80036f:	c9                   	leave
+  800370:	c3                   	ret
+
+0000000000800371 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800371:	55                   	push   %rbp
+  800372:	48 89 e5             	mov    %rsp,%rbp
+  800375:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80037c:	48 89 bd c8 fe ff ff 	mov    %rdi,-0x138(%rbp)
+  800383:	48 89 b5 c0 fe ff ff 	mov    %rsi,-0x140(%rbp)
+	struct printbuf b;
+	va_list aq;
+	va_copy(aq,ap);
+  80038a:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  800391:	48 8b b5 c0 fe ff ff 	mov    -0x140(%rbp),%rsi
+  800398:	48 8b 06             	mov    (%rsi),%rax
+  80039b:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80039f:	48 89 01             	mov    %rax,(%rcx)
+  8003a2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8003a6:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8003aa:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	b.idx = 0;
+  8003ae:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8003b5:	00 00 00 
+	b.cnt = 0;
+  8003b8:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8003bf:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, aq);
+  8003c2:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  8003c9:	48 8b 95 c8 fe ff ff 	mov    -0x138(%rbp),%rdx
+  8003d0:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8003d7:	48 89 c6             	mov    %rax,%rsi
+  8003da:	48 b8 f7 02 80 00 00 	movabs $0x8002f7,%rax
+  8003e1:	00 00 00 
+  8003e4:	48 89 c7             	mov    %rax,%rdi
+  8003e7:	48 b8 be 07 80 00 00 	movabs $0x8007be,%rax
+  8003ee:	00 00 00 
+  8003f1:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  8003f3:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8003f9:	48 98                	cltq
+  8003fb:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800402:	48 83 c2 08          	add    $0x8,%rdx
+  800406:	48 89 c6             	mov    %rax,%rsi
+  800409:	48 89 d7             	mov    %rdx,%rdi
+  80040c:	48 b8 c4 1b 80 00 00 	movabs $0x801bc4,%rax
+  800413:	00 00 00 
+  800416:	ff d0                	call   *%rax
+	va_end(aq);
+
+	return b.cnt;
+  800418:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80041e:	c9                   	leave
+  80041f:	c3                   	ret
+
+0000000000800420 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800420:	55                   	push   %rbp
+  800421:	48 89 e5             	mov    %rsp,%rbp
+  800424:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  80042b:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800432:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800439:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800440:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800447:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80044e:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800455:	84 c0                	test   %al,%al
+  800457:	74 20                	je     800479 <cprintf+0x59>
+  800459:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80045d:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800461:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800465:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800469:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80046d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800471:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800475:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+	va_list aq;
+	va_start(ap, fmt);
+  800479:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800480:	00 00 00 
+  800483:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80048a:	00 00 00 
+  80048d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800491:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800498:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80049f:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  8004a6:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8004ad:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8004b4:	48 8b 06             	mov    (%rsi),%rax
+  8004b7:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8004bb:	48 89 01             	mov    %rax,(%rcx)
+  8004be:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8004c2:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8004c6:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	cnt = vcprintf(fmt, aq);
+  8004ca:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8004d1:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8004d8:	48 89 d6             	mov    %rdx,%rsi
+  8004db:	48 89 c7             	mov    %rax,%rdi
+  8004de:	48 b8 71 03 80 00 00 	movabs $0x800371,%rax
+  8004e5:	00 00 00 
+  8004e8:	ff d0                	call   *%rax
+  8004ea:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return cnt;
+  8004f0:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8004f6:	c9                   	leave
+  8004f7:	c3                   	ret
+
+00000000008004f8 <printnum>:
+ * num: 需要打印出来的整型数，base: 整型数的进制，其他参数同 vprintfmt
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+		 unsigned long long num, unsigned base, int width, int padc)
+{
+  8004f8:	55                   	push   %rbp
+  8004f9:	48 89 e5             	mov    %rsp,%rbp
+  8004fc:	48 83 ec 30          	sub    $0x30,%rsp
+  800500:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800504:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800508:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80050c:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  80050f:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  800513:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+	// 当 num 超过一位数，首先递归函数自身打印所有高位的(更重要的)数字
+	if (num >= base)
+  800517:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80051a:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  80051e:	72 54                	jb     800574 <printnum+0x7c>
+	{
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800520:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800523:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800526:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800529:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80052d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800532:	48 f7 f6             	div    %rsi
+  800535:	49 89 c2             	mov    %rax,%r10
+  800538:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80053b:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80053e:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800542:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800546:	41 89 c9             	mov    %ecx,%r9d
+  800549:	41 89 f8             	mov    %edi,%r8d
+  80054c:	89 d1                	mov    %edx,%ecx
+  80054e:	4c 89 d2             	mov    %r10,%rdx
+  800551:	48 89 c7             	mov    %rax,%rdi
+  800554:	48 b8 f8 04 80 00 00 	movabs $0x8004f8,%rax
+  80055b:	00 00 00 
+  80055e:	ff d0                	call   *%rax
+  800560:	eb 1c                	jmp    80057e <printnum+0x86>
+	}
+	else
+	{
+		// 按照右对齐的格式在左侧补齐填充字符 padc
+		while (--width > 0)
+			putch(padc, putdat);
+  800562:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800566:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800569:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80056d:	48 89 d6             	mov    %rdx,%rsi
+  800570:	89 c7                	mov    %eax,%edi
+  800572:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800574:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800578:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80057c:	7f e4                	jg     800562 <printnum+0x6a>
+	}
+
+	// 然后打印个位数字
+	putch("0123456789abcdef"[num % base], putdat);
+  80057e:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800581:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800585:	ba 00 00 00 00       	mov    $0x0,%edx
+  80058a:	48 f7 f1             	div    %rcx
+  80058d:	48 b8 90 26 80 00 00 	movabs $0x802690,%rax
+  800594:	00 00 00 
+  800597:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  80059b:	0f be c0             	movsbl %al,%eax
+  80059e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005a2:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8005a6:	48 89 d6             	mov    %rdx,%rsi
+  8005a9:	89 c7                	mov    %eax,%edi
+  8005ab:	ff d1                	call   *%rcx
+}
+  8005ad:	90                   	nop
+  8005ae:	c9                   	leave
+  8005af:	c3                   	ret
+
+00000000008005b0 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  8005b0:	55                   	push   %rbp
+  8005b1:	48 89 e5             	mov    %rsp,%rbp
+  8005b4:	48 83 ec 20          	sub    $0x20,%rsp
+  8005b8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8005bc:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;
+	if (lflag >= 2)
+  8005bf:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8005c3:	7e 4f                	jle    800614 <getuint+0x64>
+		x = va_arg(*ap, unsigned long long);
+  8005c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005c9:	8b 00                	mov    (%rax),%eax
+  8005cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8005ce:	77 24                	ja     8005f4 <getuint+0x44>
+  8005d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005d4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005dc:	8b 00                	mov    (%rax),%eax
+  8005de:	89 c0                	mov    %eax,%eax
+  8005e0:	48 01 d0             	add    %rdx,%rax
+  8005e3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005e7:	8b 12                	mov    (%rdx),%edx
+  8005e9:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005ec:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005f0:	89 0a                	mov    %ecx,(%rdx)
+  8005f2:	eb 14                	jmp    800608 <getuint+0x58>
+  8005f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005f8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005fc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800600:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800604:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800608:	48 8b 00             	mov    (%rax),%rax
+  80060b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80060f:	e9 9d 00 00 00       	jmp    8006b1 <getuint+0x101>
+	else if (lflag)
+  800614:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800618:	74 4c                	je     800666 <getuint+0xb6>
+		x = va_arg(*ap, unsigned long);
+  80061a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80061e:	8b 00                	mov    (%rax),%eax
+  800620:	83 f8 2f             	cmp    $0x2f,%eax
+  800623:	77 24                	ja     800649 <getuint+0x99>
+  800625:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800629:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80062d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800631:	8b 00                	mov    (%rax),%eax
+  800633:	89 c0                	mov    %eax,%eax
+  800635:	48 01 d0             	add    %rdx,%rax
+  800638:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80063c:	8b 12                	mov    (%rdx),%edx
+  80063e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800641:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800645:	89 0a                	mov    %ecx,(%rdx)
+  800647:	eb 14                	jmp    80065d <getuint+0xad>
+  800649:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80064d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800651:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800655:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800659:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80065d:	48 8b 00             	mov    (%rax),%rax
+  800660:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800664:	eb 4b                	jmp    8006b1 <getuint+0x101>
+	else
+		x = va_arg(*ap, unsigned int);
+  800666:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80066a:	8b 00                	mov    (%rax),%eax
+  80066c:	83 f8 2f             	cmp    $0x2f,%eax
+  80066f:	77 24                	ja     800695 <getuint+0xe5>
+  800671:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800675:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800679:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80067d:	8b 00                	mov    (%rax),%eax
+  80067f:	89 c0                	mov    %eax,%eax
+  800681:	48 01 d0             	add    %rdx,%rax
+  800684:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800688:	8b 12                	mov    (%rdx),%edx
+  80068a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80068d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800691:	89 0a                	mov    %ecx,(%rdx)
+  800693:	eb 14                	jmp    8006a9 <getuint+0xf9>
+  800695:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800699:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80069d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006a1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006a5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006a9:	8b 00                	mov    (%rax),%eax
+  8006ab:	89 c0                	mov    %eax,%eax
+  8006ad:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8006b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8006b5:	c9                   	leave
+  8006b6:	c3                   	ret
+
+00000000008006b7 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  8006b7:	55                   	push   %rbp
+  8006b8:	48 89 e5             	mov    %rsp,%rbp
+  8006bb:	48 83 ec 20          	sub    $0x20,%rsp
+  8006bf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8006c3:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  8006c6:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8006ca:	7e 4f                	jle    80071b <getint+0x64>
+		x = va_arg(*ap, long long);
+  8006cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006d0:	8b 00                	mov    (%rax),%eax
+  8006d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8006d5:	77 24                	ja     8006fb <getint+0x44>
+  8006d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006db:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006e3:	8b 00                	mov    (%rax),%eax
+  8006e5:	89 c0                	mov    %eax,%eax
+  8006e7:	48 01 d0             	add    %rdx,%rax
+  8006ea:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006ee:	8b 12                	mov    (%rdx),%edx
+  8006f0:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006f3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006f7:	89 0a                	mov    %ecx,(%rdx)
+  8006f9:	eb 14                	jmp    80070f <getint+0x58>
+  8006fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006ff:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800703:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800707:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80070b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80070f:	48 8b 00             	mov    (%rax),%rax
+  800712:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800716:	e9 9d 00 00 00       	jmp    8007b8 <getint+0x101>
+	else if (lflag)
+  80071b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80071f:	74 4c                	je     80076d <getint+0xb6>
+		x = va_arg(*ap, long);
+  800721:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800725:	8b 00                	mov    (%rax),%eax
+  800727:	83 f8 2f             	cmp    $0x2f,%eax
+  80072a:	77 24                	ja     800750 <getint+0x99>
+  80072c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800730:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800734:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800738:	8b 00                	mov    (%rax),%eax
+  80073a:	89 c0                	mov    %eax,%eax
+  80073c:	48 01 d0             	add    %rdx,%rax
+  80073f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800743:	8b 12                	mov    (%rdx),%edx
+  800745:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800748:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80074c:	89 0a                	mov    %ecx,(%rdx)
+  80074e:	eb 14                	jmp    800764 <getint+0xad>
+  800750:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800754:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800758:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80075c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800760:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800764:	48 8b 00             	mov    (%rax),%rax
+  800767:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80076b:	eb 4b                	jmp    8007b8 <getint+0x101>
+	else
+		x = va_arg(*ap, int);
+  80076d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800771:	8b 00                	mov    (%rax),%eax
+  800773:	83 f8 2f             	cmp    $0x2f,%eax
+  800776:	77 24                	ja     80079c <getint+0xe5>
+  800778:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80077c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800780:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800784:	8b 00                	mov    (%rax),%eax
+  800786:	89 c0                	mov    %eax,%eax
+  800788:	48 01 d0             	add    %rdx,%rax
+  80078b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80078f:	8b 12                	mov    (%rdx),%edx
+  800791:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800794:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800798:	89 0a                	mov    %ecx,(%rdx)
+  80079a:	eb 14                	jmp    8007b0 <getint+0xf9>
+  80079c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007a0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007a4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007a8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007ac:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007b0:	8b 00                	mov    (%rax),%eax
+  8007b2:	48 98                	cltq
+  8007b4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8007b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8007bc:	c9                   	leave
+  8007bd:	c3                   	ret
+
+00000000008007be <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap)
+{
+  8007be:	55                   	push   %rbp
+  8007bf:	48 89 e5             	mov    %rsp,%rbp
+  8007c2:	41 54                	push   %r12
+  8007c4:	53                   	push   %rbx
+  8007c5:	48 83 ec 60          	sub    $0x60,%rsp
+  8007c9:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8007cd:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8007d1:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8007d5:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+	int base, lflag, width, precision, altflag;
+
+	// 填充字符，在显示字符串的'%'后读到'-'或'0'时，赋值到 padc
+	char padc;
+	va_list aq;
+	va_copy(aq, ap);
+  8007d9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8007dd:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8007e1:	48 8b 06             	mov    (%rsi),%rax
+  8007e4:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8007e8:	48 89 01             	mov    %rax,(%rcx)
+  8007eb:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8007ef:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8007f3:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1)
+	{
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  8007f7:	eb 17                	jmp    800810 <vprintfmt+0x52>
+		{
+			if (ch == '\0')
+  8007f9:	85 db                	test   %ebx,%ebx
+  8007fb:	0f 84 b9 04 00 00    	je     800cba <vprintfmt+0x4fc>
+				return;
+			putch(ch, putdat);
+  800801:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800805:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800809:	48 89 c6             	mov    %rax,%rsi
+  80080c:	89 df                	mov    %ebx,%edi
+  80080e:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800810:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800814:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800818:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80081c:	0f b6 00             	movzbl (%rax),%eax
+  80081f:	0f b6 d8             	movzbl %al,%ebx
+  800822:	83 fb 25             	cmp    $0x25,%ebx
+  800825:	75 d2                	jne    8007f9 <vprintfmt+0x3b>
+		}
+
+		// 处理 % 转义序列
+		// padc 初始化为空格符，padc='-'代表字符串左对齐，右边补空格，padc=' '代表右对齐，左边补空格，padc='0'右对齐，左边补0
+		padc = ' ';
+  800827:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+		width = -1;
+  80082b:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+		// 默认-1代表显示长度为字符串本来的长度
+		precision = -1;
+  800832:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+		lflag = 0;
+  800839:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+		altflag = 0;
+  800840:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *)fmt++)
+  800847:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80084b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80084f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800853:	0f b6 00             	movzbl (%rax),%eax
+  800856:	0f b6 d8             	movzbl %al,%ebx
+  800859:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  80085c:	83 f8 55             	cmp    $0x55,%eax
+  80085f:	0f 87 22 04 00 00    	ja     800c87 <vprintfmt+0x4c9>
+  800865:	89 c0                	mov    %eax,%eax
+  800867:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80086e:	00 
+  80086f:	48 b8 b8 26 80 00 00 	movabs $0x8026b8,%rax
+  800876:	00 00 00 
+  800879:	48 01 d0             	add    %rdx,%rax
+  80087c:	48 8b 00             	mov    (%rax),%rax
+  80087f:	ff e0                	jmp    *%rax
+		{
+
+		// flag to pad on the right
+		case '-':
+			padc = '-';
+  800881:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+			goto reswitch;
+  800885:	eb c0                	jmp    800847 <vprintfmt+0x89>
+
+		// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800887:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+			goto reswitch;
+  80088b:	eb ba                	jmp    800847 <vprintfmt+0x89>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0;; ++fmt)
+  80088d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+			{
+				precision = precision * 10 + ch - '0';
+  800894:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800897:	89 d0                	mov    %edx,%eax
+  800899:	c1 e0 02             	shl    $0x2,%eax
+  80089c:	01 d0                	add    %edx,%eax
+  80089e:	01 c0                	add    %eax,%eax
+  8008a0:	01 d8                	add    %ebx,%eax
+  8008a2:	83 e8 30             	sub    $0x30,%eax
+  8008a5:	89 45 d8             	mov    %eax,-0x28(%rbp)
+				ch = *fmt;
+  8008a8:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8008ac:	0f b6 00             	movzbl (%rax),%eax
+  8008af:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  8008b2:	83 fb 2f             	cmp    $0x2f,%ebx
+  8008b5:	7e 60                	jle    800917 <vprintfmt+0x159>
+  8008b7:	83 fb 39             	cmp    $0x39,%ebx
+  8008ba:	7f 5b                	jg     800917 <vprintfmt+0x159>
+			for (precision = 0;; ++fmt)
+  8008bc:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+				precision = precision * 10 + ch - '0';
+  8008c1:	eb d1                	jmp    800894 <vprintfmt+0xd6>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  8008c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c6:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c9:	77 17                	ja     8008e2 <vprintfmt+0x124>
+  8008cb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8008cf:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008d2:	89 d2                	mov    %edx,%edx
+  8008d4:	48 01 d0             	add    %rdx,%rax
+  8008d7:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008da:	83 c2 08             	add    $0x8,%edx
+  8008dd:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8008e0:	eb 0c                	jmp    8008ee <vprintfmt+0x130>
+  8008e2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8008e6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8008ea:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8008ee:	8b 00                	mov    (%rax),%eax
+  8008f0:	89 45 d8             	mov    %eax,-0x28(%rbp)
+			goto process_precision;
+  8008f3:	eb 23                	jmp    800918 <vprintfmt+0x15a>
+
+		case '.':
+			if (width < 0)
+  8008f5:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8008f9:	0f 89 48 ff ff ff    	jns    800847 <vprintfmt+0x89>
+				width = 0;
+  8008ff:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+			goto reswitch;
+  800906:	e9 3c ff ff ff       	jmp    800847 <vprintfmt+0x89>
+
+		case '#':
+			altflag = 1;
+  80090b:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+			goto reswitch;
+  800912:	e9 30 ff ff ff       	jmp    800847 <vprintfmt+0x89>
+			goto process_precision;
+  800917:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800918:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80091c:	0f 89 25 ff ff ff    	jns    800847 <vprintfmt+0x89>
+				width = precision, precision = -1;
+  800922:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800925:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800928:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+			goto reswitch;
+  80092f:	e9 13 ff ff ff       	jmp    800847 <vprintfmt+0x89>
+
+		// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800934:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+			goto reswitch;
+  800938:	e9 0a ff ff ff       	jmp    800847 <vprintfmt+0x89>
+
+		// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  80093d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800940:	83 f8 2f             	cmp    $0x2f,%eax
+  800943:	77 17                	ja     80095c <vprintfmt+0x19e>
+  800945:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800949:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80094c:	89 d2                	mov    %edx,%edx
+  80094e:	48 01 d0             	add    %rdx,%rax
+  800951:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800954:	83 c2 08             	add    $0x8,%edx
+  800957:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80095a:	eb 0c                	jmp    800968 <vprintfmt+0x1aa>
+  80095c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800960:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800964:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800968:	8b 00                	mov    (%rax),%eax
+  80096a:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80096e:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800972:	48 89 d6             	mov    %rdx,%rsi
+  800975:	89 c7                	mov    %eax,%edi
+  800977:	ff d1                	call   *%rcx
+			break;
+  800979:	e9 37 03 00 00       	jmp    800cb5 <vprintfmt+0x4f7>
+
+		// error message
+		case 'e':
+			err = va_arg(aq, int);
+  80097e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800981:	83 f8 2f             	cmp    $0x2f,%eax
+  800984:	77 17                	ja     80099d <vprintfmt+0x1df>
+  800986:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80098a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80098d:	89 d2                	mov    %edx,%edx
+  80098f:	48 01 d0             	add    %rdx,%rax
+  800992:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800995:	83 c2 08             	add    $0x8,%edx
+  800998:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80099b:	eb 0c                	jmp    8009a9 <vprintfmt+0x1eb>
+  80099d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8009a1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8009a5:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8009a9:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  8009ab:	85 db                	test   %ebx,%ebx
+  8009ad:	79 02                	jns    8009b1 <vprintfmt+0x1f3>
+				err = -err;
+  8009af:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8009b1:	83 fb 11             	cmp    $0x11,%ebx
+  8009b4:	7f 16                	jg     8009cc <vprintfmt+0x20e>
+  8009b6:	48 ba 00 26 80 00 00 	movabs $0x802600,%rdx
+  8009bd:	00 00 00 
+  8009c0:	48 63 c3             	movslq %ebx,%rax
+  8009c3:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  8009c7:	4d 85 e4             	test   %r12,%r12
+  8009ca:	75 2e                	jne    8009fa <vprintfmt+0x23c>
+				printfmt(putch, putdat, "error %d", err);
+  8009cc:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8009d0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8009d4:	89 d9                	mov    %ebx,%ecx
+  8009d6:	48 ba a1 26 80 00 00 	movabs $0x8026a1,%rdx
+  8009dd:	00 00 00 
+  8009e0:	48 89 c7             	mov    %rax,%rdi
+  8009e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e8:	49 b8 c4 0c 80 00 00 	movabs $0x800cc4,%r8
+  8009ef:	00 00 00 
+  8009f2:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  8009f5:	e9 bb 02 00 00       	jmp    800cb5 <vprintfmt+0x4f7>
+				printfmt(putch, putdat, "%s", p);
+  8009fa:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8009fe:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a02:	4c 89 e1             	mov    %r12,%rcx
+  800a05:	48 ba aa 26 80 00 00 	movabs $0x8026aa,%rdx
+  800a0c:	00 00 00 
+  800a0f:	48 89 c7             	mov    %rax,%rdi
+  800a12:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a17:	49 b8 c4 0c 80 00 00 	movabs $0x800cc4,%r8
+  800a1e:	00 00 00 
+  800a21:	41 ff d0             	call   *%r8
+			break;
+  800a24:	e9 8c 02 00 00       	jmp    800cb5 <vprintfmt+0x4f7>
+
+		// string
+		case 's':
+			// 从可变参数中读入字符串指针
+			if ((p = va_arg(aq, char *)) == NULL)
+  800a29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2f:	77 17                	ja     800a48 <vprintfmt+0x28a>
+  800a31:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a35:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a38:	89 d2                	mov    %edx,%edx
+  800a3a:	48 01 d0             	add    %rdx,%rax
+  800a3d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a40:	83 c2 08             	add    $0x8,%edx
+  800a43:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a46:	eb 0c                	jmp    800a54 <vprintfmt+0x296>
+  800a48:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a4c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a50:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a54:	4c 8b 20             	mov    (%rax),%r12
+  800a57:	4d 85 e4             	test   %r12,%r12
+  800a5a:	75 0a                	jne    800a66 <vprintfmt+0x2a8>
+				p = "(null)"; // 当字符串为空时，将它指向"(null)"字符串
+  800a5c:	49 bc ad 26 80 00 00 	movabs $0x8026ad,%r12
+  800a63:	00 00 00 
+			// 判断左对齐还是右对齐，pad='-'左对齐，否则右对齐
+			if (width > 0 && padc != '-')
+  800a66:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a6a:	7e 78                	jle    800ae4 <vprintfmt+0x326>
+  800a6c:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800a70:	74 72                	je     800ae4 <vprintfmt+0x326>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a72:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800a75:	48 98                	cltq
+  800a77:	48 89 c6             	mov    %rax,%rsi
+  800a7a:	4c 89 e7             	mov    %r12,%rdi
+  800a7d:	48 b8 69 10 80 00 00 	movabs $0x801069,%rax
+  800a84:	00 00 00 
+  800a87:	ff d0                	call   *%rax
+  800a89:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800a8c:	eb 17                	jmp    800aa5 <vprintfmt+0x2e7>
+					putch(padc, putdat); // 字符串右对齐，左边补相应数量(width-实际长度)的空格或者 0
+  800a8e:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800a92:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800a96:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800a9a:	48 89 d6             	mov    %rdx,%rsi
+  800a9d:	89 c7                	mov    %eax,%edi
+  800a9f:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800aa1:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800aa5:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800aa9:	7f e3                	jg     800a8e <vprintfmt+0x2d0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800aab:	eb 37                	jmp    800ae4 <vprintfmt+0x326>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800aad:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800ab1:	74 1e                	je     800ad1 <vprintfmt+0x313>
+  800ab3:	83 fb 1f             	cmp    $0x1f,%ebx
+  800ab6:	7e 05                	jle    800abd <vprintfmt+0x2ff>
+  800ab8:	83 fb 7e             	cmp    $0x7e,%ebx
+  800abb:	7e 14                	jle    800ad1 <vprintfmt+0x313>
+					putch('?', putdat);
+  800abd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ac1:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ac5:	48 89 c6             	mov    %rax,%rsi
+  800ac8:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800acd:	ff d2                	call   *%rdx
+  800acf:	eb 0f                	jmp    800ae0 <vprintfmt+0x322>
+				else
+					putch(ch, putdat); // 打印相应长度的字符串
+  800ad1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ad5:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ad9:	48 89 c6             	mov    %rax,%rsi
+  800adc:	89 df                	mov    %ebx,%edi
+  800ade:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ae0:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800ae4:	4c 89 e0             	mov    %r12,%rax
+  800ae7:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800aeb:	0f b6 00             	movzbl (%rax),%eax
+  800aee:	0f be d8             	movsbl %al,%ebx
+  800af1:	85 db                	test   %ebx,%ebx
+  800af3:	74 28                	je     800b1d <vprintfmt+0x35f>
+  800af5:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800af9:	78 b2                	js     800aad <vprintfmt+0x2ef>
+  800afb:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800aff:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800b03:	79 a8                	jns    800aad <vprintfmt+0x2ef>
+			for (; width > 0; width--)
+  800b05:	eb 16                	jmp    800b1d <vprintfmt+0x35f>
+				putch(' ', putdat); // 当字符串是左对齐的时候打印相应数量的空格
+  800b07:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b0b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b0f:	48 89 c6             	mov    %rax,%rsi
+  800b12:	bf 20 00 00 00       	mov    $0x20,%edi
+  800b17:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800b19:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800b1d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b21:	7f e4                	jg     800b07 <vprintfmt+0x349>
+			break;
+  800b23:	e9 8d 01 00 00       	jmp    800cb5 <vprintfmt+0x4f7>
+
+		// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800b28:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b2c:	be 03 00 00 00       	mov    $0x3,%esi
+  800b31:	48 89 c7             	mov    %rax,%rdi
+  800b34:	48 b8 b7 06 80 00 00 	movabs $0x8006b7,%rax
+  800b3b:	00 00 00 
+  800b3e:	ff d0                	call   *%rax
+  800b40:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((long long)num < 0)
+  800b44:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b48:	48 85 c0             	test   %rax,%rax
+  800b4b:	79 1d                	jns    800b6a <vprintfmt+0x3ac>
+			{
+				putch('-', putdat);
+  800b4d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b51:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b55:	48 89 c6             	mov    %rax,%rsi
+  800b58:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800b5d:	ff d2                	call   *%rdx
+				num = -(long long)num;
+  800b5f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b63:	48 f7 d8             	neg    %rax
+  800b66:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			}
+			base = 10;
+  800b6a:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800b71:	e9 d2 00 00 00       	jmp    800c48 <vprintfmt+0x48a>
+
+		// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800b76:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b7a:	be 03 00 00 00       	mov    $0x3,%esi
+  800b7f:	48 89 c7             	mov    %rax,%rdi
+  800b82:	48 b8 b0 05 80 00 00 	movabs $0x8005b0,%rax
+  800b89:	00 00 00 
+  800b8c:	ff d0                	call   *%rax
+  800b8e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 10;
+  800b92:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800b99:	e9 aa 00 00 00       	jmp    800c48 <vprintfmt+0x48a>
+		// (unsigned) octal
+		case 'o':
+			// Gets the variable argument with type integer from the point which was processed last by va_arg
+			// calls getuint which returns a long long value, which then calls printnum which prints based on
+			// base value.
+			num = getuint(&aq, 3);
+  800b9e:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800ba2:	be 03 00 00 00       	mov    $0x3,%esi
+  800ba7:	48 89 c7             	mov    %rax,%rdi
+  800baa:	48 b8 b0 05 80 00 00 	movabs $0x8005b0,%rax
+  800bb1:	00 00 00 
+  800bb4:	ff d0                	call   *%rax
+  800bb6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 8;
+  800bba:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+			goto number;
+  800bc1:	e9 82 00 00 00       	jmp    800c48 <vprintfmt+0x48a>
+
+		// pointer
+		case 'p':
+			putch('0', putdat);
+  800bc6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bca:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800bce:	48 89 c6             	mov    %rax,%rsi
+  800bd1:	bf 30 00 00 00       	mov    $0x30,%edi
+  800bd6:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800bd8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bdc:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800be0:	48 89 c6             	mov    %rax,%rsi
+  800be3:	bf 78 00 00 00       	mov    $0x78,%edi
+  800be8:	ff d2                	call   *%rdx
+			num = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800bea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bed:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf0:	77 17                	ja     800c09 <vprintfmt+0x44b>
+  800bf2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800bf6:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800bf9:	89 d2                	mov    %edx,%edx
+  800bfb:	48 01 d0             	add    %rdx,%rax
+  800bfe:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c01:	83 c2 08             	add    $0x8,%edx
+  800c04:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800c07:	eb 0c                	jmp    800c15 <vprintfmt+0x457>
+  800c09:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800c0d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c11:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800c15:	48 8b 00             	mov    (%rax),%rax
+  800c18:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800c1c:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+			goto number;
+  800c23:	eb 23                	jmp    800c48 <vprintfmt+0x48a>
+
+		// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800c25:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800c29:	be 03 00 00 00       	mov    $0x3,%esi
+  800c2e:	48 89 c7             	mov    %rax,%rdi
+  800c31:	48 b8 b0 05 80 00 00 	movabs $0x8005b0,%rax
+  800c38:	00 00 00 
+  800c3b:	ff d0                	call   *%rax
+  800c3d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800c41:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800c48:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800c4d:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800c50:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800c53:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c57:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800c5b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c5f:	45 89 c1             	mov    %r8d,%r9d
+  800c62:	41 89 f8             	mov    %edi,%r8d
+  800c65:	48 89 c7             	mov    %rax,%rdi
+  800c68:	48 b8 f8 04 80 00 00 	movabs $0x8004f8,%rax
+  800c6f:	00 00 00 
+  800c72:	ff d0                	call   *%rax
+			break;
+  800c74:	eb 3f                	jmp    800cb5 <vprintfmt+0x4f7>
+
+		// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800c76:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c7a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c7e:	48 89 c6             	mov    %rax,%rsi
+  800c81:	89 df                	mov    %ebx,%edi
+  800c83:	ff d2                	call   *%rdx
+			break;
+  800c85:	eb 2e                	jmp    800cb5 <vprintfmt+0x4f7>
+
+		// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800c87:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c8b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c8f:	48 89 c6             	mov    %rax,%rsi
+  800c92:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c97:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800c99:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800c9e:	eb 05                	jmp    800ca5 <vprintfmt+0x4e7>
+  800ca0:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800ca5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800ca9:	48 83 e8 01          	sub    $0x1,%rax
+  800cad:	0f b6 00             	movzbl (%rax),%eax
+  800cb0:	3c 25                	cmp    $0x25,%al
+  800cb2:	75 ec                	jne    800ca0 <vprintfmt+0x4e2>
+				/* do nothing */;
+			break;
+  800cb4:	90                   	nop
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800cb5:	e9 56 fb ff ff       	jmp    800810 <vprintfmt+0x52>
+				return;
+  800cba:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800cbb:	48 83 c4 60          	add    $0x60,%rsp
+  800cbf:	5b                   	pop    %rbx
+  800cc0:	41 5c                	pop    %r12
+  800cc2:	5d                   	pop    %rbp
+  800cc3:	c3                   	ret
+
+0000000000800cc4 <printfmt>:
+
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...)
+{
+  800cc4:	55                   	push   %rbp
+  800cc5:	48 89 e5             	mov    %rsp,%rbp
+  800cc8:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800ccf:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800cd6:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800cdd:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800ce4:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800ceb:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800cf2:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800cf9:	84 c0                	test   %al,%al
+  800cfb:	74 20                	je     800d1d <printfmt+0x59>
+  800cfd:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800d01:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800d05:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800d09:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800d0d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800d11:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800d15:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800d19:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800d1d:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800d24:	00 00 00 
+  800d27:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800d2e:	00 00 00 
+  800d31:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d35:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800d3c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800d43:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800d4a:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800d51:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800d58:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800d5f:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800d66:	48 89 c7             	mov    %rax,%rdi
+  800d69:	48 b8 be 07 80 00 00 	movabs $0x8007be,%rax
+  800d70:	00 00 00 
+  800d73:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  800d75:	90                   	nop
+  800d76:	c9                   	leave
+  800d77:	c3                   	ret
+
+0000000000800d78 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800d78:	55                   	push   %rbp
+  800d79:	48 89 e5             	mov    %rsp,%rbp
+  800d7c:	48 83 ec 10          	sub    $0x10,%rsp
+  800d80:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800d83:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  800d87:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d8b:	8b 40 10             	mov    0x10(%rax),%eax
+  800d8e:	8d 50 01             	lea    0x1(%rax),%edx
+  800d91:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d95:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  800d98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d9c:	48 8b 10             	mov    (%rax),%rdx
+  800d9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800da3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800da7:	48 39 c2             	cmp    %rax,%rdx
+  800daa:	73 17                	jae    800dc3 <sprintputch+0x4b>
+		*b->buf++ = ch;
+  800dac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800db0:	48 8b 00             	mov    (%rax),%rax
+  800db3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800db7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800dbb:	48 89 0a             	mov    %rcx,(%rdx)
+  800dbe:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800dc1:	88 10                	mov    %dl,(%rax)
+}
+  800dc3:	90                   	nop
+  800dc4:	c9                   	leave
+  800dc5:	c3                   	ret
+
+0000000000800dc6 <vsnprintf>:
+
+int vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800dc6:	55                   	push   %rbp
+  800dc7:	48 89 e5             	mov    %rsp,%rbp
+  800dca:	48 83 ec 50          	sub    $0x50,%rsp
+  800dce:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  800dd2:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  800dd5:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  800dd9:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+	va_list aq;
+	va_copy(aq, ap);
+  800ddd:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800de1:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800de5:	48 8b 06             	mov    (%rsi),%rax
+  800de8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800dec:	48 89 01             	mov    %rax,(%rcx)
+  800def:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800df3:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800df7:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	struct sprintbuf b = {buf, buf + n - 1, 0};
+  800dfb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800dff:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800e03:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  800e06:	48 98                	cltq
+  800e08:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800e0c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e10:	48 01 d0             	add    %rdx,%rax
+  800e13:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  800e17:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+
+	if (buf == NULL || n < 1)
+  800e1e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800e23:	74 06                	je     800e2b <vsnprintf+0x65>
+  800e25:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800e29:	7f 07                	jg     800e32 <vsnprintf+0x6c>
+		return -E_INVAL;
+  800e2b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e30:	eb 32                	jmp    800e64 <vsnprintf+0x9e>
+
+	// print the string to the buffer
+	vprintfmt((void *)sprintputch, &b, fmt, aq);
+  800e32:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800e36:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  800e3a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e3e:	48 89 c6             	mov    %rax,%rsi
+  800e41:	48 b8 78 0d 80 00 00 	movabs $0x800d78,%rax
+  800e48:	00 00 00 
+  800e4b:	48 89 c7             	mov    %rax,%rdi
+  800e4e:	48 b8 be 07 80 00 00 	movabs $0x8007be,%rax
+  800e55:	00 00 00 
+  800e58:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  800e5a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e5e:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800e61:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  800e64:	c9                   	leave
+  800e65:	c3                   	ret
+
+0000000000800e66 <snprintf>:
+
+int snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800e66:	55                   	push   %rbp
+  800e67:	48 89 e5             	mov    %rsp,%rbp
+  800e6a:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800e71:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800e78:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800e7e:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800e85:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800e8c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800e93:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800e9a:	84 c0                	test   %al,%al
+  800e9c:	74 20                	je     800ebe <snprintf+0x58>
+  800e9e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800ea2:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800ea6:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800eaa:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800eae:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800eb2:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800eb6:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800eba:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  800ebe:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800ec5:	00 00 00 
+  800ec8:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800ecf:	00 00 00 
+  800ed2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ed6:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800edd:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800ee4:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq, ap);
+  800eeb:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800ef2:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800ef9:	48 8b 06             	mov    (%rsi),%rax
+  800efc:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800f00:	48 89 01             	mov    %rax,(%rcx)
+  800f03:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800f07:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800f0b:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  800f0f:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800f16:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  800f1d:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  800f23:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800f2a:	48 89 c7             	mov    %rax,%rdi
+  800f2d:	48 b8 c6 0d 80 00 00 	movabs $0x800dc6,%rax
+  800f34:	00 00 00 
+  800f37:	ff d0                	call   *%rax
+  800f39:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  800f3f:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800f45:	c9                   	leave
+  800f46:	c3                   	ret
+
+0000000000800f47 <cpuid>:
+#define read_rip(var) __asm __volatile("leaq (%%rip), %0" : "=r" (var)::"cc","memory")
+
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800f47:	55                   	push   %rbp
+  800f48:	48 89 e5             	mov    %rsp,%rbp
+  800f4b:	53                   	push   %rbx
+  800f4c:	48 83 ec 38          	sub    $0x38,%rsp
+  800f50:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800f53:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800f57:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800f5b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800f5f:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid" 
+  800f63:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800f66:	0f a2                	cpuid
+  800f68:	89 de                	mov    %ebx,%esi
+  800f6a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800f6d:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800f70:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800f73:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info));
+	if (eaxp)
+  800f76:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800f7b:	74 09                	je     800f86 <cpuid+0x3f>
+		*eaxp = eax;
+  800f7d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f81:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800f84:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  800f86:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800f8b:	74 09                	je     800f96 <cpuid+0x4f>
+		*ebxp = ebx;
+  800f8d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f91:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800f94:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  800f96:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800f9b:	74 09                	je     800fa6 <cpuid+0x5f>
+		*ecxp = ecx;
+  800f9d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800fa1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800fa4:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  800fa6:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800fab:	74 09                	je     800fb6 <cpuid+0x6f>
+		*edxp = edx;
+  800fad:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800fb1:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800fb4:	89 10                	mov    %edx,(%rax)
+}
+  800fb6:	90                   	nop
+  800fb7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fbb:	c9                   	leave
+  800fbc:	c3                   	ret
+
+0000000000800fbd <cpuid_count>:
+
+// 带子功能号(%ecx = count)的 cpuid，用于 leaf 4/7/0xB/0xD 等
+static __inline void
+cpuid_count(uint32_t info, uint32_t count, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800fbd:	55                   	push   %rbp
+  800fbe:	48 89 e5             	mov    %rsp,%rbp
+  800fc1:	53                   	push   %rbx
+  800fc2:	48 83 ec 38          	sub    $0x38,%rsp
+  800fc6:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800fc9:	89 75 e0             	mov    %esi,-0x20(%rbp)
+  800fcc:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800fd0:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  800fd4:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+  800fd8:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800fdc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800fdf:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800fe2:	89 d1                	mov    %edx,%ecx
+  800fe4:	0f a2                	cpuid
+  800fe6:	89 de                	mov    %ebx,%esi
+  800fe8:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800feb:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800fee:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800ff1:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info), "c" (count));
+	if (eaxp)
+  800ff4:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800ff9:	74 09                	je     801004 <cpuid_count+0x47>
+		*eaxp = eax;
+  800ffb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fff:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  801002:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  801004:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801009:	74 09                	je     801014 <cpuid_count+0x57>
+		*ebxp = ebx;
+  80100b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80100f:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  801012:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  801014:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801019:	74 09                	je     801024 <cpuid_count+0x67>
+		*ecxp = ecx;
+  80101b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80101f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801022:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  801024:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801029:	74 09                	je     801034 <cpuid_count+0x77>
+		*edxp = edx;
+  80102b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80102f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801032:	89 10                	mov    %edx,(%rax)
+}
+  801034:	90                   	nop
+  801035:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801039:	c9                   	leave
+  80103a:	c3                   	ret
+
+000000000080103b <strlen>:
+// 在真正的硬件上会有一定程度的优化, 但在 Bochs 上会有更大的优化效果
+// 用这种方法, Primespipe 的运行速度快了3倍
+#define ASM 1
+
+int strlen(const char *s)
+{
+  80103b:	55                   	push   %rbp
+  80103c:	48 89 e5             	mov    %rsp,%rbp
+  80103f:	48 83 ec 18          	sub    $0x18,%rsp
+  801043:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801047:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80104e:	eb 09                	jmp    801059 <strlen+0x1e>
+		n++;
+  801050:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801054:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801059:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80105d:	0f b6 00             	movzbl (%rax),%eax
+  801060:	84 c0                	test   %al,%al
+  801062:	75 ec                	jne    801050 <strlen+0x15>
+	return n;
+  801064:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801067:	c9                   	leave
+  801068:	c3                   	ret
+
+0000000000801069 <strnlen>:
+
+int strnlen(const char *s, size_t size)
+{
+  801069:	55                   	push   %rbp
+  80106a:	48 89 e5             	mov    %rsp,%rbp
+  80106d:	48 83 ec 20          	sub    $0x20,%rsp
+  801071:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801075:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801079:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801080:	eb 0e                	jmp    801090 <strnlen+0x27>
+		n++;
+  801082:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801086:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80108b:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801090:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801095:	74 0b                	je     8010a2 <strnlen+0x39>
+  801097:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80109b:	0f b6 00             	movzbl (%rax),%eax
+  80109e:	84 c0                	test   %al,%al
+  8010a0:	75 e0                	jne    801082 <strnlen+0x19>
+	return n;
+  8010a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8010a5:	c9                   	leave
+  8010a6:	c3                   	ret
+
+00000000008010a7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8010a7:	55                   	push   %rbp
+  8010a8:	48 89 e5             	mov    %rsp,%rbp
+  8010ab:	48 83 ec 20          	sub    $0x20,%rsp
+  8010af:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8010b3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  8010b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010bb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  8010bf:	90                   	nop
+  8010c0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8010c4:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8010c8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8010cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010d0:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8010d4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8010d8:	0f b6 12             	movzbl (%rdx),%edx
+  8010db:	88 10                	mov    %dl,(%rax)
+  8010dd:	0f b6 00             	movzbl (%rax),%eax
+  8010e0:	84 c0                	test   %al,%al
+  8010e2:	75 dc                	jne    8010c0 <strcpy+0x19>
+		/* do nothing */;
+	return ret;
+  8010e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8010e8:	c9                   	leave
+  8010e9:	c3                   	ret
+
+00000000008010ea <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8010ea:	55                   	push   %rbp
+  8010eb:	48 89 e5             	mov    %rsp,%rbp
+  8010ee:	48 83 ec 20          	sub    $0x20,%rsp
+  8010f2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8010f6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int len = strlen(dst);
+  8010fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010fe:	48 89 c7             	mov    %rax,%rdi
+  801101:	48 b8 3b 10 80 00 00 	movabs $0x80103b,%rax
+  801108:	00 00 00 
+  80110b:	ff d0                	call   *%rax
+  80110d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	strcpy(dst + len, src);
+  801110:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801113:	48 63 d0             	movslq %eax,%rdx
+  801116:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80111a:	48 01 c2             	add    %rax,%rdx
+  80111d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801121:	48 89 c6             	mov    %rax,%rsi
+  801124:	48 89 d7             	mov    %rdx,%rdi
+  801127:	48 b8 a7 10 80 00 00 	movabs $0x8010a7,%rax
+  80112e:	00 00 00 
+  801131:	ff d0                	call   *%rax
+	return dst;
+  801133:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801137:	c9                   	leave
+  801138:	c3                   	ret
+
+0000000000801139 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  801139:	55                   	push   %rbp
+  80113a:	48 89 e5             	mov    %rsp,%rbp
+  80113d:	48 83 ec 28          	sub    $0x28,%rsp
+  801141:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801145:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801149:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  80114d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801151:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++)
+  801155:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80115c:	00 
+  80115d:	eb 2a                	jmp    801189 <strncpy+0x50>
+	{
+		*dst++ = *src;
+  80115f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801163:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801167:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80116b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80116f:	0f b6 12             	movzbl (%rdx),%edx
+  801172:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801174:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801178:	0f b6 00             	movzbl (%rax),%eax
+  80117b:	84 c0                	test   %al,%al
+  80117d:	74 05                	je     801184 <strncpy+0x4b>
+			src++;
+  80117f:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++)
+  801184:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801189:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80118d:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801191:	72 cc                	jb     80115f <strncpy+0x26>
+	}
+	return ret;
+  801193:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801197:	c9                   	leave
+  801198:	c3                   	ret
+
+0000000000801199 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801199:	55                   	push   %rbp
+  80119a:	48 89 e5             	mov    %rsp,%rbp
+  80119d:	48 83 ec 28          	sub    $0x28,%rsp
+  8011a1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8011a5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8011a9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  8011ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011b1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0)
+  8011b5:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8011ba:	74 3d                	je     8011f9 <strlcpy+0x60>
+	{
+		while (--size > 0 && *src != '\0')
+  8011bc:	eb 1d                	jmp    8011db <strlcpy+0x42>
+			*dst++ = *src++;
+  8011be:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8011c2:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8011c6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8011ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011ce:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8011d2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8011d6:	0f b6 12             	movzbl (%rdx),%edx
+  8011d9:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  8011db:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8011e0:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8011e5:	74 0b                	je     8011f2 <strlcpy+0x59>
+  8011e7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8011eb:	0f b6 00             	movzbl (%rax),%eax
+  8011ee:	84 c0                	test   %al,%al
+  8011f0:	75 cc                	jne    8011be <strlcpy+0x25>
+		*dst = '\0';
+  8011f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011f6:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8011f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011fd:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801201:	c9                   	leave
+  801202:	c3                   	ret
+
+0000000000801203 <strcmp>:
+
+int strcmp(const char *p, const char *q)
+{
+  801203:	55                   	push   %rbp
+  801204:	48 89 e5             	mov    %rsp,%rbp
+  801207:	48 83 ec 10          	sub    $0x10,%rsp
+  80120b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80120f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801213:	eb 0a                	jmp    80121f <strcmp+0x1c>
+		p++, q++;
+  801215:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80121a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  80121f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801223:	0f b6 00             	movzbl (%rax),%eax
+  801226:	84 c0                	test   %al,%al
+  801228:	74 12                	je     80123c <strcmp+0x39>
+  80122a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80122e:	0f b6 10             	movzbl (%rax),%edx
+  801231:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801235:	0f b6 00             	movzbl (%rax),%eax
+  801238:	38 c2                	cmp    %al,%dl
+  80123a:	74 d9                	je     801215 <strcmp+0x12>
+	return (int)((unsigned char)*p - (unsigned char)*q);
+  80123c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801240:	0f b6 00             	movzbl (%rax),%eax
+  801243:	0f b6 d0             	movzbl %al,%edx
+  801246:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80124a:	0f b6 00             	movzbl (%rax),%eax
+  80124d:	0f b6 c0             	movzbl %al,%eax
+  801250:	29 c2                	sub    %eax,%edx
+  801252:	89 d0                	mov    %edx,%eax
+}
+  801254:	c9                   	leave
+  801255:	c3                   	ret
+
+0000000000801256 <strncmp>:
+
+int strncmp(const char *p, const char *q, size_t n)
+{
+  801256:	55                   	push   %rbp
+  801257:	48 89 e5             	mov    %rsp,%rbp
+  80125a:	48 83 ec 18          	sub    $0x18,%rsp
+  80125e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801262:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801266:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80126a:	eb 0f                	jmp    80127b <strncmp+0x25>
+		n--, p++, q++;
+  80126c:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801271:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801276:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80127b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801280:	74 1d                	je     80129f <strncmp+0x49>
+  801282:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801286:	0f b6 00             	movzbl (%rax),%eax
+  801289:	84 c0                	test   %al,%al
+  80128b:	74 12                	je     80129f <strncmp+0x49>
+  80128d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801291:	0f b6 10             	movzbl (%rax),%edx
+  801294:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801298:	0f b6 00             	movzbl (%rax),%eax
+  80129b:	38 c2                	cmp    %al,%dl
+  80129d:	74 cd                	je     80126c <strncmp+0x16>
+	if (n == 0)
+  80129f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8012a4:	75 07                	jne    8012ad <strncmp+0x57>
+		return 0;
+  8012a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ab:	eb 16                	jmp    8012c3 <strncmp+0x6d>
+	else
+		return (int)((unsigned char)*p - (unsigned char)*q);
+  8012ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012b1:	0f b6 00             	movzbl (%rax),%eax
+  8012b4:	0f b6 d0             	movzbl %al,%edx
+  8012b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012bb:	0f b6 00             	movzbl (%rax),%eax
+  8012be:	0f b6 c0             	movzbl %al,%eax
+  8012c1:	29 c2                	sub    %eax,%edx
+}
+  8012c3:	89 d0                	mov    %edx,%eax
+  8012c5:	c9                   	leave
+  8012c6:	c3                   	ret
+
+00000000008012c7 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8012c7:	55                   	push   %rbp
+  8012c8:	48 89 e5             	mov    %rsp,%rbp
+  8012cb:	48 83 ec 10          	sub    $0x10,%rsp
+  8012cf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8012d3:	89 f0                	mov    %esi,%eax
+  8012d5:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8012d8:	eb 17                	jmp    8012f1 <strchr+0x2a>
+		if (*s == c)
+  8012da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012de:	0f b6 00             	movzbl (%rax),%eax
+  8012e1:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8012e4:	75 06                	jne    8012ec <strchr+0x25>
+			return (char *)s;
+  8012e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012ea:	eb 15                	jmp    801301 <strchr+0x3a>
+	for (; *s; s++)
+  8012ec:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8012f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012f5:	0f b6 00             	movzbl (%rax),%eax
+  8012f8:	84 c0                	test   %al,%al
+  8012fa:	75 de                	jne    8012da <strchr+0x13>
+	return 0;
+  8012fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801301:	c9                   	leave
+  801302:	c3                   	ret
+
+0000000000801303 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801303:	55                   	push   %rbp
+  801304:	48 89 e5             	mov    %rsp,%rbp
+  801307:	48 83 ec 10          	sub    $0x10,%rsp
+  80130b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80130f:	89 f0                	mov    %esi,%eax
+  801311:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801314:	eb 11                	jmp    801327 <strfind+0x24>
+		if (*s == c)
+  801316:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80131a:	0f b6 00             	movzbl (%rax),%eax
+  80131d:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801320:	74 12                	je     801334 <strfind+0x31>
+	for (; *s; s++)
+  801322:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801327:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80132b:	0f b6 00             	movzbl (%rax),%eax
+  80132e:	84 c0                	test   %al,%al
+  801330:	75 e4                	jne    801316 <strfind+0x13>
+  801332:	eb 01                	jmp    801335 <strfind+0x32>
+			break;
+  801334:	90                   	nop
+	return (char *)s;
+  801335:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801339:	c9                   	leave
+  80133a:	c3                   	ret
+
+000000000080133b <mem_init>:
+};
+
+static int mem_features;
+
+void mem_init(void)
+{
+  80133b:	55                   	push   %rbp
+  80133c:	48 89 e5             	mov    %rsp,%rbp
+  80133f:	48 83 ec 10          	sub    $0x10,%rsp
+	uint32_t max, ebx, edx;
+
+	mem_features = 0;
+  801343:	48 b8 28 48 80 00 00 	movabs $0x804828,%rax
+  80134a:	00 00 00 
+  80134d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	cpuid(0, &max, NULL, NULL, NULL);
+  801353:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+  801357:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80135d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801362:	ba 00 00 00 00       	mov    $0x0,%edx
+  801367:	48 89 c6             	mov    %rax,%rsi
+  80136a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80136f:	48 b8 47 0f 80 00 00 	movabs $0x800f47,%rax
+  801376:	00 00 00 
+  801379:	ff d0                	call   *%rax
+	cpuid(1, NULL, NULL, NULL, &edx);
+  80137b:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  80137f:	49 89 c0             	mov    %rax,%r8
+  801382:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801387:	ba 00 00 00 00       	mov    $0x0,%edx
+  80138c:	be 00 00 00 00       	mov    $0x0,%esi
+  801391:	bf 01 00 00 00       	mov    $0x1,%edi
+  801396:	48 b8 47 0f 80 00 00 	movabs $0x800f47,%rax
+  80139d:	00 00 00 
+  8013a0:	ff d0                	call   *%rax
+	if (edx & (1 << 26))
+  8013a2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8013a5:	25 00 00 00 04       	and    $0x4000000,%eax
+  8013aa:	85 c0                	test   %eax,%eax
+  8013ac:	74 1d                	je     8013cb <mem_init+0x90>
+		mem_features |= MEM_F_NT;
+  8013ae:	48 b8 28 48 80 00 00 	movabs $0x804828,%rax
+  8013b5:	00 00 00 
+  8013b8:	8b 00                	mov    (%rax),%eax
+  8013ba:	83 c8 02             	or     $0x2,%eax
+  8013bd:	89 c2                	mov    %eax,%edx
+  8013bf:	48 b8 28 48 80 00 00 	movabs $0x804828,%rax
+  8013c6:	00 00 00 
+  8013c9:	89 10                	mov    %edx,(%rax)
+	if (max >= 7)
+  8013cb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8013ce:	83 f8 06             	cmp    $0x6,%eax
+  8013d1:	76 57                	jbe    80142a <mem_init+0xef>
+	{
+		cpuid_count(7, 0, NULL, &ebx, NULL, NULL);
+  8013d3:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  8013d7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8013dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013e3:	48 89 c1             	mov    %rax,%rcx
+  8013e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f0:	bf 07 00 00 00       	mov    $0x7,%edi
+  8013f5:	48 b8 bd 0f 80 00 00 	movabs $0x800fbd,%rax
+  8013fc:	00 00 00 
+  8013ff:	ff d0                	call   *%rax
+		if (ebx & (1 << 9))
+  801401:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801404:	25 00 02 00 00       	and    $0x200,%eax
+  801409:	85 c0                	test   %eax,%eax
+  80140b:	74 1d                	je     80142a <mem_init+0xef>
+			mem_features |= MEM_F_ERMS;
+  80140d:	48 b8 28 48 80 00 00 	movabs $0x804828,%rax
+  801414:	00 00 00 
+  801417:	8b 00                	mov    (%rax),%eax
+  801419:	83 c8 01             	or     $0x1,%eax
+  80141c:	89 c2                	mov    %eax,%edx
+  80141e:	48 b8 28 48 80 00 00 	movabs $0x804828,%rax
+  801425:	00 00 00 
+  801428:	89 10                	mov    %edx,(%rax)
+	}
+}
+  80142a:	90                   	nop
+  80142b:	c9                   	leave
+  80142c:	c3                   	ret
+
+000000000080142d <memset_nt>:
+
+// 非临时存储填充 n 字节(v 8 字节对齐，n 为 32 的倍数)
+static void
+memset_nt(void *v, uint64_t pattern, size_t n)
+{
+  80142d:	55                   	push   %rbp
+  80142e:	48 89 e5             	mov    %rsp,%rbp
+  801431:	48 83 ec 28          	sub    $0x28,%rsp
+  801435:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801439:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80143d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t *p = (uint64_t *)v;
+  801441:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801445:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint64_t *end = p + n / 8;
+  801449:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80144d:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  801451:	48 89 c2             	mov    %rax,%rdx
+  801454:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801458:	48 01 d0             	add    %rdx,%rax
+  80145b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	for (; p < end; p += 4)
+  80145f:	eb 20                	jmp    801481 <memset_nt+0x54>
+		asm volatile("movnti %1, 0(%0)\n\t"
+  801461:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801465:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801469:	48 0f c3 10          	movnti %rdx,(%rax)
+  80146d:	48 0f c3 50 08       	movnti %rdx,0x8(%rax)
+  801472:	48 0f c3 50 10       	movnti %rdx,0x10(%rax)
+  801477:	48 0f c3 50 18       	movnti %rdx,0x18(%rax)
+	for (; p < end; p += 4)
+  80147c:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  801481:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801485:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801489:	72 d6                	jb     801461 <memset_nt+0x34>
+					 "movnti %1, 16(%0)\n\t"
+					 "movnti %1, 24(%0)"
+					 :
+					 : "r"(p), "r"(pattern)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  80148b:	0f ae f8             	sfence
+}
+  80148e:	90                   	nop
+  80148f:	c9                   	leave
+  801490:	c3                   	ret
+
+0000000000801491 <memcpy_nt>:
+
+// 非临时存储复制 n 字节(dst/src 8 字节对齐且不重叠，n 为 32 的倍数)
+static void
+memcpy_nt(void *dst, const void *src, size_t n)
+{
+  801491:	55                   	push   %rbp
+  801492:	48 89 e5             	mov    %rsp,%rbp
+  801495:	48 83 ec 58          	sub    $0x58,%rsp
+  801499:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80149d:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8014a1:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	uint64_t *d = (uint64_t *)dst;
+  8014a5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8014a9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint64_t *s = (const uint64_t *)src;
+  8014ad:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8014b1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	uint64_t *end = d + n / 8;
+  8014b5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8014b9:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  8014bd:	48 89 c2             	mov    %rax,%rdx
+  8014c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014c4:	48 01 d0             	add    %rdx,%rax
+  8014c7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint64_t t0, t1, t2, t3;
+
+	for (; d < end; d += 4, s += 4)
+  8014cb:	eb 44                	jmp    801511 <memcpy_nt+0x80>
+		asm volatile("movq 0(%4), %0\n\t"
+  8014cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014d1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8014d5:	4c 8b 00             	mov    (%rax),%r8
+  8014d8:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  8014dc:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  8014e0:	48 8b 48 18          	mov    0x18(%rax),%rcx
+  8014e4:	4c 0f c3 02          	movnti %r8,(%rdx)
+  8014e8:	48 0f c3 7a 08       	movnti %rdi,0x8(%rdx)
+  8014ed:	48 0f c3 72 10       	movnti %rsi,0x10(%rdx)
+  8014f2:	48 0f c3 4a 18       	movnti %rcx,0x18(%rdx)
+  8014f7:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8014fb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8014ff:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801503:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+	for (; d < end; d += 4, s += 4)
+  801507:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  80150c:	48 83 45 f0 20       	addq   $0x20,-0x10(%rbp)
+  801511:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801515:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  801519:	72 b2                	jb     8014cd <memcpy_nt+0x3c>
+					 "movnti %2, 16(%5)\n\t"
+					 "movnti %3, 24(%5)"
+					 : "=&r"(t0), "=&r"(t1), "=&r"(t2), "=&r"(t3)
+					 : "r"(s), "r"(d)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  80151b:	0f ae f8             	sfence
+}
+  80151e:	90                   	nop
+  80151f:	c9                   	leave
+  801520:	c3                   	ret
+
+0000000000801521 <memcpy_fwd>:
+
+// 正向复制(dst 在 src 之前或两者不重叠)
+static void
+memcpy_fwd(void *dst, const void *src, size_t n)
+{
+  801521:	55                   	push   %rbp
+  801522:	48 89 e5             	mov    %rsp,%rbp
+  801525:	48 83 ec 18          	sub    $0x18,%rsp
+  801529:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80152d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801531:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  801535:	48 b8 28 48 80 00 00 	movabs $0x804828,%rax
+  80153c:	00 00 00 
+  80153f:	8b 00                	mov    (%rax),%eax
+  801541:	83 e0 02             	and    $0x2,%eax
+  801544:	85 c0                	test   %eax,%eax
+  801546:	74 66                	je     8015ae <memcpy_fwd+0x8d>
+  801548:	48 81 7d e8 ff 0f 00 	cmpq   $0xfff,-0x18(%rbp)
+  80154f:	00 
+  801550:	76 5c                	jbe    8015ae <memcpy_fwd+0x8d>
+  801552:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801556:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80155a:	48 09 d0             	or     %rdx,%rax
+  80155d:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  801561:	83 e0 1f             	and    $0x1f,%eax
+  801564:	48 85 c0             	test   %rax,%rax
+  801567:	75 45                	jne    8015ae <memcpy_fwd+0x8d>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  801569:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80156d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801571:	48 01 d0             	add    %rdx,%rax
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  801574:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801578:	73 11                	jae    80158b <memcpy_fwd+0x6a>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  80157a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80157e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801582:	48 01 d0             	add    %rdx,%rax
+  801585:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801589:	72 23                	jb     8015ae <memcpy_fwd+0x8d>
+		memcpy_nt(dst, src, n);
+  80158b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80158f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801593:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801597:	48 89 ce             	mov    %rcx,%rsi
+  80159a:	48 89 c7             	mov    %rax,%rdi
+  80159d:	48 b8 91 14 80 00 00 	movabs $0x801491,%rax
+  8015a4:	00 00 00 
+  8015a7:	ff d0                	call   *%rax
+  8015a9:	e9 81 00 00 00       	jmp    80162f <memcpy_fwd+0x10e>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  8015ae:	48 b8 28 48 80 00 00 	movabs $0x804828,%rax
+  8015b5:	00 00 00 
+  8015b8:	8b 00                	mov    (%rax),%eax
+  8015ba:	83 e0 01             	and    $0x1,%eax
+  8015bd:	85 c0                	test   %eax,%eax
+  8015bf:	74 21                	je     8015e2 <memcpy_fwd+0xc1>
+  8015c1:	48 81 7d e8 ff 00 00 	cmpq   $0xff,-0x18(%rbp)
+  8015c8:	00 
+  8015c9:	76 17                	jbe    8015e2 <memcpy_fwd+0xc1>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  8015cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015cf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8015d3:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8015d7:	48 89 c7             	mov    %rax,%rdi
+  8015da:	48 89 d6             	mov    %rdx,%rsi
+  8015dd:	fc                   	cld
+  8015de:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8015e0:	eb 4d                	jmp    80162f <memcpy_fwd+0x10e>
+					 : "cc", "memory");
+	else if ((((uint64_t)dst | (uint64_t)src | n) & 7) == 0)
+  8015e2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8015e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015ea:	48 09 d0             	or     %rdx,%rax
+  8015ed:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  8015f1:	83 e0 07             	and    $0x7,%eax
+  8015f4:	48 85 c0             	test   %rax,%rax
+  8015f7:	75 1f                	jne    801618 <memcpy_fwd+0xf7>
+		asm volatile("cld; rep movsq\n" ::"D"(dst), "S"(src), "c"(n / 8)
+  8015f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015fd:	48 c1 e8 03          	shr    $0x3,%rax
+  801601:	48 89 c1             	mov    %rax,%rcx
+  801604:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801608:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80160c:	48 89 c7             	mov    %rax,%rdi
+  80160f:	48 89 d6             	mov    %rdx,%rsi
+  801612:	fc                   	cld
+  801613:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+					 : "cc", "memory");
+}
+  801616:	eb 17                	jmp    80162f <memcpy_fwd+0x10e>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  801618:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80161c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801620:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801624:	48 89 c7             	mov    %rax,%rdi
+  801627:	48 89 d6             	mov    %rdx,%rsi
+  80162a:	fc                   	cld
+  80162b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+  80162d:	eb 00                	jmp    80162f <memcpy_fwd+0x10e>
+  80162f:	90                   	nop
+  801630:	c9                   	leave
+  801631:	c3                   	ret
+
+0000000000801632 <memset>:
+
+void *
+memset(void *v, int c, size_t n)
+{
+  801632:	55                   	push   %rbp
+  801633:	48 89 e5             	mov    %rsp,%rbp
+  801636:	48 83 ec 28          	sub    $0x28,%rsp
+  80163a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80163e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801641:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t pattern;
+
+	if (n == 0)
+  801645:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80164a:	75 09                	jne    801655 <memset+0x23>
+		return v;
+  80164c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801650:	e9 dc 00 00 00       	jmp    801731 <memset+0xff>
+	c &= 0xFF;
+  801655:	81 65 e4 ff 00 00 00 	andl   $0xff,-0x1c(%rbp)
+	pattern = (uint64_t)c * 0x0101010101010101UL;
+  80165c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80165f:	48 98                	cltq
+  801661:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801668:	01 01 01 
+  80166b:	48 0f af c2          	imul   %rdx,%rax
+  80166f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)v | n) & 31) == 0)
+  801673:	48 b8 28 48 80 00 00 	movabs $0x804828,%rax
+  80167a:	00 00 00 
+  80167d:	8b 00                	mov    (%rax),%eax
+  80167f:	83 e0 02             	and    $0x2,%eax
+  801682:	85 c0                	test   %eax,%eax
+  801684:	74 3a                	je     8016c0 <memset+0x8e>
+  801686:	48 81 7d d8 ff 0f 00 	cmpq   $0xfff,-0x28(%rbp)
+  80168d:	00 
+  80168e:	76 30                	jbe    8016c0 <memset+0x8e>
+  801690:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801694:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  801698:	83 e0 1f             	and    $0x1f,%eax
+  80169b:	48 85 c0             	test   %rax,%rax
+  80169e:	75 20                	jne    8016c0 <memset+0x8e>
+		memset_nt(v, pattern, n);
+  8016a0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8016a4:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8016a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016ac:	48 89 ce             	mov    %rcx,%rsi
+  8016af:	48 89 c7             	mov    %rax,%rdi
+  8016b2:	48 b8 2d 14 80 00 00 	movabs $0x80142d,%rax
+  8016b9:	00 00 00 
+  8016bc:	ff d0                	call   *%rax
+  8016be:	eb 6d                	jmp    80172d <memset+0xfb>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  8016c0:	48 b8 28 48 80 00 00 	movabs $0x804828,%rax
+  8016c7:	00 00 00 
+  8016ca:	8b 00                	mov    (%rax),%eax
+  8016cc:	83 e0 01             	and    $0x1,%eax
+  8016cf:	85 c0                	test   %eax,%eax
+  8016d1:	74 1d                	je     8016f0 <memset+0xbe>
+  8016d3:	48 81 7d d8 ff 00 00 	cmpq   $0xff,-0x28(%rbp)
+  8016da:	00 
+  8016db:	76 13                	jbe    8016f0 <memset+0xbe>
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  8016dd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8016e1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8016e4:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8016e8:	48 89 d7             	mov    %rdx,%rdi
+  8016eb:	fc                   	cld
+  8016ec:	f3 aa                	rep stos %al,%es:(%rdi)
+  8016ee:	eb 3d                	jmp    80172d <memset+0xfb>
+					 : "cc", "memory");
+	else if ((((uint64_t)v | n) & 7) == 0)
+  8016f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016f4:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  8016f8:	83 e0 07             	and    $0x7,%eax
+  8016fb:	48 85 c0             	test   %rax,%rax
+  8016fe:	75 1c                	jne    80171c <memset+0xea>
+		asm volatile("cld; rep stosq\n" ::"D"(v), "a"(pattern), "c"(n / 8)
+  801700:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801704:	48 c1 e8 03          	shr    $0x3,%rax
+  801708:	48 89 c1             	mov    %rax,%rcx
+  80170b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80170f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801713:	48 89 d7             	mov    %rdx,%rdi
+  801716:	fc                   	cld
+  801717:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  80171a:	eb 11                	jmp    80172d <memset+0xfb>
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  80171c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801720:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801723:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801727:	48 89 d7             	mov    %rdx,%rdi
+  80172a:	fc                   	cld
+  80172b:	f3 aa                	rep stos %al,%es:(%rdi)
+					 : "cc", "memory");
+	return v;
+  80172d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801731:	c9                   	leave
+  801732:	c3                   	ret
+
+0000000000801733 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801733:	55                   	push   %rbp
+  801734:	48 89 e5             	mov    %rsp,%rbp
+  801737:	48 83 ec 28          	sub    $0x28,%rsp
+  80173b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80173f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801743:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801747:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80174b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  80174f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801753:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d)
+  801757:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80175b:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80175f:	73 7c                	jae    8017dd <memmove+0xaa>
+  801761:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801765:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801769:	48 01 d0             	add    %rdx,%rax
+  80176c:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801770:	73 6b                	jae    8017dd <memmove+0xaa>
+	{
+		// 重叠且 dst 在 src 之后，只能反向复制(ERMS 对反向 rep movsb 没有优化)
+		s += n;
+  801772:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801776:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  80177a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80177e:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((((uint64_t)s | (uint64_t)d | n) & 7) == 0)
+  801782:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801786:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80178a:	48 09 d0             	or     %rdx,%rax
+  80178d:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  801791:	83 e0 07             	and    $0x7,%eax
+  801794:	48 85 c0             	test   %rax,%rax
+  801797:	75 24                	jne    8017bd <memmove+0x8a>
+			asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801799:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80179d:	48 83 e8 08          	sub    $0x8,%rax
+  8017a1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017a5:	48 83 ea 08          	sub    $0x8,%rdx
+  8017a9:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8017ad:	48 c1 e9 03          	shr    $0x3,%rcx
+  8017b1:	48 89 c7             	mov    %rax,%rdi
+  8017b4:	48 89 d6             	mov    %rdx,%rsi
+  8017b7:	fd                   	std
+  8017b8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8017bb:	eb 1d                	jmp    8017da <memmove+0xa7>
+						 : "cc", "memory");
+		else
+			asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8017bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017c1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8017c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017c9:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+  8017cd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017d1:	48 89 d7             	mov    %rdx,%rdi
+  8017d4:	48 89 c1             	mov    %rax,%rcx
+  8017d7:	fd                   	std
+  8017d8:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+						 : "cc", "memory");
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::
+  8017da:	fc                   	cld
+  8017db:	eb 25                	jmp    801802 <memmove+0xcf>
+						 : "cc");
+	}
+	else if (n)
+  8017dd:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8017e2:	74 1e                	je     801802 <memmove+0xcf>
+		memcpy_fwd(d, s, n);
+  8017e4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8017e8:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8017ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017f0:	48 89 ce             	mov    %rcx,%rsi
+  8017f3:	48 89 c7             	mov    %rax,%rdi
+  8017f6:	48 b8 21 15 80 00 00 	movabs $0x801521,%rax
+  8017fd:	00 00 00 
+  801800:	ff d0                	call   *%rax
+	return dst;
+  801802:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801806:	c9                   	leave
+  801807:	c3                   	ret
+
+0000000000801808 <memcpy>:
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801808:	55                   	push   %rbp
+  801809:	48 89 e5             	mov    %rsp,%rbp
+  80180c:	48 83 ec 18          	sub    $0x18,%rsp
+  801810:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801814:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801818:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (n)
+  80181c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801821:	74 1e                	je     801841 <memcpy+0x39>
+		memcpy_fwd(dst, src, n);
+  801823:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801827:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80182b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80182f:	48 89 ce             	mov    %rcx,%rsi
+  801832:	48 89 c7             	mov    %rax,%rdi
+  801835:	48 b8 21 15 80 00 00 	movabs $0x801521,%rax
+  80183c:	00 00 00 
+  80183f:	ff d0                	call   *%rax
+	return dst;
+  801841:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801845:	c9                   	leave
+  801846:	c3                   	ret
+
+0000000000801847 <memcmp>:
+{
+}
+#endif
+
+int memcmp(const void *v1, const void *v2, size_t n)
+{
+  801847:	55                   	push   %rbp
+  801848:	48 89 e5             	mov    %rsp,%rbp
+  80184b:	48 83 ec 28          	sub    $0x28,%rsp
+  80184f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801853:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801857:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *)v1;
+  80185b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80185f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *)v2;
+  801863:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801867:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0)
+  80186b:	eb 34                	jmp    8018a1 <memcmp+0x5a>
+	{
+		if (*s1 != *s2)
+  80186d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801871:	0f b6 10             	movzbl (%rax),%edx
+  801874:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801878:	0f b6 00             	movzbl (%rax),%eax
+  80187b:	38 c2                	cmp    %al,%dl
+  80187d:	74 18                	je     801897 <memcmp+0x50>
+			return (int)*s1 - (int)*s2;
+  80187f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801883:	0f b6 00             	movzbl (%rax),%eax
+  801886:	0f b6 d0             	movzbl %al,%edx
+  801889:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80188d:	0f b6 00             	movzbl (%rax),%eax
+  801890:	0f b6 c0             	movzbl %al,%eax
+  801893:	29 c2                	sub    %eax,%edx
+  801895:	eb 20                	jmp    8018b7 <memcmp+0x70>
+		s1++, s2++;
+  801897:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80189c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0)
+  8018a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018a5:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8018a9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8018ad:	48 85 c0             	test   %rax,%rax
+  8018b0:	75 bb                	jne    80186d <memcmp+0x26>
+	}
+
+	return 0;
+  8018b2:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  8018b7:	89 d0                	mov    %edx,%eax
+  8018b9:	c9                   	leave
+  8018ba:	c3                   	ret
+
+00000000008018bb <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8018bb:	55                   	push   %rbp
+  8018bc:	48 89 e5             	mov    %rsp,%rbp
+  8018bf:	48 83 ec 28          	sub    $0x28,%rsp
+  8018c3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8018c7:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8018ca:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *)s + n;
+  8018ce:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018d2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018d6:	48 01 d0             	add    %rdx,%rax
+  8018d9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  8018dd:	eb 13                	jmp    8018f2 <memfind+0x37>
+		if (*(const unsigned char *)s == (unsigned char)c)
+  8018df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018e3:	0f b6 00             	movzbl (%rax),%eax
+  8018e6:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8018e9:	38 d0                	cmp    %dl,%al
+  8018eb:	74 11                	je     8018fe <memfind+0x43>
+	for (; s < ends; s++)
+  8018ed:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8018f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018f6:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8018fa:	72 e3                	jb     8018df <memfind+0x24>
+  8018fc:	eb 01                	jmp    8018ff <memfind+0x44>
+			break;
+  8018fe:	90                   	nop
+	return (void *)s;
+  8018ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801903:	c9                   	leave
+  801904:	c3                   	ret
+
+0000000000801905 <strtol>:
+
+long strtol(const char *s, char **endptr, int base)
+{
+  801905:	55                   	push   %rbp
+  801906:	48 89 e5             	mov    %rsp,%rbp
+  801909:	48 83 ec 38          	sub    $0x38,%rsp
+  80190d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801911:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801915:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801918:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  80191f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801926:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801927:	eb 05                	jmp    80192e <strtol+0x29>
+		s++;
+  801929:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  80192e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801932:	0f b6 00             	movzbl (%rax),%eax
+  801935:	3c 20                	cmp    $0x20,%al
+  801937:	74 f0                	je     801929 <strtol+0x24>
+  801939:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80193d:	0f b6 00             	movzbl (%rax),%eax
+  801940:	3c 09                	cmp    $0x9,%al
+  801942:	74 e5                	je     801929 <strtol+0x24>
+
+	// plus/minus sign
+	if (*s == '+')
+  801944:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801948:	0f b6 00             	movzbl (%rax),%eax
+  80194b:	3c 2b                	cmp    $0x2b,%al
+  80194d:	75 07                	jne    801956 <strtol+0x51>
+		s++;
+  80194f:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801954:	eb 17                	jmp    80196d <strtol+0x68>
+	else if (*s == '-')
+  801956:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80195a:	0f b6 00             	movzbl (%rax),%eax
+  80195d:	3c 2d                	cmp    $0x2d,%al
+  80195f:	75 0c                	jne    80196d <strtol+0x68>
+		s++, neg = 1;
+  801961:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801966:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80196d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801971:	74 06                	je     801979 <strtol+0x74>
+  801973:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801977:	75 28                	jne    8019a1 <strtol+0x9c>
+  801979:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80197d:	0f b6 00             	movzbl (%rax),%eax
+  801980:	3c 30                	cmp    $0x30,%al
+  801982:	75 1d                	jne    8019a1 <strtol+0x9c>
+  801984:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801988:	48 83 c0 01          	add    $0x1,%rax
+  80198c:	0f b6 00             	movzbl (%rax),%eax
+  80198f:	3c 78                	cmp    $0x78,%al
+  801991:	75 0e                	jne    8019a1 <strtol+0x9c>
+		s += 2, base = 16;
+  801993:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801998:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  80199f:	eb 2c                	jmp    8019cd <strtol+0xc8>
+	else if (base == 0 && s[0] == '0')
+  8019a1:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8019a5:	75 19                	jne    8019c0 <strtol+0xbb>
+  8019a7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019ab:	0f b6 00             	movzbl (%rax),%eax
+  8019ae:	3c 30                	cmp    $0x30,%al
+  8019b0:	75 0e                	jne    8019c0 <strtol+0xbb>
+		s++, base = 8;
+  8019b2:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8019b7:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  8019be:	eb 0d                	jmp    8019cd <strtol+0xc8>
+	else if (base == 0)
+  8019c0:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8019c4:	75 07                	jne    8019cd <strtol+0xc8>
+		base = 10;
+  8019c6:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+	// digits
+	while (1)
+	{
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  8019cd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019d1:	0f b6 00             	movzbl (%rax),%eax
+  8019d4:	3c 2f                	cmp    $0x2f,%al
+  8019d6:	7e 1d                	jle    8019f5 <strtol+0xf0>
+  8019d8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019dc:	0f b6 00             	movzbl (%rax),%eax
+  8019df:	3c 39                	cmp    $0x39,%al
+  8019e1:	7f 12                	jg     8019f5 <strtol+0xf0>
+			dig = *s - '0';
+  8019e3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019e7:	0f b6 00             	movzbl (%rax),%eax
+  8019ea:	0f be c0             	movsbl %al,%eax
+  8019ed:	83 e8 30             	sub    $0x30,%eax
+  8019f0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8019f3:	eb 4e                	jmp    801a43 <strtol+0x13e>
+		else if (*s >= 'a' && *s <= 'z')
+  8019f5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019f9:	0f b6 00             	movzbl (%rax),%eax
+  8019fc:	3c 60                	cmp    $0x60,%al
+  8019fe:	7e 1d                	jle    801a1d <strtol+0x118>
+  801a00:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a04:	0f b6 00             	movzbl (%rax),%eax
+  801a07:	3c 7a                	cmp    $0x7a,%al
+  801a09:	7f 12                	jg     801a1d <strtol+0x118>
+			dig = *s - 'a' + 10;
+  801a0b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a0f:	0f b6 00             	movzbl (%rax),%eax
+  801a12:	0f be c0             	movsbl %al,%eax
+  801a15:	83 e8 57             	sub    $0x57,%eax
+  801a18:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801a1b:	eb 26                	jmp    801a43 <strtol+0x13e>
+		else if (*s >= 'A' && *s <= 'Z')
+  801a1d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a21:	0f b6 00             	movzbl (%rax),%eax
+  801a24:	3c 40                	cmp    $0x40,%al
+  801a26:	7e 47                	jle    801a6f <strtol+0x16a>
+  801a28:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a2c:	0f b6 00             	movzbl (%rax),%eax
+  801a2f:	3c 5a                	cmp    $0x5a,%al
+  801a31:	7f 3c                	jg     801a6f <strtol+0x16a>
+			dig = *s - 'A' + 10;
+  801a33:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a37:	0f b6 00             	movzbl (%rax),%eax
+  801a3a:	0f be c0             	movsbl %al,%eax
+  801a3d:	83 e8 37             	sub    $0x37,%eax
+  801a40:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801a43:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801a46:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801a49:	7d 23                	jge    801a6e <strtol+0x169>
+			break;
+		s++, val = (val * base) + dig;
+  801a4b:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a50:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801a53:	48 98                	cltq
+  801a55:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801a5a:	48 89 c2             	mov    %rax,%rdx
+  801a5d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801a60:	48 98                	cltq
+  801a62:	48 01 d0             	add    %rdx,%rax
+  801a65:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+  801a69:	e9 5f ff ff ff       	jmp    8019cd <strtol+0xc8>
+			break;
+  801a6e:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801a6f:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801a74:	74 0b                	je     801a81 <strtol+0x17c>
+		*endptr = (char *)s;
+  801a76:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a7a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801a7e:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801a81:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801a85:	74 09                	je     801a90 <strtol+0x18b>
+  801a87:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a8b:	48 f7 d8             	neg    %rax
+  801a8e:	eb 04                	jmp    801a94 <strtol+0x18f>
+  801a90:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801a94:	c9                   	leave
+  801a95:	c3                   	ret
+
+0000000000801a96 <strstr>:
+
+char *strstr(const char *in, const char *str)
+{
+  801a96:	55                   	push   %rbp
+  801a97:	48 89 e5             	mov    %rsp,%rbp
+  801a9a:	48 83 ec 30          	sub    $0x30,%rsp
+  801a9e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801aa2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801aa6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801aaa:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801aae:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801ab2:	0f b6 00             	movzbl (%rax),%eax
+  801ab5:	88 45 ff             	mov    %al,-0x1(%rbp)
+	if (!c)
+  801ab8:	80 7d ff 00          	cmpb   $0x0,-0x1(%rbp)
+  801abc:	75 06                	jne    801ac4 <strstr+0x2e>
+		return (char *)in; // Trivial empty string case
+  801abe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ac2:	eb 6b                	jmp    801b2f <strstr+0x99>
+
+	len = strlen(str);
+  801ac4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ac8:	48 89 c7             	mov    %rax,%rdi
+  801acb:	48 b8 3b 10 80 00 00 	movabs $0x80103b,%rax
+  801ad2:	00 00 00 
+  801ad5:	ff d0                	call   *%rax
+  801ad7:	48 98                	cltq
+  801ad9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+		char sc;
+
+		do
+		{
+			sc = *in++;
+  801add:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ae1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801ae5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801ae9:	0f b6 00             	movzbl (%rax),%eax
+  801aec:	88 45 ef             	mov    %al,-0x11(%rbp)
+			if (!sc)
+  801aef:	80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+  801af3:	75 07                	jne    801afc <strstr+0x66>
+				return (char *)0;
+  801af5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801afa:	eb 33                	jmp    801b2f <strstr+0x99>
+		} while (sc != c);
+  801afc:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+  801b00:	3a 45 ff             	cmp    -0x1(%rbp),%al
+  801b03:	75 d8                	jne    801add <strstr+0x47>
+	} while (strncmp(in, str, len) != 0);
+  801b05:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801b09:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801b0d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b11:	48 89 ce             	mov    %rcx,%rsi
+  801b14:	48 89 c7             	mov    %rax,%rdi
+  801b17:	48 b8 56 12 80 00 00 	movabs $0x801256,%rax
+  801b1e:	00 00 00 
+  801b21:	ff d0                	call   *%rax
+  801b23:	85 c0                	test   %eax,%eax
+  801b25:	75 b6                	jne    801add <strstr+0x47>
+
+	return (char *)(in - 1);
+  801b27:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b2b:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801b2f:	c9                   	leave
+  801b30:	c3                   	ret
+
+0000000000801b31 <syscall>:
+ * 用户的指令式系统调用，该函数将系统调用序号放入eax寄存器，五个参数依次放入edx, ecx, ebx, edi, esi，然后执行指令int 0x30，
+ * 发生中断后，去IDT中查找中断处理函数，最终会走到kern/trap.c的trap_dispatch()中
+ */
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801b31:	55                   	push   %rbp
+  801b32:	48 89 e5             	mov    %rsp,%rbp
+  801b35:	53                   	push   %rbx
+  801b36:	48 83 ec 48          	sub    $0x48,%rsp
+  801b3a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801b3d:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801b40:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801b44:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801b48:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801b4c:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	 * volatile 告诉汇编程序不要因为不使用返回值就优化该指令
+	 * 最后一个子句告诉汇编程序，指令可能会改变条件代码cx和任意内存memory位置
+	 * 由汇编编译器做好数据保存和恢复工作(栈)
+	 */
+
+	asm volatile("int %1\n"			// code: int T_SYSCALL
+  801b50:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801b53:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801b57:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801b5b:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801b5f:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801b63:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801b67:	4c 89 c3             	mov    %r8,%rbx
+  801b6a:	cd 30                	int    $0x30
+  801b6c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+				   "D"(a4),			// edi = a4
+				   "S"(a5)			// esi = a5
+				 : "cc", "memory"); // 指令可能会改变条件代码cx和任意内存memory位置
+									// 由汇编编译器做好数据保存和恢复工作(栈)
+
+	if (check && ret > 0)
+  801b70:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801b74:	74 44                	je     801bba <syscall+0x89>
+  801b76:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801b7b:	7e 3d                	jle    801bba <syscall+0x89>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b7d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b81:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801b84:	49 89 d0             	mov    %rdx,%r8
+  801b87:	89 c1                	mov    %eax,%ecx
+  801b89:	48 b8 68 29 80 00 00 	movabs $0x802968,%rax
+  801b90:	00 00 00 
+  801b93:	48 89 c2             	mov    %rax,%rdx
+  801b96:	be 34 00 00 00       	mov    $0x34,%esi
+  801b9b:	48 b8 85 29 80 00 00 	movabs $0x802985,%rax
+  801ba2:	00 00 00 
+  801ba5:	48 89 c7             	mov    %rax,%rdi
+  801ba8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bad:	49 b9 a4 22 80 00 00 	movabs $0x8022a4,%r9
+  801bb4:	00 00 00 
+  801bb7:	41 ff d1             	call   *%r9
+
+	return ret;
+  801bba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801bbe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bc2:	c9                   	leave
+  801bc3:	c3                   	ret
+
+0000000000801bc4 <sys_cputs>:
+
+void sys_cputs(const char *s, size_t len)
+{
+  801bc4:	55                   	push   %rbp
+  801bc5:	48 89 e5             	mov    %rsp,%rbp
+  801bc8:	48 83 ec 10          	sub    $0x10,%rsp
+  801bcc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801bd0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 调用lib/syscall.c中的syscall()
+	// SYS_cputs: 系统调用序号(eax)，s: 需要输出的字符数组，len: 数组长度
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801bd4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bd8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801bdc:	48 83 ec 08          	sub    $0x8,%rsp
+  801be0:	6a 00                	push   $0x0
+  801be2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801be8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801bee:	48 89 d1             	mov    %rdx,%rcx
+  801bf1:	48 89 c2             	mov    %rax,%rdx
+  801bf4:	be 00 00 00 00       	mov    $0x0,%esi
+  801bf9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bfe:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  801c05:	00 00 00 
+  801c08:	ff d0                	call   *%rax
+  801c0a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c0e:	90                   	nop
+  801c0f:	c9                   	leave
+  801c10:	c3                   	ret
+
+0000000000801c11 <sys_cgetc>:
+
+int sys_cgetc(void)
+{
+  801c11:	55                   	push   %rbp
+  801c12:	48 89 e5             	mov    %rsp,%rbp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801c15:	48 83 ec 08          	sub    $0x8,%rsp
+  801c19:	6a 00                	push   $0x0
+  801c1b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801c21:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c27:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c31:	be 00 00 00 00       	mov    $0x0,%esi
+  801c36:	bf 01 00 00 00       	mov    $0x1,%edi
+  801c3b:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  801c42:	00 00 00 
+  801c45:	ff d0                	call   *%rax
+  801c47:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c4b:	c9                   	leave
+  801c4c:	c3                   	ret
+
+0000000000801c4d <sys_env_destroy>:
+
+int sys_env_destroy(envid_t envid)
+{
+  801c4d:	55                   	push   %rbp
+  801c4e:	48 89 e5             	mov    %rsp,%rbp
+  801c51:	48 83 ec 10          	sub    $0x10,%rsp
+  801c55:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	// 销毁envid对应的环境
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801c58:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801c5b:	48 98                	cltq
+  801c5d:	48 83 ec 08          	sub    $0x8,%rsp
+  801c61:	6a 00                	push   $0x0
+  801c63:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801c69:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c74:	48 89 c2             	mov    %rax,%rdx
+  801c77:	be 01 00 00 00       	mov    $0x1,%esi
+  801c7c:	bf 03 00 00 00       	mov    $0x3,%edi
+  801c81:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  801c88:	00 00 00 
+  801c8b:	ff d0                	call   *%rax
+  801c8d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c91:	c9                   	leave
+  801c92:	c3                   	ret
+
+0000000000801c93 <sys_getprocid>:
+
+envid_t
+sys_getprocid(void)
+{
+  801c93:	55                   	push   %rbp
+  801c94:	48 89 e5             	mov    %rsp,%rbp
+	// 获取当前用户环境id
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801c97:	48 83 ec 08          	sub    $0x8,%rsp
+  801c9b:	6a 00                	push   $0x0
+  801c9d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ca3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ca9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cae:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cb3:	be 00 00 00 00       	mov    $0x0,%esi
+  801cb8:	bf 02 00 00 00       	mov    $0x2,%edi
+  801cbd:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  801cc4:	00 00 00 
+  801cc7:	ff d0                	call   *%rax
+  801cc9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ccd:	c9                   	leave
+  801cce:	c3                   	ret
+
+0000000000801ccf <sys_yield>:
+
+void sys_yield(void)
+{
+  801ccf:	55                   	push   %rbp
+  801cd0:	48 89 e5             	mov    %rsp,%rbp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801cd3:	48 83 ec 08          	sub    $0x8,%rsp
+  801cd7:	6a 00                	push   $0x0
+  801cd9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801cdf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ce5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cea:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cef:	be 00 00 00 00       	mov    $0x0,%esi
+  801cf4:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801cf9:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  801d00:	00 00 00 
+  801d03:	ff d0                	call   *%rax
+  801d05:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d09:	90                   	nop
+  801d0a:	c9                   	leave
+  801d0b:	c3                   	ret
+
+0000000000801d0c <sys_page_alloc>:
+
+int sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801d0c:	55                   	push   %rbp
+  801d0d:	48 89 e5             	mov    %rsp,%rbp
+  801d10:	48 83 ec 10          	sub    $0x10,%rsp
+  801d14:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801d17:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801d1b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  801d1e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801d21:	48 63 c8             	movslq %eax,%rcx
+  801d24:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d28:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d2b:	48 98                	cltq
+  801d2d:	48 83 ec 08          	sub    $0x8,%rsp
+  801d31:	6a 00                	push   $0x0
+  801d33:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d39:	49 89 c8             	mov    %rcx,%r8
+  801d3c:	48 89 d1             	mov    %rdx,%rcx
+  801d3f:	48 89 c2             	mov    %rax,%rdx
+  801d42:	be 01 00 00 00       	mov    $0x1,%esi
+  801d47:	bf 04 00 00 00       	mov    $0x4,%edi
+  801d4c:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  801d53:	00 00 00 
+  801d56:	ff d0                	call   *%rax
+  801d58:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d5c:	c9                   	leave
+  801d5d:	c3                   	ret
+
+0000000000801d5e <sys_page_map>:
+
+int sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801d5e:	55                   	push   %rbp
+  801d5f:	48 89 e5             	mov    %rsp,%rbp
+  801d62:	48 83 ec 20          	sub    $0x20,%rsp
+  801d66:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801d69:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801d6d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801d70:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d74:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  801d78:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801d7b:	48 63 c8             	movslq %eax,%rcx
+  801d7e:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  801d82:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801d85:	48 63 f0             	movslq %eax,%rsi
+  801d88:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d8c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d8f:	48 98                	cltq
+  801d91:	48 83 ec 08          	sub    $0x8,%rsp
+  801d95:	51                   	push   %rcx
+  801d96:	49 89 f9             	mov    %rdi,%r9
+  801d99:	49 89 f0             	mov    %rsi,%r8
+  801d9c:	48 89 d1             	mov    %rdx,%rcx
+  801d9f:	48 89 c2             	mov    %rax,%rdx
+  801da2:	be 01 00 00 00       	mov    $0x1,%esi
+  801da7:	bf 05 00 00 00       	mov    $0x5,%edi
+  801dac:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  801db3:	00 00 00 
+  801db6:	ff d0                	call   *%rax
+  801db8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801dbc:	c9                   	leave
+  801dbd:	c3                   	ret
+
+0000000000801dbe <sys_page_unmap>:
+
+int sys_page_unmap(envid_t envid, void *va)
+{
+  801dbe:	55                   	push   %rbp
+  801dbf:	48 89 e5             	mov    %rsp,%rbp
+  801dc2:	48 83 ec 10          	sub    $0x10,%rsp
+  801dc6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801dc9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  801dcd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801dd1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801dd4:	48 98                	cltq
+  801dd6:	48 83 ec 08          	sub    $0x8,%rsp
+  801dda:	6a 00                	push   $0x0
+  801ddc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801de2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801de8:	48 89 d1             	mov    %rdx,%rcx
+  801deb:	48 89 c2             	mov    %rax,%rdx
+  801dee:	be 01 00 00 00       	mov    $0x1,%esi
+  801df3:	bf 06 00 00 00       	mov    $0x6,%edi
+  801df8:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  801dff:	00 00 00 
+  801e02:	ff d0                	call   *%rax
+  801e04:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e08:	c9                   	leave
+  801e09:	c3                   	ret
+
+0000000000801e0a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int sys_env_set_status(envid_t envid, int status)
+{
+  801e0a:	55                   	push   %rbp
+  801e0b:	48 89 e5             	mov    %rsp,%rbp
+  801e0e:	48 83 ec 10          	sub    $0x10,%rsp
+  801e12:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e15:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801e18:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801e1b:	48 63 d0             	movslq %eax,%rdx
+  801e1e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e21:	48 98                	cltq
+  801e23:	48 83 ec 08          	sub    $0x8,%rsp
+  801e27:	6a 00                	push   $0x0
+  801e29:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e2f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e35:	48 89 d1             	mov    %rdx,%rcx
+  801e38:	48 89 c2             	mov    %rax,%rdx
+  801e3b:	be 01 00 00 00       	mov    $0x1,%esi
+  801e40:	bf 08 00 00 00       	mov    $0x8,%edi
+  801e45:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  801e4c:	00 00 00 
+  801e4f:	ff d0                	call   *%rax
+  801e51:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e55:	c9                   	leave
+  801e56:	c3                   	ret
+
+0000000000801e57 <sys_env_set_trapframe>:
+
+int sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801e57:	55                   	push   %rbp
+  801e58:	48 89 e5             	mov    %rsp,%rbp
+  801e5b:	48 83 ec 10          	sub    $0x10,%rsp
+  801e5f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e62:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  801e66:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e6a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e6d:	48 98                	cltq
+  801e6f:	48 83 ec 08          	sub    $0x8,%rsp
+  801e73:	6a 00                	push   $0x0
+  801e75:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e7b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e81:	48 89 d1             	mov    %rdx,%rcx
+  801e84:	48 89 c2             	mov    %rax,%rdx
+  801e87:	be 01 00 00 00       	mov    $0x1,%esi
+  801e8c:	bf 09 00 00 00       	mov    $0x9,%edi
+  801e91:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  801e98:	00 00 00 
+  801e9b:	ff d0                	call   *%rax
+  801e9d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ea1:	c9                   	leave
+  801ea2:	c3                   	ret
+
+0000000000801ea3 <sys_env_set_pgfault_upcall>:
+
+int sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801ea3:	55                   	push   %rbp
+  801ea4:	48 89 e5             	mov    %rsp,%rbp
+  801ea7:	48 83 ec 10          	sub    $0x10,%rsp
+  801eab:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801eae:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  801eb2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801eb6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801eb9:	48 98                	cltq
+  801ebb:	48 83 ec 08          	sub    $0x8,%rsp
+  801ebf:	6a 00                	push   $0x0
+  801ec1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ec7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ecd:	48 89 d1             	mov    %rdx,%rcx
+  801ed0:	48 89 c2             	mov    %rax,%rdx
+  801ed3:	be 01 00 00 00       	mov    $0x1,%esi
+  801ed8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801edd:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  801ee4:	00 00 00 
+  801ee7:	ff d0                	call   *%rax
+  801ee9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801eed:	c9                   	leave
+  801eee:	c3                   	ret
+
+0000000000801eef <sys_ipc_try_send>:
+
+int sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  801eef:	55                   	push   %rbp
+  801ef0:	48 89 e5             	mov    %rsp,%rbp
+  801ef3:	48 83 ec 20          	sub    $0x20,%rsp
+  801ef7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801efa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801efe:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801f02:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  801f05:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801f08:	48 63 f0             	movslq %eax,%rsi
+  801f0b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801f0f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f12:	48 98                	cltq
+  801f14:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801f18:	48 83 ec 08          	sub    $0x8,%rsp
+  801f1c:	6a 00                	push   $0x0
+  801f1e:	49 89 f1             	mov    %rsi,%r9
+  801f21:	49 89 c8             	mov    %rcx,%r8
+  801f24:	48 89 d1             	mov    %rdx,%rcx
+  801f27:	48 89 c2             	mov    %rax,%rdx
+  801f2a:	be 00 00 00 00       	mov    $0x0,%esi
+  801f2f:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801f34:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  801f3b:	00 00 00 
+  801f3e:	ff d0                	call   *%rax
+  801f40:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f44:	c9                   	leave
+  801f45:	c3                   	ret
+
+0000000000801f46 <sys_ipc_recv>:
+
+int sys_ipc_recv(void *dstva)
+{
+  801f46:	55                   	push   %rbp
+  801f47:	48 89 e5             	mov    %rsp,%rbp
+  801f4a:	48 83 ec 10          	sub    $0x10,%rsp
+  801f4e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  801f52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f56:	48 83 ec 08          	sub    $0x8,%rsp
+  801f5a:	6a 00                	push   $0x0
+  801f5c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f62:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f68:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f6d:	48 89 c2             	mov    %rax,%rdx
+  801f70:	be 01 00 00 00       	mov    $0x1,%esi
+  801f75:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801f7a:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  801f81:	00 00 00 
+  801f84:	ff d0                	call   *%rax
+  801f86:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f8a:	c9                   	leave
+  801f8b:	c3                   	ret
+
+0000000000801f8c <sys_disk_io>:
+
+int sys_disk_io(int dev, uint64_t secno, void *va, size_t nsecs, int write)
+{
+  801f8c:	55                   	push   %rbp
+  801f8d:	48 89 e5             	mov    %rsp,%rbp
+  801f90:	48 83 ec 20          	sub    $0x20,%rsp
+  801f94:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f97:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f9b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801f9f:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  801fa3:	44 89 45 f8          	mov    %r8d,-0x8(%rbp)
+	return syscall(SYS_disk_io, 0, dev, secno, (uint64_t)va, nsecs, write);
+  801fa7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801faa:	48 63 c8             	movslq %eax,%rcx
+  801fad:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  801fb1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fb4:	48 98                	cltq
+  801fb6:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  801fba:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801fbe:	48 83 ec 08          	sub    $0x8,%rsp
+  801fc2:	51                   	push   %rcx
+  801fc3:	49 89 f9             	mov    %rdi,%r9
+  801fc6:	49 89 f0             	mov    %rsi,%r8
+  801fc9:	48 89 d1             	mov    %rdx,%rcx
+  801fcc:	48 89 c2             	mov    %rax,%rdx
+  801fcf:	be 00 00 00 00       	mov    $0x0,%esi
+  801fd4:	bf 0e 00 00 00       	mov    $0xe,%edi
+  801fd9:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  801fe0:	00 00 00 
+  801fe3:	ff d0                	call   *%rax
+  801fe5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fe9:	c9                   	leave
+  801fea:	c3                   	ret
+
+0000000000801feb <sys_vma_alloc>:
+
+int sys_vma_alloc(envid_t envid, void *va, size_t len, int perm)
+{
+  801feb:	55                   	push   %rbp
+  801fec:	48 89 e5             	mov    %rsp,%rbp
+  801fef:	48 83 ec 20          	sub    $0x20,%rsp
+  801ff3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801ff6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801ffa:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801ffe:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_vma_alloc, 1, envid, (uint64_t)va, len, perm, 0);
+  802001:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802004:	48 63 f0             	movslq %eax,%rsi
+  802007:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80200b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80200e:	48 98                	cltq
+  802010:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802014:	48 83 ec 08          	sub    $0x8,%rsp
+  802018:	6a 00                	push   $0x0
+  80201a:	49 89 f1             	mov    %rsi,%r9
+  80201d:	49 89 c8             	mov    %rcx,%r8
+  802020:	48 89 d1             	mov    %rdx,%rcx
+  802023:	48 89 c2             	mov    %rax,%rdx
+  802026:	be 01 00 00 00       	mov    $0x1,%esi
+  80202b:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802030:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  802037:	00 00 00 
+  80203a:	ff d0                	call   *%rax
+  80203c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802040:	c9                   	leave
+  802041:	c3                   	ret
+
+0000000000802042 <sys_vma_clear>:
+
+int sys_vma_clear(envid_t envid)
+{
+  802042:	55                   	push   %rbp
+  802043:	48 89 e5             	mov    %rsp,%rbp
+  802046:	48 83 ec 10          	sub    $0x10,%rsp
+  80204a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_vma_clear, 1, envid, 0, 0, 0, 0);
+  80204d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802050:	48 98                	cltq
+  802052:	48 83 ec 08          	sub    $0x8,%rsp
+  802056:	6a 00                	push   $0x0
+  802058:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80205e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802064:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802069:	48 89 c2             	mov    %rax,%rdx
+  80206c:	be 01 00 00 00       	mov    $0x1,%esi
+  802071:	bf 10 00 00 00       	mov    $0x10,%edi
+  802076:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  80207d:	00 00 00 
+  802080:	ff d0                	call   *%rax
+  802082:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802086:	c9                   	leave
+  802087:	c3                   	ret
+
+0000000000802088 <sys_trace_ctl>:
+
+int sys_trace_ctl(int enable)
+{
+  802088:	55                   	push   %rbp
+  802089:	48 89 e5             	mov    %rsp,%rbp
+  80208c:	48 83 ec 10          	sub    $0x10,%rsp
+  802090:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_trace_ctl, 0, enable, 0, 0, 0, 0);
+  802093:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802096:	48 98                	cltq
+  802098:	48 83 ec 08          	sub    $0x8,%rsp
+  80209c:	6a 00                	push   $0x0
+  80209e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020af:	48 89 c2             	mov    %rax,%rdx
+  8020b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8020b7:	bf 11 00 00 00       	mov    $0x11,%edi
+  8020bc:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  8020c3:	00 00 00 
+  8020c6:	ff d0                	call   *%rax
+  8020c8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020cc:	c9                   	leave
+  8020cd:	c3                   	ret
+
+00000000008020ce <sys_trace_read>:
+
+int sys_trace_read(int cpu, uint64_t *seq, struct TraceEvent *buf, int n)
+{
+  8020ce:	55                   	push   %rbp
+  8020cf:	48 89 e5             	mov    %rsp,%rbp
+  8020d2:	48 83 ec 20          	sub    $0x20,%rsp
+  8020d6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020d9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8020dd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8020e1:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_trace_read, 0, cpu, (uint64_t)seq, (uint64_t)buf, n, 0);
+  8020e4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8020e7:	48 63 f0             	movslq %eax,%rsi
+  8020ea:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8020ee:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8020f2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020f5:	48 98                	cltq
+  8020f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8020fb:	6a 00                	push   $0x0
+  8020fd:	49 89 f1             	mov    %rsi,%r9
+  802100:	49 89 c8             	mov    %rcx,%r8
+  802103:	48 89 d1             	mov    %rdx,%rcx
+  802106:	48 89 c2             	mov    %rax,%rdx
+  802109:	be 00 00 00 00       	mov    $0x0,%esi
+  80210e:	bf 12 00 00 00       	mov    $0x12,%edi
+  802113:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  80211a:	00 00 00 
+  80211d:	ff d0                	call   *%rax
+  80211f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802123:	c9                   	leave
+  802124:	c3                   	ret
+
+0000000000802125 <sys_getrusage>:
+
+int sys_getrusage(envid_t envid, struct Rusage *ru)
+{
+  802125:	55                   	push   %rbp
+  802126:	48 89 e5             	mov    %rsp,%rbp
+  802129:	48 83 ec 10          	sub    $0x10,%rsp
+  80212d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802130:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_getrusage, 0, envid, (uint64_t)ru, 0, 0, 0);
+  802134:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802138:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80213b:	48 98                	cltq
+  80213d:	48 83 ec 08          	sub    $0x8,%rsp
+  802141:	6a 00                	push   $0x0
+  802143:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802149:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80214f:	48 89 d1             	mov    %rdx,%rcx
+  802152:	48 89 c2             	mov    %rax,%rdx
+  802155:	be 00 00 00 00       	mov    $0x0,%esi
+  80215a:	bf 13 00 00 00       	mov    $0x13,%edi
+  80215f:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  802166:	00 00 00 
+  802169:	ff d0                	call   *%rax
+  80216b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80216f:	c9                   	leave
+  802170:	c3                   	ret
+
+0000000000802171 <sys_pmu_config>:
+
+int sys_pmu_config(int idx, uint64_t event)
+{
+  802171:	55                   	push   %rbp
+  802172:	48 89 e5             	mov    %rsp,%rbp
+  802175:	48 83 ec 10          	sub    $0x10,%rsp
+  802179:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80217c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_pmu_config, 0, idx, event, 0, 0, 0);
+  802180:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802183:	48 98                	cltq
+  802185:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802189:	48 83 ec 08          	sub    $0x8,%rsp
+  80218d:	6a 00                	push   $0x0
+  80218f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802195:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80219b:	48 89 d1             	mov    %rdx,%rcx
+  80219e:	48 89 c2             	mov    %rax,%rdx
+  8021a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8021a6:	bf 14 00 00 00       	mov    $0x14,%edi
+  8021ab:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  8021b2:	00 00 00 
+  8021b5:	ff d0                	call   *%rax
+  8021b7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021bb:	c9                   	leave
+  8021bc:	c3                   	ret
+
+00000000008021bd <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  8021bd:	55                   	push   %rbp
+  8021be:	48 89 e5             	mov    %rsp,%rbp
+  8021c1:	48 83 ec 10          	sub    $0x10,%rsp
+  8021c5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+  8021c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8021cf:	6a 00                	push   $0x0
+  8021d1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021e2:	48 89 c2             	mov    %rax,%rdx
+  8021e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ea:	bf 15 00 00 00       	mov    $0x15,%edi
+  8021ef:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  8021f6:	00 00 00 
+  8021f9:	ff d0                	call   *%rax
+  8021fb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021ff:	c9                   	leave
+  802200:	c3                   	ret
+
+0000000000802201 <sys_image_attach>:
+
+int sys_image_attach(envid_t envid, int dev, const uint64_t *secnos, size_t size)
+{
+  802201:	55                   	push   %rbp
+  802202:	48 89 e5             	mov    %rsp,%rbp
+  802205:	48 83 ec 20          	sub    $0x20,%rsp
+  802209:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80220c:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  80220f:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  802213:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+	return syscall(SYS_image_attach, 1, envid, dev, (uint64_t)secnos, size, 0);
+  802217:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80221b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80221e:	48 63 d0             	movslq %eax,%rdx
+  802221:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802224:	48 98                	cltq
+  802226:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80222a:	48 83 ec 08          	sub    $0x8,%rsp
+  80222e:	6a 00                	push   $0x0
+  802230:	49 89 f1             	mov    %rsi,%r9
+  802233:	49 89 c8             	mov    %rcx,%r8
+  802236:	48 89 d1             	mov    %rdx,%rcx
+  802239:	48 89 c2             	mov    %rax,%rdx
+  80223c:	be 01 00 00 00       	mov    $0x1,%esi
+  802241:	bf 16 00 00 00       	mov    $0x16,%edi
+  802246:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  80224d:	00 00 00 
+  802250:	ff d0                	call   *%rax
+  802252:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802256:	c9                   	leave
+  802257:	c3                   	ret
+
+0000000000802258 <sys_vma_binary>:
+
+int sys_vma_binary(envid_t envid, const struct Proghdr *ph)
+{
+  802258:	55                   	push   %rbp
+  802259:	48 89 e5             	mov    %rsp,%rbp
+  80225c:	48 83 ec 10          	sub    $0x10,%rsp
+  802260:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802263:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_vma_binary, 1, envid, (uint64_t)ph, 0, 0, 0);
+  802267:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80226b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80226e:	48 98                	cltq
+  802270:	48 83 ec 08          	sub    $0x8,%rsp
+  802274:	6a 00                	push   $0x0
+  802276:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80227c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802282:	48 89 d1             	mov    %rdx,%rcx
+  802285:	48 89 c2             	mov    %rax,%rdx
+  802288:	be 01 00 00 00       	mov    $0x1,%esi
+  80228d:	bf 17 00 00 00       	mov    $0x17,%edi
+  802292:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  802299:	00 00 00 
+  80229c:	ff d0                	call   *%rax
+  80229e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022a2:	c9                   	leave
+  8022a3:	c3                   	ret
+
+00000000008022a4 <_panic>:
+/*
+ * 无法解决的致命错误会导致死机
+ * 打印"死机:<消息>”，然后导致处理器休眠进入HLT状态
+ */
+void _panic(const char *file, int line, const char *fmt, ...)
+{
+  8022a4:	55                   	push   %rbp
+  8022a5:	48 89 e5             	mov    %rsp,%rbp
+  8022a8:	53                   	push   %rbx
+  8022a9:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8022b0:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  8022b7:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  8022bd:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  8022c4:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  8022cb:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  8022d2:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  8022d9:	84 c0                	test   %al,%al
+  8022db:	74 23                	je     802300 <_panic+0x5c>
+  8022dd:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  8022e4:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  8022e8:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  8022ec:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  8022f0:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  8022f4:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  8022f8:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  8022fc:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  802300:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  802307:	00 00 00 
+  80230a:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  802311:	00 00 00 
+  802314:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802318:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  80231f:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  802326:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+	// 输出死机的信息
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80232d:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802334:	00 00 00 
+  802337:	48 8b 18             	mov    (%rax),%rbx
+  80233a:	48 b8 93 1c 80 00 00 	movabs $0x801c93,%rax
+  802341:	00 00 00 
+  802344:	ff d0                	call   *%rax
+  802346:	89 c6                	mov    %eax,%esi
+  802348:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  80234e:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  802355:	41 89 d0             	mov    %edx,%r8d
+  802358:	48 89 c1             	mov    %rax,%rcx
+  80235b:	48 89 da             	mov    %rbx,%rdx
+  80235e:	48 b8 98 29 80 00 00 	movabs $0x802998,%rax
+  802365:	00 00 00 
+  802368:	48 89 c7             	mov    %rax,%rdi
+  80236b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802370:	49 b9 20 04 80 00 00 	movabs $0x800420,%r9
+  802377:	00 00 00 
+  80237a:	41 ff d1             	call   *%r9
+			sys_getprocid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80237d:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  802384:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80238b:	48 89 d6             	mov    %rdx,%rsi
+  80238e:	48 89 c7             	mov    %rax,%rdi
+  802391:	48 b8 71 03 80 00 00 	movabs $0x800371,%rax
+  802398:	00 00 00 
+  80239b:	ff d0                	call   *%rax
+	cprintf("\n");
+  80239d:	48 b8 bb 29 80 00 00 	movabs $0x8029bb,%rax
+  8023a4:	00 00 00 
+  8023a7:	48 89 c7             	mov    %rax,%rdi
+  8023aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023af:	48 ba 20 04 80 00 00 	movabs $0x800420,%rdx
+  8023b6:	00 00 00 
+  8023b9:	ff d2                	call   *%rdx
+
+	// 触发断点中断
+	while (1)
+		asm volatile("int3");
+  8023bb:	cc                   	int3
+  8023bc:	eb fd                	jmp    8023bb <_panic+0x117>
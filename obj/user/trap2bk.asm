@@ -0,0 +1,3572 @@
+
+obj/user/trap2bk.debug:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// entrypoint - 当最初被加载到一个新的环境中时，内核(或者父环境)在这里开始运行.
+.text
+.globl _start
+_start:
+	// 判断是否从栈上的参数开始初始化
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	// $USTACKTOP != %rsp 说明有参数，跳转到 args_exist
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// 如果不是(新环境被内核加载的时候)，则 push 伪造的 argc, argv 参数
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 15 00 00 00       	call   800056 <libmain>
+
+// 不应该返回
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+// 触发断点的用户程序
+
+#include "inc/lib.h"
+
+void umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	48 83 ec 10          	sub    $0x10,%rsp
+  80004b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80004e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	asm volatile("int $3");
+  800052:	cc                   	int3
+}
+  800053:	90                   	nop
+  800054:	c9                   	leave
+  800055:	c3                   	ret
+
+0000000000800056 <libmain>:
+
+/**
+ *  用户环境从lib/libmain.c中的函数libmain开始执行，这个函数进而调用umain，用户写的程序入口只能是umain
+ */
+void libmain(int argc, char **argv)
+{
+  800056:	55                   	push   %rbp
+  800057:	48 89 e5             	mov    %rsp,%rbp
+  80005a:	48 83 ec 10          	sub    $0x10,%rsp
+  80005e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800061:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 设置常量 thisproc 指向 procs[] 中当前环境的 Env 结构，ENVX 确保环境 id 未超过了 NENV
+	// thisproc 指向当前环境的 Env 结构
+	thisproc = &procs[ENVX(sys_getprocid())];
+  800065:	48 b8 37 0e 80 00 00 	movabs $0x800e37,%rax
+  80006c:	00 00 00 
+  80006f:	ff d0                	call   *%rax
+  800071:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800076:	48 98                	cltq
+  800078:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  80007f:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  800086:	00 00 00 
+  800089:	48 01 c2             	add    %rax,%rdx
+  80008c:	48 b8 08 30 80 00 00 	movabs $0x803008,%rax
+  800093:	00 00 00 
+  800096:	48 89 10             	mov    %rdx,(%rax)
+
+	// 通过 CPUID 选择 memset/memmove/memcpy 的实现
+	mem_init();
+  800099:	48 b8 df 04 80 00 00 	movabs $0x8004df,%rax
+  8000a0:	00 00 00 
+  8000a3:	ff d0                	call   *%rax
+
+	// 为了能让panic()提示用户错误，存储程序的名称
+	if (argc > 0)
+  8000a5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8000a9:	7e 14                	jle    8000bf <libmain+0x69>
+		binaryname = argv[0];
+  8000ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8000af:	48 8b 00             	mov    (%rax),%rax
+  8000b2:	48 ba 00 30 80 00 00 	movabs $0x803000,%rdx
+  8000b9:	00 00 00 
+  8000bc:	48 89 02             	mov    %rax,(%rdx)
+
+	// 调用用户的主程序
+	umain(argc, argv);
+  8000bf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8000c3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000c6:	48 89 d6             	mov    %rdx,%rsi
+  8000c9:	89 c7                	mov    %eax,%edi
+  8000cb:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  8000d2:	00 00 00 
+  8000d5:	ff d0                	call   *%rax
+
+	// 退出当前环境，env_destroy
+	sys_env_destroy(0);
+  8000d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000dc:	48 b8 f1 0d 80 00 00 	movabs $0x800df1,%rax
+  8000e3:	00 00 00 
+  8000e6:	ff d0                	call   *%rax
+}
+  8000e8:	90                   	nop
+  8000e9:	c9                   	leave
+  8000ea:	c3                   	ret
+
+00000000008000eb <cpuid>:
+#define read_rip(var) __asm __volatile("leaq (%%rip), %0" : "=r" (var)::"cc","memory")
+
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  8000eb:	55                   	push   %rbp
+  8000ec:	48 89 e5             	mov    %rsp,%rbp
+  8000ef:	53                   	push   %rbx
+  8000f0:	48 83 ec 38          	sub    $0x38,%rsp
+  8000f4:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  8000f7:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8000fb:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8000ff:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800103:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid" 
+  800107:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80010a:	0f a2                	cpuid
+  80010c:	89 de                	mov    %ebx,%esi
+  80010e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800111:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800114:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800117:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info));
+	if (eaxp)
+  80011a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80011f:	74 09                	je     80012a <cpuid+0x3f>
+		*eaxp = eax;
+  800121:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800125:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800128:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  80012a:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80012f:	74 09                	je     80013a <cpuid+0x4f>
+		*ebxp = ebx;
+  800131:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800135:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800138:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  80013a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80013f:	74 09                	je     80014a <cpuid+0x5f>
+		*ecxp = ecx;
+  800141:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800145:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800148:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  80014a:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80014f:	74 09                	je     80015a <cpuid+0x6f>
+		*edxp = edx;
+  800151:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800155:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800158:	89 10                	mov    %edx,(%rax)
+}
+  80015a:	90                   	nop
+  80015b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80015f:	c9                   	leave
+  800160:	c3                   	ret
+
+0000000000800161 <cpuid_count>:
+
+// 带子功能号(%ecx = count)的 cpuid，用于 leaf 4/7/0xB/0xD 等
+static __inline void
+cpuid_count(uint32_t info, uint32_t count, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800161:	55                   	push   %rbp
+  800162:	48 89 e5             	mov    %rsp,%rbp
+  800165:	53                   	push   %rbx
+  800166:	48 83 ec 38          	sub    $0x38,%rsp
+  80016a:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  80016d:	89 75 e0             	mov    %esi,-0x20(%rbp)
+  800170:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800174:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  800178:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+  80017c:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800180:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800183:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800186:	89 d1                	mov    %edx,%ecx
+  800188:	0f a2                	cpuid
+  80018a:	89 de                	mov    %ebx,%esi
+  80018c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  80018f:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800192:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800195:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info), "c" (count));
+	if (eaxp)
+  800198:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80019d:	74 09                	je     8001a8 <cpuid_count+0x47>
+		*eaxp = eax;
+  80019f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8001a3:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8001a6:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  8001a8:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8001ad:	74 09                	je     8001b8 <cpuid_count+0x57>
+		*ebxp = ebx;
+  8001af:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8001b3:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8001b6:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  8001b8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8001bd:	74 09                	je     8001c8 <cpuid_count+0x67>
+		*ecxp = ecx;
+  8001bf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8001c3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8001c6:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  8001c8:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8001cd:	74 09                	je     8001d8 <cpuid_count+0x77>
+		*edxp = edx;
+  8001cf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8001d3:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8001d6:	89 10                	mov    %edx,(%rax)
+}
+  8001d8:	90                   	nop
+  8001d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001dd:	c9                   	leave
+  8001de:	c3                   	ret
+
+00000000008001df <strlen>:
+// 在真正的硬件上会有一定程度的优化, 但在 Bochs 上会有更大的优化效果
+// 用这种方法, Primespipe 的运行速度快了3倍
+#define ASM 1
+
+int strlen(const char *s)
+{
+  8001df:	55                   	push   %rbp
+  8001e0:	48 89 e5             	mov    %rsp,%rbp
+  8001e3:	48 83 ec 18          	sub    $0x18,%rsp
+  8001e7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8001eb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8001f2:	eb 09                	jmp    8001fd <strlen+0x1e>
+		n++;
+  8001f4:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8001f8:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8001fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800201:	0f b6 00             	movzbl (%rax),%eax
+  800204:	84 c0                	test   %al,%al
+  800206:	75 ec                	jne    8001f4 <strlen+0x15>
+	return n;
+  800208:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80020b:	c9                   	leave
+  80020c:	c3                   	ret
+
+000000000080020d <strnlen>:
+
+int strnlen(const char *s, size_t size)
+{
+  80020d:	55                   	push   %rbp
+  80020e:	48 89 e5             	mov    %rsp,%rbp
+  800211:	48 83 ec 20          	sub    $0x20,%rsp
+  800215:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800219:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80021d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800224:	eb 0e                	jmp    800234 <strnlen+0x27>
+		n++;
+  800226:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80022a:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80022f:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  800234:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800239:	74 0b                	je     800246 <strnlen+0x39>
+  80023b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80023f:	0f b6 00             	movzbl (%rax),%eax
+  800242:	84 c0                	test   %al,%al
+  800244:	75 e0                	jne    800226 <strnlen+0x19>
+	return n;
+  800246:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800249:	c9                   	leave
+  80024a:	c3                   	ret
+
+000000000080024b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80024b:	55                   	push   %rbp
+  80024c:	48 89 e5             	mov    %rsp,%rbp
+  80024f:	48 83 ec 20          	sub    $0x20,%rsp
+  800253:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800257:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  80025b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80025f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  800263:	90                   	nop
+  800264:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800268:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80026c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800270:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800274:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800278:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80027c:	0f b6 12             	movzbl (%rdx),%edx
+  80027f:	88 10                	mov    %dl,(%rax)
+  800281:	0f b6 00             	movzbl (%rax),%eax
+  800284:	84 c0                	test   %al,%al
+  800286:	75 dc                	jne    800264 <strcpy+0x19>
+		/* do nothing */;
+	return ret;
+  800288:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80028c:	c9                   	leave
+  80028d:	c3                   	ret
+
+000000000080028e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80028e:	55                   	push   %rbp
+  80028f:	48 89 e5             	mov    %rsp,%rbp
+  800292:	48 83 ec 20          	sub    $0x20,%rsp
+  800296:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80029a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int len = strlen(dst);
+  80029e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8002a2:	48 89 c7             	mov    %rax,%rdi
+  8002a5:	48 b8 df 01 80 00 00 	movabs $0x8001df,%rax
+  8002ac:	00 00 00 
+  8002af:	ff d0                	call   *%rax
+  8002b1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	strcpy(dst + len, src);
+  8002b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8002b7:	48 63 d0             	movslq %eax,%rdx
+  8002ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8002be:	48 01 c2             	add    %rax,%rdx
+  8002c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8002c5:	48 89 c6             	mov    %rax,%rsi
+  8002c8:	48 89 d7             	mov    %rdx,%rdi
+  8002cb:	48 b8 4b 02 80 00 00 	movabs $0x80024b,%rax
+  8002d2:	00 00 00 
+  8002d5:	ff d0                	call   *%rax
+	return dst;
+  8002d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8002db:	c9                   	leave
+  8002dc:	c3                   	ret
+
+00000000008002dd <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8002dd:	55                   	push   %rbp
+  8002de:	48 89 e5             	mov    %rsp,%rbp
+  8002e1:	48 83 ec 28          	sub    $0x28,%rsp
+  8002e5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8002e9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8002ed:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  8002f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8002f5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++)
+  8002f9:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  800300:	00 
+  800301:	eb 2a                	jmp    80032d <strncpy+0x50>
+	{
+		*dst++ = *src;
+  800303:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800307:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80030b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80030f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800313:	0f b6 12             	movzbl (%rdx),%edx
+  800316:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  800318:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80031c:	0f b6 00             	movzbl (%rax),%eax
+  80031f:	84 c0                	test   %al,%al
+  800321:	74 05                	je     800328 <strncpy+0x4b>
+			src++;
+  800323:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++)
+  800328:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80032d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800331:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  800335:	72 cc                	jb     800303 <strncpy+0x26>
+	}
+	return ret;
+  800337:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80033b:	c9                   	leave
+  80033c:	c3                   	ret
+
+000000000080033d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80033d:	55                   	push   %rbp
+  80033e:	48 89 e5             	mov    %rsp,%rbp
+  800341:	48 83 ec 28          	sub    $0x28,%rsp
+  800345:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800349:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80034d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  800351:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800355:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0)
+  800359:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80035e:	74 3d                	je     80039d <strlcpy+0x60>
+	{
+		while (--size > 0 && *src != '\0')
+  800360:	eb 1d                	jmp    80037f <strlcpy+0x42>
+			*dst++ = *src++;
+  800362:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800366:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80036a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80036e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800372:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800376:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80037a:	0f b6 12             	movzbl (%rdx),%edx
+  80037d:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  80037f:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  800384:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800389:	74 0b                	je     800396 <strlcpy+0x59>
+  80038b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80038f:	0f b6 00             	movzbl (%rax),%eax
+  800392:	84 c0                	test   %al,%al
+  800394:	75 cc                	jne    800362 <strlcpy+0x25>
+		*dst = '\0';
+  800396:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80039a:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  80039d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8003a1:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8003a5:	c9                   	leave
+  8003a6:	c3                   	ret
+
+00000000008003a7 <strcmp>:
+
+int strcmp(const char *p, const char *q)
+{
+  8003a7:	55                   	push   %rbp
+  8003a8:	48 89 e5             	mov    %rsp,%rbp
+  8003ab:	48 83 ec 10          	sub    $0x10,%rsp
+  8003af:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8003b3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8003b7:	eb 0a                	jmp    8003c3 <strcmp+0x1c>
+		p++, q++;
+  8003b9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8003be:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8003c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003c7:	0f b6 00             	movzbl (%rax),%eax
+  8003ca:	84 c0                	test   %al,%al
+  8003cc:	74 12                	je     8003e0 <strcmp+0x39>
+  8003ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003d2:	0f b6 10             	movzbl (%rax),%edx
+  8003d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003d9:	0f b6 00             	movzbl (%rax),%eax
+  8003dc:	38 c2                	cmp    %al,%dl
+  8003de:	74 d9                	je     8003b9 <strcmp+0x12>
+	return (int)((unsigned char)*p - (unsigned char)*q);
+  8003e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003e4:	0f b6 00             	movzbl (%rax),%eax
+  8003e7:	0f b6 d0             	movzbl %al,%edx
+  8003ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003ee:	0f b6 00             	movzbl (%rax),%eax
+  8003f1:	0f b6 c0             	movzbl %al,%eax
+  8003f4:	29 c2                	sub    %eax,%edx
+  8003f6:	89 d0                	mov    %edx,%eax
+}
+  8003f8:	c9                   	leave
+  8003f9:	c3                   	ret
+
+00000000008003fa <strncmp>:
+
+int strncmp(const char *p, const char *q, size_t n)
+{
+  8003fa:	55                   	push   %rbp
+  8003fb:	48 89 e5             	mov    %rsp,%rbp
+  8003fe:	48 83 ec 18          	sub    $0x18,%rsp
+  800402:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800406:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80040a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80040e:	eb 0f                	jmp    80041f <strncmp+0x25>
+		n--, p++, q++;
+  800410:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  800415:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80041a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80041f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  800424:	74 1d                	je     800443 <strncmp+0x49>
+  800426:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80042a:	0f b6 00             	movzbl (%rax),%eax
+  80042d:	84 c0                	test   %al,%al
+  80042f:	74 12                	je     800443 <strncmp+0x49>
+  800431:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800435:	0f b6 10             	movzbl (%rax),%edx
+  800438:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80043c:	0f b6 00             	movzbl (%rax),%eax
+  80043f:	38 c2                	cmp    %al,%dl
+  800441:	74 cd                	je     800410 <strncmp+0x16>
+	if (n == 0)
+  800443:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  800448:	75 07                	jne    800451 <strncmp+0x57>
+		return 0;
+  80044a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80044f:	eb 16                	jmp    800467 <strncmp+0x6d>
+	else
+		return (int)((unsigned char)*p - (unsigned char)*q);
+  800451:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800455:	0f b6 00             	movzbl (%rax),%eax
+  800458:	0f b6 d0             	movzbl %al,%edx
+  80045b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80045f:	0f b6 00             	movzbl (%rax),%eax
+  800462:	0f b6 c0             	movzbl %al,%eax
+  800465:	29 c2                	sub    %eax,%edx
+}
+  800467:	89 d0                	mov    %edx,%eax
+  800469:	c9                   	leave
+  80046a:	c3                   	ret
+
+000000000080046b <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80046b:	55                   	push   %rbp
+  80046c:	48 89 e5             	mov    %rsp,%rbp
+  80046f:	48 83 ec 10          	sub    $0x10,%rsp
+  800473:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800477:	89 f0                	mov    %esi,%eax
+  800479:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80047c:	eb 17                	jmp    800495 <strchr+0x2a>
+		if (*s == c)
+  80047e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800482:	0f b6 00             	movzbl (%rax),%eax
+  800485:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  800488:	75 06                	jne    800490 <strchr+0x25>
+			return (char *)s;
+  80048a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80048e:	eb 15                	jmp    8004a5 <strchr+0x3a>
+	for (; *s; s++)
+  800490:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800495:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800499:	0f b6 00             	movzbl (%rax),%eax
+  80049c:	84 c0                	test   %al,%al
+  80049e:	75 de                	jne    80047e <strchr+0x13>
+	return 0;
+  8004a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8004a5:	c9                   	leave
+  8004a6:	c3                   	ret
+
+00000000008004a7 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8004a7:	55                   	push   %rbp
+  8004a8:	48 89 e5             	mov    %rsp,%rbp
+  8004ab:	48 83 ec 10          	sub    $0x10,%rsp
+  8004af:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8004b3:	89 f0                	mov    %esi,%eax
+  8004b5:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8004b8:	eb 11                	jmp    8004cb <strfind+0x24>
+		if (*s == c)
+  8004ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004be:	0f b6 00             	movzbl (%rax),%eax
+  8004c1:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8004c4:	74 12                	je     8004d8 <strfind+0x31>
+	for (; *s; s++)
+  8004c6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8004cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004cf:	0f b6 00             	movzbl (%rax),%eax
+  8004d2:	84 c0                	test   %al,%al
+  8004d4:	75 e4                	jne    8004ba <strfind+0x13>
+  8004d6:	eb 01                	jmp    8004d9 <strfind+0x32>
+			break;
+  8004d8:	90                   	nop
+	return (char *)s;
+  8004d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8004dd:	c9                   	leave
+  8004de:	c3                   	ret
+
+00000000008004df <mem_init>:
+};
+
+static int mem_features;
+
+void mem_init(void)
+{
+  8004df:	55                   	push   %rbp
+  8004e0:	48 89 e5             	mov    %rsp,%rbp
+  8004e3:	48 83 ec 10          	sub    $0x10,%rsp
+	uint32_t max, ebx, edx;
+
+	mem_features = 0;
+  8004e7:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  8004ee:	00 00 00 
+  8004f1:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	cpuid(0, &max, NULL, NULL, NULL);
+  8004f7:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+  8004fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800501:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800506:	ba 00 00 00 00       	mov    $0x0,%edx
+  80050b:	48 89 c6             	mov    %rax,%rsi
+  80050e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800513:	48 b8 eb 00 80 00 00 	movabs $0x8000eb,%rax
+  80051a:	00 00 00 
+  80051d:	ff d0                	call   *%rax
+	cpuid(1, NULL, NULL, NULL, &edx);
+  80051f:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  800523:	49 89 c0             	mov    %rax,%r8
+  800526:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80052b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800530:	be 00 00 00 00       	mov    $0x0,%esi
+  800535:	bf 01 00 00 00       	mov    $0x1,%edi
+  80053a:	48 b8 eb 00 80 00 00 	movabs $0x8000eb,%rax
+  800541:	00 00 00 
+  800544:	ff d0                	call   *%rax
+	if (edx & (1 << 26))
+  800546:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800549:	25 00 00 00 04       	and    $0x4000000,%eax
+  80054e:	85 c0                	test   %eax,%eax
+  800550:	74 1d                	je     80056f <mem_init+0x90>
+		mem_features |= MEM_F_NT;
+  800552:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  800559:	00 00 00 
+  80055c:	8b 00                	mov    (%rax),%eax
+  80055e:	83 c8 02             	or     $0x2,%eax
+  800561:	89 c2                	mov    %eax,%edx
+  800563:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  80056a:	00 00 00 
+  80056d:	89 10                	mov    %edx,(%rax)
+	if (max >= 7)
+  80056f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800572:	83 f8 06             	cmp    $0x6,%eax
+  800575:	76 57                	jbe    8005ce <mem_init+0xef>
+	{
+		cpuid_count(7, 0, NULL, &ebx, NULL, NULL);
+  800577:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  80057b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800581:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800587:	48 89 c1             	mov    %rax,%rcx
+  80058a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80058f:	be 00 00 00 00       	mov    $0x0,%esi
+  800594:	bf 07 00 00 00       	mov    $0x7,%edi
+  800599:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  8005a0:	00 00 00 
+  8005a3:	ff d0                	call   *%rax
+		if (ebx & (1 << 9))
+  8005a5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8005a8:	25 00 02 00 00       	and    $0x200,%eax
+  8005ad:	85 c0                	test   %eax,%eax
+  8005af:	74 1d                	je     8005ce <mem_init+0xef>
+			mem_features |= MEM_F_ERMS;
+  8005b1:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  8005b8:	00 00 00 
+  8005bb:	8b 00                	mov    (%rax),%eax
+  8005bd:	83 c8 01             	or     $0x1,%eax
+  8005c0:	89 c2                	mov    %eax,%edx
+  8005c2:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  8005c9:	00 00 00 
+  8005cc:	89 10                	mov    %edx,(%rax)
+	}
+}
+  8005ce:	90                   	nop
+  8005cf:	c9                   	leave
+  8005d0:	c3                   	ret
+
+00000000008005d1 <memset_nt>:
+
+// 非临时存储填充 n 字节(v 8 字节对齐，n 为 32 的倍数)
+static void
+memset_nt(void *v, uint64_t pattern, size_t n)
+{
+  8005d1:	55                   	push   %rbp
+  8005d2:	48 89 e5             	mov    %rsp,%rbp
+  8005d5:	48 83 ec 28          	sub    $0x28,%rsp
+  8005d9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8005dd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8005e1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t *p = (uint64_t *)v;
+  8005e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005e9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint64_t *end = p + n / 8;
+  8005ed:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8005f1:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  8005f5:	48 89 c2             	mov    %rax,%rdx
+  8005f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005fc:	48 01 d0             	add    %rdx,%rax
+  8005ff:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	for (; p < end; p += 4)
+  800603:	eb 20                	jmp    800625 <memset_nt+0x54>
+		asm volatile("movnti %1, 0(%0)\n\t"
+  800605:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800609:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80060d:	48 0f c3 10          	movnti %rdx,(%rax)
+  800611:	48 0f c3 50 08       	movnti %rdx,0x8(%rax)
+  800616:	48 0f c3 50 10       	movnti %rdx,0x10(%rax)
+  80061b:	48 0f c3 50 18       	movnti %rdx,0x18(%rax)
+	for (; p < end; p += 4)
+  800620:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  800625:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800629:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80062d:	72 d6                	jb     800605 <memset_nt+0x34>
+					 "movnti %1, 16(%0)\n\t"
+					 "movnti %1, 24(%0)"
+					 :
+					 : "r"(p), "r"(pattern)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  80062f:	0f ae f8             	sfence
+}
+  800632:	90                   	nop
+  800633:	c9                   	leave
+  800634:	c3                   	ret
+
+0000000000800635 <memcpy_nt>:
+
+// 非临时存储复制 n 字节(dst/src 8 字节对齐且不重叠，n 为 32 的倍数)
+static void
+memcpy_nt(void *dst, const void *src, size_t n)
+{
+  800635:	55                   	push   %rbp
+  800636:	48 89 e5             	mov    %rsp,%rbp
+  800639:	48 83 ec 58          	sub    $0x58,%rsp
+  80063d:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  800641:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  800645:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	uint64_t *d = (uint64_t *)dst;
+  800649:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80064d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint64_t *s = (const uint64_t *)src;
+  800651:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800655:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	uint64_t *end = d + n / 8;
+  800659:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80065d:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  800661:	48 89 c2             	mov    %rax,%rdx
+  800664:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800668:	48 01 d0             	add    %rdx,%rax
+  80066b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint64_t t0, t1, t2, t3;
+
+	for (; d < end; d += 4, s += 4)
+  80066f:	eb 44                	jmp    8006b5 <memcpy_nt+0x80>
+		asm volatile("movq 0(%4), %0\n\t"
+  800671:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800675:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800679:	4c 8b 00             	mov    (%rax),%r8
+  80067c:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  800680:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  800684:	48 8b 48 18          	mov    0x18(%rax),%rcx
+  800688:	4c 0f c3 02          	movnti %r8,(%rdx)
+  80068c:	48 0f c3 7a 08       	movnti %rdi,0x8(%rdx)
+  800691:	48 0f c3 72 10       	movnti %rsi,0x10(%rdx)
+  800696:	48 0f c3 4a 18       	movnti %rcx,0x18(%rdx)
+  80069b:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80069f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8006a3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8006a7:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+	for (; d < end; d += 4, s += 4)
+  8006ab:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  8006b0:	48 83 45 f0 20       	addq   $0x20,-0x10(%rbp)
+  8006b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006b9:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  8006bd:	72 b2                	jb     800671 <memcpy_nt+0x3c>
+					 "movnti %2, 16(%5)\n\t"
+					 "movnti %3, 24(%5)"
+					 : "=&r"(t0), "=&r"(t1), "=&r"(t2), "=&r"(t3)
+					 : "r"(s), "r"(d)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  8006bf:	0f ae f8             	sfence
+}
+  8006c2:	90                   	nop
+  8006c3:	c9                   	leave
+  8006c4:	c3                   	ret
+
+00000000008006c5 <memcpy_fwd>:
+
+// 正向复制(dst 在 src 之前或两者不重叠)
+static void
+memcpy_fwd(void *dst, const void *src, size_t n)
+{
+  8006c5:	55                   	push   %rbp
+  8006c6:	48 89 e5             	mov    %rsp,%rbp
+  8006c9:	48 83 ec 18          	sub    $0x18,%rsp
+  8006cd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006d1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8006d5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  8006d9:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  8006e0:	00 00 00 
+  8006e3:	8b 00                	mov    (%rax),%eax
+  8006e5:	83 e0 02             	and    $0x2,%eax
+  8006e8:	85 c0                	test   %eax,%eax
+  8006ea:	74 66                	je     800752 <memcpy_fwd+0x8d>
+  8006ec:	48 81 7d e8 ff 0f 00 	cmpq   $0xfff,-0x18(%rbp)
+  8006f3:	00 
+  8006f4:	76 5c                	jbe    800752 <memcpy_fwd+0x8d>
+  8006f6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8006fe:	48 09 d0             	or     %rdx,%rax
+  800701:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  800705:	83 e0 1f             	and    $0x1f,%eax
+  800708:	48 85 c0             	test   %rax,%rax
+  80070b:	75 45                	jne    800752 <memcpy_fwd+0x8d>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  80070d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800711:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800715:	48 01 d0             	add    %rdx,%rax
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  800718:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80071c:	73 11                	jae    80072f <memcpy_fwd+0x6a>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  80071e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800722:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800726:	48 01 d0             	add    %rdx,%rax
+  800729:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80072d:	72 23                	jb     800752 <memcpy_fwd+0x8d>
+		memcpy_nt(dst, src, n);
+  80072f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800733:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800737:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80073b:	48 89 ce             	mov    %rcx,%rsi
+  80073e:	48 89 c7             	mov    %rax,%rdi
+  800741:	48 b8 35 06 80 00 00 	movabs $0x800635,%rax
+  800748:	00 00 00 
+  80074b:	ff d0                	call   *%rax
+  80074d:	e9 81 00 00 00       	jmp    8007d3 <memcpy_fwd+0x10e>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  800752:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  800759:	00 00 00 
+  80075c:	8b 00                	mov    (%rax),%eax
+  80075e:	83 e0 01             	and    $0x1,%eax
+  800761:	85 c0                	test   %eax,%eax
+  800763:	74 21                	je     800786 <memcpy_fwd+0xc1>
+  800765:	48 81 7d e8 ff 00 00 	cmpq   $0xff,-0x18(%rbp)
+  80076c:	00 
+  80076d:	76 17                	jbe    800786 <memcpy_fwd+0xc1>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  80076f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800773:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800777:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80077b:	48 89 c7             	mov    %rax,%rdi
+  80077e:	48 89 d6             	mov    %rdx,%rsi
+  800781:	fc                   	cld
+  800782:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800784:	eb 4d                	jmp    8007d3 <memcpy_fwd+0x10e>
+					 : "cc", "memory");
+	else if ((((uint64_t)dst | (uint64_t)src | n) & 7) == 0)
+  800786:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80078a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80078e:	48 09 d0             	or     %rdx,%rax
+  800791:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  800795:	83 e0 07             	and    $0x7,%eax
+  800798:	48 85 c0             	test   %rax,%rax
+  80079b:	75 1f                	jne    8007bc <memcpy_fwd+0xf7>
+		asm volatile("cld; rep movsq\n" ::"D"(dst), "S"(src), "c"(n / 8)
+  80079d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007a1:	48 c1 e8 03          	shr    $0x3,%rax
+  8007a5:	48 89 c1             	mov    %rax,%rcx
+  8007a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007ac:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8007b0:	48 89 c7             	mov    %rax,%rdi
+  8007b3:	48 89 d6             	mov    %rdx,%rsi
+  8007b6:	fc                   	cld
+  8007b7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+					 : "cc", "memory");
+}
+  8007ba:	eb 17                	jmp    8007d3 <memcpy_fwd+0x10e>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  8007bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007c0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8007c4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8007c8:	48 89 c7             	mov    %rax,%rdi
+  8007cb:	48 89 d6             	mov    %rdx,%rsi
+  8007ce:	fc                   	cld
+  8007cf:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+  8007d1:	eb 00                	jmp    8007d3 <memcpy_fwd+0x10e>
+  8007d3:	90                   	nop
+  8007d4:	c9                   	leave
+  8007d5:	c3                   	ret
+
+00000000008007d6 <memset>:
+
+void *
+memset(void *v, int c, size_t n)
+{
+  8007d6:	55                   	push   %rbp
+  8007d7:	48 89 e5             	mov    %rsp,%rbp
+  8007da:	48 83 ec 28          	sub    $0x28,%rsp
+  8007de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8007e2:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8007e5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t pattern;
+
+	if (n == 0)
+  8007e9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8007ee:	75 09                	jne    8007f9 <memset+0x23>
+		return v;
+  8007f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007f4:	e9 dc 00 00 00       	jmp    8008d5 <memset+0xff>
+	c &= 0xFF;
+  8007f9:	81 65 e4 ff 00 00 00 	andl   $0xff,-0x1c(%rbp)
+	pattern = (uint64_t)c * 0x0101010101010101UL;
+  800800:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800803:	48 98                	cltq
+  800805:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  80080c:	01 01 01 
+  80080f:	48 0f af c2          	imul   %rdx,%rax
+  800813:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)v | n) & 31) == 0)
+  800817:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  80081e:	00 00 00 
+  800821:	8b 00                	mov    (%rax),%eax
+  800823:	83 e0 02             	and    $0x2,%eax
+  800826:	85 c0                	test   %eax,%eax
+  800828:	74 3a                	je     800864 <memset+0x8e>
+  80082a:	48 81 7d d8 ff 0f 00 	cmpq   $0xfff,-0x28(%rbp)
+  800831:	00 
+  800832:	76 30                	jbe    800864 <memset+0x8e>
+  800834:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800838:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  80083c:	83 e0 1f             	and    $0x1f,%eax
+  80083f:	48 85 c0             	test   %rax,%rax
+  800842:	75 20                	jne    800864 <memset+0x8e>
+		memset_nt(v, pattern, n);
+  800844:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800848:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80084c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800850:	48 89 ce             	mov    %rcx,%rsi
+  800853:	48 89 c7             	mov    %rax,%rdi
+  800856:	48 b8 d1 05 80 00 00 	movabs $0x8005d1,%rax
+  80085d:	00 00 00 
+  800860:	ff d0                	call   *%rax
+  800862:	eb 6d                	jmp    8008d1 <memset+0xfb>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  800864:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  80086b:	00 00 00 
+  80086e:	8b 00                	mov    (%rax),%eax
+  800870:	83 e0 01             	and    $0x1,%eax
+  800873:	85 c0                	test   %eax,%eax
+  800875:	74 1d                	je     800894 <memset+0xbe>
+  800877:	48 81 7d d8 ff 00 00 	cmpq   $0xff,-0x28(%rbp)
+  80087e:	00 
+  80087f:	76 13                	jbe    800894 <memset+0xbe>
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  800881:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800885:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800888:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80088c:	48 89 d7             	mov    %rdx,%rdi
+  80088f:	fc                   	cld
+  800890:	f3 aa                	rep stos %al,%es:(%rdi)
+  800892:	eb 3d                	jmp    8008d1 <memset+0xfb>
+					 : "cc", "memory");
+	else if ((((uint64_t)v | n) & 7) == 0)
+  800894:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800898:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  80089c:	83 e0 07             	and    $0x7,%eax
+  80089f:	48 85 c0             	test   %rax,%rax
+  8008a2:	75 1c                	jne    8008c0 <memset+0xea>
+		asm volatile("cld; rep stosq\n" ::"D"(v), "a"(pattern), "c"(n / 8)
+  8008a4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8008a8:	48 c1 e8 03          	shr    $0x3,%rax
+  8008ac:	48 89 c1             	mov    %rax,%rcx
+  8008af:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008b7:	48 89 d7             	mov    %rdx,%rdi
+  8008ba:	fc                   	cld
+  8008bb:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8008be:	eb 11                	jmp    8008d1 <memset+0xfb>
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  8008c0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008c4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8008c7:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8008cb:	48 89 d7             	mov    %rdx,%rdi
+  8008ce:	fc                   	cld
+  8008cf:	f3 aa                	rep stos %al,%es:(%rdi)
+					 : "cc", "memory");
+	return v;
+  8008d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8008d5:	c9                   	leave
+  8008d6:	c3                   	ret
+
+00000000008008d7 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008d7:	55                   	push   %rbp
+  8008d8:	48 89 e5             	mov    %rsp,%rbp
+  8008db:	48 83 ec 28          	sub    $0x28,%rsp
+  8008df:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8008e3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8008e7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  8008eb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8008ef:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8008f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008f7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d)
+  8008fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008ff:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  800903:	73 7c                	jae    800981 <memmove+0xaa>
+  800905:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800909:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80090d:	48 01 d0             	add    %rdx,%rax
+  800910:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  800914:	73 6b                	jae    800981 <memmove+0xaa>
+	{
+		// 重叠且 dst 在 src 之后，只能反向复制(ERMS 对反向 rep movsb 没有优化)
+		s += n;
+  800916:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80091a:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  80091e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800922:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((((uint64_t)s | (uint64_t)d | n) & 7) == 0)
+  800926:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80092a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80092e:	48 09 d0             	or     %rdx,%rax
+  800931:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  800935:	83 e0 07             	and    $0x7,%eax
+  800938:	48 85 c0             	test   %rax,%rax
+  80093b:	75 24                	jne    800961 <memmove+0x8a>
+			asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80093d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800941:	48 83 e8 08          	sub    $0x8,%rax
+  800945:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800949:	48 83 ea 08          	sub    $0x8,%rdx
+  80094d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  800951:	48 c1 e9 03          	shr    $0x3,%rcx
+  800955:	48 89 c7             	mov    %rax,%rdi
+  800958:	48 89 d6             	mov    %rdx,%rsi
+  80095b:	fd                   	std
+  80095c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80095f:	eb 1d                	jmp    80097e <memmove+0xa7>
+						 : "cc", "memory");
+		else
+			asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800961:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800965:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800969:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80096d:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+  800971:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800975:	48 89 d7             	mov    %rdx,%rdi
+  800978:	48 89 c1             	mov    %rax,%rcx
+  80097b:	fd                   	std
+  80097c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+						 : "cc", "memory");
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::
+  80097e:	fc                   	cld
+  80097f:	eb 25                	jmp    8009a6 <memmove+0xcf>
+						 : "cc");
+	}
+	else if (n)
+  800981:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800986:	74 1e                	je     8009a6 <memmove+0xcf>
+		memcpy_fwd(d, s, n);
+  800988:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80098c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800990:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800994:	48 89 ce             	mov    %rcx,%rsi
+  800997:	48 89 c7             	mov    %rax,%rdi
+  80099a:	48 b8 c5 06 80 00 00 	movabs $0x8006c5,%rax
+  8009a1:	00 00 00 
+  8009a4:	ff d0                	call   *%rax
+	return dst;
+  8009a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8009aa:	c9                   	leave
+  8009ab:	c3                   	ret
+
+00000000008009ac <memcpy>:
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009ac:	55                   	push   %rbp
+  8009ad:	48 89 e5             	mov    %rsp,%rbp
+  8009b0:	48 83 ec 18          	sub    $0x18,%rsp
+  8009b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8009b8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8009bc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (n)
+  8009c0:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8009c5:	74 1e                	je     8009e5 <memcpy+0x39>
+		memcpy_fwd(dst, src, n);
+  8009c7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009cb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8009cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009d3:	48 89 ce             	mov    %rcx,%rsi
+  8009d6:	48 89 c7             	mov    %rax,%rdi
+  8009d9:	48 b8 c5 06 80 00 00 	movabs $0x8006c5,%rax
+  8009e0:	00 00 00 
+  8009e3:	ff d0                	call   *%rax
+	return dst;
+  8009e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8009e9:	c9                   	leave
+  8009ea:	c3                   	ret
+
+00000000008009eb <memcmp>:
+{
+}
+#endif
+
+int memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009eb:	55                   	push   %rbp
+  8009ec:	48 89 e5             	mov    %rsp,%rbp
+  8009ef:	48 83 ec 28          	sub    $0x28,%rsp
+  8009f3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8009f7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8009fb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *)v1;
+  8009ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a03:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *)v2;
+  800a07:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800a0b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0)
+  800a0f:	eb 34                	jmp    800a45 <memcmp+0x5a>
+	{
+		if (*s1 != *s2)
+  800a11:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a15:	0f b6 10             	movzbl (%rax),%edx
+  800a18:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800a1c:	0f b6 00             	movzbl (%rax),%eax
+  800a1f:	38 c2                	cmp    %al,%dl
+  800a21:	74 18                	je     800a3b <memcmp+0x50>
+			return (int)*s1 - (int)*s2;
+  800a23:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a27:	0f b6 00             	movzbl (%rax),%eax
+  800a2a:	0f b6 d0             	movzbl %al,%edx
+  800a2d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800a31:	0f b6 00             	movzbl (%rax),%eax
+  800a34:	0f b6 c0             	movzbl %al,%eax
+  800a37:	29 c2                	sub    %eax,%edx
+  800a39:	eb 20                	jmp    800a5b <memcmp+0x70>
+		s1++, s2++;
+  800a3b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800a40:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0)
+  800a45:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a49:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800a4d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800a51:	48 85 c0             	test   %rax,%rax
+  800a54:	75 bb                	jne    800a11 <memcmp+0x26>
+	}
+
+	return 0;
+  800a56:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  800a5b:	89 d0                	mov    %edx,%eax
+  800a5d:	c9                   	leave
+  800a5e:	c3                   	ret
+
+0000000000800a5f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a5f:	55                   	push   %rbp
+  800a60:	48 89 e5             	mov    %rsp,%rbp
+  800a63:	48 83 ec 28          	sub    $0x28,%rsp
+  800a67:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a6b:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  800a6e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *)s + n;
+  800a72:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a76:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a7a:	48 01 d0             	add    %rdx,%rax
+  800a7d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  800a81:	eb 13                	jmp    800a96 <memfind+0x37>
+		if (*(const unsigned char *)s == (unsigned char)c)
+  800a83:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a87:	0f b6 00             	movzbl (%rax),%eax
+  800a8a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800a8d:	38 d0                	cmp    %dl,%al
+  800a8f:	74 11                	je     800aa2 <memfind+0x43>
+	for (; s < ends; s++)
+  800a91:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800a96:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a9a:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  800a9e:	72 e3                	jb     800a83 <memfind+0x24>
+  800aa0:	eb 01                	jmp    800aa3 <memfind+0x44>
+			break;
+  800aa2:	90                   	nop
+	return (void *)s;
+  800aa3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  800aa7:	c9                   	leave
+  800aa8:	c3                   	ret
+
+0000000000800aa9 <strtol>:
+
+long strtol(const char *s, char **endptr, int base)
+{
+  800aa9:	55                   	push   %rbp
+  800aaa:	48 89 e5             	mov    %rsp,%rbp
+  800aad:	48 83 ec 38          	sub    $0x38,%rsp
+  800ab1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800ab5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  800ab9:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  800abc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  800ac3:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  800aca:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800acb:	eb 05                	jmp    800ad2 <strtol+0x29>
+		s++;
+  800acd:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  800ad2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ad6:	0f b6 00             	movzbl (%rax),%eax
+  800ad9:	3c 20                	cmp    $0x20,%al
+  800adb:	74 f0                	je     800acd <strtol+0x24>
+  800add:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ae1:	0f b6 00             	movzbl (%rax),%eax
+  800ae4:	3c 09                	cmp    $0x9,%al
+  800ae6:	74 e5                	je     800acd <strtol+0x24>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ae8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800aec:	0f b6 00             	movzbl (%rax),%eax
+  800aef:	3c 2b                	cmp    $0x2b,%al
+  800af1:	75 07                	jne    800afa <strtol+0x51>
+		s++;
+  800af3:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  800af8:	eb 17                	jmp    800b11 <strtol+0x68>
+	else if (*s == '-')
+  800afa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800afe:	0f b6 00             	movzbl (%rax),%eax
+  800b01:	3c 2d                	cmp    $0x2d,%al
+  800b03:	75 0c                	jne    800b11 <strtol+0x68>
+		s++, neg = 1;
+  800b05:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  800b0a:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b11:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800b15:	74 06                	je     800b1d <strtol+0x74>
+  800b17:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  800b1b:	75 28                	jne    800b45 <strtol+0x9c>
+  800b1d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b21:	0f b6 00             	movzbl (%rax),%eax
+  800b24:	3c 30                	cmp    $0x30,%al
+  800b26:	75 1d                	jne    800b45 <strtol+0x9c>
+  800b28:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b2c:	48 83 c0 01          	add    $0x1,%rax
+  800b30:	0f b6 00             	movzbl (%rax),%eax
+  800b33:	3c 78                	cmp    $0x78,%al
+  800b35:	75 0e                	jne    800b45 <strtol+0x9c>
+		s += 2, base = 16;
+  800b37:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  800b3c:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  800b43:	eb 2c                	jmp    800b71 <strtol+0xc8>
+	else if (base == 0 && s[0] == '0')
+  800b45:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800b49:	75 19                	jne    800b64 <strtol+0xbb>
+  800b4b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b4f:	0f b6 00             	movzbl (%rax),%eax
+  800b52:	3c 30                	cmp    $0x30,%al
+  800b54:	75 0e                	jne    800b64 <strtol+0xbb>
+		s++, base = 8;
+  800b56:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  800b5b:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  800b62:	eb 0d                	jmp    800b71 <strtol+0xc8>
+	else if (base == 0)
+  800b64:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800b68:	75 07                	jne    800b71 <strtol+0xc8>
+		base = 10;
+  800b6a:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+	// digits
+	while (1)
+	{
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  800b71:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b75:	0f b6 00             	movzbl (%rax),%eax
+  800b78:	3c 2f                	cmp    $0x2f,%al
+  800b7a:	7e 1d                	jle    800b99 <strtol+0xf0>
+  800b7c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b80:	0f b6 00             	movzbl (%rax),%eax
+  800b83:	3c 39                	cmp    $0x39,%al
+  800b85:	7f 12                	jg     800b99 <strtol+0xf0>
+			dig = *s - '0';
+  800b87:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b8b:	0f b6 00             	movzbl (%rax),%eax
+  800b8e:	0f be c0             	movsbl %al,%eax
+  800b91:	83 e8 30             	sub    $0x30,%eax
+  800b94:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800b97:	eb 4e                	jmp    800be7 <strtol+0x13e>
+		else if (*s >= 'a' && *s <= 'z')
+  800b99:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b9d:	0f b6 00             	movzbl (%rax),%eax
+  800ba0:	3c 60                	cmp    $0x60,%al
+  800ba2:	7e 1d                	jle    800bc1 <strtol+0x118>
+  800ba4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ba8:	0f b6 00             	movzbl (%rax),%eax
+  800bab:	3c 7a                	cmp    $0x7a,%al
+  800bad:	7f 12                	jg     800bc1 <strtol+0x118>
+			dig = *s - 'a' + 10;
+  800baf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bb3:	0f b6 00             	movzbl (%rax),%eax
+  800bb6:	0f be c0             	movsbl %al,%eax
+  800bb9:	83 e8 57             	sub    $0x57,%eax
+  800bbc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800bbf:	eb 26                	jmp    800be7 <strtol+0x13e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bc1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bc5:	0f b6 00             	movzbl (%rax),%eax
+  800bc8:	3c 40                	cmp    $0x40,%al
+  800bca:	7e 47                	jle    800c13 <strtol+0x16a>
+  800bcc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bd0:	0f b6 00             	movzbl (%rax),%eax
+  800bd3:	3c 5a                	cmp    $0x5a,%al
+  800bd5:	7f 3c                	jg     800c13 <strtol+0x16a>
+			dig = *s - 'A' + 10;
+  800bd7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bdb:	0f b6 00             	movzbl (%rax),%eax
+  800bde:	0f be c0             	movsbl %al,%eax
+  800be1:	83 e8 37             	sub    $0x37,%eax
+  800be4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  800be7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800bea:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  800bed:	7d 23                	jge    800c12 <strtol+0x169>
+			break;
+		s++, val = (val * base) + dig;
+  800bef:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  800bf4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800bf7:	48 98                	cltq
+  800bf9:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  800bfe:	48 89 c2             	mov    %rax,%rdx
+  800c01:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800c04:	48 98                	cltq
+  800c06:	48 01 d0             	add    %rdx,%rax
+  800c09:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+  800c0d:	e9 5f ff ff ff       	jmp    800b71 <strtol+0xc8>
+			break;
+  800c12:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c13:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800c18:	74 0b                	je     800c25 <strtol+0x17c>
+		*endptr = (char *)s;
+  800c1a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c1e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800c22:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  800c25:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800c29:	74 09                	je     800c34 <strtol+0x18b>
+  800c2b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c2f:	48 f7 d8             	neg    %rax
+  800c32:	eb 04                	jmp    800c38 <strtol+0x18f>
+  800c34:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  800c38:	c9                   	leave
+  800c39:	c3                   	ret
+
+0000000000800c3a <strstr>:
+
+char *strstr(const char *in, const char *str)
+{
+  800c3a:	55                   	push   %rbp
+  800c3b:	48 89 e5             	mov    %rsp,%rbp
+  800c3e:	48 83 ec 30          	sub    $0x30,%rsp
+  800c42:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800c46:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  800c4a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c4e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c52:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800c56:	0f b6 00             	movzbl (%rax),%eax
+  800c59:	88 45 ff             	mov    %al,-0x1(%rbp)
+	if (!c)
+  800c5c:	80 7d ff 00          	cmpb   $0x0,-0x1(%rbp)
+  800c60:	75 06                	jne    800c68 <strstr+0x2e>
+		return (char *)in; // Trivial empty string case
+  800c62:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c66:	eb 6b                	jmp    800cd3 <strstr+0x99>
+
+	len = strlen(str);
+  800c68:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c6c:	48 89 c7             	mov    %rax,%rdi
+  800c6f:	48 b8 df 01 80 00 00 	movabs $0x8001df,%rax
+  800c76:	00 00 00 
+  800c79:	ff d0                	call   *%rax
+  800c7b:	48 98                	cltq
+  800c7d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+		char sc;
+
+		do
+		{
+			sc = *in++;
+  800c81:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c85:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c89:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800c8d:	0f b6 00             	movzbl (%rax),%eax
+  800c90:	88 45 ef             	mov    %al,-0x11(%rbp)
+			if (!sc)
+  800c93:	80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+  800c97:	75 07                	jne    800ca0 <strstr+0x66>
+				return (char *)0;
+  800c99:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c9e:	eb 33                	jmp    800cd3 <strstr+0x99>
+		} while (sc != c);
+  800ca0:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+  800ca4:	3a 45 ff             	cmp    -0x1(%rbp),%al
+  800ca7:	75 d8                	jne    800c81 <strstr+0x47>
+	} while (strncmp(in, str, len) != 0);
+  800ca9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800cad:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  800cb1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800cb5:	48 89 ce             	mov    %rcx,%rsi
+  800cb8:	48 89 c7             	mov    %rax,%rdi
+  800cbb:	48 b8 fa 03 80 00 00 	movabs $0x8003fa,%rax
+  800cc2:	00 00 00 
+  800cc5:	ff d0                	call   *%rax
+  800cc7:	85 c0                	test   %eax,%eax
+  800cc9:	75 b6                	jne    800c81 <strstr+0x47>
+
+	return (char *)(in - 1);
+  800ccb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ccf:	48 83 e8 01          	sub    $0x1,%rax
+}
+  800cd3:	c9                   	leave
+  800cd4:	c3                   	ret
+
+0000000000800cd5 <syscall>:
+ * 用户的指令式系统调用，该函数将系统调用序号放入eax寄存器，五个参数依次放入edx, ecx, ebx, edi, esi，然后执行指令int 0x30，
+ * 发生中断后，去IDT中查找中断处理函数，最终会走到kern/trap.c的trap_dispatch()中
+ */
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  800cd5:	55                   	push   %rbp
+  800cd6:	48 89 e5             	mov    %rsp,%rbp
+  800cd9:	53                   	push   %rbx
+  800cda:	48 83 ec 48          	sub    $0x48,%rsp
+  800cde:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800ce1:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  800ce4:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800ce8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800cec:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  800cf0:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	 * volatile 告诉汇编程序不要因为不使用返回值就优化该指令
+	 * 最后一个子句告诉汇编程序，指令可能会改变条件代码cx和任意内存memory位置
+	 * 由汇编编译器做好数据保存和恢复工作(栈)
+	 */
+
+	asm volatile("int %1\n"			// code: int T_SYSCALL
+  800cf4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800cf7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800cfb:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  800cff:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  800d03:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  800d07:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  800d0b:	4c 89 c3             	mov    %r8,%rbx
+  800d0e:	cd 30                	int    $0x30
+  800d10:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+				   "D"(a4),			// edi = a4
+				   "S"(a5)			// esi = a5
+				 : "cc", "memory"); // 指令可能会改变条件代码cx和任意内存memory位置
+									// 由汇编编译器做好数据保存和恢复工作(栈)
+
+	if (check && ret > 0)
+  800d14:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800d18:	74 44                	je     800d5e <syscall+0x89>
+  800d1a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  800d1f:	7e 3d                	jle    800d5e <syscall+0x89>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d21:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d25:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800d28:	49 89 d0             	mov    %rdx,%r8
+  800d2b:	89 c1                	mov    %eax,%ecx
+  800d2d:	48 b8 ca 21 80 00 00 	movabs $0x8021ca,%rax
+  800d34:	00 00 00 
+  800d37:	48 89 c2             	mov    %rax,%rdx
+  800d3a:	be 34 00 00 00       	mov    $0x34,%esi
+  800d3f:	48 b8 e7 21 80 00 00 	movabs $0x8021e7,%rax
+  800d46:	00 00 00 
+  800d49:	48 89 c7             	mov    %rax,%rdi
+  800d4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d51:	49 b9 48 14 80 00 00 	movabs $0x801448,%r9
+  800d58:	00 00 00 
+  800d5b:	41 ff d1             	call   *%r9
+
+	return ret;
+  800d5e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  800d62:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800d66:	c9                   	leave
+  800d67:	c3                   	ret
+
+0000000000800d68 <sys_cputs>:
+
+void sys_cputs(const char *s, size_t len)
+{
+  800d68:	55                   	push   %rbp
+  800d69:	48 89 e5             	mov    %rsp,%rbp
+  800d6c:	48 83 ec 10          	sub    $0x10,%rsp
+  800d70:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800d74:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 调用lib/syscall.c中的syscall()
+	// SYS_cputs: 系统调用序号(eax)，s: 需要输出的字符数组，len: 数组长度
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  800d78:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d7c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800d80:	48 83 ec 08          	sub    $0x8,%rsp
+  800d84:	6a 00                	push   $0x0
+  800d86:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800d8c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800d92:	48 89 d1             	mov    %rdx,%rcx
+  800d95:	48 89 c2             	mov    %rax,%rdx
+  800d98:	be 00 00 00 00       	mov    $0x0,%esi
+  800d9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800da2:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  800da9:	00 00 00 
+  800dac:	ff d0                	call   *%rax
+  800dae:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800db2:	90                   	nop
+  800db3:	c9                   	leave
+  800db4:	c3                   	ret
+
+0000000000800db5 <sys_cgetc>:
+
+int sys_cgetc(void)
+{
+  800db5:	55                   	push   %rbp
+  800db6:	48 89 e5             	mov    %rsp,%rbp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800db9:	48 83 ec 08          	sub    $0x8,%rsp
+  800dbd:	6a 00                	push   $0x0
+  800dbf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800dc5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800dcb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd5:	be 00 00 00 00       	mov    $0x0,%esi
+  800dda:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ddf:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  800de6:	00 00 00 
+  800de9:	ff d0                	call   *%rax
+  800deb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800def:	c9                   	leave
+  800df0:	c3                   	ret
+
+0000000000800df1 <sys_env_destroy>:
+
+int sys_env_destroy(envid_t envid)
+{
+  800df1:	55                   	push   %rbp
+  800df2:	48 89 e5             	mov    %rsp,%rbp
+  800df5:	48 83 ec 10          	sub    $0x10,%rsp
+  800df9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	// 销毁envid对应的环境
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800dfc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800dff:	48 98                	cltq
+  800e01:	48 83 ec 08          	sub    $0x8,%rsp
+  800e05:	6a 00                	push   $0x0
+  800e07:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800e0d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e13:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e18:	48 89 c2             	mov    %rax,%rdx
+  800e1b:	be 01 00 00 00       	mov    $0x1,%esi
+  800e20:	bf 03 00 00 00       	mov    $0x3,%edi
+  800e25:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  800e2c:	00 00 00 
+  800e2f:	ff d0                	call   *%rax
+  800e31:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800e35:	c9                   	leave
+  800e36:	c3                   	ret
+
+0000000000800e37 <sys_getprocid>:
+
+envid_t
+sys_getprocid(void)
+{
+  800e37:	55                   	push   %rbp
+  800e38:	48 89 e5             	mov    %rsp,%rbp
+	// 获取当前用户环境id
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800e3b:	48 83 ec 08          	sub    $0x8,%rsp
+  800e3f:	6a 00                	push   $0x0
+  800e41:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800e47:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e4d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e52:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e57:	be 00 00 00 00       	mov    $0x0,%esi
+  800e5c:	bf 02 00 00 00       	mov    $0x2,%edi
+  800e61:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  800e68:	00 00 00 
+  800e6b:	ff d0                	call   *%rax
+  800e6d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800e71:	c9                   	leave
+  800e72:	c3                   	ret
+
+0000000000800e73 <sys_yield>:
+
+void sys_yield(void)
+{
+  800e73:	55                   	push   %rbp
+  800e74:	48 89 e5             	mov    %rsp,%rbp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  800e77:	48 83 ec 08          	sub    $0x8,%rsp
+  800e7b:	6a 00                	push   $0x0
+  800e7d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800e83:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e89:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e93:	be 00 00 00 00       	mov    $0x0,%esi
+  800e98:	bf 0b 00 00 00       	mov    $0xb,%edi
+  800e9d:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  800ea4:	00 00 00 
+  800ea7:	ff d0                	call   *%rax
+  800ea9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800ead:	90                   	nop
+  800eae:	c9                   	leave
+  800eaf:	c3                   	ret
+
+0000000000800eb0 <sys_page_alloc>:
+
+int sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800eb0:	55                   	push   %rbp
+  800eb1:	48 89 e5             	mov    %rsp,%rbp
+  800eb4:	48 83 ec 10          	sub    $0x10,%rsp
+  800eb8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800ebb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800ebf:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  800ec2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800ec5:	48 63 c8             	movslq %eax,%rcx
+  800ec8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800ecc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ecf:	48 98                	cltq
+  800ed1:	48 83 ec 08          	sub    $0x8,%rsp
+  800ed5:	6a 00                	push   $0x0
+  800ed7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800edd:	49 89 c8             	mov    %rcx,%r8
+  800ee0:	48 89 d1             	mov    %rdx,%rcx
+  800ee3:	48 89 c2             	mov    %rax,%rdx
+  800ee6:	be 01 00 00 00       	mov    $0x1,%esi
+  800eeb:	bf 04 00 00 00       	mov    $0x4,%edi
+  800ef0:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  800ef7:	00 00 00 
+  800efa:	ff d0                	call   *%rax
+  800efc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800f00:	c9                   	leave
+  800f01:	c3                   	ret
+
+0000000000800f02 <sys_page_map>:
+
+int sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f02:	55                   	push   %rbp
+  800f03:	48 89 e5             	mov    %rsp,%rbp
+  800f06:	48 83 ec 20          	sub    $0x20,%rsp
+  800f0a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800f0d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800f11:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  800f14:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f18:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  800f1c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800f1f:	48 63 c8             	movslq %eax,%rcx
+  800f22:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  800f26:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800f29:	48 63 f0             	movslq %eax,%rsi
+  800f2c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800f30:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800f33:	48 98                	cltq
+  800f35:	48 83 ec 08          	sub    $0x8,%rsp
+  800f39:	51                   	push   %rcx
+  800f3a:	49 89 f9             	mov    %rdi,%r9
+  800f3d:	49 89 f0             	mov    %rsi,%r8
+  800f40:	48 89 d1             	mov    %rdx,%rcx
+  800f43:	48 89 c2             	mov    %rax,%rdx
+  800f46:	be 01 00 00 00       	mov    $0x1,%esi
+  800f4b:	bf 05 00 00 00       	mov    $0x5,%edi
+  800f50:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  800f57:	00 00 00 
+  800f5a:	ff d0                	call   *%rax
+  800f5c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800f60:	c9                   	leave
+  800f61:	c3                   	ret
+
+0000000000800f62 <sys_page_unmap>:
+
+int sys_page_unmap(envid_t envid, void *va)
+{
+  800f62:	55                   	push   %rbp
+  800f63:	48 89 e5             	mov    %rsp,%rbp
+  800f66:	48 83 ec 10          	sub    $0x10,%rsp
+  800f6a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800f6d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  800f71:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800f75:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800f78:	48 98                	cltq
+  800f7a:	48 83 ec 08          	sub    $0x8,%rsp
+  800f7e:	6a 00                	push   $0x0
+  800f80:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800f86:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f8c:	48 89 d1             	mov    %rdx,%rcx
+  800f8f:	48 89 c2             	mov    %rax,%rdx
+  800f92:	be 01 00 00 00       	mov    $0x1,%esi
+  800f97:	bf 06 00 00 00       	mov    $0x6,%edi
+  800f9c:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  800fa3:	00 00 00 
+  800fa6:	ff d0                	call   *%rax
+  800fa8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800fac:	c9                   	leave
+  800fad:	c3                   	ret
+
+0000000000800fae <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int sys_env_set_status(envid_t envid, int status)
+{
+  800fae:	55                   	push   %rbp
+  800faf:	48 89 e5             	mov    %rsp,%rbp
+  800fb2:	48 83 ec 10          	sub    $0x10,%rsp
+  800fb6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800fb9:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  800fbc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800fbf:	48 63 d0             	movslq %eax,%rdx
+  800fc2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800fc5:	48 98                	cltq
+  800fc7:	48 83 ec 08          	sub    $0x8,%rsp
+  800fcb:	6a 00                	push   $0x0
+  800fcd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800fd3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fd9:	48 89 d1             	mov    %rdx,%rcx
+  800fdc:	48 89 c2             	mov    %rax,%rdx
+  800fdf:	be 01 00 00 00       	mov    $0x1,%esi
+  800fe4:	bf 08 00 00 00       	mov    $0x8,%edi
+  800fe9:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  800ff0:	00 00 00 
+  800ff3:	ff d0                	call   *%rax
+  800ff5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800ff9:	c9                   	leave
+  800ffa:	c3                   	ret
+
+0000000000800ffb <sys_env_set_trapframe>:
+
+int sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ffb:	55                   	push   %rbp
+  800ffc:	48 89 e5             	mov    %rsp,%rbp
+  800fff:	48 83 ec 10          	sub    $0x10,%rsp
+  801003:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801006:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  80100a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80100e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801011:	48 98                	cltq
+  801013:	48 83 ec 08          	sub    $0x8,%rsp
+  801017:	6a 00                	push   $0x0
+  801019:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80101f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801025:	48 89 d1             	mov    %rdx,%rcx
+  801028:	48 89 c2             	mov    %rax,%rdx
+  80102b:	be 01 00 00 00       	mov    $0x1,%esi
+  801030:	bf 09 00 00 00       	mov    $0x9,%edi
+  801035:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  80103c:	00 00 00 
+  80103f:	ff d0                	call   *%rax
+  801041:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801045:	c9                   	leave
+  801046:	c3                   	ret
+
+0000000000801047 <sys_env_set_pgfault_upcall>:
+
+int sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801047:	55                   	push   %rbp
+  801048:	48 89 e5             	mov    %rsp,%rbp
+  80104b:	48 83 ec 10          	sub    $0x10,%rsp
+  80104f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801052:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  801056:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80105a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80105d:	48 98                	cltq
+  80105f:	48 83 ec 08          	sub    $0x8,%rsp
+  801063:	6a 00                	push   $0x0
+  801065:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80106b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801071:	48 89 d1             	mov    %rdx,%rcx
+  801074:	48 89 c2             	mov    %rax,%rdx
+  801077:	be 01 00 00 00       	mov    $0x1,%esi
+  80107c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801081:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  801088:	00 00 00 
+  80108b:	ff d0                	call   *%rax
+  80108d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801091:	c9                   	leave
+  801092:	c3                   	ret
+
+0000000000801093 <sys_ipc_try_send>:
+
+int sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  801093:	55                   	push   %rbp
+  801094:	48 89 e5             	mov    %rsp,%rbp
+  801097:	48 83 ec 20          	sub    $0x20,%rsp
+  80109b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80109e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8010a2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8010a6:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8010a9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8010ac:	48 63 f0             	movslq %eax,%rsi
+  8010af:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8010b3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8010b6:	48 98                	cltq
+  8010b8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8010bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8010c0:	6a 00                	push   $0x0
+  8010c2:	49 89 f1             	mov    %rsi,%r9
+  8010c5:	49 89 c8             	mov    %rcx,%r8
+  8010c8:	48 89 d1             	mov    %rdx,%rcx
+  8010cb:	48 89 c2             	mov    %rax,%rdx
+  8010ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d3:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8010d8:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  8010df:	00 00 00 
+  8010e2:	ff d0                	call   *%rax
+  8010e4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8010e8:	c9                   	leave
+  8010e9:	c3                   	ret
+
+00000000008010ea <sys_ipc_recv>:
+
+int sys_ipc_recv(void *dstva)
+{
+  8010ea:	55                   	push   %rbp
+  8010eb:	48 89 e5             	mov    %rsp,%rbp
+  8010ee:	48 83 ec 10          	sub    $0x10,%rsp
+  8010f2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8010f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8010fe:	6a 00                	push   $0x0
+  801100:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801106:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80110c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801111:	48 89 c2             	mov    %rax,%rdx
+  801114:	be 01 00 00 00       	mov    $0x1,%esi
+  801119:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80111e:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  801125:	00 00 00 
+  801128:	ff d0                	call   *%rax
+  80112a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80112e:	c9                   	leave
+  80112f:	c3                   	ret
+
+0000000000801130 <sys_disk_io>:
+
+int sys_disk_io(int dev, uint64_t secno, void *va, size_t nsecs, int write)
+{
+  801130:	55                   	push   %rbp
+  801131:	48 89 e5             	mov    %rsp,%rbp
+  801134:	48 83 ec 20          	sub    $0x20,%rsp
+  801138:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80113b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80113f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801143:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  801147:	44 89 45 f8          	mov    %r8d,-0x8(%rbp)
+	return syscall(SYS_disk_io, 0, dev, secno, (uint64_t)va, nsecs, write);
+  80114b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80114e:	48 63 c8             	movslq %eax,%rcx
+  801151:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  801155:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801158:	48 98                	cltq
+  80115a:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80115e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801162:	48 83 ec 08          	sub    $0x8,%rsp
+  801166:	51                   	push   %rcx
+  801167:	49 89 f9             	mov    %rdi,%r9
+  80116a:	49 89 f0             	mov    %rsi,%r8
+  80116d:	48 89 d1             	mov    %rdx,%rcx
+  801170:	48 89 c2             	mov    %rax,%rdx
+  801173:	be 00 00 00 00       	mov    $0x0,%esi
+  801178:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80117d:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  801184:	00 00 00 
+  801187:	ff d0                	call   *%rax
+  801189:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80118d:	c9                   	leave
+  80118e:	c3                   	ret
+
+000000000080118f <sys_vma_alloc>:
+
+int sys_vma_alloc(envid_t envid, void *va, size_t len, int perm)
+{
+  80118f:	55                   	push   %rbp
+  801190:	48 89 e5             	mov    %rsp,%rbp
+  801193:	48 83 ec 20          	sub    $0x20,%rsp
+  801197:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80119a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80119e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8011a2:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_vma_alloc, 1, envid, (uint64_t)va, len, perm, 0);
+  8011a5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8011a8:	48 63 f0             	movslq %eax,%rsi
+  8011ab:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8011af:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8011b2:	48 98                	cltq
+  8011b4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8011b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8011bc:	6a 00                	push   $0x0
+  8011be:	49 89 f1             	mov    %rsi,%r9
+  8011c1:	49 89 c8             	mov    %rcx,%r8
+  8011c4:	48 89 d1             	mov    %rdx,%rcx
+  8011c7:	48 89 c2             	mov    %rax,%rdx
+  8011ca:	be 01 00 00 00       	mov    $0x1,%esi
+  8011cf:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8011d4:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  8011db:	00 00 00 
+  8011de:	ff d0                	call   *%rax
+  8011e0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8011e4:	c9                   	leave
+  8011e5:	c3                   	ret
+
+00000000008011e6 <sys_vma_clear>:
+
+int sys_vma_clear(envid_t envid)
+{
+  8011e6:	55                   	push   %rbp
+  8011e7:	48 89 e5             	mov    %rsp,%rbp
+  8011ea:	48 83 ec 10          	sub    $0x10,%rsp
+  8011ee:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_vma_clear, 1, envid, 0, 0, 0, 0);
+  8011f1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8011f4:	48 98                	cltq
+  8011f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8011fa:	6a 00                	push   $0x0
+  8011fc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801202:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801208:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80120d:	48 89 c2             	mov    %rax,%rdx
+  801210:	be 01 00 00 00       	mov    $0x1,%esi
+  801215:	bf 10 00 00 00       	mov    $0x10,%edi
+  80121a:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  801221:	00 00 00 
+  801224:	ff d0                	call   *%rax
+  801226:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80122a:	c9                   	leave
+  80122b:	c3                   	ret
+
+000000000080122c <sys_trace_ctl>:
+
+int sys_trace_ctl(int enable)
+{
+  80122c:	55                   	push   %rbp
+  80122d:	48 89 e5             	mov    %rsp,%rbp
+  801230:	48 83 ec 10          	sub    $0x10,%rsp
+  801234:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_trace_ctl, 0, enable, 0, 0, 0, 0);
+  801237:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80123a:	48 98                	cltq
+  80123c:	48 83 ec 08          	sub    $0x8,%rsp
+  801240:	6a 00                	push   $0x0
+  801242:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801248:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80124e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801253:	48 89 c2             	mov    %rax,%rdx
+  801256:	be 00 00 00 00       	mov    $0x0,%esi
+  80125b:	bf 11 00 00 00       	mov    $0x11,%edi
+  801260:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  801267:	00 00 00 
+  80126a:	ff d0                	call   *%rax
+  80126c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801270:	c9                   	leave
+  801271:	c3                   	ret
+
+0000000000801272 <sys_trace_read>:
+
+int sys_trace_read(int cpu, uint64_t *seq, struct TraceEvent *buf, int n)
+{
+  801272:	55                   	push   %rbp
+  801273:	48 89 e5             	mov    %rsp,%rbp
+  801276:	48 83 ec 20          	sub    $0x20,%rsp
+  80127a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80127d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801281:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801285:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_trace_read, 0, cpu, (uint64_t)seq, (uint64_t)buf, n, 0);
+  801288:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80128b:	48 63 f0             	movslq %eax,%rsi
+  80128e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801292:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801296:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801299:	48 98                	cltq
+  80129b:	48 83 ec 08          	sub    $0x8,%rsp
+  80129f:	6a 00                	push   $0x0
+  8012a1:	49 89 f1             	mov    %rsi,%r9
+  8012a4:	49 89 c8             	mov    %rcx,%r8
+  8012a7:	48 89 d1             	mov    %rdx,%rcx
+  8012aa:	48 89 c2             	mov    %rax,%rdx
+  8012ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b2:	bf 12 00 00 00       	mov    $0x12,%edi
+  8012b7:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  8012be:	00 00 00 
+  8012c1:	ff d0                	call   *%rax
+  8012c3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8012c7:	c9                   	leave
+  8012c8:	c3                   	ret
+
+00000000008012c9 <sys_getrusage>:
+
+int sys_getrusage(envid_t envid, struct Rusage *ru)
+{
+  8012c9:	55                   	push   %rbp
+  8012ca:	48 89 e5             	mov    %rsp,%rbp
+  8012cd:	48 83 ec 10          	sub    $0x10,%rsp
+  8012d1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8012d4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_getrusage, 0, envid, (uint64_t)ru, 0, 0, 0);
+  8012d8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8012dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012df:	48 98                	cltq
+  8012e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8012e5:	6a 00                	push   $0x0
+  8012e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8012ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012f3:	48 89 d1             	mov    %rdx,%rcx
+  8012f6:	48 89 c2             	mov    %rax,%rdx
+  8012f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fe:	bf 13 00 00 00       	mov    $0x13,%edi
+  801303:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  80130a:	00 00 00 
+  80130d:	ff d0                	call   *%rax
+  80130f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801313:	c9                   	leave
+  801314:	c3                   	ret
+
+0000000000801315 <sys_pmu_config>:
+
+int sys_pmu_config(int idx, uint64_t event)
+{
+  801315:	55                   	push   %rbp
+  801316:	48 89 e5             	mov    %rsp,%rbp
+  801319:	48 83 ec 10          	sub    $0x10,%rsp
+  80131d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801320:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_pmu_config, 0, idx, event, 0, 0, 0);
+  801324:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801327:	48 98                	cltq
+  801329:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80132d:	48 83 ec 08          	sub    $0x8,%rsp
+  801331:	6a 00                	push   $0x0
+  801333:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801339:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80133f:	48 89 d1             	mov    %rdx,%rcx
+  801342:	48 89 c2             	mov    %rax,%rdx
+  801345:	be 00 00 00 00       	mov    $0x0,%esi
+  80134a:	bf 14 00 00 00       	mov    $0x14,%edi
+  80134f:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  801356:	00 00 00 
+  801359:	ff d0                	call   *%rax
+  80135b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80135f:	c9                   	leave
+  801360:	c3                   	ret
+
+0000000000801361 <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  801361:	55                   	push   %rbp
+  801362:	48 89 e5             	mov    %rsp,%rbp
+  801365:	48 83 ec 10          	sub    $0x10,%rsp
+  801369:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+  80136c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80136f:	48 83 ec 08          	sub    $0x8,%rsp
+  801373:	6a 00                	push   $0x0
+  801375:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80137b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801381:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801386:	48 89 c2             	mov    %rax,%rdx
+  801389:	be 00 00 00 00       	mov    $0x0,%esi
+  80138e:	bf 15 00 00 00       	mov    $0x15,%edi
+  801393:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  80139a:	00 00 00 
+  80139d:	ff d0                	call   *%rax
+  80139f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8013a3:	c9                   	leave
+  8013a4:	c3                   	ret
+
+00000000008013a5 <sys_image_attach>:
+
+int sys_image_attach(envid_t envid, int dev, const uint64_t *secnos, size_t size)
+{
+  8013a5:	55                   	push   %rbp
+  8013a6:	48 89 e5             	mov    %rsp,%rbp
+  8013a9:	48 83 ec 20          	sub    $0x20,%rsp
+  8013ad:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8013b0:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  8013b3:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8013b7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+	return syscall(SYS_image_attach, 1, envid, dev, (uint64_t)secnos, size, 0);
+  8013bb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8013bf:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8013c2:	48 63 d0             	movslq %eax,%rdx
+  8013c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8013c8:	48 98                	cltq
+  8013ca:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8013ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8013d2:	6a 00                	push   $0x0
+  8013d4:	49 89 f1             	mov    %rsi,%r9
+  8013d7:	49 89 c8             	mov    %rcx,%r8
+  8013da:	48 89 d1             	mov    %rdx,%rcx
+  8013dd:	48 89 c2             	mov    %rax,%rdx
+  8013e0:	be 01 00 00 00       	mov    $0x1,%esi
+  8013e5:	bf 16 00 00 00       	mov    $0x16,%edi
+  8013ea:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  8013f1:	00 00 00 
+  8013f4:	ff d0                	call   *%rax
+  8013f6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8013fa:	c9                   	leave
+  8013fb:	c3                   	ret
+
+00000000008013fc <sys_vma_binary>:
+
+int sys_vma_binary(envid_t envid, const struct Proghdr *ph)
+{
+  8013fc:	55                   	push   %rbp
+  8013fd:	48 89 e5             	mov    %rsp,%rbp
+  801400:	48 83 ec 10          	sub    $0x10,%rsp
+  801404:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801407:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_vma_binary, 1, envid, (uint64_t)ph, 0, 0, 0);
+  80140b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80140f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801412:	48 98                	cltq
+  801414:	48 83 ec 08          	sub    $0x8,%rsp
+  801418:	6a 00                	push   $0x0
+  80141a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801420:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801426:	48 89 d1             	mov    %rdx,%rcx
+  801429:	48 89 c2             	mov    %rax,%rdx
+  80142c:	be 01 00 00 00       	mov    $0x1,%esi
+  801431:	bf 17 00 00 00       	mov    $0x17,%edi
+  801436:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  80143d:	00 00 00 
+  801440:	ff d0                	call   *%rax
+  801442:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801446:	c9                   	leave
+  801447:	c3                   	ret
+
+0000000000801448 <_panic>:
+/*
+ * 无法解决的致命错误会导致死机
+ * 打印"死机:<消息>”，然后导致处理器休眠进入HLT状态
+ */
+void _panic(const char *file, int line, const char *fmt, ...)
+{
+  801448:	55                   	push   %rbp
+  801449:	48 89 e5             	mov    %rsp,%rbp
+  80144c:	53                   	push   %rbx
+  80144d:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  801454:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  80145b:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  801461:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  801468:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  80146f:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  801476:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  80147d:	84 c0                	test   %al,%al
+  80147f:	74 23                	je     8014a4 <_panic+0x5c>
+  801481:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  801488:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  80148c:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  801490:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  801494:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  801498:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  80149c:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  8014a0:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8014a4:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  8014ab:	00 00 00 
+  8014ae:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  8014b5:	00 00 00 
+  8014b8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014bc:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  8014c3:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  8014ca:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+	// 输出死机的信息
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8014d1:	48 b8 00 30 80 00 00 	movabs $0x803000,%rax
+  8014d8:	00 00 00 
+  8014db:	48 8b 18             	mov    (%rax),%rbx
+  8014de:	48 b8 37 0e 80 00 00 	movabs $0x800e37,%rax
+  8014e5:	00 00 00 
+  8014e8:	ff d0                	call   *%rax
+  8014ea:	89 c6                	mov    %eax,%esi
+  8014ec:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  8014f2:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8014f9:	41 89 d0             	mov    %edx,%r8d
+  8014fc:	48 89 c1             	mov    %rax,%rcx
+  8014ff:	48 89 da             	mov    %rbx,%rdx
+  801502:	48 b8 f8 21 80 00 00 	movabs $0x8021f8,%rax
+  801509:	00 00 00 
+  80150c:	48 89 c7             	mov    %rax,%rdi
+  80150f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801514:	49 b9 8b 16 80 00 00 	movabs $0x80168b,%r9
+  80151b:	00 00 00 
+  80151e:	41 ff d1             	call   *%r9
+			sys_getprocid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801521:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  801528:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80152f:	48 89 d6             	mov    %rdx,%rsi
+  801532:	48 89 c7             	mov    %rax,%rdi
+  801535:	48 b8 dc 15 80 00 00 	movabs $0x8015dc,%rax
+  80153c:	00 00 00 
+  80153f:	ff d0                	call   *%rax
+	cprintf("\n");
+  801541:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  801548:	00 00 00 
+  80154b:	48 89 c7             	mov    %rax,%rdi
+  80154e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801553:	48 ba 8b 16 80 00 00 	movabs $0x80168b,%rdx
+  80155a:	00 00 00 
+  80155d:	ff d2                	call   *%rdx
+
+	// 触发断点中断
+	while (1)
+		asm volatile("int3");
+  80155f:	cc                   	int3
+  801560:	eb fd                	jmp    80155f <_panic+0x117>
+
+0000000000801562 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801562:	55                   	push   %rbp
+  801563:	48 89 e5             	mov    %rsp,%rbp
+  801566:	48 83 ec 10          	sub    $0x10,%rsp
+  80156a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80156d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->buf[b->idx++] = ch;
+  801571:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801575:	8b 00                	mov    (%rax),%eax
+  801577:	8d 48 01             	lea    0x1(%rax),%ecx
+  80157a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80157e:	89 0a                	mov    %ecx,(%rdx)
+  801580:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801583:	89 d1                	mov    %edx,%ecx
+  801585:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801589:	48 98                	cltq
+  80158b:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+	if (b->idx == 256-1) {
+  80158f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801593:	8b 00                	mov    (%rax),%eax
+  801595:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80159a:	75 2c                	jne    8015c8 <putch+0x66>
+		sys_cputs(b->buf, b->idx);
+  80159c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015a0:	8b 00                	mov    (%rax),%eax
+  8015a2:	48 98                	cltq
+  8015a4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8015a8:	48 83 c2 08          	add    $0x8,%rdx
+  8015ac:	48 89 c6             	mov    %rax,%rsi
+  8015af:	48 89 d7             	mov    %rdx,%rdi
+  8015b2:	48 b8 68 0d 80 00 00 	movabs $0x800d68,%rax
+  8015b9:	00 00 00 
+  8015bc:	ff d0                	call   *%rax
+		b->idx = 0;
+  8015be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015c2:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	}
+	b->cnt++;
+  8015c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015cc:	8b 40 04             	mov    0x4(%rax),%eax
+  8015cf:	8d 50 01             	lea    0x1(%rax),%edx
+  8015d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015d6:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8015d9:	90                   	nop
+  8015da:	c9                   	leave
+  8015db:	c3                   	ret
+
+00000000008015dc <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8015dc:	55                   	push   %rbp
+  8015dd:	48 89 e5             	mov    %rsp,%rbp
+  8015e0:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8015e7:	48 89 bd c8 fe ff ff 	mov    %rdi,-0x138(%rbp)
+  8015ee:	48 89 b5 c0 fe ff ff 	mov    %rsi,-0x140(%rbp)
+	struct printbuf b;
+	va_list aq;
+	va_copy(aq,ap);
+  8015f5:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  8015fc:	48 8b b5 c0 fe ff ff 	mov    -0x140(%rbp),%rsi
+  801603:	48 8b 06             	mov    (%rsi),%rax
+  801606:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80160a:	48 89 01             	mov    %rax,(%rcx)
+  80160d:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801611:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801615:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	b.idx = 0;
+  801619:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  801620:	00 00 00 
+	b.cnt = 0;
+  801623:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80162a:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, aq);
+  80162d:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  801634:	48 8b 95 c8 fe ff ff 	mov    -0x138(%rbp),%rdx
+  80163b:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  801642:	48 89 c6             	mov    %rax,%rsi
+  801645:	48 b8 62 15 80 00 00 	movabs $0x801562,%rax
+  80164c:	00 00 00 
+  80164f:	48 89 c7             	mov    %rax,%rdi
+  801652:	48 b8 29 1a 80 00 00 	movabs $0x801a29,%rax
+  801659:	00 00 00 
+  80165c:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  80165e:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  801664:	48 98                	cltq
+  801666:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  80166d:	48 83 c2 08          	add    $0x8,%rdx
+  801671:	48 89 c6             	mov    %rax,%rsi
+  801674:	48 89 d7             	mov    %rdx,%rdi
+  801677:	48 b8 68 0d 80 00 00 	movabs $0x800d68,%rax
+  80167e:	00 00 00 
+  801681:	ff d0                	call   *%rax
+	va_end(aq);
+
+	return b.cnt;
+  801683:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  801689:	c9                   	leave
+  80168a:	c3                   	ret
+
+000000000080168b <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80168b:	55                   	push   %rbp
+  80168c:	48 89 e5             	mov    %rsp,%rbp
+  80168f:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  801696:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80169d:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8016a4:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8016ab:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8016b2:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8016b9:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8016c0:	84 c0                	test   %al,%al
+  8016c2:	74 20                	je     8016e4 <cprintf+0x59>
+  8016c4:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8016c8:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8016cc:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8016d0:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8016d4:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8016d8:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8016dc:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8016e0:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+	va_list aq;
+	va_start(ap, fmt);
+  8016e4:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8016eb:	00 00 00 
+  8016ee:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8016f5:	00 00 00 
+  8016f8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8016fc:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801703:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80170a:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  801711:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801718:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  80171f:	48 8b 06             	mov    (%rsi),%rax
+  801722:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801726:	48 89 01             	mov    %rax,(%rcx)
+  801729:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80172d:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801731:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	cnt = vcprintf(fmt, aq);
+  801735:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80173c:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801743:	48 89 d6             	mov    %rdx,%rsi
+  801746:	48 89 c7             	mov    %rax,%rdi
+  801749:	48 b8 dc 15 80 00 00 	movabs $0x8015dc,%rax
+  801750:	00 00 00 
+  801753:	ff d0                	call   *%rax
+  801755:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return cnt;
+  80175b:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801761:	c9                   	leave
+  801762:	c3                   	ret
+
+0000000000801763 <printnum>:
+ * num: 需要打印出来的整型数，base: 整型数的进制，其他参数同 vprintfmt
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+		 unsigned long long num, unsigned base, int width, int padc)
+{
+  801763:	55                   	push   %rbp
+  801764:	48 89 e5             	mov    %rsp,%rbp
+  801767:	48 83 ec 30          	sub    $0x30,%rsp
+  80176b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80176f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801773:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801777:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  80177a:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  80177e:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+	// 当 num 超过一位数，首先递归函数自身打印所有高位的(更重要的)数字
+	if (num >= base)
+  801782:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801785:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  801789:	72 54                	jb     8017df <printnum+0x7c>
+	{
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80178b:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80178e:	8d 78 ff             	lea    -0x1(%rax),%edi
+  801791:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  801794:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801798:	ba 00 00 00 00       	mov    $0x0,%edx
+  80179d:	48 f7 f6             	div    %rsi
+  8017a0:	49 89 c2             	mov    %rax,%r10
+  8017a3:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8017a6:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8017a9:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8017ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017b1:	41 89 c9             	mov    %ecx,%r9d
+  8017b4:	41 89 f8             	mov    %edi,%r8d
+  8017b7:	89 d1                	mov    %edx,%ecx
+  8017b9:	4c 89 d2             	mov    %r10,%rdx
+  8017bc:	48 89 c7             	mov    %rax,%rdi
+  8017bf:	48 b8 63 17 80 00 00 	movabs $0x801763,%rax
+  8017c6:	00 00 00 
+  8017c9:	ff d0                	call   *%rax
+  8017cb:	eb 1c                	jmp    8017e9 <printnum+0x86>
+	}
+	else
+	{
+		// 按照右对齐的格式在左侧补齐填充字符 padc
+		while (--width > 0)
+			putch(padc, putdat);
+  8017cd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8017d1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8017d4:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8017d8:	48 89 d6             	mov    %rdx,%rsi
+  8017db:	89 c7                	mov    %eax,%edi
+  8017dd:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8017df:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  8017e3:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8017e7:	7f e4                	jg     8017cd <printnum+0x6a>
+	}
+
+	// 然后打印个位数字
+	putch("0123456789abcdef"[num % base], putdat);
+  8017e9:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8017ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017f5:	48 f7 f1             	div    %rcx
+  8017f8:	48 b8 10 24 80 00 00 	movabs $0x802410,%rax
+  8017ff:	00 00 00 
+  801802:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  801806:	0f be c0             	movsbl %al,%eax
+  801809:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80180d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801811:	48 89 d6             	mov    %rdx,%rsi
+  801814:	89 c7                	mov    %eax,%edi
+  801816:	ff d1                	call   *%rcx
+}
+  801818:	90                   	nop
+  801819:	c9                   	leave
+  80181a:	c3                   	ret
+
+000000000080181b <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  80181b:	55                   	push   %rbp
+  80181c:	48 89 e5             	mov    %rsp,%rbp
+  80181f:	48 83 ec 20          	sub    $0x20,%rsp
+  801823:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801827:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;
+	if (lflag >= 2)
+  80182a:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  80182e:	7e 4f                	jle    80187f <getuint+0x64>
+		x = va_arg(*ap, unsigned long long);
+  801830:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801834:	8b 00                	mov    (%rax),%eax
+  801836:	83 f8 2f             	cmp    $0x2f,%eax
+  801839:	77 24                	ja     80185f <getuint+0x44>
+  80183b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80183f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801843:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801847:	8b 00                	mov    (%rax),%eax
+  801849:	89 c0                	mov    %eax,%eax
+  80184b:	48 01 d0             	add    %rdx,%rax
+  80184e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801852:	8b 12                	mov    (%rdx),%edx
+  801854:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801857:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80185b:	89 0a                	mov    %ecx,(%rdx)
+  80185d:	eb 14                	jmp    801873 <getuint+0x58>
+  80185f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801863:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801867:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80186b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80186f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801873:	48 8b 00             	mov    (%rax),%rax
+  801876:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80187a:	e9 9d 00 00 00       	jmp    80191c <getuint+0x101>
+	else if (lflag)
+  80187f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  801883:	74 4c                	je     8018d1 <getuint+0xb6>
+		x = va_arg(*ap, unsigned long);
+  801885:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801889:	8b 00                	mov    (%rax),%eax
+  80188b:	83 f8 2f             	cmp    $0x2f,%eax
+  80188e:	77 24                	ja     8018b4 <getuint+0x99>
+  801890:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801894:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801898:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80189c:	8b 00                	mov    (%rax),%eax
+  80189e:	89 c0                	mov    %eax,%eax
+  8018a0:	48 01 d0             	add    %rdx,%rax
+  8018a3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018a7:	8b 12                	mov    (%rdx),%edx
+  8018a9:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8018ac:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018b0:	89 0a                	mov    %ecx,(%rdx)
+  8018b2:	eb 14                	jmp    8018c8 <getuint+0xad>
+  8018b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018b8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8018bc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8018c0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018c4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8018c8:	48 8b 00             	mov    (%rax),%rax
+  8018cb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8018cf:	eb 4b                	jmp    80191c <getuint+0x101>
+	else
+		x = va_arg(*ap, unsigned int);
+  8018d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018d5:	8b 00                	mov    (%rax),%eax
+  8018d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8018da:	77 24                	ja     801900 <getuint+0xe5>
+  8018dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018e0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8018e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018e8:	8b 00                	mov    (%rax),%eax
+  8018ea:	89 c0                	mov    %eax,%eax
+  8018ec:	48 01 d0             	add    %rdx,%rax
+  8018ef:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018f3:	8b 12                	mov    (%rdx),%edx
+  8018f5:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8018f8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018fc:	89 0a                	mov    %ecx,(%rdx)
+  8018fe:	eb 14                	jmp    801914 <getuint+0xf9>
+  801900:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801904:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801908:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80190c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801910:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801914:	8b 00                	mov    (%rax),%eax
+  801916:	89 c0                	mov    %eax,%eax
+  801918:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80191c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801920:	c9                   	leave
+  801921:	c3                   	ret
+
+0000000000801922 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  801922:	55                   	push   %rbp
+  801923:	48 89 e5             	mov    %rsp,%rbp
+  801926:	48 83 ec 20          	sub    $0x20,%rsp
+  80192a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80192e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  801931:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  801935:	7e 4f                	jle    801986 <getint+0x64>
+		x = va_arg(*ap, long long);
+  801937:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80193b:	8b 00                	mov    (%rax),%eax
+  80193d:	83 f8 2f             	cmp    $0x2f,%eax
+  801940:	77 24                	ja     801966 <getint+0x44>
+  801942:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801946:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80194a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80194e:	8b 00                	mov    (%rax),%eax
+  801950:	89 c0                	mov    %eax,%eax
+  801952:	48 01 d0             	add    %rdx,%rax
+  801955:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801959:	8b 12                	mov    (%rdx),%edx
+  80195b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80195e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801962:	89 0a                	mov    %ecx,(%rdx)
+  801964:	eb 14                	jmp    80197a <getint+0x58>
+  801966:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80196a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80196e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801972:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801976:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80197a:	48 8b 00             	mov    (%rax),%rax
+  80197d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801981:	e9 9d 00 00 00       	jmp    801a23 <getint+0x101>
+	else if (lflag)
+  801986:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80198a:	74 4c                	je     8019d8 <getint+0xb6>
+		x = va_arg(*ap, long);
+  80198c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801990:	8b 00                	mov    (%rax),%eax
+  801992:	83 f8 2f             	cmp    $0x2f,%eax
+  801995:	77 24                	ja     8019bb <getint+0x99>
+  801997:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80199b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80199f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019a3:	8b 00                	mov    (%rax),%eax
+  8019a5:	89 c0                	mov    %eax,%eax
+  8019a7:	48 01 d0             	add    %rdx,%rax
+  8019aa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8019ae:	8b 12                	mov    (%rdx),%edx
+  8019b0:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8019b3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8019b7:	89 0a                	mov    %ecx,(%rdx)
+  8019b9:	eb 14                	jmp    8019cf <getint+0xad>
+  8019bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019bf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8019c3:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8019c7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8019cb:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8019cf:	48 8b 00             	mov    (%rax),%rax
+  8019d2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8019d6:	eb 4b                	jmp    801a23 <getint+0x101>
+	else
+		x = va_arg(*ap, int);
+  8019d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019dc:	8b 00                	mov    (%rax),%eax
+  8019de:	83 f8 2f             	cmp    $0x2f,%eax
+  8019e1:	77 24                	ja     801a07 <getint+0xe5>
+  8019e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019e7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8019eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019ef:	8b 00                	mov    (%rax),%eax
+  8019f1:	89 c0                	mov    %eax,%eax
+  8019f3:	48 01 d0             	add    %rdx,%rax
+  8019f6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8019fa:	8b 12                	mov    (%rdx),%edx
+  8019fc:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8019ff:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a03:	89 0a                	mov    %ecx,(%rdx)
+  801a05:	eb 14                	jmp    801a1b <getint+0xf9>
+  801a07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a0b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801a0f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801a13:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a17:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801a1b:	8b 00                	mov    (%rax),%eax
+  801a1d:	48 98                	cltq
+  801a1f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  801a23:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801a27:	c9                   	leave
+  801a28:	c3                   	ret
+
+0000000000801a29 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap)
+{
+  801a29:	55                   	push   %rbp
+  801a2a:	48 89 e5             	mov    %rsp,%rbp
+  801a2d:	41 54                	push   %r12
+  801a2f:	53                   	push   %rbx
+  801a30:	48 83 ec 60          	sub    $0x60,%rsp
+  801a34:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801a38:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  801a3c:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  801a40:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+	int base, lflag, width, precision, altflag;
+
+	// 填充字符，在显示字符串的'%'后读到'-'或'0'时，赋值到 padc
+	char padc;
+	va_list aq;
+	va_copy(aq, ap);
+  801a44:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801a48:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801a4c:	48 8b 06             	mov    (%rsi),%rax
+  801a4f:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801a53:	48 89 01             	mov    %rax,(%rcx)
+  801a56:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801a5a:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801a5e:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1)
+	{
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  801a62:	eb 17                	jmp    801a7b <vprintfmt+0x52>
+		{
+			if (ch == '\0')
+  801a64:	85 db                	test   %ebx,%ebx
+  801a66:	0f 84 b9 04 00 00    	je     801f25 <vprintfmt+0x4fc>
+				return;
+			putch(ch, putdat);
+  801a6c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a70:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801a74:	48 89 c6             	mov    %rax,%rsi
+  801a77:	89 df                	mov    %ebx,%edi
+  801a79:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  801a7b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801a7f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a83:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  801a87:	0f b6 00             	movzbl (%rax),%eax
+  801a8a:	0f b6 d8             	movzbl %al,%ebx
+  801a8d:	83 fb 25             	cmp    $0x25,%ebx
+  801a90:	75 d2                	jne    801a64 <vprintfmt+0x3b>
+		}
+
+		// 处理 % 转义序列
+		// padc 初始化为空格符，padc='-'代表字符串左对齐，右边补空格，padc=' '代表右对齐，左边补空格，padc='0'右对齐，左边补0
+		padc = ' ';
+  801a92:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+		width = -1;
+  801a96:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+		// 默认-1代表显示长度为字符串本来的长度
+		precision = -1;
+  801a9d:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+		lflag = 0;
+  801aa4:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+		altflag = 0;
+  801aab:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *)fmt++)
+  801ab2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801ab6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801aba:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  801abe:	0f b6 00             	movzbl (%rax),%eax
+  801ac1:	0f b6 d8             	movzbl %al,%ebx
+  801ac4:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  801ac7:	83 f8 55             	cmp    $0x55,%eax
+  801aca:	0f 87 22 04 00 00    	ja     801ef2 <vprintfmt+0x4c9>
+  801ad0:	89 c0                	mov    %eax,%eax
+  801ad2:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801ad9:	00 
+  801ada:	48 b8 38 24 80 00 00 	movabs $0x802438,%rax
+  801ae1:	00 00 00 
+  801ae4:	48 01 d0             	add    %rdx,%rax
+  801ae7:	48 8b 00             	mov    (%rax),%rax
+  801aea:	ff e0                	jmp    *%rax
+		{
+
+		// flag to pad on the right
+		case '-':
+			padc = '-';
+  801aec:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+			goto reswitch;
+  801af0:	eb c0                	jmp    801ab2 <vprintfmt+0x89>
+
+		// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  801af2:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+			goto reswitch;
+  801af6:	eb ba                	jmp    801ab2 <vprintfmt+0x89>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0;; ++fmt)
+  801af8:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+			{
+				precision = precision * 10 + ch - '0';
+  801aff:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  801b02:	89 d0                	mov    %edx,%eax
+  801b04:	c1 e0 02             	shl    $0x2,%eax
+  801b07:	01 d0                	add    %edx,%eax
+  801b09:	01 c0                	add    %eax,%eax
+  801b0b:	01 d8                	add    %ebx,%eax
+  801b0d:	83 e8 30             	sub    $0x30,%eax
+  801b10:	89 45 d8             	mov    %eax,-0x28(%rbp)
+				ch = *fmt;
+  801b13:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801b17:	0f b6 00             	movzbl (%rax),%eax
+  801b1a:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  801b1d:	83 fb 2f             	cmp    $0x2f,%ebx
+  801b20:	7e 60                	jle    801b82 <vprintfmt+0x159>
+  801b22:	83 fb 39             	cmp    $0x39,%ebx
+  801b25:	7f 5b                	jg     801b82 <vprintfmt+0x159>
+			for (precision = 0;; ++fmt)
+  801b27:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+				precision = precision * 10 + ch - '0';
+  801b2c:	eb d1                	jmp    801aff <vprintfmt+0xd6>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  801b2e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b31:	83 f8 2f             	cmp    $0x2f,%eax
+  801b34:	77 17                	ja     801b4d <vprintfmt+0x124>
+  801b36:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b3a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801b3d:	89 d2                	mov    %edx,%edx
+  801b3f:	48 01 d0             	add    %rdx,%rax
+  801b42:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801b45:	83 c2 08             	add    $0x8,%edx
+  801b48:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801b4b:	eb 0c                	jmp    801b59 <vprintfmt+0x130>
+  801b4d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801b51:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801b55:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801b59:	8b 00                	mov    (%rax),%eax
+  801b5b:	89 45 d8             	mov    %eax,-0x28(%rbp)
+			goto process_precision;
+  801b5e:	eb 23                	jmp    801b83 <vprintfmt+0x15a>
+
+		case '.':
+			if (width < 0)
+  801b60:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801b64:	0f 89 48 ff ff ff    	jns    801ab2 <vprintfmt+0x89>
+				width = 0;
+  801b6a:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+			goto reswitch;
+  801b71:	e9 3c ff ff ff       	jmp    801ab2 <vprintfmt+0x89>
+
+		case '#':
+			altflag = 1;
+  801b76:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+			goto reswitch;
+  801b7d:	e9 30 ff ff ff       	jmp    801ab2 <vprintfmt+0x89>
+			goto process_precision;
+  801b82:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  801b83:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801b87:	0f 89 25 ff ff ff    	jns    801ab2 <vprintfmt+0x89>
+				width = precision, precision = -1;
+  801b8d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  801b90:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801b93:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+			goto reswitch;
+  801b9a:	e9 13 ff ff ff       	jmp    801ab2 <vprintfmt+0x89>
+
+		// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  801b9f:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+			goto reswitch;
+  801ba3:	e9 0a ff ff ff       	jmp    801ab2 <vprintfmt+0x89>
+
+		// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  801ba8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bab:	83 f8 2f             	cmp    $0x2f,%eax
+  801bae:	77 17                	ja     801bc7 <vprintfmt+0x19e>
+  801bb0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bb4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801bb7:	89 d2                	mov    %edx,%edx
+  801bb9:	48 01 d0             	add    %rdx,%rax
+  801bbc:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801bbf:	83 c2 08             	add    $0x8,%edx
+  801bc2:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801bc5:	eb 0c                	jmp    801bd3 <vprintfmt+0x1aa>
+  801bc7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801bcb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801bcf:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801bd3:	8b 00                	mov    (%rax),%eax
+  801bd5:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  801bd9:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801bdd:	48 89 d6             	mov    %rdx,%rsi
+  801be0:	89 c7                	mov    %eax,%edi
+  801be2:	ff d1                	call   *%rcx
+			break;
+  801be4:	e9 37 03 00 00       	jmp    801f20 <vprintfmt+0x4f7>
+
+		// error message
+		case 'e':
+			err = va_arg(aq, int);
+  801be9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bec:	83 f8 2f             	cmp    $0x2f,%eax
+  801bef:	77 17                	ja     801c08 <vprintfmt+0x1df>
+  801bf1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bf5:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801bf8:	89 d2                	mov    %edx,%edx
+  801bfa:	48 01 d0             	add    %rdx,%rax
+  801bfd:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801c00:	83 c2 08             	add    $0x8,%edx
+  801c03:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801c06:	eb 0c                	jmp    801c14 <vprintfmt+0x1eb>
+  801c08:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801c0c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801c10:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801c14:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  801c16:	85 db                	test   %ebx,%ebx
+  801c18:	79 02                	jns    801c1c <vprintfmt+0x1f3>
+				err = -err;
+  801c1a:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801c1c:	83 fb 11             	cmp    $0x11,%ebx
+  801c1f:	7f 16                	jg     801c37 <vprintfmt+0x20e>
+  801c21:	48 ba 80 23 80 00 00 	movabs $0x802380,%rdx
+  801c28:	00 00 00 
+  801c2b:	48 63 c3             	movslq %ebx,%rax
+  801c2e:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  801c32:	4d 85 e4             	test   %r12,%r12
+  801c35:	75 2e                	jne    801c65 <vprintfmt+0x23c>
+				printfmt(putch, putdat, "error %d", err);
+  801c37:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801c3b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801c3f:	89 d9                	mov    %ebx,%ecx
+  801c41:	48 ba 21 24 80 00 00 	movabs $0x802421,%rdx
+  801c48:	00 00 00 
+  801c4b:	48 89 c7             	mov    %rax,%rdi
+  801c4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c53:	49 b8 2f 1f 80 00 00 	movabs $0x801f2f,%r8
+  801c5a:	00 00 00 
+  801c5d:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  801c60:	e9 bb 02 00 00       	jmp    801f20 <vprintfmt+0x4f7>
+				printfmt(putch, putdat, "%s", p);
+  801c65:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801c69:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801c6d:	4c 89 e1             	mov    %r12,%rcx
+  801c70:	48 ba 2a 24 80 00 00 	movabs $0x80242a,%rdx
+  801c77:	00 00 00 
+  801c7a:	48 89 c7             	mov    %rax,%rdi
+  801c7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c82:	49 b8 2f 1f 80 00 00 	movabs $0x801f2f,%r8
+  801c89:	00 00 00 
+  801c8c:	41 ff d0             	call   *%r8
+			break;
+  801c8f:	e9 8c 02 00 00       	jmp    801f20 <vprintfmt+0x4f7>
+
+		// string
+		case 's':
+			// 从可变参数中读入字符串指针
+			if ((p = va_arg(aq, char *)) == NULL)
+  801c94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c97:	83 f8 2f             	cmp    $0x2f,%eax
+  801c9a:	77 17                	ja     801cb3 <vprintfmt+0x28a>
+  801c9c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ca0:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801ca3:	89 d2                	mov    %edx,%edx
+  801ca5:	48 01 d0             	add    %rdx,%rax
+  801ca8:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801cab:	83 c2 08             	add    $0x8,%edx
+  801cae:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801cb1:	eb 0c                	jmp    801cbf <vprintfmt+0x296>
+  801cb3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801cb7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801cbb:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801cbf:	4c 8b 20             	mov    (%rax),%r12
+  801cc2:	4d 85 e4             	test   %r12,%r12
+  801cc5:	75 0a                	jne    801cd1 <vprintfmt+0x2a8>
+				p = "(null)"; // 当字符串为空时，将它指向"(null)"字符串
+  801cc7:	49 bc 2d 24 80 00 00 	movabs $0x80242d,%r12
+  801cce:	00 00 00 
+			// 判断左对齐还是右对齐，pad='-'左对齐，否则右对齐
+			if (width > 0 && padc != '-')
+  801cd1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801cd5:	7e 78                	jle    801d4f <vprintfmt+0x326>
+  801cd7:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  801cdb:	74 72                	je     801d4f <vprintfmt+0x326>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801cdd:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  801ce0:	48 98                	cltq
+  801ce2:	48 89 c6             	mov    %rax,%rsi
+  801ce5:	4c 89 e7             	mov    %r12,%rdi
+  801ce8:	48 b8 0d 02 80 00 00 	movabs $0x80020d,%rax
+  801cef:	00 00 00 
+  801cf2:	ff d0                	call   *%rax
+  801cf4:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  801cf7:	eb 17                	jmp    801d10 <vprintfmt+0x2e7>
+					putch(padc, putdat); // 字符串右对齐，左边补相应数量(width-实际长度)的空格或者 0
+  801cf9:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  801cfd:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  801d01:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801d05:	48 89 d6             	mov    %rdx,%rsi
+  801d08:	89 c7                	mov    %eax,%edi
+  801d0a:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801d0c:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  801d10:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801d14:	7f e3                	jg     801cf9 <vprintfmt+0x2d0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801d16:	eb 37                	jmp    801d4f <vprintfmt+0x326>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801d18:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  801d1c:	74 1e                	je     801d3c <vprintfmt+0x313>
+  801d1e:	83 fb 1f             	cmp    $0x1f,%ebx
+  801d21:	7e 05                	jle    801d28 <vprintfmt+0x2ff>
+  801d23:	83 fb 7e             	cmp    $0x7e,%ebx
+  801d26:	7e 14                	jle    801d3c <vprintfmt+0x313>
+					putch('?', putdat);
+  801d28:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801d2c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801d30:	48 89 c6             	mov    %rax,%rsi
+  801d33:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801d38:	ff d2                	call   *%rdx
+  801d3a:	eb 0f                	jmp    801d4b <vprintfmt+0x322>
+				else
+					putch(ch, putdat); // 打印相应长度的字符串
+  801d3c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801d40:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801d44:	48 89 c6             	mov    %rax,%rsi
+  801d47:	89 df                	mov    %ebx,%edi
+  801d49:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801d4b:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  801d4f:	4c 89 e0             	mov    %r12,%rax
+  801d52:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801d56:	0f b6 00             	movzbl (%rax),%eax
+  801d59:	0f be d8             	movsbl %al,%ebx
+  801d5c:	85 db                	test   %ebx,%ebx
+  801d5e:	74 28                	je     801d88 <vprintfmt+0x35f>
+  801d60:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801d64:	78 b2                	js     801d18 <vprintfmt+0x2ef>
+  801d66:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  801d6a:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801d6e:	79 a8                	jns    801d18 <vprintfmt+0x2ef>
+			for (; width > 0; width--)
+  801d70:	eb 16                	jmp    801d88 <vprintfmt+0x35f>
+				putch(' ', putdat); // 当字符串是左对齐的时候打印相应数量的空格
+  801d72:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801d76:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801d7a:	48 89 c6             	mov    %rax,%rsi
+  801d7d:	bf 20 00 00 00       	mov    $0x20,%edi
+  801d82:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  801d84:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  801d88:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801d8c:	7f e4                	jg     801d72 <vprintfmt+0x349>
+			break;
+  801d8e:	e9 8d 01 00 00       	jmp    801f20 <vprintfmt+0x4f7>
+
+		// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  801d93:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801d97:	be 03 00 00 00       	mov    $0x3,%esi
+  801d9c:	48 89 c7             	mov    %rax,%rdi
+  801d9f:	48 b8 22 19 80 00 00 	movabs $0x801922,%rax
+  801da6:	00 00 00 
+  801da9:	ff d0                	call   *%rax
+  801dab:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((long long)num < 0)
+  801daf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801db3:	48 85 c0             	test   %rax,%rax
+  801db6:	79 1d                	jns    801dd5 <vprintfmt+0x3ac>
+			{
+				putch('-', putdat);
+  801db8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801dbc:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801dc0:	48 89 c6             	mov    %rax,%rsi
+  801dc3:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801dc8:	ff d2                	call   *%rdx
+				num = -(long long)num;
+  801dca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801dce:	48 f7 d8             	neg    %rax
+  801dd1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			}
+			base = 10;
+  801dd5:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  801ddc:	e9 d2 00 00 00       	jmp    801eb3 <vprintfmt+0x48a>
+
+		// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  801de1:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801de5:	be 03 00 00 00       	mov    $0x3,%esi
+  801dea:	48 89 c7             	mov    %rax,%rdi
+  801ded:	48 b8 1b 18 80 00 00 	movabs $0x80181b,%rax
+  801df4:	00 00 00 
+  801df7:	ff d0                	call   *%rax
+  801df9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 10;
+  801dfd:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  801e04:	e9 aa 00 00 00       	jmp    801eb3 <vprintfmt+0x48a>
+		// (unsigned) octal
+		case 'o':
+			// Gets the variable argument with type integer from the point which was processed last by va_arg
+			// calls getuint which returns a long long value, which then calls printnum which prints based on
+			// base value.
+			num = getuint(&aq, 3);
+  801e09:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801e0d:	be 03 00 00 00       	mov    $0x3,%esi
+  801e12:	48 89 c7             	mov    %rax,%rdi
+  801e15:	48 b8 1b 18 80 00 00 	movabs $0x80181b,%rax
+  801e1c:	00 00 00 
+  801e1f:	ff d0                	call   *%rax
+  801e21:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 8;
+  801e25:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+			goto number;
+  801e2c:	e9 82 00 00 00       	jmp    801eb3 <vprintfmt+0x48a>
+
+		// pointer
+		case 'p':
+			putch('0', putdat);
+  801e31:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801e35:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801e39:	48 89 c6             	mov    %rax,%rsi
+  801e3c:	bf 30 00 00 00       	mov    $0x30,%edi
+  801e41:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  801e43:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801e47:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801e4b:	48 89 c6             	mov    %rax,%rsi
+  801e4e:	bf 78 00 00 00       	mov    $0x78,%edi
+  801e53:	ff d2                	call   *%rdx
+			num = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  801e55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e58:	83 f8 2f             	cmp    $0x2f,%eax
+  801e5b:	77 17                	ja     801e74 <vprintfmt+0x44b>
+  801e5d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e61:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801e64:	89 d2                	mov    %edx,%edx
+  801e66:	48 01 d0             	add    %rdx,%rax
+  801e69:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801e6c:	83 c2 08             	add    $0x8,%edx
+  801e6f:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801e72:	eb 0c                	jmp    801e80 <vprintfmt+0x457>
+  801e74:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801e78:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801e7c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801e80:	48 8b 00             	mov    (%rax),%rax
+  801e83:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  801e87:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+			goto number;
+  801e8e:	eb 23                	jmp    801eb3 <vprintfmt+0x48a>
+
+		// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  801e90:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801e94:	be 03 00 00 00       	mov    $0x3,%esi
+  801e99:	48 89 c7             	mov    %rax,%rdi
+  801e9c:	48 b8 1b 18 80 00 00 	movabs $0x80181b,%rax
+  801ea3:	00 00 00 
+  801ea6:	ff d0                	call   *%rax
+  801ea8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  801eac:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  801eb3:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  801eb8:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  801ebb:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  801ebe:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801ec2:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801ec6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801eca:	45 89 c1             	mov    %r8d,%r9d
+  801ecd:	41 89 f8             	mov    %edi,%r8d
+  801ed0:	48 89 c7             	mov    %rax,%rdi
+  801ed3:	48 b8 63 17 80 00 00 	movabs $0x801763,%rax
+  801eda:	00 00 00 
+  801edd:	ff d0                	call   *%rax
+			break;
+  801edf:	eb 3f                	jmp    801f20 <vprintfmt+0x4f7>
+
+		// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  801ee1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801ee5:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801ee9:	48 89 c6             	mov    %rax,%rsi
+  801eec:	89 df                	mov    %ebx,%edi
+  801eee:	ff d2                	call   *%rdx
+			break;
+  801ef0:	eb 2e                	jmp    801f20 <vprintfmt+0x4f7>
+
+		// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  801ef2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801ef6:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801efa:	48 89 c6             	mov    %rax,%rsi
+  801efd:	bf 25 00 00 00       	mov    $0x25,%edi
+  801f02:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801f04:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  801f09:	eb 05                	jmp    801f10 <vprintfmt+0x4e7>
+  801f0b:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  801f10:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801f14:	48 83 e8 01          	sub    $0x1,%rax
+  801f18:	0f b6 00             	movzbl (%rax),%eax
+  801f1b:	3c 25                	cmp    $0x25,%al
+  801f1d:	75 ec                	jne    801f0b <vprintfmt+0x4e2>
+				/* do nothing */;
+			break;
+  801f1f:	90                   	nop
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  801f20:	e9 56 fb ff ff       	jmp    801a7b <vprintfmt+0x52>
+				return;
+  801f25:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  801f26:	48 83 c4 60          	add    $0x60,%rsp
+  801f2a:	5b                   	pop    %rbx
+  801f2b:	41 5c                	pop    %r12
+  801f2d:	5d                   	pop    %rbp
+  801f2e:	c3                   	ret
+
+0000000000801f2f <printfmt>:
+
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...)
+{
+  801f2f:	55                   	push   %rbp
+  801f30:	48 89 e5             	mov    %rsp,%rbp
+  801f33:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801f3a:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801f41:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  801f48:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801f4f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801f56:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801f5d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801f64:	84 c0                	test   %al,%al
+  801f66:	74 20                	je     801f88 <printfmt+0x59>
+  801f68:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801f6c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801f70:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801f74:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801f78:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801f7c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801f80:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801f84:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801f88:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801f8f:	00 00 00 
+  801f92:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801f99:	00 00 00 
+  801f9c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801fa0:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801fa7:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801fae:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  801fb5:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801fbc:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801fc3:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801fca:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801fd1:	48 89 c7             	mov    %rax,%rdi
+  801fd4:	48 b8 29 1a 80 00 00 	movabs $0x801a29,%rax
+  801fdb:	00 00 00 
+  801fde:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801fe0:	90                   	nop
+  801fe1:	c9                   	leave
+  801fe2:	c3                   	ret
+
+0000000000801fe3 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801fe3:	55                   	push   %rbp
+  801fe4:	48 89 e5             	mov    %rsp,%rbp
+  801fe7:	48 83 ec 10          	sub    $0x10,%rsp
+  801feb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801fee:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  801ff2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ff6:	8b 40 10             	mov    0x10(%rax),%eax
+  801ff9:	8d 50 01             	lea    0x1(%rax),%edx
+  801ffc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802000:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  802003:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802007:	48 8b 10             	mov    (%rax),%rdx
+  80200a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80200e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802012:	48 39 c2             	cmp    %rax,%rdx
+  802015:	73 17                	jae    80202e <sprintputch+0x4b>
+		*b->buf++ = ch;
+  802017:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80201b:	48 8b 00             	mov    (%rax),%rax
+  80201e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  802022:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802026:	48 89 0a             	mov    %rcx,(%rdx)
+  802029:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80202c:	88 10                	mov    %dl,(%rax)
+}
+  80202e:	90                   	nop
+  80202f:	c9                   	leave
+  802030:	c3                   	ret
+
+0000000000802031 <vsnprintf>:
+
+int vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  802031:	55                   	push   %rbp
+  802032:	48 89 e5             	mov    %rsp,%rbp
+  802035:	48 83 ec 50          	sub    $0x50,%rsp
+  802039:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80203d:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  802040:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  802044:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+	va_list aq;
+	va_copy(aq, ap);
+  802048:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  80204c:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802050:	48 8b 06             	mov    (%rsi),%rax
+  802053:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  802057:	48 89 01             	mov    %rax,(%rcx)
+  80205a:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80205e:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  802062:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	struct sprintbuf b = {buf, buf + n - 1, 0};
+  802066:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80206a:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80206e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802071:	48 98                	cltq
+  802073:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802077:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80207b:	48 01 d0             	add    %rdx,%rax
+  80207e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802082:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+
+	if (buf == NULL || n < 1)
+  802089:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80208e:	74 06                	je     802096 <vsnprintf+0x65>
+  802090:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  802094:	7f 07                	jg     80209d <vsnprintf+0x6c>
+		return -E_INVAL;
+  802096:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80209b:	eb 32                	jmp    8020cf <vsnprintf+0x9e>
+
+	// print the string to the buffer
+	vprintfmt((void *)sprintputch, &b, fmt, aq);
+  80209d:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  8020a1:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8020a5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8020a9:	48 89 c6             	mov    %rax,%rsi
+  8020ac:	48 b8 e3 1f 80 00 00 	movabs $0x801fe3,%rax
+  8020b3:	00 00 00 
+  8020b6:	48 89 c7             	mov    %rax,%rdi
+  8020b9:	48 b8 29 1a 80 00 00 	movabs $0x801a29,%rax
+  8020c0:	00 00 00 
+  8020c3:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  8020c5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020c9:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  8020cc:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  8020cf:	c9                   	leave
+  8020d0:	c3                   	ret
+
+00000000008020d1 <snprintf>:
+
+int snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8020d1:	55                   	push   %rbp
+  8020d2:	48 89 e5             	mov    %rsp,%rbp
+  8020d5:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8020dc:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8020e3:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8020e9:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8020f0:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8020f7:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8020fe:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  802105:	84 c0                	test   %al,%al
+  802107:	74 20                	je     802129 <snprintf+0x58>
+  802109:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80210d:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  802111:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  802115:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  802119:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80211d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  802121:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  802125:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  802129:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  802130:	00 00 00 
+  802133:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80213a:	00 00 00 
+  80213d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802141:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  802148:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80214f:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq, ap);
+  802156:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80215d:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  802164:	48 8b 06             	mov    (%rsi),%rax
+  802167:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80216b:	48 89 01             	mov    %rax,(%rcx)
+  80216e:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  802172:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  802176:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  80217a:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  802181:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  802188:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  80218e:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  802195:	48 89 c7             	mov    %rax,%rdi
+  802198:	48 b8 31 20 80 00 00 	movabs $0x802031,%rax
+  80219f:	00 00 00 
+  8021a2:	ff d0                	call   *%rax
+  8021a4:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  8021aa:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8021b0:	c9                   	leave
+  8021b1:	c3                   	ret
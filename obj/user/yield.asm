@@ -0,0 +1,3627 @@
+
+obj/user/yield.debug:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// entrypoint - 当最初被加载到一个新的环境中时，内核(或者父环境)在这里开始运行.
+.text
+.globl _start
+_start:
+	// 判断是否从栈上的参数开始初始化
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	// $USTACKTOP != %rsp 说明有参数，跳转到 args_exist
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// 如果不是(新环境被内核加载的时候)，则 push 伪造的 argc, argv 参数
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 cf 00 00 00       	call   800110 <libmain>
+
+// 不应该返回
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+// 让处理器调度其他进程
+
+#include "inc/lib.h"
+
+void umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	48 83 ec 20          	sub    $0x20,%rsp
+  80004b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80004e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int i;
+
+	cprintf("Hello, I am process %08x.\n", thisproc->proc_id);
+  800052:	48 b8 08 30 80 00 00 	movabs $0x803008,%rax
+  800059:	00 00 00 
+  80005c:	48 8b 00             	mov    (%rax),%rax
+  80005f:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  800065:	89 c6                	mov    %eax,%esi
+  800067:	48 b8 80 22 80 00 00 	movabs $0x802280,%rax
+  80006e:	00 00 00 
+  800071:	48 89 c7             	mov    %rax,%rdi
+  800074:	b8 00 00 00 00       	mov    $0x0,%eax
+  800079:	48 ba ce 02 80 00 00 	movabs $0x8002ce,%rdx
+  800080:	00 00 00 
+  800083:	ff d2                	call   *%rdx
+	for (i = 0; i < 5; i++)
+  800085:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80008c:	eb 46                	jmp    8000d4 <umain+0x91>
+	{
+		sys_yield();
+  80008e:	48 b8 7d 1b 80 00 00 	movabs $0x801b7d,%rax
+  800095:	00 00 00 
+  800098:	ff d0                	call   *%rax
+		cprintf("Back in process %08x, iteration %d.\n",
+				thisproc->proc_id, i);
+  80009a:	48 b8 08 30 80 00 00 	movabs $0x803008,%rax
+  8000a1:	00 00 00 
+  8000a4:	48 8b 00             	mov    (%rax),%rax
+  8000a7:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+		cprintf("Back in process %08x, iteration %d.\n",
+  8000ad:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8000b0:	89 c6                	mov    %eax,%esi
+  8000b2:	48 b8 a0 22 80 00 00 	movabs $0x8022a0,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 89 c7             	mov    %rax,%rdi
+  8000bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c4:	48 b9 ce 02 80 00 00 	movabs $0x8002ce,%rcx
+  8000cb:	00 00 00 
+  8000ce:	ff d1                	call   *%rcx
+	for (i = 0; i < 5; i++)
+  8000d0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8000d4:	83 7d fc 04          	cmpl   $0x4,-0x4(%rbp)
+  8000d8:	7e b4                	jle    80008e <umain+0x4b>
+	}
+	cprintf("All done in process %08x.\n", thisproc->proc_id);
+  8000da:	48 b8 08 30 80 00 00 	movabs $0x803008,%rax
+  8000e1:	00 00 00 
+  8000e4:	48 8b 00             	mov    (%rax),%rax
+  8000e7:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8000ed:	89 c6                	mov    %eax,%esi
+  8000ef:	48 b8 c5 22 80 00 00 	movabs $0x8022c5,%rax
+  8000f6:	00 00 00 
+  8000f9:	48 89 c7             	mov    %rax,%rdi
+  8000fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800101:	48 ba ce 02 80 00 00 	movabs $0x8002ce,%rdx
+  800108:	00 00 00 
+  80010b:	ff d2                	call   *%rdx
+}
+  80010d:	90                   	nop
+  80010e:	c9                   	leave
+  80010f:	c3                   	ret
+
+0000000000800110 <libmain>:
+
+/**
+ *  用户环境从lib/libmain.c中的函数libmain开始执行，这个函数进而调用umain，用户写的程序入口只能是umain
+ */
+void libmain(int argc, char **argv)
+{
+  800110:	55                   	push   %rbp
+  800111:	48 89 e5             	mov    %rsp,%rbp
+  800114:	48 83 ec 10          	sub    $0x10,%rsp
+  800118:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80011b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 设置常量 thisproc 指向 procs[] 中当前环境的 Env 结构，ENVX 确保环境 id 未超过了 NENV
+	// thisproc 指向当前环境的 Env 结构
+	thisproc = &procs[ENVX(sys_getprocid())];
+  80011f:	48 b8 41 1b 80 00 00 	movabs $0x801b41,%rax
+  800126:	00 00 00 
+  800129:	ff d0                	call   *%rax
+  80012b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800130:	48 98                	cltq
+  800132:	48 69 c0 50 03 00 00 	imul   $0x350,%rax,%rax
+  800139:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  800140:	00 00 00 
+  800143:	48 01 c2             	add    %rax,%rdx
+  800146:	48 b8 08 30 80 00 00 	movabs $0x803008,%rax
+  80014d:	00 00 00 
+  800150:	48 89 10             	mov    %rdx,(%rax)
+
+	// 通过 CPUID 选择 memset/memmove/memcpy 的实现
+	mem_init();
+  800153:	48 b8 e9 11 80 00 00 	movabs $0x8011e9,%rax
+  80015a:	00 00 00 
+  80015d:	ff d0                	call   *%rax
+
+	// 为了能让panic()提示用户错误，存储程序的名称
+	if (argc > 0)
+  80015f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800163:	7e 14                	jle    800179 <libmain+0x69>
+		binaryname = argv[0];
+  800165:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800169:	48 8b 00             	mov    (%rax),%rax
+  80016c:	48 ba 00 30 80 00 00 	movabs $0x803000,%rdx
+  800173:	00 00 00 
+  800176:	48 89 02             	mov    %rax,(%rdx)
+
+	// 调用用户的主程序
+	umain(argc, argv);
+  800179:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80017d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800180:	48 89 d6             	mov    %rdx,%rsi
+  800183:	89 c7                	mov    %eax,%edi
+  800185:	48 b8 43 00 80 00 00 	movabs $0x800043,%rax
+  80018c:	00 00 00 
+  80018f:	ff d0                	call   *%rax
+
+	// 退出当前环境，env_destroy
+	sys_env_destroy(0);
+  800191:	bf 00 00 00 00       	mov    $0x0,%edi
+  800196:	48 b8 fb 1a 80 00 00 	movabs $0x801afb,%rax
+  80019d:	00 00 00 
+  8001a0:	ff d0                	call   *%rax
+}
+  8001a2:	90                   	nop
+  8001a3:	c9                   	leave
+  8001a4:	c3                   	ret
+
+00000000008001a5 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001a5:	55                   	push   %rbp
+  8001a6:	48 89 e5             	mov    %rsp,%rbp
+  8001a9:	48 83 ec 10          	sub    $0x10,%rsp
+  8001ad:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8001b0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->buf[b->idx++] = ch;
+  8001b4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001b8:	8b 00                	mov    (%rax),%eax
+  8001ba:	8d 48 01             	lea    0x1(%rax),%ecx
+  8001bd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001c1:	89 0a                	mov    %ecx,(%rdx)
+  8001c3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8001c6:	89 d1                	mov    %edx,%ecx
+  8001c8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001cc:	48 98                	cltq
+  8001ce:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+	if (b->idx == 256-1) {
+  8001d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001d6:	8b 00                	mov    (%rax),%eax
+  8001d8:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001dd:	75 2c                	jne    80020b <putch+0x66>
+		sys_cputs(b->buf, b->idx);
+  8001df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001e3:	8b 00                	mov    (%rax),%eax
+  8001e5:	48 98                	cltq
+  8001e7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001eb:	48 83 c2 08          	add    $0x8,%rdx
+  8001ef:	48 89 c6             	mov    %rax,%rsi
+  8001f2:	48 89 d7             	mov    %rdx,%rdi
+  8001f5:	48 b8 72 1a 80 00 00 	movabs $0x801a72,%rax
+  8001fc:	00 00 00 
+  8001ff:	ff d0                	call   *%rax
+		b->idx = 0;
+  800201:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800205:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	}
+	b->cnt++;
+  80020b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80020f:	8b 40 04             	mov    0x4(%rax),%eax
+  800212:	8d 50 01             	lea    0x1(%rax),%edx
+  800215:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800219:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80021c:	90                   	nop
+  80021d:	c9                   	leave
+  80021e:	c3                   	ret
+
+000000000080021f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80021f:	55                   	push   %rbp
+  800220:	48 89 e5             	mov    %rsp,%rbp
+  800223:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80022a:	48 89 bd c8 fe ff ff 	mov    %rdi,-0x138(%rbp)
+  800231:	48 89 b5 c0 fe ff ff 	mov    %rsi,-0x140(%rbp)
+	struct printbuf b;
+	va_list aq;
+	va_copy(aq,ap);
+  800238:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  80023f:	48 8b b5 c0 fe ff ff 	mov    -0x140(%rbp),%rsi
+  800246:	48 8b 06             	mov    (%rsi),%rax
+  800249:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80024d:	48 89 01             	mov    %rax,(%rcx)
+  800250:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800254:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800258:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	b.idx = 0;
+  80025c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800263:	00 00 00 
+	b.cnt = 0;
+  800266:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80026d:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, aq);
+  800270:	48 8d 8d d8 fe ff ff 	lea    -0x128(%rbp),%rcx
+  800277:	48 8b 95 c8 fe ff ff 	mov    -0x138(%rbp),%rdx
+  80027e:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800285:	48 89 c6             	mov    %rax,%rsi
+  800288:	48 b8 a5 01 80 00 00 	movabs $0x8001a5,%rax
+  80028f:	00 00 00 
+  800292:	48 89 c7             	mov    %rax,%rdi
+  800295:	48 b8 6c 06 80 00 00 	movabs $0x80066c,%rax
+  80029c:	00 00 00 
+  80029f:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  8002a1:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8002a7:	48 98                	cltq
+  8002a9:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8002b0:	48 83 c2 08          	add    $0x8,%rdx
+  8002b4:	48 89 c6             	mov    %rax,%rsi
+  8002b7:	48 89 d7             	mov    %rdx,%rdi
+  8002ba:	48 b8 72 1a 80 00 00 	movabs $0x801a72,%rax
+  8002c1:	00 00 00 
+  8002c4:	ff d0                	call   *%rax
+	va_end(aq);
+
+	return b.cnt;
+  8002c6:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8002cc:	c9                   	leave
+  8002cd:	c3                   	ret
+
+00000000008002ce <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002ce:	55                   	push   %rbp
+  8002cf:	48 89 e5             	mov    %rsp,%rbp
+  8002d2:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  8002d9:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8002e0:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8002e7:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8002ee:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8002f5:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8002fc:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800303:	84 c0                	test   %al,%al
+  800305:	74 20                	je     800327 <cprintf+0x59>
+  800307:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80030b:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80030f:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800313:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800317:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80031b:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80031f:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800323:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+	va_list aq;
+	va_start(ap, fmt);
+  800327:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80032e:	00 00 00 
+  800331:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800338:	00 00 00 
+  80033b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80033f:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800346:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80034d:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  800354:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80035b:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800362:	48 8b 06             	mov    (%rsi),%rax
+  800365:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800369:	48 89 01             	mov    %rax,(%rcx)
+  80036c:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800370:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800374:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	cnt = vcprintf(fmt, aq);
+  800378:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80037f:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800386:	48 89 d6             	mov    %rdx,%rsi
+  800389:	48 89 c7             	mov    %rax,%rdi
+  80038c:	48 b8 1f 02 80 00 00 	movabs $0x80021f,%rax
+  800393:	00 00 00 
+  800396:	ff d0                	call   *%rax
+  800398:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return cnt;
+  80039e:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8003a4:	c9                   	leave
+  8003a5:	c3                   	ret
+
+00000000008003a6 <printnum>:
+ * num: 需要打印出来的整型数，base: 整型数的进制，其他参数同 vprintfmt
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+		 unsigned long long num, unsigned base, int width, int padc)
+{
+  8003a6:	55                   	push   %rbp
+  8003a7:	48 89 e5             	mov    %rsp,%rbp
+  8003aa:	48 83 ec 30          	sub    $0x30,%rsp
+  8003ae:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8003b2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8003b6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8003ba:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8003bd:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8003c1:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+	// 当 num 超过一位数，首先递归函数自身打印所有高位的(更重要的)数字
+	if (num >= base)
+  8003c5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8003c8:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8003cc:	72 54                	jb     800422 <printnum+0x7c>
+	{
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003ce:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8003d1:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8003d4:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8003d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8003db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003e0:	48 f7 f6             	div    %rsi
+  8003e3:	49 89 c2             	mov    %rax,%r10
+  8003e6:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8003e9:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8003ec:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8003f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003f4:	41 89 c9             	mov    %ecx,%r9d
+  8003f7:	41 89 f8             	mov    %edi,%r8d
+  8003fa:	89 d1                	mov    %edx,%ecx
+  8003fc:	4c 89 d2             	mov    %r10,%rdx
+  8003ff:	48 89 c7             	mov    %rax,%rdi
+  800402:	48 b8 a6 03 80 00 00 	movabs $0x8003a6,%rax
+  800409:	00 00 00 
+  80040c:	ff d0                	call   *%rax
+  80040e:	eb 1c                	jmp    80042c <printnum+0x86>
+	}
+	else
+	{
+		// 按照右对齐的格式在左侧补齐填充字符 padc
+		while (--width > 0)
+			putch(padc, putdat);
+  800410:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800414:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800417:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80041b:	48 89 d6             	mov    %rdx,%rsi
+  80041e:	89 c7                	mov    %eax,%edi
+  800420:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800422:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800426:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80042a:	7f e4                	jg     800410 <printnum+0x6a>
+	}
+
+	// 然后打印个位数字
+	putch("0123456789abcdef"[num % base], putdat);
+  80042c:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80042f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800433:	ba 00 00 00 00       	mov    $0x0,%edx
+  800438:	48 f7 f1             	div    %rcx
+  80043b:	48 b8 f0 24 80 00 00 	movabs $0x8024f0,%rax
+  800442:	00 00 00 
+  800445:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800449:	0f be c0             	movsbl %al,%eax
+  80044c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800450:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800454:	48 89 d6             	mov    %rdx,%rsi
+  800457:	89 c7                	mov    %eax,%edi
+  800459:	ff d1                	call   *%rcx
+}
+  80045b:	90                   	nop
+  80045c:	c9                   	leave
+  80045d:	c3                   	ret
+
+000000000080045e <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  80045e:	55                   	push   %rbp
+  80045f:	48 89 e5             	mov    %rsp,%rbp
+  800462:	48 83 ec 20          	sub    $0x20,%rsp
+  800466:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80046a:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;
+	if (lflag >= 2)
+  80046d:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800471:	7e 4f                	jle    8004c2 <getuint+0x64>
+		x = va_arg(*ap, unsigned long long);
+  800473:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800477:	8b 00                	mov    (%rax),%eax
+  800479:	83 f8 2f             	cmp    $0x2f,%eax
+  80047c:	77 24                	ja     8004a2 <getuint+0x44>
+  80047e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800482:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800486:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80048a:	8b 00                	mov    (%rax),%eax
+  80048c:	89 c0                	mov    %eax,%eax
+  80048e:	48 01 d0             	add    %rdx,%rax
+  800491:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800495:	8b 12                	mov    (%rdx),%edx
+  800497:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80049a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80049e:	89 0a                	mov    %ecx,(%rdx)
+  8004a0:	eb 14                	jmp    8004b6 <getuint+0x58>
+  8004a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004a6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8004aa:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8004ae:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8004b2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8004b6:	48 8b 00             	mov    (%rax),%rax
+  8004b9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8004bd:	e9 9d 00 00 00       	jmp    80055f <getuint+0x101>
+	else if (lflag)
+  8004c2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8004c6:	74 4c                	je     800514 <getuint+0xb6>
+		x = va_arg(*ap, unsigned long);
+  8004c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004cc:	8b 00                	mov    (%rax),%eax
+  8004ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8004d1:	77 24                	ja     8004f7 <getuint+0x99>
+  8004d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004d7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004df:	8b 00                	mov    (%rax),%eax
+  8004e1:	89 c0                	mov    %eax,%eax
+  8004e3:	48 01 d0             	add    %rdx,%rax
+  8004e6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8004ea:	8b 12                	mov    (%rdx),%edx
+  8004ec:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8004ef:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8004f3:	89 0a                	mov    %ecx,(%rdx)
+  8004f5:	eb 14                	jmp    80050b <getuint+0xad>
+  8004f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004fb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8004ff:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800503:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800507:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80050b:	48 8b 00             	mov    (%rax),%rax
+  80050e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800512:	eb 4b                	jmp    80055f <getuint+0x101>
+	else
+		x = va_arg(*ap, unsigned int);
+  800514:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800518:	8b 00                	mov    (%rax),%eax
+  80051a:	83 f8 2f             	cmp    $0x2f,%eax
+  80051d:	77 24                	ja     800543 <getuint+0xe5>
+  80051f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800523:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800527:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80052b:	8b 00                	mov    (%rax),%eax
+  80052d:	89 c0                	mov    %eax,%eax
+  80052f:	48 01 d0             	add    %rdx,%rax
+  800532:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800536:	8b 12                	mov    (%rdx),%edx
+  800538:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80053b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80053f:	89 0a                	mov    %ecx,(%rdx)
+  800541:	eb 14                	jmp    800557 <getuint+0xf9>
+  800543:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800547:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80054b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80054f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800553:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800557:	8b 00                	mov    (%rax),%eax
+  800559:	89 c0                	mov    %eax,%eax
+  80055b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80055f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800563:	c9                   	leave
+  800564:	c3                   	ret
+
+0000000000800565 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800565:	55                   	push   %rbp
+  800566:	48 89 e5             	mov    %rsp,%rbp
+  800569:	48 83 ec 20          	sub    $0x20,%rsp
+  80056d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800571:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800574:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800578:	7e 4f                	jle    8005c9 <getint+0x64>
+		x = va_arg(*ap, long long);
+  80057a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80057e:	8b 00                	mov    (%rax),%eax
+  800580:	83 f8 2f             	cmp    $0x2f,%eax
+  800583:	77 24                	ja     8005a9 <getint+0x44>
+  800585:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800589:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80058d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800591:	8b 00                	mov    (%rax),%eax
+  800593:	89 c0                	mov    %eax,%eax
+  800595:	48 01 d0             	add    %rdx,%rax
+  800598:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80059c:	8b 12                	mov    (%rdx),%edx
+  80059e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005a1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005a5:	89 0a                	mov    %ecx,(%rdx)
+  8005a7:	eb 14                	jmp    8005bd <getint+0x58>
+  8005a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005ad:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005b1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005b5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005b9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005bd:	48 8b 00             	mov    (%rax),%rax
+  8005c0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8005c4:	e9 9d 00 00 00       	jmp    800666 <getint+0x101>
+	else if (lflag)
+  8005c9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8005cd:	74 4c                	je     80061b <getint+0xb6>
+		x = va_arg(*ap, long);
+  8005cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005d3:	8b 00                	mov    (%rax),%eax
+  8005d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8005d8:	77 24                	ja     8005fe <getint+0x99>
+  8005da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005de:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005e6:	8b 00                	mov    (%rax),%eax
+  8005e8:	89 c0                	mov    %eax,%eax
+  8005ea:	48 01 d0             	add    %rdx,%rax
+  8005ed:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005f1:	8b 12                	mov    (%rdx),%edx
+  8005f3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005f6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005fa:	89 0a                	mov    %ecx,(%rdx)
+  8005fc:	eb 14                	jmp    800612 <getint+0xad>
+  8005fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800602:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800606:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80060a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80060e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800612:	48 8b 00             	mov    (%rax),%rax
+  800615:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800619:	eb 4b                	jmp    800666 <getint+0x101>
+	else
+		x = va_arg(*ap, int);
+  80061b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80061f:	8b 00                	mov    (%rax),%eax
+  800621:	83 f8 2f             	cmp    $0x2f,%eax
+  800624:	77 24                	ja     80064a <getint+0xe5>
+  800626:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80062a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80062e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800632:	8b 00                	mov    (%rax),%eax
+  800634:	89 c0                	mov    %eax,%eax
+  800636:	48 01 d0             	add    %rdx,%rax
+  800639:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80063d:	8b 12                	mov    (%rdx),%edx
+  80063f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800642:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800646:	89 0a                	mov    %ecx,(%rdx)
+  800648:	eb 14                	jmp    80065e <getint+0xf9>
+  80064a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80064e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800652:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800656:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80065a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80065e:	8b 00                	mov    (%rax),%eax
+  800660:	48 98                	cltq
+  800662:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800666:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80066a:	c9                   	leave
+  80066b:	c3                   	ret
+
+000000000080066c <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap)
+{
+  80066c:	55                   	push   %rbp
+  80066d:	48 89 e5             	mov    %rsp,%rbp
+  800670:	41 54                	push   %r12
+  800672:	53                   	push   %rbx
+  800673:	48 83 ec 60          	sub    $0x60,%rsp
+  800677:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80067b:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80067f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800683:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+	int base, lflag, width, precision, altflag;
+
+	// 填充字符，在显示字符串的'%'后读到'-'或'0'时，赋值到 padc
+	char padc;
+	va_list aq;
+	va_copy(aq, ap);
+  800687:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80068b:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80068f:	48 8b 06             	mov    (%rsi),%rax
+  800692:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800696:	48 89 01             	mov    %rax,(%rcx)
+  800699:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80069d:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8006a1:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1)
+	{
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  8006a5:	eb 17                	jmp    8006be <vprintfmt+0x52>
+		{
+			if (ch == '\0')
+  8006a7:	85 db                	test   %ebx,%ebx
+  8006a9:	0f 84 b9 04 00 00    	je     800b68 <vprintfmt+0x4fc>
+				return;
+			putch(ch, putdat);
+  8006af:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006b3:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8006b7:	48 89 c6             	mov    %rax,%rsi
+  8006ba:	89 df                	mov    %ebx,%edi
+  8006bc:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  8006be:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8006c2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006c6:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8006ca:	0f b6 00             	movzbl (%rax),%eax
+  8006cd:	0f b6 d8             	movzbl %al,%ebx
+  8006d0:	83 fb 25             	cmp    $0x25,%ebx
+  8006d3:	75 d2                	jne    8006a7 <vprintfmt+0x3b>
+		}
+
+		// 处理 % 转义序列
+		// padc 初始化为空格符，padc='-'代表字符串左对齐，右边补空格，padc=' '代表右对齐，左边补空格，padc='0'右对齐，左边补0
+		padc = ' ';
+  8006d5:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+		width = -1;
+  8006d9:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+		// 默认-1代表显示长度为字符串本来的长度
+		precision = -1;
+  8006e0:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+		lflag = 0;
+  8006e7:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+		altflag = 0;
+  8006ee:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *)fmt++)
+  8006f5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8006f9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006fd:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800701:	0f b6 00             	movzbl (%rax),%eax
+  800704:	0f b6 d8             	movzbl %al,%ebx
+  800707:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  80070a:	83 f8 55             	cmp    $0x55,%eax
+  80070d:	0f 87 22 04 00 00    	ja     800b35 <vprintfmt+0x4c9>
+  800713:	89 c0                	mov    %eax,%eax
+  800715:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80071c:	00 
+  80071d:	48 b8 18 25 80 00 00 	movabs $0x802518,%rax
+  800724:	00 00 00 
+  800727:	48 01 d0             	add    %rdx,%rax
+  80072a:	48 8b 00             	mov    (%rax),%rax
+  80072d:	ff e0                	jmp    *%rax
+		{
+
+		// flag to pad on the right
+		case '-':
+			padc = '-';
+  80072f:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+			goto reswitch;
+  800733:	eb c0                	jmp    8006f5 <vprintfmt+0x89>
+
+		// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800735:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+			goto reswitch;
+  800739:	eb ba                	jmp    8006f5 <vprintfmt+0x89>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0;; ++fmt)
+  80073b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+			{
+				precision = precision * 10 + ch - '0';
+  800742:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800745:	89 d0                	mov    %edx,%eax
+  800747:	c1 e0 02             	shl    $0x2,%eax
+  80074a:	01 d0                	add    %edx,%eax
+  80074c:	01 c0                	add    %eax,%eax
+  80074e:	01 d8                	add    %ebx,%eax
+  800750:	83 e8 30             	sub    $0x30,%eax
+  800753:	89 45 d8             	mov    %eax,-0x28(%rbp)
+				ch = *fmt;
+  800756:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80075a:	0f b6 00             	movzbl (%rax),%eax
+  80075d:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800760:	83 fb 2f             	cmp    $0x2f,%ebx
+  800763:	7e 60                	jle    8007c5 <vprintfmt+0x159>
+  800765:	83 fb 39             	cmp    $0x39,%ebx
+  800768:	7f 5b                	jg     8007c5 <vprintfmt+0x159>
+			for (precision = 0;; ++fmt)
+  80076a:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+				precision = precision * 10 + ch - '0';
+  80076f:	eb d1                	jmp    800742 <vprintfmt+0xd6>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800771:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800774:	83 f8 2f             	cmp    $0x2f,%eax
+  800777:	77 17                	ja     800790 <vprintfmt+0x124>
+  800779:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80077d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800780:	89 d2                	mov    %edx,%edx
+  800782:	48 01 d0             	add    %rdx,%rax
+  800785:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800788:	83 c2 08             	add    $0x8,%edx
+  80078b:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80078e:	eb 0c                	jmp    80079c <vprintfmt+0x130>
+  800790:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800794:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800798:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80079c:	8b 00                	mov    (%rax),%eax
+  80079e:	89 45 d8             	mov    %eax,-0x28(%rbp)
+			goto process_precision;
+  8007a1:	eb 23                	jmp    8007c6 <vprintfmt+0x15a>
+
+		case '.':
+			if (width < 0)
+  8007a3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8007a7:	0f 89 48 ff ff ff    	jns    8006f5 <vprintfmt+0x89>
+				width = 0;
+  8007ad:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+			goto reswitch;
+  8007b4:	e9 3c ff ff ff       	jmp    8006f5 <vprintfmt+0x89>
+
+		case '#':
+			altflag = 1;
+  8007b9:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+			goto reswitch;
+  8007c0:	e9 30 ff ff ff       	jmp    8006f5 <vprintfmt+0x89>
+			goto process_precision;
+  8007c5:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  8007c6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8007ca:	0f 89 25 ff ff ff    	jns    8006f5 <vprintfmt+0x89>
+				width = precision, precision = -1;
+  8007d0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8007d3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8007d6:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+			goto reswitch;
+  8007dd:	e9 13 ff ff ff       	jmp    8006f5 <vprintfmt+0x89>
+
+		// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  8007e2:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+			goto reswitch;
+  8007e6:	e9 0a ff ff ff       	jmp    8006f5 <vprintfmt+0x89>
+
+		// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  8007eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ee:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f1:	77 17                	ja     80080a <vprintfmt+0x19e>
+  8007f3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007f7:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007fa:	89 d2                	mov    %edx,%edx
+  8007fc:	48 01 d0             	add    %rdx,%rax
+  8007ff:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800802:	83 c2 08             	add    $0x8,%edx
+  800805:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800808:	eb 0c                	jmp    800816 <vprintfmt+0x1aa>
+  80080a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80080e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800812:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800816:	8b 00                	mov    (%rax),%eax
+  800818:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80081c:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800820:	48 89 d6             	mov    %rdx,%rsi
+  800823:	89 c7                	mov    %eax,%edi
+  800825:	ff d1                	call   *%rcx
+			break;
+  800827:	e9 37 03 00 00       	jmp    800b63 <vprintfmt+0x4f7>
+
+		// error message
+		case 'e':
+			err = va_arg(aq, int);
+  80082c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082f:	83 f8 2f             	cmp    $0x2f,%eax
+  800832:	77 17                	ja     80084b <vprintfmt+0x1df>
+  800834:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800838:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80083b:	89 d2                	mov    %edx,%edx
+  80083d:	48 01 d0             	add    %rdx,%rax
+  800840:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800843:	83 c2 08             	add    $0x8,%edx
+  800846:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800849:	eb 0c                	jmp    800857 <vprintfmt+0x1eb>
+  80084b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80084f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800853:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800857:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800859:	85 db                	test   %ebx,%ebx
+  80085b:	79 02                	jns    80085f <vprintfmt+0x1f3>
+				err = -err;
+  80085d:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80085f:	83 fb 11             	cmp    $0x11,%ebx
+  800862:	7f 16                	jg     80087a <vprintfmt+0x20e>
+  800864:	48 ba 60 24 80 00 00 	movabs $0x802460,%rdx
+  80086b:	00 00 00 
+  80086e:	48 63 c3             	movslq %ebx,%rax
+  800871:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800875:	4d 85 e4             	test   %r12,%r12
+  800878:	75 2e                	jne    8008a8 <vprintfmt+0x23c>
+				printfmt(putch, putdat, "error %d", err);
+  80087a:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80087e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800882:	89 d9                	mov    %ebx,%ecx
+  800884:	48 ba 01 25 80 00 00 	movabs $0x802501,%rdx
+  80088b:	00 00 00 
+  80088e:	48 89 c7             	mov    %rax,%rdi
+  800891:	b8 00 00 00 00       	mov    $0x0,%eax
+  800896:	49 b8 72 0b 80 00 00 	movabs $0x800b72,%r8
+  80089d:	00 00 00 
+  8008a0:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  8008a3:	e9 bb 02 00 00       	jmp    800b63 <vprintfmt+0x4f7>
+				printfmt(putch, putdat, "%s", p);
+  8008a8:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8008ac:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8008b0:	4c 89 e1             	mov    %r12,%rcx
+  8008b3:	48 ba 0a 25 80 00 00 	movabs $0x80250a,%rdx
+  8008ba:	00 00 00 
+  8008bd:	48 89 c7             	mov    %rax,%rdi
+  8008c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c5:	49 b8 72 0b 80 00 00 	movabs $0x800b72,%r8
+  8008cc:	00 00 00 
+  8008cf:	41 ff d0             	call   *%r8
+			break;
+  8008d2:	e9 8c 02 00 00       	jmp    800b63 <vprintfmt+0x4f7>
+
+		// string
+		case 's':
+			// 从可变参数中读入字符串指针
+			if ((p = va_arg(aq, char *)) == NULL)
+  8008d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008da:	83 f8 2f             	cmp    $0x2f,%eax
+  8008dd:	77 17                	ja     8008f6 <vprintfmt+0x28a>
+  8008df:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8008e3:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008e6:	89 d2                	mov    %edx,%edx
+  8008e8:	48 01 d0             	add    %rdx,%rax
+  8008eb:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008ee:	83 c2 08             	add    $0x8,%edx
+  8008f1:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8008f4:	eb 0c                	jmp    800902 <vprintfmt+0x296>
+  8008f6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8008fa:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8008fe:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800902:	4c 8b 20             	mov    (%rax),%r12
+  800905:	4d 85 e4             	test   %r12,%r12
+  800908:	75 0a                	jne    800914 <vprintfmt+0x2a8>
+				p = "(null)"; // 当字符串为空时，将它指向"(null)"字符串
+  80090a:	49 bc 0d 25 80 00 00 	movabs $0x80250d,%r12
+  800911:	00 00 00 
+			// 判断左对齐还是右对齐，pad='-'左对齐，否则右对齐
+			if (width > 0 && padc != '-')
+  800914:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800918:	7e 78                	jle    800992 <vprintfmt+0x326>
+  80091a:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  80091e:	74 72                	je     800992 <vprintfmt+0x326>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800920:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800923:	48 98                	cltq
+  800925:	48 89 c6             	mov    %rax,%rsi
+  800928:	4c 89 e7             	mov    %r12,%rdi
+  80092b:	48 b8 17 0f 80 00 00 	movabs $0x800f17,%rax
+  800932:	00 00 00 
+  800935:	ff d0                	call   *%rax
+  800937:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  80093a:	eb 17                	jmp    800953 <vprintfmt+0x2e7>
+					putch(padc, putdat); // 字符串右对齐，左边补相应数量(width-实际长度)的空格或者 0
+  80093c:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800940:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800944:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800948:	48 89 d6             	mov    %rdx,%rsi
+  80094b:	89 c7                	mov    %eax,%edi
+  80094d:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80094f:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800953:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800957:	7f e3                	jg     80093c <vprintfmt+0x2d0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800959:	eb 37                	jmp    800992 <vprintfmt+0x326>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80095b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  80095f:	74 1e                	je     80097f <vprintfmt+0x313>
+  800961:	83 fb 1f             	cmp    $0x1f,%ebx
+  800964:	7e 05                	jle    80096b <vprintfmt+0x2ff>
+  800966:	83 fb 7e             	cmp    $0x7e,%ebx
+  800969:	7e 14                	jle    80097f <vprintfmt+0x313>
+					putch('?', putdat);
+  80096b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80096f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800973:	48 89 c6             	mov    %rax,%rsi
+  800976:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80097b:	ff d2                	call   *%rdx
+  80097d:	eb 0f                	jmp    80098e <vprintfmt+0x322>
+				else
+					putch(ch, putdat); // 打印相应长度的字符串
+  80097f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800983:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800987:	48 89 c6             	mov    %rax,%rsi
+  80098a:	89 df                	mov    %ebx,%edi
+  80098c:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80098e:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800992:	4c 89 e0             	mov    %r12,%rax
+  800995:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800999:	0f b6 00             	movzbl (%rax),%eax
+  80099c:	0f be d8             	movsbl %al,%ebx
+  80099f:	85 db                	test   %ebx,%ebx
+  8009a1:	74 28                	je     8009cb <vprintfmt+0x35f>
+  8009a3:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8009a7:	78 b2                	js     80095b <vprintfmt+0x2ef>
+  8009a9:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8009ad:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8009b1:	79 a8                	jns    80095b <vprintfmt+0x2ef>
+			for (; width > 0; width--)
+  8009b3:	eb 16                	jmp    8009cb <vprintfmt+0x35f>
+				putch(' ', putdat); // 当字符串是左对齐的时候打印相应数量的空格
+  8009b5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009b9:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009bd:	48 89 c6             	mov    %rax,%rsi
+  8009c0:	bf 20 00 00 00       	mov    $0x20,%edi
+  8009c5:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  8009c7:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8009cb:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8009cf:	7f e4                	jg     8009b5 <vprintfmt+0x349>
+			break;
+  8009d1:	e9 8d 01 00 00       	jmp    800b63 <vprintfmt+0x4f7>
+
+		// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  8009d6:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8009da:	be 03 00 00 00       	mov    $0x3,%esi
+  8009df:	48 89 c7             	mov    %rax,%rdi
+  8009e2:	48 b8 65 05 80 00 00 	movabs $0x800565,%rax
+  8009e9:	00 00 00 
+  8009ec:	ff d0                	call   *%rax
+  8009ee:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((long long)num < 0)
+  8009f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009f6:	48 85 c0             	test   %rax,%rax
+  8009f9:	79 1d                	jns    800a18 <vprintfmt+0x3ac>
+			{
+				putch('-', putdat);
+  8009fb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009ff:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a03:	48 89 c6             	mov    %rax,%rsi
+  800a06:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a0b:	ff d2                	call   *%rdx
+				num = -(long long)num;
+  800a0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a11:	48 f7 d8             	neg    %rax
+  800a14:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			}
+			base = 10;
+  800a18:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800a1f:	e9 d2 00 00 00       	jmp    800af6 <vprintfmt+0x48a>
+
+		// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800a24:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a28:	be 03 00 00 00       	mov    $0x3,%esi
+  800a2d:	48 89 c7             	mov    %rax,%rdi
+  800a30:	48 b8 5e 04 80 00 00 	movabs $0x80045e,%rax
+  800a37:	00 00 00 
+  800a3a:	ff d0                	call   *%rax
+  800a3c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 10;
+  800a40:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+			goto number;
+  800a47:	e9 aa 00 00 00       	jmp    800af6 <vprintfmt+0x48a>
+		// (unsigned) octal
+		case 'o':
+			// Gets the variable argument with type integer from the point which was processed last by va_arg
+			// calls getuint which returns a long long value, which then calls printnum which prints based on
+			// base value.
+			num = getuint(&aq, 3);
+  800a4c:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a50:	be 03 00 00 00       	mov    $0x3,%esi
+  800a55:	48 89 c7             	mov    %rax,%rdi
+  800a58:	48 b8 5e 04 80 00 00 	movabs $0x80045e,%rax
+  800a5f:	00 00 00 
+  800a62:	ff d0                	call   *%rax
+  800a64:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 8;
+  800a68:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+			goto number;
+  800a6f:	e9 82 00 00 00       	jmp    800af6 <vprintfmt+0x48a>
+
+		// pointer
+		case 'p':
+			putch('0', putdat);
+  800a74:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a78:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a7c:	48 89 c6             	mov    %rax,%rsi
+  800a7f:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a84:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800a86:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a8a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a8e:	48 89 c6             	mov    %rax,%rsi
+  800a91:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a96:	ff d2                	call   *%rdx
+			num = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800a98:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a9b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a9e:	77 17                	ja     800ab7 <vprintfmt+0x44b>
+  800aa0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800aa4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800aa7:	89 d2                	mov    %edx,%edx
+  800aa9:	48 01 d0             	add    %rdx,%rax
+  800aac:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800aaf:	83 c2 08             	add    $0x8,%edx
+  800ab2:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800ab5:	eb 0c                	jmp    800ac3 <vprintfmt+0x457>
+  800ab7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800abb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800abf:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800ac3:	48 8b 00             	mov    (%rax),%rax
+  800ac6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800aca:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+			goto number;
+  800ad1:	eb 23                	jmp    800af6 <vprintfmt+0x48a>
+
+		// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800ad3:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800ad7:	be 03 00 00 00       	mov    $0x3,%esi
+  800adc:	48 89 c7             	mov    %rax,%rdi
+  800adf:	48 b8 5e 04 80 00 00 	movabs $0x80045e,%rax
+  800ae6:	00 00 00 
+  800ae9:	ff d0                	call   *%rax
+  800aeb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			base = 16;
+  800aef:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800af6:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800afb:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800afe:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800b01:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b05:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800b09:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b0d:	45 89 c1             	mov    %r8d,%r9d
+  800b10:	41 89 f8             	mov    %edi,%r8d
+  800b13:	48 89 c7             	mov    %rax,%rdi
+  800b16:	48 b8 a6 03 80 00 00 	movabs $0x8003a6,%rax
+  800b1d:	00 00 00 
+  800b20:	ff d0                	call   *%rax
+			break;
+  800b22:	eb 3f                	jmp    800b63 <vprintfmt+0x4f7>
+
+		// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800b24:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b28:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b2c:	48 89 c6             	mov    %rax,%rsi
+  800b2f:	89 df                	mov    %ebx,%edi
+  800b31:	ff d2                	call   *%rdx
+			break;
+  800b33:	eb 2e                	jmp    800b63 <vprintfmt+0x4f7>
+
+		// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800b35:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b39:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b3d:	48 89 c6             	mov    %rax,%rsi
+  800b40:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b45:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b47:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800b4c:	eb 05                	jmp    800b53 <vprintfmt+0x4e7>
+  800b4e:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800b53:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800b57:	48 83 e8 01          	sub    $0x1,%rax
+  800b5b:	0f b6 00             	movzbl (%rax),%eax
+  800b5e:	3c 25                	cmp    $0x25,%al
+  800b60:	75 ec                	jne    800b4e <vprintfmt+0x4e2>
+				/* do nothing */;
+			break;
+  800b62:	90                   	nop
+		while ((ch = *(unsigned char *)fmt++) != '%')
+  800b63:	e9 56 fb ff ff       	jmp    8006be <vprintfmt+0x52>
+				return;
+  800b68:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800b69:	48 83 c4 60          	add    $0x60,%rsp
+  800b6d:	5b                   	pop    %rbx
+  800b6e:	41 5c                	pop    %r12
+  800b70:	5d                   	pop    %rbp
+  800b71:	c3                   	ret
+
+0000000000800b72 <printfmt>:
+
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...)
+{
+  800b72:	55                   	push   %rbp
+  800b73:	48 89 e5             	mov    %rsp,%rbp
+  800b76:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800b7d:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800b84:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800b8b:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800b92:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800b99:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800ba0:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800ba7:	84 c0                	test   %al,%al
+  800ba9:	74 20                	je     800bcb <printfmt+0x59>
+  800bab:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800baf:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800bb3:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800bb7:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800bbb:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800bbf:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800bc3:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800bc7:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800bcb:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800bd2:	00 00 00 
+  800bd5:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800bdc:	00 00 00 
+  800bdf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800be3:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800bea:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800bf1:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800bf8:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800bff:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800c06:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800c0d:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800c14:	48 89 c7             	mov    %rax,%rdi
+  800c17:	48 b8 6c 06 80 00 00 	movabs $0x80066c,%rax
+  800c1e:	00 00 00 
+  800c21:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  800c23:	90                   	nop
+  800c24:	c9                   	leave
+  800c25:	c3                   	ret
+
+0000000000800c26 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800c26:	55                   	push   %rbp
+  800c27:	48 89 e5             	mov    %rsp,%rbp
+  800c2a:	48 83 ec 10          	sub    $0x10,%rsp
+  800c2e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800c31:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  800c35:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c39:	8b 40 10             	mov    0x10(%rax),%eax
+  800c3c:	8d 50 01             	lea    0x1(%rax),%edx
+  800c3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c43:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  800c46:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c4a:	48 8b 10             	mov    (%rax),%rdx
+  800c4d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c51:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c55:	48 39 c2             	cmp    %rax,%rdx
+  800c58:	73 17                	jae    800c71 <sprintputch+0x4b>
+		*b->buf++ = ch;
+  800c5a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c5e:	48 8b 00             	mov    (%rax),%rax
+  800c61:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800c65:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800c69:	48 89 0a             	mov    %rcx,(%rdx)
+  800c6c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800c6f:	88 10                	mov    %dl,(%rax)
+}
+  800c71:	90                   	nop
+  800c72:	c9                   	leave
+  800c73:	c3                   	ret
+
+0000000000800c74 <vsnprintf>:
+
+int vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800c74:	55                   	push   %rbp
+  800c75:	48 89 e5             	mov    %rsp,%rbp
+  800c78:	48 83 ec 50          	sub    $0x50,%rsp
+  800c7c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  800c80:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  800c83:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  800c87:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+	va_list aq;
+	va_copy(aq, ap);
+  800c8b:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800c8f:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  800c93:	48 8b 06             	mov    (%rsi),%rax
+  800c96:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800c9a:	48 89 01             	mov    %rax,(%rcx)
+  800c9d:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800ca1:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800ca5:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	struct sprintbuf b = {buf, buf + n - 1, 0};
+  800ca9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800cad:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800cb1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  800cb4:	48 98                	cltq
+  800cb6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800cba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800cbe:	48 01 d0             	add    %rdx,%rax
+  800cc1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  800cc5:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+
+	if (buf == NULL || n < 1)
+  800ccc:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800cd1:	74 06                	je     800cd9 <vsnprintf+0x65>
+  800cd3:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800cd7:	7f 07                	jg     800ce0 <vsnprintf+0x6c>
+		return -E_INVAL;
+  800cd9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cde:	eb 32                	jmp    800d12 <vsnprintf+0x9e>
+
+	// print the string to the buffer
+	vprintfmt((void *)sprintputch, &b, fmt, aq);
+  800ce0:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+  800ce4:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  800ce8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800cec:	48 89 c6             	mov    %rax,%rsi
+  800cef:	48 b8 26 0c 80 00 00 	movabs $0x800c26,%rax
+  800cf6:	00 00 00 
+  800cf9:	48 89 c7             	mov    %rax,%rdi
+  800cfc:	48 b8 6c 06 80 00 00 	movabs $0x80066c,%rax
+  800d03:	00 00 00 
+  800d06:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  800d08:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d0c:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800d0f:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  800d12:	c9                   	leave
+  800d13:	c3                   	ret
+
+0000000000800d14 <snprintf>:
+
+int snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800d14:	55                   	push   %rbp
+  800d15:	48 89 e5             	mov    %rsp,%rbp
+  800d18:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800d1f:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800d26:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800d2c:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800d33:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800d3a:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800d41:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800d48:	84 c0                	test   %al,%al
+  800d4a:	74 20                	je     800d6c <snprintf+0x58>
+  800d4c:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800d50:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800d54:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800d58:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800d5c:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800d60:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800d64:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800d68:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  800d6c:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800d73:	00 00 00 
+  800d76:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800d7d:	00 00 00 
+  800d80:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d84:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800d8b:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800d92:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq, ap);
+  800d99:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800da0:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800da7:	48 8b 06             	mov    (%rsi),%rax
+  800daa:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800dae:	48 89 01             	mov    %rax,(%rcx)
+  800db1:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800db5:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800db9:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  800dbd:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800dc4:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  800dcb:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  800dd1:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800dd8:	48 89 c7             	mov    %rax,%rdi
+  800ddb:	48 b8 74 0c 80 00 00 	movabs $0x800c74,%rax
+  800de2:	00 00 00 
+  800de5:	ff d0                	call   *%rax
+  800de7:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  800ded:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800df3:	c9                   	leave
+  800df4:	c3                   	ret
+
+0000000000800df5 <cpuid>:
+#define read_rip(var) __asm __volatile("leaq (%%rip), %0" : "=r" (var)::"cc","memory")
+
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800df5:	55                   	push   %rbp
+  800df6:	48 89 e5             	mov    %rsp,%rbp
+  800df9:	53                   	push   %rbx
+  800dfa:	48 83 ec 38          	sub    $0x38,%rsp
+  800dfe:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800e01:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800e05:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800e09:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800e0d:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid" 
+  800e11:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800e14:	0f a2                	cpuid
+  800e16:	89 de                	mov    %ebx,%esi
+  800e18:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800e1b:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800e1e:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800e21:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info));
+	if (eaxp)
+  800e24:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800e29:	74 09                	je     800e34 <cpuid+0x3f>
+		*eaxp = eax;
+  800e2b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800e2f:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800e32:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  800e34:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800e39:	74 09                	je     800e44 <cpuid+0x4f>
+		*ebxp = ebx;
+  800e3b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e3f:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800e42:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  800e44:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800e49:	74 09                	je     800e54 <cpuid+0x5f>
+		*ecxp = ecx;
+  800e4b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e4f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800e52:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  800e54:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800e59:	74 09                	je     800e64 <cpuid+0x6f>
+		*edxp = edx;
+  800e5b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800e5f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800e62:	89 10                	mov    %edx,(%rax)
+}
+  800e64:	90                   	nop
+  800e65:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800e69:	c9                   	leave
+  800e6a:	c3                   	ret
+
+0000000000800e6b <cpuid_count>:
+
+// 带子功能号(%ecx = count)的 cpuid，用于 leaf 4/7/0xB/0xD 等
+static __inline void
+cpuid_count(uint32_t info, uint32_t count, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+  800e6b:	55                   	push   %rbp
+  800e6c:	48 89 e5             	mov    %rsp,%rbp
+  800e6f:	53                   	push   %rbx
+  800e70:	48 83 ec 38          	sub    $0x38,%rsp
+  800e74:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800e77:	89 75 e0             	mov    %esi,-0x20(%rbp)
+  800e7a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800e7e:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  800e82:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+  800e86:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800e8a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800e8d:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800e90:	89 d1                	mov    %edx,%ecx
+  800e92:	0f a2                	cpuid
+  800e94:	89 de                	mov    %ebx,%esi
+  800e96:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800e99:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800e9c:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800e9f:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "a" (info), "c" (count));
+	if (eaxp)
+  800ea2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800ea7:	74 09                	je     800eb2 <cpuid_count+0x47>
+		*eaxp = eax;
+  800ea9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ead:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800eb0:	89 10                	mov    %edx,(%rax)
+	if (ebxp)
+  800eb2:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800eb7:	74 09                	je     800ec2 <cpuid_count+0x57>
+		*ebxp = ebx;
+  800eb9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ebd:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800ec0:	89 10                	mov    %edx,(%rax)
+	if (ecxp)
+  800ec2:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800ec7:	74 09                	je     800ed2 <cpuid_count+0x67>
+		*ecxp = ecx;
+  800ec9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ecd:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800ed0:	89 10                	mov    %edx,(%rax)
+	if (edxp)
+  800ed2:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800ed7:	74 09                	je     800ee2 <cpuid_count+0x77>
+		*edxp = edx;
+  800ed9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800edd:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800ee0:	89 10                	mov    %edx,(%rax)
+}
+  800ee2:	90                   	nop
+  800ee3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ee7:	c9                   	leave
+  800ee8:	c3                   	ret
+
+0000000000800ee9 <strlen>:
+// 在真正的硬件上会有一定程度的优化, 但在 Bochs 上会有更大的优化效果
+// 用这种方法, Primespipe 的运行速度快了3倍
+#define ASM 1
+
+int strlen(const char *s)
+{
+  800ee9:	55                   	push   %rbp
+  800eea:	48 89 e5             	mov    %rsp,%rbp
+  800eed:	48 83 ec 18          	sub    $0x18,%rsp
+  800ef1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800ef5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800efc:	eb 09                	jmp    800f07 <strlen+0x1e>
+		n++;
+  800efe:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  800f02:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800f07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f0b:	0f b6 00             	movzbl (%rax),%eax
+  800f0e:	84 c0                	test   %al,%al
+  800f10:	75 ec                	jne    800efe <strlen+0x15>
+	return n;
+  800f12:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800f15:	c9                   	leave
+  800f16:	c3                   	ret
+
+0000000000800f17 <strnlen>:
+
+int strnlen(const char *s, size_t size)
+{
+  800f17:	55                   	push   %rbp
+  800f18:	48 89 e5             	mov    %rsp,%rbp
+  800f1b:	48 83 ec 20          	sub    $0x20,%rsp
+  800f1f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800f23:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f27:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800f2e:	eb 0e                	jmp    800f3e <strnlen+0x27>
+		n++;
+  800f30:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f34:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800f39:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  800f3e:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800f43:	74 0b                	je     800f50 <strnlen+0x39>
+  800f45:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f49:	0f b6 00             	movzbl (%rax),%eax
+  800f4c:	84 c0                	test   %al,%al
+  800f4e:	75 e0                	jne    800f30 <strnlen+0x19>
+	return n;
+  800f50:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800f53:	c9                   	leave
+  800f54:	c3                   	ret
+
+0000000000800f55 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800f55:	55                   	push   %rbp
+  800f56:	48 89 e5             	mov    %rsp,%rbp
+  800f59:	48 83 ec 20          	sub    $0x20,%rsp
+  800f5d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800f61:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  800f65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f69:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  800f6d:	90                   	nop
+  800f6e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f72:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  800f76:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800f7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f7e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800f82:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f86:	0f b6 12             	movzbl (%rdx),%edx
+  800f89:	88 10                	mov    %dl,(%rax)
+  800f8b:	0f b6 00             	movzbl (%rax),%eax
+  800f8e:	84 c0                	test   %al,%al
+  800f90:	75 dc                	jne    800f6e <strcpy+0x19>
+		/* do nothing */;
+	return ret;
+  800f92:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800f96:	c9                   	leave
+  800f97:	c3                   	ret
+
+0000000000800f98 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800f98:	55                   	push   %rbp
+  800f99:	48 89 e5             	mov    %rsp,%rbp
+  800f9c:	48 83 ec 20          	sub    $0x20,%rsp
+  800fa0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800fa4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int len = strlen(dst);
+  800fa8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fac:	48 89 c7             	mov    %rax,%rdi
+  800faf:	48 b8 e9 0e 80 00 00 	movabs $0x800ee9,%rax
+  800fb6:	00 00 00 
+  800fb9:	ff d0                	call   *%rax
+  800fbb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+	strcpy(dst + len, src);
+  800fbe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800fc1:	48 63 d0             	movslq %eax,%rdx
+  800fc4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fc8:	48 01 c2             	add    %rax,%rdx
+  800fcb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800fcf:	48 89 c6             	mov    %rax,%rsi
+  800fd2:	48 89 d7             	mov    %rdx,%rdi
+  800fd5:	48 b8 55 0f 80 00 00 	movabs $0x800f55,%rax
+  800fdc:	00 00 00 
+  800fdf:	ff d0                	call   *%rax
+	return dst;
+  800fe1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  800fe5:	c9                   	leave
+  800fe6:	c3                   	ret
+
+0000000000800fe7 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800fe7:	55                   	push   %rbp
+  800fe8:	48 89 e5             	mov    %rsp,%rbp
+  800feb:	48 83 ec 28          	sub    $0x28,%rsp
+  800fef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ff3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800ff7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  800ffb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fff:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++)
+  801003:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80100a:	00 
+  80100b:	eb 2a                	jmp    801037 <strncpy+0x50>
+	{
+		*dst++ = *src;
+  80100d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801011:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801015:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801019:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80101d:	0f b6 12             	movzbl (%rdx),%edx
+  801020:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801022:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801026:	0f b6 00             	movzbl (%rax),%eax
+  801029:	84 c0                	test   %al,%al
+  80102b:	74 05                	je     801032 <strncpy+0x4b>
+			src++;
+  80102d:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++)
+  801032:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801037:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80103b:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80103f:	72 cc                	jb     80100d <strncpy+0x26>
+	}
+	return ret;
+  801041:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801045:	c9                   	leave
+  801046:	c3                   	ret
+
+0000000000801047 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801047:	55                   	push   %rbp
+  801048:	48 89 e5             	mov    %rsp,%rbp
+  80104b:	48 83 ec 28          	sub    $0x28,%rsp
+  80104f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801053:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801057:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  80105b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80105f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0)
+  801063:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801068:	74 3d                	je     8010a7 <strlcpy+0x60>
+	{
+		while (--size > 0 && *src != '\0')
+  80106a:	eb 1d                	jmp    801089 <strlcpy+0x42>
+			*dst++ = *src++;
+  80106c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801070:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801074:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801078:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80107c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801080:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801084:	0f b6 12             	movzbl (%rdx),%edx
+  801087:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801089:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80108e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801093:	74 0b                	je     8010a0 <strlcpy+0x59>
+  801095:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801099:	0f b6 00             	movzbl (%rax),%eax
+  80109c:	84 c0                	test   %al,%al
+  80109e:	75 cc                	jne    80106c <strlcpy+0x25>
+		*dst = '\0';
+  8010a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010a4:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8010a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010ab:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8010af:	c9                   	leave
+  8010b0:	c3                   	ret
+
+00000000008010b1 <strcmp>:
+
+int strcmp(const char *p, const char *q)
+{
+  8010b1:	55                   	push   %rbp
+  8010b2:	48 89 e5             	mov    %rsp,%rbp
+  8010b5:	48 83 ec 10          	sub    $0x10,%rsp
+  8010b9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8010bd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8010c1:	eb 0a                	jmp    8010cd <strcmp+0x1c>
+		p++, q++;
+  8010c3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8010c8:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8010cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010d1:	0f b6 00             	movzbl (%rax),%eax
+  8010d4:	84 c0                	test   %al,%al
+  8010d6:	74 12                	je     8010ea <strcmp+0x39>
+  8010d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010dc:	0f b6 10             	movzbl (%rax),%edx
+  8010df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8010e3:	0f b6 00             	movzbl (%rax),%eax
+  8010e6:	38 c2                	cmp    %al,%dl
+  8010e8:	74 d9                	je     8010c3 <strcmp+0x12>
+	return (int)((unsigned char)*p - (unsigned char)*q);
+  8010ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010ee:	0f b6 00             	movzbl (%rax),%eax
+  8010f1:	0f b6 d0             	movzbl %al,%edx
+  8010f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8010f8:	0f b6 00             	movzbl (%rax),%eax
+  8010fb:	0f b6 c0             	movzbl %al,%eax
+  8010fe:	29 c2                	sub    %eax,%edx
+  801100:	89 d0                	mov    %edx,%eax
+}
+  801102:	c9                   	leave
+  801103:	c3                   	ret
+
+0000000000801104 <strncmp>:
+
+int strncmp(const char *p, const char *q, size_t n)
+{
+  801104:	55                   	push   %rbp
+  801105:	48 89 e5             	mov    %rsp,%rbp
+  801108:	48 83 ec 18          	sub    $0x18,%rsp
+  80110c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801110:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801114:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801118:	eb 0f                	jmp    801129 <strncmp+0x25>
+		n--, p++, q++;
+  80111a:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80111f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801124:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801129:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80112e:	74 1d                	je     80114d <strncmp+0x49>
+  801130:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801134:	0f b6 00             	movzbl (%rax),%eax
+  801137:	84 c0                	test   %al,%al
+  801139:	74 12                	je     80114d <strncmp+0x49>
+  80113b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80113f:	0f b6 10             	movzbl (%rax),%edx
+  801142:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801146:	0f b6 00             	movzbl (%rax),%eax
+  801149:	38 c2                	cmp    %al,%dl
+  80114b:	74 cd                	je     80111a <strncmp+0x16>
+	if (n == 0)
+  80114d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801152:	75 07                	jne    80115b <strncmp+0x57>
+		return 0;
+  801154:	ba 00 00 00 00       	mov    $0x0,%edx
+  801159:	eb 16                	jmp    801171 <strncmp+0x6d>
+	else
+		return (int)((unsigned char)*p - (unsigned char)*q);
+  80115b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80115f:	0f b6 00             	movzbl (%rax),%eax
+  801162:	0f b6 d0             	movzbl %al,%edx
+  801165:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801169:	0f b6 00             	movzbl (%rax),%eax
+  80116c:	0f b6 c0             	movzbl %al,%eax
+  80116f:	29 c2                	sub    %eax,%edx
+}
+  801171:	89 d0                	mov    %edx,%eax
+  801173:	c9                   	leave
+  801174:	c3                   	ret
+
+0000000000801175 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801175:	55                   	push   %rbp
+  801176:	48 89 e5             	mov    %rsp,%rbp
+  801179:	48 83 ec 10          	sub    $0x10,%rsp
+  80117d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801181:	89 f0                	mov    %esi,%eax
+  801183:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801186:	eb 17                	jmp    80119f <strchr+0x2a>
+		if (*s == c)
+  801188:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80118c:	0f b6 00             	movzbl (%rax),%eax
+  80118f:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801192:	75 06                	jne    80119a <strchr+0x25>
+			return (char *)s;
+  801194:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801198:	eb 15                	jmp    8011af <strchr+0x3a>
+	for (; *s; s++)
+  80119a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80119f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011a3:	0f b6 00             	movzbl (%rax),%eax
+  8011a6:	84 c0                	test   %al,%al
+  8011a8:	75 de                	jne    801188 <strchr+0x13>
+	return 0;
+  8011aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011af:	c9                   	leave
+  8011b0:	c3                   	ret
+
+00000000008011b1 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8011b1:	55                   	push   %rbp
+  8011b2:	48 89 e5             	mov    %rsp,%rbp
+  8011b5:	48 83 ec 10          	sub    $0x10,%rsp
+  8011b9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8011bd:	89 f0                	mov    %esi,%eax
+  8011bf:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8011c2:	eb 11                	jmp    8011d5 <strfind+0x24>
+		if (*s == c)
+  8011c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011c8:	0f b6 00             	movzbl (%rax),%eax
+  8011cb:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8011ce:	74 12                	je     8011e2 <strfind+0x31>
+	for (; *s; s++)
+  8011d0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8011d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011d9:	0f b6 00             	movzbl (%rax),%eax
+  8011dc:	84 c0                	test   %al,%al
+  8011de:	75 e4                	jne    8011c4 <strfind+0x13>
+  8011e0:	eb 01                	jmp    8011e3 <strfind+0x32>
+			break;
+  8011e2:	90                   	nop
+	return (char *)s;
+  8011e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8011e7:	c9                   	leave
+  8011e8:	c3                   	ret
+
+00000000008011e9 <mem_init>:
+};
+
+static int mem_features;
+
+void mem_init(void)
+{
+  8011e9:	55                   	push   %rbp
+  8011ea:	48 89 e5             	mov    %rsp,%rbp
+  8011ed:	48 83 ec 10          	sub    $0x10,%rsp
+	uint32_t max, ebx, edx;
+
+	mem_features = 0;
+  8011f1:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  8011f8:	00 00 00 
+  8011fb:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	cpuid(0, &max, NULL, NULL, NULL);
+  801201:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+  801205:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80120b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801210:	ba 00 00 00 00       	mov    $0x0,%edx
+  801215:	48 89 c6             	mov    %rax,%rsi
+  801218:	bf 00 00 00 00       	mov    $0x0,%edi
+  80121d:	48 b8 f5 0d 80 00 00 	movabs $0x800df5,%rax
+  801224:	00 00 00 
+  801227:	ff d0                	call   *%rax
+	cpuid(1, NULL, NULL, NULL, &edx);
+  801229:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  80122d:	49 89 c0             	mov    %rax,%r8
+  801230:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801235:	ba 00 00 00 00       	mov    $0x0,%edx
+  80123a:	be 00 00 00 00       	mov    $0x0,%esi
+  80123f:	bf 01 00 00 00       	mov    $0x1,%edi
+  801244:	48 b8 f5 0d 80 00 00 	movabs $0x800df5,%rax
+  80124b:	00 00 00 
+  80124e:	ff d0                	call   *%rax
+	if (edx & (1 << 26))
+  801250:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801253:	25 00 00 00 04       	and    $0x4000000,%eax
+  801258:	85 c0                	test   %eax,%eax
+  80125a:	74 1d                	je     801279 <mem_init+0x90>
+		mem_features |= MEM_F_NT;
+  80125c:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  801263:	00 00 00 
+  801266:	8b 00                	mov    (%rax),%eax
+  801268:	83 c8 02             	or     $0x2,%eax
+  80126b:	89 c2                	mov    %eax,%edx
+  80126d:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  801274:	00 00 00 
+  801277:	89 10                	mov    %edx,(%rax)
+	if (max >= 7)
+  801279:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80127c:	83 f8 06             	cmp    $0x6,%eax
+  80127f:	76 57                	jbe    8012d8 <mem_init+0xef>
+	{
+		cpuid_count(7, 0, NULL, &ebx, NULL, NULL);
+  801281:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801285:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80128b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801291:	48 89 c1             	mov    %rax,%rcx
+  801294:	ba 00 00 00 00       	mov    $0x0,%edx
+  801299:	be 00 00 00 00       	mov    $0x0,%esi
+  80129e:	bf 07 00 00 00       	mov    $0x7,%edi
+  8012a3:	48 b8 6b 0e 80 00 00 	movabs $0x800e6b,%rax
+  8012aa:	00 00 00 
+  8012ad:	ff d0                	call   *%rax
+		if (ebx & (1 << 9))
+  8012af:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8012b2:	25 00 02 00 00       	and    $0x200,%eax
+  8012b7:	85 c0                	test   %eax,%eax
+  8012b9:	74 1d                	je     8012d8 <mem_init+0xef>
+			mem_features |= MEM_F_ERMS;
+  8012bb:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  8012c2:	00 00 00 
+  8012c5:	8b 00                	mov    (%rax),%eax
+  8012c7:	83 c8 01             	or     $0x1,%eax
+  8012ca:	89 c2                	mov    %eax,%edx
+  8012cc:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  8012d3:	00 00 00 
+  8012d6:	89 10                	mov    %edx,(%rax)
+	}
+}
+  8012d8:	90                   	nop
+  8012d9:	c9                   	leave
+  8012da:	c3                   	ret
+
+00000000008012db <memset_nt>:
+
+// 非临时存储填充 n 字节(v 8 字节对齐，n 为 32 的倍数)
+static void
+memset_nt(void *v, uint64_t pattern, size_t n)
+{
+  8012db:	55                   	push   %rbp
+  8012dc:	48 89 e5             	mov    %rsp,%rbp
+  8012df:	48 83 ec 28          	sub    $0x28,%rsp
+  8012e3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012e7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8012eb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t *p = (uint64_t *)v;
+  8012ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012f3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	uint64_t *end = p + n / 8;
+  8012f7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012fb:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  8012ff:	48 89 c2             	mov    %rax,%rdx
+  801302:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801306:	48 01 d0             	add    %rdx,%rax
+  801309:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	for (; p < end; p += 4)
+  80130d:	eb 20                	jmp    80132f <memset_nt+0x54>
+		asm volatile("movnti %1, 0(%0)\n\t"
+  80130f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801313:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801317:	48 0f c3 10          	movnti %rdx,(%rax)
+  80131b:	48 0f c3 50 08       	movnti %rdx,0x8(%rax)
+  801320:	48 0f c3 50 10       	movnti %rdx,0x10(%rax)
+  801325:	48 0f c3 50 18       	movnti %rdx,0x18(%rax)
+	for (; p < end; p += 4)
+  80132a:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  80132f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801333:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801337:	72 d6                	jb     80130f <memset_nt+0x34>
+					 "movnti %1, 16(%0)\n\t"
+					 "movnti %1, 24(%0)"
+					 :
+					 : "r"(p), "r"(pattern)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  801339:	0f ae f8             	sfence
+}
+  80133c:	90                   	nop
+  80133d:	c9                   	leave
+  80133e:	c3                   	ret
+
+000000000080133f <memcpy_nt>:
+
+// 非临时存储复制 n 字节(dst/src 8 字节对齐且不重叠，n 为 32 的倍数)
+static void
+memcpy_nt(void *dst, const void *src, size_t n)
+{
+  80133f:	55                   	push   %rbp
+  801340:	48 89 e5             	mov    %rsp,%rbp
+  801343:	48 83 ec 58          	sub    $0x58,%rsp
+  801347:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80134b:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  80134f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	uint64_t *d = (uint64_t *)dst;
+  801353:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801357:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint64_t *s = (const uint64_t *)src;
+  80135b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80135f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	uint64_t *end = d + n / 8;
+  801363:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801367:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  80136b:	48 89 c2             	mov    %rax,%rdx
+  80136e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801372:	48 01 d0             	add    %rdx,%rax
+  801375:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint64_t t0, t1, t2, t3;
+
+	for (; d < end; d += 4, s += 4)
+  801379:	eb 44                	jmp    8013bf <memcpy_nt+0x80>
+		asm volatile("movq 0(%4), %0\n\t"
+  80137b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80137f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801383:	4c 8b 00             	mov    (%rax),%r8
+  801386:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  80138a:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  80138e:	48 8b 48 18          	mov    0x18(%rax),%rcx
+  801392:	4c 0f c3 02          	movnti %r8,(%rdx)
+  801396:	48 0f c3 7a 08       	movnti %rdi,0x8(%rdx)
+  80139b:	48 0f c3 72 10       	movnti %rsi,0x10(%rdx)
+  8013a0:	48 0f c3 4a 18       	movnti %rcx,0x18(%rdx)
+  8013a5:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8013a9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8013ad:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8013b1:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+	for (; d < end; d += 4, s += 4)
+  8013b5:	48 83 45 f8 20       	addq   $0x20,-0x8(%rbp)
+  8013ba:	48 83 45 f0 20       	addq   $0x20,-0x10(%rbp)
+  8013bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013c3:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  8013c7:	72 b2                	jb     80137b <memcpy_nt+0x3c>
+					 "movnti %2, 16(%5)\n\t"
+					 "movnti %3, 24(%5)"
+					 : "=&r"(t0), "=&r"(t1), "=&r"(t2), "=&r"(t3)
+					 : "r"(s), "r"(d)
+					 : "memory");
+	asm volatile("sfence" ::: "memory");
+  8013c9:	0f ae f8             	sfence
+}
+  8013cc:	90                   	nop
+  8013cd:	c9                   	leave
+  8013ce:	c3                   	ret
+
+00000000008013cf <memcpy_fwd>:
+
+// 正向复制(dst 在 src 之前或两者不重叠)
+static void
+memcpy_fwd(void *dst, const void *src, size_t n)
+{
+  8013cf:	55                   	push   %rbp
+  8013d0:	48 89 e5             	mov    %rsp,%rbp
+  8013d3:	48 83 ec 18          	sub    $0x18,%rsp
+  8013d7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8013db:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8013df:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  8013e3:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  8013ea:	00 00 00 
+  8013ed:	8b 00                	mov    (%rax),%eax
+  8013ef:	83 e0 02             	and    $0x2,%eax
+  8013f2:	85 c0                	test   %eax,%eax
+  8013f4:	74 66                	je     80145c <memcpy_fwd+0x8d>
+  8013f6:	48 81 7d e8 ff 0f 00 	cmpq   $0xfff,-0x18(%rbp)
+  8013fd:	00 
+  8013fe:	76 5c                	jbe    80145c <memcpy_fwd+0x8d>
+  801400:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801404:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801408:	48 09 d0             	or     %rdx,%rax
+  80140b:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  80140f:	83 e0 1f             	and    $0x1f,%eax
+  801412:	48 85 c0             	test   %rax,%rax
+  801415:	75 45                	jne    80145c <memcpy_fwd+0x8d>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  801417:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80141b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80141f:	48 01 d0             	add    %rdx,%rax
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)dst | (uint64_t)src | n) & 31) == 0 &&
+  801422:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801426:	73 11                	jae    801439 <memcpy_fwd+0x6a>
+		((const char *)src + n <= (char *)dst || (char *)dst + n <= (const char *)src))
+  801428:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80142c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801430:	48 01 d0             	add    %rdx,%rax
+  801433:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801437:	72 23                	jb     80145c <memcpy_fwd+0x8d>
+		memcpy_nt(dst, src, n);
+  801439:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80143d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801441:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801445:	48 89 ce             	mov    %rcx,%rsi
+  801448:	48 89 c7             	mov    %rax,%rdi
+  80144b:	48 b8 3f 13 80 00 00 	movabs $0x80133f,%rax
+  801452:	00 00 00 
+  801455:	ff d0                	call   *%rax
+  801457:	e9 81 00 00 00       	jmp    8014dd <memcpy_fwd+0x10e>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  80145c:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  801463:	00 00 00 
+  801466:	8b 00                	mov    (%rax),%eax
+  801468:	83 e0 01             	and    $0x1,%eax
+  80146b:	85 c0                	test   %eax,%eax
+  80146d:	74 21                	je     801490 <memcpy_fwd+0xc1>
+  80146f:	48 81 7d e8 ff 00 00 	cmpq   $0xff,-0x18(%rbp)
+  801476:	00 
+  801477:	76 17                	jbe    801490 <memcpy_fwd+0xc1>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  801479:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80147d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801481:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801485:	48 89 c7             	mov    %rax,%rdi
+  801488:	48 89 d6             	mov    %rdx,%rsi
+  80148b:	fc                   	cld
+  80148c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80148e:	eb 4d                	jmp    8014dd <memcpy_fwd+0x10e>
+					 : "cc", "memory");
+	else if ((((uint64_t)dst | (uint64_t)src | n) & 7) == 0)
+  801490:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801494:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801498:	48 09 d0             	or     %rdx,%rax
+  80149b:	48 0b 45 e8          	or     -0x18(%rbp),%rax
+  80149f:	83 e0 07             	and    $0x7,%eax
+  8014a2:	48 85 c0             	test   %rax,%rax
+  8014a5:	75 1f                	jne    8014c6 <memcpy_fwd+0xf7>
+		asm volatile("cld; rep movsq\n" ::"D"(dst), "S"(src), "c"(n / 8)
+  8014a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014ab:	48 c1 e8 03          	shr    $0x3,%rax
+  8014af:	48 89 c1             	mov    %rax,%rcx
+  8014b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014b6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8014ba:	48 89 c7             	mov    %rax,%rdi
+  8014bd:	48 89 d6             	mov    %rdx,%rsi
+  8014c0:	fc                   	cld
+  8014c1:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+					 : "cc", "memory");
+}
+  8014c4:	eb 17                	jmp    8014dd <memcpy_fwd+0x10e>
+		asm volatile("cld; rep movsb\n" ::"D"(dst), "S"(src), "c"(n)
+  8014c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014ca:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8014ce:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8014d2:	48 89 c7             	mov    %rax,%rdi
+  8014d5:	48 89 d6             	mov    %rdx,%rsi
+  8014d8:	fc                   	cld
+  8014d9:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+  8014db:	eb 00                	jmp    8014dd <memcpy_fwd+0x10e>
+  8014dd:	90                   	nop
+  8014de:	c9                   	leave
+  8014df:	c3                   	ret
+
+00000000008014e0 <memset>:
+
+void *
+memset(void *v, int c, size_t n)
+{
+  8014e0:	55                   	push   %rbp
+  8014e1:	48 89 e5             	mov    %rsp,%rbp
+  8014e4:	48 83 ec 28          	sub    $0x28,%rsp
+  8014e8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014ec:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8014ef:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	uint64_t pattern;
+
+	if (n == 0)
+  8014f3:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8014f8:	75 09                	jne    801503 <memset+0x23>
+		return v;
+  8014fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014fe:	e9 dc 00 00 00       	jmp    8015df <memset+0xff>
+	c &= 0xFF;
+  801503:	81 65 e4 ff 00 00 00 	andl   $0xff,-0x1c(%rbp)
+	pattern = (uint64_t)c * 0x0101010101010101UL;
+  80150a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80150d:	48 98                	cltq
+  80150f:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801516:	01 01 01 
+  801519:	48 0f af c2          	imul   %rdx,%rax
+  80151d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if ((mem_features & MEM_F_NT) && n >= MEM_NT_MIN && (((uint64_t)v | n) & 31) == 0)
+  801521:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  801528:	00 00 00 
+  80152b:	8b 00                	mov    (%rax),%eax
+  80152d:	83 e0 02             	and    $0x2,%eax
+  801530:	85 c0                	test   %eax,%eax
+  801532:	74 3a                	je     80156e <memset+0x8e>
+  801534:	48 81 7d d8 ff 0f 00 	cmpq   $0xfff,-0x28(%rbp)
+  80153b:	00 
+  80153c:	76 30                	jbe    80156e <memset+0x8e>
+  80153e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801542:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  801546:	83 e0 1f             	and    $0x1f,%eax
+  801549:	48 85 c0             	test   %rax,%rax
+  80154c:	75 20                	jne    80156e <memset+0x8e>
+		memset_nt(v, pattern, n);
+  80154e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801552:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801556:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80155a:	48 89 ce             	mov    %rcx,%rsi
+  80155d:	48 89 c7             	mov    %rax,%rdi
+  801560:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  801567:	00 00 00 
+  80156a:	ff d0                	call   *%rax
+  80156c:	eb 6d                	jmp    8015db <memset+0xfb>
+	else if ((mem_features & MEM_F_ERMS) && n >= MEM_ERMS_MIN)
+  80156e:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  801575:	00 00 00 
+  801578:	8b 00                	mov    (%rax),%eax
+  80157a:	83 e0 01             	and    $0x1,%eax
+  80157d:	85 c0                	test   %eax,%eax
+  80157f:	74 1d                	je     80159e <memset+0xbe>
+  801581:	48 81 7d d8 ff 00 00 	cmpq   $0xff,-0x28(%rbp)
+  801588:	00 
+  801589:	76 13                	jbe    80159e <memset+0xbe>
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  80158b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80158f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801592:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801596:	48 89 d7             	mov    %rdx,%rdi
+  801599:	fc                   	cld
+  80159a:	f3 aa                	rep stos %al,%es:(%rdi)
+  80159c:	eb 3d                	jmp    8015db <memset+0xfb>
+					 : "cc", "memory");
+	else if ((((uint64_t)v | n) & 7) == 0)
+  80159e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015a2:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  8015a6:	83 e0 07             	and    $0x7,%eax
+  8015a9:	48 85 c0             	test   %rax,%rax
+  8015ac:	75 1c                	jne    8015ca <memset+0xea>
+		asm volatile("cld; rep stosq\n" ::"D"(v), "a"(pattern), "c"(n / 8)
+  8015ae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015b2:	48 c1 e8 03          	shr    $0x3,%rax
+  8015b6:	48 89 c1             	mov    %rax,%rcx
+  8015b9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8015bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015c1:	48 89 d7             	mov    %rdx,%rdi
+  8015c4:	fc                   	cld
+  8015c5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8015c8:	eb 11                	jmp    8015db <memset+0xfb>
+					 : "cc", "memory");
+	else
+		asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+  8015ca:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8015ce:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8015d1:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8015d5:	48 89 d7             	mov    %rdx,%rdi
+  8015d8:	fc                   	cld
+  8015d9:	f3 aa                	rep stos %al,%es:(%rdi)
+					 : "cc", "memory");
+	return v;
+  8015db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8015df:	c9                   	leave
+  8015e0:	c3                   	ret
+
+00000000008015e1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8015e1:	55                   	push   %rbp
+  8015e2:	48 89 e5             	mov    %rsp,%rbp
+  8015e5:	48 83 ec 28          	sub    $0x28,%rsp
+  8015e9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015ed:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8015f1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  8015f5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015f9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8015fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801601:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d)
+  801605:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801609:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80160d:	73 7c                	jae    80168b <memmove+0xaa>
+  80160f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801613:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801617:	48 01 d0             	add    %rdx,%rax
+  80161a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80161e:	73 6b                	jae    80168b <memmove+0xaa>
+	{
+		// 重叠且 dst 在 src 之后，只能反向复制(ERMS 对反向 rep movsb 没有优化)
+		s += n;
+  801620:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801624:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801628:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80162c:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((((uint64_t)s | (uint64_t)d | n) & 7) == 0)
+  801630:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801634:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801638:	48 09 d0             	or     %rdx,%rax
+  80163b:	48 0b 45 d8          	or     -0x28(%rbp),%rax
+  80163f:	83 e0 07             	and    $0x7,%eax
+  801642:	48 85 c0             	test   %rax,%rax
+  801645:	75 24                	jne    80166b <memmove+0x8a>
+			asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801647:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80164b:	48 83 e8 08          	sub    $0x8,%rax
+  80164f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801653:	48 83 ea 08          	sub    $0x8,%rdx
+  801657:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80165b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80165f:	48 89 c7             	mov    %rax,%rdi
+  801662:	48 89 d6             	mov    %rdx,%rsi
+  801665:	fd                   	std
+  801666:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801669:	eb 1d                	jmp    801688 <memmove+0xa7>
+						 : "cc", "memory");
+		else
+			asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80166b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80166f:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801673:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801677:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+  80167b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80167f:	48 89 d7             	mov    %rdx,%rdi
+  801682:	48 89 c1             	mov    %rax,%rcx
+  801685:	fd                   	std
+  801686:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+						 : "cc", "memory");
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::
+  801688:	fc                   	cld
+  801689:	eb 25                	jmp    8016b0 <memmove+0xcf>
+						 : "cc");
+	}
+	else if (n)
+  80168b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801690:	74 1e                	je     8016b0 <memmove+0xcf>
+		memcpy_fwd(d, s, n);
+  801692:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801696:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80169a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80169e:	48 89 ce             	mov    %rcx,%rsi
+  8016a1:	48 89 c7             	mov    %rax,%rdi
+  8016a4:	48 b8 cf 13 80 00 00 	movabs $0x8013cf,%rax
+  8016ab:	00 00 00 
+  8016ae:	ff d0                	call   *%rax
+	return dst;
+  8016b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8016b4:	c9                   	leave
+  8016b5:	c3                   	ret
+
+00000000008016b6 <memcpy>:
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8016b6:	55                   	push   %rbp
+  8016b7:	48 89 e5             	mov    %rsp,%rbp
+  8016ba:	48 83 ec 18          	sub    $0x18,%rsp
+  8016be:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016c2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8016c6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (n)
+  8016ca:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8016cf:	74 1e                	je     8016ef <memcpy+0x39>
+		memcpy_fwd(dst, src, n);
+  8016d1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8016d5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8016d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016dd:	48 89 ce             	mov    %rcx,%rsi
+  8016e0:	48 89 c7             	mov    %rax,%rdi
+  8016e3:	48 b8 cf 13 80 00 00 	movabs $0x8013cf,%rax
+  8016ea:	00 00 00 
+  8016ed:	ff d0                	call   *%rax
+	return dst;
+  8016ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8016f3:	c9                   	leave
+  8016f4:	c3                   	ret
+
+00000000008016f5 <memcmp>:
+{
+}
+#endif
+
+int memcmp(const void *v1, const void *v2, size_t n)
+{
+  8016f5:	55                   	push   %rbp
+  8016f6:	48 89 e5             	mov    %rsp,%rbp
+  8016f9:	48 83 ec 28          	sub    $0x28,%rsp
+  8016fd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801701:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801705:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *)v1;
+  801709:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80170d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *)v2;
+  801711:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801715:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0)
+  801719:	eb 34                	jmp    80174f <memcmp+0x5a>
+	{
+		if (*s1 != *s2)
+  80171b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80171f:	0f b6 10             	movzbl (%rax),%edx
+  801722:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801726:	0f b6 00             	movzbl (%rax),%eax
+  801729:	38 c2                	cmp    %al,%dl
+  80172b:	74 18                	je     801745 <memcmp+0x50>
+			return (int)*s1 - (int)*s2;
+  80172d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801731:	0f b6 00             	movzbl (%rax),%eax
+  801734:	0f b6 d0             	movzbl %al,%edx
+  801737:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80173b:	0f b6 00             	movzbl (%rax),%eax
+  80173e:	0f b6 c0             	movzbl %al,%eax
+  801741:	29 c2                	sub    %eax,%edx
+  801743:	eb 20                	jmp    801765 <memcmp+0x70>
+		s1++, s2++;
+  801745:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80174a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0)
+  80174f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801753:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801757:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80175b:	48 85 c0             	test   %rax,%rax
+  80175e:	75 bb                	jne    80171b <memcmp+0x26>
+	}
+
+	return 0;
+  801760:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801765:	89 d0                	mov    %edx,%eax
+  801767:	c9                   	leave
+  801768:	c3                   	ret
+
+0000000000801769 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801769:	55                   	push   %rbp
+  80176a:	48 89 e5             	mov    %rsp,%rbp
+  80176d:	48 83 ec 28          	sub    $0x28,%rsp
+  801771:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801775:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801778:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *)s + n;
+  80177c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801780:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801784:	48 01 d0             	add    %rdx,%rax
+  801787:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  80178b:	eb 13                	jmp    8017a0 <memfind+0x37>
+		if (*(const unsigned char *)s == (unsigned char)c)
+  80178d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801791:	0f b6 00             	movzbl (%rax),%eax
+  801794:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801797:	38 d0                	cmp    %dl,%al
+  801799:	74 11                	je     8017ac <memfind+0x43>
+	for (; s < ends; s++)
+  80179b:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8017a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017a4:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8017a8:	72 e3                	jb     80178d <memfind+0x24>
+  8017aa:	eb 01                	jmp    8017ad <memfind+0x44>
+			break;
+  8017ac:	90                   	nop
+	return (void *)s;
+  8017ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8017b1:	c9                   	leave
+  8017b2:	c3                   	ret
+
+00000000008017b3 <strtol>:
+
+long strtol(const char *s, char **endptr, int base)
+{
+  8017b3:	55                   	push   %rbp
+  8017b4:	48 89 e5             	mov    %rsp,%rbp
+  8017b7:	48 83 ec 38          	sub    $0x38,%rsp
+  8017bb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8017bf:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8017c3:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  8017c6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  8017cd:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8017d4:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8017d5:	eb 05                	jmp    8017dc <strtol+0x29>
+		s++;
+  8017d7:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  8017dc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017e0:	0f b6 00             	movzbl (%rax),%eax
+  8017e3:	3c 20                	cmp    $0x20,%al
+  8017e5:	74 f0                	je     8017d7 <strtol+0x24>
+  8017e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017eb:	0f b6 00             	movzbl (%rax),%eax
+  8017ee:	3c 09                	cmp    $0x9,%al
+  8017f0:	74 e5                	je     8017d7 <strtol+0x24>
+
+	// plus/minus sign
+	if (*s == '+')
+  8017f2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017f6:	0f b6 00             	movzbl (%rax),%eax
+  8017f9:	3c 2b                	cmp    $0x2b,%al
+  8017fb:	75 07                	jne    801804 <strtol+0x51>
+		s++;
+  8017fd:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801802:	eb 17                	jmp    80181b <strtol+0x68>
+	else if (*s == '-')
+  801804:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801808:	0f b6 00             	movzbl (%rax),%eax
+  80180b:	3c 2d                	cmp    $0x2d,%al
+  80180d:	75 0c                	jne    80181b <strtol+0x68>
+		s++, neg = 1;
+  80180f:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801814:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80181b:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80181f:	74 06                	je     801827 <strtol+0x74>
+  801821:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801825:	75 28                	jne    80184f <strtol+0x9c>
+  801827:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80182b:	0f b6 00             	movzbl (%rax),%eax
+  80182e:	3c 30                	cmp    $0x30,%al
+  801830:	75 1d                	jne    80184f <strtol+0x9c>
+  801832:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801836:	48 83 c0 01          	add    $0x1,%rax
+  80183a:	0f b6 00             	movzbl (%rax),%eax
+  80183d:	3c 78                	cmp    $0x78,%al
+  80183f:	75 0e                	jne    80184f <strtol+0x9c>
+		s += 2, base = 16;
+  801841:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801846:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  80184d:	eb 2c                	jmp    80187b <strtol+0xc8>
+	else if (base == 0 && s[0] == '0')
+  80184f:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801853:	75 19                	jne    80186e <strtol+0xbb>
+  801855:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801859:	0f b6 00             	movzbl (%rax),%eax
+  80185c:	3c 30                	cmp    $0x30,%al
+  80185e:	75 0e                	jne    80186e <strtol+0xbb>
+		s++, base = 8;
+  801860:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801865:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  80186c:	eb 0d                	jmp    80187b <strtol+0xc8>
+	else if (base == 0)
+  80186e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801872:	75 07                	jne    80187b <strtol+0xc8>
+		base = 10;
+  801874:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+	// digits
+	while (1)
+	{
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  80187b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80187f:	0f b6 00             	movzbl (%rax),%eax
+  801882:	3c 2f                	cmp    $0x2f,%al
+  801884:	7e 1d                	jle    8018a3 <strtol+0xf0>
+  801886:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80188a:	0f b6 00             	movzbl (%rax),%eax
+  80188d:	3c 39                	cmp    $0x39,%al
+  80188f:	7f 12                	jg     8018a3 <strtol+0xf0>
+			dig = *s - '0';
+  801891:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801895:	0f b6 00             	movzbl (%rax),%eax
+  801898:	0f be c0             	movsbl %al,%eax
+  80189b:	83 e8 30             	sub    $0x30,%eax
+  80189e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8018a1:	eb 4e                	jmp    8018f1 <strtol+0x13e>
+		else if (*s >= 'a' && *s <= 'z')
+  8018a3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018a7:	0f b6 00             	movzbl (%rax),%eax
+  8018aa:	3c 60                	cmp    $0x60,%al
+  8018ac:	7e 1d                	jle    8018cb <strtol+0x118>
+  8018ae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018b2:	0f b6 00             	movzbl (%rax),%eax
+  8018b5:	3c 7a                	cmp    $0x7a,%al
+  8018b7:	7f 12                	jg     8018cb <strtol+0x118>
+			dig = *s - 'a' + 10;
+  8018b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018bd:	0f b6 00             	movzbl (%rax),%eax
+  8018c0:	0f be c0             	movsbl %al,%eax
+  8018c3:	83 e8 57             	sub    $0x57,%eax
+  8018c6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8018c9:	eb 26                	jmp    8018f1 <strtol+0x13e>
+		else if (*s >= 'A' && *s <= 'Z')
+  8018cb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018cf:	0f b6 00             	movzbl (%rax),%eax
+  8018d2:	3c 40                	cmp    $0x40,%al
+  8018d4:	7e 47                	jle    80191d <strtol+0x16a>
+  8018d6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018da:	0f b6 00             	movzbl (%rax),%eax
+  8018dd:	3c 5a                	cmp    $0x5a,%al
+  8018df:	7f 3c                	jg     80191d <strtol+0x16a>
+			dig = *s - 'A' + 10;
+  8018e1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018e5:	0f b6 00             	movzbl (%rax),%eax
+  8018e8:	0f be c0             	movsbl %al,%eax
+  8018eb:	83 e8 37             	sub    $0x37,%eax
+  8018ee:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  8018f1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8018f4:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  8018f7:	7d 23                	jge    80191c <strtol+0x169>
+			break;
+		s++, val = (val * base) + dig;
+  8018f9:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8018fe:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801901:	48 98                	cltq
+  801903:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801908:	48 89 c2             	mov    %rax,%rdx
+  80190b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80190e:	48 98                	cltq
+  801910:	48 01 d0             	add    %rdx,%rax
+  801913:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+  801917:	e9 5f ff ff ff       	jmp    80187b <strtol+0xc8>
+			break;
+  80191c:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80191d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801922:	74 0b                	je     80192f <strtol+0x17c>
+		*endptr = (char *)s;
+  801924:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801928:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80192c:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  80192f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801933:	74 09                	je     80193e <strtol+0x18b>
+  801935:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801939:	48 f7 d8             	neg    %rax
+  80193c:	eb 04                	jmp    801942 <strtol+0x18f>
+  80193e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801942:	c9                   	leave
+  801943:	c3                   	ret
+
+0000000000801944 <strstr>:
+
+char *strstr(const char *in, const char *str)
+{
+  801944:	55                   	push   %rbp
+  801945:	48 89 e5             	mov    %rsp,%rbp
+  801948:	48 83 ec 30          	sub    $0x30,%rsp
+  80194c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801950:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801954:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801958:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80195c:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801960:	0f b6 00             	movzbl (%rax),%eax
+  801963:	88 45 ff             	mov    %al,-0x1(%rbp)
+	if (!c)
+  801966:	80 7d ff 00          	cmpb   $0x0,-0x1(%rbp)
+  80196a:	75 06                	jne    801972 <strstr+0x2e>
+		return (char *)in; // Trivial empty string case
+  80196c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801970:	eb 6b                	jmp    8019dd <strstr+0x99>
+
+	len = strlen(str);
+  801972:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801976:	48 89 c7             	mov    %rax,%rdi
+  801979:	48 b8 e9 0e 80 00 00 	movabs $0x800ee9,%rax
+  801980:	00 00 00 
+  801983:	ff d0                	call   *%rax
+  801985:	48 98                	cltq
+  801987:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	{
+		char sc;
+
+		do
+		{
+			sc = *in++;
+  80198b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80198f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801993:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801997:	0f b6 00             	movzbl (%rax),%eax
+  80199a:	88 45 ef             	mov    %al,-0x11(%rbp)
+			if (!sc)
+  80199d:	80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+  8019a1:	75 07                	jne    8019aa <strstr+0x66>
+				return (char *)0;
+  8019a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a8:	eb 33                	jmp    8019dd <strstr+0x99>
+		} while (sc != c);
+  8019aa:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+  8019ae:	3a 45 ff             	cmp    -0x1(%rbp),%al
+  8019b1:	75 d8                	jne    80198b <strstr+0x47>
+	} while (strncmp(in, str, len) != 0);
+  8019b3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8019b7:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8019bb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019bf:	48 89 ce             	mov    %rcx,%rsi
+  8019c2:	48 89 c7             	mov    %rax,%rdi
+  8019c5:	48 b8 04 11 80 00 00 	movabs $0x801104,%rax
+  8019cc:	00 00 00 
+  8019cf:	ff d0                	call   *%rax
+  8019d1:	85 c0                	test   %eax,%eax
+  8019d3:	75 b6                	jne    80198b <strstr+0x47>
+
+	return (char *)(in - 1);
+  8019d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019d9:	48 83 e8 01          	sub    $0x1,%rax
+}
+  8019dd:	c9                   	leave
+  8019de:	c3                   	ret
+
+00000000008019df <syscall>:
+ * 用户的指令式系统调用，该函数将系统调用序号放入eax寄存器，五个参数依次放入edx, ecx, ebx, edi, esi，然后执行指令int 0x30，
+ * 发生中断后，去IDT中查找中断处理函数，最终会走到kern/trap.c的trap_dispatch()中
+ */
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  8019df:	55                   	push   %rbp
+  8019e0:	48 89 e5             	mov    %rsp,%rbp
+  8019e3:	53                   	push   %rbx
+  8019e4:	48 83 ec 48          	sub    $0x48,%rsp
+  8019e8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8019eb:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8019ee:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8019f2:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8019f6:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8019fa:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	 * volatile 告诉汇编程序不要因为不使用返回值就优化该指令
+	 * 最后一个子句告诉汇编程序，指令可能会改变条件代码cx和任意内存memory位置
+	 * 由汇编编译器做好数据保存和恢复工作(栈)
+	 */
+
+	asm volatile("int %1\n"			// code: int T_SYSCALL
+  8019fe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801a01:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801a05:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a09:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801a0d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801a11:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801a15:	4c 89 c3             	mov    %r8,%rbx
+  801a18:	cd 30                	int    $0x30
+  801a1a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+				   "D"(a4),			// edi = a4
+				   "S"(a5)			// esi = a5
+				 : "cc", "memory"); // 指令可能会改变条件代码cx和任意内存memory位置
+									// 由汇编编译器做好数据保存和恢复工作(栈)
+
+	if (check && ret > 0)
+  801a1e:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801a22:	74 44                	je     801a68 <syscall+0x89>
+  801a24:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801a29:	7e 3d                	jle    801a68 <syscall+0x89>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a2b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a2f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801a32:	49 89 d0             	mov    %rdx,%r8
+  801a35:	89 c1                	mov    %eax,%ecx
+  801a37:	48 b8 c8 27 80 00 00 	movabs $0x8027c8,%rax
+  801a3e:	00 00 00 
+  801a41:	48 89 c2             	mov    %rax,%rdx
+  801a44:	be 34 00 00 00       	mov    $0x34,%esi
+  801a49:	48 b8 e5 27 80 00 00 	movabs $0x8027e5,%rax
+  801a50:	00 00 00 
+  801a53:	48 89 c7             	mov    %rax,%rdi
+  801a56:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a5b:	49 b9 52 21 80 00 00 	movabs $0x802152,%r9
+  801a62:	00 00 00 
+  801a65:	41 ff d1             	call   *%r9
+
+	return ret;
+  801a68:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801a6c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a70:	c9                   	leave
+  801a71:	c3                   	ret
+
+0000000000801a72 <sys_cputs>:
+
+void sys_cputs(const char *s, size_t len)
+{
+  801a72:	55                   	push   %rbp
+  801a73:	48 89 e5             	mov    %rsp,%rbp
+  801a76:	48 83 ec 10          	sub    $0x10,%rsp
+  801a7a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a7e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	// 调用lib/syscall.c中的syscall()
+	// SYS_cputs: 系统调用序号(eax)，s: 需要输出的字符数组，len: 数组长度
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801a82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a86:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a8a:	48 83 ec 08          	sub    $0x8,%rsp
+  801a8e:	6a 00                	push   $0x0
+  801a90:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801a96:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801a9c:	48 89 d1             	mov    %rdx,%rcx
+  801a9f:	48 89 c2             	mov    %rax,%rdx
+  801aa2:	be 00 00 00 00       	mov    $0x0,%esi
+  801aa7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801aac:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801ab3:	00 00 00 
+  801ab6:	ff d0                	call   *%rax
+  801ab8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801abc:	90                   	nop
+  801abd:	c9                   	leave
+  801abe:	c3                   	ret
+
+0000000000801abf <sys_cgetc>:
+
+int sys_cgetc(void)
+{
+  801abf:	55                   	push   %rbp
+  801ac0:	48 89 e5             	mov    %rsp,%rbp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801ac3:	48 83 ec 08          	sub    $0x8,%rsp
+  801ac7:	6a 00                	push   $0x0
+  801ac9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801acf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ad5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ada:	ba 00 00 00 00       	mov    $0x0,%edx
+  801adf:	be 00 00 00 00       	mov    $0x0,%esi
+  801ae4:	bf 01 00 00 00       	mov    $0x1,%edi
+  801ae9:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801af0:	00 00 00 
+  801af3:	ff d0                	call   *%rax
+  801af5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801af9:	c9                   	leave
+  801afa:	c3                   	ret
+
+0000000000801afb <sys_env_destroy>:
+
+int sys_env_destroy(envid_t envid)
+{
+  801afb:	55                   	push   %rbp
+  801afc:	48 89 e5             	mov    %rsp,%rbp
+  801aff:	48 83 ec 10          	sub    $0x10,%rsp
+  801b03:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	// 销毁envid对应的环境
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801b06:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b09:	48 98                	cltq
+  801b0b:	48 83 ec 08          	sub    $0x8,%rsp
+  801b0f:	6a 00                	push   $0x0
+  801b11:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b17:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b22:	48 89 c2             	mov    %rax,%rdx
+  801b25:	be 01 00 00 00       	mov    $0x1,%esi
+  801b2a:	bf 03 00 00 00       	mov    $0x3,%edi
+  801b2f:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801b36:	00 00 00 
+  801b39:	ff d0                	call   *%rax
+  801b3b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801b3f:	c9                   	leave
+  801b40:	c3                   	ret
+
+0000000000801b41 <sys_getprocid>:
+
+envid_t
+sys_getprocid(void)
+{
+  801b41:	55                   	push   %rbp
+  801b42:	48 89 e5             	mov    %rsp,%rbp
+	// 获取当前用户环境id
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801b45:	48 83 ec 08          	sub    $0x8,%rsp
+  801b49:	6a 00                	push   $0x0
+  801b4b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b51:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b57:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b61:	be 00 00 00 00       	mov    $0x0,%esi
+  801b66:	bf 02 00 00 00       	mov    $0x2,%edi
+  801b6b:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801b72:	00 00 00 
+  801b75:	ff d0                	call   *%rax
+  801b77:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801b7b:	c9                   	leave
+  801b7c:	c3                   	ret
+
+0000000000801b7d <sys_yield>:
+
+void sys_yield(void)
+{
+  801b7d:	55                   	push   %rbp
+  801b7e:	48 89 e5             	mov    %rsp,%rbp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801b81:	48 83 ec 08          	sub    $0x8,%rsp
+  801b85:	6a 00                	push   $0x0
+  801b87:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b8d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b93:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b98:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b9d:	be 00 00 00 00       	mov    $0x0,%esi
+  801ba2:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801ba7:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801bae:	00 00 00 
+  801bb1:	ff d0                	call   *%rax
+  801bb3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801bb7:	90                   	nop
+  801bb8:	c9                   	leave
+  801bb9:	c3                   	ret
+
+0000000000801bba <sys_page_alloc>:
+
+int sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801bba:	55                   	push   %rbp
+  801bbb:	48 89 e5             	mov    %rsp,%rbp
+  801bbe:	48 83 ec 10          	sub    $0x10,%rsp
+  801bc2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801bc5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801bc9:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  801bcc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801bcf:	48 63 c8             	movslq %eax,%rcx
+  801bd2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801bd6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801bd9:	48 98                	cltq
+  801bdb:	48 83 ec 08          	sub    $0x8,%rsp
+  801bdf:	6a 00                	push   $0x0
+  801be1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801be7:	49 89 c8             	mov    %rcx,%r8
+  801bea:	48 89 d1             	mov    %rdx,%rcx
+  801bed:	48 89 c2             	mov    %rax,%rdx
+  801bf0:	be 01 00 00 00       	mov    $0x1,%esi
+  801bf5:	bf 04 00 00 00       	mov    $0x4,%edi
+  801bfa:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801c01:	00 00 00 
+  801c04:	ff d0                	call   *%rax
+  801c06:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c0a:	c9                   	leave
+  801c0b:	c3                   	ret
+
+0000000000801c0c <sys_page_map>:
+
+int sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801c0c:	55                   	push   %rbp
+  801c0d:	48 89 e5             	mov    %rsp,%rbp
+  801c10:	48 83 ec 20          	sub    $0x20,%rsp
+  801c14:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801c17:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801c1b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801c1e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801c22:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  801c26:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801c29:	48 63 c8             	movslq %eax,%rcx
+  801c2c:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  801c30:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801c33:	48 63 f0             	movslq %eax,%rsi
+  801c36:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c3a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801c3d:	48 98                	cltq
+  801c3f:	48 83 ec 08          	sub    $0x8,%rsp
+  801c43:	51                   	push   %rcx
+  801c44:	49 89 f9             	mov    %rdi,%r9
+  801c47:	49 89 f0             	mov    %rsi,%r8
+  801c4a:	48 89 d1             	mov    %rdx,%rcx
+  801c4d:	48 89 c2             	mov    %rax,%rdx
+  801c50:	be 01 00 00 00       	mov    $0x1,%esi
+  801c55:	bf 05 00 00 00       	mov    $0x5,%edi
+  801c5a:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801c61:	00 00 00 
+  801c64:	ff d0                	call   *%rax
+  801c66:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c6a:	c9                   	leave
+  801c6b:	c3                   	ret
+
+0000000000801c6c <sys_page_unmap>:
+
+int sys_page_unmap(envid_t envid, void *va)
+{
+  801c6c:	55                   	push   %rbp
+  801c6d:	48 89 e5             	mov    %rsp,%rbp
+  801c70:	48 83 ec 10          	sub    $0x10,%rsp
+  801c74:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801c77:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  801c7b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c7f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801c82:	48 98                	cltq
+  801c84:	48 83 ec 08          	sub    $0x8,%rsp
+  801c88:	6a 00                	push   $0x0
+  801c8a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801c90:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c96:	48 89 d1             	mov    %rdx,%rcx
+  801c99:	48 89 c2             	mov    %rax,%rdx
+  801c9c:	be 01 00 00 00       	mov    $0x1,%esi
+  801ca1:	bf 06 00 00 00       	mov    $0x6,%edi
+  801ca6:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801cad:	00 00 00 
+  801cb0:	ff d0                	call   *%rax
+  801cb2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801cb6:	c9                   	leave
+  801cb7:	c3                   	ret
+
+0000000000801cb8 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int sys_env_set_status(envid_t envid, int status)
+{
+  801cb8:	55                   	push   %rbp
+  801cb9:	48 89 e5             	mov    %rsp,%rbp
+  801cbc:	48 83 ec 10          	sub    $0x10,%rsp
+  801cc0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801cc3:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801cc6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801cc9:	48 63 d0             	movslq %eax,%rdx
+  801ccc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ccf:	48 98                	cltq
+  801cd1:	48 83 ec 08          	sub    $0x8,%rsp
+  801cd5:	6a 00                	push   $0x0
+  801cd7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801cdd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ce3:	48 89 d1             	mov    %rdx,%rcx
+  801ce6:	48 89 c2             	mov    %rax,%rdx
+  801ce9:	be 01 00 00 00       	mov    $0x1,%esi
+  801cee:	bf 08 00 00 00       	mov    $0x8,%edi
+  801cf3:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801cfa:	00 00 00 
+  801cfd:	ff d0                	call   *%rax
+  801cff:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d03:	c9                   	leave
+  801d04:	c3                   	ret
+
+0000000000801d05 <sys_env_set_trapframe>:
+
+int sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801d05:	55                   	push   %rbp
+  801d06:	48 89 e5             	mov    %rsp,%rbp
+  801d09:	48 83 ec 10          	sub    $0x10,%rsp
+  801d0d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801d10:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  801d14:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d18:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d1b:	48 98                	cltq
+  801d1d:	48 83 ec 08          	sub    $0x8,%rsp
+  801d21:	6a 00                	push   $0x0
+  801d23:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d29:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d2f:	48 89 d1             	mov    %rdx,%rcx
+  801d32:	48 89 c2             	mov    %rax,%rdx
+  801d35:	be 01 00 00 00       	mov    $0x1,%esi
+  801d3a:	bf 09 00 00 00       	mov    $0x9,%edi
+  801d3f:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801d46:	00 00 00 
+  801d49:	ff d0                	call   *%rax
+  801d4b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d4f:	c9                   	leave
+  801d50:	c3                   	ret
+
+0000000000801d51 <sys_env_set_pgfault_upcall>:
+
+int sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801d51:	55                   	push   %rbp
+  801d52:	48 89 e5             	mov    %rsp,%rbp
+  801d55:	48 83 ec 10          	sub    $0x10,%rsp
+  801d59:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801d5c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  801d60:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d64:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d67:	48 98                	cltq
+  801d69:	48 83 ec 08          	sub    $0x8,%rsp
+  801d6d:	6a 00                	push   $0x0
+  801d6f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d75:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d7b:	48 89 d1             	mov    %rdx,%rcx
+  801d7e:	48 89 c2             	mov    %rax,%rdx
+  801d81:	be 01 00 00 00       	mov    $0x1,%esi
+  801d86:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801d8b:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801d92:	00 00 00 
+  801d95:	ff d0                	call   *%rax
+  801d97:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d9b:	c9                   	leave
+  801d9c:	c3                   	ret
+
+0000000000801d9d <sys_ipc_try_send>:
+
+int sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  801d9d:	55                   	push   %rbp
+  801d9e:	48 89 e5             	mov    %rsp,%rbp
+  801da1:	48 83 ec 20          	sub    $0x20,%rsp
+  801da5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801da8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801dac:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801db0:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  801db3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801db6:	48 63 f0             	movslq %eax,%rsi
+  801db9:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801dbd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801dc0:	48 98                	cltq
+  801dc2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801dc6:	48 83 ec 08          	sub    $0x8,%rsp
+  801dca:	6a 00                	push   $0x0
+  801dcc:	49 89 f1             	mov    %rsi,%r9
+  801dcf:	49 89 c8             	mov    %rcx,%r8
+  801dd2:	48 89 d1             	mov    %rdx,%rcx
+  801dd5:	48 89 c2             	mov    %rax,%rdx
+  801dd8:	be 00 00 00 00       	mov    $0x0,%esi
+  801ddd:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801de2:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801de9:	00 00 00 
+  801dec:	ff d0                	call   *%rax
+  801dee:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801df2:	c9                   	leave
+  801df3:	c3                   	ret
+
+0000000000801df4 <sys_ipc_recv>:
+
+int sys_ipc_recv(void *dstva)
+{
+  801df4:	55                   	push   %rbp
+  801df5:	48 89 e5             	mov    %rsp,%rbp
+  801df8:	48 83 ec 10          	sub    $0x10,%rsp
+  801dfc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  801e00:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e04:	48 83 ec 08          	sub    $0x8,%rsp
+  801e08:	6a 00                	push   $0x0
+  801e0a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e10:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e16:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e1b:	48 89 c2             	mov    %rax,%rdx
+  801e1e:	be 01 00 00 00       	mov    $0x1,%esi
+  801e23:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801e28:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801e2f:	00 00 00 
+  801e32:	ff d0                	call   *%rax
+  801e34:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e38:	c9                   	leave
+  801e39:	c3                   	ret
+
+0000000000801e3a <sys_disk_io>:
+
+int sys_disk_io(int dev, uint64_t secno, void *va, size_t nsecs, int write)
+{
+  801e3a:	55                   	push   %rbp
+  801e3b:	48 89 e5             	mov    %rsp,%rbp
+  801e3e:	48 83 ec 20          	sub    $0x20,%rsp
+  801e42:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e45:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801e49:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801e4d:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  801e51:	44 89 45 f8          	mov    %r8d,-0x8(%rbp)
+	return syscall(SYS_disk_io, 0, dev, secno, (uint64_t)va, nsecs, write);
+  801e55:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801e58:	48 63 c8             	movslq %eax,%rcx
+  801e5b:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  801e5f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e62:	48 98                	cltq
+  801e64:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  801e68:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e6c:	48 83 ec 08          	sub    $0x8,%rsp
+  801e70:	51                   	push   %rcx
+  801e71:	49 89 f9             	mov    %rdi,%r9
+  801e74:	49 89 f0             	mov    %rsi,%r8
+  801e77:	48 89 d1             	mov    %rdx,%rcx
+  801e7a:	48 89 c2             	mov    %rax,%rdx
+  801e7d:	be 00 00 00 00       	mov    $0x0,%esi
+  801e82:	bf 0e 00 00 00       	mov    $0xe,%edi
+  801e87:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801e8e:	00 00 00 
+  801e91:	ff d0                	call   *%rax
+  801e93:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e97:	c9                   	leave
+  801e98:	c3                   	ret
+
+0000000000801e99 <sys_vma_alloc>:
+
+int sys_vma_alloc(envid_t envid, void *va, size_t len, int perm)
+{
+  801e99:	55                   	push   %rbp
+  801e9a:	48 89 e5             	mov    %rsp,%rbp
+  801e9d:	48 83 ec 20          	sub    $0x20,%rsp
+  801ea1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801ea4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801ea8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801eac:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_vma_alloc, 1, envid, (uint64_t)va, len, perm, 0);
+  801eaf:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801eb2:	48 63 f0             	movslq %eax,%rsi
+  801eb5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801eb9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ebc:	48 98                	cltq
+  801ebe:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801ec2:	48 83 ec 08          	sub    $0x8,%rsp
+  801ec6:	6a 00                	push   $0x0
+  801ec8:	49 89 f1             	mov    %rsi,%r9
+  801ecb:	49 89 c8             	mov    %rcx,%r8
+  801ece:	48 89 d1             	mov    %rdx,%rcx
+  801ed1:	48 89 c2             	mov    %rax,%rdx
+  801ed4:	be 01 00 00 00       	mov    $0x1,%esi
+  801ed9:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801ede:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801ee5:	00 00 00 
+  801ee8:	ff d0                	call   *%rax
+  801eea:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801eee:	c9                   	leave
+  801eef:	c3                   	ret
+
+0000000000801ef0 <sys_vma_clear>:
+
+int sys_vma_clear(envid_t envid)
+{
+  801ef0:	55                   	push   %rbp
+  801ef1:	48 89 e5             	mov    %rsp,%rbp
+  801ef4:	48 83 ec 10          	sub    $0x10,%rsp
+  801ef8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_vma_clear, 1, envid, 0, 0, 0, 0);
+  801efb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801efe:	48 98                	cltq
+  801f00:	48 83 ec 08          	sub    $0x8,%rsp
+  801f04:	6a 00                	push   $0x0
+  801f06:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f0c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f12:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f17:	48 89 c2             	mov    %rax,%rdx
+  801f1a:	be 01 00 00 00       	mov    $0x1,%esi
+  801f1f:	bf 10 00 00 00       	mov    $0x10,%edi
+  801f24:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801f2b:	00 00 00 
+  801f2e:	ff d0                	call   *%rax
+  801f30:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f34:	c9                   	leave
+  801f35:	c3                   	ret
+
+0000000000801f36 <sys_trace_ctl>:
+
+int sys_trace_ctl(int enable)
+{
+  801f36:	55                   	push   %rbp
+  801f37:	48 89 e5             	mov    %rsp,%rbp
+  801f3a:	48 83 ec 10          	sub    $0x10,%rsp
+  801f3e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_trace_ctl, 0, enable, 0, 0, 0, 0);
+  801f41:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f44:	48 98                	cltq
+  801f46:	48 83 ec 08          	sub    $0x8,%rsp
+  801f4a:	6a 00                	push   $0x0
+  801f4c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f52:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f58:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f5d:	48 89 c2             	mov    %rax,%rdx
+  801f60:	be 00 00 00 00       	mov    $0x0,%esi
+  801f65:	bf 11 00 00 00       	mov    $0x11,%edi
+  801f6a:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801f71:	00 00 00 
+  801f74:	ff d0                	call   *%rax
+  801f76:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f7a:	c9                   	leave
+  801f7b:	c3                   	ret
+
+0000000000801f7c <sys_trace_read>:
+
+int sys_trace_read(int cpu, uint64_t *seq, struct TraceEvent *buf, int n)
+{
+  801f7c:	55                   	push   %rbp
+  801f7d:	48 89 e5             	mov    %rsp,%rbp
+  801f80:	48 83 ec 20          	sub    $0x20,%rsp
+  801f84:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f87:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f8b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801f8f:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_trace_read, 0, cpu, (uint64_t)seq, (uint64_t)buf, n, 0);
+  801f92:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801f95:	48 63 f0             	movslq %eax,%rsi
+  801f98:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801f9c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801fa0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fa3:	48 98                	cltq
+  801fa5:	48 83 ec 08          	sub    $0x8,%rsp
+  801fa9:	6a 00                	push   $0x0
+  801fab:	49 89 f1             	mov    %rsi,%r9
+  801fae:	49 89 c8             	mov    %rcx,%r8
+  801fb1:	48 89 d1             	mov    %rdx,%rcx
+  801fb4:	48 89 c2             	mov    %rax,%rdx
+  801fb7:	be 00 00 00 00       	mov    $0x0,%esi
+  801fbc:	bf 12 00 00 00       	mov    $0x12,%edi
+  801fc1:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801fc8:	00 00 00 
+  801fcb:	ff d0                	call   *%rax
+  801fcd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fd1:	c9                   	leave
+  801fd2:	c3                   	ret
+
+0000000000801fd3 <sys_getrusage>:
+
+int sys_getrusage(envid_t envid, struct Rusage *ru)
+{
+  801fd3:	55                   	push   %rbp
+  801fd4:	48 89 e5             	mov    %rsp,%rbp
+  801fd7:	48 83 ec 10          	sub    $0x10,%rsp
+  801fdb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801fde:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_getrusage, 0, envid, (uint64_t)ru, 0, 0, 0);
+  801fe2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801fe6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fe9:	48 98                	cltq
+  801feb:	48 83 ec 08          	sub    $0x8,%rsp
+  801fef:	6a 00                	push   $0x0
+  801ff1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ff7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ffd:	48 89 d1             	mov    %rdx,%rcx
+  802000:	48 89 c2             	mov    %rax,%rdx
+  802003:	be 00 00 00 00       	mov    $0x0,%esi
+  802008:	bf 13 00 00 00       	mov    $0x13,%edi
+  80200d:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  802014:	00 00 00 
+  802017:	ff d0                	call   *%rax
+  802019:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80201d:	c9                   	leave
+  80201e:	c3                   	ret
+
+000000000080201f <sys_pmu_config>:
+
+int sys_pmu_config(int idx, uint64_t event)
+{
+  80201f:	55                   	push   %rbp
+  802020:	48 89 e5             	mov    %rsp,%rbp
+  802023:	48 83 ec 10          	sub    $0x10,%rsp
+  802027:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80202a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_pmu_config, 0, idx, event, 0, 0, 0);
+  80202e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802031:	48 98                	cltq
+  802033:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802037:	48 83 ec 08          	sub    $0x8,%rsp
+  80203b:	6a 00                	push   $0x0
+  80203d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802043:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802049:	48 89 d1             	mov    %rdx,%rcx
+  80204c:	48 89 c2             	mov    %rax,%rdx
+  80204f:	be 00 00 00 00       	mov    $0x0,%esi
+  802054:	bf 14 00 00 00       	mov    $0x14,%edi
+  802059:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  802060:	00 00 00 
+  802063:	ff d0                	call   *%rax
+  802065:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802069:	c9                   	leave
+  80206a:	c3                   	ret
+
+000000000080206b <sys_env_find>:
+
+envid_t
+sys_env_find(enum EnvType type)
+{
+  80206b:	55                   	push   %rbp
+  80206c:	48 89 e5             	mov    %rsp,%rbp
+  80206f:	48 83 ec 10          	sub    $0x10,%rsp
+  802073:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_find, 0, type, 0, 0, 0, 0);
+  802076:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802079:	48 83 ec 08          	sub    $0x8,%rsp
+  80207d:	6a 00                	push   $0x0
+  80207f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802085:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80208b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802090:	48 89 c2             	mov    %rax,%rdx
+  802093:	be 00 00 00 00       	mov    $0x0,%esi
+  802098:	bf 15 00 00 00       	mov    $0x15,%edi
+  80209d:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  8020a4:	00 00 00 
+  8020a7:	ff d0                	call   *%rax
+  8020a9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020ad:	c9                   	leave
+  8020ae:	c3                   	ret
+
+00000000008020af <sys_image_attach>:
+
+int sys_image_attach(envid_t envid, int dev, const uint64_t *secnos, size_t size)
+{
+  8020af:	55                   	push   %rbp
+  8020b0:	48 89 e5             	mov    %rsp,%rbp
+  8020b3:	48 83 ec 20          	sub    $0x20,%rsp
+  8020b7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020ba:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  8020bd:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8020c1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+	return syscall(SYS_image_attach, 1, envid, dev, (uint64_t)secnos, size, 0);
+  8020c5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8020c9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8020cc:	48 63 d0             	movslq %eax,%rdx
+  8020cf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020d2:	48 98                	cltq
+  8020d4:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8020d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8020dc:	6a 00                	push   $0x0
+  8020de:	49 89 f1             	mov    %rsi,%r9
+  8020e1:	49 89 c8             	mov    %rcx,%r8
+  8020e4:	48 89 d1             	mov    %rdx,%rcx
+  8020e7:	48 89 c2             	mov    %rax,%rdx
+  8020ea:	be 01 00 00 00       	mov    $0x1,%esi
+  8020ef:	bf 16 00 00 00       	mov    $0x16,%edi
+  8020f4:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  8020fb:	00 00 00 
+  8020fe:	ff d0                	call   *%rax
+  802100:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802104:	c9                   	leave
+  802105:	c3                   	ret
+
+0000000000802106 <sys_vma_binary>:
+
+int sys_vma_binary(envid_t envid, const struct Proghdr *ph)
+{
+  802106:	55                   	push   %rbp
+  802107:	48 89 e5             	mov    %rsp,%rbp
+  80210a:	48 83 ec 10          	sub    $0x10,%rsp
+  80210e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802111:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_vma_binary, 1, envid, (uint64_t)ph, 0, 0, 0);
+  802115:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802119:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80211c:	48 98                	cltq
+  80211e:	48 83 ec 08          	sub    $0x8,%rsp
+  802122:	6a 00                	push   $0x0
+  802124:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80212a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802130:	48 89 d1             	mov    %rdx,%rcx
+  802133:	48 89 c2             	mov    %rax,%rdx
+  802136:	be 01 00 00 00       	mov    $0x1,%esi
+  80213b:	bf 17 00 00 00       	mov    $0x17,%edi
+  802140:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  802147:	00 00 00 
+  80214a:	ff d0                	call   *%rax
+  80214c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802150:	c9                   	leave
+  802151:	c3                   	ret
+
+0000000000802152 <_panic>:
+/*
+ * 无法解决的致命错误会导致死机
+ * 打印"死机:<消息>”，然后导致处理器休眠进入HLT状态
+ */
+void _panic(const char *file, int line, const char *fmt, ...)
+{
+  802152:	55                   	push   %rbp
+  802153:	48 89 e5             	mov    %rsp,%rbp
+  802156:	53                   	push   %rbx
+  802157:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80215e:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  802165:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  80216b:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  802172:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  802179:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  802180:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  802187:	84 c0                	test   %al,%al
+  802189:	74 23                	je     8021ae <_panic+0x5c>
+  80218b:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  802192:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  802196:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  80219a:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  80219e:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  8021a2:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  8021a6:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  8021aa:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8021ae:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  8021b5:	00 00 00 
+  8021b8:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  8021bf:	00 00 00 
+  8021c2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8021c6:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  8021cd:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  8021d4:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+	// 输出死机的信息
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8021db:	48 b8 00 30 80 00 00 	movabs $0x803000,%rax
+  8021e2:	00 00 00 
+  8021e5:	48 8b 18             	mov    (%rax),%rbx
+  8021e8:	48 b8 41 1b 80 00 00 	movabs $0x801b41,%rax
+  8021ef:	00 00 00 
+  8021f2:	ff d0                	call   *%rax
+  8021f4:	89 c6                	mov    %eax,%esi
+  8021f6:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  8021fc:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  802203:	41 89 d0             	mov    %edx,%r8d
+  802206:	48 89 c1             	mov    %rax,%rcx
+  802209:	48 89 da             	mov    %rbx,%rdx
+  80220c:	48 b8 f8 27 80 00 00 	movabs $0x8027f8,%rax
+  802213:	00 00 00 
+  802216:	48 89 c7             	mov    %rax,%rdi
+  802219:	b8 00 00 00 00       	mov    $0x0,%eax
+  80221e:	49 b9 ce 02 80 00 00 	movabs $0x8002ce,%r9
+  802225:	00 00 00 
+  802228:	41 ff d1             	call   *%r9
+			sys_getprocid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80222b:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  802232:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  802239:	48 89 d6             	mov    %rdx,%rsi
+  80223c:	48 89 c7             	mov    %rax,%rdi
+  80223f:	48 b8 1f 02 80 00 00 	movabs $0x80021f,%rax
+  802246:	00 00 00 
+  802249:	ff d0                	call   *%rax
+	cprintf("\n");
+  80224b:	48 b8 1b 28 80 00 00 	movabs $0x80281b,%rax
+  802252:	00 00 00 
+  802255:	48 89 c7             	mov    %rax,%rdi
+  802258:	b8 00 00 00 00       	mov    $0x0,%eax
+  80225d:	48 ba ce 02 80 00 00 	movabs $0x8002ce,%rdx
+  802264:	00 00 00 
+  802267:	ff d2                	call   *%rdx
+
+	// 触发断点中断
+	while (1)
+		asm volatile("int3");
+  802269:	cc                   	int3
+  80226a:	eb fd                	jmp    802269 <_panic+0x117>
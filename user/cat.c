@@ -0,0 +1,34 @@
+// 通过文件系统服务器读取文件并输出到控制台
+
+#include "inc/lib.h"
+
+char buf[8192];
+
+void cat(const char *path)
+{
+	int fd;
+	ssize_t n;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+	{
+		cprintf("cat: open %s: %e\n", path, fd);
+		return;
+	}
+	while ((n = read(fd, buf, sizeof(buf))) > 0)
+		sys_cputs(buf, n);
+	if (n < 0)
+		cprintf("cat: read %s: %e\n", path, n);
+	close(fd);
+}
+
+void umain(int argc, char **argv)
+{
+	int i;
+
+	binaryname = "cat";
+	if (argc < 2)
+		cat("/motd");
+	else
+		for (i = 1; i < argc; i++)
+			cat(argv[i]);
+}
@@ -0,0 +1,29 @@
+// 内核创建的第一个用户环境: 从文件系统装入并启动其他用户程序
+
+#include "inc/lib.h"
+
+// 启动时依次运行的程序(文件系统根目录中的路径)
+static const char *progs[] = {
+	"/testbss",
+	// "/loadDS",
+	// "/stresssched",
+	// "/sendpage",
+	// "/primes",
+	// "/cat",
+	NULL};
+
+void umain(int argc, char **argv)
+{
+	const char **p;
+	const char *name;
+	envid_t r;
+
+	binaryname = "init";
+	for (p = progs; *p; p++)
+	{
+		// argv[0] 为去掉 '/' 的程序名
+		name = (*p)[0] == '/' ? *p + 1 : *p;
+		if ((r = spawnl(*p, name, (const char *)NULL)) < 0)
+			cprintf("init: spawn %s: %e\n", *p, r);
+	}
+}
@@ -0,0 +1,35 @@
+// 打开内核跟踪，让出几次 CPU，然后从每个 CPU 的跟踪环形缓冲区读出事件并输出
+// 跟踪系统调用只对特权环境开放，需要由内核以 PROC_TYPE_PRIV 创建(kern/init.c)
+
+#include "inc/lib.h"
+
+// 用户程序不知道 CPU 的个数，依次读取的 CPU 数上限(与内核的 NCPU 相同)
+#define MAXCPU 8
+
+struct TraceEvent evs[64];
+
+void umain(int argc, char **argv)
+{
+	uint64_t seq;
+	int cpu, i, n;
+
+	if ((n = sys_trace_ctl(1)) < 0)
+	{
+		cprintf("tracedump: %e\n", n);
+		return;
+	}
+	for (i = 0; i < 4; i++)
+		sys_yield();
+	sys_trace_ctl(0);
+
+	for (cpu = 0; cpu < MAXCPU; cpu++)
+	{
+		// 流式读取: 每次从上次读到的序号继续
+		seq = 0;
+		while ((n = sys_trace_read(cpu, &seq, evs, sizeof(evs) / sizeof(evs[0]))) > 0)
+			for (i = 0; i < n; i++)
+				cprintf("cpu %d [%08x] %-9s %016llx %016llx\n", evs[i].te_cpu, evs[i].te_envid,
+						trace_name(evs[i].te_id),
+						evs[i].te_args[0], evs[i].te_args[1]);
+	}
+}